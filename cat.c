@@ -9,6 +9,17 @@ cat(int fd)
 {
   int n;
 
+  // When fd is a file, or fd or stdout is a pipe, let the
+  // kernel move the data without copying it through buf.
+  while((n = sendfile(1, fd, 4096)) > 0)
+    ;
+  if(n == 0)
+    return;
+  while((n = splice(fd, 1, 4096)) > 0)
+    ;
+  if(n == 0)
+    return;
+
   while((n = read(fd, buf, sizeof(buf))) > 0) {
     if (write(1, buf, n) != n) {
       printf(1, "cat: write error\n");
@@ -237,6 +237,7 @@ consoleread(struct inode *ip, char *dst, int n)
 {
   uint target;
   int c;
+  char ch;
 
   iunlock(ip);
   target = n;
@@ -259,7 +260,17 @@ consoleread(struct inode *ip, char *dst, int n)
       }
       break;
     }
-    *dst++ = c;
+    ch = c;
+    if(umove(dst++, &ch, 1) != 0){
+      // dst cannot be written; leave c for the next read.
+      input.r--;
+      if(n == target){
+        release(&cons.lock);
+        ilock(ip);
+        return -1;
+      }
+      break;
+    }
     --n;
     if(c == '\n')
       break;
@@ -274,15 +285,16 @@ int
 consolewrite(struct inode *ip, char *buf, int n)
 {
   int i;
+  char c;
 
   iunlock(ip);
   acquire(&cons.lock);
-  for(i = 0; i < n; i++)
-    consputc(buf[i] & 0xff);
+  for(i = 0; i < n && umove(&c, buf + i, 1) == 0; i++)
+    consputc(c & 0xff);
   release(&cons.lock);
   ilock(ip);
 
-  return n;
+  return i > 0 || n == 0 ? i : -1;
 }
 
 void
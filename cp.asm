@@ -0,0 +1,2300 @@
+
+_cp:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "user.h"
+#include "fcntl.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 38             	sub    $0x38,%esp
+  int in, out, n;
+  struct stat st, dst;
+
+  if(argc != 3){
+  14:	83 39 03             	cmpl   $0x3,(%ecx)
+{
+  17:	8b 71 04             	mov    0x4(%ecx),%esi
+  if(argc != 3){
+  1a:	74 13                	je     2f <main+0x2f>
+    printf(2, "Usage: cp src dst\n");
+  1c:	50                   	push   %eax
+  1d:	50                   	push   %eax
+  1e:	68 e8 0f 00 00       	push   $0xfe8
+  23:	6a 02                	push   $0x2
+  25:	e8 86 0b 00 00       	call   bb0 <printf>
+    exit();
+  2a:	e8 f1 03 00 00       	call   420 <exit>
+  }
+  if((in = open(argv[1], O_RDONLY)) < 0){
+  2f:	50                   	push   %eax
+  30:	50                   	push   %eax
+  31:	6a 00                	push   $0x0
+  33:	ff 76 04             	push   0x4(%esi)
+  36:	e8 35 06 00 00       	call   670 <open>
+  3b:	83 c4 10             	add    $0x10,%esp
+  3e:	89 c3                	mov    %eax,%ebx
+  40:	85 c0                	test   %eax,%eax
+  42:	78 2f                	js     73 <main+0x73>
+    printf(2, "cp: cannot open %s\n", argv[1]);
+    exit();
+  }
+  if(fstat(in, &st) < 0 || st.type != T_FILE){
+  44:	50                   	push   %eax
+  45:	50                   	push   %eax
+  46:	8d 45 c0             	lea    -0x40(%ebp),%eax
+  49:	50                   	push   %eax
+  4a:	53                   	push   %ebx
+  4b:	e8 38 06 00 00       	call   688 <fstat>
+  50:	83 c4 10             	add    $0x10,%esp
+  53:	85 c0                	test   %eax,%eax
+  55:	78 07                	js     5e <main+0x5e>
+  57:	66 83 7d c0 02       	cmpw   $0x2,-0x40(%ebp)
+  5c:	74 2a                	je     88 <main+0x88>
+    printf(2, "cp: %s is not a file\n", argv[1]);
+  5e:	50                   	push   %eax
+  5f:	ff 76 04             	push   0x4(%esi)
+  62:	68 0f 10 00 00       	push   $0x100f
+  67:	6a 02                	push   $0x2
+  69:	e8 42 0b 00 00       	call   bb0 <printf>
+    exit();
+  6e:	e8 ad 03 00 00       	call   420 <exit>
+    printf(2, "cp: cannot open %s\n", argv[1]);
+  73:	50                   	push   %eax
+  74:	ff 76 04             	push   0x4(%esi)
+  77:	68 fb 0f 00 00       	push   $0xffb
+  7c:	6a 02                	push   $0x2
+  7e:	e8 2d 0b 00 00       	call   bb0 <printf>
+    exit();
+  83:	e8 98 03 00 00       	call   420 <exit>
+  }
+  // There is no O_TRUNC: start from an empty file, but
+  // never by unlinking the source.
+  if(stat(argv[2], &dst) == 0 && dst.type == T_FILE){
+  88:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+  8b:	57                   	push   %edi
+  8c:	57                   	push   %edi
+  8d:	50                   	push   %eax
+  8e:	ff 76 08             	push   0x8(%esi)
+  91:	e8 8a 02 00 00       	call   320 <stat>
+  96:	83 c4 10             	add    $0x10,%esp
+  99:	85 c0                	test   %eax,%eax
+  9b:	75 0a                	jne    a7 <main+0xa7>
+  9d:	66 83 7d d4 02       	cmpw   $0x2,-0x2c(%ebp)
+    if(dst.dev == st.dev && dst.ino == st.ino){
+      printf(2, "cp: %s and %s are the same file\n", argv[1], argv[2]);
+  a2:	8b 46 08             	mov    0x8(%esi),%eax
+  if(stat(argv[2], &dst) == 0 && dst.type == T_FILE){
+  a5:	74 70                	je     117 <main+0x117>
+      exit();
+    }
+    unlink(argv[2]);
+  }
+  if((out = open(argv[2], O_CREATE|O_WRONLY)) < 0){
+  a7:	51                   	push   %ecx
+  a8:	51                   	push   %ecx
+  a9:	68 01 02 00 00       	push   $0x201
+  ae:	ff 76 08             	push   0x8(%esi)
+  b1:	e8 ba 05 00 00       	call   670 <open>
+  b6:	83 c4 10             	add    $0x10,%esp
+  b9:	89 c7                	mov    %eax,%edi
+  bb:	85 c0                	test   %eax,%eax
+  bd:	78 2c                	js     eb <main+0xeb>
+    printf(2, "cp: cannot create %s\n", argv[2]);
+    exit();
+  }
+  while((n = sendfile(out, in, 64*1024)) > 0)
+  bf:	50                   	push   %eax
+  c0:	68 00 00 01 00       	push   $0x10000
+  c5:	53                   	push   %ebx
+  c6:	57                   	push   %edi
+  c7:	e8 84 06 00 00       	call   750 <sendfile>
+  cc:	83 c4 10             	add    $0x10,%esp
+  cf:	85 c0                	test   %eax,%eax
+  d1:	7f ec                	jg     bf <main+0xbf>
+    ;
+  if(n < 0)
+  d3:	75 2b                	jne    100 <main+0x100>
+    printf(2, "cp: %s to %s: copy failed\n", argv[1], argv[2]);
+  close(in);
+  d5:	83 ec 0c             	sub    $0xc,%esp
+  d8:	53                   	push   %ebx
+  d9:	e8 92 04 00 00       	call   570 <close>
+  close(out);
+  de:	89 3c 24             	mov    %edi,(%esp)
+  e1:	e8 8a 04 00 00       	call   570 <close>
+  exit();
+  e6:	e8 35 03 00 00       	call   420 <exit>
+    printf(2, "cp: cannot create %s\n", argv[2]);
+  eb:	52                   	push   %edx
+  ec:	ff 76 08             	push   0x8(%esi)
+  ef:	68 25 10 00 00       	push   $0x1025
+  f4:	6a 02                	push   $0x2
+  f6:	e8 b5 0a 00 00       	call   bb0 <printf>
+    exit();
+  fb:	e8 20 03 00 00       	call   420 <exit>
+    printf(2, "cp: %s to %s: copy failed\n", argv[1], argv[2]);
+ 100:	ff 76 08             	push   0x8(%esi)
+ 103:	ff 76 04             	push   0x4(%esi)
+ 106:	68 3b 10 00 00       	push   $0x103b
+ 10b:	6a 02                	push   $0x2
+ 10d:	e8 9e 0a 00 00       	call   bb0 <printf>
+ 112:	83 c4 10             	add    $0x10,%esp
+ 115:	eb be                	jmp    d5 <main+0xd5>
+    if(dst.dev == st.dev && dst.ino == st.ino){
+ 117:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+ 11a:	39 55 d8             	cmp    %edx,-0x28(%ebp)
+ 11d:	75 08                	jne    127 <main+0x127>
+ 11f:	8b 55 c8             	mov    -0x38(%ebp),%edx
+ 122:	39 55 dc             	cmp    %edx,-0x24(%ebp)
+ 125:	74 11                	je     138 <main+0x138>
+    unlink(argv[2]);
+ 127:	83 ec 0c             	sub    $0xc,%esp
+ 12a:	50                   	push   %eax
+ 12b:	e8 50 05 00 00       	call   680 <unlink>
+ 130:	83 c4 10             	add    $0x10,%esp
+ 133:	e9 6f ff ff ff       	jmp    a7 <main+0xa7>
+      printf(2, "cp: %s and %s are the same file\n", argv[1], argv[2]);
+ 138:	50                   	push   %eax
+ 139:	ff 76 04             	push   0x4(%esi)
+ 13c:	68 58 10 00 00       	push   $0x1058
+ 141:	6a 02                	push   $0x2
+ 143:	e8 68 0a 00 00       	call   bb0 <printf>
+      exit();
+ 148:	e8 d3 02 00 00       	call   420 <exit>
+ 14d:	66 90                	xchg   %ax,%ax
+ 14f:	90                   	nop
+
+00000150 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 150:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 151:	31 c0                	xor    %eax,%eax
+{
+ 153:	89 e5                	mov    %esp,%ebp
+ 155:	53                   	push   %ebx
+ 156:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 159:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 15c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 160:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 164:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 167:	83 c0 01             	add    $0x1,%eax
+ 16a:	84 d2                	test   %dl,%dl
+ 16c:	75 f2                	jne    160 <strcpy+0x10>
+    ;
+  return os;
+}
+ 16e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 171:	89 c8                	mov    %ecx,%eax
+ 173:	c9                   	leave
+ 174:	c3                   	ret
+ 175:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000180 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 180:	55                   	push   %ebp
+ 181:	89 e5                	mov    %esp,%ebp
+ 183:	53                   	push   %ebx
+ 184:	8b 55 08             	mov    0x8(%ebp),%edx
+ 187:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 18a:	0f b6 02             	movzbl (%edx),%eax
+ 18d:	84 c0                	test   %al,%al
+ 18f:	75 17                	jne    1a8 <strcmp+0x28>
+ 191:	eb 3a                	jmp    1cd <strcmp+0x4d>
+ 193:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 197:	90                   	nop
+ 198:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 19c:	83 c2 01             	add    $0x1,%edx
+ 19f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 1a2:	84 c0                	test   %al,%al
+ 1a4:	74 1a                	je     1c0 <strcmp+0x40>
+    p++, q++;
+ 1a6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 1a8:	0f b6 19             	movzbl (%ecx),%ebx
+ 1ab:	38 c3                	cmp    %al,%bl
+ 1ad:	74 e9                	je     198 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 1af:	29 d8                	sub    %ebx,%eax
+}
+ 1b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1b4:	c9                   	leave
+ 1b5:	c3                   	ret
+ 1b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1bd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 1c0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 1c4:	31 c0                	xor    %eax,%eax
+ 1c6:	29 d8                	sub    %ebx,%eax
+}
+ 1c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1cb:	c9                   	leave
+ 1cc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 1cd:	0f b6 19             	movzbl (%ecx),%ebx
+ 1d0:	31 c0                	xor    %eax,%eax
+ 1d2:	eb db                	jmp    1af <strcmp+0x2f>
+ 1d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1df:	90                   	nop
+
+000001e0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1e6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1e9:	74 15                	je     200 <strlen+0x20>
+ 1eb:	31 c0                	xor    %eax,%eax
+ 1ed:	8d 76 00             	lea    0x0(%esi),%esi
+ 1f0:	83 c0 01             	add    $0x1,%eax
+ 1f3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1f7:	89 c1                	mov    %eax,%ecx
+ 1f9:	75 f5                	jne    1f0 <strlen+0x10>
+    ;
+  return n;
+}
+ 1fb:	89 c8                	mov    %ecx,%eax
+ 1fd:	5d                   	pop    %ebp
+ 1fe:	c3                   	ret
+ 1ff:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 200:	31 c9                	xor    %ecx,%ecx
+}
+ 202:	5d                   	pop    %ebp
+ 203:	89 c8                	mov    %ecx,%eax
+ 205:	c3                   	ret
+ 206:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000210 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+ 213:	57                   	push   %edi
+ 214:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 217:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 21a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 21d:	89 d7                	mov    %edx,%edi
+ 21f:	fc                   	cld
+ 220:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 222:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 225:	89 d0                	mov    %edx,%eax
+ 227:	c9                   	leave
+ 228:	c3                   	ret
+ 229:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000230 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	56                   	push   %esi
+ 234:	53                   	push   %ebx
+ 235:	8b 75 10             	mov    0x10(%ebp),%esi
+ 238:	8b 55 08             	mov    0x8(%ebp),%edx
+ 23b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+ 23e:	85 f6                	test   %esi,%esi
+ 240:	74 2e                	je     270 <memcmp+0x40>
+ 242:	01 c6                	add    %eax,%esi
+ 244:	eb 14                	jmp    25a <memcmp+0x2a>
+ 246:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+ 250:	83 c0 01             	add    $0x1,%eax
+ 253:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+ 256:	39 f0                	cmp    %esi,%eax
+ 258:	74 16                	je     270 <memcmp+0x40>
+    if(*s1 != *s2)
+ 25a:	0f b6 0a             	movzbl (%edx),%ecx
+ 25d:	0f b6 18             	movzbl (%eax),%ebx
+ 260:	38 d9                	cmp    %bl,%cl
+ 262:	74 ec                	je     250 <memcmp+0x20>
+      return *s1 - *s2;
+ 264:	0f b6 c1             	movzbl %cl,%eax
+ 267:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+ 269:	5b                   	pop    %ebx
+ 26a:	5e                   	pop    %esi
+ 26b:	5d                   	pop    %ebp
+ 26c:	c3                   	ret
+ 26d:	8d 76 00             	lea    0x0(%esi),%esi
+ 270:	5b                   	pop    %ebx
+  return 0;
+ 271:	31 c0                	xor    %eax,%eax
+}
+ 273:	5e                   	pop    %esi
+ 274:	5d                   	pop    %ebp
+ 275:	c3                   	ret
+ 276:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000280 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	8b 45 08             	mov    0x8(%ebp),%eax
+ 286:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 28a:	0f b6 10             	movzbl (%eax),%edx
+ 28d:	84 d2                	test   %dl,%dl
+ 28f:	75 12                	jne    2a3 <strchr+0x23>
+ 291:	eb 1d                	jmp    2b0 <strchr+0x30>
+ 293:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 297:	90                   	nop
+ 298:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 29c:	83 c0 01             	add    $0x1,%eax
+ 29f:	84 d2                	test   %dl,%dl
+ 2a1:	74 0d                	je     2b0 <strchr+0x30>
+    if(*s == c)
+ 2a3:	38 d1                	cmp    %dl,%cl
+ 2a5:	75 f1                	jne    298 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 2a7:	5d                   	pop    %ebp
+ 2a8:	c3                   	ret
+ 2a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 2b0:	31 c0                	xor    %eax,%eax
+}
+ 2b2:	5d                   	pop    %ebp
+ 2b3:	c3                   	ret
+ 2b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2bf:	90                   	nop
+
+000002c0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	57                   	push   %edi
+ 2c4:	56                   	push   %esi
+int
+read(int fd, void *buf, int n)
+{
+  if(flushhook)
+    flushhook();
+  return _read(fd, buf, n);
+ 2c5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 2c8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 2c9:	31 db                	xor    %ebx,%ebx
+{
+ 2cb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 2ce:	eb 32                	jmp    302 <gets+0x42>
+  if(flushhook)
+ 2d0:	a1 10 22 00 00       	mov    0x2210,%eax
+ 2d5:	85 c0                	test   %eax,%eax
+ 2d7:	74 02                	je     2db <gets+0x1b>
+    flushhook();
+ 2d9:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+ 2db:	83 ec 04             	sub    $0x4,%esp
+ 2de:	6a 01                	push   $0x1
+ 2e0:	56                   	push   %esi
+ 2e1:	6a 00                	push   $0x0
+ 2e3:	e8 60 03 00 00       	call   648 <_read>
+    if(cc < 1)
+ 2e8:	83 c4 10             	add    $0x10,%esp
+ 2eb:	85 c0                	test   %eax,%eax
+ 2ed:	7e 1d                	jle    30c <gets+0x4c>
+    buf[i++] = c;
+ 2ef:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 2f3:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2f6:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 2fa:	3c 0a                	cmp    $0xa,%al
+ 2fc:	74 10                	je     30e <gets+0x4e>
+ 2fe:	3c 0d                	cmp    $0xd,%al
+ 300:	74 0c                	je     30e <gets+0x4e>
+  for(i=0; i+1 < max; ){
+ 302:	89 df                	mov    %ebx,%edi
+ 304:	83 c3 01             	add    $0x1,%ebx
+ 307:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 30a:	7c c4                	jl     2d0 <gets+0x10>
+ 30c:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+ 30e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 311:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+ 315:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 318:	5b                   	pop    %ebx
+ 319:	5e                   	pop    %esi
+ 31a:	5f                   	pop    %edi
+ 31b:	5d                   	pop    %ebp
+ 31c:	c3                   	ret
+ 31d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000320 <stat>:
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	56                   	push   %esi
+ 324:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+ 325:	83 ec 08             	sub    $0x8,%esp
+ 328:	6a 00                	push   $0x0
+ 32a:	ff 75 08             	push   0x8(%ebp)
+ 32d:	e8 3e 03 00 00       	call   670 <open>
+  if(fd < 0)
+ 332:	83 c4 10             	add    $0x10,%esp
+ 335:	85 c0                	test   %eax,%eax
+ 337:	78 37                	js     370 <stat+0x50>
+  r = fstat(fd, st);
+ 339:	83 ec 08             	sub    $0x8,%esp
+ 33c:	ff 75 0c             	push   0xc(%ebp)
+ 33f:	89 c3                	mov    %eax,%ebx
+ 341:	50                   	push   %eax
+ 342:	e8 41 03 00 00       	call   688 <fstat>
+}
+
+int
+close(int fd)
+{
+  if(flushhook)
+ 347:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+ 34a:	89 c6                	mov    %eax,%esi
+  if(flushhook)
+ 34c:	a1 10 22 00 00       	mov    0x2210,%eax
+ 351:	85 c0                	test   %eax,%eax
+ 353:	74 02                	je     357 <stat+0x37>
+    flushhook();
+ 355:	ff d0                	call   *%eax
+  return _close(fd);
+ 357:	83 ec 0c             	sub    $0xc,%esp
+ 35a:	53                   	push   %ebx
+ 35b:	e8 f8 02 00 00       	call   658 <_close>
+ 360:	83 c4 10             	add    $0x10,%esp
+}
+ 363:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 366:	89 f0                	mov    %esi,%eax
+ 368:	5b                   	pop    %ebx
+ 369:	5e                   	pop    %esi
+ 36a:	5d                   	pop    %ebp
+ 36b:	c3                   	ret
+ 36c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+ 370:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 375:	eb ec                	jmp    363 <stat+0x43>
+ 377:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 37e:	66 90                	xchg   %ax,%ax
+
+00000380 <atoi>:
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+ 383:	53                   	push   %ebx
+ 384:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+ 387:	0f be 02             	movsbl (%edx),%eax
+ 38a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 38d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 390:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 395:	77 1e                	ja     3b5 <atoi+0x35>
+ 397:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 3a0:	83 c2 01             	add    $0x1,%edx
+ 3a3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 3a6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 3aa:	0f be 02             	movsbl (%edx),%eax
+ 3ad:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 3b0:	80 fb 09             	cmp    $0x9,%bl
+ 3b3:	76 eb                	jbe    3a0 <atoi+0x20>
+}
+ 3b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3b8:	89 c8                	mov    %ecx,%eax
+ 3ba:	c9                   	leave
+ 3bb:	c3                   	ret
+ 3bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003c0 <memmove>:
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+ 3c3:	57                   	push   %edi
+ 3c4:	56                   	push   %esi
+ 3c5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3cb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+ 3ce:	85 c0                	test   %eax,%eax
+ 3d0:	7e 13                	jle    3e5 <memmove+0x25>
+ 3d2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 3d4:	89 d7                	mov    %edx,%edi
+ 3d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3dd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 3e0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 3e1:	39 f8                	cmp    %edi,%eax
+ 3e3:	75 fb                	jne    3e0 <memmove+0x20>
+}
+ 3e5:	5e                   	pop    %esi
+ 3e6:	89 d0                	mov    %edx,%eax
+ 3e8:	5f                   	pop    %edi
+ 3e9:	5d                   	pop    %ebp
+ 3ea:	c3                   	ret
+ 3eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3ef:	90                   	nop
+
+000003f0 <fork>:
+  if(flushhook)
+ 3f0:	a1 10 22 00 00       	mov    0x2210,%eax
+ 3f5:	85 c0                	test   %eax,%eax
+ 3f7:	74 17                	je     410 <fork+0x20>
+{
+ 3f9:	55                   	push   %ebp
+ 3fa:	89 e5                	mov    %esp,%ebp
+ 3fc:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+ 3ff:	ff d0                	call   *%eax
+}
+ 401:	c9                   	leave
+  return _fork();
+ 402:	e9 21 02 00 00       	jmp    628 <_fork>
+ 407:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 40e:	66 90                	xchg   %ax,%ax
+ 410:	e9 13 02 00 00       	jmp    628 <_fork>
+ 415:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 41c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000420 <exit>:
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+ 426:	a1 10 22 00 00       	mov    0x2210,%eax
+ 42b:	85 c0                	test   %eax,%eax
+ 42d:	74 02                	je     431 <exit+0x11>
+    flushhook();
+ 42f:	ff d0                	call   *%eax
+  _exit();
+ 431:	e8 fa 01 00 00       	call   630 <_exit>
+ 436:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 43d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000440 <exec>:
+{
+ 440:	55                   	push   %ebp
+  if(flushhook)
+ 441:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+ 446:	89 e5                	mov    %esp,%ebp
+ 448:	56                   	push   %esi
+ 449:	53                   	push   %ebx
+ 44a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 44d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+ 450:	85 c0                	test   %eax,%eax
+ 452:	74 02                	je     456 <exec+0x16>
+    flushhook();
+ 454:	ff d0                	call   *%eax
+  return _exec(path, argv);
+ 456:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 459:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 45c:	5b                   	pop    %ebx
+ 45d:	5e                   	pop    %esi
+ 45e:	5d                   	pop    %ebp
+  return _exec(path, argv);
+ 45f:	e9 04 02 00 00       	jmp    668 <_exec>
+ 464:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 46b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 46f:	90                   	nop
+
+00000470 <read>:
+{
+ 470:	55                   	push   %ebp
+ 471:	89 e5                	mov    %esp,%ebp
+ 473:	57                   	push   %edi
+ 474:	56                   	push   %esi
+ 475:	53                   	push   %ebx
+ 476:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+ 479:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+ 47e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 481:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 484:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+ 487:	85 c0                	test   %eax,%eax
+ 489:	74 02                	je     48d <read+0x1d>
+    flushhook();
+ 48b:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+ 48d:	89 7d 10             	mov    %edi,0x10(%ebp)
+ 490:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 493:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 496:	83 c4 0c             	add    $0xc,%esp
+ 499:	5b                   	pop    %ebx
+ 49a:	5e                   	pop    %esi
+ 49b:	5f                   	pop    %edi
+ 49c:	5d                   	pop    %ebp
+  return _read(fd, buf, n);
+ 49d:	e9 a6 01 00 00       	jmp    648 <_read>
+ 4a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004b0 <readv>:
+{
+ 4b0:	55                   	push   %ebp
+ 4b1:	89 e5                	mov    %esp,%ebp
+ 4b3:	57                   	push   %edi
+ 4b4:	56                   	push   %esi
+ 4b5:	53                   	push   %ebx
+ 4b6:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+ 4b9:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+ 4be:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 4c1:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 4c4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+ 4c7:	85 c0                	test   %eax,%eax
+ 4c9:	74 02                	je     4cd <readv+0x1d>
+    flushhook();
+ 4cb:	ff d0                	call   *%eax
+  return _readv(fd, iov, cnt);
+ 4cd:	89 7d 10             	mov    %edi,0x10(%ebp)
+ 4d0:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 4d3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 4d6:	83 c4 0c             	add    $0xc,%esp
+ 4d9:	5b                   	pop    %ebx
+ 4da:	5e                   	pop    %esi
+ 4db:	5f                   	pop    %edi
+ 4dc:	5d                   	pop    %ebp
+  return _readv(fd, iov, cnt);
+ 4dd:	e9 76 02 00 00       	jmp    758 <_readv>
+ 4e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004f0 <write>:
+{
+ 4f0:	55                   	push   %ebp
+ 4f1:	89 e5                	mov    %esp,%ebp
+ 4f3:	57                   	push   %edi
+ 4f4:	56                   	push   %esi
+ 4f5:	53                   	push   %ebx
+ 4f6:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+ 4f9:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+ 4fe:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 501:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 504:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+ 507:	85 c0                	test   %eax,%eax
+ 509:	74 02                	je     50d <write+0x1d>
+    flushhook();
+ 50b:	ff d0                	call   *%eax
+  return _write(fd, buf, n);
+ 50d:	89 7d 10             	mov    %edi,0x10(%ebp)
+ 510:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 513:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 516:	83 c4 0c             	add    $0xc,%esp
+ 519:	5b                   	pop    %ebx
+ 51a:	5e                   	pop    %esi
+ 51b:	5f                   	pop    %edi
+ 51c:	5d                   	pop    %ebp
+  return _write(fd, buf, n);
+ 51d:	e9 2e 01 00 00       	jmp    650 <_write>
+ 522:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 529:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000530 <writev>:
+{
+ 530:	55                   	push   %ebp
+ 531:	89 e5                	mov    %esp,%ebp
+ 533:	57                   	push   %edi
+ 534:	56                   	push   %esi
+ 535:	53                   	push   %ebx
+ 536:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+ 539:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+ 53e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 541:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 544:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+ 547:	85 c0                	test   %eax,%eax
+ 549:	74 02                	je     54d <writev+0x1d>
+    flushhook();
+ 54b:	ff d0                	call   *%eax
+  return _writev(fd, iov, cnt);
+ 54d:	89 7d 10             	mov    %edi,0x10(%ebp)
+ 550:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 553:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 556:	83 c4 0c             	add    $0xc,%esp
+ 559:	5b                   	pop    %ebx
+ 55a:	5e                   	pop    %esi
+ 55b:	5f                   	pop    %edi
+ 55c:	5d                   	pop    %ebp
+  return _writev(fd, iov, cnt);
+ 55d:	e9 fe 01 00 00       	jmp    760 <_writev>
+ 562:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 569:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000570 <close>:
+{
+ 570:	55                   	push   %ebp
+ 571:	89 e5                	mov    %esp,%ebp
+ 573:	53                   	push   %ebx
+ 574:	83 ec 04             	sub    $0x4,%esp
+  if(flushhook)
+ 577:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+ 57c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(flushhook)
+ 57f:	85 c0                	test   %eax,%eax
+ 581:	74 02                	je     585 <close+0x15>
+    flushhook();
+ 583:	ff d0                	call   *%eax
+  return _close(fd);
+ 585:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 588:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 58b:	c9                   	leave
+  return _close(fd);
+ 58c:	e9 c7 00 00 00       	jmp    658 <_close>
+ 591:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 598:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 59f:	90                   	nop
+
+000005a0 <umtxinit>:
+// process that finds the mutex held enters the kernel, to sleep
+// in futexwait() until the holder's umtxunlock() wakes it.
+
+void
+umtxinit(struct umutex *m)
+{
+ 5a0:	55                   	push   %ebp
+ 5a1:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 5a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5a6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 5ac:	5d                   	pop    %ebp
+ 5ad:	c3                   	ret
+ 5ae:	66 90                	xchg   %ax,%ax
+
+000005b0 <umtxlock>:
+
+void
+umtxlock(struct umutex *m)
+{
+ 5b0:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 5b1:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5b6:	89 e5                	mov    %esp,%ebp
+ 5b8:	56                   	push   %esi
+ 5b9:	53                   	push   %ebx
+ 5ba:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 5bd:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 1) == 0)
+ 5c0:	85 c0                	test   %eax,%eax
+ 5c2:	74 2b                	je     5ef <umtxlock+0x3f>
+ 5c4:	b8 02 00 00 00       	mov    $0x2,%eax
+ 5c9:	f0 87 03             	lock xchg %eax,(%ebx)
+    return;
+  // Mark the mutex contended, so that its holder
+  // wakes a waiter on release, and wait.
+  while(xchg(&m->state, 2) != 0)
+ 5cc:	85 c0                	test   %eax,%eax
+ 5ce:	74 1f                	je     5ef <umtxlock+0x3f>
+ 5d0:	be 02 00 00 00       	mov    $0x2,%esi
+ 5d5:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwait(&m->state, 2);
+ 5d8:	83 ec 08             	sub    $0x8,%esp
+ 5db:	6a 02                	push   $0x2
+ 5dd:	53                   	push   %ebx
+ 5de:	e8 85 01 00 00       	call   768 <futexwait>
+ 5e3:	89 f0                	mov    %esi,%eax
+ 5e5:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+ 5e8:	83 c4 10             	add    $0x10,%esp
+ 5eb:	85 c0                	test   %eax,%eax
+ 5ed:	75 e9                	jne    5d8 <umtxlock+0x28>
+}
+ 5ef:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 5f2:	5b                   	pop    %ebx
+ 5f3:	5e                   	pop    %esi
+ 5f4:	5d                   	pop    %ebp
+ 5f5:	c3                   	ret
+ 5f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000600 <umtxunlock>:
+
+void
+umtxunlock(struct umutex *m)
+{
+ 600:	55                   	push   %ebp
+ 601:	31 c0                	xor    %eax,%eax
+ 603:	89 e5                	mov    %esp,%ebp
+ 605:	83 ec 08             	sub    $0x8,%esp
+ 608:	8b 55 08             	mov    0x8(%ebp),%edx
+ 60b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 60e:	83 f8 02             	cmp    $0x2,%eax
+ 611:	74 05                	je     618 <umtxunlock+0x18>
+    futexwake(&m->state, 1);
+}
+ 613:	c9                   	leave
+ 614:	c3                   	ret
+ 615:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwake(&m->state, 1);
+ 618:	83 ec 08             	sub    $0x8,%esp
+ 61b:	6a 01                	push   $0x1
+ 61d:	52                   	push   %edx
+ 61e:	e8 4d 01 00 00       	call   770 <futexwake>
+ 623:	83 c4 10             	add    $0x10,%esp
+}
+ 626:	c9                   	leave
+ 627:	c3                   	ret
+
+00000628 <_fork>:
+  _ ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+ 628:	b8 01 00 00 00       	mov    $0x1,%eax
+ 62d:	cd 40                	int    $0x40
+ 62f:	c3                   	ret
+
+00000630 <_exit>:
+RAWSYSCALL(exit)
+ 630:	b8 02 00 00 00       	mov    $0x2,%eax
+ 635:	cd 40                	int    $0x40
+ 637:	c3                   	ret
+
+00000638 <wait>:
+SYSCALL(wait)
+ 638:	b8 03 00 00 00       	mov    $0x3,%eax
+ 63d:	cd 40                	int    $0x40
+ 63f:	c3                   	ret
+
+00000640 <pipe>:
+SYSCALL(pipe)
+ 640:	b8 04 00 00 00       	mov    $0x4,%eax
+ 645:	cd 40                	int    $0x40
+ 647:	c3                   	ret
+
+00000648 <_read>:
+RAWSYSCALL(read)
+ 648:	b8 05 00 00 00       	mov    $0x5,%eax
+ 64d:	cd 40                	int    $0x40
+ 64f:	c3                   	ret
+
+00000650 <_write>:
+RAWSYSCALL(write)
+ 650:	b8 10 00 00 00       	mov    $0x10,%eax
+ 655:	cd 40                	int    $0x40
+ 657:	c3                   	ret
+
+00000658 <_close>:
+RAWSYSCALL(close)
+ 658:	b8 15 00 00 00       	mov    $0x15,%eax
+ 65d:	cd 40                	int    $0x40
+ 65f:	c3                   	ret
+
+00000660 <kill>:
+SYSCALL(kill)
+ 660:	b8 06 00 00 00       	mov    $0x6,%eax
+ 665:	cd 40                	int    $0x40
+ 667:	c3                   	ret
+
+00000668 <_exec>:
+RAWSYSCALL(exec)
+ 668:	b8 07 00 00 00       	mov    $0x7,%eax
+ 66d:	cd 40                	int    $0x40
+ 66f:	c3                   	ret
+
+00000670 <open>:
+SYSCALL(open)
+ 670:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 675:	cd 40                	int    $0x40
+ 677:	c3                   	ret
+
+00000678 <mknod>:
+SYSCALL(mknod)
+ 678:	b8 11 00 00 00       	mov    $0x11,%eax
+ 67d:	cd 40                	int    $0x40
+ 67f:	c3                   	ret
+
+00000680 <unlink>:
+SYSCALL(unlink)
+ 680:	b8 12 00 00 00       	mov    $0x12,%eax
+ 685:	cd 40                	int    $0x40
+ 687:	c3                   	ret
+
+00000688 <fstat>:
+SYSCALL(fstat)
+ 688:	b8 08 00 00 00       	mov    $0x8,%eax
+ 68d:	cd 40                	int    $0x40
+ 68f:	c3                   	ret
+
+00000690 <link>:
+SYSCALL(link)
+ 690:	b8 13 00 00 00       	mov    $0x13,%eax
+ 695:	cd 40                	int    $0x40
+ 697:	c3                   	ret
+
+00000698 <mkdir>:
+SYSCALL(mkdir)
+ 698:	b8 14 00 00 00       	mov    $0x14,%eax
+ 69d:	cd 40                	int    $0x40
+ 69f:	c3                   	ret
+
+000006a0 <chdir>:
+SYSCALL(chdir)
+ 6a0:	b8 09 00 00 00       	mov    $0x9,%eax
+ 6a5:	cd 40                	int    $0x40
+ 6a7:	c3                   	ret
+
+000006a8 <dup>:
+SYSCALL(dup)
+ 6a8:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 6ad:	cd 40                	int    $0x40
+ 6af:	c3                   	ret
+
+000006b0 <getpid>:
+SYSCALL(getpid)
+ 6b0:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 6b5:	cd 40                	int    $0x40
+ 6b7:	c3                   	ret
+
+000006b8 <sbrk>:
+SYSCALL(sbrk)
+ 6b8:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 6bd:	cd 40                	int    $0x40
+ 6bf:	c3                   	ret
+
+000006c0 <sleep>:
+SYSCALL(sleep)
+ 6c0:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 6c5:	cd 40                	int    $0x40
+ 6c7:	c3                   	ret
+
+000006c8 <uptime>:
+SYSCALL(uptime)
+ 6c8:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 6cd:	cd 40                	int    $0x40
+ 6cf:	c3                   	ret
+
+000006d0 <wolfie>:
+SYSCALL(wolfie)
+ 6d0:	b8 16 00 00 00       	mov    $0x16,%eax
+ 6d5:	cd 40                	int    $0x40
+ 6d7:	c3                   	ret
+
+000006d8 <nice>:
+SYSCALL(nice)
+ 6d8:	b8 17 00 00 00       	mov    $0x17,%eax
+ 6dd:	cd 40                	int    $0x40
+ 6df:	c3                   	ret
+
+000006e0 <mtxget>:
+SYSCALL(mtxget)
+ 6e0:	b8 18 00 00 00       	mov    $0x18,%eax
+ 6e5:	cd 40                	int    $0x40
+ 6e7:	c3                   	ret
+
+000006e8 <mtxrel>:
+SYSCALL(mtxrel)
+ 6e8:	b8 19 00 00 00       	mov    $0x19,%eax
+ 6ed:	cd 40                	int    $0x40
+ 6ef:	c3                   	ret
+
+000006f0 <mtxacq>:
+SYSCALL(mtxacq)
+ 6f0:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 6f5:	cd 40                	int    $0x40
+ 6f7:	c3                   	ret
+
+000006f8 <mtxdel>:
+SYSCALL(mtxdel)
+ 6f8:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 6fd:	cd 40                	int    $0x40
+ 6ff:	c3                   	ret
+
+00000700 <iostat>:
+SYSCALL(iostat)
+ 700:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 705:	cd 40                	int    $0x40
+ 707:	c3                   	ret
+
+00000708 <mmap>:
+SYSCALL(mmap)
+ 708:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 70d:	cd 40                	int    $0x40
+ 70f:	c3                   	ret
+
+00000710 <munmap>:
+SYSCALL(munmap)
+ 710:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 715:	cd 40                	int    $0x40
+ 717:	c3                   	ret
+
+00000718 <shmget>:
+SYSCALL(shmget)
+ 718:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 71d:	cd 40                	int    $0x40
+ 71f:	c3                   	ret
+
+00000720 <shmat>:
+SYSCALL(shmat)
+ 720:	b8 20 00 00 00       	mov    $0x20,%eax
+ 725:	cd 40                	int    $0x40
+ 727:	c3                   	ret
+
+00000728 <shmdt>:
+SYSCALL(shmdt)
+ 728:	b8 21 00 00 00       	mov    $0x21,%eax
+ 72d:	cd 40                	int    $0x40
+ 72f:	c3                   	ret
+
+00000730 <shmdel>:
+SYSCALL(shmdel)
+ 730:	b8 22 00 00 00       	mov    $0x22,%eax
+ 735:	cd 40                	int    $0x40
+ 737:	c3                   	ret
+
+00000738 <syscount>:
+SYSCALL(syscount)
+ 738:	b8 23 00 00 00       	mov    $0x23,%eax
+ 73d:	cd 40                	int    $0x40
+ 73f:	c3                   	ret
+
+00000740 <splice>:
+SYSCALL(splice)
+ 740:	b8 24 00 00 00       	mov    $0x24,%eax
+ 745:	cd 40                	int    $0x40
+ 747:	c3                   	ret
+
+00000748 <tee>:
+SYSCALL(tee)
+ 748:	b8 25 00 00 00       	mov    $0x25,%eax
+ 74d:	cd 40                	int    $0x40
+ 74f:	c3                   	ret
+
+00000750 <sendfile>:
+SYSCALL(sendfile)
+ 750:	b8 26 00 00 00       	mov    $0x26,%eax
+ 755:	cd 40                	int    $0x40
+ 757:	c3                   	ret
+
+00000758 <_readv>:
+RAWSYSCALL(readv)
+ 758:	b8 27 00 00 00       	mov    $0x27,%eax
+ 75d:	cd 40                	int    $0x40
+ 75f:	c3                   	ret
+
+00000760 <_writev>:
+RAWSYSCALL(writev)
+ 760:	b8 28 00 00 00       	mov    $0x28,%eax
+ 765:	cd 40                	int    $0x40
+ 767:	c3                   	ret
+
+00000768 <futexwait>:
+SYSCALL(futexwait)
+ 768:	b8 29 00 00 00       	mov    $0x29,%eax
+ 76d:	cd 40                	int    $0x40
+ 76f:	c3                   	ret
+
+00000770 <futexwake>:
+SYSCALL(futexwake)
+ 770:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 775:	cd 40                	int    $0x40
+ 777:	c3                   	ret
+
+00000778 <lockstat>:
+SYSCALL(lockstat)
+ 778:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 77d:	cd 40                	int    $0x40
+ 77f:	c3                   	ret
+
+00000780 <clone>:
+SYSCALL(clone)
+ 780:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 785:	cd 40                	int    $0x40
+ 787:	c3                   	ret
+
+00000788 <join>:
+SYSCALL(join)
+ 788:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 78d:	cd 40                	int    $0x40
+ 78f:	c3                   	ret
+
+00000790 <stacklimit>:
+SYSCALL(stacklimit)
+ 790:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 795:	cd 40                	int    $0x40
+ 797:	c3                   	ret
+ 798:	66 90                	xchg   %ax,%ax
+ 79a:	66 90                	xchg   %ax,%ax
+ 79c:	66 90                	xchg   %ax,%ax
+ 79e:	66 90                	xchg   %ax,%ax
+
+000007a0 <flushall>:
+  b->n = 0;
+}
+
+static void
+flushall(void)
+{
+ 7a0:	55                   	push   %ebp
+ 7a1:	89 e5                	mov    %esp,%ebp
+ 7a3:	83 ec 14             	sub    $0x14,%esp
+  umtxlock(&stdoutlock);
+ 7a6:	68 14 22 00 00       	push   $0x2214
+ 7ab:	e8 00 fe ff ff       	call   5b0 <umtxlock>
+  if(b->n > 0)
+ 7b0:	a1 08 20 00 00       	mov    0x2008,%eax
+ 7b5:	83 c4 10             	add    $0x10,%esp
+ 7b8:	85 c0                	test   %eax,%eax
+ 7ba:	7e 17                	jle    7d3 <flushall+0x33>
+    _write(b->fd, b->buf, b->n);
+ 7bc:	83 ec 04             	sub    $0x4,%esp
+ 7bf:	50                   	push   %eax
+ 7c0:	68 0c 20 00 00       	push   $0x200c
+ 7c5:	ff 35 00 20 00 00    	push   0x2000
+ 7cb:	e8 80 fe ff ff       	call   650 <_write>
+ 7d0:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+ 7d3:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+ 7da:	00 00 00 
+  flush(&stdout);
+  umtxunlock(&stdoutlock);
+ 7dd:	83 ec 0c             	sub    $0xc,%esp
+ 7e0:	68 14 22 00 00       	push   $0x2214
+ 7e5:	e8 16 fe ff ff       	call   600 <umtxunlock>
+}
+ 7ea:	83 c4 10             	add    $0x10,%esp
+ 7ed:	c9                   	leave
+ 7ee:	c3                   	ret
+ 7ef:	90                   	nop
+
+000007f0 <printint>:
+    flush(b);
+}
+
+static void
+printint(struct outbuf *b, int xx, int base, int sgn)
+{
+ 7f0:	55                   	push   %ebp
+ 7f1:	89 e5                	mov    %esp,%ebp
+ 7f3:	57                   	push   %edi
+ 7f4:	89 cf                	mov    %ecx,%edi
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 7f6:	89 d1                	mov    %edx,%ecx
+{
+ 7f8:	56                   	push   %esi
+ 7f9:	53                   	push   %ebx
+ 7fa:	89 c3                	mov    %eax,%ebx
+ 7fc:	83 ec 2c             	sub    $0x2c,%esp
+  if(sgn && xx < 0){
+ 7ff:	85 d2                	test   %edx,%edx
+ 801:	0f 89 b9 00 00 00    	jns    8c0 <printint+0xd0>
+ 807:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 80b:	0f 84 af 00 00 00    	je     8c0 <printint+0xd0>
+    x = -xx;
+ 811:	f7 d9                	neg    %ecx
+    neg = 1;
+ 813:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 818:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 81b:	31 f6                	xor    %esi,%esi
+ 81d:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 820:	89 c8                	mov    %ecx,%eax
+ 822:	31 d2                	xor    %edx,%edx
+ 824:	89 f3                	mov    %esi,%ebx
+ 826:	f7 f7                	div    %edi
+ 828:	8d 76 01             	lea    0x1(%esi),%esi
+ 82b:	0f b6 92 88 14 00 00 	movzbl 0x1488(%edx),%edx
+ 832:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 836:	89 ca                	mov    %ecx,%edx
+ 838:	89 c1                	mov    %eax,%ecx
+ 83a:	39 fa                	cmp    %edi,%edx
+ 83c:	73 e2                	jae    820 <printint+0x30>
+  if(neg)
+ 83e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 841:	89 d9                	mov    %ebx,%ecx
+ 843:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 846:	85 c0                	test   %eax,%eax
+ 848:	74 07                	je     851 <printint+0x61>
+    buf[i++] = '-';
+ 84a:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 84f:	89 f1                	mov    %esi,%ecx
+ 851:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 854:	89 cf                	mov    %ecx,%edi
+ 856:	01 f7                	add    %esi,%edi
+ 858:	eb 1a                	jmp    874 <printint+0x84>
+ 85a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    *b->str++ = c;
+ 860:	8d 48 01             	lea    0x1(%eax),%ecx
+ 863:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+ 869:	88 10                	mov    %dl,(%eax)
+
+  while(--i >= 0)
+ 86b:	8d 47 ff             	lea    -0x1(%edi),%eax
+ 86e:	39 fe                	cmp    %edi,%esi
+ 870:	74 40                	je     8b2 <printint+0xc2>
+ 872:	89 c7                	mov    %eax,%edi
+  if(b->str){
+ 874:	8b 83 0c 02 00 00    	mov    0x20c(%ebx),%eax
+    putc(b, buf[i]);
+ 87a:	0f b6 17             	movzbl (%edi),%edx
+  if(b->str){
+ 87d:	85 c0                	test   %eax,%eax
+ 87f:	75 df                	jne    860 <printint+0x70>
+  b->buf[b->n++] = c;
+ 881:	8b 4b 08             	mov    0x8(%ebx),%ecx
+ 884:	8d 41 01             	lea    0x1(%ecx),%eax
+ 887:	89 43 08             	mov    %eax,0x8(%ebx)
+ 88a:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+ 88e:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 893:	74 3b                	je     8d0 <printint+0xe0>
+ 895:	80 fa 0a             	cmp    $0xa,%dl
+ 898:	75 d1                	jne    86b <printint+0x7b>
+ 89a:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+ 89e:	75 cb                	jne    86b <printint+0x7b>
+  if(b->n > 0)
+ 8a0:	85 c0                	test   %eax,%eax
+ 8a2:	7f 2c                	jg     8d0 <printint+0xe0>
+  b->n = 0;
+ 8a4:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  while(--i >= 0)
+ 8ab:	8d 47 ff             	lea    -0x1(%edi),%eax
+ 8ae:	39 fe                	cmp    %edi,%esi
+ 8b0:	75 c0                	jne    872 <printint+0x82>
+}
+ 8b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8b5:	5b                   	pop    %ebx
+ 8b6:	5e                   	pop    %esi
+ 8b7:	5f                   	pop    %edi
+ 8b8:	5d                   	pop    %ebp
+ 8b9:	c3                   	ret
+ 8ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  neg = 0;
+ 8c0:	31 c0                	xor    %eax,%eax
+ 8c2:	e9 51 ff ff ff       	jmp    818 <printint+0x28>
+ 8c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8ce:	66 90                	xchg   %ax,%ax
+    _write(b->fd, b->buf, b->n);
+ 8d0:	83 ec 04             	sub    $0x4,%esp
+ 8d3:	50                   	push   %eax
+ 8d4:	8d 43 0c             	lea    0xc(%ebx),%eax
+ 8d7:	50                   	push   %eax
+ 8d8:	ff 33                	push   (%ebx)
+ 8da:	e8 71 fd ff ff       	call   650 <_write>
+ 8df:	83 c4 10             	add    $0x10,%esp
+ 8e2:	eb c0                	jmp    8a4 <printint+0xb4>
+ 8e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8ef:	90                   	nop
+
+000008f0 <putc>:
+{
+ 8f0:	55                   	push   %ebp
+ 8f1:	89 e5                	mov    %esp,%ebp
+ 8f3:	53                   	push   %ebx
+ 8f4:	89 c3                	mov    %eax,%ebx
+ 8f6:	83 ec 04             	sub    $0x4,%esp
+  if(b->str){
+ 8f9:	8b 80 0c 02 00 00    	mov    0x20c(%eax),%eax
+ 8ff:	85 c0                	test   %eax,%eax
+ 901:	74 15                	je     918 <putc+0x28>
+    *b->str++ = c;
+ 903:	8d 48 01             	lea    0x1(%eax),%ecx
+ 906:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+ 90c:	88 10                	mov    %dl,(%eax)
+}
+ 90e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 911:	c9                   	leave
+ 912:	c3                   	ret
+ 913:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 917:	90                   	nop
+  b->buf[b->n++] = c;
+ 918:	8b 4b 08             	mov    0x8(%ebx),%ecx
+ 91b:	8d 41 01             	lea    0x1(%ecx),%eax
+ 91e:	89 43 08             	mov    %eax,0x8(%ebx)
+ 921:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+ 925:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 92a:	74 14                	je     940 <putc+0x50>
+ 92c:	80 fa 0a             	cmp    $0xa,%dl
+ 92f:	75 dd                	jne    90e <putc+0x1e>
+ 931:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+ 935:	75 d7                	jne    90e <putc+0x1e>
+  if(b->n > 0)
+ 937:	85 c0                	test   %eax,%eax
+ 939:	7e 17                	jle    952 <putc+0x62>
+ 93b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 93f:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+ 940:	83 ec 04             	sub    $0x4,%esp
+ 943:	50                   	push   %eax
+ 944:	8d 43 0c             	lea    0xc(%ebx),%eax
+ 947:	50                   	push   %eax
+ 948:	ff 33                	push   (%ebx)
+ 94a:	e8 01 fd ff ff       	call   650 <_write>
+ 94f:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+ 952:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+ 959:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 95c:	c9                   	leave
+ 95d:	c3                   	ret
+ 95e:	66 90                	xchg   %ax,%ax
+
+00000960 <format>:
+
+// Format fmt and the arguments at ap into b.
+// Only understands %d, %x, %p, %s, %c.
+static void
+format(struct outbuf *b, const char *fmt, uint *ap)
+{
+ 960:	55                   	push   %ebp
+ 961:	89 e5                	mov    %esp,%ebp
+ 963:	57                   	push   %edi
+ 964:	89 c7                	mov    %eax,%edi
+ 966:	56                   	push   %esi
+ 967:	53                   	push   %ebx
+ 968:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+ 96b:	0f b6 02             	movzbl (%edx),%eax
+{
+ 96e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 971:	84 c0                	test   %al,%al
+ 973:	74 5a                	je     9cf <format+0x6f>
+ 975:	8d 5a 01             	lea    0x1(%edx),%ebx
+ 978:	31 f6                	xor    %esi,%esi
+ 97a:	eb 1c                	jmp    998 <format+0x38>
+ 97c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+ 980:	83 f8 25             	cmp    $0x25,%eax
+ 983:	74 3b                	je     9c0 <format+0x60>
+        state = '%';
+      } else {
+        putc(b, c);
+ 985:	89 ca                	mov    %ecx,%edx
+ 987:	89 f8                	mov    %edi,%eax
+ 989:	e8 62 ff ff ff       	call   8f0 <putc>
+  for(i = 0; fmt[i]; i++){
+ 98e:	0f b6 03             	movzbl (%ebx),%eax
+ 991:	83 c3 01             	add    $0x1,%ebx
+ 994:	84 c0                	test   %al,%al
+ 996:	74 37                	je     9cf <format+0x6f>
+    c = fmt[i] & 0xff;
+ 998:	0f be c8             	movsbl %al,%ecx
+ 99b:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 99e:	85 f6                	test   %esi,%esi
+ 9a0:	74 de                	je     980 <format+0x20>
+      }
+    } else if(state == '%'){
+ 9a2:	83 fe 25             	cmp    $0x25,%esi
+ 9a5:	75 e7                	jne    98e <format+0x2e>
+      if(c == 'd'){
+ 9a7:	83 f8 25             	cmp    $0x25,%eax
+ 9aa:	74 46                	je     9f2 <format+0x92>
+ 9ac:	83 e8 63             	sub    $0x63,%eax
+ 9af:	83 f8 15             	cmp    $0x15,%eax
+ 9b2:	77 2c                	ja     9e0 <format+0x80>
+ 9b4:	ff 24 85 30 14 00 00 	jmp    *0x1430(,%eax,4)
+ 9bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9bf:	90                   	nop
+  for(i = 0; fmt[i]; i++){
+ 9c0:	0f b6 03             	movzbl (%ebx),%eax
+ 9c3:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+ 9c6:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+ 9cb:	84 c0                	test   %al,%al
+ 9cd:	75 c9                	jne    998 <format+0x38>
+        putc(b, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 9cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 9d2:	5b                   	pop    %ebx
+ 9d3:	5e                   	pop    %esi
+ 9d4:	5f                   	pop    %edi
+ 9d5:	5d                   	pop    %ebp
+ 9d6:	c3                   	ret
+ 9d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9de:	66 90                	xchg   %ax,%ax
+        putc(b, '%');
+ 9e0:	ba 25 00 00 00       	mov    $0x25,%edx
+ 9e5:	89 f8                	mov    %edi,%eax
+ 9e7:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+ 9ea:	e8 01 ff ff ff       	call   8f0 <putc>
+        putc(b, c);
+ 9ef:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ 9f2:	89 ca                	mov    %ecx,%edx
+ 9f4:	89 f8                	mov    %edi,%eax
+      state = 0;
+ 9f6:	31 f6                	xor    %esi,%esi
+        putc(b, c);
+ 9f8:	e8 f3 fe ff ff       	call   8f0 <putc>
+ 9fd:	eb 8f                	jmp    98e <format+0x2e>
+ 9ff:	90                   	nop
+        printint(b, *ap, 16, 0);
+ a00:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+ a03:	83 ec 0c             	sub    $0xc,%esp
+ a06:	b9 10 00 00 00       	mov    $0x10,%ecx
+ a0b:	8b 16                	mov    (%esi),%edx
+ a0d:	6a 00                	push   $0x0
+        ap++;
+ a0f:	83 c6 04             	add    $0x4,%esi
+        printint(b, *ap, 16, 0);
+ a12:	89 f8                	mov    %edi,%eax
+ a14:	e8 d7 fd ff ff       	call   7f0 <printint>
+        ap++;
+ a19:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+ a1c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a1f:	31 f6                	xor    %esi,%esi
+ a21:	e9 68 ff ff ff       	jmp    98e <format+0x2e>
+ a26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a2d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ a30:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ a33:	8b 30                	mov    (%eax),%esi
+        ap++;
+ a35:	83 c0 04             	add    $0x4,%eax
+ a38:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ a3b:	85 f6                	test   %esi,%esi
+ a3d:	75 1b                	jne    a5a <format+0xfa>
+ a3f:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+ a44:	be 28 14 00 00       	mov    $0x1428,%esi
+ a49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+          putc(b, *s);
+ a50:	89 f8                	mov    %edi,%eax
+          s++;
+ a52:	83 c6 01             	add    $0x1,%esi
+          putc(b, *s);
+ a55:	e8 96 fe ff ff       	call   8f0 <putc>
+        while(*s != 0){
+ a5a:	0f be 16             	movsbl (%esi),%edx
+ a5d:	84 d2                	test   %dl,%dl
+ a5f:	75 ef                	jne    a50 <format+0xf0>
+      state = 0;
+ a61:	31 f6                	xor    %esi,%esi
+ a63:	e9 26 ff ff ff       	jmp    98e <format+0x2e>
+ a68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a6f:	90                   	nop
+        printint(b, *ap, 10, 1);
+ a70:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+ a73:	83 ec 0c             	sub    $0xc,%esp
+ a76:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ a7b:	8b 16                	mov    (%esi),%edx
+ a7d:	6a 01                	push   $0x1
+ a7f:	eb 8e                	jmp    a0f <format+0xaf>
+ a81:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(b, *ap);
+ a88:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+ a8b:	89 f8                	mov    %edi,%eax
+ a8d:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+ a90:	83 c6 04             	add    $0x4,%esi
+        putc(b, *ap);
+ a93:	e8 58 fe ff ff       	call   8f0 <putc>
+        ap++;
+ a98:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      state = 0;
+ a9b:	31 f6                	xor    %esi,%esi
+ a9d:	e9 ec fe ff ff       	jmp    98e <format+0x2e>
+ aa2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ aa9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000ab0 <fflush>:
+{
+ ab0:	55                   	push   %ebp
+ ab1:	89 e5                	mov    %esp,%ebp
+ ab3:	83 ec 08             	sub    $0x8,%esp
+  if(fd == stdout.fd)
+ ab6:	8b 45 08             	mov    0x8(%ebp),%eax
+ ab9:	39 05 00 20 00 00    	cmp    %eax,0x2000
+ abf:	74 07                	je     ac8 <fflush+0x18>
+}
+ ac1:	c9                   	leave
+ ac2:	c3                   	ret
+ ac3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ ac7:	90                   	nop
+  umtxlock(&stdoutlock);
+ ac8:	83 ec 0c             	sub    $0xc,%esp
+ acb:	68 14 22 00 00       	push   $0x2214
+ ad0:	e8 db fa ff ff       	call   5b0 <umtxlock>
+  if(b->n > 0)
+ ad5:	a1 08 20 00 00       	mov    0x2008,%eax
+ ada:	83 c4 10             	add    $0x10,%esp
+ add:	85 c0                	test   %eax,%eax
+ adf:	7f 1f                	jg     b00 <fflush+0x50>
+  b->n = 0;
+ ae1:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+ ae8:	00 00 00 
+  umtxunlock(&stdoutlock);
+ aeb:	c7 45 08 14 22 00 00 	movl   $0x2214,0x8(%ebp)
+}
+ af2:	c9                   	leave
+  umtxunlock(&stdoutlock);
+ af3:	e9 08 fb ff ff       	jmp    600 <umtxunlock>
+ af8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ aff:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+ b00:	83 ec 04             	sub    $0x4,%esp
+ b03:	50                   	push   %eax
+ b04:	68 0c 20 00 00       	push   $0x200c
+ b09:	ff 35 00 20 00 00    	push   0x2000
+ b0f:	e8 3c fb ff ff       	call   650 <_write>
+ b14:	83 c4 10             	add    $0x10,%esp
+ b17:	eb c8                	jmp    ae1 <fflush+0x31>
+ b19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000b20 <setvbuf>:
+{
+ b20:	55                   	push   %ebp
+ b21:	89 e5                	mov    %esp,%ebp
+ b23:	53                   	push   %ebx
+ b24:	83 ec 04             	sub    $0x4,%esp
+ b27:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd != stdout.fd)
+ b2a:	8b 45 08             	mov    0x8(%ebp),%eax
+ b2d:	39 05 00 20 00 00    	cmp    %eax,0x2000
+ b33:	74 0b                	je     b40 <setvbuf+0x20>
+}
+ b35:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ b38:	c9                   	leave
+ b39:	c3                   	ret
+ b3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  umtxlock(&stdoutlock);
+ b40:	83 ec 0c             	sub    $0xc,%esp
+ b43:	68 14 22 00 00       	push   $0x2214
+ b48:	e8 63 fa ff ff       	call   5b0 <umtxlock>
+  if(b->n > 0)
+ b4d:	a1 08 20 00 00       	mov    0x2008,%eax
+ b52:	83 c4 10             	add    $0x10,%esp
+ b55:	85 c0                	test   %eax,%eax
+ b57:	7f 2f                	jg     b88 <setvbuf+0x68>
+  b->n = 0;
+ b59:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+ b60:	00 00 00 
+  stdout.mode = mode;
+ b63:	89 1d 04 20 00 00    	mov    %ebx,0x2004
+  flushhook = flushall;
+ b69:	c7 05 10 22 00 00 a0 	movl   $0x7a0,0x2210
+ b70:	07 00 00 
+}
+ b73:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&stdoutlock);
+ b76:	c7 45 08 14 22 00 00 	movl   $0x2214,0x8(%ebp)
+}
+ b7d:	c9                   	leave
+  umtxunlock(&stdoutlock);
+ b7e:	e9 7d fa ff ff       	jmp    600 <umtxunlock>
+ b83:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b87:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+ b88:	83 ec 04             	sub    $0x4,%esp
+ b8b:	50                   	push   %eax
+ b8c:	68 0c 20 00 00       	push   $0x200c
+ b91:	ff 35 00 20 00 00    	push   0x2000
+ b97:	e8 b4 fa ff ff       	call   650 <_write>
+ b9c:	83 c4 10             	add    $0x10,%esp
+ b9f:	eb b8                	jmp    b59 <setvbuf+0x39>
+ ba1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ba8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ baf:	90                   	nop
+
+00000bb0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s, %c.
+void
+printf(int fd, const char *fmt, ...)
+{
+ bb0:	55                   	push   %ebp
+ bb1:	89 e5                	mov    %esp,%ebp
+ bb3:	53                   	push   %ebx
+ bb4:	81 ec 14 02 00 00    	sub    $0x214,%esp
+ bba:	8b 45 08             	mov    0x8(%ebp),%eax
+    local.mode = _IONBF;
+    local.n = 0;
+    local.str = 0;
+    b = &local;
+  }
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+ bbd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd == stdout.fd){
+ bc0:	39 05 00 20 00 00    	cmp    %eax,0x2000
+ bc6:	74 48                	je     c10 <printf+0x60>
+    local.fd = fd;
+ bc8:	89 85 e8 fd ff ff    	mov    %eax,-0x218(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+ bce:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ bd1:	89 da                	mov    %ebx,%edx
+ bd3:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+    local.mode = _IONBF;
+ bd9:	c7 85 ec fd ff ff 03 	movl   $0x3,-0x214(%ebp)
+ be0:	00 00 00 
+    local.n = 0;
+ be3:	c7 85 f0 fd ff ff 00 	movl   $0x0,-0x210(%ebp)
+ bea:	00 00 00 
+    local.str = 0;
+ bed:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+ bf4:	e8 67 fd ff ff       	call   960 <format>
+  if(b->mode == _IONBF)
+ bf9:	83 bd ec fd ff ff 03 	cmpl   $0x3,-0x214(%ebp)
+ c00:	0f 84 a2 00 00 00    	je     ca8 <printf+0xf8>
+    flush(b);
+  if(b == &stdout)
+    umtxunlock(&stdoutlock);
+}
+ c06:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ c09:	c9                   	leave
+ c0a:	c3                   	ret
+ c0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c0f:	90                   	nop
+    umtxlock(&stdoutlock);
+ c10:	83 ec 0c             	sub    $0xc,%esp
+ c13:	68 14 22 00 00       	push   $0x2214
+ c18:	e8 93 f9 ff ff       	call   5b0 <umtxlock>
+  if(stdout.mode == 0){
+ c1d:	a1 04 20 00 00       	mov    0x2004,%eax
+ c22:	83 c4 10             	add    $0x10,%esp
+ c25:	85 c0                	test   %eax,%eax
+ c27:	74 37                	je     c60 <printf+0xb0>
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+ c29:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ c2c:	89 da                	mov    %ebx,%edx
+ c2e:	b8 00 20 00 00       	mov    $0x2000,%eax
+ c33:	e8 28 fd ff ff       	call   960 <format>
+  if(b->mode == _IONBF)
+ c38:	83 3d 04 20 00 00 03 	cmpl   $0x3,0x2004
+ c3f:	0f 84 ab 00 00 00    	je     cf0 <printf+0x140>
+    umtxunlock(&stdoutlock);
+ c45:	83 ec 0c             	sub    $0xc,%esp
+ c48:	68 14 22 00 00       	push   $0x2214
+ c4d:	e8 ae f9 ff ff       	call   600 <umtxunlock>
+}
+ c52:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    umtxunlock(&stdoutlock);
+ c55:	83 c4 10             	add    $0x10,%esp
+}
+ c58:	c9                   	leave
+ c59:	c3                   	ret
+ c5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+ c60:	83 ec 08             	sub    $0x8,%esp
+ c63:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+ c69:	50                   	push   %eax
+ c6a:	ff 35 00 20 00 00    	push   0x2000
+ c70:	e8 13 fa ff ff       	call   688 <fstat>
+ c75:	83 c4 10             	add    $0x10,%esp
+ c78:	89 c2                	mov    %eax,%edx
+      stdout.mode = _IOFBF;
+ c7a:	b8 01 00 00 00       	mov    $0x1,%eax
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+ c7f:	85 d2                	test   %edx,%edx
+ c81:	75 10                	jne    c93 <printf+0xe3>
+      stdout.mode = _IOLBF;
+ c83:	31 c0                	xor    %eax,%eax
+ c85:	66 83 bd e8 fd ff ff 	cmpw   $0x3,-0x218(%ebp)
+ c8c:	03 
+ c8d:	0f 94 c0             	sete   %al
+ c90:	83 c0 01             	add    $0x1,%eax
+ c93:	a3 04 20 00 00       	mov    %eax,0x2004
+    flushhook = flushall;
+ c98:	c7 05 10 22 00 00 a0 	movl   $0x7a0,0x2210
+ c9f:	07 00 00 
+ ca2:	eb 85                	jmp    c29 <printf+0x79>
+ ca4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(b->n > 0)
+ ca8:	8b 85 f0 fd ff ff    	mov    -0x210(%ebp),%eax
+ cae:	85 c0                	test   %eax,%eax
+ cb0:	0f 8e 50 ff ff ff    	jle    c06 <printf+0x56>
+    b = &local;
+ cb6:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+    _write(b->fd, b->buf, b->n);
+ cbc:	83 ec 04             	sub    $0x4,%esp
+ cbf:	50                   	push   %eax
+ cc0:	8d 43 0c             	lea    0xc(%ebx),%eax
+ cc3:	50                   	push   %eax
+ cc4:	ff 33                	push   (%ebx)
+ cc6:	e8 85 f9 ff ff       	call   650 <_write>
+  b->n = 0;
+ ccb:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  if(b == &stdout)
+ cd2:	83 c4 10             	add    $0x10,%esp
+ cd5:	81 fb 00 20 00 00    	cmp    $0x2000,%ebx
+ cdb:	0f 85 25 ff ff ff    	jne    c06 <printf+0x56>
+ ce1:	e9 5f ff ff ff       	jmp    c45 <printf+0x95>
+ ce6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ced:	8d 76 00             	lea    0x0(%esi),%esi
+  if(b->n > 0)
+ cf0:	a1 08 20 00 00       	mov    0x2008,%eax
+    b = getstdout();
+ cf5:	bb 00 20 00 00       	mov    $0x2000,%ebx
+  if(b->n > 0)
+ cfa:	85 c0                	test   %eax,%eax
+ cfc:	7f be                	jg     cbc <printf+0x10c>
+  b->n = 0;
+ cfe:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+ d05:	00 00 00 
+  if(b == &stdout)
+ d08:	e9 38 ff ff ff       	jmp    c45 <printf+0x95>
+ d0d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000d10 <sprintf>:
+
+// Print to the given buffer. Only understands %d, %x, %p, %s, %c.
+int
+sprintf(char *str, const char *fmt, ...)
+{
+ d10:	55                   	push   %ebp
+ d11:	89 e5                	mov    %esp,%ebp
+ d13:	53                   	push   %ebx
+  struct outbuf b;
+
+  b.str = str;
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+ d14:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+ d1a:	8d 4d 10             	lea    0x10(%ebp),%ecx
+{
+ d1d:	81 ec 14 02 00 00    	sub    $0x214,%esp
+ d23:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+ d26:	8b 55 0c             	mov    0xc(%ebp),%edx
+  b.str = str;
+ d29:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+ d2c:	e8 2f fc ff ff       	call   960 <format>
+  *b.str = '\0';
+ d31:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d34:	c6 00 00             	movb   $0x0,(%eax)
+  return b.str - str;
+ d37:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d3a:	29 d8                	sub    %ebx,%eax
+}
+ d3c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ d3f:	c9                   	leave
+ d40:	c3                   	ret
+ d41:	66 90                	xchg   %ax,%ax
+ d43:	66 90                	xchg   %ax,%ax
+ d45:	66 90                	xchg   %ax,%ax
+ d47:	66 90                	xchg   %ax,%ax
+ d49:	66 90                	xchg   %ax,%ax
+ d4b:	66 90                	xchg   %ax,%ax
+ d4d:	66 90                	xchg   %ax,%ax
+ d4f:	90                   	nop
+
+00000d50 <freeblock>:
+static Header *freep;
+static struct umutex lock;  // threads made by clone() share the heap
+
+static void
+freeblock(void *ap)
+{
+ d50:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ d51:	8d 48 f8             	lea    -0x8(%eax),%ecx
+{
+ d54:	89 e5                	mov    %esp,%ebp
+ d56:	57                   	push   %edi
+ d57:	56                   	push   %esi
+ d58:	53                   	push   %ebx
+ d59:	89 c3                	mov    %eax,%ebx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ d5b:	a1 1c 22 00 00       	mov    0x221c,%eax
+ d60:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d62:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ d64:	39 ca                	cmp    %ecx,%edx
+ d66:	73 30                	jae    d98 <freeblock+0x48>
+ d68:	39 c1                	cmp    %eax,%ecx
+ d6a:	72 04                	jb     d70 <freeblock+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d6c:	39 c2                	cmp    %eax,%edx
+ d6e:	72 f0                	jb     d60 <freeblock+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ d70:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ d73:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ d76:	39 f8                	cmp    %edi,%eax
+ d78:	74 26                	je     da0 <freeblock+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ d7a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ d7d:	8b 42 04             	mov    0x4(%edx),%eax
+ d80:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ d83:	39 f1                	cmp    %esi,%ecx
+ d85:	74 30                	je     db7 <freeblock+0x67>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ d87:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ d89:	5b                   	pop    %ebx
+  freep = p;
+ d8a:	89 15 1c 22 00 00    	mov    %edx,0x221c
+}
+ d90:	5e                   	pop    %esi
+ d91:	5f                   	pop    %edi
+ d92:	5d                   	pop    %ebp
+ d93:	c3                   	ret
+ d94:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d98:	39 c1                	cmp    %eax,%ecx
+ d9a:	72 d0                	jb     d6c <freeblock+0x1c>
+ d9c:	eb c2                	jmp    d60 <freeblock+0x10>
+ d9e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ da0:	03 70 04             	add    0x4(%eax),%esi
+ da3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ da6:	8b 02                	mov    (%edx),%eax
+ da8:	8b 00                	mov    (%eax),%eax
+ daa:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ dad:	8b 42 04             	mov    0x4(%edx),%eax
+ db0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ db3:	39 f1                	cmp    %esi,%ecx
+ db5:	75 d0                	jne    d87 <freeblock+0x37>
+    p->s.size += bp->s.size;
+ db7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ dba:	89 15 1c 22 00 00    	mov    %edx,0x221c
+    p->s.size += bp->s.size;
+ dc0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ dc3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ dc6:	89 0a                	mov    %ecx,(%edx)
+}
+ dc8:	5b                   	pop    %ebx
+ dc9:	5e                   	pop    %esi
+ dca:	5f                   	pop    %edi
+ dcb:	5d                   	pop    %ebp
+ dcc:	c3                   	ret
+ dcd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000dd0 <free>:
+
+void
+free(void *ap)
+{
+ dd0:	55                   	push   %ebp
+ dd1:	89 e5                	mov    %esp,%ebp
+ dd3:	53                   	push   %ebx
+ dd4:	83 ec 10             	sub    $0x10,%esp
+ dd7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  umtxlock(&lock);
+ dda:	68 18 22 00 00       	push   $0x2218
+ ddf:	e8 cc f7 ff ff       	call   5b0 <umtxlock>
+  freeblock(ap);
+ de4:	89 d8                	mov    %ebx,%eax
+ de6:	e8 65 ff ff ff       	call   d50 <freeblock>
+  umtxunlock(&lock);
+ deb:	c7 45 08 18 22 00 00 	movl   $0x2218,0x8(%ebp)
+}
+ df2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&lock);
+ df5:	83 c4 10             	add    $0x10,%esp
+}
+ df8:	c9                   	leave
+  umtxunlock(&lock);
+ df9:	e9 02 f8 ff ff       	jmp    600 <umtxunlock>
+ dfe:	66 90                	xchg   %ax,%ax
+
+00000e00 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ e00:	55                   	push   %ebp
+ e01:	89 e5                	mov    %esp,%ebp
+ e03:	57                   	push   %edi
+ e04:	56                   	push   %esi
+ e05:	53                   	push   %ebx
+ e06:	83 ec 28             	sub    $0x28,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ e09:	8b 45 08             	mov    0x8(%ebp),%eax
+  umtxlock(&lock);
+ e0c:	68 18 22 00 00       	push   $0x2218
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ e11:	8d 48 07             	lea    0x7(%eax),%ecx
+ e14:	c1 e9 03             	shr    $0x3,%ecx
+ e17:	8d 71 01             	lea    0x1(%ecx),%esi
+  umtxlock(&lock);
+ e1a:	e8 91 f7 ff ff       	call   5b0 <umtxlock>
+  if((prevp = freep) == 0){
+ e1f:	8b 15 1c 22 00 00    	mov    0x221c,%edx
+ e25:	83 c4 10             	add    $0x10,%esp
+ e28:	85 d2                	test   %edx,%edx
+ e2a:	0f 84 b0 00 00 00    	je     ee0 <malloc+0xe0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ e30:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ e32:	8b 47 04             	mov    0x4(%edi),%eax
+ e35:	39 f0                	cmp    %esi,%eax
+ e37:	73 6f                	jae    ea8 <malloc+0xa8>
+  if(nu < 4096)
+ e39:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ e3e:	39 de                	cmp    %ebx,%esi
+ e40:	0f 43 de             	cmovae %esi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ e43:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ e4a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ e4d:	eb 0a                	jmp    e59 <malloc+0x59>
+ e4f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ e50:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ e52:	8b 47 04             	mov    0x4(%edi),%eax
+ e55:	39 f0                	cmp    %esi,%eax
+ e57:	73 4f                	jae    ea8 <malloc+0xa8>
+      }
+      freep = prevp;
+      umtxunlock(&lock);
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ e59:	89 fa                	mov    %edi,%edx
+ e5b:	39 3d 1c 22 00 00    	cmp    %edi,0x221c
+ e61:	75 ed                	jne    e50 <malloc+0x50>
+  p = sbrk(nu * sizeof(Header));
+ e63:	83 ec 0c             	sub    $0xc,%esp
+ e66:	ff 75 e4             	push   -0x1c(%ebp)
+ e69:	e8 4a f8 ff ff       	call   6b8 <sbrk>
+  if(p == (char*)-1)
+ e6e:	83 c4 10             	add    $0x10,%esp
+ e71:	83 f8 ff             	cmp    $0xffffffff,%eax
+ e74:	74 15                	je     e8b <malloc+0x8b>
+  hp->s.size = nu;
+ e76:	89 58 04             	mov    %ebx,0x4(%eax)
+  freeblock((void*)(hp + 1));
+ e79:	83 c0 08             	add    $0x8,%eax
+ e7c:	e8 cf fe ff ff       	call   d50 <freeblock>
+  return freep;
+ e81:	8b 15 1c 22 00 00    	mov    0x221c,%edx
+      if((p = morecore(nunits)) == 0){
+ e87:	85 d2                	test   %edx,%edx
+ e89:	75 c5                	jne    e50 <malloc+0x50>
+        umtxunlock(&lock);
+ e8b:	83 ec 0c             	sub    $0xc,%esp
+ e8e:	68 18 22 00 00       	push   $0x2218
+ e93:	e8 68 f7 ff ff       	call   600 <umtxunlock>
+        return 0;
+ e98:	83 c4 10             	add    $0x10,%esp
+      }
+  }
+}
+ e9b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ e9e:	31 c0                	xor    %eax,%eax
+}
+ ea0:	5b                   	pop    %ebx
+ ea1:	5e                   	pop    %esi
+ ea2:	5f                   	pop    %edi
+ ea3:	5d                   	pop    %ebp
+ ea4:	c3                   	ret
+ ea5:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ ea8:	39 c6                	cmp    %eax,%esi
+ eaa:	74 64                	je     f10 <malloc+0x110>
+        p->s.size -= nunits;
+ eac:	29 f0                	sub    %esi,%eax
+ eae:	89 47 04             	mov    %eax,0x4(%edi)
+        p += p->s.size;
+ eb1:	8d 3c c7             	lea    (%edi,%eax,8),%edi
+        p->s.size = nunits;
+ eb4:	89 77 04             	mov    %esi,0x4(%edi)
+      umtxunlock(&lock);
+ eb7:	83 ec 0c             	sub    $0xc,%esp
+      freep = prevp;
+ eba:	89 15 1c 22 00 00    	mov    %edx,0x221c
+      umtxunlock(&lock);
+ ec0:	68 18 22 00 00       	push   $0x2218
+ ec5:	e8 36 f7 ff ff       	call   600 <umtxunlock>
+      return (void*)(p + 1);
+ eca:	83 c4 10             	add    $0x10,%esp
+}
+ ecd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ ed0:	8d 47 08             	lea    0x8(%edi),%eax
+}
+ ed3:	5b                   	pop    %ebx
+ ed4:	5e                   	pop    %esi
+ ed5:	5f                   	pop    %edi
+ ed6:	5d                   	pop    %ebp
+ ed7:	c3                   	ret
+ ed8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ edf:	90                   	nop
+    base.s.ptr = freep = prevp = &base;
+ ee0:	c7 05 1c 22 00 00 20 	movl   $0x2220,0x221c
+ ee7:	22 00 00 
+    base.s.size = 0;
+ eea:	bf 20 22 00 00       	mov    $0x2220,%edi
+    base.s.ptr = freep = prevp = &base;
+ eef:	c7 05 20 22 00 00 20 	movl   $0x2220,0x2220
+ ef6:	22 00 00 
+    base.s.size = 0;
+ ef9:	c7 05 24 22 00 00 00 	movl   $0x0,0x2224
+ f00:	00 00 00 
+    if(p->s.size >= nunits){
+ f03:	e9 31 ff ff ff       	jmp    e39 <malloc+0x39>
+ f08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ f0f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ f10:	8b 07                	mov    (%edi),%eax
+ f12:	89 02                	mov    %eax,(%edx)
+ f14:	eb a1                	jmp    eb7 <malloc+0xb7>
+ f16:	66 90                	xchg   %ax,%ax
+ f18:	66 90                	xchg   %ax,%ax
+ f1a:	66 90                	xchg   %ax,%ax
+ f1c:	66 90                	xchg   %ax,%ax
+ f1e:	66 90                	xchg   %ax,%ax
+
+00000f20 <threadstart>:
+
+#define TSTACKSZ 4096
+
+static void
+threadstart(void *fn, void *arg)
+{
+ f20:	55                   	push   %ebp
+ f21:	89 e5                	mov    %esp,%ebp
+ f23:	83 ec 14             	sub    $0x14,%esp
+  ((void (*)(void*))fn)(arg);
+ f26:	ff 75 0c             	push   0xc(%ebp)
+ f29:	ff 55 08             	call   *0x8(%ebp)
+  exit();
+ f2c:	e8 ef f4 ff ff       	call   420 <exit>
+ f31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ f38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ f3f:	90                   	nop
+
+00000f40 <thread_create>:
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ f40:	55                   	push   %ebp
+ f41:	89 e5                	mov    %esp,%ebp
+ f43:	53                   	push   %ebx
+ f44:	83 ec 20             	sub    $0x20,%esp
+  char *mem, *stack;
+  int pid;
+
+  if((mem = malloc(2*TSTACKSZ)) == 0)
+ f47:	68 00 20 00 00       	push   $0x2000
+ f4c:	e8 af fe ff ff       	call   e00 <malloc>
+ f51:	83 c4 10             	add    $0x10,%esp
+ f54:	85 c0                	test   %eax,%eax
+ f56:	74 47                	je     f9f <thread_create+0x5f>
+ f58:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)(((uint)mem + TSTACKSZ - 1) & ~(TSTACKSZ - 1));
+ f5a:	8d 80 ff 0f 00 00    	lea    0xfff(%eax),%eax
+ f60:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  *(char**)stack = mem;
+ f65:	89 18                	mov    %ebx,(%eax)
+  if((pid = clone(threadstart, (void*)fn, arg, stack)) < 0)
+ f67:	50                   	push   %eax
+ f68:	ff 75 0c             	push   0xc(%ebp)
+ f6b:	ff 75 08             	push   0x8(%ebp)
+ f6e:	68 20 0f 00 00       	push   $0xf20
+ f73:	e8 08 f8 ff ff       	call   780 <clone>
+ f78:	83 c4 10             	add    $0x10,%esp
+ f7b:	85 c0                	test   %eax,%eax
+ f7d:	78 09                	js     f88 <thread_create+0x48>
+    free(mem);
+  return pid;
+}
+ f7f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ f82:	c9                   	leave
+ f83:	c3                   	ret
+ f84:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    free(mem);
+ f88:	83 ec 0c             	sub    $0xc,%esp
+ f8b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ f8e:	53                   	push   %ebx
+ f8f:	e8 3c fe ff ff       	call   dd0 <free>
+ f94:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ f97:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+ f9a:	83 c4 10             	add    $0x10,%esp
+}
+ f9d:	c9                   	leave
+ f9e:	c3                   	ret
+    return -1;
+ f9f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ fa4:	eb d9                	jmp    f7f <thread_create+0x3f>
+ fa6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ fad:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000fb0 <thread_join>:
+
+int
+thread_join(void)
+{
+ fb0:	55                   	push   %ebp
+ fb1:	89 e5                	mov    %esp,%ebp
+ fb3:	83 ec 34             	sub    $0x34,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+ fb6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ fb9:	50                   	push   %eax
+ fba:	e8 c9 f7 ff ff       	call   788 <join>
+ fbf:	83 c4 10             	add    $0x10,%esp
+ fc2:	85 c0                	test   %eax,%eax
+ fc4:	79 0a                	jns    fd0 <thread_join+0x20>
+    free(*(char**)stack);
+  return pid;
+}
+ fc6:	c9                   	leave
+ fc7:	c3                   	ret
+ fc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ fcf:	90                   	nop
+    free(*(char**)stack);
+ fd0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ fd3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ fd6:	83 ec 0c             	sub    $0xc,%esp
+ fd9:	ff 32                	push   (%edx)
+ fdb:	e8 f0 fd ff ff       	call   dd0 <free>
+ fe0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ fe3:	83 c4 10             	add    $0x10,%esp
+}
+ fe6:	c9                   	leave
+ fe7:	c3                   	ret
@@ -0,0 +1,48 @@
+// Copy a file. sendfile() moves the data inside the kernel,
+// several pages per log transaction, instead of through a
+// user buffer a block or so at a time.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+
+int
+main(int argc, char *argv[])
+{
+  int in, out, n;
+  struct stat st, dst;
+
+  if(argc != 3){
+    printf(2, "Usage: cp src dst\n");
+    exit();
+  }
+  if((in = open(argv[1], O_RDONLY)) < 0){
+    printf(2, "cp: cannot open %s\n", argv[1]);
+    exit();
+  }
+  if(fstat(in, &st) < 0 || st.type != T_FILE){
+    printf(2, "cp: %s is not a file\n", argv[1]);
+    exit();
+  }
+  // There is no O_TRUNC: start from an empty file, but
+  // never by unlinking the source.
+  if(stat(argv[2], &dst) == 0 && dst.type == T_FILE){
+    if(dst.dev == st.dev && dst.ino == st.ino){
+      printf(2, "cp: %s and %s are the same file\n", argv[1], argv[2]);
+      exit();
+    }
+    unlink(argv[2]);
+  }
+  if((out = open(argv[2], O_CREATE|O_WRONLY)) < 0){
+    printf(2, "cp: cannot create %s\n", argv[2]);
+    exit();
+  }
+  while((n = sendfile(out, in, 64*1024)) > 0)
+    ;
+  if(n < 0)
+    printf(2, "cp: %s to %s: copy failed\n", argv[1], argv[2]);
+  close(in);
+  close(out);
+  exit();
+}
@@ -0,0 +1,2535 @@
+
+_cpbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <copy>:
+
+char buf[4096];
+
+int
+copy(int usesendfile, uint *nwrite)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	57                   	push   %edi
+       4:	56                   	push   %esi
+  struct iostat s0, s1;
+  int in, out, n, r, t0;
+
+  iostat(&s0);
+       5:	8d 45 98             	lea    -0x68(%ebp),%eax
+{
+       8:	53                   	push   %ebx
+       9:	83 ec 78             	sub    $0x78,%esp
+  iostat(&s0);
+       c:	50                   	push   %eax
+       d:	e8 0e 09 00 00       	call   920 <iostat>
+  t0 = uptime();
+      12:	e8 d1 08 00 00       	call   8e8 <uptime>
+      17:	c7 45 94 08 00 00 00 	movl   $0x8,-0x6c(%ebp)
+      1e:	83 c4 10             	add    $0x10,%esp
+      21:	89 45 90             	mov    %eax,-0x70(%ebp)
+      24:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(r = 0; r < NROUND; r++){
+    unlink("cpbench.dst");
+      28:	83 ec 0c             	sub    $0xc,%esp
+      2b:	68 08 12 00 00       	push   $0x1208
+      30:	e8 6b 08 00 00       	call   8a0 <unlink>
+    if((in = open("cpbench.src", O_RDONLY)) < 0 ||
+      35:	5a                   	pop    %edx
+      36:	59                   	pop    %ecx
+      37:	6a 00                	push   $0x0
+      39:	68 14 12 00 00       	push   $0x1214
+      3e:	e8 4d 08 00 00       	call   890 <open>
+      43:	83 c4 10             	add    $0x10,%esp
+      46:	89 c3                	mov    %eax,%ebx
+      48:	85 c0                	test   %eax,%eax
+      4a:	0f 88 f4 00 00 00    	js     144 <copy+0x144>
+       (out = open("cpbench.dst", O_CREATE|O_WRONLY)) < 0){
+      50:	83 ec 08             	sub    $0x8,%esp
+      53:	68 01 02 00 00       	push   $0x201
+      58:	68 08 12 00 00       	push   $0x1208
+      5d:	e8 2e 08 00 00       	call   890 <open>
+    if((in = open("cpbench.src", O_RDONLY)) < 0 ||
+      62:	83 c4 10             	add    $0x10,%esp
+       (out = open("cpbench.dst", O_CREATE|O_WRONLY)) < 0){
+      65:	89 c6                	mov    %eax,%esi
+    if((in = open("cpbench.src", O_RDONLY)) < 0 ||
+      67:	85 c0                	test   %eax,%eax
+      69:	0f 88 d5 00 00 00    	js     144 <copy+0x144>
+      printf(1, "cpbench: open failed\n");
+      exit();
+    }
+    if(usesendfile){
+      6f:	8b 45 08             	mov    0x8(%ebp),%eax
+      72:	85 c0                	test   %eax,%eax
+      74:	0f 84 8c 00 00 00    	je     106 <copy+0x106>
+      7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      while((n = sendfile(out, in, FILESZ)) > 0)
+      80:	83 ec 04             	sub    $0x4,%esp
+      83:	68 00 00 01 00       	push   $0x10000
+      88:	53                   	push   %ebx
+      89:	56                   	push   %esi
+      8a:	e8 e1 08 00 00       	call   970 <sendfile>
+      8f:	83 c4 10             	add    $0x10,%esp
+      92:	85 c0                	test   %eax,%eax
+      94:	7f ea                	jg     80 <copy+0x80>
+      96:	89 c7                	mov    %eax,%edi
+        if(write(out, buf, n) != n){
+          n = -1;
+          break;
+        }
+    }
+    if(n < 0){
+      98:	85 ff                	test   %edi,%edi
+      9a:	0f 85 90 00 00 00    	jne    130 <copy+0x130>
+      printf(1, "cpbench: copy failed\n");
+      exit();
+    }
+    close(in);
+      a0:	83 ec 0c             	sub    $0xc,%esp
+      a3:	53                   	push   %ebx
+      a4:	e8 e7 06 00 00       	call   790 <close>
+    close(out);
+      a9:	89 34 24             	mov    %esi,(%esp)
+      ac:	e8 df 06 00 00       	call   790 <close>
+  for(r = 0; r < NROUND; r++){
+      b1:	83 c4 10             	add    $0x10,%esp
+      b4:	83 6d 94 01          	subl   $0x1,-0x6c(%ebp)
+      b8:	0f 85 6a ff ff ff    	jne    28 <copy+0x28>
+  }
+  t0 = uptime() - t0;
+      be:	8b 7d 90             	mov    -0x70(%ebp),%edi
+      c1:	e8 22 08 00 00       	call   8e8 <uptime>
+  iostat(&s1);
+      c6:	83 ec 0c             	sub    $0xc,%esp
+  t0 = uptime() - t0;
+      c9:	29 f8                	sub    %edi,%eax
+      cb:	89 c3                	mov    %eax,%ebx
+  iostat(&s1);
+      cd:	8d 45 c0             	lea    -0x40(%ebp),%eax
+      d0:	50                   	push   %eax
+      d1:	e8 4a 08 00 00       	call   920 <iostat>
+  *nwrite = s1.nwrite - s0.nwrite;
+      d6:	8b 55 0c             	mov    0xc(%ebp),%edx
+      d9:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+      dc:	2b 45 9c             	sub    -0x64(%ebp),%eax
+      df:	89 02                	mov    %eax,(%edx)
+  return t0;
+}
+      e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      e4:	89 d8                	mov    %ebx,%eax
+      e6:	5b                   	pop    %ebx
+      e7:	5e                   	pop    %esi
+      e8:	5f                   	pop    %edi
+      e9:	5d                   	pop    %ebp
+      ea:	c3                   	ret
+      eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      ef:	90                   	nop
+        if(write(out, buf, n) != n){
+      f0:	83 ec 04             	sub    $0x4,%esp
+      f3:	57                   	push   %edi
+      f4:	68 20 22 00 00       	push   $0x2220
+      f9:	56                   	push   %esi
+      fa:	e8 11 06 00 00       	call   710 <write>
+      ff:	83 c4 10             	add    $0x10,%esp
+     102:	39 f8                	cmp    %edi,%eax
+     104:	75 2a                	jne    130 <copy+0x130>
+      while((n = read(in, buf, sizeof(buf))) > 0)
+     106:	83 ec 04             	sub    $0x4,%esp
+     109:	68 00 10 00 00       	push   $0x1000
+     10e:	68 20 22 00 00       	push   $0x2220
+     113:	53                   	push   %ebx
+     114:	e8 77 05 00 00       	call   690 <read>
+     119:	83 c4 10             	add    $0x10,%esp
+     11c:	89 c7                	mov    %eax,%edi
+     11e:	85 c0                	test   %eax,%eax
+     120:	7f ce                	jg     f0 <copy+0xf0>
+     122:	e9 71 ff ff ff       	jmp    98 <copy+0x98>
+     127:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     12e:	66 90                	xchg   %ax,%ax
+      printf(1, "cpbench: copy failed\n");
+     130:	83 ec 08             	sub    $0x8,%esp
+     133:	68 36 12 00 00       	push   $0x1236
+     138:	6a 01                	push   $0x1
+     13a:	e8 91 0c 00 00       	call   dd0 <printf>
+      exit();
+     13f:	e8 fc 04 00 00       	call   640 <exit>
+      printf(1, "cpbench: open failed\n");
+     144:	83 ec 08             	sub    $0x8,%esp
+     147:	68 20 12 00 00       	push   $0x1220
+     14c:	6a 01                	push   $0x1
+     14e:	e8 7d 0c 00 00       	call   dd0 <printf>
+      exit();
+     153:	e8 e8 04 00 00       	call   640 <exit>
+     158:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     15f:	90                   	nop
+
+00000160 <check>:
+
+void
+check(void)
+{
+     160:	55                   	push   %ebp
+     161:	89 e5                	mov    %esp,%ebp
+     163:	57                   	push   %edi
+     164:	56                   	push   %esi
+     165:	53                   	push   %ebx
+     166:	83 ec 24             	sub    $0x24,%esp
+  int fd, i, n, off;
+
+  if((fd = open("cpbench.dst", O_RDONLY)) < 0){
+     169:	6a 00                	push   $0x0
+     16b:	68 08 12 00 00       	push   $0x1208
+     170:	e8 1b 07 00 00       	call   890 <open>
+     175:	83 c4 10             	add    $0x10,%esp
+     178:	85 c0                	test   %eax,%eax
+     17a:	0f 88 a8 00 00 00    	js     228 <check+0xc8>
+    printf(1, "cpbench: cannot open cpbench.dst\n");
+    exit();
+  }
+  for(off = 0; (n = read(fd, buf, sizeof(buf))) > 0; off += n)
+    for(i = 0; i < n; i++)
+      if(buf[i] != (char)((off + i) % 251)){
+     180:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(off = 0; (n = read(fd, buf, sizeof(buf))) > 0; off += n)
+     183:	31 f6                	xor    %esi,%esi
+     185:	8d 76 00             	lea    0x0(%esi),%esi
+     188:	83 ec 04             	sub    $0x4,%esp
+     18b:	68 00 10 00 00       	push   $0x1000
+     190:	68 20 22 00 00       	push   $0x2220
+     195:	ff 75 e4             	push   -0x1c(%ebp)
+     198:	e8 f3 04 00 00       	call   690 <read>
+     19d:	83 c4 10             	add    $0x10,%esp
+     1a0:	89 c7                	mov    %eax,%edi
+     1a2:	85 c0                	test   %eax,%eax
+     1a4:	7e 34                	jle    1da <check+0x7a>
+    for(i = 0; i < n; i++)
+     1a6:	31 c9                	xor    %ecx,%ecx
+     1a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1af:	90                   	nop
+      if(buf[i] != (char)((off + i) % 251)){
+     1b0:	8d 1c 0e             	lea    (%esi,%ecx,1),%ebx
+     1b3:	b8 bf bf 8c 82       	mov    $0x828cbfbf,%eax
+     1b8:	f7 e3                	mul    %ebx
+     1ba:	89 d8                	mov    %ebx,%eax
+     1bc:	c1 ea 07             	shr    $0x7,%edx
+     1bf:	69 d2 fb 00 00 00    	imul   $0xfb,%edx,%edx
+     1c5:	29 d0                	sub    %edx,%eax
+     1c7:	38 81 20 22 00 00    	cmp    %al,0x2220(%ecx)
+     1cd:	75 44                	jne    213 <check+0xb3>
+    for(i = 0; i < n; i++)
+     1cf:	83 c1 01             	add    $0x1,%ecx
+     1d2:	39 cf                	cmp    %ecx,%edi
+     1d4:	75 da                	jne    1b0 <check+0x50>
+  for(off = 0; (n = read(fd, buf, sizeof(buf))) > 0; off += n)
+     1d6:	01 fe                	add    %edi,%esi
+     1d8:	eb ae                	jmp    188 <check+0x28>
+        printf(1, "cpbench: copy differs at byte %d\n", off + i);
+        exit();
+      }
+  if(off != FILESZ)
+     1da:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     1dd:	81 fe 00 00 01 00    	cmp    $0x10000,%esi
+     1e3:	75 14                	jne    1f9 <check+0x99>
+    printf(1, "cpbench: copy has %d bytes, expected %d\n", off, FILESZ);
+  close(fd);
+     1e5:	83 ec 0c             	sub    $0xc,%esp
+     1e8:	52                   	push   %edx
+     1e9:	e8 a2 05 00 00       	call   790 <close>
+}
+     1ee:	83 c4 10             	add    $0x10,%esp
+     1f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     1f4:	5b                   	pop    %ebx
+     1f5:	5e                   	pop    %esi
+     1f6:	5f                   	pop    %edi
+     1f7:	5d                   	pop    %ebp
+     1f8:	c3                   	ret
+    printf(1, "cpbench: copy has %d bytes, expected %d\n", off, FILESZ);
+     1f9:	68 00 00 01 00       	push   $0x10000
+     1fe:	56                   	push   %esi
+     1ff:	68 94 12 00 00       	push   $0x1294
+     204:	6a 01                	push   $0x1
+     206:	e8 c5 0b 00 00       	call   dd0 <printf>
+     20b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     20e:	83 c4 10             	add    $0x10,%esp
+     211:	eb d2                	jmp    1e5 <check+0x85>
+        printf(1, "cpbench: copy differs at byte %d\n", off + i);
+     213:	83 ec 04             	sub    $0x4,%esp
+     216:	53                   	push   %ebx
+     217:	68 70 12 00 00       	push   $0x1270
+     21c:	6a 01                	push   $0x1
+     21e:	e8 ad 0b 00 00       	call   dd0 <printf>
+        exit();
+     223:	e8 18 04 00 00       	call   640 <exit>
+    printf(1, "cpbench: cannot open cpbench.dst\n");
+     228:	50                   	push   %eax
+     229:	50                   	push   %eax
+     22a:	68 4c 12 00 00       	push   $0x124c
+     22f:	6a 01                	push   $0x1
+     231:	e8 9a 0b 00 00       	call   dd0 <printf>
+    exit();
+     236:	e8 05 04 00 00       	call   640 <exit>
+     23b:	66 90                	xchg   %ax,%ax
+     23d:	66 90                	xchg   %ax,%ax
+     23f:	90                   	nop
+
+00000240 <main>:
+
+int
+main(int argc, char *argv[])
+{
+     240:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     244:	83 e4 f0             	and    $0xfffffff0,%esp
+     247:	ff 71 fc             	push   -0x4(%ecx)
+     24a:	55                   	push   %ebp
+     24b:	89 e5                	mov    %esp,%ebp
+     24d:	57                   	push   %edi
+     24e:	56                   	push   %esi
+     24f:	53                   	push   %ebx
+     250:	51                   	push   %ecx
+     251:	83 ec 30             	sub    $0x30,%esp
+  int fd, i, off, tr, ts;
+  uint wr, ws;
+
+  if((fd = open("cpbench.src", O_CREATE|O_RDWR)) < 0){
+     254:	68 02 02 00 00       	push   $0x202
+     259:	68 14 12 00 00       	push   $0x1214
+     25e:	e8 2d 06 00 00       	call   890 <open>
+     263:	83 c4 10             	add    $0x10,%esp
+     266:	85 c0                	test   %eax,%eax
+     268:	0f 88 e2 00 00 00    	js     350 <main+0x110>
+     26e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     271:	31 f6                	xor    %esi,%esi
+     273:	bf bf bf 8c 82       	mov    $0x828cbfbf,%edi
+     278:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     27f:	90                   	nop
+    printf(1, "cpbench: cannot create cpbench.src\n");
+    exit();
+  }
+  for(off = 0; off < FILESZ; off += sizeof(buf)){
+    for(i = 0; i < sizeof(buf); i++)
+     280:	31 c9                	xor    %ecx,%ecx
+     282:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      buf[i] = (off + i) % 251;
+     288:	8d 1c 31             	lea    (%ecx,%esi,1),%ebx
+    for(i = 0; i < sizeof(buf); i++)
+     28b:	83 c1 01             	add    $0x1,%ecx
+      buf[i] = (off + i) % 251;
+     28e:	89 d8                	mov    %ebx,%eax
+     290:	f7 e7                	mul    %edi
+     292:	c1 ea 07             	shr    $0x7,%edx
+     295:	69 d2 fb 00 00 00    	imul   $0xfb,%edx,%edx
+     29b:	29 d3                	sub    %edx,%ebx
+     29d:	88 99 1f 22 00 00    	mov    %bl,0x221f(%ecx)
+    for(i = 0; i < sizeof(buf); i++)
+     2a3:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+     2a9:	75 dd                	jne    288 <main+0x48>
+    write(fd, buf, sizeof(buf));
+     2ab:	83 ec 04             	sub    $0x4,%esp
+  for(off = 0; off < FILESZ; off += sizeof(buf)){
+     2ae:	81 c6 00 10 00 00    	add    $0x1000,%esi
+    write(fd, buf, sizeof(buf));
+     2b4:	68 00 10 00 00       	push   $0x1000
+     2b9:	68 20 22 00 00       	push   $0x2220
+     2be:	ff 75 d4             	push   -0x2c(%ebp)
+     2c1:	e8 4a 04 00 00       	call   710 <write>
+  for(off = 0; off < FILESZ; off += sizeof(buf)){
+     2c6:	83 c4 10             	add    $0x10,%esp
+     2c9:	81 fe 00 00 01 00    	cmp    $0x10000,%esi
+     2cf:	75 af                	jne    280 <main+0x40>
+  }
+  close(fd);
+     2d1:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     2d4:	83 ec 0c             	sub    $0xc,%esp
+     2d7:	50                   	push   %eax
+     2d8:	e8 b3 04 00 00       	call   790 <close>
+
+  tr = copy(0, &wr);
+     2dd:	58                   	pop    %eax
+     2de:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     2e1:	5a                   	pop    %edx
+     2e2:	50                   	push   %eax
+     2e3:	6a 00                	push   $0x0
+     2e5:	e8 16 fd ff ff       	call   0 <copy>
+     2ea:	89 c6                	mov    %eax,%esi
+  check();
+     2ec:	e8 6f fe ff ff       	call   160 <check>
+  ts = copy(1, &ws);
+     2f1:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     2f4:	59                   	pop    %ecx
+     2f5:	5b                   	pop    %ebx
+     2f6:	50                   	push   %eax
+     2f7:	6a 01                	push   $0x1
+     2f9:	e8 02 fd ff ff       	call   0 <copy>
+     2fe:	89 c3                	mov    %eax,%ebx
+  check();
+     300:	e8 5b fe ff ff       	call   160 <check>
+  printf(1, "cpbench: %d x %d KB, read/write: %d ticks, %d disk writes\n",
+     305:	5f                   	pop    %edi
+     306:	58                   	pop    %eax
+     307:	ff 75 e0             	push   -0x20(%ebp)
+     30a:	56                   	push   %esi
+     30b:	6a 40                	push   $0x40
+     30d:	6a 08                	push   $0x8
+     30f:	68 e4 12 00 00       	push   $0x12e4
+     314:	6a 01                	push   $0x1
+     316:	e8 b5 0a 00 00       	call   dd0 <printf>
+         NROUND, FILESZ/1024, tr, wr);
+  printf(1, "cpbench: %d x %d KB, sendfile: %d ticks, %d disk writes\n",
+     31b:	83 c4 18             	add    $0x18,%esp
+     31e:	ff 75 e4             	push   -0x1c(%ebp)
+     321:	53                   	push   %ebx
+     322:	6a 40                	push   $0x40
+     324:	6a 08                	push   $0x8
+     326:	68 20 13 00 00       	push   $0x1320
+     32b:	6a 01                	push   $0x1
+     32d:	e8 9e 0a 00 00       	call   dd0 <printf>
+         NROUND, FILESZ/1024, ts, ws);
+  unlink("cpbench.src");
+     332:	83 c4 14             	add    $0x14,%esp
+     335:	68 14 12 00 00       	push   $0x1214
+     33a:	e8 61 05 00 00       	call   8a0 <unlink>
+  unlink("cpbench.dst");
+     33f:	c7 04 24 08 12 00 00 	movl   $0x1208,(%esp)
+     346:	e8 55 05 00 00       	call   8a0 <unlink>
+  exit();
+     34b:	e8 f0 02 00 00       	call   640 <exit>
+    printf(1, "cpbench: cannot create cpbench.src\n");
+     350:	50                   	push   %eax
+     351:	50                   	push   %eax
+     352:	68 c0 12 00 00       	push   $0x12c0
+     357:	6a 01                	push   $0x1
+     359:	e8 72 0a 00 00       	call   dd0 <printf>
+    exit();
+     35e:	e8 dd 02 00 00       	call   640 <exit>
+     363:	66 90                	xchg   %ax,%ax
+     365:	66 90                	xchg   %ax,%ax
+     367:	66 90                	xchg   %ax,%ax
+     369:	66 90                	xchg   %ax,%ax
+     36b:	66 90                	xchg   %ax,%ax
+     36d:	66 90                	xchg   %ax,%ax
+     36f:	90                   	nop
+
+00000370 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     370:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     371:	31 c0                	xor    %eax,%eax
+{
+     373:	89 e5                	mov    %esp,%ebp
+     375:	53                   	push   %ebx
+     376:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     379:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     37c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     380:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     384:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     387:	83 c0 01             	add    $0x1,%eax
+     38a:	84 d2                	test   %dl,%dl
+     38c:	75 f2                	jne    380 <strcpy+0x10>
+    ;
+  return os;
+}
+     38e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     391:	89 c8                	mov    %ecx,%eax
+     393:	c9                   	leave
+     394:	c3                   	ret
+     395:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     39c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003a0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     3a0:	55                   	push   %ebp
+     3a1:	89 e5                	mov    %esp,%ebp
+     3a3:	53                   	push   %ebx
+     3a4:	8b 55 08             	mov    0x8(%ebp),%edx
+     3a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     3aa:	0f b6 02             	movzbl (%edx),%eax
+     3ad:	84 c0                	test   %al,%al
+     3af:	75 17                	jne    3c8 <strcmp+0x28>
+     3b1:	eb 3a                	jmp    3ed <strcmp+0x4d>
+     3b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     3b7:	90                   	nop
+     3b8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     3bc:	83 c2 01             	add    $0x1,%edx
+     3bf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     3c2:	84 c0                	test   %al,%al
+     3c4:	74 1a                	je     3e0 <strcmp+0x40>
+    p++, q++;
+     3c6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     3c8:	0f b6 19             	movzbl (%ecx),%ebx
+     3cb:	38 c3                	cmp    %al,%bl
+     3cd:	74 e9                	je     3b8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     3cf:	29 d8                	sub    %ebx,%eax
+}
+     3d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     3d4:	c9                   	leave
+     3d5:	c3                   	ret
+     3d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3dd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     3e0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     3e4:	31 c0                	xor    %eax,%eax
+     3e6:	29 d8                	sub    %ebx,%eax
+}
+     3e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     3eb:	c9                   	leave
+     3ec:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     3ed:	0f b6 19             	movzbl (%ecx),%ebx
+     3f0:	31 c0                	xor    %eax,%eax
+     3f2:	eb db                	jmp    3cf <strcmp+0x2f>
+     3f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     3ff:	90                   	nop
+
+00000400 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     400:	55                   	push   %ebp
+     401:	89 e5                	mov    %esp,%ebp
+     403:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     406:	80 3a 00             	cmpb   $0x0,(%edx)
+     409:	74 15                	je     420 <strlen+0x20>
+     40b:	31 c0                	xor    %eax,%eax
+     40d:	8d 76 00             	lea    0x0(%esi),%esi
+     410:	83 c0 01             	add    $0x1,%eax
+     413:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     417:	89 c1                	mov    %eax,%ecx
+     419:	75 f5                	jne    410 <strlen+0x10>
+    ;
+  return n;
+}
+     41b:	89 c8                	mov    %ecx,%eax
+     41d:	5d                   	pop    %ebp
+     41e:	c3                   	ret
+     41f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     420:	31 c9                	xor    %ecx,%ecx
+}
+     422:	5d                   	pop    %ebp
+     423:	89 c8                	mov    %ecx,%eax
+     425:	c3                   	ret
+     426:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     42d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000430 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     430:	55                   	push   %ebp
+     431:	89 e5                	mov    %esp,%ebp
+     433:	57                   	push   %edi
+     434:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     437:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     43a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     43d:	89 d7                	mov    %edx,%edi
+     43f:	fc                   	cld
+     440:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     442:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     445:	89 d0                	mov    %edx,%eax
+     447:	c9                   	leave
+     448:	c3                   	ret
+     449:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000450 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     450:	55                   	push   %ebp
+     451:	89 e5                	mov    %esp,%ebp
+     453:	56                   	push   %esi
+     454:	53                   	push   %ebx
+     455:	8b 75 10             	mov    0x10(%ebp),%esi
+     458:	8b 55 08             	mov    0x8(%ebp),%edx
+     45b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+     45e:	85 f6                	test   %esi,%esi
+     460:	74 2e                	je     490 <memcmp+0x40>
+     462:	01 c6                	add    %eax,%esi
+     464:	eb 14                	jmp    47a <memcmp+0x2a>
+     466:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     46d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+     470:	83 c0 01             	add    $0x1,%eax
+     473:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+     476:	39 f0                	cmp    %esi,%eax
+     478:	74 16                	je     490 <memcmp+0x40>
+    if(*s1 != *s2)
+     47a:	0f b6 0a             	movzbl (%edx),%ecx
+     47d:	0f b6 18             	movzbl (%eax),%ebx
+     480:	38 d9                	cmp    %bl,%cl
+     482:	74 ec                	je     470 <memcmp+0x20>
+      return *s1 - *s2;
+     484:	0f b6 c1             	movzbl %cl,%eax
+     487:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+     489:	5b                   	pop    %ebx
+     48a:	5e                   	pop    %esi
+     48b:	5d                   	pop    %ebp
+     48c:	c3                   	ret
+     48d:	8d 76 00             	lea    0x0(%esi),%esi
+     490:	5b                   	pop    %ebx
+  return 0;
+     491:	31 c0                	xor    %eax,%eax
+}
+     493:	5e                   	pop    %esi
+     494:	5d                   	pop    %ebp
+     495:	c3                   	ret
+     496:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     49d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000004a0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     4a0:	55                   	push   %ebp
+     4a1:	89 e5                	mov    %esp,%ebp
+     4a3:	8b 45 08             	mov    0x8(%ebp),%eax
+     4a6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     4aa:	0f b6 10             	movzbl (%eax),%edx
+     4ad:	84 d2                	test   %dl,%dl
+     4af:	75 12                	jne    4c3 <strchr+0x23>
+     4b1:	eb 1d                	jmp    4d0 <strchr+0x30>
+     4b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     4b7:	90                   	nop
+     4b8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     4bc:	83 c0 01             	add    $0x1,%eax
+     4bf:	84 d2                	test   %dl,%dl
+     4c1:	74 0d                	je     4d0 <strchr+0x30>
+    if(*s == c)
+     4c3:	38 d1                	cmp    %dl,%cl
+     4c5:	75 f1                	jne    4b8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     4c7:	5d                   	pop    %ebp
+     4c8:	c3                   	ret
+     4c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     4d0:	31 c0                	xor    %eax,%eax
+}
+     4d2:	5d                   	pop    %ebp
+     4d3:	c3                   	ret
+     4d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     4df:	90                   	nop
+
+000004e0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     4e0:	55                   	push   %ebp
+     4e1:	89 e5                	mov    %esp,%ebp
+     4e3:	57                   	push   %edi
+     4e4:	56                   	push   %esi
+int
+read(int fd, void *buf, int n)
+{
+  if(flushhook)
+    flushhook();
+  return _read(fd, buf, n);
+     4e5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     4e8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     4e9:	31 db                	xor    %ebx,%ebx
+{
+     4eb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     4ee:	eb 32                	jmp    522 <gets+0x42>
+  if(flushhook)
+     4f0:	a1 20 32 00 00       	mov    0x3220,%eax
+     4f5:	85 c0                	test   %eax,%eax
+     4f7:	74 02                	je     4fb <gets+0x1b>
+    flushhook();
+     4f9:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+     4fb:	83 ec 04             	sub    $0x4,%esp
+     4fe:	6a 01                	push   $0x1
+     500:	56                   	push   %esi
+     501:	6a 00                	push   $0x0
+     503:	e8 60 03 00 00       	call   868 <_read>
+    if(cc < 1)
+     508:	83 c4 10             	add    $0x10,%esp
+     50b:	85 c0                	test   %eax,%eax
+     50d:	7e 1d                	jle    52c <gets+0x4c>
+    buf[i++] = c;
+     50f:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     513:	8b 55 08             	mov    0x8(%ebp),%edx
+     516:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     51a:	3c 0a                	cmp    $0xa,%al
+     51c:	74 10                	je     52e <gets+0x4e>
+     51e:	3c 0d                	cmp    $0xd,%al
+     520:	74 0c                	je     52e <gets+0x4e>
+  for(i=0; i+1 < max; ){
+     522:	89 df                	mov    %ebx,%edi
+     524:	83 c3 01             	add    $0x1,%ebx
+     527:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     52a:	7c c4                	jl     4f0 <gets+0x10>
+     52c:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+     52e:	8b 45 08             	mov    0x8(%ebp),%eax
+     531:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+     535:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     538:	5b                   	pop    %ebx
+     539:	5e                   	pop    %esi
+     53a:	5f                   	pop    %edi
+     53b:	5d                   	pop    %ebp
+     53c:	c3                   	ret
+     53d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000540 <stat>:
+{
+     540:	55                   	push   %ebp
+     541:	89 e5                	mov    %esp,%ebp
+     543:	56                   	push   %esi
+     544:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+     545:	83 ec 08             	sub    $0x8,%esp
+     548:	6a 00                	push   $0x0
+     54a:	ff 75 08             	push   0x8(%ebp)
+     54d:	e8 3e 03 00 00       	call   890 <open>
+  if(fd < 0)
+     552:	83 c4 10             	add    $0x10,%esp
+     555:	85 c0                	test   %eax,%eax
+     557:	78 37                	js     590 <stat+0x50>
+  r = fstat(fd, st);
+     559:	83 ec 08             	sub    $0x8,%esp
+     55c:	ff 75 0c             	push   0xc(%ebp)
+     55f:	89 c3                	mov    %eax,%ebx
+     561:	50                   	push   %eax
+     562:	e8 41 03 00 00       	call   8a8 <fstat>
+}
+
+int
+close(int fd)
+{
+  if(flushhook)
+     567:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+     56a:	89 c6                	mov    %eax,%esi
+  if(flushhook)
+     56c:	a1 20 32 00 00       	mov    0x3220,%eax
+     571:	85 c0                	test   %eax,%eax
+     573:	74 02                	je     577 <stat+0x37>
+    flushhook();
+     575:	ff d0                	call   *%eax
+  return _close(fd);
+     577:	83 ec 0c             	sub    $0xc,%esp
+     57a:	53                   	push   %ebx
+     57b:	e8 f8 02 00 00       	call   878 <_close>
+     580:	83 c4 10             	add    $0x10,%esp
+}
+     583:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     586:	89 f0                	mov    %esi,%eax
+     588:	5b                   	pop    %ebx
+     589:	5e                   	pop    %esi
+     58a:	5d                   	pop    %ebp
+     58b:	c3                   	ret
+     58c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+     590:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     595:	eb ec                	jmp    583 <stat+0x43>
+     597:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     59e:	66 90                	xchg   %ax,%ax
+
+000005a0 <atoi>:
+{
+     5a0:	55                   	push   %ebp
+     5a1:	89 e5                	mov    %esp,%ebp
+     5a3:	53                   	push   %ebx
+     5a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+     5a7:	0f be 02             	movsbl (%edx),%eax
+     5aa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     5ad:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     5b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     5b5:	77 1e                	ja     5d5 <atoi+0x35>
+     5b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5be:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     5c0:	83 c2 01             	add    $0x1,%edx
+     5c3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     5c6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     5ca:	0f be 02             	movsbl (%edx),%eax
+     5cd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     5d0:	80 fb 09             	cmp    $0x9,%bl
+     5d3:	76 eb                	jbe    5c0 <atoi+0x20>
+}
+     5d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     5d8:	89 c8                	mov    %ecx,%eax
+     5da:	c9                   	leave
+     5db:	c3                   	ret
+     5dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005e0 <memmove>:
+{
+     5e0:	55                   	push   %ebp
+     5e1:	89 e5                	mov    %esp,%ebp
+     5e3:	57                   	push   %edi
+     5e4:	56                   	push   %esi
+     5e5:	8b 45 10             	mov    0x10(%ebp),%eax
+     5e8:	8b 55 08             	mov    0x8(%ebp),%edx
+     5eb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+     5ee:	85 c0                	test   %eax,%eax
+     5f0:	7e 13                	jle    605 <memmove+0x25>
+     5f2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     5f4:	89 d7                	mov    %edx,%edi
+     5f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5fd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     600:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     601:	39 f8                	cmp    %edi,%eax
+     603:	75 fb                	jne    600 <memmove+0x20>
+}
+     605:	5e                   	pop    %esi
+     606:	89 d0                	mov    %edx,%eax
+     608:	5f                   	pop    %edi
+     609:	5d                   	pop    %ebp
+     60a:	c3                   	ret
+     60b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     60f:	90                   	nop
+
+00000610 <fork>:
+  if(flushhook)
+     610:	a1 20 32 00 00       	mov    0x3220,%eax
+     615:	85 c0                	test   %eax,%eax
+     617:	74 17                	je     630 <fork+0x20>
+{
+     619:	55                   	push   %ebp
+     61a:	89 e5                	mov    %esp,%ebp
+     61c:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+     61f:	ff d0                	call   *%eax
+}
+     621:	c9                   	leave
+  return _fork();
+     622:	e9 21 02 00 00       	jmp    848 <_fork>
+     627:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     62e:	66 90                	xchg   %ax,%ax
+     630:	e9 13 02 00 00       	jmp    848 <_fork>
+     635:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     63c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000640 <exit>:
+{
+     640:	55                   	push   %ebp
+     641:	89 e5                	mov    %esp,%ebp
+     643:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+     646:	a1 20 32 00 00       	mov    0x3220,%eax
+     64b:	85 c0                	test   %eax,%eax
+     64d:	74 02                	je     651 <exit+0x11>
+    flushhook();
+     64f:	ff d0                	call   *%eax
+  _exit();
+     651:	e8 fa 01 00 00       	call   850 <_exit>
+     656:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     65d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000660 <exec>:
+{
+     660:	55                   	push   %ebp
+  if(flushhook)
+     661:	a1 20 32 00 00       	mov    0x3220,%eax
+{
+     666:	89 e5                	mov    %esp,%ebp
+     668:	56                   	push   %esi
+     669:	53                   	push   %ebx
+     66a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     66d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+     670:	85 c0                	test   %eax,%eax
+     672:	74 02                	je     676 <exec+0x16>
+    flushhook();
+     674:	ff d0                	call   *%eax
+  return _exec(path, argv);
+     676:	89 75 0c             	mov    %esi,0xc(%ebp)
+     679:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     67c:	5b                   	pop    %ebx
+     67d:	5e                   	pop    %esi
+     67e:	5d                   	pop    %ebp
+  return _exec(path, argv);
+     67f:	e9 04 02 00 00       	jmp    888 <_exec>
+     684:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     68b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     68f:	90                   	nop
+
+00000690 <read>:
+{
+     690:	55                   	push   %ebp
+     691:	89 e5                	mov    %esp,%ebp
+     693:	57                   	push   %edi
+     694:	56                   	push   %esi
+     695:	53                   	push   %ebx
+     696:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     699:	a1 20 32 00 00       	mov    0x3220,%eax
+{
+     69e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     6a1:	8b 75 0c             	mov    0xc(%ebp),%esi
+     6a4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     6a7:	85 c0                	test   %eax,%eax
+     6a9:	74 02                	je     6ad <read+0x1d>
+    flushhook();
+     6ab:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+     6ad:	89 7d 10             	mov    %edi,0x10(%ebp)
+     6b0:	89 75 0c             	mov    %esi,0xc(%ebp)
+     6b3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     6b6:	83 c4 0c             	add    $0xc,%esp
+     6b9:	5b                   	pop    %ebx
+     6ba:	5e                   	pop    %esi
+     6bb:	5f                   	pop    %edi
+     6bc:	5d                   	pop    %ebp
+  return _read(fd, buf, n);
+     6bd:	e9 a6 01 00 00       	jmp    868 <_read>
+     6c2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000006d0 <readv>:
+{
+     6d0:	55                   	push   %ebp
+     6d1:	89 e5                	mov    %esp,%ebp
+     6d3:	57                   	push   %edi
+     6d4:	56                   	push   %esi
+     6d5:	53                   	push   %ebx
+     6d6:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     6d9:	a1 20 32 00 00       	mov    0x3220,%eax
+{
+     6de:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     6e1:	8b 75 0c             	mov    0xc(%ebp),%esi
+     6e4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     6e7:	85 c0                	test   %eax,%eax
+     6e9:	74 02                	je     6ed <readv+0x1d>
+    flushhook();
+     6eb:	ff d0                	call   *%eax
+  return _readv(fd, iov, cnt);
+     6ed:	89 7d 10             	mov    %edi,0x10(%ebp)
+     6f0:	89 75 0c             	mov    %esi,0xc(%ebp)
+     6f3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     6f6:	83 c4 0c             	add    $0xc,%esp
+     6f9:	5b                   	pop    %ebx
+     6fa:	5e                   	pop    %esi
+     6fb:	5f                   	pop    %edi
+     6fc:	5d                   	pop    %ebp
+  return _readv(fd, iov, cnt);
+     6fd:	e9 76 02 00 00       	jmp    978 <_readv>
+     702:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     709:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000710 <write>:
+{
+     710:	55                   	push   %ebp
+     711:	89 e5                	mov    %esp,%ebp
+     713:	57                   	push   %edi
+     714:	56                   	push   %esi
+     715:	53                   	push   %ebx
+     716:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     719:	a1 20 32 00 00       	mov    0x3220,%eax
+{
+     71e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     721:	8b 75 0c             	mov    0xc(%ebp),%esi
+     724:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     727:	85 c0                	test   %eax,%eax
+     729:	74 02                	je     72d <write+0x1d>
+    flushhook();
+     72b:	ff d0                	call   *%eax
+  return _write(fd, buf, n);
+     72d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     730:	89 75 0c             	mov    %esi,0xc(%ebp)
+     733:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     736:	83 c4 0c             	add    $0xc,%esp
+     739:	5b                   	pop    %ebx
+     73a:	5e                   	pop    %esi
+     73b:	5f                   	pop    %edi
+     73c:	5d                   	pop    %ebp
+  return _write(fd, buf, n);
+     73d:	e9 2e 01 00 00       	jmp    870 <_write>
+     742:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     749:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000750 <writev>:
+{
+     750:	55                   	push   %ebp
+     751:	89 e5                	mov    %esp,%ebp
+     753:	57                   	push   %edi
+     754:	56                   	push   %esi
+     755:	53                   	push   %ebx
+     756:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     759:	a1 20 32 00 00       	mov    0x3220,%eax
+{
+     75e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     761:	8b 75 0c             	mov    0xc(%ebp),%esi
+     764:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     767:	85 c0                	test   %eax,%eax
+     769:	74 02                	je     76d <writev+0x1d>
+    flushhook();
+     76b:	ff d0                	call   *%eax
+  return _writev(fd, iov, cnt);
+     76d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     770:	89 75 0c             	mov    %esi,0xc(%ebp)
+     773:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     776:	83 c4 0c             	add    $0xc,%esp
+     779:	5b                   	pop    %ebx
+     77a:	5e                   	pop    %esi
+     77b:	5f                   	pop    %edi
+     77c:	5d                   	pop    %ebp
+  return _writev(fd, iov, cnt);
+     77d:	e9 fe 01 00 00       	jmp    980 <_writev>
+     782:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     789:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000790 <close>:
+{
+     790:	55                   	push   %ebp
+     791:	89 e5                	mov    %esp,%ebp
+     793:	53                   	push   %ebx
+     794:	83 ec 04             	sub    $0x4,%esp
+  if(flushhook)
+     797:	a1 20 32 00 00       	mov    0x3220,%eax
+{
+     79c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(flushhook)
+     79f:	85 c0                	test   %eax,%eax
+     7a1:	74 02                	je     7a5 <close+0x15>
+    flushhook();
+     7a3:	ff d0                	call   *%eax
+  return _close(fd);
+     7a5:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     7a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     7ab:	c9                   	leave
+  return _close(fd);
+     7ac:	e9 c7 00 00 00       	jmp    878 <_close>
+     7b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7bf:	90                   	nop
+
+000007c0 <umtxinit>:
+// process that finds the mutex held enters the kernel, to sleep
+// in futexwait() until the holder's umtxunlock() wakes it.
+
+void
+umtxinit(struct umutex *m)
+{
+     7c0:	55                   	push   %ebp
+     7c1:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+     7c3:	8b 45 08             	mov    0x8(%ebp),%eax
+     7c6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     7cc:	5d                   	pop    %ebp
+     7cd:	c3                   	ret
+     7ce:	66 90                	xchg   %ax,%ax
+
+000007d0 <umtxlock>:
+
+void
+umtxlock(struct umutex *m)
+{
+     7d0:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+     7d1:	b8 01 00 00 00       	mov    $0x1,%eax
+     7d6:	89 e5                	mov    %esp,%ebp
+     7d8:	56                   	push   %esi
+     7d9:	53                   	push   %ebx
+     7da:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     7dd:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 1) == 0)
+     7e0:	85 c0                	test   %eax,%eax
+     7e2:	74 2b                	je     80f <umtxlock+0x3f>
+     7e4:	b8 02 00 00 00       	mov    $0x2,%eax
+     7e9:	f0 87 03             	lock xchg %eax,(%ebx)
+    return;
+  // Mark the mutex contended, so that its holder
+  // wakes a waiter on release, and wait.
+  while(xchg(&m->state, 2) != 0)
+     7ec:	85 c0                	test   %eax,%eax
+     7ee:	74 1f                	je     80f <umtxlock+0x3f>
+     7f0:	be 02 00 00 00       	mov    $0x2,%esi
+     7f5:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwait(&m->state, 2);
+     7f8:	83 ec 08             	sub    $0x8,%esp
+     7fb:	6a 02                	push   $0x2
+     7fd:	53                   	push   %ebx
+     7fe:	e8 85 01 00 00       	call   988 <futexwait>
+     803:	89 f0                	mov    %esi,%eax
+     805:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+     808:	83 c4 10             	add    $0x10,%esp
+     80b:	85 c0                	test   %eax,%eax
+     80d:	75 e9                	jne    7f8 <umtxlock+0x28>
+}
+     80f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     812:	5b                   	pop    %ebx
+     813:	5e                   	pop    %esi
+     814:	5d                   	pop    %ebp
+     815:	c3                   	ret
+     816:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     81d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000820 <umtxunlock>:
+
+void
+umtxunlock(struct umutex *m)
+{
+     820:	55                   	push   %ebp
+     821:	31 c0                	xor    %eax,%eax
+     823:	89 e5                	mov    %esp,%ebp
+     825:	83 ec 08             	sub    $0x8,%esp
+     828:	8b 55 08             	mov    0x8(%ebp),%edx
+     82b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+     82e:	83 f8 02             	cmp    $0x2,%eax
+     831:	74 05                	je     838 <umtxunlock+0x18>
+    futexwake(&m->state, 1);
+}
+     833:	c9                   	leave
+     834:	c3                   	ret
+     835:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwake(&m->state, 1);
+     838:	83 ec 08             	sub    $0x8,%esp
+     83b:	6a 01                	push   $0x1
+     83d:	52                   	push   %edx
+     83e:	e8 4d 01 00 00       	call   990 <futexwake>
+     843:	83 c4 10             	add    $0x10,%esp
+}
+     846:	c9                   	leave
+     847:	c3                   	ret
+
+00000848 <_fork>:
+  _ ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+     848:	b8 01 00 00 00       	mov    $0x1,%eax
+     84d:	cd 40                	int    $0x40
+     84f:	c3                   	ret
+
+00000850 <_exit>:
+RAWSYSCALL(exit)
+     850:	b8 02 00 00 00       	mov    $0x2,%eax
+     855:	cd 40                	int    $0x40
+     857:	c3                   	ret
+
+00000858 <wait>:
+SYSCALL(wait)
+     858:	b8 03 00 00 00       	mov    $0x3,%eax
+     85d:	cd 40                	int    $0x40
+     85f:	c3                   	ret
+
+00000860 <pipe>:
+SYSCALL(pipe)
+     860:	b8 04 00 00 00       	mov    $0x4,%eax
+     865:	cd 40                	int    $0x40
+     867:	c3                   	ret
+
+00000868 <_read>:
+RAWSYSCALL(read)
+     868:	b8 05 00 00 00       	mov    $0x5,%eax
+     86d:	cd 40                	int    $0x40
+     86f:	c3                   	ret
+
+00000870 <_write>:
+RAWSYSCALL(write)
+     870:	b8 10 00 00 00       	mov    $0x10,%eax
+     875:	cd 40                	int    $0x40
+     877:	c3                   	ret
+
+00000878 <_close>:
+RAWSYSCALL(close)
+     878:	b8 15 00 00 00       	mov    $0x15,%eax
+     87d:	cd 40                	int    $0x40
+     87f:	c3                   	ret
+
+00000880 <kill>:
+SYSCALL(kill)
+     880:	b8 06 00 00 00       	mov    $0x6,%eax
+     885:	cd 40                	int    $0x40
+     887:	c3                   	ret
+
+00000888 <_exec>:
+RAWSYSCALL(exec)
+     888:	b8 07 00 00 00       	mov    $0x7,%eax
+     88d:	cd 40                	int    $0x40
+     88f:	c3                   	ret
+
+00000890 <open>:
+SYSCALL(open)
+     890:	b8 0f 00 00 00       	mov    $0xf,%eax
+     895:	cd 40                	int    $0x40
+     897:	c3                   	ret
+
+00000898 <mknod>:
+SYSCALL(mknod)
+     898:	b8 11 00 00 00       	mov    $0x11,%eax
+     89d:	cd 40                	int    $0x40
+     89f:	c3                   	ret
+
+000008a0 <unlink>:
+SYSCALL(unlink)
+     8a0:	b8 12 00 00 00       	mov    $0x12,%eax
+     8a5:	cd 40                	int    $0x40
+     8a7:	c3                   	ret
+
+000008a8 <fstat>:
+SYSCALL(fstat)
+     8a8:	b8 08 00 00 00       	mov    $0x8,%eax
+     8ad:	cd 40                	int    $0x40
+     8af:	c3                   	ret
+
+000008b0 <link>:
+SYSCALL(link)
+     8b0:	b8 13 00 00 00       	mov    $0x13,%eax
+     8b5:	cd 40                	int    $0x40
+     8b7:	c3                   	ret
+
+000008b8 <mkdir>:
+SYSCALL(mkdir)
+     8b8:	b8 14 00 00 00       	mov    $0x14,%eax
+     8bd:	cd 40                	int    $0x40
+     8bf:	c3                   	ret
+
+000008c0 <chdir>:
+SYSCALL(chdir)
+     8c0:	b8 09 00 00 00       	mov    $0x9,%eax
+     8c5:	cd 40                	int    $0x40
+     8c7:	c3                   	ret
+
+000008c8 <dup>:
+SYSCALL(dup)
+     8c8:	b8 0a 00 00 00       	mov    $0xa,%eax
+     8cd:	cd 40                	int    $0x40
+     8cf:	c3                   	ret
+
+000008d0 <getpid>:
+SYSCALL(getpid)
+     8d0:	b8 0b 00 00 00       	mov    $0xb,%eax
+     8d5:	cd 40                	int    $0x40
+     8d7:	c3                   	ret
+
+000008d8 <sbrk>:
+SYSCALL(sbrk)
+     8d8:	b8 0c 00 00 00       	mov    $0xc,%eax
+     8dd:	cd 40                	int    $0x40
+     8df:	c3                   	ret
+
+000008e0 <sleep>:
+SYSCALL(sleep)
+     8e0:	b8 0d 00 00 00       	mov    $0xd,%eax
+     8e5:	cd 40                	int    $0x40
+     8e7:	c3                   	ret
+
+000008e8 <uptime>:
+SYSCALL(uptime)
+     8e8:	b8 0e 00 00 00       	mov    $0xe,%eax
+     8ed:	cd 40                	int    $0x40
+     8ef:	c3                   	ret
+
+000008f0 <wolfie>:
+SYSCALL(wolfie)
+     8f0:	b8 16 00 00 00       	mov    $0x16,%eax
+     8f5:	cd 40                	int    $0x40
+     8f7:	c3                   	ret
+
+000008f8 <nice>:
+SYSCALL(nice)
+     8f8:	b8 17 00 00 00       	mov    $0x17,%eax
+     8fd:	cd 40                	int    $0x40
+     8ff:	c3                   	ret
+
+00000900 <mtxget>:
+SYSCALL(mtxget)
+     900:	b8 18 00 00 00       	mov    $0x18,%eax
+     905:	cd 40                	int    $0x40
+     907:	c3                   	ret
+
+00000908 <mtxrel>:
+SYSCALL(mtxrel)
+     908:	b8 19 00 00 00       	mov    $0x19,%eax
+     90d:	cd 40                	int    $0x40
+     90f:	c3                   	ret
+
+00000910 <mtxacq>:
+SYSCALL(mtxacq)
+     910:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     915:	cd 40                	int    $0x40
+     917:	c3                   	ret
+
+00000918 <mtxdel>:
+SYSCALL(mtxdel)
+     918:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     91d:	cd 40                	int    $0x40
+     91f:	c3                   	ret
+
+00000920 <iostat>:
+SYSCALL(iostat)
+     920:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     925:	cd 40                	int    $0x40
+     927:	c3                   	ret
+
+00000928 <mmap>:
+SYSCALL(mmap)
+     928:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     92d:	cd 40                	int    $0x40
+     92f:	c3                   	ret
+
+00000930 <munmap>:
+SYSCALL(munmap)
+     930:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     935:	cd 40                	int    $0x40
+     937:	c3                   	ret
+
+00000938 <shmget>:
+SYSCALL(shmget)
+     938:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     93d:	cd 40                	int    $0x40
+     93f:	c3                   	ret
+
+00000940 <shmat>:
+SYSCALL(shmat)
+     940:	b8 20 00 00 00       	mov    $0x20,%eax
+     945:	cd 40                	int    $0x40
+     947:	c3                   	ret
+
+00000948 <shmdt>:
+SYSCALL(shmdt)
+     948:	b8 21 00 00 00       	mov    $0x21,%eax
+     94d:	cd 40                	int    $0x40
+     94f:	c3                   	ret
+
+00000950 <shmdel>:
+SYSCALL(shmdel)
+     950:	b8 22 00 00 00       	mov    $0x22,%eax
+     955:	cd 40                	int    $0x40
+     957:	c3                   	ret
+
+00000958 <syscount>:
+SYSCALL(syscount)
+     958:	b8 23 00 00 00       	mov    $0x23,%eax
+     95d:	cd 40                	int    $0x40
+     95f:	c3                   	ret
+
+00000960 <splice>:
+SYSCALL(splice)
+     960:	b8 24 00 00 00       	mov    $0x24,%eax
+     965:	cd 40                	int    $0x40
+     967:	c3                   	ret
+
+00000968 <tee>:
+SYSCALL(tee)
+     968:	b8 25 00 00 00       	mov    $0x25,%eax
+     96d:	cd 40                	int    $0x40
+     96f:	c3                   	ret
+
+00000970 <sendfile>:
+SYSCALL(sendfile)
+     970:	b8 26 00 00 00       	mov    $0x26,%eax
+     975:	cd 40                	int    $0x40
+     977:	c3                   	ret
+
+00000978 <_readv>:
+RAWSYSCALL(readv)
+     978:	b8 27 00 00 00       	mov    $0x27,%eax
+     97d:	cd 40                	int    $0x40
+     97f:	c3                   	ret
+
+00000980 <_writev>:
+RAWSYSCALL(writev)
+     980:	b8 28 00 00 00       	mov    $0x28,%eax
+     985:	cd 40                	int    $0x40
+     987:	c3                   	ret
+
+00000988 <futexwait>:
+SYSCALL(futexwait)
+     988:	b8 29 00 00 00       	mov    $0x29,%eax
+     98d:	cd 40                	int    $0x40
+     98f:	c3                   	ret
+
+00000990 <futexwake>:
+SYSCALL(futexwake)
+     990:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     995:	cd 40                	int    $0x40
+     997:	c3                   	ret
+
+00000998 <lockstat>:
+SYSCALL(lockstat)
+     998:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     99d:	cd 40                	int    $0x40
+     99f:	c3                   	ret
+
+000009a0 <clone>:
+SYSCALL(clone)
+     9a0:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     9a5:	cd 40                	int    $0x40
+     9a7:	c3                   	ret
+
+000009a8 <join>:
+SYSCALL(join)
+     9a8:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     9ad:	cd 40                	int    $0x40
+     9af:	c3                   	ret
+
+000009b0 <stacklimit>:
+SYSCALL(stacklimit)
+     9b0:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     9b5:	cd 40                	int    $0x40
+     9b7:	c3                   	ret
+     9b8:	66 90                	xchg   %ax,%ax
+     9ba:	66 90                	xchg   %ax,%ax
+     9bc:	66 90                	xchg   %ax,%ax
+     9be:	66 90                	xchg   %ax,%ax
+
+000009c0 <flushall>:
+  b->n = 0;
+}
+
+static void
+flushall(void)
+{
+     9c0:	55                   	push   %ebp
+     9c1:	89 e5                	mov    %esp,%ebp
+     9c3:	83 ec 14             	sub    $0x14,%esp
+  umtxlock(&stdoutlock);
+     9c6:	68 24 32 00 00       	push   $0x3224
+     9cb:	e8 00 fe ff ff       	call   7d0 <umtxlock>
+  if(b->n > 0)
+     9d0:	a1 08 20 00 00       	mov    0x2008,%eax
+     9d5:	83 c4 10             	add    $0x10,%esp
+     9d8:	85 c0                	test   %eax,%eax
+     9da:	7e 17                	jle    9f3 <flushall+0x33>
+    _write(b->fd, b->buf, b->n);
+     9dc:	83 ec 04             	sub    $0x4,%esp
+     9df:	50                   	push   %eax
+     9e0:	68 0c 20 00 00       	push   $0x200c
+     9e5:	ff 35 00 20 00 00    	push   0x2000
+     9eb:	e8 80 fe ff ff       	call   870 <_write>
+     9f0:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     9f3:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     9fa:	00 00 00 
+  flush(&stdout);
+  umtxunlock(&stdoutlock);
+     9fd:	83 ec 0c             	sub    $0xc,%esp
+     a00:	68 24 32 00 00       	push   $0x3224
+     a05:	e8 16 fe ff ff       	call   820 <umtxunlock>
+}
+     a0a:	83 c4 10             	add    $0x10,%esp
+     a0d:	c9                   	leave
+     a0e:	c3                   	ret
+     a0f:	90                   	nop
+
+00000a10 <printint>:
+    flush(b);
+}
+
+static void
+printint(struct outbuf *b, int xx, int base, int sgn)
+{
+     a10:	55                   	push   %ebp
+     a11:	89 e5                	mov    %esp,%ebp
+     a13:	57                   	push   %edi
+     a14:	89 cf                	mov    %ecx,%edi
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     a16:	89 d1                	mov    %edx,%ecx
+{
+     a18:	56                   	push   %esi
+     a19:	53                   	push   %ebx
+     a1a:	89 c3                	mov    %eax,%ebx
+     a1c:	83 ec 2c             	sub    $0x2c,%esp
+  if(sgn && xx < 0){
+     a1f:	85 d2                	test   %edx,%edx
+     a21:	0f 89 b9 00 00 00    	jns    ae0 <printint+0xd0>
+     a27:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     a2b:	0f 84 af 00 00 00    	je     ae0 <printint+0xd0>
+    x = -xx;
+     a31:	f7 d9                	neg    %ecx
+    neg = 1;
+     a33:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     a38:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     a3b:	31 f6                	xor    %esi,%esi
+     a3d:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     a40:	89 c8                	mov    %ecx,%eax
+     a42:	31 d2                	xor    %edx,%edx
+     a44:	89 f3                	mov    %esi,%ebx
+     a46:	f7 f7                	div    %edi
+     a48:	8d 76 01             	lea    0x1(%esi),%esi
+     a4b:	0f b6 92 c8 17 00 00 	movzbl 0x17c8(%edx),%edx
+     a52:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     a56:	89 ca                	mov    %ecx,%edx
+     a58:	89 c1                	mov    %eax,%ecx
+     a5a:	39 fa                	cmp    %edi,%edx
+     a5c:	73 e2                	jae    a40 <printint+0x30>
+  if(neg)
+     a5e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     a61:	89 d9                	mov    %ebx,%ecx
+     a63:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     a66:	85 c0                	test   %eax,%eax
+     a68:	74 07                	je     a71 <printint+0x61>
+    buf[i++] = '-';
+     a6a:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     a6f:	89 f1                	mov    %esi,%ecx
+     a71:	8d 75 d8             	lea    -0x28(%ebp),%esi
+     a74:	89 cf                	mov    %ecx,%edi
+     a76:	01 f7                	add    %esi,%edi
+     a78:	eb 1a                	jmp    a94 <printint+0x84>
+     a7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    *b->str++ = c;
+     a80:	8d 48 01             	lea    0x1(%eax),%ecx
+     a83:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+     a89:	88 10                	mov    %dl,(%eax)
+
+  while(--i >= 0)
+     a8b:	8d 47 ff             	lea    -0x1(%edi),%eax
+     a8e:	39 fe                	cmp    %edi,%esi
+     a90:	74 40                	je     ad2 <printint+0xc2>
+     a92:	89 c7                	mov    %eax,%edi
+  if(b->str){
+     a94:	8b 83 0c 02 00 00    	mov    0x20c(%ebx),%eax
+    putc(b, buf[i]);
+     a9a:	0f b6 17             	movzbl (%edi),%edx
+  if(b->str){
+     a9d:	85 c0                	test   %eax,%eax
+     a9f:	75 df                	jne    a80 <printint+0x70>
+  b->buf[b->n++] = c;
+     aa1:	8b 4b 08             	mov    0x8(%ebx),%ecx
+     aa4:	8d 41 01             	lea    0x1(%ecx),%eax
+     aa7:	89 43 08             	mov    %eax,0x8(%ebx)
+     aaa:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+     aae:	3d 00 02 00 00       	cmp    $0x200,%eax
+     ab3:	74 3b                	je     af0 <printint+0xe0>
+     ab5:	80 fa 0a             	cmp    $0xa,%dl
+     ab8:	75 d1                	jne    a8b <printint+0x7b>
+     aba:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+     abe:	75 cb                	jne    a8b <printint+0x7b>
+  if(b->n > 0)
+     ac0:	85 c0                	test   %eax,%eax
+     ac2:	7f 2c                	jg     af0 <printint+0xe0>
+  b->n = 0;
+     ac4:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  while(--i >= 0)
+     acb:	8d 47 ff             	lea    -0x1(%edi),%eax
+     ace:	39 fe                	cmp    %edi,%esi
+     ad0:	75 c0                	jne    a92 <printint+0x82>
+}
+     ad2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ad5:	5b                   	pop    %ebx
+     ad6:	5e                   	pop    %esi
+     ad7:	5f                   	pop    %edi
+     ad8:	5d                   	pop    %ebp
+     ad9:	c3                   	ret
+     ada:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  neg = 0;
+     ae0:	31 c0                	xor    %eax,%eax
+     ae2:	e9 51 ff ff ff       	jmp    a38 <printint+0x28>
+     ae7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     aee:	66 90                	xchg   %ax,%ax
+    _write(b->fd, b->buf, b->n);
+     af0:	83 ec 04             	sub    $0x4,%esp
+     af3:	50                   	push   %eax
+     af4:	8d 43 0c             	lea    0xc(%ebx),%eax
+     af7:	50                   	push   %eax
+     af8:	ff 33                	push   (%ebx)
+     afa:	e8 71 fd ff ff       	call   870 <_write>
+     aff:	83 c4 10             	add    $0x10,%esp
+     b02:	eb c0                	jmp    ac4 <printint+0xb4>
+     b04:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b0f:	90                   	nop
+
+00000b10 <putc>:
+{
+     b10:	55                   	push   %ebp
+     b11:	89 e5                	mov    %esp,%ebp
+     b13:	53                   	push   %ebx
+     b14:	89 c3                	mov    %eax,%ebx
+     b16:	83 ec 04             	sub    $0x4,%esp
+  if(b->str){
+     b19:	8b 80 0c 02 00 00    	mov    0x20c(%eax),%eax
+     b1f:	85 c0                	test   %eax,%eax
+     b21:	74 15                	je     b38 <putc+0x28>
+    *b->str++ = c;
+     b23:	8d 48 01             	lea    0x1(%eax),%ecx
+     b26:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+     b2c:	88 10                	mov    %dl,(%eax)
+}
+     b2e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     b31:	c9                   	leave
+     b32:	c3                   	ret
+     b33:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b37:	90                   	nop
+  b->buf[b->n++] = c;
+     b38:	8b 4b 08             	mov    0x8(%ebx),%ecx
+     b3b:	8d 41 01             	lea    0x1(%ecx),%eax
+     b3e:	89 43 08             	mov    %eax,0x8(%ebx)
+     b41:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+     b45:	3d 00 02 00 00       	cmp    $0x200,%eax
+     b4a:	74 14                	je     b60 <putc+0x50>
+     b4c:	80 fa 0a             	cmp    $0xa,%dl
+     b4f:	75 dd                	jne    b2e <putc+0x1e>
+     b51:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+     b55:	75 d7                	jne    b2e <putc+0x1e>
+  if(b->n > 0)
+     b57:	85 c0                	test   %eax,%eax
+     b59:	7e 17                	jle    b72 <putc+0x62>
+     b5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b5f:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     b60:	83 ec 04             	sub    $0x4,%esp
+     b63:	50                   	push   %eax
+     b64:	8d 43 0c             	lea    0xc(%ebx),%eax
+     b67:	50                   	push   %eax
+     b68:	ff 33                	push   (%ebx)
+     b6a:	e8 01 fd ff ff       	call   870 <_write>
+     b6f:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     b72:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+     b79:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     b7c:	c9                   	leave
+     b7d:	c3                   	ret
+     b7e:	66 90                	xchg   %ax,%ax
+
+00000b80 <format>:
+
+// Format fmt and the arguments at ap into b.
+// Only understands %d, %x, %p, %s, %c.
+static void
+format(struct outbuf *b, const char *fmt, uint *ap)
+{
+     b80:	55                   	push   %ebp
+     b81:	89 e5                	mov    %esp,%ebp
+     b83:	57                   	push   %edi
+     b84:	89 c7                	mov    %eax,%edi
+     b86:	56                   	push   %esi
+     b87:	53                   	push   %ebx
+     b88:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+     b8b:	0f b6 02             	movzbl (%edx),%eax
+{
+     b8e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  for(i = 0; fmt[i]; i++){
+     b91:	84 c0                	test   %al,%al
+     b93:	74 5a                	je     bef <format+0x6f>
+     b95:	8d 5a 01             	lea    0x1(%edx),%ebx
+     b98:	31 f6                	xor    %esi,%esi
+     b9a:	eb 1c                	jmp    bb8 <format+0x38>
+     b9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     ba0:	83 f8 25             	cmp    $0x25,%eax
+     ba3:	74 3b                	je     be0 <format+0x60>
+        state = '%';
+      } else {
+        putc(b, c);
+     ba5:	89 ca                	mov    %ecx,%edx
+     ba7:	89 f8                	mov    %edi,%eax
+     ba9:	e8 62 ff ff ff       	call   b10 <putc>
+  for(i = 0; fmt[i]; i++){
+     bae:	0f b6 03             	movzbl (%ebx),%eax
+     bb1:	83 c3 01             	add    $0x1,%ebx
+     bb4:	84 c0                	test   %al,%al
+     bb6:	74 37                	je     bef <format+0x6f>
+    c = fmt[i] & 0xff;
+     bb8:	0f be c8             	movsbl %al,%ecx
+     bbb:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     bbe:	85 f6                	test   %esi,%esi
+     bc0:	74 de                	je     ba0 <format+0x20>
+      }
+    } else if(state == '%'){
+     bc2:	83 fe 25             	cmp    $0x25,%esi
+     bc5:	75 e7                	jne    bae <format+0x2e>
+      if(c == 'd'){
+     bc7:	83 f8 25             	cmp    $0x25,%eax
+     bca:	74 46                	je     c12 <format+0x92>
+     bcc:	83 e8 63             	sub    $0x63,%eax
+     bcf:	83 f8 15             	cmp    $0x15,%eax
+     bd2:	77 2c                	ja     c00 <format+0x80>
+     bd4:	ff 24 85 70 17 00 00 	jmp    *0x1770(,%eax,4)
+     bdb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     bdf:	90                   	nop
+  for(i = 0; fmt[i]; i++){
+     be0:	0f b6 03             	movzbl (%ebx),%eax
+     be3:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+     be6:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+     beb:	84 c0                	test   %al,%al
+     bed:	75 c9                	jne    bb8 <format+0x38>
+        putc(b, c);
+      }
+      state = 0;
+    }
+  }
+}
+     bef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     bf2:	5b                   	pop    %ebx
+     bf3:	5e                   	pop    %esi
+     bf4:	5f                   	pop    %edi
+     bf5:	5d                   	pop    %ebp
+     bf6:	c3                   	ret
+     bf7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bfe:	66 90                	xchg   %ax,%ax
+        putc(b, '%');
+     c00:	ba 25 00 00 00       	mov    $0x25,%edx
+     c05:	89 f8                	mov    %edi,%eax
+     c07:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     c0a:	e8 01 ff ff ff       	call   b10 <putc>
+        putc(b, c);
+     c0f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     c12:	89 ca                	mov    %ecx,%edx
+     c14:	89 f8                	mov    %edi,%eax
+      state = 0;
+     c16:	31 f6                	xor    %esi,%esi
+        putc(b, c);
+     c18:	e8 f3 fe ff ff       	call   b10 <putc>
+     c1d:	eb 8f                	jmp    bae <format+0x2e>
+     c1f:	90                   	nop
+        printint(b, *ap, 16, 0);
+     c20:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     c23:	83 ec 0c             	sub    $0xc,%esp
+     c26:	b9 10 00 00 00       	mov    $0x10,%ecx
+     c2b:	8b 16                	mov    (%esi),%edx
+     c2d:	6a 00                	push   $0x0
+        ap++;
+     c2f:	83 c6 04             	add    $0x4,%esi
+        printint(b, *ap, 16, 0);
+     c32:	89 f8                	mov    %edi,%eax
+     c34:	e8 d7 fd ff ff       	call   a10 <printint>
+        ap++;
+     c39:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+     c3c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     c3f:	31 f6                	xor    %esi,%esi
+     c41:	e9 68 ff ff ff       	jmp    bae <format+0x2e>
+     c46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c4d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     c50:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     c53:	8b 30                	mov    (%eax),%esi
+        ap++;
+     c55:	83 c0 04             	add    $0x4,%eax
+     c58:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+     c5b:	85 f6                	test   %esi,%esi
+     c5d:	75 1b                	jne    c7a <format+0xfa>
+     c5f:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+     c64:	be 68 17 00 00       	mov    $0x1768,%esi
+     c69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+          putc(b, *s);
+     c70:	89 f8                	mov    %edi,%eax
+          s++;
+     c72:	83 c6 01             	add    $0x1,%esi
+          putc(b, *s);
+     c75:	e8 96 fe ff ff       	call   b10 <putc>
+        while(*s != 0){
+     c7a:	0f be 16             	movsbl (%esi),%edx
+     c7d:	84 d2                	test   %dl,%dl
+     c7f:	75 ef                	jne    c70 <format+0xf0>
+      state = 0;
+     c81:	31 f6                	xor    %esi,%esi
+     c83:	e9 26 ff ff ff       	jmp    bae <format+0x2e>
+     c88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c8f:	90                   	nop
+        printint(b, *ap, 10, 1);
+     c90:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     c93:	83 ec 0c             	sub    $0xc,%esp
+     c96:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     c9b:	8b 16                	mov    (%esi),%edx
+     c9d:	6a 01                	push   $0x1
+     c9f:	eb 8e                	jmp    c2f <format+0xaf>
+     ca1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(b, *ap);
+     ca8:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     cab:	89 f8                	mov    %edi,%eax
+     cad:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+     cb0:	83 c6 04             	add    $0x4,%esi
+        putc(b, *ap);
+     cb3:	e8 58 fe ff ff       	call   b10 <putc>
+        ap++;
+     cb8:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      state = 0;
+     cbb:	31 f6                	xor    %esi,%esi
+     cbd:	e9 ec fe ff ff       	jmp    bae <format+0x2e>
+     cc2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cc9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000cd0 <fflush>:
+{
+     cd0:	55                   	push   %ebp
+     cd1:	89 e5                	mov    %esp,%ebp
+     cd3:	83 ec 08             	sub    $0x8,%esp
+  if(fd == stdout.fd)
+     cd6:	8b 45 08             	mov    0x8(%ebp),%eax
+     cd9:	39 05 00 20 00 00    	cmp    %eax,0x2000
+     cdf:	74 07                	je     ce8 <fflush+0x18>
+}
+     ce1:	c9                   	leave
+     ce2:	c3                   	ret
+     ce3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     ce7:	90                   	nop
+  umtxlock(&stdoutlock);
+     ce8:	83 ec 0c             	sub    $0xc,%esp
+     ceb:	68 24 32 00 00       	push   $0x3224
+     cf0:	e8 db fa ff ff       	call   7d0 <umtxlock>
+  if(b->n > 0)
+     cf5:	a1 08 20 00 00       	mov    0x2008,%eax
+     cfa:	83 c4 10             	add    $0x10,%esp
+     cfd:	85 c0                	test   %eax,%eax
+     cff:	7f 1f                	jg     d20 <fflush+0x50>
+  b->n = 0;
+     d01:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     d08:	00 00 00 
+  umtxunlock(&stdoutlock);
+     d0b:	c7 45 08 24 32 00 00 	movl   $0x3224,0x8(%ebp)
+}
+     d12:	c9                   	leave
+  umtxunlock(&stdoutlock);
+     d13:	e9 08 fb ff ff       	jmp    820 <umtxunlock>
+     d18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d1f:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     d20:	83 ec 04             	sub    $0x4,%esp
+     d23:	50                   	push   %eax
+     d24:	68 0c 20 00 00       	push   $0x200c
+     d29:	ff 35 00 20 00 00    	push   0x2000
+     d2f:	e8 3c fb ff ff       	call   870 <_write>
+     d34:	83 c4 10             	add    $0x10,%esp
+     d37:	eb c8                	jmp    d01 <fflush+0x31>
+     d39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000d40 <setvbuf>:
+{
+     d40:	55                   	push   %ebp
+     d41:	89 e5                	mov    %esp,%ebp
+     d43:	53                   	push   %ebx
+     d44:	83 ec 04             	sub    $0x4,%esp
+     d47:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd != stdout.fd)
+     d4a:	8b 45 08             	mov    0x8(%ebp),%eax
+     d4d:	39 05 00 20 00 00    	cmp    %eax,0x2000
+     d53:	74 0b                	je     d60 <setvbuf+0x20>
+}
+     d55:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     d58:	c9                   	leave
+     d59:	c3                   	ret
+     d5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  umtxlock(&stdoutlock);
+     d60:	83 ec 0c             	sub    $0xc,%esp
+     d63:	68 24 32 00 00       	push   $0x3224
+     d68:	e8 63 fa ff ff       	call   7d0 <umtxlock>
+  if(b->n > 0)
+     d6d:	a1 08 20 00 00       	mov    0x2008,%eax
+     d72:	83 c4 10             	add    $0x10,%esp
+     d75:	85 c0                	test   %eax,%eax
+     d77:	7f 2f                	jg     da8 <setvbuf+0x68>
+  b->n = 0;
+     d79:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     d80:	00 00 00 
+  stdout.mode = mode;
+     d83:	89 1d 04 20 00 00    	mov    %ebx,0x2004
+  flushhook = flushall;
+     d89:	c7 05 20 32 00 00 c0 	movl   $0x9c0,0x3220
+     d90:	09 00 00 
+}
+     d93:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&stdoutlock);
+     d96:	c7 45 08 24 32 00 00 	movl   $0x3224,0x8(%ebp)
+}
+     d9d:	c9                   	leave
+  umtxunlock(&stdoutlock);
+     d9e:	e9 7d fa ff ff       	jmp    820 <umtxunlock>
+     da3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     da7:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     da8:	83 ec 04             	sub    $0x4,%esp
+     dab:	50                   	push   %eax
+     dac:	68 0c 20 00 00       	push   $0x200c
+     db1:	ff 35 00 20 00 00    	push   0x2000
+     db7:	e8 b4 fa ff ff       	call   870 <_write>
+     dbc:	83 c4 10             	add    $0x10,%esp
+     dbf:	eb b8                	jmp    d79 <setvbuf+0x39>
+     dc1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dcf:	90                   	nop
+
+00000dd0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s, %c.
+void
+printf(int fd, const char *fmt, ...)
+{
+     dd0:	55                   	push   %ebp
+     dd1:	89 e5                	mov    %esp,%ebp
+     dd3:	53                   	push   %ebx
+     dd4:	81 ec 14 02 00 00    	sub    $0x214,%esp
+     dda:	8b 45 08             	mov    0x8(%ebp),%eax
+    local.mode = _IONBF;
+    local.n = 0;
+    local.str = 0;
+    b = &local;
+  }
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     ddd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd == stdout.fd){
+     de0:	39 05 00 20 00 00    	cmp    %eax,0x2000
+     de6:	74 48                	je     e30 <printf+0x60>
+    local.fd = fd;
+     de8:	89 85 e8 fd ff ff    	mov    %eax,-0x218(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     dee:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     df1:	89 da                	mov    %ebx,%edx
+     df3:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+    local.mode = _IONBF;
+     df9:	c7 85 ec fd ff ff 03 	movl   $0x3,-0x214(%ebp)
+     e00:	00 00 00 
+    local.n = 0;
+     e03:	c7 85 f0 fd ff ff 00 	movl   $0x0,-0x210(%ebp)
+     e0a:	00 00 00 
+    local.str = 0;
+     e0d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     e14:	e8 67 fd ff ff       	call   b80 <format>
+  if(b->mode == _IONBF)
+     e19:	83 bd ec fd ff ff 03 	cmpl   $0x3,-0x214(%ebp)
+     e20:	0f 84 a2 00 00 00    	je     ec8 <printf+0xf8>
+    flush(b);
+  if(b == &stdout)
+    umtxunlock(&stdoutlock);
+}
+     e26:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     e29:	c9                   	leave
+     e2a:	c3                   	ret
+     e2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e2f:	90                   	nop
+    umtxlock(&stdoutlock);
+     e30:	83 ec 0c             	sub    $0xc,%esp
+     e33:	68 24 32 00 00       	push   $0x3224
+     e38:	e8 93 f9 ff ff       	call   7d0 <umtxlock>
+  if(stdout.mode == 0){
+     e3d:	a1 04 20 00 00       	mov    0x2004,%eax
+     e42:	83 c4 10             	add    $0x10,%esp
+     e45:	85 c0                	test   %eax,%eax
+     e47:	74 37                	je     e80 <printf+0xb0>
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     e49:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     e4c:	89 da                	mov    %ebx,%edx
+     e4e:	b8 00 20 00 00       	mov    $0x2000,%eax
+     e53:	e8 28 fd ff ff       	call   b80 <format>
+  if(b->mode == _IONBF)
+     e58:	83 3d 04 20 00 00 03 	cmpl   $0x3,0x2004
+     e5f:	0f 84 ab 00 00 00    	je     f10 <printf+0x140>
+    umtxunlock(&stdoutlock);
+     e65:	83 ec 0c             	sub    $0xc,%esp
+     e68:	68 24 32 00 00       	push   $0x3224
+     e6d:	e8 ae f9 ff ff       	call   820 <umtxunlock>
+}
+     e72:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    umtxunlock(&stdoutlock);
+     e75:	83 c4 10             	add    $0x10,%esp
+}
+     e78:	c9                   	leave
+     e79:	c3                   	ret
+     e7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+     e80:	83 ec 08             	sub    $0x8,%esp
+     e83:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+     e89:	50                   	push   %eax
+     e8a:	ff 35 00 20 00 00    	push   0x2000
+     e90:	e8 13 fa ff ff       	call   8a8 <fstat>
+     e95:	83 c4 10             	add    $0x10,%esp
+     e98:	89 c2                	mov    %eax,%edx
+      stdout.mode = _IOFBF;
+     e9a:	b8 01 00 00 00       	mov    $0x1,%eax
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+     e9f:	85 d2                	test   %edx,%edx
+     ea1:	75 10                	jne    eb3 <printf+0xe3>
+      stdout.mode = _IOLBF;
+     ea3:	31 c0                	xor    %eax,%eax
+     ea5:	66 83 bd e8 fd ff ff 	cmpw   $0x3,-0x218(%ebp)
+     eac:	03 
+     ead:	0f 94 c0             	sete   %al
+     eb0:	83 c0 01             	add    $0x1,%eax
+     eb3:	a3 04 20 00 00       	mov    %eax,0x2004
+    flushhook = flushall;
+     eb8:	c7 05 20 32 00 00 c0 	movl   $0x9c0,0x3220
+     ebf:	09 00 00 
+     ec2:	eb 85                	jmp    e49 <printf+0x79>
+     ec4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(b->n > 0)
+     ec8:	8b 85 f0 fd ff ff    	mov    -0x210(%ebp),%eax
+     ece:	85 c0                	test   %eax,%eax
+     ed0:	0f 8e 50 ff ff ff    	jle    e26 <printf+0x56>
+    b = &local;
+     ed6:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+    _write(b->fd, b->buf, b->n);
+     edc:	83 ec 04             	sub    $0x4,%esp
+     edf:	50                   	push   %eax
+     ee0:	8d 43 0c             	lea    0xc(%ebx),%eax
+     ee3:	50                   	push   %eax
+     ee4:	ff 33                	push   (%ebx)
+     ee6:	e8 85 f9 ff ff       	call   870 <_write>
+  b->n = 0;
+     eeb:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  if(b == &stdout)
+     ef2:	83 c4 10             	add    $0x10,%esp
+     ef5:	81 fb 00 20 00 00    	cmp    $0x2000,%ebx
+     efb:	0f 85 25 ff ff ff    	jne    e26 <printf+0x56>
+     f01:	e9 5f ff ff ff       	jmp    e65 <printf+0x95>
+     f06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f0d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(b->n > 0)
+     f10:	a1 08 20 00 00       	mov    0x2008,%eax
+    b = getstdout();
+     f15:	bb 00 20 00 00       	mov    $0x2000,%ebx
+  if(b->n > 0)
+     f1a:	85 c0                	test   %eax,%eax
+     f1c:	7f be                	jg     edc <printf+0x10c>
+  b->n = 0;
+     f1e:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     f25:	00 00 00 
+  if(b == &stdout)
+     f28:	e9 38 ff ff ff       	jmp    e65 <printf+0x95>
+     f2d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000f30 <sprintf>:
+
+// Print to the given buffer. Only understands %d, %x, %p, %s, %c.
+int
+sprintf(char *str, const char *fmt, ...)
+{
+     f30:	55                   	push   %ebp
+     f31:	89 e5                	mov    %esp,%ebp
+     f33:	53                   	push   %ebx
+  struct outbuf b;
+
+  b.str = str;
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+     f34:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+     f3a:	8d 4d 10             	lea    0x10(%ebp),%ecx
+{
+     f3d:	81 ec 14 02 00 00    	sub    $0x214,%esp
+     f43:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+     f46:	8b 55 0c             	mov    0xc(%ebp),%edx
+  b.str = str;
+     f49:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+     f4c:	e8 2f fc ff ff       	call   b80 <format>
+  *b.str = '\0';
+     f51:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f54:	c6 00 00             	movb   $0x0,(%eax)
+  return b.str - str;
+     f57:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f5a:	29 d8                	sub    %ebx,%eax
+}
+     f5c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     f5f:	c9                   	leave
+     f60:	c3                   	ret
+     f61:	66 90                	xchg   %ax,%ax
+     f63:	66 90                	xchg   %ax,%ax
+     f65:	66 90                	xchg   %ax,%ax
+     f67:	66 90                	xchg   %ax,%ax
+     f69:	66 90                	xchg   %ax,%ax
+     f6b:	66 90                	xchg   %ax,%ax
+     f6d:	66 90                	xchg   %ax,%ax
+     f6f:	90                   	nop
+
+00000f70 <freeblock>:
+static Header *freep;
+static struct umutex lock;  // threads made by clone() share the heap
+
+static void
+freeblock(void *ap)
+{
+     f70:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+     f71:	8d 48 f8             	lea    -0x8(%eax),%ecx
+{
+     f74:	89 e5                	mov    %esp,%ebp
+     f76:	57                   	push   %edi
+     f77:	56                   	push   %esi
+     f78:	53                   	push   %ebx
+     f79:	89 c3                	mov    %eax,%ebx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     f7b:	a1 2c 32 00 00       	mov    0x322c,%eax
+     f80:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     f82:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     f84:	39 ca                	cmp    %ecx,%edx
+     f86:	73 30                	jae    fb8 <freeblock+0x48>
+     f88:	39 c1                	cmp    %eax,%ecx
+     f8a:	72 04                	jb     f90 <freeblock+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     f8c:	39 c2                	cmp    %eax,%edx
+     f8e:	72 f0                	jb     f80 <freeblock+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     f90:	8b 73 fc             	mov    -0x4(%ebx),%esi
+     f93:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+     f96:	39 f8                	cmp    %edi,%eax
+     f98:	74 26                	je     fc0 <freeblock+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+     f9a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+     f9d:	8b 42 04             	mov    0x4(%edx),%eax
+     fa0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     fa3:	39 f1                	cmp    %esi,%ecx
+     fa5:	74 30                	je     fd7 <freeblock+0x67>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+     fa7:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+     fa9:	5b                   	pop    %ebx
+  freep = p;
+     faa:	89 15 2c 32 00 00    	mov    %edx,0x322c
+}
+     fb0:	5e                   	pop    %esi
+     fb1:	5f                   	pop    %edi
+     fb2:	5d                   	pop    %ebp
+     fb3:	c3                   	ret
+     fb4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     fb8:	39 c1                	cmp    %eax,%ecx
+     fba:	72 d0                	jb     f8c <freeblock+0x1c>
+     fbc:	eb c2                	jmp    f80 <freeblock+0x10>
+     fbe:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+     fc0:	03 70 04             	add    0x4(%eax),%esi
+     fc3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     fc6:	8b 02                	mov    (%edx),%eax
+     fc8:	8b 00                	mov    (%eax),%eax
+     fca:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+     fcd:	8b 42 04             	mov    0x4(%edx),%eax
+     fd0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     fd3:	39 f1                	cmp    %esi,%ecx
+     fd5:	75 d0                	jne    fa7 <freeblock+0x37>
+    p->s.size += bp->s.size;
+     fd7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+     fda:	89 15 2c 32 00 00    	mov    %edx,0x322c
+    p->s.size += bp->s.size;
+     fe0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+     fe3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+     fe6:	89 0a                	mov    %ecx,(%edx)
+}
+     fe8:	5b                   	pop    %ebx
+     fe9:	5e                   	pop    %esi
+     fea:	5f                   	pop    %edi
+     feb:	5d                   	pop    %ebp
+     fec:	c3                   	ret
+     fed:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ff0 <free>:
+
+void
+free(void *ap)
+{
+     ff0:	55                   	push   %ebp
+     ff1:	89 e5                	mov    %esp,%ebp
+     ff3:	53                   	push   %ebx
+     ff4:	83 ec 10             	sub    $0x10,%esp
+     ff7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  umtxlock(&lock);
+     ffa:	68 28 32 00 00       	push   $0x3228
+     fff:	e8 cc f7 ff ff       	call   7d0 <umtxlock>
+  freeblock(ap);
+    1004:	89 d8                	mov    %ebx,%eax
+    1006:	e8 65 ff ff ff       	call   f70 <freeblock>
+  umtxunlock(&lock);
+    100b:	c7 45 08 28 32 00 00 	movl   $0x3228,0x8(%ebp)
+}
+    1012:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&lock);
+    1015:	83 c4 10             	add    $0x10,%esp
+}
+    1018:	c9                   	leave
+  umtxunlock(&lock);
+    1019:	e9 02 f8 ff ff       	jmp    820 <umtxunlock>
+    101e:	66 90                	xchg   %ax,%ax
+
+00001020 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    1020:	55                   	push   %ebp
+    1021:	89 e5                	mov    %esp,%ebp
+    1023:	57                   	push   %edi
+    1024:	56                   	push   %esi
+    1025:	53                   	push   %ebx
+    1026:	83 ec 28             	sub    $0x28,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1029:	8b 45 08             	mov    0x8(%ebp),%eax
+  umtxlock(&lock);
+    102c:	68 28 32 00 00       	push   $0x3228
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1031:	8d 48 07             	lea    0x7(%eax),%ecx
+    1034:	c1 e9 03             	shr    $0x3,%ecx
+    1037:	8d 71 01             	lea    0x1(%ecx),%esi
+  umtxlock(&lock);
+    103a:	e8 91 f7 ff ff       	call   7d0 <umtxlock>
+  if((prevp = freep) == 0){
+    103f:	8b 15 2c 32 00 00    	mov    0x322c,%edx
+    1045:	83 c4 10             	add    $0x10,%esp
+    1048:	85 d2                	test   %edx,%edx
+    104a:	0f 84 b0 00 00 00    	je     1100 <malloc+0xe0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1050:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+    1052:	8b 47 04             	mov    0x4(%edi),%eax
+    1055:	39 f0                	cmp    %esi,%eax
+    1057:	73 6f                	jae    10c8 <malloc+0xa8>
+  if(nu < 4096)
+    1059:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    105e:	39 de                	cmp    %ebx,%esi
+    1060:	0f 43 de             	cmovae %esi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    1063:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+    106a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    106d:	eb 0a                	jmp    1079 <malloc+0x59>
+    106f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1070:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+    1072:	8b 47 04             	mov    0x4(%edi),%eax
+    1075:	39 f0                	cmp    %esi,%eax
+    1077:	73 4f                	jae    10c8 <malloc+0xa8>
+      }
+      freep = prevp;
+      umtxunlock(&lock);
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    1079:	89 fa                	mov    %edi,%edx
+    107b:	39 3d 2c 32 00 00    	cmp    %edi,0x322c
+    1081:	75 ed                	jne    1070 <malloc+0x50>
+  p = sbrk(nu * sizeof(Header));
+    1083:	83 ec 0c             	sub    $0xc,%esp
+    1086:	ff 75 e4             	push   -0x1c(%ebp)
+    1089:	e8 4a f8 ff ff       	call   8d8 <sbrk>
+  if(p == (char*)-1)
+    108e:	83 c4 10             	add    $0x10,%esp
+    1091:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1094:	74 15                	je     10ab <malloc+0x8b>
+  hp->s.size = nu;
+    1096:	89 58 04             	mov    %ebx,0x4(%eax)
+  freeblock((void*)(hp + 1));
+    1099:	83 c0 08             	add    $0x8,%eax
+    109c:	e8 cf fe ff ff       	call   f70 <freeblock>
+  return freep;
+    10a1:	8b 15 2c 32 00 00    	mov    0x322c,%edx
+      if((p = morecore(nunits)) == 0){
+    10a7:	85 d2                	test   %edx,%edx
+    10a9:	75 c5                	jne    1070 <malloc+0x50>
+        umtxunlock(&lock);
+    10ab:	83 ec 0c             	sub    $0xc,%esp
+    10ae:	68 28 32 00 00       	push   $0x3228
+    10b3:	e8 68 f7 ff ff       	call   820 <umtxunlock>
+        return 0;
+    10b8:	83 c4 10             	add    $0x10,%esp
+      }
+  }
+}
+    10bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    10be:	31 c0                	xor    %eax,%eax
+}
+    10c0:	5b                   	pop    %ebx
+    10c1:	5e                   	pop    %esi
+    10c2:	5f                   	pop    %edi
+    10c3:	5d                   	pop    %ebp
+    10c4:	c3                   	ret
+    10c5:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    10c8:	39 c6                	cmp    %eax,%esi
+    10ca:	74 64                	je     1130 <malloc+0x110>
+        p->s.size -= nunits;
+    10cc:	29 f0                	sub    %esi,%eax
+    10ce:	89 47 04             	mov    %eax,0x4(%edi)
+        p += p->s.size;
+    10d1:	8d 3c c7             	lea    (%edi,%eax,8),%edi
+        p->s.size = nunits;
+    10d4:	89 77 04             	mov    %esi,0x4(%edi)
+      umtxunlock(&lock);
+    10d7:	83 ec 0c             	sub    $0xc,%esp
+      freep = prevp;
+    10da:	89 15 2c 32 00 00    	mov    %edx,0x322c
+      umtxunlock(&lock);
+    10e0:	68 28 32 00 00       	push   $0x3228
+    10e5:	e8 36 f7 ff ff       	call   820 <umtxunlock>
+      return (void*)(p + 1);
+    10ea:	83 c4 10             	add    $0x10,%esp
+}
+    10ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    10f0:	8d 47 08             	lea    0x8(%edi),%eax
+}
+    10f3:	5b                   	pop    %ebx
+    10f4:	5e                   	pop    %esi
+    10f5:	5f                   	pop    %edi
+    10f6:	5d                   	pop    %ebp
+    10f7:	c3                   	ret
+    10f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10ff:	90                   	nop
+    base.s.ptr = freep = prevp = &base;
+    1100:	c7 05 2c 32 00 00 30 	movl   $0x3230,0x322c
+    1107:	32 00 00 
+    base.s.size = 0;
+    110a:	bf 30 32 00 00       	mov    $0x3230,%edi
+    base.s.ptr = freep = prevp = &base;
+    110f:	c7 05 30 32 00 00 30 	movl   $0x3230,0x3230
+    1116:	32 00 00 
+    base.s.size = 0;
+    1119:	c7 05 34 32 00 00 00 	movl   $0x0,0x3234
+    1120:	00 00 00 
+    if(p->s.size >= nunits){
+    1123:	e9 31 ff ff ff       	jmp    1059 <malloc+0x39>
+    1128:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    112f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1130:	8b 07                	mov    (%edi),%eax
+    1132:	89 02                	mov    %eax,(%edx)
+    1134:	eb a1                	jmp    10d7 <malloc+0xb7>
+    1136:	66 90                	xchg   %ax,%ax
+    1138:	66 90                	xchg   %ax,%ax
+    113a:	66 90                	xchg   %ax,%ax
+    113c:	66 90                	xchg   %ax,%ax
+    113e:	66 90                	xchg   %ax,%ax
+
+00001140 <threadstart>:
+
+#define TSTACKSZ 4096
+
+static void
+threadstart(void *fn, void *arg)
+{
+    1140:	55                   	push   %ebp
+    1141:	89 e5                	mov    %esp,%ebp
+    1143:	83 ec 14             	sub    $0x14,%esp
+  ((void (*)(void*))fn)(arg);
+    1146:	ff 75 0c             	push   0xc(%ebp)
+    1149:	ff 55 08             	call   *0x8(%ebp)
+  exit();
+    114c:	e8 ef f4 ff ff       	call   640 <exit>
+    1151:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1158:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    115f:	90                   	nop
+
+00001160 <thread_create>:
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    1160:	55                   	push   %ebp
+    1161:	89 e5                	mov    %esp,%ebp
+    1163:	53                   	push   %ebx
+    1164:	83 ec 20             	sub    $0x20,%esp
+  char *mem, *stack;
+  int pid;
+
+  if((mem = malloc(2*TSTACKSZ)) == 0)
+    1167:	68 00 20 00 00       	push   $0x2000
+    116c:	e8 af fe ff ff       	call   1020 <malloc>
+    1171:	83 c4 10             	add    $0x10,%esp
+    1174:	85 c0                	test   %eax,%eax
+    1176:	74 47                	je     11bf <thread_create+0x5f>
+    1178:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)(((uint)mem + TSTACKSZ - 1) & ~(TSTACKSZ - 1));
+    117a:	8d 80 ff 0f 00 00    	lea    0xfff(%eax),%eax
+    1180:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  *(char**)stack = mem;
+    1185:	89 18                	mov    %ebx,(%eax)
+  if((pid = clone(threadstart, (void*)fn, arg, stack)) < 0)
+    1187:	50                   	push   %eax
+    1188:	ff 75 0c             	push   0xc(%ebp)
+    118b:	ff 75 08             	push   0x8(%ebp)
+    118e:	68 40 11 00 00       	push   $0x1140
+    1193:	e8 08 f8 ff ff       	call   9a0 <clone>
+    1198:	83 c4 10             	add    $0x10,%esp
+    119b:	85 c0                	test   %eax,%eax
+    119d:	78 09                	js     11a8 <thread_create+0x48>
+    free(mem);
+  return pid;
+}
+    119f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    11a2:	c9                   	leave
+    11a3:	c3                   	ret
+    11a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    free(mem);
+    11a8:	83 ec 0c             	sub    $0xc,%esp
+    11ab:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    11ae:	53                   	push   %ebx
+    11af:	e8 3c fe ff ff       	call   ff0 <free>
+    11b4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    11b7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+    11ba:	83 c4 10             	add    $0x10,%esp
+}
+    11bd:	c9                   	leave
+    11be:	c3                   	ret
+    return -1;
+    11bf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    11c4:	eb d9                	jmp    119f <thread_create+0x3f>
+    11c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000011d0 <thread_join>:
+
+int
+thread_join(void)
+{
+    11d0:	55                   	push   %ebp
+    11d1:	89 e5                	mov    %esp,%ebp
+    11d3:	83 ec 34             	sub    $0x34,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    11d6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    11d9:	50                   	push   %eax
+    11da:	e8 c9 f7 ff ff       	call   9a8 <join>
+    11df:	83 c4 10             	add    $0x10,%esp
+    11e2:	85 c0                	test   %eax,%eax
+    11e4:	79 0a                	jns    11f0 <thread_join+0x20>
+    free(*(char**)stack);
+  return pid;
+}
+    11e6:	c9                   	leave
+    11e7:	c3                   	ret
+    11e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11ef:	90                   	nop
+    free(*(char**)stack);
+    11f0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    11f3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    11f6:	83 ec 0c             	sub    $0xc,%esp
+    11f9:	ff 32                	push   (%edx)
+    11fb:	e8 f0 fd ff ff       	call   ff0 <free>
+    1200:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1203:	83 c4 10             	add    $0x10,%esp
+}
+    1206:	c9                   	leave
+    1207:	c3                   	ret
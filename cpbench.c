@@ -0,0 +1,104 @@
+// Compare copying a file with a read()/write() loop against
+// sendfile(). The loop copies through a user buffer and
+// filewrite() commits a log transaction every three blocks;
+// sendfile() copies from the page cache and fits thirteen
+// blocks in each transaction. Disk writes include the log.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+#include "iostat.h"
+
+#define FILESZ  (64*1024)
+#define NROUND  8
+
+char buf[4096];
+
+int
+copy(int usesendfile, uint *nwrite)
+{
+  struct iostat s0, s1;
+  int in, out, n, r, t0;
+
+  iostat(&s0);
+  t0 = uptime();
+  for(r = 0; r < NROUND; r++){
+    unlink("cpbench.dst");
+    if((in = open("cpbench.src", O_RDONLY)) < 0 ||
+       (out = open("cpbench.dst", O_CREATE|O_WRONLY)) < 0){
+      printf(1, "cpbench: open failed\n");
+      exit();
+    }
+    if(usesendfile){
+      while((n = sendfile(out, in, FILESZ)) > 0)
+        ;
+    } else {
+      while((n = read(in, buf, sizeof(buf))) > 0)
+        if(write(out, buf, n) != n){
+          n = -1;
+          break;
+        }
+    }
+    if(n < 0){
+      printf(1, "cpbench: copy failed\n");
+      exit();
+    }
+    close(in);
+    close(out);
+  }
+  t0 = uptime() - t0;
+  iostat(&s1);
+  *nwrite = s1.nwrite - s0.nwrite;
+  return t0;
+}
+
+void
+check(void)
+{
+  int fd, i, n, off;
+
+  if((fd = open("cpbench.dst", O_RDONLY)) < 0){
+    printf(1, "cpbench: cannot open cpbench.dst\n");
+    exit();
+  }
+  for(off = 0; (n = read(fd, buf, sizeof(buf))) > 0; off += n)
+    for(i = 0; i < n; i++)
+      if(buf[i] != (char)((off + i) % 251)){
+        printf(1, "cpbench: copy differs at byte %d\n", off + i);
+        exit();
+      }
+  if(off != FILESZ)
+    printf(1, "cpbench: copy has %d bytes, expected %d\n", off, FILESZ);
+  close(fd);
+}
+
+int
+main(int argc, char *argv[])
+{
+  int fd, i, off, tr, ts;
+  uint wr, ws;
+
+  if((fd = open("cpbench.src", O_CREATE|O_RDWR)) < 0){
+    printf(1, "cpbench: cannot create cpbench.src\n");
+    exit();
+  }
+  for(off = 0; off < FILESZ; off += sizeof(buf)){
+    for(i = 0; i < sizeof(buf); i++)
+      buf[i] = (off + i) % 251;
+    write(fd, buf, sizeof(buf));
+  }
+  close(fd);
+
+  tr = copy(0, &wr);
+  check();
+  ts = copy(1, &ws);
+  check();
+  printf(1, "cpbench: %d x %d KB, read/write: %d ticks, %d disk writes\n",
+         NROUND, FILESZ/1024, tr, wr);
+  printf(1, "cpbench: %d x %d KB, sendfile: %d ticks, %d disk writes\n",
+         NROUND, FILESZ/1024, ts, ws);
+  unlink("cpbench.src");
+  unlink("cpbench.dst");
+  exit();
+}
@@ -0,0 +1,2314 @@
+
+_ctxbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <pingpong>:
+
+#define NROUND 20000
+
+int
+pingpong(void)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	57                   	push   %edi
+       4:	56                   	push   %esi
+  int ab[2], ba[2], i, t0;
+  char c;
+
+  if(pipe(ab) < 0 || pipe(ba) < 0){
+       5:	8d 45 d8             	lea    -0x28(%ebp),%eax
+{
+       8:	53                   	push   %ebx
+       9:	83 ec 38             	sub    $0x38,%esp
+  if(pipe(ab) < 0 || pipe(ba) < 0){
+       c:	50                   	push   %eax
+       d:	e8 4e 06 00 00       	call   660 <pipe>
+      12:	83 c4 10             	add    $0x10,%esp
+      15:	85 c0                	test   %eax,%eax
+      17:	0f 88 f4 00 00 00    	js     111 <pingpong+0x111>
+      1d:	83 ec 0c             	sub    $0xc,%esp
+      20:	8d 45 e0             	lea    -0x20(%ebp),%eax
+      23:	50                   	push   %eax
+      24:	e8 37 06 00 00       	call   660 <pipe>
+      29:	83 c4 10             	add    $0x10,%esp
+      2c:	85 c0                	test   %eax,%eax
+      2e:	0f 88 dd 00 00 00    	js     111 <pingpong+0x111>
+    printf(1, "ctxbench: pipe failed\n");
+    exit();
+  }
+  t0 = uptime();
+      34:	e8 af 06 00 00       	call   6e8 <uptime>
+      39:	89 c7                	mov    %eax,%edi
+  if(fork() == 0){
+      3b:	e8 d0 03 00 00       	call   410 <fork>
+      40:	85 c0                	test   %eax,%eax
+      42:	0f 84 8b 00 00 00    	je     d3 <pingpong+0xd3>
+        break;
+      write(ba[1], &c, 1);
+    }
+    exit();
+  }
+  c = 0;
+      48:	c6 45 d7 00          	movb   $0x0,-0x29(%ebp)
+      4c:	bb 20 4e 00 00       	mov    $0x4e20,%ebx
+      51:	8d 75 d7             	lea    -0x29(%ebp),%esi
+      54:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; i < NROUND; i++){
+    write(ab[1], &c, 1);
+      58:	83 ec 04             	sub    $0x4,%esp
+      5b:	6a 01                	push   $0x1
+      5d:	56                   	push   %esi
+      5e:	ff 75 dc             	push   -0x24(%ebp)
+      61:	e8 aa 04 00 00       	call   510 <write>
+    if(read(ba[0], &c, 1) != 1){
+      66:	83 c4 0c             	add    $0xc,%esp
+      69:	6a 01                	push   $0x1
+      6b:	56                   	push   %esi
+      6c:	ff 75 e0             	push   -0x20(%ebp)
+      6f:	e8 1c 04 00 00       	call   490 <read>
+      74:	83 c4 10             	add    $0x10,%esp
+      77:	83 f8 01             	cmp    $0x1,%eax
+      7a:	75 43                	jne    bf <pingpong+0xbf>
+  for(i = 0; i < NROUND; i++){
+      7c:	83 eb 01             	sub    $0x1,%ebx
+      7f:	75 d7                	jne    58 <pingpong+0x58>
+      printf(1, "ctxbench: read failed\n");
+      exit();
+    }
+  }
+  wait();
+      81:	e8 d2 05 00 00       	call   658 <wait>
+  t0 = uptime() - t0;
+      86:	e8 5d 06 00 00       	call   6e8 <uptime>
+  close(ab[0]);
+      8b:	83 ec 0c             	sub    $0xc,%esp
+      8e:	ff 75 d8             	push   -0x28(%ebp)
+  t0 = uptime() - t0;
+      91:	29 f8                	sub    %edi,%eax
+      93:	89 c3                	mov    %eax,%ebx
+  close(ab[0]);
+      95:	e8 f6 04 00 00       	call   590 <close>
+  close(ab[1]);
+      9a:	58                   	pop    %eax
+      9b:	ff 75 dc             	push   -0x24(%ebp)
+      9e:	e8 ed 04 00 00       	call   590 <close>
+  close(ba[0]);
+      a3:	5a                   	pop    %edx
+      a4:	ff 75 e0             	push   -0x20(%ebp)
+      a7:	e8 e4 04 00 00       	call   590 <close>
+  close(ba[1]);
+      ac:	59                   	pop    %ecx
+      ad:	ff 75 e4             	push   -0x1c(%ebp)
+      b0:	e8 db 04 00 00       	call   590 <close>
+  return t0;
+}
+      b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      b8:	89 d8                	mov    %ebx,%eax
+      ba:	5b                   	pop    %ebx
+      bb:	5e                   	pop    %esi
+      bc:	5f                   	pop    %edi
+      bd:	5d                   	pop    %ebp
+      be:	c3                   	ret
+      printf(1, "ctxbench: read failed\n");
+      bf:	83 ec 08             	sub    $0x8,%esp
+      c2:	68 1f 10 00 00       	push   $0x101f
+      c7:	6a 01                	push   $0x1
+      c9:	e8 02 0b 00 00       	call   bd0 <printf>
+      exit();
+      ce:	e8 6d 03 00 00       	call   440 <exit>
+      d3:	bb 20 4e 00 00       	mov    $0x4e20,%ebx
+      d8:	8d 75 d7             	lea    -0x29(%ebp),%esi
+      db:	eb 19                	jmp    f6 <pingpong+0xf6>
+      dd:	8d 76 00             	lea    0x0(%esi),%esi
+      write(ba[1], &c, 1);
+      e0:	83 ec 04             	sub    $0x4,%esp
+      e3:	6a 01                	push   $0x1
+      e5:	56                   	push   %esi
+      e6:	ff 75 e4             	push   -0x1c(%ebp)
+      e9:	e8 22 04 00 00       	call   510 <write>
+    for(i = 0; i < NROUND; i++){
+      ee:	83 c4 10             	add    $0x10,%esp
+      f1:	83 eb 01             	sub    $0x1,%ebx
+      f4:	74 16                	je     10c <pingpong+0x10c>
+      if(read(ab[0], &c, 1) != 1)
+      f6:	83 ec 04             	sub    $0x4,%esp
+      f9:	6a 01                	push   $0x1
+      fb:	56                   	push   %esi
+      fc:	ff 75 d8             	push   -0x28(%ebp)
+      ff:	e8 8c 03 00 00       	call   490 <read>
+     104:	83 c4 10             	add    $0x10,%esp
+     107:	83 f8 01             	cmp    $0x1,%eax
+     10a:	74 d4                	je     e0 <pingpong+0xe0>
+    exit();
+     10c:	e8 2f 03 00 00       	call   440 <exit>
+    printf(1, "ctxbench: pipe failed\n");
+     111:	53                   	push   %ebx
+     112:	53                   	push   %ebx
+     113:	68 08 10 00 00       	push   $0x1008
+     118:	6a 01                	push   $0x1
+     11a:	e8 b1 0a 00 00       	call   bd0 <printf>
+    exit();
+     11f:	e8 1c 03 00 00       	call   440 <exit>
+     124:	66 90                	xchg   %ax,%ax
+     126:	66 90                	xchg   %ax,%ax
+     128:	66 90                	xchg   %ax,%ax
+     12a:	66 90                	xchg   %ax,%ax
+     12c:	66 90                	xchg   %ax,%ax
+     12e:	66 90                	xchg   %ax,%ax
+
+00000130 <main>:
+
+int
+main(int argc, char *argv[])
+{
+     130:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     134:	83 e4 f0             	and    $0xfffffff0,%esp
+     137:	ff 71 fc             	push   -0x4(%ecx)
+     13a:	55                   	push   %ebp
+     13b:	89 e5                	mov    %esp,%ebp
+     13d:	51                   	push   %ecx
+     13e:	83 ec 04             	sub    $0x4,%esp
+  int t;
+
+  t = pingpong();
+     141:	e8 ba fe ff ff       	call   0 <pingpong>
+  printf(1, "ctxbench: %d pipe round trips (%d context switches): %d ticks\n",
+     146:	83 ec 0c             	sub    $0xc,%esp
+     149:	50                   	push   %eax
+     14a:	68 40 9c 00 00       	push   $0x9c40
+     14f:	68 20 4e 00 00       	push   $0x4e20
+     154:	68 38 10 00 00       	push   $0x1038
+     159:	6a 01                	push   $0x1
+     15b:	e8 70 0a 00 00       	call   bd0 <printf>
+         NROUND, 2*NROUND, t);
+  exit();
+     160:	83 c4 20             	add    $0x20,%esp
+     163:	e8 d8 02 00 00       	call   440 <exit>
+     168:	66 90                	xchg   %ax,%ax
+     16a:	66 90                	xchg   %ax,%ax
+     16c:	66 90                	xchg   %ax,%ax
+     16e:	66 90                	xchg   %ax,%ax
+
+00000170 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     170:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     171:	31 c0                	xor    %eax,%eax
+{
+     173:	89 e5                	mov    %esp,%ebp
+     175:	53                   	push   %ebx
+     176:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     179:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     17c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     180:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     184:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     187:	83 c0 01             	add    $0x1,%eax
+     18a:	84 d2                	test   %dl,%dl
+     18c:	75 f2                	jne    180 <strcpy+0x10>
+    ;
+  return os;
+}
+     18e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     191:	89 c8                	mov    %ecx,%eax
+     193:	c9                   	leave
+     194:	c3                   	ret
+     195:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     19c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000001a0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     1a0:	55                   	push   %ebp
+     1a1:	89 e5                	mov    %esp,%ebp
+     1a3:	53                   	push   %ebx
+     1a4:	8b 55 08             	mov    0x8(%ebp),%edx
+     1a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     1aa:	0f b6 02             	movzbl (%edx),%eax
+     1ad:	84 c0                	test   %al,%al
+     1af:	75 17                	jne    1c8 <strcmp+0x28>
+     1b1:	eb 3a                	jmp    1ed <strcmp+0x4d>
+     1b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     1b7:	90                   	nop
+     1b8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     1bc:	83 c2 01             	add    $0x1,%edx
+     1bf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     1c2:	84 c0                	test   %al,%al
+     1c4:	74 1a                	je     1e0 <strcmp+0x40>
+    p++, q++;
+     1c6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     1c8:	0f b6 19             	movzbl (%ecx),%ebx
+     1cb:	38 c3                	cmp    %al,%bl
+     1cd:	74 e9                	je     1b8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     1cf:	29 d8                	sub    %ebx,%eax
+}
+     1d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     1d4:	c9                   	leave
+     1d5:	c3                   	ret
+     1d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1dd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     1e0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     1e4:	31 c0                	xor    %eax,%eax
+     1e6:	29 d8                	sub    %ebx,%eax
+}
+     1e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     1eb:	c9                   	leave
+     1ec:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     1ed:	0f b6 19             	movzbl (%ecx),%ebx
+     1f0:	31 c0                	xor    %eax,%eax
+     1f2:	eb db                	jmp    1cf <strcmp+0x2f>
+     1f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     1ff:	90                   	nop
+
+00000200 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     200:	55                   	push   %ebp
+     201:	89 e5                	mov    %esp,%ebp
+     203:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     206:	80 3a 00             	cmpb   $0x0,(%edx)
+     209:	74 15                	je     220 <strlen+0x20>
+     20b:	31 c0                	xor    %eax,%eax
+     20d:	8d 76 00             	lea    0x0(%esi),%esi
+     210:	83 c0 01             	add    $0x1,%eax
+     213:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     217:	89 c1                	mov    %eax,%ecx
+     219:	75 f5                	jne    210 <strlen+0x10>
+    ;
+  return n;
+}
+     21b:	89 c8                	mov    %ecx,%eax
+     21d:	5d                   	pop    %ebp
+     21e:	c3                   	ret
+     21f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     220:	31 c9                	xor    %ecx,%ecx
+}
+     222:	5d                   	pop    %ebp
+     223:	89 c8                	mov    %ecx,%eax
+     225:	c3                   	ret
+     226:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     22d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000230 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     230:	55                   	push   %ebp
+     231:	89 e5                	mov    %esp,%ebp
+     233:	57                   	push   %edi
+     234:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     237:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     23a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     23d:	89 d7                	mov    %edx,%edi
+     23f:	fc                   	cld
+     240:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     242:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     245:	89 d0                	mov    %edx,%eax
+     247:	c9                   	leave
+     248:	c3                   	ret
+     249:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000250 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     250:	55                   	push   %ebp
+     251:	89 e5                	mov    %esp,%ebp
+     253:	56                   	push   %esi
+     254:	53                   	push   %ebx
+     255:	8b 75 10             	mov    0x10(%ebp),%esi
+     258:	8b 55 08             	mov    0x8(%ebp),%edx
+     25b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+     25e:	85 f6                	test   %esi,%esi
+     260:	74 2e                	je     290 <memcmp+0x40>
+     262:	01 c6                	add    %eax,%esi
+     264:	eb 14                	jmp    27a <memcmp+0x2a>
+     266:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     26d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+     270:	83 c0 01             	add    $0x1,%eax
+     273:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+     276:	39 f0                	cmp    %esi,%eax
+     278:	74 16                	je     290 <memcmp+0x40>
+    if(*s1 != *s2)
+     27a:	0f b6 0a             	movzbl (%edx),%ecx
+     27d:	0f b6 18             	movzbl (%eax),%ebx
+     280:	38 d9                	cmp    %bl,%cl
+     282:	74 ec                	je     270 <memcmp+0x20>
+      return *s1 - *s2;
+     284:	0f b6 c1             	movzbl %cl,%eax
+     287:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+     289:	5b                   	pop    %ebx
+     28a:	5e                   	pop    %esi
+     28b:	5d                   	pop    %ebp
+     28c:	c3                   	ret
+     28d:	8d 76 00             	lea    0x0(%esi),%esi
+     290:	5b                   	pop    %ebx
+  return 0;
+     291:	31 c0                	xor    %eax,%eax
+}
+     293:	5e                   	pop    %esi
+     294:	5d                   	pop    %ebp
+     295:	c3                   	ret
+     296:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     29d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002a0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     2a0:	55                   	push   %ebp
+     2a1:	89 e5                	mov    %esp,%ebp
+     2a3:	8b 45 08             	mov    0x8(%ebp),%eax
+     2a6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     2aa:	0f b6 10             	movzbl (%eax),%edx
+     2ad:	84 d2                	test   %dl,%dl
+     2af:	75 12                	jne    2c3 <strchr+0x23>
+     2b1:	eb 1d                	jmp    2d0 <strchr+0x30>
+     2b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2b7:	90                   	nop
+     2b8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     2bc:	83 c0 01             	add    $0x1,%eax
+     2bf:	84 d2                	test   %dl,%dl
+     2c1:	74 0d                	je     2d0 <strchr+0x30>
+    if(*s == c)
+     2c3:	38 d1                	cmp    %dl,%cl
+     2c5:	75 f1                	jne    2b8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     2c7:	5d                   	pop    %ebp
+     2c8:	c3                   	ret
+     2c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     2d0:	31 c0                	xor    %eax,%eax
+}
+     2d2:	5d                   	pop    %ebp
+     2d3:	c3                   	ret
+     2d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2df:	90                   	nop
+
+000002e0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     2e0:	55                   	push   %ebp
+     2e1:	89 e5                	mov    %esp,%ebp
+     2e3:	57                   	push   %edi
+     2e4:	56                   	push   %esi
+int
+read(int fd, void *buf, int n)
+{
+  if(flushhook)
+    flushhook();
+  return _read(fd, buf, n);
+     2e5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     2e8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     2e9:	31 db                	xor    %ebx,%ebx
+{
+     2eb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     2ee:	eb 32                	jmp    322 <gets+0x42>
+  if(flushhook)
+     2f0:	a1 10 22 00 00       	mov    0x2210,%eax
+     2f5:	85 c0                	test   %eax,%eax
+     2f7:	74 02                	je     2fb <gets+0x1b>
+    flushhook();
+     2f9:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+     2fb:	83 ec 04             	sub    $0x4,%esp
+     2fe:	6a 01                	push   $0x1
+     300:	56                   	push   %esi
+     301:	6a 00                	push   $0x0
+     303:	e8 60 03 00 00       	call   668 <_read>
+    if(cc < 1)
+     308:	83 c4 10             	add    $0x10,%esp
+     30b:	85 c0                	test   %eax,%eax
+     30d:	7e 1d                	jle    32c <gets+0x4c>
+    buf[i++] = c;
+     30f:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     313:	8b 55 08             	mov    0x8(%ebp),%edx
+     316:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     31a:	3c 0a                	cmp    $0xa,%al
+     31c:	74 10                	je     32e <gets+0x4e>
+     31e:	3c 0d                	cmp    $0xd,%al
+     320:	74 0c                	je     32e <gets+0x4e>
+  for(i=0; i+1 < max; ){
+     322:	89 df                	mov    %ebx,%edi
+     324:	83 c3 01             	add    $0x1,%ebx
+     327:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     32a:	7c c4                	jl     2f0 <gets+0x10>
+     32c:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+     32e:	8b 45 08             	mov    0x8(%ebp),%eax
+     331:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+     335:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     338:	5b                   	pop    %ebx
+     339:	5e                   	pop    %esi
+     33a:	5f                   	pop    %edi
+     33b:	5d                   	pop    %ebp
+     33c:	c3                   	ret
+     33d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000340 <stat>:
+{
+     340:	55                   	push   %ebp
+     341:	89 e5                	mov    %esp,%ebp
+     343:	56                   	push   %esi
+     344:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+     345:	83 ec 08             	sub    $0x8,%esp
+     348:	6a 00                	push   $0x0
+     34a:	ff 75 08             	push   0x8(%ebp)
+     34d:	e8 3e 03 00 00       	call   690 <open>
+  if(fd < 0)
+     352:	83 c4 10             	add    $0x10,%esp
+     355:	85 c0                	test   %eax,%eax
+     357:	78 37                	js     390 <stat+0x50>
+  r = fstat(fd, st);
+     359:	83 ec 08             	sub    $0x8,%esp
+     35c:	ff 75 0c             	push   0xc(%ebp)
+     35f:	89 c3                	mov    %eax,%ebx
+     361:	50                   	push   %eax
+     362:	e8 41 03 00 00       	call   6a8 <fstat>
+}
+
+int
+close(int fd)
+{
+  if(flushhook)
+     367:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+     36a:	89 c6                	mov    %eax,%esi
+  if(flushhook)
+     36c:	a1 10 22 00 00       	mov    0x2210,%eax
+     371:	85 c0                	test   %eax,%eax
+     373:	74 02                	je     377 <stat+0x37>
+    flushhook();
+     375:	ff d0                	call   *%eax
+  return _close(fd);
+     377:	83 ec 0c             	sub    $0xc,%esp
+     37a:	53                   	push   %ebx
+     37b:	e8 f8 02 00 00       	call   678 <_close>
+     380:	83 c4 10             	add    $0x10,%esp
+}
+     383:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     386:	89 f0                	mov    %esi,%eax
+     388:	5b                   	pop    %ebx
+     389:	5e                   	pop    %esi
+     38a:	5d                   	pop    %ebp
+     38b:	c3                   	ret
+     38c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+     390:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     395:	eb ec                	jmp    383 <stat+0x43>
+     397:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     39e:	66 90                	xchg   %ax,%ax
+
+000003a0 <atoi>:
+{
+     3a0:	55                   	push   %ebp
+     3a1:	89 e5                	mov    %esp,%ebp
+     3a3:	53                   	push   %ebx
+     3a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+     3a7:	0f be 02             	movsbl (%edx),%eax
+     3aa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     3ad:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     3b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     3b5:	77 1e                	ja     3d5 <atoi+0x35>
+     3b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3be:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     3c0:	83 c2 01             	add    $0x1,%edx
+     3c3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     3c6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     3ca:	0f be 02             	movsbl (%edx),%eax
+     3cd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     3d0:	80 fb 09             	cmp    $0x9,%bl
+     3d3:	76 eb                	jbe    3c0 <atoi+0x20>
+}
+     3d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     3d8:	89 c8                	mov    %ecx,%eax
+     3da:	c9                   	leave
+     3db:	c3                   	ret
+     3dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003e0 <memmove>:
+{
+     3e0:	55                   	push   %ebp
+     3e1:	89 e5                	mov    %esp,%ebp
+     3e3:	57                   	push   %edi
+     3e4:	56                   	push   %esi
+     3e5:	8b 45 10             	mov    0x10(%ebp),%eax
+     3e8:	8b 55 08             	mov    0x8(%ebp),%edx
+     3eb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+     3ee:	85 c0                	test   %eax,%eax
+     3f0:	7e 13                	jle    405 <memmove+0x25>
+     3f2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     3f4:	89 d7                	mov    %edx,%edi
+     3f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3fd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     400:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     401:	39 f8                	cmp    %edi,%eax
+     403:	75 fb                	jne    400 <memmove+0x20>
+}
+     405:	5e                   	pop    %esi
+     406:	89 d0                	mov    %edx,%eax
+     408:	5f                   	pop    %edi
+     409:	5d                   	pop    %ebp
+     40a:	c3                   	ret
+     40b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     40f:	90                   	nop
+
+00000410 <fork>:
+  if(flushhook)
+     410:	a1 10 22 00 00       	mov    0x2210,%eax
+     415:	85 c0                	test   %eax,%eax
+     417:	74 17                	je     430 <fork+0x20>
+{
+     419:	55                   	push   %ebp
+     41a:	89 e5                	mov    %esp,%ebp
+     41c:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+     41f:	ff d0                	call   *%eax
+}
+     421:	c9                   	leave
+  return _fork();
+     422:	e9 21 02 00 00       	jmp    648 <_fork>
+     427:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     42e:	66 90                	xchg   %ax,%ax
+     430:	e9 13 02 00 00       	jmp    648 <_fork>
+     435:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     43c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000440 <exit>:
+{
+     440:	55                   	push   %ebp
+     441:	89 e5                	mov    %esp,%ebp
+     443:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+     446:	a1 10 22 00 00       	mov    0x2210,%eax
+     44b:	85 c0                	test   %eax,%eax
+     44d:	74 02                	je     451 <exit+0x11>
+    flushhook();
+     44f:	ff d0                	call   *%eax
+  _exit();
+     451:	e8 fa 01 00 00       	call   650 <_exit>
+     456:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     45d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000460 <exec>:
+{
+     460:	55                   	push   %ebp
+  if(flushhook)
+     461:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+     466:	89 e5                	mov    %esp,%ebp
+     468:	56                   	push   %esi
+     469:	53                   	push   %ebx
+     46a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     46d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+     470:	85 c0                	test   %eax,%eax
+     472:	74 02                	je     476 <exec+0x16>
+    flushhook();
+     474:	ff d0                	call   *%eax
+  return _exec(path, argv);
+     476:	89 75 0c             	mov    %esi,0xc(%ebp)
+     479:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     47c:	5b                   	pop    %ebx
+     47d:	5e                   	pop    %esi
+     47e:	5d                   	pop    %ebp
+  return _exec(path, argv);
+     47f:	e9 04 02 00 00       	jmp    688 <_exec>
+     484:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     48b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     48f:	90                   	nop
+
+00000490 <read>:
+{
+     490:	55                   	push   %ebp
+     491:	89 e5                	mov    %esp,%ebp
+     493:	57                   	push   %edi
+     494:	56                   	push   %esi
+     495:	53                   	push   %ebx
+     496:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     499:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+     49e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     4a1:	8b 75 0c             	mov    0xc(%ebp),%esi
+     4a4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     4a7:	85 c0                	test   %eax,%eax
+     4a9:	74 02                	je     4ad <read+0x1d>
+    flushhook();
+     4ab:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+     4ad:	89 7d 10             	mov    %edi,0x10(%ebp)
+     4b0:	89 75 0c             	mov    %esi,0xc(%ebp)
+     4b3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     4b6:	83 c4 0c             	add    $0xc,%esp
+     4b9:	5b                   	pop    %ebx
+     4ba:	5e                   	pop    %esi
+     4bb:	5f                   	pop    %edi
+     4bc:	5d                   	pop    %ebp
+  return _read(fd, buf, n);
+     4bd:	e9 a6 01 00 00       	jmp    668 <_read>
+     4c2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004d0 <readv>:
+{
+     4d0:	55                   	push   %ebp
+     4d1:	89 e5                	mov    %esp,%ebp
+     4d3:	57                   	push   %edi
+     4d4:	56                   	push   %esi
+     4d5:	53                   	push   %ebx
+     4d6:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     4d9:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+     4de:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     4e1:	8b 75 0c             	mov    0xc(%ebp),%esi
+     4e4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     4e7:	85 c0                	test   %eax,%eax
+     4e9:	74 02                	je     4ed <readv+0x1d>
+    flushhook();
+     4eb:	ff d0                	call   *%eax
+  return _readv(fd, iov, cnt);
+     4ed:	89 7d 10             	mov    %edi,0x10(%ebp)
+     4f0:	89 75 0c             	mov    %esi,0xc(%ebp)
+     4f3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     4f6:	83 c4 0c             	add    $0xc,%esp
+     4f9:	5b                   	pop    %ebx
+     4fa:	5e                   	pop    %esi
+     4fb:	5f                   	pop    %edi
+     4fc:	5d                   	pop    %ebp
+  return _readv(fd, iov, cnt);
+     4fd:	e9 76 02 00 00       	jmp    778 <_readv>
+     502:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     509:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000510 <write>:
+{
+     510:	55                   	push   %ebp
+     511:	89 e5                	mov    %esp,%ebp
+     513:	57                   	push   %edi
+     514:	56                   	push   %esi
+     515:	53                   	push   %ebx
+     516:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     519:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+     51e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     521:	8b 75 0c             	mov    0xc(%ebp),%esi
+     524:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     527:	85 c0                	test   %eax,%eax
+     529:	74 02                	je     52d <write+0x1d>
+    flushhook();
+     52b:	ff d0                	call   *%eax
+  return _write(fd, buf, n);
+     52d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     530:	89 75 0c             	mov    %esi,0xc(%ebp)
+     533:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     536:	83 c4 0c             	add    $0xc,%esp
+     539:	5b                   	pop    %ebx
+     53a:	5e                   	pop    %esi
+     53b:	5f                   	pop    %edi
+     53c:	5d                   	pop    %ebp
+  return _write(fd, buf, n);
+     53d:	e9 2e 01 00 00       	jmp    670 <_write>
+     542:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     549:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000550 <writev>:
+{
+     550:	55                   	push   %ebp
+     551:	89 e5                	mov    %esp,%ebp
+     553:	57                   	push   %edi
+     554:	56                   	push   %esi
+     555:	53                   	push   %ebx
+     556:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     559:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+     55e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     561:	8b 75 0c             	mov    0xc(%ebp),%esi
+     564:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     567:	85 c0                	test   %eax,%eax
+     569:	74 02                	je     56d <writev+0x1d>
+    flushhook();
+     56b:	ff d0                	call   *%eax
+  return _writev(fd, iov, cnt);
+     56d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     570:	89 75 0c             	mov    %esi,0xc(%ebp)
+     573:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     576:	83 c4 0c             	add    $0xc,%esp
+     579:	5b                   	pop    %ebx
+     57a:	5e                   	pop    %esi
+     57b:	5f                   	pop    %edi
+     57c:	5d                   	pop    %ebp
+  return _writev(fd, iov, cnt);
+     57d:	e9 fe 01 00 00       	jmp    780 <_writev>
+     582:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     589:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000590 <close>:
+{
+     590:	55                   	push   %ebp
+     591:	89 e5                	mov    %esp,%ebp
+     593:	53                   	push   %ebx
+     594:	83 ec 04             	sub    $0x4,%esp
+  if(flushhook)
+     597:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+     59c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(flushhook)
+     59f:	85 c0                	test   %eax,%eax
+     5a1:	74 02                	je     5a5 <close+0x15>
+    flushhook();
+     5a3:	ff d0                	call   *%eax
+  return _close(fd);
+     5a5:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     5a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     5ab:	c9                   	leave
+  return _close(fd);
+     5ac:	e9 c7 00 00 00       	jmp    678 <_close>
+     5b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5bf:	90                   	nop
+
+000005c0 <umtxinit>:
+// process that finds the mutex held enters the kernel, to sleep
+// in futexwait() until the holder's umtxunlock() wakes it.
+
+void
+umtxinit(struct umutex *m)
+{
+     5c0:	55                   	push   %ebp
+     5c1:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+     5c3:	8b 45 08             	mov    0x8(%ebp),%eax
+     5c6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     5cc:	5d                   	pop    %ebp
+     5cd:	c3                   	ret
+     5ce:	66 90                	xchg   %ax,%ax
+
+000005d0 <umtxlock>:
+
+void
+umtxlock(struct umutex *m)
+{
+     5d0:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+     5d1:	b8 01 00 00 00       	mov    $0x1,%eax
+     5d6:	89 e5                	mov    %esp,%ebp
+     5d8:	56                   	push   %esi
+     5d9:	53                   	push   %ebx
+     5da:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     5dd:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 1) == 0)
+     5e0:	85 c0                	test   %eax,%eax
+     5e2:	74 2b                	je     60f <umtxlock+0x3f>
+     5e4:	b8 02 00 00 00       	mov    $0x2,%eax
+     5e9:	f0 87 03             	lock xchg %eax,(%ebx)
+    return;
+  // Mark the mutex contended, so that its holder
+  // wakes a waiter on release, and wait.
+  while(xchg(&m->state, 2) != 0)
+     5ec:	85 c0                	test   %eax,%eax
+     5ee:	74 1f                	je     60f <umtxlock+0x3f>
+     5f0:	be 02 00 00 00       	mov    $0x2,%esi
+     5f5:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwait(&m->state, 2);
+     5f8:	83 ec 08             	sub    $0x8,%esp
+     5fb:	6a 02                	push   $0x2
+     5fd:	53                   	push   %ebx
+     5fe:	e8 85 01 00 00       	call   788 <futexwait>
+     603:	89 f0                	mov    %esi,%eax
+     605:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+     608:	83 c4 10             	add    $0x10,%esp
+     60b:	85 c0                	test   %eax,%eax
+     60d:	75 e9                	jne    5f8 <umtxlock+0x28>
+}
+     60f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     612:	5b                   	pop    %ebx
+     613:	5e                   	pop    %esi
+     614:	5d                   	pop    %ebp
+     615:	c3                   	ret
+     616:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     61d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000620 <umtxunlock>:
+
+void
+umtxunlock(struct umutex *m)
+{
+     620:	55                   	push   %ebp
+     621:	31 c0                	xor    %eax,%eax
+     623:	89 e5                	mov    %esp,%ebp
+     625:	83 ec 08             	sub    $0x8,%esp
+     628:	8b 55 08             	mov    0x8(%ebp),%edx
+     62b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+     62e:	83 f8 02             	cmp    $0x2,%eax
+     631:	74 05                	je     638 <umtxunlock+0x18>
+    futexwake(&m->state, 1);
+}
+     633:	c9                   	leave
+     634:	c3                   	ret
+     635:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwake(&m->state, 1);
+     638:	83 ec 08             	sub    $0x8,%esp
+     63b:	6a 01                	push   $0x1
+     63d:	52                   	push   %edx
+     63e:	e8 4d 01 00 00       	call   790 <futexwake>
+     643:	83 c4 10             	add    $0x10,%esp
+}
+     646:	c9                   	leave
+     647:	c3                   	ret
+
+00000648 <_fork>:
+  _ ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+     648:	b8 01 00 00 00       	mov    $0x1,%eax
+     64d:	cd 40                	int    $0x40
+     64f:	c3                   	ret
+
+00000650 <_exit>:
+RAWSYSCALL(exit)
+     650:	b8 02 00 00 00       	mov    $0x2,%eax
+     655:	cd 40                	int    $0x40
+     657:	c3                   	ret
+
+00000658 <wait>:
+SYSCALL(wait)
+     658:	b8 03 00 00 00       	mov    $0x3,%eax
+     65d:	cd 40                	int    $0x40
+     65f:	c3                   	ret
+
+00000660 <pipe>:
+SYSCALL(pipe)
+     660:	b8 04 00 00 00       	mov    $0x4,%eax
+     665:	cd 40                	int    $0x40
+     667:	c3                   	ret
+
+00000668 <_read>:
+RAWSYSCALL(read)
+     668:	b8 05 00 00 00       	mov    $0x5,%eax
+     66d:	cd 40                	int    $0x40
+     66f:	c3                   	ret
+
+00000670 <_write>:
+RAWSYSCALL(write)
+     670:	b8 10 00 00 00       	mov    $0x10,%eax
+     675:	cd 40                	int    $0x40
+     677:	c3                   	ret
+
+00000678 <_close>:
+RAWSYSCALL(close)
+     678:	b8 15 00 00 00       	mov    $0x15,%eax
+     67d:	cd 40                	int    $0x40
+     67f:	c3                   	ret
+
+00000680 <kill>:
+SYSCALL(kill)
+     680:	b8 06 00 00 00       	mov    $0x6,%eax
+     685:	cd 40                	int    $0x40
+     687:	c3                   	ret
+
+00000688 <_exec>:
+RAWSYSCALL(exec)
+     688:	b8 07 00 00 00       	mov    $0x7,%eax
+     68d:	cd 40                	int    $0x40
+     68f:	c3                   	ret
+
+00000690 <open>:
+SYSCALL(open)
+     690:	b8 0f 00 00 00       	mov    $0xf,%eax
+     695:	cd 40                	int    $0x40
+     697:	c3                   	ret
+
+00000698 <mknod>:
+SYSCALL(mknod)
+     698:	b8 11 00 00 00       	mov    $0x11,%eax
+     69d:	cd 40                	int    $0x40
+     69f:	c3                   	ret
+
+000006a0 <unlink>:
+SYSCALL(unlink)
+     6a0:	b8 12 00 00 00       	mov    $0x12,%eax
+     6a5:	cd 40                	int    $0x40
+     6a7:	c3                   	ret
+
+000006a8 <fstat>:
+SYSCALL(fstat)
+     6a8:	b8 08 00 00 00       	mov    $0x8,%eax
+     6ad:	cd 40                	int    $0x40
+     6af:	c3                   	ret
+
+000006b0 <link>:
+SYSCALL(link)
+     6b0:	b8 13 00 00 00       	mov    $0x13,%eax
+     6b5:	cd 40                	int    $0x40
+     6b7:	c3                   	ret
+
+000006b8 <mkdir>:
+SYSCALL(mkdir)
+     6b8:	b8 14 00 00 00       	mov    $0x14,%eax
+     6bd:	cd 40                	int    $0x40
+     6bf:	c3                   	ret
+
+000006c0 <chdir>:
+SYSCALL(chdir)
+     6c0:	b8 09 00 00 00       	mov    $0x9,%eax
+     6c5:	cd 40                	int    $0x40
+     6c7:	c3                   	ret
+
+000006c8 <dup>:
+SYSCALL(dup)
+     6c8:	b8 0a 00 00 00       	mov    $0xa,%eax
+     6cd:	cd 40                	int    $0x40
+     6cf:	c3                   	ret
+
+000006d0 <getpid>:
+SYSCALL(getpid)
+     6d0:	b8 0b 00 00 00       	mov    $0xb,%eax
+     6d5:	cd 40                	int    $0x40
+     6d7:	c3                   	ret
+
+000006d8 <sbrk>:
+SYSCALL(sbrk)
+     6d8:	b8 0c 00 00 00       	mov    $0xc,%eax
+     6dd:	cd 40                	int    $0x40
+     6df:	c3                   	ret
+
+000006e0 <sleep>:
+SYSCALL(sleep)
+     6e0:	b8 0d 00 00 00       	mov    $0xd,%eax
+     6e5:	cd 40                	int    $0x40
+     6e7:	c3                   	ret
+
+000006e8 <uptime>:
+SYSCALL(uptime)
+     6e8:	b8 0e 00 00 00       	mov    $0xe,%eax
+     6ed:	cd 40                	int    $0x40
+     6ef:	c3                   	ret
+
+000006f0 <wolfie>:
+SYSCALL(wolfie)
+     6f0:	b8 16 00 00 00       	mov    $0x16,%eax
+     6f5:	cd 40                	int    $0x40
+     6f7:	c3                   	ret
+
+000006f8 <nice>:
+SYSCALL(nice)
+     6f8:	b8 17 00 00 00       	mov    $0x17,%eax
+     6fd:	cd 40                	int    $0x40
+     6ff:	c3                   	ret
+
+00000700 <mtxget>:
+SYSCALL(mtxget)
+     700:	b8 18 00 00 00       	mov    $0x18,%eax
+     705:	cd 40                	int    $0x40
+     707:	c3                   	ret
+
+00000708 <mtxrel>:
+SYSCALL(mtxrel)
+     708:	b8 19 00 00 00       	mov    $0x19,%eax
+     70d:	cd 40                	int    $0x40
+     70f:	c3                   	ret
+
+00000710 <mtxacq>:
+SYSCALL(mtxacq)
+     710:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     715:	cd 40                	int    $0x40
+     717:	c3                   	ret
+
+00000718 <mtxdel>:
+SYSCALL(mtxdel)
+     718:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     71d:	cd 40                	int    $0x40
+     71f:	c3                   	ret
+
+00000720 <iostat>:
+SYSCALL(iostat)
+     720:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     725:	cd 40                	int    $0x40
+     727:	c3                   	ret
+
+00000728 <mmap>:
+SYSCALL(mmap)
+     728:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     72d:	cd 40                	int    $0x40
+     72f:	c3                   	ret
+
+00000730 <munmap>:
+SYSCALL(munmap)
+     730:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     735:	cd 40                	int    $0x40
+     737:	c3                   	ret
+
+00000738 <shmget>:
+SYSCALL(shmget)
+     738:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     73d:	cd 40                	int    $0x40
+     73f:	c3                   	ret
+
+00000740 <shmat>:
+SYSCALL(shmat)
+     740:	b8 20 00 00 00       	mov    $0x20,%eax
+     745:	cd 40                	int    $0x40
+     747:	c3                   	ret
+
+00000748 <shmdt>:
+SYSCALL(shmdt)
+     748:	b8 21 00 00 00       	mov    $0x21,%eax
+     74d:	cd 40                	int    $0x40
+     74f:	c3                   	ret
+
+00000750 <shmdel>:
+SYSCALL(shmdel)
+     750:	b8 22 00 00 00       	mov    $0x22,%eax
+     755:	cd 40                	int    $0x40
+     757:	c3                   	ret
+
+00000758 <syscount>:
+SYSCALL(syscount)
+     758:	b8 23 00 00 00       	mov    $0x23,%eax
+     75d:	cd 40                	int    $0x40
+     75f:	c3                   	ret
+
+00000760 <splice>:
+SYSCALL(splice)
+     760:	b8 24 00 00 00       	mov    $0x24,%eax
+     765:	cd 40                	int    $0x40
+     767:	c3                   	ret
+
+00000768 <tee>:
+SYSCALL(tee)
+     768:	b8 25 00 00 00       	mov    $0x25,%eax
+     76d:	cd 40                	int    $0x40
+     76f:	c3                   	ret
+
+00000770 <sendfile>:
+SYSCALL(sendfile)
+     770:	b8 26 00 00 00       	mov    $0x26,%eax
+     775:	cd 40                	int    $0x40
+     777:	c3                   	ret
+
+00000778 <_readv>:
+RAWSYSCALL(readv)
+     778:	b8 27 00 00 00       	mov    $0x27,%eax
+     77d:	cd 40                	int    $0x40
+     77f:	c3                   	ret
+
+00000780 <_writev>:
+RAWSYSCALL(writev)
+     780:	b8 28 00 00 00       	mov    $0x28,%eax
+     785:	cd 40                	int    $0x40
+     787:	c3                   	ret
+
+00000788 <futexwait>:
+SYSCALL(futexwait)
+     788:	b8 29 00 00 00       	mov    $0x29,%eax
+     78d:	cd 40                	int    $0x40
+     78f:	c3                   	ret
+
+00000790 <futexwake>:
+SYSCALL(futexwake)
+     790:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     795:	cd 40                	int    $0x40
+     797:	c3                   	ret
+
+00000798 <lockstat>:
+SYSCALL(lockstat)
+     798:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     79d:	cd 40                	int    $0x40
+     79f:	c3                   	ret
+
+000007a0 <clone>:
+SYSCALL(clone)
+     7a0:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     7a5:	cd 40                	int    $0x40
+     7a7:	c3                   	ret
+
+000007a8 <join>:
+SYSCALL(join)
+     7a8:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     7ad:	cd 40                	int    $0x40
+     7af:	c3                   	ret
+
+000007b0 <stacklimit>:
+SYSCALL(stacklimit)
+     7b0:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     7b5:	cd 40                	int    $0x40
+     7b7:	c3                   	ret
+     7b8:	66 90                	xchg   %ax,%ax
+     7ba:	66 90                	xchg   %ax,%ax
+     7bc:	66 90                	xchg   %ax,%ax
+     7be:	66 90                	xchg   %ax,%ax
+
+000007c0 <flushall>:
+  b->n = 0;
+}
+
+static void
+flushall(void)
+{
+     7c0:	55                   	push   %ebp
+     7c1:	89 e5                	mov    %esp,%ebp
+     7c3:	83 ec 14             	sub    $0x14,%esp
+  umtxlock(&stdoutlock);
+     7c6:	68 14 22 00 00       	push   $0x2214
+     7cb:	e8 00 fe ff ff       	call   5d0 <umtxlock>
+  if(b->n > 0)
+     7d0:	a1 08 20 00 00       	mov    0x2008,%eax
+     7d5:	83 c4 10             	add    $0x10,%esp
+     7d8:	85 c0                	test   %eax,%eax
+     7da:	7e 17                	jle    7f3 <flushall+0x33>
+    _write(b->fd, b->buf, b->n);
+     7dc:	83 ec 04             	sub    $0x4,%esp
+     7df:	50                   	push   %eax
+     7e0:	68 0c 20 00 00       	push   $0x200c
+     7e5:	ff 35 00 20 00 00    	push   0x2000
+     7eb:	e8 80 fe ff ff       	call   670 <_write>
+     7f0:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     7f3:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     7fa:	00 00 00 
+  flush(&stdout);
+  umtxunlock(&stdoutlock);
+     7fd:	83 ec 0c             	sub    $0xc,%esp
+     800:	68 14 22 00 00       	push   $0x2214
+     805:	e8 16 fe ff ff       	call   620 <umtxunlock>
+}
+     80a:	83 c4 10             	add    $0x10,%esp
+     80d:	c9                   	leave
+     80e:	c3                   	ret
+     80f:	90                   	nop
+
+00000810 <printint>:
+    flush(b);
+}
+
+static void
+printint(struct outbuf *b, int xx, int base, int sgn)
+{
+     810:	55                   	push   %ebp
+     811:	89 e5                	mov    %esp,%ebp
+     813:	57                   	push   %edi
+     814:	89 cf                	mov    %ecx,%edi
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     816:	89 d1                	mov    %edx,%ecx
+{
+     818:	56                   	push   %esi
+     819:	53                   	push   %ebx
+     81a:	89 c3                	mov    %eax,%ebx
+     81c:	83 ec 2c             	sub    $0x2c,%esp
+  if(sgn && xx < 0){
+     81f:	85 d2                	test   %edx,%edx
+     821:	0f 89 b9 00 00 00    	jns    8e0 <printint+0xd0>
+     827:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     82b:	0f 84 af 00 00 00    	je     8e0 <printint+0xd0>
+    x = -xx;
+     831:	f7 d9                	neg    %ecx
+    neg = 1;
+     833:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     838:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     83b:	31 f6                	xor    %esi,%esi
+     83d:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     840:	89 c8                	mov    %ecx,%eax
+     842:	31 d2                	xor    %edx,%edx
+     844:	89 f3                	mov    %esi,%ebx
+     846:	f7 f7                	div    %edi
+     848:	8d 76 01             	lea    0x1(%esi),%esi
+     84b:	0f b6 92 a8 14 00 00 	movzbl 0x14a8(%edx),%edx
+     852:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     856:	89 ca                	mov    %ecx,%edx
+     858:	89 c1                	mov    %eax,%ecx
+     85a:	39 fa                	cmp    %edi,%edx
+     85c:	73 e2                	jae    840 <printint+0x30>
+  if(neg)
+     85e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     861:	89 d9                	mov    %ebx,%ecx
+     863:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     866:	85 c0                	test   %eax,%eax
+     868:	74 07                	je     871 <printint+0x61>
+    buf[i++] = '-';
+     86a:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     86f:	89 f1                	mov    %esi,%ecx
+     871:	8d 75 d8             	lea    -0x28(%ebp),%esi
+     874:	89 cf                	mov    %ecx,%edi
+     876:	01 f7                	add    %esi,%edi
+     878:	eb 1a                	jmp    894 <printint+0x84>
+     87a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    *b->str++ = c;
+     880:	8d 48 01             	lea    0x1(%eax),%ecx
+     883:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+     889:	88 10                	mov    %dl,(%eax)
+
+  while(--i >= 0)
+     88b:	8d 47 ff             	lea    -0x1(%edi),%eax
+     88e:	39 fe                	cmp    %edi,%esi
+     890:	74 40                	je     8d2 <printint+0xc2>
+     892:	89 c7                	mov    %eax,%edi
+  if(b->str){
+     894:	8b 83 0c 02 00 00    	mov    0x20c(%ebx),%eax
+    putc(b, buf[i]);
+     89a:	0f b6 17             	movzbl (%edi),%edx
+  if(b->str){
+     89d:	85 c0                	test   %eax,%eax
+     89f:	75 df                	jne    880 <printint+0x70>
+  b->buf[b->n++] = c;
+     8a1:	8b 4b 08             	mov    0x8(%ebx),%ecx
+     8a4:	8d 41 01             	lea    0x1(%ecx),%eax
+     8a7:	89 43 08             	mov    %eax,0x8(%ebx)
+     8aa:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+     8ae:	3d 00 02 00 00       	cmp    $0x200,%eax
+     8b3:	74 3b                	je     8f0 <printint+0xe0>
+     8b5:	80 fa 0a             	cmp    $0xa,%dl
+     8b8:	75 d1                	jne    88b <printint+0x7b>
+     8ba:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+     8be:	75 cb                	jne    88b <printint+0x7b>
+  if(b->n > 0)
+     8c0:	85 c0                	test   %eax,%eax
+     8c2:	7f 2c                	jg     8f0 <printint+0xe0>
+  b->n = 0;
+     8c4:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  while(--i >= 0)
+     8cb:	8d 47 ff             	lea    -0x1(%edi),%eax
+     8ce:	39 fe                	cmp    %edi,%esi
+     8d0:	75 c0                	jne    892 <printint+0x82>
+}
+     8d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     8d5:	5b                   	pop    %ebx
+     8d6:	5e                   	pop    %esi
+     8d7:	5f                   	pop    %edi
+     8d8:	5d                   	pop    %ebp
+     8d9:	c3                   	ret
+     8da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  neg = 0;
+     8e0:	31 c0                	xor    %eax,%eax
+     8e2:	e9 51 ff ff ff       	jmp    838 <printint+0x28>
+     8e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8ee:	66 90                	xchg   %ax,%ax
+    _write(b->fd, b->buf, b->n);
+     8f0:	83 ec 04             	sub    $0x4,%esp
+     8f3:	50                   	push   %eax
+     8f4:	8d 43 0c             	lea    0xc(%ebx),%eax
+     8f7:	50                   	push   %eax
+     8f8:	ff 33                	push   (%ebx)
+     8fa:	e8 71 fd ff ff       	call   670 <_write>
+     8ff:	83 c4 10             	add    $0x10,%esp
+     902:	eb c0                	jmp    8c4 <printint+0xb4>
+     904:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     90b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     90f:	90                   	nop
+
+00000910 <putc>:
+{
+     910:	55                   	push   %ebp
+     911:	89 e5                	mov    %esp,%ebp
+     913:	53                   	push   %ebx
+     914:	89 c3                	mov    %eax,%ebx
+     916:	83 ec 04             	sub    $0x4,%esp
+  if(b->str){
+     919:	8b 80 0c 02 00 00    	mov    0x20c(%eax),%eax
+     91f:	85 c0                	test   %eax,%eax
+     921:	74 15                	je     938 <putc+0x28>
+    *b->str++ = c;
+     923:	8d 48 01             	lea    0x1(%eax),%ecx
+     926:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+     92c:	88 10                	mov    %dl,(%eax)
+}
+     92e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     931:	c9                   	leave
+     932:	c3                   	ret
+     933:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     937:	90                   	nop
+  b->buf[b->n++] = c;
+     938:	8b 4b 08             	mov    0x8(%ebx),%ecx
+     93b:	8d 41 01             	lea    0x1(%ecx),%eax
+     93e:	89 43 08             	mov    %eax,0x8(%ebx)
+     941:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+     945:	3d 00 02 00 00       	cmp    $0x200,%eax
+     94a:	74 14                	je     960 <putc+0x50>
+     94c:	80 fa 0a             	cmp    $0xa,%dl
+     94f:	75 dd                	jne    92e <putc+0x1e>
+     951:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+     955:	75 d7                	jne    92e <putc+0x1e>
+  if(b->n > 0)
+     957:	85 c0                	test   %eax,%eax
+     959:	7e 17                	jle    972 <putc+0x62>
+     95b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     95f:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     960:	83 ec 04             	sub    $0x4,%esp
+     963:	50                   	push   %eax
+     964:	8d 43 0c             	lea    0xc(%ebx),%eax
+     967:	50                   	push   %eax
+     968:	ff 33                	push   (%ebx)
+     96a:	e8 01 fd ff ff       	call   670 <_write>
+     96f:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     972:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+     979:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     97c:	c9                   	leave
+     97d:	c3                   	ret
+     97e:	66 90                	xchg   %ax,%ax
+
+00000980 <format>:
+
+// Format fmt and the arguments at ap into b.
+// Only understands %d, %x, %p, %s, %c.
+static void
+format(struct outbuf *b, const char *fmt, uint *ap)
+{
+     980:	55                   	push   %ebp
+     981:	89 e5                	mov    %esp,%ebp
+     983:	57                   	push   %edi
+     984:	89 c7                	mov    %eax,%edi
+     986:	56                   	push   %esi
+     987:	53                   	push   %ebx
+     988:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+     98b:	0f b6 02             	movzbl (%edx),%eax
+{
+     98e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  for(i = 0; fmt[i]; i++){
+     991:	84 c0                	test   %al,%al
+     993:	74 5a                	je     9ef <format+0x6f>
+     995:	8d 5a 01             	lea    0x1(%edx),%ebx
+     998:	31 f6                	xor    %esi,%esi
+     99a:	eb 1c                	jmp    9b8 <format+0x38>
+     99c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     9a0:	83 f8 25             	cmp    $0x25,%eax
+     9a3:	74 3b                	je     9e0 <format+0x60>
+        state = '%';
+      } else {
+        putc(b, c);
+     9a5:	89 ca                	mov    %ecx,%edx
+     9a7:	89 f8                	mov    %edi,%eax
+     9a9:	e8 62 ff ff ff       	call   910 <putc>
+  for(i = 0; fmt[i]; i++){
+     9ae:	0f b6 03             	movzbl (%ebx),%eax
+     9b1:	83 c3 01             	add    $0x1,%ebx
+     9b4:	84 c0                	test   %al,%al
+     9b6:	74 37                	je     9ef <format+0x6f>
+    c = fmt[i] & 0xff;
+     9b8:	0f be c8             	movsbl %al,%ecx
+     9bb:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     9be:	85 f6                	test   %esi,%esi
+     9c0:	74 de                	je     9a0 <format+0x20>
+      }
+    } else if(state == '%'){
+     9c2:	83 fe 25             	cmp    $0x25,%esi
+     9c5:	75 e7                	jne    9ae <format+0x2e>
+      if(c == 'd'){
+     9c7:	83 f8 25             	cmp    $0x25,%eax
+     9ca:	74 46                	je     a12 <format+0x92>
+     9cc:	83 e8 63             	sub    $0x63,%eax
+     9cf:	83 f8 15             	cmp    $0x15,%eax
+     9d2:	77 2c                	ja     a00 <format+0x80>
+     9d4:	ff 24 85 50 14 00 00 	jmp    *0x1450(,%eax,4)
+     9db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     9df:	90                   	nop
+  for(i = 0; fmt[i]; i++){
+     9e0:	0f b6 03             	movzbl (%ebx),%eax
+     9e3:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+     9e6:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+     9eb:	84 c0                	test   %al,%al
+     9ed:	75 c9                	jne    9b8 <format+0x38>
+        putc(b, c);
+      }
+      state = 0;
+    }
+  }
+}
+     9ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     9f2:	5b                   	pop    %ebx
+     9f3:	5e                   	pop    %esi
+     9f4:	5f                   	pop    %edi
+     9f5:	5d                   	pop    %ebp
+     9f6:	c3                   	ret
+     9f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9fe:	66 90                	xchg   %ax,%ax
+        putc(b, '%');
+     a00:	ba 25 00 00 00       	mov    $0x25,%edx
+     a05:	89 f8                	mov    %edi,%eax
+     a07:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     a0a:	e8 01 ff ff ff       	call   910 <putc>
+        putc(b, c);
+     a0f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     a12:	89 ca                	mov    %ecx,%edx
+     a14:	89 f8                	mov    %edi,%eax
+      state = 0;
+     a16:	31 f6                	xor    %esi,%esi
+        putc(b, c);
+     a18:	e8 f3 fe ff ff       	call   910 <putc>
+     a1d:	eb 8f                	jmp    9ae <format+0x2e>
+     a1f:	90                   	nop
+        printint(b, *ap, 16, 0);
+     a20:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     a23:	83 ec 0c             	sub    $0xc,%esp
+     a26:	b9 10 00 00 00       	mov    $0x10,%ecx
+     a2b:	8b 16                	mov    (%esi),%edx
+     a2d:	6a 00                	push   $0x0
+        ap++;
+     a2f:	83 c6 04             	add    $0x4,%esi
+        printint(b, *ap, 16, 0);
+     a32:	89 f8                	mov    %edi,%eax
+     a34:	e8 d7 fd ff ff       	call   810 <printint>
+        ap++;
+     a39:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+     a3c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     a3f:	31 f6                	xor    %esi,%esi
+     a41:	e9 68 ff ff ff       	jmp    9ae <format+0x2e>
+     a46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a4d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     a50:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     a53:	8b 30                	mov    (%eax),%esi
+        ap++;
+     a55:	83 c0 04             	add    $0x4,%eax
+     a58:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+     a5b:	85 f6                	test   %esi,%esi
+     a5d:	75 1b                	jne    a7a <format+0xfa>
+     a5f:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+     a64:	be 48 14 00 00       	mov    $0x1448,%esi
+     a69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+          putc(b, *s);
+     a70:	89 f8                	mov    %edi,%eax
+          s++;
+     a72:	83 c6 01             	add    $0x1,%esi
+          putc(b, *s);
+     a75:	e8 96 fe ff ff       	call   910 <putc>
+        while(*s != 0){
+     a7a:	0f be 16             	movsbl (%esi),%edx
+     a7d:	84 d2                	test   %dl,%dl
+     a7f:	75 ef                	jne    a70 <format+0xf0>
+      state = 0;
+     a81:	31 f6                	xor    %esi,%esi
+     a83:	e9 26 ff ff ff       	jmp    9ae <format+0x2e>
+     a88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a8f:	90                   	nop
+        printint(b, *ap, 10, 1);
+     a90:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     a93:	83 ec 0c             	sub    $0xc,%esp
+     a96:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     a9b:	8b 16                	mov    (%esi),%edx
+     a9d:	6a 01                	push   $0x1
+     a9f:	eb 8e                	jmp    a2f <format+0xaf>
+     aa1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(b, *ap);
+     aa8:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     aab:	89 f8                	mov    %edi,%eax
+     aad:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+     ab0:	83 c6 04             	add    $0x4,%esi
+        putc(b, *ap);
+     ab3:	e8 58 fe ff ff       	call   910 <putc>
+        ap++;
+     ab8:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      state = 0;
+     abb:	31 f6                	xor    %esi,%esi
+     abd:	e9 ec fe ff ff       	jmp    9ae <format+0x2e>
+     ac2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ac9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000ad0 <fflush>:
+{
+     ad0:	55                   	push   %ebp
+     ad1:	89 e5                	mov    %esp,%ebp
+     ad3:	83 ec 08             	sub    $0x8,%esp
+  if(fd == stdout.fd)
+     ad6:	8b 45 08             	mov    0x8(%ebp),%eax
+     ad9:	39 05 00 20 00 00    	cmp    %eax,0x2000
+     adf:	74 07                	je     ae8 <fflush+0x18>
+}
+     ae1:	c9                   	leave
+     ae2:	c3                   	ret
+     ae3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     ae7:	90                   	nop
+  umtxlock(&stdoutlock);
+     ae8:	83 ec 0c             	sub    $0xc,%esp
+     aeb:	68 14 22 00 00       	push   $0x2214
+     af0:	e8 db fa ff ff       	call   5d0 <umtxlock>
+  if(b->n > 0)
+     af5:	a1 08 20 00 00       	mov    0x2008,%eax
+     afa:	83 c4 10             	add    $0x10,%esp
+     afd:	85 c0                	test   %eax,%eax
+     aff:	7f 1f                	jg     b20 <fflush+0x50>
+  b->n = 0;
+     b01:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     b08:	00 00 00 
+  umtxunlock(&stdoutlock);
+     b0b:	c7 45 08 14 22 00 00 	movl   $0x2214,0x8(%ebp)
+}
+     b12:	c9                   	leave
+  umtxunlock(&stdoutlock);
+     b13:	e9 08 fb ff ff       	jmp    620 <umtxunlock>
+     b18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b1f:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     b20:	83 ec 04             	sub    $0x4,%esp
+     b23:	50                   	push   %eax
+     b24:	68 0c 20 00 00       	push   $0x200c
+     b29:	ff 35 00 20 00 00    	push   0x2000
+     b2f:	e8 3c fb ff ff       	call   670 <_write>
+     b34:	83 c4 10             	add    $0x10,%esp
+     b37:	eb c8                	jmp    b01 <fflush+0x31>
+     b39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000b40 <setvbuf>:
+{
+     b40:	55                   	push   %ebp
+     b41:	89 e5                	mov    %esp,%ebp
+     b43:	53                   	push   %ebx
+     b44:	83 ec 04             	sub    $0x4,%esp
+     b47:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd != stdout.fd)
+     b4a:	8b 45 08             	mov    0x8(%ebp),%eax
+     b4d:	39 05 00 20 00 00    	cmp    %eax,0x2000
+     b53:	74 0b                	je     b60 <setvbuf+0x20>
+}
+     b55:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     b58:	c9                   	leave
+     b59:	c3                   	ret
+     b5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  umtxlock(&stdoutlock);
+     b60:	83 ec 0c             	sub    $0xc,%esp
+     b63:	68 14 22 00 00       	push   $0x2214
+     b68:	e8 63 fa ff ff       	call   5d0 <umtxlock>
+  if(b->n > 0)
+     b6d:	a1 08 20 00 00       	mov    0x2008,%eax
+     b72:	83 c4 10             	add    $0x10,%esp
+     b75:	85 c0                	test   %eax,%eax
+     b77:	7f 2f                	jg     ba8 <setvbuf+0x68>
+  b->n = 0;
+     b79:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     b80:	00 00 00 
+  stdout.mode = mode;
+     b83:	89 1d 04 20 00 00    	mov    %ebx,0x2004
+  flushhook = flushall;
+     b89:	c7 05 10 22 00 00 c0 	movl   $0x7c0,0x2210
+     b90:	07 00 00 
+}
+     b93:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&stdoutlock);
+     b96:	c7 45 08 14 22 00 00 	movl   $0x2214,0x8(%ebp)
+}
+     b9d:	c9                   	leave
+  umtxunlock(&stdoutlock);
+     b9e:	e9 7d fa ff ff       	jmp    620 <umtxunlock>
+     ba3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     ba7:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     ba8:	83 ec 04             	sub    $0x4,%esp
+     bab:	50                   	push   %eax
+     bac:	68 0c 20 00 00       	push   $0x200c
+     bb1:	ff 35 00 20 00 00    	push   0x2000
+     bb7:	e8 b4 fa ff ff       	call   670 <_write>
+     bbc:	83 c4 10             	add    $0x10,%esp
+     bbf:	eb b8                	jmp    b79 <setvbuf+0x39>
+     bc1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bcf:	90                   	nop
+
+00000bd0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s, %c.
+void
+printf(int fd, const char *fmt, ...)
+{
+     bd0:	55                   	push   %ebp
+     bd1:	89 e5                	mov    %esp,%ebp
+     bd3:	53                   	push   %ebx
+     bd4:	81 ec 14 02 00 00    	sub    $0x214,%esp
+     bda:	8b 45 08             	mov    0x8(%ebp),%eax
+    local.mode = _IONBF;
+    local.n = 0;
+    local.str = 0;
+    b = &local;
+  }
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     bdd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd == stdout.fd){
+     be0:	39 05 00 20 00 00    	cmp    %eax,0x2000
+     be6:	74 48                	je     c30 <printf+0x60>
+    local.fd = fd;
+     be8:	89 85 e8 fd ff ff    	mov    %eax,-0x218(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     bee:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     bf1:	89 da                	mov    %ebx,%edx
+     bf3:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+    local.mode = _IONBF;
+     bf9:	c7 85 ec fd ff ff 03 	movl   $0x3,-0x214(%ebp)
+     c00:	00 00 00 
+    local.n = 0;
+     c03:	c7 85 f0 fd ff ff 00 	movl   $0x0,-0x210(%ebp)
+     c0a:	00 00 00 
+    local.str = 0;
+     c0d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     c14:	e8 67 fd ff ff       	call   980 <format>
+  if(b->mode == _IONBF)
+     c19:	83 bd ec fd ff ff 03 	cmpl   $0x3,-0x214(%ebp)
+     c20:	0f 84 a2 00 00 00    	je     cc8 <printf+0xf8>
+    flush(b);
+  if(b == &stdout)
+    umtxunlock(&stdoutlock);
+}
+     c26:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     c29:	c9                   	leave
+     c2a:	c3                   	ret
+     c2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c2f:	90                   	nop
+    umtxlock(&stdoutlock);
+     c30:	83 ec 0c             	sub    $0xc,%esp
+     c33:	68 14 22 00 00       	push   $0x2214
+     c38:	e8 93 f9 ff ff       	call   5d0 <umtxlock>
+  if(stdout.mode == 0){
+     c3d:	a1 04 20 00 00       	mov    0x2004,%eax
+     c42:	83 c4 10             	add    $0x10,%esp
+     c45:	85 c0                	test   %eax,%eax
+     c47:	74 37                	je     c80 <printf+0xb0>
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     c49:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     c4c:	89 da                	mov    %ebx,%edx
+     c4e:	b8 00 20 00 00       	mov    $0x2000,%eax
+     c53:	e8 28 fd ff ff       	call   980 <format>
+  if(b->mode == _IONBF)
+     c58:	83 3d 04 20 00 00 03 	cmpl   $0x3,0x2004
+     c5f:	0f 84 ab 00 00 00    	je     d10 <printf+0x140>
+    umtxunlock(&stdoutlock);
+     c65:	83 ec 0c             	sub    $0xc,%esp
+     c68:	68 14 22 00 00       	push   $0x2214
+     c6d:	e8 ae f9 ff ff       	call   620 <umtxunlock>
+}
+     c72:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    umtxunlock(&stdoutlock);
+     c75:	83 c4 10             	add    $0x10,%esp
+}
+     c78:	c9                   	leave
+     c79:	c3                   	ret
+     c7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+     c80:	83 ec 08             	sub    $0x8,%esp
+     c83:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+     c89:	50                   	push   %eax
+     c8a:	ff 35 00 20 00 00    	push   0x2000
+     c90:	e8 13 fa ff ff       	call   6a8 <fstat>
+     c95:	83 c4 10             	add    $0x10,%esp
+     c98:	89 c2                	mov    %eax,%edx
+      stdout.mode = _IOFBF;
+     c9a:	b8 01 00 00 00       	mov    $0x1,%eax
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+     c9f:	85 d2                	test   %edx,%edx
+     ca1:	75 10                	jne    cb3 <printf+0xe3>
+      stdout.mode = _IOLBF;
+     ca3:	31 c0                	xor    %eax,%eax
+     ca5:	66 83 bd e8 fd ff ff 	cmpw   $0x3,-0x218(%ebp)
+     cac:	03 
+     cad:	0f 94 c0             	sete   %al
+     cb0:	83 c0 01             	add    $0x1,%eax
+     cb3:	a3 04 20 00 00       	mov    %eax,0x2004
+    flushhook = flushall;
+     cb8:	c7 05 10 22 00 00 c0 	movl   $0x7c0,0x2210
+     cbf:	07 00 00 
+     cc2:	eb 85                	jmp    c49 <printf+0x79>
+     cc4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(b->n > 0)
+     cc8:	8b 85 f0 fd ff ff    	mov    -0x210(%ebp),%eax
+     cce:	85 c0                	test   %eax,%eax
+     cd0:	0f 8e 50 ff ff ff    	jle    c26 <printf+0x56>
+    b = &local;
+     cd6:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+    _write(b->fd, b->buf, b->n);
+     cdc:	83 ec 04             	sub    $0x4,%esp
+     cdf:	50                   	push   %eax
+     ce0:	8d 43 0c             	lea    0xc(%ebx),%eax
+     ce3:	50                   	push   %eax
+     ce4:	ff 33                	push   (%ebx)
+     ce6:	e8 85 f9 ff ff       	call   670 <_write>
+  b->n = 0;
+     ceb:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  if(b == &stdout)
+     cf2:	83 c4 10             	add    $0x10,%esp
+     cf5:	81 fb 00 20 00 00    	cmp    $0x2000,%ebx
+     cfb:	0f 85 25 ff ff ff    	jne    c26 <printf+0x56>
+     d01:	e9 5f ff ff ff       	jmp    c65 <printf+0x95>
+     d06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d0d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(b->n > 0)
+     d10:	a1 08 20 00 00       	mov    0x2008,%eax
+    b = getstdout();
+     d15:	bb 00 20 00 00       	mov    $0x2000,%ebx
+  if(b->n > 0)
+     d1a:	85 c0                	test   %eax,%eax
+     d1c:	7f be                	jg     cdc <printf+0x10c>
+  b->n = 0;
+     d1e:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     d25:	00 00 00 
+  if(b == &stdout)
+     d28:	e9 38 ff ff ff       	jmp    c65 <printf+0x95>
+     d2d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000d30 <sprintf>:
+
+// Print to the given buffer. Only understands %d, %x, %p, %s, %c.
+int
+sprintf(char *str, const char *fmt, ...)
+{
+     d30:	55                   	push   %ebp
+     d31:	89 e5                	mov    %esp,%ebp
+     d33:	53                   	push   %ebx
+  struct outbuf b;
+
+  b.str = str;
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+     d34:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+     d3a:	8d 4d 10             	lea    0x10(%ebp),%ecx
+{
+     d3d:	81 ec 14 02 00 00    	sub    $0x214,%esp
+     d43:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+     d46:	8b 55 0c             	mov    0xc(%ebp),%edx
+  b.str = str;
+     d49:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+     d4c:	e8 2f fc ff ff       	call   980 <format>
+  *b.str = '\0';
+     d51:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d54:	c6 00 00             	movb   $0x0,(%eax)
+  return b.str - str;
+     d57:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d5a:	29 d8                	sub    %ebx,%eax
+}
+     d5c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     d5f:	c9                   	leave
+     d60:	c3                   	ret
+     d61:	66 90                	xchg   %ax,%ax
+     d63:	66 90                	xchg   %ax,%ax
+     d65:	66 90                	xchg   %ax,%ax
+     d67:	66 90                	xchg   %ax,%ax
+     d69:	66 90                	xchg   %ax,%ax
+     d6b:	66 90                	xchg   %ax,%ax
+     d6d:	66 90                	xchg   %ax,%ax
+     d6f:	90                   	nop
+
+00000d70 <freeblock>:
+static Header *freep;
+static struct umutex lock;  // threads made by clone() share the heap
+
+static void
+freeblock(void *ap)
+{
+     d70:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+     d71:	8d 48 f8             	lea    -0x8(%eax),%ecx
+{
+     d74:	89 e5                	mov    %esp,%ebp
+     d76:	57                   	push   %edi
+     d77:	56                   	push   %esi
+     d78:	53                   	push   %ebx
+     d79:	89 c3                	mov    %eax,%ebx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     d7b:	a1 1c 22 00 00       	mov    0x221c,%eax
+     d80:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     d82:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     d84:	39 ca                	cmp    %ecx,%edx
+     d86:	73 30                	jae    db8 <freeblock+0x48>
+     d88:	39 c1                	cmp    %eax,%ecx
+     d8a:	72 04                	jb     d90 <freeblock+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     d8c:	39 c2                	cmp    %eax,%edx
+     d8e:	72 f0                	jb     d80 <freeblock+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     d90:	8b 73 fc             	mov    -0x4(%ebx),%esi
+     d93:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+     d96:	39 f8                	cmp    %edi,%eax
+     d98:	74 26                	je     dc0 <freeblock+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+     d9a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+     d9d:	8b 42 04             	mov    0x4(%edx),%eax
+     da0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     da3:	39 f1                	cmp    %esi,%ecx
+     da5:	74 30                	je     dd7 <freeblock+0x67>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+     da7:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+     da9:	5b                   	pop    %ebx
+  freep = p;
+     daa:	89 15 1c 22 00 00    	mov    %edx,0x221c
+}
+     db0:	5e                   	pop    %esi
+     db1:	5f                   	pop    %edi
+     db2:	5d                   	pop    %ebp
+     db3:	c3                   	ret
+     db4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     db8:	39 c1                	cmp    %eax,%ecx
+     dba:	72 d0                	jb     d8c <freeblock+0x1c>
+     dbc:	eb c2                	jmp    d80 <freeblock+0x10>
+     dbe:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+     dc0:	03 70 04             	add    0x4(%eax),%esi
+     dc3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     dc6:	8b 02                	mov    (%edx),%eax
+     dc8:	8b 00                	mov    (%eax),%eax
+     dca:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+     dcd:	8b 42 04             	mov    0x4(%edx),%eax
+     dd0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     dd3:	39 f1                	cmp    %esi,%ecx
+     dd5:	75 d0                	jne    da7 <freeblock+0x37>
+    p->s.size += bp->s.size;
+     dd7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+     dda:	89 15 1c 22 00 00    	mov    %edx,0x221c
+    p->s.size += bp->s.size;
+     de0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+     de3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+     de6:	89 0a                	mov    %ecx,(%edx)
+}
+     de8:	5b                   	pop    %ebx
+     de9:	5e                   	pop    %esi
+     dea:	5f                   	pop    %edi
+     deb:	5d                   	pop    %ebp
+     dec:	c3                   	ret
+     ded:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000df0 <free>:
+
+void
+free(void *ap)
+{
+     df0:	55                   	push   %ebp
+     df1:	89 e5                	mov    %esp,%ebp
+     df3:	53                   	push   %ebx
+     df4:	83 ec 10             	sub    $0x10,%esp
+     df7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  umtxlock(&lock);
+     dfa:	68 18 22 00 00       	push   $0x2218
+     dff:	e8 cc f7 ff ff       	call   5d0 <umtxlock>
+  freeblock(ap);
+     e04:	89 d8                	mov    %ebx,%eax
+     e06:	e8 65 ff ff ff       	call   d70 <freeblock>
+  umtxunlock(&lock);
+     e0b:	c7 45 08 18 22 00 00 	movl   $0x2218,0x8(%ebp)
+}
+     e12:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&lock);
+     e15:	83 c4 10             	add    $0x10,%esp
+}
+     e18:	c9                   	leave
+  umtxunlock(&lock);
+     e19:	e9 02 f8 ff ff       	jmp    620 <umtxunlock>
+     e1e:	66 90                	xchg   %ax,%ax
+
+00000e20 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+     e20:	55                   	push   %ebp
+     e21:	89 e5                	mov    %esp,%ebp
+     e23:	57                   	push   %edi
+     e24:	56                   	push   %esi
+     e25:	53                   	push   %ebx
+     e26:	83 ec 28             	sub    $0x28,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     e29:	8b 45 08             	mov    0x8(%ebp),%eax
+  umtxlock(&lock);
+     e2c:	68 18 22 00 00       	push   $0x2218
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     e31:	8d 48 07             	lea    0x7(%eax),%ecx
+     e34:	c1 e9 03             	shr    $0x3,%ecx
+     e37:	8d 71 01             	lea    0x1(%ecx),%esi
+  umtxlock(&lock);
+     e3a:	e8 91 f7 ff ff       	call   5d0 <umtxlock>
+  if((prevp = freep) == 0){
+     e3f:	8b 15 1c 22 00 00    	mov    0x221c,%edx
+     e45:	83 c4 10             	add    $0x10,%esp
+     e48:	85 d2                	test   %edx,%edx
+     e4a:	0f 84 b0 00 00 00    	je     f00 <malloc+0xe0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     e50:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+     e52:	8b 47 04             	mov    0x4(%edi),%eax
+     e55:	39 f0                	cmp    %esi,%eax
+     e57:	73 6f                	jae    ec8 <malloc+0xa8>
+  if(nu < 4096)
+     e59:	bb 00 10 00 00       	mov    $0x1000,%ebx
+     e5e:	39 de                	cmp    %ebx,%esi
+     e60:	0f 43 de             	cmovae %esi,%ebx
+  p = sbrk(nu * sizeof(Header));
+     e63:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+     e6a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     e6d:	eb 0a                	jmp    e79 <malloc+0x59>
+     e6f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     e70:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+     e72:	8b 47 04             	mov    0x4(%edi),%eax
+     e75:	39 f0                	cmp    %esi,%eax
+     e77:	73 4f                	jae    ec8 <malloc+0xa8>
+      }
+      freep = prevp;
+      umtxunlock(&lock);
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+     e79:	89 fa                	mov    %edi,%edx
+     e7b:	39 3d 1c 22 00 00    	cmp    %edi,0x221c
+     e81:	75 ed                	jne    e70 <malloc+0x50>
+  p = sbrk(nu * sizeof(Header));
+     e83:	83 ec 0c             	sub    $0xc,%esp
+     e86:	ff 75 e4             	push   -0x1c(%ebp)
+     e89:	e8 4a f8 ff ff       	call   6d8 <sbrk>
+  if(p == (char*)-1)
+     e8e:	83 c4 10             	add    $0x10,%esp
+     e91:	83 f8 ff             	cmp    $0xffffffff,%eax
+     e94:	74 15                	je     eab <malloc+0x8b>
+  hp->s.size = nu;
+     e96:	89 58 04             	mov    %ebx,0x4(%eax)
+  freeblock((void*)(hp + 1));
+     e99:	83 c0 08             	add    $0x8,%eax
+     e9c:	e8 cf fe ff ff       	call   d70 <freeblock>
+  return freep;
+     ea1:	8b 15 1c 22 00 00    	mov    0x221c,%edx
+      if((p = morecore(nunits)) == 0){
+     ea7:	85 d2                	test   %edx,%edx
+     ea9:	75 c5                	jne    e70 <malloc+0x50>
+        umtxunlock(&lock);
+     eab:	83 ec 0c             	sub    $0xc,%esp
+     eae:	68 18 22 00 00       	push   $0x2218
+     eb3:	e8 68 f7 ff ff       	call   620 <umtxunlock>
+        return 0;
+     eb8:	83 c4 10             	add    $0x10,%esp
+      }
+  }
+}
+     ebb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+     ebe:	31 c0                	xor    %eax,%eax
+}
+     ec0:	5b                   	pop    %ebx
+     ec1:	5e                   	pop    %esi
+     ec2:	5f                   	pop    %edi
+     ec3:	5d                   	pop    %ebp
+     ec4:	c3                   	ret
+     ec5:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+     ec8:	39 c6                	cmp    %eax,%esi
+     eca:	74 64                	je     f30 <malloc+0x110>
+        p->s.size -= nunits;
+     ecc:	29 f0                	sub    %esi,%eax
+     ece:	89 47 04             	mov    %eax,0x4(%edi)
+        p += p->s.size;
+     ed1:	8d 3c c7             	lea    (%edi,%eax,8),%edi
+        p->s.size = nunits;
+     ed4:	89 77 04             	mov    %esi,0x4(%edi)
+      umtxunlock(&lock);
+     ed7:	83 ec 0c             	sub    $0xc,%esp
+      freep = prevp;
+     eda:	89 15 1c 22 00 00    	mov    %edx,0x221c
+      umtxunlock(&lock);
+     ee0:	68 18 22 00 00       	push   $0x2218
+     ee5:	e8 36 f7 ff ff       	call   620 <umtxunlock>
+      return (void*)(p + 1);
+     eea:	83 c4 10             	add    $0x10,%esp
+}
+     eed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+     ef0:	8d 47 08             	lea    0x8(%edi),%eax
+}
+     ef3:	5b                   	pop    %ebx
+     ef4:	5e                   	pop    %esi
+     ef5:	5f                   	pop    %edi
+     ef6:	5d                   	pop    %ebp
+     ef7:	c3                   	ret
+     ef8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     eff:	90                   	nop
+    base.s.ptr = freep = prevp = &base;
+     f00:	c7 05 1c 22 00 00 20 	movl   $0x2220,0x221c
+     f07:	22 00 00 
+    base.s.size = 0;
+     f0a:	bf 20 22 00 00       	mov    $0x2220,%edi
+    base.s.ptr = freep = prevp = &base;
+     f0f:	c7 05 20 22 00 00 20 	movl   $0x2220,0x2220
+     f16:	22 00 00 
+    base.s.size = 0;
+     f19:	c7 05 24 22 00 00 00 	movl   $0x0,0x2224
+     f20:	00 00 00 
+    if(p->s.size >= nunits){
+     f23:	e9 31 ff ff ff       	jmp    e59 <malloc+0x39>
+     f28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f2f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+     f30:	8b 07                	mov    (%edi),%eax
+     f32:	89 02                	mov    %eax,(%edx)
+     f34:	eb a1                	jmp    ed7 <malloc+0xb7>
+     f36:	66 90                	xchg   %ax,%ax
+     f38:	66 90                	xchg   %ax,%ax
+     f3a:	66 90                	xchg   %ax,%ax
+     f3c:	66 90                	xchg   %ax,%ax
+     f3e:	66 90                	xchg   %ax,%ax
+
+00000f40 <threadstart>:
+
+#define TSTACKSZ 4096
+
+static void
+threadstart(void *fn, void *arg)
+{
+     f40:	55                   	push   %ebp
+     f41:	89 e5                	mov    %esp,%ebp
+     f43:	83 ec 14             	sub    $0x14,%esp
+  ((void (*)(void*))fn)(arg);
+     f46:	ff 75 0c             	push   0xc(%ebp)
+     f49:	ff 55 08             	call   *0x8(%ebp)
+  exit();
+     f4c:	e8 ef f4 ff ff       	call   440 <exit>
+     f51:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f5f:	90                   	nop
+
+00000f60 <thread_create>:
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+     f60:	55                   	push   %ebp
+     f61:	89 e5                	mov    %esp,%ebp
+     f63:	53                   	push   %ebx
+     f64:	83 ec 20             	sub    $0x20,%esp
+  char *mem, *stack;
+  int pid;
+
+  if((mem = malloc(2*TSTACKSZ)) == 0)
+     f67:	68 00 20 00 00       	push   $0x2000
+     f6c:	e8 af fe ff ff       	call   e20 <malloc>
+     f71:	83 c4 10             	add    $0x10,%esp
+     f74:	85 c0                	test   %eax,%eax
+     f76:	74 47                	je     fbf <thread_create+0x5f>
+     f78:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)(((uint)mem + TSTACKSZ - 1) & ~(TSTACKSZ - 1));
+     f7a:	8d 80 ff 0f 00 00    	lea    0xfff(%eax),%eax
+     f80:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  *(char**)stack = mem;
+     f85:	89 18                	mov    %ebx,(%eax)
+  if((pid = clone(threadstart, (void*)fn, arg, stack)) < 0)
+     f87:	50                   	push   %eax
+     f88:	ff 75 0c             	push   0xc(%ebp)
+     f8b:	ff 75 08             	push   0x8(%ebp)
+     f8e:	68 40 0f 00 00       	push   $0xf40
+     f93:	e8 08 f8 ff ff       	call   7a0 <clone>
+     f98:	83 c4 10             	add    $0x10,%esp
+     f9b:	85 c0                	test   %eax,%eax
+     f9d:	78 09                	js     fa8 <thread_create+0x48>
+    free(mem);
+  return pid;
+}
+     f9f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     fa2:	c9                   	leave
+     fa3:	c3                   	ret
+     fa4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    free(mem);
+     fa8:	83 ec 0c             	sub    $0xc,%esp
+     fab:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     fae:	53                   	push   %ebx
+     faf:	e8 3c fe ff ff       	call   df0 <free>
+     fb4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     fb7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+     fba:	83 c4 10             	add    $0x10,%esp
+}
+     fbd:	c9                   	leave
+     fbe:	c3                   	ret
+    return -1;
+     fbf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     fc4:	eb d9                	jmp    f9f <thread_create+0x3f>
+     fc6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fcd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000fd0 <thread_join>:
+
+int
+thread_join(void)
+{
+     fd0:	55                   	push   %ebp
+     fd1:	89 e5                	mov    %esp,%ebp
+     fd3:	83 ec 34             	sub    $0x34,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+     fd6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+     fd9:	50                   	push   %eax
+     fda:	e8 c9 f7 ff ff       	call   7a8 <join>
+     fdf:	83 c4 10             	add    $0x10,%esp
+     fe2:	85 c0                	test   %eax,%eax
+     fe4:	79 0a                	jns    ff0 <thread_join+0x20>
+    free(*(char**)stack);
+  return pid;
+}
+     fe6:	c9                   	leave
+     fe7:	c3                   	ret
+     fe8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fef:	90                   	nop
+    free(*(char**)stack);
+     ff0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     ff3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     ff6:	83 ec 0c             	sub    $0xc,%esp
+     ff9:	ff 32                	push   (%edx)
+     ffb:	e8 f0 fd ff ff       	call   df0 <free>
+    1000:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1003:	83 c4 10             	add    $0x10,%esp
+}
+    1006:	c9                   	leave
+    1007:	c3                   	ret
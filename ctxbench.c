@@ -0,0 +1,56 @@
+// Context switch cost: two processes bounce a byte back and
+// forth through a pair of pipes, so that every round trip
+// switches from one process to the other and back.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+#define NROUND 20000
+
+int
+pingpong(void)
+{
+  int ab[2], ba[2], i, t0;
+  char c;
+
+  if(pipe(ab) < 0 || pipe(ba) < 0){
+    printf(1, "ctxbench: pipe failed\n");
+    exit();
+  }
+  t0 = uptime();
+  if(fork() == 0){
+    for(i = 0; i < NROUND; i++){
+      if(read(ab[0], &c, 1) != 1)
+        break;
+      write(ba[1], &c, 1);
+    }
+    exit();
+  }
+  c = 0;
+  for(i = 0; i < NROUND; i++){
+    write(ab[1], &c, 1);
+    if(read(ba[0], &c, 1) != 1){
+      printf(1, "ctxbench: read failed\n");
+      exit();
+    }
+  }
+  wait();
+  t0 = uptime() - t0;
+  close(ab[0]);
+  close(ab[1]);
+  close(ba[0]);
+  close(ba[1]);
+  return t0;
+}
+
+int
+main(int argc, char *argv[])
+{
+  int t;
+
+  t = pingpong();
+  printf(1, "ctxbench: %d pipe round trips (%d context switches): %d ticks\n",
+         NROUND, 2*NROUND, t);
+  exit();
+}
@@ -1,14 +1,22 @@
 struct buf;
 struct context;
 struct file;
+struct files;
 struct inode;
+struct iostat;
+struct iovec;
+struct lockstat;
+struct page;
 struct pipe;
 struct proc;
 struct rtcdate;
 struct spinlock;
 struct sleeplock;
 struct stat;
+struct shm;
 struct superblock;
+struct vm;
+struct vma;
 
 // bio.c
 void            binit(void);
@@ -22,6 +30,9 @@ void            cprintf(char*, ...);
 void            consoleintr(int(*)(void));
 void            panic(char*) __attribute__((noreturn));
 
+// copyuser.S
+uint            copyuser(void*, const void*, uint);
+
 // exec.c
 int             exec(char*, char**);
 
@@ -33,17 +44,31 @@ void            fileinit(void);
 int             fileread(struct file*, char*, int n);
 int             filestat(struct file*, struct stat*);
 int             filewrite(struct file*, char*, int n);
+int             filesplice(struct file*, struct file*, int n);
+int             filetee(struct file*, struct file*, int n);
+int             filecopy(struct file*, struct file*, int n);
+int             filereadv(struct file*, struct iovec*, int);
+int             filewritev(struct file*, struct iovec*, int);
+struct files*   filesalloc(struct inode*);
+struct files*   filescopy(struct files*);
+struct files*   filesdup(struct files*);
+void            filesput(struct files*);
+struct file*    fdget(int);
+void            fdput(struct proc*);
 
 // fs.c
 void            readsb(int dev, struct superblock *sb);
 int             dirlink(struct inode*, char*, uint);
 struct inode*   dirlookup(struct inode*, char*, uint*);
-struct inode*   ialloc(uint, short);
+struct inode*   ialloc(uint, short, uint);
 struct inode*   idup(struct inode*);
+struct page*    igetpage(struct inode*, uint);
 void            iinit(int dev);
 void            ilock(struct inode*);
+void            ilockshared(struct inode*);
 void            iput(struct inode*);
 void            iunlock(struct inode*);
+void            iunlockshared(struct inode*);
 void            iunlockput(struct inode*);
 void            iupdate(struct inode*);
 int             namecmp(const char*, const char*);
@@ -57,6 +82,7 @@ int             writei(struct inode*, char*, uint, uint);
 void            ideinit(void);
 void            ideintr(void);
 void            iderw(struct buf*);
+void            ideiostat(struct iostat*);
 
 // ioapic.c
 void            ioapicenable(int irq, int cpu);
@@ -65,7 +91,12 @@ void            ioapicinit(void);
 
 // kalloc.c
 char*           kalloc(void);
+char*           kalloclarge(void);
 void            kfree(char*);
+void            kfreelarge(char*);
+char*           kzalloc(void);
+int             kzero(void);
+void            kmemstat(struct iostat*);
 void            kinit1(void*, void*);
 void            kinit2(void*, void*);
 
@@ -78,6 +109,9 @@ int             lapicid(void);
 extern volatile uint*    lapic;
 void            lapiceoi(void);
 void            lapicinit(void);
+void            lapicipi(int, int);
+int             lapicstarttick(void);
+void            lapicstoptick(void);
 void            lapicstartap(uchar, uint);
 void            microdelay(int);
 
@@ -86,6 +120,20 @@ void            initlog(int dev);
 void            log_write(struct buf*);
 void            begin_op();
 void            end_op();
+void            begin_opn(int);
+void            end_opn(int);
+
+// mmap.c
+struct vma*     vmalookup(struct proc*, uint);
+struct vma*     vmaoverlap(struct proc*, uint, uint);
+int             vmafault(struct proc*, uint, int);
+int             vmaload(struct proc*, uint, uint);
+int             vmamap(struct proc*, struct file*, uint, int, int, uint);
+int             vmatext(struct vm*, pde_t*, struct inode*, uint, uint, uint);
+int             vmashm(struct proc*, struct shm*, uint);
+int             vmaunmap(struct proc*, uint, uint);
+int             vmacopy(struct proc*, struct proc*);
+void            vmafree(struct vm*);
 
 // mp.c
 extern int      ismp;
@@ -99,14 +147,35 @@ void            picinit(void);
 int             pipealloc(struct file**, struct file**);
 void            pipeclose(struct pipe*, int);
 int             piperead(struct pipe*, char*, int);
+int             pipepeek(struct pipe*, char*, int);
 int             pipewrite(struct pipe*, char*, int);
+int             pipereadv(struct pipe*, struct iovec*, int);
+int             pipewritev(struct pipe*, struct iovec*, int);
+
+// pcache.c
+void            pcinit(void);
+struct page*    pcget(uint, uint, uint);
+int             pcfill(struct page*);
+void            pcfilled(struct page*);
+void            pcput(struct page*);
+struct page*    pcframe(uint, uint, uint, char*);
+void            pctext(struct page*, int);
+void            pcshared(struct page*, int);
+void            pcwrite(uint, uint, char*, uint, uint);
+void            pcinval(uint, uint);
+int             pcreclaim(void);
+void            pcstat(struct iostat*);
 
 //PAGEBREAK: 16
 // proc.c
+struct vm*      allocvm(void);
+int             clone(uint, uint, uint, uint);
 int             cpuid(void);
 void            exit(void);
 int             fork(void);
 int             growproc(int);
+int             growstack(uint);
+int             stacklimit(int, int);
 int             kill(int);
 int             nice(int, int);
 struct cpu*     mycpu(void);
@@ -119,6 +188,15 @@ void            changeprocstate(struct proc*, int);
 void            setproc(struct proc*);
 void            sleep(void*, struct spinlock*);
 void            userinit(void);
+int             join(uint*);
+void            pin(uint, uint);
+void            unpin(struct proc*);
+void            vmlock(struct vm*);
+int             vmpinned(struct vm*, uint, uint);
+void            vmput(struct vm*);
+int             vmsole(void);
+struct vm*      vmtrylock(int, int*);
+void            vmunlock(struct vm*);
 int             wait(void);
 void            wakeup(void*);
 void            yield(void);
@@ -126,6 +204,30 @@ int             mtxget(void);
 int             mtxacq(int n);
 int             mtxrel(int n);
 int             mtxdel(int n);
+void            mtxexit(struct proc*);
+int             futexwait(uint, int);
+int             futexwake(uint, int);
+
+// shm.c
+void            shminit(void);
+int             shmget(int, uint);
+int             shmat(int);
+int             shmdt(uint);
+int             shmdel(int);
+char*           shmpage(struct shm*, uint);
+void            shmdup(struct shm*);
+void            shmput(struct shm*);
+
+// swap.c
+int             swapdup(pde_t*, uint, pte_t);
+int             swapfault(struct vm*, uint, int);
+void            swapfree(pte_t);
+int             swapin(struct vm*, uint);
+void            swapinit(int);
+int             swapload(struct vm*, uint, uint);
+void            swapstat(struct iostat*);
+char*           ualloc(void);
+char*           uzalloc(void);
 
 // swtch.S
 void            swtch(struct context**, struct context*);
@@ -135,6 +237,8 @@ void            acquire(struct spinlock*);
 void            getcallerpcs(void*, uint*);
 int             holding(struct spinlock*);
 void            initlock(struct spinlock*, char*);
+int             lockstat(int, struct lockstat*);
+void            lockwaited(struct spinlock*, int);
 void            release(struct spinlock*);
 void            pushcli(void);
 void            popcli(void);
@@ -142,6 +246,8 @@ void            popcli(void);
 // sleeplock.c
 void            acquiresleep(struct sleeplock*);
 void            releasesleep(struct sleeplock*);
+void            acquiresleepshared(struct sleeplock*);
+void            releasesleepshared(struct sleeplock*);
 int             holdingsleep(struct sleeplock*);
 void            initsleeplock(struct sleeplock*, char*);
 
@@ -157,9 +263,12 @@ char*           strncpy(char*, const char*, int);
 // syscall.c
 int             argint(int, int*);
 int             argptr(int, char**, int);
-int             argstr(int, char**);
+int             argstr(int, char*, int);
+int             checkptr(uint, int);
+int             fetchbuf(uint, void*, int);
 int             fetchint(uint, int*);
-int             fetchstr(uint, char**);
+int             fetchstr(uint, char*, int);
+int             putbuf(uint, void*, int);
 void            syscall(void);
 
 // timer.c
@@ -168,6 +277,7 @@ void            timerinit(void);
 // trap.c
 void            idtinit(void);
 extern uint     ticks;
+extern uint     npgfault;
 void            tvinit(void);
 extern struct spinlock tickslock;
 
@@ -183,14 +293,22 @@ pde_t*          setupkvm(void);
 char*           uva2ka(pde_t*, char*);
 int             allocuvm(pde_t*, uint, uint);
 int             deallocuvm(pde_t*, uint, uint);
+void            unmapuvm(pde_t*, uint, uint);
 void            freevm(pde_t*);
 void            inituvm(pde_t*, char*, uint);
 int             loaduvm(pde_t*, char*, struct inode*, uint, uint);
 pde_t*          copyuvm(pde_t*, uint, uint);
 void            switchuvm(struct proc*);
 void            switchkvm(void);
-int             copyout(pde_t*, uint, void*, uint);
+void            tlbintr(void);
+void            tlbshoot(pde_t*, int);
+int             copyoutuvm(pde_t*, uint, void*, uint);
+int             copyin(void*, uint, uint);
+int             copyout(uint, void*, uint);
+uint            umove(void*, const void*, uint);
 void            clearpteu(pde_t *pgdir, char *uva);
+pte_t*          walkpgdir(pde_t*, const void*, int);
+int             mappages(pde_t*, void*, uint, uint, int);
 
 // number of elements in fixed-size array
 #define NELEM(x) (sizeof(x)/sizeof((x)[0]))
@@ -0,0 +1,2179 @@
+
+_echo:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 08             	sub    $0x8,%esp
+  14:	8b 31                	mov    (%ecx),%esi
+  16:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  for(i = 1; i < argc; i++)
+  19:	83 fe 01             	cmp    $0x1,%esi
+  1c:	7e 47                	jle    65 <main+0x65>
+    printf(1, "%s%s", argv[i], i+1 < argc ? " " : "\n");
+  1e:	8b 47 04             	mov    0x4(%edi),%eax
+  21:	83 fe 02             	cmp    $0x2,%esi
+  24:	74 2a                	je     50 <main+0x50>
+  26:	bb 02 00 00 00       	mov    $0x2,%ebx
+  2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+  30:	68 08 0f 00 00       	push   $0xf08
+  35:	83 c3 01             	add    $0x1,%ebx
+  38:	50                   	push   %eax
+  39:	68 0a 0f 00 00       	push   $0xf0a
+  3e:	6a 01                	push   $0x1
+  40:	e8 8b 0a 00 00       	call   ad0 <printf>
+  45:	8b 44 9f fc          	mov    -0x4(%edi,%ebx,4),%eax
+  49:	83 c4 10             	add    $0x10,%esp
+  4c:	39 f3                	cmp    %esi,%ebx
+  4e:	75 e0                	jne    30 <main+0x30>
+  50:	68 0f 0f 00 00       	push   $0xf0f
+  55:	50                   	push   %eax
+  56:	68 0a 0f 00 00       	push   $0xf0a
+  5b:	6a 01                	push   $0x1
+  5d:	e8 6e 0a 00 00       	call   ad0 <printf>
+  62:	83 c4 10             	add    $0x10,%esp
+  exit();
+  65:	e8 d6 02 00 00       	call   340 <exit>
+  6a:	66 90                	xchg   %ax,%ax
+  6c:	66 90                	xchg   %ax,%ax
+  6e:	66 90                	xchg   %ax,%ax
+
+00000070 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  70:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  71:	31 c0                	xor    %eax,%eax
+{
+  73:	89 e5                	mov    %esp,%ebp
+  75:	53                   	push   %ebx
+  76:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  79:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  80:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  84:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  87:	83 c0 01             	add    $0x1,%eax
+  8a:	84 d2                	test   %dl,%dl
+  8c:	75 f2                	jne    80 <strcpy+0x10>
+    ;
+  return os;
+}
+  8e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  91:	89 c8                	mov    %ecx,%eax
+  93:	c9                   	leave
+  94:	c3                   	ret
+  95:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000a0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  a0:	55                   	push   %ebp
+  a1:	89 e5                	mov    %esp,%ebp
+  a3:	53                   	push   %ebx
+  a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  aa:	0f b6 02             	movzbl (%edx),%eax
+  ad:	84 c0                	test   %al,%al
+  af:	75 17                	jne    c8 <strcmp+0x28>
+  b1:	eb 3a                	jmp    ed <strcmp+0x4d>
+  b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  b7:	90                   	nop
+  b8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  bc:	83 c2 01             	add    $0x1,%edx
+  bf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  c2:	84 c0                	test   %al,%al
+  c4:	74 1a                	je     e0 <strcmp+0x40>
+    p++, q++;
+  c6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  c8:	0f b6 19             	movzbl (%ecx),%ebx
+  cb:	38 c3                	cmp    %al,%bl
+  cd:	74 e9                	je     b8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  cf:	29 d8                	sub    %ebx,%eax
+}
+  d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  d4:	c9                   	leave
+  d5:	c3                   	ret
+  d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  dd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  e0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  e4:	31 c0                	xor    %eax,%eax
+  e6:	29 d8                	sub    %ebx,%eax
+}
+  e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  eb:	c9                   	leave
+  ec:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  ed:	0f b6 19             	movzbl (%ecx),%ebx
+  f0:	31 c0                	xor    %eax,%eax
+  f2:	eb db                	jmp    cf <strcmp+0x2f>
+  f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  ff:	90                   	nop
+
+00000100 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 100:	55                   	push   %ebp
+ 101:	89 e5                	mov    %esp,%ebp
+ 103:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 106:	80 3a 00             	cmpb   $0x0,(%edx)
+ 109:	74 15                	je     120 <strlen+0x20>
+ 10b:	31 c0                	xor    %eax,%eax
+ 10d:	8d 76 00             	lea    0x0(%esi),%esi
+ 110:	83 c0 01             	add    $0x1,%eax
+ 113:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 117:	89 c1                	mov    %eax,%ecx
+ 119:	75 f5                	jne    110 <strlen+0x10>
+    ;
+  return n;
+}
+ 11b:	89 c8                	mov    %ecx,%eax
+ 11d:	5d                   	pop    %ebp
+ 11e:	c3                   	ret
+ 11f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 120:	31 c9                	xor    %ecx,%ecx
+}
+ 122:	5d                   	pop    %ebp
+ 123:	89 c8                	mov    %ecx,%eax
+ 125:	c3                   	ret
+ 126:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 12d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000130 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 130:	55                   	push   %ebp
+ 131:	89 e5                	mov    %esp,%ebp
+ 133:	57                   	push   %edi
+ 134:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 137:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 13a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 13d:	89 d7                	mov    %edx,%edi
+ 13f:	fc                   	cld
+ 140:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 142:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 145:	89 d0                	mov    %edx,%eax
+ 147:	c9                   	leave
+ 148:	c3                   	ret
+ 149:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000150 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	56                   	push   %esi
+ 154:	53                   	push   %ebx
+ 155:	8b 75 10             	mov    0x10(%ebp),%esi
+ 158:	8b 55 08             	mov    0x8(%ebp),%edx
+ 15b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+ 15e:	85 f6                	test   %esi,%esi
+ 160:	74 2e                	je     190 <memcmp+0x40>
+ 162:	01 c6                	add    %eax,%esi
+ 164:	eb 14                	jmp    17a <memcmp+0x2a>
+ 166:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 16d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+ 170:	83 c0 01             	add    $0x1,%eax
+ 173:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+ 176:	39 f0                	cmp    %esi,%eax
+ 178:	74 16                	je     190 <memcmp+0x40>
+    if(*s1 != *s2)
+ 17a:	0f b6 0a             	movzbl (%edx),%ecx
+ 17d:	0f b6 18             	movzbl (%eax),%ebx
+ 180:	38 d9                	cmp    %bl,%cl
+ 182:	74 ec                	je     170 <memcmp+0x20>
+      return *s1 - *s2;
+ 184:	0f b6 c1             	movzbl %cl,%eax
+ 187:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+ 189:	5b                   	pop    %ebx
+ 18a:	5e                   	pop    %esi
+ 18b:	5d                   	pop    %ebp
+ 18c:	c3                   	ret
+ 18d:	8d 76 00             	lea    0x0(%esi),%esi
+ 190:	5b                   	pop    %ebx
+  return 0;
+ 191:	31 c0                	xor    %eax,%eax
+}
+ 193:	5e                   	pop    %esi
+ 194:	5d                   	pop    %ebp
+ 195:	c3                   	ret
+ 196:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 19d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001a0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1a6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1aa:	0f b6 10             	movzbl (%eax),%edx
+ 1ad:	84 d2                	test   %dl,%dl
+ 1af:	75 12                	jne    1c3 <strchr+0x23>
+ 1b1:	eb 1d                	jmp    1d0 <strchr+0x30>
+ 1b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1b7:	90                   	nop
+ 1b8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 1bc:	83 c0 01             	add    $0x1,%eax
+ 1bf:	84 d2                	test   %dl,%dl
+ 1c1:	74 0d                	je     1d0 <strchr+0x30>
+    if(*s == c)
+ 1c3:	38 d1                	cmp    %dl,%cl
+ 1c5:	75 f1                	jne    1b8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 1c7:	5d                   	pop    %ebp
+ 1c8:	c3                   	ret
+ 1c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 1d0:	31 c0                	xor    %eax,%eax
+}
+ 1d2:	5d                   	pop    %ebp
+ 1d3:	c3                   	ret
+ 1d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1df:	90                   	nop
+
+000001e0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	57                   	push   %edi
+ 1e4:	56                   	push   %esi
+int
+read(int fd, void *buf, int n)
+{
+  if(flushhook)
+    flushhook();
+  return _read(fd, buf, n);
+ 1e5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 1e8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 1e9:	31 db                	xor    %ebx,%ebx
+{
+ 1eb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 1ee:	eb 32                	jmp    222 <gets+0x42>
+  if(flushhook)
+ 1f0:	a1 10 22 00 00       	mov    0x2210,%eax
+ 1f5:	85 c0                	test   %eax,%eax
+ 1f7:	74 02                	je     1fb <gets+0x1b>
+    flushhook();
+ 1f9:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+ 1fb:	83 ec 04             	sub    $0x4,%esp
+ 1fe:	6a 01                	push   $0x1
+ 200:	56                   	push   %esi
+ 201:	6a 00                	push   $0x0
+ 203:	e8 60 03 00 00       	call   568 <_read>
+    if(cc < 1)
+ 208:	83 c4 10             	add    $0x10,%esp
+ 20b:	85 c0                	test   %eax,%eax
+ 20d:	7e 1d                	jle    22c <gets+0x4c>
+    buf[i++] = c;
+ 20f:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 213:	8b 55 08             	mov    0x8(%ebp),%edx
+ 216:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 21a:	3c 0a                	cmp    $0xa,%al
+ 21c:	74 10                	je     22e <gets+0x4e>
+ 21e:	3c 0d                	cmp    $0xd,%al
+ 220:	74 0c                	je     22e <gets+0x4e>
+  for(i=0; i+1 < max; ){
+ 222:	89 df                	mov    %ebx,%edi
+ 224:	83 c3 01             	add    $0x1,%ebx
+ 227:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 22a:	7c c4                	jl     1f0 <gets+0x10>
+ 22c:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+ 22e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 231:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+ 235:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 238:	5b                   	pop    %ebx
+ 239:	5e                   	pop    %esi
+ 23a:	5f                   	pop    %edi
+ 23b:	5d                   	pop    %ebp
+ 23c:	c3                   	ret
+ 23d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000240 <stat>:
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	56                   	push   %esi
+ 244:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+ 245:	83 ec 08             	sub    $0x8,%esp
+ 248:	6a 00                	push   $0x0
+ 24a:	ff 75 08             	push   0x8(%ebp)
+ 24d:	e8 3e 03 00 00       	call   590 <open>
+  if(fd < 0)
+ 252:	83 c4 10             	add    $0x10,%esp
+ 255:	85 c0                	test   %eax,%eax
+ 257:	78 37                	js     290 <stat+0x50>
+  r = fstat(fd, st);
+ 259:	83 ec 08             	sub    $0x8,%esp
+ 25c:	ff 75 0c             	push   0xc(%ebp)
+ 25f:	89 c3                	mov    %eax,%ebx
+ 261:	50                   	push   %eax
+ 262:	e8 41 03 00 00       	call   5a8 <fstat>
+}
+
+int
+close(int fd)
+{
+  if(flushhook)
+ 267:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+ 26a:	89 c6                	mov    %eax,%esi
+  if(flushhook)
+ 26c:	a1 10 22 00 00       	mov    0x2210,%eax
+ 271:	85 c0                	test   %eax,%eax
+ 273:	74 02                	je     277 <stat+0x37>
+    flushhook();
+ 275:	ff d0                	call   *%eax
+  return _close(fd);
+ 277:	83 ec 0c             	sub    $0xc,%esp
+ 27a:	53                   	push   %ebx
+ 27b:	e8 f8 02 00 00       	call   578 <_close>
+ 280:	83 c4 10             	add    $0x10,%esp
+}
+ 283:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 286:	89 f0                	mov    %esi,%eax
+ 288:	5b                   	pop    %ebx
+ 289:	5e                   	pop    %esi
+ 28a:	5d                   	pop    %ebp
+ 28b:	c3                   	ret
+ 28c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+ 290:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 295:	eb ec                	jmp    283 <stat+0x43>
+ 297:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29e:	66 90                	xchg   %ax,%ax
+
+000002a0 <atoi>:
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	53                   	push   %ebx
+ 2a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+ 2a7:	0f be 02             	movsbl (%edx),%eax
+ 2aa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 2ad:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 2b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 2b5:	77 1e                	ja     2d5 <atoi+0x35>
+ 2b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2be:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 2c0:	83 c2 01             	add    $0x1,%edx
+ 2c3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 2c6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 2ca:	0f be 02             	movsbl (%edx),%eax
+ 2cd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 2d0:	80 fb 09             	cmp    $0x9,%bl
+ 2d3:	76 eb                	jbe    2c0 <atoi+0x20>
+}
+ 2d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2d8:	89 c8                	mov    %ecx,%eax
+ 2da:	c9                   	leave
+ 2db:	c3                   	ret
+ 2dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002e0 <memmove>:
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	57                   	push   %edi
+ 2e4:	56                   	push   %esi
+ 2e5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2e8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2eb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+ 2ee:	85 c0                	test   %eax,%eax
+ 2f0:	7e 13                	jle    305 <memmove+0x25>
+ 2f2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 2f4:	89 d7                	mov    %edx,%edi
+ 2f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 300:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 301:	39 f8                	cmp    %edi,%eax
+ 303:	75 fb                	jne    300 <memmove+0x20>
+}
+ 305:	5e                   	pop    %esi
+ 306:	89 d0                	mov    %edx,%eax
+ 308:	5f                   	pop    %edi
+ 309:	5d                   	pop    %ebp
+ 30a:	c3                   	ret
+ 30b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 30f:	90                   	nop
+
+00000310 <fork>:
+  if(flushhook)
+ 310:	a1 10 22 00 00       	mov    0x2210,%eax
+ 315:	85 c0                	test   %eax,%eax
+ 317:	74 17                	je     330 <fork+0x20>
+{
+ 319:	55                   	push   %ebp
+ 31a:	89 e5                	mov    %esp,%ebp
+ 31c:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+ 31f:	ff d0                	call   *%eax
+}
+ 321:	c9                   	leave
+  return _fork();
+ 322:	e9 21 02 00 00       	jmp    548 <_fork>
+ 327:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 32e:	66 90                	xchg   %ax,%ax
+ 330:	e9 13 02 00 00       	jmp    548 <_fork>
+ 335:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000340 <exit>:
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+ 346:	a1 10 22 00 00       	mov    0x2210,%eax
+ 34b:	85 c0                	test   %eax,%eax
+ 34d:	74 02                	je     351 <exit+0x11>
+    flushhook();
+ 34f:	ff d0                	call   *%eax
+  _exit();
+ 351:	e8 fa 01 00 00       	call   550 <_exit>
+ 356:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 35d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000360 <exec>:
+{
+ 360:	55                   	push   %ebp
+  if(flushhook)
+ 361:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+ 366:	89 e5                	mov    %esp,%ebp
+ 368:	56                   	push   %esi
+ 369:	53                   	push   %ebx
+ 36a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 36d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+ 370:	85 c0                	test   %eax,%eax
+ 372:	74 02                	je     376 <exec+0x16>
+    flushhook();
+ 374:	ff d0                	call   *%eax
+  return _exec(path, argv);
+ 376:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 379:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 37c:	5b                   	pop    %ebx
+ 37d:	5e                   	pop    %esi
+ 37e:	5d                   	pop    %ebp
+  return _exec(path, argv);
+ 37f:	e9 04 02 00 00       	jmp    588 <_exec>
+ 384:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 38b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 38f:	90                   	nop
+
+00000390 <read>:
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	57                   	push   %edi
+ 394:	56                   	push   %esi
+ 395:	53                   	push   %ebx
+ 396:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+ 399:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+ 39e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 3a1:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 3a4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+ 3a7:	85 c0                	test   %eax,%eax
+ 3a9:	74 02                	je     3ad <read+0x1d>
+    flushhook();
+ 3ab:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+ 3ad:	89 7d 10             	mov    %edi,0x10(%ebp)
+ 3b0:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 3b3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 3b6:	83 c4 0c             	add    $0xc,%esp
+ 3b9:	5b                   	pop    %ebx
+ 3ba:	5e                   	pop    %esi
+ 3bb:	5f                   	pop    %edi
+ 3bc:	5d                   	pop    %ebp
+  return _read(fd, buf, n);
+ 3bd:	e9 a6 01 00 00       	jmp    568 <_read>
+ 3c2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003d0 <readv>:
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	57                   	push   %edi
+ 3d4:	56                   	push   %esi
+ 3d5:	53                   	push   %ebx
+ 3d6:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+ 3d9:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+ 3de:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 3e1:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 3e4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+ 3e7:	85 c0                	test   %eax,%eax
+ 3e9:	74 02                	je     3ed <readv+0x1d>
+    flushhook();
+ 3eb:	ff d0                	call   *%eax
+  return _readv(fd, iov, cnt);
+ 3ed:	89 7d 10             	mov    %edi,0x10(%ebp)
+ 3f0:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 3f3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 3f6:	83 c4 0c             	add    $0xc,%esp
+ 3f9:	5b                   	pop    %ebx
+ 3fa:	5e                   	pop    %esi
+ 3fb:	5f                   	pop    %edi
+ 3fc:	5d                   	pop    %ebp
+  return _readv(fd, iov, cnt);
+ 3fd:	e9 76 02 00 00       	jmp    678 <_readv>
+ 402:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 409:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000410 <write>:
+{
+ 410:	55                   	push   %ebp
+ 411:	89 e5                	mov    %esp,%ebp
+ 413:	57                   	push   %edi
+ 414:	56                   	push   %esi
+ 415:	53                   	push   %ebx
+ 416:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+ 419:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+ 41e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 421:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 424:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+ 427:	85 c0                	test   %eax,%eax
+ 429:	74 02                	je     42d <write+0x1d>
+    flushhook();
+ 42b:	ff d0                	call   *%eax
+  return _write(fd, buf, n);
+ 42d:	89 7d 10             	mov    %edi,0x10(%ebp)
+ 430:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 433:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 436:	83 c4 0c             	add    $0xc,%esp
+ 439:	5b                   	pop    %ebx
+ 43a:	5e                   	pop    %esi
+ 43b:	5f                   	pop    %edi
+ 43c:	5d                   	pop    %ebp
+  return _write(fd, buf, n);
+ 43d:	e9 2e 01 00 00       	jmp    570 <_write>
+ 442:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 449:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000450 <writev>:
+{
+ 450:	55                   	push   %ebp
+ 451:	89 e5                	mov    %esp,%ebp
+ 453:	57                   	push   %edi
+ 454:	56                   	push   %esi
+ 455:	53                   	push   %ebx
+ 456:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+ 459:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+ 45e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 461:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 464:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+ 467:	85 c0                	test   %eax,%eax
+ 469:	74 02                	je     46d <writev+0x1d>
+    flushhook();
+ 46b:	ff d0                	call   *%eax
+  return _writev(fd, iov, cnt);
+ 46d:	89 7d 10             	mov    %edi,0x10(%ebp)
+ 470:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 473:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 476:	83 c4 0c             	add    $0xc,%esp
+ 479:	5b                   	pop    %ebx
+ 47a:	5e                   	pop    %esi
+ 47b:	5f                   	pop    %edi
+ 47c:	5d                   	pop    %ebp
+  return _writev(fd, iov, cnt);
+ 47d:	e9 fe 01 00 00       	jmp    680 <_writev>
+ 482:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 489:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000490 <close>:
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	53                   	push   %ebx
+ 494:	83 ec 04             	sub    $0x4,%esp
+  if(flushhook)
+ 497:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+ 49c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(flushhook)
+ 49f:	85 c0                	test   %eax,%eax
+ 4a1:	74 02                	je     4a5 <close+0x15>
+    flushhook();
+ 4a3:	ff d0                	call   *%eax
+  return _close(fd);
+ 4a5:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 4a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4ab:	c9                   	leave
+  return _close(fd);
+ 4ac:	e9 c7 00 00 00       	jmp    578 <_close>
+ 4b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4bf:	90                   	nop
+
+000004c0 <umtxinit>:
+// process that finds the mutex held enters the kernel, to sleep
+// in futexwait() until the holder's umtxunlock() wakes it.
+
+void
+umtxinit(struct umutex *m)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 4c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4c6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 4cc:	5d                   	pop    %ebp
+ 4cd:	c3                   	ret
+ 4ce:	66 90                	xchg   %ax,%ax
+
+000004d0 <umtxlock>:
+
+void
+umtxlock(struct umutex *m)
+{
+ 4d0:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 4d1:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4d6:	89 e5                	mov    %esp,%ebp
+ 4d8:	56                   	push   %esi
+ 4d9:	53                   	push   %ebx
+ 4da:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 4dd:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 1) == 0)
+ 4e0:	85 c0                	test   %eax,%eax
+ 4e2:	74 2b                	je     50f <umtxlock+0x3f>
+ 4e4:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4e9:	f0 87 03             	lock xchg %eax,(%ebx)
+    return;
+  // Mark the mutex contended, so that its holder
+  // wakes a waiter on release, and wait.
+  while(xchg(&m->state, 2) != 0)
+ 4ec:	85 c0                	test   %eax,%eax
+ 4ee:	74 1f                	je     50f <umtxlock+0x3f>
+ 4f0:	be 02 00 00 00       	mov    $0x2,%esi
+ 4f5:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwait(&m->state, 2);
+ 4f8:	83 ec 08             	sub    $0x8,%esp
+ 4fb:	6a 02                	push   $0x2
+ 4fd:	53                   	push   %ebx
+ 4fe:	e8 85 01 00 00       	call   688 <futexwait>
+ 503:	89 f0                	mov    %esi,%eax
+ 505:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+ 508:	83 c4 10             	add    $0x10,%esp
+ 50b:	85 c0                	test   %eax,%eax
+ 50d:	75 e9                	jne    4f8 <umtxlock+0x28>
+}
+ 50f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 512:	5b                   	pop    %ebx
+ 513:	5e                   	pop    %esi
+ 514:	5d                   	pop    %ebp
+ 515:	c3                   	ret
+ 516:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 51d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000520 <umtxunlock>:
+
+void
+umtxunlock(struct umutex *m)
+{
+ 520:	55                   	push   %ebp
+ 521:	31 c0                	xor    %eax,%eax
+ 523:	89 e5                	mov    %esp,%ebp
+ 525:	83 ec 08             	sub    $0x8,%esp
+ 528:	8b 55 08             	mov    0x8(%ebp),%edx
+ 52b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 52e:	83 f8 02             	cmp    $0x2,%eax
+ 531:	74 05                	je     538 <umtxunlock+0x18>
+    futexwake(&m->state, 1);
+}
+ 533:	c9                   	leave
+ 534:	c3                   	ret
+ 535:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwake(&m->state, 1);
+ 538:	83 ec 08             	sub    $0x8,%esp
+ 53b:	6a 01                	push   $0x1
+ 53d:	52                   	push   %edx
+ 53e:	e8 4d 01 00 00       	call   690 <futexwake>
+ 543:	83 c4 10             	add    $0x10,%esp
+}
+ 546:	c9                   	leave
+ 547:	c3                   	ret
+
+00000548 <_fork>:
+  _ ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+ 548:	b8 01 00 00 00       	mov    $0x1,%eax
+ 54d:	cd 40                	int    $0x40
+ 54f:	c3                   	ret
+
+00000550 <_exit>:
+RAWSYSCALL(exit)
+ 550:	b8 02 00 00 00       	mov    $0x2,%eax
+ 555:	cd 40                	int    $0x40
+ 557:	c3                   	ret
+
+00000558 <wait>:
+SYSCALL(wait)
+ 558:	b8 03 00 00 00       	mov    $0x3,%eax
+ 55d:	cd 40                	int    $0x40
+ 55f:	c3                   	ret
+
+00000560 <pipe>:
+SYSCALL(pipe)
+ 560:	b8 04 00 00 00       	mov    $0x4,%eax
+ 565:	cd 40                	int    $0x40
+ 567:	c3                   	ret
+
+00000568 <_read>:
+RAWSYSCALL(read)
+ 568:	b8 05 00 00 00       	mov    $0x5,%eax
+ 56d:	cd 40                	int    $0x40
+ 56f:	c3                   	ret
+
+00000570 <_write>:
+RAWSYSCALL(write)
+ 570:	b8 10 00 00 00       	mov    $0x10,%eax
+ 575:	cd 40                	int    $0x40
+ 577:	c3                   	ret
+
+00000578 <_close>:
+RAWSYSCALL(close)
+ 578:	b8 15 00 00 00       	mov    $0x15,%eax
+ 57d:	cd 40                	int    $0x40
+ 57f:	c3                   	ret
+
+00000580 <kill>:
+SYSCALL(kill)
+ 580:	b8 06 00 00 00       	mov    $0x6,%eax
+ 585:	cd 40                	int    $0x40
+ 587:	c3                   	ret
+
+00000588 <_exec>:
+RAWSYSCALL(exec)
+ 588:	b8 07 00 00 00       	mov    $0x7,%eax
+ 58d:	cd 40                	int    $0x40
+ 58f:	c3                   	ret
+
+00000590 <open>:
+SYSCALL(open)
+ 590:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 595:	cd 40                	int    $0x40
+ 597:	c3                   	ret
+
+00000598 <mknod>:
+SYSCALL(mknod)
+ 598:	b8 11 00 00 00       	mov    $0x11,%eax
+ 59d:	cd 40                	int    $0x40
+ 59f:	c3                   	ret
+
+000005a0 <unlink>:
+SYSCALL(unlink)
+ 5a0:	b8 12 00 00 00       	mov    $0x12,%eax
+ 5a5:	cd 40                	int    $0x40
+ 5a7:	c3                   	ret
+
+000005a8 <fstat>:
+SYSCALL(fstat)
+ 5a8:	b8 08 00 00 00       	mov    $0x8,%eax
+ 5ad:	cd 40                	int    $0x40
+ 5af:	c3                   	ret
+
+000005b0 <link>:
+SYSCALL(link)
+ 5b0:	b8 13 00 00 00       	mov    $0x13,%eax
+ 5b5:	cd 40                	int    $0x40
+ 5b7:	c3                   	ret
+
+000005b8 <mkdir>:
+SYSCALL(mkdir)
+ 5b8:	b8 14 00 00 00       	mov    $0x14,%eax
+ 5bd:	cd 40                	int    $0x40
+ 5bf:	c3                   	ret
+
+000005c0 <chdir>:
+SYSCALL(chdir)
+ 5c0:	b8 09 00 00 00       	mov    $0x9,%eax
+ 5c5:	cd 40                	int    $0x40
+ 5c7:	c3                   	ret
+
+000005c8 <dup>:
+SYSCALL(dup)
+ 5c8:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 5cd:	cd 40                	int    $0x40
+ 5cf:	c3                   	ret
+
+000005d0 <getpid>:
+SYSCALL(getpid)
+ 5d0:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 5d5:	cd 40                	int    $0x40
+ 5d7:	c3                   	ret
+
+000005d8 <sbrk>:
+SYSCALL(sbrk)
+ 5d8:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 5dd:	cd 40                	int    $0x40
+ 5df:	c3                   	ret
+
+000005e0 <sleep>:
+SYSCALL(sleep)
+ 5e0:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 5e5:	cd 40                	int    $0x40
+ 5e7:	c3                   	ret
+
+000005e8 <uptime>:
+SYSCALL(uptime)
+ 5e8:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 5ed:	cd 40                	int    $0x40
+ 5ef:	c3                   	ret
+
+000005f0 <wolfie>:
+SYSCALL(wolfie)
+ 5f0:	b8 16 00 00 00       	mov    $0x16,%eax
+ 5f5:	cd 40                	int    $0x40
+ 5f7:	c3                   	ret
+
+000005f8 <nice>:
+SYSCALL(nice)
+ 5f8:	b8 17 00 00 00       	mov    $0x17,%eax
+ 5fd:	cd 40                	int    $0x40
+ 5ff:	c3                   	ret
+
+00000600 <mtxget>:
+SYSCALL(mtxget)
+ 600:	b8 18 00 00 00       	mov    $0x18,%eax
+ 605:	cd 40                	int    $0x40
+ 607:	c3                   	ret
+
+00000608 <mtxrel>:
+SYSCALL(mtxrel)
+ 608:	b8 19 00 00 00       	mov    $0x19,%eax
+ 60d:	cd 40                	int    $0x40
+ 60f:	c3                   	ret
+
+00000610 <mtxacq>:
+SYSCALL(mtxacq)
+ 610:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 615:	cd 40                	int    $0x40
+ 617:	c3                   	ret
+
+00000618 <mtxdel>:
+SYSCALL(mtxdel)
+ 618:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 61d:	cd 40                	int    $0x40
+ 61f:	c3                   	ret
+
+00000620 <iostat>:
+SYSCALL(iostat)
+ 620:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 625:	cd 40                	int    $0x40
+ 627:	c3                   	ret
+
+00000628 <mmap>:
+SYSCALL(mmap)
+ 628:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 62d:	cd 40                	int    $0x40
+ 62f:	c3                   	ret
+
+00000630 <munmap>:
+SYSCALL(munmap)
+ 630:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 635:	cd 40                	int    $0x40
+ 637:	c3                   	ret
+
+00000638 <shmget>:
+SYSCALL(shmget)
+ 638:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 63d:	cd 40                	int    $0x40
+ 63f:	c3                   	ret
+
+00000640 <shmat>:
+SYSCALL(shmat)
+ 640:	b8 20 00 00 00       	mov    $0x20,%eax
+ 645:	cd 40                	int    $0x40
+ 647:	c3                   	ret
+
+00000648 <shmdt>:
+SYSCALL(shmdt)
+ 648:	b8 21 00 00 00       	mov    $0x21,%eax
+ 64d:	cd 40                	int    $0x40
+ 64f:	c3                   	ret
+
+00000650 <shmdel>:
+SYSCALL(shmdel)
+ 650:	b8 22 00 00 00       	mov    $0x22,%eax
+ 655:	cd 40                	int    $0x40
+ 657:	c3                   	ret
+
+00000658 <syscount>:
+SYSCALL(syscount)
+ 658:	b8 23 00 00 00       	mov    $0x23,%eax
+ 65d:	cd 40                	int    $0x40
+ 65f:	c3                   	ret
+
+00000660 <splice>:
+SYSCALL(splice)
+ 660:	b8 24 00 00 00       	mov    $0x24,%eax
+ 665:	cd 40                	int    $0x40
+ 667:	c3                   	ret
+
+00000668 <tee>:
+SYSCALL(tee)
+ 668:	b8 25 00 00 00       	mov    $0x25,%eax
+ 66d:	cd 40                	int    $0x40
+ 66f:	c3                   	ret
+
+00000670 <sendfile>:
+SYSCALL(sendfile)
+ 670:	b8 26 00 00 00       	mov    $0x26,%eax
+ 675:	cd 40                	int    $0x40
+ 677:	c3                   	ret
+
+00000678 <_readv>:
+RAWSYSCALL(readv)
+ 678:	b8 27 00 00 00       	mov    $0x27,%eax
+ 67d:	cd 40                	int    $0x40
+ 67f:	c3                   	ret
+
+00000680 <_writev>:
+RAWSYSCALL(writev)
+ 680:	b8 28 00 00 00       	mov    $0x28,%eax
+ 685:	cd 40                	int    $0x40
+ 687:	c3                   	ret
+
+00000688 <futexwait>:
+SYSCALL(futexwait)
+ 688:	b8 29 00 00 00       	mov    $0x29,%eax
+ 68d:	cd 40                	int    $0x40
+ 68f:	c3                   	ret
+
+00000690 <futexwake>:
+SYSCALL(futexwake)
+ 690:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 695:	cd 40                	int    $0x40
+ 697:	c3                   	ret
+
+00000698 <lockstat>:
+SYSCALL(lockstat)
+ 698:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 69d:	cd 40                	int    $0x40
+ 69f:	c3                   	ret
+
+000006a0 <clone>:
+SYSCALL(clone)
+ 6a0:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 6a5:	cd 40                	int    $0x40
+ 6a7:	c3                   	ret
+
+000006a8 <join>:
+SYSCALL(join)
+ 6a8:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 6ad:	cd 40                	int    $0x40
+ 6af:	c3                   	ret
+
+000006b0 <stacklimit>:
+SYSCALL(stacklimit)
+ 6b0:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 6b5:	cd 40                	int    $0x40
+ 6b7:	c3                   	ret
+ 6b8:	66 90                	xchg   %ax,%ax
+ 6ba:	66 90                	xchg   %ax,%ax
+ 6bc:	66 90                	xchg   %ax,%ax
+ 6be:	66 90                	xchg   %ax,%ax
+
+000006c0 <flushall>:
+  b->n = 0;
+}
+
+static void
+flushall(void)
+{
+ 6c0:	55                   	push   %ebp
+ 6c1:	89 e5                	mov    %esp,%ebp
+ 6c3:	83 ec 14             	sub    $0x14,%esp
+  umtxlock(&stdoutlock);
+ 6c6:	68 14 22 00 00       	push   $0x2214
+ 6cb:	e8 00 fe ff ff       	call   4d0 <umtxlock>
+  if(b->n > 0)
+ 6d0:	a1 08 20 00 00       	mov    0x2008,%eax
+ 6d5:	83 c4 10             	add    $0x10,%esp
+ 6d8:	85 c0                	test   %eax,%eax
+ 6da:	7e 17                	jle    6f3 <flushall+0x33>
+    _write(b->fd, b->buf, b->n);
+ 6dc:	83 ec 04             	sub    $0x4,%esp
+ 6df:	50                   	push   %eax
+ 6e0:	68 0c 20 00 00       	push   $0x200c
+ 6e5:	ff 35 00 20 00 00    	push   0x2000
+ 6eb:	e8 80 fe ff ff       	call   570 <_write>
+ 6f0:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+ 6f3:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+ 6fa:	00 00 00 
+  flush(&stdout);
+  umtxunlock(&stdoutlock);
+ 6fd:	83 ec 0c             	sub    $0xc,%esp
+ 700:	68 14 22 00 00       	push   $0x2214
+ 705:	e8 16 fe ff ff       	call   520 <umtxunlock>
+}
+ 70a:	83 c4 10             	add    $0x10,%esp
+ 70d:	c9                   	leave
+ 70e:	c3                   	ret
+ 70f:	90                   	nop
+
+00000710 <printint>:
+    flush(b);
+}
+
+static void
+printint(struct outbuf *b, int xx, int base, int sgn)
+{
+ 710:	55                   	push   %ebp
+ 711:	89 e5                	mov    %esp,%ebp
+ 713:	57                   	push   %edi
+ 714:	89 cf                	mov    %ecx,%edi
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 716:	89 d1                	mov    %edx,%ecx
+{
+ 718:	56                   	push   %esi
+ 719:	53                   	push   %ebx
+ 71a:	89 c3                	mov    %eax,%ebx
+ 71c:	83 ec 2c             	sub    $0x2c,%esp
+  if(sgn && xx < 0){
+ 71f:	85 d2                	test   %edx,%edx
+ 721:	0f 89 b9 00 00 00    	jns    7e0 <printint+0xd0>
+ 727:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 72b:	0f 84 af 00 00 00    	je     7e0 <printint+0xd0>
+    x = -xx;
+ 731:	f7 d9                	neg    %ecx
+    neg = 1;
+ 733:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 738:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 73b:	31 f6                	xor    %esi,%esi
+ 73d:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 740:	89 c8                	mov    %ecx,%eax
+ 742:	31 d2                	xor    %edx,%edx
+ 744:	89 f3                	mov    %esi,%ebx
+ 746:	f7 f7                	div    %edi
+ 748:	8d 76 01             	lea    0x1(%esi),%esi
+ 74b:	0f b6 92 20 13 00 00 	movzbl 0x1320(%edx),%edx
+ 752:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 756:	89 ca                	mov    %ecx,%edx
+ 758:	89 c1                	mov    %eax,%ecx
+ 75a:	39 fa                	cmp    %edi,%edx
+ 75c:	73 e2                	jae    740 <printint+0x30>
+  if(neg)
+ 75e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 761:	89 d9                	mov    %ebx,%ecx
+ 763:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 766:	85 c0                	test   %eax,%eax
+ 768:	74 07                	je     771 <printint+0x61>
+    buf[i++] = '-';
+ 76a:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 76f:	89 f1                	mov    %esi,%ecx
+ 771:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 774:	89 cf                	mov    %ecx,%edi
+ 776:	01 f7                	add    %esi,%edi
+ 778:	eb 1a                	jmp    794 <printint+0x84>
+ 77a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    *b->str++ = c;
+ 780:	8d 48 01             	lea    0x1(%eax),%ecx
+ 783:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+ 789:	88 10                	mov    %dl,(%eax)
+
+  while(--i >= 0)
+ 78b:	8d 47 ff             	lea    -0x1(%edi),%eax
+ 78e:	39 fe                	cmp    %edi,%esi
+ 790:	74 40                	je     7d2 <printint+0xc2>
+ 792:	89 c7                	mov    %eax,%edi
+  if(b->str){
+ 794:	8b 83 0c 02 00 00    	mov    0x20c(%ebx),%eax
+    putc(b, buf[i]);
+ 79a:	0f b6 17             	movzbl (%edi),%edx
+  if(b->str){
+ 79d:	85 c0                	test   %eax,%eax
+ 79f:	75 df                	jne    780 <printint+0x70>
+  b->buf[b->n++] = c;
+ 7a1:	8b 4b 08             	mov    0x8(%ebx),%ecx
+ 7a4:	8d 41 01             	lea    0x1(%ecx),%eax
+ 7a7:	89 43 08             	mov    %eax,0x8(%ebx)
+ 7aa:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+ 7ae:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 7b3:	74 3b                	je     7f0 <printint+0xe0>
+ 7b5:	80 fa 0a             	cmp    $0xa,%dl
+ 7b8:	75 d1                	jne    78b <printint+0x7b>
+ 7ba:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+ 7be:	75 cb                	jne    78b <printint+0x7b>
+  if(b->n > 0)
+ 7c0:	85 c0                	test   %eax,%eax
+ 7c2:	7f 2c                	jg     7f0 <printint+0xe0>
+  b->n = 0;
+ 7c4:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  while(--i >= 0)
+ 7cb:	8d 47 ff             	lea    -0x1(%edi),%eax
+ 7ce:	39 fe                	cmp    %edi,%esi
+ 7d0:	75 c0                	jne    792 <printint+0x82>
+}
+ 7d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7d5:	5b                   	pop    %ebx
+ 7d6:	5e                   	pop    %esi
+ 7d7:	5f                   	pop    %edi
+ 7d8:	5d                   	pop    %ebp
+ 7d9:	c3                   	ret
+ 7da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  neg = 0;
+ 7e0:	31 c0                	xor    %eax,%eax
+ 7e2:	e9 51 ff ff ff       	jmp    738 <printint+0x28>
+ 7e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ee:	66 90                	xchg   %ax,%ax
+    _write(b->fd, b->buf, b->n);
+ 7f0:	83 ec 04             	sub    $0x4,%esp
+ 7f3:	50                   	push   %eax
+ 7f4:	8d 43 0c             	lea    0xc(%ebx),%eax
+ 7f7:	50                   	push   %eax
+ 7f8:	ff 33                	push   (%ebx)
+ 7fa:	e8 71 fd ff ff       	call   570 <_write>
+ 7ff:	83 c4 10             	add    $0x10,%esp
+ 802:	eb c0                	jmp    7c4 <printint+0xb4>
+ 804:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 80b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 80f:	90                   	nop
+
+00000810 <putc>:
+{
+ 810:	55                   	push   %ebp
+ 811:	89 e5                	mov    %esp,%ebp
+ 813:	53                   	push   %ebx
+ 814:	89 c3                	mov    %eax,%ebx
+ 816:	83 ec 04             	sub    $0x4,%esp
+  if(b->str){
+ 819:	8b 80 0c 02 00 00    	mov    0x20c(%eax),%eax
+ 81f:	85 c0                	test   %eax,%eax
+ 821:	74 15                	je     838 <putc+0x28>
+    *b->str++ = c;
+ 823:	8d 48 01             	lea    0x1(%eax),%ecx
+ 826:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+ 82c:	88 10                	mov    %dl,(%eax)
+}
+ 82e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 831:	c9                   	leave
+ 832:	c3                   	ret
+ 833:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 837:	90                   	nop
+  b->buf[b->n++] = c;
+ 838:	8b 4b 08             	mov    0x8(%ebx),%ecx
+ 83b:	8d 41 01             	lea    0x1(%ecx),%eax
+ 83e:	89 43 08             	mov    %eax,0x8(%ebx)
+ 841:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+ 845:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 84a:	74 14                	je     860 <putc+0x50>
+ 84c:	80 fa 0a             	cmp    $0xa,%dl
+ 84f:	75 dd                	jne    82e <putc+0x1e>
+ 851:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+ 855:	75 d7                	jne    82e <putc+0x1e>
+  if(b->n > 0)
+ 857:	85 c0                	test   %eax,%eax
+ 859:	7e 17                	jle    872 <putc+0x62>
+ 85b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 85f:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+ 860:	83 ec 04             	sub    $0x4,%esp
+ 863:	50                   	push   %eax
+ 864:	8d 43 0c             	lea    0xc(%ebx),%eax
+ 867:	50                   	push   %eax
+ 868:	ff 33                	push   (%ebx)
+ 86a:	e8 01 fd ff ff       	call   570 <_write>
+ 86f:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+ 872:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+ 879:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 87c:	c9                   	leave
+ 87d:	c3                   	ret
+ 87e:	66 90                	xchg   %ax,%ax
+
+00000880 <format>:
+
+// Format fmt and the arguments at ap into b.
+// Only understands %d, %x, %p, %s, %c.
+static void
+format(struct outbuf *b, const char *fmt, uint *ap)
+{
+ 880:	55                   	push   %ebp
+ 881:	89 e5                	mov    %esp,%ebp
+ 883:	57                   	push   %edi
+ 884:	89 c7                	mov    %eax,%edi
+ 886:	56                   	push   %esi
+ 887:	53                   	push   %ebx
+ 888:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+ 88b:	0f b6 02             	movzbl (%edx),%eax
+{
+ 88e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 891:	84 c0                	test   %al,%al
+ 893:	74 5a                	je     8ef <format+0x6f>
+ 895:	8d 5a 01             	lea    0x1(%edx),%ebx
+ 898:	31 f6                	xor    %esi,%esi
+ 89a:	eb 1c                	jmp    8b8 <format+0x38>
+ 89c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+ 8a0:	83 f8 25             	cmp    $0x25,%eax
+ 8a3:	74 3b                	je     8e0 <format+0x60>
+        state = '%';
+      } else {
+        putc(b, c);
+ 8a5:	89 ca                	mov    %ecx,%edx
+ 8a7:	89 f8                	mov    %edi,%eax
+ 8a9:	e8 62 ff ff ff       	call   810 <putc>
+  for(i = 0; fmt[i]; i++){
+ 8ae:	0f b6 03             	movzbl (%ebx),%eax
+ 8b1:	83 c3 01             	add    $0x1,%ebx
+ 8b4:	84 c0                	test   %al,%al
+ 8b6:	74 37                	je     8ef <format+0x6f>
+    c = fmt[i] & 0xff;
+ 8b8:	0f be c8             	movsbl %al,%ecx
+ 8bb:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 8be:	85 f6                	test   %esi,%esi
+ 8c0:	74 de                	je     8a0 <format+0x20>
+      }
+    } else if(state == '%'){
+ 8c2:	83 fe 25             	cmp    $0x25,%esi
+ 8c5:	75 e7                	jne    8ae <format+0x2e>
+      if(c == 'd'){
+ 8c7:	83 f8 25             	cmp    $0x25,%eax
+ 8ca:	74 46                	je     912 <format+0x92>
+ 8cc:	83 e8 63             	sub    $0x63,%eax
+ 8cf:	83 f8 15             	cmp    $0x15,%eax
+ 8d2:	77 2c                	ja     900 <format+0x80>
+ 8d4:	ff 24 85 c8 12 00 00 	jmp    *0x12c8(,%eax,4)
+ 8db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8df:	90                   	nop
+  for(i = 0; fmt[i]; i++){
+ 8e0:	0f b6 03             	movzbl (%ebx),%eax
+ 8e3:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+ 8e6:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+ 8eb:	84 c0                	test   %al,%al
+ 8ed:	75 c9                	jne    8b8 <format+0x38>
+        putc(b, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 8ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8f2:	5b                   	pop    %ebx
+ 8f3:	5e                   	pop    %esi
+ 8f4:	5f                   	pop    %edi
+ 8f5:	5d                   	pop    %ebp
+ 8f6:	c3                   	ret
+ 8f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8fe:	66 90                	xchg   %ax,%ax
+        putc(b, '%');
+ 900:	ba 25 00 00 00       	mov    $0x25,%edx
+ 905:	89 f8                	mov    %edi,%eax
+ 907:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+ 90a:	e8 01 ff ff ff       	call   810 <putc>
+        putc(b, c);
+ 90f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ 912:	89 ca                	mov    %ecx,%edx
+ 914:	89 f8                	mov    %edi,%eax
+      state = 0;
+ 916:	31 f6                	xor    %esi,%esi
+        putc(b, c);
+ 918:	e8 f3 fe ff ff       	call   810 <putc>
+ 91d:	eb 8f                	jmp    8ae <format+0x2e>
+ 91f:	90                   	nop
+        printint(b, *ap, 16, 0);
+ 920:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+ 923:	83 ec 0c             	sub    $0xc,%esp
+ 926:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 92b:	8b 16                	mov    (%esi),%edx
+ 92d:	6a 00                	push   $0x0
+        ap++;
+ 92f:	83 c6 04             	add    $0x4,%esi
+        printint(b, *ap, 16, 0);
+ 932:	89 f8                	mov    %edi,%eax
+ 934:	e8 d7 fd ff ff       	call   710 <printint>
+        ap++;
+ 939:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+ 93c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 93f:	31 f6                	xor    %esi,%esi
+ 941:	e9 68 ff ff ff       	jmp    8ae <format+0x2e>
+ 946:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 94d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 950:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 953:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 955:	83 c0 04             	add    $0x4,%eax
+ 958:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 95b:	85 f6                	test   %esi,%esi
+ 95d:	75 1b                	jne    97a <format+0xfa>
+ 95f:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+ 964:	be c0 12 00 00       	mov    $0x12c0,%esi
+ 969:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+          putc(b, *s);
+ 970:	89 f8                	mov    %edi,%eax
+          s++;
+ 972:	83 c6 01             	add    $0x1,%esi
+          putc(b, *s);
+ 975:	e8 96 fe ff ff       	call   810 <putc>
+        while(*s != 0){
+ 97a:	0f be 16             	movsbl (%esi),%edx
+ 97d:	84 d2                	test   %dl,%dl
+ 97f:	75 ef                	jne    970 <format+0xf0>
+      state = 0;
+ 981:	31 f6                	xor    %esi,%esi
+ 983:	e9 26 ff ff ff       	jmp    8ae <format+0x2e>
+ 988:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 98f:	90                   	nop
+        printint(b, *ap, 10, 1);
+ 990:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+ 993:	83 ec 0c             	sub    $0xc,%esp
+ 996:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 99b:	8b 16                	mov    (%esi),%edx
+ 99d:	6a 01                	push   $0x1
+ 99f:	eb 8e                	jmp    92f <format+0xaf>
+ 9a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(b, *ap);
+ 9a8:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+ 9ab:	89 f8                	mov    %edi,%eax
+ 9ad:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+ 9b0:	83 c6 04             	add    $0x4,%esi
+        putc(b, *ap);
+ 9b3:	e8 58 fe ff ff       	call   810 <putc>
+        ap++;
+ 9b8:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      state = 0;
+ 9bb:	31 f6                	xor    %esi,%esi
+ 9bd:	e9 ec fe ff ff       	jmp    8ae <format+0x2e>
+ 9c2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000009d0 <fflush>:
+{
+ 9d0:	55                   	push   %ebp
+ 9d1:	89 e5                	mov    %esp,%ebp
+ 9d3:	83 ec 08             	sub    $0x8,%esp
+  if(fd == stdout.fd)
+ 9d6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9d9:	39 05 00 20 00 00    	cmp    %eax,0x2000
+ 9df:	74 07                	je     9e8 <fflush+0x18>
+}
+ 9e1:	c9                   	leave
+ 9e2:	c3                   	ret
+ 9e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9e7:	90                   	nop
+  umtxlock(&stdoutlock);
+ 9e8:	83 ec 0c             	sub    $0xc,%esp
+ 9eb:	68 14 22 00 00       	push   $0x2214
+ 9f0:	e8 db fa ff ff       	call   4d0 <umtxlock>
+  if(b->n > 0)
+ 9f5:	a1 08 20 00 00       	mov    0x2008,%eax
+ 9fa:	83 c4 10             	add    $0x10,%esp
+ 9fd:	85 c0                	test   %eax,%eax
+ 9ff:	7f 1f                	jg     a20 <fflush+0x50>
+  b->n = 0;
+ a01:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+ a08:	00 00 00 
+  umtxunlock(&stdoutlock);
+ a0b:	c7 45 08 14 22 00 00 	movl   $0x2214,0x8(%ebp)
+}
+ a12:	c9                   	leave
+  umtxunlock(&stdoutlock);
+ a13:	e9 08 fb ff ff       	jmp    520 <umtxunlock>
+ a18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a1f:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+ a20:	83 ec 04             	sub    $0x4,%esp
+ a23:	50                   	push   %eax
+ a24:	68 0c 20 00 00       	push   $0x200c
+ a29:	ff 35 00 20 00 00    	push   0x2000
+ a2f:	e8 3c fb ff ff       	call   570 <_write>
+ a34:	83 c4 10             	add    $0x10,%esp
+ a37:	eb c8                	jmp    a01 <fflush+0x31>
+ a39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000a40 <setvbuf>:
+{
+ a40:	55                   	push   %ebp
+ a41:	89 e5                	mov    %esp,%ebp
+ a43:	53                   	push   %ebx
+ a44:	83 ec 04             	sub    $0x4,%esp
+ a47:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd != stdout.fd)
+ a4a:	8b 45 08             	mov    0x8(%ebp),%eax
+ a4d:	39 05 00 20 00 00    	cmp    %eax,0x2000
+ a53:	74 0b                	je     a60 <setvbuf+0x20>
+}
+ a55:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ a58:	c9                   	leave
+ a59:	c3                   	ret
+ a5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  umtxlock(&stdoutlock);
+ a60:	83 ec 0c             	sub    $0xc,%esp
+ a63:	68 14 22 00 00       	push   $0x2214
+ a68:	e8 63 fa ff ff       	call   4d0 <umtxlock>
+  if(b->n > 0)
+ a6d:	a1 08 20 00 00       	mov    0x2008,%eax
+ a72:	83 c4 10             	add    $0x10,%esp
+ a75:	85 c0                	test   %eax,%eax
+ a77:	7f 2f                	jg     aa8 <setvbuf+0x68>
+  b->n = 0;
+ a79:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+ a80:	00 00 00 
+  stdout.mode = mode;
+ a83:	89 1d 04 20 00 00    	mov    %ebx,0x2004
+  flushhook = flushall;
+ a89:	c7 05 10 22 00 00 c0 	movl   $0x6c0,0x2210
+ a90:	06 00 00 
+}
+ a93:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&stdoutlock);
+ a96:	c7 45 08 14 22 00 00 	movl   $0x2214,0x8(%ebp)
+}
+ a9d:	c9                   	leave
+  umtxunlock(&stdoutlock);
+ a9e:	e9 7d fa ff ff       	jmp    520 <umtxunlock>
+ aa3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ aa7:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+ aa8:	83 ec 04             	sub    $0x4,%esp
+ aab:	50                   	push   %eax
+ aac:	68 0c 20 00 00       	push   $0x200c
+ ab1:	ff 35 00 20 00 00    	push   0x2000
+ ab7:	e8 b4 fa ff ff       	call   570 <_write>
+ abc:	83 c4 10             	add    $0x10,%esp
+ abf:	eb b8                	jmp    a79 <setvbuf+0x39>
+ ac1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ac8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ acf:	90                   	nop
+
+00000ad0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s, %c.
+void
+printf(int fd, const char *fmt, ...)
+{
+ ad0:	55                   	push   %ebp
+ ad1:	89 e5                	mov    %esp,%ebp
+ ad3:	53                   	push   %ebx
+ ad4:	81 ec 14 02 00 00    	sub    $0x214,%esp
+ ada:	8b 45 08             	mov    0x8(%ebp),%eax
+    local.mode = _IONBF;
+    local.n = 0;
+    local.str = 0;
+    b = &local;
+  }
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+ add:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd == stdout.fd){
+ ae0:	39 05 00 20 00 00    	cmp    %eax,0x2000
+ ae6:	74 48                	je     b30 <printf+0x60>
+    local.fd = fd;
+ ae8:	89 85 e8 fd ff ff    	mov    %eax,-0x218(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+ aee:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ af1:	89 da                	mov    %ebx,%edx
+ af3:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+    local.mode = _IONBF;
+ af9:	c7 85 ec fd ff ff 03 	movl   $0x3,-0x214(%ebp)
+ b00:	00 00 00 
+    local.n = 0;
+ b03:	c7 85 f0 fd ff ff 00 	movl   $0x0,-0x210(%ebp)
+ b0a:	00 00 00 
+    local.str = 0;
+ b0d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+ b14:	e8 67 fd ff ff       	call   880 <format>
+  if(b->mode == _IONBF)
+ b19:	83 bd ec fd ff ff 03 	cmpl   $0x3,-0x214(%ebp)
+ b20:	0f 84 a2 00 00 00    	je     bc8 <printf+0xf8>
+    flush(b);
+  if(b == &stdout)
+    umtxunlock(&stdoutlock);
+}
+ b26:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ b29:	c9                   	leave
+ b2a:	c3                   	ret
+ b2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b2f:	90                   	nop
+    umtxlock(&stdoutlock);
+ b30:	83 ec 0c             	sub    $0xc,%esp
+ b33:	68 14 22 00 00       	push   $0x2214
+ b38:	e8 93 f9 ff ff       	call   4d0 <umtxlock>
+  if(stdout.mode == 0){
+ b3d:	a1 04 20 00 00       	mov    0x2004,%eax
+ b42:	83 c4 10             	add    $0x10,%esp
+ b45:	85 c0                	test   %eax,%eax
+ b47:	74 37                	je     b80 <printf+0xb0>
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+ b49:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ b4c:	89 da                	mov    %ebx,%edx
+ b4e:	b8 00 20 00 00       	mov    $0x2000,%eax
+ b53:	e8 28 fd ff ff       	call   880 <format>
+  if(b->mode == _IONBF)
+ b58:	83 3d 04 20 00 00 03 	cmpl   $0x3,0x2004
+ b5f:	0f 84 ab 00 00 00    	je     c10 <printf+0x140>
+    umtxunlock(&stdoutlock);
+ b65:	83 ec 0c             	sub    $0xc,%esp
+ b68:	68 14 22 00 00       	push   $0x2214
+ b6d:	e8 ae f9 ff ff       	call   520 <umtxunlock>
+}
+ b72:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    umtxunlock(&stdoutlock);
+ b75:	83 c4 10             	add    $0x10,%esp
+}
+ b78:	c9                   	leave
+ b79:	c3                   	ret
+ b7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+ b80:	83 ec 08             	sub    $0x8,%esp
+ b83:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+ b89:	50                   	push   %eax
+ b8a:	ff 35 00 20 00 00    	push   0x2000
+ b90:	e8 13 fa ff ff       	call   5a8 <fstat>
+ b95:	83 c4 10             	add    $0x10,%esp
+ b98:	89 c2                	mov    %eax,%edx
+      stdout.mode = _IOFBF;
+ b9a:	b8 01 00 00 00       	mov    $0x1,%eax
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+ b9f:	85 d2                	test   %edx,%edx
+ ba1:	75 10                	jne    bb3 <printf+0xe3>
+      stdout.mode = _IOLBF;
+ ba3:	31 c0                	xor    %eax,%eax
+ ba5:	66 83 bd e8 fd ff ff 	cmpw   $0x3,-0x218(%ebp)
+ bac:	03 
+ bad:	0f 94 c0             	sete   %al
+ bb0:	83 c0 01             	add    $0x1,%eax
+ bb3:	a3 04 20 00 00       	mov    %eax,0x2004
+    flushhook = flushall;
+ bb8:	c7 05 10 22 00 00 c0 	movl   $0x6c0,0x2210
+ bbf:	06 00 00 
+ bc2:	eb 85                	jmp    b49 <printf+0x79>
+ bc4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(b->n > 0)
+ bc8:	8b 85 f0 fd ff ff    	mov    -0x210(%ebp),%eax
+ bce:	85 c0                	test   %eax,%eax
+ bd0:	0f 8e 50 ff ff ff    	jle    b26 <printf+0x56>
+    b = &local;
+ bd6:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+    _write(b->fd, b->buf, b->n);
+ bdc:	83 ec 04             	sub    $0x4,%esp
+ bdf:	50                   	push   %eax
+ be0:	8d 43 0c             	lea    0xc(%ebx),%eax
+ be3:	50                   	push   %eax
+ be4:	ff 33                	push   (%ebx)
+ be6:	e8 85 f9 ff ff       	call   570 <_write>
+  b->n = 0;
+ beb:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  if(b == &stdout)
+ bf2:	83 c4 10             	add    $0x10,%esp
+ bf5:	81 fb 00 20 00 00    	cmp    $0x2000,%ebx
+ bfb:	0f 85 25 ff ff ff    	jne    b26 <printf+0x56>
+ c01:	e9 5f ff ff ff       	jmp    b65 <printf+0x95>
+ c06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c0d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(b->n > 0)
+ c10:	a1 08 20 00 00       	mov    0x2008,%eax
+    b = getstdout();
+ c15:	bb 00 20 00 00       	mov    $0x2000,%ebx
+  if(b->n > 0)
+ c1a:	85 c0                	test   %eax,%eax
+ c1c:	7f be                	jg     bdc <printf+0x10c>
+  b->n = 0;
+ c1e:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+ c25:	00 00 00 
+  if(b == &stdout)
+ c28:	e9 38 ff ff ff       	jmp    b65 <printf+0x95>
+ c2d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000c30 <sprintf>:
+
+// Print to the given buffer. Only understands %d, %x, %p, %s, %c.
+int
+sprintf(char *str, const char *fmt, ...)
+{
+ c30:	55                   	push   %ebp
+ c31:	89 e5                	mov    %esp,%ebp
+ c33:	53                   	push   %ebx
+  struct outbuf b;
+
+  b.str = str;
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+ c34:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+ c3a:	8d 4d 10             	lea    0x10(%ebp),%ecx
+{
+ c3d:	81 ec 14 02 00 00    	sub    $0x214,%esp
+ c43:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+ c46:	8b 55 0c             	mov    0xc(%ebp),%edx
+  b.str = str;
+ c49:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+ c4c:	e8 2f fc ff ff       	call   880 <format>
+  *b.str = '\0';
+ c51:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c54:	c6 00 00             	movb   $0x0,(%eax)
+  return b.str - str;
+ c57:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c5a:	29 d8                	sub    %ebx,%eax
+}
+ c5c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ c5f:	c9                   	leave
+ c60:	c3                   	ret
+ c61:	66 90                	xchg   %ax,%ax
+ c63:	66 90                	xchg   %ax,%ax
+ c65:	66 90                	xchg   %ax,%ax
+ c67:	66 90                	xchg   %ax,%ax
+ c69:	66 90                	xchg   %ax,%ax
+ c6b:	66 90                	xchg   %ax,%ax
+ c6d:	66 90                	xchg   %ax,%ax
+ c6f:	90                   	nop
+
+00000c70 <freeblock>:
+static Header *freep;
+static struct umutex lock;  // threads made by clone() share the heap
+
+static void
+freeblock(void *ap)
+{
+ c70:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ c71:	8d 48 f8             	lea    -0x8(%eax),%ecx
+{
+ c74:	89 e5                	mov    %esp,%ebp
+ c76:	57                   	push   %edi
+ c77:	56                   	push   %esi
+ c78:	53                   	push   %ebx
+ c79:	89 c3                	mov    %eax,%ebx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c7b:	a1 1c 22 00 00       	mov    0x221c,%eax
+ c80:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c82:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c84:	39 ca                	cmp    %ecx,%edx
+ c86:	73 30                	jae    cb8 <freeblock+0x48>
+ c88:	39 c1                	cmp    %eax,%ecx
+ c8a:	72 04                	jb     c90 <freeblock+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c8c:	39 c2                	cmp    %eax,%edx
+ c8e:	72 f0                	jb     c80 <freeblock+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ c90:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ c93:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ c96:	39 f8                	cmp    %edi,%eax
+ c98:	74 26                	je     cc0 <freeblock+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c9a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ c9d:	8b 42 04             	mov    0x4(%edx),%eax
+ ca0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ ca3:	39 f1                	cmp    %esi,%ecx
+ ca5:	74 30                	je     cd7 <freeblock+0x67>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ ca7:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ ca9:	5b                   	pop    %ebx
+  freep = p;
+ caa:	89 15 1c 22 00 00    	mov    %edx,0x221c
+}
+ cb0:	5e                   	pop    %esi
+ cb1:	5f                   	pop    %edi
+ cb2:	5d                   	pop    %ebp
+ cb3:	c3                   	ret
+ cb4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ cb8:	39 c1                	cmp    %eax,%ecx
+ cba:	72 d0                	jb     c8c <freeblock+0x1c>
+ cbc:	eb c2                	jmp    c80 <freeblock+0x10>
+ cbe:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ cc0:	03 70 04             	add    0x4(%eax),%esi
+ cc3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ cc6:	8b 02                	mov    (%edx),%eax
+ cc8:	8b 00                	mov    (%eax),%eax
+ cca:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ ccd:	8b 42 04             	mov    0x4(%edx),%eax
+ cd0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ cd3:	39 f1                	cmp    %esi,%ecx
+ cd5:	75 d0                	jne    ca7 <freeblock+0x37>
+    p->s.size += bp->s.size;
+ cd7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ cda:	89 15 1c 22 00 00    	mov    %edx,0x221c
+    p->s.size += bp->s.size;
+ ce0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ ce3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ ce6:	89 0a                	mov    %ecx,(%edx)
+}
+ ce8:	5b                   	pop    %ebx
+ ce9:	5e                   	pop    %esi
+ cea:	5f                   	pop    %edi
+ ceb:	5d                   	pop    %ebp
+ cec:	c3                   	ret
+ ced:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000cf0 <free>:
+
+void
+free(void *ap)
+{
+ cf0:	55                   	push   %ebp
+ cf1:	89 e5                	mov    %esp,%ebp
+ cf3:	53                   	push   %ebx
+ cf4:	83 ec 10             	sub    $0x10,%esp
+ cf7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  umtxlock(&lock);
+ cfa:	68 18 22 00 00       	push   $0x2218
+ cff:	e8 cc f7 ff ff       	call   4d0 <umtxlock>
+  freeblock(ap);
+ d04:	89 d8                	mov    %ebx,%eax
+ d06:	e8 65 ff ff ff       	call   c70 <freeblock>
+  umtxunlock(&lock);
+ d0b:	c7 45 08 18 22 00 00 	movl   $0x2218,0x8(%ebp)
+}
+ d12:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&lock);
+ d15:	83 c4 10             	add    $0x10,%esp
+}
+ d18:	c9                   	leave
+  umtxunlock(&lock);
+ d19:	e9 02 f8 ff ff       	jmp    520 <umtxunlock>
+ d1e:	66 90                	xchg   %ax,%ax
+
+00000d20 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ d20:	55                   	push   %ebp
+ d21:	89 e5                	mov    %esp,%ebp
+ d23:	57                   	push   %edi
+ d24:	56                   	push   %esi
+ d25:	53                   	push   %ebx
+ d26:	83 ec 28             	sub    $0x28,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d29:	8b 45 08             	mov    0x8(%ebp),%eax
+  umtxlock(&lock);
+ d2c:	68 18 22 00 00       	push   $0x2218
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d31:	8d 48 07             	lea    0x7(%eax),%ecx
+ d34:	c1 e9 03             	shr    $0x3,%ecx
+ d37:	8d 71 01             	lea    0x1(%ecx),%esi
+  umtxlock(&lock);
+ d3a:	e8 91 f7 ff ff       	call   4d0 <umtxlock>
+  if((prevp = freep) == 0){
+ d3f:	8b 15 1c 22 00 00    	mov    0x221c,%edx
+ d45:	83 c4 10             	add    $0x10,%esp
+ d48:	85 d2                	test   %edx,%edx
+ d4a:	0f 84 b0 00 00 00    	je     e00 <malloc+0xe0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d50:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ d52:	8b 47 04             	mov    0x4(%edi),%eax
+ d55:	39 f0                	cmp    %esi,%eax
+ d57:	73 6f                	jae    dc8 <malloc+0xa8>
+  if(nu < 4096)
+ d59:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ d5e:	39 de                	cmp    %ebx,%esi
+ d60:	0f 43 de             	cmovae %esi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ d63:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ d6a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ d6d:	eb 0a                	jmp    d79 <malloc+0x59>
+ d6f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d70:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ d72:	8b 47 04             	mov    0x4(%edi),%eax
+ d75:	39 f0                	cmp    %esi,%eax
+ d77:	73 4f                	jae    dc8 <malloc+0xa8>
+      }
+      freep = prevp;
+      umtxunlock(&lock);
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ d79:	89 fa                	mov    %edi,%edx
+ d7b:	39 3d 1c 22 00 00    	cmp    %edi,0x221c
+ d81:	75 ed                	jne    d70 <malloc+0x50>
+  p = sbrk(nu * sizeof(Header));
+ d83:	83 ec 0c             	sub    $0xc,%esp
+ d86:	ff 75 e4             	push   -0x1c(%ebp)
+ d89:	e8 4a f8 ff ff       	call   5d8 <sbrk>
+  if(p == (char*)-1)
+ d8e:	83 c4 10             	add    $0x10,%esp
+ d91:	83 f8 ff             	cmp    $0xffffffff,%eax
+ d94:	74 15                	je     dab <malloc+0x8b>
+  hp->s.size = nu;
+ d96:	89 58 04             	mov    %ebx,0x4(%eax)
+  freeblock((void*)(hp + 1));
+ d99:	83 c0 08             	add    $0x8,%eax
+ d9c:	e8 cf fe ff ff       	call   c70 <freeblock>
+  return freep;
+ da1:	8b 15 1c 22 00 00    	mov    0x221c,%edx
+      if((p = morecore(nunits)) == 0){
+ da7:	85 d2                	test   %edx,%edx
+ da9:	75 c5                	jne    d70 <malloc+0x50>
+        umtxunlock(&lock);
+ dab:	83 ec 0c             	sub    $0xc,%esp
+ dae:	68 18 22 00 00       	push   $0x2218
+ db3:	e8 68 f7 ff ff       	call   520 <umtxunlock>
+        return 0;
+ db8:	83 c4 10             	add    $0x10,%esp
+      }
+  }
+}
+ dbb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ dbe:	31 c0                	xor    %eax,%eax
+}
+ dc0:	5b                   	pop    %ebx
+ dc1:	5e                   	pop    %esi
+ dc2:	5f                   	pop    %edi
+ dc3:	5d                   	pop    %ebp
+ dc4:	c3                   	ret
+ dc5:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ dc8:	39 c6                	cmp    %eax,%esi
+ dca:	74 64                	je     e30 <malloc+0x110>
+        p->s.size -= nunits;
+ dcc:	29 f0                	sub    %esi,%eax
+ dce:	89 47 04             	mov    %eax,0x4(%edi)
+        p += p->s.size;
+ dd1:	8d 3c c7             	lea    (%edi,%eax,8),%edi
+        p->s.size = nunits;
+ dd4:	89 77 04             	mov    %esi,0x4(%edi)
+      umtxunlock(&lock);
+ dd7:	83 ec 0c             	sub    $0xc,%esp
+      freep = prevp;
+ dda:	89 15 1c 22 00 00    	mov    %edx,0x221c
+      umtxunlock(&lock);
+ de0:	68 18 22 00 00       	push   $0x2218
+ de5:	e8 36 f7 ff ff       	call   520 <umtxunlock>
+      return (void*)(p + 1);
+ dea:	83 c4 10             	add    $0x10,%esp
+}
+ ded:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ df0:	8d 47 08             	lea    0x8(%edi),%eax
+}
+ df3:	5b                   	pop    %ebx
+ df4:	5e                   	pop    %esi
+ df5:	5f                   	pop    %edi
+ df6:	5d                   	pop    %ebp
+ df7:	c3                   	ret
+ df8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ dff:	90                   	nop
+    base.s.ptr = freep = prevp = &base;
+ e00:	c7 05 1c 22 00 00 20 	movl   $0x2220,0x221c
+ e07:	22 00 00 
+    base.s.size = 0;
+ e0a:	bf 20 22 00 00       	mov    $0x2220,%edi
+    base.s.ptr = freep = prevp = &base;
+ e0f:	c7 05 20 22 00 00 20 	movl   $0x2220,0x2220
+ e16:	22 00 00 
+    base.s.size = 0;
+ e19:	c7 05 24 22 00 00 00 	movl   $0x0,0x2224
+ e20:	00 00 00 
+    if(p->s.size >= nunits){
+ e23:	e9 31 ff ff ff       	jmp    d59 <malloc+0x39>
+ e28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e2f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ e30:	8b 07                	mov    (%edi),%eax
+ e32:	89 02                	mov    %eax,(%edx)
+ e34:	eb a1                	jmp    dd7 <malloc+0xb7>
+ e36:	66 90                	xchg   %ax,%ax
+ e38:	66 90                	xchg   %ax,%ax
+ e3a:	66 90                	xchg   %ax,%ax
+ e3c:	66 90                	xchg   %ax,%ax
+ e3e:	66 90                	xchg   %ax,%ax
+
+00000e40 <threadstart>:
+
+#define TSTACKSZ 4096
+
+static void
+threadstart(void *fn, void *arg)
+{
+ e40:	55                   	push   %ebp
+ e41:	89 e5                	mov    %esp,%ebp
+ e43:	83 ec 14             	sub    $0x14,%esp
+  ((void (*)(void*))fn)(arg);
+ e46:	ff 75 0c             	push   0xc(%ebp)
+ e49:	ff 55 08             	call   *0x8(%ebp)
+  exit();
+ e4c:	e8 ef f4 ff ff       	call   340 <exit>
+ e51:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e5f:	90                   	nop
+
+00000e60 <thread_create>:
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ e60:	55                   	push   %ebp
+ e61:	89 e5                	mov    %esp,%ebp
+ e63:	53                   	push   %ebx
+ e64:	83 ec 20             	sub    $0x20,%esp
+  char *mem, *stack;
+  int pid;
+
+  if((mem = malloc(2*TSTACKSZ)) == 0)
+ e67:	68 00 20 00 00       	push   $0x2000
+ e6c:	e8 af fe ff ff       	call   d20 <malloc>
+ e71:	83 c4 10             	add    $0x10,%esp
+ e74:	85 c0                	test   %eax,%eax
+ e76:	74 47                	je     ebf <thread_create+0x5f>
+ e78:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)(((uint)mem + TSTACKSZ - 1) & ~(TSTACKSZ - 1));
+ e7a:	8d 80 ff 0f 00 00    	lea    0xfff(%eax),%eax
+ e80:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  *(char**)stack = mem;
+ e85:	89 18                	mov    %ebx,(%eax)
+  if((pid = clone(threadstart, (void*)fn, arg, stack)) < 0)
+ e87:	50                   	push   %eax
+ e88:	ff 75 0c             	push   0xc(%ebp)
+ e8b:	ff 75 08             	push   0x8(%ebp)
+ e8e:	68 40 0e 00 00       	push   $0xe40
+ e93:	e8 08 f8 ff ff       	call   6a0 <clone>
+ e98:	83 c4 10             	add    $0x10,%esp
+ e9b:	85 c0                	test   %eax,%eax
+ e9d:	78 09                	js     ea8 <thread_create+0x48>
+    free(mem);
+  return pid;
+}
+ e9f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ ea2:	c9                   	leave
+ ea3:	c3                   	ret
+ ea4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    free(mem);
+ ea8:	83 ec 0c             	sub    $0xc,%esp
+ eab:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ eae:	53                   	push   %ebx
+ eaf:	e8 3c fe ff ff       	call   cf0 <free>
+ eb4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ eb7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+ eba:	83 c4 10             	add    $0x10,%esp
+}
+ ebd:	c9                   	leave
+ ebe:	c3                   	ret
+    return -1;
+ ebf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ ec4:	eb d9                	jmp    e9f <thread_create+0x3f>
+ ec6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ecd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ed0 <thread_join>:
+
+int
+thread_join(void)
+{
+ ed0:	55                   	push   %ebp
+ ed1:	89 e5                	mov    %esp,%ebp
+ ed3:	83 ec 34             	sub    $0x34,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+ ed6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ ed9:	50                   	push   %eax
+ eda:	e8 c9 f7 ff ff       	call   6a8 <join>
+ edf:	83 c4 10             	add    $0x10,%esp
+ ee2:	85 c0                	test   %eax,%eax
+ ee4:	79 0a                	jns    ef0 <thread_join+0x20>
+    free(*(char**)stack);
+  return pid;
+}
+ ee6:	c9                   	leave
+ ee7:	c3                   	ret
+ ee8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ eef:	90                   	nop
+    free(*(char**)stack);
+ ef0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ ef3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ ef6:	83 ec 0c             	sub    $0xc,%esp
+ ef9:	ff 32                	push   (%edx)
+ efb:	e8 f0 fd ff ff       	call   cf0 <free>
+ f00:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ f03:	83 c4 10             	add    $0x10,%esp
+}
+ f06:	c9                   	leave
+ f07:	c3                   	ret
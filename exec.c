@@ -12,11 +12,12 @@ exec(char *path, char **argv)
 {
   char *s, *last;
   int i, off;
-  uint argc, sz, sp, ustack[3+MAXARG+1];
+  uint argc, sz, textsz, sp, ustack[3+MAXARG+1];
   struct elfhdr elf;
   struct inode *ip;
   struct proghdr ph;
-  pde_t *pgdir, *oldpgdir;
+  pde_t *pgdir;
+  struct vm *vm, *oldvm;
   struct proc *curproc = myproc();
 
   begin_op();
@@ -28,6 +29,7 @@ exec(char *path, char **argv)
   }
   ilock(ip);
   pgdir = 0;
+  vm = 0;
 
   // Check ELF header
   if(readi(ip, (char*)&elf, 0, sizeof(elf)) != sizeof(elf))
@@ -37,9 +39,13 @@ exec(char *path, char **argv)
 
   if((pgdir = setupkvm()) == 0)
     goto bad;
+  if((vm = allocvm()) == 0)
+    goto bad;
+  vm->stacklim = curproc->vm->stacklim;
+  vm->stackahead = curproc->vm->stackahead;
 
   // Load program into memory.
-  sz = 0;
+  sz = textsz = 0;
   for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
     if(readi(ip, (char*)&ph, off, sizeof(ph)) != sizeof(ph))
       goto bad;
@@ -49,10 +55,22 @@ exec(char *path, char **argv)
       goto bad;
     if(ph.vaddr + ph.memsz < ph.vaddr)
       goto bad;
-    if((sz = allocuvm(pgdir, sz, ph.vaddr + ph.memsz)) == 0)
-      goto bad;
     if(ph.vaddr % PGSIZE != 0)
       goto bad;
+    // Share read-only text that starts on a page of its
+    // own in the file, rather than load a copy.
+    if(!(ph.flags & ELF_PROG_FLAG_WRITE) && ph.off % PGSIZE == 0 &&
+       ph.memsz == ph.filesz && ph.memsz > 0 && ph.vaddr >= PGROUNDUP(sz) &&
+       ph.vaddr + ph.memsz < KERNBASE){
+      if(vmatext(vm, pgdir, ip, ph.vaddr, ph.off, ph.memsz) < 0)
+        goto bad;
+      sz = textsz = ph.vaddr + ph.memsz;
+      continue;
+    }
+    if(ph.vaddr < PGROUNDUP(textsz))
+      goto bad;
+    if((sz = allocuvm(pgdir, sz, ph.vaddr + ph.memsz)) == 0)
+      goto bad;
     if(loaduvm(pgdir, (char*)ph.vaddr, ip, ph.off, ph.filesz) < 0)
       goto bad;
   }
@@ -74,7 +92,7 @@ exec(char *path, char **argv)
     if(argc >= MAXARG)
       goto bad;
     sp = (sp - (strlen(argv[argc]) + 1)) & ~3;
-    if(copyout(pgdir, sp, argv[argc], strlen(argv[argc]) + 1) < 0)
+    if(copyoutuvm(pgdir, sp, argv[argc], strlen(argv[argc]) + 1) < 0)
       goto bad;
     ustack[3+argc] = sp;
   }
@@ -85,7 +103,7 @@ exec(char *path, char **argv)
   ustack[2] = sp - (argc+1)*4;  // argv pointer
 
   sp -= (3+argc+1) * 4;
-  if(copyout(pgdir, sp, ustack, (3+argc+1)*4) < 0)
+  if(copyoutuvm(pgdir, sp, ustack, (3+argc+1)*4) < 0)
     goto bad;
 
   // Save program name for debugging.
@@ -94,23 +112,32 @@ exec(char *path, char **argv)
       last = s+1;
   safestrcpy(curproc->name, last, sizeof(curproc->name));
 
+  // The other threads sharing the old memory are
+  // running the old program; they go.
+  if(vmsole() < 0)
+    goto bad;
+
   // Commit to the user image.
-  oldpgdir = curproc->pgdir;
-  curproc->pgdir = pgdir;
-  curproc->sz = sz;
-  curproc->stacksz = KERNBASE - 2 * PGSIZE;
+  unpin(curproc);
+  oldvm = curproc->vm;
+  curproc->vm = vm;
+  vm->pgdir = pgdir;
+  vm->sz = sz;
   curproc->tf->eip = elf.entry;  // main
   curproc->tf->esp = sp;
   switchuvm(curproc);
-  freevm(oldpgdir);
+  vmput(oldvm);
   return 0;
 
  bad:
-  if(pgdir)
-    freevm(pgdir);
   if(ip){
     iunlockput(ip);
     end_op();
   }
+  if(vm){
+    vm->pgdir = pgdir;
+    vmput(vm);
+  } else if(pgdir)
+    freevm(pgdir);
   return -1;
 }
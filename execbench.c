@@ -0,0 +1,83 @@
+// Start NSH shells one after another and leave them all waiting
+// for input, timing each from fork() until it prints its prompt,
+// then count the memory they take between them. exec() maps a
+// program's text from the page cache, so every shell shares one
+// copy of sh's text and only its data, stack and page tables
+// are its own.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "iostat.h"
+
+#define NSH 50
+
+static inline uint
+cycles(void)
+{
+  uint lo, hi;
+
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+  return lo;
+}
+
+int
+main(int argc, char *argv[])
+{
+  char *args[] = { "sh", 0 };
+  int in[2], out[2], i, n, pid;
+  uint c, total, worst;
+  struct iostat before, after;
+  char buf[2];
+
+  if(pipe(in) < 0 || pipe(out) < 0){
+    printf(2, "execbench: pipe failed\n");
+    exit();
+  }
+  iostat(&before);
+  total = worst = 0;
+  for(n = 0; n < NSH; n++){
+    c = cycles();
+    if((pid = fork()) < 0)
+      break;
+    if(pid == 0){
+      // Input from in, prompts to out.
+      close(0);
+      dup(in[0]);
+      close(1);
+      dup(out[1]);
+      close(2);
+      dup(out[1]);
+      close(in[0]);
+      close(in[1]);
+      close(out[0]);
+      close(out[1]);
+      exec("sh", args);
+      printf(2, "execbench: exec sh failed\n");
+      exit();
+    }
+    if(read(out[0], buf, 2) != 2)
+      break;
+    c = cycles() - c;
+    total += c;
+    if(c > worst)
+      worst = c;
+  }
+  iostat(&after);
+
+  // End of input: each shell exits.
+  close(in[1]);
+  for(i = 0; i < n; i++)
+    wait();
+
+  if(n == 0){
+    printf(2, "execbench: no shell started\n");
+    exit();
+  }
+  printf(1, "execbench: %d shells: fork+exec %d cycles on average, %d at worst\n",
+         n, total / n, worst);
+  printf(1, "execbench: %d KB of memory for all %d, %d KB per shell\n",
+         (before.freemem - after.freemem) * 4, n,
+         (before.freemem - after.freemem) * 4 / n);
+  exit();
+}
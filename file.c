@@ -9,6 +9,12 @@
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "file.h"
+#include "mmu.h"
+#include "proc.h"
+#include "memlayout.h"
+#include "stat.h"
+#include "pcache.h"
+#include "uio.h"
 
 struct devsw devsw[NDEV];
 struct {
@@ -16,10 +22,154 @@ struct {
   struct file file[NFILE];
 } ftable;
 
+// One table for each process can use at most, so
+// allocating one cannot fail.
+struct {
+  struct spinlock lock;
+  struct files files[NPROC];
+} fdtable;
+
 void
 fileinit(void)
 {
+  struct files *fs;
+
   initlock(&ftable.lock, "ftable");
+  initlock(&fdtable.lock, "fdtable");
+  for(fs = fdtable.files; fs < &fdtable.files[NPROC]; fs++)
+    initlock(&fs->lock, "files");
+}
+
+// Allocate an empty table of open files, with cwd as
+// its working directory. A slot is free when no thread
+// uses it and the last one has finished closing its files.
+struct files*
+filesalloc(struct inode *cwd)
+{
+  struct files *fs;
+
+  acquire(&fdtable.lock);
+  for(fs = fdtable.files; fs < &fdtable.files[NPROC]; fs++){
+    if(fs->ref == 0 && fs->cwd == 0){
+      fs->ref = 1;
+      release(&fdtable.lock);
+      memset(fs->ofile, 0, sizeof(fs->ofile));
+      fs->cwd = cwd;
+      return fs;
+    }
+  }
+  panic("filesalloc");
+}
+
+// Copy fs, for fork().
+struct files*
+filescopy(struct files *fs)
+{
+  struct files *nfs;
+  int fd;
+
+  nfs = filesalloc(0);
+  acquire(&fs->lock);
+  for(fd = 0; fd < NOFILE; fd++)
+    if(fs->ofile[fd])
+      nfs->ofile[fd] = filedup(fs->ofile[fd]);
+  nfs->cwd = idup(fs->cwd);
+  release(&fs->lock);
+  return nfs;
+}
+
+// Share fs with one more thread, for clone().
+struct files*
+filesdup(struct files *fs)
+{
+  acquire(&fdtable.lock);
+  fs->ref++;
+  release(&fdtable.lock);
+  return fs;
+}
+
+// Drop a thread's reference to fs. The last thread to
+// let go closes the files.
+void
+filesput(struct files *fs)
+{
+  int fd;
+
+  acquire(&fdtable.lock);
+  if(--fs->ref > 0){
+    release(&fdtable.lock);
+    return;
+  }
+  release(&fdtable.lock);
+  for(fd = 0; fd < NOFILE; fd++){
+    if(fs->ofile[fd]){
+      fileclose(fs->ofile[fd]);
+      fs->ofile[fd] = 0;
+    }
+  }
+  begin_op();
+  iput(fs->cwd);
+  end_op();
+  acquire(&fdtable.lock);
+  fs->cwd = 0;
+  release(&fdtable.lock);
+}
+
+// Return the file open as fd in the current process,
+// or 0. While other threads share the table, one of
+// them may close fd at any time, so the current thread
+// holds a reference to the file until fdput().
+struct file*
+fdget(int fd)
+{
+  struct proc *p = myproc();
+  struct files *fs = p->files;
+  struct file *f;
+  int i;
+
+  if(fd < 0 || fd >= NOFILE)
+    return 0;
+  acquire(&fs->lock);
+  if((f = fs->ofile[fd]) != 0 && fs->ref > 1){
+    for(i = 0; i < NELEM(p->fdref) && p->fdref[i]; i++)
+      ;
+    if(i < NELEM(p->fdref))
+      p->fdref[i] = filedup(f);
+    else
+      f = 0;
+  }
+  release(&fs->lock);
+  return f;
+}
+
+// Let go of the files fdget() gave p, when its system
+// call returns.
+void
+fdput(struct proc *p)
+{
+  int i;
+
+  for(i = 0; i < NELEM(p->fdref); i++){
+    if(p->fdref[i]){
+      fileclose(p->fdref[i]);
+      p->fdref[i] = 0;
+    }
+  }
+}
+
+// How many references to f the current thread holds
+// only for its system call; see fdget().
+static int
+fdheld(struct file *f)
+{
+  struct proc *p = myproc();
+  int i, n;
+
+  n = 0;
+  for(i = 0; i < NELEM(p->fdref); i++)
+    if(p->fdref[i] == f)
+      n++;
+  return n;
 }
 
 // Allocate a file structure.
@@ -84,30 +234,90 @@ int
 filestat(struct file *f, struct stat *st)
 {
   if(f->type == FD_INODE){
-    ilock(f->ip);
+    ilockshared(f->ip);
     stati(f->ip, st);
-    iunlock(f->ip);
+    iunlockshared(f->ip);
     return 0;
   }
   return -1;
 }
 
+// Read from inode file f at f->off.
+static int
+readinode(struct file *f, char *addr, int n)
+{
+  int r;
+
+  // Processes reading a regular file through their own
+  // opens of it share its lock. f->off still needs the
+  // lock to itself when f is shared, by dup(), fork(), or
+  // threads that hold it through fdget(), and a device's
+  // read routine may drop the lock while it waits.
+  if(f->ip->type == T_FILE && f->ref == 1 + fdheld(f)){
+    ilockshared(f->ip);
+    if((r = readi(f->ip, addr, f->off, n)) > 0)
+      f->off += r;
+    iunlockshared(f->ip);
+    return r;
+  }
+  ilock(f->ip);
+  if((r = readi(f->ip, addr, f->off, n)) > 0)
+    f->off += r;
+  iunlock(f->ip);
+  return r;
+}
+
+// Write n bytes at addr to inode file f at f->off,
+// in one log transaction.
+static int
+writeinode(struct file *f, char *addr, int n)
+{
+  int r;
+
+  begin_op();
+  ilock(f->ip);
+  if ((r = writei(f->ip, addr, f->off, n)) > 0)
+    f->off += r;
+  iunlock(f->ip);
+  end_op();
+  return r;
+}
+
+// Whether a read or write of inode file f that failed on
+// the n bytes at addr is worth another try: it was the
+// user's buffer that was not all there, and checkptr()
+// has now brought it in. A device's routine is not tried
+// twice; sys_read() and sys_write() check its buffer first.
+static int
+retryable(struct file *f, char *addr, int n)
+{
+  return f->ip->type != T_DEV && (uint)addr < KERNBASE &&
+         checkptr((uint)addr, n) == 0;
+}
+
 // Read from file f.
 int
 fileread(struct file *f, char *addr, int n)
 {
-  int r;
+  int r, tot;
 
   if(f->readable == 0)
     return -1;
   if(f->type == FD_PIPE)
     return piperead(f->pipe, addr, n);
   if(f->type == FD_INODE){
-    ilock(f->ip);
-    if((r = readi(f->ip, addr, f->off, n)) > 0)
-      f->off += r;
-    iunlock(f->ip);
-    return r;
+    // readi() copies straight into user memory and stops
+    // at a page of it that is missing. Bring the pages in
+    // with the lock dropped, then go on from there.
+    tot = 0;
+    do {
+      if((r = readinode(f, addr + tot, n - tot)) < 0 &&
+         retryable(f, addr + tot, n - tot))
+        r = readinode(f, addr + tot, n - tot);
+      if(r > 0)
+        tot += r;
+    } while(r > 0 && tot < n && f->ip->type != T_DEV);
+    return tot > 0 ? tot : r;
   }
   panic("fileread");
 }
@@ -137,21 +347,321 @@ filewrite(struct file *f, char *addr, int n)
       if(n1 > max)
         n1 = max;
 
+      // writei() stops short at a page of the buffer that
+      // is missing; bring it in and go on from there.
+      if((r = writeinode(f, addr + i, n1)) < 0 && retryable(f, addr + i, n1))
+        r = writeinode(f, addr + i, n1);
+      if(r < 0)
+        break;
+      i += r;
+    }
+    return i > 0 || n == 0 ? i : -1;
+  }
+  panic("filewrite");
+}
+
+// Read from file f into the buffers of iov in order.
+// A pipe is read under one hold of its lock; an inode
+// under one hold of its sleeplock, unless a buffer page
+// is missing and has to be brought in, as in fileread().
+int
+filereadv(struct file *f, struct iovec *iov, int cnt)
+{
+  int k, r, n, retried;
+  uint i;
+
+  if(f->readable == 0)
+    return -1;
+  if(f->type == FD_PIPE)
+    return pipereadv(f->pipe, iov, cnt);
+  if(f->type == FD_INODE){
+    n = 0;
+    r = 0;
+    retried = 0;
+    ilock(f->ip);
+    for(k = 0, i = 0; k < cnt; ){
+      if(i == iov[k].iov_len){
+        k++;
+        i = 0;
+        continue;
+      }
+      r = readi(f->ip, (char*)iov[k].iov_base + i, f->off, iov[k].iov_len - i);
+      if(r < 0){
+        if(retried)
+          break;
+        iunlock(f->ip);
+        retried = 1;
+        r = retryable(f, (char*)iov[k].iov_base + i, iov[k].iov_len - i);
+        ilock(f->ip);
+        if(r)
+          continue;
+        break;
+      }
+      retried = 0;
+      f->off += r;
+      n += r;
+      i += r;
+      // End of file, or a device that had no more.
+      if(r == 0 || (f->ip->type == T_DEV && i < iov[k].iov_len))
+        break;
+    }
+    iunlock(f->ip);
+    return n > 0 ? n : (r < 0 ? -1 : 0);
+  }
+  panic("filereadv");
+}
+
+// Write the buffers of iov to file f in order.
+// A pipe takes them under one hold of its lock. An inode
+// takes as many as fit in each log transaction, as much
+// data as filewrite() puts in one, splitting large buffers.
+int
+filewritev(struct file *f, struct iovec *iov, int cnt)
+{
+  int max = ((MAXOPBLOCKS-1-1-2) / 2) * 512;
+  int k, n, n1, done, r, retried, stopped;
+  uint i;
+
+  if(f->writable == 0)
+    return -1;
+  if(f->type == FD_PIPE)
+    return pipewritev(f->pipe, iov, cnt);
+  if(f->type == FD_INODE){
+    n = 0;
+    k = 0;
+    i = 0;
+    retried = 0;
+    while(k < cnt){
+      stopped = 0;
       begin_op();
       ilock(f->ip);
-      if ((r = writei(f->ip, addr + i, f->off, n1)) > 0)
-        f->off += r;
+      for(done = 0; k < cnt && done < max; done += n1){
+        if(i == iov[k].iov_len){
+          k++;
+          i = 0;
+          n1 = 0;
+          continue;
+        }
+        n1 = iov[k].iov_len - i;
+        if(n1 > max - done)
+          n1 = max - done;
+        if((r = writei(f->ip, (char*)iov[k].iov_base + i, f->off, n1)) > 0){
+          f->off += r;
+          i += r;
+          n += r;
+          retried = 0;
+        }
+        if(r != n1){
+          stopped = 1;
+          break;
+        }
+      }
       iunlock(f->ip);
       end_op();
+      // The rest of the buffer is missing, or the disk is
+      // full. Bring the buffer in, once, and go on.
+      if(stopped){
+        if(retried || f->ip->type == T_DEV ||
+           !retryable(f, (char*)iov[k].iov_base + i, iov[k].iov_len - i))
+          return n > 0 ? n : -1;
+        retried = 1;
+      }
+    }
+    return n;
+  }
+  panic("filewritev");
+}
 
-      if(r < 0)
-        break;
-      if(r != n1)
-        panic("short filewrite");
-      i += r;
+//PAGEBREAK!
+// Move up to n bytes of regular file f into pipe p,
+// copying them straight from the page cache.
+static int
+splicetopipe(struct file *f, struct pipe *p, int n)
+{
+  struct inode *ip = f->ip;
+  struct page *pg;
+  uint off, m;
+  int tot;
+
+  for(tot = 0; tot < n; tot += m){
+    ilock(ip);
+    off = f->off;
+    if(ip->type != T_FILE || off >= ip->size){
+      iunlock(ip);
+      break;
     }
-    return i == n ? n : -1;
+    m = n - tot;
+    if(m > PGSIZE - off%PGSIZE)
+      m = PGSIZE - off%PGSIZE;
+    if(m > ip->size - off)
+      m = ip->size - off;
+    pg = igetpage(ip, off/PGSIZE);
+    iunlock(ip);
+    if(pg == 0)
+      break;
+    // The page reference keeps the data in place while
+    // pipewrite() waits for room.
+    if(pipewrite(p, pg->data + off%PGSIZE, m) < 0){
+      pcput(pg);
+      return tot > 0 ? tot : -1;
+    }
+    pcput(pg);
+    f->off = off + m;
   }
-  panic("filewrite");
+  return tot;
+}
+
+// Move what pipe p holds, up to n bytes, into file f.
+static int
+splicefrompipe(struct pipe *p, struct file *f, int n)
+{
+  char *buf;
+  int r;
+
+  if((buf = kalloc()) == 0)
+    return -1;
+  if(n > PGSIZE)
+    n = PGSIZE;
+  if((r = piperead(p, buf, n)) > 0 && filewrite(f, buf, r) != r)
+    r = -1;
+  kfree(buf);
+  return r;
+}
+
+// Move up to n bytes from file in to file out without
+// copying them through user space. One of the two must
+// be a pipe; the other a regular file when reading from
+// it, or any inode when writing to it.
+// Returns the number of bytes moved, 0 at end of file,
+// or -1.
+int
+filesplice(struct file *in, struct file *out, int n)
+{
+  if(in->readable == 0 || out->writable == 0 || n < 0)
+    return -1;
+  if(in->type == FD_INODE && out->type == FD_PIPE){
+    if(in->ip->type != T_FILE)
+      return -1;
+    return splicetopipe(in, out->pipe, n);
+  }
+  if(in->type == FD_PIPE && out->type == FD_INODE)
+    return splicefrompipe(in->pipe, out, n);
+  return -1;
+}
+
+// Copy up to n bytes that pipe in holds into pipe out,
+// leaving them in the pipe in.
+// Returns the number of bytes copied, or -1.
+int
+filetee(struct file *in, struct file *out, int n)
+{
+  char *buf;
+  int r;
+
+  if(in->readable == 0 || out->writable == 0 || n < 0)
+    return -1;
+  if(in->type != FD_PIPE || out->type != FD_PIPE || in->pipe == out->pipe)
+    return -1;
+  if((buf = kalloc()) == 0)
+    return -1;
+  if(n > PGSIZE)
+    n = PGSIZE;
+  if((r = pipepeek(in->pipe, buf, n)) > 0 && pipewrite(out->pipe, buf, r) < 0)
+    r = -1;
+  kfree(buf);
+  return r;
 }
 
+//PAGEBREAK!
+// Log blocks a filecopy() transaction reserves, and the file
+// data it can carry: the rest covers the inode, two bitmap
+// blocks, three indirect blocks and a partial block at the
+// start, as the copied bytes land in one contiguous run.
+#define COPYOPBLOCKS (2*MAXOPBLOCKS)
+#define COPYOPBYTES  ((COPYOPBLOCKS-1-2-3-1) * BSIZE)
+
+// Lock two different inodes, the lower address first.
+static void
+ilock2(struct inode *a, struct inode *b)
+{
+  if(a < b){
+    ilock(a);
+    ilock(b);
+  } else {
+    ilock(b);
+    ilock(a);
+  }
+}
+
+static void
+iunlock2(struct inode *a, struct inode *b)
+{
+  iunlock(a);
+  iunlock(b);
+}
+
+// Copy up to n bytes from regular file in to file out without
+// copying them through user space: straight from the page
+// cache into out, several pages per log transaction when out
+// is a file, or to a device such as the console.
+// Returns the number of bytes copied, 0 at end of file, or -1.
+int
+filecopy(struct file *in, struct file *out, int n)
+{
+  struct inode *ip = in->ip;
+  struct page *pg;
+  uint off, m;
+  int tot, done, r;
+
+  if(in->readable == 0 || out->writable == 0 || n < 0)
+    return -1;
+  if(in->type != FD_INODE || ip->type != T_FILE)
+    return -1;
+  if(out->type == FD_PIPE)
+    return splicetopipe(in, out->pipe, n);
+  if(out->type != FD_INODE || out->ip == ip)
+    return -1;
+
+  tot = 0;
+  while(tot < n){
+    begin_opn(COPYOPBLOCKS);
+    for(done = 0; tot < n && done < COPYOPBYTES; done += m, tot += m){
+      // Hold both inodes, so that both offsets move under
+      // their locks; lock them in address order, so that
+      // copies between two files both ways cannot deadlock.
+      ilock2(ip, out->ip);
+      off = in->off;
+      if(off >= ip->size){
+        iunlock2(ip, out->ip);
+        break;
+      }
+      m = n - tot;
+      if(m > COPYOPBYTES - done)
+        m = COPYOPBYTES - done;
+      if(m > PGSIZE - off%PGSIZE)
+        m = PGSIZE - off%PGSIZE;
+      if(m > ip->size - off)
+        m = ip->size - off;
+      if((pg = igetpage(ip, off/PGSIZE)) == 0){
+        iunlock2(ip, out->ip);
+        break;
+      }
+      if((r = writei(out->ip, pg->data + off%PGSIZE, out->off, m)) > 0){
+        out->off += r;
+        in->off = off + r;
+      }
+      iunlock2(ip, out->ip);
+      pcput(pg);
+      if(r != m){
+        end_opn(COPYOPBLOCKS);
+        if(r > 0)
+          tot += r;
+        return tot > 0 ? tot : -1;
+      }
+    }
+    end_opn(COPYOPBLOCKS);
+    if(done == 0)
+      break;
+  }
+  return tot;
+}
@@ -8,6 +8,15 @@ struct file {
   uint off;
 };
 
+// Open files and working directory of a process, shared
+// by the threads clone() makes as their struct vm is.
+struct files {
+  struct spinlock lock; // protects everything below here
+  int ref;              // Threads using it
+  struct file *ofile[NOFILE];  // Open files
+  struct inode *cwd;    // Current directory
+};
+
 
 // in-memory copy of an inode
 struct inode {
@@ -22,7 +31,7 @@ struct inode {
   short minor;
   short nlink;
   uint size;
-  uint addrs[NDIRECT+1];
+  uint addrs[NINLINE/sizeof(uint)];
 };
 
 // table mapping major device number to
@@ -0,0 +1,1202 @@
+
+_forktest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <printf>:
+
+#define N  1000
+
+void
+printf(int fd, const char *s, ...)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	53                   	push   %ebx
+   4:	83 ec 10             	sub    $0x10,%esp
+   7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  write(fd, s, strlen(s));
+   a:	53                   	push   %ebx
+   b:	e8 a0 01 00 00       	call   1b0 <strlen>
+  10:	83 c4 0c             	add    $0xc,%esp
+  13:	50                   	push   %eax
+  14:	53                   	push   %ebx
+  15:	ff 75 08             	push   0x8(%ebp)
+  18:	e8 a3 04 00 00       	call   4c0 <write>
+}
+  1d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  20:	83 c4 10             	add    $0x10,%esp
+  23:	c9                   	leave
+  24:	c3                   	ret
+  25:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000030 <forktest>:
+
+void
+forktest(void)
+{
+  30:	55                   	push   %ebp
+  31:	89 e5                	mov    %esp,%ebp
+  33:	53                   	push   %ebx
+  int n, pid;
+
+  printf(1, "fork test\n");
+
+  for(n=0; n<N; n++){
+  34:	31 db                	xor    %ebx,%ebx
+{
+  36:	83 ec 10             	sub    $0x10,%esp
+  write(fd, s, strlen(s));
+  39:	68 68 07 00 00       	push   $0x768
+  3e:	e8 6d 01 00 00       	call   1b0 <strlen>
+  43:	83 c4 0c             	add    $0xc,%esp
+  46:	50                   	push   %eax
+  47:	68 68 07 00 00       	push   $0x768
+  4c:	6a 01                	push   $0x1
+  4e:	e8 6d 04 00 00       	call   4c0 <write>
+  53:	83 c4 10             	add    $0x10,%esp
+  56:	eb 19                	jmp    71 <forktest+0x41>
+  58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  5f:	90                   	nop
+    pid = fork();
+    if(pid < 0)
+      break;
+    if(pid == 0)
+  60:	74 5b                	je     bd <forktest+0x8d>
+  for(n=0; n<N; n++){
+  62:	83 c3 01             	add    $0x1,%ebx
+  65:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+  6b:	0f 84 86 00 00 00    	je     f7 <forktest+0xc7>
+    pid = fork();
+  71:	e8 4a 03 00 00       	call   3c0 <fork>
+    if(pid < 0)
+  76:	85 c0                	test   %eax,%eax
+  78:	79 e6                	jns    60 <forktest+0x30>
+  if(n == N){
+    printf(1, "fork claimed to work N times!\n", N);
+    exit();
+  }
+
+  for(; n > 0; n--){
+  7a:	85 db                	test   %ebx,%ebx
+  7c:	74 10                	je     8e <forktest+0x5e>
+  7e:	66 90                	xchg   %ax,%ax
+    if(wait() < 0){
+  80:	e8 83 05 00 00       	call   608 <wait>
+  85:	85 c0                	test   %eax,%eax
+  87:	78 39                	js     c2 <forktest+0x92>
+  for(; n > 0; n--){
+  89:	83 eb 01             	sub    $0x1,%ebx
+  8c:	75 f2                	jne    80 <forktest+0x50>
+      printf(1, "wait stopped early\n");
+      exit();
+    }
+  }
+
+  if(wait() != -1){
+  8e:	e8 75 05 00 00       	call   608 <wait>
+  93:	83 f8 ff             	cmp    $0xffffffff,%eax
+  96:	75 4c                	jne    e4 <forktest+0xb4>
+  write(fd, s, strlen(s));
+  98:	83 ec 0c             	sub    $0xc,%esp
+  9b:	68 9a 07 00 00       	push   $0x79a
+  a0:	e8 0b 01 00 00       	call   1b0 <strlen>
+  a5:	83 c4 0c             	add    $0xc,%esp
+  a8:	50                   	push   %eax
+  a9:	68 9a 07 00 00       	push   $0x79a
+  ae:	6a 01                	push   $0x1
+  b0:	e8 0b 04 00 00       	call   4c0 <write>
+    printf(1, "wait got too many\n");
+    exit();
+  }
+
+  printf(1, "fork test OK\n");
+}
+  b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  b8:	83 c4 10             	add    $0x10,%esp
+  bb:	c9                   	leave
+  bc:	c3                   	ret
+      exit();
+  bd:	e8 2e 03 00 00       	call   3f0 <exit>
+  write(fd, s, strlen(s));
+  c2:	83 ec 0c             	sub    $0xc,%esp
+  c5:	68 73 07 00 00       	push   $0x773
+  ca:	e8 e1 00 00 00       	call   1b0 <strlen>
+  cf:	83 c4 0c             	add    $0xc,%esp
+  d2:	50                   	push   %eax
+  d3:	68 73 07 00 00       	push   $0x773
+  d8:	6a 01                	push   $0x1
+  da:	e8 e1 03 00 00       	call   4c0 <write>
+      exit();
+  df:	e8 0c 03 00 00       	call   3f0 <exit>
+    printf(1, "wait got too many\n");
+  e4:	50                   	push   %eax
+  e5:	50                   	push   %eax
+  e6:	68 87 07 00 00       	push   $0x787
+  eb:	6a 01                	push   $0x1
+  ed:	e8 0e ff ff ff       	call   0 <printf>
+    exit();
+  f2:	e8 f9 02 00 00       	call   3f0 <exit>
+    printf(1, "fork claimed to work N times!\n", N);
+  f7:	52                   	push   %edx
+  f8:	68 e8 03 00 00       	push   $0x3e8
+  fd:	68 a8 07 00 00       	push   $0x7a8
+ 102:	6a 01                	push   $0x1
+ 104:	e8 f7 fe ff ff       	call   0 <printf>
+    exit();
+ 109:	e8 e2 02 00 00       	call   3f0 <exit>
+ 10e:	66 90                	xchg   %ax,%ax
+
+00000110 <main>:
+
+int
+main(void)
+{
+ 110:	55                   	push   %ebp
+ 111:	89 e5                	mov    %esp,%ebp
+ 113:	83 e4 f0             	and    $0xfffffff0,%esp
+  forktest();
+ 116:	e8 15 ff ff ff       	call   30 <forktest>
+  exit();
+ 11b:	e8 d0 02 00 00       	call   3f0 <exit>
+
+00000120 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 120:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 121:	31 c0                	xor    %eax,%eax
+{
+ 123:	89 e5                	mov    %esp,%ebp
+ 125:	53                   	push   %ebx
+ 126:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 129:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 12c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 130:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 134:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 137:	83 c0 01             	add    $0x1,%eax
+ 13a:	84 d2                	test   %dl,%dl
+ 13c:	75 f2                	jne    130 <strcpy+0x10>
+    ;
+  return os;
+}
+ 13e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 141:	89 c8                	mov    %ecx,%eax
+ 143:	c9                   	leave
+ 144:	c3                   	ret
+ 145:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000150 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	53                   	push   %ebx
+ 154:	8b 55 08             	mov    0x8(%ebp),%edx
+ 157:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 15a:	0f b6 02             	movzbl (%edx),%eax
+ 15d:	84 c0                	test   %al,%al
+ 15f:	75 17                	jne    178 <strcmp+0x28>
+ 161:	eb 3a                	jmp    19d <strcmp+0x4d>
+ 163:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 167:	90                   	nop
+ 168:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 16c:	83 c2 01             	add    $0x1,%edx
+ 16f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 172:	84 c0                	test   %al,%al
+ 174:	74 1a                	je     190 <strcmp+0x40>
+    p++, q++;
+ 176:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 178:	0f b6 19             	movzbl (%ecx),%ebx
+ 17b:	38 c3                	cmp    %al,%bl
+ 17d:	74 e9                	je     168 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 17f:	29 d8                	sub    %ebx,%eax
+}
+ 181:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 184:	c9                   	leave
+ 185:	c3                   	ret
+ 186:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 18d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 190:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 194:	31 c0                	xor    %eax,%eax
+ 196:	29 d8                	sub    %ebx,%eax
+}
+ 198:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 19b:	c9                   	leave
+ 19c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 19d:	0f b6 19             	movzbl (%ecx),%ebx
+ 1a0:	31 c0                	xor    %eax,%eax
+ 1a2:	eb db                	jmp    17f <strcmp+0x2f>
+ 1a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1af:	90                   	nop
+
+000001b0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1b6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1b9:	74 15                	je     1d0 <strlen+0x20>
+ 1bb:	31 c0                	xor    %eax,%eax
+ 1bd:	8d 76 00             	lea    0x0(%esi),%esi
+ 1c0:	83 c0 01             	add    $0x1,%eax
+ 1c3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1c7:	89 c1                	mov    %eax,%ecx
+ 1c9:	75 f5                	jne    1c0 <strlen+0x10>
+    ;
+  return n;
+}
+ 1cb:	89 c8                	mov    %ecx,%eax
+ 1cd:	5d                   	pop    %ebp
+ 1ce:	c3                   	ret
+ 1cf:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 1d0:	31 c9                	xor    %ecx,%ecx
+}
+ 1d2:	5d                   	pop    %ebp
+ 1d3:	89 c8                	mov    %ecx,%eax
+ 1d5:	c3                   	ret
+ 1d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001e0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	57                   	push   %edi
+ 1e4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1e7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1ed:	89 d7                	mov    %edx,%edi
+ 1ef:	fc                   	cld
+ 1f0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1f2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1f5:	89 d0                	mov    %edx,%eax
+ 1f7:	c9                   	leave
+ 1f8:	c3                   	ret
+ 1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000200 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	56                   	push   %esi
+ 204:	53                   	push   %ebx
+ 205:	8b 75 10             	mov    0x10(%ebp),%esi
+ 208:	8b 55 08             	mov    0x8(%ebp),%edx
+ 20b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+ 20e:	85 f6                	test   %esi,%esi
+ 210:	74 2e                	je     240 <memcmp+0x40>
+ 212:	01 c6                	add    %eax,%esi
+ 214:	eb 14                	jmp    22a <memcmp+0x2a>
+ 216:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 21d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+ 220:	83 c0 01             	add    $0x1,%eax
+ 223:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+ 226:	39 f0                	cmp    %esi,%eax
+ 228:	74 16                	je     240 <memcmp+0x40>
+    if(*s1 != *s2)
+ 22a:	0f b6 0a             	movzbl (%edx),%ecx
+ 22d:	0f b6 18             	movzbl (%eax),%ebx
+ 230:	38 d9                	cmp    %bl,%cl
+ 232:	74 ec                	je     220 <memcmp+0x20>
+      return *s1 - *s2;
+ 234:	0f b6 c1             	movzbl %cl,%eax
+ 237:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+ 239:	5b                   	pop    %ebx
+ 23a:	5e                   	pop    %esi
+ 23b:	5d                   	pop    %ebp
+ 23c:	c3                   	ret
+ 23d:	8d 76 00             	lea    0x0(%esi),%esi
+ 240:	5b                   	pop    %ebx
+  return 0;
+ 241:	31 c0                	xor    %eax,%eax
+}
+ 243:	5e                   	pop    %esi
+ 244:	5d                   	pop    %ebp
+ 245:	c3                   	ret
+ 246:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000250 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	8b 45 08             	mov    0x8(%ebp),%eax
+ 256:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 25a:	0f b6 10             	movzbl (%eax),%edx
+ 25d:	84 d2                	test   %dl,%dl
+ 25f:	75 12                	jne    273 <strchr+0x23>
+ 261:	eb 1d                	jmp    280 <strchr+0x30>
+ 263:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 267:	90                   	nop
+ 268:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 26c:	83 c0 01             	add    $0x1,%eax
+ 26f:	84 d2                	test   %dl,%dl
+ 271:	74 0d                	je     280 <strchr+0x30>
+    if(*s == c)
+ 273:	38 d1                	cmp    %dl,%cl
+ 275:	75 f1                	jne    268 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 277:	5d                   	pop    %ebp
+ 278:	c3                   	ret
+ 279:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 280:	31 c0                	xor    %eax,%eax
+}
+ 282:	5d                   	pop    %ebp
+ 283:	c3                   	ret
+ 284:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 28f:	90                   	nop
+
+00000290 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	57                   	push   %edi
+ 294:	56                   	push   %esi
+int
+read(int fd, void *buf, int n)
+{
+  if(flushhook)
+    flushhook();
+  return _read(fd, buf, n);
+ 295:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 298:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 299:	31 db                	xor    %ebx,%ebx
+{
+ 29b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 29e:	eb 32                	jmp    2d2 <gets+0x42>
+  if(flushhook)
+ 2a0:	a1 00 10 00 00       	mov    0x1000,%eax
+ 2a5:	85 c0                	test   %eax,%eax
+ 2a7:	74 02                	je     2ab <gets+0x1b>
+    flushhook();
+ 2a9:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+ 2ab:	83 ec 04             	sub    $0x4,%esp
+ 2ae:	6a 01                	push   $0x1
+ 2b0:	56                   	push   %esi
+ 2b1:	6a 00                	push   $0x0
+ 2b3:	e8 60 03 00 00       	call   618 <_read>
+    if(cc < 1)
+ 2b8:	83 c4 10             	add    $0x10,%esp
+ 2bb:	85 c0                	test   %eax,%eax
+ 2bd:	7e 1d                	jle    2dc <gets+0x4c>
+    buf[i++] = c;
+ 2bf:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 2c3:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2c6:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 2ca:	3c 0a                	cmp    $0xa,%al
+ 2cc:	74 10                	je     2de <gets+0x4e>
+ 2ce:	3c 0d                	cmp    $0xd,%al
+ 2d0:	74 0c                	je     2de <gets+0x4e>
+  for(i=0; i+1 < max; ){
+ 2d2:	89 df                	mov    %ebx,%edi
+ 2d4:	83 c3 01             	add    $0x1,%ebx
+ 2d7:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 2da:	7c c4                	jl     2a0 <gets+0x10>
+ 2dc:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+ 2de:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2e1:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+ 2e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2e8:	5b                   	pop    %ebx
+ 2e9:	5e                   	pop    %esi
+ 2ea:	5f                   	pop    %edi
+ 2eb:	5d                   	pop    %ebp
+ 2ec:	c3                   	ret
+ 2ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002f0 <stat>:
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	56                   	push   %esi
+ 2f4:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+ 2f5:	83 ec 08             	sub    $0x8,%esp
+ 2f8:	6a 00                	push   $0x0
+ 2fa:	ff 75 08             	push   0x8(%ebp)
+ 2fd:	e8 3e 03 00 00       	call   640 <open>
+  if(fd < 0)
+ 302:	83 c4 10             	add    $0x10,%esp
+ 305:	85 c0                	test   %eax,%eax
+ 307:	78 37                	js     340 <stat+0x50>
+  r = fstat(fd, st);
+ 309:	83 ec 08             	sub    $0x8,%esp
+ 30c:	ff 75 0c             	push   0xc(%ebp)
+ 30f:	89 c3                	mov    %eax,%ebx
+ 311:	50                   	push   %eax
+ 312:	e8 41 03 00 00       	call   658 <fstat>
+}
+
+int
+close(int fd)
+{
+  if(flushhook)
+ 317:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+ 31a:	89 c6                	mov    %eax,%esi
+  if(flushhook)
+ 31c:	a1 00 10 00 00       	mov    0x1000,%eax
+ 321:	85 c0                	test   %eax,%eax
+ 323:	74 02                	je     327 <stat+0x37>
+    flushhook();
+ 325:	ff d0                	call   *%eax
+  return _close(fd);
+ 327:	83 ec 0c             	sub    $0xc,%esp
+ 32a:	53                   	push   %ebx
+ 32b:	e8 f8 02 00 00       	call   628 <_close>
+ 330:	83 c4 10             	add    $0x10,%esp
+}
+ 333:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 336:	89 f0                	mov    %esi,%eax
+ 338:	5b                   	pop    %ebx
+ 339:	5e                   	pop    %esi
+ 33a:	5d                   	pop    %ebp
+ 33b:	c3                   	ret
+ 33c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+ 340:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 345:	eb ec                	jmp    333 <stat+0x43>
+ 347:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34e:	66 90                	xchg   %ax,%ax
+
+00000350 <atoi>:
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	53                   	push   %ebx
+ 354:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+ 357:	0f be 02             	movsbl (%edx),%eax
+ 35a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 35d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 360:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 365:	77 1e                	ja     385 <atoi+0x35>
+ 367:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 370:	83 c2 01             	add    $0x1,%edx
+ 373:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 376:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 37a:	0f be 02             	movsbl (%edx),%eax
+ 37d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 380:	80 fb 09             	cmp    $0x9,%bl
+ 383:	76 eb                	jbe    370 <atoi+0x20>
+}
+ 385:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 388:	89 c8                	mov    %ecx,%eax
+ 38a:	c9                   	leave
+ 38b:	c3                   	ret
+ 38c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000390 <memmove>:
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	57                   	push   %edi
+ 394:	56                   	push   %esi
+ 395:	8b 45 10             	mov    0x10(%ebp),%eax
+ 398:	8b 55 08             	mov    0x8(%ebp),%edx
+ 39b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+ 39e:	85 c0                	test   %eax,%eax
+ 3a0:	7e 13                	jle    3b5 <memmove+0x25>
+ 3a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 3a4:	89 d7                	mov    %edx,%edi
+ 3a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 3b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 3b1:	39 f8                	cmp    %edi,%eax
+ 3b3:	75 fb                	jne    3b0 <memmove+0x20>
+}
+ 3b5:	5e                   	pop    %esi
+ 3b6:	89 d0                	mov    %edx,%eax
+ 3b8:	5f                   	pop    %edi
+ 3b9:	5d                   	pop    %ebp
+ 3ba:	c3                   	ret
+ 3bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3bf:	90                   	nop
+
+000003c0 <fork>:
+  if(flushhook)
+ 3c0:	a1 00 10 00 00       	mov    0x1000,%eax
+ 3c5:	85 c0                	test   %eax,%eax
+ 3c7:	74 17                	je     3e0 <fork+0x20>
+{
+ 3c9:	55                   	push   %ebp
+ 3ca:	89 e5                	mov    %esp,%ebp
+ 3cc:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+ 3cf:	ff d0                	call   *%eax
+}
+ 3d1:	c9                   	leave
+  return _fork();
+ 3d2:	e9 21 02 00 00       	jmp    5f8 <_fork>
+ 3d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3de:	66 90                	xchg   %ax,%ax
+ 3e0:	e9 13 02 00 00       	jmp    5f8 <_fork>
+ 3e5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003f0 <exit>:
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+ 3f3:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+ 3f6:	a1 00 10 00 00       	mov    0x1000,%eax
+ 3fb:	85 c0                	test   %eax,%eax
+ 3fd:	74 02                	je     401 <exit+0x11>
+    flushhook();
+ 3ff:	ff d0                	call   *%eax
+  _exit();
+ 401:	e8 fa 01 00 00       	call   600 <_exit>
+ 406:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 40d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000410 <exec>:
+{
+ 410:	55                   	push   %ebp
+  if(flushhook)
+ 411:	a1 00 10 00 00       	mov    0x1000,%eax
+{
+ 416:	89 e5                	mov    %esp,%ebp
+ 418:	56                   	push   %esi
+ 419:	53                   	push   %ebx
+ 41a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 41d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+ 420:	85 c0                	test   %eax,%eax
+ 422:	74 02                	je     426 <exec+0x16>
+    flushhook();
+ 424:	ff d0                	call   *%eax
+  return _exec(path, argv);
+ 426:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 429:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 42c:	5b                   	pop    %ebx
+ 42d:	5e                   	pop    %esi
+ 42e:	5d                   	pop    %ebp
+  return _exec(path, argv);
+ 42f:	e9 04 02 00 00       	jmp    638 <_exec>
+ 434:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 43b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 43f:	90                   	nop
+
+00000440 <read>:
+{
+ 440:	55                   	push   %ebp
+ 441:	89 e5                	mov    %esp,%ebp
+ 443:	57                   	push   %edi
+ 444:	56                   	push   %esi
+ 445:	53                   	push   %ebx
+ 446:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+ 449:	a1 00 10 00 00       	mov    0x1000,%eax
+{
+ 44e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 451:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 454:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+ 457:	85 c0                	test   %eax,%eax
+ 459:	74 02                	je     45d <read+0x1d>
+    flushhook();
+ 45b:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+ 45d:	89 7d 10             	mov    %edi,0x10(%ebp)
+ 460:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 463:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 466:	83 c4 0c             	add    $0xc,%esp
+ 469:	5b                   	pop    %ebx
+ 46a:	5e                   	pop    %esi
+ 46b:	5f                   	pop    %edi
+ 46c:	5d                   	pop    %ebp
+  return _read(fd, buf, n);
+ 46d:	e9 a6 01 00 00       	jmp    618 <_read>
+ 472:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 479:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000480 <readv>:
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	57                   	push   %edi
+ 484:	56                   	push   %esi
+ 485:	53                   	push   %ebx
+ 486:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+ 489:	a1 00 10 00 00       	mov    0x1000,%eax
+{
+ 48e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 491:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 494:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+ 497:	85 c0                	test   %eax,%eax
+ 499:	74 02                	je     49d <readv+0x1d>
+    flushhook();
+ 49b:	ff d0                	call   *%eax
+  return _readv(fd, iov, cnt);
+ 49d:	89 7d 10             	mov    %edi,0x10(%ebp)
+ 4a0:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 4a3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 4a6:	83 c4 0c             	add    $0xc,%esp
+ 4a9:	5b                   	pop    %ebx
+ 4aa:	5e                   	pop    %esi
+ 4ab:	5f                   	pop    %edi
+ 4ac:	5d                   	pop    %ebp
+  return _readv(fd, iov, cnt);
+ 4ad:	e9 76 02 00 00       	jmp    728 <_readv>
+ 4b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004c0 <write>:
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	57                   	push   %edi
+ 4c4:	56                   	push   %esi
+ 4c5:	53                   	push   %ebx
+ 4c6:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+ 4c9:	a1 00 10 00 00       	mov    0x1000,%eax
+{
+ 4ce:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 4d1:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 4d4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+ 4d7:	85 c0                	test   %eax,%eax
+ 4d9:	74 02                	je     4dd <write+0x1d>
+    flushhook();
+ 4db:	ff d0                	call   *%eax
+  return _write(fd, buf, n);
+ 4dd:	89 7d 10             	mov    %edi,0x10(%ebp)
+ 4e0:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 4e3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 4e6:	83 c4 0c             	add    $0xc,%esp
+ 4e9:	5b                   	pop    %ebx
+ 4ea:	5e                   	pop    %esi
+ 4eb:	5f                   	pop    %edi
+ 4ec:	5d                   	pop    %ebp
+  return _write(fd, buf, n);
+ 4ed:	e9 2e 01 00 00       	jmp    620 <_write>
+ 4f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000500 <writev>:
+{
+ 500:	55                   	push   %ebp
+ 501:	89 e5                	mov    %esp,%ebp
+ 503:	57                   	push   %edi
+ 504:	56                   	push   %esi
+ 505:	53                   	push   %ebx
+ 506:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+ 509:	a1 00 10 00 00       	mov    0x1000,%eax
+{
+ 50e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 511:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 514:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+ 517:	85 c0                	test   %eax,%eax
+ 519:	74 02                	je     51d <writev+0x1d>
+    flushhook();
+ 51b:	ff d0                	call   *%eax
+  return _writev(fd, iov, cnt);
+ 51d:	89 7d 10             	mov    %edi,0x10(%ebp)
+ 520:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 523:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 526:	83 c4 0c             	add    $0xc,%esp
+ 529:	5b                   	pop    %ebx
+ 52a:	5e                   	pop    %esi
+ 52b:	5f                   	pop    %edi
+ 52c:	5d                   	pop    %ebp
+  return _writev(fd, iov, cnt);
+ 52d:	e9 fe 01 00 00       	jmp    730 <_writev>
+ 532:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 539:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000540 <close>:
+{
+ 540:	55                   	push   %ebp
+ 541:	89 e5                	mov    %esp,%ebp
+ 543:	53                   	push   %ebx
+ 544:	83 ec 04             	sub    $0x4,%esp
+  if(flushhook)
+ 547:	a1 00 10 00 00       	mov    0x1000,%eax
+{
+ 54c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(flushhook)
+ 54f:	85 c0                	test   %eax,%eax
+ 551:	74 02                	je     555 <close+0x15>
+    flushhook();
+ 553:	ff d0                	call   *%eax
+  return _close(fd);
+ 555:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 558:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 55b:	c9                   	leave
+  return _close(fd);
+ 55c:	e9 c7 00 00 00       	jmp    628 <_close>
+ 561:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 568:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 56f:	90                   	nop
+
+00000570 <umtxinit>:
+// process that finds the mutex held enters the kernel, to sleep
+// in futexwait() until the holder's umtxunlock() wakes it.
+
+void
+umtxinit(struct umutex *m)
+{
+ 570:	55                   	push   %ebp
+ 571:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 573:	8b 45 08             	mov    0x8(%ebp),%eax
+ 576:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 57c:	5d                   	pop    %ebp
+ 57d:	c3                   	ret
+ 57e:	66 90                	xchg   %ax,%ax
+
+00000580 <umtxlock>:
+
+void
+umtxlock(struct umutex *m)
+{
+ 580:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 581:	b8 01 00 00 00       	mov    $0x1,%eax
+ 586:	89 e5                	mov    %esp,%ebp
+ 588:	56                   	push   %esi
+ 589:	53                   	push   %ebx
+ 58a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 58d:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 1) == 0)
+ 590:	85 c0                	test   %eax,%eax
+ 592:	74 2b                	je     5bf <umtxlock+0x3f>
+ 594:	b8 02 00 00 00       	mov    $0x2,%eax
+ 599:	f0 87 03             	lock xchg %eax,(%ebx)
+    return;
+  // Mark the mutex contended, so that its holder
+  // wakes a waiter on release, and wait.
+  while(xchg(&m->state, 2) != 0)
+ 59c:	85 c0                	test   %eax,%eax
+ 59e:	74 1f                	je     5bf <umtxlock+0x3f>
+ 5a0:	be 02 00 00 00       	mov    $0x2,%esi
+ 5a5:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwait(&m->state, 2);
+ 5a8:	83 ec 08             	sub    $0x8,%esp
+ 5ab:	6a 02                	push   $0x2
+ 5ad:	53                   	push   %ebx
+ 5ae:	e8 85 01 00 00       	call   738 <futexwait>
+ 5b3:	89 f0                	mov    %esi,%eax
+ 5b5:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+ 5b8:	83 c4 10             	add    $0x10,%esp
+ 5bb:	85 c0                	test   %eax,%eax
+ 5bd:	75 e9                	jne    5a8 <umtxlock+0x28>
+}
+ 5bf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 5c2:	5b                   	pop    %ebx
+ 5c3:	5e                   	pop    %esi
+ 5c4:	5d                   	pop    %ebp
+ 5c5:	c3                   	ret
+ 5c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000005d0 <umtxunlock>:
+
+void
+umtxunlock(struct umutex *m)
+{
+ 5d0:	55                   	push   %ebp
+ 5d1:	31 c0                	xor    %eax,%eax
+ 5d3:	89 e5                	mov    %esp,%ebp
+ 5d5:	83 ec 08             	sub    $0x8,%esp
+ 5d8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 5db:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 5de:	83 f8 02             	cmp    $0x2,%eax
+ 5e1:	74 05                	je     5e8 <umtxunlock+0x18>
+    futexwake(&m->state, 1);
+}
+ 5e3:	c9                   	leave
+ 5e4:	c3                   	ret
+ 5e5:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwake(&m->state, 1);
+ 5e8:	83 ec 08             	sub    $0x8,%esp
+ 5eb:	6a 01                	push   $0x1
+ 5ed:	52                   	push   %edx
+ 5ee:	e8 4d 01 00 00       	call   740 <futexwake>
+ 5f3:	83 c4 10             	add    $0x10,%esp
+}
+ 5f6:	c9                   	leave
+ 5f7:	c3                   	ret
+
+000005f8 <_fork>:
+  _ ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+ 5f8:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5fd:	cd 40                	int    $0x40
+ 5ff:	c3                   	ret
+
+00000600 <_exit>:
+RAWSYSCALL(exit)
+ 600:	b8 02 00 00 00       	mov    $0x2,%eax
+ 605:	cd 40                	int    $0x40
+ 607:	c3                   	ret
+
+00000608 <wait>:
+SYSCALL(wait)
+ 608:	b8 03 00 00 00       	mov    $0x3,%eax
+ 60d:	cd 40                	int    $0x40
+ 60f:	c3                   	ret
+
+00000610 <pipe>:
+SYSCALL(pipe)
+ 610:	b8 04 00 00 00       	mov    $0x4,%eax
+ 615:	cd 40                	int    $0x40
+ 617:	c3                   	ret
+
+00000618 <_read>:
+RAWSYSCALL(read)
+ 618:	b8 05 00 00 00       	mov    $0x5,%eax
+ 61d:	cd 40                	int    $0x40
+ 61f:	c3                   	ret
+
+00000620 <_write>:
+RAWSYSCALL(write)
+ 620:	b8 10 00 00 00       	mov    $0x10,%eax
+ 625:	cd 40                	int    $0x40
+ 627:	c3                   	ret
+
+00000628 <_close>:
+RAWSYSCALL(close)
+ 628:	b8 15 00 00 00       	mov    $0x15,%eax
+ 62d:	cd 40                	int    $0x40
+ 62f:	c3                   	ret
+
+00000630 <kill>:
+SYSCALL(kill)
+ 630:	b8 06 00 00 00       	mov    $0x6,%eax
+ 635:	cd 40                	int    $0x40
+ 637:	c3                   	ret
+
+00000638 <_exec>:
+RAWSYSCALL(exec)
+ 638:	b8 07 00 00 00       	mov    $0x7,%eax
+ 63d:	cd 40                	int    $0x40
+ 63f:	c3                   	ret
+
+00000640 <open>:
+SYSCALL(open)
+ 640:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 645:	cd 40                	int    $0x40
+ 647:	c3                   	ret
+
+00000648 <mknod>:
+SYSCALL(mknod)
+ 648:	b8 11 00 00 00       	mov    $0x11,%eax
+ 64d:	cd 40                	int    $0x40
+ 64f:	c3                   	ret
+
+00000650 <unlink>:
+SYSCALL(unlink)
+ 650:	b8 12 00 00 00       	mov    $0x12,%eax
+ 655:	cd 40                	int    $0x40
+ 657:	c3                   	ret
+
+00000658 <fstat>:
+SYSCALL(fstat)
+ 658:	b8 08 00 00 00       	mov    $0x8,%eax
+ 65d:	cd 40                	int    $0x40
+ 65f:	c3                   	ret
+
+00000660 <link>:
+SYSCALL(link)
+ 660:	b8 13 00 00 00       	mov    $0x13,%eax
+ 665:	cd 40                	int    $0x40
+ 667:	c3                   	ret
+
+00000668 <mkdir>:
+SYSCALL(mkdir)
+ 668:	b8 14 00 00 00       	mov    $0x14,%eax
+ 66d:	cd 40                	int    $0x40
+ 66f:	c3                   	ret
+
+00000670 <chdir>:
+SYSCALL(chdir)
+ 670:	b8 09 00 00 00       	mov    $0x9,%eax
+ 675:	cd 40                	int    $0x40
+ 677:	c3                   	ret
+
+00000678 <dup>:
+SYSCALL(dup)
+ 678:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 67d:	cd 40                	int    $0x40
+ 67f:	c3                   	ret
+
+00000680 <getpid>:
+SYSCALL(getpid)
+ 680:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 685:	cd 40                	int    $0x40
+ 687:	c3                   	ret
+
+00000688 <sbrk>:
+SYSCALL(sbrk)
+ 688:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 68d:	cd 40                	int    $0x40
+ 68f:	c3                   	ret
+
+00000690 <sleep>:
+SYSCALL(sleep)
+ 690:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 695:	cd 40                	int    $0x40
+ 697:	c3                   	ret
+
+00000698 <uptime>:
+SYSCALL(uptime)
+ 698:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 69d:	cd 40                	int    $0x40
+ 69f:	c3                   	ret
+
+000006a0 <wolfie>:
+SYSCALL(wolfie)
+ 6a0:	b8 16 00 00 00       	mov    $0x16,%eax
+ 6a5:	cd 40                	int    $0x40
+ 6a7:	c3                   	ret
+
+000006a8 <nice>:
+SYSCALL(nice)
+ 6a8:	b8 17 00 00 00       	mov    $0x17,%eax
+ 6ad:	cd 40                	int    $0x40
+ 6af:	c3                   	ret
+
+000006b0 <mtxget>:
+SYSCALL(mtxget)
+ 6b0:	b8 18 00 00 00       	mov    $0x18,%eax
+ 6b5:	cd 40                	int    $0x40
+ 6b7:	c3                   	ret
+
+000006b8 <mtxrel>:
+SYSCALL(mtxrel)
+ 6b8:	b8 19 00 00 00       	mov    $0x19,%eax
+ 6bd:	cd 40                	int    $0x40
+ 6bf:	c3                   	ret
+
+000006c0 <mtxacq>:
+SYSCALL(mtxacq)
+ 6c0:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 6c5:	cd 40                	int    $0x40
+ 6c7:	c3                   	ret
+
+000006c8 <mtxdel>:
+SYSCALL(mtxdel)
+ 6c8:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 6cd:	cd 40                	int    $0x40
+ 6cf:	c3                   	ret
+
+000006d0 <iostat>:
+SYSCALL(iostat)
+ 6d0:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 6d5:	cd 40                	int    $0x40
+ 6d7:	c3                   	ret
+
+000006d8 <mmap>:
+SYSCALL(mmap)
+ 6d8:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 6dd:	cd 40                	int    $0x40
+ 6df:	c3                   	ret
+
+000006e0 <munmap>:
+SYSCALL(munmap)
+ 6e0:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 6e5:	cd 40                	int    $0x40
+ 6e7:	c3                   	ret
+
+000006e8 <shmget>:
+SYSCALL(shmget)
+ 6e8:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 6ed:	cd 40                	int    $0x40
+ 6ef:	c3                   	ret
+
+000006f0 <shmat>:
+SYSCALL(shmat)
+ 6f0:	b8 20 00 00 00       	mov    $0x20,%eax
+ 6f5:	cd 40                	int    $0x40
+ 6f7:	c3                   	ret
+
+000006f8 <shmdt>:
+SYSCALL(shmdt)
+ 6f8:	b8 21 00 00 00       	mov    $0x21,%eax
+ 6fd:	cd 40                	int    $0x40
+ 6ff:	c3                   	ret
+
+00000700 <shmdel>:
+SYSCALL(shmdel)
+ 700:	b8 22 00 00 00       	mov    $0x22,%eax
+ 705:	cd 40                	int    $0x40
+ 707:	c3                   	ret
+
+00000708 <syscount>:
+SYSCALL(syscount)
+ 708:	b8 23 00 00 00       	mov    $0x23,%eax
+ 70d:	cd 40                	int    $0x40
+ 70f:	c3                   	ret
+
+00000710 <splice>:
+SYSCALL(splice)
+ 710:	b8 24 00 00 00       	mov    $0x24,%eax
+ 715:	cd 40                	int    $0x40
+ 717:	c3                   	ret
+
+00000718 <tee>:
+SYSCALL(tee)
+ 718:	b8 25 00 00 00       	mov    $0x25,%eax
+ 71d:	cd 40                	int    $0x40
+ 71f:	c3                   	ret
+
+00000720 <sendfile>:
+SYSCALL(sendfile)
+ 720:	b8 26 00 00 00       	mov    $0x26,%eax
+ 725:	cd 40                	int    $0x40
+ 727:	c3                   	ret
+
+00000728 <_readv>:
+RAWSYSCALL(readv)
+ 728:	b8 27 00 00 00       	mov    $0x27,%eax
+ 72d:	cd 40                	int    $0x40
+ 72f:	c3                   	ret
+
+00000730 <_writev>:
+RAWSYSCALL(writev)
+ 730:	b8 28 00 00 00       	mov    $0x28,%eax
+ 735:	cd 40                	int    $0x40
+ 737:	c3                   	ret
+
+00000738 <futexwait>:
+SYSCALL(futexwait)
+ 738:	b8 29 00 00 00       	mov    $0x29,%eax
+ 73d:	cd 40                	int    $0x40
+ 73f:	c3                   	ret
+
+00000740 <futexwake>:
+SYSCALL(futexwake)
+ 740:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 745:	cd 40                	int    $0x40
+ 747:	c3                   	ret
+
+00000748 <lockstat>:
+SYSCALL(lockstat)
+ 748:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 74d:	cd 40                	int    $0x40
+ 74f:	c3                   	ret
+
+00000750 <clone>:
+SYSCALL(clone)
+ 750:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 755:	cd 40                	int    $0x40
+ 757:	c3                   	ret
+
+00000758 <join>:
+SYSCALL(join)
+ 758:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 75d:	cd 40                	int    $0x40
+ 75f:	c3                   	ret
+
+00000760 <stacklimit>:
+SYSCALL(stacklimit)
+ 760:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 765:	cd 40                	int    $0x40
+ 767:	c3                   	ret
@@ -20,6 +20,7 @@
 #include "fs.h"
 #include "buf.h"
 #include "file.h"
+#include "pcache.h"
 
 #define min(a, b) ((a) < (b) ? (a) : (b))
 static void itrunc(struct inode*);
@@ -27,6 +28,15 @@ static void itrunc(struct inode*);
 // only one device
 struct superblock sb; 
 
+// Free block and free inode counts of each block group,
+// computed by iinit() and kept up to date by the allocators.
+// They only steer placement, so a stale value is harmless.
+struct {
+  struct spinlock lock;
+  uint nbfree[NGROUP];
+  uint nifree[NGROUP];
+} groups;
+
 // Read the super block.
 void
 readsb(int dev, struct superblock *sb)
@@ -52,27 +62,63 @@ bzero(int dev, int bno)
 
 // Blocks.
 
-// Allocate a zeroed disk block.
+// Last block of group g, plus one.
+static uint
+gend(uint g)
+{
+  return min(GSTART(g+1, sb), sb.size);
+}
+
+// Find a free block in group g at or after block from,
+// mark it in use and return it. Return 0 if there is none.
 static uint
-balloc(uint dev)
+bgrab(uint dev, uint g, uint from)
 {
-  int b, bi, m;
+  uint b, bi, m;
   struct buf *bp;
 
-  bp = 0;
-  for(b = 0; b < sb.size; b += BPB){
-    bp = bread(dev, BBLOCK(b, sb));
-    for(bi = 0; bi < BPB && b + bi < sb.size; bi++){
-      m = 1 << (bi % 8);
-      if((bp->data[bi/8] & m) == 0){  // Is block free?
-        bp->data[bi/8] |= m;  // Mark block in use.
-        log_write(bp);
-        brelse(bp);
-        bzero(dev, b + bi);
-        return b + bi;
-      }
+  bp = bread(dev, BBLOCK(from, sb));
+  for(b = from; b < gend(g); b++){
+    bi = BBIT(b, sb);
+    if(bi % 8 == 0 && bp->data[bi/8] == 0xff){  // skip full bytes
+      b += 7;
+      continue;
     }
-    brelse(bp);
+    m = 1 << (bi % 8);
+    if((bp->data[bi/8] & m) == 0){  // Is block free?
+      bp->data[bi/8] |= m;  // Mark block in use.
+      log_write(bp);
+      brelse(bp);
+      return b;
+    }
+  }
+  brelse(bp);
+  return 0;
+}
+
+// Allocate a zeroed disk block, preferring the first free
+// block at or after goal so that consecutive blocks of a file
+// end up next to each other. Falls back to the following
+// groups, and finally to the start of goal's own group.
+static uint
+balloc(uint dev, uint goal)
+{
+  uint g, i, b;
+
+  if(goal < GDATA(0, sb) || goal >= sb.size)
+    goal = GDATA(0, sb);
+  g = BGROUP(goal, sb);
+  if(goal < GDATA(g, sb))
+    goal = GDATA(g, sb);
+  for(i = 0; i <= sb.ngroups; i++){
+    if((b = bgrab(dev, g, i == 0 ? goal : GDATA(g, sb))) != 0){
+      acquire(&groups.lock);
+      groups.nbfree[g]--;
+      release(&groups.lock);
+      bzero(dev, b);
+      return b;
+    }
+    g = (g + 1) % sb.ngroups;
   }
   panic("balloc: out of blocks");
 }
@@ -85,13 +131,17 @@ bfree(int dev, uint b)
   int bi, m;
 
   bp = bread(dev, BBLOCK(b, sb));
-  bi = b % BPB;
+  bi = BBIT(b, sb);
   m = 1 << (bi % 8);
   if((bp->data[bi/8] & m) == 0)
     panic("freeing free block");
   bp->data[bi/8] &= ~m;
   log_write(bp);
   brelse(bp);
+
+  acquire(&groups.lock);
+  groups.nbfree[BGROUP(b, sb)]++;
+  release(&groups.lock);
 }
 
 // Inodes.
@@ -101,9 +151,9 @@ bfree(int dev, uint b)
 // its size, the number of links referring to it, and the
 // list of blocks holding the file's content.
 //
-// The inodes are laid out sequentially on disk at
-// sb.startinode. Each inode has a number, indicating its
-// position on the disk.
+// The inodes are spread over the block groups, sb.ipg per
+// group, at the start of each group. Each inode has a number,
+// indicating its position on the disk.
 //
 // The kernel keeps a cache of in-use inodes in memory
 // to provide a place for synchronizing access
@@ -168,47 +218,115 @@ struct {
   struct inode inode[NINODE];
 } icache;
 
+// Count the free blocks and free inodes of every group.
+static void
+gcount(int dev)
+{
+  uint g, b, inum;
+  struct buf *bp;
+  struct dinode *dip;
+
+  for(g = 0; g < sb.ngroups; g++){
+    bp = bread(dev, BBLOCK(GSTART(g, sb), sb));
+    for(b = GDATA(g, sb); b < gend(g); b++)
+      if((bp->data[BBIT(b, sb)/8] & (1 << (BBIT(b, sb) % 8))) == 0)
+        groups.nbfree[g]++;
+    brelse(bp);
+
+    for(inum = g*sb.ipg; inum < (g+1)*sb.ipg; inum += IPB){
+      bp = bread(dev, IBLOCK(inum, sb));
+      for(dip = (struct dinode*)bp->data; dip < (struct dinode*)bp->data + IPB; dip++)
+        if(dip->type == 0)
+          groups.nifree[g]++;
+      brelse(bp);
+    }
+  }
+  groups.nifree[0]--;  // inode 0 is never handed out
+}
+
 void
 iinit(int dev)
 {
   int i = 0;
   
   initlock(&icache.lock, "icache");
+  initlock(&groups.lock, "groups");
   for(i = 0; i < NINODE; i++) {
     initsleeplock(&icache.inode[i].lock, "inode");
   }
 
   readsb(dev, &sb);
+  if(sb.ngroups > NGROUP)
+    panic("iinit: too many groups");
   cprintf("sb: size %d nblocks %d ninodes %d nlog %d logstart %d\
- inodestart %d bmap start %d\n", sb.size, sb.nblocks,
-          sb.ninodes, sb.nlog, sb.logstart, sb.inodestart,
-          sb.bmapstart);
+ groupstart %d ngroups %d bpg %d ipg %d\n", sb.size, sb.nblocks,
+          sb.ninodes, sb.nlog, sb.logstart, sb.groupstart,
+          sb.ngroups, sb.bpg, sb.ipg);
+  gcount(dev);
 }
 
 static struct inode* iget(uint dev, uint inum);
 
 //PAGEBREAK!
-// Allocate an inode on device dev.
-// Mark it as allocated by  giving it type type.
+// Choose the group for a new inode of the given type whose
+// parent directory is inode pinum. Files stay in their parent's
+// group, so that the directory, the inode and the data are close
+// together. Directories are spread out: each goes to the group
+// with the most free blocks among those with at least an average
+// share of free inodes, leaving room for the files it will hold.
+static uint
+igroup(short type, uint pinum)
+{
+  uint g, best, avg;
+
+  best = IGROUP(pinum, sb);
+  if(type != T_DIR)
+    return best;
+
+  acquire(&groups.lock);
+  avg = 0;
+  for(g = 0; g < sb.ngroups; g++)
+    avg += groups.nifree[g];
+  avg /= sb.ngroups;
+  for(g = 0; g < sb.ngroups; g++){
+    if(groups.nifree[g] < avg)
+      continue;
+    if(groups.nifree[best] < avg || groups.nbfree[g] > groups.nbfree[best])
+      best = g;
+  }
+  release(&groups.lock);
+  return best;
+}
+
+// Allocate an inode on device dev, near its parent
+// directory pinum. Mark it as allocated by giving it type type.
 // Returns an unlocked but allocated and referenced inode.
 struct inode*
-ialloc(uint dev, short type)
+ialloc(uint dev, short type, uint pinum)
 {
-  int inum;
+  uint g, i, inum;
   struct buf *bp;
   struct dinode *dip;
 
-  for(inum = 1; inum < sb.ninodes; inum++){
-    bp = bread(dev, IBLOCK(inum, sb));
-    dip = (struct dinode*)bp->data + inum%IPB;
-    if(dip->type == 0){  // a free inode
-      memset(dip, 0, sizeof(*dip));
-      dip->type = type;
-      log_write(bp);   // mark it allocated on the disk
+  g = igroup(type, pinum);
+  for(i = 0; i < sb.ngroups; i++, g = (g+1) % sb.ngroups){
+    for(inum = g*sb.ipg; inum < (g+1)*sb.ipg; inum++){
+      if(inum == 0)
+        continue;
+      bp = bread(dev, IBLOCK(inum, sb));
+      dip = (struct dinode*)bp->data + inum%IPB;
+      if(dip->type == 0){  // a free inode
+        memset(dip, 0, sizeof(*dip));
+        dip->type = type;
+        log_write(bp);   // mark it allocated on the disk
+        brelse(bp);
+        acquire(&groups.lock);
+        groups.nifree[g]--;
+        release(&groups.lock);
+        return iget(dev, inum);
+      }
       brelse(bp);
-      return iget(dev, inum);
     }
-    brelse(bp);
   }
   panic("ialloc: no inodes");
 }
@@ -321,6 +439,35 @@ iunlock(struct inode *ip)
   releasesleep(&ip->lock);
 }
 
+// Lock the given inode for reading only, sharing the lock
+// with other readers. Reads the inode in if necessary.
+// Enough for readi(), dirlookup() and stati(), but not for
+// anything that modifies the inode or its data.
+void
+ilockshared(struct inode *ip)
+{
+  if(ip == 0 || ip->ref < 1)
+    panic("ilockshared");
+
+  // Loading the inode needs it to itself. It cannot be
+  // invalidated again while the caller holds a reference.
+  if(ip->valid == 0){
+    ilock(ip);
+    iunlock(ip);
+  }
+  acquiresleepshared(&ip->lock);
+}
+
+// Unlock an inode locked with ilockshared().
+void
+iunlockshared(struct inode *ip)
+{
+  if(ip == 0 || ip->ref < 1)
+    panic("iunlockshared");
+
+  releasesleepshared(&ip->lock);
+}
+
 // Drop a reference to an in-memory inode.
 // If that was the last reference, the inode cache entry can
 // be recycled.
@@ -342,6 +489,9 @@ iput(struct inode *ip)
       ip->type = 0;
       iupdate(ip);
       ip->valid = 0;
+      acquire(&groups.lock);
+      groups.nifree[IGROUP(ip->inum, sb)]++;
+      release(&groups.lock);
     }
   }
   releasesleep(&ip->lock);
@@ -365,7 +515,27 @@ iunlockput(struct inode *ip)
 // The content (data) associated with each inode is stored
 // in blocks on the disk. The first NDIRECT block numbers
 // are listed in ip->addrs[].  The next NINDIRECT blocks are
-// listed in block ip->addrs[NDIRECT].
+// listed in block ip->addrs[NDIRECT]. The next NDINDIRECT
+// blocks are listed in the blocks listed in the doubly-indirect
+// block ip->addrs[NDIRECT+1].
+//
+// New blocks are placed right after the file's previous block
+// when possible, and the first block in the inode's own group.
+//
+// Files and directories of at most NINLINE bytes have no blocks:
+// their data is stored in ip->addrs[] itself, so reading one
+// costs only the inode block. writei() moves the data out to a
+// block when the file grows past NINLINE.
+
+// Where to look for a new block that follows block prev
+// of inode ip (0 if ip has no blocks yet).
+static uint
+bgoal(struct inode *ip, uint prev)
+{
+  if(prev)
+    return prev + 1;
+  return GDATA(IGROUP(ip->inum, sb), sb);
+}
 
 // Return the disk block address of the nth block in inode ip.
 // If there is no such block, bmap allocates one.
@@ -377,7 +547,8 @@ bmap(struct inode *ip, uint bn)
 
   if(bn < NDIRECT){
     if((addr = ip->addrs[bn]) == 0)
-      ip->addrs[bn] = addr = balloc(ip->dev);
+      ip->addrs[bn] = addr = balloc(ip->dev,
+        bgoal(ip, bn > 0 ? ip->addrs[bn-1] : 0));
     return addr;
   }
   bn -= NDIRECT;
@@ -385,11 +556,39 @@ bmap(struct inode *ip, uint bn)
   if(bn < NINDIRECT){
     // Load indirect block, allocating if necessary.
     if((addr = ip->addrs[NDIRECT]) == 0)
-      ip->addrs[NDIRECT] = addr = balloc(ip->dev);
+      ip->addrs[NDIRECT] = addr = balloc(ip->dev,
+        bgoal(ip, ip->addrs[NDIRECT-1]));
     bp = bread(ip->dev, addr);
     a = (uint*)bp->data;
     if((addr = a[bn]) == 0){
-      a[bn] = addr = balloc(ip->dev);
+      a[bn] = addr = balloc(ip->dev,
+        bgoal(ip, bn > 0 ? a[bn-1] : ip->addrs[NDIRECT]));
+      log_write(bp);
+    }
+    brelse(bp);
+    return addr;
+  }
+  bn -= NINDIRECT;
+
+  if(bn < NDINDIRECT){
+    // Load doubly-indirect block, then the indirect
+    // block it lists, allocating if necessary.
+    if((addr = ip->addrs[NDIRECT+1]) == 0)
+      ip->addrs[NDIRECT+1] = addr = balloc(ip->dev,
+        bgoal(ip, ip->addrs[NDIRECT]));
+    bp = bread(ip->dev, addr);
+    a = (uint*)bp->data;
+    if((addr = a[bn / NINDIRECT]) == 0){
+      a[bn / NINDIRECT] = addr = balloc(ip->dev,
+        bgoal(ip, ip->addrs[NDIRECT+1]));
+      log_write(bp);
+    }
+    brelse(bp);
+    bp = bread(ip->dev, addr);
+    a = (uint*)bp->data;
+    if((addr = a[bn % NINDIRECT]) == 0){
+      a[bn % NINDIRECT] = addr = balloc(ip->dev,
+        bgoal(ip, bn % NINDIRECT > 0 ? a[bn % NINDIRECT - 1] : 0));
       log_write(bp);
     }
     brelse(bp);
@@ -408,8 +607,18 @@ static void
 itrunc(struct inode *ip)
 {
   int i, j;
-  struct buf *bp;
-  uint *a;
+  struct buf *bp, *bp2;
+  uint *a, *a2;
+
+  if(ip->type == T_FILE)
+    pcinval(ip->dev, ip->inum);
+
+  if(ip->type != T_DEV && ip->size <= NINLINE){
+    memset(ip->addrs, 0, sizeof(ip->addrs));
+    ip->size = 0;
+    iupdate(ip);
+    return;
+  }
 
   for(i = 0; i < NDIRECT; i++){
     if(ip->addrs[i]){
@@ -430,12 +639,32 @@ itrunc(struct inode *ip)
     ip->addrs[NDIRECT] = 0;
   }
 
+  if(ip->addrs[NDIRECT+1]){
+    bp = bread(ip->dev, ip->addrs[NDIRECT+1]);
+    a = (uint*)bp->data;
+    for(i = 0; i < NINDIRECT; i++){
+      if(a[i] == 0)
+        continue;
+      bp2 = bread(ip->dev, a[i]);
+      a2 = (uint*)bp2->data;
+      for(j = 0; j < NINDIRECT; j++){
+        if(a2[j])
+          bfree(ip->dev, a2[j]);
+      }
+      brelse(bp2);
+      bfree(ip->dev, a[i]);
+    }
+    brelse(bp);
+    bfree(ip->dev, ip->addrs[NDIRECT+1]);
+    ip->addrs[NDIRECT+1] = 0;
+  }
+
   ip->size = 0;
   iupdate(ip);
 }
 
 // Copy stat information from inode.
-// Caller must hold ip->lock.
+// Caller must hold ip->lock, perhaps shared.
 void
 stati(struct inode *ip, struct stat *st)
 {
@@ -447,13 +676,65 @@ stati(struct inode *ip, struct stat *st)
 }
 
 //PAGEBREAK!
+// Copy n bytes at offset off of ip's data to dst
+// through the buffer cache. Returns the number of bytes
+// copied, fewer than n if dst is user memory that is not
+// all there; see umove().
+static uint
+readblocks(struct inode *ip, char *dst, uint off, uint n)
+{
+  uint tot, m, left;
+  struct buf *bp;
+
+  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+    m = min(n - tot, BSIZE - off%BSIZE);
+    left = umove(dst, bp->data + off%BSIZE, m);
+    brelse(bp);
+    if(left)
+      return tot + m - left;
+  }
+  return n;
+}
+
+// Return the referenced page cache page holding page pgno
+// of the regular file ip, reading it in if it is not cached.
+// Bytes past the end of the file read as zero.
+// Returns 0 if there is no memory for it.
+// Caller must hold ip->lock, perhaps shared.
+struct page*
+igetpage(struct inode *ip, uint pgno)
+{
+  struct page *pg;
+  uint off, n;
+
+  if((pg = pcget(ip->dev, ip->inum, pgno)) == 0)
+    return 0;
+  if(!pg->valid && pcfill(pg)){
+    off = pgno*PGSIZE;
+    n = off < ip->size ? min(ip->size - off, PGSIZE) : 0;
+    if(ip->size <= NINLINE)
+      memmove(pg->data, (char*)ip->addrs + off, n);
+    else
+      readblocks(ip, pg->data, off, n);
+    memset(pg->data + n, 0, PGSIZE - n);
+    pcfilled(pg);
+  }
+  return pg;
+}
+
 // Read data from inode.
-// Caller must hold ip->lock.
+// Regular files are read through the page cache.
+// dst may be a user address. If part of it is not mapped,
+// readi() stops there and returns the number of bytes read
+// before it, or -1 if there were none; the caller can bring
+// the pages in and go on once it has dropped the lock.
+// Caller must hold ip->lock, shared for a file or directory.
 int
 readi(struct inode *ip, char *dst, uint off, uint n)
 {
-  uint tot, m;
-  struct buf *bp;
+  uint tot, m, left;
+  struct page *pg;
 
   if(ip->type == T_DEV){
     if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].read)
@@ -466,23 +747,79 @@ readi(struct inode *ip, char *dst, uint off, uint n)
   if(off + n > ip->size)
     n = ip->size - off;
 
-  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
-    bp = bread(ip->dev, bmap(ip, off/BSIZE));
-    m = min(n - tot, BSIZE - off%BSIZE);
-    memmove(dst, bp->data + off%BSIZE, m);
-    brelse(bp);
+  if(ip->size <= NINLINE)
+    tot = n - umove(dst, (char*)ip->addrs + off, n);
+  else if(ip->type != T_FILE)
+    tot = readblocks(ip, dst, off, n);
+  else {
+    for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+      m = min(n - tot, PGSIZE - off%PGSIZE);
+      if((pg = igetpage(ip, off/PGSIZE)) == 0)
+        left = m - readblocks(ip, dst, off, m);
+      else {
+        left = umove(dst, pg->data + off%PGSIZE, m);
+        pcput(pg);
+      }
+      if(left){
+        tot += m - left;
+        break;
+      }
+    }
   }
-  return n;
+  return tot == 0 && n > 0 ? -1 : tot;
+}
+
+// Move the inline data of ip out to its first block,
+// before the file grows past NINLINE bytes.
+// Caller must hold ip->lock.
+static void
+iunpack(struct inode *ip)
+{
+  char data[NINLINE];
+  struct buf *bp;
+
+  memmove(data, ip->addrs, sizeof(data));
+  memset(ip->addrs, 0, sizeof(ip->addrs));
+  if(ip->size == 0)
+    return;
+  bp = bread(ip->dev, bmap(ip, 0));
+  memmove(bp->data, data, ip->size);
+  log_write(bp);
+  brelse(bp);
+}
+
+// Undo iunpack(): move ip's data back inline from its first
+// block, and free the block. For a write that was to grow ip
+// past NINLINE bytes but stopped short before it did.
+// Caller must hold ip->lock.
+static void
+irepack(struct inode *ip)
+{
+  struct buf *bp;
+  uint addr;
+
+  addr = ip->addrs[0];
+  memset(ip->addrs, 0, sizeof(ip->addrs));
+  bp = bread(ip->dev, addr);
+  memmove(ip->addrs, bp->data, ip->size);
+  brelse(bp);
+  bfree(ip->dev, addr);
+  iupdate(ip);
 }
 
 // PAGEBREAK!
 // Write data to inode.
+// src may be a user address, as for readi(). If part of it
+// is not mapped, writei() stops there and returns the number
+// of bytes written before it, or -1 if there were none; the
+// file is left as if the write had been that long.
 // Caller must hold ip->lock.
 int
 writei(struct inode *ip, char *src, uint off, uint n)
 {
-  uint tot, m;
+  uint tot, m, left;
   struct buf *bp;
+  int unpacked;
 
   if(ip->type == T_DEV){
     if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].write)
@@ -495,19 +832,55 @@ writei(struct inode *ip, char *src, uint off, uint n)
   if(off + n > MAXFILE*BSIZE)
     return -1;
 
+  // The page cache is updated from the copy in the inode or
+  // the block, so that it never copies from user memory.
+  unpacked = 0;
+  if(ip->size <= NINLINE){
+    if(off + n <= NINLINE){
+      tot = n - umove((char*)ip->addrs + off, src, n);
+      if(tot == 0 && n > 0)
+        return -1;
+      if(ip->type == T_FILE)
+        pcwrite(ip->dev, ip->inum, (char*)ip->addrs + off, off, tot);
+      if(off + tot > ip->size)
+        ip->size = off + tot;
+      iupdate(ip);
+      return tot;
+    }
+    iunpack(ip);
+    unpacked = 1;
+  }
+
   for(tot=0; tot<n; tot+=m, off+=m, src+=m){
     bp = bread(ip->dev, bmap(ip, off/BSIZE));
     m = min(n - tot, BSIZE - off%BSIZE);
-    memmove(bp->data + off%BSIZE, src, m);
-    log_write(bp);
+    left = umove(bp->data + off%BSIZE, src, m);
+    m -= left;
+    if(m > 0){
+      log_write(bp);
+      if(ip->type == T_FILE)
+        pcwrite(ip->dev, ip->inum, (char*)bp->data + off%BSIZE, off, m);
+    }
     brelse(bp);
+    if(left){
+      tot += m;
+      off += m;
+      break;
+    }
   }
 
-  if(n > 0 && off > ip->size){
+  // The first block holds the first BSIZE bytes, so if the
+  // write stopped short the data may still fit inline, and
+  // ip must not be left with a small size but block addresses.
+  if(unpacked && off <= NINLINE){
+    if(off > ip->size)
+      ip->size = off;
+    irepack(ip);
+  } else if(off > ip->size){
     ip->size = off;
     iupdate(ip);
   }
-  return n;
+  return tot == 0 && n > 0 ? -1 : tot;
 }
 
 //PAGEBREAK!
@@ -521,6 +894,7 @@ namecmp(const char *s, const char *t)
 
 // Look for a directory entry in a directory.
 // If found, set *poff to byte offset of entry.
+// Caller must hold dp->lock, perhaps shared.
 struct inode*
 dirlookup(struct inode *dp, char *name, uint *poff)
 {
@@ -625,28 +999,37 @@ static struct inode*
 namex(char *path, int nameiparent, char *name)
 {
   struct inode *ip, *next;
+  struct files *fs;
 
   if(*path == '/')
     ip = iget(ROOTDEV, ROOTINO);
-  else
-    ip = idup(myproc()->cwd);
+  else {
+    // Another thread may chdir() meanwhile.
+    fs = myproc()->files;
+    acquire(&fs->lock);
+    ip = idup(fs->cwd);
+    release(&fs->lock);
+  }
 
+  // Walks through the same directories, "/" above all,
+  // share their locks.
   while((path = skipelem(path, name)) != 0){
-    ilock(ip);
+    ilockshared(ip);
     if(ip->type != T_DIR){
-      iunlockput(ip);
+      iunlockshared(ip);
+      iput(ip);
       return 0;
     }
     if(nameiparent && *path == '\0'){
       // Stop one level early.
-      iunlock(ip);
+      iunlockshared(ip);
       return ip;
     }
-    if((next = dirlookup(ip, name, 0)) == 0){
-      iunlockput(ip);
+    next = dirlookup(ip, name, 0);
+    iunlockshared(ip);
+    iput(ip);
+    if(next == 0)
       return 0;
-    }
-    iunlockput(ip);
     ip = next;
   }
   if(nameiparent){
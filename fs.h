@@ -6,8 +6,17 @@
 #define BSIZE 512  // block size
 
 // Disk layout:
-// [ boot block | super block | log | inode blocks |
-//                                          free bit map | data blocks]
+// [ boot block | super block | log | group 0 | group 1 | ... | swap ]
+//
+// The disk between the log and the swap area is split into
+// block groups. Each group
+// holds its own slice of the inodes, a free bit map for its own
+// blocks, and data blocks, so that a file's inode, its directory
+// and its data can be kept close together:
+// [ inode blocks | free bit map | data blocks ]
+//
+// The swap area after the file system holds pages of process
+// memory written out when memory runs short; see swap.c.
 //
 // mkfs computes the super block and builds an initial file system. The
 // super block describes the disk layout:
@@ -17,13 +26,28 @@ struct superblock {
   uint ninodes;      // Number of inodes.
   uint nlog;         // Number of log blocks
   uint logstart;     // Block number of first log block
-  uint inodestart;   // Block number of first inode block
-  uint bmapstart;    // Block number of first free map block
+  uint groupstart;   // Block number of first block group
+  uint ngroups;      // Number of block groups
+  uint bpg;          // Blocks per group (the last may be shorter)
+  uint ipg;          // Inodes per group
+  uint swapstart;    // Block number of first swap block
+  uint nswap;        // Number of swap blocks
 };
 
-#define NDIRECT 12
+// A file's blocks: NDIRECT listed in the inode, then NINDIRECT
+// in an indirect block, then NDINDIRECT through a doubly-indirect
+// block, which lists indirect blocks.
+#define NDIRECT 11
 #define NINDIRECT (BSIZE / sizeof(uint))
-#define MAXFILE (NDIRECT + NINDIRECT)
+#define NDINDIRECT (NINDIRECT * NINDIRECT)
+#define MAXFILE (NDIRECT + NINDIRECT + NDINDIRECT)
+
+// A file or directory of at most NINLINE bytes keeps its
+// data in the inode itself, over the block addresses and the
+// spare words after them. The dinode is 128 bytes, 4 to a
+// block, which leaves 116 bytes: a directory with five
+// entries besides . and .., or a short text file.
+#define NINLINE 116
 
 // On-disk inode structure
 struct dinode {
@@ -32,20 +56,35 @@ struct dinode {
   short minor;          // Minor device number (T_DEV only)
   short nlink;          // Number of links to inode in file system
   uint size;            // Size of file (bytes)
-  uint addrs[NDIRECT+1];   // Data block addresses
+  uint addrs[NINLINE/sizeof(uint)]; // NDIRECT+2 block addresses, or data if size <= NINLINE
 };
 
 // Inodes per block.
 #define IPB           (BSIZE / sizeof(struct dinode))
 
+// Inode blocks per group
+#define IBPG(sb)      ((sb).ipg / IPB)
+
+// First block of group g
+#define GSTART(g, sb) ((sb).groupstart + (g)*(sb).bpg)
+
+// First data block of group g
+#define GDATA(g, sb)  (GSTART(g, sb) + IBPG(sb) + 1)
+
+// Group holding inode i, and group holding block b
+#define IGROUP(i, sb) ((i) / (sb).ipg)
+#define BGROUP(b, sb) (((b) - (sb).groupstart) / (sb).bpg)
+
 // Block containing inode i
-#define IBLOCK(i, sb)     ((i) / IPB + sb.inodestart)
+#define IBLOCK(i, sb)     (GSTART(IGROUP(i, sb), sb) + ((i) % (sb).ipg) / IPB)
 
 // Bitmap bits per block
 #define BPB           (BSIZE*8)
 
-// Block of free map containing bit for block b
-#define BBLOCK(b, sb) (b/BPB + sb.bmapstart)
+// Block of free map containing bit for block b,
+// and the number of that bit within the block
+#define BBLOCK(b, sb) (GSTART(BGROUP(b, sb), sb) + IBPG(sb))
+#define BBIT(b, sb)   (((b) - (sb).groupstart) % (sb).bpg)
 
 // Directory is a file containing a sequence of dirent structures.
 #define DIRSIZ 14
@@ -0,0 +1,2708 @@
+
+_fsaging:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <rnd>:
+uint seed = 1;
+
+uint
+rnd(void)
+{
+  seed = seed * 1103515245 + 12345;
+       0:	69 05 00 20 00 00 6d 	imul   $0x41c64e6d,0x2000,%eax
+       7:	4e c6 41 
+       a:	05 39 30 00 00       	add    $0x3039,%eax
+       f:	a3 00 20 00 00       	mov    %eax,0x2000
+  return (seed >> 16) & 0x7fff;
+      14:	c1 e8 10             	shr    $0x10,%eax
+      17:	25 ff 7f 00 00       	and    $0x7fff,%eax
+}
+      1c:	c3                   	ret
+      1d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000020 <name>:
+
+void
+name(char *s, char c, int n)
+{
+      20:	55                   	push   %ebp
+      21:	89 e5                	mov    %esp,%ebp
+      23:	53                   	push   %ebx
+      24:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  s[0] = c;
+      27:	8b 45 0c             	mov    0xc(%ebp),%eax
+{
+      2a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  s[0] = c;
+      2d:	88 03                	mov    %al,(%ebx)
+  s[1] = '0' + n / 10;
+      2f:	b8 67 66 66 66       	mov    $0x66666667,%eax
+      34:	f7 e9                	imul   %ecx
+      36:	89 c8                	mov    %ecx,%eax
+  s[2] = '0' + n % 10;
+  s[3] = 0;
+      38:	c6 43 03 00          	movb   $0x0,0x3(%ebx)
+  s[1] = '0' + n / 10;
+      3c:	c1 f8 1f             	sar    $0x1f,%eax
+      3f:	c1 fa 02             	sar    $0x2,%edx
+      42:	29 c2                	sub    %eax,%edx
+      44:	8d 42 30             	lea    0x30(%edx),%eax
+      47:	88 43 01             	mov    %al,0x1(%ebx)
+  s[2] = '0' + n % 10;
+      4a:	8d 04 92             	lea    (%edx,%edx,4),%eax
+      4d:	01 c0                	add    %eax,%eax
+      4f:	29 c1                	sub    %eax,%ecx
+      51:	83 c1 30             	add    $0x30,%ecx
+      54:	88 4b 02             	mov    %cl,0x2(%ebx)
+}
+      57:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+      5a:	c9                   	leave
+      5b:	c3                   	ret
+      5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000060 <age>:
+
+void
+age(void)
+{
+      60:	55                   	push   %ebp
+      61:	b9 10 00 00 00       	mov    $0x10,%ecx
+      66:	89 e5                	mov    %esp,%ebp
+      68:	57                   	push   %edi
+      69:	56                   	push   %esi
+      6a:	53                   	push   %ebx
+      6b:	83 ec 2c             	sub    $0x2c,%esp
+  int r, i, j, n, fd;
+  char path[4];
+
+  for(r = 0; r < NROUND; r++){
+    for(i = r*NAGE; i < (r+1)*NAGE; i++){
+      6e:	8d 41 f0             	lea    -0x10(%ecx),%eax
+      71:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+      74:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+      77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      7e:	66 90                	xchg   %ax,%ax
+  s[1] = '0' + n / 10;
+      80:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+      83:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+      name(path, 'a', i);
+      if((fd = open(path, O_CREATE|O_RDWR)) < 0){
+      88:	83 ec 08             	sub    $0x8,%esp
+  s[0] = c;
+      8b:	c6 45 e4 61          	movb   $0x61,-0x1c(%ebp)
+  s[3] = 0;
+      8f:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+  s[1] = '0' + n / 10;
+      93:	f7 e1                	mul    %ecx
+      95:	c1 ea 03             	shr    $0x3,%edx
+      98:	8d 42 30             	lea    0x30(%edx),%eax
+  s[2] = '0' + n % 10;
+      9b:	8d 14 92             	lea    (%edx,%edx,4),%edx
+  s[1] = '0' + n / 10;
+      9e:	88 45 e5             	mov    %al,-0x1b(%ebp)
+  s[2] = '0' + n % 10;
+      a1:	01 d2                	add    %edx,%edx
+      a3:	89 c8                	mov    %ecx,%eax
+      a5:	29 d0                	sub    %edx,%eax
+      a7:	83 c0 30             	add    $0x30,%eax
+      aa:	88 45 e6             	mov    %al,-0x1a(%ebp)
+      if((fd = open(path, O_CREATE|O_RDWR)) < 0){
+      ad:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+      b0:	68 02 02 00 00       	push   $0x202
+      b5:	50                   	push   %eax
+      b6:	e8 15 09 00 00       	call   9d0 <open>
+      bb:	83 c4 10             	add    $0x10,%esp
+      be:	89 c7                	mov    %eax,%edi
+      c0:	85 c0                	test   %eax,%eax
+      c2:	0f 88 fb 00 00 00    	js     1c3 <age+0x163>
+  seed = seed * 1103515245 + 12345;
+      c8:	69 1d 00 20 00 00 6d 	imul   $0x41c64e6d,0x2000,%ebx
+      cf:	4e c6 41 
+        printf(1, "fsaging: create %s failed\n", path);
+        exit();
+      }
+      n = 1 + rnd() % 8;
+      for(j = 0; j < n; j++)
+      d2:	31 f6                	xor    %esi,%esi
+  seed = seed * 1103515245 + 12345;
+      d4:	81 c3 39 30 00 00    	add    $0x3039,%ebx
+      da:	89 1d 00 20 00 00    	mov    %ebx,0x2000
+  return (seed >> 16) & 0x7fff;
+      e0:	c1 eb 10             	shr    $0x10,%ebx
+      n = 1 + rnd() % 8;
+      e3:	83 e3 07             	and    $0x7,%ebx
+      e6:	83 c3 01             	add    $0x1,%ebx
+      for(j = 0; j < n; j++)
+      e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        write(fd, buf, sizeof(buf));
+      f0:	83 ec 04             	sub    $0x4,%esp
+      for(j = 0; j < n; j++)
+      f3:	83 c6 01             	add    $0x1,%esi
+        write(fd, buf, sizeof(buf));
+      f6:	68 00 02 00 00       	push   $0x200
+      fb:	68 a0 22 00 00       	push   $0x22a0
+     100:	57                   	push   %edi
+     101:	e8 4a 07 00 00       	call   850 <write>
+      for(j = 0; j < n; j++)
+     106:	83 c4 10             	add    $0x10,%esp
+     109:	39 f3                	cmp    %esi,%ebx
+     10b:	7f e3                	jg     f0 <age+0x90>
+      close(fd);
+     10d:	83 ec 0c             	sub    $0xc,%esp
+     110:	57                   	push   %edi
+     111:	e8 ba 07 00 00       	call   8d0 <close>
+      live[i] = 1;
+     116:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    for(i = r*NAGE; i < (r+1)*NAGE; i++){
+     119:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+     11c:	83 c4 10             	add    $0x10,%esp
+      live[i] = 1;
+     11f:	c6 80 40 22 00 00 01 	movb   $0x1,0x2240(%eax)
+    for(i = r*NAGE; i < (r+1)*NAGE; i++){
+     126:	83 c0 01             	add    $0x1,%eax
+     129:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     12c:	39 c8                	cmp    %ecx,%eax
+     12e:	0f 8c 4c ff ff ff    	jl     80 <age+0x20>
+    }
+    for(i = 0; i < (r+1)*NAGE; i++){
+     134:	31 db                	xor    %ebx,%ebx
+     136:	89 ce                	mov    %ecx,%esi
+     138:	eb 0d                	jmp    147 <age+0xe7>
+     13a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     140:	83 c3 01             	add    $0x1,%ebx
+     143:	39 f3                	cmp    %esi,%ebx
+     145:	74 68                	je     1af <age+0x14f>
+      if(live[i] && rnd() % 2){
+     147:	80 bb 40 22 00 00 00 	cmpb   $0x0,0x2240(%ebx)
+     14e:	74 f0                	je     140 <age+0xe0>
+  seed = seed * 1103515245 + 12345;
+     150:	69 05 00 20 00 00 6d 	imul   $0x41c64e6d,0x2000,%eax
+     157:	4e c6 41 
+     15a:	05 39 30 00 00       	add    $0x3039,%eax
+     15f:	a3 00 20 00 00       	mov    %eax,0x2000
+      if(live[i] && rnd() % 2){
+     164:	a9 00 00 01 00       	test   $0x10000,%eax
+     169:	74 d5                	je     140 <age+0xe0>
+  s[1] = '0' + n / 10;
+     16b:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+        name(path, 'a', i);
+        unlink(path);
+     170:	83 ec 0c             	sub    $0xc,%esp
+  s[0] = c;
+     173:	c6 45 e4 61          	movb   $0x61,-0x1c(%ebp)
+  s[1] = '0' + n / 10;
+     177:	f7 e3                	mul    %ebx
+  s[3] = 0;
+     179:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+  s[1] = '0' + n / 10;
+     17d:	c1 ea 03             	shr    $0x3,%edx
+     180:	8d 42 30             	lea    0x30(%edx),%eax
+  s[2] = '0' + n % 10;
+     183:	8d 14 92             	lea    (%edx,%edx,4),%edx
+  s[1] = '0' + n / 10;
+     186:	88 45 e5             	mov    %al,-0x1b(%ebp)
+  s[2] = '0' + n % 10;
+     189:	01 d2                	add    %edx,%edx
+     18b:	89 d8                	mov    %ebx,%eax
+    for(i = 0; i < (r+1)*NAGE; i++){
+     18d:	83 c3 01             	add    $0x1,%ebx
+  s[2] = '0' + n % 10;
+     190:	29 d0                	sub    %edx,%eax
+     192:	83 c0 30             	add    $0x30,%eax
+     195:	88 45 e6             	mov    %al,-0x1a(%ebp)
+        unlink(path);
+     198:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     19b:	50                   	push   %eax
+     19c:	e8 3f 08 00 00       	call   9e0 <unlink>
+        live[i] = 0;
+     1a1:	c6 83 3f 22 00 00 00 	movb   $0x0,0x223f(%ebx)
+     1a8:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < (r+1)*NAGE; i++){
+     1ab:	39 f3                	cmp    %esi,%ebx
+     1ad:	75 98                	jne    147 <age+0xe7>
+  for(r = 0; r < NROUND; r++){
+     1af:	8d 4b 10             	lea    0x10(%ebx),%ecx
+     1b2:	83 fb 60             	cmp    $0x60,%ebx
+     1b5:	0f 85 b3 fe ff ff    	jne    6e <age+0xe>
+      }
+    }
+  }
+}
+     1bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     1be:	5b                   	pop    %ebx
+     1bf:	5e                   	pop    %esi
+     1c0:	5f                   	pop    %edi
+     1c1:	5d                   	pop    %ebp
+     1c2:	c3                   	ret
+        printf(1, "fsaging: create %s failed\n", path);
+     1c3:	83 ec 04             	sub    $0x4,%esp
+     1c6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     1c9:	50                   	push   %eax
+     1ca:	68 48 13 00 00       	push   $0x1348
+     1cf:	6a 01                	push   $0x1
+     1d1:	e8 3a 0d 00 00       	call   f10 <printf>
+        exit();
+     1d6:	e8 a5 05 00 00       	call   780 <exit>
+     1db:	66 90                	xchg   %ax,%ax
+     1dd:	66 90                	xchg   %ax,%ax
+     1df:	90                   	nop
+
+000001e0 <main>:
+
+int
+main(int argc, char *argv[])
+{
+     1e0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     1e4:	83 e4 f0             	and    $0xfffffff0,%esp
+     1e7:	ff 71 fc             	push   -0x4(%ecx)
+     1ea:	55                   	push   %ebp
+     1eb:	89 e5                	mov    %esp,%ebp
+     1ed:	57                   	push   %edi
+     1ee:	56                   	push   %esi
+     1ef:	53                   	push   %ebx
+     1f0:	51                   	push   %ecx
+     1f1:	81 ec a4 00 00 00    	sub    $0xa4,%esp
+  int i, j, fd[NPROBE];
+  char path[4];
+  struct iostat st0, st1;
+  uint nread, nseek;
+
+  mkdir("agedir");
+     1f7:	68 63 13 00 00       	push   $0x1363
+     1fc:	e8 f7 07 00 00       	call   9f8 <mkdir>
+  if(chdir("agedir") < 0){
+     201:	c7 04 24 63 13 00 00 	movl   $0x1363,(%esp)
+     208:	e8 f3 07 00 00       	call   a00 <chdir>
+     20d:	83 c4 10             	add    $0x10,%esp
+     210:	85 c0                	test   %eax,%eax
+     212:	0f 88 4b 02 00 00    	js     463 <main+0x283>
+    printf(1, "fsaging: chdir failed\n");
+    exit();
+  }
+  memset(buf, 'x', sizeof(buf));
+     218:	51                   	push   %ecx
+
+  printf(1, "fsaging: aging with %d rounds of %d files\n", NROUND, NAGE);
+  age();
+
+  for(i = 0; i < NPROBE; i++){
+     219:	31 db                	xor    %ebx,%ebx
+     21b:	8d b5 74 ff ff ff    	lea    -0x8c(%ebp),%esi
+  memset(buf, 'x', sizeof(buf));
+     221:	68 00 02 00 00       	push   $0x200
+     226:	6a 78                	push   $0x78
+     228:	68 a0 22 00 00       	push   $0x22a0
+     22d:	e8 3e 03 00 00       	call   570 <memset>
+  printf(1, "fsaging: aging with %d rounds of %d files\n", NROUND, NAGE);
+     232:	6a 10                	push   $0x10
+     234:	6a 06                	push   $0x6
+     236:	68 84 13 00 00       	push   $0x1384
+     23b:	6a 01                	push   $0x1
+     23d:	e8 ce 0c 00 00       	call   f10 <printf>
+  age();
+     242:	83 c4 20             	add    $0x20,%esp
+     245:	e8 16 fe ff ff       	call   60 <age>
+  for(i = 0; i < NPROBE; i++){
+     24a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  s[0] = c;
+     250:	0f b7 05 2a 14 00 00 	movzwl 0x142a,%eax
+    name(path, 'p', i);
+    fd[i] = open(path, O_CREATE|O_RDWR);
+     257:	83 ec 08             	sub    $0x8,%esp
+  s[3] = 0;
+     25a:	c6 85 77 ff ff ff 00 	movb   $0x0,-0x89(%ebp)
+  s[0] = c;
+     261:	66 89 85 74 ff ff ff 	mov    %ax,-0x8c(%ebp)
+  s[2] = '0' + n % 10;
+     268:	8d 43 30             	lea    0x30(%ebx),%eax
+     26b:	88 85 76 ff ff ff    	mov    %al,-0x8a(%ebp)
+    fd[i] = open(path, O_CREATE|O_RDWR);
+     271:	68 02 02 00 00       	push   $0x202
+     276:	56                   	push   %esi
+     277:	e8 54 07 00 00       	call   9d0 <open>
+  for(i = 0; i < NPROBE; i++){
+     27c:	83 c4 10             	add    $0x10,%esp
+    fd[i] = open(path, O_CREATE|O_RDWR);
+     27f:	89 84 9d 78 ff ff ff 	mov    %eax,-0x88(%ebp,%ebx,4)
+  for(i = 0; i < NPROBE; i++){
+     286:	83 c3 01             	add    $0x1,%ebx
+     289:	83 fb 08             	cmp    $0x8,%ebx
+     28c:	75 c2                	jne    250 <main+0x70>
+     28e:	c7 85 64 ff ff ff 18 	movl   $0x18,-0x9c(%ebp)
+     295:	00 00 00 
+     298:	8d 5d 98             	lea    -0x68(%ebp),%ebx
+     29b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     29f:	90                   	nop
+  }
+  for(j = 0; j < PROBESZ; j++)
+    for(i = 0; i < NPROBE; i++)
+     2a0:	8d 85 78 ff ff ff    	lea    -0x88(%ebp),%eax
+     2a6:	89 85 60 ff ff ff    	mov    %eax,-0xa0(%ebp)
+  for(i = 0; i < NPROBE; i++){
+     2ac:	89 c7                	mov    %eax,%edi
+     2ae:	66 90                	xchg   %ax,%ax
+      write(fd[i], buf, sizeof(buf));
+     2b0:	83 ec 04             	sub    $0x4,%esp
+    for(i = 0; i < NPROBE; i++)
+     2b3:	83 c7 04             	add    $0x4,%edi
+      write(fd[i], buf, sizeof(buf));
+     2b6:	68 00 02 00 00       	push   $0x200
+     2bb:	68 a0 22 00 00       	push   $0x22a0
+     2c0:	ff 77 fc             	push   -0x4(%edi)
+     2c3:	e8 88 05 00 00       	call   850 <write>
+    for(i = 0; i < NPROBE; i++)
+     2c8:	83 c4 10             	add    $0x10,%esp
+     2cb:	39 fb                	cmp    %edi,%ebx
+     2cd:	75 e1                	jne    2b0 <main+0xd0>
+  for(j = 0; j < PROBESZ; j++)
+     2cf:	83 ad 64 ff ff ff 01 	subl   $0x1,-0x9c(%ebp)
+     2d6:	75 c8                	jne    2a0 <main+0xc0>
+     2d8:	8b bd 60 ff ff ff    	mov    -0xa0(%ebp),%edi
+     2de:	66 90                	xchg   %ax,%ax
+  for(i = 0; i < NPROBE; i++)
+    close(fd[i]);
+     2e0:	83 ec 0c             	sub    $0xc,%esp
+     2e3:	ff 37                	push   (%edi)
+  for(i = 0; i < NPROBE; i++)
+     2e5:	83 c7 04             	add    $0x4,%edi
+    close(fd[i]);
+     2e8:	e8 e3 05 00 00       	call   8d0 <close>
+  for(i = 0; i < NPROBE; i++)
+     2ed:	83 c4 10             	add    $0x10,%esp
+     2f0:	39 df                	cmp    %ebx,%edi
+     2f2:	75 ec                	jne    2e0 <main+0x100>
+
+  iostat(&st0);
+     2f4:	83 ec 0c             	sub    $0xc,%esp
+     2f7:	57                   	push   %edi
+     2f8:	bf 30 00 00 00       	mov    $0x30,%edi
+     2fd:	e8 5e 07 00 00       	call   a60 <iostat>
+     302:	83 c4 10             	add    $0x10,%esp
+     305:	8d 76 00             	lea    0x0(%esi),%esi
+  s[0] = c;
+     308:	0f b7 05 2a 14 00 00 	movzwl 0x142a,%eax
+  for(i = 0; i < NPROBE; i++){
+    name(path, 'p', i);
+    fd[0] = open(path, O_RDONLY);
+     30f:	83 ec 08             	sub    $0x8,%esp
+  s[3] = 0;
+     312:	c6 85 77 ff ff ff 00 	movb   $0x0,-0x89(%ebp)
+  s[0] = c;
+     319:	66 89 85 74 ff ff ff 	mov    %ax,-0x8c(%ebp)
+  s[2] = '0' + n % 10;
+     320:	89 f8                	mov    %edi,%eax
+     322:	88 85 76 ff ff ff    	mov    %al,-0x8a(%ebp)
+    fd[0] = open(path, O_RDONLY);
+     328:	6a 00                	push   $0x0
+     32a:	56                   	push   %esi
+     32b:	e8 a0 06 00 00       	call   9d0 <open>
+    while(read(fd[0], buf, sizeof(buf)) > 0)
+     330:	83 c4 10             	add    $0x10,%esp
+    fd[0] = open(path, O_RDONLY);
+     333:	89 c3                	mov    %eax,%ebx
+    while(read(fd[0], buf, sizeof(buf)) > 0)
+     335:	8d 76 00             	lea    0x0(%esi),%esi
+     338:	83 ec 04             	sub    $0x4,%esp
+     33b:	68 00 02 00 00       	push   $0x200
+     340:	68 a0 22 00 00       	push   $0x22a0
+     345:	53                   	push   %ebx
+     346:	e8 85 04 00 00       	call   7d0 <read>
+     34b:	83 c4 10             	add    $0x10,%esp
+     34e:	85 c0                	test   %eax,%eax
+     350:	7f e6                	jg     338 <main+0x158>
+      ;
+    close(fd[0]);
+     352:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < NPROBE; i++){
+     355:	83 c7 01             	add    $0x1,%edi
+    close(fd[0]);
+     358:	53                   	push   %ebx
+     359:	e8 72 05 00 00       	call   8d0 <close>
+  for(i = 0; i < NPROBE; i++){
+     35e:	89 f8                	mov    %edi,%eax
+     360:	83 c4 10             	add    $0x10,%esp
+     363:	3c 38                	cmp    $0x38,%al
+     365:	75 a1                	jne    308 <main+0x128>
+  }
+  iostat(&st1);
+     367:	83 ec 0c             	sub    $0xc,%esp
+     36a:	8d 45 c0             	lea    -0x40(%ebp),%eax
+     36d:	50                   	push   %eax
+     36e:	e8 ed 06 00 00       	call   a60 <iostat>
+
+  nread = st1.nread - st0.nread;
+  nseek = st1.nseek - st0.nseek;
+  printf(1, "fsaging: read %d probe blocks: %d disk reads, %d seeks, "
+     373:	58                   	pop    %eax
+  nread = st1.nread - st0.nread;
+     374:	8b 7d c0             	mov    -0x40(%ebp),%edi
+  nseek = st1.nseek - st0.nseek;
+     377:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  printf(1, "fsaging: read %d probe blocks: %d disk reads, %d seeks, "
+     37a:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  nread = st1.nread - st0.nread;
+     37d:	2b 7d 98             	sub    -0x68(%ebp),%edi
+  nseek = st1.nseek - st0.nseek;
+     380:	2b 5d a0             	sub    -0x60(%ebp),%ebx
+  printf(1, "fsaging: read %d probe blocks: %d disk reads, %d seeks, "
+     383:	2b 45 a4             	sub    -0x5c(%ebp),%eax
+     386:	5a                   	pop    %edx
+     387:	50                   	push   %eax
+     388:	53                   	push   %ebx
+     389:	57                   	push   %edi
+     38a:	68 c0 00 00 00       	push   $0xc0
+     38f:	68 b0 13 00 00       	push   $0x13b0
+     394:	6a 01                	push   $0x1
+     396:	e8 75 0b 00 00       	call   f10 <printf>
+         "%d blocks seek distance\n", NPROBE*PROBESZ, nread, nseek,
+         st1.seekdist - st0.seekdist);
+  if(nseek > 0)
+     39b:	83 c4 20             	add    $0x20,%esp
+     39e:	85 db                	test   %ebx,%ebx
+     3a0:	0f 85 d0 00 00 00    	jne    476 <main+0x296>
+  iostat(&st0);
+     3a6:	bb 30 00 00 00       	mov    $0x30,%ebx
+     3ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     3af:	90                   	nop
+  s[0] = c;
+     3b0:	0f b7 05 2a 14 00 00 	movzwl 0x142a,%eax
+    printf(1, "fsaging: %d.%d blocks read per seek\n",
+           nread / nseek, nread * 10 / nseek % 10);
+
+  for(i = 0; i < NPROBE; i++){
+    name(path, 'p', i);
+    unlink(path);
+     3b7:	83 ec 0c             	sub    $0xc,%esp
+  s[2] = '0' + n % 10;
+     3ba:	88 9d 76 ff ff ff    	mov    %bl,-0x8a(%ebp)
+  for(i = 0; i < NPROBE; i++){
+     3c0:	83 c3 01             	add    $0x1,%ebx
+  s[3] = 0;
+     3c3:	c6 85 77 ff ff ff 00 	movb   $0x0,-0x89(%ebp)
+  s[0] = c;
+     3ca:	66 89 85 74 ff ff ff 	mov    %ax,-0x8c(%ebp)
+    unlink(path);
+     3d1:	56                   	push   %esi
+     3d2:	e8 09 06 00 00       	call   9e0 <unlink>
+  for(i = 0; i < NPROBE; i++){
+     3d7:	83 c4 10             	add    $0x10,%esp
+     3da:	80 fb 38             	cmp    $0x38,%bl
+     3dd:	75 d1                	jne    3b0 <main+0x1d0>
+  }
+  for(i = 0; i < NROUND*NAGE; i++){
+     3df:	31 db                	xor    %ebx,%ebx
+  s[1] = '0' + n / 10;
+     3e1:	bf cd cc cc cc       	mov    $0xcccccccd,%edi
+     3e6:	eb 10                	jmp    3f8 <main+0x218>
+     3e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3ef:	90                   	nop
+  for(i = 0; i < NROUND*NAGE; i++){
+     3f0:	83 c3 01             	add    $0x1,%ebx
+     3f3:	83 fb 60             	cmp    $0x60,%ebx
+     3f6:	74 4d                	je     445 <main+0x265>
+    if(live[i]){
+     3f8:	80 bb 40 22 00 00 00 	cmpb   $0x0,0x2240(%ebx)
+     3ff:	74 ef                	je     3f0 <main+0x210>
+  s[1] = '0' + n / 10;
+     401:	89 d8                	mov    %ebx,%eax
+      name(path, 'a', i);
+      unlink(path);
+     403:	83 ec 0c             	sub    $0xc,%esp
+  s[0] = c;
+     406:	c6 85 74 ff ff ff 61 	movb   $0x61,-0x8c(%ebp)
+  s[1] = '0' + n / 10;
+     40d:	f7 e7                	mul    %edi
+  s[3] = 0;
+     40f:	c6 85 77 ff ff ff 00 	movb   $0x0,-0x89(%ebp)
+  s[1] = '0' + n / 10;
+     416:	c1 ea 03             	shr    $0x3,%edx
+     419:	8d 42 30             	lea    0x30(%edx),%eax
+  s[2] = '0' + n % 10;
+     41c:	8d 14 92             	lea    (%edx,%edx,4),%edx
+  s[1] = '0' + n / 10;
+     41f:	88 85 75 ff ff ff    	mov    %al,-0x8b(%ebp)
+  s[2] = '0' + n % 10;
+     425:	01 d2                	add    %edx,%edx
+     427:	89 d8                	mov    %ebx,%eax
+  for(i = 0; i < NROUND*NAGE; i++){
+     429:	83 c3 01             	add    $0x1,%ebx
+  s[2] = '0' + n % 10;
+     42c:	29 d0                	sub    %edx,%eax
+     42e:	83 c0 30             	add    $0x30,%eax
+     431:	88 85 76 ff ff ff    	mov    %al,-0x8a(%ebp)
+      unlink(path);
+     437:	56                   	push   %esi
+     438:	e8 a3 05 00 00       	call   9e0 <unlink>
+     43d:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NROUND*NAGE; i++){
+     440:	83 fb 60             	cmp    $0x60,%ebx
+     443:	75 b3                	jne    3f8 <main+0x218>
+    }
+  }
+  chdir("..");
+     445:	83 ec 0c             	sub    $0xc,%esp
+     448:	68 81 13 00 00       	push   $0x1381
+     44d:	e8 ae 05 00 00       	call   a00 <chdir>
+  unlink("agedir");
+     452:	c7 04 24 63 13 00 00 	movl   $0x1363,(%esp)
+     459:	e8 82 05 00 00       	call   9e0 <unlink>
+  exit();
+     45e:	e8 1d 03 00 00       	call   780 <exit>
+    printf(1, "fsaging: chdir failed\n");
+     463:	53                   	push   %ebx
+     464:	53                   	push   %ebx
+     465:	68 6a 13 00 00       	push   $0x136a
+     46a:	6a 01                	push   $0x1
+     46c:	e8 9f 0a 00 00       	call   f10 <printf>
+    exit();
+     471:	e8 0a 03 00 00       	call   780 <exit>
+           nread / nseek, nread * 10 / nseek % 10);
+     476:	6b c7 0a             	imul   $0xa,%edi,%eax
+     479:	31 d2                	xor    %edx,%edx
+    printf(1, "fsaging: %d.%d blocks read per seek\n",
+     47b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+           nread / nseek, nread * 10 / nseek % 10);
+     480:	f7 f3                	div    %ebx
+    printf(1, "fsaging: %d.%d blocks read per seek\n",
+     482:	31 d2                	xor    %edx,%edx
+     484:	f7 f1                	div    %ecx
+     486:	89 f8                	mov    %edi,%eax
+     488:	52                   	push   %edx
+     489:	31 d2                	xor    %edx,%edx
+     48b:	f7 f3                	div    %ebx
+     48d:	50                   	push   %eax
+     48e:	68 04 14 00 00       	push   $0x1404
+     493:	6a 01                	push   $0x1
+     495:	e8 76 0a 00 00       	call   f10 <printf>
+     49a:	83 c4 10             	add    $0x10,%esp
+     49d:	e9 04 ff ff ff       	jmp    3a6 <main+0x1c6>
+     4a2:	66 90                	xchg   %ax,%ax
+     4a4:	66 90                	xchg   %ax,%ax
+     4a6:	66 90                	xchg   %ax,%ax
+     4a8:	66 90                	xchg   %ax,%ax
+     4aa:	66 90                	xchg   %ax,%ax
+     4ac:	66 90                	xchg   %ax,%ax
+     4ae:	66 90                	xchg   %ax,%ax
+
+000004b0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     4b0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     4b1:	31 c0                	xor    %eax,%eax
+{
+     4b3:	89 e5                	mov    %esp,%ebp
+     4b5:	53                   	push   %ebx
+     4b6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     4b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     4bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     4c0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     4c4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     4c7:	83 c0 01             	add    $0x1,%eax
+     4ca:	84 d2                	test   %dl,%dl
+     4cc:	75 f2                	jne    4c0 <strcpy+0x10>
+    ;
+  return os;
+}
+     4ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     4d1:	89 c8                	mov    %ecx,%eax
+     4d3:	c9                   	leave
+     4d4:	c3                   	ret
+     4d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004e0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     4e0:	55                   	push   %ebp
+     4e1:	89 e5                	mov    %esp,%ebp
+     4e3:	53                   	push   %ebx
+     4e4:	8b 55 08             	mov    0x8(%ebp),%edx
+     4e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     4ea:	0f b6 02             	movzbl (%edx),%eax
+     4ed:	84 c0                	test   %al,%al
+     4ef:	75 17                	jne    508 <strcmp+0x28>
+     4f1:	eb 3a                	jmp    52d <strcmp+0x4d>
+     4f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     4f7:	90                   	nop
+     4f8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     4fc:	83 c2 01             	add    $0x1,%edx
+     4ff:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     502:	84 c0                	test   %al,%al
+     504:	74 1a                	je     520 <strcmp+0x40>
+    p++, q++;
+     506:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     508:	0f b6 19             	movzbl (%ecx),%ebx
+     50b:	38 c3                	cmp    %al,%bl
+     50d:	74 e9                	je     4f8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     50f:	29 d8                	sub    %ebx,%eax
+}
+     511:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     514:	c9                   	leave
+     515:	c3                   	ret
+     516:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     51d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     520:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     524:	31 c0                	xor    %eax,%eax
+     526:	29 d8                	sub    %ebx,%eax
+}
+     528:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     52b:	c9                   	leave
+     52c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     52d:	0f b6 19             	movzbl (%ecx),%ebx
+     530:	31 c0                	xor    %eax,%eax
+     532:	eb db                	jmp    50f <strcmp+0x2f>
+     534:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     53b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     53f:	90                   	nop
+
+00000540 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     540:	55                   	push   %ebp
+     541:	89 e5                	mov    %esp,%ebp
+     543:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     546:	80 3a 00             	cmpb   $0x0,(%edx)
+     549:	74 15                	je     560 <strlen+0x20>
+     54b:	31 c0                	xor    %eax,%eax
+     54d:	8d 76 00             	lea    0x0(%esi),%esi
+     550:	83 c0 01             	add    $0x1,%eax
+     553:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     557:	89 c1                	mov    %eax,%ecx
+     559:	75 f5                	jne    550 <strlen+0x10>
+    ;
+  return n;
+}
+     55b:	89 c8                	mov    %ecx,%eax
+     55d:	5d                   	pop    %ebp
+     55e:	c3                   	ret
+     55f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     560:	31 c9                	xor    %ecx,%ecx
+}
+     562:	5d                   	pop    %ebp
+     563:	89 c8                	mov    %ecx,%eax
+     565:	c3                   	ret
+     566:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     56d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000570 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     570:	55                   	push   %ebp
+     571:	89 e5                	mov    %esp,%ebp
+     573:	57                   	push   %edi
+     574:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     577:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     57a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     57d:	89 d7                	mov    %edx,%edi
+     57f:	fc                   	cld
+     580:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     582:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     585:	89 d0                	mov    %edx,%eax
+     587:	c9                   	leave
+     588:	c3                   	ret
+     589:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000590 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     590:	55                   	push   %ebp
+     591:	89 e5                	mov    %esp,%ebp
+     593:	56                   	push   %esi
+     594:	53                   	push   %ebx
+     595:	8b 75 10             	mov    0x10(%ebp),%esi
+     598:	8b 55 08             	mov    0x8(%ebp),%edx
+     59b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+     59e:	85 f6                	test   %esi,%esi
+     5a0:	74 2e                	je     5d0 <memcmp+0x40>
+     5a2:	01 c6                	add    %eax,%esi
+     5a4:	eb 14                	jmp    5ba <memcmp+0x2a>
+     5a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5ad:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+     5b0:	83 c0 01             	add    $0x1,%eax
+     5b3:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+     5b6:	39 f0                	cmp    %esi,%eax
+     5b8:	74 16                	je     5d0 <memcmp+0x40>
+    if(*s1 != *s2)
+     5ba:	0f b6 0a             	movzbl (%edx),%ecx
+     5bd:	0f b6 18             	movzbl (%eax),%ebx
+     5c0:	38 d9                	cmp    %bl,%cl
+     5c2:	74 ec                	je     5b0 <memcmp+0x20>
+      return *s1 - *s2;
+     5c4:	0f b6 c1             	movzbl %cl,%eax
+     5c7:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+     5c9:	5b                   	pop    %ebx
+     5ca:	5e                   	pop    %esi
+     5cb:	5d                   	pop    %ebp
+     5cc:	c3                   	ret
+     5cd:	8d 76 00             	lea    0x0(%esi),%esi
+     5d0:	5b                   	pop    %ebx
+  return 0;
+     5d1:	31 c0                	xor    %eax,%eax
+}
+     5d3:	5e                   	pop    %esi
+     5d4:	5d                   	pop    %ebp
+     5d5:	c3                   	ret
+     5d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000005e0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     5e0:	55                   	push   %ebp
+     5e1:	89 e5                	mov    %esp,%ebp
+     5e3:	8b 45 08             	mov    0x8(%ebp),%eax
+     5e6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     5ea:	0f b6 10             	movzbl (%eax),%edx
+     5ed:	84 d2                	test   %dl,%dl
+     5ef:	75 12                	jne    603 <strchr+0x23>
+     5f1:	eb 1d                	jmp    610 <strchr+0x30>
+     5f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     5f7:	90                   	nop
+     5f8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     5fc:	83 c0 01             	add    $0x1,%eax
+     5ff:	84 d2                	test   %dl,%dl
+     601:	74 0d                	je     610 <strchr+0x30>
+    if(*s == c)
+     603:	38 d1                	cmp    %dl,%cl
+     605:	75 f1                	jne    5f8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     607:	5d                   	pop    %ebp
+     608:	c3                   	ret
+     609:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     610:	31 c0                	xor    %eax,%eax
+}
+     612:	5d                   	pop    %ebp
+     613:	c3                   	ret
+     614:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     61b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     61f:	90                   	nop
+
+00000620 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     620:	55                   	push   %ebp
+     621:	89 e5                	mov    %esp,%ebp
+     623:	57                   	push   %edi
+     624:	56                   	push   %esi
+int
+read(int fd, void *buf, int n)
+{
+  if(flushhook)
+    flushhook();
+  return _read(fd, buf, n);
+     625:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     628:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     629:	31 db                	xor    %ebx,%ebx
+{
+     62b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     62e:	eb 32                	jmp    662 <gets+0x42>
+  if(flushhook)
+     630:	a1 a0 24 00 00       	mov    0x24a0,%eax
+     635:	85 c0                	test   %eax,%eax
+     637:	74 02                	je     63b <gets+0x1b>
+    flushhook();
+     639:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+     63b:	83 ec 04             	sub    $0x4,%esp
+     63e:	6a 01                	push   $0x1
+     640:	56                   	push   %esi
+     641:	6a 00                	push   $0x0
+     643:	e8 60 03 00 00       	call   9a8 <_read>
+    if(cc < 1)
+     648:	83 c4 10             	add    $0x10,%esp
+     64b:	85 c0                	test   %eax,%eax
+     64d:	7e 1d                	jle    66c <gets+0x4c>
+    buf[i++] = c;
+     64f:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     653:	8b 55 08             	mov    0x8(%ebp),%edx
+     656:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     65a:	3c 0a                	cmp    $0xa,%al
+     65c:	74 10                	je     66e <gets+0x4e>
+     65e:	3c 0d                	cmp    $0xd,%al
+     660:	74 0c                	je     66e <gets+0x4e>
+  for(i=0; i+1 < max; ){
+     662:	89 df                	mov    %ebx,%edi
+     664:	83 c3 01             	add    $0x1,%ebx
+     667:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     66a:	7c c4                	jl     630 <gets+0x10>
+     66c:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+     66e:	8b 45 08             	mov    0x8(%ebp),%eax
+     671:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+     675:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     678:	5b                   	pop    %ebx
+     679:	5e                   	pop    %esi
+     67a:	5f                   	pop    %edi
+     67b:	5d                   	pop    %ebp
+     67c:	c3                   	ret
+     67d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000680 <stat>:
+{
+     680:	55                   	push   %ebp
+     681:	89 e5                	mov    %esp,%ebp
+     683:	56                   	push   %esi
+     684:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+     685:	83 ec 08             	sub    $0x8,%esp
+     688:	6a 00                	push   $0x0
+     68a:	ff 75 08             	push   0x8(%ebp)
+     68d:	e8 3e 03 00 00       	call   9d0 <open>
+  if(fd < 0)
+     692:	83 c4 10             	add    $0x10,%esp
+     695:	85 c0                	test   %eax,%eax
+     697:	78 37                	js     6d0 <stat+0x50>
+  r = fstat(fd, st);
+     699:	83 ec 08             	sub    $0x8,%esp
+     69c:	ff 75 0c             	push   0xc(%ebp)
+     69f:	89 c3                	mov    %eax,%ebx
+     6a1:	50                   	push   %eax
+     6a2:	e8 41 03 00 00       	call   9e8 <fstat>
+}
+
+int
+close(int fd)
+{
+  if(flushhook)
+     6a7:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+     6aa:	89 c6                	mov    %eax,%esi
+  if(flushhook)
+     6ac:	a1 a0 24 00 00       	mov    0x24a0,%eax
+     6b1:	85 c0                	test   %eax,%eax
+     6b3:	74 02                	je     6b7 <stat+0x37>
+    flushhook();
+     6b5:	ff d0                	call   *%eax
+  return _close(fd);
+     6b7:	83 ec 0c             	sub    $0xc,%esp
+     6ba:	53                   	push   %ebx
+     6bb:	e8 f8 02 00 00       	call   9b8 <_close>
+     6c0:	83 c4 10             	add    $0x10,%esp
+}
+     6c3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     6c6:	89 f0                	mov    %esi,%eax
+     6c8:	5b                   	pop    %ebx
+     6c9:	5e                   	pop    %esi
+     6ca:	5d                   	pop    %ebp
+     6cb:	c3                   	ret
+     6cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+     6d0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     6d5:	eb ec                	jmp    6c3 <stat+0x43>
+     6d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6de:	66 90                	xchg   %ax,%ax
+
+000006e0 <atoi>:
+{
+     6e0:	55                   	push   %ebp
+     6e1:	89 e5                	mov    %esp,%ebp
+     6e3:	53                   	push   %ebx
+     6e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+     6e7:	0f be 02             	movsbl (%edx),%eax
+     6ea:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     6ed:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     6f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     6f5:	77 1e                	ja     715 <atoi+0x35>
+     6f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6fe:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     700:	83 c2 01             	add    $0x1,%edx
+     703:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     706:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     70a:	0f be 02             	movsbl (%edx),%eax
+     70d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     710:	80 fb 09             	cmp    $0x9,%bl
+     713:	76 eb                	jbe    700 <atoi+0x20>
+}
+     715:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     718:	89 c8                	mov    %ecx,%eax
+     71a:	c9                   	leave
+     71b:	c3                   	ret
+     71c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000720 <memmove>:
+{
+     720:	55                   	push   %ebp
+     721:	89 e5                	mov    %esp,%ebp
+     723:	57                   	push   %edi
+     724:	56                   	push   %esi
+     725:	8b 45 10             	mov    0x10(%ebp),%eax
+     728:	8b 55 08             	mov    0x8(%ebp),%edx
+     72b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+     72e:	85 c0                	test   %eax,%eax
+     730:	7e 13                	jle    745 <memmove+0x25>
+     732:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     734:	89 d7                	mov    %edx,%edi
+     736:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     73d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     740:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     741:	39 f8                	cmp    %edi,%eax
+     743:	75 fb                	jne    740 <memmove+0x20>
+}
+     745:	5e                   	pop    %esi
+     746:	89 d0                	mov    %edx,%eax
+     748:	5f                   	pop    %edi
+     749:	5d                   	pop    %ebp
+     74a:	c3                   	ret
+     74b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     74f:	90                   	nop
+
+00000750 <fork>:
+  if(flushhook)
+     750:	a1 a0 24 00 00       	mov    0x24a0,%eax
+     755:	85 c0                	test   %eax,%eax
+     757:	74 17                	je     770 <fork+0x20>
+{
+     759:	55                   	push   %ebp
+     75a:	89 e5                	mov    %esp,%ebp
+     75c:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+     75f:	ff d0                	call   *%eax
+}
+     761:	c9                   	leave
+  return _fork();
+     762:	e9 21 02 00 00       	jmp    988 <_fork>
+     767:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     76e:	66 90                	xchg   %ax,%ax
+     770:	e9 13 02 00 00       	jmp    988 <_fork>
+     775:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     77c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000780 <exit>:
+{
+     780:	55                   	push   %ebp
+     781:	89 e5                	mov    %esp,%ebp
+     783:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+     786:	a1 a0 24 00 00       	mov    0x24a0,%eax
+     78b:	85 c0                	test   %eax,%eax
+     78d:	74 02                	je     791 <exit+0x11>
+    flushhook();
+     78f:	ff d0                	call   *%eax
+  _exit();
+     791:	e8 fa 01 00 00       	call   990 <_exit>
+     796:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     79d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000007a0 <exec>:
+{
+     7a0:	55                   	push   %ebp
+  if(flushhook)
+     7a1:	a1 a0 24 00 00       	mov    0x24a0,%eax
+{
+     7a6:	89 e5                	mov    %esp,%ebp
+     7a8:	56                   	push   %esi
+     7a9:	53                   	push   %ebx
+     7aa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     7ad:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+     7b0:	85 c0                	test   %eax,%eax
+     7b2:	74 02                	je     7b6 <exec+0x16>
+    flushhook();
+     7b4:	ff d0                	call   *%eax
+  return _exec(path, argv);
+     7b6:	89 75 0c             	mov    %esi,0xc(%ebp)
+     7b9:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     7bc:	5b                   	pop    %ebx
+     7bd:	5e                   	pop    %esi
+     7be:	5d                   	pop    %ebp
+  return _exec(path, argv);
+     7bf:	e9 04 02 00 00       	jmp    9c8 <_exec>
+     7c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     7cf:	90                   	nop
+
+000007d0 <read>:
+{
+     7d0:	55                   	push   %ebp
+     7d1:	89 e5                	mov    %esp,%ebp
+     7d3:	57                   	push   %edi
+     7d4:	56                   	push   %esi
+     7d5:	53                   	push   %ebx
+     7d6:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     7d9:	a1 a0 24 00 00       	mov    0x24a0,%eax
+{
+     7de:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     7e1:	8b 75 0c             	mov    0xc(%ebp),%esi
+     7e4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     7e7:	85 c0                	test   %eax,%eax
+     7e9:	74 02                	je     7ed <read+0x1d>
+    flushhook();
+     7eb:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+     7ed:	89 7d 10             	mov    %edi,0x10(%ebp)
+     7f0:	89 75 0c             	mov    %esi,0xc(%ebp)
+     7f3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     7f6:	83 c4 0c             	add    $0xc,%esp
+     7f9:	5b                   	pop    %ebx
+     7fa:	5e                   	pop    %esi
+     7fb:	5f                   	pop    %edi
+     7fc:	5d                   	pop    %ebp
+  return _read(fd, buf, n);
+     7fd:	e9 a6 01 00 00       	jmp    9a8 <_read>
+     802:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     809:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000810 <readv>:
+{
+     810:	55                   	push   %ebp
+     811:	89 e5                	mov    %esp,%ebp
+     813:	57                   	push   %edi
+     814:	56                   	push   %esi
+     815:	53                   	push   %ebx
+     816:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     819:	a1 a0 24 00 00       	mov    0x24a0,%eax
+{
+     81e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     821:	8b 75 0c             	mov    0xc(%ebp),%esi
+     824:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     827:	85 c0                	test   %eax,%eax
+     829:	74 02                	je     82d <readv+0x1d>
+    flushhook();
+     82b:	ff d0                	call   *%eax
+  return _readv(fd, iov, cnt);
+     82d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     830:	89 75 0c             	mov    %esi,0xc(%ebp)
+     833:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     836:	83 c4 0c             	add    $0xc,%esp
+     839:	5b                   	pop    %ebx
+     83a:	5e                   	pop    %esi
+     83b:	5f                   	pop    %edi
+     83c:	5d                   	pop    %ebp
+  return _readv(fd, iov, cnt);
+     83d:	e9 76 02 00 00       	jmp    ab8 <_readv>
+     842:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     849:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000850 <write>:
+{
+     850:	55                   	push   %ebp
+     851:	89 e5                	mov    %esp,%ebp
+     853:	57                   	push   %edi
+     854:	56                   	push   %esi
+     855:	53                   	push   %ebx
+     856:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     859:	a1 a0 24 00 00       	mov    0x24a0,%eax
+{
+     85e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     861:	8b 75 0c             	mov    0xc(%ebp),%esi
+     864:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     867:	85 c0                	test   %eax,%eax
+     869:	74 02                	je     86d <write+0x1d>
+    flushhook();
+     86b:	ff d0                	call   *%eax
+  return _write(fd, buf, n);
+     86d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     870:	89 75 0c             	mov    %esi,0xc(%ebp)
+     873:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     876:	83 c4 0c             	add    $0xc,%esp
+     879:	5b                   	pop    %ebx
+     87a:	5e                   	pop    %esi
+     87b:	5f                   	pop    %edi
+     87c:	5d                   	pop    %ebp
+  return _write(fd, buf, n);
+     87d:	e9 2e 01 00 00       	jmp    9b0 <_write>
+     882:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     889:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000890 <writev>:
+{
+     890:	55                   	push   %ebp
+     891:	89 e5                	mov    %esp,%ebp
+     893:	57                   	push   %edi
+     894:	56                   	push   %esi
+     895:	53                   	push   %ebx
+     896:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     899:	a1 a0 24 00 00       	mov    0x24a0,%eax
+{
+     89e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     8a1:	8b 75 0c             	mov    0xc(%ebp),%esi
+     8a4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     8a7:	85 c0                	test   %eax,%eax
+     8a9:	74 02                	je     8ad <writev+0x1d>
+    flushhook();
+     8ab:	ff d0                	call   *%eax
+  return _writev(fd, iov, cnt);
+     8ad:	89 7d 10             	mov    %edi,0x10(%ebp)
+     8b0:	89 75 0c             	mov    %esi,0xc(%ebp)
+     8b3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     8b6:	83 c4 0c             	add    $0xc,%esp
+     8b9:	5b                   	pop    %ebx
+     8ba:	5e                   	pop    %esi
+     8bb:	5f                   	pop    %edi
+     8bc:	5d                   	pop    %ebp
+  return _writev(fd, iov, cnt);
+     8bd:	e9 fe 01 00 00       	jmp    ac0 <_writev>
+     8c2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000008d0 <close>:
+{
+     8d0:	55                   	push   %ebp
+     8d1:	89 e5                	mov    %esp,%ebp
+     8d3:	53                   	push   %ebx
+     8d4:	83 ec 04             	sub    $0x4,%esp
+  if(flushhook)
+     8d7:	a1 a0 24 00 00       	mov    0x24a0,%eax
+{
+     8dc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(flushhook)
+     8df:	85 c0                	test   %eax,%eax
+     8e1:	74 02                	je     8e5 <close+0x15>
+    flushhook();
+     8e3:	ff d0                	call   *%eax
+  return _close(fd);
+     8e5:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     8e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     8eb:	c9                   	leave
+  return _close(fd);
+     8ec:	e9 c7 00 00 00       	jmp    9b8 <_close>
+     8f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8ff:	90                   	nop
+
+00000900 <umtxinit>:
+// process that finds the mutex held enters the kernel, to sleep
+// in futexwait() until the holder's umtxunlock() wakes it.
+
+void
+umtxinit(struct umutex *m)
+{
+     900:	55                   	push   %ebp
+     901:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+     903:	8b 45 08             	mov    0x8(%ebp),%eax
+     906:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     90c:	5d                   	pop    %ebp
+     90d:	c3                   	ret
+     90e:	66 90                	xchg   %ax,%ax
+
+00000910 <umtxlock>:
+
+void
+umtxlock(struct umutex *m)
+{
+     910:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+     911:	b8 01 00 00 00       	mov    $0x1,%eax
+     916:	89 e5                	mov    %esp,%ebp
+     918:	56                   	push   %esi
+     919:	53                   	push   %ebx
+     91a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     91d:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 1) == 0)
+     920:	85 c0                	test   %eax,%eax
+     922:	74 2b                	je     94f <umtxlock+0x3f>
+     924:	b8 02 00 00 00       	mov    $0x2,%eax
+     929:	f0 87 03             	lock xchg %eax,(%ebx)
+    return;
+  // Mark the mutex contended, so that its holder
+  // wakes a waiter on release, and wait.
+  while(xchg(&m->state, 2) != 0)
+     92c:	85 c0                	test   %eax,%eax
+     92e:	74 1f                	je     94f <umtxlock+0x3f>
+     930:	be 02 00 00 00       	mov    $0x2,%esi
+     935:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwait(&m->state, 2);
+     938:	83 ec 08             	sub    $0x8,%esp
+     93b:	6a 02                	push   $0x2
+     93d:	53                   	push   %ebx
+     93e:	e8 85 01 00 00       	call   ac8 <futexwait>
+     943:	89 f0                	mov    %esi,%eax
+     945:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+     948:	83 c4 10             	add    $0x10,%esp
+     94b:	85 c0                	test   %eax,%eax
+     94d:	75 e9                	jne    938 <umtxlock+0x28>
+}
+     94f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     952:	5b                   	pop    %ebx
+     953:	5e                   	pop    %esi
+     954:	5d                   	pop    %ebp
+     955:	c3                   	ret
+     956:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     95d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000960 <umtxunlock>:
+
+void
+umtxunlock(struct umutex *m)
+{
+     960:	55                   	push   %ebp
+     961:	31 c0                	xor    %eax,%eax
+     963:	89 e5                	mov    %esp,%ebp
+     965:	83 ec 08             	sub    $0x8,%esp
+     968:	8b 55 08             	mov    0x8(%ebp),%edx
+     96b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+     96e:	83 f8 02             	cmp    $0x2,%eax
+     971:	74 05                	je     978 <umtxunlock+0x18>
+    futexwake(&m->state, 1);
+}
+     973:	c9                   	leave
+     974:	c3                   	ret
+     975:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwake(&m->state, 1);
+     978:	83 ec 08             	sub    $0x8,%esp
+     97b:	6a 01                	push   $0x1
+     97d:	52                   	push   %edx
+     97e:	e8 4d 01 00 00       	call   ad0 <futexwake>
+     983:	83 c4 10             	add    $0x10,%esp
+}
+     986:	c9                   	leave
+     987:	c3                   	ret
+
+00000988 <_fork>:
+  _ ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+     988:	b8 01 00 00 00       	mov    $0x1,%eax
+     98d:	cd 40                	int    $0x40
+     98f:	c3                   	ret
+
+00000990 <_exit>:
+RAWSYSCALL(exit)
+     990:	b8 02 00 00 00       	mov    $0x2,%eax
+     995:	cd 40                	int    $0x40
+     997:	c3                   	ret
+
+00000998 <wait>:
+SYSCALL(wait)
+     998:	b8 03 00 00 00       	mov    $0x3,%eax
+     99d:	cd 40                	int    $0x40
+     99f:	c3                   	ret
+
+000009a0 <pipe>:
+SYSCALL(pipe)
+     9a0:	b8 04 00 00 00       	mov    $0x4,%eax
+     9a5:	cd 40                	int    $0x40
+     9a7:	c3                   	ret
+
+000009a8 <_read>:
+RAWSYSCALL(read)
+     9a8:	b8 05 00 00 00       	mov    $0x5,%eax
+     9ad:	cd 40                	int    $0x40
+     9af:	c3                   	ret
+
+000009b0 <_write>:
+RAWSYSCALL(write)
+     9b0:	b8 10 00 00 00       	mov    $0x10,%eax
+     9b5:	cd 40                	int    $0x40
+     9b7:	c3                   	ret
+
+000009b8 <_close>:
+RAWSYSCALL(close)
+     9b8:	b8 15 00 00 00       	mov    $0x15,%eax
+     9bd:	cd 40                	int    $0x40
+     9bf:	c3                   	ret
+
+000009c0 <kill>:
+SYSCALL(kill)
+     9c0:	b8 06 00 00 00       	mov    $0x6,%eax
+     9c5:	cd 40                	int    $0x40
+     9c7:	c3                   	ret
+
+000009c8 <_exec>:
+RAWSYSCALL(exec)
+     9c8:	b8 07 00 00 00       	mov    $0x7,%eax
+     9cd:	cd 40                	int    $0x40
+     9cf:	c3                   	ret
+
+000009d0 <open>:
+SYSCALL(open)
+     9d0:	b8 0f 00 00 00       	mov    $0xf,%eax
+     9d5:	cd 40                	int    $0x40
+     9d7:	c3                   	ret
+
+000009d8 <mknod>:
+SYSCALL(mknod)
+     9d8:	b8 11 00 00 00       	mov    $0x11,%eax
+     9dd:	cd 40                	int    $0x40
+     9df:	c3                   	ret
+
+000009e0 <unlink>:
+SYSCALL(unlink)
+     9e0:	b8 12 00 00 00       	mov    $0x12,%eax
+     9e5:	cd 40                	int    $0x40
+     9e7:	c3                   	ret
+
+000009e8 <fstat>:
+SYSCALL(fstat)
+     9e8:	b8 08 00 00 00       	mov    $0x8,%eax
+     9ed:	cd 40                	int    $0x40
+     9ef:	c3                   	ret
+
+000009f0 <link>:
+SYSCALL(link)
+     9f0:	b8 13 00 00 00       	mov    $0x13,%eax
+     9f5:	cd 40                	int    $0x40
+     9f7:	c3                   	ret
+
+000009f8 <mkdir>:
+SYSCALL(mkdir)
+     9f8:	b8 14 00 00 00       	mov    $0x14,%eax
+     9fd:	cd 40                	int    $0x40
+     9ff:	c3                   	ret
+
+00000a00 <chdir>:
+SYSCALL(chdir)
+     a00:	b8 09 00 00 00       	mov    $0x9,%eax
+     a05:	cd 40                	int    $0x40
+     a07:	c3                   	ret
+
+00000a08 <dup>:
+SYSCALL(dup)
+     a08:	b8 0a 00 00 00       	mov    $0xa,%eax
+     a0d:	cd 40                	int    $0x40
+     a0f:	c3                   	ret
+
+00000a10 <getpid>:
+SYSCALL(getpid)
+     a10:	b8 0b 00 00 00       	mov    $0xb,%eax
+     a15:	cd 40                	int    $0x40
+     a17:	c3                   	ret
+
+00000a18 <sbrk>:
+SYSCALL(sbrk)
+     a18:	b8 0c 00 00 00       	mov    $0xc,%eax
+     a1d:	cd 40                	int    $0x40
+     a1f:	c3                   	ret
+
+00000a20 <sleep>:
+SYSCALL(sleep)
+     a20:	b8 0d 00 00 00       	mov    $0xd,%eax
+     a25:	cd 40                	int    $0x40
+     a27:	c3                   	ret
+
+00000a28 <uptime>:
+SYSCALL(uptime)
+     a28:	b8 0e 00 00 00       	mov    $0xe,%eax
+     a2d:	cd 40                	int    $0x40
+     a2f:	c3                   	ret
+
+00000a30 <wolfie>:
+SYSCALL(wolfie)
+     a30:	b8 16 00 00 00       	mov    $0x16,%eax
+     a35:	cd 40                	int    $0x40
+     a37:	c3                   	ret
+
+00000a38 <nice>:
+SYSCALL(nice)
+     a38:	b8 17 00 00 00       	mov    $0x17,%eax
+     a3d:	cd 40                	int    $0x40
+     a3f:	c3                   	ret
+
+00000a40 <mtxget>:
+SYSCALL(mtxget)
+     a40:	b8 18 00 00 00       	mov    $0x18,%eax
+     a45:	cd 40                	int    $0x40
+     a47:	c3                   	ret
+
+00000a48 <mtxrel>:
+SYSCALL(mtxrel)
+     a48:	b8 19 00 00 00       	mov    $0x19,%eax
+     a4d:	cd 40                	int    $0x40
+     a4f:	c3                   	ret
+
+00000a50 <mtxacq>:
+SYSCALL(mtxacq)
+     a50:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     a55:	cd 40                	int    $0x40
+     a57:	c3                   	ret
+
+00000a58 <mtxdel>:
+SYSCALL(mtxdel)
+     a58:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     a5d:	cd 40                	int    $0x40
+     a5f:	c3                   	ret
+
+00000a60 <iostat>:
+SYSCALL(iostat)
+     a60:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     a65:	cd 40                	int    $0x40
+     a67:	c3                   	ret
+
+00000a68 <mmap>:
+SYSCALL(mmap)
+     a68:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     a6d:	cd 40                	int    $0x40
+     a6f:	c3                   	ret
+
+00000a70 <munmap>:
+SYSCALL(munmap)
+     a70:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     a75:	cd 40                	int    $0x40
+     a77:	c3                   	ret
+
+00000a78 <shmget>:
+SYSCALL(shmget)
+     a78:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     a7d:	cd 40                	int    $0x40
+     a7f:	c3                   	ret
+
+00000a80 <shmat>:
+SYSCALL(shmat)
+     a80:	b8 20 00 00 00       	mov    $0x20,%eax
+     a85:	cd 40                	int    $0x40
+     a87:	c3                   	ret
+
+00000a88 <shmdt>:
+SYSCALL(shmdt)
+     a88:	b8 21 00 00 00       	mov    $0x21,%eax
+     a8d:	cd 40                	int    $0x40
+     a8f:	c3                   	ret
+
+00000a90 <shmdel>:
+SYSCALL(shmdel)
+     a90:	b8 22 00 00 00       	mov    $0x22,%eax
+     a95:	cd 40                	int    $0x40
+     a97:	c3                   	ret
+
+00000a98 <syscount>:
+SYSCALL(syscount)
+     a98:	b8 23 00 00 00       	mov    $0x23,%eax
+     a9d:	cd 40                	int    $0x40
+     a9f:	c3                   	ret
+
+00000aa0 <splice>:
+SYSCALL(splice)
+     aa0:	b8 24 00 00 00       	mov    $0x24,%eax
+     aa5:	cd 40                	int    $0x40
+     aa7:	c3                   	ret
+
+00000aa8 <tee>:
+SYSCALL(tee)
+     aa8:	b8 25 00 00 00       	mov    $0x25,%eax
+     aad:	cd 40                	int    $0x40
+     aaf:	c3                   	ret
+
+00000ab0 <sendfile>:
+SYSCALL(sendfile)
+     ab0:	b8 26 00 00 00       	mov    $0x26,%eax
+     ab5:	cd 40                	int    $0x40
+     ab7:	c3                   	ret
+
+00000ab8 <_readv>:
+RAWSYSCALL(readv)
+     ab8:	b8 27 00 00 00       	mov    $0x27,%eax
+     abd:	cd 40                	int    $0x40
+     abf:	c3                   	ret
+
+00000ac0 <_writev>:
+RAWSYSCALL(writev)
+     ac0:	b8 28 00 00 00       	mov    $0x28,%eax
+     ac5:	cd 40                	int    $0x40
+     ac7:	c3                   	ret
+
+00000ac8 <futexwait>:
+SYSCALL(futexwait)
+     ac8:	b8 29 00 00 00       	mov    $0x29,%eax
+     acd:	cd 40                	int    $0x40
+     acf:	c3                   	ret
+
+00000ad0 <futexwake>:
+SYSCALL(futexwake)
+     ad0:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     ad5:	cd 40                	int    $0x40
+     ad7:	c3                   	ret
+
+00000ad8 <lockstat>:
+SYSCALL(lockstat)
+     ad8:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     add:	cd 40                	int    $0x40
+     adf:	c3                   	ret
+
+00000ae0 <clone>:
+SYSCALL(clone)
+     ae0:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     ae5:	cd 40                	int    $0x40
+     ae7:	c3                   	ret
+
+00000ae8 <join>:
+SYSCALL(join)
+     ae8:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     aed:	cd 40                	int    $0x40
+     aef:	c3                   	ret
+
+00000af0 <stacklimit>:
+SYSCALL(stacklimit)
+     af0:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     af5:	cd 40                	int    $0x40
+     af7:	c3                   	ret
+     af8:	66 90                	xchg   %ax,%ax
+     afa:	66 90                	xchg   %ax,%ax
+     afc:	66 90                	xchg   %ax,%ax
+     afe:	66 90                	xchg   %ax,%ax
+
+00000b00 <flushall>:
+  b->n = 0;
+}
+
+static void
+flushall(void)
+{
+     b00:	55                   	push   %ebp
+     b01:	89 e5                	mov    %esp,%ebp
+     b03:	83 ec 14             	sub    $0x14,%esp
+  umtxlock(&stdoutlock);
+     b06:	68 a4 24 00 00       	push   $0x24a4
+     b0b:	e8 00 fe ff ff       	call   910 <umtxlock>
+  if(b->n > 0)
+     b10:	a1 28 20 00 00       	mov    0x2028,%eax
+     b15:	83 c4 10             	add    $0x10,%esp
+     b18:	85 c0                	test   %eax,%eax
+     b1a:	7e 17                	jle    b33 <flushall+0x33>
+    _write(b->fd, b->buf, b->n);
+     b1c:	83 ec 04             	sub    $0x4,%esp
+     b1f:	50                   	push   %eax
+     b20:	68 2c 20 00 00       	push   $0x202c
+     b25:	ff 35 20 20 00 00    	push   0x2020
+     b2b:	e8 80 fe ff ff       	call   9b0 <_write>
+     b30:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     b33:	c7 05 28 20 00 00 00 	movl   $0x0,0x2028
+     b3a:	00 00 00 
+  flush(&stdout);
+  umtxunlock(&stdoutlock);
+     b3d:	83 ec 0c             	sub    $0xc,%esp
+     b40:	68 a4 24 00 00       	push   $0x24a4
+     b45:	e8 16 fe ff ff       	call   960 <umtxunlock>
+}
+     b4a:	83 c4 10             	add    $0x10,%esp
+     b4d:	c9                   	leave
+     b4e:	c3                   	ret
+     b4f:	90                   	nop
+
+00000b50 <printint>:
+    flush(b);
+}
+
+static void
+printint(struct outbuf *b, int xx, int base, int sgn)
+{
+     b50:	55                   	push   %ebp
+     b51:	89 e5                	mov    %esp,%ebp
+     b53:	57                   	push   %edi
+     b54:	89 cf                	mov    %ecx,%edi
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     b56:	89 d1                	mov    %edx,%ecx
+{
+     b58:	56                   	push   %esi
+     b59:	53                   	push   %ebx
+     b5a:	89 c3                	mov    %eax,%ebx
+     b5c:	83 ec 2c             	sub    $0x2c,%esp
+  if(sgn && xx < 0){
+     b5f:	85 d2                	test   %edx,%edx
+     b61:	0f 89 b9 00 00 00    	jns    c20 <printint+0xd0>
+     b67:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     b6b:	0f 84 af 00 00 00    	je     c20 <printint+0xd0>
+    x = -xx;
+     b71:	f7 d9                	neg    %ecx
+    neg = 1;
+     b73:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     b78:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     b7b:	31 f6                	xor    %esi,%esi
+     b7d:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     b80:	89 c8                	mov    %ecx,%eax
+     b82:	31 d2                	xor    %edx,%edx
+     b84:	89 f3                	mov    %esi,%ebx
+     b86:	f7 f7                	div    %edi
+     b88:	8d 76 01             	lea    0x1(%esi),%esi
+     b8b:	0f b6 92 a0 18 00 00 	movzbl 0x18a0(%edx),%edx
+     b92:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     b96:	89 ca                	mov    %ecx,%edx
+     b98:	89 c1                	mov    %eax,%ecx
+     b9a:	39 fa                	cmp    %edi,%edx
+     b9c:	73 e2                	jae    b80 <printint+0x30>
+  if(neg)
+     b9e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     ba1:	89 d9                	mov    %ebx,%ecx
+     ba3:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     ba6:	85 c0                	test   %eax,%eax
+     ba8:	74 07                	je     bb1 <printint+0x61>
+    buf[i++] = '-';
+     baa:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     baf:	89 f1                	mov    %esi,%ecx
+     bb1:	8d 75 d8             	lea    -0x28(%ebp),%esi
+     bb4:	89 cf                	mov    %ecx,%edi
+     bb6:	01 f7                	add    %esi,%edi
+     bb8:	eb 1a                	jmp    bd4 <printint+0x84>
+     bba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    *b->str++ = c;
+     bc0:	8d 48 01             	lea    0x1(%eax),%ecx
+     bc3:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+     bc9:	88 10                	mov    %dl,(%eax)
+
+  while(--i >= 0)
+     bcb:	8d 47 ff             	lea    -0x1(%edi),%eax
+     bce:	39 fe                	cmp    %edi,%esi
+     bd0:	74 40                	je     c12 <printint+0xc2>
+     bd2:	89 c7                	mov    %eax,%edi
+  if(b->str){
+     bd4:	8b 83 0c 02 00 00    	mov    0x20c(%ebx),%eax
+    putc(b, buf[i]);
+     bda:	0f b6 17             	movzbl (%edi),%edx
+  if(b->str){
+     bdd:	85 c0                	test   %eax,%eax
+     bdf:	75 df                	jne    bc0 <printint+0x70>
+  b->buf[b->n++] = c;
+     be1:	8b 4b 08             	mov    0x8(%ebx),%ecx
+     be4:	8d 41 01             	lea    0x1(%ecx),%eax
+     be7:	89 43 08             	mov    %eax,0x8(%ebx)
+     bea:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+     bee:	3d 00 02 00 00       	cmp    $0x200,%eax
+     bf3:	74 3b                	je     c30 <printint+0xe0>
+     bf5:	80 fa 0a             	cmp    $0xa,%dl
+     bf8:	75 d1                	jne    bcb <printint+0x7b>
+     bfa:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+     bfe:	75 cb                	jne    bcb <printint+0x7b>
+  if(b->n > 0)
+     c00:	85 c0                	test   %eax,%eax
+     c02:	7f 2c                	jg     c30 <printint+0xe0>
+  b->n = 0;
+     c04:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  while(--i >= 0)
+     c0b:	8d 47 ff             	lea    -0x1(%edi),%eax
+     c0e:	39 fe                	cmp    %edi,%esi
+     c10:	75 c0                	jne    bd2 <printint+0x82>
+}
+     c12:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c15:	5b                   	pop    %ebx
+     c16:	5e                   	pop    %esi
+     c17:	5f                   	pop    %edi
+     c18:	5d                   	pop    %ebp
+     c19:	c3                   	ret
+     c1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  neg = 0;
+     c20:	31 c0                	xor    %eax,%eax
+     c22:	e9 51 ff ff ff       	jmp    b78 <printint+0x28>
+     c27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c2e:	66 90                	xchg   %ax,%ax
+    _write(b->fd, b->buf, b->n);
+     c30:	83 ec 04             	sub    $0x4,%esp
+     c33:	50                   	push   %eax
+     c34:	8d 43 0c             	lea    0xc(%ebx),%eax
+     c37:	50                   	push   %eax
+     c38:	ff 33                	push   (%ebx)
+     c3a:	e8 71 fd ff ff       	call   9b0 <_write>
+     c3f:	83 c4 10             	add    $0x10,%esp
+     c42:	eb c0                	jmp    c04 <printint+0xb4>
+     c44:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c4f:	90                   	nop
+
+00000c50 <putc>:
+{
+     c50:	55                   	push   %ebp
+     c51:	89 e5                	mov    %esp,%ebp
+     c53:	53                   	push   %ebx
+     c54:	89 c3                	mov    %eax,%ebx
+     c56:	83 ec 04             	sub    $0x4,%esp
+  if(b->str){
+     c59:	8b 80 0c 02 00 00    	mov    0x20c(%eax),%eax
+     c5f:	85 c0                	test   %eax,%eax
+     c61:	74 15                	je     c78 <putc+0x28>
+    *b->str++ = c;
+     c63:	8d 48 01             	lea    0x1(%eax),%ecx
+     c66:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+     c6c:	88 10                	mov    %dl,(%eax)
+}
+     c6e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     c71:	c9                   	leave
+     c72:	c3                   	ret
+     c73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c77:	90                   	nop
+  b->buf[b->n++] = c;
+     c78:	8b 4b 08             	mov    0x8(%ebx),%ecx
+     c7b:	8d 41 01             	lea    0x1(%ecx),%eax
+     c7e:	89 43 08             	mov    %eax,0x8(%ebx)
+     c81:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+     c85:	3d 00 02 00 00       	cmp    $0x200,%eax
+     c8a:	74 14                	je     ca0 <putc+0x50>
+     c8c:	80 fa 0a             	cmp    $0xa,%dl
+     c8f:	75 dd                	jne    c6e <putc+0x1e>
+     c91:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+     c95:	75 d7                	jne    c6e <putc+0x1e>
+  if(b->n > 0)
+     c97:	85 c0                	test   %eax,%eax
+     c99:	7e 17                	jle    cb2 <putc+0x62>
+     c9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c9f:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     ca0:	83 ec 04             	sub    $0x4,%esp
+     ca3:	50                   	push   %eax
+     ca4:	8d 43 0c             	lea    0xc(%ebx),%eax
+     ca7:	50                   	push   %eax
+     ca8:	ff 33                	push   (%ebx)
+     caa:	e8 01 fd ff ff       	call   9b0 <_write>
+     caf:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     cb2:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+     cb9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     cbc:	c9                   	leave
+     cbd:	c3                   	ret
+     cbe:	66 90                	xchg   %ax,%ax
+
+00000cc0 <format>:
+
+// Format fmt and the arguments at ap into b.
+// Only understands %d, %x, %p, %s, %c.
+static void
+format(struct outbuf *b, const char *fmt, uint *ap)
+{
+     cc0:	55                   	push   %ebp
+     cc1:	89 e5                	mov    %esp,%ebp
+     cc3:	57                   	push   %edi
+     cc4:	89 c7                	mov    %eax,%edi
+     cc6:	56                   	push   %esi
+     cc7:	53                   	push   %ebx
+     cc8:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+     ccb:	0f b6 02             	movzbl (%edx),%eax
+{
+     cce:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  for(i = 0; fmt[i]; i++){
+     cd1:	84 c0                	test   %al,%al
+     cd3:	74 5a                	je     d2f <format+0x6f>
+     cd5:	8d 5a 01             	lea    0x1(%edx),%ebx
+     cd8:	31 f6                	xor    %esi,%esi
+     cda:	eb 1c                	jmp    cf8 <format+0x38>
+     cdc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     ce0:	83 f8 25             	cmp    $0x25,%eax
+     ce3:	74 3b                	je     d20 <format+0x60>
+        state = '%';
+      } else {
+        putc(b, c);
+     ce5:	89 ca                	mov    %ecx,%edx
+     ce7:	89 f8                	mov    %edi,%eax
+     ce9:	e8 62 ff ff ff       	call   c50 <putc>
+  for(i = 0; fmt[i]; i++){
+     cee:	0f b6 03             	movzbl (%ebx),%eax
+     cf1:	83 c3 01             	add    $0x1,%ebx
+     cf4:	84 c0                	test   %al,%al
+     cf6:	74 37                	je     d2f <format+0x6f>
+    c = fmt[i] & 0xff;
+     cf8:	0f be c8             	movsbl %al,%ecx
+     cfb:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     cfe:	85 f6                	test   %esi,%esi
+     d00:	74 de                	je     ce0 <format+0x20>
+      }
+    } else if(state == '%'){
+     d02:	83 fe 25             	cmp    $0x25,%esi
+     d05:	75 e7                	jne    cee <format+0x2e>
+      if(c == 'd'){
+     d07:	83 f8 25             	cmp    $0x25,%eax
+     d0a:	74 46                	je     d52 <format+0x92>
+     d0c:	83 e8 63             	sub    $0x63,%eax
+     d0f:	83 f8 15             	cmp    $0x15,%eax
+     d12:	77 2c                	ja     d40 <format+0x80>
+     d14:	ff 24 85 48 18 00 00 	jmp    *0x1848(,%eax,4)
+     d1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d1f:	90                   	nop
+  for(i = 0; fmt[i]; i++){
+     d20:	0f b6 03             	movzbl (%ebx),%eax
+     d23:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+     d26:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+     d2b:	84 c0                	test   %al,%al
+     d2d:	75 c9                	jne    cf8 <format+0x38>
+        putc(b, c);
+      }
+      state = 0;
+    }
+  }
+}
+     d2f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d32:	5b                   	pop    %ebx
+     d33:	5e                   	pop    %esi
+     d34:	5f                   	pop    %edi
+     d35:	5d                   	pop    %ebp
+     d36:	c3                   	ret
+     d37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d3e:	66 90                	xchg   %ax,%ax
+        putc(b, '%');
+     d40:	ba 25 00 00 00       	mov    $0x25,%edx
+     d45:	89 f8                	mov    %edi,%eax
+     d47:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     d4a:	e8 01 ff ff ff       	call   c50 <putc>
+        putc(b, c);
+     d4f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     d52:	89 ca                	mov    %ecx,%edx
+     d54:	89 f8                	mov    %edi,%eax
+      state = 0;
+     d56:	31 f6                	xor    %esi,%esi
+        putc(b, c);
+     d58:	e8 f3 fe ff ff       	call   c50 <putc>
+     d5d:	eb 8f                	jmp    cee <format+0x2e>
+     d5f:	90                   	nop
+        printint(b, *ap, 16, 0);
+     d60:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     d63:	83 ec 0c             	sub    $0xc,%esp
+     d66:	b9 10 00 00 00       	mov    $0x10,%ecx
+     d6b:	8b 16                	mov    (%esi),%edx
+     d6d:	6a 00                	push   $0x0
+        ap++;
+     d6f:	83 c6 04             	add    $0x4,%esi
+        printint(b, *ap, 16, 0);
+     d72:	89 f8                	mov    %edi,%eax
+     d74:	e8 d7 fd ff ff       	call   b50 <printint>
+        ap++;
+     d79:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+     d7c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     d7f:	31 f6                	xor    %esi,%esi
+     d81:	e9 68 ff ff ff       	jmp    cee <format+0x2e>
+     d86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d8d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     d90:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     d93:	8b 30                	mov    (%eax),%esi
+        ap++;
+     d95:	83 c0 04             	add    $0x4,%eax
+     d98:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+     d9b:	85 f6                	test   %esi,%esi
+     d9d:	75 1b                	jne    dba <format+0xfa>
+     d9f:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+     da4:	be 40 18 00 00       	mov    $0x1840,%esi
+     da9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+          putc(b, *s);
+     db0:	89 f8                	mov    %edi,%eax
+          s++;
+     db2:	83 c6 01             	add    $0x1,%esi
+          putc(b, *s);
+     db5:	e8 96 fe ff ff       	call   c50 <putc>
+        while(*s != 0){
+     dba:	0f be 16             	movsbl (%esi),%edx
+     dbd:	84 d2                	test   %dl,%dl
+     dbf:	75 ef                	jne    db0 <format+0xf0>
+      state = 0;
+     dc1:	31 f6                	xor    %esi,%esi
+     dc3:	e9 26 ff ff ff       	jmp    cee <format+0x2e>
+     dc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dcf:	90                   	nop
+        printint(b, *ap, 10, 1);
+     dd0:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     dd3:	83 ec 0c             	sub    $0xc,%esp
+     dd6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     ddb:	8b 16                	mov    (%esi),%edx
+     ddd:	6a 01                	push   $0x1
+     ddf:	eb 8e                	jmp    d6f <format+0xaf>
+     de1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(b, *ap);
+     de8:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     deb:	89 f8                	mov    %edi,%eax
+     ded:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+     df0:	83 c6 04             	add    $0x4,%esi
+        putc(b, *ap);
+     df3:	e8 58 fe ff ff       	call   c50 <putc>
+        ap++;
+     df8:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      state = 0;
+     dfb:	31 f6                	xor    %esi,%esi
+     dfd:	e9 ec fe ff ff       	jmp    cee <format+0x2e>
+     e02:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000e10 <fflush>:
+{
+     e10:	55                   	push   %ebp
+     e11:	89 e5                	mov    %esp,%ebp
+     e13:	83 ec 08             	sub    $0x8,%esp
+  if(fd == stdout.fd)
+     e16:	8b 45 08             	mov    0x8(%ebp),%eax
+     e19:	39 05 20 20 00 00    	cmp    %eax,0x2020
+     e1f:	74 07                	je     e28 <fflush+0x18>
+}
+     e21:	c9                   	leave
+     e22:	c3                   	ret
+     e23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e27:	90                   	nop
+  umtxlock(&stdoutlock);
+     e28:	83 ec 0c             	sub    $0xc,%esp
+     e2b:	68 a4 24 00 00       	push   $0x24a4
+     e30:	e8 db fa ff ff       	call   910 <umtxlock>
+  if(b->n > 0)
+     e35:	a1 28 20 00 00       	mov    0x2028,%eax
+     e3a:	83 c4 10             	add    $0x10,%esp
+     e3d:	85 c0                	test   %eax,%eax
+     e3f:	7f 1f                	jg     e60 <fflush+0x50>
+  b->n = 0;
+     e41:	c7 05 28 20 00 00 00 	movl   $0x0,0x2028
+     e48:	00 00 00 
+  umtxunlock(&stdoutlock);
+     e4b:	c7 45 08 a4 24 00 00 	movl   $0x24a4,0x8(%ebp)
+}
+     e52:	c9                   	leave
+  umtxunlock(&stdoutlock);
+     e53:	e9 08 fb ff ff       	jmp    960 <umtxunlock>
+     e58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e5f:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     e60:	83 ec 04             	sub    $0x4,%esp
+     e63:	50                   	push   %eax
+     e64:	68 2c 20 00 00       	push   $0x202c
+     e69:	ff 35 20 20 00 00    	push   0x2020
+     e6f:	e8 3c fb ff ff       	call   9b0 <_write>
+     e74:	83 c4 10             	add    $0x10,%esp
+     e77:	eb c8                	jmp    e41 <fflush+0x31>
+     e79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000e80 <setvbuf>:
+{
+     e80:	55                   	push   %ebp
+     e81:	89 e5                	mov    %esp,%ebp
+     e83:	53                   	push   %ebx
+     e84:	83 ec 04             	sub    $0x4,%esp
+     e87:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd != stdout.fd)
+     e8a:	8b 45 08             	mov    0x8(%ebp),%eax
+     e8d:	39 05 20 20 00 00    	cmp    %eax,0x2020
+     e93:	74 0b                	je     ea0 <setvbuf+0x20>
+}
+     e95:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     e98:	c9                   	leave
+     e99:	c3                   	ret
+     e9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  umtxlock(&stdoutlock);
+     ea0:	83 ec 0c             	sub    $0xc,%esp
+     ea3:	68 a4 24 00 00       	push   $0x24a4
+     ea8:	e8 63 fa ff ff       	call   910 <umtxlock>
+  if(b->n > 0)
+     ead:	a1 28 20 00 00       	mov    0x2028,%eax
+     eb2:	83 c4 10             	add    $0x10,%esp
+     eb5:	85 c0                	test   %eax,%eax
+     eb7:	7f 2f                	jg     ee8 <setvbuf+0x68>
+  b->n = 0;
+     eb9:	c7 05 28 20 00 00 00 	movl   $0x0,0x2028
+     ec0:	00 00 00 
+  stdout.mode = mode;
+     ec3:	89 1d 24 20 00 00    	mov    %ebx,0x2024
+  flushhook = flushall;
+     ec9:	c7 05 a0 24 00 00 00 	movl   $0xb00,0x24a0
+     ed0:	0b 00 00 
+}
+     ed3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&stdoutlock);
+     ed6:	c7 45 08 a4 24 00 00 	movl   $0x24a4,0x8(%ebp)
+}
+     edd:	c9                   	leave
+  umtxunlock(&stdoutlock);
+     ede:	e9 7d fa ff ff       	jmp    960 <umtxunlock>
+     ee3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     ee7:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     ee8:	83 ec 04             	sub    $0x4,%esp
+     eeb:	50                   	push   %eax
+     eec:	68 2c 20 00 00       	push   $0x202c
+     ef1:	ff 35 20 20 00 00    	push   0x2020
+     ef7:	e8 b4 fa ff ff       	call   9b0 <_write>
+     efc:	83 c4 10             	add    $0x10,%esp
+     eff:	eb b8                	jmp    eb9 <setvbuf+0x39>
+     f01:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f0f:	90                   	nop
+
+00000f10 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s, %c.
+void
+printf(int fd, const char *fmt, ...)
+{
+     f10:	55                   	push   %ebp
+     f11:	89 e5                	mov    %esp,%ebp
+     f13:	53                   	push   %ebx
+     f14:	81 ec 14 02 00 00    	sub    $0x214,%esp
+     f1a:	8b 45 08             	mov    0x8(%ebp),%eax
+    local.mode = _IONBF;
+    local.n = 0;
+    local.str = 0;
+    b = &local;
+  }
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     f1d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd == stdout.fd){
+     f20:	39 05 20 20 00 00    	cmp    %eax,0x2020
+     f26:	74 48                	je     f70 <printf+0x60>
+    local.fd = fd;
+     f28:	89 85 e8 fd ff ff    	mov    %eax,-0x218(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     f2e:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     f31:	89 da                	mov    %ebx,%edx
+     f33:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+    local.mode = _IONBF;
+     f39:	c7 85 ec fd ff ff 03 	movl   $0x3,-0x214(%ebp)
+     f40:	00 00 00 
+    local.n = 0;
+     f43:	c7 85 f0 fd ff ff 00 	movl   $0x0,-0x210(%ebp)
+     f4a:	00 00 00 
+    local.str = 0;
+     f4d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     f54:	e8 67 fd ff ff       	call   cc0 <format>
+  if(b->mode == _IONBF)
+     f59:	83 bd ec fd ff ff 03 	cmpl   $0x3,-0x214(%ebp)
+     f60:	0f 84 a2 00 00 00    	je     1008 <printf+0xf8>
+    flush(b);
+  if(b == &stdout)
+    umtxunlock(&stdoutlock);
+}
+     f66:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     f69:	c9                   	leave
+     f6a:	c3                   	ret
+     f6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     f6f:	90                   	nop
+    umtxlock(&stdoutlock);
+     f70:	83 ec 0c             	sub    $0xc,%esp
+     f73:	68 a4 24 00 00       	push   $0x24a4
+     f78:	e8 93 f9 ff ff       	call   910 <umtxlock>
+  if(stdout.mode == 0){
+     f7d:	a1 24 20 00 00       	mov    0x2024,%eax
+     f82:	83 c4 10             	add    $0x10,%esp
+     f85:	85 c0                	test   %eax,%eax
+     f87:	74 37                	je     fc0 <printf+0xb0>
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     f89:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     f8c:	89 da                	mov    %ebx,%edx
+     f8e:	b8 20 20 00 00       	mov    $0x2020,%eax
+     f93:	e8 28 fd ff ff       	call   cc0 <format>
+  if(b->mode == _IONBF)
+     f98:	83 3d 24 20 00 00 03 	cmpl   $0x3,0x2024
+     f9f:	0f 84 ab 00 00 00    	je     1050 <printf+0x140>
+    umtxunlock(&stdoutlock);
+     fa5:	83 ec 0c             	sub    $0xc,%esp
+     fa8:	68 a4 24 00 00       	push   $0x24a4
+     fad:	e8 ae f9 ff ff       	call   960 <umtxunlock>
+}
+     fb2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    umtxunlock(&stdoutlock);
+     fb5:	83 c4 10             	add    $0x10,%esp
+}
+     fb8:	c9                   	leave
+     fb9:	c3                   	ret
+     fba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+     fc0:	83 ec 08             	sub    $0x8,%esp
+     fc3:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+     fc9:	50                   	push   %eax
+     fca:	ff 35 20 20 00 00    	push   0x2020
+     fd0:	e8 13 fa ff ff       	call   9e8 <fstat>
+     fd5:	83 c4 10             	add    $0x10,%esp
+     fd8:	89 c2                	mov    %eax,%edx
+      stdout.mode = _IOFBF;
+     fda:	b8 01 00 00 00       	mov    $0x1,%eax
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+     fdf:	85 d2                	test   %edx,%edx
+     fe1:	75 10                	jne    ff3 <printf+0xe3>
+      stdout.mode = _IOLBF;
+     fe3:	31 c0                	xor    %eax,%eax
+     fe5:	66 83 bd e8 fd ff ff 	cmpw   $0x3,-0x218(%ebp)
+     fec:	03 
+     fed:	0f 94 c0             	sete   %al
+     ff0:	83 c0 01             	add    $0x1,%eax
+     ff3:	a3 24 20 00 00       	mov    %eax,0x2024
+    flushhook = flushall;
+     ff8:	c7 05 a0 24 00 00 00 	movl   $0xb00,0x24a0
+     fff:	0b 00 00 
+    1002:	eb 85                	jmp    f89 <printf+0x79>
+    1004:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(b->n > 0)
+    1008:	8b 85 f0 fd ff ff    	mov    -0x210(%ebp),%eax
+    100e:	85 c0                	test   %eax,%eax
+    1010:	0f 8e 50 ff ff ff    	jle    f66 <printf+0x56>
+    b = &local;
+    1016:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+    _write(b->fd, b->buf, b->n);
+    101c:	83 ec 04             	sub    $0x4,%esp
+    101f:	50                   	push   %eax
+    1020:	8d 43 0c             	lea    0xc(%ebx),%eax
+    1023:	50                   	push   %eax
+    1024:	ff 33                	push   (%ebx)
+    1026:	e8 85 f9 ff ff       	call   9b0 <_write>
+  b->n = 0;
+    102b:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  if(b == &stdout)
+    1032:	83 c4 10             	add    $0x10,%esp
+    1035:	81 fb 20 20 00 00    	cmp    $0x2020,%ebx
+    103b:	0f 85 25 ff ff ff    	jne    f66 <printf+0x56>
+    1041:	e9 5f ff ff ff       	jmp    fa5 <printf+0x95>
+    1046:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    104d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(b->n > 0)
+    1050:	a1 28 20 00 00       	mov    0x2028,%eax
+    b = getstdout();
+    1055:	bb 20 20 00 00       	mov    $0x2020,%ebx
+  if(b->n > 0)
+    105a:	85 c0                	test   %eax,%eax
+    105c:	7f be                	jg     101c <printf+0x10c>
+  b->n = 0;
+    105e:	c7 05 28 20 00 00 00 	movl   $0x0,0x2028
+    1065:	00 00 00 
+  if(b == &stdout)
+    1068:	e9 38 ff ff ff       	jmp    fa5 <printf+0x95>
+    106d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001070 <sprintf>:
+
+// Print to the given buffer. Only understands %d, %x, %p, %s, %c.
+int
+sprintf(char *str, const char *fmt, ...)
+{
+    1070:	55                   	push   %ebp
+    1071:	89 e5                	mov    %esp,%ebp
+    1073:	53                   	push   %ebx
+  struct outbuf b;
+
+  b.str = str;
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+    1074:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+    107a:	8d 4d 10             	lea    0x10(%ebp),%ecx
+{
+    107d:	81 ec 14 02 00 00    	sub    $0x214,%esp
+    1083:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+    1086:	8b 55 0c             	mov    0xc(%ebp),%edx
+  b.str = str;
+    1089:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+    108c:	e8 2f fc ff ff       	call   cc0 <format>
+  *b.str = '\0';
+    1091:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1094:	c6 00 00             	movb   $0x0,(%eax)
+  return b.str - str;
+    1097:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    109a:	29 d8                	sub    %ebx,%eax
+}
+    109c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    109f:	c9                   	leave
+    10a0:	c3                   	ret
+    10a1:	66 90                	xchg   %ax,%ax
+    10a3:	66 90                	xchg   %ax,%ax
+    10a5:	66 90                	xchg   %ax,%ax
+    10a7:	66 90                	xchg   %ax,%ax
+    10a9:	66 90                	xchg   %ax,%ax
+    10ab:	66 90                	xchg   %ax,%ax
+    10ad:	66 90                	xchg   %ax,%ax
+    10af:	90                   	nop
+
+000010b0 <freeblock>:
+static Header *freep;
+static struct umutex lock;  // threads made by clone() share the heap
+
+static void
+freeblock(void *ap)
+{
+    10b0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+    10b1:	8d 48 f8             	lea    -0x8(%eax),%ecx
+{
+    10b4:	89 e5                	mov    %esp,%ebp
+    10b6:	57                   	push   %edi
+    10b7:	56                   	push   %esi
+    10b8:	53                   	push   %ebx
+    10b9:	89 c3                	mov    %eax,%ebx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    10bb:	a1 ac 24 00 00       	mov    0x24ac,%eax
+    10c0:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    10c2:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    10c4:	39 ca                	cmp    %ecx,%edx
+    10c6:	73 30                	jae    10f8 <freeblock+0x48>
+    10c8:	39 c1                	cmp    %eax,%ecx
+    10ca:	72 04                	jb     10d0 <freeblock+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    10cc:	39 c2                	cmp    %eax,%edx
+    10ce:	72 f0                	jb     10c0 <freeblock+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    10d0:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    10d3:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    10d6:	39 f8                	cmp    %edi,%eax
+    10d8:	74 26                	je     1100 <freeblock+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    10da:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    10dd:	8b 42 04             	mov    0x4(%edx),%eax
+    10e0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    10e3:	39 f1                	cmp    %esi,%ecx
+    10e5:	74 30                	je     1117 <freeblock+0x67>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    10e7:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    10e9:	5b                   	pop    %ebx
+  freep = p;
+    10ea:	89 15 ac 24 00 00    	mov    %edx,0x24ac
+}
+    10f0:	5e                   	pop    %esi
+    10f1:	5f                   	pop    %edi
+    10f2:	5d                   	pop    %ebp
+    10f3:	c3                   	ret
+    10f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    10f8:	39 c1                	cmp    %eax,%ecx
+    10fa:	72 d0                	jb     10cc <freeblock+0x1c>
+    10fc:	eb c2                	jmp    10c0 <freeblock+0x10>
+    10fe:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+    1100:	03 70 04             	add    0x4(%eax),%esi
+    1103:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1106:	8b 02                	mov    (%edx),%eax
+    1108:	8b 00                	mov    (%eax),%eax
+    110a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    110d:	8b 42 04             	mov    0x4(%edx),%eax
+    1110:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    1113:	39 f1                	cmp    %esi,%ecx
+    1115:	75 d0                	jne    10e7 <freeblock+0x37>
+    p->s.size += bp->s.size;
+    1117:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    111a:	89 15 ac 24 00 00    	mov    %edx,0x24ac
+    p->s.size += bp->s.size;
+    1120:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1123:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    1126:	89 0a                	mov    %ecx,(%edx)
+}
+    1128:	5b                   	pop    %ebx
+    1129:	5e                   	pop    %esi
+    112a:	5f                   	pop    %edi
+    112b:	5d                   	pop    %ebp
+    112c:	c3                   	ret
+    112d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001130 <free>:
+
+void
+free(void *ap)
+{
+    1130:	55                   	push   %ebp
+    1131:	89 e5                	mov    %esp,%ebp
+    1133:	53                   	push   %ebx
+    1134:	83 ec 10             	sub    $0x10,%esp
+    1137:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  umtxlock(&lock);
+    113a:	68 a8 24 00 00       	push   $0x24a8
+    113f:	e8 cc f7 ff ff       	call   910 <umtxlock>
+  freeblock(ap);
+    1144:	89 d8                	mov    %ebx,%eax
+    1146:	e8 65 ff ff ff       	call   10b0 <freeblock>
+  umtxunlock(&lock);
+    114b:	c7 45 08 a8 24 00 00 	movl   $0x24a8,0x8(%ebp)
+}
+    1152:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&lock);
+    1155:	83 c4 10             	add    $0x10,%esp
+}
+    1158:	c9                   	leave
+  umtxunlock(&lock);
+    1159:	e9 02 f8 ff ff       	jmp    960 <umtxunlock>
+    115e:	66 90                	xchg   %ax,%ax
+
+00001160 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    1160:	55                   	push   %ebp
+    1161:	89 e5                	mov    %esp,%ebp
+    1163:	57                   	push   %edi
+    1164:	56                   	push   %esi
+    1165:	53                   	push   %ebx
+    1166:	83 ec 28             	sub    $0x28,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1169:	8b 45 08             	mov    0x8(%ebp),%eax
+  umtxlock(&lock);
+    116c:	68 a8 24 00 00       	push   $0x24a8
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1171:	8d 48 07             	lea    0x7(%eax),%ecx
+    1174:	c1 e9 03             	shr    $0x3,%ecx
+    1177:	8d 71 01             	lea    0x1(%ecx),%esi
+  umtxlock(&lock);
+    117a:	e8 91 f7 ff ff       	call   910 <umtxlock>
+  if((prevp = freep) == 0){
+    117f:	8b 15 ac 24 00 00    	mov    0x24ac,%edx
+    1185:	83 c4 10             	add    $0x10,%esp
+    1188:	85 d2                	test   %edx,%edx
+    118a:	0f 84 b0 00 00 00    	je     1240 <malloc+0xe0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1190:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+    1192:	8b 47 04             	mov    0x4(%edi),%eax
+    1195:	39 f0                	cmp    %esi,%eax
+    1197:	73 6f                	jae    1208 <malloc+0xa8>
+  if(nu < 4096)
+    1199:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    119e:	39 de                	cmp    %ebx,%esi
+    11a0:	0f 43 de             	cmovae %esi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    11a3:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+    11aa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    11ad:	eb 0a                	jmp    11b9 <malloc+0x59>
+    11af:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    11b0:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+    11b2:	8b 47 04             	mov    0x4(%edi),%eax
+    11b5:	39 f0                	cmp    %esi,%eax
+    11b7:	73 4f                	jae    1208 <malloc+0xa8>
+      }
+      freep = prevp;
+      umtxunlock(&lock);
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    11b9:	89 fa                	mov    %edi,%edx
+    11bb:	39 3d ac 24 00 00    	cmp    %edi,0x24ac
+    11c1:	75 ed                	jne    11b0 <malloc+0x50>
+  p = sbrk(nu * sizeof(Header));
+    11c3:	83 ec 0c             	sub    $0xc,%esp
+    11c6:	ff 75 e4             	push   -0x1c(%ebp)
+    11c9:	e8 4a f8 ff ff       	call   a18 <sbrk>
+  if(p == (char*)-1)
+    11ce:	83 c4 10             	add    $0x10,%esp
+    11d1:	83 f8 ff             	cmp    $0xffffffff,%eax
+    11d4:	74 15                	je     11eb <malloc+0x8b>
+  hp->s.size = nu;
+    11d6:	89 58 04             	mov    %ebx,0x4(%eax)
+  freeblock((void*)(hp + 1));
+    11d9:	83 c0 08             	add    $0x8,%eax
+    11dc:	e8 cf fe ff ff       	call   10b0 <freeblock>
+  return freep;
+    11e1:	8b 15 ac 24 00 00    	mov    0x24ac,%edx
+      if((p = morecore(nunits)) == 0){
+    11e7:	85 d2                	test   %edx,%edx
+    11e9:	75 c5                	jne    11b0 <malloc+0x50>
+        umtxunlock(&lock);
+    11eb:	83 ec 0c             	sub    $0xc,%esp
+    11ee:	68 a8 24 00 00       	push   $0x24a8
+    11f3:	e8 68 f7 ff ff       	call   960 <umtxunlock>
+        return 0;
+    11f8:	83 c4 10             	add    $0x10,%esp
+      }
+  }
+}
+    11fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    11fe:	31 c0                	xor    %eax,%eax
+}
+    1200:	5b                   	pop    %ebx
+    1201:	5e                   	pop    %esi
+    1202:	5f                   	pop    %edi
+    1203:	5d                   	pop    %ebp
+    1204:	c3                   	ret
+    1205:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1208:	39 c6                	cmp    %eax,%esi
+    120a:	74 64                	je     1270 <malloc+0x110>
+        p->s.size -= nunits;
+    120c:	29 f0                	sub    %esi,%eax
+    120e:	89 47 04             	mov    %eax,0x4(%edi)
+        p += p->s.size;
+    1211:	8d 3c c7             	lea    (%edi,%eax,8),%edi
+        p->s.size = nunits;
+    1214:	89 77 04             	mov    %esi,0x4(%edi)
+      umtxunlock(&lock);
+    1217:	83 ec 0c             	sub    $0xc,%esp
+      freep = prevp;
+    121a:	89 15 ac 24 00 00    	mov    %edx,0x24ac
+      umtxunlock(&lock);
+    1220:	68 a8 24 00 00       	push   $0x24a8
+    1225:	e8 36 f7 ff ff       	call   960 <umtxunlock>
+      return (void*)(p + 1);
+    122a:	83 c4 10             	add    $0x10,%esp
+}
+    122d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    1230:	8d 47 08             	lea    0x8(%edi),%eax
+}
+    1233:	5b                   	pop    %ebx
+    1234:	5e                   	pop    %esi
+    1235:	5f                   	pop    %edi
+    1236:	5d                   	pop    %ebp
+    1237:	c3                   	ret
+    1238:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    123f:	90                   	nop
+    base.s.ptr = freep = prevp = &base;
+    1240:	c7 05 ac 24 00 00 b0 	movl   $0x24b0,0x24ac
+    1247:	24 00 00 
+    base.s.size = 0;
+    124a:	bf b0 24 00 00       	mov    $0x24b0,%edi
+    base.s.ptr = freep = prevp = &base;
+    124f:	c7 05 b0 24 00 00 b0 	movl   $0x24b0,0x24b0
+    1256:	24 00 00 
+    base.s.size = 0;
+    1259:	c7 05 b4 24 00 00 00 	movl   $0x0,0x24b4
+    1260:	00 00 00 
+    if(p->s.size >= nunits){
+    1263:	e9 31 ff ff ff       	jmp    1199 <malloc+0x39>
+    1268:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    126f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1270:	8b 07                	mov    (%edi),%eax
+    1272:	89 02                	mov    %eax,(%edx)
+    1274:	eb a1                	jmp    1217 <malloc+0xb7>
+    1276:	66 90                	xchg   %ax,%ax
+    1278:	66 90                	xchg   %ax,%ax
+    127a:	66 90                	xchg   %ax,%ax
+    127c:	66 90                	xchg   %ax,%ax
+    127e:	66 90                	xchg   %ax,%ax
+
+00001280 <threadstart>:
+
+#define TSTACKSZ 4096
+
+static void
+threadstart(void *fn, void *arg)
+{
+    1280:	55                   	push   %ebp
+    1281:	89 e5                	mov    %esp,%ebp
+    1283:	83 ec 14             	sub    $0x14,%esp
+  ((void (*)(void*))fn)(arg);
+    1286:	ff 75 0c             	push   0xc(%ebp)
+    1289:	ff 55 08             	call   *0x8(%ebp)
+  exit();
+    128c:	e8 ef f4 ff ff       	call   780 <exit>
+    1291:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1298:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    129f:	90                   	nop
+
+000012a0 <thread_create>:
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    12a0:	55                   	push   %ebp
+    12a1:	89 e5                	mov    %esp,%ebp
+    12a3:	53                   	push   %ebx
+    12a4:	83 ec 20             	sub    $0x20,%esp
+  char *mem, *stack;
+  int pid;
+
+  if((mem = malloc(2*TSTACKSZ)) == 0)
+    12a7:	68 00 20 00 00       	push   $0x2000
+    12ac:	e8 af fe ff ff       	call   1160 <malloc>
+    12b1:	83 c4 10             	add    $0x10,%esp
+    12b4:	85 c0                	test   %eax,%eax
+    12b6:	74 47                	je     12ff <thread_create+0x5f>
+    12b8:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)(((uint)mem + TSTACKSZ - 1) & ~(TSTACKSZ - 1));
+    12ba:	8d 80 ff 0f 00 00    	lea    0xfff(%eax),%eax
+    12c0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  *(char**)stack = mem;
+    12c5:	89 18                	mov    %ebx,(%eax)
+  if((pid = clone(threadstart, (void*)fn, arg, stack)) < 0)
+    12c7:	50                   	push   %eax
+    12c8:	ff 75 0c             	push   0xc(%ebp)
+    12cb:	ff 75 08             	push   0x8(%ebp)
+    12ce:	68 80 12 00 00       	push   $0x1280
+    12d3:	e8 08 f8 ff ff       	call   ae0 <clone>
+    12d8:	83 c4 10             	add    $0x10,%esp
+    12db:	85 c0                	test   %eax,%eax
+    12dd:	78 09                	js     12e8 <thread_create+0x48>
+    free(mem);
+  return pid;
+}
+    12df:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    12e2:	c9                   	leave
+    12e3:	c3                   	ret
+    12e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    free(mem);
+    12e8:	83 ec 0c             	sub    $0xc,%esp
+    12eb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    12ee:	53                   	push   %ebx
+    12ef:	e8 3c fe ff ff       	call   1130 <free>
+    12f4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    12f7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+    12fa:	83 c4 10             	add    $0x10,%esp
+}
+    12fd:	c9                   	leave
+    12fe:	c3                   	ret
+    return -1;
+    12ff:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1304:	eb d9                	jmp    12df <thread_create+0x3f>
+    1306:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    130d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001310 <thread_join>:
+
+int
+thread_join(void)
+{
+    1310:	55                   	push   %ebp
+    1311:	89 e5                	mov    %esp,%ebp
+    1313:	83 ec 34             	sub    $0x34,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    1316:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    1319:	50                   	push   %eax
+    131a:	e8 c9 f7 ff ff       	call   ae8 <join>
+    131f:	83 c4 10             	add    $0x10,%esp
+    1322:	85 c0                	test   %eax,%eax
+    1324:	79 0a                	jns    1330 <thread_join+0x20>
+    free(*(char**)stack);
+  return pid;
+}
+    1326:	c9                   	leave
+    1327:	c3                   	ret
+    1328:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    132f:	90                   	nop
+    free(*(char**)stack);
+    1330:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1333:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1336:	83 ec 0c             	sub    $0xc,%esp
+    1339:	ff 32                	push   (%edx)
+    133b:	e8 f0 fd ff ff       	call   1130 <free>
+    1340:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1343:	83 c4 10             	add    $0x10,%esp
+}
+    1346:	c9                   	leave
+    1347:	c3                   	ret
@@ -0,0 +1,130 @@
+// Age the file system with a create/delete workload, then
+// measure how well the blocks of newly written files are laid
+// out: read them back and count disk reads and seeks.
+//
+// The probe files are written a block at a time in round-robin
+// order, which scatters their blocks unless the allocator
+// places each file's blocks after one another.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fs.h"
+#include "fcntl.h"
+#include "iostat.h"
+
+#define NROUND   6   // aging rounds
+#define NAGE    16   // files created per round
+#define NPROBE   8   // probe files
+#define PROBESZ 24   // blocks per probe file
+
+char buf[BSIZE];
+char live[NROUND*NAGE];
+uint seed = 1;
+
+uint
+rnd(void)
+{
+  seed = seed * 1103515245 + 12345;
+  return (seed >> 16) & 0x7fff;
+}
+
+void
+name(char *s, char c, int n)
+{
+  s[0] = c;
+  s[1] = '0' + n / 10;
+  s[2] = '0' + n % 10;
+  s[3] = 0;
+}
+
+void
+age(void)
+{
+  int r, i, j, n, fd;
+  char path[4];
+
+  for(r = 0; r < NROUND; r++){
+    for(i = r*NAGE; i < (r+1)*NAGE; i++){
+      name(path, 'a', i);
+      if((fd = open(path, O_CREATE|O_RDWR)) < 0){
+        printf(1, "fsaging: create %s failed\n", path);
+        exit();
+      }
+      n = 1 + rnd() % 8;
+      for(j = 0; j < n; j++)
+        write(fd, buf, sizeof(buf));
+      close(fd);
+      live[i] = 1;
+    }
+    for(i = 0; i < (r+1)*NAGE; i++){
+      if(live[i] && rnd() % 2){
+        name(path, 'a', i);
+        unlink(path);
+        live[i] = 0;
+      }
+    }
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+  int i, j, fd[NPROBE];
+  char path[4];
+  struct iostat st0, st1;
+  uint nread, nseek;
+
+  mkdir("agedir");
+  if(chdir("agedir") < 0){
+    printf(1, "fsaging: chdir failed\n");
+    exit();
+  }
+  memset(buf, 'x', sizeof(buf));
+
+  printf(1, "fsaging: aging with %d rounds of %d files\n", NROUND, NAGE);
+  age();
+
+  for(i = 0; i < NPROBE; i++){
+    name(path, 'p', i);
+    fd[i] = open(path, O_CREATE|O_RDWR);
+  }
+  for(j = 0; j < PROBESZ; j++)
+    for(i = 0; i < NPROBE; i++)
+      write(fd[i], buf, sizeof(buf));
+  for(i = 0; i < NPROBE; i++)
+    close(fd[i]);
+
+  iostat(&st0);
+  for(i = 0; i < NPROBE; i++){
+    name(path, 'p', i);
+    fd[0] = open(path, O_RDONLY);
+    while(read(fd[0], buf, sizeof(buf)) > 0)
+      ;
+    close(fd[0]);
+  }
+  iostat(&st1);
+
+  nread = st1.nread - st0.nread;
+  nseek = st1.nseek - st0.nseek;
+  printf(1, "fsaging: read %d probe blocks: %d disk reads, %d seeks, "
+         "%d blocks seek distance\n", NPROBE*PROBESZ, nread, nseek,
+         st1.seekdist - st0.seekdist);
+  if(nseek > 0)
+    printf(1, "fsaging: %d.%d blocks read per seek\n",
+           nread / nseek, nread * 10 / nseek % 10);
+
+  for(i = 0; i < NPROBE; i++){
+    name(path, 'p', i);
+    unlink(path);
+  }
+  for(i = 0; i < NROUND*NAGE; i++){
+    if(live[i]){
+      name(path, 'a', i);
+      unlink(path);
+    }
+  }
+  chdir("..");
+  unlink("agedir");
+  exit();
+}
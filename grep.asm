@@ -0,0 +1,2592 @@
+
+_grep:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <matchhere>:
+  return 0;
+}
+
+// matchhere: search for re at beginning of text
+int matchhere(char *re, char *text)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	57                   	push   %edi
+       4:	56                   	push   %esi
+       5:	53                   	push   %ebx
+       6:	83 ec 0c             	sub    $0xc,%esp
+       9:	8b 7d 08             	mov    0x8(%ebp),%edi
+       c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(re[0] == '\0')
+       f:	0f b6 0f             	movzbl (%edi),%ecx
+      12:	84 c9                	test   %cl,%cl
+      14:	0f 84 96 00 00 00    	je     b0 <matchhere+0xb0>
+    return 1;
+  if(re[1] == '*')
+      1a:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+      1e:	3c 2a                	cmp    $0x2a,%al
+      20:	74 2d                	je     4f <matchhere+0x4f>
+      22:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return matchstar(re[0], re+2, text);
+  if(re[0] == '$' && re[1] == '\0')
+    return *text == '\0';
+      28:	0f b6 33             	movzbl (%ebx),%esi
+  if(re[0] == '$' && re[1] == '\0')
+      2b:	80 f9 24             	cmp    $0x24,%cl
+      2e:	74 50                	je     80 <matchhere+0x80>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+      30:	89 f2                	mov    %esi,%edx
+      32:	84 d2                	test   %dl,%dl
+      34:	74 6e                	je     a4 <matchhere+0xa4>
+      36:	80 f9 2e             	cmp    $0x2e,%cl
+      39:	75 65                	jne    a0 <matchhere+0xa0>
+    return matchhere(re+1, text+1);
+      3b:	83 c3 01             	add    $0x1,%ebx
+      3e:	83 c7 01             	add    $0x1,%edi
+  if(re[0] == '\0')
+      41:	84 c0                	test   %al,%al
+      43:	74 6b                	je     b0 <matchhere+0xb0>
+      45:	89 c1                	mov    %eax,%ecx
+  if(re[1] == '*')
+      47:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+      4b:	3c 2a                	cmp    $0x2a,%al
+      4d:	75 d9                	jne    28 <matchhere+0x28>
+    return matchstar(re[0], re+2, text);
+      4f:	8d 77 02             	lea    0x2(%edi),%esi
+      52:	0f be f9             	movsbl %cl,%edi
+  return 0;
+}
+
+// matchstar: search for c*re at beginning of text
+int matchstar(int c, char *re, char *text)
+      55:	8d 76 00             	lea    0x0(%esi),%esi
+{
+  do{  // a * matches zero or more instances
+    if(matchhere(re, text))
+      58:	83 ec 08             	sub    $0x8,%esp
+      5b:	53                   	push   %ebx
+      5c:	56                   	push   %esi
+      5d:	e8 9e ff ff ff       	call   0 <matchhere>
+      62:	83 c4 10             	add    $0x10,%esp
+      65:	85 c0                	test   %eax,%eax
+      67:	75 47                	jne    b0 <matchhere+0xb0>
+      return 1;
+  }while(*text!='\0' && (*text++==c || c=='.'));
+      69:	0f be 13             	movsbl (%ebx),%edx
+      6c:	84 d2                	test   %dl,%dl
+      6e:	74 45                	je     b5 <matchhere+0xb5>
+      70:	83 c3 01             	add    $0x1,%ebx
+      73:	39 fa                	cmp    %edi,%edx
+      75:	74 e1                	je     58 <matchhere+0x58>
+      77:	83 ff 2e             	cmp    $0x2e,%edi
+      7a:	74 dc                	je     58 <matchhere+0x58>
+      7c:	eb 37                	jmp    b5 <matchhere+0xb5>
+      7e:	66 90                	xchg   %ax,%ax
+  if(re[0] == '$' && re[1] == '\0')
+      80:	84 c0                	test   %al,%al
+      82:	74 39                	je     bd <matchhere+0xbd>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+      84:	89 f2                	mov    %esi,%edx
+      86:	84 d2                	test   %dl,%dl
+      88:	74 1a                	je     a4 <matchhere+0xa4>
+      8a:	80 fa 24             	cmp    $0x24,%dl
+      8d:	75 15                	jne    a4 <matchhere+0xa4>
+    return matchhere(re+1, text+1);
+      8f:	83 c3 01             	add    $0x1,%ebx
+      92:	83 c7 01             	add    $0x1,%edi
+  if(re[0] == '\0')
+      95:	89 c1                	mov    %eax,%ecx
+      97:	eb ae                	jmp    47 <matchhere+0x47>
+      99:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+      a0:	38 ca                	cmp    %cl,%dl
+      a2:	74 97                	je     3b <matchhere+0x3b>
+}
+      a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+      a7:	31 c0                	xor    %eax,%eax
+}
+      a9:	5b                   	pop    %ebx
+      aa:	5e                   	pop    %esi
+      ab:	5f                   	pop    %edi
+      ac:	5d                   	pop    %ebp
+      ad:	c3                   	ret
+      ae:	66 90                	xchg   %ax,%ax
+    return 1;
+      b0:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+      b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      b8:	5b                   	pop    %ebx
+      b9:	5e                   	pop    %esi
+      ba:	5f                   	pop    %edi
+      bb:	5d                   	pop    %ebp
+      bc:	c3                   	ret
+    return *text == '\0';
+      bd:	89 f0                	mov    %esi,%eax
+      bf:	84 c0                	test   %al,%al
+      c1:	0f 94 c0             	sete   %al
+      c4:	0f b6 c0             	movzbl %al,%eax
+      c7:	eb ec                	jmp    b5 <matchhere+0xb5>
+      c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000000d0 <match>:
+{
+      d0:	55                   	push   %ebp
+      d1:	89 e5                	mov    %esp,%ebp
+      d3:	56                   	push   %esi
+      d4:	53                   	push   %ebx
+      d5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+      d8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(re[0] == '^')
+      db:	80 3b 5e             	cmpb   $0x5e,(%ebx)
+      de:	75 11                	jne    f1 <match+0x21>
+      e0:	eb 2e                	jmp    110 <match+0x40>
+      e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  }while(*text++ != '\0');
+      e8:	83 c6 01             	add    $0x1,%esi
+      eb:	80 7e ff 00          	cmpb   $0x0,-0x1(%esi)
+      ef:	74 16                	je     107 <match+0x37>
+    if(matchhere(re, text))
+      f1:	83 ec 08             	sub    $0x8,%esp
+      f4:	56                   	push   %esi
+      f5:	53                   	push   %ebx
+      f6:	e8 05 ff ff ff       	call   0 <matchhere>
+      fb:	83 c4 10             	add    $0x10,%esp
+      fe:	85 c0                	test   %eax,%eax
+     100:	74 e6                	je     e8 <match+0x18>
+      return 1;
+     102:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+     107:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     10a:	5b                   	pop    %ebx
+     10b:	5e                   	pop    %esi
+     10c:	5d                   	pop    %ebp
+     10d:	c3                   	ret
+     10e:	66 90                	xchg   %ax,%ax
+    return matchhere(re+1, text);
+     110:	83 c3 01             	add    $0x1,%ebx
+     113:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     116:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     119:	5b                   	pop    %ebx
+     11a:	5e                   	pop    %esi
+     11b:	5d                   	pop    %ebp
+    return matchhere(re+1, text);
+     11c:	e9 df fe ff ff       	jmp    0 <matchhere>
+     121:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     128:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     12f:	90                   	nop
+
+00000130 <grep>:
+{
+     130:	55                   	push   %ebp
+     131:	89 e5                	mov    %esp,%ebp
+     133:	57                   	push   %edi
+  m = 0;
+     134:	31 ff                	xor    %edi,%edi
+{
+     136:	56                   	push   %esi
+     137:	53                   	push   %ebx
+     138:	83 ec 1c             	sub    $0x1c,%esp
+     13b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     13e:	89 7d e0             	mov    %edi,-0x20(%ebp)
+    return matchhere(re+1, text);
+     141:	8d 43 01             	lea    0x1(%ebx),%eax
+     144:	89 45 dc             	mov    %eax,-0x24(%ebp)
+     147:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     14e:	66 90                	xchg   %ax,%ax
+  while((n = read(fd, buf+m, sizeof(buf)-m-1)) > 0){
+     150:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     153:	b8 ff 03 00 00       	mov    $0x3ff,%eax
+     158:	83 ec 04             	sub    $0x4,%esp
+     15b:	29 c8                	sub    %ecx,%eax
+     15d:	50                   	push   %eax
+     15e:	8d 81 20 22 00 00    	lea    0x2220(%ecx),%eax
+     164:	50                   	push   %eax
+     165:	ff 75 0c             	push   0xc(%ebp)
+     168:	e8 53 05 00 00       	call   6c0 <read>
+     16d:	83 c4 10             	add    $0x10,%esp
+     170:	85 c0                	test   %eax,%eax
+     172:	0f 8e fd 00 00 00    	jle    275 <grep+0x145>
+    m += n;
+     178:	01 45 e0             	add    %eax,-0x20(%ebp)
+     17b:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    buf[m] = '\0';
+     17e:	bf 20 22 00 00       	mov    $0x2220,%edi
+     183:	89 de                	mov    %ebx,%esi
+     185:	c6 81 20 22 00 00 00 	movb   $0x0,0x2220(%ecx)
+    while((q = strchr(p, '\n')) != 0){
+     18c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     190:	83 ec 08             	sub    $0x8,%esp
+     193:	6a 0a                	push   $0xa
+     195:	57                   	push   %edi
+     196:	e8 35 03 00 00       	call   4d0 <strchr>
+     19b:	83 c4 10             	add    $0x10,%esp
+     19e:	89 c2                	mov    %eax,%edx
+     1a0:	85 c0                	test   %eax,%eax
+     1a2:	0f 84 88 00 00 00    	je     230 <grep+0x100>
+      *q = 0;
+     1a8:	c6 02 00             	movb   $0x0,(%edx)
+  if(re[0] == '^')
+     1ab:	80 3e 5e             	cmpb   $0x5e,(%esi)
+     1ae:	74 58                	je     208 <grep+0xd8>
+     1b0:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+     1b3:	89 d3                	mov    %edx,%ebx
+     1b5:	eb 12                	jmp    1c9 <grep+0x99>
+     1b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1be:	66 90                	xchg   %ax,%ax
+  }while(*text++ != '\0');
+     1c0:	83 c7 01             	add    $0x1,%edi
+     1c3:	80 7f ff 00          	cmpb   $0x0,-0x1(%edi)
+     1c7:	74 37                	je     200 <grep+0xd0>
+    if(matchhere(re, text))
+     1c9:	83 ec 08             	sub    $0x8,%esp
+     1cc:	57                   	push   %edi
+     1cd:	56                   	push   %esi
+     1ce:	e8 2d fe ff ff       	call   0 <matchhere>
+     1d3:	83 c4 10             	add    $0x10,%esp
+     1d6:	85 c0                	test   %eax,%eax
+     1d8:	74 e6                	je     1c0 <grep+0x90>
+        write(1, p, q+1 - p);
+     1da:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     1dd:	89 da                	mov    %ebx,%edx
+     1df:	8d 5b 01             	lea    0x1(%ebx),%ebx
+     1e2:	89 d8                	mov    %ebx,%eax
+     1e4:	83 ec 04             	sub    $0x4,%esp
+        *q = '\n';
+     1e7:	c6 02 0a             	movb   $0xa,(%edx)
+        write(1, p, q+1 - p);
+     1ea:	29 f8                	sub    %edi,%eax
+     1ec:	50                   	push   %eax
+     1ed:	57                   	push   %edi
+     1ee:	89 df                	mov    %ebx,%edi
+     1f0:	6a 01                	push   $0x1
+     1f2:	e8 49 05 00 00       	call   740 <write>
+     1f7:	83 c4 10             	add    $0x10,%esp
+     1fa:	eb 94                	jmp    190 <grep+0x60>
+     1fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     200:	8d 7b 01             	lea    0x1(%ebx),%edi
+      p = q+1;
+     203:	eb 8b                	jmp    190 <grep+0x60>
+     205:	8d 76 00             	lea    0x0(%esi),%esi
+    return matchhere(re+1, text);
+     208:	83 ec 08             	sub    $0x8,%esp
+     20b:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+     20e:	57                   	push   %edi
+     20f:	ff 75 dc             	push   -0x24(%ebp)
+     212:	e8 e9 fd ff ff       	call   0 <matchhere>
+        write(1, p, q+1 - p);
+     217:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    return matchhere(re+1, text);
+     21a:	83 c4 10             	add    $0x10,%esp
+        write(1, p, q+1 - p);
+     21d:	8d 5a 01             	lea    0x1(%edx),%ebx
+      if(match(pattern, p)){
+     220:	85 c0                	test   %eax,%eax
+     222:	75 be                	jne    1e2 <grep+0xb2>
+        write(1, p, q+1 - p);
+     224:	89 df                	mov    %ebx,%edi
+     226:	e9 65 ff ff ff       	jmp    190 <grep+0x60>
+     22b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     22f:	90                   	nop
+    if(p == buf)
+     230:	89 f3                	mov    %esi,%ebx
+     232:	81 ff 20 22 00 00    	cmp    $0x2220,%edi
+     238:	74 2f                	je     269 <grep+0x139>
+    if(m > 0){
+     23a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     23d:	85 c0                	test   %eax,%eax
+     23f:	0f 8e 0b ff ff ff    	jle    150 <grep+0x20>
+      m -= p - buf;
+     245:	89 f8                	mov    %edi,%eax
+      memmove(buf, p, m);
+     247:	83 ec 04             	sub    $0x4,%esp
+      m -= p - buf;
+     24a:	2d 20 22 00 00       	sub    $0x2220,%eax
+     24f:	29 45 e0             	sub    %eax,-0x20(%ebp)
+     252:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+      memmove(buf, p, m);
+     255:	51                   	push   %ecx
+     256:	57                   	push   %edi
+     257:	68 20 22 00 00       	push   $0x2220
+     25c:	e8 af 03 00 00       	call   610 <memmove>
+     261:	83 c4 10             	add    $0x10,%esp
+     264:	e9 e7 fe ff ff       	jmp    150 <grep+0x20>
+      m = 0;
+     269:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+     270:	e9 db fe ff ff       	jmp    150 <grep+0x20>
+}
+     275:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     278:	5b                   	pop    %ebx
+     279:	5e                   	pop    %esi
+     27a:	5f                   	pop    %edi
+     27b:	5d                   	pop    %ebp
+     27c:	c3                   	ret
+     27d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000280 <matchstar>:
+{
+     280:	55                   	push   %ebp
+     281:	89 e5                	mov    %esp,%ebp
+     283:	57                   	push   %edi
+     284:	56                   	push   %esi
+     285:	53                   	push   %ebx
+     286:	83 ec 0c             	sub    $0xc,%esp
+     289:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     28c:	8b 75 0c             	mov    0xc(%ebp),%esi
+     28f:	8b 7d 10             	mov    0x10(%ebp),%edi
+     292:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(matchhere(re, text))
+     298:	83 ec 08             	sub    $0x8,%esp
+     29b:	57                   	push   %edi
+     29c:	56                   	push   %esi
+     29d:	e8 5e fd ff ff       	call   0 <matchhere>
+     2a2:	83 c4 10             	add    $0x10,%esp
+     2a5:	85 c0                	test   %eax,%eax
+     2a7:	75 1f                	jne    2c8 <matchstar+0x48>
+  }while(*text!='\0' && (*text++==c || c=='.'));
+     2a9:	0f be 17             	movsbl (%edi),%edx
+     2ac:	84 d2                	test   %dl,%dl
+     2ae:	74 0c                	je     2bc <matchstar+0x3c>
+     2b0:	83 c7 01             	add    $0x1,%edi
+     2b3:	39 da                	cmp    %ebx,%edx
+     2b5:	74 e1                	je     298 <matchstar+0x18>
+     2b7:	83 fb 2e             	cmp    $0x2e,%ebx
+     2ba:	74 dc                	je     298 <matchstar+0x18>
+}
+     2bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     2bf:	5b                   	pop    %ebx
+     2c0:	5e                   	pop    %esi
+     2c1:	5f                   	pop    %edi
+     2c2:	5d                   	pop    %ebp
+     2c3:	c3                   	ret
+     2c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return 1;
+     2cb:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+     2d0:	5b                   	pop    %ebx
+     2d1:	5e                   	pop    %esi
+     2d2:	5f                   	pop    %edi
+     2d3:	5d                   	pop    %ebp
+     2d4:	c3                   	ret
+     2d5:	66 90                	xchg   %ax,%ax
+     2d7:	66 90                	xchg   %ax,%ax
+     2d9:	66 90                	xchg   %ax,%ax
+     2db:	66 90                	xchg   %ax,%ax
+     2dd:	66 90                	xchg   %ax,%ax
+     2df:	90                   	nop
+
+000002e0 <main>:
+{
+     2e0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     2e4:	83 e4 f0             	and    $0xfffffff0,%esp
+     2e7:	ff 71 fc             	push   -0x4(%ecx)
+     2ea:	55                   	push   %ebp
+     2eb:	89 e5                	mov    %esp,%ebp
+     2ed:	57                   	push   %edi
+     2ee:	56                   	push   %esi
+     2ef:	53                   	push   %ebx
+     2f0:	51                   	push   %ecx
+     2f1:	83 ec 18             	sub    $0x18,%esp
+     2f4:	8b 01                	mov    (%ecx),%eax
+     2f6:	8b 59 04             	mov    0x4(%ecx),%ebx
+     2f9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(argc <= 1){
+     2fc:	83 f8 01             	cmp    $0x1,%eax
+     2ff:	7e 6f                	jle    370 <main+0x90>
+  pattern = argv[1];
+     301:	8b 43 04             	mov    0x4(%ebx),%eax
+     304:	83 c3 08             	add    $0x8,%ebx
+  if(argc <= 2){
+     307:	83 7d e4 02          	cmpl   $0x2,-0x1c(%ebp)
+  for(i = 2; i < argc; i++){
+     30b:	be 02 00 00 00       	mov    $0x2,%esi
+  pattern = argv[1];
+     310:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if(argc <= 2){
+     313:	75 2d                	jne    342 <main+0x62>
+     315:	eb 6c                	jmp    383 <main+0xa3>
+     317:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     31e:	66 90                	xchg   %ax,%ax
+    grep(pattern, fd);
+     320:	83 ec 08             	sub    $0x8,%esp
+  for(i = 2; i < argc; i++){
+     323:	83 c6 01             	add    $0x1,%esi
+     326:	83 c3 04             	add    $0x4,%ebx
+    grep(pattern, fd);
+     329:	50                   	push   %eax
+     32a:	ff 75 e0             	push   -0x20(%ebp)
+     32d:	e8 fe fd ff ff       	call   130 <grep>
+    close(fd);
+     332:	89 3c 24             	mov    %edi,(%esp)
+     335:	e8 86 04 00 00       	call   7c0 <close>
+  for(i = 2; i < argc; i++){
+     33a:	83 c4 10             	add    $0x10,%esp
+     33d:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+     340:	7e 29                	jle    36b <main+0x8b>
+    if((fd = open(argv[i], 0)) < 0){
+     342:	83 ec 08             	sub    $0x8,%esp
+     345:	6a 00                	push   $0x0
+     347:	ff 33                	push   (%ebx)
+     349:	e8 72 05 00 00       	call   8c0 <open>
+     34e:	83 c4 10             	add    $0x10,%esp
+     351:	89 c7                	mov    %eax,%edi
+     353:	85 c0                	test   %eax,%eax
+     355:	79 c9                	jns    320 <main+0x40>
+      printf(1, "grep: cannot open %s\n", argv[i]);
+     357:	50                   	push   %eax
+     358:	ff 33                	push   (%ebx)
+     35a:	68 58 12 00 00       	push   $0x1258
+     35f:	6a 01                	push   $0x1
+     361:	e8 9a 0a 00 00       	call   e00 <printf>
+      exit();
+     366:	e8 05 03 00 00       	call   670 <exit>
+  exit();
+     36b:	e8 00 03 00 00       	call   670 <exit>
+    printf(2, "usage: grep pattern [file ...]\n");
+     370:	51                   	push   %ecx
+     371:	51                   	push   %ecx
+     372:	68 38 12 00 00       	push   $0x1238
+     377:	6a 02                	push   $0x2
+     379:	e8 82 0a 00 00       	call   e00 <printf>
+    exit();
+     37e:	e8 ed 02 00 00       	call   670 <exit>
+    grep(pattern, 0);
+     383:	52                   	push   %edx
+     384:	52                   	push   %edx
+     385:	6a 00                	push   $0x0
+     387:	50                   	push   %eax
+     388:	e8 a3 fd ff ff       	call   130 <grep>
+    exit();
+     38d:	e8 de 02 00 00       	call   670 <exit>
+     392:	66 90                	xchg   %ax,%ax
+     394:	66 90                	xchg   %ax,%ax
+     396:	66 90                	xchg   %ax,%ax
+     398:	66 90                	xchg   %ax,%ax
+     39a:	66 90                	xchg   %ax,%ax
+     39c:	66 90                	xchg   %ax,%ax
+     39e:	66 90                	xchg   %ax,%ax
+
+000003a0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     3a0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     3a1:	31 c0                	xor    %eax,%eax
+{
+     3a3:	89 e5                	mov    %esp,%ebp
+     3a5:	53                   	push   %ebx
+     3a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     3a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     3ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     3b0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     3b4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     3b7:	83 c0 01             	add    $0x1,%eax
+     3ba:	84 d2                	test   %dl,%dl
+     3bc:	75 f2                	jne    3b0 <strcpy+0x10>
+    ;
+  return os;
+}
+     3be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     3c1:	89 c8                	mov    %ecx,%eax
+     3c3:	c9                   	leave
+     3c4:	c3                   	ret
+     3c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003d0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     3d0:	55                   	push   %ebp
+     3d1:	89 e5                	mov    %esp,%ebp
+     3d3:	53                   	push   %ebx
+     3d4:	8b 55 08             	mov    0x8(%ebp),%edx
+     3d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     3da:	0f b6 02             	movzbl (%edx),%eax
+     3dd:	84 c0                	test   %al,%al
+     3df:	75 17                	jne    3f8 <strcmp+0x28>
+     3e1:	eb 3a                	jmp    41d <strcmp+0x4d>
+     3e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     3e7:	90                   	nop
+     3e8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     3ec:	83 c2 01             	add    $0x1,%edx
+     3ef:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     3f2:	84 c0                	test   %al,%al
+     3f4:	74 1a                	je     410 <strcmp+0x40>
+    p++, q++;
+     3f6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     3f8:	0f b6 19             	movzbl (%ecx),%ebx
+     3fb:	38 c3                	cmp    %al,%bl
+     3fd:	74 e9                	je     3e8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     3ff:	29 d8                	sub    %ebx,%eax
+}
+     401:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     404:	c9                   	leave
+     405:	c3                   	ret
+     406:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     40d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     410:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     414:	31 c0                	xor    %eax,%eax
+     416:	29 d8                	sub    %ebx,%eax
+}
+     418:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     41b:	c9                   	leave
+     41c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     41d:	0f b6 19             	movzbl (%ecx),%ebx
+     420:	31 c0                	xor    %eax,%eax
+     422:	eb db                	jmp    3ff <strcmp+0x2f>
+     424:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     42b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     42f:	90                   	nop
+
+00000430 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     430:	55                   	push   %ebp
+     431:	89 e5                	mov    %esp,%ebp
+     433:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     436:	80 3a 00             	cmpb   $0x0,(%edx)
+     439:	74 15                	je     450 <strlen+0x20>
+     43b:	31 c0                	xor    %eax,%eax
+     43d:	8d 76 00             	lea    0x0(%esi),%esi
+     440:	83 c0 01             	add    $0x1,%eax
+     443:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     447:	89 c1                	mov    %eax,%ecx
+     449:	75 f5                	jne    440 <strlen+0x10>
+    ;
+  return n;
+}
+     44b:	89 c8                	mov    %ecx,%eax
+     44d:	5d                   	pop    %ebp
+     44e:	c3                   	ret
+     44f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     450:	31 c9                	xor    %ecx,%ecx
+}
+     452:	5d                   	pop    %ebp
+     453:	89 c8                	mov    %ecx,%eax
+     455:	c3                   	ret
+     456:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     45d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000460 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     460:	55                   	push   %ebp
+     461:	89 e5                	mov    %esp,%ebp
+     463:	57                   	push   %edi
+     464:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     467:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     46a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     46d:	89 d7                	mov    %edx,%edi
+     46f:	fc                   	cld
+     470:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     472:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     475:	89 d0                	mov    %edx,%eax
+     477:	c9                   	leave
+     478:	c3                   	ret
+     479:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000480 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     480:	55                   	push   %ebp
+     481:	89 e5                	mov    %esp,%ebp
+     483:	56                   	push   %esi
+     484:	53                   	push   %ebx
+     485:	8b 75 10             	mov    0x10(%ebp),%esi
+     488:	8b 55 08             	mov    0x8(%ebp),%edx
+     48b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+     48e:	85 f6                	test   %esi,%esi
+     490:	74 2e                	je     4c0 <memcmp+0x40>
+     492:	01 c6                	add    %eax,%esi
+     494:	eb 14                	jmp    4aa <memcmp+0x2a>
+     496:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     49d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+     4a0:	83 c0 01             	add    $0x1,%eax
+     4a3:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+     4a6:	39 f0                	cmp    %esi,%eax
+     4a8:	74 16                	je     4c0 <memcmp+0x40>
+    if(*s1 != *s2)
+     4aa:	0f b6 0a             	movzbl (%edx),%ecx
+     4ad:	0f b6 18             	movzbl (%eax),%ebx
+     4b0:	38 d9                	cmp    %bl,%cl
+     4b2:	74 ec                	je     4a0 <memcmp+0x20>
+      return *s1 - *s2;
+     4b4:	0f b6 c1             	movzbl %cl,%eax
+     4b7:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+     4b9:	5b                   	pop    %ebx
+     4ba:	5e                   	pop    %esi
+     4bb:	5d                   	pop    %ebp
+     4bc:	c3                   	ret
+     4bd:	8d 76 00             	lea    0x0(%esi),%esi
+     4c0:	5b                   	pop    %ebx
+  return 0;
+     4c1:	31 c0                	xor    %eax,%eax
+}
+     4c3:	5e                   	pop    %esi
+     4c4:	5d                   	pop    %ebp
+     4c5:	c3                   	ret
+     4c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000004d0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     4d0:	55                   	push   %ebp
+     4d1:	89 e5                	mov    %esp,%ebp
+     4d3:	8b 45 08             	mov    0x8(%ebp),%eax
+     4d6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     4da:	0f b6 10             	movzbl (%eax),%edx
+     4dd:	84 d2                	test   %dl,%dl
+     4df:	75 12                	jne    4f3 <strchr+0x23>
+     4e1:	eb 1d                	jmp    500 <strchr+0x30>
+     4e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     4e7:	90                   	nop
+     4e8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     4ec:	83 c0 01             	add    $0x1,%eax
+     4ef:	84 d2                	test   %dl,%dl
+     4f1:	74 0d                	je     500 <strchr+0x30>
+    if(*s == c)
+     4f3:	38 d1                	cmp    %dl,%cl
+     4f5:	75 f1                	jne    4e8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     4f7:	5d                   	pop    %ebp
+     4f8:	c3                   	ret
+     4f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     500:	31 c0                	xor    %eax,%eax
+}
+     502:	5d                   	pop    %ebp
+     503:	c3                   	ret
+     504:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     50b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     50f:	90                   	nop
+
+00000510 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     510:	55                   	push   %ebp
+     511:	89 e5                	mov    %esp,%ebp
+     513:	57                   	push   %edi
+     514:	56                   	push   %esi
+int
+read(int fd, void *buf, int n)
+{
+  if(flushhook)
+    flushhook();
+  return _read(fd, buf, n);
+     515:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     518:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     519:	31 db                	xor    %ebx,%ebx
+{
+     51b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     51e:	eb 32                	jmp    552 <gets+0x42>
+  if(flushhook)
+     520:	a1 20 26 00 00       	mov    0x2620,%eax
+     525:	85 c0                	test   %eax,%eax
+     527:	74 02                	je     52b <gets+0x1b>
+    flushhook();
+     529:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+     52b:	83 ec 04             	sub    $0x4,%esp
+     52e:	6a 01                	push   $0x1
+     530:	56                   	push   %esi
+     531:	6a 00                	push   $0x0
+     533:	e8 60 03 00 00       	call   898 <_read>
+    if(cc < 1)
+     538:	83 c4 10             	add    $0x10,%esp
+     53b:	85 c0                	test   %eax,%eax
+     53d:	7e 1d                	jle    55c <gets+0x4c>
+    buf[i++] = c;
+     53f:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     543:	8b 55 08             	mov    0x8(%ebp),%edx
+     546:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     54a:	3c 0a                	cmp    $0xa,%al
+     54c:	74 10                	je     55e <gets+0x4e>
+     54e:	3c 0d                	cmp    $0xd,%al
+     550:	74 0c                	je     55e <gets+0x4e>
+  for(i=0; i+1 < max; ){
+     552:	89 df                	mov    %ebx,%edi
+     554:	83 c3 01             	add    $0x1,%ebx
+     557:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     55a:	7c c4                	jl     520 <gets+0x10>
+     55c:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+     55e:	8b 45 08             	mov    0x8(%ebp),%eax
+     561:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+     565:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     568:	5b                   	pop    %ebx
+     569:	5e                   	pop    %esi
+     56a:	5f                   	pop    %edi
+     56b:	5d                   	pop    %ebp
+     56c:	c3                   	ret
+     56d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000570 <stat>:
+{
+     570:	55                   	push   %ebp
+     571:	89 e5                	mov    %esp,%ebp
+     573:	56                   	push   %esi
+     574:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+     575:	83 ec 08             	sub    $0x8,%esp
+     578:	6a 00                	push   $0x0
+     57a:	ff 75 08             	push   0x8(%ebp)
+     57d:	e8 3e 03 00 00       	call   8c0 <open>
+  if(fd < 0)
+     582:	83 c4 10             	add    $0x10,%esp
+     585:	85 c0                	test   %eax,%eax
+     587:	78 37                	js     5c0 <stat+0x50>
+  r = fstat(fd, st);
+     589:	83 ec 08             	sub    $0x8,%esp
+     58c:	ff 75 0c             	push   0xc(%ebp)
+     58f:	89 c3                	mov    %eax,%ebx
+     591:	50                   	push   %eax
+     592:	e8 41 03 00 00       	call   8d8 <fstat>
+}
+
+int
+close(int fd)
+{
+  if(flushhook)
+     597:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+     59a:	89 c6                	mov    %eax,%esi
+  if(flushhook)
+     59c:	a1 20 26 00 00       	mov    0x2620,%eax
+     5a1:	85 c0                	test   %eax,%eax
+     5a3:	74 02                	je     5a7 <stat+0x37>
+    flushhook();
+     5a5:	ff d0                	call   *%eax
+  return _close(fd);
+     5a7:	83 ec 0c             	sub    $0xc,%esp
+     5aa:	53                   	push   %ebx
+     5ab:	e8 f8 02 00 00       	call   8a8 <_close>
+     5b0:	83 c4 10             	add    $0x10,%esp
+}
+     5b3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     5b6:	89 f0                	mov    %esi,%eax
+     5b8:	5b                   	pop    %ebx
+     5b9:	5e                   	pop    %esi
+     5ba:	5d                   	pop    %ebp
+     5bb:	c3                   	ret
+     5bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+     5c0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     5c5:	eb ec                	jmp    5b3 <stat+0x43>
+     5c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5ce:	66 90                	xchg   %ax,%ax
+
+000005d0 <atoi>:
+{
+     5d0:	55                   	push   %ebp
+     5d1:	89 e5                	mov    %esp,%ebp
+     5d3:	53                   	push   %ebx
+     5d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+     5d7:	0f be 02             	movsbl (%edx),%eax
+     5da:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     5dd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     5e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     5e5:	77 1e                	ja     605 <atoi+0x35>
+     5e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5ee:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     5f0:	83 c2 01             	add    $0x1,%edx
+     5f3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     5f6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     5fa:	0f be 02             	movsbl (%edx),%eax
+     5fd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     600:	80 fb 09             	cmp    $0x9,%bl
+     603:	76 eb                	jbe    5f0 <atoi+0x20>
+}
+     605:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     608:	89 c8                	mov    %ecx,%eax
+     60a:	c9                   	leave
+     60b:	c3                   	ret
+     60c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000610 <memmove>:
+{
+     610:	55                   	push   %ebp
+     611:	89 e5                	mov    %esp,%ebp
+     613:	57                   	push   %edi
+     614:	56                   	push   %esi
+     615:	8b 45 10             	mov    0x10(%ebp),%eax
+     618:	8b 55 08             	mov    0x8(%ebp),%edx
+     61b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+     61e:	85 c0                	test   %eax,%eax
+     620:	7e 13                	jle    635 <memmove+0x25>
+     622:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     624:	89 d7                	mov    %edx,%edi
+     626:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     62d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     630:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     631:	39 f8                	cmp    %edi,%eax
+     633:	75 fb                	jne    630 <memmove+0x20>
+}
+     635:	5e                   	pop    %esi
+     636:	89 d0                	mov    %edx,%eax
+     638:	5f                   	pop    %edi
+     639:	5d                   	pop    %ebp
+     63a:	c3                   	ret
+     63b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     63f:	90                   	nop
+
+00000640 <fork>:
+  if(flushhook)
+     640:	a1 20 26 00 00       	mov    0x2620,%eax
+     645:	85 c0                	test   %eax,%eax
+     647:	74 17                	je     660 <fork+0x20>
+{
+     649:	55                   	push   %ebp
+     64a:	89 e5                	mov    %esp,%ebp
+     64c:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+     64f:	ff d0                	call   *%eax
+}
+     651:	c9                   	leave
+  return _fork();
+     652:	e9 21 02 00 00       	jmp    878 <_fork>
+     657:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     65e:	66 90                	xchg   %ax,%ax
+     660:	e9 13 02 00 00       	jmp    878 <_fork>
+     665:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     66c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000670 <exit>:
+{
+     670:	55                   	push   %ebp
+     671:	89 e5                	mov    %esp,%ebp
+     673:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+     676:	a1 20 26 00 00       	mov    0x2620,%eax
+     67b:	85 c0                	test   %eax,%eax
+     67d:	74 02                	je     681 <exit+0x11>
+    flushhook();
+     67f:	ff d0                	call   *%eax
+  _exit();
+     681:	e8 fa 01 00 00       	call   880 <_exit>
+     686:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     68d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000690 <exec>:
+{
+     690:	55                   	push   %ebp
+  if(flushhook)
+     691:	a1 20 26 00 00       	mov    0x2620,%eax
+{
+     696:	89 e5                	mov    %esp,%ebp
+     698:	56                   	push   %esi
+     699:	53                   	push   %ebx
+     69a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     69d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+     6a0:	85 c0                	test   %eax,%eax
+     6a2:	74 02                	je     6a6 <exec+0x16>
+    flushhook();
+     6a4:	ff d0                	call   *%eax
+  return _exec(path, argv);
+     6a6:	89 75 0c             	mov    %esi,0xc(%ebp)
+     6a9:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     6ac:	5b                   	pop    %ebx
+     6ad:	5e                   	pop    %esi
+     6ae:	5d                   	pop    %ebp
+  return _exec(path, argv);
+     6af:	e9 04 02 00 00       	jmp    8b8 <_exec>
+     6b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     6bf:	90                   	nop
+
+000006c0 <read>:
+{
+     6c0:	55                   	push   %ebp
+     6c1:	89 e5                	mov    %esp,%ebp
+     6c3:	57                   	push   %edi
+     6c4:	56                   	push   %esi
+     6c5:	53                   	push   %ebx
+     6c6:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     6c9:	a1 20 26 00 00       	mov    0x2620,%eax
+{
+     6ce:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     6d1:	8b 75 0c             	mov    0xc(%ebp),%esi
+     6d4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     6d7:	85 c0                	test   %eax,%eax
+     6d9:	74 02                	je     6dd <read+0x1d>
+    flushhook();
+     6db:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+     6dd:	89 7d 10             	mov    %edi,0x10(%ebp)
+     6e0:	89 75 0c             	mov    %esi,0xc(%ebp)
+     6e3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     6e6:	83 c4 0c             	add    $0xc,%esp
+     6e9:	5b                   	pop    %ebx
+     6ea:	5e                   	pop    %esi
+     6eb:	5f                   	pop    %edi
+     6ec:	5d                   	pop    %ebp
+  return _read(fd, buf, n);
+     6ed:	e9 a6 01 00 00       	jmp    898 <_read>
+     6f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000700 <readv>:
+{
+     700:	55                   	push   %ebp
+     701:	89 e5                	mov    %esp,%ebp
+     703:	57                   	push   %edi
+     704:	56                   	push   %esi
+     705:	53                   	push   %ebx
+     706:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     709:	a1 20 26 00 00       	mov    0x2620,%eax
+{
+     70e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     711:	8b 75 0c             	mov    0xc(%ebp),%esi
+     714:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     717:	85 c0                	test   %eax,%eax
+     719:	74 02                	je     71d <readv+0x1d>
+    flushhook();
+     71b:	ff d0                	call   *%eax
+  return _readv(fd, iov, cnt);
+     71d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     720:	89 75 0c             	mov    %esi,0xc(%ebp)
+     723:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     726:	83 c4 0c             	add    $0xc,%esp
+     729:	5b                   	pop    %ebx
+     72a:	5e                   	pop    %esi
+     72b:	5f                   	pop    %edi
+     72c:	5d                   	pop    %ebp
+  return _readv(fd, iov, cnt);
+     72d:	e9 76 02 00 00       	jmp    9a8 <_readv>
+     732:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     739:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000740 <write>:
+{
+     740:	55                   	push   %ebp
+     741:	89 e5                	mov    %esp,%ebp
+     743:	57                   	push   %edi
+     744:	56                   	push   %esi
+     745:	53                   	push   %ebx
+     746:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     749:	a1 20 26 00 00       	mov    0x2620,%eax
+{
+     74e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     751:	8b 75 0c             	mov    0xc(%ebp),%esi
+     754:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     757:	85 c0                	test   %eax,%eax
+     759:	74 02                	je     75d <write+0x1d>
+    flushhook();
+     75b:	ff d0                	call   *%eax
+  return _write(fd, buf, n);
+     75d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     760:	89 75 0c             	mov    %esi,0xc(%ebp)
+     763:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     766:	83 c4 0c             	add    $0xc,%esp
+     769:	5b                   	pop    %ebx
+     76a:	5e                   	pop    %esi
+     76b:	5f                   	pop    %edi
+     76c:	5d                   	pop    %ebp
+  return _write(fd, buf, n);
+     76d:	e9 2e 01 00 00       	jmp    8a0 <_write>
+     772:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     779:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000780 <writev>:
+{
+     780:	55                   	push   %ebp
+     781:	89 e5                	mov    %esp,%ebp
+     783:	57                   	push   %edi
+     784:	56                   	push   %esi
+     785:	53                   	push   %ebx
+     786:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     789:	a1 20 26 00 00       	mov    0x2620,%eax
+{
+     78e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     791:	8b 75 0c             	mov    0xc(%ebp),%esi
+     794:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     797:	85 c0                	test   %eax,%eax
+     799:	74 02                	je     79d <writev+0x1d>
+    flushhook();
+     79b:	ff d0                	call   *%eax
+  return _writev(fd, iov, cnt);
+     79d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     7a0:	89 75 0c             	mov    %esi,0xc(%ebp)
+     7a3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     7a6:	83 c4 0c             	add    $0xc,%esp
+     7a9:	5b                   	pop    %ebx
+     7aa:	5e                   	pop    %esi
+     7ab:	5f                   	pop    %edi
+     7ac:	5d                   	pop    %ebp
+  return _writev(fd, iov, cnt);
+     7ad:	e9 fe 01 00 00       	jmp    9b0 <_writev>
+     7b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000007c0 <close>:
+{
+     7c0:	55                   	push   %ebp
+     7c1:	89 e5                	mov    %esp,%ebp
+     7c3:	53                   	push   %ebx
+     7c4:	83 ec 04             	sub    $0x4,%esp
+  if(flushhook)
+     7c7:	a1 20 26 00 00       	mov    0x2620,%eax
+{
+     7cc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(flushhook)
+     7cf:	85 c0                	test   %eax,%eax
+     7d1:	74 02                	je     7d5 <close+0x15>
+    flushhook();
+     7d3:	ff d0                	call   *%eax
+  return _close(fd);
+     7d5:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     7d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     7db:	c9                   	leave
+  return _close(fd);
+     7dc:	e9 c7 00 00 00       	jmp    8a8 <_close>
+     7e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7ef:	90                   	nop
+
+000007f0 <umtxinit>:
+// process that finds the mutex held enters the kernel, to sleep
+// in futexwait() until the holder's umtxunlock() wakes it.
+
+void
+umtxinit(struct umutex *m)
+{
+     7f0:	55                   	push   %ebp
+     7f1:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+     7f3:	8b 45 08             	mov    0x8(%ebp),%eax
+     7f6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     7fc:	5d                   	pop    %ebp
+     7fd:	c3                   	ret
+     7fe:	66 90                	xchg   %ax,%ax
+
+00000800 <umtxlock>:
+
+void
+umtxlock(struct umutex *m)
+{
+     800:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+     801:	b8 01 00 00 00       	mov    $0x1,%eax
+     806:	89 e5                	mov    %esp,%ebp
+     808:	56                   	push   %esi
+     809:	53                   	push   %ebx
+     80a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     80d:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 1) == 0)
+     810:	85 c0                	test   %eax,%eax
+     812:	74 2b                	je     83f <umtxlock+0x3f>
+     814:	b8 02 00 00 00       	mov    $0x2,%eax
+     819:	f0 87 03             	lock xchg %eax,(%ebx)
+    return;
+  // Mark the mutex contended, so that its holder
+  // wakes a waiter on release, and wait.
+  while(xchg(&m->state, 2) != 0)
+     81c:	85 c0                	test   %eax,%eax
+     81e:	74 1f                	je     83f <umtxlock+0x3f>
+     820:	be 02 00 00 00       	mov    $0x2,%esi
+     825:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwait(&m->state, 2);
+     828:	83 ec 08             	sub    $0x8,%esp
+     82b:	6a 02                	push   $0x2
+     82d:	53                   	push   %ebx
+     82e:	e8 85 01 00 00       	call   9b8 <futexwait>
+     833:	89 f0                	mov    %esi,%eax
+     835:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+     838:	83 c4 10             	add    $0x10,%esp
+     83b:	85 c0                	test   %eax,%eax
+     83d:	75 e9                	jne    828 <umtxlock+0x28>
+}
+     83f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     842:	5b                   	pop    %ebx
+     843:	5e                   	pop    %esi
+     844:	5d                   	pop    %ebp
+     845:	c3                   	ret
+     846:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     84d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000850 <umtxunlock>:
+
+void
+umtxunlock(struct umutex *m)
+{
+     850:	55                   	push   %ebp
+     851:	31 c0                	xor    %eax,%eax
+     853:	89 e5                	mov    %esp,%ebp
+     855:	83 ec 08             	sub    $0x8,%esp
+     858:	8b 55 08             	mov    0x8(%ebp),%edx
+     85b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+     85e:	83 f8 02             	cmp    $0x2,%eax
+     861:	74 05                	je     868 <umtxunlock+0x18>
+    futexwake(&m->state, 1);
+}
+     863:	c9                   	leave
+     864:	c3                   	ret
+     865:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwake(&m->state, 1);
+     868:	83 ec 08             	sub    $0x8,%esp
+     86b:	6a 01                	push   $0x1
+     86d:	52                   	push   %edx
+     86e:	e8 4d 01 00 00       	call   9c0 <futexwake>
+     873:	83 c4 10             	add    $0x10,%esp
+}
+     876:	c9                   	leave
+     877:	c3                   	ret
+
+00000878 <_fork>:
+  _ ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+     878:	b8 01 00 00 00       	mov    $0x1,%eax
+     87d:	cd 40                	int    $0x40
+     87f:	c3                   	ret
+
+00000880 <_exit>:
+RAWSYSCALL(exit)
+     880:	b8 02 00 00 00       	mov    $0x2,%eax
+     885:	cd 40                	int    $0x40
+     887:	c3                   	ret
+
+00000888 <wait>:
+SYSCALL(wait)
+     888:	b8 03 00 00 00       	mov    $0x3,%eax
+     88d:	cd 40                	int    $0x40
+     88f:	c3                   	ret
+
+00000890 <pipe>:
+SYSCALL(pipe)
+     890:	b8 04 00 00 00       	mov    $0x4,%eax
+     895:	cd 40                	int    $0x40
+     897:	c3                   	ret
+
+00000898 <_read>:
+RAWSYSCALL(read)
+     898:	b8 05 00 00 00       	mov    $0x5,%eax
+     89d:	cd 40                	int    $0x40
+     89f:	c3                   	ret
+
+000008a0 <_write>:
+RAWSYSCALL(write)
+     8a0:	b8 10 00 00 00       	mov    $0x10,%eax
+     8a5:	cd 40                	int    $0x40
+     8a7:	c3                   	ret
+
+000008a8 <_close>:
+RAWSYSCALL(close)
+     8a8:	b8 15 00 00 00       	mov    $0x15,%eax
+     8ad:	cd 40                	int    $0x40
+     8af:	c3                   	ret
+
+000008b0 <kill>:
+SYSCALL(kill)
+     8b0:	b8 06 00 00 00       	mov    $0x6,%eax
+     8b5:	cd 40                	int    $0x40
+     8b7:	c3                   	ret
+
+000008b8 <_exec>:
+RAWSYSCALL(exec)
+     8b8:	b8 07 00 00 00       	mov    $0x7,%eax
+     8bd:	cd 40                	int    $0x40
+     8bf:	c3                   	ret
+
+000008c0 <open>:
+SYSCALL(open)
+     8c0:	b8 0f 00 00 00       	mov    $0xf,%eax
+     8c5:	cd 40                	int    $0x40
+     8c7:	c3                   	ret
+
+000008c8 <mknod>:
+SYSCALL(mknod)
+     8c8:	b8 11 00 00 00       	mov    $0x11,%eax
+     8cd:	cd 40                	int    $0x40
+     8cf:	c3                   	ret
+
+000008d0 <unlink>:
+SYSCALL(unlink)
+     8d0:	b8 12 00 00 00       	mov    $0x12,%eax
+     8d5:	cd 40                	int    $0x40
+     8d7:	c3                   	ret
+
+000008d8 <fstat>:
+SYSCALL(fstat)
+     8d8:	b8 08 00 00 00       	mov    $0x8,%eax
+     8dd:	cd 40                	int    $0x40
+     8df:	c3                   	ret
+
+000008e0 <link>:
+SYSCALL(link)
+     8e0:	b8 13 00 00 00       	mov    $0x13,%eax
+     8e5:	cd 40                	int    $0x40
+     8e7:	c3                   	ret
+
+000008e8 <mkdir>:
+SYSCALL(mkdir)
+     8e8:	b8 14 00 00 00       	mov    $0x14,%eax
+     8ed:	cd 40                	int    $0x40
+     8ef:	c3                   	ret
+
+000008f0 <chdir>:
+SYSCALL(chdir)
+     8f0:	b8 09 00 00 00       	mov    $0x9,%eax
+     8f5:	cd 40                	int    $0x40
+     8f7:	c3                   	ret
+
+000008f8 <dup>:
+SYSCALL(dup)
+     8f8:	b8 0a 00 00 00       	mov    $0xa,%eax
+     8fd:	cd 40                	int    $0x40
+     8ff:	c3                   	ret
+
+00000900 <getpid>:
+SYSCALL(getpid)
+     900:	b8 0b 00 00 00       	mov    $0xb,%eax
+     905:	cd 40                	int    $0x40
+     907:	c3                   	ret
+
+00000908 <sbrk>:
+SYSCALL(sbrk)
+     908:	b8 0c 00 00 00       	mov    $0xc,%eax
+     90d:	cd 40                	int    $0x40
+     90f:	c3                   	ret
+
+00000910 <sleep>:
+SYSCALL(sleep)
+     910:	b8 0d 00 00 00       	mov    $0xd,%eax
+     915:	cd 40                	int    $0x40
+     917:	c3                   	ret
+
+00000918 <uptime>:
+SYSCALL(uptime)
+     918:	b8 0e 00 00 00       	mov    $0xe,%eax
+     91d:	cd 40                	int    $0x40
+     91f:	c3                   	ret
+
+00000920 <wolfie>:
+SYSCALL(wolfie)
+     920:	b8 16 00 00 00       	mov    $0x16,%eax
+     925:	cd 40                	int    $0x40
+     927:	c3                   	ret
+
+00000928 <nice>:
+SYSCALL(nice)
+     928:	b8 17 00 00 00       	mov    $0x17,%eax
+     92d:	cd 40                	int    $0x40
+     92f:	c3                   	ret
+
+00000930 <mtxget>:
+SYSCALL(mtxget)
+     930:	b8 18 00 00 00       	mov    $0x18,%eax
+     935:	cd 40                	int    $0x40
+     937:	c3                   	ret
+
+00000938 <mtxrel>:
+SYSCALL(mtxrel)
+     938:	b8 19 00 00 00       	mov    $0x19,%eax
+     93d:	cd 40                	int    $0x40
+     93f:	c3                   	ret
+
+00000940 <mtxacq>:
+SYSCALL(mtxacq)
+     940:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     945:	cd 40                	int    $0x40
+     947:	c3                   	ret
+
+00000948 <mtxdel>:
+SYSCALL(mtxdel)
+     948:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     94d:	cd 40                	int    $0x40
+     94f:	c3                   	ret
+
+00000950 <iostat>:
+SYSCALL(iostat)
+     950:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     955:	cd 40                	int    $0x40
+     957:	c3                   	ret
+
+00000958 <mmap>:
+SYSCALL(mmap)
+     958:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     95d:	cd 40                	int    $0x40
+     95f:	c3                   	ret
+
+00000960 <munmap>:
+SYSCALL(munmap)
+     960:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     965:	cd 40                	int    $0x40
+     967:	c3                   	ret
+
+00000968 <shmget>:
+SYSCALL(shmget)
+     968:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     96d:	cd 40                	int    $0x40
+     96f:	c3                   	ret
+
+00000970 <shmat>:
+SYSCALL(shmat)
+     970:	b8 20 00 00 00       	mov    $0x20,%eax
+     975:	cd 40                	int    $0x40
+     977:	c3                   	ret
+
+00000978 <shmdt>:
+SYSCALL(shmdt)
+     978:	b8 21 00 00 00       	mov    $0x21,%eax
+     97d:	cd 40                	int    $0x40
+     97f:	c3                   	ret
+
+00000980 <shmdel>:
+SYSCALL(shmdel)
+     980:	b8 22 00 00 00       	mov    $0x22,%eax
+     985:	cd 40                	int    $0x40
+     987:	c3                   	ret
+
+00000988 <syscount>:
+SYSCALL(syscount)
+     988:	b8 23 00 00 00       	mov    $0x23,%eax
+     98d:	cd 40                	int    $0x40
+     98f:	c3                   	ret
+
+00000990 <splice>:
+SYSCALL(splice)
+     990:	b8 24 00 00 00       	mov    $0x24,%eax
+     995:	cd 40                	int    $0x40
+     997:	c3                   	ret
+
+00000998 <tee>:
+SYSCALL(tee)
+     998:	b8 25 00 00 00       	mov    $0x25,%eax
+     99d:	cd 40                	int    $0x40
+     99f:	c3                   	ret
+
+000009a0 <sendfile>:
+SYSCALL(sendfile)
+     9a0:	b8 26 00 00 00       	mov    $0x26,%eax
+     9a5:	cd 40                	int    $0x40
+     9a7:	c3                   	ret
+
+000009a8 <_readv>:
+RAWSYSCALL(readv)
+     9a8:	b8 27 00 00 00       	mov    $0x27,%eax
+     9ad:	cd 40                	int    $0x40
+     9af:	c3                   	ret
+
+000009b0 <_writev>:
+RAWSYSCALL(writev)
+     9b0:	b8 28 00 00 00       	mov    $0x28,%eax
+     9b5:	cd 40                	int    $0x40
+     9b7:	c3                   	ret
+
+000009b8 <futexwait>:
+SYSCALL(futexwait)
+     9b8:	b8 29 00 00 00       	mov    $0x29,%eax
+     9bd:	cd 40                	int    $0x40
+     9bf:	c3                   	ret
+
+000009c0 <futexwake>:
+SYSCALL(futexwake)
+     9c0:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     9c5:	cd 40                	int    $0x40
+     9c7:	c3                   	ret
+
+000009c8 <lockstat>:
+SYSCALL(lockstat)
+     9c8:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     9cd:	cd 40                	int    $0x40
+     9cf:	c3                   	ret
+
+000009d0 <clone>:
+SYSCALL(clone)
+     9d0:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     9d5:	cd 40                	int    $0x40
+     9d7:	c3                   	ret
+
+000009d8 <join>:
+SYSCALL(join)
+     9d8:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     9dd:	cd 40                	int    $0x40
+     9df:	c3                   	ret
+
+000009e0 <stacklimit>:
+SYSCALL(stacklimit)
+     9e0:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     9e5:	cd 40                	int    $0x40
+     9e7:	c3                   	ret
+     9e8:	66 90                	xchg   %ax,%ax
+     9ea:	66 90                	xchg   %ax,%ax
+     9ec:	66 90                	xchg   %ax,%ax
+     9ee:	66 90                	xchg   %ax,%ax
+
+000009f0 <flushall>:
+  b->n = 0;
+}
+
+static void
+flushall(void)
+{
+     9f0:	55                   	push   %ebp
+     9f1:	89 e5                	mov    %esp,%ebp
+     9f3:	83 ec 14             	sub    $0x14,%esp
+  umtxlock(&stdoutlock);
+     9f6:	68 24 26 00 00       	push   $0x2624
+     9fb:	e8 00 fe ff ff       	call   800 <umtxlock>
+  if(b->n > 0)
+     a00:	a1 08 20 00 00       	mov    0x2008,%eax
+     a05:	83 c4 10             	add    $0x10,%esp
+     a08:	85 c0                	test   %eax,%eax
+     a0a:	7e 17                	jle    a23 <flushall+0x33>
+    _write(b->fd, b->buf, b->n);
+     a0c:	83 ec 04             	sub    $0x4,%esp
+     a0f:	50                   	push   %eax
+     a10:	68 0c 20 00 00       	push   $0x200c
+     a15:	ff 35 00 20 00 00    	push   0x2000
+     a1b:	e8 80 fe ff ff       	call   8a0 <_write>
+     a20:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     a23:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     a2a:	00 00 00 
+  flush(&stdout);
+  umtxunlock(&stdoutlock);
+     a2d:	83 ec 0c             	sub    $0xc,%esp
+     a30:	68 24 26 00 00       	push   $0x2624
+     a35:	e8 16 fe ff ff       	call   850 <umtxunlock>
+}
+     a3a:	83 c4 10             	add    $0x10,%esp
+     a3d:	c9                   	leave
+     a3e:	c3                   	ret
+     a3f:	90                   	nop
+
+00000a40 <printint>:
+    flush(b);
+}
+
+static void
+printint(struct outbuf *b, int xx, int base, int sgn)
+{
+     a40:	55                   	push   %ebp
+     a41:	89 e5                	mov    %esp,%ebp
+     a43:	57                   	push   %edi
+     a44:	89 cf                	mov    %ecx,%edi
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     a46:	89 d1                	mov    %edx,%ecx
+{
+     a48:	56                   	push   %esi
+     a49:	53                   	push   %ebx
+     a4a:	89 c3                	mov    %eax,%ebx
+     a4c:	83 ec 2c             	sub    $0x2c,%esp
+  if(sgn && xx < 0){
+     a4f:	85 d2                	test   %edx,%edx
+     a51:	0f 89 b9 00 00 00    	jns    b10 <printint+0xd0>
+     a57:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     a5b:	0f 84 af 00 00 00    	je     b10 <printint+0xd0>
+    x = -xx;
+     a61:	f7 d9                	neg    %ecx
+    neg = 1;
+     a63:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     a68:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     a6b:	31 f6                	xor    %esi,%esi
+     a6d:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     a70:	89 c8                	mov    %ecx,%eax
+     a72:	31 d2                	xor    %edx,%edx
+     a74:	89 f3                	mov    %esi,%ebx
+     a76:	f7 f7                	div    %edi
+     a78:	8d 76 01             	lea    0x1(%esi),%esi
+     a7b:	0f b6 92 5c 17 00 00 	movzbl 0x175c(%edx),%edx
+     a82:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     a86:	89 ca                	mov    %ecx,%edx
+     a88:	89 c1                	mov    %eax,%ecx
+     a8a:	39 fa                	cmp    %edi,%edx
+     a8c:	73 e2                	jae    a70 <printint+0x30>
+  if(neg)
+     a8e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     a91:	89 d9                	mov    %ebx,%ecx
+     a93:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     a96:	85 c0                	test   %eax,%eax
+     a98:	74 07                	je     aa1 <printint+0x61>
+    buf[i++] = '-';
+     a9a:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     a9f:	89 f1                	mov    %esi,%ecx
+     aa1:	8d 75 d8             	lea    -0x28(%ebp),%esi
+     aa4:	89 cf                	mov    %ecx,%edi
+     aa6:	01 f7                	add    %esi,%edi
+     aa8:	eb 1a                	jmp    ac4 <printint+0x84>
+     aaa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    *b->str++ = c;
+     ab0:	8d 48 01             	lea    0x1(%eax),%ecx
+     ab3:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+     ab9:	88 10                	mov    %dl,(%eax)
+
+  while(--i >= 0)
+     abb:	8d 47 ff             	lea    -0x1(%edi),%eax
+     abe:	39 fe                	cmp    %edi,%esi
+     ac0:	74 40                	je     b02 <printint+0xc2>
+     ac2:	89 c7                	mov    %eax,%edi
+  if(b->str){
+     ac4:	8b 83 0c 02 00 00    	mov    0x20c(%ebx),%eax
+    putc(b, buf[i]);
+     aca:	0f b6 17             	movzbl (%edi),%edx
+  if(b->str){
+     acd:	85 c0                	test   %eax,%eax
+     acf:	75 df                	jne    ab0 <printint+0x70>
+  b->buf[b->n++] = c;
+     ad1:	8b 4b 08             	mov    0x8(%ebx),%ecx
+     ad4:	8d 41 01             	lea    0x1(%ecx),%eax
+     ad7:	89 43 08             	mov    %eax,0x8(%ebx)
+     ada:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+     ade:	3d 00 02 00 00       	cmp    $0x200,%eax
+     ae3:	74 3b                	je     b20 <printint+0xe0>
+     ae5:	80 fa 0a             	cmp    $0xa,%dl
+     ae8:	75 d1                	jne    abb <printint+0x7b>
+     aea:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+     aee:	75 cb                	jne    abb <printint+0x7b>
+  if(b->n > 0)
+     af0:	85 c0                	test   %eax,%eax
+     af2:	7f 2c                	jg     b20 <printint+0xe0>
+  b->n = 0;
+     af4:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  while(--i >= 0)
+     afb:	8d 47 ff             	lea    -0x1(%edi),%eax
+     afe:	39 fe                	cmp    %edi,%esi
+     b00:	75 c0                	jne    ac2 <printint+0x82>
+}
+     b02:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     b05:	5b                   	pop    %ebx
+     b06:	5e                   	pop    %esi
+     b07:	5f                   	pop    %edi
+     b08:	5d                   	pop    %ebp
+     b09:	c3                   	ret
+     b0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  neg = 0;
+     b10:	31 c0                	xor    %eax,%eax
+     b12:	e9 51 ff ff ff       	jmp    a68 <printint+0x28>
+     b17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b1e:	66 90                	xchg   %ax,%ax
+    _write(b->fd, b->buf, b->n);
+     b20:	83 ec 04             	sub    $0x4,%esp
+     b23:	50                   	push   %eax
+     b24:	8d 43 0c             	lea    0xc(%ebx),%eax
+     b27:	50                   	push   %eax
+     b28:	ff 33                	push   (%ebx)
+     b2a:	e8 71 fd ff ff       	call   8a0 <_write>
+     b2f:	83 c4 10             	add    $0x10,%esp
+     b32:	eb c0                	jmp    af4 <printint+0xb4>
+     b34:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b3f:	90                   	nop
+
+00000b40 <putc>:
+{
+     b40:	55                   	push   %ebp
+     b41:	89 e5                	mov    %esp,%ebp
+     b43:	53                   	push   %ebx
+     b44:	89 c3                	mov    %eax,%ebx
+     b46:	83 ec 04             	sub    $0x4,%esp
+  if(b->str){
+     b49:	8b 80 0c 02 00 00    	mov    0x20c(%eax),%eax
+     b4f:	85 c0                	test   %eax,%eax
+     b51:	74 15                	je     b68 <putc+0x28>
+    *b->str++ = c;
+     b53:	8d 48 01             	lea    0x1(%eax),%ecx
+     b56:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+     b5c:	88 10                	mov    %dl,(%eax)
+}
+     b5e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     b61:	c9                   	leave
+     b62:	c3                   	ret
+     b63:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b67:	90                   	nop
+  b->buf[b->n++] = c;
+     b68:	8b 4b 08             	mov    0x8(%ebx),%ecx
+     b6b:	8d 41 01             	lea    0x1(%ecx),%eax
+     b6e:	89 43 08             	mov    %eax,0x8(%ebx)
+     b71:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+     b75:	3d 00 02 00 00       	cmp    $0x200,%eax
+     b7a:	74 14                	je     b90 <putc+0x50>
+     b7c:	80 fa 0a             	cmp    $0xa,%dl
+     b7f:	75 dd                	jne    b5e <putc+0x1e>
+     b81:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+     b85:	75 d7                	jne    b5e <putc+0x1e>
+  if(b->n > 0)
+     b87:	85 c0                	test   %eax,%eax
+     b89:	7e 17                	jle    ba2 <putc+0x62>
+     b8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b8f:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     b90:	83 ec 04             	sub    $0x4,%esp
+     b93:	50                   	push   %eax
+     b94:	8d 43 0c             	lea    0xc(%ebx),%eax
+     b97:	50                   	push   %eax
+     b98:	ff 33                	push   (%ebx)
+     b9a:	e8 01 fd ff ff       	call   8a0 <_write>
+     b9f:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     ba2:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+     ba9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     bac:	c9                   	leave
+     bad:	c3                   	ret
+     bae:	66 90                	xchg   %ax,%ax
+
+00000bb0 <format>:
+
+// Format fmt and the arguments at ap into b.
+// Only understands %d, %x, %p, %s, %c.
+static void
+format(struct outbuf *b, const char *fmt, uint *ap)
+{
+     bb0:	55                   	push   %ebp
+     bb1:	89 e5                	mov    %esp,%ebp
+     bb3:	57                   	push   %edi
+     bb4:	89 c7                	mov    %eax,%edi
+     bb6:	56                   	push   %esi
+     bb7:	53                   	push   %ebx
+     bb8:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+     bbb:	0f b6 02             	movzbl (%edx),%eax
+{
+     bbe:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  for(i = 0; fmt[i]; i++){
+     bc1:	84 c0                	test   %al,%al
+     bc3:	74 5a                	je     c1f <format+0x6f>
+     bc5:	8d 5a 01             	lea    0x1(%edx),%ebx
+     bc8:	31 f6                	xor    %esi,%esi
+     bca:	eb 1c                	jmp    be8 <format+0x38>
+     bcc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     bd0:	83 f8 25             	cmp    $0x25,%eax
+     bd3:	74 3b                	je     c10 <format+0x60>
+        state = '%';
+      } else {
+        putc(b, c);
+     bd5:	89 ca                	mov    %ecx,%edx
+     bd7:	89 f8                	mov    %edi,%eax
+     bd9:	e8 62 ff ff ff       	call   b40 <putc>
+  for(i = 0; fmt[i]; i++){
+     bde:	0f b6 03             	movzbl (%ebx),%eax
+     be1:	83 c3 01             	add    $0x1,%ebx
+     be4:	84 c0                	test   %al,%al
+     be6:	74 37                	je     c1f <format+0x6f>
+    c = fmt[i] & 0xff;
+     be8:	0f be c8             	movsbl %al,%ecx
+     beb:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     bee:	85 f6                	test   %esi,%esi
+     bf0:	74 de                	je     bd0 <format+0x20>
+      }
+    } else if(state == '%'){
+     bf2:	83 fe 25             	cmp    $0x25,%esi
+     bf5:	75 e7                	jne    bde <format+0x2e>
+      if(c == 'd'){
+     bf7:	83 f8 25             	cmp    $0x25,%eax
+     bfa:	74 46                	je     c42 <format+0x92>
+     bfc:	83 e8 63             	sub    $0x63,%eax
+     bff:	83 f8 15             	cmp    $0x15,%eax
+     c02:	77 2c                	ja     c30 <format+0x80>
+     c04:	ff 24 85 04 17 00 00 	jmp    *0x1704(,%eax,4)
+     c0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c0f:	90                   	nop
+  for(i = 0; fmt[i]; i++){
+     c10:	0f b6 03             	movzbl (%ebx),%eax
+     c13:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+     c16:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+     c1b:	84 c0                	test   %al,%al
+     c1d:	75 c9                	jne    be8 <format+0x38>
+        putc(b, c);
+      }
+      state = 0;
+    }
+  }
+}
+     c1f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c22:	5b                   	pop    %ebx
+     c23:	5e                   	pop    %esi
+     c24:	5f                   	pop    %edi
+     c25:	5d                   	pop    %ebp
+     c26:	c3                   	ret
+     c27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c2e:	66 90                	xchg   %ax,%ax
+        putc(b, '%');
+     c30:	ba 25 00 00 00       	mov    $0x25,%edx
+     c35:	89 f8                	mov    %edi,%eax
+     c37:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     c3a:	e8 01 ff ff ff       	call   b40 <putc>
+        putc(b, c);
+     c3f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     c42:	89 ca                	mov    %ecx,%edx
+     c44:	89 f8                	mov    %edi,%eax
+      state = 0;
+     c46:	31 f6                	xor    %esi,%esi
+        putc(b, c);
+     c48:	e8 f3 fe ff ff       	call   b40 <putc>
+     c4d:	eb 8f                	jmp    bde <format+0x2e>
+     c4f:	90                   	nop
+        printint(b, *ap, 16, 0);
+     c50:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     c53:	83 ec 0c             	sub    $0xc,%esp
+     c56:	b9 10 00 00 00       	mov    $0x10,%ecx
+     c5b:	8b 16                	mov    (%esi),%edx
+     c5d:	6a 00                	push   $0x0
+        ap++;
+     c5f:	83 c6 04             	add    $0x4,%esi
+        printint(b, *ap, 16, 0);
+     c62:	89 f8                	mov    %edi,%eax
+     c64:	e8 d7 fd ff ff       	call   a40 <printint>
+        ap++;
+     c69:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+     c6c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     c6f:	31 f6                	xor    %esi,%esi
+     c71:	e9 68 ff ff ff       	jmp    bde <format+0x2e>
+     c76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c7d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     c80:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     c83:	8b 30                	mov    (%eax),%esi
+        ap++;
+     c85:	83 c0 04             	add    $0x4,%eax
+     c88:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+     c8b:	85 f6                	test   %esi,%esi
+     c8d:	75 1b                	jne    caa <format+0xfa>
+     c8f:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+     c94:	be fc 16 00 00       	mov    $0x16fc,%esi
+     c99:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+          putc(b, *s);
+     ca0:	89 f8                	mov    %edi,%eax
+          s++;
+     ca2:	83 c6 01             	add    $0x1,%esi
+          putc(b, *s);
+     ca5:	e8 96 fe ff ff       	call   b40 <putc>
+        while(*s != 0){
+     caa:	0f be 16             	movsbl (%esi),%edx
+     cad:	84 d2                	test   %dl,%dl
+     caf:	75 ef                	jne    ca0 <format+0xf0>
+      state = 0;
+     cb1:	31 f6                	xor    %esi,%esi
+     cb3:	e9 26 ff ff ff       	jmp    bde <format+0x2e>
+     cb8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cbf:	90                   	nop
+        printint(b, *ap, 10, 1);
+     cc0:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     cc3:	83 ec 0c             	sub    $0xc,%esp
+     cc6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     ccb:	8b 16                	mov    (%esi),%edx
+     ccd:	6a 01                	push   $0x1
+     ccf:	eb 8e                	jmp    c5f <format+0xaf>
+     cd1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(b, *ap);
+     cd8:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     cdb:	89 f8                	mov    %edi,%eax
+     cdd:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+     ce0:	83 c6 04             	add    $0x4,%esi
+        putc(b, *ap);
+     ce3:	e8 58 fe ff ff       	call   b40 <putc>
+        ap++;
+     ce8:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      state = 0;
+     ceb:	31 f6                	xor    %esi,%esi
+     ced:	e9 ec fe ff ff       	jmp    bde <format+0x2e>
+     cf2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cf9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000d00 <fflush>:
+{
+     d00:	55                   	push   %ebp
+     d01:	89 e5                	mov    %esp,%ebp
+     d03:	83 ec 08             	sub    $0x8,%esp
+  if(fd == stdout.fd)
+     d06:	8b 45 08             	mov    0x8(%ebp),%eax
+     d09:	39 05 00 20 00 00    	cmp    %eax,0x2000
+     d0f:	74 07                	je     d18 <fflush+0x18>
+}
+     d11:	c9                   	leave
+     d12:	c3                   	ret
+     d13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d17:	90                   	nop
+  umtxlock(&stdoutlock);
+     d18:	83 ec 0c             	sub    $0xc,%esp
+     d1b:	68 24 26 00 00       	push   $0x2624
+     d20:	e8 db fa ff ff       	call   800 <umtxlock>
+  if(b->n > 0)
+     d25:	a1 08 20 00 00       	mov    0x2008,%eax
+     d2a:	83 c4 10             	add    $0x10,%esp
+     d2d:	85 c0                	test   %eax,%eax
+     d2f:	7f 1f                	jg     d50 <fflush+0x50>
+  b->n = 0;
+     d31:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     d38:	00 00 00 
+  umtxunlock(&stdoutlock);
+     d3b:	c7 45 08 24 26 00 00 	movl   $0x2624,0x8(%ebp)
+}
+     d42:	c9                   	leave
+  umtxunlock(&stdoutlock);
+     d43:	e9 08 fb ff ff       	jmp    850 <umtxunlock>
+     d48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d4f:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     d50:	83 ec 04             	sub    $0x4,%esp
+     d53:	50                   	push   %eax
+     d54:	68 0c 20 00 00       	push   $0x200c
+     d59:	ff 35 00 20 00 00    	push   0x2000
+     d5f:	e8 3c fb ff ff       	call   8a0 <_write>
+     d64:	83 c4 10             	add    $0x10,%esp
+     d67:	eb c8                	jmp    d31 <fflush+0x31>
+     d69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000d70 <setvbuf>:
+{
+     d70:	55                   	push   %ebp
+     d71:	89 e5                	mov    %esp,%ebp
+     d73:	53                   	push   %ebx
+     d74:	83 ec 04             	sub    $0x4,%esp
+     d77:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd != stdout.fd)
+     d7a:	8b 45 08             	mov    0x8(%ebp),%eax
+     d7d:	39 05 00 20 00 00    	cmp    %eax,0x2000
+     d83:	74 0b                	je     d90 <setvbuf+0x20>
+}
+     d85:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     d88:	c9                   	leave
+     d89:	c3                   	ret
+     d8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  umtxlock(&stdoutlock);
+     d90:	83 ec 0c             	sub    $0xc,%esp
+     d93:	68 24 26 00 00       	push   $0x2624
+     d98:	e8 63 fa ff ff       	call   800 <umtxlock>
+  if(b->n > 0)
+     d9d:	a1 08 20 00 00       	mov    0x2008,%eax
+     da2:	83 c4 10             	add    $0x10,%esp
+     da5:	85 c0                	test   %eax,%eax
+     da7:	7f 2f                	jg     dd8 <setvbuf+0x68>
+  b->n = 0;
+     da9:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     db0:	00 00 00 
+  stdout.mode = mode;
+     db3:	89 1d 04 20 00 00    	mov    %ebx,0x2004
+  flushhook = flushall;
+     db9:	c7 05 20 26 00 00 f0 	movl   $0x9f0,0x2620
+     dc0:	09 00 00 
+}
+     dc3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&stdoutlock);
+     dc6:	c7 45 08 24 26 00 00 	movl   $0x2624,0x8(%ebp)
+}
+     dcd:	c9                   	leave
+  umtxunlock(&stdoutlock);
+     dce:	e9 7d fa ff ff       	jmp    850 <umtxunlock>
+     dd3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     dd7:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     dd8:	83 ec 04             	sub    $0x4,%esp
+     ddb:	50                   	push   %eax
+     ddc:	68 0c 20 00 00       	push   $0x200c
+     de1:	ff 35 00 20 00 00    	push   0x2000
+     de7:	e8 b4 fa ff ff       	call   8a0 <_write>
+     dec:	83 c4 10             	add    $0x10,%esp
+     def:	eb b8                	jmp    da9 <setvbuf+0x39>
+     df1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     df8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dff:	90                   	nop
+
+00000e00 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s, %c.
+void
+printf(int fd, const char *fmt, ...)
+{
+     e00:	55                   	push   %ebp
+     e01:	89 e5                	mov    %esp,%ebp
+     e03:	53                   	push   %ebx
+     e04:	81 ec 14 02 00 00    	sub    $0x214,%esp
+     e0a:	8b 45 08             	mov    0x8(%ebp),%eax
+    local.mode = _IONBF;
+    local.n = 0;
+    local.str = 0;
+    b = &local;
+  }
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     e0d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd == stdout.fd){
+     e10:	39 05 00 20 00 00    	cmp    %eax,0x2000
+     e16:	74 48                	je     e60 <printf+0x60>
+    local.fd = fd;
+     e18:	89 85 e8 fd ff ff    	mov    %eax,-0x218(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     e1e:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     e21:	89 da                	mov    %ebx,%edx
+     e23:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+    local.mode = _IONBF;
+     e29:	c7 85 ec fd ff ff 03 	movl   $0x3,-0x214(%ebp)
+     e30:	00 00 00 
+    local.n = 0;
+     e33:	c7 85 f0 fd ff ff 00 	movl   $0x0,-0x210(%ebp)
+     e3a:	00 00 00 
+    local.str = 0;
+     e3d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     e44:	e8 67 fd ff ff       	call   bb0 <format>
+  if(b->mode == _IONBF)
+     e49:	83 bd ec fd ff ff 03 	cmpl   $0x3,-0x214(%ebp)
+     e50:	0f 84 a2 00 00 00    	je     ef8 <printf+0xf8>
+    flush(b);
+  if(b == &stdout)
+    umtxunlock(&stdoutlock);
+}
+     e56:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     e59:	c9                   	leave
+     e5a:	c3                   	ret
+     e5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e5f:	90                   	nop
+    umtxlock(&stdoutlock);
+     e60:	83 ec 0c             	sub    $0xc,%esp
+     e63:	68 24 26 00 00       	push   $0x2624
+     e68:	e8 93 f9 ff ff       	call   800 <umtxlock>
+  if(stdout.mode == 0){
+     e6d:	a1 04 20 00 00       	mov    0x2004,%eax
+     e72:	83 c4 10             	add    $0x10,%esp
+     e75:	85 c0                	test   %eax,%eax
+     e77:	74 37                	je     eb0 <printf+0xb0>
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     e79:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     e7c:	89 da                	mov    %ebx,%edx
+     e7e:	b8 00 20 00 00       	mov    $0x2000,%eax
+     e83:	e8 28 fd ff ff       	call   bb0 <format>
+  if(b->mode == _IONBF)
+     e88:	83 3d 04 20 00 00 03 	cmpl   $0x3,0x2004
+     e8f:	0f 84 ab 00 00 00    	je     f40 <printf+0x140>
+    umtxunlock(&stdoutlock);
+     e95:	83 ec 0c             	sub    $0xc,%esp
+     e98:	68 24 26 00 00       	push   $0x2624
+     e9d:	e8 ae f9 ff ff       	call   850 <umtxunlock>
+}
+     ea2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    umtxunlock(&stdoutlock);
+     ea5:	83 c4 10             	add    $0x10,%esp
+}
+     ea8:	c9                   	leave
+     ea9:	c3                   	ret
+     eaa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+     eb0:	83 ec 08             	sub    $0x8,%esp
+     eb3:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+     eb9:	50                   	push   %eax
+     eba:	ff 35 00 20 00 00    	push   0x2000
+     ec0:	e8 13 fa ff ff       	call   8d8 <fstat>
+     ec5:	83 c4 10             	add    $0x10,%esp
+     ec8:	89 c2                	mov    %eax,%edx
+      stdout.mode = _IOFBF;
+     eca:	b8 01 00 00 00       	mov    $0x1,%eax
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+     ecf:	85 d2                	test   %edx,%edx
+     ed1:	75 10                	jne    ee3 <printf+0xe3>
+      stdout.mode = _IOLBF;
+     ed3:	31 c0                	xor    %eax,%eax
+     ed5:	66 83 bd e8 fd ff ff 	cmpw   $0x3,-0x218(%ebp)
+     edc:	03 
+     edd:	0f 94 c0             	sete   %al
+     ee0:	83 c0 01             	add    $0x1,%eax
+     ee3:	a3 04 20 00 00       	mov    %eax,0x2004
+    flushhook = flushall;
+     ee8:	c7 05 20 26 00 00 f0 	movl   $0x9f0,0x2620
+     eef:	09 00 00 
+     ef2:	eb 85                	jmp    e79 <printf+0x79>
+     ef4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(b->n > 0)
+     ef8:	8b 85 f0 fd ff ff    	mov    -0x210(%ebp),%eax
+     efe:	85 c0                	test   %eax,%eax
+     f00:	0f 8e 50 ff ff ff    	jle    e56 <printf+0x56>
+    b = &local;
+     f06:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+    _write(b->fd, b->buf, b->n);
+     f0c:	83 ec 04             	sub    $0x4,%esp
+     f0f:	50                   	push   %eax
+     f10:	8d 43 0c             	lea    0xc(%ebx),%eax
+     f13:	50                   	push   %eax
+     f14:	ff 33                	push   (%ebx)
+     f16:	e8 85 f9 ff ff       	call   8a0 <_write>
+  b->n = 0;
+     f1b:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  if(b == &stdout)
+     f22:	83 c4 10             	add    $0x10,%esp
+     f25:	81 fb 00 20 00 00    	cmp    $0x2000,%ebx
+     f2b:	0f 85 25 ff ff ff    	jne    e56 <printf+0x56>
+     f31:	e9 5f ff ff ff       	jmp    e95 <printf+0x95>
+     f36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f3d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(b->n > 0)
+     f40:	a1 08 20 00 00       	mov    0x2008,%eax
+    b = getstdout();
+     f45:	bb 00 20 00 00       	mov    $0x2000,%ebx
+  if(b->n > 0)
+     f4a:	85 c0                	test   %eax,%eax
+     f4c:	7f be                	jg     f0c <printf+0x10c>
+  b->n = 0;
+     f4e:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     f55:	00 00 00 
+  if(b == &stdout)
+     f58:	e9 38 ff ff ff       	jmp    e95 <printf+0x95>
+     f5d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000f60 <sprintf>:
+
+// Print to the given buffer. Only understands %d, %x, %p, %s, %c.
+int
+sprintf(char *str, const char *fmt, ...)
+{
+     f60:	55                   	push   %ebp
+     f61:	89 e5                	mov    %esp,%ebp
+     f63:	53                   	push   %ebx
+  struct outbuf b;
+
+  b.str = str;
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+     f64:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+     f6a:	8d 4d 10             	lea    0x10(%ebp),%ecx
+{
+     f6d:	81 ec 14 02 00 00    	sub    $0x214,%esp
+     f73:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+     f76:	8b 55 0c             	mov    0xc(%ebp),%edx
+  b.str = str;
+     f79:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+     f7c:	e8 2f fc ff ff       	call   bb0 <format>
+  *b.str = '\0';
+     f81:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f84:	c6 00 00             	movb   $0x0,(%eax)
+  return b.str - str;
+     f87:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f8a:	29 d8                	sub    %ebx,%eax
+}
+     f8c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     f8f:	c9                   	leave
+     f90:	c3                   	ret
+     f91:	66 90                	xchg   %ax,%ax
+     f93:	66 90                	xchg   %ax,%ax
+     f95:	66 90                	xchg   %ax,%ax
+     f97:	66 90                	xchg   %ax,%ax
+     f99:	66 90                	xchg   %ax,%ax
+     f9b:	66 90                	xchg   %ax,%ax
+     f9d:	66 90                	xchg   %ax,%ax
+     f9f:	90                   	nop
+
+00000fa0 <freeblock>:
+static Header *freep;
+static struct umutex lock;  // threads made by clone() share the heap
+
+static void
+freeblock(void *ap)
+{
+     fa0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+     fa1:	8d 48 f8             	lea    -0x8(%eax),%ecx
+{
+     fa4:	89 e5                	mov    %esp,%ebp
+     fa6:	57                   	push   %edi
+     fa7:	56                   	push   %esi
+     fa8:	53                   	push   %ebx
+     fa9:	89 c3                	mov    %eax,%ebx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     fab:	a1 2c 26 00 00       	mov    0x262c,%eax
+     fb0:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     fb2:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     fb4:	39 ca                	cmp    %ecx,%edx
+     fb6:	73 30                	jae    fe8 <freeblock+0x48>
+     fb8:	39 c1                	cmp    %eax,%ecx
+     fba:	72 04                	jb     fc0 <freeblock+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     fbc:	39 c2                	cmp    %eax,%edx
+     fbe:	72 f0                	jb     fb0 <freeblock+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     fc0:	8b 73 fc             	mov    -0x4(%ebx),%esi
+     fc3:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+     fc6:	39 f8                	cmp    %edi,%eax
+     fc8:	74 26                	je     ff0 <freeblock+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+     fca:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+     fcd:	8b 42 04             	mov    0x4(%edx),%eax
+     fd0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     fd3:	39 f1                	cmp    %esi,%ecx
+     fd5:	74 30                	je     1007 <freeblock+0x67>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+     fd7:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+     fd9:	5b                   	pop    %ebx
+  freep = p;
+     fda:	89 15 2c 26 00 00    	mov    %edx,0x262c
+}
+     fe0:	5e                   	pop    %esi
+     fe1:	5f                   	pop    %edi
+     fe2:	5d                   	pop    %ebp
+     fe3:	c3                   	ret
+     fe4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     fe8:	39 c1                	cmp    %eax,%ecx
+     fea:	72 d0                	jb     fbc <freeblock+0x1c>
+     fec:	eb c2                	jmp    fb0 <freeblock+0x10>
+     fee:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+     ff0:	03 70 04             	add    0x4(%eax),%esi
+     ff3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     ff6:	8b 02                	mov    (%edx),%eax
+     ff8:	8b 00                	mov    (%eax),%eax
+     ffa:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+     ffd:	8b 42 04             	mov    0x4(%edx),%eax
+    1000:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    1003:	39 f1                	cmp    %esi,%ecx
+    1005:	75 d0                	jne    fd7 <freeblock+0x37>
+    p->s.size += bp->s.size;
+    1007:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    100a:	89 15 2c 26 00 00    	mov    %edx,0x262c
+    p->s.size += bp->s.size;
+    1010:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1013:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    1016:	89 0a                	mov    %ecx,(%edx)
+}
+    1018:	5b                   	pop    %ebx
+    1019:	5e                   	pop    %esi
+    101a:	5f                   	pop    %edi
+    101b:	5d                   	pop    %ebp
+    101c:	c3                   	ret
+    101d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001020 <free>:
+
+void
+free(void *ap)
+{
+    1020:	55                   	push   %ebp
+    1021:	89 e5                	mov    %esp,%ebp
+    1023:	53                   	push   %ebx
+    1024:	83 ec 10             	sub    $0x10,%esp
+    1027:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  umtxlock(&lock);
+    102a:	68 28 26 00 00       	push   $0x2628
+    102f:	e8 cc f7 ff ff       	call   800 <umtxlock>
+  freeblock(ap);
+    1034:	89 d8                	mov    %ebx,%eax
+    1036:	e8 65 ff ff ff       	call   fa0 <freeblock>
+  umtxunlock(&lock);
+    103b:	c7 45 08 28 26 00 00 	movl   $0x2628,0x8(%ebp)
+}
+    1042:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&lock);
+    1045:	83 c4 10             	add    $0x10,%esp
+}
+    1048:	c9                   	leave
+  umtxunlock(&lock);
+    1049:	e9 02 f8 ff ff       	jmp    850 <umtxunlock>
+    104e:	66 90                	xchg   %ax,%ax
+
+00001050 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    1050:	55                   	push   %ebp
+    1051:	89 e5                	mov    %esp,%ebp
+    1053:	57                   	push   %edi
+    1054:	56                   	push   %esi
+    1055:	53                   	push   %ebx
+    1056:	83 ec 28             	sub    $0x28,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1059:	8b 45 08             	mov    0x8(%ebp),%eax
+  umtxlock(&lock);
+    105c:	68 28 26 00 00       	push   $0x2628
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1061:	8d 48 07             	lea    0x7(%eax),%ecx
+    1064:	c1 e9 03             	shr    $0x3,%ecx
+    1067:	8d 71 01             	lea    0x1(%ecx),%esi
+  umtxlock(&lock);
+    106a:	e8 91 f7 ff ff       	call   800 <umtxlock>
+  if((prevp = freep) == 0){
+    106f:	8b 15 2c 26 00 00    	mov    0x262c,%edx
+    1075:	83 c4 10             	add    $0x10,%esp
+    1078:	85 d2                	test   %edx,%edx
+    107a:	0f 84 b0 00 00 00    	je     1130 <malloc+0xe0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1080:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+    1082:	8b 47 04             	mov    0x4(%edi),%eax
+    1085:	39 f0                	cmp    %esi,%eax
+    1087:	73 6f                	jae    10f8 <malloc+0xa8>
+  if(nu < 4096)
+    1089:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    108e:	39 de                	cmp    %ebx,%esi
+    1090:	0f 43 de             	cmovae %esi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    1093:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+    109a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    109d:	eb 0a                	jmp    10a9 <malloc+0x59>
+    109f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    10a0:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+    10a2:	8b 47 04             	mov    0x4(%edi),%eax
+    10a5:	39 f0                	cmp    %esi,%eax
+    10a7:	73 4f                	jae    10f8 <malloc+0xa8>
+      }
+      freep = prevp;
+      umtxunlock(&lock);
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    10a9:	89 fa                	mov    %edi,%edx
+    10ab:	39 3d 2c 26 00 00    	cmp    %edi,0x262c
+    10b1:	75 ed                	jne    10a0 <malloc+0x50>
+  p = sbrk(nu * sizeof(Header));
+    10b3:	83 ec 0c             	sub    $0xc,%esp
+    10b6:	ff 75 e4             	push   -0x1c(%ebp)
+    10b9:	e8 4a f8 ff ff       	call   908 <sbrk>
+  if(p == (char*)-1)
+    10be:	83 c4 10             	add    $0x10,%esp
+    10c1:	83 f8 ff             	cmp    $0xffffffff,%eax
+    10c4:	74 15                	je     10db <malloc+0x8b>
+  hp->s.size = nu;
+    10c6:	89 58 04             	mov    %ebx,0x4(%eax)
+  freeblock((void*)(hp + 1));
+    10c9:	83 c0 08             	add    $0x8,%eax
+    10cc:	e8 cf fe ff ff       	call   fa0 <freeblock>
+  return freep;
+    10d1:	8b 15 2c 26 00 00    	mov    0x262c,%edx
+      if((p = morecore(nunits)) == 0){
+    10d7:	85 d2                	test   %edx,%edx
+    10d9:	75 c5                	jne    10a0 <malloc+0x50>
+        umtxunlock(&lock);
+    10db:	83 ec 0c             	sub    $0xc,%esp
+    10de:	68 28 26 00 00       	push   $0x2628
+    10e3:	e8 68 f7 ff ff       	call   850 <umtxunlock>
+        return 0;
+    10e8:	83 c4 10             	add    $0x10,%esp
+      }
+  }
+}
+    10eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    10ee:	31 c0                	xor    %eax,%eax
+}
+    10f0:	5b                   	pop    %ebx
+    10f1:	5e                   	pop    %esi
+    10f2:	5f                   	pop    %edi
+    10f3:	5d                   	pop    %ebp
+    10f4:	c3                   	ret
+    10f5:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    10f8:	39 c6                	cmp    %eax,%esi
+    10fa:	74 64                	je     1160 <malloc+0x110>
+        p->s.size -= nunits;
+    10fc:	29 f0                	sub    %esi,%eax
+    10fe:	89 47 04             	mov    %eax,0x4(%edi)
+        p += p->s.size;
+    1101:	8d 3c c7             	lea    (%edi,%eax,8),%edi
+        p->s.size = nunits;
+    1104:	89 77 04             	mov    %esi,0x4(%edi)
+      umtxunlock(&lock);
+    1107:	83 ec 0c             	sub    $0xc,%esp
+      freep = prevp;
+    110a:	89 15 2c 26 00 00    	mov    %edx,0x262c
+      umtxunlock(&lock);
+    1110:	68 28 26 00 00       	push   $0x2628
+    1115:	e8 36 f7 ff ff       	call   850 <umtxunlock>
+      return (void*)(p + 1);
+    111a:	83 c4 10             	add    $0x10,%esp
+}
+    111d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    1120:	8d 47 08             	lea    0x8(%edi),%eax
+}
+    1123:	5b                   	pop    %ebx
+    1124:	5e                   	pop    %esi
+    1125:	5f                   	pop    %edi
+    1126:	5d                   	pop    %ebp
+    1127:	c3                   	ret
+    1128:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    112f:	90                   	nop
+    base.s.ptr = freep = prevp = &base;
+    1130:	c7 05 2c 26 00 00 30 	movl   $0x2630,0x262c
+    1137:	26 00 00 
+    base.s.size = 0;
+    113a:	bf 30 26 00 00       	mov    $0x2630,%edi
+    base.s.ptr = freep = prevp = &base;
+    113f:	c7 05 30 26 00 00 30 	movl   $0x2630,0x2630
+    1146:	26 00 00 
+    base.s.size = 0;
+    1149:	c7 05 34 26 00 00 00 	movl   $0x0,0x2634
+    1150:	00 00 00 
+    if(p->s.size >= nunits){
+    1153:	e9 31 ff ff ff       	jmp    1089 <malloc+0x39>
+    1158:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    115f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1160:	8b 07                	mov    (%edi),%eax
+    1162:	89 02                	mov    %eax,(%edx)
+    1164:	eb a1                	jmp    1107 <malloc+0xb7>
+    1166:	66 90                	xchg   %ax,%ax
+    1168:	66 90                	xchg   %ax,%ax
+    116a:	66 90                	xchg   %ax,%ax
+    116c:	66 90                	xchg   %ax,%ax
+    116e:	66 90                	xchg   %ax,%ax
+
+00001170 <threadstart>:
+
+#define TSTACKSZ 4096
+
+static void
+threadstart(void *fn, void *arg)
+{
+    1170:	55                   	push   %ebp
+    1171:	89 e5                	mov    %esp,%ebp
+    1173:	83 ec 14             	sub    $0x14,%esp
+  ((void (*)(void*))fn)(arg);
+    1176:	ff 75 0c             	push   0xc(%ebp)
+    1179:	ff 55 08             	call   *0x8(%ebp)
+  exit();
+    117c:	e8 ef f4 ff ff       	call   670 <exit>
+    1181:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1188:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    118f:	90                   	nop
+
+00001190 <thread_create>:
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    1190:	55                   	push   %ebp
+    1191:	89 e5                	mov    %esp,%ebp
+    1193:	53                   	push   %ebx
+    1194:	83 ec 20             	sub    $0x20,%esp
+  char *mem, *stack;
+  int pid;
+
+  if((mem = malloc(2*TSTACKSZ)) == 0)
+    1197:	68 00 20 00 00       	push   $0x2000
+    119c:	e8 af fe ff ff       	call   1050 <malloc>
+    11a1:	83 c4 10             	add    $0x10,%esp
+    11a4:	85 c0                	test   %eax,%eax
+    11a6:	74 47                	je     11ef <thread_create+0x5f>
+    11a8:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)(((uint)mem + TSTACKSZ - 1) & ~(TSTACKSZ - 1));
+    11aa:	8d 80 ff 0f 00 00    	lea    0xfff(%eax),%eax
+    11b0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  *(char**)stack = mem;
+    11b5:	89 18                	mov    %ebx,(%eax)
+  if((pid = clone(threadstart, (void*)fn, arg, stack)) < 0)
+    11b7:	50                   	push   %eax
+    11b8:	ff 75 0c             	push   0xc(%ebp)
+    11bb:	ff 75 08             	push   0x8(%ebp)
+    11be:	68 70 11 00 00       	push   $0x1170
+    11c3:	e8 08 f8 ff ff       	call   9d0 <clone>
+    11c8:	83 c4 10             	add    $0x10,%esp
+    11cb:	85 c0                	test   %eax,%eax
+    11cd:	78 09                	js     11d8 <thread_create+0x48>
+    free(mem);
+  return pid;
+}
+    11cf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    11d2:	c9                   	leave
+    11d3:	c3                   	ret
+    11d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    free(mem);
+    11d8:	83 ec 0c             	sub    $0xc,%esp
+    11db:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    11de:	53                   	push   %ebx
+    11df:	e8 3c fe ff ff       	call   1020 <free>
+    11e4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    11e7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+    11ea:	83 c4 10             	add    $0x10,%esp
+}
+    11ed:	c9                   	leave
+    11ee:	c3                   	ret
+    return -1;
+    11ef:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    11f4:	eb d9                	jmp    11cf <thread_create+0x3f>
+    11f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001200 <thread_join>:
+
+int
+thread_join(void)
+{
+    1200:	55                   	push   %ebp
+    1201:	89 e5                	mov    %esp,%ebp
+    1203:	83 ec 34             	sub    $0x34,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    1206:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    1209:	50                   	push   %eax
+    120a:	e8 c9 f7 ff ff       	call   9d8 <join>
+    120f:	83 c4 10             	add    $0x10,%esp
+    1212:	85 c0                	test   %eax,%eax
+    1214:	79 0a                	jns    1220 <thread_join+0x20>
+    free(*(char**)stack);
+  return pid;
+}
+    1216:	c9                   	leave
+    1217:	c3                   	ret
+    1218:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    121f:	90                   	nop
+    free(*(char**)stack);
+    1220:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1223:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1226:	83 ec 0c             	sub    $0xc,%esp
+    1229:	ff 32                	push   (%edx)
+    122b:	e8 f0 fd ff ff       	call   1020 <free>
+    1230:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1233:	83 c4 10             	add    $0x10,%esp
+}
+    1236:	c9                   	leave
+    1237:	c3                   	ret
@@ -12,6 +12,7 @@
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "iostat.h"
 
 #define SECTOR_SIZE   512
 #define IDE_BSY       0x80
@@ -31,6 +32,11 @@
 static struct spinlock idelock;
 static struct buf *idequeue;
 
+// Disk activity, in the order requests reach the disk.
+// Protected by idelock.
+static struct iostat iostat;
+static uint lastblock;
+
 static int havedisk1;
 static void idestart(struct buf*);
 
@@ -75,7 +81,7 @@ idestart(struct buf *b)
 {
   if(b == 0)
     panic("idestart");
-  if(b->blockno >= FSSIZE)
+  if(b->blockno >= FSSIZE + SWAPSIZE)
     panic("incorrect blockno");
   int sector_per_block =  BSIZE/SECTOR_SIZE;
   int sector = b->blockno * sector_per_block;
@@ -84,6 +90,16 @@ idestart(struct buf *b)
 
   if (sector_per_block > 7) panic("idestart");
 
+  if(b->flags & B_DIRTY)
+    iostat.nwrite++;
+  else
+    iostat.nread++;
+  if(b->blockno != lastblock + 1){
+    iostat.nseek++;
+    iostat.seekdist += b->blockno > lastblock ? b->blockno - lastblock : lastblock - b->blockno;
+  }
+  lastblock = b->blockno;
+
   idewait(0);
   outb(0x3f6, 0);  // generate interrupt
   outb(0x1f2, sector_per_block);  // number of sectors
@@ -166,3 +182,12 @@ iderw(struct buf *b)
 
   release(&idelock);
 }
+
+// Copy the disk activity counters into *st.
+void
+ideiostat(struct iostat *st)
+{
+  acquire(&idelock);
+  *st = iostat;
+  release(&idelock);
+}
@@ -0,0 +1,2257 @@
+
+_idlebench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+struct lockstat before[NCLASS], after[NCLASS];
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 20             	sub    $0x20,%esp
+  int nb, na, i, t;
+  uint nacq, ncont;
+
+  nb = lockstat(before, NCLASS);
+  14:	6a 40                	push   $0x40
+  16:	68 20 2c 00 00       	push   $0x2c20
+  1b:	e8 18 07 00 00       	call   738 <lockstat>
+  20:	89 c6                	mov    %eax,%esi
+  t = uptime();
+  22:	e8 61 06 00 00       	call   688 <uptime>
+  sleep(NTICK);
+  27:	c7 04 24 c8 00 00 00 	movl   $0xc8,(%esp)
+  t = uptime();
+  2e:	89 c3                	mov    %eax,%ebx
+  sleep(NTICK);
+  30:	e8 4b 06 00 00       	call   680 <sleep>
+  t = uptime() - t;
+  35:	e8 4e 06 00 00       	call   688 <uptime>
+  if(nb < 0 || (na = lockstat(after, NCLASS)) < 0){
+  3a:	83 c4 10             	add    $0x10,%esp
+  3d:	85 f6                	test   %esi,%esi
+  3f:	0f 88 9e 00 00 00    	js     e3 <main+0xe3>
+  45:	52                   	push   %edx
+  46:	89 c7                	mov    %eax,%edi
+  48:	52                   	push   %edx
+  49:	6a 40                	push   $0x40
+  4b:	68 20 22 00 00       	push   $0x2220
+  50:	e8 e3 06 00 00       	call   738 <lockstat>
+  55:	83 c4 10             	add    $0x10,%esp
+  58:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  5b:	85 c0                	test   %eax,%eax
+  5d:	0f 88 80 00 00 00    	js     e3 <main+0xe3>
+    printf(2, "idlebench: lockstat failed\n");
+    exit();
+  }
+  if(t == 0)
+  63:	29 df                	sub    %ebx,%edi
+  65:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  68:	0f 84 88 00 00 00    	je     f6 <main+0xf6>
+    t = 1;
+
+  printf(1, "idlebench: %d ticks idle\n", t);
+  6e:	50                   	push   %eax
+  for(i = 0; i < na; i++){
+  6f:	31 db                	xor    %ebx,%ebx
+  71:	31 ff                	xor    %edi,%edi
+  printf(1, "idlebench: %d ticks idle\n", t);
+  73:	ff 75 e0             	push   -0x20(%ebp)
+  76:	68 c4 0f 00 00       	push   $0xfc4
+  7b:	6a 01                	push   $0x1
+  7d:	e8 ee 0a 00 00       	call   b70 <printf>
+  for(i = 0; i < na; i++){
+  82:	83 c4 10             	add    $0x10,%esp
+  85:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  89:	74 53                	je     de <main+0xde>
+  8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  8f:	90                   	nop
+    nacq = after[i].nacquire - (i < nb ? before[i].nacquire : 0);
+  90:	8b 8b 30 22 00 00    	mov    0x2230(%ebx),%ecx
+    ncont = after[i].ncontend - (i < nb ? before[i].ncontend : 0);
+  96:	8b 83 34 22 00 00    	mov    0x2234(%ebx),%eax
+    nacq = after[i].nacquire - (i < nb ? before[i].nacquire : 0);
+  9c:	39 fe                	cmp    %edi,%esi
+  9e:	7e 0c                	jle    ac <main+0xac>
+  a0:	2b 8b 30 2c 00 00    	sub    0x2c30(%ebx),%ecx
+    ncont = after[i].ncontend - (i < nb ? before[i].ncontend : 0);
+  a6:	2b 83 34 2c 00 00    	sub    0x2c34(%ebx),%eax
+    if(nacq == 0)
+  ac:	85 c9                	test   %ecx,%ecx
+  ae:	74 23                	je     d3 <main+0xd3>
+      continue;
+    printf(1, "idlebench: %s: acquired %d (%d per tick), contended %d\n",
+  b0:	83 ec 08             	sub    $0x8,%esp
+  b3:	31 d2                	xor    %edx,%edx
+  b5:	50                   	push   %eax
+  b6:	89 c8                	mov    %ecx,%eax
+  b8:	f7 75 e0             	divl   -0x20(%ebp)
+  bb:	50                   	push   %eax
+           after[i].name, nacq, nacq / t, ncont);
+  bc:	8d 83 20 22 00 00    	lea    0x2220(%ebx),%eax
+    printf(1, "idlebench: %s: acquired %d (%d per tick), contended %d\n",
+  c2:	51                   	push   %ecx
+  c3:	50                   	push   %eax
+  c4:	68 e0 0f 00 00       	push   $0xfe0
+  c9:	6a 01                	push   $0x1
+  cb:	e8 a0 0a 00 00       	call   b70 <printf>
+  d0:	83 c4 20             	add    $0x20,%esp
+  for(i = 0; i < na; i++){
+  d3:	83 c7 01             	add    $0x1,%edi
+  d6:	83 c3 28             	add    $0x28,%ebx
+  d9:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  dc:	75 b2                	jne    90 <main+0x90>
+  }
+  exit();
+  de:	e8 fd 02 00 00       	call   3e0 <exit>
+    printf(2, "idlebench: lockstat failed\n");
+  e3:	51                   	push   %ecx
+  e4:	51                   	push   %ecx
+  e5:	68 a8 0f 00 00       	push   $0xfa8
+  ea:	6a 02                	push   $0x2
+  ec:	e8 7f 0a 00 00       	call   b70 <printf>
+    exit();
+  f1:	e8 ea 02 00 00       	call   3e0 <exit>
+    t = 1;
+  f6:	c7 45 e0 01 00 00 00 	movl   $0x1,-0x20(%ebp)
+  fd:	e9 6c ff ff ff       	jmp    6e <main+0x6e>
+ 102:	66 90                	xchg   %ax,%ax
+ 104:	66 90                	xchg   %ax,%ax
+ 106:	66 90                	xchg   %ax,%ax
+ 108:	66 90                	xchg   %ax,%ax
+ 10a:	66 90                	xchg   %ax,%ax
+ 10c:	66 90                	xchg   %ax,%ax
+ 10e:	66 90                	xchg   %ax,%ax
+
+00000110 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 110:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 111:	31 c0                	xor    %eax,%eax
+{
+ 113:	89 e5                	mov    %esp,%ebp
+ 115:	53                   	push   %ebx
+ 116:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 119:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 11c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 120:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 124:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 127:	83 c0 01             	add    $0x1,%eax
+ 12a:	84 d2                	test   %dl,%dl
+ 12c:	75 f2                	jne    120 <strcpy+0x10>
+    ;
+  return os;
+}
+ 12e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 131:	89 c8                	mov    %ecx,%eax
+ 133:	c9                   	leave
+ 134:	c3                   	ret
+ 135:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000140 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	53                   	push   %ebx
+ 144:	8b 55 08             	mov    0x8(%ebp),%edx
+ 147:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 14a:	0f b6 02             	movzbl (%edx),%eax
+ 14d:	84 c0                	test   %al,%al
+ 14f:	75 17                	jne    168 <strcmp+0x28>
+ 151:	eb 3a                	jmp    18d <strcmp+0x4d>
+ 153:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 157:	90                   	nop
+ 158:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 15c:	83 c2 01             	add    $0x1,%edx
+ 15f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 162:	84 c0                	test   %al,%al
+ 164:	74 1a                	je     180 <strcmp+0x40>
+    p++, q++;
+ 166:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 168:	0f b6 19             	movzbl (%ecx),%ebx
+ 16b:	38 c3                	cmp    %al,%bl
+ 16d:	74 e9                	je     158 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 16f:	29 d8                	sub    %ebx,%eax
+}
+ 171:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 174:	c9                   	leave
+ 175:	c3                   	ret
+ 176:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 180:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 184:	31 c0                	xor    %eax,%eax
+ 186:	29 d8                	sub    %ebx,%eax
+}
+ 188:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 18b:	c9                   	leave
+ 18c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 18d:	0f b6 19             	movzbl (%ecx),%ebx
+ 190:	31 c0                	xor    %eax,%eax
+ 192:	eb db                	jmp    16f <strcmp+0x2f>
+ 194:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 19b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 19f:	90                   	nop
+
+000001a0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1a6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1a9:	74 15                	je     1c0 <strlen+0x20>
+ 1ab:	31 c0                	xor    %eax,%eax
+ 1ad:	8d 76 00             	lea    0x0(%esi),%esi
+ 1b0:	83 c0 01             	add    $0x1,%eax
+ 1b3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1b7:	89 c1                	mov    %eax,%ecx
+ 1b9:	75 f5                	jne    1b0 <strlen+0x10>
+    ;
+  return n;
+}
+ 1bb:	89 c8                	mov    %ecx,%eax
+ 1bd:	5d                   	pop    %ebp
+ 1be:	c3                   	ret
+ 1bf:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 1c0:	31 c9                	xor    %ecx,%ecx
+}
+ 1c2:	5d                   	pop    %ebp
+ 1c3:	89 c8                	mov    %ecx,%eax
+ 1c5:	c3                   	ret
+ 1c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001d0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1d0:	55                   	push   %ebp
+ 1d1:	89 e5                	mov    %esp,%ebp
+ 1d3:	57                   	push   %edi
+ 1d4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1d7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1da:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1dd:	89 d7                	mov    %edx,%edi
+ 1df:	fc                   	cld
+ 1e0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1e2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1e5:	89 d0                	mov    %edx,%eax
+ 1e7:	c9                   	leave
+ 1e8:	c3                   	ret
+ 1e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001f0 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	56                   	push   %esi
+ 1f4:	53                   	push   %ebx
+ 1f5:	8b 75 10             	mov    0x10(%ebp),%esi
+ 1f8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1fb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+ 1fe:	85 f6                	test   %esi,%esi
+ 200:	74 2e                	je     230 <memcmp+0x40>
+ 202:	01 c6                	add    %eax,%esi
+ 204:	eb 14                	jmp    21a <memcmp+0x2a>
+ 206:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+ 210:	83 c0 01             	add    $0x1,%eax
+ 213:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+ 216:	39 f0                	cmp    %esi,%eax
+ 218:	74 16                	je     230 <memcmp+0x40>
+    if(*s1 != *s2)
+ 21a:	0f b6 0a             	movzbl (%edx),%ecx
+ 21d:	0f b6 18             	movzbl (%eax),%ebx
+ 220:	38 d9                	cmp    %bl,%cl
+ 222:	74 ec                	je     210 <memcmp+0x20>
+      return *s1 - *s2;
+ 224:	0f b6 c1             	movzbl %cl,%eax
+ 227:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+ 229:	5b                   	pop    %ebx
+ 22a:	5e                   	pop    %esi
+ 22b:	5d                   	pop    %ebp
+ 22c:	c3                   	ret
+ 22d:	8d 76 00             	lea    0x0(%esi),%esi
+ 230:	5b                   	pop    %ebx
+  return 0;
+ 231:	31 c0                	xor    %eax,%eax
+}
+ 233:	5e                   	pop    %esi
+ 234:	5d                   	pop    %ebp
+ 235:	c3                   	ret
+ 236:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000240 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	8b 45 08             	mov    0x8(%ebp),%eax
+ 246:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 24a:	0f b6 10             	movzbl (%eax),%edx
+ 24d:	84 d2                	test   %dl,%dl
+ 24f:	75 12                	jne    263 <strchr+0x23>
+ 251:	eb 1d                	jmp    270 <strchr+0x30>
+ 253:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 257:	90                   	nop
+ 258:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 25c:	83 c0 01             	add    $0x1,%eax
+ 25f:	84 d2                	test   %dl,%dl
+ 261:	74 0d                	je     270 <strchr+0x30>
+    if(*s == c)
+ 263:	38 d1                	cmp    %dl,%cl
+ 265:	75 f1                	jne    258 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 267:	5d                   	pop    %ebp
+ 268:	c3                   	ret
+ 269:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 270:	31 c0                	xor    %eax,%eax
+}
+ 272:	5d                   	pop    %ebp
+ 273:	c3                   	ret
+ 274:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 27f:	90                   	nop
+
+00000280 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	57                   	push   %edi
+ 284:	56                   	push   %esi
+int
+read(int fd, void *buf, int n)
+{
+  if(flushhook)
+    flushhook();
+  return _read(fd, buf, n);
+ 285:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 288:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 289:	31 db                	xor    %ebx,%ebx
+{
+ 28b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 28e:	eb 32                	jmp    2c2 <gets+0x42>
+  if(flushhook)
+ 290:	a1 20 36 00 00       	mov    0x3620,%eax
+ 295:	85 c0                	test   %eax,%eax
+ 297:	74 02                	je     29b <gets+0x1b>
+    flushhook();
+ 299:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+ 29b:	83 ec 04             	sub    $0x4,%esp
+ 29e:	6a 01                	push   $0x1
+ 2a0:	56                   	push   %esi
+ 2a1:	6a 00                	push   $0x0
+ 2a3:	e8 60 03 00 00       	call   608 <_read>
+    if(cc < 1)
+ 2a8:	83 c4 10             	add    $0x10,%esp
+ 2ab:	85 c0                	test   %eax,%eax
+ 2ad:	7e 1d                	jle    2cc <gets+0x4c>
+    buf[i++] = c;
+ 2af:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 2b3:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2b6:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 2ba:	3c 0a                	cmp    $0xa,%al
+ 2bc:	74 10                	je     2ce <gets+0x4e>
+ 2be:	3c 0d                	cmp    $0xd,%al
+ 2c0:	74 0c                	je     2ce <gets+0x4e>
+  for(i=0; i+1 < max; ){
+ 2c2:	89 df                	mov    %ebx,%edi
+ 2c4:	83 c3 01             	add    $0x1,%ebx
+ 2c7:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 2ca:	7c c4                	jl     290 <gets+0x10>
+ 2cc:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+ 2ce:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2d1:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+ 2d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2d8:	5b                   	pop    %ebx
+ 2d9:	5e                   	pop    %esi
+ 2da:	5f                   	pop    %edi
+ 2db:	5d                   	pop    %ebp
+ 2dc:	c3                   	ret
+ 2dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002e0 <stat>:
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	56                   	push   %esi
+ 2e4:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+ 2e5:	83 ec 08             	sub    $0x8,%esp
+ 2e8:	6a 00                	push   $0x0
+ 2ea:	ff 75 08             	push   0x8(%ebp)
+ 2ed:	e8 3e 03 00 00       	call   630 <open>
+  if(fd < 0)
+ 2f2:	83 c4 10             	add    $0x10,%esp
+ 2f5:	85 c0                	test   %eax,%eax
+ 2f7:	78 37                	js     330 <stat+0x50>
+  r = fstat(fd, st);
+ 2f9:	83 ec 08             	sub    $0x8,%esp
+ 2fc:	ff 75 0c             	push   0xc(%ebp)
+ 2ff:	89 c3                	mov    %eax,%ebx
+ 301:	50                   	push   %eax
+ 302:	e8 41 03 00 00       	call   648 <fstat>
+}
+
+int
+close(int fd)
+{
+  if(flushhook)
+ 307:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+ 30a:	89 c6                	mov    %eax,%esi
+  if(flushhook)
+ 30c:	a1 20 36 00 00       	mov    0x3620,%eax
+ 311:	85 c0                	test   %eax,%eax
+ 313:	74 02                	je     317 <stat+0x37>
+    flushhook();
+ 315:	ff d0                	call   *%eax
+  return _close(fd);
+ 317:	83 ec 0c             	sub    $0xc,%esp
+ 31a:	53                   	push   %ebx
+ 31b:	e8 f8 02 00 00       	call   618 <_close>
+ 320:	83 c4 10             	add    $0x10,%esp
+}
+ 323:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 326:	89 f0                	mov    %esi,%eax
+ 328:	5b                   	pop    %ebx
+ 329:	5e                   	pop    %esi
+ 32a:	5d                   	pop    %ebp
+ 32b:	c3                   	ret
+ 32c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+ 330:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 335:	eb ec                	jmp    323 <stat+0x43>
+ 337:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33e:	66 90                	xchg   %ax,%ax
+
+00000340 <atoi>:
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	53                   	push   %ebx
+ 344:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+ 347:	0f be 02             	movsbl (%edx),%eax
+ 34a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 34d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 350:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 355:	77 1e                	ja     375 <atoi+0x35>
+ 357:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 35e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 360:	83 c2 01             	add    $0x1,%edx
+ 363:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 366:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 36a:	0f be 02             	movsbl (%edx),%eax
+ 36d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 370:	80 fb 09             	cmp    $0x9,%bl
+ 373:	76 eb                	jbe    360 <atoi+0x20>
+}
+ 375:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 378:	89 c8                	mov    %ecx,%eax
+ 37a:	c9                   	leave
+ 37b:	c3                   	ret
+ 37c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000380 <memmove>:
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+ 383:	57                   	push   %edi
+ 384:	56                   	push   %esi
+ 385:	8b 45 10             	mov    0x10(%ebp),%eax
+ 388:	8b 55 08             	mov    0x8(%ebp),%edx
+ 38b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+ 38e:	85 c0                	test   %eax,%eax
+ 390:	7e 13                	jle    3a5 <memmove+0x25>
+ 392:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 394:	89 d7                	mov    %edx,%edi
+ 396:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 3a0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 3a1:	39 f8                	cmp    %edi,%eax
+ 3a3:	75 fb                	jne    3a0 <memmove+0x20>
+}
+ 3a5:	5e                   	pop    %esi
+ 3a6:	89 d0                	mov    %edx,%eax
+ 3a8:	5f                   	pop    %edi
+ 3a9:	5d                   	pop    %ebp
+ 3aa:	c3                   	ret
+ 3ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3af:	90                   	nop
+
+000003b0 <fork>:
+  if(flushhook)
+ 3b0:	a1 20 36 00 00       	mov    0x3620,%eax
+ 3b5:	85 c0                	test   %eax,%eax
+ 3b7:	74 17                	je     3d0 <fork+0x20>
+{
+ 3b9:	55                   	push   %ebp
+ 3ba:	89 e5                	mov    %esp,%ebp
+ 3bc:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+ 3bf:	ff d0                	call   *%eax
+}
+ 3c1:	c9                   	leave
+  return _fork();
+ 3c2:	e9 21 02 00 00       	jmp    5e8 <_fork>
+ 3c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ce:	66 90                	xchg   %ax,%ax
+ 3d0:	e9 13 02 00 00       	jmp    5e8 <_fork>
+ 3d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003e0 <exit>:
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+ 3e6:	a1 20 36 00 00       	mov    0x3620,%eax
+ 3eb:	85 c0                	test   %eax,%eax
+ 3ed:	74 02                	je     3f1 <exit+0x11>
+    flushhook();
+ 3ef:	ff d0                	call   *%eax
+  _exit();
+ 3f1:	e8 fa 01 00 00       	call   5f0 <_exit>
+ 3f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000400 <exec>:
+{
+ 400:	55                   	push   %ebp
+  if(flushhook)
+ 401:	a1 20 36 00 00       	mov    0x3620,%eax
+{
+ 406:	89 e5                	mov    %esp,%ebp
+ 408:	56                   	push   %esi
+ 409:	53                   	push   %ebx
+ 40a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 40d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+ 410:	85 c0                	test   %eax,%eax
+ 412:	74 02                	je     416 <exec+0x16>
+    flushhook();
+ 414:	ff d0                	call   *%eax
+  return _exec(path, argv);
+ 416:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 419:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 41c:	5b                   	pop    %ebx
+ 41d:	5e                   	pop    %esi
+ 41e:	5d                   	pop    %ebp
+  return _exec(path, argv);
+ 41f:	e9 04 02 00 00       	jmp    628 <_exec>
+ 424:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 42b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 42f:	90                   	nop
+
+00000430 <read>:
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	57                   	push   %edi
+ 434:	56                   	push   %esi
+ 435:	53                   	push   %ebx
+ 436:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+ 439:	a1 20 36 00 00       	mov    0x3620,%eax
+{
+ 43e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 441:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 444:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+ 447:	85 c0                	test   %eax,%eax
+ 449:	74 02                	je     44d <read+0x1d>
+    flushhook();
+ 44b:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+ 44d:	89 7d 10             	mov    %edi,0x10(%ebp)
+ 450:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 453:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 456:	83 c4 0c             	add    $0xc,%esp
+ 459:	5b                   	pop    %ebx
+ 45a:	5e                   	pop    %esi
+ 45b:	5f                   	pop    %edi
+ 45c:	5d                   	pop    %ebp
+  return _read(fd, buf, n);
+ 45d:	e9 a6 01 00 00       	jmp    608 <_read>
+ 462:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 469:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000470 <readv>:
+{
+ 470:	55                   	push   %ebp
+ 471:	89 e5                	mov    %esp,%ebp
+ 473:	57                   	push   %edi
+ 474:	56                   	push   %esi
+ 475:	53                   	push   %ebx
+ 476:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+ 479:	a1 20 36 00 00       	mov    0x3620,%eax
+{
+ 47e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 481:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 484:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+ 487:	85 c0                	test   %eax,%eax
+ 489:	74 02                	je     48d <readv+0x1d>
+    flushhook();
+ 48b:	ff d0                	call   *%eax
+  return _readv(fd, iov, cnt);
+ 48d:	89 7d 10             	mov    %edi,0x10(%ebp)
+ 490:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 493:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 496:	83 c4 0c             	add    $0xc,%esp
+ 499:	5b                   	pop    %ebx
+ 49a:	5e                   	pop    %esi
+ 49b:	5f                   	pop    %edi
+ 49c:	5d                   	pop    %ebp
+  return _readv(fd, iov, cnt);
+ 49d:	e9 76 02 00 00       	jmp    718 <_readv>
+ 4a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004b0 <write>:
+{
+ 4b0:	55                   	push   %ebp
+ 4b1:	89 e5                	mov    %esp,%ebp
+ 4b3:	57                   	push   %edi
+ 4b4:	56                   	push   %esi
+ 4b5:	53                   	push   %ebx
+ 4b6:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+ 4b9:	a1 20 36 00 00       	mov    0x3620,%eax
+{
+ 4be:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 4c1:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 4c4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+ 4c7:	85 c0                	test   %eax,%eax
+ 4c9:	74 02                	je     4cd <write+0x1d>
+    flushhook();
+ 4cb:	ff d0                	call   *%eax
+  return _write(fd, buf, n);
+ 4cd:	89 7d 10             	mov    %edi,0x10(%ebp)
+ 4d0:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 4d3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 4d6:	83 c4 0c             	add    $0xc,%esp
+ 4d9:	5b                   	pop    %ebx
+ 4da:	5e                   	pop    %esi
+ 4db:	5f                   	pop    %edi
+ 4dc:	5d                   	pop    %ebp
+  return _write(fd, buf, n);
+ 4dd:	e9 2e 01 00 00       	jmp    610 <_write>
+ 4e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004f0 <writev>:
+{
+ 4f0:	55                   	push   %ebp
+ 4f1:	89 e5                	mov    %esp,%ebp
+ 4f3:	57                   	push   %edi
+ 4f4:	56                   	push   %esi
+ 4f5:	53                   	push   %ebx
+ 4f6:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+ 4f9:	a1 20 36 00 00       	mov    0x3620,%eax
+{
+ 4fe:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 501:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 504:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+ 507:	85 c0                	test   %eax,%eax
+ 509:	74 02                	je     50d <writev+0x1d>
+    flushhook();
+ 50b:	ff d0                	call   *%eax
+  return _writev(fd, iov, cnt);
+ 50d:	89 7d 10             	mov    %edi,0x10(%ebp)
+ 510:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 513:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 516:	83 c4 0c             	add    $0xc,%esp
+ 519:	5b                   	pop    %ebx
+ 51a:	5e                   	pop    %esi
+ 51b:	5f                   	pop    %edi
+ 51c:	5d                   	pop    %ebp
+  return _writev(fd, iov, cnt);
+ 51d:	e9 fe 01 00 00       	jmp    720 <_writev>
+ 522:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 529:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000530 <close>:
+{
+ 530:	55                   	push   %ebp
+ 531:	89 e5                	mov    %esp,%ebp
+ 533:	53                   	push   %ebx
+ 534:	83 ec 04             	sub    $0x4,%esp
+  if(flushhook)
+ 537:	a1 20 36 00 00       	mov    0x3620,%eax
+{
+ 53c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(flushhook)
+ 53f:	85 c0                	test   %eax,%eax
+ 541:	74 02                	je     545 <close+0x15>
+    flushhook();
+ 543:	ff d0                	call   *%eax
+  return _close(fd);
+ 545:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 548:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 54b:	c9                   	leave
+  return _close(fd);
+ 54c:	e9 c7 00 00 00       	jmp    618 <_close>
+ 551:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 558:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 55f:	90                   	nop
+
+00000560 <umtxinit>:
+// process that finds the mutex held enters the kernel, to sleep
+// in futexwait() until the holder's umtxunlock() wakes it.
+
+void
+umtxinit(struct umutex *m)
+{
+ 560:	55                   	push   %ebp
+ 561:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 563:	8b 45 08             	mov    0x8(%ebp),%eax
+ 566:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 56c:	5d                   	pop    %ebp
+ 56d:	c3                   	ret
+ 56e:	66 90                	xchg   %ax,%ax
+
+00000570 <umtxlock>:
+
+void
+umtxlock(struct umutex *m)
+{
+ 570:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 571:	b8 01 00 00 00       	mov    $0x1,%eax
+ 576:	89 e5                	mov    %esp,%ebp
+ 578:	56                   	push   %esi
+ 579:	53                   	push   %ebx
+ 57a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 57d:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 1) == 0)
+ 580:	85 c0                	test   %eax,%eax
+ 582:	74 2b                	je     5af <umtxlock+0x3f>
+ 584:	b8 02 00 00 00       	mov    $0x2,%eax
+ 589:	f0 87 03             	lock xchg %eax,(%ebx)
+    return;
+  // Mark the mutex contended, so that its holder
+  // wakes a waiter on release, and wait.
+  while(xchg(&m->state, 2) != 0)
+ 58c:	85 c0                	test   %eax,%eax
+ 58e:	74 1f                	je     5af <umtxlock+0x3f>
+ 590:	be 02 00 00 00       	mov    $0x2,%esi
+ 595:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwait(&m->state, 2);
+ 598:	83 ec 08             	sub    $0x8,%esp
+ 59b:	6a 02                	push   $0x2
+ 59d:	53                   	push   %ebx
+ 59e:	e8 85 01 00 00       	call   728 <futexwait>
+ 5a3:	89 f0                	mov    %esi,%eax
+ 5a5:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+ 5a8:	83 c4 10             	add    $0x10,%esp
+ 5ab:	85 c0                	test   %eax,%eax
+ 5ad:	75 e9                	jne    598 <umtxlock+0x28>
+}
+ 5af:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 5b2:	5b                   	pop    %ebx
+ 5b3:	5e                   	pop    %esi
+ 5b4:	5d                   	pop    %ebp
+ 5b5:	c3                   	ret
+ 5b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000005c0 <umtxunlock>:
+
+void
+umtxunlock(struct umutex *m)
+{
+ 5c0:	55                   	push   %ebp
+ 5c1:	31 c0                	xor    %eax,%eax
+ 5c3:	89 e5                	mov    %esp,%ebp
+ 5c5:	83 ec 08             	sub    $0x8,%esp
+ 5c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 5cb:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 5ce:	83 f8 02             	cmp    $0x2,%eax
+ 5d1:	74 05                	je     5d8 <umtxunlock+0x18>
+    futexwake(&m->state, 1);
+}
+ 5d3:	c9                   	leave
+ 5d4:	c3                   	ret
+ 5d5:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwake(&m->state, 1);
+ 5d8:	83 ec 08             	sub    $0x8,%esp
+ 5db:	6a 01                	push   $0x1
+ 5dd:	52                   	push   %edx
+ 5de:	e8 4d 01 00 00       	call   730 <futexwake>
+ 5e3:	83 c4 10             	add    $0x10,%esp
+}
+ 5e6:	c9                   	leave
+ 5e7:	c3                   	ret
+
+000005e8 <_fork>:
+  _ ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+ 5e8:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5ed:	cd 40                	int    $0x40
+ 5ef:	c3                   	ret
+
+000005f0 <_exit>:
+RAWSYSCALL(exit)
+ 5f0:	b8 02 00 00 00       	mov    $0x2,%eax
+ 5f5:	cd 40                	int    $0x40
+ 5f7:	c3                   	ret
+
+000005f8 <wait>:
+SYSCALL(wait)
+ 5f8:	b8 03 00 00 00       	mov    $0x3,%eax
+ 5fd:	cd 40                	int    $0x40
+ 5ff:	c3                   	ret
+
+00000600 <pipe>:
+SYSCALL(pipe)
+ 600:	b8 04 00 00 00       	mov    $0x4,%eax
+ 605:	cd 40                	int    $0x40
+ 607:	c3                   	ret
+
+00000608 <_read>:
+RAWSYSCALL(read)
+ 608:	b8 05 00 00 00       	mov    $0x5,%eax
+ 60d:	cd 40                	int    $0x40
+ 60f:	c3                   	ret
+
+00000610 <_write>:
+RAWSYSCALL(write)
+ 610:	b8 10 00 00 00       	mov    $0x10,%eax
+ 615:	cd 40                	int    $0x40
+ 617:	c3                   	ret
+
+00000618 <_close>:
+RAWSYSCALL(close)
+ 618:	b8 15 00 00 00       	mov    $0x15,%eax
+ 61d:	cd 40                	int    $0x40
+ 61f:	c3                   	ret
+
+00000620 <kill>:
+SYSCALL(kill)
+ 620:	b8 06 00 00 00       	mov    $0x6,%eax
+ 625:	cd 40                	int    $0x40
+ 627:	c3                   	ret
+
+00000628 <_exec>:
+RAWSYSCALL(exec)
+ 628:	b8 07 00 00 00       	mov    $0x7,%eax
+ 62d:	cd 40                	int    $0x40
+ 62f:	c3                   	ret
+
+00000630 <open>:
+SYSCALL(open)
+ 630:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 635:	cd 40                	int    $0x40
+ 637:	c3                   	ret
+
+00000638 <mknod>:
+SYSCALL(mknod)
+ 638:	b8 11 00 00 00       	mov    $0x11,%eax
+ 63d:	cd 40                	int    $0x40
+ 63f:	c3                   	ret
+
+00000640 <unlink>:
+SYSCALL(unlink)
+ 640:	b8 12 00 00 00       	mov    $0x12,%eax
+ 645:	cd 40                	int    $0x40
+ 647:	c3                   	ret
+
+00000648 <fstat>:
+SYSCALL(fstat)
+ 648:	b8 08 00 00 00       	mov    $0x8,%eax
+ 64d:	cd 40                	int    $0x40
+ 64f:	c3                   	ret
+
+00000650 <link>:
+SYSCALL(link)
+ 650:	b8 13 00 00 00       	mov    $0x13,%eax
+ 655:	cd 40                	int    $0x40
+ 657:	c3                   	ret
+
+00000658 <mkdir>:
+SYSCALL(mkdir)
+ 658:	b8 14 00 00 00       	mov    $0x14,%eax
+ 65d:	cd 40                	int    $0x40
+ 65f:	c3                   	ret
+
+00000660 <chdir>:
+SYSCALL(chdir)
+ 660:	b8 09 00 00 00       	mov    $0x9,%eax
+ 665:	cd 40                	int    $0x40
+ 667:	c3                   	ret
+
+00000668 <dup>:
+SYSCALL(dup)
+ 668:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 66d:	cd 40                	int    $0x40
+ 66f:	c3                   	ret
+
+00000670 <getpid>:
+SYSCALL(getpid)
+ 670:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 675:	cd 40                	int    $0x40
+ 677:	c3                   	ret
+
+00000678 <sbrk>:
+SYSCALL(sbrk)
+ 678:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 67d:	cd 40                	int    $0x40
+ 67f:	c3                   	ret
+
+00000680 <sleep>:
+SYSCALL(sleep)
+ 680:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 685:	cd 40                	int    $0x40
+ 687:	c3                   	ret
+
+00000688 <uptime>:
+SYSCALL(uptime)
+ 688:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 68d:	cd 40                	int    $0x40
+ 68f:	c3                   	ret
+
+00000690 <wolfie>:
+SYSCALL(wolfie)
+ 690:	b8 16 00 00 00       	mov    $0x16,%eax
+ 695:	cd 40                	int    $0x40
+ 697:	c3                   	ret
+
+00000698 <nice>:
+SYSCALL(nice)
+ 698:	b8 17 00 00 00       	mov    $0x17,%eax
+ 69d:	cd 40                	int    $0x40
+ 69f:	c3                   	ret
+
+000006a0 <mtxget>:
+SYSCALL(mtxget)
+ 6a0:	b8 18 00 00 00       	mov    $0x18,%eax
+ 6a5:	cd 40                	int    $0x40
+ 6a7:	c3                   	ret
+
+000006a8 <mtxrel>:
+SYSCALL(mtxrel)
+ 6a8:	b8 19 00 00 00       	mov    $0x19,%eax
+ 6ad:	cd 40                	int    $0x40
+ 6af:	c3                   	ret
+
+000006b0 <mtxacq>:
+SYSCALL(mtxacq)
+ 6b0:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 6b5:	cd 40                	int    $0x40
+ 6b7:	c3                   	ret
+
+000006b8 <mtxdel>:
+SYSCALL(mtxdel)
+ 6b8:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 6bd:	cd 40                	int    $0x40
+ 6bf:	c3                   	ret
+
+000006c0 <iostat>:
+SYSCALL(iostat)
+ 6c0:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 6c5:	cd 40                	int    $0x40
+ 6c7:	c3                   	ret
+
+000006c8 <mmap>:
+SYSCALL(mmap)
+ 6c8:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 6cd:	cd 40                	int    $0x40
+ 6cf:	c3                   	ret
+
+000006d0 <munmap>:
+SYSCALL(munmap)
+ 6d0:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 6d5:	cd 40                	int    $0x40
+ 6d7:	c3                   	ret
+
+000006d8 <shmget>:
+SYSCALL(shmget)
+ 6d8:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 6dd:	cd 40                	int    $0x40
+ 6df:	c3                   	ret
+
+000006e0 <shmat>:
+SYSCALL(shmat)
+ 6e0:	b8 20 00 00 00       	mov    $0x20,%eax
+ 6e5:	cd 40                	int    $0x40
+ 6e7:	c3                   	ret
+
+000006e8 <shmdt>:
+SYSCALL(shmdt)
+ 6e8:	b8 21 00 00 00       	mov    $0x21,%eax
+ 6ed:	cd 40                	int    $0x40
+ 6ef:	c3                   	ret
+
+000006f0 <shmdel>:
+SYSCALL(shmdel)
+ 6f0:	b8 22 00 00 00       	mov    $0x22,%eax
+ 6f5:	cd 40                	int    $0x40
+ 6f7:	c3                   	ret
+
+000006f8 <syscount>:
+SYSCALL(syscount)
+ 6f8:	b8 23 00 00 00       	mov    $0x23,%eax
+ 6fd:	cd 40                	int    $0x40
+ 6ff:	c3                   	ret
+
+00000700 <splice>:
+SYSCALL(splice)
+ 700:	b8 24 00 00 00       	mov    $0x24,%eax
+ 705:	cd 40                	int    $0x40
+ 707:	c3                   	ret
+
+00000708 <tee>:
+SYSCALL(tee)
+ 708:	b8 25 00 00 00       	mov    $0x25,%eax
+ 70d:	cd 40                	int    $0x40
+ 70f:	c3                   	ret
+
+00000710 <sendfile>:
+SYSCALL(sendfile)
+ 710:	b8 26 00 00 00       	mov    $0x26,%eax
+ 715:	cd 40                	int    $0x40
+ 717:	c3                   	ret
+
+00000718 <_readv>:
+RAWSYSCALL(readv)
+ 718:	b8 27 00 00 00       	mov    $0x27,%eax
+ 71d:	cd 40                	int    $0x40
+ 71f:	c3                   	ret
+
+00000720 <_writev>:
+RAWSYSCALL(writev)
+ 720:	b8 28 00 00 00       	mov    $0x28,%eax
+ 725:	cd 40                	int    $0x40
+ 727:	c3                   	ret
+
+00000728 <futexwait>:
+SYSCALL(futexwait)
+ 728:	b8 29 00 00 00       	mov    $0x29,%eax
+ 72d:	cd 40                	int    $0x40
+ 72f:	c3                   	ret
+
+00000730 <futexwake>:
+SYSCALL(futexwake)
+ 730:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 735:	cd 40                	int    $0x40
+ 737:	c3                   	ret
+
+00000738 <lockstat>:
+SYSCALL(lockstat)
+ 738:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 73d:	cd 40                	int    $0x40
+ 73f:	c3                   	ret
+
+00000740 <clone>:
+SYSCALL(clone)
+ 740:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 745:	cd 40                	int    $0x40
+ 747:	c3                   	ret
+
+00000748 <join>:
+SYSCALL(join)
+ 748:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 74d:	cd 40                	int    $0x40
+ 74f:	c3                   	ret
+
+00000750 <stacklimit>:
+SYSCALL(stacklimit)
+ 750:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 755:	cd 40                	int    $0x40
+ 757:	c3                   	ret
+ 758:	66 90                	xchg   %ax,%ax
+ 75a:	66 90                	xchg   %ax,%ax
+ 75c:	66 90                	xchg   %ax,%ax
+ 75e:	66 90                	xchg   %ax,%ax
+
+00000760 <flushall>:
+  b->n = 0;
+}
+
+static void
+flushall(void)
+{
+ 760:	55                   	push   %ebp
+ 761:	89 e5                	mov    %esp,%ebp
+ 763:	83 ec 14             	sub    $0x14,%esp
+  umtxlock(&stdoutlock);
+ 766:	68 24 36 00 00       	push   $0x3624
+ 76b:	e8 00 fe ff ff       	call   570 <umtxlock>
+  if(b->n > 0)
+ 770:	a1 08 20 00 00       	mov    0x2008,%eax
+ 775:	83 c4 10             	add    $0x10,%esp
+ 778:	85 c0                	test   %eax,%eax
+ 77a:	7e 17                	jle    793 <flushall+0x33>
+    _write(b->fd, b->buf, b->n);
+ 77c:	83 ec 04             	sub    $0x4,%esp
+ 77f:	50                   	push   %eax
+ 780:	68 0c 20 00 00       	push   $0x200c
+ 785:	ff 35 00 20 00 00    	push   0x2000
+ 78b:	e8 80 fe ff ff       	call   610 <_write>
+ 790:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+ 793:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+ 79a:	00 00 00 
+  flush(&stdout);
+  umtxunlock(&stdoutlock);
+ 79d:	83 ec 0c             	sub    $0xc,%esp
+ 7a0:	68 24 36 00 00       	push   $0x3624
+ 7a5:	e8 16 fe ff ff       	call   5c0 <umtxunlock>
+}
+ 7aa:	83 c4 10             	add    $0x10,%esp
+ 7ad:	c9                   	leave
+ 7ae:	c3                   	ret
+ 7af:	90                   	nop
+
+000007b0 <printint>:
+    flush(b);
+}
+
+static void
+printint(struct outbuf *b, int xx, int base, int sgn)
+{
+ 7b0:	55                   	push   %ebp
+ 7b1:	89 e5                	mov    %esp,%ebp
+ 7b3:	57                   	push   %edi
+ 7b4:	89 cf                	mov    %ecx,%edi
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 7b6:	89 d1                	mov    %edx,%ecx
+{
+ 7b8:	56                   	push   %esi
+ 7b9:	53                   	push   %ebx
+ 7ba:	89 c3                	mov    %eax,%ebx
+ 7bc:	83 ec 2c             	sub    $0x2c,%esp
+  if(sgn && xx < 0){
+ 7bf:	85 d2                	test   %edx,%edx
+ 7c1:	0f 89 b9 00 00 00    	jns    880 <printint+0xd0>
+ 7c7:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 7cb:	0f 84 af 00 00 00    	je     880 <printint+0xd0>
+    x = -xx;
+ 7d1:	f7 d9                	neg    %ecx
+    neg = 1;
+ 7d3:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 7d8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 7db:	31 f6                	xor    %esi,%esi
+ 7dd:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 7e0:	89 c8                	mov    %ecx,%eax
+ 7e2:	31 d2                	xor    %edx,%edx
+ 7e4:	89 f3                	mov    %esi,%ebx
+ 7e6:	f7 f7                	div    %edi
+ 7e8:	8d 76 01             	lea    0x1(%esi),%esi
+ 7eb:	0f b6 92 24 14 00 00 	movzbl 0x1424(%edx),%edx
+ 7f2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 7f6:	89 ca                	mov    %ecx,%edx
+ 7f8:	89 c1                	mov    %eax,%ecx
+ 7fa:	39 fa                	cmp    %edi,%edx
+ 7fc:	73 e2                	jae    7e0 <printint+0x30>
+  if(neg)
+ 7fe:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 801:	89 d9                	mov    %ebx,%ecx
+ 803:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 806:	85 c0                	test   %eax,%eax
+ 808:	74 07                	je     811 <printint+0x61>
+    buf[i++] = '-';
+ 80a:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 80f:	89 f1                	mov    %esi,%ecx
+ 811:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 814:	89 cf                	mov    %ecx,%edi
+ 816:	01 f7                	add    %esi,%edi
+ 818:	eb 1a                	jmp    834 <printint+0x84>
+ 81a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    *b->str++ = c;
+ 820:	8d 48 01             	lea    0x1(%eax),%ecx
+ 823:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+ 829:	88 10                	mov    %dl,(%eax)
+
+  while(--i >= 0)
+ 82b:	8d 47 ff             	lea    -0x1(%edi),%eax
+ 82e:	39 fe                	cmp    %edi,%esi
+ 830:	74 40                	je     872 <printint+0xc2>
+ 832:	89 c7                	mov    %eax,%edi
+  if(b->str){
+ 834:	8b 83 0c 02 00 00    	mov    0x20c(%ebx),%eax
+    putc(b, buf[i]);
+ 83a:	0f b6 17             	movzbl (%edi),%edx
+  if(b->str){
+ 83d:	85 c0                	test   %eax,%eax
+ 83f:	75 df                	jne    820 <printint+0x70>
+  b->buf[b->n++] = c;
+ 841:	8b 4b 08             	mov    0x8(%ebx),%ecx
+ 844:	8d 41 01             	lea    0x1(%ecx),%eax
+ 847:	89 43 08             	mov    %eax,0x8(%ebx)
+ 84a:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+ 84e:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 853:	74 3b                	je     890 <printint+0xe0>
+ 855:	80 fa 0a             	cmp    $0xa,%dl
+ 858:	75 d1                	jne    82b <printint+0x7b>
+ 85a:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+ 85e:	75 cb                	jne    82b <printint+0x7b>
+  if(b->n > 0)
+ 860:	85 c0                	test   %eax,%eax
+ 862:	7f 2c                	jg     890 <printint+0xe0>
+  b->n = 0;
+ 864:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  while(--i >= 0)
+ 86b:	8d 47 ff             	lea    -0x1(%edi),%eax
+ 86e:	39 fe                	cmp    %edi,%esi
+ 870:	75 c0                	jne    832 <printint+0x82>
+}
+ 872:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 875:	5b                   	pop    %ebx
+ 876:	5e                   	pop    %esi
+ 877:	5f                   	pop    %edi
+ 878:	5d                   	pop    %ebp
+ 879:	c3                   	ret
+ 87a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  neg = 0;
+ 880:	31 c0                	xor    %eax,%eax
+ 882:	e9 51 ff ff ff       	jmp    7d8 <printint+0x28>
+ 887:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 88e:	66 90                	xchg   %ax,%ax
+    _write(b->fd, b->buf, b->n);
+ 890:	83 ec 04             	sub    $0x4,%esp
+ 893:	50                   	push   %eax
+ 894:	8d 43 0c             	lea    0xc(%ebx),%eax
+ 897:	50                   	push   %eax
+ 898:	ff 33                	push   (%ebx)
+ 89a:	e8 71 fd ff ff       	call   610 <_write>
+ 89f:	83 c4 10             	add    $0x10,%esp
+ 8a2:	eb c0                	jmp    864 <printint+0xb4>
+ 8a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8af:	90                   	nop
+
+000008b0 <putc>:
+{
+ 8b0:	55                   	push   %ebp
+ 8b1:	89 e5                	mov    %esp,%ebp
+ 8b3:	53                   	push   %ebx
+ 8b4:	89 c3                	mov    %eax,%ebx
+ 8b6:	83 ec 04             	sub    $0x4,%esp
+  if(b->str){
+ 8b9:	8b 80 0c 02 00 00    	mov    0x20c(%eax),%eax
+ 8bf:	85 c0                	test   %eax,%eax
+ 8c1:	74 15                	je     8d8 <putc+0x28>
+    *b->str++ = c;
+ 8c3:	8d 48 01             	lea    0x1(%eax),%ecx
+ 8c6:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+ 8cc:	88 10                	mov    %dl,(%eax)
+}
+ 8ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 8d1:	c9                   	leave
+ 8d2:	c3                   	ret
+ 8d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8d7:	90                   	nop
+  b->buf[b->n++] = c;
+ 8d8:	8b 4b 08             	mov    0x8(%ebx),%ecx
+ 8db:	8d 41 01             	lea    0x1(%ecx),%eax
+ 8de:	89 43 08             	mov    %eax,0x8(%ebx)
+ 8e1:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+ 8e5:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 8ea:	74 14                	je     900 <putc+0x50>
+ 8ec:	80 fa 0a             	cmp    $0xa,%dl
+ 8ef:	75 dd                	jne    8ce <putc+0x1e>
+ 8f1:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+ 8f5:	75 d7                	jne    8ce <putc+0x1e>
+  if(b->n > 0)
+ 8f7:	85 c0                	test   %eax,%eax
+ 8f9:	7e 17                	jle    912 <putc+0x62>
+ 8fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8ff:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+ 900:	83 ec 04             	sub    $0x4,%esp
+ 903:	50                   	push   %eax
+ 904:	8d 43 0c             	lea    0xc(%ebx),%eax
+ 907:	50                   	push   %eax
+ 908:	ff 33                	push   (%ebx)
+ 90a:	e8 01 fd ff ff       	call   610 <_write>
+ 90f:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+ 912:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+ 919:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 91c:	c9                   	leave
+ 91d:	c3                   	ret
+ 91e:	66 90                	xchg   %ax,%ax
+
+00000920 <format>:
+
+// Format fmt and the arguments at ap into b.
+// Only understands %d, %x, %p, %s, %c.
+static void
+format(struct outbuf *b, const char *fmt, uint *ap)
+{
+ 920:	55                   	push   %ebp
+ 921:	89 e5                	mov    %esp,%ebp
+ 923:	57                   	push   %edi
+ 924:	89 c7                	mov    %eax,%edi
+ 926:	56                   	push   %esi
+ 927:	53                   	push   %ebx
+ 928:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+ 92b:	0f b6 02             	movzbl (%edx),%eax
+{
+ 92e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 931:	84 c0                	test   %al,%al
+ 933:	74 5a                	je     98f <format+0x6f>
+ 935:	8d 5a 01             	lea    0x1(%edx),%ebx
+ 938:	31 f6                	xor    %esi,%esi
+ 93a:	eb 1c                	jmp    958 <format+0x38>
+ 93c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+ 940:	83 f8 25             	cmp    $0x25,%eax
+ 943:	74 3b                	je     980 <format+0x60>
+        state = '%';
+      } else {
+        putc(b, c);
+ 945:	89 ca                	mov    %ecx,%edx
+ 947:	89 f8                	mov    %edi,%eax
+ 949:	e8 62 ff ff ff       	call   8b0 <putc>
+  for(i = 0; fmt[i]; i++){
+ 94e:	0f b6 03             	movzbl (%ebx),%eax
+ 951:	83 c3 01             	add    $0x1,%ebx
+ 954:	84 c0                	test   %al,%al
+ 956:	74 37                	je     98f <format+0x6f>
+    c = fmt[i] & 0xff;
+ 958:	0f be c8             	movsbl %al,%ecx
+ 95b:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 95e:	85 f6                	test   %esi,%esi
+ 960:	74 de                	je     940 <format+0x20>
+      }
+    } else if(state == '%'){
+ 962:	83 fe 25             	cmp    $0x25,%esi
+ 965:	75 e7                	jne    94e <format+0x2e>
+      if(c == 'd'){
+ 967:	83 f8 25             	cmp    $0x25,%eax
+ 96a:	74 46                	je     9b2 <format+0x92>
+ 96c:	83 e8 63             	sub    $0x63,%eax
+ 96f:	83 f8 15             	cmp    $0x15,%eax
+ 972:	77 2c                	ja     9a0 <format+0x80>
+ 974:	ff 24 85 cc 13 00 00 	jmp    *0x13cc(,%eax,4)
+ 97b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 97f:	90                   	nop
+  for(i = 0; fmt[i]; i++){
+ 980:	0f b6 03             	movzbl (%ebx),%eax
+ 983:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+ 986:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+ 98b:	84 c0                	test   %al,%al
+ 98d:	75 c9                	jne    958 <format+0x38>
+        putc(b, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 98f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 992:	5b                   	pop    %ebx
+ 993:	5e                   	pop    %esi
+ 994:	5f                   	pop    %edi
+ 995:	5d                   	pop    %ebp
+ 996:	c3                   	ret
+ 997:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 99e:	66 90                	xchg   %ax,%ax
+        putc(b, '%');
+ 9a0:	ba 25 00 00 00       	mov    $0x25,%edx
+ 9a5:	89 f8                	mov    %edi,%eax
+ 9a7:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+ 9aa:	e8 01 ff ff ff       	call   8b0 <putc>
+        putc(b, c);
+ 9af:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ 9b2:	89 ca                	mov    %ecx,%edx
+ 9b4:	89 f8                	mov    %edi,%eax
+      state = 0;
+ 9b6:	31 f6                	xor    %esi,%esi
+        putc(b, c);
+ 9b8:	e8 f3 fe ff ff       	call   8b0 <putc>
+ 9bd:	eb 8f                	jmp    94e <format+0x2e>
+ 9bf:	90                   	nop
+        printint(b, *ap, 16, 0);
+ 9c0:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+ 9c3:	83 ec 0c             	sub    $0xc,%esp
+ 9c6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 9cb:	8b 16                	mov    (%esi),%edx
+ 9cd:	6a 00                	push   $0x0
+        ap++;
+ 9cf:	83 c6 04             	add    $0x4,%esi
+        printint(b, *ap, 16, 0);
+ 9d2:	89 f8                	mov    %edi,%eax
+ 9d4:	e8 d7 fd ff ff       	call   7b0 <printint>
+        ap++;
+ 9d9:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+ 9dc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 9df:	31 f6                	xor    %esi,%esi
+ 9e1:	e9 68 ff ff ff       	jmp    94e <format+0x2e>
+ 9e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9ed:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 9f0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 9f3:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 9f5:	83 c0 04             	add    $0x4,%eax
+ 9f8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 9fb:	85 f6                	test   %esi,%esi
+ 9fd:	75 1b                	jne    a1a <format+0xfa>
+ 9ff:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+ a04:	be c4 13 00 00       	mov    $0x13c4,%esi
+ a09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+          putc(b, *s);
+ a10:	89 f8                	mov    %edi,%eax
+          s++;
+ a12:	83 c6 01             	add    $0x1,%esi
+          putc(b, *s);
+ a15:	e8 96 fe ff ff       	call   8b0 <putc>
+        while(*s != 0){
+ a1a:	0f be 16             	movsbl (%esi),%edx
+ a1d:	84 d2                	test   %dl,%dl
+ a1f:	75 ef                	jne    a10 <format+0xf0>
+      state = 0;
+ a21:	31 f6                	xor    %esi,%esi
+ a23:	e9 26 ff ff ff       	jmp    94e <format+0x2e>
+ a28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a2f:	90                   	nop
+        printint(b, *ap, 10, 1);
+ a30:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+ a33:	83 ec 0c             	sub    $0xc,%esp
+ a36:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ a3b:	8b 16                	mov    (%esi),%edx
+ a3d:	6a 01                	push   $0x1
+ a3f:	eb 8e                	jmp    9cf <format+0xaf>
+ a41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(b, *ap);
+ a48:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+ a4b:	89 f8                	mov    %edi,%eax
+ a4d:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+ a50:	83 c6 04             	add    $0x4,%esi
+        putc(b, *ap);
+ a53:	e8 58 fe ff ff       	call   8b0 <putc>
+        ap++;
+ a58:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      state = 0;
+ a5b:	31 f6                	xor    %esi,%esi
+ a5d:	e9 ec fe ff ff       	jmp    94e <format+0x2e>
+ a62:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000a70 <fflush>:
+{
+ a70:	55                   	push   %ebp
+ a71:	89 e5                	mov    %esp,%ebp
+ a73:	83 ec 08             	sub    $0x8,%esp
+  if(fd == stdout.fd)
+ a76:	8b 45 08             	mov    0x8(%ebp),%eax
+ a79:	39 05 00 20 00 00    	cmp    %eax,0x2000
+ a7f:	74 07                	je     a88 <fflush+0x18>
+}
+ a81:	c9                   	leave
+ a82:	c3                   	ret
+ a83:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a87:	90                   	nop
+  umtxlock(&stdoutlock);
+ a88:	83 ec 0c             	sub    $0xc,%esp
+ a8b:	68 24 36 00 00       	push   $0x3624
+ a90:	e8 db fa ff ff       	call   570 <umtxlock>
+  if(b->n > 0)
+ a95:	a1 08 20 00 00       	mov    0x2008,%eax
+ a9a:	83 c4 10             	add    $0x10,%esp
+ a9d:	85 c0                	test   %eax,%eax
+ a9f:	7f 1f                	jg     ac0 <fflush+0x50>
+  b->n = 0;
+ aa1:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+ aa8:	00 00 00 
+  umtxunlock(&stdoutlock);
+ aab:	c7 45 08 24 36 00 00 	movl   $0x3624,0x8(%ebp)
+}
+ ab2:	c9                   	leave
+  umtxunlock(&stdoutlock);
+ ab3:	e9 08 fb ff ff       	jmp    5c0 <umtxunlock>
+ ab8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ abf:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+ ac0:	83 ec 04             	sub    $0x4,%esp
+ ac3:	50                   	push   %eax
+ ac4:	68 0c 20 00 00       	push   $0x200c
+ ac9:	ff 35 00 20 00 00    	push   0x2000
+ acf:	e8 3c fb ff ff       	call   610 <_write>
+ ad4:	83 c4 10             	add    $0x10,%esp
+ ad7:	eb c8                	jmp    aa1 <fflush+0x31>
+ ad9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000ae0 <setvbuf>:
+{
+ ae0:	55                   	push   %ebp
+ ae1:	89 e5                	mov    %esp,%ebp
+ ae3:	53                   	push   %ebx
+ ae4:	83 ec 04             	sub    $0x4,%esp
+ ae7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd != stdout.fd)
+ aea:	8b 45 08             	mov    0x8(%ebp),%eax
+ aed:	39 05 00 20 00 00    	cmp    %eax,0x2000
+ af3:	74 0b                	je     b00 <setvbuf+0x20>
+}
+ af5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ af8:	c9                   	leave
+ af9:	c3                   	ret
+ afa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  umtxlock(&stdoutlock);
+ b00:	83 ec 0c             	sub    $0xc,%esp
+ b03:	68 24 36 00 00       	push   $0x3624
+ b08:	e8 63 fa ff ff       	call   570 <umtxlock>
+  if(b->n > 0)
+ b0d:	a1 08 20 00 00       	mov    0x2008,%eax
+ b12:	83 c4 10             	add    $0x10,%esp
+ b15:	85 c0                	test   %eax,%eax
+ b17:	7f 2f                	jg     b48 <setvbuf+0x68>
+  b->n = 0;
+ b19:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+ b20:	00 00 00 
+  stdout.mode = mode;
+ b23:	89 1d 04 20 00 00    	mov    %ebx,0x2004
+  flushhook = flushall;
+ b29:	c7 05 20 36 00 00 60 	movl   $0x760,0x3620
+ b30:	07 00 00 
+}
+ b33:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&stdoutlock);
+ b36:	c7 45 08 24 36 00 00 	movl   $0x3624,0x8(%ebp)
+}
+ b3d:	c9                   	leave
+  umtxunlock(&stdoutlock);
+ b3e:	e9 7d fa ff ff       	jmp    5c0 <umtxunlock>
+ b43:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b47:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+ b48:	83 ec 04             	sub    $0x4,%esp
+ b4b:	50                   	push   %eax
+ b4c:	68 0c 20 00 00       	push   $0x200c
+ b51:	ff 35 00 20 00 00    	push   0x2000
+ b57:	e8 b4 fa ff ff       	call   610 <_write>
+ b5c:	83 c4 10             	add    $0x10,%esp
+ b5f:	eb b8                	jmp    b19 <setvbuf+0x39>
+ b61:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b6f:	90                   	nop
+
+00000b70 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s, %c.
+void
+printf(int fd, const char *fmt, ...)
+{
+ b70:	55                   	push   %ebp
+ b71:	89 e5                	mov    %esp,%ebp
+ b73:	53                   	push   %ebx
+ b74:	81 ec 14 02 00 00    	sub    $0x214,%esp
+ b7a:	8b 45 08             	mov    0x8(%ebp),%eax
+    local.mode = _IONBF;
+    local.n = 0;
+    local.str = 0;
+    b = &local;
+  }
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+ b7d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd == stdout.fd){
+ b80:	39 05 00 20 00 00    	cmp    %eax,0x2000
+ b86:	74 48                	je     bd0 <printf+0x60>
+    local.fd = fd;
+ b88:	89 85 e8 fd ff ff    	mov    %eax,-0x218(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+ b8e:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ b91:	89 da                	mov    %ebx,%edx
+ b93:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+    local.mode = _IONBF;
+ b99:	c7 85 ec fd ff ff 03 	movl   $0x3,-0x214(%ebp)
+ ba0:	00 00 00 
+    local.n = 0;
+ ba3:	c7 85 f0 fd ff ff 00 	movl   $0x0,-0x210(%ebp)
+ baa:	00 00 00 
+    local.str = 0;
+ bad:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+ bb4:	e8 67 fd ff ff       	call   920 <format>
+  if(b->mode == _IONBF)
+ bb9:	83 bd ec fd ff ff 03 	cmpl   $0x3,-0x214(%ebp)
+ bc0:	0f 84 a2 00 00 00    	je     c68 <printf+0xf8>
+    flush(b);
+  if(b == &stdout)
+    umtxunlock(&stdoutlock);
+}
+ bc6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ bc9:	c9                   	leave
+ bca:	c3                   	ret
+ bcb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ bcf:	90                   	nop
+    umtxlock(&stdoutlock);
+ bd0:	83 ec 0c             	sub    $0xc,%esp
+ bd3:	68 24 36 00 00       	push   $0x3624
+ bd8:	e8 93 f9 ff ff       	call   570 <umtxlock>
+  if(stdout.mode == 0){
+ bdd:	a1 04 20 00 00       	mov    0x2004,%eax
+ be2:	83 c4 10             	add    $0x10,%esp
+ be5:	85 c0                	test   %eax,%eax
+ be7:	74 37                	je     c20 <printf+0xb0>
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+ be9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ bec:	89 da                	mov    %ebx,%edx
+ bee:	b8 00 20 00 00       	mov    $0x2000,%eax
+ bf3:	e8 28 fd ff ff       	call   920 <format>
+  if(b->mode == _IONBF)
+ bf8:	83 3d 04 20 00 00 03 	cmpl   $0x3,0x2004
+ bff:	0f 84 ab 00 00 00    	je     cb0 <printf+0x140>
+    umtxunlock(&stdoutlock);
+ c05:	83 ec 0c             	sub    $0xc,%esp
+ c08:	68 24 36 00 00       	push   $0x3624
+ c0d:	e8 ae f9 ff ff       	call   5c0 <umtxunlock>
+}
+ c12:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    umtxunlock(&stdoutlock);
+ c15:	83 c4 10             	add    $0x10,%esp
+}
+ c18:	c9                   	leave
+ c19:	c3                   	ret
+ c1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+ c20:	83 ec 08             	sub    $0x8,%esp
+ c23:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+ c29:	50                   	push   %eax
+ c2a:	ff 35 00 20 00 00    	push   0x2000
+ c30:	e8 13 fa ff ff       	call   648 <fstat>
+ c35:	83 c4 10             	add    $0x10,%esp
+ c38:	89 c2                	mov    %eax,%edx
+      stdout.mode = _IOFBF;
+ c3a:	b8 01 00 00 00       	mov    $0x1,%eax
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+ c3f:	85 d2                	test   %edx,%edx
+ c41:	75 10                	jne    c53 <printf+0xe3>
+      stdout.mode = _IOLBF;
+ c43:	31 c0                	xor    %eax,%eax
+ c45:	66 83 bd e8 fd ff ff 	cmpw   $0x3,-0x218(%ebp)
+ c4c:	03 
+ c4d:	0f 94 c0             	sete   %al
+ c50:	83 c0 01             	add    $0x1,%eax
+ c53:	a3 04 20 00 00       	mov    %eax,0x2004
+    flushhook = flushall;
+ c58:	c7 05 20 36 00 00 60 	movl   $0x760,0x3620
+ c5f:	07 00 00 
+ c62:	eb 85                	jmp    be9 <printf+0x79>
+ c64:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(b->n > 0)
+ c68:	8b 85 f0 fd ff ff    	mov    -0x210(%ebp),%eax
+ c6e:	85 c0                	test   %eax,%eax
+ c70:	0f 8e 50 ff ff ff    	jle    bc6 <printf+0x56>
+    b = &local;
+ c76:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+    _write(b->fd, b->buf, b->n);
+ c7c:	83 ec 04             	sub    $0x4,%esp
+ c7f:	50                   	push   %eax
+ c80:	8d 43 0c             	lea    0xc(%ebx),%eax
+ c83:	50                   	push   %eax
+ c84:	ff 33                	push   (%ebx)
+ c86:	e8 85 f9 ff ff       	call   610 <_write>
+  b->n = 0;
+ c8b:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  if(b == &stdout)
+ c92:	83 c4 10             	add    $0x10,%esp
+ c95:	81 fb 00 20 00 00    	cmp    $0x2000,%ebx
+ c9b:	0f 85 25 ff ff ff    	jne    bc6 <printf+0x56>
+ ca1:	e9 5f ff ff ff       	jmp    c05 <printf+0x95>
+ ca6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cad:	8d 76 00             	lea    0x0(%esi),%esi
+  if(b->n > 0)
+ cb0:	a1 08 20 00 00       	mov    0x2008,%eax
+    b = getstdout();
+ cb5:	bb 00 20 00 00       	mov    $0x2000,%ebx
+  if(b->n > 0)
+ cba:	85 c0                	test   %eax,%eax
+ cbc:	7f be                	jg     c7c <printf+0x10c>
+  b->n = 0;
+ cbe:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+ cc5:	00 00 00 
+  if(b == &stdout)
+ cc8:	e9 38 ff ff ff       	jmp    c05 <printf+0x95>
+ ccd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000cd0 <sprintf>:
+
+// Print to the given buffer. Only understands %d, %x, %p, %s, %c.
+int
+sprintf(char *str, const char *fmt, ...)
+{
+ cd0:	55                   	push   %ebp
+ cd1:	89 e5                	mov    %esp,%ebp
+ cd3:	53                   	push   %ebx
+  struct outbuf b;
+
+  b.str = str;
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+ cd4:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+ cda:	8d 4d 10             	lea    0x10(%ebp),%ecx
+{
+ cdd:	81 ec 14 02 00 00    	sub    $0x214,%esp
+ ce3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+ ce6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  b.str = str;
+ ce9:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+ cec:	e8 2f fc ff ff       	call   920 <format>
+  *b.str = '\0';
+ cf1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cf4:	c6 00 00             	movb   $0x0,(%eax)
+  return b.str - str;
+ cf7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cfa:	29 d8                	sub    %ebx,%eax
+}
+ cfc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ cff:	c9                   	leave
+ d00:	c3                   	ret
+ d01:	66 90                	xchg   %ax,%ax
+ d03:	66 90                	xchg   %ax,%ax
+ d05:	66 90                	xchg   %ax,%ax
+ d07:	66 90                	xchg   %ax,%ax
+ d09:	66 90                	xchg   %ax,%ax
+ d0b:	66 90                	xchg   %ax,%ax
+ d0d:	66 90                	xchg   %ax,%ax
+ d0f:	90                   	nop
+
+00000d10 <freeblock>:
+static Header *freep;
+static struct umutex lock;  // threads made by clone() share the heap
+
+static void
+freeblock(void *ap)
+{
+ d10:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ d11:	8d 48 f8             	lea    -0x8(%eax),%ecx
+{
+ d14:	89 e5                	mov    %esp,%ebp
+ d16:	57                   	push   %edi
+ d17:	56                   	push   %esi
+ d18:	53                   	push   %ebx
+ d19:	89 c3                	mov    %eax,%ebx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ d1b:	a1 2c 36 00 00       	mov    0x362c,%eax
+ d20:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d22:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ d24:	39 ca                	cmp    %ecx,%edx
+ d26:	73 30                	jae    d58 <freeblock+0x48>
+ d28:	39 c1                	cmp    %eax,%ecx
+ d2a:	72 04                	jb     d30 <freeblock+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d2c:	39 c2                	cmp    %eax,%edx
+ d2e:	72 f0                	jb     d20 <freeblock+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ d30:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ d33:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ d36:	39 f8                	cmp    %edi,%eax
+ d38:	74 26                	je     d60 <freeblock+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ d3a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ d3d:	8b 42 04             	mov    0x4(%edx),%eax
+ d40:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ d43:	39 f1                	cmp    %esi,%ecx
+ d45:	74 30                	je     d77 <freeblock+0x67>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ d47:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ d49:	5b                   	pop    %ebx
+  freep = p;
+ d4a:	89 15 2c 36 00 00    	mov    %edx,0x362c
+}
+ d50:	5e                   	pop    %esi
+ d51:	5f                   	pop    %edi
+ d52:	5d                   	pop    %ebp
+ d53:	c3                   	ret
+ d54:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d58:	39 c1                	cmp    %eax,%ecx
+ d5a:	72 d0                	jb     d2c <freeblock+0x1c>
+ d5c:	eb c2                	jmp    d20 <freeblock+0x10>
+ d5e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ d60:	03 70 04             	add    0x4(%eax),%esi
+ d63:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ d66:	8b 02                	mov    (%edx),%eax
+ d68:	8b 00                	mov    (%eax),%eax
+ d6a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ d6d:	8b 42 04             	mov    0x4(%edx),%eax
+ d70:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ d73:	39 f1                	cmp    %esi,%ecx
+ d75:	75 d0                	jne    d47 <freeblock+0x37>
+    p->s.size += bp->s.size;
+ d77:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ d7a:	89 15 2c 36 00 00    	mov    %edx,0x362c
+    p->s.size += bp->s.size;
+ d80:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ d83:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ d86:	89 0a                	mov    %ecx,(%edx)
+}
+ d88:	5b                   	pop    %ebx
+ d89:	5e                   	pop    %esi
+ d8a:	5f                   	pop    %edi
+ d8b:	5d                   	pop    %ebp
+ d8c:	c3                   	ret
+ d8d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000d90 <free>:
+
+void
+free(void *ap)
+{
+ d90:	55                   	push   %ebp
+ d91:	89 e5                	mov    %esp,%ebp
+ d93:	53                   	push   %ebx
+ d94:	83 ec 10             	sub    $0x10,%esp
+ d97:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  umtxlock(&lock);
+ d9a:	68 28 36 00 00       	push   $0x3628
+ d9f:	e8 cc f7 ff ff       	call   570 <umtxlock>
+  freeblock(ap);
+ da4:	89 d8                	mov    %ebx,%eax
+ da6:	e8 65 ff ff ff       	call   d10 <freeblock>
+  umtxunlock(&lock);
+ dab:	c7 45 08 28 36 00 00 	movl   $0x3628,0x8(%ebp)
+}
+ db2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&lock);
+ db5:	83 c4 10             	add    $0x10,%esp
+}
+ db8:	c9                   	leave
+  umtxunlock(&lock);
+ db9:	e9 02 f8 ff ff       	jmp    5c0 <umtxunlock>
+ dbe:	66 90                	xchg   %ax,%ax
+
+00000dc0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ dc0:	55                   	push   %ebp
+ dc1:	89 e5                	mov    %esp,%ebp
+ dc3:	57                   	push   %edi
+ dc4:	56                   	push   %esi
+ dc5:	53                   	push   %ebx
+ dc6:	83 ec 28             	sub    $0x28,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ dc9:	8b 45 08             	mov    0x8(%ebp),%eax
+  umtxlock(&lock);
+ dcc:	68 28 36 00 00       	push   $0x3628
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ dd1:	8d 48 07             	lea    0x7(%eax),%ecx
+ dd4:	c1 e9 03             	shr    $0x3,%ecx
+ dd7:	8d 71 01             	lea    0x1(%ecx),%esi
+  umtxlock(&lock);
+ dda:	e8 91 f7 ff ff       	call   570 <umtxlock>
+  if((prevp = freep) == 0){
+ ddf:	8b 15 2c 36 00 00    	mov    0x362c,%edx
+ de5:	83 c4 10             	add    $0x10,%esp
+ de8:	85 d2                	test   %edx,%edx
+ dea:	0f 84 b0 00 00 00    	je     ea0 <malloc+0xe0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ df0:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ df2:	8b 47 04             	mov    0x4(%edi),%eax
+ df5:	39 f0                	cmp    %esi,%eax
+ df7:	73 6f                	jae    e68 <malloc+0xa8>
+  if(nu < 4096)
+ df9:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ dfe:	39 de                	cmp    %ebx,%esi
+ e00:	0f 43 de             	cmovae %esi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ e03:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ e0a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ e0d:	eb 0a                	jmp    e19 <malloc+0x59>
+ e0f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ e10:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ e12:	8b 47 04             	mov    0x4(%edi),%eax
+ e15:	39 f0                	cmp    %esi,%eax
+ e17:	73 4f                	jae    e68 <malloc+0xa8>
+      }
+      freep = prevp;
+      umtxunlock(&lock);
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ e19:	89 fa                	mov    %edi,%edx
+ e1b:	39 3d 2c 36 00 00    	cmp    %edi,0x362c
+ e21:	75 ed                	jne    e10 <malloc+0x50>
+  p = sbrk(nu * sizeof(Header));
+ e23:	83 ec 0c             	sub    $0xc,%esp
+ e26:	ff 75 e4             	push   -0x1c(%ebp)
+ e29:	e8 4a f8 ff ff       	call   678 <sbrk>
+  if(p == (char*)-1)
+ e2e:	83 c4 10             	add    $0x10,%esp
+ e31:	83 f8 ff             	cmp    $0xffffffff,%eax
+ e34:	74 15                	je     e4b <malloc+0x8b>
+  hp->s.size = nu;
+ e36:	89 58 04             	mov    %ebx,0x4(%eax)
+  freeblock((void*)(hp + 1));
+ e39:	83 c0 08             	add    $0x8,%eax
+ e3c:	e8 cf fe ff ff       	call   d10 <freeblock>
+  return freep;
+ e41:	8b 15 2c 36 00 00    	mov    0x362c,%edx
+      if((p = morecore(nunits)) == 0){
+ e47:	85 d2                	test   %edx,%edx
+ e49:	75 c5                	jne    e10 <malloc+0x50>
+        umtxunlock(&lock);
+ e4b:	83 ec 0c             	sub    $0xc,%esp
+ e4e:	68 28 36 00 00       	push   $0x3628
+ e53:	e8 68 f7 ff ff       	call   5c0 <umtxunlock>
+        return 0;
+ e58:	83 c4 10             	add    $0x10,%esp
+      }
+  }
+}
+ e5b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ e5e:	31 c0                	xor    %eax,%eax
+}
+ e60:	5b                   	pop    %ebx
+ e61:	5e                   	pop    %esi
+ e62:	5f                   	pop    %edi
+ e63:	5d                   	pop    %ebp
+ e64:	c3                   	ret
+ e65:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ e68:	39 c6                	cmp    %eax,%esi
+ e6a:	74 64                	je     ed0 <malloc+0x110>
+        p->s.size -= nunits;
+ e6c:	29 f0                	sub    %esi,%eax
+ e6e:	89 47 04             	mov    %eax,0x4(%edi)
+        p += p->s.size;
+ e71:	8d 3c c7             	lea    (%edi,%eax,8),%edi
+        p->s.size = nunits;
+ e74:	89 77 04             	mov    %esi,0x4(%edi)
+      umtxunlock(&lock);
+ e77:	83 ec 0c             	sub    $0xc,%esp
+      freep = prevp;
+ e7a:	89 15 2c 36 00 00    	mov    %edx,0x362c
+      umtxunlock(&lock);
+ e80:	68 28 36 00 00       	push   $0x3628
+ e85:	e8 36 f7 ff ff       	call   5c0 <umtxunlock>
+      return (void*)(p + 1);
+ e8a:	83 c4 10             	add    $0x10,%esp
+}
+ e8d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ e90:	8d 47 08             	lea    0x8(%edi),%eax
+}
+ e93:	5b                   	pop    %ebx
+ e94:	5e                   	pop    %esi
+ e95:	5f                   	pop    %edi
+ e96:	5d                   	pop    %ebp
+ e97:	c3                   	ret
+ e98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e9f:	90                   	nop
+    base.s.ptr = freep = prevp = &base;
+ ea0:	c7 05 2c 36 00 00 30 	movl   $0x3630,0x362c
+ ea7:	36 00 00 
+    base.s.size = 0;
+ eaa:	bf 30 36 00 00       	mov    $0x3630,%edi
+    base.s.ptr = freep = prevp = &base;
+ eaf:	c7 05 30 36 00 00 30 	movl   $0x3630,0x3630
+ eb6:	36 00 00 
+    base.s.size = 0;
+ eb9:	c7 05 34 36 00 00 00 	movl   $0x0,0x3634
+ ec0:	00 00 00 
+    if(p->s.size >= nunits){
+ ec3:	e9 31 ff ff ff       	jmp    df9 <malloc+0x39>
+ ec8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ecf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ ed0:	8b 07                	mov    (%edi),%eax
+ ed2:	89 02                	mov    %eax,(%edx)
+ ed4:	eb a1                	jmp    e77 <malloc+0xb7>
+ ed6:	66 90                	xchg   %ax,%ax
+ ed8:	66 90                	xchg   %ax,%ax
+ eda:	66 90                	xchg   %ax,%ax
+ edc:	66 90                	xchg   %ax,%ax
+ ede:	66 90                	xchg   %ax,%ax
+
+00000ee0 <threadstart>:
+
+#define TSTACKSZ 4096
+
+static void
+threadstart(void *fn, void *arg)
+{
+ ee0:	55                   	push   %ebp
+ ee1:	89 e5                	mov    %esp,%ebp
+ ee3:	83 ec 14             	sub    $0x14,%esp
+  ((void (*)(void*))fn)(arg);
+ ee6:	ff 75 0c             	push   0xc(%ebp)
+ ee9:	ff 55 08             	call   *0x8(%ebp)
+  exit();
+ eec:	e8 ef f4 ff ff       	call   3e0 <exit>
+ ef1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ef8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ eff:	90                   	nop
+
+00000f00 <thread_create>:
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ f00:	55                   	push   %ebp
+ f01:	89 e5                	mov    %esp,%ebp
+ f03:	53                   	push   %ebx
+ f04:	83 ec 20             	sub    $0x20,%esp
+  char *mem, *stack;
+  int pid;
+
+  if((mem = malloc(2*TSTACKSZ)) == 0)
+ f07:	68 00 20 00 00       	push   $0x2000
+ f0c:	e8 af fe ff ff       	call   dc0 <malloc>
+ f11:	83 c4 10             	add    $0x10,%esp
+ f14:	85 c0                	test   %eax,%eax
+ f16:	74 47                	je     f5f <thread_create+0x5f>
+ f18:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)(((uint)mem + TSTACKSZ - 1) & ~(TSTACKSZ - 1));
+ f1a:	8d 80 ff 0f 00 00    	lea    0xfff(%eax),%eax
+ f20:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  *(char**)stack = mem;
+ f25:	89 18                	mov    %ebx,(%eax)
+  if((pid = clone(threadstart, (void*)fn, arg, stack)) < 0)
+ f27:	50                   	push   %eax
+ f28:	ff 75 0c             	push   0xc(%ebp)
+ f2b:	ff 75 08             	push   0x8(%ebp)
+ f2e:	68 e0 0e 00 00       	push   $0xee0
+ f33:	e8 08 f8 ff ff       	call   740 <clone>
+ f38:	83 c4 10             	add    $0x10,%esp
+ f3b:	85 c0                	test   %eax,%eax
+ f3d:	78 09                	js     f48 <thread_create+0x48>
+    free(mem);
+  return pid;
+}
+ f3f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ f42:	c9                   	leave
+ f43:	c3                   	ret
+ f44:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    free(mem);
+ f48:	83 ec 0c             	sub    $0xc,%esp
+ f4b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ f4e:	53                   	push   %ebx
+ f4f:	e8 3c fe ff ff       	call   d90 <free>
+ f54:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ f57:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+ f5a:	83 c4 10             	add    $0x10,%esp
+}
+ f5d:	c9                   	leave
+ f5e:	c3                   	ret
+    return -1;
+ f5f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ f64:	eb d9                	jmp    f3f <thread_create+0x3f>
+ f66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ f6d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000f70 <thread_join>:
+
+int
+thread_join(void)
+{
+ f70:	55                   	push   %ebp
+ f71:	89 e5                	mov    %esp,%ebp
+ f73:	83 ec 34             	sub    $0x34,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+ f76:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ f79:	50                   	push   %eax
+ f7a:	e8 c9 f7 ff ff       	call   748 <join>
+ f7f:	83 c4 10             	add    $0x10,%esp
+ f82:	85 c0                	test   %eax,%eax
+ f84:	79 0a                	jns    f90 <thread_join+0x20>
+    free(*(char**)stack);
+  return pid;
+}
+ f86:	c9                   	leave
+ f87:	c3                   	ret
+ f88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ f8f:	90                   	nop
+    free(*(char**)stack);
+ f90:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ f93:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ f96:	83 ec 0c             	sub    $0xc,%esp
+ f99:	ff 32                	push   (%edx)
+ f9b:	e8 f0 fd ff ff       	call   d90 <free>
+ fa0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ fa3:	83 c4 10             	add    $0x10,%esp
+}
+ fa6:	c9                   	leave
+ fa7:	c3                   	ret
@@ -0,0 +1,43 @@
+// Show what an idle system costs in locking: sleep for a
+// while and count the lock acquisitions made meanwhile, per
+// tick. A CPU with nothing to run halts until an interrupt
+// or an IPI instead of rescanning the process table.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "lockstat.h"
+
+#define NCLASS 64
+#define NTICK  200
+
+struct lockstat before[NCLASS], after[NCLASS];
+
+int
+main(int argc, char *argv[])
+{
+  int nb, na, i, t;
+  uint nacq, ncont;
+
+  nb = lockstat(before, NCLASS);
+  t = uptime();
+  sleep(NTICK);
+  t = uptime() - t;
+  if(nb < 0 || (na = lockstat(after, NCLASS)) < 0){
+    printf(2, "idlebench: lockstat failed\n");
+    exit();
+  }
+  if(t == 0)
+    t = 1;
+
+  printf(1, "idlebench: %d ticks idle\n", t);
+  for(i = 0; i < na; i++){
+    nacq = after[i].nacquire - (i < nb ? before[i].nacquire : 0);
+    ncont = after[i].ncontend - (i < nb ? before[i].ncontend : 0);
+    if(nacq == 0)
+      continue;
+    printf(1, "idlebench: %s: acquired %d (%d per tick), contended %d\n",
+           after[i].name, nacq, nacq / t, ncont);
+  }
+  exit();
+}
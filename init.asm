@@ -0,0 +1,2241 @@
+
+_init:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+char *argv[] = { "sh", 0 };
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+  int pid, wpid;
+
+  if(open("console", O_RDWR) < 0){
+   f:	83 ec 08             	sub    $0x8,%esp
+  12:	6a 02                	push   $0x2
+  14:	68 88 0f 00 00       	push   $0xf88
+  19:	e8 f2 05 00 00       	call   610 <open>
+  1e:	83 c4 10             	add    $0x10,%esp
+  21:	85 c0                	test   %eax,%eax
+  23:	0f 88 9f 00 00 00    	js     c8 <main+0xc8>
+    mknod("console", 1, 1);
+    open("console", O_RDWR);
+  }
+  dup(0);  // stdout
+  29:	83 ec 0c             	sub    $0xc,%esp
+  2c:	6a 00                	push   $0x0
+  2e:	e8 15 06 00 00       	call   648 <dup>
+  dup(0);  // stderr
+  33:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  3a:	e8 09 06 00 00       	call   648 <dup>
+  3f:	83 c4 10             	add    $0x10,%esp
+  42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+  for(;;){
+    printf(1, "init: starting sh\n");
+  48:	83 ec 08             	sub    $0x8,%esp
+  4b:	68 90 0f 00 00       	push   $0xf90
+  50:	6a 01                	push   $0x1
+  52:	e8 f9 0a 00 00       	call   b50 <printf>
+    pid = fork();
+  57:	e8 34 03 00 00       	call   390 <fork>
+    if(pid < 0){
+  5c:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+  5f:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+  61:	85 c0                	test   %eax,%eax
+  63:	78 2c                	js     91 <main+0x91>
+      printf(1, "init: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+  65:	74 3d                	je     a4 <main+0xa4>
+  67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  6e:	66 90                	xchg   %ax,%ax
+      exec("sh", argv);
+      printf(1, "init: exec sh failed\n");
+      exit();
+    }
+    while((wpid=wait()) >= 0 && wpid != pid)
+  70:	e8 63 05 00 00       	call   5d8 <wait>
+  75:	85 c0                	test   %eax,%eax
+  77:	78 cf                	js     48 <main+0x48>
+  79:	39 c3                	cmp    %eax,%ebx
+  7b:	74 cb                	je     48 <main+0x48>
+      printf(1, "zombie!\n");
+  7d:	83 ec 08             	sub    $0x8,%esp
+  80:	68 cf 0f 00 00       	push   $0xfcf
+  85:	6a 01                	push   $0x1
+  87:	e8 c4 0a 00 00       	call   b50 <printf>
+  8c:	83 c4 10             	add    $0x10,%esp
+  8f:	eb df                	jmp    70 <main+0x70>
+      printf(1, "init: fork failed\n");
+  91:	53                   	push   %ebx
+  92:	53                   	push   %ebx
+  93:	68 a3 0f 00 00       	push   $0xfa3
+  98:	6a 01                	push   $0x1
+  9a:	e8 b1 0a 00 00       	call   b50 <printf>
+      exit();
+  9f:	e8 1c 03 00 00       	call   3c0 <exit>
+      exec("sh", argv);
+  a4:	50                   	push   %eax
+  a5:	50                   	push   %eax
+  a6:	68 00 20 00 00       	push   $0x2000
+  ab:	68 b6 0f 00 00       	push   $0xfb6
+  b0:	e8 2b 03 00 00       	call   3e0 <exec>
+      printf(1, "init: exec sh failed\n");
+  b5:	5a                   	pop    %edx
+  b6:	59                   	pop    %ecx
+  b7:	68 b9 0f 00 00       	push   $0xfb9
+  bc:	6a 01                	push   $0x1
+  be:	e8 8d 0a 00 00       	call   b50 <printf>
+      exit();
+  c3:	e8 f8 02 00 00       	call   3c0 <exit>
+    mknod("console", 1, 1);
+  c8:	50                   	push   %eax
+  c9:	6a 01                	push   $0x1
+  cb:	6a 01                	push   $0x1
+  cd:	68 88 0f 00 00       	push   $0xf88
+  d2:	e8 41 05 00 00       	call   618 <mknod>
+    open("console", O_RDWR);
+  d7:	58                   	pop    %eax
+  d8:	5a                   	pop    %edx
+  d9:	6a 02                	push   $0x2
+  db:	68 88 0f 00 00       	push   $0xf88
+  e0:	e8 2b 05 00 00       	call   610 <open>
+  e5:	83 c4 10             	add    $0x10,%esp
+  e8:	e9 3c ff ff ff       	jmp    29 <main+0x29>
+  ed:	66 90                	xchg   %ax,%ax
+  ef:	90                   	nop
+
+000000f0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  f0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  f1:	31 c0                	xor    %eax,%eax
+{
+  f3:	89 e5                	mov    %esp,%ebp
+  f5:	53                   	push   %ebx
+  f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 100:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 104:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 107:	83 c0 01             	add    $0x1,%eax
+ 10a:	84 d2                	test   %dl,%dl
+ 10c:	75 f2                	jne    100 <strcpy+0x10>
+    ;
+  return os;
+}
+ 10e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 111:	89 c8                	mov    %ecx,%eax
+ 113:	c9                   	leave
+ 114:	c3                   	ret
+ 115:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 11c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000120 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 120:	55                   	push   %ebp
+ 121:	89 e5                	mov    %esp,%ebp
+ 123:	53                   	push   %ebx
+ 124:	8b 55 08             	mov    0x8(%ebp),%edx
+ 127:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 12a:	0f b6 02             	movzbl (%edx),%eax
+ 12d:	84 c0                	test   %al,%al
+ 12f:	75 17                	jne    148 <strcmp+0x28>
+ 131:	eb 3a                	jmp    16d <strcmp+0x4d>
+ 133:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 137:	90                   	nop
+ 138:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 13c:	83 c2 01             	add    $0x1,%edx
+ 13f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 142:	84 c0                	test   %al,%al
+ 144:	74 1a                	je     160 <strcmp+0x40>
+    p++, q++;
+ 146:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 148:	0f b6 19             	movzbl (%ecx),%ebx
+ 14b:	38 c3                	cmp    %al,%bl
+ 14d:	74 e9                	je     138 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 14f:	29 d8                	sub    %ebx,%eax
+}
+ 151:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 154:	c9                   	leave
+ 155:	c3                   	ret
+ 156:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 15d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 160:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 164:	31 c0                	xor    %eax,%eax
+ 166:	29 d8                	sub    %ebx,%eax
+}
+ 168:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 16b:	c9                   	leave
+ 16c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 16d:	0f b6 19             	movzbl (%ecx),%ebx
+ 170:	31 c0                	xor    %eax,%eax
+ 172:	eb db                	jmp    14f <strcmp+0x2f>
+ 174:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 17f:	90                   	nop
+
+00000180 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 180:	55                   	push   %ebp
+ 181:	89 e5                	mov    %esp,%ebp
+ 183:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 186:	80 3a 00             	cmpb   $0x0,(%edx)
+ 189:	74 15                	je     1a0 <strlen+0x20>
+ 18b:	31 c0                	xor    %eax,%eax
+ 18d:	8d 76 00             	lea    0x0(%esi),%esi
+ 190:	83 c0 01             	add    $0x1,%eax
+ 193:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 197:	89 c1                	mov    %eax,%ecx
+ 199:	75 f5                	jne    190 <strlen+0x10>
+    ;
+  return n;
+}
+ 19b:	89 c8                	mov    %ecx,%eax
+ 19d:	5d                   	pop    %ebp
+ 19e:	c3                   	ret
+ 19f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 1a0:	31 c9                	xor    %ecx,%ecx
+}
+ 1a2:	5d                   	pop    %ebp
+ 1a3:	89 c8                	mov    %ecx,%eax
+ 1a5:	c3                   	ret
+ 1a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001b0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	57                   	push   %edi
+ 1b4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1b7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1bd:	89 d7                	mov    %edx,%edi
+ 1bf:	fc                   	cld
+ 1c0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1c2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1c5:	89 d0                	mov    %edx,%eax
+ 1c7:	c9                   	leave
+ 1c8:	c3                   	ret
+ 1c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001d0 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+ 1d0:	55                   	push   %ebp
+ 1d1:	89 e5                	mov    %esp,%ebp
+ 1d3:	56                   	push   %esi
+ 1d4:	53                   	push   %ebx
+ 1d5:	8b 75 10             	mov    0x10(%ebp),%esi
+ 1d8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1db:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+ 1de:	85 f6                	test   %esi,%esi
+ 1e0:	74 2e                	je     210 <memcmp+0x40>
+ 1e2:	01 c6                	add    %eax,%esi
+ 1e4:	eb 14                	jmp    1fa <memcmp+0x2a>
+ 1e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ed:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+ 1f0:	83 c0 01             	add    $0x1,%eax
+ 1f3:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+ 1f6:	39 f0                	cmp    %esi,%eax
+ 1f8:	74 16                	je     210 <memcmp+0x40>
+    if(*s1 != *s2)
+ 1fa:	0f b6 0a             	movzbl (%edx),%ecx
+ 1fd:	0f b6 18             	movzbl (%eax),%ebx
+ 200:	38 d9                	cmp    %bl,%cl
+ 202:	74 ec                	je     1f0 <memcmp+0x20>
+      return *s1 - *s2;
+ 204:	0f b6 c1             	movzbl %cl,%eax
+ 207:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+ 209:	5b                   	pop    %ebx
+ 20a:	5e                   	pop    %esi
+ 20b:	5d                   	pop    %ebp
+ 20c:	c3                   	ret
+ 20d:	8d 76 00             	lea    0x0(%esi),%esi
+ 210:	5b                   	pop    %ebx
+  return 0;
+ 211:	31 c0                	xor    %eax,%eax
+}
+ 213:	5e                   	pop    %esi
+ 214:	5d                   	pop    %ebp
+ 215:	c3                   	ret
+ 216:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 21d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000220 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 220:	55                   	push   %ebp
+ 221:	89 e5                	mov    %esp,%ebp
+ 223:	8b 45 08             	mov    0x8(%ebp),%eax
+ 226:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 22a:	0f b6 10             	movzbl (%eax),%edx
+ 22d:	84 d2                	test   %dl,%dl
+ 22f:	75 12                	jne    243 <strchr+0x23>
+ 231:	eb 1d                	jmp    250 <strchr+0x30>
+ 233:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 237:	90                   	nop
+ 238:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 23c:	83 c0 01             	add    $0x1,%eax
+ 23f:	84 d2                	test   %dl,%dl
+ 241:	74 0d                	je     250 <strchr+0x30>
+    if(*s == c)
+ 243:	38 d1                	cmp    %dl,%cl
+ 245:	75 f1                	jne    238 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 247:	5d                   	pop    %ebp
+ 248:	c3                   	ret
+ 249:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 250:	31 c0                	xor    %eax,%eax
+}
+ 252:	5d                   	pop    %ebp
+ 253:	c3                   	ret
+ 254:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 25f:	90                   	nop
+
+00000260 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+ 263:	57                   	push   %edi
+ 264:	56                   	push   %esi
+int
+read(int fd, void *buf, int n)
+{
+  if(flushhook)
+    flushhook();
+  return _read(fd, buf, n);
+ 265:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 268:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 269:	31 db                	xor    %ebx,%ebx
+{
+ 26b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 26e:	eb 32                	jmp    2a2 <gets+0x42>
+  if(flushhook)
+ 270:	a1 30 22 00 00       	mov    0x2230,%eax
+ 275:	85 c0                	test   %eax,%eax
+ 277:	74 02                	je     27b <gets+0x1b>
+    flushhook();
+ 279:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+ 27b:	83 ec 04             	sub    $0x4,%esp
+ 27e:	6a 01                	push   $0x1
+ 280:	56                   	push   %esi
+ 281:	6a 00                	push   $0x0
+ 283:	e8 60 03 00 00       	call   5e8 <_read>
+    if(cc < 1)
+ 288:	83 c4 10             	add    $0x10,%esp
+ 28b:	85 c0                	test   %eax,%eax
+ 28d:	7e 1d                	jle    2ac <gets+0x4c>
+    buf[i++] = c;
+ 28f:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 293:	8b 55 08             	mov    0x8(%ebp),%edx
+ 296:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 29a:	3c 0a                	cmp    $0xa,%al
+ 29c:	74 10                	je     2ae <gets+0x4e>
+ 29e:	3c 0d                	cmp    $0xd,%al
+ 2a0:	74 0c                	je     2ae <gets+0x4e>
+  for(i=0; i+1 < max; ){
+ 2a2:	89 df                	mov    %ebx,%edi
+ 2a4:	83 c3 01             	add    $0x1,%ebx
+ 2a7:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 2aa:	7c c4                	jl     270 <gets+0x10>
+ 2ac:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+ 2ae:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2b1:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+ 2b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2b8:	5b                   	pop    %ebx
+ 2b9:	5e                   	pop    %esi
+ 2ba:	5f                   	pop    %edi
+ 2bb:	5d                   	pop    %ebp
+ 2bc:	c3                   	ret
+ 2bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002c0 <stat>:
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	56                   	push   %esi
+ 2c4:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+ 2c5:	83 ec 08             	sub    $0x8,%esp
+ 2c8:	6a 00                	push   $0x0
+ 2ca:	ff 75 08             	push   0x8(%ebp)
+ 2cd:	e8 3e 03 00 00       	call   610 <open>
+  if(fd < 0)
+ 2d2:	83 c4 10             	add    $0x10,%esp
+ 2d5:	85 c0                	test   %eax,%eax
+ 2d7:	78 37                	js     310 <stat+0x50>
+  r = fstat(fd, st);
+ 2d9:	83 ec 08             	sub    $0x8,%esp
+ 2dc:	ff 75 0c             	push   0xc(%ebp)
+ 2df:	89 c3                	mov    %eax,%ebx
+ 2e1:	50                   	push   %eax
+ 2e2:	e8 41 03 00 00       	call   628 <fstat>
+}
+
+int
+close(int fd)
+{
+  if(flushhook)
+ 2e7:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+ 2ea:	89 c6                	mov    %eax,%esi
+  if(flushhook)
+ 2ec:	a1 30 22 00 00       	mov    0x2230,%eax
+ 2f1:	85 c0                	test   %eax,%eax
+ 2f3:	74 02                	je     2f7 <stat+0x37>
+    flushhook();
+ 2f5:	ff d0                	call   *%eax
+  return _close(fd);
+ 2f7:	83 ec 0c             	sub    $0xc,%esp
+ 2fa:	53                   	push   %ebx
+ 2fb:	e8 f8 02 00 00       	call   5f8 <_close>
+ 300:	83 c4 10             	add    $0x10,%esp
+}
+ 303:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 306:	89 f0                	mov    %esi,%eax
+ 308:	5b                   	pop    %ebx
+ 309:	5e                   	pop    %esi
+ 30a:	5d                   	pop    %ebp
+ 30b:	c3                   	ret
+ 30c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+ 310:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 315:	eb ec                	jmp    303 <stat+0x43>
+ 317:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31e:	66 90                	xchg   %ax,%ax
+
+00000320 <atoi>:
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	53                   	push   %ebx
+ 324:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+ 327:	0f be 02             	movsbl (%edx),%eax
+ 32a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 32d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 330:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 335:	77 1e                	ja     355 <atoi+0x35>
+ 337:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 340:	83 c2 01             	add    $0x1,%edx
+ 343:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 346:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 34a:	0f be 02             	movsbl (%edx),%eax
+ 34d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 350:	80 fb 09             	cmp    $0x9,%bl
+ 353:	76 eb                	jbe    340 <atoi+0x20>
+}
+ 355:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 358:	89 c8                	mov    %ecx,%eax
+ 35a:	c9                   	leave
+ 35b:	c3                   	ret
+ 35c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000360 <memmove>:
+{
+ 360:	55                   	push   %ebp
+ 361:	89 e5                	mov    %esp,%ebp
+ 363:	57                   	push   %edi
+ 364:	56                   	push   %esi
+ 365:	8b 45 10             	mov    0x10(%ebp),%eax
+ 368:	8b 55 08             	mov    0x8(%ebp),%edx
+ 36b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+ 36e:	85 c0                	test   %eax,%eax
+ 370:	7e 13                	jle    385 <memmove+0x25>
+ 372:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 374:	89 d7                	mov    %edx,%edi
+ 376:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 37d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 380:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 381:	39 f8                	cmp    %edi,%eax
+ 383:	75 fb                	jne    380 <memmove+0x20>
+}
+ 385:	5e                   	pop    %esi
+ 386:	89 d0                	mov    %edx,%eax
+ 388:	5f                   	pop    %edi
+ 389:	5d                   	pop    %ebp
+ 38a:	c3                   	ret
+ 38b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 38f:	90                   	nop
+
+00000390 <fork>:
+  if(flushhook)
+ 390:	a1 30 22 00 00       	mov    0x2230,%eax
+ 395:	85 c0                	test   %eax,%eax
+ 397:	74 17                	je     3b0 <fork+0x20>
+{
+ 399:	55                   	push   %ebp
+ 39a:	89 e5                	mov    %esp,%ebp
+ 39c:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+ 39f:	ff d0                	call   *%eax
+}
+ 3a1:	c9                   	leave
+  return _fork();
+ 3a2:	e9 21 02 00 00       	jmp    5c8 <_fork>
+ 3a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ae:	66 90                	xchg   %ax,%ax
+ 3b0:	e9 13 02 00 00       	jmp    5c8 <_fork>
+ 3b5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003c0 <exit>:
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+ 3c3:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+ 3c6:	a1 30 22 00 00       	mov    0x2230,%eax
+ 3cb:	85 c0                	test   %eax,%eax
+ 3cd:	74 02                	je     3d1 <exit+0x11>
+    flushhook();
+ 3cf:	ff d0                	call   *%eax
+  _exit();
+ 3d1:	e8 fa 01 00 00       	call   5d0 <_exit>
+ 3d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003e0 <exec>:
+{
+ 3e0:	55                   	push   %ebp
+  if(flushhook)
+ 3e1:	a1 30 22 00 00       	mov    0x2230,%eax
+{
+ 3e6:	89 e5                	mov    %esp,%ebp
+ 3e8:	56                   	push   %esi
+ 3e9:	53                   	push   %ebx
+ 3ea:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 3ed:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+ 3f0:	85 c0                	test   %eax,%eax
+ 3f2:	74 02                	je     3f6 <exec+0x16>
+    flushhook();
+ 3f4:	ff d0                	call   *%eax
+  return _exec(path, argv);
+ 3f6:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 3f9:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 3fc:	5b                   	pop    %ebx
+ 3fd:	5e                   	pop    %esi
+ 3fe:	5d                   	pop    %ebp
+  return _exec(path, argv);
+ 3ff:	e9 04 02 00 00       	jmp    608 <_exec>
+ 404:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 40b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 40f:	90                   	nop
+
+00000410 <read>:
+{
+ 410:	55                   	push   %ebp
+ 411:	89 e5                	mov    %esp,%ebp
+ 413:	57                   	push   %edi
+ 414:	56                   	push   %esi
+ 415:	53                   	push   %ebx
+ 416:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+ 419:	a1 30 22 00 00       	mov    0x2230,%eax
+{
+ 41e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 421:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 424:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+ 427:	85 c0                	test   %eax,%eax
+ 429:	74 02                	je     42d <read+0x1d>
+    flushhook();
+ 42b:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+ 42d:	89 7d 10             	mov    %edi,0x10(%ebp)
+ 430:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 433:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 436:	83 c4 0c             	add    $0xc,%esp
+ 439:	5b                   	pop    %ebx
+ 43a:	5e                   	pop    %esi
+ 43b:	5f                   	pop    %edi
+ 43c:	5d                   	pop    %ebp
+  return _read(fd, buf, n);
+ 43d:	e9 a6 01 00 00       	jmp    5e8 <_read>
+ 442:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 449:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000450 <readv>:
+{
+ 450:	55                   	push   %ebp
+ 451:	89 e5                	mov    %esp,%ebp
+ 453:	57                   	push   %edi
+ 454:	56                   	push   %esi
+ 455:	53                   	push   %ebx
+ 456:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+ 459:	a1 30 22 00 00       	mov    0x2230,%eax
+{
+ 45e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 461:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 464:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+ 467:	85 c0                	test   %eax,%eax
+ 469:	74 02                	je     46d <readv+0x1d>
+    flushhook();
+ 46b:	ff d0                	call   *%eax
+  return _readv(fd, iov, cnt);
+ 46d:	89 7d 10             	mov    %edi,0x10(%ebp)
+ 470:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 473:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 476:	83 c4 0c             	add    $0xc,%esp
+ 479:	5b                   	pop    %ebx
+ 47a:	5e                   	pop    %esi
+ 47b:	5f                   	pop    %edi
+ 47c:	5d                   	pop    %ebp
+  return _readv(fd, iov, cnt);
+ 47d:	e9 76 02 00 00       	jmp    6f8 <_readv>
+ 482:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 489:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000490 <write>:
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	57                   	push   %edi
+ 494:	56                   	push   %esi
+ 495:	53                   	push   %ebx
+ 496:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+ 499:	a1 30 22 00 00       	mov    0x2230,%eax
+{
+ 49e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 4a1:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 4a4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+ 4a7:	85 c0                	test   %eax,%eax
+ 4a9:	74 02                	je     4ad <write+0x1d>
+    flushhook();
+ 4ab:	ff d0                	call   *%eax
+  return _write(fd, buf, n);
+ 4ad:	89 7d 10             	mov    %edi,0x10(%ebp)
+ 4b0:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 4b3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 4b6:	83 c4 0c             	add    $0xc,%esp
+ 4b9:	5b                   	pop    %ebx
+ 4ba:	5e                   	pop    %esi
+ 4bb:	5f                   	pop    %edi
+ 4bc:	5d                   	pop    %ebp
+  return _write(fd, buf, n);
+ 4bd:	e9 2e 01 00 00       	jmp    5f0 <_write>
+ 4c2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004d0 <writev>:
+{
+ 4d0:	55                   	push   %ebp
+ 4d1:	89 e5                	mov    %esp,%ebp
+ 4d3:	57                   	push   %edi
+ 4d4:	56                   	push   %esi
+ 4d5:	53                   	push   %ebx
+ 4d6:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+ 4d9:	a1 30 22 00 00       	mov    0x2230,%eax
+{
+ 4de:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 4e1:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 4e4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+ 4e7:	85 c0                	test   %eax,%eax
+ 4e9:	74 02                	je     4ed <writev+0x1d>
+    flushhook();
+ 4eb:	ff d0                	call   *%eax
+  return _writev(fd, iov, cnt);
+ 4ed:	89 7d 10             	mov    %edi,0x10(%ebp)
+ 4f0:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 4f3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 4f6:	83 c4 0c             	add    $0xc,%esp
+ 4f9:	5b                   	pop    %ebx
+ 4fa:	5e                   	pop    %esi
+ 4fb:	5f                   	pop    %edi
+ 4fc:	5d                   	pop    %ebp
+  return _writev(fd, iov, cnt);
+ 4fd:	e9 fe 01 00 00       	jmp    700 <_writev>
+ 502:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 509:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000510 <close>:
+{
+ 510:	55                   	push   %ebp
+ 511:	89 e5                	mov    %esp,%ebp
+ 513:	53                   	push   %ebx
+ 514:	83 ec 04             	sub    $0x4,%esp
+  if(flushhook)
+ 517:	a1 30 22 00 00       	mov    0x2230,%eax
+{
+ 51c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(flushhook)
+ 51f:	85 c0                	test   %eax,%eax
+ 521:	74 02                	je     525 <close+0x15>
+    flushhook();
+ 523:	ff d0                	call   *%eax
+  return _close(fd);
+ 525:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 528:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 52b:	c9                   	leave
+  return _close(fd);
+ 52c:	e9 c7 00 00 00       	jmp    5f8 <_close>
+ 531:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 538:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 53f:	90                   	nop
+
+00000540 <umtxinit>:
+// process that finds the mutex held enters the kernel, to sleep
+// in futexwait() until the holder's umtxunlock() wakes it.
+
+void
+umtxinit(struct umutex *m)
+{
+ 540:	55                   	push   %ebp
+ 541:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 543:	8b 45 08             	mov    0x8(%ebp),%eax
+ 546:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 54c:	5d                   	pop    %ebp
+ 54d:	c3                   	ret
+ 54e:	66 90                	xchg   %ax,%ax
+
+00000550 <umtxlock>:
+
+void
+umtxlock(struct umutex *m)
+{
+ 550:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 551:	b8 01 00 00 00       	mov    $0x1,%eax
+ 556:	89 e5                	mov    %esp,%ebp
+ 558:	56                   	push   %esi
+ 559:	53                   	push   %ebx
+ 55a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 55d:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 1) == 0)
+ 560:	85 c0                	test   %eax,%eax
+ 562:	74 2b                	je     58f <umtxlock+0x3f>
+ 564:	b8 02 00 00 00       	mov    $0x2,%eax
+ 569:	f0 87 03             	lock xchg %eax,(%ebx)
+    return;
+  // Mark the mutex contended, so that its holder
+  // wakes a waiter on release, and wait.
+  while(xchg(&m->state, 2) != 0)
+ 56c:	85 c0                	test   %eax,%eax
+ 56e:	74 1f                	je     58f <umtxlock+0x3f>
+ 570:	be 02 00 00 00       	mov    $0x2,%esi
+ 575:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwait(&m->state, 2);
+ 578:	83 ec 08             	sub    $0x8,%esp
+ 57b:	6a 02                	push   $0x2
+ 57d:	53                   	push   %ebx
+ 57e:	e8 85 01 00 00       	call   708 <futexwait>
+ 583:	89 f0                	mov    %esi,%eax
+ 585:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+ 588:	83 c4 10             	add    $0x10,%esp
+ 58b:	85 c0                	test   %eax,%eax
+ 58d:	75 e9                	jne    578 <umtxlock+0x28>
+}
+ 58f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 592:	5b                   	pop    %ebx
+ 593:	5e                   	pop    %esi
+ 594:	5d                   	pop    %ebp
+ 595:	c3                   	ret
+ 596:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 59d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000005a0 <umtxunlock>:
+
+void
+umtxunlock(struct umutex *m)
+{
+ 5a0:	55                   	push   %ebp
+ 5a1:	31 c0                	xor    %eax,%eax
+ 5a3:	89 e5                	mov    %esp,%ebp
+ 5a5:	83 ec 08             	sub    $0x8,%esp
+ 5a8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 5ab:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 5ae:	83 f8 02             	cmp    $0x2,%eax
+ 5b1:	74 05                	je     5b8 <umtxunlock+0x18>
+    futexwake(&m->state, 1);
+}
+ 5b3:	c9                   	leave
+ 5b4:	c3                   	ret
+ 5b5:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwake(&m->state, 1);
+ 5b8:	83 ec 08             	sub    $0x8,%esp
+ 5bb:	6a 01                	push   $0x1
+ 5bd:	52                   	push   %edx
+ 5be:	e8 4d 01 00 00       	call   710 <futexwake>
+ 5c3:	83 c4 10             	add    $0x10,%esp
+}
+ 5c6:	c9                   	leave
+ 5c7:	c3                   	ret
+
+000005c8 <_fork>:
+  _ ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+ 5c8:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5cd:	cd 40                	int    $0x40
+ 5cf:	c3                   	ret
+
+000005d0 <_exit>:
+RAWSYSCALL(exit)
+ 5d0:	b8 02 00 00 00       	mov    $0x2,%eax
+ 5d5:	cd 40                	int    $0x40
+ 5d7:	c3                   	ret
+
+000005d8 <wait>:
+SYSCALL(wait)
+ 5d8:	b8 03 00 00 00       	mov    $0x3,%eax
+ 5dd:	cd 40                	int    $0x40
+ 5df:	c3                   	ret
+
+000005e0 <pipe>:
+SYSCALL(pipe)
+ 5e0:	b8 04 00 00 00       	mov    $0x4,%eax
+ 5e5:	cd 40                	int    $0x40
+ 5e7:	c3                   	ret
+
+000005e8 <_read>:
+RAWSYSCALL(read)
+ 5e8:	b8 05 00 00 00       	mov    $0x5,%eax
+ 5ed:	cd 40                	int    $0x40
+ 5ef:	c3                   	ret
+
+000005f0 <_write>:
+RAWSYSCALL(write)
+ 5f0:	b8 10 00 00 00       	mov    $0x10,%eax
+ 5f5:	cd 40                	int    $0x40
+ 5f7:	c3                   	ret
+
+000005f8 <_close>:
+RAWSYSCALL(close)
+ 5f8:	b8 15 00 00 00       	mov    $0x15,%eax
+ 5fd:	cd 40                	int    $0x40
+ 5ff:	c3                   	ret
+
+00000600 <kill>:
+SYSCALL(kill)
+ 600:	b8 06 00 00 00       	mov    $0x6,%eax
+ 605:	cd 40                	int    $0x40
+ 607:	c3                   	ret
+
+00000608 <_exec>:
+RAWSYSCALL(exec)
+ 608:	b8 07 00 00 00       	mov    $0x7,%eax
+ 60d:	cd 40                	int    $0x40
+ 60f:	c3                   	ret
+
+00000610 <open>:
+SYSCALL(open)
+ 610:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 615:	cd 40                	int    $0x40
+ 617:	c3                   	ret
+
+00000618 <mknod>:
+SYSCALL(mknod)
+ 618:	b8 11 00 00 00       	mov    $0x11,%eax
+ 61d:	cd 40                	int    $0x40
+ 61f:	c3                   	ret
+
+00000620 <unlink>:
+SYSCALL(unlink)
+ 620:	b8 12 00 00 00       	mov    $0x12,%eax
+ 625:	cd 40                	int    $0x40
+ 627:	c3                   	ret
+
+00000628 <fstat>:
+SYSCALL(fstat)
+ 628:	b8 08 00 00 00       	mov    $0x8,%eax
+ 62d:	cd 40                	int    $0x40
+ 62f:	c3                   	ret
+
+00000630 <link>:
+SYSCALL(link)
+ 630:	b8 13 00 00 00       	mov    $0x13,%eax
+ 635:	cd 40                	int    $0x40
+ 637:	c3                   	ret
+
+00000638 <mkdir>:
+SYSCALL(mkdir)
+ 638:	b8 14 00 00 00       	mov    $0x14,%eax
+ 63d:	cd 40                	int    $0x40
+ 63f:	c3                   	ret
+
+00000640 <chdir>:
+SYSCALL(chdir)
+ 640:	b8 09 00 00 00       	mov    $0x9,%eax
+ 645:	cd 40                	int    $0x40
+ 647:	c3                   	ret
+
+00000648 <dup>:
+SYSCALL(dup)
+ 648:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 64d:	cd 40                	int    $0x40
+ 64f:	c3                   	ret
+
+00000650 <getpid>:
+SYSCALL(getpid)
+ 650:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 655:	cd 40                	int    $0x40
+ 657:	c3                   	ret
+
+00000658 <sbrk>:
+SYSCALL(sbrk)
+ 658:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 65d:	cd 40                	int    $0x40
+ 65f:	c3                   	ret
+
+00000660 <sleep>:
+SYSCALL(sleep)
+ 660:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 665:	cd 40                	int    $0x40
+ 667:	c3                   	ret
+
+00000668 <uptime>:
+SYSCALL(uptime)
+ 668:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 66d:	cd 40                	int    $0x40
+ 66f:	c3                   	ret
+
+00000670 <wolfie>:
+SYSCALL(wolfie)
+ 670:	b8 16 00 00 00       	mov    $0x16,%eax
+ 675:	cd 40                	int    $0x40
+ 677:	c3                   	ret
+
+00000678 <nice>:
+SYSCALL(nice)
+ 678:	b8 17 00 00 00       	mov    $0x17,%eax
+ 67d:	cd 40                	int    $0x40
+ 67f:	c3                   	ret
+
+00000680 <mtxget>:
+SYSCALL(mtxget)
+ 680:	b8 18 00 00 00       	mov    $0x18,%eax
+ 685:	cd 40                	int    $0x40
+ 687:	c3                   	ret
+
+00000688 <mtxrel>:
+SYSCALL(mtxrel)
+ 688:	b8 19 00 00 00       	mov    $0x19,%eax
+ 68d:	cd 40                	int    $0x40
+ 68f:	c3                   	ret
+
+00000690 <mtxacq>:
+SYSCALL(mtxacq)
+ 690:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 695:	cd 40                	int    $0x40
+ 697:	c3                   	ret
+
+00000698 <mtxdel>:
+SYSCALL(mtxdel)
+ 698:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 69d:	cd 40                	int    $0x40
+ 69f:	c3                   	ret
+
+000006a0 <iostat>:
+SYSCALL(iostat)
+ 6a0:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 6a5:	cd 40                	int    $0x40
+ 6a7:	c3                   	ret
+
+000006a8 <mmap>:
+SYSCALL(mmap)
+ 6a8:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 6ad:	cd 40                	int    $0x40
+ 6af:	c3                   	ret
+
+000006b0 <munmap>:
+SYSCALL(munmap)
+ 6b0:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 6b5:	cd 40                	int    $0x40
+ 6b7:	c3                   	ret
+
+000006b8 <shmget>:
+SYSCALL(shmget)
+ 6b8:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 6bd:	cd 40                	int    $0x40
+ 6bf:	c3                   	ret
+
+000006c0 <shmat>:
+SYSCALL(shmat)
+ 6c0:	b8 20 00 00 00       	mov    $0x20,%eax
+ 6c5:	cd 40                	int    $0x40
+ 6c7:	c3                   	ret
+
+000006c8 <shmdt>:
+SYSCALL(shmdt)
+ 6c8:	b8 21 00 00 00       	mov    $0x21,%eax
+ 6cd:	cd 40                	int    $0x40
+ 6cf:	c3                   	ret
+
+000006d0 <shmdel>:
+SYSCALL(shmdel)
+ 6d0:	b8 22 00 00 00       	mov    $0x22,%eax
+ 6d5:	cd 40                	int    $0x40
+ 6d7:	c3                   	ret
+
+000006d8 <syscount>:
+SYSCALL(syscount)
+ 6d8:	b8 23 00 00 00       	mov    $0x23,%eax
+ 6dd:	cd 40                	int    $0x40
+ 6df:	c3                   	ret
+
+000006e0 <splice>:
+SYSCALL(splice)
+ 6e0:	b8 24 00 00 00       	mov    $0x24,%eax
+ 6e5:	cd 40                	int    $0x40
+ 6e7:	c3                   	ret
+
+000006e8 <tee>:
+SYSCALL(tee)
+ 6e8:	b8 25 00 00 00       	mov    $0x25,%eax
+ 6ed:	cd 40                	int    $0x40
+ 6ef:	c3                   	ret
+
+000006f0 <sendfile>:
+SYSCALL(sendfile)
+ 6f0:	b8 26 00 00 00       	mov    $0x26,%eax
+ 6f5:	cd 40                	int    $0x40
+ 6f7:	c3                   	ret
+
+000006f8 <_readv>:
+RAWSYSCALL(readv)
+ 6f8:	b8 27 00 00 00       	mov    $0x27,%eax
+ 6fd:	cd 40                	int    $0x40
+ 6ff:	c3                   	ret
+
+00000700 <_writev>:
+RAWSYSCALL(writev)
+ 700:	b8 28 00 00 00       	mov    $0x28,%eax
+ 705:	cd 40                	int    $0x40
+ 707:	c3                   	ret
+
+00000708 <futexwait>:
+SYSCALL(futexwait)
+ 708:	b8 29 00 00 00       	mov    $0x29,%eax
+ 70d:	cd 40                	int    $0x40
+ 70f:	c3                   	ret
+
+00000710 <futexwake>:
+SYSCALL(futexwake)
+ 710:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 715:	cd 40                	int    $0x40
+ 717:	c3                   	ret
+
+00000718 <lockstat>:
+SYSCALL(lockstat)
+ 718:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 71d:	cd 40                	int    $0x40
+ 71f:	c3                   	ret
+
+00000720 <clone>:
+SYSCALL(clone)
+ 720:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 725:	cd 40                	int    $0x40
+ 727:	c3                   	ret
+
+00000728 <join>:
+SYSCALL(join)
+ 728:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 72d:	cd 40                	int    $0x40
+ 72f:	c3                   	ret
+
+00000730 <stacklimit>:
+SYSCALL(stacklimit)
+ 730:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 735:	cd 40                	int    $0x40
+ 737:	c3                   	ret
+ 738:	66 90                	xchg   %ax,%ax
+ 73a:	66 90                	xchg   %ax,%ax
+ 73c:	66 90                	xchg   %ax,%ax
+ 73e:	66 90                	xchg   %ax,%ax
+
+00000740 <flushall>:
+  b->n = 0;
+}
+
+static void
+flushall(void)
+{
+ 740:	55                   	push   %ebp
+ 741:	89 e5                	mov    %esp,%ebp
+ 743:	83 ec 14             	sub    $0x14,%esp
+  umtxlock(&stdoutlock);
+ 746:	68 34 22 00 00       	push   $0x2234
+ 74b:	e8 00 fe ff ff       	call   550 <umtxlock>
+  if(b->n > 0)
+ 750:	a1 28 20 00 00       	mov    0x2028,%eax
+ 755:	83 c4 10             	add    $0x10,%esp
+ 758:	85 c0                	test   %eax,%eax
+ 75a:	7e 17                	jle    773 <flushall+0x33>
+    _write(b->fd, b->buf, b->n);
+ 75c:	83 ec 04             	sub    $0x4,%esp
+ 75f:	50                   	push   %eax
+ 760:	68 2c 20 00 00       	push   $0x202c
+ 765:	ff 35 20 20 00 00    	push   0x2020
+ 76b:	e8 80 fe ff ff       	call   5f0 <_write>
+ 770:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+ 773:	c7 05 28 20 00 00 00 	movl   $0x0,0x2028
+ 77a:	00 00 00 
+  flush(&stdout);
+  umtxunlock(&stdoutlock);
+ 77d:	83 ec 0c             	sub    $0xc,%esp
+ 780:	68 34 22 00 00       	push   $0x2234
+ 785:	e8 16 fe ff ff       	call   5a0 <umtxunlock>
+}
+ 78a:	83 c4 10             	add    $0x10,%esp
+ 78d:	c9                   	leave
+ 78e:	c3                   	ret
+ 78f:	90                   	nop
+
+00000790 <printint>:
+    flush(b);
+}
+
+static void
+printint(struct outbuf *b, int xx, int base, int sgn)
+{
+ 790:	55                   	push   %ebp
+ 791:	89 e5                	mov    %esp,%ebp
+ 793:	57                   	push   %edi
+ 794:	89 cf                	mov    %ecx,%edi
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 796:	89 d1                	mov    %edx,%ecx
+{
+ 798:	56                   	push   %esi
+ 799:	53                   	push   %ebx
+ 79a:	89 c3                	mov    %eax,%ebx
+ 79c:	83 ec 2c             	sub    $0x2c,%esp
+  if(sgn && xx < 0){
+ 79f:	85 d2                	test   %edx,%edx
+ 7a1:	0f 89 b9 00 00 00    	jns    860 <printint+0xd0>
+ 7a7:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 7ab:	0f 84 af 00 00 00    	je     860 <printint+0xd0>
+    x = -xx;
+ 7b1:	f7 d9                	neg    %ecx
+    neg = 1;
+ 7b3:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 7b8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 7bb:	31 f6                	xor    %esi,%esi
+ 7bd:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 7c0:	89 c8                	mov    %ecx,%eax
+ 7c2:	31 d2                	xor    %edx,%edx
+ 7c4:	89 f3                	mov    %esi,%ebx
+ 7c6:	f7 f7                	div    %edi
+ 7c8:	8d 76 01             	lea    0x1(%esi),%esi
+ 7cb:	0f b6 92 dc 13 00 00 	movzbl 0x13dc(%edx),%edx
+ 7d2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 7d6:	89 ca                	mov    %ecx,%edx
+ 7d8:	89 c1                	mov    %eax,%ecx
+ 7da:	39 fa                	cmp    %edi,%edx
+ 7dc:	73 e2                	jae    7c0 <printint+0x30>
+  if(neg)
+ 7de:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 7e1:	89 d9                	mov    %ebx,%ecx
+ 7e3:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 7e6:	85 c0                	test   %eax,%eax
+ 7e8:	74 07                	je     7f1 <printint+0x61>
+    buf[i++] = '-';
+ 7ea:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 7ef:	89 f1                	mov    %esi,%ecx
+ 7f1:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 7f4:	89 cf                	mov    %ecx,%edi
+ 7f6:	01 f7                	add    %esi,%edi
+ 7f8:	eb 1a                	jmp    814 <printint+0x84>
+ 7fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    *b->str++ = c;
+ 800:	8d 48 01             	lea    0x1(%eax),%ecx
+ 803:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+ 809:	88 10                	mov    %dl,(%eax)
+
+  while(--i >= 0)
+ 80b:	8d 47 ff             	lea    -0x1(%edi),%eax
+ 80e:	39 fe                	cmp    %edi,%esi
+ 810:	74 40                	je     852 <printint+0xc2>
+ 812:	89 c7                	mov    %eax,%edi
+  if(b->str){
+ 814:	8b 83 0c 02 00 00    	mov    0x20c(%ebx),%eax
+    putc(b, buf[i]);
+ 81a:	0f b6 17             	movzbl (%edi),%edx
+  if(b->str){
+ 81d:	85 c0                	test   %eax,%eax
+ 81f:	75 df                	jne    800 <printint+0x70>
+  b->buf[b->n++] = c;
+ 821:	8b 4b 08             	mov    0x8(%ebx),%ecx
+ 824:	8d 41 01             	lea    0x1(%ecx),%eax
+ 827:	89 43 08             	mov    %eax,0x8(%ebx)
+ 82a:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+ 82e:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 833:	74 3b                	je     870 <printint+0xe0>
+ 835:	80 fa 0a             	cmp    $0xa,%dl
+ 838:	75 d1                	jne    80b <printint+0x7b>
+ 83a:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+ 83e:	75 cb                	jne    80b <printint+0x7b>
+  if(b->n > 0)
+ 840:	85 c0                	test   %eax,%eax
+ 842:	7f 2c                	jg     870 <printint+0xe0>
+  b->n = 0;
+ 844:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  while(--i >= 0)
+ 84b:	8d 47 ff             	lea    -0x1(%edi),%eax
+ 84e:	39 fe                	cmp    %edi,%esi
+ 850:	75 c0                	jne    812 <printint+0x82>
+}
+ 852:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 855:	5b                   	pop    %ebx
+ 856:	5e                   	pop    %esi
+ 857:	5f                   	pop    %edi
+ 858:	5d                   	pop    %ebp
+ 859:	c3                   	ret
+ 85a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  neg = 0;
+ 860:	31 c0                	xor    %eax,%eax
+ 862:	e9 51 ff ff ff       	jmp    7b8 <printint+0x28>
+ 867:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 86e:	66 90                	xchg   %ax,%ax
+    _write(b->fd, b->buf, b->n);
+ 870:	83 ec 04             	sub    $0x4,%esp
+ 873:	50                   	push   %eax
+ 874:	8d 43 0c             	lea    0xc(%ebx),%eax
+ 877:	50                   	push   %eax
+ 878:	ff 33                	push   (%ebx)
+ 87a:	e8 71 fd ff ff       	call   5f0 <_write>
+ 87f:	83 c4 10             	add    $0x10,%esp
+ 882:	eb c0                	jmp    844 <printint+0xb4>
+ 884:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 88b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 88f:	90                   	nop
+
+00000890 <putc>:
+{
+ 890:	55                   	push   %ebp
+ 891:	89 e5                	mov    %esp,%ebp
+ 893:	53                   	push   %ebx
+ 894:	89 c3                	mov    %eax,%ebx
+ 896:	83 ec 04             	sub    $0x4,%esp
+  if(b->str){
+ 899:	8b 80 0c 02 00 00    	mov    0x20c(%eax),%eax
+ 89f:	85 c0                	test   %eax,%eax
+ 8a1:	74 15                	je     8b8 <putc+0x28>
+    *b->str++ = c;
+ 8a3:	8d 48 01             	lea    0x1(%eax),%ecx
+ 8a6:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+ 8ac:	88 10                	mov    %dl,(%eax)
+}
+ 8ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 8b1:	c9                   	leave
+ 8b2:	c3                   	ret
+ 8b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8b7:	90                   	nop
+  b->buf[b->n++] = c;
+ 8b8:	8b 4b 08             	mov    0x8(%ebx),%ecx
+ 8bb:	8d 41 01             	lea    0x1(%ecx),%eax
+ 8be:	89 43 08             	mov    %eax,0x8(%ebx)
+ 8c1:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+ 8c5:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 8ca:	74 14                	je     8e0 <putc+0x50>
+ 8cc:	80 fa 0a             	cmp    $0xa,%dl
+ 8cf:	75 dd                	jne    8ae <putc+0x1e>
+ 8d1:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+ 8d5:	75 d7                	jne    8ae <putc+0x1e>
+  if(b->n > 0)
+ 8d7:	85 c0                	test   %eax,%eax
+ 8d9:	7e 17                	jle    8f2 <putc+0x62>
+ 8db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8df:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+ 8e0:	83 ec 04             	sub    $0x4,%esp
+ 8e3:	50                   	push   %eax
+ 8e4:	8d 43 0c             	lea    0xc(%ebx),%eax
+ 8e7:	50                   	push   %eax
+ 8e8:	ff 33                	push   (%ebx)
+ 8ea:	e8 01 fd ff ff       	call   5f0 <_write>
+ 8ef:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+ 8f2:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+ 8f9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 8fc:	c9                   	leave
+ 8fd:	c3                   	ret
+ 8fe:	66 90                	xchg   %ax,%ax
+
+00000900 <format>:
+
+// Format fmt and the arguments at ap into b.
+// Only understands %d, %x, %p, %s, %c.
+static void
+format(struct outbuf *b, const char *fmt, uint *ap)
+{
+ 900:	55                   	push   %ebp
+ 901:	89 e5                	mov    %esp,%ebp
+ 903:	57                   	push   %edi
+ 904:	89 c7                	mov    %eax,%edi
+ 906:	56                   	push   %esi
+ 907:	53                   	push   %ebx
+ 908:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+ 90b:	0f b6 02             	movzbl (%edx),%eax
+{
+ 90e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 911:	84 c0                	test   %al,%al
+ 913:	74 5a                	je     96f <format+0x6f>
+ 915:	8d 5a 01             	lea    0x1(%edx),%ebx
+ 918:	31 f6                	xor    %esi,%esi
+ 91a:	eb 1c                	jmp    938 <format+0x38>
+ 91c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+ 920:	83 f8 25             	cmp    $0x25,%eax
+ 923:	74 3b                	je     960 <format+0x60>
+        state = '%';
+      } else {
+        putc(b, c);
+ 925:	89 ca                	mov    %ecx,%edx
+ 927:	89 f8                	mov    %edi,%eax
+ 929:	e8 62 ff ff ff       	call   890 <putc>
+  for(i = 0; fmt[i]; i++){
+ 92e:	0f b6 03             	movzbl (%ebx),%eax
+ 931:	83 c3 01             	add    $0x1,%ebx
+ 934:	84 c0                	test   %al,%al
+ 936:	74 37                	je     96f <format+0x6f>
+    c = fmt[i] & 0xff;
+ 938:	0f be c8             	movsbl %al,%ecx
+ 93b:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 93e:	85 f6                	test   %esi,%esi
+ 940:	74 de                	je     920 <format+0x20>
+      }
+    } else if(state == '%'){
+ 942:	83 fe 25             	cmp    $0x25,%esi
+ 945:	75 e7                	jne    92e <format+0x2e>
+      if(c == 'd'){
+ 947:	83 f8 25             	cmp    $0x25,%eax
+ 94a:	74 46                	je     992 <format+0x92>
+ 94c:	83 e8 63             	sub    $0x63,%eax
+ 94f:	83 f8 15             	cmp    $0x15,%eax
+ 952:	77 2c                	ja     980 <format+0x80>
+ 954:	ff 24 85 84 13 00 00 	jmp    *0x1384(,%eax,4)
+ 95b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 95f:	90                   	nop
+  for(i = 0; fmt[i]; i++){
+ 960:	0f b6 03             	movzbl (%ebx),%eax
+ 963:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+ 966:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+ 96b:	84 c0                	test   %al,%al
+ 96d:	75 c9                	jne    938 <format+0x38>
+        putc(b, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 96f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 972:	5b                   	pop    %ebx
+ 973:	5e                   	pop    %esi
+ 974:	5f                   	pop    %edi
+ 975:	5d                   	pop    %ebp
+ 976:	c3                   	ret
+ 977:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 97e:	66 90                	xchg   %ax,%ax
+        putc(b, '%');
+ 980:	ba 25 00 00 00       	mov    $0x25,%edx
+ 985:	89 f8                	mov    %edi,%eax
+ 987:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+ 98a:	e8 01 ff ff ff       	call   890 <putc>
+        putc(b, c);
+ 98f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ 992:	89 ca                	mov    %ecx,%edx
+ 994:	89 f8                	mov    %edi,%eax
+      state = 0;
+ 996:	31 f6                	xor    %esi,%esi
+        putc(b, c);
+ 998:	e8 f3 fe ff ff       	call   890 <putc>
+ 99d:	eb 8f                	jmp    92e <format+0x2e>
+ 99f:	90                   	nop
+        printint(b, *ap, 16, 0);
+ 9a0:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+ 9a3:	83 ec 0c             	sub    $0xc,%esp
+ 9a6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 9ab:	8b 16                	mov    (%esi),%edx
+ 9ad:	6a 00                	push   $0x0
+        ap++;
+ 9af:	83 c6 04             	add    $0x4,%esi
+        printint(b, *ap, 16, 0);
+ 9b2:	89 f8                	mov    %edi,%eax
+ 9b4:	e8 d7 fd ff ff       	call   790 <printint>
+        ap++;
+ 9b9:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+ 9bc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 9bf:	31 f6                	xor    %esi,%esi
+ 9c1:	e9 68 ff ff ff       	jmp    92e <format+0x2e>
+ 9c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9cd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 9d0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 9d3:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 9d5:	83 c0 04             	add    $0x4,%eax
+ 9d8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 9db:	85 f6                	test   %esi,%esi
+ 9dd:	75 1b                	jne    9fa <format+0xfa>
+ 9df:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+ 9e4:	be 7c 13 00 00       	mov    $0x137c,%esi
+ 9e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+          putc(b, *s);
+ 9f0:	89 f8                	mov    %edi,%eax
+          s++;
+ 9f2:	83 c6 01             	add    $0x1,%esi
+          putc(b, *s);
+ 9f5:	e8 96 fe ff ff       	call   890 <putc>
+        while(*s != 0){
+ 9fa:	0f be 16             	movsbl (%esi),%edx
+ 9fd:	84 d2                	test   %dl,%dl
+ 9ff:	75 ef                	jne    9f0 <format+0xf0>
+      state = 0;
+ a01:	31 f6                	xor    %esi,%esi
+ a03:	e9 26 ff ff ff       	jmp    92e <format+0x2e>
+ a08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a0f:	90                   	nop
+        printint(b, *ap, 10, 1);
+ a10:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+ a13:	83 ec 0c             	sub    $0xc,%esp
+ a16:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ a1b:	8b 16                	mov    (%esi),%edx
+ a1d:	6a 01                	push   $0x1
+ a1f:	eb 8e                	jmp    9af <format+0xaf>
+ a21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(b, *ap);
+ a28:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+ a2b:	89 f8                	mov    %edi,%eax
+ a2d:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+ a30:	83 c6 04             	add    $0x4,%esi
+        putc(b, *ap);
+ a33:	e8 58 fe ff ff       	call   890 <putc>
+        ap++;
+ a38:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      state = 0;
+ a3b:	31 f6                	xor    %esi,%esi
+ a3d:	e9 ec fe ff ff       	jmp    92e <format+0x2e>
+ a42:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000a50 <fflush>:
+{
+ a50:	55                   	push   %ebp
+ a51:	89 e5                	mov    %esp,%ebp
+ a53:	83 ec 08             	sub    $0x8,%esp
+  if(fd == stdout.fd)
+ a56:	8b 45 08             	mov    0x8(%ebp),%eax
+ a59:	39 05 20 20 00 00    	cmp    %eax,0x2020
+ a5f:	74 07                	je     a68 <fflush+0x18>
+}
+ a61:	c9                   	leave
+ a62:	c3                   	ret
+ a63:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a67:	90                   	nop
+  umtxlock(&stdoutlock);
+ a68:	83 ec 0c             	sub    $0xc,%esp
+ a6b:	68 34 22 00 00       	push   $0x2234
+ a70:	e8 db fa ff ff       	call   550 <umtxlock>
+  if(b->n > 0)
+ a75:	a1 28 20 00 00       	mov    0x2028,%eax
+ a7a:	83 c4 10             	add    $0x10,%esp
+ a7d:	85 c0                	test   %eax,%eax
+ a7f:	7f 1f                	jg     aa0 <fflush+0x50>
+  b->n = 0;
+ a81:	c7 05 28 20 00 00 00 	movl   $0x0,0x2028
+ a88:	00 00 00 
+  umtxunlock(&stdoutlock);
+ a8b:	c7 45 08 34 22 00 00 	movl   $0x2234,0x8(%ebp)
+}
+ a92:	c9                   	leave
+  umtxunlock(&stdoutlock);
+ a93:	e9 08 fb ff ff       	jmp    5a0 <umtxunlock>
+ a98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a9f:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+ aa0:	83 ec 04             	sub    $0x4,%esp
+ aa3:	50                   	push   %eax
+ aa4:	68 2c 20 00 00       	push   $0x202c
+ aa9:	ff 35 20 20 00 00    	push   0x2020
+ aaf:	e8 3c fb ff ff       	call   5f0 <_write>
+ ab4:	83 c4 10             	add    $0x10,%esp
+ ab7:	eb c8                	jmp    a81 <fflush+0x31>
+ ab9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000ac0 <setvbuf>:
+{
+ ac0:	55                   	push   %ebp
+ ac1:	89 e5                	mov    %esp,%ebp
+ ac3:	53                   	push   %ebx
+ ac4:	83 ec 04             	sub    $0x4,%esp
+ ac7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd != stdout.fd)
+ aca:	8b 45 08             	mov    0x8(%ebp),%eax
+ acd:	39 05 20 20 00 00    	cmp    %eax,0x2020
+ ad3:	74 0b                	je     ae0 <setvbuf+0x20>
+}
+ ad5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ ad8:	c9                   	leave
+ ad9:	c3                   	ret
+ ada:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  umtxlock(&stdoutlock);
+ ae0:	83 ec 0c             	sub    $0xc,%esp
+ ae3:	68 34 22 00 00       	push   $0x2234
+ ae8:	e8 63 fa ff ff       	call   550 <umtxlock>
+  if(b->n > 0)
+ aed:	a1 28 20 00 00       	mov    0x2028,%eax
+ af2:	83 c4 10             	add    $0x10,%esp
+ af5:	85 c0                	test   %eax,%eax
+ af7:	7f 2f                	jg     b28 <setvbuf+0x68>
+  b->n = 0;
+ af9:	c7 05 28 20 00 00 00 	movl   $0x0,0x2028
+ b00:	00 00 00 
+  stdout.mode = mode;
+ b03:	89 1d 24 20 00 00    	mov    %ebx,0x2024
+  flushhook = flushall;
+ b09:	c7 05 30 22 00 00 40 	movl   $0x740,0x2230
+ b10:	07 00 00 
+}
+ b13:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&stdoutlock);
+ b16:	c7 45 08 34 22 00 00 	movl   $0x2234,0x8(%ebp)
+}
+ b1d:	c9                   	leave
+  umtxunlock(&stdoutlock);
+ b1e:	e9 7d fa ff ff       	jmp    5a0 <umtxunlock>
+ b23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b27:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+ b28:	83 ec 04             	sub    $0x4,%esp
+ b2b:	50                   	push   %eax
+ b2c:	68 2c 20 00 00       	push   $0x202c
+ b31:	ff 35 20 20 00 00    	push   0x2020
+ b37:	e8 b4 fa ff ff       	call   5f0 <_write>
+ b3c:	83 c4 10             	add    $0x10,%esp
+ b3f:	eb b8                	jmp    af9 <setvbuf+0x39>
+ b41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b4f:	90                   	nop
+
+00000b50 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s, %c.
+void
+printf(int fd, const char *fmt, ...)
+{
+ b50:	55                   	push   %ebp
+ b51:	89 e5                	mov    %esp,%ebp
+ b53:	53                   	push   %ebx
+ b54:	81 ec 14 02 00 00    	sub    $0x214,%esp
+ b5a:	8b 45 08             	mov    0x8(%ebp),%eax
+    local.mode = _IONBF;
+    local.n = 0;
+    local.str = 0;
+    b = &local;
+  }
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+ b5d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd == stdout.fd){
+ b60:	39 05 20 20 00 00    	cmp    %eax,0x2020
+ b66:	74 48                	je     bb0 <printf+0x60>
+    local.fd = fd;
+ b68:	89 85 e8 fd ff ff    	mov    %eax,-0x218(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+ b6e:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ b71:	89 da                	mov    %ebx,%edx
+ b73:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+    local.mode = _IONBF;
+ b79:	c7 85 ec fd ff ff 03 	movl   $0x3,-0x214(%ebp)
+ b80:	00 00 00 
+    local.n = 0;
+ b83:	c7 85 f0 fd ff ff 00 	movl   $0x0,-0x210(%ebp)
+ b8a:	00 00 00 
+    local.str = 0;
+ b8d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+ b94:	e8 67 fd ff ff       	call   900 <format>
+  if(b->mode == _IONBF)
+ b99:	83 bd ec fd ff ff 03 	cmpl   $0x3,-0x214(%ebp)
+ ba0:	0f 84 a2 00 00 00    	je     c48 <printf+0xf8>
+    flush(b);
+  if(b == &stdout)
+    umtxunlock(&stdoutlock);
+}
+ ba6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ ba9:	c9                   	leave
+ baa:	c3                   	ret
+ bab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ baf:	90                   	nop
+    umtxlock(&stdoutlock);
+ bb0:	83 ec 0c             	sub    $0xc,%esp
+ bb3:	68 34 22 00 00       	push   $0x2234
+ bb8:	e8 93 f9 ff ff       	call   550 <umtxlock>
+  if(stdout.mode == 0){
+ bbd:	a1 24 20 00 00       	mov    0x2024,%eax
+ bc2:	83 c4 10             	add    $0x10,%esp
+ bc5:	85 c0                	test   %eax,%eax
+ bc7:	74 37                	je     c00 <printf+0xb0>
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+ bc9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ bcc:	89 da                	mov    %ebx,%edx
+ bce:	b8 20 20 00 00       	mov    $0x2020,%eax
+ bd3:	e8 28 fd ff ff       	call   900 <format>
+  if(b->mode == _IONBF)
+ bd8:	83 3d 24 20 00 00 03 	cmpl   $0x3,0x2024
+ bdf:	0f 84 ab 00 00 00    	je     c90 <printf+0x140>
+    umtxunlock(&stdoutlock);
+ be5:	83 ec 0c             	sub    $0xc,%esp
+ be8:	68 34 22 00 00       	push   $0x2234
+ bed:	e8 ae f9 ff ff       	call   5a0 <umtxunlock>
+}
+ bf2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    umtxunlock(&stdoutlock);
+ bf5:	83 c4 10             	add    $0x10,%esp
+}
+ bf8:	c9                   	leave
+ bf9:	c3                   	ret
+ bfa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+ c00:	83 ec 08             	sub    $0x8,%esp
+ c03:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+ c09:	50                   	push   %eax
+ c0a:	ff 35 20 20 00 00    	push   0x2020
+ c10:	e8 13 fa ff ff       	call   628 <fstat>
+ c15:	83 c4 10             	add    $0x10,%esp
+ c18:	89 c2                	mov    %eax,%edx
+      stdout.mode = _IOFBF;
+ c1a:	b8 01 00 00 00       	mov    $0x1,%eax
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+ c1f:	85 d2                	test   %edx,%edx
+ c21:	75 10                	jne    c33 <printf+0xe3>
+      stdout.mode = _IOLBF;
+ c23:	31 c0                	xor    %eax,%eax
+ c25:	66 83 bd e8 fd ff ff 	cmpw   $0x3,-0x218(%ebp)
+ c2c:	03 
+ c2d:	0f 94 c0             	sete   %al
+ c30:	83 c0 01             	add    $0x1,%eax
+ c33:	a3 24 20 00 00       	mov    %eax,0x2024
+    flushhook = flushall;
+ c38:	c7 05 30 22 00 00 40 	movl   $0x740,0x2230
+ c3f:	07 00 00 
+ c42:	eb 85                	jmp    bc9 <printf+0x79>
+ c44:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(b->n > 0)
+ c48:	8b 85 f0 fd ff ff    	mov    -0x210(%ebp),%eax
+ c4e:	85 c0                	test   %eax,%eax
+ c50:	0f 8e 50 ff ff ff    	jle    ba6 <printf+0x56>
+    b = &local;
+ c56:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+    _write(b->fd, b->buf, b->n);
+ c5c:	83 ec 04             	sub    $0x4,%esp
+ c5f:	50                   	push   %eax
+ c60:	8d 43 0c             	lea    0xc(%ebx),%eax
+ c63:	50                   	push   %eax
+ c64:	ff 33                	push   (%ebx)
+ c66:	e8 85 f9 ff ff       	call   5f0 <_write>
+  b->n = 0;
+ c6b:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  if(b == &stdout)
+ c72:	83 c4 10             	add    $0x10,%esp
+ c75:	81 fb 20 20 00 00    	cmp    $0x2020,%ebx
+ c7b:	0f 85 25 ff ff ff    	jne    ba6 <printf+0x56>
+ c81:	e9 5f ff ff ff       	jmp    be5 <printf+0x95>
+ c86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c8d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(b->n > 0)
+ c90:	a1 28 20 00 00       	mov    0x2028,%eax
+    b = getstdout();
+ c95:	bb 20 20 00 00       	mov    $0x2020,%ebx
+  if(b->n > 0)
+ c9a:	85 c0                	test   %eax,%eax
+ c9c:	7f be                	jg     c5c <printf+0x10c>
+  b->n = 0;
+ c9e:	c7 05 28 20 00 00 00 	movl   $0x0,0x2028
+ ca5:	00 00 00 
+  if(b == &stdout)
+ ca8:	e9 38 ff ff ff       	jmp    be5 <printf+0x95>
+ cad:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000cb0 <sprintf>:
+
+// Print to the given buffer. Only understands %d, %x, %p, %s, %c.
+int
+sprintf(char *str, const char *fmt, ...)
+{
+ cb0:	55                   	push   %ebp
+ cb1:	89 e5                	mov    %esp,%ebp
+ cb3:	53                   	push   %ebx
+  struct outbuf b;
+
+  b.str = str;
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+ cb4:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+ cba:	8d 4d 10             	lea    0x10(%ebp),%ecx
+{
+ cbd:	81 ec 14 02 00 00    	sub    $0x214,%esp
+ cc3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+ cc6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  b.str = str;
+ cc9:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+ ccc:	e8 2f fc ff ff       	call   900 <format>
+  *b.str = '\0';
+ cd1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cd4:	c6 00 00             	movb   $0x0,(%eax)
+  return b.str - str;
+ cd7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cda:	29 d8                	sub    %ebx,%eax
+}
+ cdc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ cdf:	c9                   	leave
+ ce0:	c3                   	ret
+ ce1:	66 90                	xchg   %ax,%ax
+ ce3:	66 90                	xchg   %ax,%ax
+ ce5:	66 90                	xchg   %ax,%ax
+ ce7:	66 90                	xchg   %ax,%ax
+ ce9:	66 90                	xchg   %ax,%ax
+ ceb:	66 90                	xchg   %ax,%ax
+ ced:	66 90                	xchg   %ax,%ax
+ cef:	90                   	nop
+
+00000cf0 <freeblock>:
+static Header *freep;
+static struct umutex lock;  // threads made by clone() share the heap
+
+static void
+freeblock(void *ap)
+{
+ cf0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ cf1:	8d 48 f8             	lea    -0x8(%eax),%ecx
+{
+ cf4:	89 e5                	mov    %esp,%ebp
+ cf6:	57                   	push   %edi
+ cf7:	56                   	push   %esi
+ cf8:	53                   	push   %ebx
+ cf9:	89 c3                	mov    %eax,%ebx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ cfb:	a1 3c 22 00 00       	mov    0x223c,%eax
+ d00:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d02:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ d04:	39 ca                	cmp    %ecx,%edx
+ d06:	73 30                	jae    d38 <freeblock+0x48>
+ d08:	39 c1                	cmp    %eax,%ecx
+ d0a:	72 04                	jb     d10 <freeblock+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d0c:	39 c2                	cmp    %eax,%edx
+ d0e:	72 f0                	jb     d00 <freeblock+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ d10:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ d13:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ d16:	39 f8                	cmp    %edi,%eax
+ d18:	74 26                	je     d40 <freeblock+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ d1a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ d1d:	8b 42 04             	mov    0x4(%edx),%eax
+ d20:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ d23:	39 f1                	cmp    %esi,%ecx
+ d25:	74 30                	je     d57 <freeblock+0x67>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ d27:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ d29:	5b                   	pop    %ebx
+  freep = p;
+ d2a:	89 15 3c 22 00 00    	mov    %edx,0x223c
+}
+ d30:	5e                   	pop    %esi
+ d31:	5f                   	pop    %edi
+ d32:	5d                   	pop    %ebp
+ d33:	c3                   	ret
+ d34:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d38:	39 c1                	cmp    %eax,%ecx
+ d3a:	72 d0                	jb     d0c <freeblock+0x1c>
+ d3c:	eb c2                	jmp    d00 <freeblock+0x10>
+ d3e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ d40:	03 70 04             	add    0x4(%eax),%esi
+ d43:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ d46:	8b 02                	mov    (%edx),%eax
+ d48:	8b 00                	mov    (%eax),%eax
+ d4a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ d4d:	8b 42 04             	mov    0x4(%edx),%eax
+ d50:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ d53:	39 f1                	cmp    %esi,%ecx
+ d55:	75 d0                	jne    d27 <freeblock+0x37>
+    p->s.size += bp->s.size;
+ d57:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ d5a:	89 15 3c 22 00 00    	mov    %edx,0x223c
+    p->s.size += bp->s.size;
+ d60:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ d63:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ d66:	89 0a                	mov    %ecx,(%edx)
+}
+ d68:	5b                   	pop    %ebx
+ d69:	5e                   	pop    %esi
+ d6a:	5f                   	pop    %edi
+ d6b:	5d                   	pop    %ebp
+ d6c:	c3                   	ret
+ d6d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000d70 <free>:
+
+void
+free(void *ap)
+{
+ d70:	55                   	push   %ebp
+ d71:	89 e5                	mov    %esp,%ebp
+ d73:	53                   	push   %ebx
+ d74:	83 ec 10             	sub    $0x10,%esp
+ d77:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  umtxlock(&lock);
+ d7a:	68 38 22 00 00       	push   $0x2238
+ d7f:	e8 cc f7 ff ff       	call   550 <umtxlock>
+  freeblock(ap);
+ d84:	89 d8                	mov    %ebx,%eax
+ d86:	e8 65 ff ff ff       	call   cf0 <freeblock>
+  umtxunlock(&lock);
+ d8b:	c7 45 08 38 22 00 00 	movl   $0x2238,0x8(%ebp)
+}
+ d92:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&lock);
+ d95:	83 c4 10             	add    $0x10,%esp
+}
+ d98:	c9                   	leave
+  umtxunlock(&lock);
+ d99:	e9 02 f8 ff ff       	jmp    5a0 <umtxunlock>
+ d9e:	66 90                	xchg   %ax,%ax
+
+00000da0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ da0:	55                   	push   %ebp
+ da1:	89 e5                	mov    %esp,%ebp
+ da3:	57                   	push   %edi
+ da4:	56                   	push   %esi
+ da5:	53                   	push   %ebx
+ da6:	83 ec 28             	sub    $0x28,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ da9:	8b 45 08             	mov    0x8(%ebp),%eax
+  umtxlock(&lock);
+ dac:	68 38 22 00 00       	push   $0x2238
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ db1:	8d 48 07             	lea    0x7(%eax),%ecx
+ db4:	c1 e9 03             	shr    $0x3,%ecx
+ db7:	8d 71 01             	lea    0x1(%ecx),%esi
+  umtxlock(&lock);
+ dba:	e8 91 f7 ff ff       	call   550 <umtxlock>
+  if((prevp = freep) == 0){
+ dbf:	8b 15 3c 22 00 00    	mov    0x223c,%edx
+ dc5:	83 c4 10             	add    $0x10,%esp
+ dc8:	85 d2                	test   %edx,%edx
+ dca:	0f 84 b0 00 00 00    	je     e80 <malloc+0xe0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ dd0:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ dd2:	8b 47 04             	mov    0x4(%edi),%eax
+ dd5:	39 f0                	cmp    %esi,%eax
+ dd7:	73 6f                	jae    e48 <malloc+0xa8>
+  if(nu < 4096)
+ dd9:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ dde:	39 de                	cmp    %ebx,%esi
+ de0:	0f 43 de             	cmovae %esi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ de3:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ dea:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ ded:	eb 0a                	jmp    df9 <malloc+0x59>
+ def:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ df0:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ df2:	8b 47 04             	mov    0x4(%edi),%eax
+ df5:	39 f0                	cmp    %esi,%eax
+ df7:	73 4f                	jae    e48 <malloc+0xa8>
+      }
+      freep = prevp;
+      umtxunlock(&lock);
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ df9:	89 fa                	mov    %edi,%edx
+ dfb:	39 3d 3c 22 00 00    	cmp    %edi,0x223c
+ e01:	75 ed                	jne    df0 <malloc+0x50>
+  p = sbrk(nu * sizeof(Header));
+ e03:	83 ec 0c             	sub    $0xc,%esp
+ e06:	ff 75 e4             	push   -0x1c(%ebp)
+ e09:	e8 4a f8 ff ff       	call   658 <sbrk>
+  if(p == (char*)-1)
+ e0e:	83 c4 10             	add    $0x10,%esp
+ e11:	83 f8 ff             	cmp    $0xffffffff,%eax
+ e14:	74 15                	je     e2b <malloc+0x8b>
+  hp->s.size = nu;
+ e16:	89 58 04             	mov    %ebx,0x4(%eax)
+  freeblock((void*)(hp + 1));
+ e19:	83 c0 08             	add    $0x8,%eax
+ e1c:	e8 cf fe ff ff       	call   cf0 <freeblock>
+  return freep;
+ e21:	8b 15 3c 22 00 00    	mov    0x223c,%edx
+      if((p = morecore(nunits)) == 0){
+ e27:	85 d2                	test   %edx,%edx
+ e29:	75 c5                	jne    df0 <malloc+0x50>
+        umtxunlock(&lock);
+ e2b:	83 ec 0c             	sub    $0xc,%esp
+ e2e:	68 38 22 00 00       	push   $0x2238
+ e33:	e8 68 f7 ff ff       	call   5a0 <umtxunlock>
+        return 0;
+ e38:	83 c4 10             	add    $0x10,%esp
+      }
+  }
+}
+ e3b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ e3e:	31 c0                	xor    %eax,%eax
+}
+ e40:	5b                   	pop    %ebx
+ e41:	5e                   	pop    %esi
+ e42:	5f                   	pop    %edi
+ e43:	5d                   	pop    %ebp
+ e44:	c3                   	ret
+ e45:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ e48:	39 c6                	cmp    %eax,%esi
+ e4a:	74 64                	je     eb0 <malloc+0x110>
+        p->s.size -= nunits;
+ e4c:	29 f0                	sub    %esi,%eax
+ e4e:	89 47 04             	mov    %eax,0x4(%edi)
+        p += p->s.size;
+ e51:	8d 3c c7             	lea    (%edi,%eax,8),%edi
+        p->s.size = nunits;
+ e54:	89 77 04             	mov    %esi,0x4(%edi)
+      umtxunlock(&lock);
+ e57:	83 ec 0c             	sub    $0xc,%esp
+      freep = prevp;
+ e5a:	89 15 3c 22 00 00    	mov    %edx,0x223c
+      umtxunlock(&lock);
+ e60:	68 38 22 00 00       	push   $0x2238
+ e65:	e8 36 f7 ff ff       	call   5a0 <umtxunlock>
+      return (void*)(p + 1);
+ e6a:	83 c4 10             	add    $0x10,%esp
+}
+ e6d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ e70:	8d 47 08             	lea    0x8(%edi),%eax
+}
+ e73:	5b                   	pop    %ebx
+ e74:	5e                   	pop    %esi
+ e75:	5f                   	pop    %edi
+ e76:	5d                   	pop    %ebp
+ e77:	c3                   	ret
+ e78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e7f:	90                   	nop
+    base.s.ptr = freep = prevp = &base;
+ e80:	c7 05 3c 22 00 00 40 	movl   $0x2240,0x223c
+ e87:	22 00 00 
+    base.s.size = 0;
+ e8a:	bf 40 22 00 00       	mov    $0x2240,%edi
+    base.s.ptr = freep = prevp = &base;
+ e8f:	c7 05 40 22 00 00 40 	movl   $0x2240,0x2240
+ e96:	22 00 00 
+    base.s.size = 0;
+ e99:	c7 05 44 22 00 00 00 	movl   $0x0,0x2244
+ ea0:	00 00 00 
+    if(p->s.size >= nunits){
+ ea3:	e9 31 ff ff ff       	jmp    dd9 <malloc+0x39>
+ ea8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ eaf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ eb0:	8b 07                	mov    (%edi),%eax
+ eb2:	89 02                	mov    %eax,(%edx)
+ eb4:	eb a1                	jmp    e57 <malloc+0xb7>
+ eb6:	66 90                	xchg   %ax,%ax
+ eb8:	66 90                	xchg   %ax,%ax
+ eba:	66 90                	xchg   %ax,%ax
+ ebc:	66 90                	xchg   %ax,%ax
+ ebe:	66 90                	xchg   %ax,%ax
+
+00000ec0 <threadstart>:
+
+#define TSTACKSZ 4096
+
+static void
+threadstart(void *fn, void *arg)
+{
+ ec0:	55                   	push   %ebp
+ ec1:	89 e5                	mov    %esp,%ebp
+ ec3:	83 ec 14             	sub    $0x14,%esp
+  ((void (*)(void*))fn)(arg);
+ ec6:	ff 75 0c             	push   0xc(%ebp)
+ ec9:	ff 55 08             	call   *0x8(%ebp)
+  exit();
+ ecc:	e8 ef f4 ff ff       	call   3c0 <exit>
+ ed1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ed8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ edf:	90                   	nop
+
+00000ee0 <thread_create>:
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ ee0:	55                   	push   %ebp
+ ee1:	89 e5                	mov    %esp,%ebp
+ ee3:	53                   	push   %ebx
+ ee4:	83 ec 20             	sub    $0x20,%esp
+  char *mem, *stack;
+  int pid;
+
+  if((mem = malloc(2*TSTACKSZ)) == 0)
+ ee7:	68 00 20 00 00       	push   $0x2000
+ eec:	e8 af fe ff ff       	call   da0 <malloc>
+ ef1:	83 c4 10             	add    $0x10,%esp
+ ef4:	85 c0                	test   %eax,%eax
+ ef6:	74 47                	je     f3f <thread_create+0x5f>
+ ef8:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)(((uint)mem + TSTACKSZ - 1) & ~(TSTACKSZ - 1));
+ efa:	8d 80 ff 0f 00 00    	lea    0xfff(%eax),%eax
+ f00:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  *(char**)stack = mem;
+ f05:	89 18                	mov    %ebx,(%eax)
+  if((pid = clone(threadstart, (void*)fn, arg, stack)) < 0)
+ f07:	50                   	push   %eax
+ f08:	ff 75 0c             	push   0xc(%ebp)
+ f0b:	ff 75 08             	push   0x8(%ebp)
+ f0e:	68 c0 0e 00 00       	push   $0xec0
+ f13:	e8 08 f8 ff ff       	call   720 <clone>
+ f18:	83 c4 10             	add    $0x10,%esp
+ f1b:	85 c0                	test   %eax,%eax
+ f1d:	78 09                	js     f28 <thread_create+0x48>
+    free(mem);
+  return pid;
+}
+ f1f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ f22:	c9                   	leave
+ f23:	c3                   	ret
+ f24:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    free(mem);
+ f28:	83 ec 0c             	sub    $0xc,%esp
+ f2b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ f2e:	53                   	push   %ebx
+ f2f:	e8 3c fe ff ff       	call   d70 <free>
+ f34:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ f37:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+ f3a:	83 c4 10             	add    $0x10,%esp
+}
+ f3d:	c9                   	leave
+ f3e:	c3                   	ret
+    return -1;
+ f3f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ f44:	eb d9                	jmp    f1f <thread_create+0x3f>
+ f46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ f4d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000f50 <thread_join>:
+
+int
+thread_join(void)
+{
+ f50:	55                   	push   %ebp
+ f51:	89 e5                	mov    %esp,%ebp
+ f53:	83 ec 34             	sub    $0x34,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+ f56:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ f59:	50                   	push   %eax
+ f5a:	e8 c9 f7 ff ff       	call   728 <join>
+ f5f:	83 c4 10             	add    $0x10,%esp
+ f62:	85 c0                	test   %eax,%eax
+ f64:	79 0a                	jns    f70 <thread_join+0x20>
+    free(*(char**)stack);
+  return pid;
+}
+ f66:	c9                   	leave
+ f67:	c3                   	ret
+ f68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ f6f:	90                   	nop
+    free(*(char**)stack);
+ f70:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ f73:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ f76:	83 ec 0c             	sub    $0xc,%esp
+ f79:	ff 32                	push   (%edx)
+ f7b:	e8 f0 fd ff ff       	call   d70 <free>
+ f80:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ f83:	83 c4 10             	add    $0x10,%esp
+}
+ f86:	c9                   	leave
+ f87:	c3                   	ret
@@ -0,0 +1,13 @@
+// Disk, page cache, swap, memory and page fault counters, see iostat().
+struct iostat {
+  uint nread;     // blocks read from disk
+  uint nwrite;    // blocks written to disk
+  uint nseek;     // requests not adjacent to the previous one
+  uint seekdist;  // total distance in blocks between requests
+  uint pchit;     // file pages found in the page cache
+  uint pcmiss;    // file pages not found in the page cache
+  uint swapin;    // pages read back in from swap
+  uint swapout;   // pages written out to swap
+  uint freemem;   // pages of memory free now
+  uint pgfault;   // page faults taken
+};
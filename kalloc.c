@@ -1,6 +1,16 @@
 // Physical memory allocator, intended to allocate
 // memory for user processes, kernel stacks, page table pages,
 // and pipe buffers. Allocates 4096-byte pages.
+//
+// Free memory is kept as aligned 4MB chunks where possible, so
+// that big heaps can be mapped with large pages (see allocuvm).
+// kalloc() breaks a chunk into 4096-byte pages when it runs out
+// of those; pages are not put back together once freed.
+//
+// CPUs with nothing to run call kzero() to keep up to NZEROPAGE
+// free pages zeroed ahead of time, for kzalloc() to hand out.
+// Like kalloc(), it breaks a chunk when there are no free pages,
+// which after boot is most of the time; NZEROPAGE is one chunk.
 
 #include "types.h"
 #include "defs.h"
@@ -8,6 +18,7 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "spinlock.h"
+#include "iostat.h"
 
 void freerange(void *vstart, void *vend);
 extern char end[]; // first address after kernel loaded from ELF file
@@ -21,6 +32,10 @@ struct {
   struct spinlock lock;
   int use_lock;
   struct run *freelist;
+  struct run *lfreelist;  // free 4MB chunks
+  struct run *zfreelist;  // free pages already zeroed
+  int nzero;              // pages on zfreelist
+  uint nfree;             // free pages, counting those in chunks
 } kmem;
 
 // Initialization happens in two phases.
@@ -48,8 +63,15 @@ freerange(void *vstart, void *vend)
 {
   char *p;
   p = (char*)PGROUNDUP((uint)vstart);
-  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
-    kfree(p);
+  while(p + PGSIZE <= (char*)vend){
+    if(V2P(p) % LPGSIZE == 0 && (char*)vend - p >= LPGSIZE){
+      kfreelarge(p);
+      p += LPGSIZE;
+    } else {
+      kfree(p);
+      p += PGSIZE;
+    }
+  }
 }
 //PAGEBREAK: 21
 // Free the page of physical memory pointed at by v,
@@ -72,25 +94,164 @@ kfree(char *v)
   r = (struct run*)v;
   r->next = kmem.freelist;
   kmem.freelist = r;
+  kmem.nfree++;
   if(kmem.use_lock)
     release(&kmem.lock);
 }
 
+// Free the 4MB chunk of physical memory at v,
+// which kalloclarge() returned.
+void
+kfreelarge(char *v)
+{
+  struct run *r;
+
+  if(V2P(v) % LPGSIZE || v < end || V2P(v) + LPGSIZE > PHYSTOP)
+    panic("kfreelarge");
+
+  memset(v, 1, LPGSIZE);
+
+  if(kmem.use_lock)
+    acquire(&kmem.lock);
+  r = (struct run*)v;
+  r->next = kmem.lfreelist;
+  kmem.lfreelist = r;
+  kmem.nfree += LPGSIZE / PGSIZE;
+  if(kmem.use_lock)
+    release(&kmem.lock);
+}
+
+// Allocate an aligned 4MB chunk of physical memory.
+// Returns 0 if there is no free chunk; callers
+// fall back to 4096-byte pages.
+char*
+kalloclarge(void)
+{
+  struct run *r;
+
+  acquire(&kmem.lock);
+  r = kmem.lfreelist;
+  if(r){
+    kmem.lfreelist = r->next;
+    kmem.nfree -= LPGSIZE / PGSIZE;
+  }
+  release(&kmem.lock);
+  return (char*)r;
+}
+
+// Move the pages of a free 4MB chunk onto the page free list.
+// Caller must hold kmem.lock if it is in use.
+static void
+split(void)
+{
+  struct run *r;
+  char *p;
+
+  r = kmem.lfreelist;
+  kmem.lfreelist = r->next;
+  for(p = (char*)r + LPGSIZE - PGSIZE; p >= (char*)r; p -= PGSIZE){
+    ((struct run*)p)->next = kmem.freelist;
+    kmem.freelist = (struct run*)p;
+  }
+}
+
 // Allocate one 4096-byte page of physical memory.
 // Returns a pointer that the kernel can use.
 // Returns 0 if the memory cannot be allocated.
+// When memory runs out, takes back idle page cache frames.
 char*
 kalloc(void)
 {
   struct run *r;
 
+  for(;;){
+    if(kmem.use_lock)
+      acquire(&kmem.lock);
+    if(kmem.freelist == 0 && kmem.lfreelist)
+      split();
+    r = kmem.freelist;
+    if(r)
+      kmem.freelist = r->next;
+    else if((r = kmem.zfreelist) != 0){
+      kmem.zfreelist = r->next;
+      kmem.nzero--;
+    }
+    if(r)
+      kmem.nfree--;
+    if(kmem.use_lock)
+      release(&kmem.lock);
+    if(r || !kmem.use_lock || pcreclaim() == 0)
+      return (char*)r;
+  }
+}
+
+// Allocate one zeroed 4096-byte page, from the pages
+// kzero() has zeroed if there are any.
+char*
+kzalloc(void)
+{
+  struct run *r;
+
   if(kmem.use_lock)
     acquire(&kmem.lock);
-  r = kmem.freelist;
-  if(r)
-    kmem.freelist = r->next;
+  r = kmem.zfreelist;
+  if(r){
+    kmem.zfreelist = r->next;
+    kmem.nzero--;
+    kmem.nfree--;
+  }
   if(kmem.use_lock)
     release(&kmem.lock);
+  if(r){
+    r->next = 0;
+    return (char*)r;
+  }
+  if((r = (struct run*)kalloc()) != 0)
+    memset(r, 0, PGSIZE);
   return (char*)r;
 }
 
+// Zero a free page for kzalloc(), if fewer than NZEROPAGE
+// are ready. Called by idle CPUs; returns 0 if there was
+// nothing to do.
+int
+kzero(void)
+{
+  struct run *r;
+
+  // Look before taking the lock, which idle CPUs
+  // would otherwise keep from busy ones.
+  if(kmem.nzero >= NZEROPAGE ||
+     (kmem.freelist == 0 && kmem.lfreelist == 0))
+    return 0;
+  acquire(&kmem.lock);
+  r = 0;
+  if(kmem.nzero < NZEROPAGE){
+    if(kmem.freelist == 0 && kmem.lfreelist)
+      split();
+    if((r = kmem.freelist) != 0)
+      kmem.freelist = r->next;
+  }
+  release(&kmem.lock);
+  if(r == 0)
+    return 0;
+
+  memset(r, 0, PGSIZE);
+
+  acquire(&kmem.lock);
+  r->next = kmem.zfreelist;
+  kmem.zfreelist = r;
+  kmem.nzero++;
+  release(&kmem.lock);
+  return 1;
+}
+
+
+// Fill in the count of free pages in *st.
+void
+kmemstat(struct iostat *st)
+{
+  acquire(&kmem.lock);
+  st->freemem = kmem.nfree;
+  release(&kmem.lock);
+}
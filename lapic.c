@@ -31,6 +31,7 @@
 #define ICRHI   (0x0310/4)   // Interrupt Command [63:32]
 #define TIMER   (0x0320/4)   // Local Vector Table 0 (TIMER)
   #define X1         0x0000000B   // divide counts by 1
+  #define X128       0x0000000A   // divide counts by 128
   #define PERIODIC   0x00020000   // Periodic
 #define PCINT   (0x0340/4)   // Performance Counter LVT
 #define LINT0   (0x0350/4)   // Local Vector Table 1 (LINT0)
@@ -41,6 +42,8 @@
 #define TCCR    (0x0390/4)   // Timer Current Count
 #define TDCR    (0x03E0/4)   // Timer Divide Configuration
 
+#define TICK    10000000     // Bus cycles per timer interrupt
+
 volatile uint *lapic;  // Initialized in mp.c
 
 //PAGEBREAK!
@@ -66,7 +69,7 @@ lapicinit(void)
   // TICR would be calibrated using an external time source.
   lapicw(TDCR, X1);
   lapicw(TIMER, PERIODIC | (T_IRQ0 + IRQ_TIMER));
-  lapicw(TICR, 10000000);
+  lapicw(TICR, TICK);
 
   // Disable logical interrupt lines.
   lapicw(LINT0, MASKED);
@@ -113,6 +116,62 @@ lapiceoi(void)
     lapicw(EOI, 0);
 }
 
+// Send interrupt vector to the CPU with the given APIC id.
+void
+lapicipi(int apicid, int vector)
+{
+  if(!lapic)
+    return;
+  lapicw(ICRHI, apicid<<24);
+  lapicw(ICRLO, FIXED | ASSERT | vector);
+  while(lapic[ICRLO] & DELIVS)
+    ;
+}
+
+// Bus cycles each CPU has spent idle that did not
+// add up to a whole tick, kept for its next idle spell.
+static uint idlecycles[NCPU];
+
+// Stop this CPU's periodic timer interrupt before it halts with
+// nothing to do. Instead the timer counts down once, 128 times
+// slower and from as high as it can, so that lapicstarttick()
+// can tell how long the CPU was halted.
+// Caller must have interrupts off.
+void
+lapicstoptick(void)
+{
+  if(!lapic)
+    return;
+  idlecycles[cpuid()] += TICK - lapic[TCCR];
+  lapicw(TDCR, X128);
+  lapicw(TIMER, T_IRQ0 + IRQ_TIMER);
+  lapicw(TICR, 0xFFFFFFFF);
+}
+
+// Restart the periodic timer interrupt when this CPU stops
+// idling, and return the number of ticks it missed.
+// Caller must have interrupts off.
+int
+lapicstarttick(void)
+{
+  uint n, t, *idle;
+
+  if(!lapic)
+    return 0;
+  t = 0xFFFFFFFF - lapic[TCCR];
+  lapicw(TDCR, X1);
+  lapicw(TIMER, PERIODIC | (T_IRQ0 + IRQ_TIMER));
+  lapicw(TICR, TICK);
+
+  // t counts 128 bus cycles at a time.
+  idle = &idlecycles[cpuid()];
+  n = t / (TICK/128);
+  *idle += t % (TICK/128) * 128;
+  n += *idle / TICK;
+  *idle %= TICK;
+  return n;
+}
+
 // Spin for a given number of microseconds.
 // On real hardware would want to tune this dynamically.
 void
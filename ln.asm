@@ -0,0 +1,2179 @@
+
+_ln:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+  if(argc != 3){
+   f:	83 39 03             	cmpl   $0x3,(%ecx)
+{
+  12:	8b 59 04             	mov    0x4(%ecx),%ebx
+  if(argc != 3){
+  15:	74 13                	je     2a <main+0x2a>
+    printf(2, "Usage: ln old new\n");
+  17:	52                   	push   %edx
+  18:	52                   	push   %edx
+  19:	68 f8 0e 00 00       	push   $0xef8
+  1e:	6a 02                	push   $0x2
+  20:	e8 9b 0a 00 00       	call   ac0 <printf>
+    exit();
+  25:	e8 06 03 00 00       	call   330 <exit>
+  }
+  if(link(argv[1], argv[2]) < 0)
+  2a:	50                   	push   %eax
+  2b:	50                   	push   %eax
+  2c:	ff 73 08             	push   0x8(%ebx)
+  2f:	ff 73 04             	push   0x4(%ebx)
+  32:	e8 69 05 00 00       	call   5a0 <link>
+  37:	83 c4 10             	add    $0x10,%esp
+  3a:	85 c0                	test   %eax,%eax
+  3c:	78 05                	js     43 <main+0x43>
+    printf(2, "link %s %s: failed\n", argv[1], argv[2]);
+  exit();
+  3e:	e8 ed 02 00 00       	call   330 <exit>
+    printf(2, "link %s %s: failed\n", argv[1], argv[2]);
+  43:	ff 73 08             	push   0x8(%ebx)
+  46:	ff 73 04             	push   0x4(%ebx)
+  49:	68 0b 0f 00 00       	push   $0xf0b
+  4e:	6a 02                	push   $0x2
+  50:	e8 6b 0a 00 00       	call   ac0 <printf>
+  55:	83 c4 10             	add    $0x10,%esp
+  58:	eb e4                	jmp    3e <main+0x3e>
+  5a:	66 90                	xchg   %ax,%ax
+  5c:	66 90                	xchg   %ax,%ax
+  5e:	66 90                	xchg   %ax,%ax
+
+00000060 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  60:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  61:	31 c0                	xor    %eax,%eax
+{
+  63:	89 e5                	mov    %esp,%ebp
+  65:	53                   	push   %ebx
+  66:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  69:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  70:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  74:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  77:	83 c0 01             	add    $0x1,%eax
+  7a:	84 d2                	test   %dl,%dl
+  7c:	75 f2                	jne    70 <strcpy+0x10>
+    ;
+  return os;
+}
+  7e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  81:	89 c8                	mov    %ecx,%eax
+  83:	c9                   	leave
+  84:	c3                   	ret
+  85:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000090 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  90:	55                   	push   %ebp
+  91:	89 e5                	mov    %esp,%ebp
+  93:	53                   	push   %ebx
+  94:	8b 55 08             	mov    0x8(%ebp),%edx
+  97:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  9a:	0f b6 02             	movzbl (%edx),%eax
+  9d:	84 c0                	test   %al,%al
+  9f:	75 17                	jne    b8 <strcmp+0x28>
+  a1:	eb 3a                	jmp    dd <strcmp+0x4d>
+  a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  a7:	90                   	nop
+  a8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  ac:	83 c2 01             	add    $0x1,%edx
+  af:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  b2:	84 c0                	test   %al,%al
+  b4:	74 1a                	je     d0 <strcmp+0x40>
+    p++, q++;
+  b6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  b8:	0f b6 19             	movzbl (%ecx),%ebx
+  bb:	38 c3                	cmp    %al,%bl
+  bd:	74 e9                	je     a8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  bf:	29 d8                	sub    %ebx,%eax
+}
+  c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  c4:	c9                   	leave
+  c5:	c3                   	ret
+  c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  cd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  d0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  d4:	31 c0                	xor    %eax,%eax
+  d6:	29 d8                	sub    %ebx,%eax
+}
+  d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  db:	c9                   	leave
+  dc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  dd:	0f b6 19             	movzbl (%ecx),%ebx
+  e0:	31 c0                	xor    %eax,%eax
+  e2:	eb db                	jmp    bf <strcmp+0x2f>
+  e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  ef:	90                   	nop
+
+000000f0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+  f0:	55                   	push   %ebp
+  f1:	89 e5                	mov    %esp,%ebp
+  f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  f6:	80 3a 00             	cmpb   $0x0,(%edx)
+  f9:	74 15                	je     110 <strlen+0x20>
+  fb:	31 c0                	xor    %eax,%eax
+  fd:	8d 76 00             	lea    0x0(%esi),%esi
+ 100:	83 c0 01             	add    $0x1,%eax
+ 103:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 107:	89 c1                	mov    %eax,%ecx
+ 109:	75 f5                	jne    100 <strlen+0x10>
+    ;
+  return n;
+}
+ 10b:	89 c8                	mov    %ecx,%eax
+ 10d:	5d                   	pop    %ebp
+ 10e:	c3                   	ret
+ 10f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 110:	31 c9                	xor    %ecx,%ecx
+}
+ 112:	5d                   	pop    %ebp
+ 113:	89 c8                	mov    %ecx,%eax
+ 115:	c3                   	ret
+ 116:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 11d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000120 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 120:	55                   	push   %ebp
+ 121:	89 e5                	mov    %esp,%ebp
+ 123:	57                   	push   %edi
+ 124:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 127:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 12a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 12d:	89 d7                	mov    %edx,%edi
+ 12f:	fc                   	cld
+ 130:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 132:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 135:	89 d0                	mov    %edx,%eax
+ 137:	c9                   	leave
+ 138:	c3                   	ret
+ 139:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000140 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	56                   	push   %esi
+ 144:	53                   	push   %ebx
+ 145:	8b 75 10             	mov    0x10(%ebp),%esi
+ 148:	8b 55 08             	mov    0x8(%ebp),%edx
+ 14b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+ 14e:	85 f6                	test   %esi,%esi
+ 150:	74 2e                	je     180 <memcmp+0x40>
+ 152:	01 c6                	add    %eax,%esi
+ 154:	eb 14                	jmp    16a <memcmp+0x2a>
+ 156:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 15d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+ 160:	83 c0 01             	add    $0x1,%eax
+ 163:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+ 166:	39 f0                	cmp    %esi,%eax
+ 168:	74 16                	je     180 <memcmp+0x40>
+    if(*s1 != *s2)
+ 16a:	0f b6 0a             	movzbl (%edx),%ecx
+ 16d:	0f b6 18             	movzbl (%eax),%ebx
+ 170:	38 d9                	cmp    %bl,%cl
+ 172:	74 ec                	je     160 <memcmp+0x20>
+      return *s1 - *s2;
+ 174:	0f b6 c1             	movzbl %cl,%eax
+ 177:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+ 179:	5b                   	pop    %ebx
+ 17a:	5e                   	pop    %esi
+ 17b:	5d                   	pop    %ebp
+ 17c:	c3                   	ret
+ 17d:	8d 76 00             	lea    0x0(%esi),%esi
+ 180:	5b                   	pop    %ebx
+  return 0;
+ 181:	31 c0                	xor    %eax,%eax
+}
+ 183:	5e                   	pop    %esi
+ 184:	5d                   	pop    %ebp
+ 185:	c3                   	ret
+ 186:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 18d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000190 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 190:	55                   	push   %ebp
+ 191:	89 e5                	mov    %esp,%ebp
+ 193:	8b 45 08             	mov    0x8(%ebp),%eax
+ 196:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 19a:	0f b6 10             	movzbl (%eax),%edx
+ 19d:	84 d2                	test   %dl,%dl
+ 19f:	75 12                	jne    1b3 <strchr+0x23>
+ 1a1:	eb 1d                	jmp    1c0 <strchr+0x30>
+ 1a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1a7:	90                   	nop
+ 1a8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 1ac:	83 c0 01             	add    $0x1,%eax
+ 1af:	84 d2                	test   %dl,%dl
+ 1b1:	74 0d                	je     1c0 <strchr+0x30>
+    if(*s == c)
+ 1b3:	38 d1                	cmp    %dl,%cl
+ 1b5:	75 f1                	jne    1a8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 1b7:	5d                   	pop    %ebp
+ 1b8:	c3                   	ret
+ 1b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 1c0:	31 c0                	xor    %eax,%eax
+}
+ 1c2:	5d                   	pop    %ebp
+ 1c3:	c3                   	ret
+ 1c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1cf:	90                   	nop
+
+000001d0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1d0:	55                   	push   %ebp
+ 1d1:	89 e5                	mov    %esp,%ebp
+ 1d3:	57                   	push   %edi
+ 1d4:	56                   	push   %esi
+int
+read(int fd, void *buf, int n)
+{
+  if(flushhook)
+    flushhook();
+  return _read(fd, buf, n);
+ 1d5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 1d8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 1d9:	31 db                	xor    %ebx,%ebx
+{
+ 1db:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 1de:	eb 32                	jmp    212 <gets+0x42>
+  if(flushhook)
+ 1e0:	a1 10 22 00 00       	mov    0x2210,%eax
+ 1e5:	85 c0                	test   %eax,%eax
+ 1e7:	74 02                	je     1eb <gets+0x1b>
+    flushhook();
+ 1e9:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+ 1eb:	83 ec 04             	sub    $0x4,%esp
+ 1ee:	6a 01                	push   $0x1
+ 1f0:	56                   	push   %esi
+ 1f1:	6a 00                	push   $0x0
+ 1f3:	e8 60 03 00 00       	call   558 <_read>
+    if(cc < 1)
+ 1f8:	83 c4 10             	add    $0x10,%esp
+ 1fb:	85 c0                	test   %eax,%eax
+ 1fd:	7e 1d                	jle    21c <gets+0x4c>
+    buf[i++] = c;
+ 1ff:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 203:	8b 55 08             	mov    0x8(%ebp),%edx
+ 206:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 20a:	3c 0a                	cmp    $0xa,%al
+ 20c:	74 10                	je     21e <gets+0x4e>
+ 20e:	3c 0d                	cmp    $0xd,%al
+ 210:	74 0c                	je     21e <gets+0x4e>
+  for(i=0; i+1 < max; ){
+ 212:	89 df                	mov    %ebx,%edi
+ 214:	83 c3 01             	add    $0x1,%ebx
+ 217:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 21a:	7c c4                	jl     1e0 <gets+0x10>
+ 21c:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+ 21e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 221:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+ 225:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 228:	5b                   	pop    %ebx
+ 229:	5e                   	pop    %esi
+ 22a:	5f                   	pop    %edi
+ 22b:	5d                   	pop    %ebp
+ 22c:	c3                   	ret
+ 22d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000230 <stat>:
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	56                   	push   %esi
+ 234:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+ 235:	83 ec 08             	sub    $0x8,%esp
+ 238:	6a 00                	push   $0x0
+ 23a:	ff 75 08             	push   0x8(%ebp)
+ 23d:	e8 3e 03 00 00       	call   580 <open>
+  if(fd < 0)
+ 242:	83 c4 10             	add    $0x10,%esp
+ 245:	85 c0                	test   %eax,%eax
+ 247:	78 37                	js     280 <stat+0x50>
+  r = fstat(fd, st);
+ 249:	83 ec 08             	sub    $0x8,%esp
+ 24c:	ff 75 0c             	push   0xc(%ebp)
+ 24f:	89 c3                	mov    %eax,%ebx
+ 251:	50                   	push   %eax
+ 252:	e8 41 03 00 00       	call   598 <fstat>
+}
+
+int
+close(int fd)
+{
+  if(flushhook)
+ 257:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+ 25a:	89 c6                	mov    %eax,%esi
+  if(flushhook)
+ 25c:	a1 10 22 00 00       	mov    0x2210,%eax
+ 261:	85 c0                	test   %eax,%eax
+ 263:	74 02                	je     267 <stat+0x37>
+    flushhook();
+ 265:	ff d0                	call   *%eax
+  return _close(fd);
+ 267:	83 ec 0c             	sub    $0xc,%esp
+ 26a:	53                   	push   %ebx
+ 26b:	e8 f8 02 00 00       	call   568 <_close>
+ 270:	83 c4 10             	add    $0x10,%esp
+}
+ 273:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 276:	89 f0                	mov    %esi,%eax
+ 278:	5b                   	pop    %ebx
+ 279:	5e                   	pop    %esi
+ 27a:	5d                   	pop    %ebp
+ 27b:	c3                   	ret
+ 27c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+ 280:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 285:	eb ec                	jmp    273 <stat+0x43>
+ 287:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28e:	66 90                	xchg   %ax,%ax
+
+00000290 <atoi>:
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	53                   	push   %ebx
+ 294:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+ 297:	0f be 02             	movsbl (%edx),%eax
+ 29a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 29d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 2a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 2a5:	77 1e                	ja     2c5 <atoi+0x35>
+ 2a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ae:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 2b0:	83 c2 01             	add    $0x1,%edx
+ 2b3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 2b6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 2ba:	0f be 02             	movsbl (%edx),%eax
+ 2bd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 2c0:	80 fb 09             	cmp    $0x9,%bl
+ 2c3:	76 eb                	jbe    2b0 <atoi+0x20>
+}
+ 2c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2c8:	89 c8                	mov    %ecx,%eax
+ 2ca:	c9                   	leave
+ 2cb:	c3                   	ret
+ 2cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002d0 <memmove>:
+{
+ 2d0:	55                   	push   %ebp
+ 2d1:	89 e5                	mov    %esp,%ebp
+ 2d3:	57                   	push   %edi
+ 2d4:	56                   	push   %esi
+ 2d5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2d8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2db:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+ 2de:	85 c0                	test   %eax,%eax
+ 2e0:	7e 13                	jle    2f5 <memmove+0x25>
+ 2e2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 2e4:	89 d7                	mov    %edx,%edi
+ 2e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ed:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 2f0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 2f1:	39 f8                	cmp    %edi,%eax
+ 2f3:	75 fb                	jne    2f0 <memmove+0x20>
+}
+ 2f5:	5e                   	pop    %esi
+ 2f6:	89 d0                	mov    %edx,%eax
+ 2f8:	5f                   	pop    %edi
+ 2f9:	5d                   	pop    %ebp
+ 2fa:	c3                   	ret
+ 2fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2ff:	90                   	nop
+
+00000300 <fork>:
+  if(flushhook)
+ 300:	a1 10 22 00 00       	mov    0x2210,%eax
+ 305:	85 c0                	test   %eax,%eax
+ 307:	74 17                	je     320 <fork+0x20>
+{
+ 309:	55                   	push   %ebp
+ 30a:	89 e5                	mov    %esp,%ebp
+ 30c:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+ 30f:	ff d0                	call   *%eax
+}
+ 311:	c9                   	leave
+  return _fork();
+ 312:	e9 21 02 00 00       	jmp    538 <_fork>
+ 317:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31e:	66 90                	xchg   %ax,%ax
+ 320:	e9 13 02 00 00       	jmp    538 <_fork>
+ 325:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 32c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000330 <exit>:
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+ 336:	a1 10 22 00 00       	mov    0x2210,%eax
+ 33b:	85 c0                	test   %eax,%eax
+ 33d:	74 02                	je     341 <exit+0x11>
+    flushhook();
+ 33f:	ff d0                	call   *%eax
+  _exit();
+ 341:	e8 fa 01 00 00       	call   540 <_exit>
+ 346:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000350 <exec>:
+{
+ 350:	55                   	push   %ebp
+  if(flushhook)
+ 351:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+ 356:	89 e5                	mov    %esp,%ebp
+ 358:	56                   	push   %esi
+ 359:	53                   	push   %ebx
+ 35a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 35d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+ 360:	85 c0                	test   %eax,%eax
+ 362:	74 02                	je     366 <exec+0x16>
+    flushhook();
+ 364:	ff d0                	call   *%eax
+  return _exec(path, argv);
+ 366:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 369:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 36c:	5b                   	pop    %ebx
+ 36d:	5e                   	pop    %esi
+ 36e:	5d                   	pop    %ebp
+  return _exec(path, argv);
+ 36f:	e9 04 02 00 00       	jmp    578 <_exec>
+ 374:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 37b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 37f:	90                   	nop
+
+00000380 <read>:
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+ 383:	57                   	push   %edi
+ 384:	56                   	push   %esi
+ 385:	53                   	push   %ebx
+ 386:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+ 389:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+ 38e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 391:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 394:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+ 397:	85 c0                	test   %eax,%eax
+ 399:	74 02                	je     39d <read+0x1d>
+    flushhook();
+ 39b:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+ 39d:	89 7d 10             	mov    %edi,0x10(%ebp)
+ 3a0:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 3a3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 3a6:	83 c4 0c             	add    $0xc,%esp
+ 3a9:	5b                   	pop    %ebx
+ 3aa:	5e                   	pop    %esi
+ 3ab:	5f                   	pop    %edi
+ 3ac:	5d                   	pop    %ebp
+  return _read(fd, buf, n);
+ 3ad:	e9 a6 01 00 00       	jmp    558 <_read>
+ 3b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003c0 <readv>:
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+ 3c3:	57                   	push   %edi
+ 3c4:	56                   	push   %esi
+ 3c5:	53                   	push   %ebx
+ 3c6:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+ 3c9:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+ 3ce:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 3d1:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 3d4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+ 3d7:	85 c0                	test   %eax,%eax
+ 3d9:	74 02                	je     3dd <readv+0x1d>
+    flushhook();
+ 3db:	ff d0                	call   *%eax
+  return _readv(fd, iov, cnt);
+ 3dd:	89 7d 10             	mov    %edi,0x10(%ebp)
+ 3e0:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 3e3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 3e6:	83 c4 0c             	add    $0xc,%esp
+ 3e9:	5b                   	pop    %ebx
+ 3ea:	5e                   	pop    %esi
+ 3eb:	5f                   	pop    %edi
+ 3ec:	5d                   	pop    %ebp
+  return _readv(fd, iov, cnt);
+ 3ed:	e9 76 02 00 00       	jmp    668 <_readv>
+ 3f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000400 <write>:
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	57                   	push   %edi
+ 404:	56                   	push   %esi
+ 405:	53                   	push   %ebx
+ 406:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+ 409:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+ 40e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 411:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 414:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+ 417:	85 c0                	test   %eax,%eax
+ 419:	74 02                	je     41d <write+0x1d>
+    flushhook();
+ 41b:	ff d0                	call   *%eax
+  return _write(fd, buf, n);
+ 41d:	89 7d 10             	mov    %edi,0x10(%ebp)
+ 420:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 423:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 426:	83 c4 0c             	add    $0xc,%esp
+ 429:	5b                   	pop    %ebx
+ 42a:	5e                   	pop    %esi
+ 42b:	5f                   	pop    %edi
+ 42c:	5d                   	pop    %ebp
+  return _write(fd, buf, n);
+ 42d:	e9 2e 01 00 00       	jmp    560 <_write>
+ 432:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 439:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000440 <writev>:
+{
+ 440:	55                   	push   %ebp
+ 441:	89 e5                	mov    %esp,%ebp
+ 443:	57                   	push   %edi
+ 444:	56                   	push   %esi
+ 445:	53                   	push   %ebx
+ 446:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+ 449:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+ 44e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 451:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 454:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+ 457:	85 c0                	test   %eax,%eax
+ 459:	74 02                	je     45d <writev+0x1d>
+    flushhook();
+ 45b:	ff d0                	call   *%eax
+  return _writev(fd, iov, cnt);
+ 45d:	89 7d 10             	mov    %edi,0x10(%ebp)
+ 460:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 463:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 466:	83 c4 0c             	add    $0xc,%esp
+ 469:	5b                   	pop    %ebx
+ 46a:	5e                   	pop    %esi
+ 46b:	5f                   	pop    %edi
+ 46c:	5d                   	pop    %ebp
+  return _writev(fd, iov, cnt);
+ 46d:	e9 fe 01 00 00       	jmp    670 <_writev>
+ 472:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 479:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000480 <close>:
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	53                   	push   %ebx
+ 484:	83 ec 04             	sub    $0x4,%esp
+  if(flushhook)
+ 487:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+ 48c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(flushhook)
+ 48f:	85 c0                	test   %eax,%eax
+ 491:	74 02                	je     495 <close+0x15>
+    flushhook();
+ 493:	ff d0                	call   *%eax
+  return _close(fd);
+ 495:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 498:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 49b:	c9                   	leave
+  return _close(fd);
+ 49c:	e9 c7 00 00 00       	jmp    568 <_close>
+ 4a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4af:	90                   	nop
+
+000004b0 <umtxinit>:
+// process that finds the mutex held enters the kernel, to sleep
+// in futexwait() until the holder's umtxunlock() wakes it.
+
+void
+umtxinit(struct umutex *m)
+{
+ 4b0:	55                   	push   %ebp
+ 4b1:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 4b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4b6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 4bc:	5d                   	pop    %ebp
+ 4bd:	c3                   	ret
+ 4be:	66 90                	xchg   %ax,%ax
+
+000004c0 <umtxlock>:
+
+void
+umtxlock(struct umutex *m)
+{
+ 4c0:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 4c1:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4c6:	89 e5                	mov    %esp,%ebp
+ 4c8:	56                   	push   %esi
+ 4c9:	53                   	push   %ebx
+ 4ca:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 4cd:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 1) == 0)
+ 4d0:	85 c0                	test   %eax,%eax
+ 4d2:	74 2b                	je     4ff <umtxlock+0x3f>
+ 4d4:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4d9:	f0 87 03             	lock xchg %eax,(%ebx)
+    return;
+  // Mark the mutex contended, so that its holder
+  // wakes a waiter on release, and wait.
+  while(xchg(&m->state, 2) != 0)
+ 4dc:	85 c0                	test   %eax,%eax
+ 4de:	74 1f                	je     4ff <umtxlock+0x3f>
+ 4e0:	be 02 00 00 00       	mov    $0x2,%esi
+ 4e5:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwait(&m->state, 2);
+ 4e8:	83 ec 08             	sub    $0x8,%esp
+ 4eb:	6a 02                	push   $0x2
+ 4ed:	53                   	push   %ebx
+ 4ee:	e8 85 01 00 00       	call   678 <futexwait>
+ 4f3:	89 f0                	mov    %esi,%eax
+ 4f5:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+ 4f8:	83 c4 10             	add    $0x10,%esp
+ 4fb:	85 c0                	test   %eax,%eax
+ 4fd:	75 e9                	jne    4e8 <umtxlock+0x28>
+}
+ 4ff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 502:	5b                   	pop    %ebx
+ 503:	5e                   	pop    %esi
+ 504:	5d                   	pop    %ebp
+ 505:	c3                   	ret
+ 506:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 50d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000510 <umtxunlock>:
+
+void
+umtxunlock(struct umutex *m)
+{
+ 510:	55                   	push   %ebp
+ 511:	31 c0                	xor    %eax,%eax
+ 513:	89 e5                	mov    %esp,%ebp
+ 515:	83 ec 08             	sub    $0x8,%esp
+ 518:	8b 55 08             	mov    0x8(%ebp),%edx
+ 51b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 51e:	83 f8 02             	cmp    $0x2,%eax
+ 521:	74 05                	je     528 <umtxunlock+0x18>
+    futexwake(&m->state, 1);
+}
+ 523:	c9                   	leave
+ 524:	c3                   	ret
+ 525:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwake(&m->state, 1);
+ 528:	83 ec 08             	sub    $0x8,%esp
+ 52b:	6a 01                	push   $0x1
+ 52d:	52                   	push   %edx
+ 52e:	e8 4d 01 00 00       	call   680 <futexwake>
+ 533:	83 c4 10             	add    $0x10,%esp
+}
+ 536:	c9                   	leave
+ 537:	c3                   	ret
+
+00000538 <_fork>:
+  _ ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+ 538:	b8 01 00 00 00       	mov    $0x1,%eax
+ 53d:	cd 40                	int    $0x40
+ 53f:	c3                   	ret
+
+00000540 <_exit>:
+RAWSYSCALL(exit)
+ 540:	b8 02 00 00 00       	mov    $0x2,%eax
+ 545:	cd 40                	int    $0x40
+ 547:	c3                   	ret
+
+00000548 <wait>:
+SYSCALL(wait)
+ 548:	b8 03 00 00 00       	mov    $0x3,%eax
+ 54d:	cd 40                	int    $0x40
+ 54f:	c3                   	ret
+
+00000550 <pipe>:
+SYSCALL(pipe)
+ 550:	b8 04 00 00 00       	mov    $0x4,%eax
+ 555:	cd 40                	int    $0x40
+ 557:	c3                   	ret
+
+00000558 <_read>:
+RAWSYSCALL(read)
+ 558:	b8 05 00 00 00       	mov    $0x5,%eax
+ 55d:	cd 40                	int    $0x40
+ 55f:	c3                   	ret
+
+00000560 <_write>:
+RAWSYSCALL(write)
+ 560:	b8 10 00 00 00       	mov    $0x10,%eax
+ 565:	cd 40                	int    $0x40
+ 567:	c3                   	ret
+
+00000568 <_close>:
+RAWSYSCALL(close)
+ 568:	b8 15 00 00 00       	mov    $0x15,%eax
+ 56d:	cd 40                	int    $0x40
+ 56f:	c3                   	ret
+
+00000570 <kill>:
+SYSCALL(kill)
+ 570:	b8 06 00 00 00       	mov    $0x6,%eax
+ 575:	cd 40                	int    $0x40
+ 577:	c3                   	ret
+
+00000578 <_exec>:
+RAWSYSCALL(exec)
+ 578:	b8 07 00 00 00       	mov    $0x7,%eax
+ 57d:	cd 40                	int    $0x40
+ 57f:	c3                   	ret
+
+00000580 <open>:
+SYSCALL(open)
+ 580:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 585:	cd 40                	int    $0x40
+ 587:	c3                   	ret
+
+00000588 <mknod>:
+SYSCALL(mknod)
+ 588:	b8 11 00 00 00       	mov    $0x11,%eax
+ 58d:	cd 40                	int    $0x40
+ 58f:	c3                   	ret
+
+00000590 <unlink>:
+SYSCALL(unlink)
+ 590:	b8 12 00 00 00       	mov    $0x12,%eax
+ 595:	cd 40                	int    $0x40
+ 597:	c3                   	ret
+
+00000598 <fstat>:
+SYSCALL(fstat)
+ 598:	b8 08 00 00 00       	mov    $0x8,%eax
+ 59d:	cd 40                	int    $0x40
+ 59f:	c3                   	ret
+
+000005a0 <link>:
+SYSCALL(link)
+ 5a0:	b8 13 00 00 00       	mov    $0x13,%eax
+ 5a5:	cd 40                	int    $0x40
+ 5a7:	c3                   	ret
+
+000005a8 <mkdir>:
+SYSCALL(mkdir)
+ 5a8:	b8 14 00 00 00       	mov    $0x14,%eax
+ 5ad:	cd 40                	int    $0x40
+ 5af:	c3                   	ret
+
+000005b0 <chdir>:
+SYSCALL(chdir)
+ 5b0:	b8 09 00 00 00       	mov    $0x9,%eax
+ 5b5:	cd 40                	int    $0x40
+ 5b7:	c3                   	ret
+
+000005b8 <dup>:
+SYSCALL(dup)
+ 5b8:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 5bd:	cd 40                	int    $0x40
+ 5bf:	c3                   	ret
+
+000005c0 <getpid>:
+SYSCALL(getpid)
+ 5c0:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 5c5:	cd 40                	int    $0x40
+ 5c7:	c3                   	ret
+
+000005c8 <sbrk>:
+SYSCALL(sbrk)
+ 5c8:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 5cd:	cd 40                	int    $0x40
+ 5cf:	c3                   	ret
+
+000005d0 <sleep>:
+SYSCALL(sleep)
+ 5d0:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 5d5:	cd 40                	int    $0x40
+ 5d7:	c3                   	ret
+
+000005d8 <uptime>:
+SYSCALL(uptime)
+ 5d8:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 5dd:	cd 40                	int    $0x40
+ 5df:	c3                   	ret
+
+000005e0 <wolfie>:
+SYSCALL(wolfie)
+ 5e0:	b8 16 00 00 00       	mov    $0x16,%eax
+ 5e5:	cd 40                	int    $0x40
+ 5e7:	c3                   	ret
+
+000005e8 <nice>:
+SYSCALL(nice)
+ 5e8:	b8 17 00 00 00       	mov    $0x17,%eax
+ 5ed:	cd 40                	int    $0x40
+ 5ef:	c3                   	ret
+
+000005f0 <mtxget>:
+SYSCALL(mtxget)
+ 5f0:	b8 18 00 00 00       	mov    $0x18,%eax
+ 5f5:	cd 40                	int    $0x40
+ 5f7:	c3                   	ret
+
+000005f8 <mtxrel>:
+SYSCALL(mtxrel)
+ 5f8:	b8 19 00 00 00       	mov    $0x19,%eax
+ 5fd:	cd 40                	int    $0x40
+ 5ff:	c3                   	ret
+
+00000600 <mtxacq>:
+SYSCALL(mtxacq)
+ 600:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 605:	cd 40                	int    $0x40
+ 607:	c3                   	ret
+
+00000608 <mtxdel>:
+SYSCALL(mtxdel)
+ 608:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 60d:	cd 40                	int    $0x40
+ 60f:	c3                   	ret
+
+00000610 <iostat>:
+SYSCALL(iostat)
+ 610:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 615:	cd 40                	int    $0x40
+ 617:	c3                   	ret
+
+00000618 <mmap>:
+SYSCALL(mmap)
+ 618:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 61d:	cd 40                	int    $0x40
+ 61f:	c3                   	ret
+
+00000620 <munmap>:
+SYSCALL(munmap)
+ 620:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 625:	cd 40                	int    $0x40
+ 627:	c3                   	ret
+
+00000628 <shmget>:
+SYSCALL(shmget)
+ 628:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 62d:	cd 40                	int    $0x40
+ 62f:	c3                   	ret
+
+00000630 <shmat>:
+SYSCALL(shmat)
+ 630:	b8 20 00 00 00       	mov    $0x20,%eax
+ 635:	cd 40                	int    $0x40
+ 637:	c3                   	ret
+
+00000638 <shmdt>:
+SYSCALL(shmdt)
+ 638:	b8 21 00 00 00       	mov    $0x21,%eax
+ 63d:	cd 40                	int    $0x40
+ 63f:	c3                   	ret
+
+00000640 <shmdel>:
+SYSCALL(shmdel)
+ 640:	b8 22 00 00 00       	mov    $0x22,%eax
+ 645:	cd 40                	int    $0x40
+ 647:	c3                   	ret
+
+00000648 <syscount>:
+SYSCALL(syscount)
+ 648:	b8 23 00 00 00       	mov    $0x23,%eax
+ 64d:	cd 40                	int    $0x40
+ 64f:	c3                   	ret
+
+00000650 <splice>:
+SYSCALL(splice)
+ 650:	b8 24 00 00 00       	mov    $0x24,%eax
+ 655:	cd 40                	int    $0x40
+ 657:	c3                   	ret
+
+00000658 <tee>:
+SYSCALL(tee)
+ 658:	b8 25 00 00 00       	mov    $0x25,%eax
+ 65d:	cd 40                	int    $0x40
+ 65f:	c3                   	ret
+
+00000660 <sendfile>:
+SYSCALL(sendfile)
+ 660:	b8 26 00 00 00       	mov    $0x26,%eax
+ 665:	cd 40                	int    $0x40
+ 667:	c3                   	ret
+
+00000668 <_readv>:
+RAWSYSCALL(readv)
+ 668:	b8 27 00 00 00       	mov    $0x27,%eax
+ 66d:	cd 40                	int    $0x40
+ 66f:	c3                   	ret
+
+00000670 <_writev>:
+RAWSYSCALL(writev)
+ 670:	b8 28 00 00 00       	mov    $0x28,%eax
+ 675:	cd 40                	int    $0x40
+ 677:	c3                   	ret
+
+00000678 <futexwait>:
+SYSCALL(futexwait)
+ 678:	b8 29 00 00 00       	mov    $0x29,%eax
+ 67d:	cd 40                	int    $0x40
+ 67f:	c3                   	ret
+
+00000680 <futexwake>:
+SYSCALL(futexwake)
+ 680:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 685:	cd 40                	int    $0x40
+ 687:	c3                   	ret
+
+00000688 <lockstat>:
+SYSCALL(lockstat)
+ 688:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 68d:	cd 40                	int    $0x40
+ 68f:	c3                   	ret
+
+00000690 <clone>:
+SYSCALL(clone)
+ 690:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 695:	cd 40                	int    $0x40
+ 697:	c3                   	ret
+
+00000698 <join>:
+SYSCALL(join)
+ 698:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 69d:	cd 40                	int    $0x40
+ 69f:	c3                   	ret
+
+000006a0 <stacklimit>:
+SYSCALL(stacklimit)
+ 6a0:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 6a5:	cd 40                	int    $0x40
+ 6a7:	c3                   	ret
+ 6a8:	66 90                	xchg   %ax,%ax
+ 6aa:	66 90                	xchg   %ax,%ax
+ 6ac:	66 90                	xchg   %ax,%ax
+ 6ae:	66 90                	xchg   %ax,%ax
+
+000006b0 <flushall>:
+  b->n = 0;
+}
+
+static void
+flushall(void)
+{
+ 6b0:	55                   	push   %ebp
+ 6b1:	89 e5                	mov    %esp,%ebp
+ 6b3:	83 ec 14             	sub    $0x14,%esp
+  umtxlock(&stdoutlock);
+ 6b6:	68 14 22 00 00       	push   $0x2214
+ 6bb:	e8 00 fe ff ff       	call   4c0 <umtxlock>
+  if(b->n > 0)
+ 6c0:	a1 08 20 00 00       	mov    0x2008,%eax
+ 6c5:	83 c4 10             	add    $0x10,%esp
+ 6c8:	85 c0                	test   %eax,%eax
+ 6ca:	7e 17                	jle    6e3 <flushall+0x33>
+    _write(b->fd, b->buf, b->n);
+ 6cc:	83 ec 04             	sub    $0x4,%esp
+ 6cf:	50                   	push   %eax
+ 6d0:	68 0c 20 00 00       	push   $0x200c
+ 6d5:	ff 35 00 20 00 00    	push   0x2000
+ 6db:	e8 80 fe ff ff       	call   560 <_write>
+ 6e0:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+ 6e3:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+ 6ea:	00 00 00 
+  flush(&stdout);
+  umtxunlock(&stdoutlock);
+ 6ed:	83 ec 0c             	sub    $0xc,%esp
+ 6f0:	68 14 22 00 00       	push   $0x2214
+ 6f5:	e8 16 fe ff ff       	call   510 <umtxunlock>
+}
+ 6fa:	83 c4 10             	add    $0x10,%esp
+ 6fd:	c9                   	leave
+ 6fe:	c3                   	ret
+ 6ff:	90                   	nop
+
+00000700 <printint>:
+    flush(b);
+}
+
+static void
+printint(struct outbuf *b, int xx, int base, int sgn)
+{
+ 700:	55                   	push   %ebp
+ 701:	89 e5                	mov    %esp,%ebp
+ 703:	57                   	push   %edi
+ 704:	89 cf                	mov    %ecx,%edi
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 706:	89 d1                	mov    %edx,%ecx
+{
+ 708:	56                   	push   %esi
+ 709:	53                   	push   %ebx
+ 70a:	89 c3                	mov    %eax,%ebx
+ 70c:	83 ec 2c             	sub    $0x2c,%esp
+  if(sgn && xx < 0){
+ 70f:	85 d2                	test   %edx,%edx
+ 711:	0f 89 b9 00 00 00    	jns    7d0 <printint+0xd0>
+ 717:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 71b:	0f 84 af 00 00 00    	je     7d0 <printint+0xd0>
+    x = -xx;
+ 721:	f7 d9                	neg    %ecx
+    neg = 1;
+ 723:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 728:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 72b:	31 f6                	xor    %esi,%esi
+ 72d:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 730:	89 c8                	mov    %ecx,%eax
+ 732:	31 d2                	xor    %edx,%edx
+ 734:	89 f3                	mov    %esi,%ebx
+ 736:	f7 f7                	div    %edi
+ 738:	8d 76 01             	lea    0x1(%esi),%esi
+ 73b:	0f b6 92 24 13 00 00 	movzbl 0x1324(%edx),%edx
+ 742:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 746:	89 ca                	mov    %ecx,%edx
+ 748:	89 c1                	mov    %eax,%ecx
+ 74a:	39 fa                	cmp    %edi,%edx
+ 74c:	73 e2                	jae    730 <printint+0x30>
+  if(neg)
+ 74e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 751:	89 d9                	mov    %ebx,%ecx
+ 753:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 756:	85 c0                	test   %eax,%eax
+ 758:	74 07                	je     761 <printint+0x61>
+    buf[i++] = '-';
+ 75a:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 75f:	89 f1                	mov    %esi,%ecx
+ 761:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 764:	89 cf                	mov    %ecx,%edi
+ 766:	01 f7                	add    %esi,%edi
+ 768:	eb 1a                	jmp    784 <printint+0x84>
+ 76a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    *b->str++ = c;
+ 770:	8d 48 01             	lea    0x1(%eax),%ecx
+ 773:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+ 779:	88 10                	mov    %dl,(%eax)
+
+  while(--i >= 0)
+ 77b:	8d 47 ff             	lea    -0x1(%edi),%eax
+ 77e:	39 fe                	cmp    %edi,%esi
+ 780:	74 40                	je     7c2 <printint+0xc2>
+ 782:	89 c7                	mov    %eax,%edi
+  if(b->str){
+ 784:	8b 83 0c 02 00 00    	mov    0x20c(%ebx),%eax
+    putc(b, buf[i]);
+ 78a:	0f b6 17             	movzbl (%edi),%edx
+  if(b->str){
+ 78d:	85 c0                	test   %eax,%eax
+ 78f:	75 df                	jne    770 <printint+0x70>
+  b->buf[b->n++] = c;
+ 791:	8b 4b 08             	mov    0x8(%ebx),%ecx
+ 794:	8d 41 01             	lea    0x1(%ecx),%eax
+ 797:	89 43 08             	mov    %eax,0x8(%ebx)
+ 79a:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+ 79e:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 7a3:	74 3b                	je     7e0 <printint+0xe0>
+ 7a5:	80 fa 0a             	cmp    $0xa,%dl
+ 7a8:	75 d1                	jne    77b <printint+0x7b>
+ 7aa:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+ 7ae:	75 cb                	jne    77b <printint+0x7b>
+  if(b->n > 0)
+ 7b0:	85 c0                	test   %eax,%eax
+ 7b2:	7f 2c                	jg     7e0 <printint+0xe0>
+  b->n = 0;
+ 7b4:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  while(--i >= 0)
+ 7bb:	8d 47 ff             	lea    -0x1(%edi),%eax
+ 7be:	39 fe                	cmp    %edi,%esi
+ 7c0:	75 c0                	jne    782 <printint+0x82>
+}
+ 7c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7c5:	5b                   	pop    %ebx
+ 7c6:	5e                   	pop    %esi
+ 7c7:	5f                   	pop    %edi
+ 7c8:	5d                   	pop    %ebp
+ 7c9:	c3                   	ret
+ 7ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  neg = 0;
+ 7d0:	31 c0                	xor    %eax,%eax
+ 7d2:	e9 51 ff ff ff       	jmp    728 <printint+0x28>
+ 7d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7de:	66 90                	xchg   %ax,%ax
+    _write(b->fd, b->buf, b->n);
+ 7e0:	83 ec 04             	sub    $0x4,%esp
+ 7e3:	50                   	push   %eax
+ 7e4:	8d 43 0c             	lea    0xc(%ebx),%eax
+ 7e7:	50                   	push   %eax
+ 7e8:	ff 33                	push   (%ebx)
+ 7ea:	e8 71 fd ff ff       	call   560 <_write>
+ 7ef:	83 c4 10             	add    $0x10,%esp
+ 7f2:	eb c0                	jmp    7b4 <printint+0xb4>
+ 7f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7ff:	90                   	nop
+
+00000800 <putc>:
+{
+ 800:	55                   	push   %ebp
+ 801:	89 e5                	mov    %esp,%ebp
+ 803:	53                   	push   %ebx
+ 804:	89 c3                	mov    %eax,%ebx
+ 806:	83 ec 04             	sub    $0x4,%esp
+  if(b->str){
+ 809:	8b 80 0c 02 00 00    	mov    0x20c(%eax),%eax
+ 80f:	85 c0                	test   %eax,%eax
+ 811:	74 15                	je     828 <putc+0x28>
+    *b->str++ = c;
+ 813:	8d 48 01             	lea    0x1(%eax),%ecx
+ 816:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+ 81c:	88 10                	mov    %dl,(%eax)
+}
+ 81e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 821:	c9                   	leave
+ 822:	c3                   	ret
+ 823:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 827:	90                   	nop
+  b->buf[b->n++] = c;
+ 828:	8b 4b 08             	mov    0x8(%ebx),%ecx
+ 82b:	8d 41 01             	lea    0x1(%ecx),%eax
+ 82e:	89 43 08             	mov    %eax,0x8(%ebx)
+ 831:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+ 835:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 83a:	74 14                	je     850 <putc+0x50>
+ 83c:	80 fa 0a             	cmp    $0xa,%dl
+ 83f:	75 dd                	jne    81e <putc+0x1e>
+ 841:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+ 845:	75 d7                	jne    81e <putc+0x1e>
+  if(b->n > 0)
+ 847:	85 c0                	test   %eax,%eax
+ 849:	7e 17                	jle    862 <putc+0x62>
+ 84b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 84f:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+ 850:	83 ec 04             	sub    $0x4,%esp
+ 853:	50                   	push   %eax
+ 854:	8d 43 0c             	lea    0xc(%ebx),%eax
+ 857:	50                   	push   %eax
+ 858:	ff 33                	push   (%ebx)
+ 85a:	e8 01 fd ff ff       	call   560 <_write>
+ 85f:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+ 862:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+ 869:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 86c:	c9                   	leave
+ 86d:	c3                   	ret
+ 86e:	66 90                	xchg   %ax,%ax
+
+00000870 <format>:
+
+// Format fmt and the arguments at ap into b.
+// Only understands %d, %x, %p, %s, %c.
+static void
+format(struct outbuf *b, const char *fmt, uint *ap)
+{
+ 870:	55                   	push   %ebp
+ 871:	89 e5                	mov    %esp,%ebp
+ 873:	57                   	push   %edi
+ 874:	89 c7                	mov    %eax,%edi
+ 876:	56                   	push   %esi
+ 877:	53                   	push   %ebx
+ 878:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+ 87b:	0f b6 02             	movzbl (%edx),%eax
+{
+ 87e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 881:	84 c0                	test   %al,%al
+ 883:	74 5a                	je     8df <format+0x6f>
+ 885:	8d 5a 01             	lea    0x1(%edx),%ebx
+ 888:	31 f6                	xor    %esi,%esi
+ 88a:	eb 1c                	jmp    8a8 <format+0x38>
+ 88c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+ 890:	83 f8 25             	cmp    $0x25,%eax
+ 893:	74 3b                	je     8d0 <format+0x60>
+        state = '%';
+      } else {
+        putc(b, c);
+ 895:	89 ca                	mov    %ecx,%edx
+ 897:	89 f8                	mov    %edi,%eax
+ 899:	e8 62 ff ff ff       	call   800 <putc>
+  for(i = 0; fmt[i]; i++){
+ 89e:	0f b6 03             	movzbl (%ebx),%eax
+ 8a1:	83 c3 01             	add    $0x1,%ebx
+ 8a4:	84 c0                	test   %al,%al
+ 8a6:	74 37                	je     8df <format+0x6f>
+    c = fmt[i] & 0xff;
+ 8a8:	0f be c8             	movsbl %al,%ecx
+ 8ab:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 8ae:	85 f6                	test   %esi,%esi
+ 8b0:	74 de                	je     890 <format+0x20>
+      }
+    } else if(state == '%'){
+ 8b2:	83 fe 25             	cmp    $0x25,%esi
+ 8b5:	75 e7                	jne    89e <format+0x2e>
+      if(c == 'd'){
+ 8b7:	83 f8 25             	cmp    $0x25,%eax
+ 8ba:	74 46                	je     902 <format+0x92>
+ 8bc:	83 e8 63             	sub    $0x63,%eax
+ 8bf:	83 f8 15             	cmp    $0x15,%eax
+ 8c2:	77 2c                	ja     8f0 <format+0x80>
+ 8c4:	ff 24 85 cc 12 00 00 	jmp    *0x12cc(,%eax,4)
+ 8cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8cf:	90                   	nop
+  for(i = 0; fmt[i]; i++){
+ 8d0:	0f b6 03             	movzbl (%ebx),%eax
+ 8d3:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+ 8d6:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+ 8db:	84 c0                	test   %al,%al
+ 8dd:	75 c9                	jne    8a8 <format+0x38>
+        putc(b, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 8df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8e2:	5b                   	pop    %ebx
+ 8e3:	5e                   	pop    %esi
+ 8e4:	5f                   	pop    %edi
+ 8e5:	5d                   	pop    %ebp
+ 8e6:	c3                   	ret
+ 8e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8ee:	66 90                	xchg   %ax,%ax
+        putc(b, '%');
+ 8f0:	ba 25 00 00 00       	mov    $0x25,%edx
+ 8f5:	89 f8                	mov    %edi,%eax
+ 8f7:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+ 8fa:	e8 01 ff ff ff       	call   800 <putc>
+        putc(b, c);
+ 8ff:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ 902:	89 ca                	mov    %ecx,%edx
+ 904:	89 f8                	mov    %edi,%eax
+      state = 0;
+ 906:	31 f6                	xor    %esi,%esi
+        putc(b, c);
+ 908:	e8 f3 fe ff ff       	call   800 <putc>
+ 90d:	eb 8f                	jmp    89e <format+0x2e>
+ 90f:	90                   	nop
+        printint(b, *ap, 16, 0);
+ 910:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+ 913:	83 ec 0c             	sub    $0xc,%esp
+ 916:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 91b:	8b 16                	mov    (%esi),%edx
+ 91d:	6a 00                	push   $0x0
+        ap++;
+ 91f:	83 c6 04             	add    $0x4,%esi
+        printint(b, *ap, 16, 0);
+ 922:	89 f8                	mov    %edi,%eax
+ 924:	e8 d7 fd ff ff       	call   700 <printint>
+        ap++;
+ 929:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+ 92c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 92f:	31 f6                	xor    %esi,%esi
+ 931:	e9 68 ff ff ff       	jmp    89e <format+0x2e>
+ 936:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 93d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 940:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 943:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 945:	83 c0 04             	add    $0x4,%eax
+ 948:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 94b:	85 f6                	test   %esi,%esi
+ 94d:	75 1b                	jne    96a <format+0xfa>
+ 94f:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+ 954:	be c4 12 00 00       	mov    $0x12c4,%esi
+ 959:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+          putc(b, *s);
+ 960:	89 f8                	mov    %edi,%eax
+          s++;
+ 962:	83 c6 01             	add    $0x1,%esi
+          putc(b, *s);
+ 965:	e8 96 fe ff ff       	call   800 <putc>
+        while(*s != 0){
+ 96a:	0f be 16             	movsbl (%esi),%edx
+ 96d:	84 d2                	test   %dl,%dl
+ 96f:	75 ef                	jne    960 <format+0xf0>
+      state = 0;
+ 971:	31 f6                	xor    %esi,%esi
+ 973:	e9 26 ff ff ff       	jmp    89e <format+0x2e>
+ 978:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 97f:	90                   	nop
+        printint(b, *ap, 10, 1);
+ 980:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+ 983:	83 ec 0c             	sub    $0xc,%esp
+ 986:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 98b:	8b 16                	mov    (%esi),%edx
+ 98d:	6a 01                	push   $0x1
+ 98f:	eb 8e                	jmp    91f <format+0xaf>
+ 991:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(b, *ap);
+ 998:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+ 99b:	89 f8                	mov    %edi,%eax
+ 99d:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+ 9a0:	83 c6 04             	add    $0x4,%esi
+        putc(b, *ap);
+ 9a3:	e8 58 fe ff ff       	call   800 <putc>
+        ap++;
+ 9a8:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      state = 0;
+ 9ab:	31 f6                	xor    %esi,%esi
+ 9ad:	e9 ec fe ff ff       	jmp    89e <format+0x2e>
+ 9b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000009c0 <fflush>:
+{
+ 9c0:	55                   	push   %ebp
+ 9c1:	89 e5                	mov    %esp,%ebp
+ 9c3:	83 ec 08             	sub    $0x8,%esp
+  if(fd == stdout.fd)
+ 9c6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9c9:	39 05 00 20 00 00    	cmp    %eax,0x2000
+ 9cf:	74 07                	je     9d8 <fflush+0x18>
+}
+ 9d1:	c9                   	leave
+ 9d2:	c3                   	ret
+ 9d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9d7:	90                   	nop
+  umtxlock(&stdoutlock);
+ 9d8:	83 ec 0c             	sub    $0xc,%esp
+ 9db:	68 14 22 00 00       	push   $0x2214
+ 9e0:	e8 db fa ff ff       	call   4c0 <umtxlock>
+  if(b->n > 0)
+ 9e5:	a1 08 20 00 00       	mov    0x2008,%eax
+ 9ea:	83 c4 10             	add    $0x10,%esp
+ 9ed:	85 c0                	test   %eax,%eax
+ 9ef:	7f 1f                	jg     a10 <fflush+0x50>
+  b->n = 0;
+ 9f1:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+ 9f8:	00 00 00 
+  umtxunlock(&stdoutlock);
+ 9fb:	c7 45 08 14 22 00 00 	movl   $0x2214,0x8(%ebp)
+}
+ a02:	c9                   	leave
+  umtxunlock(&stdoutlock);
+ a03:	e9 08 fb ff ff       	jmp    510 <umtxunlock>
+ a08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a0f:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+ a10:	83 ec 04             	sub    $0x4,%esp
+ a13:	50                   	push   %eax
+ a14:	68 0c 20 00 00       	push   $0x200c
+ a19:	ff 35 00 20 00 00    	push   0x2000
+ a1f:	e8 3c fb ff ff       	call   560 <_write>
+ a24:	83 c4 10             	add    $0x10,%esp
+ a27:	eb c8                	jmp    9f1 <fflush+0x31>
+ a29:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000a30 <setvbuf>:
+{
+ a30:	55                   	push   %ebp
+ a31:	89 e5                	mov    %esp,%ebp
+ a33:	53                   	push   %ebx
+ a34:	83 ec 04             	sub    $0x4,%esp
+ a37:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd != stdout.fd)
+ a3a:	8b 45 08             	mov    0x8(%ebp),%eax
+ a3d:	39 05 00 20 00 00    	cmp    %eax,0x2000
+ a43:	74 0b                	je     a50 <setvbuf+0x20>
+}
+ a45:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ a48:	c9                   	leave
+ a49:	c3                   	ret
+ a4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  umtxlock(&stdoutlock);
+ a50:	83 ec 0c             	sub    $0xc,%esp
+ a53:	68 14 22 00 00       	push   $0x2214
+ a58:	e8 63 fa ff ff       	call   4c0 <umtxlock>
+  if(b->n > 0)
+ a5d:	a1 08 20 00 00       	mov    0x2008,%eax
+ a62:	83 c4 10             	add    $0x10,%esp
+ a65:	85 c0                	test   %eax,%eax
+ a67:	7f 2f                	jg     a98 <setvbuf+0x68>
+  b->n = 0;
+ a69:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+ a70:	00 00 00 
+  stdout.mode = mode;
+ a73:	89 1d 04 20 00 00    	mov    %ebx,0x2004
+  flushhook = flushall;
+ a79:	c7 05 10 22 00 00 b0 	movl   $0x6b0,0x2210
+ a80:	06 00 00 
+}
+ a83:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&stdoutlock);
+ a86:	c7 45 08 14 22 00 00 	movl   $0x2214,0x8(%ebp)
+}
+ a8d:	c9                   	leave
+  umtxunlock(&stdoutlock);
+ a8e:	e9 7d fa ff ff       	jmp    510 <umtxunlock>
+ a93:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a97:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+ a98:	83 ec 04             	sub    $0x4,%esp
+ a9b:	50                   	push   %eax
+ a9c:	68 0c 20 00 00       	push   $0x200c
+ aa1:	ff 35 00 20 00 00    	push   0x2000
+ aa7:	e8 b4 fa ff ff       	call   560 <_write>
+ aac:	83 c4 10             	add    $0x10,%esp
+ aaf:	eb b8                	jmp    a69 <setvbuf+0x39>
+ ab1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ab8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ abf:	90                   	nop
+
+00000ac0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s, %c.
+void
+printf(int fd, const char *fmt, ...)
+{
+ ac0:	55                   	push   %ebp
+ ac1:	89 e5                	mov    %esp,%ebp
+ ac3:	53                   	push   %ebx
+ ac4:	81 ec 14 02 00 00    	sub    $0x214,%esp
+ aca:	8b 45 08             	mov    0x8(%ebp),%eax
+    local.mode = _IONBF;
+    local.n = 0;
+    local.str = 0;
+    b = &local;
+  }
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+ acd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd == stdout.fd){
+ ad0:	39 05 00 20 00 00    	cmp    %eax,0x2000
+ ad6:	74 48                	je     b20 <printf+0x60>
+    local.fd = fd;
+ ad8:	89 85 e8 fd ff ff    	mov    %eax,-0x218(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+ ade:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ ae1:	89 da                	mov    %ebx,%edx
+ ae3:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+    local.mode = _IONBF;
+ ae9:	c7 85 ec fd ff ff 03 	movl   $0x3,-0x214(%ebp)
+ af0:	00 00 00 
+    local.n = 0;
+ af3:	c7 85 f0 fd ff ff 00 	movl   $0x0,-0x210(%ebp)
+ afa:	00 00 00 
+    local.str = 0;
+ afd:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+ b04:	e8 67 fd ff ff       	call   870 <format>
+  if(b->mode == _IONBF)
+ b09:	83 bd ec fd ff ff 03 	cmpl   $0x3,-0x214(%ebp)
+ b10:	0f 84 a2 00 00 00    	je     bb8 <printf+0xf8>
+    flush(b);
+  if(b == &stdout)
+    umtxunlock(&stdoutlock);
+}
+ b16:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ b19:	c9                   	leave
+ b1a:	c3                   	ret
+ b1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b1f:	90                   	nop
+    umtxlock(&stdoutlock);
+ b20:	83 ec 0c             	sub    $0xc,%esp
+ b23:	68 14 22 00 00       	push   $0x2214
+ b28:	e8 93 f9 ff ff       	call   4c0 <umtxlock>
+  if(stdout.mode == 0){
+ b2d:	a1 04 20 00 00       	mov    0x2004,%eax
+ b32:	83 c4 10             	add    $0x10,%esp
+ b35:	85 c0                	test   %eax,%eax
+ b37:	74 37                	je     b70 <printf+0xb0>
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+ b39:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ b3c:	89 da                	mov    %ebx,%edx
+ b3e:	b8 00 20 00 00       	mov    $0x2000,%eax
+ b43:	e8 28 fd ff ff       	call   870 <format>
+  if(b->mode == _IONBF)
+ b48:	83 3d 04 20 00 00 03 	cmpl   $0x3,0x2004
+ b4f:	0f 84 ab 00 00 00    	je     c00 <printf+0x140>
+    umtxunlock(&stdoutlock);
+ b55:	83 ec 0c             	sub    $0xc,%esp
+ b58:	68 14 22 00 00       	push   $0x2214
+ b5d:	e8 ae f9 ff ff       	call   510 <umtxunlock>
+}
+ b62:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    umtxunlock(&stdoutlock);
+ b65:	83 c4 10             	add    $0x10,%esp
+}
+ b68:	c9                   	leave
+ b69:	c3                   	ret
+ b6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+ b70:	83 ec 08             	sub    $0x8,%esp
+ b73:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+ b79:	50                   	push   %eax
+ b7a:	ff 35 00 20 00 00    	push   0x2000
+ b80:	e8 13 fa ff ff       	call   598 <fstat>
+ b85:	83 c4 10             	add    $0x10,%esp
+ b88:	89 c2                	mov    %eax,%edx
+      stdout.mode = _IOFBF;
+ b8a:	b8 01 00 00 00       	mov    $0x1,%eax
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+ b8f:	85 d2                	test   %edx,%edx
+ b91:	75 10                	jne    ba3 <printf+0xe3>
+      stdout.mode = _IOLBF;
+ b93:	31 c0                	xor    %eax,%eax
+ b95:	66 83 bd e8 fd ff ff 	cmpw   $0x3,-0x218(%ebp)
+ b9c:	03 
+ b9d:	0f 94 c0             	sete   %al
+ ba0:	83 c0 01             	add    $0x1,%eax
+ ba3:	a3 04 20 00 00       	mov    %eax,0x2004
+    flushhook = flushall;
+ ba8:	c7 05 10 22 00 00 b0 	movl   $0x6b0,0x2210
+ baf:	06 00 00 
+ bb2:	eb 85                	jmp    b39 <printf+0x79>
+ bb4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(b->n > 0)
+ bb8:	8b 85 f0 fd ff ff    	mov    -0x210(%ebp),%eax
+ bbe:	85 c0                	test   %eax,%eax
+ bc0:	0f 8e 50 ff ff ff    	jle    b16 <printf+0x56>
+    b = &local;
+ bc6:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+    _write(b->fd, b->buf, b->n);
+ bcc:	83 ec 04             	sub    $0x4,%esp
+ bcf:	50                   	push   %eax
+ bd0:	8d 43 0c             	lea    0xc(%ebx),%eax
+ bd3:	50                   	push   %eax
+ bd4:	ff 33                	push   (%ebx)
+ bd6:	e8 85 f9 ff ff       	call   560 <_write>
+  b->n = 0;
+ bdb:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  if(b == &stdout)
+ be2:	83 c4 10             	add    $0x10,%esp
+ be5:	81 fb 00 20 00 00    	cmp    $0x2000,%ebx
+ beb:	0f 85 25 ff ff ff    	jne    b16 <printf+0x56>
+ bf1:	e9 5f ff ff ff       	jmp    b55 <printf+0x95>
+ bf6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bfd:	8d 76 00             	lea    0x0(%esi),%esi
+  if(b->n > 0)
+ c00:	a1 08 20 00 00       	mov    0x2008,%eax
+    b = getstdout();
+ c05:	bb 00 20 00 00       	mov    $0x2000,%ebx
+  if(b->n > 0)
+ c0a:	85 c0                	test   %eax,%eax
+ c0c:	7f be                	jg     bcc <printf+0x10c>
+  b->n = 0;
+ c0e:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+ c15:	00 00 00 
+  if(b == &stdout)
+ c18:	e9 38 ff ff ff       	jmp    b55 <printf+0x95>
+ c1d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000c20 <sprintf>:
+
+// Print to the given buffer. Only understands %d, %x, %p, %s, %c.
+int
+sprintf(char *str, const char *fmt, ...)
+{
+ c20:	55                   	push   %ebp
+ c21:	89 e5                	mov    %esp,%ebp
+ c23:	53                   	push   %ebx
+  struct outbuf b;
+
+  b.str = str;
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+ c24:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+ c2a:	8d 4d 10             	lea    0x10(%ebp),%ecx
+{
+ c2d:	81 ec 14 02 00 00    	sub    $0x214,%esp
+ c33:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+ c36:	8b 55 0c             	mov    0xc(%ebp),%edx
+  b.str = str;
+ c39:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+ c3c:	e8 2f fc ff ff       	call   870 <format>
+  *b.str = '\0';
+ c41:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c44:	c6 00 00             	movb   $0x0,(%eax)
+  return b.str - str;
+ c47:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c4a:	29 d8                	sub    %ebx,%eax
+}
+ c4c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ c4f:	c9                   	leave
+ c50:	c3                   	ret
+ c51:	66 90                	xchg   %ax,%ax
+ c53:	66 90                	xchg   %ax,%ax
+ c55:	66 90                	xchg   %ax,%ax
+ c57:	66 90                	xchg   %ax,%ax
+ c59:	66 90                	xchg   %ax,%ax
+ c5b:	66 90                	xchg   %ax,%ax
+ c5d:	66 90                	xchg   %ax,%ax
+ c5f:	90                   	nop
+
+00000c60 <freeblock>:
+static Header *freep;
+static struct umutex lock;  // threads made by clone() share the heap
+
+static void
+freeblock(void *ap)
+{
+ c60:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ c61:	8d 48 f8             	lea    -0x8(%eax),%ecx
+{
+ c64:	89 e5                	mov    %esp,%ebp
+ c66:	57                   	push   %edi
+ c67:	56                   	push   %esi
+ c68:	53                   	push   %ebx
+ c69:	89 c3                	mov    %eax,%ebx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c6b:	a1 1c 22 00 00       	mov    0x221c,%eax
+ c70:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c72:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c74:	39 ca                	cmp    %ecx,%edx
+ c76:	73 30                	jae    ca8 <freeblock+0x48>
+ c78:	39 c1                	cmp    %eax,%ecx
+ c7a:	72 04                	jb     c80 <freeblock+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c7c:	39 c2                	cmp    %eax,%edx
+ c7e:	72 f0                	jb     c70 <freeblock+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ c80:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ c83:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ c86:	39 f8                	cmp    %edi,%eax
+ c88:	74 26                	je     cb0 <freeblock+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c8a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ c8d:	8b 42 04             	mov    0x4(%edx),%eax
+ c90:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ c93:	39 f1                	cmp    %esi,%ecx
+ c95:	74 30                	je     cc7 <freeblock+0x67>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ c97:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ c99:	5b                   	pop    %ebx
+  freep = p;
+ c9a:	89 15 1c 22 00 00    	mov    %edx,0x221c
+}
+ ca0:	5e                   	pop    %esi
+ ca1:	5f                   	pop    %edi
+ ca2:	5d                   	pop    %ebp
+ ca3:	c3                   	ret
+ ca4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ ca8:	39 c1                	cmp    %eax,%ecx
+ caa:	72 d0                	jb     c7c <freeblock+0x1c>
+ cac:	eb c2                	jmp    c70 <freeblock+0x10>
+ cae:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ cb0:	03 70 04             	add    0x4(%eax),%esi
+ cb3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ cb6:	8b 02                	mov    (%edx),%eax
+ cb8:	8b 00                	mov    (%eax),%eax
+ cba:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ cbd:	8b 42 04             	mov    0x4(%edx),%eax
+ cc0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ cc3:	39 f1                	cmp    %esi,%ecx
+ cc5:	75 d0                	jne    c97 <freeblock+0x37>
+    p->s.size += bp->s.size;
+ cc7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ cca:	89 15 1c 22 00 00    	mov    %edx,0x221c
+    p->s.size += bp->s.size;
+ cd0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ cd3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ cd6:	89 0a                	mov    %ecx,(%edx)
+}
+ cd8:	5b                   	pop    %ebx
+ cd9:	5e                   	pop    %esi
+ cda:	5f                   	pop    %edi
+ cdb:	5d                   	pop    %ebp
+ cdc:	c3                   	ret
+ cdd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ce0 <free>:
+
+void
+free(void *ap)
+{
+ ce0:	55                   	push   %ebp
+ ce1:	89 e5                	mov    %esp,%ebp
+ ce3:	53                   	push   %ebx
+ ce4:	83 ec 10             	sub    $0x10,%esp
+ ce7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  umtxlock(&lock);
+ cea:	68 18 22 00 00       	push   $0x2218
+ cef:	e8 cc f7 ff ff       	call   4c0 <umtxlock>
+  freeblock(ap);
+ cf4:	89 d8                	mov    %ebx,%eax
+ cf6:	e8 65 ff ff ff       	call   c60 <freeblock>
+  umtxunlock(&lock);
+ cfb:	c7 45 08 18 22 00 00 	movl   $0x2218,0x8(%ebp)
+}
+ d02:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&lock);
+ d05:	83 c4 10             	add    $0x10,%esp
+}
+ d08:	c9                   	leave
+  umtxunlock(&lock);
+ d09:	e9 02 f8 ff ff       	jmp    510 <umtxunlock>
+ d0e:	66 90                	xchg   %ax,%ax
+
+00000d10 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ d10:	55                   	push   %ebp
+ d11:	89 e5                	mov    %esp,%ebp
+ d13:	57                   	push   %edi
+ d14:	56                   	push   %esi
+ d15:	53                   	push   %ebx
+ d16:	83 ec 28             	sub    $0x28,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d19:	8b 45 08             	mov    0x8(%ebp),%eax
+  umtxlock(&lock);
+ d1c:	68 18 22 00 00       	push   $0x2218
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d21:	8d 48 07             	lea    0x7(%eax),%ecx
+ d24:	c1 e9 03             	shr    $0x3,%ecx
+ d27:	8d 71 01             	lea    0x1(%ecx),%esi
+  umtxlock(&lock);
+ d2a:	e8 91 f7 ff ff       	call   4c0 <umtxlock>
+  if((prevp = freep) == 0){
+ d2f:	8b 15 1c 22 00 00    	mov    0x221c,%edx
+ d35:	83 c4 10             	add    $0x10,%esp
+ d38:	85 d2                	test   %edx,%edx
+ d3a:	0f 84 b0 00 00 00    	je     df0 <malloc+0xe0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d40:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ d42:	8b 47 04             	mov    0x4(%edi),%eax
+ d45:	39 f0                	cmp    %esi,%eax
+ d47:	73 6f                	jae    db8 <malloc+0xa8>
+  if(nu < 4096)
+ d49:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ d4e:	39 de                	cmp    %ebx,%esi
+ d50:	0f 43 de             	cmovae %esi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ d53:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ d5a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ d5d:	eb 0a                	jmp    d69 <malloc+0x59>
+ d5f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d60:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ d62:	8b 47 04             	mov    0x4(%edi),%eax
+ d65:	39 f0                	cmp    %esi,%eax
+ d67:	73 4f                	jae    db8 <malloc+0xa8>
+      }
+      freep = prevp;
+      umtxunlock(&lock);
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ d69:	89 fa                	mov    %edi,%edx
+ d6b:	39 3d 1c 22 00 00    	cmp    %edi,0x221c
+ d71:	75 ed                	jne    d60 <malloc+0x50>
+  p = sbrk(nu * sizeof(Header));
+ d73:	83 ec 0c             	sub    $0xc,%esp
+ d76:	ff 75 e4             	push   -0x1c(%ebp)
+ d79:	e8 4a f8 ff ff       	call   5c8 <sbrk>
+  if(p == (char*)-1)
+ d7e:	83 c4 10             	add    $0x10,%esp
+ d81:	83 f8 ff             	cmp    $0xffffffff,%eax
+ d84:	74 15                	je     d9b <malloc+0x8b>
+  hp->s.size = nu;
+ d86:	89 58 04             	mov    %ebx,0x4(%eax)
+  freeblock((void*)(hp + 1));
+ d89:	83 c0 08             	add    $0x8,%eax
+ d8c:	e8 cf fe ff ff       	call   c60 <freeblock>
+  return freep;
+ d91:	8b 15 1c 22 00 00    	mov    0x221c,%edx
+      if((p = morecore(nunits)) == 0){
+ d97:	85 d2                	test   %edx,%edx
+ d99:	75 c5                	jne    d60 <malloc+0x50>
+        umtxunlock(&lock);
+ d9b:	83 ec 0c             	sub    $0xc,%esp
+ d9e:	68 18 22 00 00       	push   $0x2218
+ da3:	e8 68 f7 ff ff       	call   510 <umtxunlock>
+        return 0;
+ da8:	83 c4 10             	add    $0x10,%esp
+      }
+  }
+}
+ dab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ dae:	31 c0                	xor    %eax,%eax
+}
+ db0:	5b                   	pop    %ebx
+ db1:	5e                   	pop    %esi
+ db2:	5f                   	pop    %edi
+ db3:	5d                   	pop    %ebp
+ db4:	c3                   	ret
+ db5:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ db8:	39 c6                	cmp    %eax,%esi
+ dba:	74 64                	je     e20 <malloc+0x110>
+        p->s.size -= nunits;
+ dbc:	29 f0                	sub    %esi,%eax
+ dbe:	89 47 04             	mov    %eax,0x4(%edi)
+        p += p->s.size;
+ dc1:	8d 3c c7             	lea    (%edi,%eax,8),%edi
+        p->s.size = nunits;
+ dc4:	89 77 04             	mov    %esi,0x4(%edi)
+      umtxunlock(&lock);
+ dc7:	83 ec 0c             	sub    $0xc,%esp
+      freep = prevp;
+ dca:	89 15 1c 22 00 00    	mov    %edx,0x221c
+      umtxunlock(&lock);
+ dd0:	68 18 22 00 00       	push   $0x2218
+ dd5:	e8 36 f7 ff ff       	call   510 <umtxunlock>
+      return (void*)(p + 1);
+ dda:	83 c4 10             	add    $0x10,%esp
+}
+ ddd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ de0:	8d 47 08             	lea    0x8(%edi),%eax
+}
+ de3:	5b                   	pop    %ebx
+ de4:	5e                   	pop    %esi
+ de5:	5f                   	pop    %edi
+ de6:	5d                   	pop    %ebp
+ de7:	c3                   	ret
+ de8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ def:	90                   	nop
+    base.s.ptr = freep = prevp = &base;
+ df0:	c7 05 1c 22 00 00 20 	movl   $0x2220,0x221c
+ df7:	22 00 00 
+    base.s.size = 0;
+ dfa:	bf 20 22 00 00       	mov    $0x2220,%edi
+    base.s.ptr = freep = prevp = &base;
+ dff:	c7 05 20 22 00 00 20 	movl   $0x2220,0x2220
+ e06:	22 00 00 
+    base.s.size = 0;
+ e09:	c7 05 24 22 00 00 00 	movl   $0x0,0x2224
+ e10:	00 00 00 
+    if(p->s.size >= nunits){
+ e13:	e9 31 ff ff ff       	jmp    d49 <malloc+0x39>
+ e18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e1f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ e20:	8b 07                	mov    (%edi),%eax
+ e22:	89 02                	mov    %eax,(%edx)
+ e24:	eb a1                	jmp    dc7 <malloc+0xb7>
+ e26:	66 90                	xchg   %ax,%ax
+ e28:	66 90                	xchg   %ax,%ax
+ e2a:	66 90                	xchg   %ax,%ax
+ e2c:	66 90                	xchg   %ax,%ax
+ e2e:	66 90                	xchg   %ax,%ax
+
+00000e30 <threadstart>:
+
+#define TSTACKSZ 4096
+
+static void
+threadstart(void *fn, void *arg)
+{
+ e30:	55                   	push   %ebp
+ e31:	89 e5                	mov    %esp,%ebp
+ e33:	83 ec 14             	sub    $0x14,%esp
+  ((void (*)(void*))fn)(arg);
+ e36:	ff 75 0c             	push   0xc(%ebp)
+ e39:	ff 55 08             	call   *0x8(%ebp)
+  exit();
+ e3c:	e8 ef f4 ff ff       	call   330 <exit>
+ e41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e4f:	90                   	nop
+
+00000e50 <thread_create>:
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ e50:	55                   	push   %ebp
+ e51:	89 e5                	mov    %esp,%ebp
+ e53:	53                   	push   %ebx
+ e54:	83 ec 20             	sub    $0x20,%esp
+  char *mem, *stack;
+  int pid;
+
+  if((mem = malloc(2*TSTACKSZ)) == 0)
+ e57:	68 00 20 00 00       	push   $0x2000
+ e5c:	e8 af fe ff ff       	call   d10 <malloc>
+ e61:	83 c4 10             	add    $0x10,%esp
+ e64:	85 c0                	test   %eax,%eax
+ e66:	74 47                	je     eaf <thread_create+0x5f>
+ e68:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)(((uint)mem + TSTACKSZ - 1) & ~(TSTACKSZ - 1));
+ e6a:	8d 80 ff 0f 00 00    	lea    0xfff(%eax),%eax
+ e70:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  *(char**)stack = mem;
+ e75:	89 18                	mov    %ebx,(%eax)
+  if((pid = clone(threadstart, (void*)fn, arg, stack)) < 0)
+ e77:	50                   	push   %eax
+ e78:	ff 75 0c             	push   0xc(%ebp)
+ e7b:	ff 75 08             	push   0x8(%ebp)
+ e7e:	68 30 0e 00 00       	push   $0xe30
+ e83:	e8 08 f8 ff ff       	call   690 <clone>
+ e88:	83 c4 10             	add    $0x10,%esp
+ e8b:	85 c0                	test   %eax,%eax
+ e8d:	78 09                	js     e98 <thread_create+0x48>
+    free(mem);
+  return pid;
+}
+ e8f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ e92:	c9                   	leave
+ e93:	c3                   	ret
+ e94:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    free(mem);
+ e98:	83 ec 0c             	sub    $0xc,%esp
+ e9b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ e9e:	53                   	push   %ebx
+ e9f:	e8 3c fe ff ff       	call   ce0 <free>
+ ea4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ ea7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+ eaa:	83 c4 10             	add    $0x10,%esp
+}
+ ead:	c9                   	leave
+ eae:	c3                   	ret
+    return -1;
+ eaf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ eb4:	eb d9                	jmp    e8f <thread_create+0x3f>
+ eb6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ebd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ec0 <thread_join>:
+
+int
+thread_join(void)
+{
+ ec0:	55                   	push   %ebp
+ ec1:	89 e5                	mov    %esp,%ebp
+ ec3:	83 ec 34             	sub    $0x34,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+ ec6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ ec9:	50                   	push   %eax
+ eca:	e8 c9 f7 ff ff       	call   698 <join>
+ ecf:	83 c4 10             	add    $0x10,%esp
+ ed2:	85 c0                	test   %eax,%eax
+ ed4:	79 0a                	jns    ee0 <thread_join+0x20>
+    free(*(char**)stack);
+  return pid;
+}
+ ed6:	c9                   	leave
+ ed7:	c3                   	ret
+ ed8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ edf:	90                   	nop
+    free(*(char**)stack);
+ ee0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ ee3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ ee6:	83 ec 0c             	sub    $0xc,%esp
+ ee9:	ff 32                	push   (%edx)
+ eeb:	e8 f0 fd ff ff       	call   ce0 <free>
+ ef0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ ef3:	83 c4 10             	add    $0x10,%esp
+}
+ ef6:	c9                   	leave
+ ef7:	c3                   	ret
@@ -0,0 +1,2808 @@
+
+_lockstat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <column>:
+
+// Print s in a column of width characters,
+// left-aligned if left, else right-aligned.
+void
+column(char *s, int width, int left)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	57                   	push   %edi
+       4:	56                   	push   %esi
+       5:	53                   	push   %ebx
+       6:	83 ec 28             	sub    $0x28,%esp
+       9:	8b 45 08             	mov    0x8(%ebp),%eax
+       c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+       f:	8b 75 10             	mov    0x10(%ebp),%esi
+      12:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  int n;
+
+  n = strlen(s);
+      15:	50                   	push   %eax
+      16:	e8 25 06 00 00       	call   640 <strlen>
+  if(left)
+      1b:	83 c4 10             	add    $0x10,%esp
+  n = strlen(s);
+      1e:	89 c7                	mov    %eax,%edi
+  if(left)
+      20:	85 f6                	test   %esi,%esi
+      22:	75 34                	jne    58 <column+0x58>
+    printf(1, "%s", s);
+  for(; n < width; n++)
+      24:	39 d8                	cmp    %ebx,%eax
+      26:	7d 50                	jge    78 <column+0x78>
+      28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      2f:	90                   	nop
+    printf(1, " ");
+      30:	83 ec 08             	sub    $0x8,%esp
+  for(; n < width; n++)
+      33:	83 c7 01             	add    $0x1,%edi
+    printf(1, " ");
+      36:	68 4b 14 00 00       	push   $0x144b
+      3b:	6a 01                	push   $0x1
+      3d:	e8 ce 0f 00 00       	call   1010 <printf>
+  for(; n < width; n++)
+      42:	83 c4 10             	add    $0x10,%esp
+      45:	39 fb                	cmp    %edi,%ebx
+      47:	7f e7                	jg     30 <column+0x30>
+  if(!left)
+      49:	85 f6                	test   %esi,%esi
+      4b:	74 2b                	je     78 <column+0x78>
+    printf(1, "%s", s);
+}
+      4d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      50:	5b                   	pop    %ebx
+      51:	5e                   	pop    %esi
+      52:	5f                   	pop    %edi
+      53:	5d                   	pop    %ebp
+      54:	c3                   	ret
+      55:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, "%s", s);
+      58:	83 ec 04             	sub    $0x4,%esp
+      5b:	ff 75 e4             	push   -0x1c(%ebp)
+      5e:	68 48 14 00 00       	push   $0x1448
+      63:	6a 01                	push   $0x1
+      65:	e8 a6 0f 00 00       	call   1010 <printf>
+  for(; n < width; n++)
+      6a:	83 c4 10             	add    $0x10,%esp
+      6d:	39 df                	cmp    %ebx,%edi
+      6f:	7c bf                	jl     30 <column+0x30>
+      71:	eb da                	jmp    4d <column+0x4d>
+      73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      77:	90                   	nop
+    printf(1, "%s", s);
+      78:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      7b:	c7 45 0c 48 14 00 00 	movl   $0x1448,0xc(%ebp)
+      82:	c7 45 08 01 00 00 00 	movl   $0x1,0x8(%ebp)
+      89:	89 45 10             	mov    %eax,0x10(%ebp)
+}
+      8c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      8f:	5b                   	pop    %ebx
+      90:	5e                   	pop    %esi
+      91:	5f                   	pop    %edi
+      92:	5d                   	pop    %ebp
+    printf(1, "%s", s);
+      93:	e9 78 0f 00 00       	jmp    1010 <printf>
+      98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      9f:	90                   	nop
+
+000000a0 <number>:
+
+void
+number(uint x, int width)
+{
+      a0:	55                   	push   %ebp
+      a1:	89 e5                	mov    %esp,%ebp
+      a3:	57                   	push   %edi
+      a4:	56                   	push   %esi
+  char buf[16];
+
+  sprintf(buf, "%d", x);
+      a5:	8d 7d d8             	lea    -0x28(%ebp),%edi
+{
+      a8:	53                   	push   %ebx
+      a9:	83 ec 20             	sub    $0x20,%esp
+      ac:	8b 75 0c             	mov    0xc(%ebp),%esi
+  sprintf(buf, "%d", x);
+      af:	ff 75 08             	push   0x8(%ebp)
+      b2:	68 4d 14 00 00       	push   $0x144d
+      b7:	57                   	push   %edi
+      b8:	e8 b3 10 00 00       	call   1170 <sprintf>
+  n = strlen(s);
+      bd:	89 3c 24             	mov    %edi,(%esp)
+      c0:	e8 7b 05 00 00       	call   640 <strlen>
+  for(; n < width; n++)
+      c5:	83 c4 10             	add    $0x10,%esp
+      c8:	39 c6                	cmp    %eax,%esi
+      ca:	7e 1d                	jle    e9 <number+0x49>
+      cc:	89 c3                	mov    %eax,%ebx
+      ce:	66 90                	xchg   %ax,%ax
+    printf(1, " ");
+      d0:	83 ec 08             	sub    $0x8,%esp
+  for(; n < width; n++)
+      d3:	83 c3 01             	add    $0x1,%ebx
+    printf(1, " ");
+      d6:	68 4b 14 00 00       	push   $0x144b
+      db:	6a 01                	push   $0x1
+      dd:	e8 2e 0f 00 00       	call   1010 <printf>
+  for(; n < width; n++)
+      e2:	83 c4 10             	add    $0x10,%esp
+      e5:	39 de                	cmp    %ebx,%esi
+      e7:	75 e7                	jne    d0 <number+0x30>
+    printf(1, "%s", s);
+      e9:	83 ec 04             	sub    $0x4,%esp
+      ec:	57                   	push   %edi
+      ed:	68 48 14 00 00       	push   $0x1448
+      f2:	6a 01                	push   $0x1
+      f4:	e8 17 0f 00 00       	call   1010 <printf>
+  column(buf, width, 0);
+}
+      f9:	83 c4 10             	add    $0x10,%esp
+      fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      ff:	5b                   	pop    %ebx
+     100:	5e                   	pop    %esi
+     101:	5f                   	pop    %edi
+     102:	5d                   	pop    %ebp
+     103:	c3                   	ret
+     104:	66 90                	xchg   %ax,%ax
+     106:	66 90                	xchg   %ax,%ax
+     108:	66 90                	xchg   %ax,%ax
+     10a:	66 90                	xchg   %ax,%ax
+     10c:	66 90                	xchg   %ax,%ax
+     10e:	66 90                	xchg   %ax,%ax
+
+00000110 <main>:
+
+int
+main(int argc, char *argv[])
+{
+     110:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     114:	83 e4 f0             	and    $0xfffffff0,%esp
+     117:	ff 71 fc             	push   -0x4(%ecx)
+     11a:	55                   	push   %ebp
+     11b:	89 e5                	mov    %esp,%ebp
+     11d:	57                   	push   %edi
+     11e:	56                   	push   %esi
+     11f:	53                   	push   %ebx
+     120:	51                   	push   %ecx
+     121:	83 ec 48             	sub    $0x48,%esp
+  struct lockstat *a, *b;
+  int nb, na, i, pid;
+  uint nacq, ncont, nspin, hold, avg, nsleep, nspinwait;
+
+  nb = 0;
+  if(argc > 1){
+     124:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+     127:	8b 59 04             	mov    0x4(%ecx),%ebx
+  if(argc > 1){
+     12a:	7e 4c                	jle    178 <main+0x68>
+    nb = lockstat(before, NCLASS);
+     12c:	52                   	push   %edx
+     12d:	52                   	push   %edx
+     12e:	6a 40                	push   $0x40
+     130:	68 20 2c 00 00       	push   $0x2c20
+     135:	e8 9e 0a 00 00       	call   bd8 <lockstat>
+     13a:	89 45 bc             	mov    %eax,-0x44(%ebp)
+    if((pid = fork()) < 0){
+     13d:	e8 0e 07 00 00       	call   850 <fork>
+     142:	83 c4 10             	add    $0x10,%esp
+     145:	85 c0                	test   %eax,%eax
+     147:	0f 88 46 04 00 00    	js     593 <main+0x483>
+      printf(2, "lockstat: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+     14d:	0f 85 36 04 00 00    	jne    589 <main+0x479>
+      exec(argv[1], argv + 1);
+     153:	50                   	push   %eax
+     154:	50                   	push   %eax
+     155:	8d 43 04             	lea    0x4(%ebx),%eax
+     158:	50                   	push   %eax
+     159:	ff 73 04             	push   0x4(%ebx)
+     15c:	e8 3f 07 00 00       	call   8a0 <exec>
+      printf(2, "lockstat: exec %s failed\n", argv[1]);
+     161:	83 c4 0c             	add    $0xc,%esp
+     164:	ff 73 04             	push   0x4(%ebx)
+     167:	68 67 14 00 00       	push   $0x1467
+     16c:	6a 02                	push   $0x2
+     16e:	e8 9d 0e 00 00       	call   1010 <printf>
+      exit();
+     173:	e8 08 07 00 00       	call   880 <exit>
+  nb = 0;
+     178:	31 c0                	xor    %eax,%eax
+     17a:	89 45 bc             	mov    %eax,-0x44(%ebp)
+    }
+    wait();
+  }
+  if((na = lockstat(after, NCLASS)) < 0){
+     17d:	50                   	push   %eax
+     17e:	50                   	push   %eax
+     17f:	6a 40                	push   $0x40
+     181:	68 20 22 00 00       	push   $0x2220
+     186:	e8 4d 0a 00 00       	call   bd8 <lockstat>
+     18b:	83 c4 10             	add    $0x10,%esp
+     18e:	89 45 b8             	mov    %eax,-0x48(%ebp)
+     191:	85 c0                	test   %eax,%eax
+     193:	0f 88 dd 03 00 00    	js     576 <main+0x466>
+    printf(2, "lockstat: lockstat failed\n");
+    exit();
+  }
+
+  column("name", 16, 1);
+     199:	51                   	push   %ecx
+  column("spins", 12, 0);
+  column("avg hold", 10, 0);
+  column("slept", 8, 0);
+  column("spun", 8, 0);
+  printf(1, "\n");
+  for(i = 0; i < na; i++){
+     19a:	31 ff                	xor    %edi,%edi
+  column("name", 16, 1);
+     19c:	6a 01                	push   $0x1
+     19e:	6a 10                	push   $0x10
+     1a0:	68 9c 14 00 00       	push   $0x149c
+     1a5:	e8 56 fe ff ff       	call   0 <column>
+  column("acquired", 10, 0);
+     1aa:	83 c4 0c             	add    $0xc,%esp
+     1ad:	6a 00                	push   $0x0
+     1af:	6a 0a                	push   $0xa
+     1b1:	68 a1 14 00 00       	push   $0x14a1
+     1b6:	e8 45 fe ff ff       	call   0 <column>
+  column("contended", 10, 0);
+     1bb:	83 c4 0c             	add    $0xc,%esp
+     1be:	6a 00                	push   $0x0
+     1c0:	6a 0a                	push   $0xa
+     1c2:	68 aa 14 00 00       	push   $0x14aa
+     1c7:	e8 34 fe ff ff       	call   0 <column>
+  column("spins", 12, 0);
+     1cc:	83 c4 0c             	add    $0xc,%esp
+     1cf:	6a 00                	push   $0x0
+     1d1:	6a 0c                	push   $0xc
+     1d3:	68 b4 14 00 00       	push   $0x14b4
+     1d8:	e8 23 fe ff ff       	call   0 <column>
+  column("avg hold", 10, 0);
+     1dd:	83 c4 0c             	add    $0xc,%esp
+     1e0:	6a 00                	push   $0x0
+     1e2:	6a 0a                	push   $0xa
+     1e4:	68 ba 14 00 00       	push   $0x14ba
+     1e9:	e8 12 fe ff ff       	call   0 <column>
+  column("slept", 8, 0);
+     1ee:	83 c4 0c             	add    $0xc,%esp
+     1f1:	6a 00                	push   $0x0
+     1f3:	6a 08                	push   $0x8
+     1f5:	68 c3 14 00 00       	push   $0x14c3
+     1fa:	e8 01 fe ff ff       	call   0 <column>
+  column("spun", 8, 0);
+     1ff:	83 c4 0c             	add    $0xc,%esp
+     202:	6a 00                	push   $0x0
+     204:	6a 08                	push   $0x8
+     206:	68 c9 14 00 00       	push   $0x14c9
+     20b:	e8 f0 fd ff ff       	call   0 <column>
+  printf(1, "\n");
+     210:	5b                   	pop    %ebx
+     211:	5e                   	pop    %esi
+     212:	68 65 14 00 00       	push   $0x1465
+     217:	6a 01                	push   $0x1
+     219:	e8 f2 0d 00 00       	call   1010 <printf>
+  for(i = 0; i < na; i++){
+     21e:	31 c9                	xor    %ecx,%ecx
+     220:	83 c4 10             	add    $0x10,%esp
+     223:	83 7d b8 00          	cmpl   $0x0,-0x48(%ebp)
+     227:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+     22a:	89 cb                	mov    %ecx,%ebx
+     22c:	0f 84 3f 03 00 00    	je     571 <main+0x461>
+     232:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    a = &after[i];
+    b = i < nb ? &before[i] : 0;
+    nacq = a->nacquire - (b ? b->nacquire : 0);
+    ncont = a->ncontend - (b ? b->ncontend : 0);
+    nspin = a->nspin - (b ? b->nspin : 0);
+    hold = a->holdkc - (b ? b->holdkc : 0);
+     238:	8b 83 3c 22 00 00    	mov    0x223c(%ebx),%eax
+    nsleep = a->nsleep - (b ? b->nsleep : 0);
+     23e:	8b 93 40 22 00 00    	mov    0x2240(%ebx),%edx
+    nspinwait = a->nspinwait - (b ? b->nspinwait : 0);
+     244:	8b 8b 44 22 00 00    	mov    0x2244(%ebx),%ecx
+    nspin = a->nspin - (b ? b->nspin : 0);
+     24a:	8b bb 38 22 00 00    	mov    0x2238(%ebx),%edi
+    hold = a->holdkc - (b ? b->holdkc : 0);
+     250:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    ncont = a->ncontend - (b ? b->ncontend : 0);
+     253:	8b 83 34 22 00 00    	mov    0x2234(%ebx),%eax
+    nsleep = a->nsleep - (b ? b->nsleep : 0);
+     259:	89 55 c0             	mov    %edx,-0x40(%ebp)
+    nacq = a->nacquire - (b ? b->nacquire : 0);
+     25c:	8b b3 30 22 00 00    	mov    0x2230(%ebx),%esi
+    nspinwait = a->nspinwait - (b ? b->nspinwait : 0);
+     262:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    b = i < nb ? &before[i] : 0;
+     265:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    nspin = a->nspin - (b ? b->nspin : 0);
+     268:	89 7d cc             	mov    %edi,-0x34(%ebp)
+    ncont = a->ncontend - (b ? b->ncontend : 0);
+     26b:	89 45 c8             	mov    %eax,-0x38(%ebp)
+    b = i < nb ? &before[i] : 0;
+     26e:	39 55 bc             	cmp    %edx,-0x44(%ebp)
+     271:	7e 39                	jle    2ac <main+0x19c>
+    ncont = a->ncontend - (b ? b->ncontend : 0);
+     273:	8b 93 34 2c 00 00    	mov    0x2c34(%ebx),%edx
+    nacq = a->nacquire - (b ? b->nacquire : 0);
+     279:	2b b3 30 2c 00 00    	sub    0x2c30(%ebx),%esi
+    ncont = a->ncontend - (b ? b->ncontend : 0);
+     27f:	29 d0                	sub    %edx,%eax
+     281:	89 45 c8             	mov    %eax,-0x38(%ebp)
+    nspin = a->nspin - (b ? b->nspin : 0);
+     284:	8b 83 38 2c 00 00    	mov    0x2c38(%ebx),%eax
+     28a:	29 c7                	sub    %eax,%edi
+    nsleep = a->nsleep - (b ? b->nsleep : 0);
+     28c:	8b 83 40 2c 00 00    	mov    0x2c40(%ebx),%eax
+     292:	29 45 c0             	sub    %eax,-0x40(%ebp)
+    nspinwait = a->nspinwait - (b ? b->nspinwait : 0);
+     295:	8b 83 44 2c 00 00    	mov    0x2c44(%ebx),%eax
+    nspin = a->nspin - (b ? b->nspin : 0);
+     29b:	89 7d cc             	mov    %edi,-0x34(%ebp)
+    hold = a->holdkc - (b ? b->holdkc : 0);
+     29e:	8b bb 3c 2c 00 00    	mov    0x2c3c(%ebx),%edi
+     2a4:	29 7d c4             	sub    %edi,-0x3c(%ebp)
+    nspinwait = a->nspinwait - (b ? b->nspinwait : 0);
+     2a7:	29 c1                	sub    %eax,%ecx
+     2a9:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    if(nacq == 0)
+     2ac:	85 f6                	test   %esi,%esi
+     2ae:	0f 84 aa 02 00 00    	je     55e <main+0x44e>
+      continue;
+    // Average of hold*1024/nacq without overflowing.
+    avg = hold / nacq * 1024 + hold % nacq * 1024 / nacq;
+     2b4:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     2b7:	31 d2                	xor    %edx,%edx
+  n = strlen(s);
+     2b9:	83 ec 0c             	sub    $0xc,%esp
+     2bc:	f7 f6                	div    %esi
+     2be:	89 c1                	mov    %eax,%ecx
+    avg = hold / nacq * 1024 + hold % nacq * 1024 / nacq;
+     2c0:	89 d0                	mov    %edx,%eax
+     2c2:	31 d2                	xor    %edx,%edx
+     2c4:	c1 e0 0a             	shl    $0xa,%eax
+     2c7:	c1 e1 0a             	shl    $0xa,%ecx
+     2ca:	f7 f6                	div    %esi
+    column(a->name, 16, 1);
+     2cc:	8d 93 20 22 00 00    	lea    0x2220(%ebx),%edx
+    avg = hold / nacq * 1024 + hold % nacq * 1024 / nacq;
+     2d2:	01 c8                	add    %ecx,%eax
+     2d4:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  n = strlen(s);
+     2d7:	52                   	push   %edx
+     2d8:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+     2db:	e8 60 03 00 00       	call   640 <strlen>
+    printf(1, "%s", s);
+     2e0:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+     2e3:	83 c4 0c             	add    $0xc,%esp
+  n = strlen(s);
+     2e6:	89 c7                	mov    %eax,%edi
+    printf(1, "%s", s);
+     2e8:	52                   	push   %edx
+     2e9:	68 48 14 00 00       	push   $0x1448
+     2ee:	6a 01                	push   $0x1
+     2f0:	e8 1b 0d 00 00       	call   1010 <printf>
+  for(; n < width; n++)
+     2f5:	83 c4 10             	add    $0x10,%esp
+     2f8:	83 ff 0f             	cmp    $0xf,%edi
+     2fb:	7f 1d                	jg     31a <main+0x20a>
+     2fd:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, " ");
+     300:	83 ec 08             	sub    $0x8,%esp
+  for(; n < width; n++)
+     303:	83 c7 01             	add    $0x1,%edi
+    printf(1, " ");
+     306:	68 4b 14 00 00       	push   $0x144b
+     30b:	6a 01                	push   $0x1
+     30d:	e8 fe 0c 00 00       	call   1010 <printf>
+  for(; n < width; n++)
+     312:	83 c4 10             	add    $0x10,%esp
+     315:	83 ff 10             	cmp    $0x10,%edi
+     318:	75 e6                	jne    300 <main+0x1f0>
+  sprintf(buf, "%d", x);
+     31a:	83 ec 04             	sub    $0x4,%esp
+     31d:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     320:	56                   	push   %esi
+     321:	68 4d 14 00 00       	push   $0x144d
+     326:	50                   	push   %eax
+     327:	e8 44 0e 00 00       	call   1170 <sprintf>
+  n = strlen(s);
+     32c:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     32f:	89 04 24             	mov    %eax,(%esp)
+     332:	e8 09 03 00 00       	call   640 <strlen>
+  for(; n < width; n++)
+     337:	83 c4 10             	add    $0x10,%esp
+  n = strlen(s);
+     33a:	89 c6                	mov    %eax,%esi
+  for(; n < width; n++)
+     33c:	83 f8 09             	cmp    $0x9,%eax
+     33f:	7f 21                	jg     362 <main+0x252>
+     341:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    printf(1, " ");
+     348:	83 ec 08             	sub    $0x8,%esp
+  for(; n < width; n++)
+     34b:	83 c6 01             	add    $0x1,%esi
+    printf(1, " ");
+     34e:	68 4b 14 00 00       	push   $0x144b
+     353:	6a 01                	push   $0x1
+     355:	e8 b6 0c 00 00       	call   1010 <printf>
+  for(; n < width; n++)
+     35a:	83 c4 10             	add    $0x10,%esp
+     35d:	83 fe 0a             	cmp    $0xa,%esi
+     360:	75 e6                	jne    348 <main+0x238>
+    printf(1, "%s", s);
+     362:	83 ec 04             	sub    $0x4,%esp
+     365:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     368:	50                   	push   %eax
+     369:	68 48 14 00 00       	push   $0x1448
+     36e:	6a 01                	push   $0x1
+     370:	e8 9b 0c 00 00       	call   1010 <printf>
+  sprintf(buf, "%d", x);
+     375:	83 c4 0c             	add    $0xc,%esp
+     378:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     37b:	ff 75 c8             	push   -0x38(%ebp)
+     37e:	68 4d 14 00 00       	push   $0x144d
+     383:	50                   	push   %eax
+     384:	e8 e7 0d 00 00       	call   1170 <sprintf>
+  n = strlen(s);
+     389:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     38c:	89 04 24             	mov    %eax,(%esp)
+     38f:	e8 ac 02 00 00       	call   640 <strlen>
+  for(; n < width; n++)
+     394:	83 c4 10             	add    $0x10,%esp
+  n = strlen(s);
+     397:	89 c6                	mov    %eax,%esi
+  for(; n < width; n++)
+     399:	83 f8 09             	cmp    $0x9,%eax
+     39c:	7f 1c                	jg     3ba <main+0x2aa>
+     39e:	66 90                	xchg   %ax,%ax
+    printf(1, " ");
+     3a0:	83 ec 08             	sub    $0x8,%esp
+  for(; n < width; n++)
+     3a3:	83 c6 01             	add    $0x1,%esi
+    printf(1, " ");
+     3a6:	68 4b 14 00 00       	push   $0x144b
+     3ab:	6a 01                	push   $0x1
+     3ad:	e8 5e 0c 00 00       	call   1010 <printf>
+  for(; n < width; n++)
+     3b2:	83 c4 10             	add    $0x10,%esp
+     3b5:	83 fe 0a             	cmp    $0xa,%esi
+     3b8:	75 e6                	jne    3a0 <main+0x290>
+    printf(1, "%s", s);
+     3ba:	83 ec 04             	sub    $0x4,%esp
+     3bd:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     3c0:	50                   	push   %eax
+     3c1:	68 48 14 00 00       	push   $0x1448
+     3c6:	6a 01                	push   $0x1
+     3c8:	e8 43 0c 00 00       	call   1010 <printf>
+  sprintf(buf, "%d", x);
+     3cd:	83 c4 0c             	add    $0xc,%esp
+     3d0:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     3d3:	ff 75 cc             	push   -0x34(%ebp)
+     3d6:	68 4d 14 00 00       	push   $0x144d
+     3db:	50                   	push   %eax
+     3dc:	e8 8f 0d 00 00       	call   1170 <sprintf>
+  n = strlen(s);
+     3e1:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     3e4:	89 04 24             	mov    %eax,(%esp)
+     3e7:	e8 54 02 00 00       	call   640 <strlen>
+  for(; n < width; n++)
+     3ec:	83 c4 10             	add    $0x10,%esp
+  n = strlen(s);
+     3ef:	89 c6                	mov    %eax,%esi
+  for(; n < width; n++)
+     3f1:	83 f8 0b             	cmp    $0xb,%eax
+     3f4:	7f 24                	jg     41a <main+0x30a>
+     3f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3fd:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, " ");
+     400:	83 ec 08             	sub    $0x8,%esp
+  for(; n < width; n++)
+     403:	83 c6 01             	add    $0x1,%esi
+    printf(1, " ");
+     406:	68 4b 14 00 00       	push   $0x144b
+     40b:	6a 01                	push   $0x1
+     40d:	e8 fe 0b 00 00       	call   1010 <printf>
+  for(; n < width; n++)
+     412:	83 c4 10             	add    $0x10,%esp
+     415:	83 fe 0c             	cmp    $0xc,%esi
+     418:	75 e6                	jne    400 <main+0x2f0>
+    printf(1, "%s", s);
+     41a:	83 ec 04             	sub    $0x4,%esp
+     41d:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     420:	50                   	push   %eax
+     421:	68 48 14 00 00       	push   $0x1448
+     426:	6a 01                	push   $0x1
+     428:	e8 e3 0b 00 00       	call   1010 <printf>
+  sprintf(buf, "%d", x);
+     42d:	83 c4 0c             	add    $0xc,%esp
+     430:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     433:	ff 75 c4             	push   -0x3c(%ebp)
+     436:	68 4d 14 00 00       	push   $0x144d
+     43b:	50                   	push   %eax
+     43c:	e8 2f 0d 00 00       	call   1170 <sprintf>
+  n = strlen(s);
+     441:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     444:	89 04 24             	mov    %eax,(%esp)
+     447:	e8 f4 01 00 00       	call   640 <strlen>
+  for(; n < width; n++)
+     44c:	83 c4 10             	add    $0x10,%esp
+  n = strlen(s);
+     44f:	89 c6                	mov    %eax,%esi
+  for(; n < width; n++)
+     451:	83 f8 09             	cmp    $0x9,%eax
+     454:	7f 24                	jg     47a <main+0x36a>
+     456:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     45d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, " ");
+     460:	83 ec 08             	sub    $0x8,%esp
+  for(; n < width; n++)
+     463:	83 c6 01             	add    $0x1,%esi
+    printf(1, " ");
+     466:	68 4b 14 00 00       	push   $0x144b
+     46b:	6a 01                	push   $0x1
+     46d:	e8 9e 0b 00 00       	call   1010 <printf>
+  for(; n < width; n++)
+     472:	83 c4 10             	add    $0x10,%esp
+     475:	83 fe 0a             	cmp    $0xa,%esi
+     478:	75 e6                	jne    460 <main+0x350>
+    printf(1, "%s", s);
+     47a:	83 ec 04             	sub    $0x4,%esp
+     47d:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     480:	50                   	push   %eax
+     481:	68 48 14 00 00       	push   $0x1448
+     486:	6a 01                	push   $0x1
+     488:	e8 83 0b 00 00       	call   1010 <printf>
+  sprintf(buf, "%d", x);
+     48d:	83 c4 0c             	add    $0xc,%esp
+     490:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     493:	ff 75 c0             	push   -0x40(%ebp)
+     496:	68 4d 14 00 00       	push   $0x144d
+     49b:	50                   	push   %eax
+     49c:	e8 cf 0c 00 00       	call   1170 <sprintf>
+  n = strlen(s);
+     4a1:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     4a4:	89 04 24             	mov    %eax,(%esp)
+     4a7:	e8 94 01 00 00       	call   640 <strlen>
+  for(; n < width; n++)
+     4ac:	83 c4 10             	add    $0x10,%esp
+  n = strlen(s);
+     4af:	89 c6                	mov    %eax,%esi
+  for(; n < width; n++)
+     4b1:	83 f8 07             	cmp    $0x7,%eax
+     4b4:	7f 24                	jg     4da <main+0x3ca>
+     4b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4bd:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, " ");
+     4c0:	83 ec 08             	sub    $0x8,%esp
+  for(; n < width; n++)
+     4c3:	83 c6 01             	add    $0x1,%esi
+    printf(1, " ");
+     4c6:	68 4b 14 00 00       	push   $0x144b
+     4cb:	6a 01                	push   $0x1
+     4cd:	e8 3e 0b 00 00       	call   1010 <printf>
+  for(; n < width; n++)
+     4d2:	83 c4 10             	add    $0x10,%esp
+     4d5:	83 fe 08             	cmp    $0x8,%esi
+     4d8:	75 e6                	jne    4c0 <main+0x3b0>
+    printf(1, "%s", s);
+     4da:	83 ec 04             	sub    $0x4,%esp
+     4dd:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     4e0:	50                   	push   %eax
+     4e1:	68 48 14 00 00       	push   $0x1448
+     4e6:	6a 01                	push   $0x1
+     4e8:	e8 23 0b 00 00       	call   1010 <printf>
+  sprintf(buf, "%d", x);
+     4ed:	83 c4 0c             	add    $0xc,%esp
+     4f0:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     4f3:	ff 75 d0             	push   -0x30(%ebp)
+     4f6:	68 4d 14 00 00       	push   $0x144d
+     4fb:	50                   	push   %eax
+     4fc:	e8 6f 0c 00 00       	call   1170 <sprintf>
+  n = strlen(s);
+     501:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     504:	89 04 24             	mov    %eax,(%esp)
+     507:	e8 34 01 00 00       	call   640 <strlen>
+  for(; n < width; n++)
+     50c:	83 c4 10             	add    $0x10,%esp
+  n = strlen(s);
+     50f:	89 c6                	mov    %eax,%esi
+  for(; n < width; n++)
+     511:	83 f8 07             	cmp    $0x7,%eax
+     514:	7f 24                	jg     53a <main+0x42a>
+     516:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     51d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, " ");
+     520:	83 ec 08             	sub    $0x8,%esp
+  for(; n < width; n++)
+     523:	83 c6 01             	add    $0x1,%esi
+    printf(1, " ");
+     526:	68 4b 14 00 00       	push   $0x144b
+     52b:	6a 01                	push   $0x1
+     52d:	e8 de 0a 00 00       	call   1010 <printf>
+  for(; n < width; n++)
+     532:	83 c4 10             	add    $0x10,%esp
+     535:	83 fe 08             	cmp    $0x8,%esi
+     538:	75 e6                	jne    520 <main+0x410>
+    printf(1, "%s", s);
+     53a:	83 ec 04             	sub    $0x4,%esp
+     53d:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     540:	50                   	push   %eax
+     541:	68 48 14 00 00       	push   $0x1448
+     546:	6a 01                	push   $0x1
+     548:	e8 c3 0a 00 00       	call   1010 <printf>
+    number(ncont, 10);
+    number(nspin, 12);
+    number(avg, 10);
+    number(nsleep, 8);
+    number(nspinwait, 8);
+    printf(1, "\n");
+     54d:	58                   	pop    %eax
+     54e:	5a                   	pop    %edx
+     54f:	68 65 14 00 00       	push   $0x1465
+     554:	6a 01                	push   $0x1
+     556:	e8 b5 0a 00 00       	call   1010 <printf>
+     55b:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < na; i++){
+     55e:	83 45 d4 01          	addl   $0x1,-0x2c(%ebp)
+     562:	83 c3 28             	add    $0x28,%ebx
+     565:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     568:	39 45 b8             	cmp    %eax,-0x48(%ebp)
+     56b:	0f 85 c7 fc ff ff    	jne    238 <main+0x128>
+  }
+  exit();
+     571:	e8 0a 03 00 00       	call   880 <exit>
+    printf(2, "lockstat: lockstat failed\n");
+     576:	50                   	push   %eax
+     577:	50                   	push   %eax
+     578:	68 81 14 00 00       	push   $0x1481
+     57d:	6a 02                	push   $0x2
+     57f:	e8 8c 0a 00 00       	call   1010 <printf>
+    exit();
+     584:	e8 f7 02 00 00       	call   880 <exit>
+    wait();
+     589:	e8 0a 05 00 00       	call   a98 <wait>
+     58e:	e9 ea fb ff ff       	jmp    17d <main+0x6d>
+      printf(2, "lockstat: fork failed\n");
+     593:	50                   	push   %eax
+     594:	50                   	push   %eax
+     595:	68 50 14 00 00       	push   $0x1450
+     59a:	6a 02                	push   $0x2
+     59c:	e8 6f 0a 00 00       	call   1010 <printf>
+      exit();
+     5a1:	e8 da 02 00 00       	call   880 <exit>
+     5a6:	66 90                	xchg   %ax,%ax
+     5a8:	66 90                	xchg   %ax,%ax
+     5aa:	66 90                	xchg   %ax,%ax
+     5ac:	66 90                	xchg   %ax,%ax
+     5ae:	66 90                	xchg   %ax,%ax
+
+000005b0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     5b0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     5b1:	31 c0                	xor    %eax,%eax
+{
+     5b3:	89 e5                	mov    %esp,%ebp
+     5b5:	53                   	push   %ebx
+     5b6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     5b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     5bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     5c0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     5c4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     5c7:	83 c0 01             	add    $0x1,%eax
+     5ca:	84 d2                	test   %dl,%dl
+     5cc:	75 f2                	jne    5c0 <strcpy+0x10>
+    ;
+  return os;
+}
+     5ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     5d1:	89 c8                	mov    %ecx,%eax
+     5d3:	c9                   	leave
+     5d4:	c3                   	ret
+     5d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005e0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     5e0:	55                   	push   %ebp
+     5e1:	89 e5                	mov    %esp,%ebp
+     5e3:	53                   	push   %ebx
+     5e4:	8b 55 08             	mov    0x8(%ebp),%edx
+     5e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     5ea:	0f b6 02             	movzbl (%edx),%eax
+     5ed:	84 c0                	test   %al,%al
+     5ef:	75 17                	jne    608 <strcmp+0x28>
+     5f1:	eb 3a                	jmp    62d <strcmp+0x4d>
+     5f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     5f7:	90                   	nop
+     5f8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     5fc:	83 c2 01             	add    $0x1,%edx
+     5ff:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     602:	84 c0                	test   %al,%al
+     604:	74 1a                	je     620 <strcmp+0x40>
+    p++, q++;
+     606:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     608:	0f b6 19             	movzbl (%ecx),%ebx
+     60b:	38 c3                	cmp    %al,%bl
+     60d:	74 e9                	je     5f8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     60f:	29 d8                	sub    %ebx,%eax
+}
+     611:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     614:	c9                   	leave
+     615:	c3                   	ret
+     616:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     61d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     620:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     624:	31 c0                	xor    %eax,%eax
+     626:	29 d8                	sub    %ebx,%eax
+}
+     628:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     62b:	c9                   	leave
+     62c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     62d:	0f b6 19             	movzbl (%ecx),%ebx
+     630:	31 c0                	xor    %eax,%eax
+     632:	eb db                	jmp    60f <strcmp+0x2f>
+     634:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     63b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     63f:	90                   	nop
+
+00000640 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     640:	55                   	push   %ebp
+     641:	89 e5                	mov    %esp,%ebp
+     643:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     646:	80 3a 00             	cmpb   $0x0,(%edx)
+     649:	74 15                	je     660 <strlen+0x20>
+     64b:	31 c0                	xor    %eax,%eax
+     64d:	8d 76 00             	lea    0x0(%esi),%esi
+     650:	83 c0 01             	add    $0x1,%eax
+     653:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     657:	89 c1                	mov    %eax,%ecx
+     659:	75 f5                	jne    650 <strlen+0x10>
+    ;
+  return n;
+}
+     65b:	89 c8                	mov    %ecx,%eax
+     65d:	5d                   	pop    %ebp
+     65e:	c3                   	ret
+     65f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     660:	31 c9                	xor    %ecx,%ecx
+}
+     662:	5d                   	pop    %ebp
+     663:	89 c8                	mov    %ecx,%eax
+     665:	c3                   	ret
+     666:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     66d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000670 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     670:	55                   	push   %ebp
+     671:	89 e5                	mov    %esp,%ebp
+     673:	57                   	push   %edi
+     674:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     677:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     67a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     67d:	89 d7                	mov    %edx,%edi
+     67f:	fc                   	cld
+     680:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     682:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     685:	89 d0                	mov    %edx,%eax
+     687:	c9                   	leave
+     688:	c3                   	ret
+     689:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000690 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     690:	55                   	push   %ebp
+     691:	89 e5                	mov    %esp,%ebp
+     693:	56                   	push   %esi
+     694:	53                   	push   %ebx
+     695:	8b 75 10             	mov    0x10(%ebp),%esi
+     698:	8b 55 08             	mov    0x8(%ebp),%edx
+     69b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+     69e:	85 f6                	test   %esi,%esi
+     6a0:	74 2e                	je     6d0 <memcmp+0x40>
+     6a2:	01 c6                	add    %eax,%esi
+     6a4:	eb 14                	jmp    6ba <memcmp+0x2a>
+     6a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6ad:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+     6b0:	83 c0 01             	add    $0x1,%eax
+     6b3:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+     6b6:	39 f0                	cmp    %esi,%eax
+     6b8:	74 16                	je     6d0 <memcmp+0x40>
+    if(*s1 != *s2)
+     6ba:	0f b6 0a             	movzbl (%edx),%ecx
+     6bd:	0f b6 18             	movzbl (%eax),%ebx
+     6c0:	38 d9                	cmp    %bl,%cl
+     6c2:	74 ec                	je     6b0 <memcmp+0x20>
+      return *s1 - *s2;
+     6c4:	0f b6 c1             	movzbl %cl,%eax
+     6c7:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+     6c9:	5b                   	pop    %ebx
+     6ca:	5e                   	pop    %esi
+     6cb:	5d                   	pop    %ebp
+     6cc:	c3                   	ret
+     6cd:	8d 76 00             	lea    0x0(%esi),%esi
+     6d0:	5b                   	pop    %ebx
+  return 0;
+     6d1:	31 c0                	xor    %eax,%eax
+}
+     6d3:	5e                   	pop    %esi
+     6d4:	5d                   	pop    %ebp
+     6d5:	c3                   	ret
+     6d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000006e0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     6e0:	55                   	push   %ebp
+     6e1:	89 e5                	mov    %esp,%ebp
+     6e3:	8b 45 08             	mov    0x8(%ebp),%eax
+     6e6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     6ea:	0f b6 10             	movzbl (%eax),%edx
+     6ed:	84 d2                	test   %dl,%dl
+     6ef:	75 12                	jne    703 <strchr+0x23>
+     6f1:	eb 1d                	jmp    710 <strchr+0x30>
+     6f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     6f7:	90                   	nop
+     6f8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     6fc:	83 c0 01             	add    $0x1,%eax
+     6ff:	84 d2                	test   %dl,%dl
+     701:	74 0d                	je     710 <strchr+0x30>
+    if(*s == c)
+     703:	38 d1                	cmp    %dl,%cl
+     705:	75 f1                	jne    6f8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     707:	5d                   	pop    %ebp
+     708:	c3                   	ret
+     709:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     710:	31 c0                	xor    %eax,%eax
+}
+     712:	5d                   	pop    %ebp
+     713:	c3                   	ret
+     714:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     71b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     71f:	90                   	nop
+
+00000720 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     720:	55                   	push   %ebp
+     721:	89 e5                	mov    %esp,%ebp
+     723:	57                   	push   %edi
+     724:	56                   	push   %esi
+int
+read(int fd, void *buf, int n)
+{
+  if(flushhook)
+    flushhook();
+  return _read(fd, buf, n);
+     725:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     728:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     729:	31 db                	xor    %ebx,%ebx
+{
+     72b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     72e:	eb 32                	jmp    762 <gets+0x42>
+  if(flushhook)
+     730:	a1 20 36 00 00       	mov    0x3620,%eax
+     735:	85 c0                	test   %eax,%eax
+     737:	74 02                	je     73b <gets+0x1b>
+    flushhook();
+     739:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+     73b:	83 ec 04             	sub    $0x4,%esp
+     73e:	6a 01                	push   $0x1
+     740:	56                   	push   %esi
+     741:	6a 00                	push   $0x0
+     743:	e8 60 03 00 00       	call   aa8 <_read>
+    if(cc < 1)
+     748:	83 c4 10             	add    $0x10,%esp
+     74b:	85 c0                	test   %eax,%eax
+     74d:	7e 1d                	jle    76c <gets+0x4c>
+    buf[i++] = c;
+     74f:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     753:	8b 55 08             	mov    0x8(%ebp),%edx
+     756:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     75a:	3c 0a                	cmp    $0xa,%al
+     75c:	74 10                	je     76e <gets+0x4e>
+     75e:	3c 0d                	cmp    $0xd,%al
+     760:	74 0c                	je     76e <gets+0x4e>
+  for(i=0; i+1 < max; ){
+     762:	89 df                	mov    %ebx,%edi
+     764:	83 c3 01             	add    $0x1,%ebx
+     767:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     76a:	7c c4                	jl     730 <gets+0x10>
+     76c:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+     76e:	8b 45 08             	mov    0x8(%ebp),%eax
+     771:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+     775:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     778:	5b                   	pop    %ebx
+     779:	5e                   	pop    %esi
+     77a:	5f                   	pop    %edi
+     77b:	5d                   	pop    %ebp
+     77c:	c3                   	ret
+     77d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000780 <stat>:
+{
+     780:	55                   	push   %ebp
+     781:	89 e5                	mov    %esp,%ebp
+     783:	56                   	push   %esi
+     784:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+     785:	83 ec 08             	sub    $0x8,%esp
+     788:	6a 00                	push   $0x0
+     78a:	ff 75 08             	push   0x8(%ebp)
+     78d:	e8 3e 03 00 00       	call   ad0 <open>
+  if(fd < 0)
+     792:	83 c4 10             	add    $0x10,%esp
+     795:	85 c0                	test   %eax,%eax
+     797:	78 37                	js     7d0 <stat+0x50>
+  r = fstat(fd, st);
+     799:	83 ec 08             	sub    $0x8,%esp
+     79c:	ff 75 0c             	push   0xc(%ebp)
+     79f:	89 c3                	mov    %eax,%ebx
+     7a1:	50                   	push   %eax
+     7a2:	e8 41 03 00 00       	call   ae8 <fstat>
+}
+
+int
+close(int fd)
+{
+  if(flushhook)
+     7a7:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+     7aa:	89 c6                	mov    %eax,%esi
+  if(flushhook)
+     7ac:	a1 20 36 00 00       	mov    0x3620,%eax
+     7b1:	85 c0                	test   %eax,%eax
+     7b3:	74 02                	je     7b7 <stat+0x37>
+    flushhook();
+     7b5:	ff d0                	call   *%eax
+  return _close(fd);
+     7b7:	83 ec 0c             	sub    $0xc,%esp
+     7ba:	53                   	push   %ebx
+     7bb:	e8 f8 02 00 00       	call   ab8 <_close>
+     7c0:	83 c4 10             	add    $0x10,%esp
+}
+     7c3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     7c6:	89 f0                	mov    %esi,%eax
+     7c8:	5b                   	pop    %ebx
+     7c9:	5e                   	pop    %esi
+     7ca:	5d                   	pop    %ebp
+     7cb:	c3                   	ret
+     7cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+     7d0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     7d5:	eb ec                	jmp    7c3 <stat+0x43>
+     7d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7de:	66 90                	xchg   %ax,%ax
+
+000007e0 <atoi>:
+{
+     7e0:	55                   	push   %ebp
+     7e1:	89 e5                	mov    %esp,%ebp
+     7e3:	53                   	push   %ebx
+     7e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+     7e7:	0f be 02             	movsbl (%edx),%eax
+     7ea:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     7ed:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     7f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     7f5:	77 1e                	ja     815 <atoi+0x35>
+     7f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7fe:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     800:	83 c2 01             	add    $0x1,%edx
+     803:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     806:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     80a:	0f be 02             	movsbl (%edx),%eax
+     80d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     810:	80 fb 09             	cmp    $0x9,%bl
+     813:	76 eb                	jbe    800 <atoi+0x20>
+}
+     815:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     818:	89 c8                	mov    %ecx,%eax
+     81a:	c9                   	leave
+     81b:	c3                   	ret
+     81c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000820 <memmove>:
+{
+     820:	55                   	push   %ebp
+     821:	89 e5                	mov    %esp,%ebp
+     823:	57                   	push   %edi
+     824:	56                   	push   %esi
+     825:	8b 45 10             	mov    0x10(%ebp),%eax
+     828:	8b 55 08             	mov    0x8(%ebp),%edx
+     82b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+     82e:	85 c0                	test   %eax,%eax
+     830:	7e 13                	jle    845 <memmove+0x25>
+     832:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     834:	89 d7                	mov    %edx,%edi
+     836:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     83d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     840:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     841:	39 f8                	cmp    %edi,%eax
+     843:	75 fb                	jne    840 <memmove+0x20>
+}
+     845:	5e                   	pop    %esi
+     846:	89 d0                	mov    %edx,%eax
+     848:	5f                   	pop    %edi
+     849:	5d                   	pop    %ebp
+     84a:	c3                   	ret
+     84b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     84f:	90                   	nop
+
+00000850 <fork>:
+  if(flushhook)
+     850:	a1 20 36 00 00       	mov    0x3620,%eax
+     855:	85 c0                	test   %eax,%eax
+     857:	74 17                	je     870 <fork+0x20>
+{
+     859:	55                   	push   %ebp
+     85a:	89 e5                	mov    %esp,%ebp
+     85c:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+     85f:	ff d0                	call   *%eax
+}
+     861:	c9                   	leave
+  return _fork();
+     862:	e9 21 02 00 00       	jmp    a88 <_fork>
+     867:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     86e:	66 90                	xchg   %ax,%ax
+     870:	e9 13 02 00 00       	jmp    a88 <_fork>
+     875:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     87c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000880 <exit>:
+{
+     880:	55                   	push   %ebp
+     881:	89 e5                	mov    %esp,%ebp
+     883:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+     886:	a1 20 36 00 00       	mov    0x3620,%eax
+     88b:	85 c0                	test   %eax,%eax
+     88d:	74 02                	je     891 <exit+0x11>
+    flushhook();
+     88f:	ff d0                	call   *%eax
+  _exit();
+     891:	e8 fa 01 00 00       	call   a90 <_exit>
+     896:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     89d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000008a0 <exec>:
+{
+     8a0:	55                   	push   %ebp
+  if(flushhook)
+     8a1:	a1 20 36 00 00       	mov    0x3620,%eax
+{
+     8a6:	89 e5                	mov    %esp,%ebp
+     8a8:	56                   	push   %esi
+     8a9:	53                   	push   %ebx
+     8aa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     8ad:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+     8b0:	85 c0                	test   %eax,%eax
+     8b2:	74 02                	je     8b6 <exec+0x16>
+    flushhook();
+     8b4:	ff d0                	call   *%eax
+  return _exec(path, argv);
+     8b6:	89 75 0c             	mov    %esi,0xc(%ebp)
+     8b9:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     8bc:	5b                   	pop    %ebx
+     8bd:	5e                   	pop    %esi
+     8be:	5d                   	pop    %ebp
+  return _exec(path, argv);
+     8bf:	e9 04 02 00 00       	jmp    ac8 <_exec>
+     8c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     8cf:	90                   	nop
+
+000008d0 <read>:
+{
+     8d0:	55                   	push   %ebp
+     8d1:	89 e5                	mov    %esp,%ebp
+     8d3:	57                   	push   %edi
+     8d4:	56                   	push   %esi
+     8d5:	53                   	push   %ebx
+     8d6:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     8d9:	a1 20 36 00 00       	mov    0x3620,%eax
+{
+     8de:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     8e1:	8b 75 0c             	mov    0xc(%ebp),%esi
+     8e4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     8e7:	85 c0                	test   %eax,%eax
+     8e9:	74 02                	je     8ed <read+0x1d>
+    flushhook();
+     8eb:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+     8ed:	89 7d 10             	mov    %edi,0x10(%ebp)
+     8f0:	89 75 0c             	mov    %esi,0xc(%ebp)
+     8f3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     8f6:	83 c4 0c             	add    $0xc,%esp
+     8f9:	5b                   	pop    %ebx
+     8fa:	5e                   	pop    %esi
+     8fb:	5f                   	pop    %edi
+     8fc:	5d                   	pop    %ebp
+  return _read(fd, buf, n);
+     8fd:	e9 a6 01 00 00       	jmp    aa8 <_read>
+     902:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     909:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000910 <readv>:
+{
+     910:	55                   	push   %ebp
+     911:	89 e5                	mov    %esp,%ebp
+     913:	57                   	push   %edi
+     914:	56                   	push   %esi
+     915:	53                   	push   %ebx
+     916:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     919:	a1 20 36 00 00       	mov    0x3620,%eax
+{
+     91e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     921:	8b 75 0c             	mov    0xc(%ebp),%esi
+     924:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     927:	85 c0                	test   %eax,%eax
+     929:	74 02                	je     92d <readv+0x1d>
+    flushhook();
+     92b:	ff d0                	call   *%eax
+  return _readv(fd, iov, cnt);
+     92d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     930:	89 75 0c             	mov    %esi,0xc(%ebp)
+     933:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     936:	83 c4 0c             	add    $0xc,%esp
+     939:	5b                   	pop    %ebx
+     93a:	5e                   	pop    %esi
+     93b:	5f                   	pop    %edi
+     93c:	5d                   	pop    %ebp
+  return _readv(fd, iov, cnt);
+     93d:	e9 76 02 00 00       	jmp    bb8 <_readv>
+     942:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     949:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000950 <write>:
+{
+     950:	55                   	push   %ebp
+     951:	89 e5                	mov    %esp,%ebp
+     953:	57                   	push   %edi
+     954:	56                   	push   %esi
+     955:	53                   	push   %ebx
+     956:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     959:	a1 20 36 00 00       	mov    0x3620,%eax
+{
+     95e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     961:	8b 75 0c             	mov    0xc(%ebp),%esi
+     964:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     967:	85 c0                	test   %eax,%eax
+     969:	74 02                	je     96d <write+0x1d>
+    flushhook();
+     96b:	ff d0                	call   *%eax
+  return _write(fd, buf, n);
+     96d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     970:	89 75 0c             	mov    %esi,0xc(%ebp)
+     973:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     976:	83 c4 0c             	add    $0xc,%esp
+     979:	5b                   	pop    %ebx
+     97a:	5e                   	pop    %esi
+     97b:	5f                   	pop    %edi
+     97c:	5d                   	pop    %ebp
+  return _write(fd, buf, n);
+     97d:	e9 2e 01 00 00       	jmp    ab0 <_write>
+     982:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     989:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000990 <writev>:
+{
+     990:	55                   	push   %ebp
+     991:	89 e5                	mov    %esp,%ebp
+     993:	57                   	push   %edi
+     994:	56                   	push   %esi
+     995:	53                   	push   %ebx
+     996:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     999:	a1 20 36 00 00       	mov    0x3620,%eax
+{
+     99e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     9a1:	8b 75 0c             	mov    0xc(%ebp),%esi
+     9a4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     9a7:	85 c0                	test   %eax,%eax
+     9a9:	74 02                	je     9ad <writev+0x1d>
+    flushhook();
+     9ab:	ff d0                	call   *%eax
+  return _writev(fd, iov, cnt);
+     9ad:	89 7d 10             	mov    %edi,0x10(%ebp)
+     9b0:	89 75 0c             	mov    %esi,0xc(%ebp)
+     9b3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     9b6:	83 c4 0c             	add    $0xc,%esp
+     9b9:	5b                   	pop    %ebx
+     9ba:	5e                   	pop    %esi
+     9bb:	5f                   	pop    %edi
+     9bc:	5d                   	pop    %ebp
+  return _writev(fd, iov, cnt);
+     9bd:	e9 fe 01 00 00       	jmp    bc0 <_writev>
+     9c2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000009d0 <close>:
+{
+     9d0:	55                   	push   %ebp
+     9d1:	89 e5                	mov    %esp,%ebp
+     9d3:	53                   	push   %ebx
+     9d4:	83 ec 04             	sub    $0x4,%esp
+  if(flushhook)
+     9d7:	a1 20 36 00 00       	mov    0x3620,%eax
+{
+     9dc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(flushhook)
+     9df:	85 c0                	test   %eax,%eax
+     9e1:	74 02                	je     9e5 <close+0x15>
+    flushhook();
+     9e3:	ff d0                	call   *%eax
+  return _close(fd);
+     9e5:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     9e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     9eb:	c9                   	leave
+  return _close(fd);
+     9ec:	e9 c7 00 00 00       	jmp    ab8 <_close>
+     9f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9ff:	90                   	nop
+
+00000a00 <umtxinit>:
+// process that finds the mutex held enters the kernel, to sleep
+// in futexwait() until the holder's umtxunlock() wakes it.
+
+void
+umtxinit(struct umutex *m)
+{
+     a00:	55                   	push   %ebp
+     a01:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+     a03:	8b 45 08             	mov    0x8(%ebp),%eax
+     a06:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     a0c:	5d                   	pop    %ebp
+     a0d:	c3                   	ret
+     a0e:	66 90                	xchg   %ax,%ax
+
+00000a10 <umtxlock>:
+
+void
+umtxlock(struct umutex *m)
+{
+     a10:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+     a11:	b8 01 00 00 00       	mov    $0x1,%eax
+     a16:	89 e5                	mov    %esp,%ebp
+     a18:	56                   	push   %esi
+     a19:	53                   	push   %ebx
+     a1a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     a1d:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 1) == 0)
+     a20:	85 c0                	test   %eax,%eax
+     a22:	74 2b                	je     a4f <umtxlock+0x3f>
+     a24:	b8 02 00 00 00       	mov    $0x2,%eax
+     a29:	f0 87 03             	lock xchg %eax,(%ebx)
+    return;
+  // Mark the mutex contended, so that its holder
+  // wakes a waiter on release, and wait.
+  while(xchg(&m->state, 2) != 0)
+     a2c:	85 c0                	test   %eax,%eax
+     a2e:	74 1f                	je     a4f <umtxlock+0x3f>
+     a30:	be 02 00 00 00       	mov    $0x2,%esi
+     a35:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwait(&m->state, 2);
+     a38:	83 ec 08             	sub    $0x8,%esp
+     a3b:	6a 02                	push   $0x2
+     a3d:	53                   	push   %ebx
+     a3e:	e8 85 01 00 00       	call   bc8 <futexwait>
+     a43:	89 f0                	mov    %esi,%eax
+     a45:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+     a48:	83 c4 10             	add    $0x10,%esp
+     a4b:	85 c0                	test   %eax,%eax
+     a4d:	75 e9                	jne    a38 <umtxlock+0x28>
+}
+     a4f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     a52:	5b                   	pop    %ebx
+     a53:	5e                   	pop    %esi
+     a54:	5d                   	pop    %ebp
+     a55:	c3                   	ret
+     a56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a5d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a60 <umtxunlock>:
+
+void
+umtxunlock(struct umutex *m)
+{
+     a60:	55                   	push   %ebp
+     a61:	31 c0                	xor    %eax,%eax
+     a63:	89 e5                	mov    %esp,%ebp
+     a65:	83 ec 08             	sub    $0x8,%esp
+     a68:	8b 55 08             	mov    0x8(%ebp),%edx
+     a6b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+     a6e:	83 f8 02             	cmp    $0x2,%eax
+     a71:	74 05                	je     a78 <umtxunlock+0x18>
+    futexwake(&m->state, 1);
+}
+     a73:	c9                   	leave
+     a74:	c3                   	ret
+     a75:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwake(&m->state, 1);
+     a78:	83 ec 08             	sub    $0x8,%esp
+     a7b:	6a 01                	push   $0x1
+     a7d:	52                   	push   %edx
+     a7e:	e8 4d 01 00 00       	call   bd0 <futexwake>
+     a83:	83 c4 10             	add    $0x10,%esp
+}
+     a86:	c9                   	leave
+     a87:	c3                   	ret
+
+00000a88 <_fork>:
+  _ ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+     a88:	b8 01 00 00 00       	mov    $0x1,%eax
+     a8d:	cd 40                	int    $0x40
+     a8f:	c3                   	ret
+
+00000a90 <_exit>:
+RAWSYSCALL(exit)
+     a90:	b8 02 00 00 00       	mov    $0x2,%eax
+     a95:	cd 40                	int    $0x40
+     a97:	c3                   	ret
+
+00000a98 <wait>:
+SYSCALL(wait)
+     a98:	b8 03 00 00 00       	mov    $0x3,%eax
+     a9d:	cd 40                	int    $0x40
+     a9f:	c3                   	ret
+
+00000aa0 <pipe>:
+SYSCALL(pipe)
+     aa0:	b8 04 00 00 00       	mov    $0x4,%eax
+     aa5:	cd 40                	int    $0x40
+     aa7:	c3                   	ret
+
+00000aa8 <_read>:
+RAWSYSCALL(read)
+     aa8:	b8 05 00 00 00       	mov    $0x5,%eax
+     aad:	cd 40                	int    $0x40
+     aaf:	c3                   	ret
+
+00000ab0 <_write>:
+RAWSYSCALL(write)
+     ab0:	b8 10 00 00 00       	mov    $0x10,%eax
+     ab5:	cd 40                	int    $0x40
+     ab7:	c3                   	ret
+
+00000ab8 <_close>:
+RAWSYSCALL(close)
+     ab8:	b8 15 00 00 00       	mov    $0x15,%eax
+     abd:	cd 40                	int    $0x40
+     abf:	c3                   	ret
+
+00000ac0 <kill>:
+SYSCALL(kill)
+     ac0:	b8 06 00 00 00       	mov    $0x6,%eax
+     ac5:	cd 40                	int    $0x40
+     ac7:	c3                   	ret
+
+00000ac8 <_exec>:
+RAWSYSCALL(exec)
+     ac8:	b8 07 00 00 00       	mov    $0x7,%eax
+     acd:	cd 40                	int    $0x40
+     acf:	c3                   	ret
+
+00000ad0 <open>:
+SYSCALL(open)
+     ad0:	b8 0f 00 00 00       	mov    $0xf,%eax
+     ad5:	cd 40                	int    $0x40
+     ad7:	c3                   	ret
+
+00000ad8 <mknod>:
+SYSCALL(mknod)
+     ad8:	b8 11 00 00 00       	mov    $0x11,%eax
+     add:	cd 40                	int    $0x40
+     adf:	c3                   	ret
+
+00000ae0 <unlink>:
+SYSCALL(unlink)
+     ae0:	b8 12 00 00 00       	mov    $0x12,%eax
+     ae5:	cd 40                	int    $0x40
+     ae7:	c3                   	ret
+
+00000ae8 <fstat>:
+SYSCALL(fstat)
+     ae8:	b8 08 00 00 00       	mov    $0x8,%eax
+     aed:	cd 40                	int    $0x40
+     aef:	c3                   	ret
+
+00000af0 <link>:
+SYSCALL(link)
+     af0:	b8 13 00 00 00       	mov    $0x13,%eax
+     af5:	cd 40                	int    $0x40
+     af7:	c3                   	ret
+
+00000af8 <mkdir>:
+SYSCALL(mkdir)
+     af8:	b8 14 00 00 00       	mov    $0x14,%eax
+     afd:	cd 40                	int    $0x40
+     aff:	c3                   	ret
+
+00000b00 <chdir>:
+SYSCALL(chdir)
+     b00:	b8 09 00 00 00       	mov    $0x9,%eax
+     b05:	cd 40                	int    $0x40
+     b07:	c3                   	ret
+
+00000b08 <dup>:
+SYSCALL(dup)
+     b08:	b8 0a 00 00 00       	mov    $0xa,%eax
+     b0d:	cd 40                	int    $0x40
+     b0f:	c3                   	ret
+
+00000b10 <getpid>:
+SYSCALL(getpid)
+     b10:	b8 0b 00 00 00       	mov    $0xb,%eax
+     b15:	cd 40                	int    $0x40
+     b17:	c3                   	ret
+
+00000b18 <sbrk>:
+SYSCALL(sbrk)
+     b18:	b8 0c 00 00 00       	mov    $0xc,%eax
+     b1d:	cd 40                	int    $0x40
+     b1f:	c3                   	ret
+
+00000b20 <sleep>:
+SYSCALL(sleep)
+     b20:	b8 0d 00 00 00       	mov    $0xd,%eax
+     b25:	cd 40                	int    $0x40
+     b27:	c3                   	ret
+
+00000b28 <uptime>:
+SYSCALL(uptime)
+     b28:	b8 0e 00 00 00       	mov    $0xe,%eax
+     b2d:	cd 40                	int    $0x40
+     b2f:	c3                   	ret
+
+00000b30 <wolfie>:
+SYSCALL(wolfie)
+     b30:	b8 16 00 00 00       	mov    $0x16,%eax
+     b35:	cd 40                	int    $0x40
+     b37:	c3                   	ret
+
+00000b38 <nice>:
+SYSCALL(nice)
+     b38:	b8 17 00 00 00       	mov    $0x17,%eax
+     b3d:	cd 40                	int    $0x40
+     b3f:	c3                   	ret
+
+00000b40 <mtxget>:
+SYSCALL(mtxget)
+     b40:	b8 18 00 00 00       	mov    $0x18,%eax
+     b45:	cd 40                	int    $0x40
+     b47:	c3                   	ret
+
+00000b48 <mtxrel>:
+SYSCALL(mtxrel)
+     b48:	b8 19 00 00 00       	mov    $0x19,%eax
+     b4d:	cd 40                	int    $0x40
+     b4f:	c3                   	ret
+
+00000b50 <mtxacq>:
+SYSCALL(mtxacq)
+     b50:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     b55:	cd 40                	int    $0x40
+     b57:	c3                   	ret
+
+00000b58 <mtxdel>:
+SYSCALL(mtxdel)
+     b58:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     b5d:	cd 40                	int    $0x40
+     b5f:	c3                   	ret
+
+00000b60 <iostat>:
+SYSCALL(iostat)
+     b60:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     b65:	cd 40                	int    $0x40
+     b67:	c3                   	ret
+
+00000b68 <mmap>:
+SYSCALL(mmap)
+     b68:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     b6d:	cd 40                	int    $0x40
+     b6f:	c3                   	ret
+
+00000b70 <munmap>:
+SYSCALL(munmap)
+     b70:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     b75:	cd 40                	int    $0x40
+     b77:	c3                   	ret
+
+00000b78 <shmget>:
+SYSCALL(shmget)
+     b78:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     b7d:	cd 40                	int    $0x40
+     b7f:	c3                   	ret
+
+00000b80 <shmat>:
+SYSCALL(shmat)
+     b80:	b8 20 00 00 00       	mov    $0x20,%eax
+     b85:	cd 40                	int    $0x40
+     b87:	c3                   	ret
+
+00000b88 <shmdt>:
+SYSCALL(shmdt)
+     b88:	b8 21 00 00 00       	mov    $0x21,%eax
+     b8d:	cd 40                	int    $0x40
+     b8f:	c3                   	ret
+
+00000b90 <shmdel>:
+SYSCALL(shmdel)
+     b90:	b8 22 00 00 00       	mov    $0x22,%eax
+     b95:	cd 40                	int    $0x40
+     b97:	c3                   	ret
+
+00000b98 <syscount>:
+SYSCALL(syscount)
+     b98:	b8 23 00 00 00       	mov    $0x23,%eax
+     b9d:	cd 40                	int    $0x40
+     b9f:	c3                   	ret
+
+00000ba0 <splice>:
+SYSCALL(splice)
+     ba0:	b8 24 00 00 00       	mov    $0x24,%eax
+     ba5:	cd 40                	int    $0x40
+     ba7:	c3                   	ret
+
+00000ba8 <tee>:
+SYSCALL(tee)
+     ba8:	b8 25 00 00 00       	mov    $0x25,%eax
+     bad:	cd 40                	int    $0x40
+     baf:	c3                   	ret
+
+00000bb0 <sendfile>:
+SYSCALL(sendfile)
+     bb0:	b8 26 00 00 00       	mov    $0x26,%eax
+     bb5:	cd 40                	int    $0x40
+     bb7:	c3                   	ret
+
+00000bb8 <_readv>:
+RAWSYSCALL(readv)
+     bb8:	b8 27 00 00 00       	mov    $0x27,%eax
+     bbd:	cd 40                	int    $0x40
+     bbf:	c3                   	ret
+
+00000bc0 <_writev>:
+RAWSYSCALL(writev)
+     bc0:	b8 28 00 00 00       	mov    $0x28,%eax
+     bc5:	cd 40                	int    $0x40
+     bc7:	c3                   	ret
+
+00000bc8 <futexwait>:
+SYSCALL(futexwait)
+     bc8:	b8 29 00 00 00       	mov    $0x29,%eax
+     bcd:	cd 40                	int    $0x40
+     bcf:	c3                   	ret
+
+00000bd0 <futexwake>:
+SYSCALL(futexwake)
+     bd0:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     bd5:	cd 40                	int    $0x40
+     bd7:	c3                   	ret
+
+00000bd8 <lockstat>:
+SYSCALL(lockstat)
+     bd8:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     bdd:	cd 40                	int    $0x40
+     bdf:	c3                   	ret
+
+00000be0 <clone>:
+SYSCALL(clone)
+     be0:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     be5:	cd 40                	int    $0x40
+     be7:	c3                   	ret
+
+00000be8 <join>:
+SYSCALL(join)
+     be8:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     bed:	cd 40                	int    $0x40
+     bef:	c3                   	ret
+
+00000bf0 <stacklimit>:
+SYSCALL(stacklimit)
+     bf0:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     bf5:	cd 40                	int    $0x40
+     bf7:	c3                   	ret
+     bf8:	66 90                	xchg   %ax,%ax
+     bfa:	66 90                	xchg   %ax,%ax
+     bfc:	66 90                	xchg   %ax,%ax
+     bfe:	66 90                	xchg   %ax,%ax
+
+00000c00 <flushall>:
+  b->n = 0;
+}
+
+static void
+flushall(void)
+{
+     c00:	55                   	push   %ebp
+     c01:	89 e5                	mov    %esp,%ebp
+     c03:	83 ec 14             	sub    $0x14,%esp
+  umtxlock(&stdoutlock);
+     c06:	68 24 36 00 00       	push   $0x3624
+     c0b:	e8 00 fe ff ff       	call   a10 <umtxlock>
+  if(b->n > 0)
+     c10:	a1 08 20 00 00       	mov    0x2008,%eax
+     c15:	83 c4 10             	add    $0x10,%esp
+     c18:	85 c0                	test   %eax,%eax
+     c1a:	7e 17                	jle    c33 <flushall+0x33>
+    _write(b->fd, b->buf, b->n);
+     c1c:	83 ec 04             	sub    $0x4,%esp
+     c1f:	50                   	push   %eax
+     c20:	68 0c 20 00 00       	push   $0x200c
+     c25:	ff 35 00 20 00 00    	push   0x2000
+     c2b:	e8 80 fe ff ff       	call   ab0 <_write>
+     c30:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     c33:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     c3a:	00 00 00 
+  flush(&stdout);
+  umtxunlock(&stdoutlock);
+     c3d:	83 ec 0c             	sub    $0xc,%esp
+     c40:	68 24 36 00 00       	push   $0x3624
+     c45:	e8 16 fe ff ff       	call   a60 <umtxunlock>
+}
+     c4a:	83 c4 10             	add    $0x10,%esp
+     c4d:	c9                   	leave
+     c4e:	c3                   	ret
+     c4f:	90                   	nop
+
+00000c50 <printint>:
+    flush(b);
+}
+
+static void
+printint(struct outbuf *b, int xx, int base, int sgn)
+{
+     c50:	55                   	push   %ebp
+     c51:	89 e5                	mov    %esp,%ebp
+     c53:	57                   	push   %edi
+     c54:	89 cf                	mov    %ecx,%edi
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     c56:	89 d1                	mov    %edx,%ecx
+{
+     c58:	56                   	push   %esi
+     c59:	53                   	push   %ebx
+     c5a:	89 c3                	mov    %eax,%ebx
+     c5c:	83 ec 2c             	sub    $0x2c,%esp
+  if(sgn && xx < 0){
+     c5f:	85 d2                	test   %edx,%edx
+     c61:	0f 89 b9 00 00 00    	jns    d20 <printint+0xd0>
+     c67:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     c6b:	0f 84 af 00 00 00    	je     d20 <printint+0xd0>
+    x = -xx;
+     c71:	f7 d9                	neg    %ecx
+    neg = 1;
+     c73:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     c78:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     c7b:	31 f6                	xor    %esi,%esi
+     c7d:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     c80:	89 c8                	mov    %ecx,%eax
+     c82:	31 d2                	xor    %edx,%edx
+     c84:	89 f3                	mov    %esi,%ebx
+     c86:	f7 f7                	div    %edi
+     c88:	8d 76 01             	lea    0x1(%esi),%esi
+     c8b:	0f b6 92 48 19 00 00 	movzbl 0x1948(%edx),%edx
+     c92:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     c96:	89 ca                	mov    %ecx,%edx
+     c98:	89 c1                	mov    %eax,%ecx
+     c9a:	39 fa                	cmp    %edi,%edx
+     c9c:	73 e2                	jae    c80 <printint+0x30>
+  if(neg)
+     c9e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     ca1:	89 d9                	mov    %ebx,%ecx
+     ca3:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     ca6:	85 c0                	test   %eax,%eax
+     ca8:	74 07                	je     cb1 <printint+0x61>
+    buf[i++] = '-';
+     caa:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     caf:	89 f1                	mov    %esi,%ecx
+     cb1:	8d 75 d8             	lea    -0x28(%ebp),%esi
+     cb4:	89 cf                	mov    %ecx,%edi
+     cb6:	01 f7                	add    %esi,%edi
+     cb8:	eb 1a                	jmp    cd4 <printint+0x84>
+     cba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    *b->str++ = c;
+     cc0:	8d 48 01             	lea    0x1(%eax),%ecx
+     cc3:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+     cc9:	88 10                	mov    %dl,(%eax)
+
+  while(--i >= 0)
+     ccb:	8d 47 ff             	lea    -0x1(%edi),%eax
+     cce:	39 fe                	cmp    %edi,%esi
+     cd0:	74 40                	je     d12 <printint+0xc2>
+     cd2:	89 c7                	mov    %eax,%edi
+  if(b->str){
+     cd4:	8b 83 0c 02 00 00    	mov    0x20c(%ebx),%eax
+    putc(b, buf[i]);
+     cda:	0f b6 17             	movzbl (%edi),%edx
+  if(b->str){
+     cdd:	85 c0                	test   %eax,%eax
+     cdf:	75 df                	jne    cc0 <printint+0x70>
+  b->buf[b->n++] = c;
+     ce1:	8b 4b 08             	mov    0x8(%ebx),%ecx
+     ce4:	8d 41 01             	lea    0x1(%ecx),%eax
+     ce7:	89 43 08             	mov    %eax,0x8(%ebx)
+     cea:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+     cee:	3d 00 02 00 00       	cmp    $0x200,%eax
+     cf3:	74 3b                	je     d30 <printint+0xe0>
+     cf5:	80 fa 0a             	cmp    $0xa,%dl
+     cf8:	75 d1                	jne    ccb <printint+0x7b>
+     cfa:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+     cfe:	75 cb                	jne    ccb <printint+0x7b>
+  if(b->n > 0)
+     d00:	85 c0                	test   %eax,%eax
+     d02:	7f 2c                	jg     d30 <printint+0xe0>
+  b->n = 0;
+     d04:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  while(--i >= 0)
+     d0b:	8d 47 ff             	lea    -0x1(%edi),%eax
+     d0e:	39 fe                	cmp    %edi,%esi
+     d10:	75 c0                	jne    cd2 <printint+0x82>
+}
+     d12:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d15:	5b                   	pop    %ebx
+     d16:	5e                   	pop    %esi
+     d17:	5f                   	pop    %edi
+     d18:	5d                   	pop    %ebp
+     d19:	c3                   	ret
+     d1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  neg = 0;
+     d20:	31 c0                	xor    %eax,%eax
+     d22:	e9 51 ff ff ff       	jmp    c78 <printint+0x28>
+     d27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d2e:	66 90                	xchg   %ax,%ax
+    _write(b->fd, b->buf, b->n);
+     d30:	83 ec 04             	sub    $0x4,%esp
+     d33:	50                   	push   %eax
+     d34:	8d 43 0c             	lea    0xc(%ebx),%eax
+     d37:	50                   	push   %eax
+     d38:	ff 33                	push   (%ebx)
+     d3a:	e8 71 fd ff ff       	call   ab0 <_write>
+     d3f:	83 c4 10             	add    $0x10,%esp
+     d42:	eb c0                	jmp    d04 <printint+0xb4>
+     d44:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d4f:	90                   	nop
+
+00000d50 <putc>:
+{
+     d50:	55                   	push   %ebp
+     d51:	89 e5                	mov    %esp,%ebp
+     d53:	53                   	push   %ebx
+     d54:	89 c3                	mov    %eax,%ebx
+     d56:	83 ec 04             	sub    $0x4,%esp
+  if(b->str){
+     d59:	8b 80 0c 02 00 00    	mov    0x20c(%eax),%eax
+     d5f:	85 c0                	test   %eax,%eax
+     d61:	74 15                	je     d78 <putc+0x28>
+    *b->str++ = c;
+     d63:	8d 48 01             	lea    0x1(%eax),%ecx
+     d66:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+     d6c:	88 10                	mov    %dl,(%eax)
+}
+     d6e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     d71:	c9                   	leave
+     d72:	c3                   	ret
+     d73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d77:	90                   	nop
+  b->buf[b->n++] = c;
+     d78:	8b 4b 08             	mov    0x8(%ebx),%ecx
+     d7b:	8d 41 01             	lea    0x1(%ecx),%eax
+     d7e:	89 43 08             	mov    %eax,0x8(%ebx)
+     d81:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+     d85:	3d 00 02 00 00       	cmp    $0x200,%eax
+     d8a:	74 14                	je     da0 <putc+0x50>
+     d8c:	80 fa 0a             	cmp    $0xa,%dl
+     d8f:	75 dd                	jne    d6e <putc+0x1e>
+     d91:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+     d95:	75 d7                	jne    d6e <putc+0x1e>
+  if(b->n > 0)
+     d97:	85 c0                	test   %eax,%eax
+     d99:	7e 17                	jle    db2 <putc+0x62>
+     d9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d9f:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     da0:	83 ec 04             	sub    $0x4,%esp
+     da3:	50                   	push   %eax
+     da4:	8d 43 0c             	lea    0xc(%ebx),%eax
+     da7:	50                   	push   %eax
+     da8:	ff 33                	push   (%ebx)
+     daa:	e8 01 fd ff ff       	call   ab0 <_write>
+     daf:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     db2:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+     db9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     dbc:	c9                   	leave
+     dbd:	c3                   	ret
+     dbe:	66 90                	xchg   %ax,%ax
+
+00000dc0 <format>:
+
+// Format fmt and the arguments at ap into b.
+// Only understands %d, %x, %p, %s, %c.
+static void
+format(struct outbuf *b, const char *fmt, uint *ap)
+{
+     dc0:	55                   	push   %ebp
+     dc1:	89 e5                	mov    %esp,%ebp
+     dc3:	57                   	push   %edi
+     dc4:	89 c7                	mov    %eax,%edi
+     dc6:	56                   	push   %esi
+     dc7:	53                   	push   %ebx
+     dc8:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+     dcb:	0f b6 02             	movzbl (%edx),%eax
+{
+     dce:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  for(i = 0; fmt[i]; i++){
+     dd1:	84 c0                	test   %al,%al
+     dd3:	74 5a                	je     e2f <format+0x6f>
+     dd5:	8d 5a 01             	lea    0x1(%edx),%ebx
+     dd8:	31 f6                	xor    %esi,%esi
+     dda:	eb 1c                	jmp    df8 <format+0x38>
+     ddc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     de0:	83 f8 25             	cmp    $0x25,%eax
+     de3:	74 3b                	je     e20 <format+0x60>
+        state = '%';
+      } else {
+        putc(b, c);
+     de5:	89 ca                	mov    %ecx,%edx
+     de7:	89 f8                	mov    %edi,%eax
+     de9:	e8 62 ff ff ff       	call   d50 <putc>
+  for(i = 0; fmt[i]; i++){
+     dee:	0f b6 03             	movzbl (%ebx),%eax
+     df1:	83 c3 01             	add    $0x1,%ebx
+     df4:	84 c0                	test   %al,%al
+     df6:	74 37                	je     e2f <format+0x6f>
+    c = fmt[i] & 0xff;
+     df8:	0f be c8             	movsbl %al,%ecx
+     dfb:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     dfe:	85 f6                	test   %esi,%esi
+     e00:	74 de                	je     de0 <format+0x20>
+      }
+    } else if(state == '%'){
+     e02:	83 fe 25             	cmp    $0x25,%esi
+     e05:	75 e7                	jne    dee <format+0x2e>
+      if(c == 'd'){
+     e07:	83 f8 25             	cmp    $0x25,%eax
+     e0a:	74 46                	je     e52 <format+0x92>
+     e0c:	83 e8 63             	sub    $0x63,%eax
+     e0f:	83 f8 15             	cmp    $0x15,%eax
+     e12:	77 2c                	ja     e40 <format+0x80>
+     e14:	ff 24 85 f0 18 00 00 	jmp    *0x18f0(,%eax,4)
+     e1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e1f:	90                   	nop
+  for(i = 0; fmt[i]; i++){
+     e20:	0f b6 03             	movzbl (%ebx),%eax
+     e23:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+     e26:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+     e2b:	84 c0                	test   %al,%al
+     e2d:	75 c9                	jne    df8 <format+0x38>
+        putc(b, c);
+      }
+      state = 0;
+    }
+  }
+}
+     e2f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e32:	5b                   	pop    %ebx
+     e33:	5e                   	pop    %esi
+     e34:	5f                   	pop    %edi
+     e35:	5d                   	pop    %ebp
+     e36:	c3                   	ret
+     e37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e3e:	66 90                	xchg   %ax,%ax
+        putc(b, '%');
+     e40:	ba 25 00 00 00       	mov    $0x25,%edx
+     e45:	89 f8                	mov    %edi,%eax
+     e47:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     e4a:	e8 01 ff ff ff       	call   d50 <putc>
+        putc(b, c);
+     e4f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     e52:	89 ca                	mov    %ecx,%edx
+     e54:	89 f8                	mov    %edi,%eax
+      state = 0;
+     e56:	31 f6                	xor    %esi,%esi
+        putc(b, c);
+     e58:	e8 f3 fe ff ff       	call   d50 <putc>
+     e5d:	eb 8f                	jmp    dee <format+0x2e>
+     e5f:	90                   	nop
+        printint(b, *ap, 16, 0);
+     e60:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     e63:	83 ec 0c             	sub    $0xc,%esp
+     e66:	b9 10 00 00 00       	mov    $0x10,%ecx
+     e6b:	8b 16                	mov    (%esi),%edx
+     e6d:	6a 00                	push   $0x0
+        ap++;
+     e6f:	83 c6 04             	add    $0x4,%esi
+        printint(b, *ap, 16, 0);
+     e72:	89 f8                	mov    %edi,%eax
+     e74:	e8 d7 fd ff ff       	call   c50 <printint>
+        ap++;
+     e79:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+     e7c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     e7f:	31 f6                	xor    %esi,%esi
+     e81:	e9 68 ff ff ff       	jmp    dee <format+0x2e>
+     e86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e8d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     e90:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     e93:	8b 30                	mov    (%eax),%esi
+        ap++;
+     e95:	83 c0 04             	add    $0x4,%eax
+     e98:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+     e9b:	85 f6                	test   %esi,%esi
+     e9d:	75 1b                	jne    eba <format+0xfa>
+     e9f:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+     ea4:	be e8 18 00 00       	mov    $0x18e8,%esi
+     ea9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+          putc(b, *s);
+     eb0:	89 f8                	mov    %edi,%eax
+          s++;
+     eb2:	83 c6 01             	add    $0x1,%esi
+          putc(b, *s);
+     eb5:	e8 96 fe ff ff       	call   d50 <putc>
+        while(*s != 0){
+     eba:	0f be 16             	movsbl (%esi),%edx
+     ebd:	84 d2                	test   %dl,%dl
+     ebf:	75 ef                	jne    eb0 <format+0xf0>
+      state = 0;
+     ec1:	31 f6                	xor    %esi,%esi
+     ec3:	e9 26 ff ff ff       	jmp    dee <format+0x2e>
+     ec8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ecf:	90                   	nop
+        printint(b, *ap, 10, 1);
+     ed0:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     ed3:	83 ec 0c             	sub    $0xc,%esp
+     ed6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     edb:	8b 16                	mov    (%esi),%edx
+     edd:	6a 01                	push   $0x1
+     edf:	eb 8e                	jmp    e6f <format+0xaf>
+     ee1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(b, *ap);
+     ee8:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     eeb:	89 f8                	mov    %edi,%eax
+     eed:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+     ef0:	83 c6 04             	add    $0x4,%esi
+        putc(b, *ap);
+     ef3:	e8 58 fe ff ff       	call   d50 <putc>
+        ap++;
+     ef8:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      state = 0;
+     efb:	31 f6                	xor    %esi,%esi
+     efd:	e9 ec fe ff ff       	jmp    dee <format+0x2e>
+     f02:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000f10 <fflush>:
+{
+     f10:	55                   	push   %ebp
+     f11:	89 e5                	mov    %esp,%ebp
+     f13:	83 ec 08             	sub    $0x8,%esp
+  if(fd == stdout.fd)
+     f16:	8b 45 08             	mov    0x8(%ebp),%eax
+     f19:	39 05 00 20 00 00    	cmp    %eax,0x2000
+     f1f:	74 07                	je     f28 <fflush+0x18>
+}
+     f21:	c9                   	leave
+     f22:	c3                   	ret
+     f23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     f27:	90                   	nop
+  umtxlock(&stdoutlock);
+     f28:	83 ec 0c             	sub    $0xc,%esp
+     f2b:	68 24 36 00 00       	push   $0x3624
+     f30:	e8 db fa ff ff       	call   a10 <umtxlock>
+  if(b->n > 0)
+     f35:	a1 08 20 00 00       	mov    0x2008,%eax
+     f3a:	83 c4 10             	add    $0x10,%esp
+     f3d:	85 c0                	test   %eax,%eax
+     f3f:	7f 1f                	jg     f60 <fflush+0x50>
+  b->n = 0;
+     f41:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     f48:	00 00 00 
+  umtxunlock(&stdoutlock);
+     f4b:	c7 45 08 24 36 00 00 	movl   $0x3624,0x8(%ebp)
+}
+     f52:	c9                   	leave
+  umtxunlock(&stdoutlock);
+     f53:	e9 08 fb ff ff       	jmp    a60 <umtxunlock>
+     f58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f5f:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     f60:	83 ec 04             	sub    $0x4,%esp
+     f63:	50                   	push   %eax
+     f64:	68 0c 20 00 00       	push   $0x200c
+     f69:	ff 35 00 20 00 00    	push   0x2000
+     f6f:	e8 3c fb ff ff       	call   ab0 <_write>
+     f74:	83 c4 10             	add    $0x10,%esp
+     f77:	eb c8                	jmp    f41 <fflush+0x31>
+     f79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000f80 <setvbuf>:
+{
+     f80:	55                   	push   %ebp
+     f81:	89 e5                	mov    %esp,%ebp
+     f83:	53                   	push   %ebx
+     f84:	83 ec 04             	sub    $0x4,%esp
+     f87:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd != stdout.fd)
+     f8a:	8b 45 08             	mov    0x8(%ebp),%eax
+     f8d:	39 05 00 20 00 00    	cmp    %eax,0x2000
+     f93:	74 0b                	je     fa0 <setvbuf+0x20>
+}
+     f95:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     f98:	c9                   	leave
+     f99:	c3                   	ret
+     f9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  umtxlock(&stdoutlock);
+     fa0:	83 ec 0c             	sub    $0xc,%esp
+     fa3:	68 24 36 00 00       	push   $0x3624
+     fa8:	e8 63 fa ff ff       	call   a10 <umtxlock>
+  if(b->n > 0)
+     fad:	a1 08 20 00 00       	mov    0x2008,%eax
+     fb2:	83 c4 10             	add    $0x10,%esp
+     fb5:	85 c0                	test   %eax,%eax
+     fb7:	7f 2f                	jg     fe8 <setvbuf+0x68>
+  b->n = 0;
+     fb9:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     fc0:	00 00 00 
+  stdout.mode = mode;
+     fc3:	89 1d 04 20 00 00    	mov    %ebx,0x2004
+  flushhook = flushall;
+     fc9:	c7 05 20 36 00 00 00 	movl   $0xc00,0x3620
+     fd0:	0c 00 00 
+}
+     fd3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&stdoutlock);
+     fd6:	c7 45 08 24 36 00 00 	movl   $0x3624,0x8(%ebp)
+}
+     fdd:	c9                   	leave
+  umtxunlock(&stdoutlock);
+     fde:	e9 7d fa ff ff       	jmp    a60 <umtxunlock>
+     fe3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     fe7:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     fe8:	83 ec 04             	sub    $0x4,%esp
+     feb:	50                   	push   %eax
+     fec:	68 0c 20 00 00       	push   $0x200c
+     ff1:	ff 35 00 20 00 00    	push   0x2000
+     ff7:	e8 b4 fa ff ff       	call   ab0 <_write>
+     ffc:	83 c4 10             	add    $0x10,%esp
+     fff:	eb b8                	jmp    fb9 <setvbuf+0x39>
+    1001:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1008:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    100f:	90                   	nop
+
+00001010 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s, %c.
+void
+printf(int fd, const char *fmt, ...)
+{
+    1010:	55                   	push   %ebp
+    1011:	89 e5                	mov    %esp,%ebp
+    1013:	53                   	push   %ebx
+    1014:	81 ec 14 02 00 00    	sub    $0x214,%esp
+    101a:	8b 45 08             	mov    0x8(%ebp),%eax
+    local.mode = _IONBF;
+    local.n = 0;
+    local.str = 0;
+    b = &local;
+  }
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+    101d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd == stdout.fd){
+    1020:	39 05 00 20 00 00    	cmp    %eax,0x2000
+    1026:	74 48                	je     1070 <printf+0x60>
+    local.fd = fd;
+    1028:	89 85 e8 fd ff ff    	mov    %eax,-0x218(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+    102e:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    1031:	89 da                	mov    %ebx,%edx
+    1033:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+    local.mode = _IONBF;
+    1039:	c7 85 ec fd ff ff 03 	movl   $0x3,-0x214(%ebp)
+    1040:	00 00 00 
+    local.n = 0;
+    1043:	c7 85 f0 fd ff ff 00 	movl   $0x0,-0x210(%ebp)
+    104a:	00 00 00 
+    local.str = 0;
+    104d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+    1054:	e8 67 fd ff ff       	call   dc0 <format>
+  if(b->mode == _IONBF)
+    1059:	83 bd ec fd ff ff 03 	cmpl   $0x3,-0x214(%ebp)
+    1060:	0f 84 a2 00 00 00    	je     1108 <printf+0xf8>
+    flush(b);
+  if(b == &stdout)
+    umtxunlock(&stdoutlock);
+}
+    1066:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1069:	c9                   	leave
+    106a:	c3                   	ret
+    106b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    106f:	90                   	nop
+    umtxlock(&stdoutlock);
+    1070:	83 ec 0c             	sub    $0xc,%esp
+    1073:	68 24 36 00 00       	push   $0x3624
+    1078:	e8 93 f9 ff ff       	call   a10 <umtxlock>
+  if(stdout.mode == 0){
+    107d:	a1 04 20 00 00       	mov    0x2004,%eax
+    1082:	83 c4 10             	add    $0x10,%esp
+    1085:	85 c0                	test   %eax,%eax
+    1087:	74 37                	je     10c0 <printf+0xb0>
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+    1089:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    108c:	89 da                	mov    %ebx,%edx
+    108e:	b8 00 20 00 00       	mov    $0x2000,%eax
+    1093:	e8 28 fd ff ff       	call   dc0 <format>
+  if(b->mode == _IONBF)
+    1098:	83 3d 04 20 00 00 03 	cmpl   $0x3,0x2004
+    109f:	0f 84 ab 00 00 00    	je     1150 <printf+0x140>
+    umtxunlock(&stdoutlock);
+    10a5:	83 ec 0c             	sub    $0xc,%esp
+    10a8:	68 24 36 00 00       	push   $0x3624
+    10ad:	e8 ae f9 ff ff       	call   a60 <umtxunlock>
+}
+    10b2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    umtxunlock(&stdoutlock);
+    10b5:	83 c4 10             	add    $0x10,%esp
+}
+    10b8:	c9                   	leave
+    10b9:	c3                   	ret
+    10ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+    10c0:	83 ec 08             	sub    $0x8,%esp
+    10c3:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+    10c9:	50                   	push   %eax
+    10ca:	ff 35 00 20 00 00    	push   0x2000
+    10d0:	e8 13 fa ff ff       	call   ae8 <fstat>
+    10d5:	83 c4 10             	add    $0x10,%esp
+    10d8:	89 c2                	mov    %eax,%edx
+      stdout.mode = _IOFBF;
+    10da:	b8 01 00 00 00       	mov    $0x1,%eax
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+    10df:	85 d2                	test   %edx,%edx
+    10e1:	75 10                	jne    10f3 <printf+0xe3>
+      stdout.mode = _IOLBF;
+    10e3:	31 c0                	xor    %eax,%eax
+    10e5:	66 83 bd e8 fd ff ff 	cmpw   $0x3,-0x218(%ebp)
+    10ec:	03 
+    10ed:	0f 94 c0             	sete   %al
+    10f0:	83 c0 01             	add    $0x1,%eax
+    10f3:	a3 04 20 00 00       	mov    %eax,0x2004
+    flushhook = flushall;
+    10f8:	c7 05 20 36 00 00 00 	movl   $0xc00,0x3620
+    10ff:	0c 00 00 
+    1102:	eb 85                	jmp    1089 <printf+0x79>
+    1104:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(b->n > 0)
+    1108:	8b 85 f0 fd ff ff    	mov    -0x210(%ebp),%eax
+    110e:	85 c0                	test   %eax,%eax
+    1110:	0f 8e 50 ff ff ff    	jle    1066 <printf+0x56>
+    b = &local;
+    1116:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+    _write(b->fd, b->buf, b->n);
+    111c:	83 ec 04             	sub    $0x4,%esp
+    111f:	50                   	push   %eax
+    1120:	8d 43 0c             	lea    0xc(%ebx),%eax
+    1123:	50                   	push   %eax
+    1124:	ff 33                	push   (%ebx)
+    1126:	e8 85 f9 ff ff       	call   ab0 <_write>
+  b->n = 0;
+    112b:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  if(b == &stdout)
+    1132:	83 c4 10             	add    $0x10,%esp
+    1135:	81 fb 00 20 00 00    	cmp    $0x2000,%ebx
+    113b:	0f 85 25 ff ff ff    	jne    1066 <printf+0x56>
+    1141:	e9 5f ff ff ff       	jmp    10a5 <printf+0x95>
+    1146:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    114d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(b->n > 0)
+    1150:	a1 08 20 00 00       	mov    0x2008,%eax
+    b = getstdout();
+    1155:	bb 00 20 00 00       	mov    $0x2000,%ebx
+  if(b->n > 0)
+    115a:	85 c0                	test   %eax,%eax
+    115c:	7f be                	jg     111c <printf+0x10c>
+  b->n = 0;
+    115e:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+    1165:	00 00 00 
+  if(b == &stdout)
+    1168:	e9 38 ff ff ff       	jmp    10a5 <printf+0x95>
+    116d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001170 <sprintf>:
+
+// Print to the given buffer. Only understands %d, %x, %p, %s, %c.
+int
+sprintf(char *str, const char *fmt, ...)
+{
+    1170:	55                   	push   %ebp
+    1171:	89 e5                	mov    %esp,%ebp
+    1173:	53                   	push   %ebx
+  struct outbuf b;
+
+  b.str = str;
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+    1174:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+    117a:	8d 4d 10             	lea    0x10(%ebp),%ecx
+{
+    117d:	81 ec 14 02 00 00    	sub    $0x214,%esp
+    1183:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+    1186:	8b 55 0c             	mov    0xc(%ebp),%edx
+  b.str = str;
+    1189:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+    118c:	e8 2f fc ff ff       	call   dc0 <format>
+  *b.str = '\0';
+    1191:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1194:	c6 00 00             	movb   $0x0,(%eax)
+  return b.str - str;
+    1197:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    119a:	29 d8                	sub    %ebx,%eax
+}
+    119c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    119f:	c9                   	leave
+    11a0:	c3                   	ret
+    11a1:	66 90                	xchg   %ax,%ax
+    11a3:	66 90                	xchg   %ax,%ax
+    11a5:	66 90                	xchg   %ax,%ax
+    11a7:	66 90                	xchg   %ax,%ax
+    11a9:	66 90                	xchg   %ax,%ax
+    11ab:	66 90                	xchg   %ax,%ax
+    11ad:	66 90                	xchg   %ax,%ax
+    11af:	90                   	nop
+
+000011b0 <freeblock>:
+static Header *freep;
+static struct umutex lock;  // threads made by clone() share the heap
+
+static void
+freeblock(void *ap)
+{
+    11b0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+    11b1:	8d 48 f8             	lea    -0x8(%eax),%ecx
+{
+    11b4:	89 e5                	mov    %esp,%ebp
+    11b6:	57                   	push   %edi
+    11b7:	56                   	push   %esi
+    11b8:	53                   	push   %ebx
+    11b9:	89 c3                	mov    %eax,%ebx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    11bb:	a1 2c 36 00 00       	mov    0x362c,%eax
+    11c0:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    11c2:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    11c4:	39 ca                	cmp    %ecx,%edx
+    11c6:	73 30                	jae    11f8 <freeblock+0x48>
+    11c8:	39 c1                	cmp    %eax,%ecx
+    11ca:	72 04                	jb     11d0 <freeblock+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    11cc:	39 c2                	cmp    %eax,%edx
+    11ce:	72 f0                	jb     11c0 <freeblock+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    11d0:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    11d3:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    11d6:	39 f8                	cmp    %edi,%eax
+    11d8:	74 26                	je     1200 <freeblock+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    11da:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    11dd:	8b 42 04             	mov    0x4(%edx),%eax
+    11e0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    11e3:	39 f1                	cmp    %esi,%ecx
+    11e5:	74 30                	je     1217 <freeblock+0x67>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    11e7:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    11e9:	5b                   	pop    %ebx
+  freep = p;
+    11ea:	89 15 2c 36 00 00    	mov    %edx,0x362c
+}
+    11f0:	5e                   	pop    %esi
+    11f1:	5f                   	pop    %edi
+    11f2:	5d                   	pop    %ebp
+    11f3:	c3                   	ret
+    11f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    11f8:	39 c1                	cmp    %eax,%ecx
+    11fa:	72 d0                	jb     11cc <freeblock+0x1c>
+    11fc:	eb c2                	jmp    11c0 <freeblock+0x10>
+    11fe:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+    1200:	03 70 04             	add    0x4(%eax),%esi
+    1203:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1206:	8b 02                	mov    (%edx),%eax
+    1208:	8b 00                	mov    (%eax),%eax
+    120a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    120d:	8b 42 04             	mov    0x4(%edx),%eax
+    1210:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    1213:	39 f1                	cmp    %esi,%ecx
+    1215:	75 d0                	jne    11e7 <freeblock+0x37>
+    p->s.size += bp->s.size;
+    1217:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    121a:	89 15 2c 36 00 00    	mov    %edx,0x362c
+    p->s.size += bp->s.size;
+    1220:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1223:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    1226:	89 0a                	mov    %ecx,(%edx)
+}
+    1228:	5b                   	pop    %ebx
+    1229:	5e                   	pop    %esi
+    122a:	5f                   	pop    %edi
+    122b:	5d                   	pop    %ebp
+    122c:	c3                   	ret
+    122d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001230 <free>:
+
+void
+free(void *ap)
+{
+    1230:	55                   	push   %ebp
+    1231:	89 e5                	mov    %esp,%ebp
+    1233:	53                   	push   %ebx
+    1234:	83 ec 10             	sub    $0x10,%esp
+    1237:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  umtxlock(&lock);
+    123a:	68 28 36 00 00       	push   $0x3628
+    123f:	e8 cc f7 ff ff       	call   a10 <umtxlock>
+  freeblock(ap);
+    1244:	89 d8                	mov    %ebx,%eax
+    1246:	e8 65 ff ff ff       	call   11b0 <freeblock>
+  umtxunlock(&lock);
+    124b:	c7 45 08 28 36 00 00 	movl   $0x3628,0x8(%ebp)
+}
+    1252:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&lock);
+    1255:	83 c4 10             	add    $0x10,%esp
+}
+    1258:	c9                   	leave
+  umtxunlock(&lock);
+    1259:	e9 02 f8 ff ff       	jmp    a60 <umtxunlock>
+    125e:	66 90                	xchg   %ax,%ax
+
+00001260 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    1260:	55                   	push   %ebp
+    1261:	89 e5                	mov    %esp,%ebp
+    1263:	57                   	push   %edi
+    1264:	56                   	push   %esi
+    1265:	53                   	push   %ebx
+    1266:	83 ec 28             	sub    $0x28,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1269:	8b 45 08             	mov    0x8(%ebp),%eax
+  umtxlock(&lock);
+    126c:	68 28 36 00 00       	push   $0x3628
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1271:	8d 48 07             	lea    0x7(%eax),%ecx
+    1274:	c1 e9 03             	shr    $0x3,%ecx
+    1277:	8d 71 01             	lea    0x1(%ecx),%esi
+  umtxlock(&lock);
+    127a:	e8 91 f7 ff ff       	call   a10 <umtxlock>
+  if((prevp = freep) == 0){
+    127f:	8b 15 2c 36 00 00    	mov    0x362c,%edx
+    1285:	83 c4 10             	add    $0x10,%esp
+    1288:	85 d2                	test   %edx,%edx
+    128a:	0f 84 b0 00 00 00    	je     1340 <malloc+0xe0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1290:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+    1292:	8b 47 04             	mov    0x4(%edi),%eax
+    1295:	39 f0                	cmp    %esi,%eax
+    1297:	73 6f                	jae    1308 <malloc+0xa8>
+  if(nu < 4096)
+    1299:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    129e:	39 de                	cmp    %ebx,%esi
+    12a0:	0f 43 de             	cmovae %esi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    12a3:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+    12aa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    12ad:	eb 0a                	jmp    12b9 <malloc+0x59>
+    12af:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    12b0:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+    12b2:	8b 47 04             	mov    0x4(%edi),%eax
+    12b5:	39 f0                	cmp    %esi,%eax
+    12b7:	73 4f                	jae    1308 <malloc+0xa8>
+      }
+      freep = prevp;
+      umtxunlock(&lock);
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    12b9:	89 fa                	mov    %edi,%edx
+    12bb:	39 3d 2c 36 00 00    	cmp    %edi,0x362c
+    12c1:	75 ed                	jne    12b0 <malloc+0x50>
+  p = sbrk(nu * sizeof(Header));
+    12c3:	83 ec 0c             	sub    $0xc,%esp
+    12c6:	ff 75 e4             	push   -0x1c(%ebp)
+    12c9:	e8 4a f8 ff ff       	call   b18 <sbrk>
+  if(p == (char*)-1)
+    12ce:	83 c4 10             	add    $0x10,%esp
+    12d1:	83 f8 ff             	cmp    $0xffffffff,%eax
+    12d4:	74 15                	je     12eb <malloc+0x8b>
+  hp->s.size = nu;
+    12d6:	89 58 04             	mov    %ebx,0x4(%eax)
+  freeblock((void*)(hp + 1));
+    12d9:	83 c0 08             	add    $0x8,%eax
+    12dc:	e8 cf fe ff ff       	call   11b0 <freeblock>
+  return freep;
+    12e1:	8b 15 2c 36 00 00    	mov    0x362c,%edx
+      if((p = morecore(nunits)) == 0){
+    12e7:	85 d2                	test   %edx,%edx
+    12e9:	75 c5                	jne    12b0 <malloc+0x50>
+        umtxunlock(&lock);
+    12eb:	83 ec 0c             	sub    $0xc,%esp
+    12ee:	68 28 36 00 00       	push   $0x3628
+    12f3:	e8 68 f7 ff ff       	call   a60 <umtxunlock>
+        return 0;
+    12f8:	83 c4 10             	add    $0x10,%esp
+      }
+  }
+}
+    12fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    12fe:	31 c0                	xor    %eax,%eax
+}
+    1300:	5b                   	pop    %ebx
+    1301:	5e                   	pop    %esi
+    1302:	5f                   	pop    %edi
+    1303:	5d                   	pop    %ebp
+    1304:	c3                   	ret
+    1305:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1308:	39 c6                	cmp    %eax,%esi
+    130a:	74 64                	je     1370 <malloc+0x110>
+        p->s.size -= nunits;
+    130c:	29 f0                	sub    %esi,%eax
+    130e:	89 47 04             	mov    %eax,0x4(%edi)
+        p += p->s.size;
+    1311:	8d 3c c7             	lea    (%edi,%eax,8),%edi
+        p->s.size = nunits;
+    1314:	89 77 04             	mov    %esi,0x4(%edi)
+      umtxunlock(&lock);
+    1317:	83 ec 0c             	sub    $0xc,%esp
+      freep = prevp;
+    131a:	89 15 2c 36 00 00    	mov    %edx,0x362c
+      umtxunlock(&lock);
+    1320:	68 28 36 00 00       	push   $0x3628
+    1325:	e8 36 f7 ff ff       	call   a60 <umtxunlock>
+      return (void*)(p + 1);
+    132a:	83 c4 10             	add    $0x10,%esp
+}
+    132d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    1330:	8d 47 08             	lea    0x8(%edi),%eax
+}
+    1333:	5b                   	pop    %ebx
+    1334:	5e                   	pop    %esi
+    1335:	5f                   	pop    %edi
+    1336:	5d                   	pop    %ebp
+    1337:	c3                   	ret
+    1338:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    133f:	90                   	nop
+    base.s.ptr = freep = prevp = &base;
+    1340:	c7 05 2c 36 00 00 30 	movl   $0x3630,0x362c
+    1347:	36 00 00 
+    base.s.size = 0;
+    134a:	bf 30 36 00 00       	mov    $0x3630,%edi
+    base.s.ptr = freep = prevp = &base;
+    134f:	c7 05 30 36 00 00 30 	movl   $0x3630,0x3630
+    1356:	36 00 00 
+    base.s.size = 0;
+    1359:	c7 05 34 36 00 00 00 	movl   $0x0,0x3634
+    1360:	00 00 00 
+    if(p->s.size >= nunits){
+    1363:	e9 31 ff ff ff       	jmp    1299 <malloc+0x39>
+    1368:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    136f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1370:	8b 07                	mov    (%edi),%eax
+    1372:	89 02                	mov    %eax,(%edx)
+    1374:	eb a1                	jmp    1317 <malloc+0xb7>
+    1376:	66 90                	xchg   %ax,%ax
+    1378:	66 90                	xchg   %ax,%ax
+    137a:	66 90                	xchg   %ax,%ax
+    137c:	66 90                	xchg   %ax,%ax
+    137e:	66 90                	xchg   %ax,%ax
+
+00001380 <threadstart>:
+
+#define TSTACKSZ 4096
+
+static void
+threadstart(void *fn, void *arg)
+{
+    1380:	55                   	push   %ebp
+    1381:	89 e5                	mov    %esp,%ebp
+    1383:	83 ec 14             	sub    $0x14,%esp
+  ((void (*)(void*))fn)(arg);
+    1386:	ff 75 0c             	push   0xc(%ebp)
+    1389:	ff 55 08             	call   *0x8(%ebp)
+  exit();
+    138c:	e8 ef f4 ff ff       	call   880 <exit>
+    1391:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1398:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    139f:	90                   	nop
+
+000013a0 <thread_create>:
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    13a0:	55                   	push   %ebp
+    13a1:	89 e5                	mov    %esp,%ebp
+    13a3:	53                   	push   %ebx
+    13a4:	83 ec 20             	sub    $0x20,%esp
+  char *mem, *stack;
+  int pid;
+
+  if((mem = malloc(2*TSTACKSZ)) == 0)
+    13a7:	68 00 20 00 00       	push   $0x2000
+    13ac:	e8 af fe ff ff       	call   1260 <malloc>
+    13b1:	83 c4 10             	add    $0x10,%esp
+    13b4:	85 c0                	test   %eax,%eax
+    13b6:	74 47                	je     13ff <thread_create+0x5f>
+    13b8:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)(((uint)mem + TSTACKSZ - 1) & ~(TSTACKSZ - 1));
+    13ba:	8d 80 ff 0f 00 00    	lea    0xfff(%eax),%eax
+    13c0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  *(char**)stack = mem;
+    13c5:	89 18                	mov    %ebx,(%eax)
+  if((pid = clone(threadstart, (void*)fn, arg, stack)) < 0)
+    13c7:	50                   	push   %eax
+    13c8:	ff 75 0c             	push   0xc(%ebp)
+    13cb:	ff 75 08             	push   0x8(%ebp)
+    13ce:	68 80 13 00 00       	push   $0x1380
+    13d3:	e8 08 f8 ff ff       	call   be0 <clone>
+    13d8:	83 c4 10             	add    $0x10,%esp
+    13db:	85 c0                	test   %eax,%eax
+    13dd:	78 09                	js     13e8 <thread_create+0x48>
+    free(mem);
+  return pid;
+}
+    13df:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    13e2:	c9                   	leave
+    13e3:	c3                   	ret
+    13e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    free(mem);
+    13e8:	83 ec 0c             	sub    $0xc,%esp
+    13eb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    13ee:	53                   	push   %ebx
+    13ef:	e8 3c fe ff ff       	call   1230 <free>
+    13f4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    13f7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+    13fa:	83 c4 10             	add    $0x10,%esp
+}
+    13fd:	c9                   	leave
+    13fe:	c3                   	ret
+    return -1;
+    13ff:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1404:	eb d9                	jmp    13df <thread_create+0x3f>
+    1406:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    140d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001410 <thread_join>:
+
+int
+thread_join(void)
+{
+    1410:	55                   	push   %ebp
+    1411:	89 e5                	mov    %esp,%ebp
+    1413:	83 ec 34             	sub    $0x34,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    1416:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    1419:	50                   	push   %eax
+    141a:	e8 c9 f7 ff ff       	call   be8 <join>
+    141f:	83 c4 10             	add    $0x10,%esp
+    1422:	85 c0                	test   %eax,%eax
+    1424:	79 0a                	jns    1430 <thread_join+0x20>
+    free(*(char**)stack);
+  return pid;
+}
+    1426:	c9                   	leave
+    1427:	c3                   	ret
+    1428:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    142f:	90                   	nop
+    free(*(char**)stack);
+    1430:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1433:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1436:	83 ec 0c             	sub    $0xc,%esp
+    1439:	ff 32                	push   (%edx)
+    143b:	e8 f0 fd ff ff       	call   1230 <free>
+    1440:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1443:	83 c4 10             	add    $0x10,%esp
+}
+    1446:	c9                   	leave
+    1447:	c3                   	ret
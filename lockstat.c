@@ -0,0 +1,98 @@
+// Show lock contention by lock name: since boot, or while
+// running a command, as in "lockstat usertests". Average hold
+// times are in TSC cycles. For sleep locks, "slept" counts the
+// waits that switched away and "spun" those that spun on a
+// holder running on another CPU instead.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "lockstat.h"
+
+#define NCLASS 64
+
+struct lockstat before[NCLASS], after[NCLASS];
+
+// Print s in a column of width characters,
+// left-aligned if left, else right-aligned.
+void
+column(char *s, int width, int left)
+{
+  int n;
+
+  n = strlen(s);
+  if(left)
+    printf(1, "%s", s);
+  for(; n < width; n++)
+    printf(1, " ");
+  if(!left)
+    printf(1, "%s", s);
+}
+
+void
+number(uint x, int width)
+{
+  char buf[16];
+
+  sprintf(buf, "%d", x);
+  column(buf, width, 0);
+}
+
+int
+main(int argc, char *argv[])
+{
+  struct lockstat *a, *b;
+  int nb, na, i, pid;
+  uint nacq, ncont, nspin, hold, avg, nsleep, nspinwait;
+
+  nb = 0;
+  if(argc > 1){
+    nb = lockstat(before, NCLASS);
+    if((pid = fork()) < 0){
+      printf(2, "lockstat: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      exec(argv[1], argv + 1);
+      printf(2, "lockstat: exec %s failed\n", argv[1]);
+      exit();
+    }
+    wait();
+  }
+  if((na = lockstat(after, NCLASS)) < 0){
+    printf(2, "lockstat: lockstat failed\n");
+    exit();
+  }
+
+  column("name", 16, 1);
+  column("acquired", 10, 0);
+  column("contended", 10, 0);
+  column("spins", 12, 0);
+  column("avg hold", 10, 0);
+  column("slept", 8, 0);
+  column("spun", 8, 0);
+  printf(1, "\n");
+  for(i = 0; i < na; i++){
+    a = &after[i];
+    b = i < nb ? &before[i] : 0;
+    nacq = a->nacquire - (b ? b->nacquire : 0);
+    ncont = a->ncontend - (b ? b->ncontend : 0);
+    nspin = a->nspin - (b ? b->nspin : 0);
+    hold = a->holdkc - (b ? b->holdkc : 0);
+    nsleep = a->nsleep - (b ? b->nsleep : 0);
+    nspinwait = a->nspinwait - (b ? b->nspinwait : 0);
+    if(nacq == 0)
+      continue;
+    // Average of hold*1024/nacq without overflowing.
+    avg = hold / nacq * 1024 + hold % nacq * 1024 / nacq;
+    column(a->name, 16, 1);
+    number(nacq, 10);
+    number(ncont, 10);
+    number(nspin, 12);
+    number(avg, 10);
+    number(nsleep, 8);
+    number(nspinwait, 8);
+    printf(1, "\n");
+  }
+  exit();
+}
@@ -0,0 +1,12 @@
+// Lock contention counters for all locks of one name, see
+// lockstat(). A sleep lock's counters are those of its spin
+// lock, plus how its waits for the lock itself went.
+struct lockstat {
+  char name[16];
+  uint nacquire;   // acquisitions
+  uint ncontend;   // acquisitions that had to wait
+  uint nspin;      // times round the wait loop
+  uint holdkc;     // time held, in units of 1024 TSC cycles
+  uint nsleep;     // sleep lock waits that slept
+  uint nspinwait;  // sleep lock waits that spun instead
+};
@@ -0,0 +1,2497 @@
+
+_ls:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <fmtname>:
+#include "user.h"
+#include "fs.h"
+
+char*
+fmtname(char *path)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	56                   	push   %esi
+       4:	53                   	push   %ebx
+       5:	8b 75 08             	mov    0x8(%ebp),%esi
+  static char buf[DIRSIZ+1];
+  char *p;
+
+  // Find first character after last slash.
+  for(p=path+strlen(path); p >= path && *p != '/'; p--)
+       8:	83 ec 0c             	sub    $0xc,%esp
+       b:	56                   	push   %esi
+       c:	e8 bf 03 00 00       	call   3d0 <strlen>
+      11:	83 c4 10             	add    $0x10,%esp
+      14:	01 f0                	add    %esi,%eax
+      16:	89 c3                	mov    %eax,%ebx
+      18:	73 0f                	jae    29 <fmtname+0x29>
+      1a:	eb 12                	jmp    2e <fmtname+0x2e>
+      1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      20:	8d 43 ff             	lea    -0x1(%ebx),%eax
+      23:	39 f0                	cmp    %esi,%eax
+      25:	72 0a                	jb     31 <fmtname+0x31>
+      27:	89 c3                	mov    %eax,%ebx
+      29:	80 3b 2f             	cmpb   $0x2f,(%ebx)
+      2c:	75 f2                	jne    20 <fmtname+0x20>
+    ;
+  p++;
+      2e:	83 c3 01             	add    $0x1,%ebx
+
+  // Return blank-padded name.
+  if(strlen(p) >= DIRSIZ)
+      31:	83 ec 0c             	sub    $0xc,%esp
+      34:	53                   	push   %ebx
+      35:	e8 96 03 00 00       	call   3d0 <strlen>
+      3a:	83 c4 10             	add    $0x10,%esp
+      3d:	83 f8 0d             	cmp    $0xd,%eax
+      40:	77 4a                	ja     8c <fmtname+0x8c>
+    return p;
+  memmove(buf, p, strlen(p));
+      42:	83 ec 0c             	sub    $0xc,%esp
+      45:	53                   	push   %ebx
+      46:	e8 85 03 00 00       	call   3d0 <strlen>
+      4b:	83 c4 0c             	add    $0xc,%esp
+      4e:	50                   	push   %eax
+      4f:	53                   	push   %ebx
+      50:	68 10 22 00 00       	push   $0x2210
+      55:	e8 56 05 00 00       	call   5b0 <memmove>
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+      5a:	89 1c 24             	mov    %ebx,(%esp)
+      5d:	e8 6e 03 00 00       	call   3d0 <strlen>
+      62:	89 1c 24             	mov    %ebx,(%esp)
+  return buf;
+      65:	bb 10 22 00 00       	mov    $0x2210,%ebx
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+      6a:	89 c6                	mov    %eax,%esi
+      6c:	e8 5f 03 00 00       	call   3d0 <strlen>
+      71:	ba 0e 00 00 00       	mov    $0xe,%edx
+      76:	83 c4 0c             	add    $0xc,%esp
+      79:	29 f2                	sub    %esi,%edx
+      7b:	05 10 22 00 00       	add    $0x2210,%eax
+      80:	52                   	push   %edx
+      81:	6a 20                	push   $0x20
+      83:	50                   	push   %eax
+      84:	e8 77 03 00 00       	call   400 <memset>
+  return buf;
+      89:	83 c4 10             	add    $0x10,%esp
+}
+      8c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      8f:	89 d8                	mov    %ebx,%eax
+      91:	5b                   	pop    %ebx
+      92:	5e                   	pop    %esi
+      93:	5d                   	pop    %ebp
+      94:	c3                   	ret
+      95:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000a0 <ls>:
+
+void
+ls(char *path)
+{
+      a0:	55                   	push   %ebp
+      a1:	89 e5                	mov    %esp,%ebp
+      a3:	57                   	push   %edi
+      a4:	56                   	push   %esi
+      a5:	53                   	push   %ebx
+      a6:	81 ec 64 02 00 00    	sub    $0x264,%esp
+      ac:	8b 7d 08             	mov    0x8(%ebp),%edi
+  char buf[512], *p;
+  int fd;
+  struct dirent de;
+  struct stat st;
+
+  if((fd = open(path, 0)) < 0){
+      af:	6a 00                	push   $0x0
+      b1:	57                   	push   %edi
+      b2:	e8 a9 07 00 00       	call   860 <open>
+      b7:	83 c4 10             	add    $0x10,%esp
+      ba:	85 c0                	test   %eax,%eax
+      bc:	0f 88 9e 01 00 00    	js     260 <ls+0x1c0>
+    printf(2, "ls: cannot open %s\n", path);
+    return;
+  }
+
+  if(fstat(fd, &st) < 0){
+      c2:	83 ec 08             	sub    $0x8,%esp
+      c5:	8d b5 d4 fd ff ff    	lea    -0x22c(%ebp),%esi
+      cb:	89 c3                	mov    %eax,%ebx
+      cd:	56                   	push   %esi
+      ce:	50                   	push   %eax
+      cf:	e8 a4 07 00 00       	call   878 <fstat>
+      d4:	83 c4 10             	add    $0x10,%esp
+      d7:	85 c0                	test   %eax,%eax
+      d9:	0f 88 c1 01 00 00    	js     2a0 <ls+0x200>
+    printf(2, "ls: cannot stat %s\n", path);
+    close(fd);
+    return;
+  }
+
+  switch(st.type){
+      df:	0f b7 85 d4 fd ff ff 	movzwl -0x22c(%ebp),%eax
+      e6:	66 83 f8 01          	cmp    $0x1,%ax
+      ea:	74 64                	je     150 <ls+0xb0>
+      ec:	66 83 f8 02          	cmp    $0x2,%ax
+      f0:	74 1e                	je     110 <ls+0x70>
+      }
+      printf(1, "%s %d %d %d\n", fmtname(buf), st.type, st.ino, st.size);
+    }
+    break;
+  }
+  close(fd);
+      f2:	83 ec 0c             	sub    $0xc,%esp
+      f5:	53                   	push   %ebx
+      f6:	e8 65 06 00 00       	call   760 <close>
+      fb:	83 c4 10             	add    $0x10,%esp
+}
+      fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     101:	5b                   	pop    %ebx
+     102:	5e                   	pop    %esi
+     103:	5f                   	pop    %edi
+     104:	5d                   	pop    %ebp
+     105:	c3                   	ret
+     106:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     10d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, "%s %d %d %d\n", fmtname(path), st.type, st.ino, st.size);
+     110:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+     116:	83 ec 0c             	sub    $0xc,%esp
+     119:	8b b5 dc fd ff ff    	mov    -0x224(%ebp),%esi
+     11f:	89 95 b4 fd ff ff    	mov    %edx,-0x24c(%ebp)
+     125:	57                   	push   %edi
+     126:	e8 d5 fe ff ff       	call   0 <fmtname>
+     12b:	8b 95 b4 fd ff ff    	mov    -0x24c(%ebp),%edx
+     131:	59                   	pop    %ecx
+     132:	5f                   	pop    %edi
+     133:	52                   	push   %edx
+     134:	56                   	push   %esi
+     135:	6a 02                	push   $0x2
+     137:	50                   	push   %eax
+     138:	68 00 12 00 00       	push   $0x1200
+     13d:	6a 01                	push   $0x1
+     13f:	e8 5c 0c 00 00       	call   da0 <printf>
+    break;
+     144:	83 c4 20             	add    $0x20,%esp
+     147:	eb a9                	jmp    f2 <ls+0x52>
+     149:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(strlen(path) + 1 + DIRSIZ + 1 > sizeof buf){
+     150:	83 ec 0c             	sub    $0xc,%esp
+     153:	57                   	push   %edi
+     154:	e8 77 02 00 00       	call   3d0 <strlen>
+     159:	83 c4 10             	add    $0x10,%esp
+     15c:	83 c0 10             	add    $0x10,%eax
+     15f:	3d 00 02 00 00       	cmp    $0x200,%eax
+     164:	0f 87 16 01 00 00    	ja     280 <ls+0x1e0>
+    strcpy(buf, path);
+     16a:	83 ec 08             	sub    $0x8,%esp
+     16d:	57                   	push   %edi
+     16e:	8d bd e8 fd ff ff    	lea    -0x218(%ebp),%edi
+     174:	57                   	push   %edi
+     175:	e8 c6 01 00 00       	call   340 <strcpy>
+    p = buf+strlen(buf);
+     17a:	89 3c 24             	mov    %edi,(%esp)
+     17d:	e8 4e 02 00 00       	call   3d0 <strlen>
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+     182:	83 c4 10             	add    $0x10,%esp
+    p = buf+strlen(buf);
+     185:	01 f8                	add    %edi,%eax
+    *p++ = '/';
+     187:	8d 48 01             	lea    0x1(%eax),%ecx
+    p = buf+strlen(buf);
+     18a:	89 85 a8 fd ff ff    	mov    %eax,-0x258(%ebp)
+    *p++ = '/';
+     190:	89 8d a4 fd ff ff    	mov    %ecx,-0x25c(%ebp)
+     196:	c6 00 2f             	movb   $0x2f,(%eax)
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+     199:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1a0:	83 ec 04             	sub    $0x4,%esp
+     1a3:	8d 85 c4 fd ff ff    	lea    -0x23c(%ebp),%eax
+     1a9:	6a 10                	push   $0x10
+     1ab:	50                   	push   %eax
+     1ac:	53                   	push   %ebx
+     1ad:	e8 ae 04 00 00       	call   660 <read>
+     1b2:	83 c4 10             	add    $0x10,%esp
+     1b5:	83 f8 10             	cmp    $0x10,%eax
+     1b8:	0f 85 34 ff ff ff    	jne    f2 <ls+0x52>
+      if(de.inum == 0)
+     1be:	66 83 bd c4 fd ff ff 	cmpw   $0x0,-0x23c(%ebp)
+     1c5:	00 
+     1c6:	74 d8                	je     1a0 <ls+0x100>
+      memmove(p, de.name, DIRSIZ);
+     1c8:	83 ec 04             	sub    $0x4,%esp
+     1cb:	8d 85 c6 fd ff ff    	lea    -0x23a(%ebp),%eax
+     1d1:	6a 0e                	push   $0xe
+     1d3:	50                   	push   %eax
+     1d4:	ff b5 a4 fd ff ff    	push   -0x25c(%ebp)
+     1da:	e8 d1 03 00 00       	call   5b0 <memmove>
+      p[DIRSIZ] = 0;
+     1df:	8b 85 a8 fd ff ff    	mov    -0x258(%ebp),%eax
+     1e5:	c6 40 0f 00          	movb   $0x0,0xf(%eax)
+      if(stat(buf, &st) < 0){
+     1e9:	58                   	pop    %eax
+     1ea:	5a                   	pop    %edx
+     1eb:	56                   	push   %esi
+     1ec:	57                   	push   %edi
+     1ed:	e8 1e 03 00 00       	call   510 <stat>
+     1f2:	83 c4 10             	add    $0x10,%esp
+     1f5:	85 c0                	test   %eax,%eax
+     1f7:	0f 88 cb 00 00 00    	js     2c8 <ls+0x228>
+      printf(1, "%s %d %d %d\n", fmtname(buf), st.type, st.ino, st.size);
+     1fd:	8b 8d e4 fd ff ff    	mov    -0x21c(%ebp),%ecx
+     203:	8b 95 dc fd ff ff    	mov    -0x224(%ebp),%edx
+     209:	83 ec 0c             	sub    $0xc,%esp
+     20c:	0f bf 85 d4 fd ff ff 	movswl -0x22c(%ebp),%eax
+     213:	89 8d ac fd ff ff    	mov    %ecx,-0x254(%ebp)
+     219:	89 95 b0 fd ff ff    	mov    %edx,-0x250(%ebp)
+     21f:	89 85 b4 fd ff ff    	mov    %eax,-0x24c(%ebp)
+     225:	57                   	push   %edi
+     226:	e8 d5 fd ff ff       	call   0 <fmtname>
+     22b:	5a                   	pop    %edx
+     22c:	59                   	pop    %ecx
+     22d:	8b 8d ac fd ff ff    	mov    -0x254(%ebp),%ecx
+     233:	51                   	push   %ecx
+     234:	8b 95 b0 fd ff ff    	mov    -0x250(%ebp),%edx
+     23a:	52                   	push   %edx
+     23b:	ff b5 b4 fd ff ff    	push   -0x24c(%ebp)
+     241:	50                   	push   %eax
+     242:	68 00 12 00 00       	push   $0x1200
+     247:	6a 01                	push   $0x1
+     249:	e8 52 0b 00 00       	call   da0 <printf>
+     24e:	83 c4 20             	add    $0x20,%esp
+     251:	e9 4a ff ff ff       	jmp    1a0 <ls+0x100>
+     256:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     25d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(2, "ls: cannot open %s\n", path);
+     260:	83 ec 04             	sub    $0x4,%esp
+     263:	57                   	push   %edi
+     264:	68 d8 11 00 00       	push   $0x11d8
+     269:	6a 02                	push   $0x2
+     26b:	e8 30 0b 00 00       	call   da0 <printf>
+    return;
+     270:	83 c4 10             	add    $0x10,%esp
+}
+     273:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     276:	5b                   	pop    %ebx
+     277:	5e                   	pop    %esi
+     278:	5f                   	pop    %edi
+     279:	5d                   	pop    %ebp
+     27a:	c3                   	ret
+     27b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     27f:	90                   	nop
+      printf(1, "ls: path too long\n");
+     280:	83 ec 08             	sub    $0x8,%esp
+     283:	68 0d 12 00 00       	push   $0x120d
+     288:	6a 01                	push   $0x1
+     28a:	e8 11 0b 00 00       	call   da0 <printf>
+      break;
+     28f:	83 c4 10             	add    $0x10,%esp
+     292:	e9 5b fe ff ff       	jmp    f2 <ls+0x52>
+     297:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     29e:	66 90                	xchg   %ax,%ax
+    printf(2, "ls: cannot stat %s\n", path);
+     2a0:	83 ec 04             	sub    $0x4,%esp
+     2a3:	57                   	push   %edi
+     2a4:	68 ec 11 00 00       	push   $0x11ec
+     2a9:	6a 02                	push   $0x2
+     2ab:	e8 f0 0a 00 00       	call   da0 <printf>
+    close(fd);
+     2b0:	89 1c 24             	mov    %ebx,(%esp)
+     2b3:	e8 a8 04 00 00       	call   760 <close>
+    return;
+     2b8:	83 c4 10             	add    $0x10,%esp
+}
+     2bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     2be:	5b                   	pop    %ebx
+     2bf:	5e                   	pop    %esi
+     2c0:	5f                   	pop    %edi
+     2c1:	5d                   	pop    %ebp
+     2c2:	c3                   	ret
+     2c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2c7:	90                   	nop
+        printf(1, "ls: cannot stat %s\n", buf);
+     2c8:	83 ec 04             	sub    $0x4,%esp
+     2cb:	57                   	push   %edi
+     2cc:	68 ec 11 00 00       	push   $0x11ec
+     2d1:	6a 01                	push   $0x1
+     2d3:	e8 c8 0a 00 00       	call   da0 <printf>
+        continue;
+     2d8:	83 c4 10             	add    $0x10,%esp
+     2db:	e9 c0 fe ff ff       	jmp    1a0 <ls+0x100>
+
+000002e0 <main>:
+
+int
+main(int argc, char *argv[])
+{
+     2e0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     2e4:	83 e4 f0             	and    $0xfffffff0,%esp
+     2e7:	ff 71 fc             	push   -0x4(%ecx)
+     2ea:	55                   	push   %ebp
+     2eb:	89 e5                	mov    %esp,%ebp
+     2ed:	57                   	push   %edi
+     2ee:	56                   	push   %esi
+     2ef:	53                   	push   %ebx
+     2f0:	bb 01 00 00 00       	mov    $0x1,%ebx
+     2f5:	51                   	push   %ecx
+     2f6:	83 ec 08             	sub    $0x8,%esp
+     2f9:	8b 31                	mov    (%ecx),%esi
+     2fb:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  if(argc < 2){
+     2fe:	83 fe 01             	cmp    $0x1,%esi
+     301:	7e 1f                	jle    322 <main+0x42>
+     303:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     307:	90                   	nop
+    ls(".");
+    exit();
+  }
+  for(i=1; i<argc; i++)
+    ls(argv[i]);
+     308:	83 ec 0c             	sub    $0xc,%esp
+     30b:	ff 34 9f             	push   (%edi,%ebx,4)
+  for(i=1; i<argc; i++)
+     30e:	83 c3 01             	add    $0x1,%ebx
+    ls(argv[i]);
+     311:	e8 8a fd ff ff       	call   a0 <ls>
+  for(i=1; i<argc; i++)
+     316:	83 c4 10             	add    $0x10,%esp
+     319:	39 de                	cmp    %ebx,%esi
+     31b:	75 eb                	jne    308 <main+0x28>
+  exit();
+     31d:	e8 ee 02 00 00       	call   610 <exit>
+    ls(".");
+     322:	83 ec 0c             	sub    $0xc,%esp
+     325:	68 20 12 00 00       	push   $0x1220
+     32a:	e8 71 fd ff ff       	call   a0 <ls>
+    exit();
+     32f:	e8 dc 02 00 00       	call   610 <exit>
+     334:	66 90                	xchg   %ax,%ax
+     336:	66 90                	xchg   %ax,%ax
+     338:	66 90                	xchg   %ax,%ax
+     33a:	66 90                	xchg   %ax,%ax
+     33c:	66 90                	xchg   %ax,%ax
+     33e:	66 90                	xchg   %ax,%ax
+
+00000340 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     340:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     341:	31 c0                	xor    %eax,%eax
+{
+     343:	89 e5                	mov    %esp,%ebp
+     345:	53                   	push   %ebx
+     346:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     349:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     34c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     350:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     354:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     357:	83 c0 01             	add    $0x1,%eax
+     35a:	84 d2                	test   %dl,%dl
+     35c:	75 f2                	jne    350 <strcpy+0x10>
+    ;
+  return os;
+}
+     35e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     361:	89 c8                	mov    %ecx,%eax
+     363:	c9                   	leave
+     364:	c3                   	ret
+     365:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     36c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000370 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     370:	55                   	push   %ebp
+     371:	89 e5                	mov    %esp,%ebp
+     373:	53                   	push   %ebx
+     374:	8b 55 08             	mov    0x8(%ebp),%edx
+     377:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     37a:	0f b6 02             	movzbl (%edx),%eax
+     37d:	84 c0                	test   %al,%al
+     37f:	75 17                	jne    398 <strcmp+0x28>
+     381:	eb 3a                	jmp    3bd <strcmp+0x4d>
+     383:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     387:	90                   	nop
+     388:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     38c:	83 c2 01             	add    $0x1,%edx
+     38f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     392:	84 c0                	test   %al,%al
+     394:	74 1a                	je     3b0 <strcmp+0x40>
+    p++, q++;
+     396:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     398:	0f b6 19             	movzbl (%ecx),%ebx
+     39b:	38 c3                	cmp    %al,%bl
+     39d:	74 e9                	je     388 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     39f:	29 d8                	sub    %ebx,%eax
+}
+     3a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     3a4:	c9                   	leave
+     3a5:	c3                   	ret
+     3a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3ad:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     3b0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     3b4:	31 c0                	xor    %eax,%eax
+     3b6:	29 d8                	sub    %ebx,%eax
+}
+     3b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     3bb:	c9                   	leave
+     3bc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     3bd:	0f b6 19             	movzbl (%ecx),%ebx
+     3c0:	31 c0                	xor    %eax,%eax
+     3c2:	eb db                	jmp    39f <strcmp+0x2f>
+     3c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     3cf:	90                   	nop
+
+000003d0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     3d0:	55                   	push   %ebp
+     3d1:	89 e5                	mov    %esp,%ebp
+     3d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     3d6:	80 3a 00             	cmpb   $0x0,(%edx)
+     3d9:	74 15                	je     3f0 <strlen+0x20>
+     3db:	31 c0                	xor    %eax,%eax
+     3dd:	8d 76 00             	lea    0x0(%esi),%esi
+     3e0:	83 c0 01             	add    $0x1,%eax
+     3e3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     3e7:	89 c1                	mov    %eax,%ecx
+     3e9:	75 f5                	jne    3e0 <strlen+0x10>
+    ;
+  return n;
+}
+     3eb:	89 c8                	mov    %ecx,%eax
+     3ed:	5d                   	pop    %ebp
+     3ee:	c3                   	ret
+     3ef:	90                   	nop
+  for(n = 0; s[n]; n++)
+     3f0:	31 c9                	xor    %ecx,%ecx
+}
+     3f2:	5d                   	pop    %ebp
+     3f3:	89 c8                	mov    %ecx,%eax
+     3f5:	c3                   	ret
+     3f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000400 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     400:	55                   	push   %ebp
+     401:	89 e5                	mov    %esp,%ebp
+     403:	57                   	push   %edi
+     404:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     407:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     40a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     40d:	89 d7                	mov    %edx,%edi
+     40f:	fc                   	cld
+     410:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     412:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     415:	89 d0                	mov    %edx,%eax
+     417:	c9                   	leave
+     418:	c3                   	ret
+     419:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000420 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     420:	55                   	push   %ebp
+     421:	89 e5                	mov    %esp,%ebp
+     423:	56                   	push   %esi
+     424:	53                   	push   %ebx
+     425:	8b 75 10             	mov    0x10(%ebp),%esi
+     428:	8b 55 08             	mov    0x8(%ebp),%edx
+     42b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+     42e:	85 f6                	test   %esi,%esi
+     430:	74 2e                	je     460 <memcmp+0x40>
+     432:	01 c6                	add    %eax,%esi
+     434:	eb 14                	jmp    44a <memcmp+0x2a>
+     436:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     43d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+     440:	83 c0 01             	add    $0x1,%eax
+     443:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+     446:	39 f0                	cmp    %esi,%eax
+     448:	74 16                	je     460 <memcmp+0x40>
+    if(*s1 != *s2)
+     44a:	0f b6 0a             	movzbl (%edx),%ecx
+     44d:	0f b6 18             	movzbl (%eax),%ebx
+     450:	38 d9                	cmp    %bl,%cl
+     452:	74 ec                	je     440 <memcmp+0x20>
+      return *s1 - *s2;
+     454:	0f b6 c1             	movzbl %cl,%eax
+     457:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+     459:	5b                   	pop    %ebx
+     45a:	5e                   	pop    %esi
+     45b:	5d                   	pop    %ebp
+     45c:	c3                   	ret
+     45d:	8d 76 00             	lea    0x0(%esi),%esi
+     460:	5b                   	pop    %ebx
+  return 0;
+     461:	31 c0                	xor    %eax,%eax
+}
+     463:	5e                   	pop    %esi
+     464:	5d                   	pop    %ebp
+     465:	c3                   	ret
+     466:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     46d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000470 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     470:	55                   	push   %ebp
+     471:	89 e5                	mov    %esp,%ebp
+     473:	8b 45 08             	mov    0x8(%ebp),%eax
+     476:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     47a:	0f b6 10             	movzbl (%eax),%edx
+     47d:	84 d2                	test   %dl,%dl
+     47f:	75 12                	jne    493 <strchr+0x23>
+     481:	eb 1d                	jmp    4a0 <strchr+0x30>
+     483:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     487:	90                   	nop
+     488:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     48c:	83 c0 01             	add    $0x1,%eax
+     48f:	84 d2                	test   %dl,%dl
+     491:	74 0d                	je     4a0 <strchr+0x30>
+    if(*s == c)
+     493:	38 d1                	cmp    %dl,%cl
+     495:	75 f1                	jne    488 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     497:	5d                   	pop    %ebp
+     498:	c3                   	ret
+     499:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     4a0:	31 c0                	xor    %eax,%eax
+}
+     4a2:	5d                   	pop    %ebp
+     4a3:	c3                   	ret
+     4a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     4af:	90                   	nop
+
+000004b0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     4b0:	55                   	push   %ebp
+     4b1:	89 e5                	mov    %esp,%ebp
+     4b3:	57                   	push   %edi
+     4b4:	56                   	push   %esi
+int
+read(int fd, void *buf, int n)
+{
+  if(flushhook)
+    flushhook();
+  return _read(fd, buf, n);
+     4b5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     4b8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     4b9:	31 db                	xor    %ebx,%ebx
+{
+     4bb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     4be:	eb 32                	jmp    4f2 <gets+0x42>
+  if(flushhook)
+     4c0:	a1 20 22 00 00       	mov    0x2220,%eax
+     4c5:	85 c0                	test   %eax,%eax
+     4c7:	74 02                	je     4cb <gets+0x1b>
+    flushhook();
+     4c9:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+     4cb:	83 ec 04             	sub    $0x4,%esp
+     4ce:	6a 01                	push   $0x1
+     4d0:	56                   	push   %esi
+     4d1:	6a 00                	push   $0x0
+     4d3:	e8 60 03 00 00       	call   838 <_read>
+    if(cc < 1)
+     4d8:	83 c4 10             	add    $0x10,%esp
+     4db:	85 c0                	test   %eax,%eax
+     4dd:	7e 1d                	jle    4fc <gets+0x4c>
+    buf[i++] = c;
+     4df:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     4e3:	8b 55 08             	mov    0x8(%ebp),%edx
+     4e6:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     4ea:	3c 0a                	cmp    $0xa,%al
+     4ec:	74 10                	je     4fe <gets+0x4e>
+     4ee:	3c 0d                	cmp    $0xd,%al
+     4f0:	74 0c                	je     4fe <gets+0x4e>
+  for(i=0; i+1 < max; ){
+     4f2:	89 df                	mov    %ebx,%edi
+     4f4:	83 c3 01             	add    $0x1,%ebx
+     4f7:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     4fa:	7c c4                	jl     4c0 <gets+0x10>
+     4fc:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+     4fe:	8b 45 08             	mov    0x8(%ebp),%eax
+     501:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+     505:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     508:	5b                   	pop    %ebx
+     509:	5e                   	pop    %esi
+     50a:	5f                   	pop    %edi
+     50b:	5d                   	pop    %ebp
+     50c:	c3                   	ret
+     50d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000510 <stat>:
+{
+     510:	55                   	push   %ebp
+     511:	89 e5                	mov    %esp,%ebp
+     513:	56                   	push   %esi
+     514:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+     515:	83 ec 08             	sub    $0x8,%esp
+     518:	6a 00                	push   $0x0
+     51a:	ff 75 08             	push   0x8(%ebp)
+     51d:	e8 3e 03 00 00       	call   860 <open>
+  if(fd < 0)
+     522:	83 c4 10             	add    $0x10,%esp
+     525:	85 c0                	test   %eax,%eax
+     527:	78 37                	js     560 <stat+0x50>
+  r = fstat(fd, st);
+     529:	83 ec 08             	sub    $0x8,%esp
+     52c:	ff 75 0c             	push   0xc(%ebp)
+     52f:	89 c3                	mov    %eax,%ebx
+     531:	50                   	push   %eax
+     532:	e8 41 03 00 00       	call   878 <fstat>
+}
+
+int
+close(int fd)
+{
+  if(flushhook)
+     537:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+     53a:	89 c6                	mov    %eax,%esi
+  if(flushhook)
+     53c:	a1 20 22 00 00       	mov    0x2220,%eax
+     541:	85 c0                	test   %eax,%eax
+     543:	74 02                	je     547 <stat+0x37>
+    flushhook();
+     545:	ff d0                	call   *%eax
+  return _close(fd);
+     547:	83 ec 0c             	sub    $0xc,%esp
+     54a:	53                   	push   %ebx
+     54b:	e8 f8 02 00 00       	call   848 <_close>
+     550:	83 c4 10             	add    $0x10,%esp
+}
+     553:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     556:	89 f0                	mov    %esi,%eax
+     558:	5b                   	pop    %ebx
+     559:	5e                   	pop    %esi
+     55a:	5d                   	pop    %ebp
+     55b:	c3                   	ret
+     55c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+     560:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     565:	eb ec                	jmp    553 <stat+0x43>
+     567:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     56e:	66 90                	xchg   %ax,%ax
+
+00000570 <atoi>:
+{
+     570:	55                   	push   %ebp
+     571:	89 e5                	mov    %esp,%ebp
+     573:	53                   	push   %ebx
+     574:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+     577:	0f be 02             	movsbl (%edx),%eax
+     57a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     57d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     580:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     585:	77 1e                	ja     5a5 <atoi+0x35>
+     587:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     58e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     590:	83 c2 01             	add    $0x1,%edx
+     593:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     596:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     59a:	0f be 02             	movsbl (%edx),%eax
+     59d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     5a0:	80 fb 09             	cmp    $0x9,%bl
+     5a3:	76 eb                	jbe    590 <atoi+0x20>
+}
+     5a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     5a8:	89 c8                	mov    %ecx,%eax
+     5aa:	c9                   	leave
+     5ab:	c3                   	ret
+     5ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005b0 <memmove>:
+{
+     5b0:	55                   	push   %ebp
+     5b1:	89 e5                	mov    %esp,%ebp
+     5b3:	57                   	push   %edi
+     5b4:	56                   	push   %esi
+     5b5:	8b 45 10             	mov    0x10(%ebp),%eax
+     5b8:	8b 55 08             	mov    0x8(%ebp),%edx
+     5bb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+     5be:	85 c0                	test   %eax,%eax
+     5c0:	7e 13                	jle    5d5 <memmove+0x25>
+     5c2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     5c4:	89 d7                	mov    %edx,%edi
+     5c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5cd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     5d0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     5d1:	39 f8                	cmp    %edi,%eax
+     5d3:	75 fb                	jne    5d0 <memmove+0x20>
+}
+     5d5:	5e                   	pop    %esi
+     5d6:	89 d0                	mov    %edx,%eax
+     5d8:	5f                   	pop    %edi
+     5d9:	5d                   	pop    %ebp
+     5da:	c3                   	ret
+     5db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     5df:	90                   	nop
+
+000005e0 <fork>:
+  if(flushhook)
+     5e0:	a1 20 22 00 00       	mov    0x2220,%eax
+     5e5:	85 c0                	test   %eax,%eax
+     5e7:	74 17                	je     600 <fork+0x20>
+{
+     5e9:	55                   	push   %ebp
+     5ea:	89 e5                	mov    %esp,%ebp
+     5ec:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+     5ef:	ff d0                	call   *%eax
+}
+     5f1:	c9                   	leave
+  return _fork();
+     5f2:	e9 21 02 00 00       	jmp    818 <_fork>
+     5f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5fe:	66 90                	xchg   %ax,%ax
+     600:	e9 13 02 00 00       	jmp    818 <_fork>
+     605:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     60c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000610 <exit>:
+{
+     610:	55                   	push   %ebp
+     611:	89 e5                	mov    %esp,%ebp
+     613:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+     616:	a1 20 22 00 00       	mov    0x2220,%eax
+     61b:	85 c0                	test   %eax,%eax
+     61d:	74 02                	je     621 <exit+0x11>
+    flushhook();
+     61f:	ff d0                	call   *%eax
+  _exit();
+     621:	e8 fa 01 00 00       	call   820 <_exit>
+     626:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     62d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000630 <exec>:
+{
+     630:	55                   	push   %ebp
+  if(flushhook)
+     631:	a1 20 22 00 00       	mov    0x2220,%eax
+{
+     636:	89 e5                	mov    %esp,%ebp
+     638:	56                   	push   %esi
+     639:	53                   	push   %ebx
+     63a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     63d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+     640:	85 c0                	test   %eax,%eax
+     642:	74 02                	je     646 <exec+0x16>
+    flushhook();
+     644:	ff d0                	call   *%eax
+  return _exec(path, argv);
+     646:	89 75 0c             	mov    %esi,0xc(%ebp)
+     649:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     64c:	5b                   	pop    %ebx
+     64d:	5e                   	pop    %esi
+     64e:	5d                   	pop    %ebp
+  return _exec(path, argv);
+     64f:	e9 04 02 00 00       	jmp    858 <_exec>
+     654:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     65b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     65f:	90                   	nop
+
+00000660 <read>:
+{
+     660:	55                   	push   %ebp
+     661:	89 e5                	mov    %esp,%ebp
+     663:	57                   	push   %edi
+     664:	56                   	push   %esi
+     665:	53                   	push   %ebx
+     666:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     669:	a1 20 22 00 00       	mov    0x2220,%eax
+{
+     66e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     671:	8b 75 0c             	mov    0xc(%ebp),%esi
+     674:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     677:	85 c0                	test   %eax,%eax
+     679:	74 02                	je     67d <read+0x1d>
+    flushhook();
+     67b:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+     67d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     680:	89 75 0c             	mov    %esi,0xc(%ebp)
+     683:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     686:	83 c4 0c             	add    $0xc,%esp
+     689:	5b                   	pop    %ebx
+     68a:	5e                   	pop    %esi
+     68b:	5f                   	pop    %edi
+     68c:	5d                   	pop    %ebp
+  return _read(fd, buf, n);
+     68d:	e9 a6 01 00 00       	jmp    838 <_read>
+     692:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     699:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000006a0 <readv>:
+{
+     6a0:	55                   	push   %ebp
+     6a1:	89 e5                	mov    %esp,%ebp
+     6a3:	57                   	push   %edi
+     6a4:	56                   	push   %esi
+     6a5:	53                   	push   %ebx
+     6a6:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     6a9:	a1 20 22 00 00       	mov    0x2220,%eax
+{
+     6ae:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     6b1:	8b 75 0c             	mov    0xc(%ebp),%esi
+     6b4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     6b7:	85 c0                	test   %eax,%eax
+     6b9:	74 02                	je     6bd <readv+0x1d>
+    flushhook();
+     6bb:	ff d0                	call   *%eax
+  return _readv(fd, iov, cnt);
+     6bd:	89 7d 10             	mov    %edi,0x10(%ebp)
+     6c0:	89 75 0c             	mov    %esi,0xc(%ebp)
+     6c3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     6c6:	83 c4 0c             	add    $0xc,%esp
+     6c9:	5b                   	pop    %ebx
+     6ca:	5e                   	pop    %esi
+     6cb:	5f                   	pop    %edi
+     6cc:	5d                   	pop    %ebp
+  return _readv(fd, iov, cnt);
+     6cd:	e9 76 02 00 00       	jmp    948 <_readv>
+     6d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000006e0 <write>:
+{
+     6e0:	55                   	push   %ebp
+     6e1:	89 e5                	mov    %esp,%ebp
+     6e3:	57                   	push   %edi
+     6e4:	56                   	push   %esi
+     6e5:	53                   	push   %ebx
+     6e6:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     6e9:	a1 20 22 00 00       	mov    0x2220,%eax
+{
+     6ee:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     6f1:	8b 75 0c             	mov    0xc(%ebp),%esi
+     6f4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     6f7:	85 c0                	test   %eax,%eax
+     6f9:	74 02                	je     6fd <write+0x1d>
+    flushhook();
+     6fb:	ff d0                	call   *%eax
+  return _write(fd, buf, n);
+     6fd:	89 7d 10             	mov    %edi,0x10(%ebp)
+     700:	89 75 0c             	mov    %esi,0xc(%ebp)
+     703:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     706:	83 c4 0c             	add    $0xc,%esp
+     709:	5b                   	pop    %ebx
+     70a:	5e                   	pop    %esi
+     70b:	5f                   	pop    %edi
+     70c:	5d                   	pop    %ebp
+  return _write(fd, buf, n);
+     70d:	e9 2e 01 00 00       	jmp    840 <_write>
+     712:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     719:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000720 <writev>:
+{
+     720:	55                   	push   %ebp
+     721:	89 e5                	mov    %esp,%ebp
+     723:	57                   	push   %edi
+     724:	56                   	push   %esi
+     725:	53                   	push   %ebx
+     726:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     729:	a1 20 22 00 00       	mov    0x2220,%eax
+{
+     72e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     731:	8b 75 0c             	mov    0xc(%ebp),%esi
+     734:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     737:	85 c0                	test   %eax,%eax
+     739:	74 02                	je     73d <writev+0x1d>
+    flushhook();
+     73b:	ff d0                	call   *%eax
+  return _writev(fd, iov, cnt);
+     73d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     740:	89 75 0c             	mov    %esi,0xc(%ebp)
+     743:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     746:	83 c4 0c             	add    $0xc,%esp
+     749:	5b                   	pop    %ebx
+     74a:	5e                   	pop    %esi
+     74b:	5f                   	pop    %edi
+     74c:	5d                   	pop    %ebp
+  return _writev(fd, iov, cnt);
+     74d:	e9 fe 01 00 00       	jmp    950 <_writev>
+     752:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     759:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000760 <close>:
+{
+     760:	55                   	push   %ebp
+     761:	89 e5                	mov    %esp,%ebp
+     763:	53                   	push   %ebx
+     764:	83 ec 04             	sub    $0x4,%esp
+  if(flushhook)
+     767:	a1 20 22 00 00       	mov    0x2220,%eax
+{
+     76c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(flushhook)
+     76f:	85 c0                	test   %eax,%eax
+     771:	74 02                	je     775 <close+0x15>
+    flushhook();
+     773:	ff d0                	call   *%eax
+  return _close(fd);
+     775:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     778:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     77b:	c9                   	leave
+  return _close(fd);
+     77c:	e9 c7 00 00 00       	jmp    848 <_close>
+     781:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     788:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     78f:	90                   	nop
+
+00000790 <umtxinit>:
+// process that finds the mutex held enters the kernel, to sleep
+// in futexwait() until the holder's umtxunlock() wakes it.
+
+void
+umtxinit(struct umutex *m)
+{
+     790:	55                   	push   %ebp
+     791:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+     793:	8b 45 08             	mov    0x8(%ebp),%eax
+     796:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     79c:	5d                   	pop    %ebp
+     79d:	c3                   	ret
+     79e:	66 90                	xchg   %ax,%ax
+
+000007a0 <umtxlock>:
+
+void
+umtxlock(struct umutex *m)
+{
+     7a0:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+     7a1:	b8 01 00 00 00       	mov    $0x1,%eax
+     7a6:	89 e5                	mov    %esp,%ebp
+     7a8:	56                   	push   %esi
+     7a9:	53                   	push   %ebx
+     7aa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     7ad:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 1) == 0)
+     7b0:	85 c0                	test   %eax,%eax
+     7b2:	74 2b                	je     7df <umtxlock+0x3f>
+     7b4:	b8 02 00 00 00       	mov    $0x2,%eax
+     7b9:	f0 87 03             	lock xchg %eax,(%ebx)
+    return;
+  // Mark the mutex contended, so that its holder
+  // wakes a waiter on release, and wait.
+  while(xchg(&m->state, 2) != 0)
+     7bc:	85 c0                	test   %eax,%eax
+     7be:	74 1f                	je     7df <umtxlock+0x3f>
+     7c0:	be 02 00 00 00       	mov    $0x2,%esi
+     7c5:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwait(&m->state, 2);
+     7c8:	83 ec 08             	sub    $0x8,%esp
+     7cb:	6a 02                	push   $0x2
+     7cd:	53                   	push   %ebx
+     7ce:	e8 85 01 00 00       	call   958 <futexwait>
+     7d3:	89 f0                	mov    %esi,%eax
+     7d5:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+     7d8:	83 c4 10             	add    $0x10,%esp
+     7db:	85 c0                	test   %eax,%eax
+     7dd:	75 e9                	jne    7c8 <umtxlock+0x28>
+}
+     7df:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     7e2:	5b                   	pop    %ebx
+     7e3:	5e                   	pop    %esi
+     7e4:	5d                   	pop    %ebp
+     7e5:	c3                   	ret
+     7e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000007f0 <umtxunlock>:
+
+void
+umtxunlock(struct umutex *m)
+{
+     7f0:	55                   	push   %ebp
+     7f1:	31 c0                	xor    %eax,%eax
+     7f3:	89 e5                	mov    %esp,%ebp
+     7f5:	83 ec 08             	sub    $0x8,%esp
+     7f8:	8b 55 08             	mov    0x8(%ebp),%edx
+     7fb:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+     7fe:	83 f8 02             	cmp    $0x2,%eax
+     801:	74 05                	je     808 <umtxunlock+0x18>
+    futexwake(&m->state, 1);
+}
+     803:	c9                   	leave
+     804:	c3                   	ret
+     805:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwake(&m->state, 1);
+     808:	83 ec 08             	sub    $0x8,%esp
+     80b:	6a 01                	push   $0x1
+     80d:	52                   	push   %edx
+     80e:	e8 4d 01 00 00       	call   960 <futexwake>
+     813:	83 c4 10             	add    $0x10,%esp
+}
+     816:	c9                   	leave
+     817:	c3                   	ret
+
+00000818 <_fork>:
+  _ ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+     818:	b8 01 00 00 00       	mov    $0x1,%eax
+     81d:	cd 40                	int    $0x40
+     81f:	c3                   	ret
+
+00000820 <_exit>:
+RAWSYSCALL(exit)
+     820:	b8 02 00 00 00       	mov    $0x2,%eax
+     825:	cd 40                	int    $0x40
+     827:	c3                   	ret
+
+00000828 <wait>:
+SYSCALL(wait)
+     828:	b8 03 00 00 00       	mov    $0x3,%eax
+     82d:	cd 40                	int    $0x40
+     82f:	c3                   	ret
+
+00000830 <pipe>:
+SYSCALL(pipe)
+     830:	b8 04 00 00 00       	mov    $0x4,%eax
+     835:	cd 40                	int    $0x40
+     837:	c3                   	ret
+
+00000838 <_read>:
+RAWSYSCALL(read)
+     838:	b8 05 00 00 00       	mov    $0x5,%eax
+     83d:	cd 40                	int    $0x40
+     83f:	c3                   	ret
+
+00000840 <_write>:
+RAWSYSCALL(write)
+     840:	b8 10 00 00 00       	mov    $0x10,%eax
+     845:	cd 40                	int    $0x40
+     847:	c3                   	ret
+
+00000848 <_close>:
+RAWSYSCALL(close)
+     848:	b8 15 00 00 00       	mov    $0x15,%eax
+     84d:	cd 40                	int    $0x40
+     84f:	c3                   	ret
+
+00000850 <kill>:
+SYSCALL(kill)
+     850:	b8 06 00 00 00       	mov    $0x6,%eax
+     855:	cd 40                	int    $0x40
+     857:	c3                   	ret
+
+00000858 <_exec>:
+RAWSYSCALL(exec)
+     858:	b8 07 00 00 00       	mov    $0x7,%eax
+     85d:	cd 40                	int    $0x40
+     85f:	c3                   	ret
+
+00000860 <open>:
+SYSCALL(open)
+     860:	b8 0f 00 00 00       	mov    $0xf,%eax
+     865:	cd 40                	int    $0x40
+     867:	c3                   	ret
+
+00000868 <mknod>:
+SYSCALL(mknod)
+     868:	b8 11 00 00 00       	mov    $0x11,%eax
+     86d:	cd 40                	int    $0x40
+     86f:	c3                   	ret
+
+00000870 <unlink>:
+SYSCALL(unlink)
+     870:	b8 12 00 00 00       	mov    $0x12,%eax
+     875:	cd 40                	int    $0x40
+     877:	c3                   	ret
+
+00000878 <fstat>:
+SYSCALL(fstat)
+     878:	b8 08 00 00 00       	mov    $0x8,%eax
+     87d:	cd 40                	int    $0x40
+     87f:	c3                   	ret
+
+00000880 <link>:
+SYSCALL(link)
+     880:	b8 13 00 00 00       	mov    $0x13,%eax
+     885:	cd 40                	int    $0x40
+     887:	c3                   	ret
+
+00000888 <mkdir>:
+SYSCALL(mkdir)
+     888:	b8 14 00 00 00       	mov    $0x14,%eax
+     88d:	cd 40                	int    $0x40
+     88f:	c3                   	ret
+
+00000890 <chdir>:
+SYSCALL(chdir)
+     890:	b8 09 00 00 00       	mov    $0x9,%eax
+     895:	cd 40                	int    $0x40
+     897:	c3                   	ret
+
+00000898 <dup>:
+SYSCALL(dup)
+     898:	b8 0a 00 00 00       	mov    $0xa,%eax
+     89d:	cd 40                	int    $0x40
+     89f:	c3                   	ret
+
+000008a0 <getpid>:
+SYSCALL(getpid)
+     8a0:	b8 0b 00 00 00       	mov    $0xb,%eax
+     8a5:	cd 40                	int    $0x40
+     8a7:	c3                   	ret
+
+000008a8 <sbrk>:
+SYSCALL(sbrk)
+     8a8:	b8 0c 00 00 00       	mov    $0xc,%eax
+     8ad:	cd 40                	int    $0x40
+     8af:	c3                   	ret
+
+000008b0 <sleep>:
+SYSCALL(sleep)
+     8b0:	b8 0d 00 00 00       	mov    $0xd,%eax
+     8b5:	cd 40                	int    $0x40
+     8b7:	c3                   	ret
+
+000008b8 <uptime>:
+SYSCALL(uptime)
+     8b8:	b8 0e 00 00 00       	mov    $0xe,%eax
+     8bd:	cd 40                	int    $0x40
+     8bf:	c3                   	ret
+
+000008c0 <wolfie>:
+SYSCALL(wolfie)
+     8c0:	b8 16 00 00 00       	mov    $0x16,%eax
+     8c5:	cd 40                	int    $0x40
+     8c7:	c3                   	ret
+
+000008c8 <nice>:
+SYSCALL(nice)
+     8c8:	b8 17 00 00 00       	mov    $0x17,%eax
+     8cd:	cd 40                	int    $0x40
+     8cf:	c3                   	ret
+
+000008d0 <mtxget>:
+SYSCALL(mtxget)
+     8d0:	b8 18 00 00 00       	mov    $0x18,%eax
+     8d5:	cd 40                	int    $0x40
+     8d7:	c3                   	ret
+
+000008d8 <mtxrel>:
+SYSCALL(mtxrel)
+     8d8:	b8 19 00 00 00       	mov    $0x19,%eax
+     8dd:	cd 40                	int    $0x40
+     8df:	c3                   	ret
+
+000008e0 <mtxacq>:
+SYSCALL(mtxacq)
+     8e0:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     8e5:	cd 40                	int    $0x40
+     8e7:	c3                   	ret
+
+000008e8 <mtxdel>:
+SYSCALL(mtxdel)
+     8e8:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     8ed:	cd 40                	int    $0x40
+     8ef:	c3                   	ret
+
+000008f0 <iostat>:
+SYSCALL(iostat)
+     8f0:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     8f5:	cd 40                	int    $0x40
+     8f7:	c3                   	ret
+
+000008f8 <mmap>:
+SYSCALL(mmap)
+     8f8:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     8fd:	cd 40                	int    $0x40
+     8ff:	c3                   	ret
+
+00000900 <munmap>:
+SYSCALL(munmap)
+     900:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     905:	cd 40                	int    $0x40
+     907:	c3                   	ret
+
+00000908 <shmget>:
+SYSCALL(shmget)
+     908:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     90d:	cd 40                	int    $0x40
+     90f:	c3                   	ret
+
+00000910 <shmat>:
+SYSCALL(shmat)
+     910:	b8 20 00 00 00       	mov    $0x20,%eax
+     915:	cd 40                	int    $0x40
+     917:	c3                   	ret
+
+00000918 <shmdt>:
+SYSCALL(shmdt)
+     918:	b8 21 00 00 00       	mov    $0x21,%eax
+     91d:	cd 40                	int    $0x40
+     91f:	c3                   	ret
+
+00000920 <shmdel>:
+SYSCALL(shmdel)
+     920:	b8 22 00 00 00       	mov    $0x22,%eax
+     925:	cd 40                	int    $0x40
+     927:	c3                   	ret
+
+00000928 <syscount>:
+SYSCALL(syscount)
+     928:	b8 23 00 00 00       	mov    $0x23,%eax
+     92d:	cd 40                	int    $0x40
+     92f:	c3                   	ret
+
+00000930 <splice>:
+SYSCALL(splice)
+     930:	b8 24 00 00 00       	mov    $0x24,%eax
+     935:	cd 40                	int    $0x40
+     937:	c3                   	ret
+
+00000938 <tee>:
+SYSCALL(tee)
+     938:	b8 25 00 00 00       	mov    $0x25,%eax
+     93d:	cd 40                	int    $0x40
+     93f:	c3                   	ret
+
+00000940 <sendfile>:
+SYSCALL(sendfile)
+     940:	b8 26 00 00 00       	mov    $0x26,%eax
+     945:	cd 40                	int    $0x40
+     947:	c3                   	ret
+
+00000948 <_readv>:
+RAWSYSCALL(readv)
+     948:	b8 27 00 00 00       	mov    $0x27,%eax
+     94d:	cd 40                	int    $0x40
+     94f:	c3                   	ret
+
+00000950 <_writev>:
+RAWSYSCALL(writev)
+     950:	b8 28 00 00 00       	mov    $0x28,%eax
+     955:	cd 40                	int    $0x40
+     957:	c3                   	ret
+
+00000958 <futexwait>:
+SYSCALL(futexwait)
+     958:	b8 29 00 00 00       	mov    $0x29,%eax
+     95d:	cd 40                	int    $0x40
+     95f:	c3                   	ret
+
+00000960 <futexwake>:
+SYSCALL(futexwake)
+     960:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     965:	cd 40                	int    $0x40
+     967:	c3                   	ret
+
+00000968 <lockstat>:
+SYSCALL(lockstat)
+     968:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     96d:	cd 40                	int    $0x40
+     96f:	c3                   	ret
+
+00000970 <clone>:
+SYSCALL(clone)
+     970:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     975:	cd 40                	int    $0x40
+     977:	c3                   	ret
+
+00000978 <join>:
+SYSCALL(join)
+     978:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     97d:	cd 40                	int    $0x40
+     97f:	c3                   	ret
+
+00000980 <stacklimit>:
+SYSCALL(stacklimit)
+     980:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     985:	cd 40                	int    $0x40
+     987:	c3                   	ret
+     988:	66 90                	xchg   %ax,%ax
+     98a:	66 90                	xchg   %ax,%ax
+     98c:	66 90                	xchg   %ax,%ax
+     98e:	66 90                	xchg   %ax,%ax
+
+00000990 <flushall>:
+  b->n = 0;
+}
+
+static void
+flushall(void)
+{
+     990:	55                   	push   %ebp
+     991:	89 e5                	mov    %esp,%ebp
+     993:	83 ec 14             	sub    $0x14,%esp
+  umtxlock(&stdoutlock);
+     996:	68 24 22 00 00       	push   $0x2224
+     99b:	e8 00 fe ff ff       	call   7a0 <umtxlock>
+  if(b->n > 0)
+     9a0:	a1 08 20 00 00       	mov    0x2008,%eax
+     9a5:	83 c4 10             	add    $0x10,%esp
+     9a8:	85 c0                	test   %eax,%eax
+     9aa:	7e 17                	jle    9c3 <flushall+0x33>
+    _write(b->fd, b->buf, b->n);
+     9ac:	83 ec 04             	sub    $0x4,%esp
+     9af:	50                   	push   %eax
+     9b0:	68 0c 20 00 00       	push   $0x200c
+     9b5:	ff 35 00 20 00 00    	push   0x2000
+     9bb:	e8 80 fe ff ff       	call   840 <_write>
+     9c0:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     9c3:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     9ca:	00 00 00 
+  flush(&stdout);
+  umtxunlock(&stdoutlock);
+     9cd:	83 ec 0c             	sub    $0xc,%esp
+     9d0:	68 24 22 00 00       	push   $0x2224
+     9d5:	e8 16 fe ff ff       	call   7f0 <umtxunlock>
+}
+     9da:	83 c4 10             	add    $0x10,%esp
+     9dd:	c9                   	leave
+     9de:	c3                   	ret
+     9df:	90                   	nop
+
+000009e0 <printint>:
+    flush(b);
+}
+
+static void
+printint(struct outbuf *b, int xx, int base, int sgn)
+{
+     9e0:	55                   	push   %ebp
+     9e1:	89 e5                	mov    %esp,%ebp
+     9e3:	57                   	push   %edi
+     9e4:	89 cf                	mov    %ecx,%edi
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     9e6:	89 d1                	mov    %edx,%ecx
+{
+     9e8:	56                   	push   %esi
+     9e9:	53                   	push   %ebx
+     9ea:	89 c3                	mov    %eax,%ebx
+     9ec:	83 ec 2c             	sub    $0x2c,%esp
+  if(sgn && xx < 0){
+     9ef:	85 d2                	test   %edx,%edx
+     9f1:	0f 89 b9 00 00 00    	jns    ab0 <printint+0xd0>
+     9f7:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     9fb:	0f 84 af 00 00 00    	je     ab0 <printint+0xd0>
+    x = -xx;
+     a01:	f7 d9                	neg    %ecx
+    neg = 1;
+     a03:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     a08:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     a0b:	31 f6                	xor    %esi,%esi
+     a0d:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     a10:	89 c8                	mov    %ecx,%eax
+     a12:	31 d2                	xor    %edx,%edx
+     a14:	89 f3                	mov    %esi,%ebx
+     a16:	f7 f7                	div    %edi
+     a18:	8d 76 01             	lea    0x1(%esi),%esi
+     a1b:	0f b6 92 ac 16 00 00 	movzbl 0x16ac(%edx),%edx
+     a22:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     a26:	89 ca                	mov    %ecx,%edx
+     a28:	89 c1                	mov    %eax,%ecx
+     a2a:	39 fa                	cmp    %edi,%edx
+     a2c:	73 e2                	jae    a10 <printint+0x30>
+  if(neg)
+     a2e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     a31:	89 d9                	mov    %ebx,%ecx
+     a33:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     a36:	85 c0                	test   %eax,%eax
+     a38:	74 07                	je     a41 <printint+0x61>
+    buf[i++] = '-';
+     a3a:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     a3f:	89 f1                	mov    %esi,%ecx
+     a41:	8d 75 d8             	lea    -0x28(%ebp),%esi
+     a44:	89 cf                	mov    %ecx,%edi
+     a46:	01 f7                	add    %esi,%edi
+     a48:	eb 1a                	jmp    a64 <printint+0x84>
+     a4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    *b->str++ = c;
+     a50:	8d 48 01             	lea    0x1(%eax),%ecx
+     a53:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+     a59:	88 10                	mov    %dl,(%eax)
+
+  while(--i >= 0)
+     a5b:	8d 47 ff             	lea    -0x1(%edi),%eax
+     a5e:	39 fe                	cmp    %edi,%esi
+     a60:	74 40                	je     aa2 <printint+0xc2>
+     a62:	89 c7                	mov    %eax,%edi
+  if(b->str){
+     a64:	8b 83 0c 02 00 00    	mov    0x20c(%ebx),%eax
+    putc(b, buf[i]);
+     a6a:	0f b6 17             	movzbl (%edi),%edx
+  if(b->str){
+     a6d:	85 c0                	test   %eax,%eax
+     a6f:	75 df                	jne    a50 <printint+0x70>
+  b->buf[b->n++] = c;
+     a71:	8b 4b 08             	mov    0x8(%ebx),%ecx
+     a74:	8d 41 01             	lea    0x1(%ecx),%eax
+     a77:	89 43 08             	mov    %eax,0x8(%ebx)
+     a7a:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+     a7e:	3d 00 02 00 00       	cmp    $0x200,%eax
+     a83:	74 3b                	je     ac0 <printint+0xe0>
+     a85:	80 fa 0a             	cmp    $0xa,%dl
+     a88:	75 d1                	jne    a5b <printint+0x7b>
+     a8a:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+     a8e:	75 cb                	jne    a5b <printint+0x7b>
+  if(b->n > 0)
+     a90:	85 c0                	test   %eax,%eax
+     a92:	7f 2c                	jg     ac0 <printint+0xe0>
+  b->n = 0;
+     a94:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  while(--i >= 0)
+     a9b:	8d 47 ff             	lea    -0x1(%edi),%eax
+     a9e:	39 fe                	cmp    %edi,%esi
+     aa0:	75 c0                	jne    a62 <printint+0x82>
+}
+     aa2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     aa5:	5b                   	pop    %ebx
+     aa6:	5e                   	pop    %esi
+     aa7:	5f                   	pop    %edi
+     aa8:	5d                   	pop    %ebp
+     aa9:	c3                   	ret
+     aaa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  neg = 0;
+     ab0:	31 c0                	xor    %eax,%eax
+     ab2:	e9 51 ff ff ff       	jmp    a08 <printint+0x28>
+     ab7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     abe:	66 90                	xchg   %ax,%ax
+    _write(b->fd, b->buf, b->n);
+     ac0:	83 ec 04             	sub    $0x4,%esp
+     ac3:	50                   	push   %eax
+     ac4:	8d 43 0c             	lea    0xc(%ebx),%eax
+     ac7:	50                   	push   %eax
+     ac8:	ff 33                	push   (%ebx)
+     aca:	e8 71 fd ff ff       	call   840 <_write>
+     acf:	83 c4 10             	add    $0x10,%esp
+     ad2:	eb c0                	jmp    a94 <printint+0xb4>
+     ad4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     adb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     adf:	90                   	nop
+
+00000ae0 <putc>:
+{
+     ae0:	55                   	push   %ebp
+     ae1:	89 e5                	mov    %esp,%ebp
+     ae3:	53                   	push   %ebx
+     ae4:	89 c3                	mov    %eax,%ebx
+     ae6:	83 ec 04             	sub    $0x4,%esp
+  if(b->str){
+     ae9:	8b 80 0c 02 00 00    	mov    0x20c(%eax),%eax
+     aef:	85 c0                	test   %eax,%eax
+     af1:	74 15                	je     b08 <putc+0x28>
+    *b->str++ = c;
+     af3:	8d 48 01             	lea    0x1(%eax),%ecx
+     af6:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+     afc:	88 10                	mov    %dl,(%eax)
+}
+     afe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     b01:	c9                   	leave
+     b02:	c3                   	ret
+     b03:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b07:	90                   	nop
+  b->buf[b->n++] = c;
+     b08:	8b 4b 08             	mov    0x8(%ebx),%ecx
+     b0b:	8d 41 01             	lea    0x1(%ecx),%eax
+     b0e:	89 43 08             	mov    %eax,0x8(%ebx)
+     b11:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+     b15:	3d 00 02 00 00       	cmp    $0x200,%eax
+     b1a:	74 14                	je     b30 <putc+0x50>
+     b1c:	80 fa 0a             	cmp    $0xa,%dl
+     b1f:	75 dd                	jne    afe <putc+0x1e>
+     b21:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+     b25:	75 d7                	jne    afe <putc+0x1e>
+  if(b->n > 0)
+     b27:	85 c0                	test   %eax,%eax
+     b29:	7e 17                	jle    b42 <putc+0x62>
+     b2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b2f:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     b30:	83 ec 04             	sub    $0x4,%esp
+     b33:	50                   	push   %eax
+     b34:	8d 43 0c             	lea    0xc(%ebx),%eax
+     b37:	50                   	push   %eax
+     b38:	ff 33                	push   (%ebx)
+     b3a:	e8 01 fd ff ff       	call   840 <_write>
+     b3f:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     b42:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+     b49:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     b4c:	c9                   	leave
+     b4d:	c3                   	ret
+     b4e:	66 90                	xchg   %ax,%ax
+
+00000b50 <format>:
+
+// Format fmt and the arguments at ap into b.
+// Only understands %d, %x, %p, %s, %c.
+static void
+format(struct outbuf *b, const char *fmt, uint *ap)
+{
+     b50:	55                   	push   %ebp
+     b51:	89 e5                	mov    %esp,%ebp
+     b53:	57                   	push   %edi
+     b54:	89 c7                	mov    %eax,%edi
+     b56:	56                   	push   %esi
+     b57:	53                   	push   %ebx
+     b58:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+     b5b:	0f b6 02             	movzbl (%edx),%eax
+{
+     b5e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  for(i = 0; fmt[i]; i++){
+     b61:	84 c0                	test   %al,%al
+     b63:	74 5a                	je     bbf <format+0x6f>
+     b65:	8d 5a 01             	lea    0x1(%edx),%ebx
+     b68:	31 f6                	xor    %esi,%esi
+     b6a:	eb 1c                	jmp    b88 <format+0x38>
+     b6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     b70:	83 f8 25             	cmp    $0x25,%eax
+     b73:	74 3b                	je     bb0 <format+0x60>
+        state = '%';
+      } else {
+        putc(b, c);
+     b75:	89 ca                	mov    %ecx,%edx
+     b77:	89 f8                	mov    %edi,%eax
+     b79:	e8 62 ff ff ff       	call   ae0 <putc>
+  for(i = 0; fmt[i]; i++){
+     b7e:	0f b6 03             	movzbl (%ebx),%eax
+     b81:	83 c3 01             	add    $0x1,%ebx
+     b84:	84 c0                	test   %al,%al
+     b86:	74 37                	je     bbf <format+0x6f>
+    c = fmt[i] & 0xff;
+     b88:	0f be c8             	movsbl %al,%ecx
+     b8b:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     b8e:	85 f6                	test   %esi,%esi
+     b90:	74 de                	je     b70 <format+0x20>
+      }
+    } else if(state == '%'){
+     b92:	83 fe 25             	cmp    $0x25,%esi
+     b95:	75 e7                	jne    b7e <format+0x2e>
+      if(c == 'd'){
+     b97:	83 f8 25             	cmp    $0x25,%eax
+     b9a:	74 46                	je     be2 <format+0x92>
+     b9c:	83 e8 63             	sub    $0x63,%eax
+     b9f:	83 f8 15             	cmp    $0x15,%eax
+     ba2:	77 2c                	ja     bd0 <format+0x80>
+     ba4:	ff 24 85 54 16 00 00 	jmp    *0x1654(,%eax,4)
+     bab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     baf:	90                   	nop
+  for(i = 0; fmt[i]; i++){
+     bb0:	0f b6 03             	movzbl (%ebx),%eax
+     bb3:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+     bb6:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+     bbb:	84 c0                	test   %al,%al
+     bbd:	75 c9                	jne    b88 <format+0x38>
+        putc(b, c);
+      }
+      state = 0;
+    }
+  }
+}
+     bbf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     bc2:	5b                   	pop    %ebx
+     bc3:	5e                   	pop    %esi
+     bc4:	5f                   	pop    %edi
+     bc5:	5d                   	pop    %ebp
+     bc6:	c3                   	ret
+     bc7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bce:	66 90                	xchg   %ax,%ax
+        putc(b, '%');
+     bd0:	ba 25 00 00 00       	mov    $0x25,%edx
+     bd5:	89 f8                	mov    %edi,%eax
+     bd7:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     bda:	e8 01 ff ff ff       	call   ae0 <putc>
+        putc(b, c);
+     bdf:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     be2:	89 ca                	mov    %ecx,%edx
+     be4:	89 f8                	mov    %edi,%eax
+      state = 0;
+     be6:	31 f6                	xor    %esi,%esi
+        putc(b, c);
+     be8:	e8 f3 fe ff ff       	call   ae0 <putc>
+     bed:	eb 8f                	jmp    b7e <format+0x2e>
+     bef:	90                   	nop
+        printint(b, *ap, 16, 0);
+     bf0:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     bf3:	83 ec 0c             	sub    $0xc,%esp
+     bf6:	b9 10 00 00 00       	mov    $0x10,%ecx
+     bfb:	8b 16                	mov    (%esi),%edx
+     bfd:	6a 00                	push   $0x0
+        ap++;
+     bff:	83 c6 04             	add    $0x4,%esi
+        printint(b, *ap, 16, 0);
+     c02:	89 f8                	mov    %edi,%eax
+     c04:	e8 d7 fd ff ff       	call   9e0 <printint>
+        ap++;
+     c09:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+     c0c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     c0f:	31 f6                	xor    %esi,%esi
+     c11:	e9 68 ff ff ff       	jmp    b7e <format+0x2e>
+     c16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c1d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     c20:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     c23:	8b 30                	mov    (%eax),%esi
+        ap++;
+     c25:	83 c0 04             	add    $0x4,%eax
+     c28:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+     c2b:	85 f6                	test   %esi,%esi
+     c2d:	75 1b                	jne    c4a <format+0xfa>
+     c2f:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+     c34:	be 4c 16 00 00       	mov    $0x164c,%esi
+     c39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+          putc(b, *s);
+     c40:	89 f8                	mov    %edi,%eax
+          s++;
+     c42:	83 c6 01             	add    $0x1,%esi
+          putc(b, *s);
+     c45:	e8 96 fe ff ff       	call   ae0 <putc>
+        while(*s != 0){
+     c4a:	0f be 16             	movsbl (%esi),%edx
+     c4d:	84 d2                	test   %dl,%dl
+     c4f:	75 ef                	jne    c40 <format+0xf0>
+      state = 0;
+     c51:	31 f6                	xor    %esi,%esi
+     c53:	e9 26 ff ff ff       	jmp    b7e <format+0x2e>
+     c58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c5f:	90                   	nop
+        printint(b, *ap, 10, 1);
+     c60:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     c63:	83 ec 0c             	sub    $0xc,%esp
+     c66:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     c6b:	8b 16                	mov    (%esi),%edx
+     c6d:	6a 01                	push   $0x1
+     c6f:	eb 8e                	jmp    bff <format+0xaf>
+     c71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(b, *ap);
+     c78:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     c7b:	89 f8                	mov    %edi,%eax
+     c7d:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+     c80:	83 c6 04             	add    $0x4,%esi
+        putc(b, *ap);
+     c83:	e8 58 fe ff ff       	call   ae0 <putc>
+        ap++;
+     c88:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      state = 0;
+     c8b:	31 f6                	xor    %esi,%esi
+     c8d:	e9 ec fe ff ff       	jmp    b7e <format+0x2e>
+     c92:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c99:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000ca0 <fflush>:
+{
+     ca0:	55                   	push   %ebp
+     ca1:	89 e5                	mov    %esp,%ebp
+     ca3:	83 ec 08             	sub    $0x8,%esp
+  if(fd == stdout.fd)
+     ca6:	8b 45 08             	mov    0x8(%ebp),%eax
+     ca9:	39 05 00 20 00 00    	cmp    %eax,0x2000
+     caf:	74 07                	je     cb8 <fflush+0x18>
+}
+     cb1:	c9                   	leave
+     cb2:	c3                   	ret
+     cb3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     cb7:	90                   	nop
+  umtxlock(&stdoutlock);
+     cb8:	83 ec 0c             	sub    $0xc,%esp
+     cbb:	68 24 22 00 00       	push   $0x2224
+     cc0:	e8 db fa ff ff       	call   7a0 <umtxlock>
+  if(b->n > 0)
+     cc5:	a1 08 20 00 00       	mov    0x2008,%eax
+     cca:	83 c4 10             	add    $0x10,%esp
+     ccd:	85 c0                	test   %eax,%eax
+     ccf:	7f 1f                	jg     cf0 <fflush+0x50>
+  b->n = 0;
+     cd1:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     cd8:	00 00 00 
+  umtxunlock(&stdoutlock);
+     cdb:	c7 45 08 24 22 00 00 	movl   $0x2224,0x8(%ebp)
+}
+     ce2:	c9                   	leave
+  umtxunlock(&stdoutlock);
+     ce3:	e9 08 fb ff ff       	jmp    7f0 <umtxunlock>
+     ce8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cef:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     cf0:	83 ec 04             	sub    $0x4,%esp
+     cf3:	50                   	push   %eax
+     cf4:	68 0c 20 00 00       	push   $0x200c
+     cf9:	ff 35 00 20 00 00    	push   0x2000
+     cff:	e8 3c fb ff ff       	call   840 <_write>
+     d04:	83 c4 10             	add    $0x10,%esp
+     d07:	eb c8                	jmp    cd1 <fflush+0x31>
+     d09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000d10 <setvbuf>:
+{
+     d10:	55                   	push   %ebp
+     d11:	89 e5                	mov    %esp,%ebp
+     d13:	53                   	push   %ebx
+     d14:	83 ec 04             	sub    $0x4,%esp
+     d17:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd != stdout.fd)
+     d1a:	8b 45 08             	mov    0x8(%ebp),%eax
+     d1d:	39 05 00 20 00 00    	cmp    %eax,0x2000
+     d23:	74 0b                	je     d30 <setvbuf+0x20>
+}
+     d25:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     d28:	c9                   	leave
+     d29:	c3                   	ret
+     d2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  umtxlock(&stdoutlock);
+     d30:	83 ec 0c             	sub    $0xc,%esp
+     d33:	68 24 22 00 00       	push   $0x2224
+     d38:	e8 63 fa ff ff       	call   7a0 <umtxlock>
+  if(b->n > 0)
+     d3d:	a1 08 20 00 00       	mov    0x2008,%eax
+     d42:	83 c4 10             	add    $0x10,%esp
+     d45:	85 c0                	test   %eax,%eax
+     d47:	7f 2f                	jg     d78 <setvbuf+0x68>
+  b->n = 0;
+     d49:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     d50:	00 00 00 
+  stdout.mode = mode;
+     d53:	89 1d 04 20 00 00    	mov    %ebx,0x2004
+  flushhook = flushall;
+     d59:	c7 05 20 22 00 00 90 	movl   $0x990,0x2220
+     d60:	09 00 00 
+}
+     d63:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&stdoutlock);
+     d66:	c7 45 08 24 22 00 00 	movl   $0x2224,0x8(%ebp)
+}
+     d6d:	c9                   	leave
+  umtxunlock(&stdoutlock);
+     d6e:	e9 7d fa ff ff       	jmp    7f0 <umtxunlock>
+     d73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d77:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     d78:	83 ec 04             	sub    $0x4,%esp
+     d7b:	50                   	push   %eax
+     d7c:	68 0c 20 00 00       	push   $0x200c
+     d81:	ff 35 00 20 00 00    	push   0x2000
+     d87:	e8 b4 fa ff ff       	call   840 <_write>
+     d8c:	83 c4 10             	add    $0x10,%esp
+     d8f:	eb b8                	jmp    d49 <setvbuf+0x39>
+     d91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d9f:	90                   	nop
+
+00000da0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s, %c.
+void
+printf(int fd, const char *fmt, ...)
+{
+     da0:	55                   	push   %ebp
+     da1:	89 e5                	mov    %esp,%ebp
+     da3:	53                   	push   %ebx
+     da4:	81 ec 14 02 00 00    	sub    $0x214,%esp
+     daa:	8b 45 08             	mov    0x8(%ebp),%eax
+    local.mode = _IONBF;
+    local.n = 0;
+    local.str = 0;
+    b = &local;
+  }
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     dad:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd == stdout.fd){
+     db0:	39 05 00 20 00 00    	cmp    %eax,0x2000
+     db6:	74 48                	je     e00 <printf+0x60>
+    local.fd = fd;
+     db8:	89 85 e8 fd ff ff    	mov    %eax,-0x218(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     dbe:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     dc1:	89 da                	mov    %ebx,%edx
+     dc3:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+    local.mode = _IONBF;
+     dc9:	c7 85 ec fd ff ff 03 	movl   $0x3,-0x214(%ebp)
+     dd0:	00 00 00 
+    local.n = 0;
+     dd3:	c7 85 f0 fd ff ff 00 	movl   $0x0,-0x210(%ebp)
+     dda:	00 00 00 
+    local.str = 0;
+     ddd:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     de4:	e8 67 fd ff ff       	call   b50 <format>
+  if(b->mode == _IONBF)
+     de9:	83 bd ec fd ff ff 03 	cmpl   $0x3,-0x214(%ebp)
+     df0:	0f 84 a2 00 00 00    	je     e98 <printf+0xf8>
+    flush(b);
+  if(b == &stdout)
+    umtxunlock(&stdoutlock);
+}
+     df6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     df9:	c9                   	leave
+     dfa:	c3                   	ret
+     dfb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     dff:	90                   	nop
+    umtxlock(&stdoutlock);
+     e00:	83 ec 0c             	sub    $0xc,%esp
+     e03:	68 24 22 00 00       	push   $0x2224
+     e08:	e8 93 f9 ff ff       	call   7a0 <umtxlock>
+  if(stdout.mode == 0){
+     e0d:	a1 04 20 00 00       	mov    0x2004,%eax
+     e12:	83 c4 10             	add    $0x10,%esp
+     e15:	85 c0                	test   %eax,%eax
+     e17:	74 37                	je     e50 <printf+0xb0>
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     e19:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     e1c:	89 da                	mov    %ebx,%edx
+     e1e:	b8 00 20 00 00       	mov    $0x2000,%eax
+     e23:	e8 28 fd ff ff       	call   b50 <format>
+  if(b->mode == _IONBF)
+     e28:	83 3d 04 20 00 00 03 	cmpl   $0x3,0x2004
+     e2f:	0f 84 ab 00 00 00    	je     ee0 <printf+0x140>
+    umtxunlock(&stdoutlock);
+     e35:	83 ec 0c             	sub    $0xc,%esp
+     e38:	68 24 22 00 00       	push   $0x2224
+     e3d:	e8 ae f9 ff ff       	call   7f0 <umtxunlock>
+}
+     e42:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    umtxunlock(&stdoutlock);
+     e45:	83 c4 10             	add    $0x10,%esp
+}
+     e48:	c9                   	leave
+     e49:	c3                   	ret
+     e4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+     e50:	83 ec 08             	sub    $0x8,%esp
+     e53:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+     e59:	50                   	push   %eax
+     e5a:	ff 35 00 20 00 00    	push   0x2000
+     e60:	e8 13 fa ff ff       	call   878 <fstat>
+     e65:	83 c4 10             	add    $0x10,%esp
+     e68:	89 c2                	mov    %eax,%edx
+      stdout.mode = _IOFBF;
+     e6a:	b8 01 00 00 00       	mov    $0x1,%eax
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+     e6f:	85 d2                	test   %edx,%edx
+     e71:	75 10                	jne    e83 <printf+0xe3>
+      stdout.mode = _IOLBF;
+     e73:	31 c0                	xor    %eax,%eax
+     e75:	66 83 bd e8 fd ff ff 	cmpw   $0x3,-0x218(%ebp)
+     e7c:	03 
+     e7d:	0f 94 c0             	sete   %al
+     e80:	83 c0 01             	add    $0x1,%eax
+     e83:	a3 04 20 00 00       	mov    %eax,0x2004
+    flushhook = flushall;
+     e88:	c7 05 20 22 00 00 90 	movl   $0x990,0x2220
+     e8f:	09 00 00 
+     e92:	eb 85                	jmp    e19 <printf+0x79>
+     e94:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(b->n > 0)
+     e98:	8b 85 f0 fd ff ff    	mov    -0x210(%ebp),%eax
+     e9e:	85 c0                	test   %eax,%eax
+     ea0:	0f 8e 50 ff ff ff    	jle    df6 <printf+0x56>
+    b = &local;
+     ea6:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+    _write(b->fd, b->buf, b->n);
+     eac:	83 ec 04             	sub    $0x4,%esp
+     eaf:	50                   	push   %eax
+     eb0:	8d 43 0c             	lea    0xc(%ebx),%eax
+     eb3:	50                   	push   %eax
+     eb4:	ff 33                	push   (%ebx)
+     eb6:	e8 85 f9 ff ff       	call   840 <_write>
+  b->n = 0;
+     ebb:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  if(b == &stdout)
+     ec2:	83 c4 10             	add    $0x10,%esp
+     ec5:	81 fb 00 20 00 00    	cmp    $0x2000,%ebx
+     ecb:	0f 85 25 ff ff ff    	jne    df6 <printf+0x56>
+     ed1:	e9 5f ff ff ff       	jmp    e35 <printf+0x95>
+     ed6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     edd:	8d 76 00             	lea    0x0(%esi),%esi
+  if(b->n > 0)
+     ee0:	a1 08 20 00 00       	mov    0x2008,%eax
+    b = getstdout();
+     ee5:	bb 00 20 00 00       	mov    $0x2000,%ebx
+  if(b->n > 0)
+     eea:	85 c0                	test   %eax,%eax
+     eec:	7f be                	jg     eac <printf+0x10c>
+  b->n = 0;
+     eee:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     ef5:	00 00 00 
+  if(b == &stdout)
+     ef8:	e9 38 ff ff ff       	jmp    e35 <printf+0x95>
+     efd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000f00 <sprintf>:
+
+// Print to the given buffer. Only understands %d, %x, %p, %s, %c.
+int
+sprintf(char *str, const char *fmt, ...)
+{
+     f00:	55                   	push   %ebp
+     f01:	89 e5                	mov    %esp,%ebp
+     f03:	53                   	push   %ebx
+  struct outbuf b;
+
+  b.str = str;
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+     f04:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+     f0a:	8d 4d 10             	lea    0x10(%ebp),%ecx
+{
+     f0d:	81 ec 14 02 00 00    	sub    $0x214,%esp
+     f13:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+     f16:	8b 55 0c             	mov    0xc(%ebp),%edx
+  b.str = str;
+     f19:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+     f1c:	e8 2f fc ff ff       	call   b50 <format>
+  *b.str = '\0';
+     f21:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f24:	c6 00 00             	movb   $0x0,(%eax)
+  return b.str - str;
+     f27:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f2a:	29 d8                	sub    %ebx,%eax
+}
+     f2c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     f2f:	c9                   	leave
+     f30:	c3                   	ret
+     f31:	66 90                	xchg   %ax,%ax
+     f33:	66 90                	xchg   %ax,%ax
+     f35:	66 90                	xchg   %ax,%ax
+     f37:	66 90                	xchg   %ax,%ax
+     f39:	66 90                	xchg   %ax,%ax
+     f3b:	66 90                	xchg   %ax,%ax
+     f3d:	66 90                	xchg   %ax,%ax
+     f3f:	90                   	nop
+
+00000f40 <freeblock>:
+static Header *freep;
+static struct umutex lock;  // threads made by clone() share the heap
+
+static void
+freeblock(void *ap)
+{
+     f40:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+     f41:	8d 48 f8             	lea    -0x8(%eax),%ecx
+{
+     f44:	89 e5                	mov    %esp,%ebp
+     f46:	57                   	push   %edi
+     f47:	56                   	push   %esi
+     f48:	53                   	push   %ebx
+     f49:	89 c3                	mov    %eax,%ebx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     f4b:	a1 2c 22 00 00       	mov    0x222c,%eax
+     f50:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     f52:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     f54:	39 ca                	cmp    %ecx,%edx
+     f56:	73 30                	jae    f88 <freeblock+0x48>
+     f58:	39 c1                	cmp    %eax,%ecx
+     f5a:	72 04                	jb     f60 <freeblock+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     f5c:	39 c2                	cmp    %eax,%edx
+     f5e:	72 f0                	jb     f50 <freeblock+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     f60:	8b 73 fc             	mov    -0x4(%ebx),%esi
+     f63:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+     f66:	39 f8                	cmp    %edi,%eax
+     f68:	74 26                	je     f90 <freeblock+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+     f6a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+     f6d:	8b 42 04             	mov    0x4(%edx),%eax
+     f70:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     f73:	39 f1                	cmp    %esi,%ecx
+     f75:	74 30                	je     fa7 <freeblock+0x67>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+     f77:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+     f79:	5b                   	pop    %ebx
+  freep = p;
+     f7a:	89 15 2c 22 00 00    	mov    %edx,0x222c
+}
+     f80:	5e                   	pop    %esi
+     f81:	5f                   	pop    %edi
+     f82:	5d                   	pop    %ebp
+     f83:	c3                   	ret
+     f84:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     f88:	39 c1                	cmp    %eax,%ecx
+     f8a:	72 d0                	jb     f5c <freeblock+0x1c>
+     f8c:	eb c2                	jmp    f50 <freeblock+0x10>
+     f8e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+     f90:	03 70 04             	add    0x4(%eax),%esi
+     f93:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     f96:	8b 02                	mov    (%edx),%eax
+     f98:	8b 00                	mov    (%eax),%eax
+     f9a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+     f9d:	8b 42 04             	mov    0x4(%edx),%eax
+     fa0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     fa3:	39 f1                	cmp    %esi,%ecx
+     fa5:	75 d0                	jne    f77 <freeblock+0x37>
+    p->s.size += bp->s.size;
+     fa7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+     faa:	89 15 2c 22 00 00    	mov    %edx,0x222c
+    p->s.size += bp->s.size;
+     fb0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+     fb3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+     fb6:	89 0a                	mov    %ecx,(%edx)
+}
+     fb8:	5b                   	pop    %ebx
+     fb9:	5e                   	pop    %esi
+     fba:	5f                   	pop    %edi
+     fbb:	5d                   	pop    %ebp
+     fbc:	c3                   	ret
+     fbd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000fc0 <free>:
+
+void
+free(void *ap)
+{
+     fc0:	55                   	push   %ebp
+     fc1:	89 e5                	mov    %esp,%ebp
+     fc3:	53                   	push   %ebx
+     fc4:	83 ec 10             	sub    $0x10,%esp
+     fc7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  umtxlock(&lock);
+     fca:	68 28 22 00 00       	push   $0x2228
+     fcf:	e8 cc f7 ff ff       	call   7a0 <umtxlock>
+  freeblock(ap);
+     fd4:	89 d8                	mov    %ebx,%eax
+     fd6:	e8 65 ff ff ff       	call   f40 <freeblock>
+  umtxunlock(&lock);
+     fdb:	c7 45 08 28 22 00 00 	movl   $0x2228,0x8(%ebp)
+}
+     fe2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&lock);
+     fe5:	83 c4 10             	add    $0x10,%esp
+}
+     fe8:	c9                   	leave
+  umtxunlock(&lock);
+     fe9:	e9 02 f8 ff ff       	jmp    7f0 <umtxunlock>
+     fee:	66 90                	xchg   %ax,%ax
+
+00000ff0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+     ff0:	55                   	push   %ebp
+     ff1:	89 e5                	mov    %esp,%ebp
+     ff3:	57                   	push   %edi
+     ff4:	56                   	push   %esi
+     ff5:	53                   	push   %ebx
+     ff6:	83 ec 28             	sub    $0x28,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     ff9:	8b 45 08             	mov    0x8(%ebp),%eax
+  umtxlock(&lock);
+     ffc:	68 28 22 00 00       	push   $0x2228
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1001:	8d 48 07             	lea    0x7(%eax),%ecx
+    1004:	c1 e9 03             	shr    $0x3,%ecx
+    1007:	8d 71 01             	lea    0x1(%ecx),%esi
+  umtxlock(&lock);
+    100a:	e8 91 f7 ff ff       	call   7a0 <umtxlock>
+  if((prevp = freep) == 0){
+    100f:	8b 15 2c 22 00 00    	mov    0x222c,%edx
+    1015:	83 c4 10             	add    $0x10,%esp
+    1018:	85 d2                	test   %edx,%edx
+    101a:	0f 84 b0 00 00 00    	je     10d0 <malloc+0xe0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1020:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+    1022:	8b 47 04             	mov    0x4(%edi),%eax
+    1025:	39 f0                	cmp    %esi,%eax
+    1027:	73 6f                	jae    1098 <malloc+0xa8>
+  if(nu < 4096)
+    1029:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    102e:	39 de                	cmp    %ebx,%esi
+    1030:	0f 43 de             	cmovae %esi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    1033:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+    103a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    103d:	eb 0a                	jmp    1049 <malloc+0x59>
+    103f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1040:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+    1042:	8b 47 04             	mov    0x4(%edi),%eax
+    1045:	39 f0                	cmp    %esi,%eax
+    1047:	73 4f                	jae    1098 <malloc+0xa8>
+      }
+      freep = prevp;
+      umtxunlock(&lock);
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    1049:	89 fa                	mov    %edi,%edx
+    104b:	39 3d 2c 22 00 00    	cmp    %edi,0x222c
+    1051:	75 ed                	jne    1040 <malloc+0x50>
+  p = sbrk(nu * sizeof(Header));
+    1053:	83 ec 0c             	sub    $0xc,%esp
+    1056:	ff 75 e4             	push   -0x1c(%ebp)
+    1059:	e8 4a f8 ff ff       	call   8a8 <sbrk>
+  if(p == (char*)-1)
+    105e:	83 c4 10             	add    $0x10,%esp
+    1061:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1064:	74 15                	je     107b <malloc+0x8b>
+  hp->s.size = nu;
+    1066:	89 58 04             	mov    %ebx,0x4(%eax)
+  freeblock((void*)(hp + 1));
+    1069:	83 c0 08             	add    $0x8,%eax
+    106c:	e8 cf fe ff ff       	call   f40 <freeblock>
+  return freep;
+    1071:	8b 15 2c 22 00 00    	mov    0x222c,%edx
+      if((p = morecore(nunits)) == 0){
+    1077:	85 d2                	test   %edx,%edx
+    1079:	75 c5                	jne    1040 <malloc+0x50>
+        umtxunlock(&lock);
+    107b:	83 ec 0c             	sub    $0xc,%esp
+    107e:	68 28 22 00 00       	push   $0x2228
+    1083:	e8 68 f7 ff ff       	call   7f0 <umtxunlock>
+        return 0;
+    1088:	83 c4 10             	add    $0x10,%esp
+      }
+  }
+}
+    108b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    108e:	31 c0                	xor    %eax,%eax
+}
+    1090:	5b                   	pop    %ebx
+    1091:	5e                   	pop    %esi
+    1092:	5f                   	pop    %edi
+    1093:	5d                   	pop    %ebp
+    1094:	c3                   	ret
+    1095:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1098:	39 c6                	cmp    %eax,%esi
+    109a:	74 64                	je     1100 <malloc+0x110>
+        p->s.size -= nunits;
+    109c:	29 f0                	sub    %esi,%eax
+    109e:	89 47 04             	mov    %eax,0x4(%edi)
+        p += p->s.size;
+    10a1:	8d 3c c7             	lea    (%edi,%eax,8),%edi
+        p->s.size = nunits;
+    10a4:	89 77 04             	mov    %esi,0x4(%edi)
+      umtxunlock(&lock);
+    10a7:	83 ec 0c             	sub    $0xc,%esp
+      freep = prevp;
+    10aa:	89 15 2c 22 00 00    	mov    %edx,0x222c
+      umtxunlock(&lock);
+    10b0:	68 28 22 00 00       	push   $0x2228
+    10b5:	e8 36 f7 ff ff       	call   7f0 <umtxunlock>
+      return (void*)(p + 1);
+    10ba:	83 c4 10             	add    $0x10,%esp
+}
+    10bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    10c0:	8d 47 08             	lea    0x8(%edi),%eax
+}
+    10c3:	5b                   	pop    %ebx
+    10c4:	5e                   	pop    %esi
+    10c5:	5f                   	pop    %edi
+    10c6:	5d                   	pop    %ebp
+    10c7:	c3                   	ret
+    10c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10cf:	90                   	nop
+    base.s.ptr = freep = prevp = &base;
+    10d0:	c7 05 2c 22 00 00 30 	movl   $0x2230,0x222c
+    10d7:	22 00 00 
+    base.s.size = 0;
+    10da:	bf 30 22 00 00       	mov    $0x2230,%edi
+    base.s.ptr = freep = prevp = &base;
+    10df:	c7 05 30 22 00 00 30 	movl   $0x2230,0x2230
+    10e6:	22 00 00 
+    base.s.size = 0;
+    10e9:	c7 05 34 22 00 00 00 	movl   $0x0,0x2234
+    10f0:	00 00 00 
+    if(p->s.size >= nunits){
+    10f3:	e9 31 ff ff ff       	jmp    1029 <malloc+0x39>
+    10f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10ff:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1100:	8b 07                	mov    (%edi),%eax
+    1102:	89 02                	mov    %eax,(%edx)
+    1104:	eb a1                	jmp    10a7 <malloc+0xb7>
+    1106:	66 90                	xchg   %ax,%ax
+    1108:	66 90                	xchg   %ax,%ax
+    110a:	66 90                	xchg   %ax,%ax
+    110c:	66 90                	xchg   %ax,%ax
+    110e:	66 90                	xchg   %ax,%ax
+
+00001110 <threadstart>:
+
+#define TSTACKSZ 4096
+
+static void
+threadstart(void *fn, void *arg)
+{
+    1110:	55                   	push   %ebp
+    1111:	89 e5                	mov    %esp,%ebp
+    1113:	83 ec 14             	sub    $0x14,%esp
+  ((void (*)(void*))fn)(arg);
+    1116:	ff 75 0c             	push   0xc(%ebp)
+    1119:	ff 55 08             	call   *0x8(%ebp)
+  exit();
+    111c:	e8 ef f4 ff ff       	call   610 <exit>
+    1121:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1128:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    112f:	90                   	nop
+
+00001130 <thread_create>:
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    1130:	55                   	push   %ebp
+    1131:	89 e5                	mov    %esp,%ebp
+    1133:	53                   	push   %ebx
+    1134:	83 ec 20             	sub    $0x20,%esp
+  char *mem, *stack;
+  int pid;
+
+  if((mem = malloc(2*TSTACKSZ)) == 0)
+    1137:	68 00 20 00 00       	push   $0x2000
+    113c:	e8 af fe ff ff       	call   ff0 <malloc>
+    1141:	83 c4 10             	add    $0x10,%esp
+    1144:	85 c0                	test   %eax,%eax
+    1146:	74 47                	je     118f <thread_create+0x5f>
+    1148:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)(((uint)mem + TSTACKSZ - 1) & ~(TSTACKSZ - 1));
+    114a:	8d 80 ff 0f 00 00    	lea    0xfff(%eax),%eax
+    1150:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  *(char**)stack = mem;
+    1155:	89 18                	mov    %ebx,(%eax)
+  if((pid = clone(threadstart, (void*)fn, arg, stack)) < 0)
+    1157:	50                   	push   %eax
+    1158:	ff 75 0c             	push   0xc(%ebp)
+    115b:	ff 75 08             	push   0x8(%ebp)
+    115e:	68 10 11 00 00       	push   $0x1110
+    1163:	e8 08 f8 ff ff       	call   970 <clone>
+    1168:	83 c4 10             	add    $0x10,%esp
+    116b:	85 c0                	test   %eax,%eax
+    116d:	78 09                	js     1178 <thread_create+0x48>
+    free(mem);
+  return pid;
+}
+    116f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1172:	c9                   	leave
+    1173:	c3                   	ret
+    1174:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    free(mem);
+    1178:	83 ec 0c             	sub    $0xc,%esp
+    117b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    117e:	53                   	push   %ebx
+    117f:	e8 3c fe ff ff       	call   fc0 <free>
+    1184:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    1187:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+    118a:	83 c4 10             	add    $0x10,%esp
+}
+    118d:	c9                   	leave
+    118e:	c3                   	ret
+    return -1;
+    118f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1194:	eb d9                	jmp    116f <thread_create+0x3f>
+    1196:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    119d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000011a0 <thread_join>:
+
+int
+thread_join(void)
+{
+    11a0:	55                   	push   %ebp
+    11a1:	89 e5                	mov    %esp,%ebp
+    11a3:	83 ec 34             	sub    $0x34,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    11a6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    11a9:	50                   	push   %eax
+    11aa:	e8 c9 f7 ff ff       	call   978 <join>
+    11af:	83 c4 10             	add    $0x10,%esp
+    11b2:	85 c0                	test   %eax,%eax
+    11b4:	79 0a                	jns    11c0 <thread_join+0x20>
+    free(*(char**)stack);
+  return pid;
+}
+    11b6:	c9                   	leave
+    11b7:	c3                   	ret
+    11b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11bf:	90                   	nop
+    free(*(char**)stack);
+    11c0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    11c3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    11c6:	83 ec 0c             	sub    $0xc,%esp
+    11c9:	ff 32                	push   (%edx)
+    11cb:	e8 f0 fd ff ff       	call   fc0 <free>
+    11d0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    11d3:	83 c4 10             	add    $0x10,%esp
+}
+    11d6:	c9                   	leave
+    11d7:	c3                   	ret
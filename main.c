@@ -29,6 +29,8 @@ main(void)
   pinit();         // process table
   tvinit();        // trap vectors
   binit();         // buffer cache
+  pcinit();        // page cache
+  shminit();       // shared memory segments
   fileinit();      // file table
   ideinit();       // disk 
   startothers();   // start other processors
@@ -12,11 +12,13 @@
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "iostat.h"
 
 extern uchar _binary_fs_img_start[], _binary_fs_img_size[];
 
 static int disksize;
 static uchar *memdisk;
+static struct iostat iostat;
 
 void
 ideinit(void)
@@ -54,7 +56,18 @@ iderw(struct buf *b)
   if(b->flags & B_DIRTY){
     b->flags &= ~B_DIRTY;
     memmove(p, b->data, BSIZE);
-  } else
+    iostat.nwrite++;
+  } else {
     memmove(b->data, p, BSIZE);
+    iostat.nread++;
+  }
   b->flags |= B_VALID;
 }
+
+// Copy the disk activity counters into *st.
+// A memory disk never seeks.
+void
+ideiostat(struct iostat *st)
+{
+  *st = iostat;
+}
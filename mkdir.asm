@@ -0,0 +1,2199 @@
+
+_mkdir:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	bf 01 00 00 00       	mov    $0x1,%edi
+  13:	56                   	push   %esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 08             	sub    $0x8,%esp
+  19:	8b 59 04             	mov    0x4(%ecx),%ebx
+  1c:	8b 31                	mov    (%ecx),%esi
+  1e:	83 c3 04             	add    $0x4,%ebx
+  int i;
+
+  if(argc < 2){
+  21:	83 fe 01             	cmp    $0x1,%esi
+  24:	7f 14                	jg     3a <main+0x3a>
+  26:	eb 3a                	jmp    62 <main+0x62>
+  28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+    printf(2, "Usage: mkdir files...\n");
+    exit();
+  }
+
+  for(i = 1; i < argc; i++){
+  30:	83 c7 01             	add    $0x1,%edi
+  33:	83 c3 04             	add    $0x4,%ebx
+  36:	39 fe                	cmp    %edi,%esi
+  38:	74 23                	je     5d <main+0x5d>
+    if(mkdir(argv[i]) < 0){
+  3a:	83 ec 0c             	sub    $0xc,%esp
+  3d:	ff 33                	push   (%ebx)
+  3f:	e8 84 05 00 00       	call   5c8 <mkdir>
+  44:	83 c4 10             	add    $0x10,%esp
+  47:	85 c0                	test   %eax,%eax
+  49:	79 e5                	jns    30 <main+0x30>
+      printf(2, "mkdir: %s failed to create\n", argv[i]);
+  4b:	50                   	push   %eax
+  4c:	ff 33                	push   (%ebx)
+  4e:	68 2f 0f 00 00       	push   $0xf2f
+  53:	6a 02                	push   $0x2
+  55:	e8 86 0a 00 00       	call   ae0 <printf>
+      break;
+  5a:	83 c4 10             	add    $0x10,%esp
+    }
+  }
+
+  exit();
+  5d:	e8 ee 02 00 00       	call   350 <exit>
+    printf(2, "Usage: mkdir files...\n");
+  62:	52                   	push   %edx
+  63:	52                   	push   %edx
+  64:	68 18 0f 00 00       	push   $0xf18
+  69:	6a 02                	push   $0x2
+  6b:	e8 70 0a 00 00       	call   ae0 <printf>
+    exit();
+  70:	e8 db 02 00 00       	call   350 <exit>
+  75:	66 90                	xchg   %ax,%ax
+  77:	66 90                	xchg   %ax,%ax
+  79:	66 90                	xchg   %ax,%ax
+  7b:	66 90                	xchg   %ax,%ax
+  7d:	66 90                	xchg   %ax,%ax
+  7f:	90                   	nop
+
+00000080 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  80:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  81:	31 c0                	xor    %eax,%eax
+{
+  83:	89 e5                	mov    %esp,%ebp
+  85:	53                   	push   %ebx
+  86:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  89:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  90:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  94:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  97:	83 c0 01             	add    $0x1,%eax
+  9a:	84 d2                	test   %dl,%dl
+  9c:	75 f2                	jne    90 <strcpy+0x10>
+    ;
+  return os;
+}
+  9e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  a1:	89 c8                	mov    %ecx,%eax
+  a3:	c9                   	leave
+  a4:	c3                   	ret
+  a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000b0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  b0:	55                   	push   %ebp
+  b1:	89 e5                	mov    %esp,%ebp
+  b3:	53                   	push   %ebx
+  b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  ba:	0f b6 02             	movzbl (%edx),%eax
+  bd:	84 c0                	test   %al,%al
+  bf:	75 17                	jne    d8 <strcmp+0x28>
+  c1:	eb 3a                	jmp    fd <strcmp+0x4d>
+  c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  c7:	90                   	nop
+  c8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  cc:	83 c2 01             	add    $0x1,%edx
+  cf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  d2:	84 c0                	test   %al,%al
+  d4:	74 1a                	je     f0 <strcmp+0x40>
+    p++, q++;
+  d6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  d8:	0f b6 19             	movzbl (%ecx),%ebx
+  db:	38 c3                	cmp    %al,%bl
+  dd:	74 e9                	je     c8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  df:	29 d8                	sub    %ebx,%eax
+}
+  e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  e4:	c9                   	leave
+  e5:	c3                   	ret
+  e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ed:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  f0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  f4:	31 c0                	xor    %eax,%eax
+  f6:	29 d8                	sub    %ebx,%eax
+}
+  f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  fb:	c9                   	leave
+  fc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  fd:	0f b6 19             	movzbl (%ecx),%ebx
+ 100:	31 c0                	xor    %eax,%eax
+ 102:	eb db                	jmp    df <strcmp+0x2f>
+ 104:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 10b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 10f:	90                   	nop
+
+00000110 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 110:	55                   	push   %ebp
+ 111:	89 e5                	mov    %esp,%ebp
+ 113:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 116:	80 3a 00             	cmpb   $0x0,(%edx)
+ 119:	74 15                	je     130 <strlen+0x20>
+ 11b:	31 c0                	xor    %eax,%eax
+ 11d:	8d 76 00             	lea    0x0(%esi),%esi
+ 120:	83 c0 01             	add    $0x1,%eax
+ 123:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 127:	89 c1                	mov    %eax,%ecx
+ 129:	75 f5                	jne    120 <strlen+0x10>
+    ;
+  return n;
+}
+ 12b:	89 c8                	mov    %ecx,%eax
+ 12d:	5d                   	pop    %ebp
+ 12e:	c3                   	ret
+ 12f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 130:	31 c9                	xor    %ecx,%ecx
+}
+ 132:	5d                   	pop    %ebp
+ 133:	89 c8                	mov    %ecx,%eax
+ 135:	c3                   	ret
+ 136:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000140 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	57                   	push   %edi
+ 144:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 147:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 14a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 14d:	89 d7                	mov    %edx,%edi
+ 14f:	fc                   	cld
+ 150:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 152:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 155:	89 d0                	mov    %edx,%eax
+ 157:	c9                   	leave
+ 158:	c3                   	ret
+ 159:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000160 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+ 160:	55                   	push   %ebp
+ 161:	89 e5                	mov    %esp,%ebp
+ 163:	56                   	push   %esi
+ 164:	53                   	push   %ebx
+ 165:	8b 75 10             	mov    0x10(%ebp),%esi
+ 168:	8b 55 08             	mov    0x8(%ebp),%edx
+ 16b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+ 16e:	85 f6                	test   %esi,%esi
+ 170:	74 2e                	je     1a0 <memcmp+0x40>
+ 172:	01 c6                	add    %eax,%esi
+ 174:	eb 14                	jmp    18a <memcmp+0x2a>
+ 176:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+ 180:	83 c0 01             	add    $0x1,%eax
+ 183:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+ 186:	39 f0                	cmp    %esi,%eax
+ 188:	74 16                	je     1a0 <memcmp+0x40>
+    if(*s1 != *s2)
+ 18a:	0f b6 0a             	movzbl (%edx),%ecx
+ 18d:	0f b6 18             	movzbl (%eax),%ebx
+ 190:	38 d9                	cmp    %bl,%cl
+ 192:	74 ec                	je     180 <memcmp+0x20>
+      return *s1 - *s2;
+ 194:	0f b6 c1             	movzbl %cl,%eax
+ 197:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+ 199:	5b                   	pop    %ebx
+ 19a:	5e                   	pop    %esi
+ 19b:	5d                   	pop    %ebp
+ 19c:	c3                   	ret
+ 19d:	8d 76 00             	lea    0x0(%esi),%esi
+ 1a0:	5b                   	pop    %ebx
+  return 0;
+ 1a1:	31 c0                	xor    %eax,%eax
+}
+ 1a3:	5e                   	pop    %esi
+ 1a4:	5d                   	pop    %ebp
+ 1a5:	c3                   	ret
+ 1a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001b0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1b6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1ba:	0f b6 10             	movzbl (%eax),%edx
+ 1bd:	84 d2                	test   %dl,%dl
+ 1bf:	75 12                	jne    1d3 <strchr+0x23>
+ 1c1:	eb 1d                	jmp    1e0 <strchr+0x30>
+ 1c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1c7:	90                   	nop
+ 1c8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 1cc:	83 c0 01             	add    $0x1,%eax
+ 1cf:	84 d2                	test   %dl,%dl
+ 1d1:	74 0d                	je     1e0 <strchr+0x30>
+    if(*s == c)
+ 1d3:	38 d1                	cmp    %dl,%cl
+ 1d5:	75 f1                	jne    1c8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 1d7:	5d                   	pop    %ebp
+ 1d8:	c3                   	ret
+ 1d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 1e0:	31 c0                	xor    %eax,%eax
+}
+ 1e2:	5d                   	pop    %ebp
+ 1e3:	c3                   	ret
+ 1e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1ef:	90                   	nop
+
+000001f0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	57                   	push   %edi
+ 1f4:	56                   	push   %esi
+int
+read(int fd, void *buf, int n)
+{
+  if(flushhook)
+    flushhook();
+  return _read(fd, buf, n);
+ 1f5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 1f8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 1f9:	31 db                	xor    %ebx,%ebx
+{
+ 1fb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 1fe:	eb 32                	jmp    232 <gets+0x42>
+  if(flushhook)
+ 200:	a1 10 22 00 00       	mov    0x2210,%eax
+ 205:	85 c0                	test   %eax,%eax
+ 207:	74 02                	je     20b <gets+0x1b>
+    flushhook();
+ 209:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+ 20b:	83 ec 04             	sub    $0x4,%esp
+ 20e:	6a 01                	push   $0x1
+ 210:	56                   	push   %esi
+ 211:	6a 00                	push   $0x0
+ 213:	e8 60 03 00 00       	call   578 <_read>
+    if(cc < 1)
+ 218:	83 c4 10             	add    $0x10,%esp
+ 21b:	85 c0                	test   %eax,%eax
+ 21d:	7e 1d                	jle    23c <gets+0x4c>
+    buf[i++] = c;
+ 21f:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 223:	8b 55 08             	mov    0x8(%ebp),%edx
+ 226:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 22a:	3c 0a                	cmp    $0xa,%al
+ 22c:	74 10                	je     23e <gets+0x4e>
+ 22e:	3c 0d                	cmp    $0xd,%al
+ 230:	74 0c                	je     23e <gets+0x4e>
+  for(i=0; i+1 < max; ){
+ 232:	89 df                	mov    %ebx,%edi
+ 234:	83 c3 01             	add    $0x1,%ebx
+ 237:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 23a:	7c c4                	jl     200 <gets+0x10>
+ 23c:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+ 23e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 241:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+ 245:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 248:	5b                   	pop    %ebx
+ 249:	5e                   	pop    %esi
+ 24a:	5f                   	pop    %edi
+ 24b:	5d                   	pop    %ebp
+ 24c:	c3                   	ret
+ 24d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000250 <stat>:
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	56                   	push   %esi
+ 254:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+ 255:	83 ec 08             	sub    $0x8,%esp
+ 258:	6a 00                	push   $0x0
+ 25a:	ff 75 08             	push   0x8(%ebp)
+ 25d:	e8 3e 03 00 00       	call   5a0 <open>
+  if(fd < 0)
+ 262:	83 c4 10             	add    $0x10,%esp
+ 265:	85 c0                	test   %eax,%eax
+ 267:	78 37                	js     2a0 <stat+0x50>
+  r = fstat(fd, st);
+ 269:	83 ec 08             	sub    $0x8,%esp
+ 26c:	ff 75 0c             	push   0xc(%ebp)
+ 26f:	89 c3                	mov    %eax,%ebx
+ 271:	50                   	push   %eax
+ 272:	e8 41 03 00 00       	call   5b8 <fstat>
+}
+
+int
+close(int fd)
+{
+  if(flushhook)
+ 277:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+ 27a:	89 c6                	mov    %eax,%esi
+  if(flushhook)
+ 27c:	a1 10 22 00 00       	mov    0x2210,%eax
+ 281:	85 c0                	test   %eax,%eax
+ 283:	74 02                	je     287 <stat+0x37>
+    flushhook();
+ 285:	ff d0                	call   *%eax
+  return _close(fd);
+ 287:	83 ec 0c             	sub    $0xc,%esp
+ 28a:	53                   	push   %ebx
+ 28b:	e8 f8 02 00 00       	call   588 <_close>
+ 290:	83 c4 10             	add    $0x10,%esp
+}
+ 293:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 296:	89 f0                	mov    %esi,%eax
+ 298:	5b                   	pop    %ebx
+ 299:	5e                   	pop    %esi
+ 29a:	5d                   	pop    %ebp
+ 29b:	c3                   	ret
+ 29c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+ 2a0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2a5:	eb ec                	jmp    293 <stat+0x43>
+ 2a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ae:	66 90                	xchg   %ax,%ax
+
+000002b0 <atoi>:
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	53                   	push   %ebx
+ 2b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+ 2b7:	0f be 02             	movsbl (%edx),%eax
+ 2ba:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 2bd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 2c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 2c5:	77 1e                	ja     2e5 <atoi+0x35>
+ 2c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ce:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 2d0:	83 c2 01             	add    $0x1,%edx
+ 2d3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 2d6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 2da:	0f be 02             	movsbl (%edx),%eax
+ 2dd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 2e0:	80 fb 09             	cmp    $0x9,%bl
+ 2e3:	76 eb                	jbe    2d0 <atoi+0x20>
+}
+ 2e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2e8:	89 c8                	mov    %ecx,%eax
+ 2ea:	c9                   	leave
+ 2eb:	c3                   	ret
+ 2ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002f0 <memmove>:
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	57                   	push   %edi
+ 2f4:	56                   	push   %esi
+ 2f5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2f8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2fb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+ 2fe:	85 c0                	test   %eax,%eax
+ 300:	7e 13                	jle    315 <memmove+0x25>
+ 302:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 304:	89 d7                	mov    %edx,%edi
+ 306:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 310:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 311:	39 f8                	cmp    %edi,%eax
+ 313:	75 fb                	jne    310 <memmove+0x20>
+}
+ 315:	5e                   	pop    %esi
+ 316:	89 d0                	mov    %edx,%eax
+ 318:	5f                   	pop    %edi
+ 319:	5d                   	pop    %ebp
+ 31a:	c3                   	ret
+ 31b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 31f:	90                   	nop
+
+00000320 <fork>:
+  if(flushhook)
+ 320:	a1 10 22 00 00       	mov    0x2210,%eax
+ 325:	85 c0                	test   %eax,%eax
+ 327:	74 17                	je     340 <fork+0x20>
+{
+ 329:	55                   	push   %ebp
+ 32a:	89 e5                	mov    %esp,%ebp
+ 32c:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+ 32f:	ff d0                	call   *%eax
+}
+ 331:	c9                   	leave
+  return _fork();
+ 332:	e9 21 02 00 00       	jmp    558 <_fork>
+ 337:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33e:	66 90                	xchg   %ax,%ax
+ 340:	e9 13 02 00 00       	jmp    558 <_fork>
+ 345:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000350 <exit>:
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+ 356:	a1 10 22 00 00       	mov    0x2210,%eax
+ 35b:	85 c0                	test   %eax,%eax
+ 35d:	74 02                	je     361 <exit+0x11>
+    flushhook();
+ 35f:	ff d0                	call   *%eax
+  _exit();
+ 361:	e8 fa 01 00 00       	call   560 <_exit>
+ 366:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000370 <exec>:
+{
+ 370:	55                   	push   %ebp
+  if(flushhook)
+ 371:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+ 376:	89 e5                	mov    %esp,%ebp
+ 378:	56                   	push   %esi
+ 379:	53                   	push   %ebx
+ 37a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 37d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+ 380:	85 c0                	test   %eax,%eax
+ 382:	74 02                	je     386 <exec+0x16>
+    flushhook();
+ 384:	ff d0                	call   *%eax
+  return _exec(path, argv);
+ 386:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 389:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 38c:	5b                   	pop    %ebx
+ 38d:	5e                   	pop    %esi
+ 38e:	5d                   	pop    %ebp
+  return _exec(path, argv);
+ 38f:	e9 04 02 00 00       	jmp    598 <_exec>
+ 394:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 39f:	90                   	nop
+
+000003a0 <read>:
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	57                   	push   %edi
+ 3a4:	56                   	push   %esi
+ 3a5:	53                   	push   %ebx
+ 3a6:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+ 3a9:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+ 3ae:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 3b1:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 3b4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+ 3b7:	85 c0                	test   %eax,%eax
+ 3b9:	74 02                	je     3bd <read+0x1d>
+    flushhook();
+ 3bb:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+ 3bd:	89 7d 10             	mov    %edi,0x10(%ebp)
+ 3c0:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 3c3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 3c6:	83 c4 0c             	add    $0xc,%esp
+ 3c9:	5b                   	pop    %ebx
+ 3ca:	5e                   	pop    %esi
+ 3cb:	5f                   	pop    %edi
+ 3cc:	5d                   	pop    %ebp
+  return _read(fd, buf, n);
+ 3cd:	e9 a6 01 00 00       	jmp    578 <_read>
+ 3d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003e0 <readv>:
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	57                   	push   %edi
+ 3e4:	56                   	push   %esi
+ 3e5:	53                   	push   %ebx
+ 3e6:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+ 3e9:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+ 3ee:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 3f1:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 3f4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+ 3f7:	85 c0                	test   %eax,%eax
+ 3f9:	74 02                	je     3fd <readv+0x1d>
+    flushhook();
+ 3fb:	ff d0                	call   *%eax
+  return _readv(fd, iov, cnt);
+ 3fd:	89 7d 10             	mov    %edi,0x10(%ebp)
+ 400:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 403:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 406:	83 c4 0c             	add    $0xc,%esp
+ 409:	5b                   	pop    %ebx
+ 40a:	5e                   	pop    %esi
+ 40b:	5f                   	pop    %edi
+ 40c:	5d                   	pop    %ebp
+  return _readv(fd, iov, cnt);
+ 40d:	e9 76 02 00 00       	jmp    688 <_readv>
+ 412:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 419:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000420 <write>:
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	57                   	push   %edi
+ 424:	56                   	push   %esi
+ 425:	53                   	push   %ebx
+ 426:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+ 429:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+ 42e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 431:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 434:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+ 437:	85 c0                	test   %eax,%eax
+ 439:	74 02                	je     43d <write+0x1d>
+    flushhook();
+ 43b:	ff d0                	call   *%eax
+  return _write(fd, buf, n);
+ 43d:	89 7d 10             	mov    %edi,0x10(%ebp)
+ 440:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 443:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 446:	83 c4 0c             	add    $0xc,%esp
+ 449:	5b                   	pop    %ebx
+ 44a:	5e                   	pop    %esi
+ 44b:	5f                   	pop    %edi
+ 44c:	5d                   	pop    %ebp
+  return _write(fd, buf, n);
+ 44d:	e9 2e 01 00 00       	jmp    580 <_write>
+ 452:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 459:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000460 <writev>:
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	57                   	push   %edi
+ 464:	56                   	push   %esi
+ 465:	53                   	push   %ebx
+ 466:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+ 469:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+ 46e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 471:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 474:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+ 477:	85 c0                	test   %eax,%eax
+ 479:	74 02                	je     47d <writev+0x1d>
+    flushhook();
+ 47b:	ff d0                	call   *%eax
+  return _writev(fd, iov, cnt);
+ 47d:	89 7d 10             	mov    %edi,0x10(%ebp)
+ 480:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 483:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 486:	83 c4 0c             	add    $0xc,%esp
+ 489:	5b                   	pop    %ebx
+ 48a:	5e                   	pop    %esi
+ 48b:	5f                   	pop    %edi
+ 48c:	5d                   	pop    %ebp
+  return _writev(fd, iov, cnt);
+ 48d:	e9 fe 01 00 00       	jmp    690 <_writev>
+ 492:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 499:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004a0 <close>:
+{
+ 4a0:	55                   	push   %ebp
+ 4a1:	89 e5                	mov    %esp,%ebp
+ 4a3:	53                   	push   %ebx
+ 4a4:	83 ec 04             	sub    $0x4,%esp
+  if(flushhook)
+ 4a7:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+ 4ac:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(flushhook)
+ 4af:	85 c0                	test   %eax,%eax
+ 4b1:	74 02                	je     4b5 <close+0x15>
+    flushhook();
+ 4b3:	ff d0                	call   *%eax
+  return _close(fd);
+ 4b5:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 4b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4bb:	c9                   	leave
+  return _close(fd);
+ 4bc:	e9 c7 00 00 00       	jmp    588 <_close>
+ 4c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4cf:	90                   	nop
+
+000004d0 <umtxinit>:
+// process that finds the mutex held enters the kernel, to sleep
+// in futexwait() until the holder's umtxunlock() wakes it.
+
+void
+umtxinit(struct umutex *m)
+{
+ 4d0:	55                   	push   %ebp
+ 4d1:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 4d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4d6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 4dc:	5d                   	pop    %ebp
+ 4dd:	c3                   	ret
+ 4de:	66 90                	xchg   %ax,%ax
+
+000004e0 <umtxlock>:
+
+void
+umtxlock(struct umutex *m)
+{
+ 4e0:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 4e1:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4e6:	89 e5                	mov    %esp,%ebp
+ 4e8:	56                   	push   %esi
+ 4e9:	53                   	push   %ebx
+ 4ea:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 4ed:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 1) == 0)
+ 4f0:	85 c0                	test   %eax,%eax
+ 4f2:	74 2b                	je     51f <umtxlock+0x3f>
+ 4f4:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4f9:	f0 87 03             	lock xchg %eax,(%ebx)
+    return;
+  // Mark the mutex contended, so that its holder
+  // wakes a waiter on release, and wait.
+  while(xchg(&m->state, 2) != 0)
+ 4fc:	85 c0                	test   %eax,%eax
+ 4fe:	74 1f                	je     51f <umtxlock+0x3f>
+ 500:	be 02 00 00 00       	mov    $0x2,%esi
+ 505:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwait(&m->state, 2);
+ 508:	83 ec 08             	sub    $0x8,%esp
+ 50b:	6a 02                	push   $0x2
+ 50d:	53                   	push   %ebx
+ 50e:	e8 85 01 00 00       	call   698 <futexwait>
+ 513:	89 f0                	mov    %esi,%eax
+ 515:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+ 518:	83 c4 10             	add    $0x10,%esp
+ 51b:	85 c0                	test   %eax,%eax
+ 51d:	75 e9                	jne    508 <umtxlock+0x28>
+}
+ 51f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 522:	5b                   	pop    %ebx
+ 523:	5e                   	pop    %esi
+ 524:	5d                   	pop    %ebp
+ 525:	c3                   	ret
+ 526:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 52d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000530 <umtxunlock>:
+
+void
+umtxunlock(struct umutex *m)
+{
+ 530:	55                   	push   %ebp
+ 531:	31 c0                	xor    %eax,%eax
+ 533:	89 e5                	mov    %esp,%ebp
+ 535:	83 ec 08             	sub    $0x8,%esp
+ 538:	8b 55 08             	mov    0x8(%ebp),%edx
+ 53b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 53e:	83 f8 02             	cmp    $0x2,%eax
+ 541:	74 05                	je     548 <umtxunlock+0x18>
+    futexwake(&m->state, 1);
+}
+ 543:	c9                   	leave
+ 544:	c3                   	ret
+ 545:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwake(&m->state, 1);
+ 548:	83 ec 08             	sub    $0x8,%esp
+ 54b:	6a 01                	push   $0x1
+ 54d:	52                   	push   %edx
+ 54e:	e8 4d 01 00 00       	call   6a0 <futexwake>
+ 553:	83 c4 10             	add    $0x10,%esp
+}
+ 556:	c9                   	leave
+ 557:	c3                   	ret
+
+00000558 <_fork>:
+  _ ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+ 558:	b8 01 00 00 00       	mov    $0x1,%eax
+ 55d:	cd 40                	int    $0x40
+ 55f:	c3                   	ret
+
+00000560 <_exit>:
+RAWSYSCALL(exit)
+ 560:	b8 02 00 00 00       	mov    $0x2,%eax
+ 565:	cd 40                	int    $0x40
+ 567:	c3                   	ret
+
+00000568 <wait>:
+SYSCALL(wait)
+ 568:	b8 03 00 00 00       	mov    $0x3,%eax
+ 56d:	cd 40                	int    $0x40
+ 56f:	c3                   	ret
+
+00000570 <pipe>:
+SYSCALL(pipe)
+ 570:	b8 04 00 00 00       	mov    $0x4,%eax
+ 575:	cd 40                	int    $0x40
+ 577:	c3                   	ret
+
+00000578 <_read>:
+RAWSYSCALL(read)
+ 578:	b8 05 00 00 00       	mov    $0x5,%eax
+ 57d:	cd 40                	int    $0x40
+ 57f:	c3                   	ret
+
+00000580 <_write>:
+RAWSYSCALL(write)
+ 580:	b8 10 00 00 00       	mov    $0x10,%eax
+ 585:	cd 40                	int    $0x40
+ 587:	c3                   	ret
+
+00000588 <_close>:
+RAWSYSCALL(close)
+ 588:	b8 15 00 00 00       	mov    $0x15,%eax
+ 58d:	cd 40                	int    $0x40
+ 58f:	c3                   	ret
+
+00000590 <kill>:
+SYSCALL(kill)
+ 590:	b8 06 00 00 00       	mov    $0x6,%eax
+ 595:	cd 40                	int    $0x40
+ 597:	c3                   	ret
+
+00000598 <_exec>:
+RAWSYSCALL(exec)
+ 598:	b8 07 00 00 00       	mov    $0x7,%eax
+ 59d:	cd 40                	int    $0x40
+ 59f:	c3                   	ret
+
+000005a0 <open>:
+SYSCALL(open)
+ 5a0:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 5a5:	cd 40                	int    $0x40
+ 5a7:	c3                   	ret
+
+000005a8 <mknod>:
+SYSCALL(mknod)
+ 5a8:	b8 11 00 00 00       	mov    $0x11,%eax
+ 5ad:	cd 40                	int    $0x40
+ 5af:	c3                   	ret
+
+000005b0 <unlink>:
+SYSCALL(unlink)
+ 5b0:	b8 12 00 00 00       	mov    $0x12,%eax
+ 5b5:	cd 40                	int    $0x40
+ 5b7:	c3                   	ret
+
+000005b8 <fstat>:
+SYSCALL(fstat)
+ 5b8:	b8 08 00 00 00       	mov    $0x8,%eax
+ 5bd:	cd 40                	int    $0x40
+ 5bf:	c3                   	ret
+
+000005c0 <link>:
+SYSCALL(link)
+ 5c0:	b8 13 00 00 00       	mov    $0x13,%eax
+ 5c5:	cd 40                	int    $0x40
+ 5c7:	c3                   	ret
+
+000005c8 <mkdir>:
+SYSCALL(mkdir)
+ 5c8:	b8 14 00 00 00       	mov    $0x14,%eax
+ 5cd:	cd 40                	int    $0x40
+ 5cf:	c3                   	ret
+
+000005d0 <chdir>:
+SYSCALL(chdir)
+ 5d0:	b8 09 00 00 00       	mov    $0x9,%eax
+ 5d5:	cd 40                	int    $0x40
+ 5d7:	c3                   	ret
+
+000005d8 <dup>:
+SYSCALL(dup)
+ 5d8:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 5dd:	cd 40                	int    $0x40
+ 5df:	c3                   	ret
+
+000005e0 <getpid>:
+SYSCALL(getpid)
+ 5e0:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 5e5:	cd 40                	int    $0x40
+ 5e7:	c3                   	ret
+
+000005e8 <sbrk>:
+SYSCALL(sbrk)
+ 5e8:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 5ed:	cd 40                	int    $0x40
+ 5ef:	c3                   	ret
+
+000005f0 <sleep>:
+SYSCALL(sleep)
+ 5f0:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 5f5:	cd 40                	int    $0x40
+ 5f7:	c3                   	ret
+
+000005f8 <uptime>:
+SYSCALL(uptime)
+ 5f8:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 5fd:	cd 40                	int    $0x40
+ 5ff:	c3                   	ret
+
+00000600 <wolfie>:
+SYSCALL(wolfie)
+ 600:	b8 16 00 00 00       	mov    $0x16,%eax
+ 605:	cd 40                	int    $0x40
+ 607:	c3                   	ret
+
+00000608 <nice>:
+SYSCALL(nice)
+ 608:	b8 17 00 00 00       	mov    $0x17,%eax
+ 60d:	cd 40                	int    $0x40
+ 60f:	c3                   	ret
+
+00000610 <mtxget>:
+SYSCALL(mtxget)
+ 610:	b8 18 00 00 00       	mov    $0x18,%eax
+ 615:	cd 40                	int    $0x40
+ 617:	c3                   	ret
+
+00000618 <mtxrel>:
+SYSCALL(mtxrel)
+ 618:	b8 19 00 00 00       	mov    $0x19,%eax
+ 61d:	cd 40                	int    $0x40
+ 61f:	c3                   	ret
+
+00000620 <mtxacq>:
+SYSCALL(mtxacq)
+ 620:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 625:	cd 40                	int    $0x40
+ 627:	c3                   	ret
+
+00000628 <mtxdel>:
+SYSCALL(mtxdel)
+ 628:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 62d:	cd 40                	int    $0x40
+ 62f:	c3                   	ret
+
+00000630 <iostat>:
+SYSCALL(iostat)
+ 630:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 635:	cd 40                	int    $0x40
+ 637:	c3                   	ret
+
+00000638 <mmap>:
+SYSCALL(mmap)
+ 638:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 63d:	cd 40                	int    $0x40
+ 63f:	c3                   	ret
+
+00000640 <munmap>:
+SYSCALL(munmap)
+ 640:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 645:	cd 40                	int    $0x40
+ 647:	c3                   	ret
+
+00000648 <shmget>:
+SYSCALL(shmget)
+ 648:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 64d:	cd 40                	int    $0x40
+ 64f:	c3                   	ret
+
+00000650 <shmat>:
+SYSCALL(shmat)
+ 650:	b8 20 00 00 00       	mov    $0x20,%eax
+ 655:	cd 40                	int    $0x40
+ 657:	c3                   	ret
+
+00000658 <shmdt>:
+SYSCALL(shmdt)
+ 658:	b8 21 00 00 00       	mov    $0x21,%eax
+ 65d:	cd 40                	int    $0x40
+ 65f:	c3                   	ret
+
+00000660 <shmdel>:
+SYSCALL(shmdel)
+ 660:	b8 22 00 00 00       	mov    $0x22,%eax
+ 665:	cd 40                	int    $0x40
+ 667:	c3                   	ret
+
+00000668 <syscount>:
+SYSCALL(syscount)
+ 668:	b8 23 00 00 00       	mov    $0x23,%eax
+ 66d:	cd 40                	int    $0x40
+ 66f:	c3                   	ret
+
+00000670 <splice>:
+SYSCALL(splice)
+ 670:	b8 24 00 00 00       	mov    $0x24,%eax
+ 675:	cd 40                	int    $0x40
+ 677:	c3                   	ret
+
+00000678 <tee>:
+SYSCALL(tee)
+ 678:	b8 25 00 00 00       	mov    $0x25,%eax
+ 67d:	cd 40                	int    $0x40
+ 67f:	c3                   	ret
+
+00000680 <sendfile>:
+SYSCALL(sendfile)
+ 680:	b8 26 00 00 00       	mov    $0x26,%eax
+ 685:	cd 40                	int    $0x40
+ 687:	c3                   	ret
+
+00000688 <_readv>:
+RAWSYSCALL(readv)
+ 688:	b8 27 00 00 00       	mov    $0x27,%eax
+ 68d:	cd 40                	int    $0x40
+ 68f:	c3                   	ret
+
+00000690 <_writev>:
+RAWSYSCALL(writev)
+ 690:	b8 28 00 00 00       	mov    $0x28,%eax
+ 695:	cd 40                	int    $0x40
+ 697:	c3                   	ret
+
+00000698 <futexwait>:
+SYSCALL(futexwait)
+ 698:	b8 29 00 00 00       	mov    $0x29,%eax
+ 69d:	cd 40                	int    $0x40
+ 69f:	c3                   	ret
+
+000006a0 <futexwake>:
+SYSCALL(futexwake)
+ 6a0:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 6a5:	cd 40                	int    $0x40
+ 6a7:	c3                   	ret
+
+000006a8 <lockstat>:
+SYSCALL(lockstat)
+ 6a8:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 6ad:	cd 40                	int    $0x40
+ 6af:	c3                   	ret
+
+000006b0 <clone>:
+SYSCALL(clone)
+ 6b0:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 6b5:	cd 40                	int    $0x40
+ 6b7:	c3                   	ret
+
+000006b8 <join>:
+SYSCALL(join)
+ 6b8:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 6bd:	cd 40                	int    $0x40
+ 6bf:	c3                   	ret
+
+000006c0 <stacklimit>:
+SYSCALL(stacklimit)
+ 6c0:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 6c5:	cd 40                	int    $0x40
+ 6c7:	c3                   	ret
+ 6c8:	66 90                	xchg   %ax,%ax
+ 6ca:	66 90                	xchg   %ax,%ax
+ 6cc:	66 90                	xchg   %ax,%ax
+ 6ce:	66 90                	xchg   %ax,%ax
+
+000006d0 <flushall>:
+  b->n = 0;
+}
+
+static void
+flushall(void)
+{
+ 6d0:	55                   	push   %ebp
+ 6d1:	89 e5                	mov    %esp,%ebp
+ 6d3:	83 ec 14             	sub    $0x14,%esp
+  umtxlock(&stdoutlock);
+ 6d6:	68 14 22 00 00       	push   $0x2214
+ 6db:	e8 00 fe ff ff       	call   4e0 <umtxlock>
+  if(b->n > 0)
+ 6e0:	a1 08 20 00 00       	mov    0x2008,%eax
+ 6e5:	83 c4 10             	add    $0x10,%esp
+ 6e8:	85 c0                	test   %eax,%eax
+ 6ea:	7e 17                	jle    703 <flushall+0x33>
+    _write(b->fd, b->buf, b->n);
+ 6ec:	83 ec 04             	sub    $0x4,%esp
+ 6ef:	50                   	push   %eax
+ 6f0:	68 0c 20 00 00       	push   $0x200c
+ 6f5:	ff 35 00 20 00 00    	push   0x2000
+ 6fb:	e8 80 fe ff ff       	call   580 <_write>
+ 700:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+ 703:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+ 70a:	00 00 00 
+  flush(&stdout);
+  umtxunlock(&stdoutlock);
+ 70d:	83 ec 0c             	sub    $0xc,%esp
+ 710:	68 14 22 00 00       	push   $0x2214
+ 715:	e8 16 fe ff ff       	call   530 <umtxunlock>
+}
+ 71a:	83 c4 10             	add    $0x10,%esp
+ 71d:	c9                   	leave
+ 71e:	c3                   	ret
+ 71f:	90                   	nop
+
+00000720 <printint>:
+    flush(b);
+}
+
+static void
+printint(struct outbuf *b, int xx, int base, int sgn)
+{
+ 720:	55                   	push   %ebp
+ 721:	89 e5                	mov    %esp,%ebp
+ 723:	57                   	push   %edi
+ 724:	89 cf                	mov    %ecx,%edi
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 726:	89 d1                	mov    %edx,%ecx
+{
+ 728:	56                   	push   %esi
+ 729:	53                   	push   %ebx
+ 72a:	89 c3                	mov    %eax,%ebx
+ 72c:	83 ec 2c             	sub    $0x2c,%esp
+  if(sgn && xx < 0){
+ 72f:	85 d2                	test   %edx,%edx
+ 731:	0f 89 b9 00 00 00    	jns    7f0 <printint+0xd0>
+ 737:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 73b:	0f 84 af 00 00 00    	je     7f0 <printint+0xd0>
+    x = -xx;
+ 741:	f7 d9                	neg    %ecx
+    neg = 1;
+ 743:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 748:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 74b:	31 f6                	xor    %esi,%esi
+ 74d:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 750:	89 c8                	mov    %ecx,%eax
+ 752:	31 d2                	xor    %edx,%edx
+ 754:	89 f3                	mov    %esi,%ebx
+ 756:	f7 f7                	div    %edi
+ 758:	8d 76 01             	lea    0x1(%esi),%esi
+ 75b:	0f b6 92 5c 13 00 00 	movzbl 0x135c(%edx),%edx
+ 762:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 766:	89 ca                	mov    %ecx,%edx
+ 768:	89 c1                	mov    %eax,%ecx
+ 76a:	39 fa                	cmp    %edi,%edx
+ 76c:	73 e2                	jae    750 <printint+0x30>
+  if(neg)
+ 76e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 771:	89 d9                	mov    %ebx,%ecx
+ 773:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 776:	85 c0                	test   %eax,%eax
+ 778:	74 07                	je     781 <printint+0x61>
+    buf[i++] = '-';
+ 77a:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 77f:	89 f1                	mov    %esi,%ecx
+ 781:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 784:	89 cf                	mov    %ecx,%edi
+ 786:	01 f7                	add    %esi,%edi
+ 788:	eb 1a                	jmp    7a4 <printint+0x84>
+ 78a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    *b->str++ = c;
+ 790:	8d 48 01             	lea    0x1(%eax),%ecx
+ 793:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+ 799:	88 10                	mov    %dl,(%eax)
+
+  while(--i >= 0)
+ 79b:	8d 47 ff             	lea    -0x1(%edi),%eax
+ 79e:	39 fe                	cmp    %edi,%esi
+ 7a0:	74 40                	je     7e2 <printint+0xc2>
+ 7a2:	89 c7                	mov    %eax,%edi
+  if(b->str){
+ 7a4:	8b 83 0c 02 00 00    	mov    0x20c(%ebx),%eax
+    putc(b, buf[i]);
+ 7aa:	0f b6 17             	movzbl (%edi),%edx
+  if(b->str){
+ 7ad:	85 c0                	test   %eax,%eax
+ 7af:	75 df                	jne    790 <printint+0x70>
+  b->buf[b->n++] = c;
+ 7b1:	8b 4b 08             	mov    0x8(%ebx),%ecx
+ 7b4:	8d 41 01             	lea    0x1(%ecx),%eax
+ 7b7:	89 43 08             	mov    %eax,0x8(%ebx)
+ 7ba:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+ 7be:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 7c3:	74 3b                	je     800 <printint+0xe0>
+ 7c5:	80 fa 0a             	cmp    $0xa,%dl
+ 7c8:	75 d1                	jne    79b <printint+0x7b>
+ 7ca:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+ 7ce:	75 cb                	jne    79b <printint+0x7b>
+  if(b->n > 0)
+ 7d0:	85 c0                	test   %eax,%eax
+ 7d2:	7f 2c                	jg     800 <printint+0xe0>
+  b->n = 0;
+ 7d4:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  while(--i >= 0)
+ 7db:	8d 47 ff             	lea    -0x1(%edi),%eax
+ 7de:	39 fe                	cmp    %edi,%esi
+ 7e0:	75 c0                	jne    7a2 <printint+0x82>
+}
+ 7e2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7e5:	5b                   	pop    %ebx
+ 7e6:	5e                   	pop    %esi
+ 7e7:	5f                   	pop    %edi
+ 7e8:	5d                   	pop    %ebp
+ 7e9:	c3                   	ret
+ 7ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  neg = 0;
+ 7f0:	31 c0                	xor    %eax,%eax
+ 7f2:	e9 51 ff ff ff       	jmp    748 <printint+0x28>
+ 7f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7fe:	66 90                	xchg   %ax,%ax
+    _write(b->fd, b->buf, b->n);
+ 800:	83 ec 04             	sub    $0x4,%esp
+ 803:	50                   	push   %eax
+ 804:	8d 43 0c             	lea    0xc(%ebx),%eax
+ 807:	50                   	push   %eax
+ 808:	ff 33                	push   (%ebx)
+ 80a:	e8 71 fd ff ff       	call   580 <_write>
+ 80f:	83 c4 10             	add    $0x10,%esp
+ 812:	eb c0                	jmp    7d4 <printint+0xb4>
+ 814:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 81b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 81f:	90                   	nop
+
+00000820 <putc>:
+{
+ 820:	55                   	push   %ebp
+ 821:	89 e5                	mov    %esp,%ebp
+ 823:	53                   	push   %ebx
+ 824:	89 c3                	mov    %eax,%ebx
+ 826:	83 ec 04             	sub    $0x4,%esp
+  if(b->str){
+ 829:	8b 80 0c 02 00 00    	mov    0x20c(%eax),%eax
+ 82f:	85 c0                	test   %eax,%eax
+ 831:	74 15                	je     848 <putc+0x28>
+    *b->str++ = c;
+ 833:	8d 48 01             	lea    0x1(%eax),%ecx
+ 836:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+ 83c:	88 10                	mov    %dl,(%eax)
+}
+ 83e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 841:	c9                   	leave
+ 842:	c3                   	ret
+ 843:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 847:	90                   	nop
+  b->buf[b->n++] = c;
+ 848:	8b 4b 08             	mov    0x8(%ebx),%ecx
+ 84b:	8d 41 01             	lea    0x1(%ecx),%eax
+ 84e:	89 43 08             	mov    %eax,0x8(%ebx)
+ 851:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+ 855:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 85a:	74 14                	je     870 <putc+0x50>
+ 85c:	80 fa 0a             	cmp    $0xa,%dl
+ 85f:	75 dd                	jne    83e <putc+0x1e>
+ 861:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+ 865:	75 d7                	jne    83e <putc+0x1e>
+  if(b->n > 0)
+ 867:	85 c0                	test   %eax,%eax
+ 869:	7e 17                	jle    882 <putc+0x62>
+ 86b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 86f:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+ 870:	83 ec 04             	sub    $0x4,%esp
+ 873:	50                   	push   %eax
+ 874:	8d 43 0c             	lea    0xc(%ebx),%eax
+ 877:	50                   	push   %eax
+ 878:	ff 33                	push   (%ebx)
+ 87a:	e8 01 fd ff ff       	call   580 <_write>
+ 87f:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+ 882:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+ 889:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 88c:	c9                   	leave
+ 88d:	c3                   	ret
+ 88e:	66 90                	xchg   %ax,%ax
+
+00000890 <format>:
+
+// Format fmt and the arguments at ap into b.
+// Only understands %d, %x, %p, %s, %c.
+static void
+format(struct outbuf *b, const char *fmt, uint *ap)
+{
+ 890:	55                   	push   %ebp
+ 891:	89 e5                	mov    %esp,%ebp
+ 893:	57                   	push   %edi
+ 894:	89 c7                	mov    %eax,%edi
+ 896:	56                   	push   %esi
+ 897:	53                   	push   %ebx
+ 898:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+ 89b:	0f b6 02             	movzbl (%edx),%eax
+{
+ 89e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 8a1:	84 c0                	test   %al,%al
+ 8a3:	74 5a                	je     8ff <format+0x6f>
+ 8a5:	8d 5a 01             	lea    0x1(%edx),%ebx
+ 8a8:	31 f6                	xor    %esi,%esi
+ 8aa:	eb 1c                	jmp    8c8 <format+0x38>
+ 8ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+ 8b0:	83 f8 25             	cmp    $0x25,%eax
+ 8b3:	74 3b                	je     8f0 <format+0x60>
+        state = '%';
+      } else {
+        putc(b, c);
+ 8b5:	89 ca                	mov    %ecx,%edx
+ 8b7:	89 f8                	mov    %edi,%eax
+ 8b9:	e8 62 ff ff ff       	call   820 <putc>
+  for(i = 0; fmt[i]; i++){
+ 8be:	0f b6 03             	movzbl (%ebx),%eax
+ 8c1:	83 c3 01             	add    $0x1,%ebx
+ 8c4:	84 c0                	test   %al,%al
+ 8c6:	74 37                	je     8ff <format+0x6f>
+    c = fmt[i] & 0xff;
+ 8c8:	0f be c8             	movsbl %al,%ecx
+ 8cb:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 8ce:	85 f6                	test   %esi,%esi
+ 8d0:	74 de                	je     8b0 <format+0x20>
+      }
+    } else if(state == '%'){
+ 8d2:	83 fe 25             	cmp    $0x25,%esi
+ 8d5:	75 e7                	jne    8be <format+0x2e>
+      if(c == 'd'){
+ 8d7:	83 f8 25             	cmp    $0x25,%eax
+ 8da:	74 46                	je     922 <format+0x92>
+ 8dc:	83 e8 63             	sub    $0x63,%eax
+ 8df:	83 f8 15             	cmp    $0x15,%eax
+ 8e2:	77 2c                	ja     910 <format+0x80>
+ 8e4:	ff 24 85 04 13 00 00 	jmp    *0x1304(,%eax,4)
+ 8eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8ef:	90                   	nop
+  for(i = 0; fmt[i]; i++){
+ 8f0:	0f b6 03             	movzbl (%ebx),%eax
+ 8f3:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+ 8f6:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+ 8fb:	84 c0                	test   %al,%al
+ 8fd:	75 c9                	jne    8c8 <format+0x38>
+        putc(b, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 8ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 902:	5b                   	pop    %ebx
+ 903:	5e                   	pop    %esi
+ 904:	5f                   	pop    %edi
+ 905:	5d                   	pop    %ebp
+ 906:	c3                   	ret
+ 907:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 90e:	66 90                	xchg   %ax,%ax
+        putc(b, '%');
+ 910:	ba 25 00 00 00       	mov    $0x25,%edx
+ 915:	89 f8                	mov    %edi,%eax
+ 917:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+ 91a:	e8 01 ff ff ff       	call   820 <putc>
+        putc(b, c);
+ 91f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ 922:	89 ca                	mov    %ecx,%edx
+ 924:	89 f8                	mov    %edi,%eax
+      state = 0;
+ 926:	31 f6                	xor    %esi,%esi
+        putc(b, c);
+ 928:	e8 f3 fe ff ff       	call   820 <putc>
+ 92d:	eb 8f                	jmp    8be <format+0x2e>
+ 92f:	90                   	nop
+        printint(b, *ap, 16, 0);
+ 930:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+ 933:	83 ec 0c             	sub    $0xc,%esp
+ 936:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 93b:	8b 16                	mov    (%esi),%edx
+ 93d:	6a 00                	push   $0x0
+        ap++;
+ 93f:	83 c6 04             	add    $0x4,%esi
+        printint(b, *ap, 16, 0);
+ 942:	89 f8                	mov    %edi,%eax
+ 944:	e8 d7 fd ff ff       	call   720 <printint>
+        ap++;
+ 949:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+ 94c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 94f:	31 f6                	xor    %esi,%esi
+ 951:	e9 68 ff ff ff       	jmp    8be <format+0x2e>
+ 956:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 95d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 960:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 963:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 965:	83 c0 04             	add    $0x4,%eax
+ 968:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 96b:	85 f6                	test   %esi,%esi
+ 96d:	75 1b                	jne    98a <format+0xfa>
+ 96f:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+ 974:	be fc 12 00 00       	mov    $0x12fc,%esi
+ 979:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+          putc(b, *s);
+ 980:	89 f8                	mov    %edi,%eax
+          s++;
+ 982:	83 c6 01             	add    $0x1,%esi
+          putc(b, *s);
+ 985:	e8 96 fe ff ff       	call   820 <putc>
+        while(*s != 0){
+ 98a:	0f be 16             	movsbl (%esi),%edx
+ 98d:	84 d2                	test   %dl,%dl
+ 98f:	75 ef                	jne    980 <format+0xf0>
+      state = 0;
+ 991:	31 f6                	xor    %esi,%esi
+ 993:	e9 26 ff ff ff       	jmp    8be <format+0x2e>
+ 998:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 99f:	90                   	nop
+        printint(b, *ap, 10, 1);
+ 9a0:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+ 9a3:	83 ec 0c             	sub    $0xc,%esp
+ 9a6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 9ab:	8b 16                	mov    (%esi),%edx
+ 9ad:	6a 01                	push   $0x1
+ 9af:	eb 8e                	jmp    93f <format+0xaf>
+ 9b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(b, *ap);
+ 9b8:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+ 9bb:	89 f8                	mov    %edi,%eax
+ 9bd:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+ 9c0:	83 c6 04             	add    $0x4,%esi
+        putc(b, *ap);
+ 9c3:	e8 58 fe ff ff       	call   820 <putc>
+        ap++;
+ 9c8:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      state = 0;
+ 9cb:	31 f6                	xor    %esi,%esi
+ 9cd:	e9 ec fe ff ff       	jmp    8be <format+0x2e>
+ 9d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000009e0 <fflush>:
+{
+ 9e0:	55                   	push   %ebp
+ 9e1:	89 e5                	mov    %esp,%ebp
+ 9e3:	83 ec 08             	sub    $0x8,%esp
+  if(fd == stdout.fd)
+ 9e6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9e9:	39 05 00 20 00 00    	cmp    %eax,0x2000
+ 9ef:	74 07                	je     9f8 <fflush+0x18>
+}
+ 9f1:	c9                   	leave
+ 9f2:	c3                   	ret
+ 9f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9f7:	90                   	nop
+  umtxlock(&stdoutlock);
+ 9f8:	83 ec 0c             	sub    $0xc,%esp
+ 9fb:	68 14 22 00 00       	push   $0x2214
+ a00:	e8 db fa ff ff       	call   4e0 <umtxlock>
+  if(b->n > 0)
+ a05:	a1 08 20 00 00       	mov    0x2008,%eax
+ a0a:	83 c4 10             	add    $0x10,%esp
+ a0d:	85 c0                	test   %eax,%eax
+ a0f:	7f 1f                	jg     a30 <fflush+0x50>
+  b->n = 0;
+ a11:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+ a18:	00 00 00 
+  umtxunlock(&stdoutlock);
+ a1b:	c7 45 08 14 22 00 00 	movl   $0x2214,0x8(%ebp)
+}
+ a22:	c9                   	leave
+  umtxunlock(&stdoutlock);
+ a23:	e9 08 fb ff ff       	jmp    530 <umtxunlock>
+ a28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a2f:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+ a30:	83 ec 04             	sub    $0x4,%esp
+ a33:	50                   	push   %eax
+ a34:	68 0c 20 00 00       	push   $0x200c
+ a39:	ff 35 00 20 00 00    	push   0x2000
+ a3f:	e8 3c fb ff ff       	call   580 <_write>
+ a44:	83 c4 10             	add    $0x10,%esp
+ a47:	eb c8                	jmp    a11 <fflush+0x31>
+ a49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000a50 <setvbuf>:
+{
+ a50:	55                   	push   %ebp
+ a51:	89 e5                	mov    %esp,%ebp
+ a53:	53                   	push   %ebx
+ a54:	83 ec 04             	sub    $0x4,%esp
+ a57:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd != stdout.fd)
+ a5a:	8b 45 08             	mov    0x8(%ebp),%eax
+ a5d:	39 05 00 20 00 00    	cmp    %eax,0x2000
+ a63:	74 0b                	je     a70 <setvbuf+0x20>
+}
+ a65:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ a68:	c9                   	leave
+ a69:	c3                   	ret
+ a6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  umtxlock(&stdoutlock);
+ a70:	83 ec 0c             	sub    $0xc,%esp
+ a73:	68 14 22 00 00       	push   $0x2214
+ a78:	e8 63 fa ff ff       	call   4e0 <umtxlock>
+  if(b->n > 0)
+ a7d:	a1 08 20 00 00       	mov    0x2008,%eax
+ a82:	83 c4 10             	add    $0x10,%esp
+ a85:	85 c0                	test   %eax,%eax
+ a87:	7f 2f                	jg     ab8 <setvbuf+0x68>
+  b->n = 0;
+ a89:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+ a90:	00 00 00 
+  stdout.mode = mode;
+ a93:	89 1d 04 20 00 00    	mov    %ebx,0x2004
+  flushhook = flushall;
+ a99:	c7 05 10 22 00 00 d0 	movl   $0x6d0,0x2210
+ aa0:	06 00 00 
+}
+ aa3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&stdoutlock);
+ aa6:	c7 45 08 14 22 00 00 	movl   $0x2214,0x8(%ebp)
+}
+ aad:	c9                   	leave
+  umtxunlock(&stdoutlock);
+ aae:	e9 7d fa ff ff       	jmp    530 <umtxunlock>
+ ab3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ ab7:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+ ab8:	83 ec 04             	sub    $0x4,%esp
+ abb:	50                   	push   %eax
+ abc:	68 0c 20 00 00       	push   $0x200c
+ ac1:	ff 35 00 20 00 00    	push   0x2000
+ ac7:	e8 b4 fa ff ff       	call   580 <_write>
+ acc:	83 c4 10             	add    $0x10,%esp
+ acf:	eb b8                	jmp    a89 <setvbuf+0x39>
+ ad1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ad8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ adf:	90                   	nop
+
+00000ae0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s, %c.
+void
+printf(int fd, const char *fmt, ...)
+{
+ ae0:	55                   	push   %ebp
+ ae1:	89 e5                	mov    %esp,%ebp
+ ae3:	53                   	push   %ebx
+ ae4:	81 ec 14 02 00 00    	sub    $0x214,%esp
+ aea:	8b 45 08             	mov    0x8(%ebp),%eax
+    local.mode = _IONBF;
+    local.n = 0;
+    local.str = 0;
+    b = &local;
+  }
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+ aed:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd == stdout.fd){
+ af0:	39 05 00 20 00 00    	cmp    %eax,0x2000
+ af6:	74 48                	je     b40 <printf+0x60>
+    local.fd = fd;
+ af8:	89 85 e8 fd ff ff    	mov    %eax,-0x218(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+ afe:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ b01:	89 da                	mov    %ebx,%edx
+ b03:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+    local.mode = _IONBF;
+ b09:	c7 85 ec fd ff ff 03 	movl   $0x3,-0x214(%ebp)
+ b10:	00 00 00 
+    local.n = 0;
+ b13:	c7 85 f0 fd ff ff 00 	movl   $0x0,-0x210(%ebp)
+ b1a:	00 00 00 
+    local.str = 0;
+ b1d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+ b24:	e8 67 fd ff ff       	call   890 <format>
+  if(b->mode == _IONBF)
+ b29:	83 bd ec fd ff ff 03 	cmpl   $0x3,-0x214(%ebp)
+ b30:	0f 84 a2 00 00 00    	je     bd8 <printf+0xf8>
+    flush(b);
+  if(b == &stdout)
+    umtxunlock(&stdoutlock);
+}
+ b36:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ b39:	c9                   	leave
+ b3a:	c3                   	ret
+ b3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b3f:	90                   	nop
+    umtxlock(&stdoutlock);
+ b40:	83 ec 0c             	sub    $0xc,%esp
+ b43:	68 14 22 00 00       	push   $0x2214
+ b48:	e8 93 f9 ff ff       	call   4e0 <umtxlock>
+  if(stdout.mode == 0){
+ b4d:	a1 04 20 00 00       	mov    0x2004,%eax
+ b52:	83 c4 10             	add    $0x10,%esp
+ b55:	85 c0                	test   %eax,%eax
+ b57:	74 37                	je     b90 <printf+0xb0>
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+ b59:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ b5c:	89 da                	mov    %ebx,%edx
+ b5e:	b8 00 20 00 00       	mov    $0x2000,%eax
+ b63:	e8 28 fd ff ff       	call   890 <format>
+  if(b->mode == _IONBF)
+ b68:	83 3d 04 20 00 00 03 	cmpl   $0x3,0x2004
+ b6f:	0f 84 ab 00 00 00    	je     c20 <printf+0x140>
+    umtxunlock(&stdoutlock);
+ b75:	83 ec 0c             	sub    $0xc,%esp
+ b78:	68 14 22 00 00       	push   $0x2214
+ b7d:	e8 ae f9 ff ff       	call   530 <umtxunlock>
+}
+ b82:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    umtxunlock(&stdoutlock);
+ b85:	83 c4 10             	add    $0x10,%esp
+}
+ b88:	c9                   	leave
+ b89:	c3                   	ret
+ b8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+ b90:	83 ec 08             	sub    $0x8,%esp
+ b93:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+ b99:	50                   	push   %eax
+ b9a:	ff 35 00 20 00 00    	push   0x2000
+ ba0:	e8 13 fa ff ff       	call   5b8 <fstat>
+ ba5:	83 c4 10             	add    $0x10,%esp
+ ba8:	89 c2                	mov    %eax,%edx
+      stdout.mode = _IOFBF;
+ baa:	b8 01 00 00 00       	mov    $0x1,%eax
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+ baf:	85 d2                	test   %edx,%edx
+ bb1:	75 10                	jne    bc3 <printf+0xe3>
+      stdout.mode = _IOLBF;
+ bb3:	31 c0                	xor    %eax,%eax
+ bb5:	66 83 bd e8 fd ff ff 	cmpw   $0x3,-0x218(%ebp)
+ bbc:	03 
+ bbd:	0f 94 c0             	sete   %al
+ bc0:	83 c0 01             	add    $0x1,%eax
+ bc3:	a3 04 20 00 00       	mov    %eax,0x2004
+    flushhook = flushall;
+ bc8:	c7 05 10 22 00 00 d0 	movl   $0x6d0,0x2210
+ bcf:	06 00 00 
+ bd2:	eb 85                	jmp    b59 <printf+0x79>
+ bd4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(b->n > 0)
+ bd8:	8b 85 f0 fd ff ff    	mov    -0x210(%ebp),%eax
+ bde:	85 c0                	test   %eax,%eax
+ be0:	0f 8e 50 ff ff ff    	jle    b36 <printf+0x56>
+    b = &local;
+ be6:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+    _write(b->fd, b->buf, b->n);
+ bec:	83 ec 04             	sub    $0x4,%esp
+ bef:	50                   	push   %eax
+ bf0:	8d 43 0c             	lea    0xc(%ebx),%eax
+ bf3:	50                   	push   %eax
+ bf4:	ff 33                	push   (%ebx)
+ bf6:	e8 85 f9 ff ff       	call   580 <_write>
+  b->n = 0;
+ bfb:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  if(b == &stdout)
+ c02:	83 c4 10             	add    $0x10,%esp
+ c05:	81 fb 00 20 00 00    	cmp    $0x2000,%ebx
+ c0b:	0f 85 25 ff ff ff    	jne    b36 <printf+0x56>
+ c11:	e9 5f ff ff ff       	jmp    b75 <printf+0x95>
+ c16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c1d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(b->n > 0)
+ c20:	a1 08 20 00 00       	mov    0x2008,%eax
+    b = getstdout();
+ c25:	bb 00 20 00 00       	mov    $0x2000,%ebx
+  if(b->n > 0)
+ c2a:	85 c0                	test   %eax,%eax
+ c2c:	7f be                	jg     bec <printf+0x10c>
+  b->n = 0;
+ c2e:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+ c35:	00 00 00 
+  if(b == &stdout)
+ c38:	e9 38 ff ff ff       	jmp    b75 <printf+0x95>
+ c3d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000c40 <sprintf>:
+
+// Print to the given buffer. Only understands %d, %x, %p, %s, %c.
+int
+sprintf(char *str, const char *fmt, ...)
+{
+ c40:	55                   	push   %ebp
+ c41:	89 e5                	mov    %esp,%ebp
+ c43:	53                   	push   %ebx
+  struct outbuf b;
+
+  b.str = str;
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+ c44:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+ c4a:	8d 4d 10             	lea    0x10(%ebp),%ecx
+{
+ c4d:	81 ec 14 02 00 00    	sub    $0x214,%esp
+ c53:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+ c56:	8b 55 0c             	mov    0xc(%ebp),%edx
+  b.str = str;
+ c59:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+ c5c:	e8 2f fc ff ff       	call   890 <format>
+  *b.str = '\0';
+ c61:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c64:	c6 00 00             	movb   $0x0,(%eax)
+  return b.str - str;
+ c67:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c6a:	29 d8                	sub    %ebx,%eax
+}
+ c6c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ c6f:	c9                   	leave
+ c70:	c3                   	ret
+ c71:	66 90                	xchg   %ax,%ax
+ c73:	66 90                	xchg   %ax,%ax
+ c75:	66 90                	xchg   %ax,%ax
+ c77:	66 90                	xchg   %ax,%ax
+ c79:	66 90                	xchg   %ax,%ax
+ c7b:	66 90                	xchg   %ax,%ax
+ c7d:	66 90                	xchg   %ax,%ax
+ c7f:	90                   	nop
+
+00000c80 <freeblock>:
+static Header *freep;
+static struct umutex lock;  // threads made by clone() share the heap
+
+static void
+freeblock(void *ap)
+{
+ c80:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ c81:	8d 48 f8             	lea    -0x8(%eax),%ecx
+{
+ c84:	89 e5                	mov    %esp,%ebp
+ c86:	57                   	push   %edi
+ c87:	56                   	push   %esi
+ c88:	53                   	push   %ebx
+ c89:	89 c3                	mov    %eax,%ebx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c8b:	a1 1c 22 00 00       	mov    0x221c,%eax
+ c90:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c92:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c94:	39 ca                	cmp    %ecx,%edx
+ c96:	73 30                	jae    cc8 <freeblock+0x48>
+ c98:	39 c1                	cmp    %eax,%ecx
+ c9a:	72 04                	jb     ca0 <freeblock+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c9c:	39 c2                	cmp    %eax,%edx
+ c9e:	72 f0                	jb     c90 <freeblock+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ ca0:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ ca3:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ ca6:	39 f8                	cmp    %edi,%eax
+ ca8:	74 26                	je     cd0 <freeblock+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ caa:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ cad:	8b 42 04             	mov    0x4(%edx),%eax
+ cb0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ cb3:	39 f1                	cmp    %esi,%ecx
+ cb5:	74 30                	je     ce7 <freeblock+0x67>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ cb7:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ cb9:	5b                   	pop    %ebx
+  freep = p;
+ cba:	89 15 1c 22 00 00    	mov    %edx,0x221c
+}
+ cc0:	5e                   	pop    %esi
+ cc1:	5f                   	pop    %edi
+ cc2:	5d                   	pop    %ebp
+ cc3:	c3                   	ret
+ cc4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ cc8:	39 c1                	cmp    %eax,%ecx
+ cca:	72 d0                	jb     c9c <freeblock+0x1c>
+ ccc:	eb c2                	jmp    c90 <freeblock+0x10>
+ cce:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ cd0:	03 70 04             	add    0x4(%eax),%esi
+ cd3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ cd6:	8b 02                	mov    (%edx),%eax
+ cd8:	8b 00                	mov    (%eax),%eax
+ cda:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ cdd:	8b 42 04             	mov    0x4(%edx),%eax
+ ce0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ ce3:	39 f1                	cmp    %esi,%ecx
+ ce5:	75 d0                	jne    cb7 <freeblock+0x37>
+    p->s.size += bp->s.size;
+ ce7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ cea:	89 15 1c 22 00 00    	mov    %edx,0x221c
+    p->s.size += bp->s.size;
+ cf0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ cf3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ cf6:	89 0a                	mov    %ecx,(%edx)
+}
+ cf8:	5b                   	pop    %ebx
+ cf9:	5e                   	pop    %esi
+ cfa:	5f                   	pop    %edi
+ cfb:	5d                   	pop    %ebp
+ cfc:	c3                   	ret
+ cfd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000d00 <free>:
+
+void
+free(void *ap)
+{
+ d00:	55                   	push   %ebp
+ d01:	89 e5                	mov    %esp,%ebp
+ d03:	53                   	push   %ebx
+ d04:	83 ec 10             	sub    $0x10,%esp
+ d07:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  umtxlock(&lock);
+ d0a:	68 18 22 00 00       	push   $0x2218
+ d0f:	e8 cc f7 ff ff       	call   4e0 <umtxlock>
+  freeblock(ap);
+ d14:	89 d8                	mov    %ebx,%eax
+ d16:	e8 65 ff ff ff       	call   c80 <freeblock>
+  umtxunlock(&lock);
+ d1b:	c7 45 08 18 22 00 00 	movl   $0x2218,0x8(%ebp)
+}
+ d22:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&lock);
+ d25:	83 c4 10             	add    $0x10,%esp
+}
+ d28:	c9                   	leave
+  umtxunlock(&lock);
+ d29:	e9 02 f8 ff ff       	jmp    530 <umtxunlock>
+ d2e:	66 90                	xchg   %ax,%ax
+
+00000d30 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ d30:	55                   	push   %ebp
+ d31:	89 e5                	mov    %esp,%ebp
+ d33:	57                   	push   %edi
+ d34:	56                   	push   %esi
+ d35:	53                   	push   %ebx
+ d36:	83 ec 28             	sub    $0x28,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d39:	8b 45 08             	mov    0x8(%ebp),%eax
+  umtxlock(&lock);
+ d3c:	68 18 22 00 00       	push   $0x2218
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d41:	8d 48 07             	lea    0x7(%eax),%ecx
+ d44:	c1 e9 03             	shr    $0x3,%ecx
+ d47:	8d 71 01             	lea    0x1(%ecx),%esi
+  umtxlock(&lock);
+ d4a:	e8 91 f7 ff ff       	call   4e0 <umtxlock>
+  if((prevp = freep) == 0){
+ d4f:	8b 15 1c 22 00 00    	mov    0x221c,%edx
+ d55:	83 c4 10             	add    $0x10,%esp
+ d58:	85 d2                	test   %edx,%edx
+ d5a:	0f 84 b0 00 00 00    	je     e10 <malloc+0xe0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d60:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ d62:	8b 47 04             	mov    0x4(%edi),%eax
+ d65:	39 f0                	cmp    %esi,%eax
+ d67:	73 6f                	jae    dd8 <malloc+0xa8>
+  if(nu < 4096)
+ d69:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ d6e:	39 de                	cmp    %ebx,%esi
+ d70:	0f 43 de             	cmovae %esi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ d73:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ d7a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ d7d:	eb 0a                	jmp    d89 <malloc+0x59>
+ d7f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d80:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ d82:	8b 47 04             	mov    0x4(%edi),%eax
+ d85:	39 f0                	cmp    %esi,%eax
+ d87:	73 4f                	jae    dd8 <malloc+0xa8>
+      }
+      freep = prevp;
+      umtxunlock(&lock);
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ d89:	89 fa                	mov    %edi,%edx
+ d8b:	39 3d 1c 22 00 00    	cmp    %edi,0x221c
+ d91:	75 ed                	jne    d80 <malloc+0x50>
+  p = sbrk(nu * sizeof(Header));
+ d93:	83 ec 0c             	sub    $0xc,%esp
+ d96:	ff 75 e4             	push   -0x1c(%ebp)
+ d99:	e8 4a f8 ff ff       	call   5e8 <sbrk>
+  if(p == (char*)-1)
+ d9e:	83 c4 10             	add    $0x10,%esp
+ da1:	83 f8 ff             	cmp    $0xffffffff,%eax
+ da4:	74 15                	je     dbb <malloc+0x8b>
+  hp->s.size = nu;
+ da6:	89 58 04             	mov    %ebx,0x4(%eax)
+  freeblock((void*)(hp + 1));
+ da9:	83 c0 08             	add    $0x8,%eax
+ dac:	e8 cf fe ff ff       	call   c80 <freeblock>
+  return freep;
+ db1:	8b 15 1c 22 00 00    	mov    0x221c,%edx
+      if((p = morecore(nunits)) == 0){
+ db7:	85 d2                	test   %edx,%edx
+ db9:	75 c5                	jne    d80 <malloc+0x50>
+        umtxunlock(&lock);
+ dbb:	83 ec 0c             	sub    $0xc,%esp
+ dbe:	68 18 22 00 00       	push   $0x2218
+ dc3:	e8 68 f7 ff ff       	call   530 <umtxunlock>
+        return 0;
+ dc8:	83 c4 10             	add    $0x10,%esp
+      }
+  }
+}
+ dcb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ dce:	31 c0                	xor    %eax,%eax
+}
+ dd0:	5b                   	pop    %ebx
+ dd1:	5e                   	pop    %esi
+ dd2:	5f                   	pop    %edi
+ dd3:	5d                   	pop    %ebp
+ dd4:	c3                   	ret
+ dd5:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ dd8:	39 c6                	cmp    %eax,%esi
+ dda:	74 64                	je     e40 <malloc+0x110>
+        p->s.size -= nunits;
+ ddc:	29 f0                	sub    %esi,%eax
+ dde:	89 47 04             	mov    %eax,0x4(%edi)
+        p += p->s.size;
+ de1:	8d 3c c7             	lea    (%edi,%eax,8),%edi
+        p->s.size = nunits;
+ de4:	89 77 04             	mov    %esi,0x4(%edi)
+      umtxunlock(&lock);
+ de7:	83 ec 0c             	sub    $0xc,%esp
+      freep = prevp;
+ dea:	89 15 1c 22 00 00    	mov    %edx,0x221c
+      umtxunlock(&lock);
+ df0:	68 18 22 00 00       	push   $0x2218
+ df5:	e8 36 f7 ff ff       	call   530 <umtxunlock>
+      return (void*)(p + 1);
+ dfa:	83 c4 10             	add    $0x10,%esp
+}
+ dfd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ e00:	8d 47 08             	lea    0x8(%edi),%eax
+}
+ e03:	5b                   	pop    %ebx
+ e04:	5e                   	pop    %esi
+ e05:	5f                   	pop    %edi
+ e06:	5d                   	pop    %ebp
+ e07:	c3                   	ret
+ e08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e0f:	90                   	nop
+    base.s.ptr = freep = prevp = &base;
+ e10:	c7 05 1c 22 00 00 20 	movl   $0x2220,0x221c
+ e17:	22 00 00 
+    base.s.size = 0;
+ e1a:	bf 20 22 00 00       	mov    $0x2220,%edi
+    base.s.ptr = freep = prevp = &base;
+ e1f:	c7 05 20 22 00 00 20 	movl   $0x2220,0x2220
+ e26:	22 00 00 
+    base.s.size = 0;
+ e29:	c7 05 24 22 00 00 00 	movl   $0x0,0x2224
+ e30:	00 00 00 
+    if(p->s.size >= nunits){
+ e33:	e9 31 ff ff ff       	jmp    d69 <malloc+0x39>
+ e38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e3f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ e40:	8b 07                	mov    (%edi),%eax
+ e42:	89 02                	mov    %eax,(%edx)
+ e44:	eb a1                	jmp    de7 <malloc+0xb7>
+ e46:	66 90                	xchg   %ax,%ax
+ e48:	66 90                	xchg   %ax,%ax
+ e4a:	66 90                	xchg   %ax,%ax
+ e4c:	66 90                	xchg   %ax,%ax
+ e4e:	66 90                	xchg   %ax,%ax
+
+00000e50 <threadstart>:
+
+#define TSTACKSZ 4096
+
+static void
+threadstart(void *fn, void *arg)
+{
+ e50:	55                   	push   %ebp
+ e51:	89 e5                	mov    %esp,%ebp
+ e53:	83 ec 14             	sub    $0x14,%esp
+  ((void (*)(void*))fn)(arg);
+ e56:	ff 75 0c             	push   0xc(%ebp)
+ e59:	ff 55 08             	call   *0x8(%ebp)
+  exit();
+ e5c:	e8 ef f4 ff ff       	call   350 <exit>
+ e61:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e6f:	90                   	nop
+
+00000e70 <thread_create>:
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ e70:	55                   	push   %ebp
+ e71:	89 e5                	mov    %esp,%ebp
+ e73:	53                   	push   %ebx
+ e74:	83 ec 20             	sub    $0x20,%esp
+  char *mem, *stack;
+  int pid;
+
+  if((mem = malloc(2*TSTACKSZ)) == 0)
+ e77:	68 00 20 00 00       	push   $0x2000
+ e7c:	e8 af fe ff ff       	call   d30 <malloc>
+ e81:	83 c4 10             	add    $0x10,%esp
+ e84:	85 c0                	test   %eax,%eax
+ e86:	74 47                	je     ecf <thread_create+0x5f>
+ e88:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)(((uint)mem + TSTACKSZ - 1) & ~(TSTACKSZ - 1));
+ e8a:	8d 80 ff 0f 00 00    	lea    0xfff(%eax),%eax
+ e90:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  *(char**)stack = mem;
+ e95:	89 18                	mov    %ebx,(%eax)
+  if((pid = clone(threadstart, (void*)fn, arg, stack)) < 0)
+ e97:	50                   	push   %eax
+ e98:	ff 75 0c             	push   0xc(%ebp)
+ e9b:	ff 75 08             	push   0x8(%ebp)
+ e9e:	68 50 0e 00 00       	push   $0xe50
+ ea3:	e8 08 f8 ff ff       	call   6b0 <clone>
+ ea8:	83 c4 10             	add    $0x10,%esp
+ eab:	85 c0                	test   %eax,%eax
+ ead:	78 09                	js     eb8 <thread_create+0x48>
+    free(mem);
+  return pid;
+}
+ eaf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ eb2:	c9                   	leave
+ eb3:	c3                   	ret
+ eb4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    free(mem);
+ eb8:	83 ec 0c             	sub    $0xc,%esp
+ ebb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ ebe:	53                   	push   %ebx
+ ebf:	e8 3c fe ff ff       	call   d00 <free>
+ ec4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ ec7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+ eca:	83 c4 10             	add    $0x10,%esp
+}
+ ecd:	c9                   	leave
+ ece:	c3                   	ret
+    return -1;
+ ecf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ ed4:	eb d9                	jmp    eaf <thread_create+0x3f>
+ ed6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ edd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ee0 <thread_join>:
+
+int
+thread_join(void)
+{
+ ee0:	55                   	push   %ebp
+ ee1:	89 e5                	mov    %esp,%ebp
+ ee3:	83 ec 34             	sub    $0x34,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+ ee6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ ee9:	50                   	push   %eax
+ eea:	e8 c9 f7 ff ff       	call   6b8 <join>
+ eef:	83 c4 10             	add    $0x10,%esp
+ ef2:	85 c0                	test   %eax,%eax
+ ef4:	79 0a                	jns    f00 <thread_join+0x20>
+    free(*(char**)stack);
+  return pid;
+}
+ ef6:	c9                   	leave
+ ef7:	c3                   	ret
+ ef8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ eff:	90                   	nop
+    free(*(char**)stack);
+ f00:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ f03:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ f06:	83 ec 0c             	sub    $0xc,%esp
+ f09:	ff 32                	push   (%edx)
+ f0b:	e8 f0 fd ff ff       	call   d00 <free>
+ f10:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ f13:	83 c4 10             	add    $0x10,%esp
+}
+ f16:	c9                   	leave
+ f17:	c3                   	ret
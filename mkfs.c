@@ -18,10 +18,11 @@
 #define NINODES 200
 
 // Disk layout:
-// [ boot block | sb block | log | inode blocks | free bit map | data blocks ]
+// [ boot block | sb block | log | group 0 | group 1 | ... | swap ]
+// with each group laid out as
+// [ inode blocks | free bit map | data blocks ]
 
-int nbitmap = FSSIZE/(BSIZE*8) + 1;
-int ninodeblocks = NINODES / IPB + 1;
+int ipg = (NINODES/NGROUP + IPB - 1) / IPB * IPB;
 int nlog = LOGSIZE;
 int nmeta;    // Number of meta blocks (boot, sb, nlog, inode, bitmap)
 int nblocks;  // Number of data blocks
@@ -30,10 +31,11 @@ int fsfd;
 struct superblock sb;
 char zeroes[BSIZE];
 uint freeinode = 1;
-uint freeblock;
+uint freeblock[NGROUP];  // next free data block in each group
 
 
 void balloc(int);
+uint nextblock(uint);
 void wsect(uint, void*);
 void winode(uint, struct dinode*);
 void rinode(uint inum, struct dinode *ip);
@@ -91,24 +93,38 @@ main(int argc, char *argv[])
   }
 
   // 1 fs block = 1 disk sector
-  nmeta = 2 + nlog + ninodeblocks + nbitmap;
+  nmeta = 2 + nlog + NGROUP*(ipg/IPB + 1);
   nblocks = FSSIZE - nmeta;
 
   sb.size = xint(FSSIZE);
   sb.nblocks = xint(nblocks);
-  sb.ninodes = xint(NINODES);
+  sb.ninodes = xint(NGROUP*ipg);
   sb.nlog = xint(nlog);
   sb.logstart = xint(2);
-  sb.inodestart = xint(2+nlog);
-  sb.bmapstart = xint(2+nlog+ninodeblocks);
+  sb.groupstart = xint(2+nlog);
+  sb.ngroups = xint(NGROUP);
+  sb.bpg = xint((FSSIZE - (2+nlog) + NGROUP - 1) / NGROUP);
+  sb.ipg = xint(ipg);
+  sb.swapstart = xint(FSSIZE);
+  sb.nswap = xint(SWAPSIZE);
 
-  printf("nmeta %d (boot, super, log blocks %u inode blocks %u, bitmap blocks %u) blocks %d total %d\n",
-         nmeta, nlog, ninodeblocks, nbitmap, nblocks, FSSIZE);
+  assert(xint(sb.bpg) <= BPB);
+  assert(GDATA(NGROUP-1, sb) < FSSIZE);
 
-  freeblock = nmeta;     // the first free block that we can allocate
+  printf("nmeta %d (boot, super, log blocks %u, %d groups of %u blocks: inode blocks %u, bitmap blocks 1) blocks %d total %d swap %d\n",
+         nmeta, nlog, NGROUP, xint(sb.bpg), (uint)IBPG(sb), nblocks, FSSIZE, SWAPSIZE);
+
+  // the first free block that we can allocate in each group
+  for(i = 0; i < NGROUP; i++)
+    freeblock[i] = GDATA(i, sb);
 
   for(i = 0; i < FSSIZE; i++)
     wsect(i, zeroes);
+  // The swap area needs no contents; leave it a hole in the image.
+  if(ftruncate(fsfd, (off_t)(FSSIZE + SWAPSIZE) * BSIZE) < 0){
+    perror("ftruncate");
+    exit(1);
+  }
 
   memset(buf, 0, sizeof(buf));
   memmove(buf, &sb, sizeof(sb));
@@ -158,11 +174,14 @@ main(int argc, char *argv[])
   // fix size of root inode dir
   rinode(rootino, &din);
   off = xint(din.size);
-  off = ((off/BSIZE) + 1) * BSIZE;
-  din.size = xint(off);
-  winode(rootino, &din);
+  if(off > NINLINE){
+    off = ((off/BSIZE) + 1) * BSIZE;
+    din.size = xint(off);
+    winode(rootino, &din);
+  }
 
-  balloc(freeblock);
+  for(i = 0; i < NGROUP; i++)
+    balloc(i);
 
   exit(0);
 }
@@ -226,6 +245,7 @@ ialloc(ushort type)
   uint inum = freeinode++;
   struct dinode din;
 
+  assert(inum < NGROUP*ipg);
   bzero(&din, sizeof(din));
   din.type = xshort(type);
   din.nlink = xshort(1);
@@ -234,24 +254,59 @@ ialloc(ushort type)
   return inum;
 }
 
+// Allocate the next data block for inode inum, from the inode's
+// own group if it has room left, else from the groups after it.
+uint
+nextblock(uint inum)
+{
+  uint g, i, end;
+
+  g = IGROUP(inum, sb);
+  for(i = 0; i < NGROUP; i++, g = (g+1) % NGROUP){
+    end = g == NGROUP-1 ? FSSIZE : GSTART(g+1, sb);
+    if(freeblock[g] < end)
+      return freeblock[g]++;
+  }
+  fprintf(stderr, "mkfs: out of blocks\n");
+  exit(1);
+}
+
+// Write the free bit map of group g: the group's inode blocks,
+// the bitmap block itself and the data blocks handed out so far
+// are in use.
 void
-balloc(int used)
+balloc(int g)
 {
   uchar buf[BSIZE];
-  int i;
+  int i, used;
 
-  printf("balloc: first %d blocks have been allocated\n", used);
-  assert(used < BSIZE*8);
+  used = freeblock[g] - GSTART(g, sb);
+  printf("balloc: group %d: first %d blocks have been allocated\n", g, used);
+  assert(used <= BPB);
   bzero(buf, BSIZE);
   for(i = 0; i < used; i++){
     buf[i/8] = buf[i/8] | (0x1 << (i%8));
   }
-  printf("balloc: write bitmap block at sector %d\n", sb.bmapstart);
-  wsect(sb.bmapstart, buf);
+  wsect(GSTART(g, sb) + IBPG(sb), buf);
 }
 
 #define min(a, b) ((a) < (b) ? (a) : (b))
 
+// Return entry i of the block-address block blk,
+// allocating a block for inode inum if it is zero.
+uint
+indirect(uint blk, uint i, uint inum)
+{
+  uint a[NINDIRECT];
+
+  rsect(blk, (char*)a);
+  if(a[i] == 0){
+    a[i] = xint(nextblock(inum));
+    wsect(blk, (char*)a);
+  }
+  return xint(a[i]);
+}
+
 void
 iappend(uint inum, void *xp, int n)
 {
@@ -259,30 +314,46 @@ iappend(uint inum, void *xp, int n)
   uint fbn, off, n1;
   struct dinode din;
   char buf[BSIZE];
-  uint indirect[NINDIRECT];
   uint x;
 
   rinode(inum, &din);
   off = xint(din.size);
   // printf("append inum %d at off %d sz %d\n", inum, off, n);
+  if(off + n <= NINLINE){
+    // still small enough to live in the inode
+    bcopy(p, (char*)din.addrs + off, n);
+    din.size = xint(off + n);
+    winode(inum, &din);
+    return;
+  }
+  if(off > 0 && off <= NINLINE){
+    // growing out of the inode: move the data to a block
+    bzero(buf, sizeof(buf));
+    bcopy(din.addrs, buf, off);
+    bzero(din.addrs, sizeof(din.addrs));
+    din.addrs[0] = xint(nextblock(inum));
+    wsect(xint(din.addrs[0]), buf);
+  }
   while(n > 0){
     fbn = off / BSIZE;
     assert(fbn < MAXFILE);
     if(fbn < NDIRECT){
       if(xint(din.addrs[fbn]) == 0){
-        din.addrs[fbn] = xint(freeblock++);
+        din.addrs[fbn] = xint(nextblock(inum));
       }
       x = xint(din.addrs[fbn]);
-    } else {
+    } else if(fbn < NDIRECT + NINDIRECT){
       if(xint(din.addrs[NDIRECT]) == 0){
-        din.addrs[NDIRECT] = xint(freeblock++);
+        din.addrs[NDIRECT] = xint(nextblock(inum));
       }
-      rsect(xint(din.addrs[NDIRECT]), (char*)indirect);
-      if(indirect[fbn - NDIRECT] == 0){
-        indirect[fbn - NDIRECT] = xint(freeblock++);
-        wsect(xint(din.addrs[NDIRECT]), (char*)indirect);
+      x = indirect(xint(din.addrs[NDIRECT]), fbn - NDIRECT, inum);
+    } else {
+      if(xint(din.addrs[NDIRECT+1]) == 0){
+        din.addrs[NDIRECT+1] = xint(nextblock(inum));
       }
-      x = xint(indirect[fbn-NDIRECT]);
+      x = indirect(xint(din.addrs[NDIRECT+1]),
+                   (fbn - NDIRECT - NINDIRECT) / NINDIRECT, inum);
+      x = indirect(x, (fbn - NDIRECT - NINDIRECT) % NINDIRECT, inum);
     }
     n1 = min(n, (fbn + 1) * BSIZE - off);
     rsect(x, buf);
@@ -0,0 +1,8 @@
+#define PROT_READ    0x1   // pages may be read
+#define PROT_WRITE   0x2   // pages may be written
+
+#define MAP_SHARED   0x01  // writes go to the file, seen by all
+#define MAP_PRIVATE  0x02  // writes go to a private copy
+#define MAP_ANON     0x20  // zeroed memory, no file
+
+#define MAP_FAILED   ((void*)-1)
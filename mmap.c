@@ -0,0 +1,552 @@
+// Memory-mapped regions.
+//
+// Each process has up to NVMA regions, recorded in its struct vm,
+// in the addresses between its heap and its stack. mmap() only
+// reserves the addresses; vmafault() fills in a page the first
+// time the process touches it.
+//
+// A private region gets pages of its own: zeroed for anonymous
+// memory, or a copy of the file's data. These may be swapped
+// out (see swap.c); the pages of shared regions are not. A shared region maps
+// the file's page cache frames themselves, so every process
+// that maps the file, and read() and write() on it, see the
+// same bytes. Each mapped frame holds a reference on its page
+// cache page, which keeps the page from being recycled.
+// Unmapping writes dirty shared pages back to the file through
+// the log. A region can also map a shared memory segment from
+// shm.c, whose pages belong to the segment.
+//
+// exec() maps a program's text as a region too, read-only, of
+// the program's page cache pages. Every process running the
+// program shares them; writing the file leaves them to the
+// processes already running it, unless a shared region maps
+// them too (see pcwrite()). The text lies
+// below p->vm->sz, where its entries carry PTE_TEXT so that
+// copyuvm() leaves them to vmacopy().
+//
+// The kernel does not take page faults on mapped memory while
+// holding locks: copyin() and copyout() stop at a page that is
+// not there, and checkptr() calls vmaload() to fault it in.
+//
+// Threads made by clone() share their regions. vmlock() keeps
+// two of them from changing the regions, or faulting in the
+// same page, at once.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "proc.h"
+#include "stat.h"
+#include "fs.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "file.h"
+#include "pcache.h"
+#include "mman.h"
+
+// Return the region of p that contains va, or 0.
+struct vma*
+vmalookup(struct proc *p, uint va)
+{
+  struct vma *v;
+
+  for(v = p->vm->vma; v < &p->vm->vma[NVMA]; v++)
+    if(v->end && va >= v->start && va < v->end)
+      return v;
+  return 0;
+}
+
+// Return a region of p that overlaps [start, end), or 0.
+struct vma*
+vmaoverlap(struct proc *p, uint start, uint end)
+{
+  struct vma *v;
+
+  for(v = p->vm->vma; v < &p->vm->vma[NVMA]; v++)
+    if(v->end && start < v->end && v->start < end)
+      return v;
+  return 0;
+}
+
+static int
+vmaperm(struct vma *v)
+{
+  if(v->ip)
+    return PTE_TEXT|PTE_U;
+  return (v->prot & PROT_WRITE) ? PTE_W|PTE_U : PTE_U;
+}
+
+// Fill in the page of p's memory that holds va. Returns -1
+// if the page is already present; see vmafault().
+// Caller must hold vmlock(p->vm).
+static int
+fault(struct proc *p, uint va)
+{
+  struct vma *v;
+  struct inode *ip;
+  struct page *pg;
+  pte_t *pte;
+  char *mem;
+  uint off, n;
+
+  if((v = vmalookup(p, va)) == 0)
+    return -1;
+  va = PGROUNDDOWN(va);
+  if((pte = walkpgdir(p->vm->pgdir, (char*)va, 0)) != 0 && (*pte & PTE_P))
+    return -1;
+  if(pte && (*pte & PTE_SWAP))
+    return swapin(p->vm, va);
+  off = v->off + (va - v->start);
+
+  pg = 0;
+  if(v->shm){
+    if((mem = shmpage(v->shm, off/PGSIZE)) == 0)
+      return -1;
+  } else if(v->f && (v->flags & MAP_SHARED)){
+    ip = v->f->ip;
+    ilock(ip);
+    if(off < ip->size)
+      pg = igetpage(ip, off/PGSIZE);
+    iunlock(ip);
+    if(pg == 0)
+      return -1;
+    pcshared(pg, 1);
+    pcput(pg);
+    mem = pg->data;
+  } else {
+    if((mem = uzalloc()) == 0)
+      return -1;
+    if(v->f){
+      ip = v->f->ip;
+      ilock(ip);
+      if(off < ip->size){
+        n = ip->size - off;
+        if(n > PGSIZE)
+          n = PGSIZE;
+        readi(ip, mem, off, n);
+      }
+      iunlock(ip);
+    }
+  }
+
+  if(mappages(p->vm->pgdir, (char*)va, PGSIZE, V2P(mem), vmaperm(v)) < 0){
+    if(pg)
+      pcshared(pg, -1);
+    else if(v->shm == 0)
+      kfree(mem);
+    return -1;
+  }
+  return 0;
+}
+
+// Fill in the page of p's memory that holds va, after a
+// page fault; write is set if the fault was for a write.
+// Returns -1 if va is not mapped, the fault is a write to
+// a read-only region, the page lies past the end of a shared
+// file, or memory runs out. Returns 0 without doing anything
+// if another thread has already filled in the page.
+int
+vmafault(struct proc *p, uint va, int write)
+{
+  pte_t *pte;
+  int r;
+
+  vmlock(p->vm);
+  pte = walkpgdir(p->vm->pgdir, (char*)va, 0);
+  if(pte && (*pte & PTE_P))
+    r = write && (*pte & PTE_W) == 0 ? -1 : 0;
+  else
+    r = fault(p, va);
+  vmunlock(p->vm);
+  return r;
+}
+
+// Make sure the pages of p holding [va, va+n) are present.
+// Returns -1 unless the whole range lies in mapped regions.
+int
+vmaload(struct proc *p, uint va, uint n)
+{
+  uint a, last;
+  pte_t *pte;
+
+  if(va + n < va)
+    return -1;
+  a = PGROUNDDOWN(va);
+  last = n > 0 ? PGROUNDDOWN(va + n - 1) : a;
+  for(;; a += PGSIZE){
+    if(vmalookup(p, a) == 0)
+      return -1;
+    pte = walkpgdir(p->vm->pgdir, (char*)a, 0);
+    if(pte == 0 || (*pte & PTE_P) == 0){
+      // Another thread may have faulted it in meanwhile.
+      vmlock(p->vm);
+      pte = walkpgdir(p->vm->pgdir, (char*)a, 0);
+      if((pte == 0 || (*pte & PTE_P) == 0) && fault(p, a) < 0){
+        vmunlock(p->vm);
+        return -1;
+      }
+      vmunlock(p->vm);
+    }
+    if(a == last)
+      break;
+  }
+  return 0;
+}
+
+// Write the page at src back to offset off of ip, without
+// growing the file. A few blocks at a time, as in filewrite().
+static void
+writeback(struct inode *ip, char *src, uint off)
+{
+  int max = ((MAXOPBLOCKS-1-1-2) / 2) * BSIZE;
+  uint i, n;
+
+  for(i = 0; i < PGSIZE; i += n){
+    begin_op();
+    ilock(ip);
+    n = 0;
+    if(off + i < ip->size){
+      n = ip->size - (off + i);
+      if(n > max)
+        n = max;
+      if(n > PGSIZE - i)
+        n = PGSIZE - i;
+      writei(ip, src + i, off + i, n);
+    }
+    iunlock(ip);
+    end_op();
+    if(n == 0)
+      break;
+  }
+}
+
+// Unmap the present pages of region v in [a, b).
+// Dirty pages of a shared file are written back first.
+// Caller must hold vmlock().
+static void
+unmappages(pde_t *pgdir, struct vma *v, uint a, uint b)
+{
+  struct inode *ip;
+  pte_t *pte;
+  uint off;
+  char *mem;
+
+  // No CPU may write to a page once it is freed.
+  unmapuvm(pgdir, a, b);
+  for(; a < b; a += PGSIZE){
+    pte = walkpgdir(pgdir, (char*)a, 0);
+    if(pte && (*pte & PTE_SWAP)){
+      swapfree(*pte);
+      *pte = 0;
+      continue;
+    }
+    if(pte == 0 || PTE_ADDR(*pte) == 0)
+      continue;
+    mem = P2V(PTE_ADDR(*pte));
+    if(v->shm){
+      // The page belongs to the segment.
+    } else if(v->ip){
+      off = v->off + (a - v->start);
+      pctext(pcframe(v->ip->dev, v->ip->inum, off/PGSIZE, mem), -1);
+    } else if(v->f && (v->flags & MAP_SHARED)){
+      ip = v->f->ip;
+      off = v->off + (a - v->start);
+      if(*pte & PTE_D)
+        writeback(ip, mem, off);
+      pcshared(pcframe(ip->dev, ip->inum, off/PGSIZE, mem), -1);
+    } else {
+      kfree(mem);
+    }
+    *pte = 0;
+  }
+}
+
+// Allocate a free region of p for len bytes: the first fit
+// above the heap that leaves a guard page below the stack.
+// Caller must hold vmlock(p->vm).
+static struct vma*
+vmaalloc(struct proc *p, uint len)
+{
+  struct vma *v, *w;
+  uint start;
+
+  for(v = p->vm->vma; v < &p->vm->vma[NVMA]; v++)
+    if(v->end == 0)
+      break;
+  if(v == &p->vm->vma[NVMA])
+    return 0;
+
+  len = PGROUNDUP(len);
+  start = PGROUNDUP(p->vm->sz);
+  if(start < MMAPBASE)
+    start = MMAPBASE;
+  while((w = vmaoverlap(p, start, start + len)) != 0)
+    start = w->end;
+  if(start + len < start || start + len > p->vm->stacksz - PGSIZE)
+    return 0;
+
+  memset(v, 0, sizeof(*v));
+  v->start = start;
+  v->end = start + len;
+  return v;
+}
+
+// Map len bytes of file f starting at offset off, or
+// anonymous memory if f is 0, into p's address space.
+// Returns the address of the region, or -1.
+int
+vmamap(struct proc *p, struct file *f, uint len, int prot, int flags, uint off)
+{
+  struct vma *v;
+  int share;
+
+  share = flags & (MAP_SHARED|MAP_PRIVATE);
+  if(len == 0 || off % PGSIZE != 0)
+    return -1;
+  if(share != MAP_SHARED && share != MAP_PRIVATE)
+    return -1;
+  if(f){
+    if(f->type != FD_INODE || f->ip->type != T_FILE || !f->readable)
+      return -1;
+    if(share == MAP_SHARED && (prot & PROT_WRITE) && !f->writable)
+      return -1;
+  } else if(share == MAP_SHARED){
+    return -1;
+  }
+
+  vmlock(p->vm);
+  if((v = vmaalloc(p, len)) == 0){
+    vmunlock(p->vm);
+    return -1;
+  }
+  v->prot = prot;
+  v->flags = share;
+  v->f = f ? filedup(f) : 0;
+  v->off = off;
+  vmunlock(p->vm);
+  return v->start;
+}
+
+// Map len bytes of shared memory segment s into p's
+// address space, read-write. The caller has counted the
+// new region in s. Returns the address of the region, or -1.
+int
+vmashm(struct proc *p, struct shm *s, uint len)
+{
+  struct vma *v;
+
+  vmlock(p->vm);
+  if((v = vmaalloc(p, len)) == 0){
+    vmunlock(p->vm);
+    return -1;
+  }
+  v->prot = PROT_READ|PROT_WRITE;
+  v->flags = MAP_SHARED;
+  v->shm = s;
+  vmunlock(p->vm);
+  return v->start;
+}
+
+// Drop what unmapped region v holds, and free its slot.
+static void
+vmaclose(struct vma *v)
+{
+  if(v->f)
+    fileclose(v->f);
+  if(v->shm)
+    shmput(v->shm);
+  if(v->ip){
+    begin_op();
+    iput(v->ip);
+    end_op();
+  }
+  memset(v, 0, sizeof(*v));
+}
+
+// Map n bytes of the text of program ip, from file offset off,
+// at va of pgdir, which is to become vm's page table. va and
+// off must be page aligned. Returns -1 if out of regions or
+// memory, leaving the pages mapped so far for vmafree().
+// Caller must hold ip->lock.
+int
+vmatext(struct vm *vm, pde_t *pgdir, struct inode *ip, uint va, uint off, uint n)
+{
+  struct vma *v;
+  struct page *pg;
+  uint a;
+
+  for(v = vm->vma; v < &vm->vma[NVMA]; v++)
+    if(v->end == 0)
+      break;
+  if(v == &vm->vma[NVMA])
+    return -1;
+  memset(v, 0, sizeof(*v));
+  v->start = va;
+  v->end = PGROUNDUP(va + n);
+  v->prot = PROT_READ;
+  v->flags = MAP_PRIVATE;
+  v->off = off;
+  v->ip = idup(ip);
+  for(a = v->start; a < v->end; a += PGSIZE){
+    if((pg = igetpage(ip, (off + a - va) / PGSIZE)) == 0)
+      return -1;
+    pctext(pg, 1);
+    pcput(pg);
+    if(mappages(pgdir, (char*)a, PGSIZE, V2P(pg->data), vmaperm(v)) < 0){
+      pctext(pg, -1);
+      return -1;
+    }
+  }
+  return 0;
+}
+
+// Unmap [addr, addr+len) from p, shrinking or splitting
+// the regions it overlaps. Returns -1 if a split needs
+// a free region slot and there is none, or if the range
+// overlaps program text, which stays mapped while the
+// program runs: the pages below sz must all be present.
+int
+vmaunmap(struct proc *p, uint addr, uint len)
+{
+  struct vma *v, *nv;
+  uint a, b;
+
+  if(addr % PGSIZE != 0 || len == 0 || addr + len < addr ||
+     addr + len > KERNBASE)
+    return -1;
+  b = PGROUNDUP(addr + len);
+  vmlock(p->vm);
+  for(v = p->vm->vma; v < &p->vm->vma[NVMA]; v++){
+    if(v->end != 0 && v->ip && v->end > addr && v->start < b){
+      vmunlock(p->vm);
+      return -1;
+    }
+  }
+  for(v = p->vm->vma; v < &p->vm->vma[NVMA]; v++){
+    if(v->end == 0 || v->end <= addr || v->start >= b)
+      continue;
+    a = addr > v->start ? addr : v->start;
+    if(a > v->start && b < v->end){
+      // Punching a hole: the part above it
+      // becomes a region of its own.
+      for(nv = p->vm->vma; nv < &p->vm->vma[NVMA]; nv++)
+        if(nv->end == 0)
+          break;
+      if(nv == &p->vm->vma[NVMA]){
+        vmunlock(p->vm);
+        return -1;
+      }
+      unmappages(p->vm->pgdir, v, a, b);
+      *nv = *v;
+      nv->start = b;
+      nv->off += b - v->start;
+      if(nv->f)
+        filedup(nv->f);
+      if(nv->shm)
+        shmdup(nv->shm);
+      v->end = a;
+    } else if(a > v->start){
+      unmappages(p->vm->pgdir, v, a, v->end);
+      v->end = a;
+    } else if(b < v->end){
+      unmappages(p->vm->pgdir, v, v->start, b);
+      v->off += b - v->start;
+      v->start = b;
+    } else {
+      unmappages(p->vm->pgdir, v, v->start, v->end);
+      vmaclose(v);
+    }
+  }
+  vmunlock(p->vm);
+  return 0;
+}
+
+// Give child np copies of p's regions. Private pages
+// are copied; program text, shared file pages and shared
+// memory segments are mapped in both. Caller must hold
+// vmlock(p->vm).
+int
+vmacopy(struct proc *np, struct proc *p)
+{
+  struct vma *v, *nv;
+  struct inode *ip;
+  struct page *pg;
+  pte_t *pte;
+  uint a, pgno;
+  char *mem;
+
+  for(v = p->vm->vma, nv = np->vm->vma; v < &p->vm->vma[NVMA]; v++, nv++){
+    if(v->end == 0)
+      continue;
+    *nv = *v;
+    if(nv->f)
+      filedup(nv->f);
+    if(nv->shm)
+      shmdup(nv->shm);
+    if(nv->ip)
+      idup(nv->ip);
+    for(a = v->start; a < v->end; a += PGSIZE){
+      pte = walkpgdir(p->vm->pgdir, (char*)a, 0);
+      if(pte && (*pte & PTE_SWAP)){
+        if(swapdup(np->vm->pgdir, a, *pte) < 0)
+          return -1;
+        continue;
+      }
+      if(pte == 0 || (*pte & PTE_P) == 0)
+        continue;
+      pg = 0;
+      if(v->shm){
+        mem = P2V(PTE_ADDR(*pte));
+      } else if(v->ip){
+        mem = P2V(PTE_ADDR(*pte));
+        pgno = (v->off + (a - v->start)) / PGSIZE;
+        pg = pcframe(v->ip->dev, v->ip->inum, pgno, mem);
+        pctext(pg, 1);
+      } else if(v->f && (v->flags & MAP_SHARED)){
+        ip = v->f->ip;
+        mem = P2V(PTE_ADDR(*pte));
+        pgno = (v->off + (a - v->start)) / PGSIZE;
+        pg = pcframe(ip->dev, ip->inum, pgno, mem);
+        pcshared(pg, 1);
+      } else {
+        if((mem = ualloc()) == 0)
+          return -1;
+        // ualloc() may have swapped the page out.
+        if(*pte & PTE_SWAP){
+          kfree(mem);
+          if(swapdup(np->vm->pgdir, a, *pte) < 0)
+            return -1;
+          continue;
+        }
+        memmove(mem, P2V(PTE_ADDR(*pte)), PGSIZE);
+      }
+      if(mappages(np->vm->pgdir, (char*)a, PGSIZE, V2P(mem), vmaperm(v)) < 0){
+        if(v->ip)
+          pctext(pg, -1);
+        else if(pg)
+          pcshared(pg, -1);
+        else if(v->shm == 0)
+          kfree(mem);
+        return -1;
+      }
+    }
+  }
+  return 0;
+}
+
+// Unmap all of vm's regions, once the last
+// thread using it has exited or exec()ed.
+void
+vmafree(struct vm *vm)
+{
+  struct vma *v;
+
+  for(v = vm->vma; v < &vm->vma[NVMA]; v++){
+    if(v->end == 0)
+      continue;
+    unmappages(vm->pgdir, v, v->start, v->end);
+    vmaclose(v);
+  }
+}
@@ -0,0 +1,2621 @@
+
+_mutextest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <bench>:
+};
+
+struct shared *sh;
+
+void bench(char *name, int nproc, int kernel)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	57                   	push   %edi
+       4:	56                   	push   %esi
+       5:	53                   	push   %ebx
+       6:	83 ec 1c             	sub    $0x1c,%esp
+       9:	8b 7d 10             	mov    0x10(%ebp),%edi
+       c:	8b 75 0c             	mov    0xc(%ebp),%esi
+    int i, j, n, t0, nsys;
+
+    n = kernel ? mtxget() : 0;
+       f:	85 ff                	test   %edi,%edi
+      11:	0f 85 e1 00 00 00    	jne    f8 <bench+0xf8>
+    umtxinit(&sh->m);
+      17:	83 ec 0c             	sub    $0xc,%esp
+      1a:	ff 35 10 22 00 00    	push   0x2210
+      20:	e8 6b 08 00 00       	call   890 <umtxinit>
+    sh->count = 0;
+      25:	a1 10 22 00 00       	mov    0x2210,%eax
+      2a:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+    t0 = uptime();
+      31:	e8 82 09 00 00       	call   9b8 <uptime>
+    n = kernel ? mtxget() : 0;
+      36:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+    for (i = 0; i < nproc; i++)
+      3d:	83 c4 10             	add    $0x10,%esp
+    t0 = uptime();
+      40:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    for (i = 0; i < nproc; i++)
+      43:	85 f6                	test   %esi,%esi
+      45:	0f 8e 26 01 00 00    	jle    171 <bench+0x171>
+      4b:	31 db                	xor    %ebx,%ebx
+      4d:	eb 03                	jmp    52 <bench+0x52>
+      4f:	90                   	nop
+      50:	89 c3                	mov    %eax,%ebx
+    {
+        if (fork() == 0)
+      52:	e8 89 06 00 00       	call   6e0 <fork>
+      57:	85 c0                	test   %eax,%eax
+      59:	0f 84 29 01 00 00    	je     188 <bench+0x188>
+    for (i = 0; i < nproc; i++)
+      5f:	8d 43 01             	lea    0x1(%ebx),%eax
+      62:	39 c6                	cmp    %eax,%esi
+      64:	75 ea                	jne    50 <bench+0x50>
+            }
+            sh->nsys[i] = syscount() - nsys - 1;
+            exit();
+        }
+    }
+    for (i = 0; i < nproc; i++)
+      66:	31 c9                	xor    %ecx,%ecx
+      68:	89 75 0c             	mov    %esi,0xc(%ebp)
+      6b:	89 ce                	mov    %ecx,%esi
+      6d:	8d 76 00             	lea    0x0(%esi),%esi
+        wait();
+      70:	e8 b3 08 00 00       	call   928 <wait>
+    for (i = 0; i < nproc; i++)
+      75:	89 f0                	mov    %esi,%eax
+      77:	83 c6 01             	add    $0x1,%esi
+      7a:	39 c3                	cmp    %eax,%ebx
+      7c:	75 f2                	jne    70 <bench+0x70>
+    t0 = uptime() - t0;
+      7e:	8b 75 0c             	mov    0xc(%ebp),%esi
+      81:	e8 32 09 00 00       	call   9b8 <uptime>
+      86:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+      89:	29 d0                	sub    %edx,%eax
+      8b:	89 c3                	mov    %eax,%ebx
+    if (kernel)
+      8d:	85 ff                	test   %edi,%edi
+      8f:	0f 85 c3 00 00 00    	jne    158 <bench+0x158>
+        mtxdel(n);
+    nsys = 0;
+    for (i = 0; i < nproc; i++)
+        nsys += sh->nsys[i];
+      95:	8b 0d 10 22 00 00    	mov    0x2210,%ecx
+    nsys = 0;
+      9b:	31 ff                	xor    %edi,%edi
+    for (i = 0; i < nproc; i++)
+      9d:	31 c0                	xor    %eax,%eax
+      9f:	90                   	nop
+        nsys += sh->nsys[i];
+      a0:	03 7c 81 08          	add    0x8(%ecx,%eax,4),%edi
+    for (i = 0; i < nproc; i++)
+      a4:	83 c0 01             	add    $0x1,%eax
+      a7:	39 c6                	cmp    %eax,%esi
+      a9:	75 f5                	jne    a0 <bench+0xa0>
+    if (sh->count != nproc * NITER)
+      ab:	8b 41 04             	mov    0x4(%ecx),%eax
+      ae:	69 ce d0 07 00 00    	imul   $0x7d0,%esi,%ecx
+      b4:	39 c8                	cmp    %ecx,%eax
+      b6:	74 17                	je     cf <bench+0xcf>
+        printf(1, "mutextest: %s: count %d, expected %d\n", name, sh->count, nproc * NITER);
+      b8:	83 ec 0c             	sub    $0xc,%esp
+      bb:	51                   	push   %ecx
+      bc:	50                   	push   %eax
+      bd:	ff 75 08             	push   0x8(%ebp)
+      c0:	68 d8 12 00 00       	push   $0x12d8
+      c5:	6a 01                	push   $0x1
+      c7:	e8 d4 0d 00 00       	call   ea0 <printf>
+      cc:	83 c4 20             	add    $0x20,%esp
+    printf(1, "mutextest: %s, %d procs x %d: %d ticks, %d syscalls\n",
+      cf:	83 ec 04             	sub    $0x4,%esp
+      d2:	57                   	push   %edi
+      d3:	53                   	push   %ebx
+      d4:	68 d0 07 00 00       	push   $0x7d0
+      d9:	56                   	push   %esi
+      da:	ff 75 08             	push   0x8(%ebp)
+      dd:	68 00 13 00 00       	push   $0x1300
+      e2:	6a 01                	push   $0x1
+      e4:	e8 b7 0d 00 00       	call   ea0 <printf>
+           name, nproc, NITER, t0, nsys);
+}
+      e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      ec:	5b                   	pop    %ebx
+      ed:	5e                   	pop    %esi
+      ee:	5f                   	pop    %edi
+      ef:	5d                   	pop    %ebp
+      f0:	c3                   	ret
+      f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    n = kernel ? mtxget() : 0;
+      f8:	e8 d3 08 00 00       	call   9d0 <mtxget>
+    umtxinit(&sh->m);
+      fd:	83 ec 0c             	sub    $0xc,%esp
+    n = kernel ? mtxget() : 0;
+     100:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    umtxinit(&sh->m);
+     103:	ff 35 10 22 00 00    	push   0x2210
+     109:	e8 82 07 00 00       	call   890 <umtxinit>
+    sh->count = 0;
+     10e:	a1 10 22 00 00       	mov    0x2210,%eax
+     113:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+    t0 = uptime();
+     11a:	e8 99 08 00 00       	call   9b8 <uptime>
+    for (i = 0; i < nproc; i++)
+     11f:	83 c4 10             	add    $0x10,%esp
+    t0 = uptime();
+     122:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    for (i = 0; i < nproc; i++)
+     125:	85 f6                	test   %esi,%esi
+     127:	0f 8f 1e ff ff ff    	jg     4b <bench+0x4b>
+    t0 = uptime() - t0;
+     12d:	e8 86 08 00 00       	call   9b8 <uptime>
+     132:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+        mtxdel(n);
+     135:	83 ec 0c             	sub    $0xc,%esp
+     138:	ff 75 e0             	push   -0x20(%ebp)
+    nsys = 0;
+     13b:	31 ff                	xor    %edi,%edi
+    t0 = uptime() - t0;
+     13d:	29 d0                	sub    %edx,%eax
+     13f:	89 c3                	mov    %eax,%ebx
+        mtxdel(n);
+     141:	e8 a2 08 00 00       	call   9e8 <mtxdel>
+        nsys += sh->nsys[i];
+     146:	8b 0d 10 22 00 00    	mov    0x2210,%ecx
+     14c:	83 c4 10             	add    $0x10,%esp
+     14f:	e9 57 ff ff ff       	jmp    ab <bench+0xab>
+     154:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        mtxdel(n);
+     158:	83 ec 0c             	sub    $0xc,%esp
+     15b:	ff 75 e0             	push   -0x20(%ebp)
+     15e:	e8 85 08 00 00       	call   9e8 <mtxdel>
+        nsys += sh->nsys[i];
+     163:	8b 0d 10 22 00 00    	mov    0x2210,%ecx
+     169:	83 c4 10             	add    $0x10,%esp
+     16c:	e9 2a ff ff ff       	jmp    9b <bench+0x9b>
+    t0 = uptime() - t0;
+     171:	e8 42 08 00 00       	call   9b8 <uptime>
+     176:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    if (sh->count != nproc * NITER)
+     179:	8b 0d 10 22 00 00    	mov    0x2210,%ecx
+    t0 = uptime() - t0;
+     17f:	29 d0                	sub    %edx,%eax
+     181:	89 c3                	mov    %eax,%ebx
+    if (kernel)
+     183:	e9 23 ff ff ff       	jmp    ab <bench+0xab>
+            nsys = syscount();
+     188:	e8 9b 08 00 00       	call   a28 <syscount>
+     18d:	be d0 07 00 00       	mov    $0x7d0,%esi
+     192:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+     195:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+     198:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+            for (j = 0; j < NITER; j++)
+     19b:	eb 25                	jmp    1c2 <bench+0x1c2>
+     19d:	8d 76 00             	lea    0x0(%esi),%esi
+                    mtxacq(n);
+     1a0:	83 ec 0c             	sub    $0xc,%esp
+     1a3:	53                   	push   %ebx
+     1a4:	e8 37 08 00 00       	call   9e0 <mtxacq>
+                sh->count++;
+     1a9:	a1 10 22 00 00       	mov    0x2210,%eax
+     1ae:	83 40 04 01          	addl   $0x1,0x4(%eax)
+                    mtxrel(n);
+     1b2:	89 1c 24             	mov    %ebx,(%esp)
+     1b5:	e8 1e 08 00 00       	call   9d8 <mtxrel>
+     1ba:	83 c4 10             	add    $0x10,%esp
+            for (j = 0; j < NITER; j++)
+     1bd:	83 ee 01             	sub    $0x1,%esi
+     1c0:	74 28                	je     1ea <bench+0x1ea>
+                if (kernel)
+     1c2:	85 ff                	test   %edi,%edi
+     1c4:	75 da                	jne    1a0 <bench+0x1a0>
+                    umtxlock(&sh->m);
+     1c6:	83 ec 0c             	sub    $0xc,%esp
+     1c9:	ff 35 10 22 00 00    	push   0x2210
+     1cf:	e8 cc 06 00 00       	call   8a0 <umtxlock>
+                sh->count++;
+     1d4:	a1 10 22 00 00       	mov    0x2210,%eax
+     1d9:	83 40 04 01          	addl   $0x1,0x4(%eax)
+                    umtxunlock(&sh->m);
+     1dd:	89 04 24             	mov    %eax,(%esp)
+     1e0:	e8 0b 07 00 00       	call   8f0 <umtxunlock>
+     1e5:	83 c4 10             	add    $0x10,%esp
+     1e8:	eb d3                	jmp    1bd <bench+0x1bd>
+            sh->nsys[i] = syscount() - nsys - 1;
+     1ea:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+     1ed:	e8 36 08 00 00       	call   a28 <syscount>
+     1f2:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     1f5:	29 d0                	sub    %edx,%eax
+     1f7:	8b 15 10 22 00 00    	mov    0x2210,%edx
+     1fd:	83 e8 01             	sub    $0x1,%eax
+     200:	89 44 9a 08          	mov    %eax,0x8(%edx,%ebx,4)
+            exit();
+     204:	e8 07 05 00 00       	call   710 <exit>
+     209:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000210 <donate>:
+
+void donate(void)
+{
+     210:	55                   	push   %ebp
+     211:	89 e5                	mov    %esp,%ebp
+     213:	56                   	push   %esi
+     214:	53                   	push   %ebx
+    int n = mtxget();
+     215:	e8 b6 07 00 00       	call   9d0 <mtxget>
+     21a:	89 c6                	mov    %eax,%esi
+    int pid = fork();
+     21c:	e8 bf 04 00 00       	call   6e0 <fork>
+    if (pid == 0)
+     221:	85 c0                	test   %eax,%eax
+     223:	75 3f                	jne    264 <donate+0x54>
+    {
+        printf(1, "infinate loop start with nice %d!\n", nice(getpid(), 0));
+     225:	e8 76 07 00 00       	call   9a0 <getpid>
+     22a:	53                   	push   %ebx
+     22b:	53                   	push   %ebx
+     22c:	6a 00                	push   $0x0
+     22e:	50                   	push   %eax
+     22f:	e8 94 07 00 00       	call   9c8 <nice>
+     234:	83 c4 0c             	add    $0xc,%esp
+     237:	50                   	push   %eax
+     238:	68 38 13 00 00       	push   $0x1338
+     23d:	6a 01                	push   $0x1
+     23f:	e8 5c 0c 00 00       	call   ea0 <printf>
+     244:	83 c4 10             	add    $0x10,%esp
+     247:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     24e:	66 90                	xchg   %ax,%ax
+        for (;;)
+        {
+            printf(1, "");
+     250:	83 ec 08             	sub    $0x8,%esp
+     253:	68 16 14 00 00       	push   $0x1416
+     258:	6a 01                	push   $0x1
+     25a:	e8 41 0c 00 00       	call   ea0 <printf>
+     25f:	83 c4 10             	add    $0x10,%esp
+     262:	eb ec                	jmp    250 <donate+0x40>
+        }
+        exit();
+    }
+    pid = fork();
+     264:	e8 77 04 00 00       	call   6e0 <fork>
+    if (pid)
+     269:	85 c0                	test   %eax,%eax
+     26b:	0f 84 8e 00 00 00    	je     2ff <donate+0xef>
+    {
+        pid = getpid();
+     271:	e8 2a 07 00 00       	call   9a0 <getpid>
+        nice(pid, 10);
+     276:	52                   	push   %edx
+     277:	52                   	push   %edx
+     278:	6a 0a                	push   $0xa
+     27a:	50                   	push   %eax
+     27b:	e8 48 07 00 00       	call   9c8 <nice>
+        printf(1, "parent try to acquire mutex!\n");
+     280:	59                   	pop    %ecx
+     281:	5b                   	pop    %ebx
+     282:	68 cc 13 00 00       	push   $0x13cc
+     287:	6a 01                	push   $0x1
+        mtxacq(n);
+        printf(1, "parent acquire mutex with nice %d!\n", nice(getpid(), 0));
+     289:	bb 00 e1 f5 05       	mov    $0x5f5e100,%ebx
+        printf(1, "parent try to acquire mutex!\n");
+     28e:	e8 0d 0c 00 00       	call   ea0 <printf>
+        mtxacq(n);
+     293:	89 34 24             	mov    %esi,(%esp)
+     296:	e8 45 07 00 00       	call   9e0 <mtxacq>
+        printf(1, "parent acquire mutex with nice %d!\n", nice(getpid(), 0));
+     29b:	e8 00 07 00 00       	call   9a0 <getpid>
+     2a0:	5a                   	pop    %edx
+     2a1:	59                   	pop    %ecx
+     2a2:	6a 00                	push   $0x0
+     2a4:	50                   	push   %eax
+     2a5:	e8 1e 07 00 00       	call   9c8 <nice>
+     2aa:	83 c4 0c             	add    $0xc,%esp
+     2ad:	50                   	push   %eax
+     2ae:	68 5c 13 00 00       	push   $0x135c
+     2b3:	6a 01                	push   $0x1
+     2b5:	e8 e6 0b 00 00       	call   ea0 <printf>
+     2ba:	83 c4 10             	add    $0x10,%esp
+     2bd:	8d 76 00             	lea    0x0(%esi),%esi
+        for (int i = 0; i < 100000000; i++)
+        {
+            printf(1, "");
+     2c0:	83 ec 08             	sub    $0x8,%esp
+     2c3:	68 16 14 00 00       	push   $0x1416
+     2c8:	6a 01                	push   $0x1
+     2ca:	e8 d1 0b 00 00       	call   ea0 <printf>
+        for (int i = 0; i < 100000000; i++)
+     2cf:	83 c4 10             	add    $0x10,%esp
+     2d2:	83 eb 01             	sub    $0x1,%ebx
+     2d5:	75 e9                	jne    2c0 <donate+0xb0>
+        }
+        printf(1, "parent release mutex!\n");
+     2d7:	50                   	push   %eax
+     2d8:	50                   	push   %eax
+     2d9:	68 ea 13 00 00       	push   $0x13ea
+     2de:	6a 01                	push   $0x1
+     2e0:	e8 bb 0b 00 00       	call   ea0 <printf>
+        mtxrel(n);
+     2e5:	89 34 24             	mov    %esi,(%esp)
+     2e8:	e8 eb 06 00 00       	call   9d8 <mtxrel>
+        wait();
+     2ed:	e8 36 06 00 00       	call   928 <wait>
+        mtxdel(n);
+     2f2:	89 34 24             	mov    %esi,(%esp)
+     2f5:	e8 ee 06 00 00       	call   9e8 <mtxdel>
+     2fa:	83 c4 10             	add    $0x10,%esp
+     2fd:	eb 6b                	jmp    36a <donate+0x15a>
+    }
+    else
+    {
+        sleep(1);
+     2ff:	83 ec 0c             	sub    $0xc,%esp
+     302:	6a 01                	push   $0x1
+     304:	e8 a7 06 00 00       	call   9b0 <sleep>
+        pid = getpid();
+     309:	e8 92 06 00 00       	call   9a0 <getpid>
+        printf(1, "child try to acquire mutex with nice %d!\n", nice(getpid(), 0));
+     30e:	e8 8d 06 00 00       	call   9a0 <getpid>
+     313:	5a                   	pop    %edx
+     314:	59                   	pop    %ecx
+     315:	6a 00                	push   $0x0
+     317:	50                   	push   %eax
+     318:	e8 ab 06 00 00       	call   9c8 <nice>
+     31d:	83 c4 0c             	add    $0xc,%esp
+     320:	50                   	push   %eax
+     321:	68 80 13 00 00       	push   $0x1380
+     326:	6a 01                	push   $0x1
+     328:	e8 73 0b 00 00       	call   ea0 <printf>
+        mtxacq(n);
+     32d:	89 34 24             	mov    %esi,(%esp)
+     330:	e8 ab 06 00 00       	call   9e0 <mtxacq>
+        printf(1, "child acquire mutex!\n");
+     335:	5b                   	pop    %ebx
+     336:	58                   	pop    %eax
+     337:	68 01 14 00 00       	push   $0x1401
+     33c:	6a 01                	push   $0x1
+     33e:	e8 5d 0b 00 00       	call   ea0 <printf>
+        printf(1, "child release mutex!\n");
+     343:	58                   	pop    %eax
+     344:	5a                   	pop    %edx
+     345:	68 17 14 00 00       	push   $0x1417
+     34a:	6a 01                	push   $0x1
+     34c:	e8 4f 0b 00 00       	call   ea0 <printf>
+        mtxrel(n);
+     351:	89 34 24             	mov    %esi,(%esp)
+     354:	e8 7f 06 00 00       	call   9d8 <mtxrel>
+        printf(1, "child complete\n");
+     359:	59                   	pop    %ecx
+     35a:	5b                   	pop    %ebx
+     35b:	68 2d 14 00 00       	push   $0x142d
+     360:	6a 01                	push   $0x1
+     362:	e8 39 0b 00 00       	call   ea0 <printf>
+     367:	83 c4 10             	add    $0x10,%esp
+    }
+    exit();
+     36a:	e8 a1 03 00 00       	call   710 <exit>
+     36f:	90                   	nop
+
+00000370 <main>:
+}
+
+int main(int argc, char *argv[])
+{
+     370:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     374:	83 e4 f0             	and    $0xfffffff0,%esp
+     377:	ff 71 fc             	push   -0x4(%ecx)
+     37a:	55                   	push   %ebp
+     37b:	89 e5                	mov    %esp,%ebp
+     37d:	53                   	push   %ebx
+     37e:	51                   	push   %ecx
+    int id, nproc;
+
+    if (argc > 1 && strcmp(argv[1], "donate") == 0)
+     37f:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+     382:	8b 41 04             	mov    0x4(%ecx),%eax
+    if (argc > 1 && strcmp(argv[1], "donate") == 0)
+     385:	7e 1a                	jle    3a1 <main+0x31>
+     387:	52                   	push   %edx
+     388:	52                   	push   %edx
+     389:	68 3d 14 00 00       	push   $0x143d
+     38e:	ff 70 04             	push   0x4(%eax)
+     391:	e8 da 00 00 00       	call   470 <strcmp>
+     396:	83 c4 10             	add    $0x10,%esp
+     399:	85 c0                	test   %eax,%eax
+     39b:	0f 84 90 00 00 00    	je     431 <main+0xc1>
+        donate();
+    if ((id = shmget(0, sizeof(*sh))) < 0 || (sh = shmat(id)) == (void*)-1)
+     3a1:	83 ec 08             	sub    $0x8,%esp
+     3a4:	6a 28                	push   $0x28
+     3a6:	6a 00                	push   $0x0
+     3a8:	e8 5b 06 00 00       	call   a08 <shmget>
+     3ad:	83 c4 10             	add    $0x10,%esp
+     3b0:	89 c3                	mov    %eax,%ebx
+     3b2:	85 c0                	test   %eax,%eax
+     3b4:	78 68                	js     41e <main+0xae>
+     3b6:	83 ec 0c             	sub    $0xc,%esp
+     3b9:	50                   	push   %eax
+     3ba:	e8 51 06 00 00       	call   a10 <shmat>
+     3bf:	83 c4 10             	add    $0x10,%esp
+     3c2:	a3 10 22 00 00       	mov    %eax,0x2210
+     3c7:	83 c0 01             	add    $0x1,%eax
+     3ca:	74 52                	je     41e <main+0xae>
+    {
+        printf(1, "mutextest: shmget/shmat failed\n");
+        exit();
+    }
+    shmdel(id);
+     3cc:	83 ec 0c             	sub    $0xc,%esp
+     3cf:	53                   	push   %ebx
+     3d0:	e8 4b 06 00 00       	call   a20 <shmdel>
+    for (nproc = 1; nproc <= 4; nproc *= 4)
+    {
+        bench("mtxacq", nproc, 1);
+     3d5:	83 c4 0c             	add    $0xc,%esp
+     3d8:	6a 01                	push   $0x1
+     3da:	6a 01                	push   $0x1
+     3dc:	68 44 14 00 00       	push   $0x1444
+     3e1:	e8 1a fc ff ff       	call   0 <bench>
+        bench("umtxlock", nproc, 0);
+     3e6:	83 c4 0c             	add    $0xc,%esp
+     3e9:	6a 00                	push   $0x0
+     3eb:	6a 01                	push   $0x1
+     3ed:	68 4b 14 00 00       	push   $0x144b
+     3f2:	e8 09 fc ff ff       	call   0 <bench>
+        bench("mtxacq", nproc, 1);
+     3f7:	83 c4 0c             	add    $0xc,%esp
+     3fa:	6a 01                	push   $0x1
+     3fc:	6a 04                	push   $0x4
+     3fe:	68 44 14 00 00       	push   $0x1444
+     403:	e8 f8 fb ff ff       	call   0 <bench>
+        bench("umtxlock", nproc, 0);
+     408:	83 c4 0c             	add    $0xc,%esp
+     40b:	6a 00                	push   $0x0
+     40d:	6a 04                	push   $0x4
+     40f:	68 4b 14 00 00       	push   $0x144b
+     414:	e8 e7 fb ff ff       	call   0 <bench>
+    }
+    exit();
+     419:	e8 f2 02 00 00       	call   710 <exit>
+        printf(1, "mutextest: shmget/shmat failed\n");
+     41e:	50                   	push   %eax
+     41f:	50                   	push   %eax
+     420:	68 ac 13 00 00       	push   $0x13ac
+     425:	6a 01                	push   $0x1
+     427:	e8 74 0a 00 00       	call   ea0 <printf>
+        exit();
+     42c:	e8 df 02 00 00       	call   710 <exit>
+        donate();
+     431:	e8 da fd ff ff       	call   210 <donate>
+     436:	66 90                	xchg   %ax,%ax
+     438:	66 90                	xchg   %ax,%ax
+     43a:	66 90                	xchg   %ax,%ax
+     43c:	66 90                	xchg   %ax,%ax
+     43e:	66 90                	xchg   %ax,%ax
+
+00000440 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     440:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     441:	31 c0                	xor    %eax,%eax
+{
+     443:	89 e5                	mov    %esp,%ebp
+     445:	53                   	push   %ebx
+     446:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     449:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     44c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     450:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     454:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     457:	83 c0 01             	add    $0x1,%eax
+     45a:	84 d2                	test   %dl,%dl
+     45c:	75 f2                	jne    450 <strcpy+0x10>
+    ;
+  return os;
+}
+     45e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     461:	89 c8                	mov    %ecx,%eax
+     463:	c9                   	leave
+     464:	c3                   	ret
+     465:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     46c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000470 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     470:	55                   	push   %ebp
+     471:	89 e5                	mov    %esp,%ebp
+     473:	53                   	push   %ebx
+     474:	8b 55 08             	mov    0x8(%ebp),%edx
+     477:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     47a:	0f b6 02             	movzbl (%edx),%eax
+     47d:	84 c0                	test   %al,%al
+     47f:	75 17                	jne    498 <strcmp+0x28>
+     481:	eb 3a                	jmp    4bd <strcmp+0x4d>
+     483:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     487:	90                   	nop
+     488:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     48c:	83 c2 01             	add    $0x1,%edx
+     48f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     492:	84 c0                	test   %al,%al
+     494:	74 1a                	je     4b0 <strcmp+0x40>
+    p++, q++;
+     496:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     498:	0f b6 19             	movzbl (%ecx),%ebx
+     49b:	38 c3                	cmp    %al,%bl
+     49d:	74 e9                	je     488 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     49f:	29 d8                	sub    %ebx,%eax
+}
+     4a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     4a4:	c9                   	leave
+     4a5:	c3                   	ret
+     4a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4ad:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     4b0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     4b4:	31 c0                	xor    %eax,%eax
+     4b6:	29 d8                	sub    %ebx,%eax
+}
+     4b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     4bb:	c9                   	leave
+     4bc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     4bd:	0f b6 19             	movzbl (%ecx),%ebx
+     4c0:	31 c0                	xor    %eax,%eax
+     4c2:	eb db                	jmp    49f <strcmp+0x2f>
+     4c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     4cf:	90                   	nop
+
+000004d0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     4d0:	55                   	push   %ebp
+     4d1:	89 e5                	mov    %esp,%ebp
+     4d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     4d6:	80 3a 00             	cmpb   $0x0,(%edx)
+     4d9:	74 15                	je     4f0 <strlen+0x20>
+     4db:	31 c0                	xor    %eax,%eax
+     4dd:	8d 76 00             	lea    0x0(%esi),%esi
+     4e0:	83 c0 01             	add    $0x1,%eax
+     4e3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     4e7:	89 c1                	mov    %eax,%ecx
+     4e9:	75 f5                	jne    4e0 <strlen+0x10>
+    ;
+  return n;
+}
+     4eb:	89 c8                	mov    %ecx,%eax
+     4ed:	5d                   	pop    %ebp
+     4ee:	c3                   	ret
+     4ef:	90                   	nop
+  for(n = 0; s[n]; n++)
+     4f0:	31 c9                	xor    %ecx,%ecx
+}
+     4f2:	5d                   	pop    %ebp
+     4f3:	89 c8                	mov    %ecx,%eax
+     4f5:	c3                   	ret
+     4f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000500 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     500:	55                   	push   %ebp
+     501:	89 e5                	mov    %esp,%ebp
+     503:	57                   	push   %edi
+     504:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     507:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     50a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     50d:	89 d7                	mov    %edx,%edi
+     50f:	fc                   	cld
+     510:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     512:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     515:	89 d0                	mov    %edx,%eax
+     517:	c9                   	leave
+     518:	c3                   	ret
+     519:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000520 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     520:	55                   	push   %ebp
+     521:	89 e5                	mov    %esp,%ebp
+     523:	56                   	push   %esi
+     524:	53                   	push   %ebx
+     525:	8b 75 10             	mov    0x10(%ebp),%esi
+     528:	8b 55 08             	mov    0x8(%ebp),%edx
+     52b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+     52e:	85 f6                	test   %esi,%esi
+     530:	74 2e                	je     560 <memcmp+0x40>
+     532:	01 c6                	add    %eax,%esi
+     534:	eb 14                	jmp    54a <memcmp+0x2a>
+     536:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     53d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+     540:	83 c0 01             	add    $0x1,%eax
+     543:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+     546:	39 f0                	cmp    %esi,%eax
+     548:	74 16                	je     560 <memcmp+0x40>
+    if(*s1 != *s2)
+     54a:	0f b6 0a             	movzbl (%edx),%ecx
+     54d:	0f b6 18             	movzbl (%eax),%ebx
+     550:	38 d9                	cmp    %bl,%cl
+     552:	74 ec                	je     540 <memcmp+0x20>
+      return *s1 - *s2;
+     554:	0f b6 c1             	movzbl %cl,%eax
+     557:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+     559:	5b                   	pop    %ebx
+     55a:	5e                   	pop    %esi
+     55b:	5d                   	pop    %ebp
+     55c:	c3                   	ret
+     55d:	8d 76 00             	lea    0x0(%esi),%esi
+     560:	5b                   	pop    %ebx
+  return 0;
+     561:	31 c0                	xor    %eax,%eax
+}
+     563:	5e                   	pop    %esi
+     564:	5d                   	pop    %ebp
+     565:	c3                   	ret
+     566:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     56d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000570 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     570:	55                   	push   %ebp
+     571:	89 e5                	mov    %esp,%ebp
+     573:	8b 45 08             	mov    0x8(%ebp),%eax
+     576:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     57a:	0f b6 10             	movzbl (%eax),%edx
+     57d:	84 d2                	test   %dl,%dl
+     57f:	75 12                	jne    593 <strchr+0x23>
+     581:	eb 1d                	jmp    5a0 <strchr+0x30>
+     583:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     587:	90                   	nop
+     588:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     58c:	83 c0 01             	add    $0x1,%eax
+     58f:	84 d2                	test   %dl,%dl
+     591:	74 0d                	je     5a0 <strchr+0x30>
+    if(*s == c)
+     593:	38 d1                	cmp    %dl,%cl
+     595:	75 f1                	jne    588 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     597:	5d                   	pop    %ebp
+     598:	c3                   	ret
+     599:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     5a0:	31 c0                	xor    %eax,%eax
+}
+     5a2:	5d                   	pop    %ebp
+     5a3:	c3                   	ret
+     5a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     5af:	90                   	nop
+
+000005b0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     5b0:	55                   	push   %ebp
+     5b1:	89 e5                	mov    %esp,%ebp
+     5b3:	57                   	push   %edi
+     5b4:	56                   	push   %esi
+int
+read(int fd, void *buf, int n)
+{
+  if(flushhook)
+    flushhook();
+  return _read(fd, buf, n);
+     5b5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     5b8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     5b9:	31 db                	xor    %ebx,%ebx
+{
+     5bb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     5be:	eb 32                	jmp    5f2 <gets+0x42>
+  if(flushhook)
+     5c0:	a1 14 22 00 00       	mov    0x2214,%eax
+     5c5:	85 c0                	test   %eax,%eax
+     5c7:	74 02                	je     5cb <gets+0x1b>
+    flushhook();
+     5c9:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+     5cb:	83 ec 04             	sub    $0x4,%esp
+     5ce:	6a 01                	push   $0x1
+     5d0:	56                   	push   %esi
+     5d1:	6a 00                	push   $0x0
+     5d3:	e8 60 03 00 00       	call   938 <_read>
+    if(cc < 1)
+     5d8:	83 c4 10             	add    $0x10,%esp
+     5db:	85 c0                	test   %eax,%eax
+     5dd:	7e 1d                	jle    5fc <gets+0x4c>
+    buf[i++] = c;
+     5df:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     5e3:	8b 55 08             	mov    0x8(%ebp),%edx
+     5e6:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     5ea:	3c 0a                	cmp    $0xa,%al
+     5ec:	74 10                	je     5fe <gets+0x4e>
+     5ee:	3c 0d                	cmp    $0xd,%al
+     5f0:	74 0c                	je     5fe <gets+0x4e>
+  for(i=0; i+1 < max; ){
+     5f2:	89 df                	mov    %ebx,%edi
+     5f4:	83 c3 01             	add    $0x1,%ebx
+     5f7:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     5fa:	7c c4                	jl     5c0 <gets+0x10>
+     5fc:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+     5fe:	8b 45 08             	mov    0x8(%ebp),%eax
+     601:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+     605:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     608:	5b                   	pop    %ebx
+     609:	5e                   	pop    %esi
+     60a:	5f                   	pop    %edi
+     60b:	5d                   	pop    %ebp
+     60c:	c3                   	ret
+     60d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000610 <stat>:
+{
+     610:	55                   	push   %ebp
+     611:	89 e5                	mov    %esp,%ebp
+     613:	56                   	push   %esi
+     614:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+     615:	83 ec 08             	sub    $0x8,%esp
+     618:	6a 00                	push   $0x0
+     61a:	ff 75 08             	push   0x8(%ebp)
+     61d:	e8 3e 03 00 00       	call   960 <open>
+  if(fd < 0)
+     622:	83 c4 10             	add    $0x10,%esp
+     625:	85 c0                	test   %eax,%eax
+     627:	78 37                	js     660 <stat+0x50>
+  r = fstat(fd, st);
+     629:	83 ec 08             	sub    $0x8,%esp
+     62c:	ff 75 0c             	push   0xc(%ebp)
+     62f:	89 c3                	mov    %eax,%ebx
+     631:	50                   	push   %eax
+     632:	e8 41 03 00 00       	call   978 <fstat>
+}
+
+int
+close(int fd)
+{
+  if(flushhook)
+     637:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+     63a:	89 c6                	mov    %eax,%esi
+  if(flushhook)
+     63c:	a1 14 22 00 00       	mov    0x2214,%eax
+     641:	85 c0                	test   %eax,%eax
+     643:	74 02                	je     647 <stat+0x37>
+    flushhook();
+     645:	ff d0                	call   *%eax
+  return _close(fd);
+     647:	83 ec 0c             	sub    $0xc,%esp
+     64a:	53                   	push   %ebx
+     64b:	e8 f8 02 00 00       	call   948 <_close>
+     650:	83 c4 10             	add    $0x10,%esp
+}
+     653:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     656:	89 f0                	mov    %esi,%eax
+     658:	5b                   	pop    %ebx
+     659:	5e                   	pop    %esi
+     65a:	5d                   	pop    %ebp
+     65b:	c3                   	ret
+     65c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+     660:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     665:	eb ec                	jmp    653 <stat+0x43>
+     667:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     66e:	66 90                	xchg   %ax,%ax
+
+00000670 <atoi>:
+{
+     670:	55                   	push   %ebp
+     671:	89 e5                	mov    %esp,%ebp
+     673:	53                   	push   %ebx
+     674:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+     677:	0f be 02             	movsbl (%edx),%eax
+     67a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     67d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     680:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     685:	77 1e                	ja     6a5 <atoi+0x35>
+     687:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     68e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     690:	83 c2 01             	add    $0x1,%edx
+     693:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     696:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     69a:	0f be 02             	movsbl (%edx),%eax
+     69d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     6a0:	80 fb 09             	cmp    $0x9,%bl
+     6a3:	76 eb                	jbe    690 <atoi+0x20>
+}
+     6a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     6a8:	89 c8                	mov    %ecx,%eax
+     6aa:	c9                   	leave
+     6ab:	c3                   	ret
+     6ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006b0 <memmove>:
+{
+     6b0:	55                   	push   %ebp
+     6b1:	89 e5                	mov    %esp,%ebp
+     6b3:	57                   	push   %edi
+     6b4:	56                   	push   %esi
+     6b5:	8b 45 10             	mov    0x10(%ebp),%eax
+     6b8:	8b 55 08             	mov    0x8(%ebp),%edx
+     6bb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+     6be:	85 c0                	test   %eax,%eax
+     6c0:	7e 13                	jle    6d5 <memmove+0x25>
+     6c2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     6c4:	89 d7                	mov    %edx,%edi
+     6c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6cd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     6d0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     6d1:	39 f8                	cmp    %edi,%eax
+     6d3:	75 fb                	jne    6d0 <memmove+0x20>
+}
+     6d5:	5e                   	pop    %esi
+     6d6:	89 d0                	mov    %edx,%eax
+     6d8:	5f                   	pop    %edi
+     6d9:	5d                   	pop    %ebp
+     6da:	c3                   	ret
+     6db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     6df:	90                   	nop
+
+000006e0 <fork>:
+  if(flushhook)
+     6e0:	a1 14 22 00 00       	mov    0x2214,%eax
+     6e5:	85 c0                	test   %eax,%eax
+     6e7:	74 17                	je     700 <fork+0x20>
+{
+     6e9:	55                   	push   %ebp
+     6ea:	89 e5                	mov    %esp,%ebp
+     6ec:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+     6ef:	ff d0                	call   *%eax
+}
+     6f1:	c9                   	leave
+  return _fork();
+     6f2:	e9 21 02 00 00       	jmp    918 <_fork>
+     6f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6fe:	66 90                	xchg   %ax,%ax
+     700:	e9 13 02 00 00       	jmp    918 <_fork>
+     705:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     70c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000710 <exit>:
+{
+     710:	55                   	push   %ebp
+     711:	89 e5                	mov    %esp,%ebp
+     713:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+     716:	a1 14 22 00 00       	mov    0x2214,%eax
+     71b:	85 c0                	test   %eax,%eax
+     71d:	74 02                	je     721 <exit+0x11>
+    flushhook();
+     71f:	ff d0                	call   *%eax
+  _exit();
+     721:	e8 fa 01 00 00       	call   920 <_exit>
+     726:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     72d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000730 <exec>:
+{
+     730:	55                   	push   %ebp
+  if(flushhook)
+     731:	a1 14 22 00 00       	mov    0x2214,%eax
+{
+     736:	89 e5                	mov    %esp,%ebp
+     738:	56                   	push   %esi
+     739:	53                   	push   %ebx
+     73a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     73d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+     740:	85 c0                	test   %eax,%eax
+     742:	74 02                	je     746 <exec+0x16>
+    flushhook();
+     744:	ff d0                	call   *%eax
+  return _exec(path, argv);
+     746:	89 75 0c             	mov    %esi,0xc(%ebp)
+     749:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     74c:	5b                   	pop    %ebx
+     74d:	5e                   	pop    %esi
+     74e:	5d                   	pop    %ebp
+  return _exec(path, argv);
+     74f:	e9 04 02 00 00       	jmp    958 <_exec>
+     754:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     75b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     75f:	90                   	nop
+
+00000760 <read>:
+{
+     760:	55                   	push   %ebp
+     761:	89 e5                	mov    %esp,%ebp
+     763:	57                   	push   %edi
+     764:	56                   	push   %esi
+     765:	53                   	push   %ebx
+     766:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     769:	a1 14 22 00 00       	mov    0x2214,%eax
+{
+     76e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     771:	8b 75 0c             	mov    0xc(%ebp),%esi
+     774:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     777:	85 c0                	test   %eax,%eax
+     779:	74 02                	je     77d <read+0x1d>
+    flushhook();
+     77b:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+     77d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     780:	89 75 0c             	mov    %esi,0xc(%ebp)
+     783:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     786:	83 c4 0c             	add    $0xc,%esp
+     789:	5b                   	pop    %ebx
+     78a:	5e                   	pop    %esi
+     78b:	5f                   	pop    %edi
+     78c:	5d                   	pop    %ebp
+  return _read(fd, buf, n);
+     78d:	e9 a6 01 00 00       	jmp    938 <_read>
+     792:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     799:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000007a0 <readv>:
+{
+     7a0:	55                   	push   %ebp
+     7a1:	89 e5                	mov    %esp,%ebp
+     7a3:	57                   	push   %edi
+     7a4:	56                   	push   %esi
+     7a5:	53                   	push   %ebx
+     7a6:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     7a9:	a1 14 22 00 00       	mov    0x2214,%eax
+{
+     7ae:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     7b1:	8b 75 0c             	mov    0xc(%ebp),%esi
+     7b4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     7b7:	85 c0                	test   %eax,%eax
+     7b9:	74 02                	je     7bd <readv+0x1d>
+    flushhook();
+     7bb:	ff d0                	call   *%eax
+  return _readv(fd, iov, cnt);
+     7bd:	89 7d 10             	mov    %edi,0x10(%ebp)
+     7c0:	89 75 0c             	mov    %esi,0xc(%ebp)
+     7c3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     7c6:	83 c4 0c             	add    $0xc,%esp
+     7c9:	5b                   	pop    %ebx
+     7ca:	5e                   	pop    %esi
+     7cb:	5f                   	pop    %edi
+     7cc:	5d                   	pop    %ebp
+  return _readv(fd, iov, cnt);
+     7cd:	e9 76 02 00 00       	jmp    a48 <_readv>
+     7d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000007e0 <write>:
+{
+     7e0:	55                   	push   %ebp
+     7e1:	89 e5                	mov    %esp,%ebp
+     7e3:	57                   	push   %edi
+     7e4:	56                   	push   %esi
+     7e5:	53                   	push   %ebx
+     7e6:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     7e9:	a1 14 22 00 00       	mov    0x2214,%eax
+{
+     7ee:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     7f1:	8b 75 0c             	mov    0xc(%ebp),%esi
+     7f4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     7f7:	85 c0                	test   %eax,%eax
+     7f9:	74 02                	je     7fd <write+0x1d>
+    flushhook();
+     7fb:	ff d0                	call   *%eax
+  return _write(fd, buf, n);
+     7fd:	89 7d 10             	mov    %edi,0x10(%ebp)
+     800:	89 75 0c             	mov    %esi,0xc(%ebp)
+     803:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     806:	83 c4 0c             	add    $0xc,%esp
+     809:	5b                   	pop    %ebx
+     80a:	5e                   	pop    %esi
+     80b:	5f                   	pop    %edi
+     80c:	5d                   	pop    %ebp
+  return _write(fd, buf, n);
+     80d:	e9 2e 01 00 00       	jmp    940 <_write>
+     812:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     819:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000820 <writev>:
+{
+     820:	55                   	push   %ebp
+     821:	89 e5                	mov    %esp,%ebp
+     823:	57                   	push   %edi
+     824:	56                   	push   %esi
+     825:	53                   	push   %ebx
+     826:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     829:	a1 14 22 00 00       	mov    0x2214,%eax
+{
+     82e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     831:	8b 75 0c             	mov    0xc(%ebp),%esi
+     834:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     837:	85 c0                	test   %eax,%eax
+     839:	74 02                	je     83d <writev+0x1d>
+    flushhook();
+     83b:	ff d0                	call   *%eax
+  return _writev(fd, iov, cnt);
+     83d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     840:	89 75 0c             	mov    %esi,0xc(%ebp)
+     843:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     846:	83 c4 0c             	add    $0xc,%esp
+     849:	5b                   	pop    %ebx
+     84a:	5e                   	pop    %esi
+     84b:	5f                   	pop    %edi
+     84c:	5d                   	pop    %ebp
+  return _writev(fd, iov, cnt);
+     84d:	e9 fe 01 00 00       	jmp    a50 <_writev>
+     852:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     859:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000860 <close>:
+{
+     860:	55                   	push   %ebp
+     861:	89 e5                	mov    %esp,%ebp
+     863:	53                   	push   %ebx
+     864:	83 ec 04             	sub    $0x4,%esp
+  if(flushhook)
+     867:	a1 14 22 00 00       	mov    0x2214,%eax
+{
+     86c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(flushhook)
+     86f:	85 c0                	test   %eax,%eax
+     871:	74 02                	je     875 <close+0x15>
+    flushhook();
+     873:	ff d0                	call   *%eax
+  return _close(fd);
+     875:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     878:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     87b:	c9                   	leave
+  return _close(fd);
+     87c:	e9 c7 00 00 00       	jmp    948 <_close>
+     881:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     888:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     88f:	90                   	nop
+
+00000890 <umtxinit>:
+// process that finds the mutex held enters the kernel, to sleep
+// in futexwait() until the holder's umtxunlock() wakes it.
+
+void
+umtxinit(struct umutex *m)
+{
+     890:	55                   	push   %ebp
+     891:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+     893:	8b 45 08             	mov    0x8(%ebp),%eax
+     896:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     89c:	5d                   	pop    %ebp
+     89d:	c3                   	ret
+     89e:	66 90                	xchg   %ax,%ax
+
+000008a0 <umtxlock>:
+
+void
+umtxlock(struct umutex *m)
+{
+     8a0:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+     8a1:	b8 01 00 00 00       	mov    $0x1,%eax
+     8a6:	89 e5                	mov    %esp,%ebp
+     8a8:	56                   	push   %esi
+     8a9:	53                   	push   %ebx
+     8aa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     8ad:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 1) == 0)
+     8b0:	85 c0                	test   %eax,%eax
+     8b2:	74 2b                	je     8df <umtxlock+0x3f>
+     8b4:	b8 02 00 00 00       	mov    $0x2,%eax
+     8b9:	f0 87 03             	lock xchg %eax,(%ebx)
+    return;
+  // Mark the mutex contended, so that its holder
+  // wakes a waiter on release, and wait.
+  while(xchg(&m->state, 2) != 0)
+     8bc:	85 c0                	test   %eax,%eax
+     8be:	74 1f                	je     8df <umtxlock+0x3f>
+     8c0:	be 02 00 00 00       	mov    $0x2,%esi
+     8c5:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwait(&m->state, 2);
+     8c8:	83 ec 08             	sub    $0x8,%esp
+     8cb:	6a 02                	push   $0x2
+     8cd:	53                   	push   %ebx
+     8ce:	e8 85 01 00 00       	call   a58 <futexwait>
+     8d3:	89 f0                	mov    %esi,%eax
+     8d5:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+     8d8:	83 c4 10             	add    $0x10,%esp
+     8db:	85 c0                	test   %eax,%eax
+     8dd:	75 e9                	jne    8c8 <umtxlock+0x28>
+}
+     8df:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     8e2:	5b                   	pop    %ebx
+     8e3:	5e                   	pop    %esi
+     8e4:	5d                   	pop    %ebp
+     8e5:	c3                   	ret
+     8e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000008f0 <umtxunlock>:
+
+void
+umtxunlock(struct umutex *m)
+{
+     8f0:	55                   	push   %ebp
+     8f1:	31 c0                	xor    %eax,%eax
+     8f3:	89 e5                	mov    %esp,%ebp
+     8f5:	83 ec 08             	sub    $0x8,%esp
+     8f8:	8b 55 08             	mov    0x8(%ebp),%edx
+     8fb:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+     8fe:	83 f8 02             	cmp    $0x2,%eax
+     901:	74 05                	je     908 <umtxunlock+0x18>
+    futexwake(&m->state, 1);
+}
+     903:	c9                   	leave
+     904:	c3                   	ret
+     905:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwake(&m->state, 1);
+     908:	83 ec 08             	sub    $0x8,%esp
+     90b:	6a 01                	push   $0x1
+     90d:	52                   	push   %edx
+     90e:	e8 4d 01 00 00       	call   a60 <futexwake>
+     913:	83 c4 10             	add    $0x10,%esp
+}
+     916:	c9                   	leave
+     917:	c3                   	ret
+
+00000918 <_fork>:
+  _ ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+     918:	b8 01 00 00 00       	mov    $0x1,%eax
+     91d:	cd 40                	int    $0x40
+     91f:	c3                   	ret
+
+00000920 <_exit>:
+RAWSYSCALL(exit)
+     920:	b8 02 00 00 00       	mov    $0x2,%eax
+     925:	cd 40                	int    $0x40
+     927:	c3                   	ret
+
+00000928 <wait>:
+SYSCALL(wait)
+     928:	b8 03 00 00 00       	mov    $0x3,%eax
+     92d:	cd 40                	int    $0x40
+     92f:	c3                   	ret
+
+00000930 <pipe>:
+SYSCALL(pipe)
+     930:	b8 04 00 00 00       	mov    $0x4,%eax
+     935:	cd 40                	int    $0x40
+     937:	c3                   	ret
+
+00000938 <_read>:
+RAWSYSCALL(read)
+     938:	b8 05 00 00 00       	mov    $0x5,%eax
+     93d:	cd 40                	int    $0x40
+     93f:	c3                   	ret
+
+00000940 <_write>:
+RAWSYSCALL(write)
+     940:	b8 10 00 00 00       	mov    $0x10,%eax
+     945:	cd 40                	int    $0x40
+     947:	c3                   	ret
+
+00000948 <_close>:
+RAWSYSCALL(close)
+     948:	b8 15 00 00 00       	mov    $0x15,%eax
+     94d:	cd 40                	int    $0x40
+     94f:	c3                   	ret
+
+00000950 <kill>:
+SYSCALL(kill)
+     950:	b8 06 00 00 00       	mov    $0x6,%eax
+     955:	cd 40                	int    $0x40
+     957:	c3                   	ret
+
+00000958 <_exec>:
+RAWSYSCALL(exec)
+     958:	b8 07 00 00 00       	mov    $0x7,%eax
+     95d:	cd 40                	int    $0x40
+     95f:	c3                   	ret
+
+00000960 <open>:
+SYSCALL(open)
+     960:	b8 0f 00 00 00       	mov    $0xf,%eax
+     965:	cd 40                	int    $0x40
+     967:	c3                   	ret
+
+00000968 <mknod>:
+SYSCALL(mknod)
+     968:	b8 11 00 00 00       	mov    $0x11,%eax
+     96d:	cd 40                	int    $0x40
+     96f:	c3                   	ret
+
+00000970 <unlink>:
+SYSCALL(unlink)
+     970:	b8 12 00 00 00       	mov    $0x12,%eax
+     975:	cd 40                	int    $0x40
+     977:	c3                   	ret
+
+00000978 <fstat>:
+SYSCALL(fstat)
+     978:	b8 08 00 00 00       	mov    $0x8,%eax
+     97d:	cd 40                	int    $0x40
+     97f:	c3                   	ret
+
+00000980 <link>:
+SYSCALL(link)
+     980:	b8 13 00 00 00       	mov    $0x13,%eax
+     985:	cd 40                	int    $0x40
+     987:	c3                   	ret
+
+00000988 <mkdir>:
+SYSCALL(mkdir)
+     988:	b8 14 00 00 00       	mov    $0x14,%eax
+     98d:	cd 40                	int    $0x40
+     98f:	c3                   	ret
+
+00000990 <chdir>:
+SYSCALL(chdir)
+     990:	b8 09 00 00 00       	mov    $0x9,%eax
+     995:	cd 40                	int    $0x40
+     997:	c3                   	ret
+
+00000998 <dup>:
+SYSCALL(dup)
+     998:	b8 0a 00 00 00       	mov    $0xa,%eax
+     99d:	cd 40                	int    $0x40
+     99f:	c3                   	ret
+
+000009a0 <getpid>:
+SYSCALL(getpid)
+     9a0:	b8 0b 00 00 00       	mov    $0xb,%eax
+     9a5:	cd 40                	int    $0x40
+     9a7:	c3                   	ret
+
+000009a8 <sbrk>:
+SYSCALL(sbrk)
+     9a8:	b8 0c 00 00 00       	mov    $0xc,%eax
+     9ad:	cd 40                	int    $0x40
+     9af:	c3                   	ret
+
+000009b0 <sleep>:
+SYSCALL(sleep)
+     9b0:	b8 0d 00 00 00       	mov    $0xd,%eax
+     9b5:	cd 40                	int    $0x40
+     9b7:	c3                   	ret
+
+000009b8 <uptime>:
+SYSCALL(uptime)
+     9b8:	b8 0e 00 00 00       	mov    $0xe,%eax
+     9bd:	cd 40                	int    $0x40
+     9bf:	c3                   	ret
+
+000009c0 <wolfie>:
+SYSCALL(wolfie)
+     9c0:	b8 16 00 00 00       	mov    $0x16,%eax
+     9c5:	cd 40                	int    $0x40
+     9c7:	c3                   	ret
+
+000009c8 <nice>:
+SYSCALL(nice)
+     9c8:	b8 17 00 00 00       	mov    $0x17,%eax
+     9cd:	cd 40                	int    $0x40
+     9cf:	c3                   	ret
+
+000009d0 <mtxget>:
+SYSCALL(mtxget)
+     9d0:	b8 18 00 00 00       	mov    $0x18,%eax
+     9d5:	cd 40                	int    $0x40
+     9d7:	c3                   	ret
+
+000009d8 <mtxrel>:
+SYSCALL(mtxrel)
+     9d8:	b8 19 00 00 00       	mov    $0x19,%eax
+     9dd:	cd 40                	int    $0x40
+     9df:	c3                   	ret
+
+000009e0 <mtxacq>:
+SYSCALL(mtxacq)
+     9e0:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     9e5:	cd 40                	int    $0x40
+     9e7:	c3                   	ret
+
+000009e8 <mtxdel>:
+SYSCALL(mtxdel)
+     9e8:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     9ed:	cd 40                	int    $0x40
+     9ef:	c3                   	ret
+
+000009f0 <iostat>:
+SYSCALL(iostat)
+     9f0:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     9f5:	cd 40                	int    $0x40
+     9f7:	c3                   	ret
+
+000009f8 <mmap>:
+SYSCALL(mmap)
+     9f8:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     9fd:	cd 40                	int    $0x40
+     9ff:	c3                   	ret
+
+00000a00 <munmap>:
+SYSCALL(munmap)
+     a00:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     a05:	cd 40                	int    $0x40
+     a07:	c3                   	ret
+
+00000a08 <shmget>:
+SYSCALL(shmget)
+     a08:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     a0d:	cd 40                	int    $0x40
+     a0f:	c3                   	ret
+
+00000a10 <shmat>:
+SYSCALL(shmat)
+     a10:	b8 20 00 00 00       	mov    $0x20,%eax
+     a15:	cd 40                	int    $0x40
+     a17:	c3                   	ret
+
+00000a18 <shmdt>:
+SYSCALL(shmdt)
+     a18:	b8 21 00 00 00       	mov    $0x21,%eax
+     a1d:	cd 40                	int    $0x40
+     a1f:	c3                   	ret
+
+00000a20 <shmdel>:
+SYSCALL(shmdel)
+     a20:	b8 22 00 00 00       	mov    $0x22,%eax
+     a25:	cd 40                	int    $0x40
+     a27:	c3                   	ret
+
+00000a28 <syscount>:
+SYSCALL(syscount)
+     a28:	b8 23 00 00 00       	mov    $0x23,%eax
+     a2d:	cd 40                	int    $0x40
+     a2f:	c3                   	ret
+
+00000a30 <splice>:
+SYSCALL(splice)
+     a30:	b8 24 00 00 00       	mov    $0x24,%eax
+     a35:	cd 40                	int    $0x40
+     a37:	c3                   	ret
+
+00000a38 <tee>:
+SYSCALL(tee)
+     a38:	b8 25 00 00 00       	mov    $0x25,%eax
+     a3d:	cd 40                	int    $0x40
+     a3f:	c3                   	ret
+
+00000a40 <sendfile>:
+SYSCALL(sendfile)
+     a40:	b8 26 00 00 00       	mov    $0x26,%eax
+     a45:	cd 40                	int    $0x40
+     a47:	c3                   	ret
+
+00000a48 <_readv>:
+RAWSYSCALL(readv)
+     a48:	b8 27 00 00 00       	mov    $0x27,%eax
+     a4d:	cd 40                	int    $0x40
+     a4f:	c3                   	ret
+
+00000a50 <_writev>:
+RAWSYSCALL(writev)
+     a50:	b8 28 00 00 00       	mov    $0x28,%eax
+     a55:	cd 40                	int    $0x40
+     a57:	c3                   	ret
+
+00000a58 <futexwait>:
+SYSCALL(futexwait)
+     a58:	b8 29 00 00 00       	mov    $0x29,%eax
+     a5d:	cd 40                	int    $0x40
+     a5f:	c3                   	ret
+
+00000a60 <futexwake>:
+SYSCALL(futexwake)
+     a60:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     a65:	cd 40                	int    $0x40
+     a67:	c3                   	ret
+
+00000a68 <lockstat>:
+SYSCALL(lockstat)
+     a68:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     a6d:	cd 40                	int    $0x40
+     a6f:	c3                   	ret
+
+00000a70 <clone>:
+SYSCALL(clone)
+     a70:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     a75:	cd 40                	int    $0x40
+     a77:	c3                   	ret
+
+00000a78 <join>:
+SYSCALL(join)
+     a78:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     a7d:	cd 40                	int    $0x40
+     a7f:	c3                   	ret
+
+00000a80 <stacklimit>:
+SYSCALL(stacklimit)
+     a80:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     a85:	cd 40                	int    $0x40
+     a87:	c3                   	ret
+     a88:	66 90                	xchg   %ax,%ax
+     a8a:	66 90                	xchg   %ax,%ax
+     a8c:	66 90                	xchg   %ax,%ax
+     a8e:	66 90                	xchg   %ax,%ax
+
+00000a90 <flushall>:
+  b->n = 0;
+}
+
+static void
+flushall(void)
+{
+     a90:	55                   	push   %ebp
+     a91:	89 e5                	mov    %esp,%ebp
+     a93:	83 ec 14             	sub    $0x14,%esp
+  umtxlock(&stdoutlock);
+     a96:	68 18 22 00 00       	push   $0x2218
+     a9b:	e8 00 fe ff ff       	call   8a0 <umtxlock>
+  if(b->n > 0)
+     aa0:	a1 08 20 00 00       	mov    0x2008,%eax
+     aa5:	83 c4 10             	add    $0x10,%esp
+     aa8:	85 c0                	test   %eax,%eax
+     aaa:	7e 17                	jle    ac3 <flushall+0x33>
+    _write(b->fd, b->buf, b->n);
+     aac:	83 ec 04             	sub    $0x4,%esp
+     aaf:	50                   	push   %eax
+     ab0:	68 0c 20 00 00       	push   $0x200c
+     ab5:	ff 35 00 20 00 00    	push   0x2000
+     abb:	e8 80 fe ff ff       	call   940 <_write>
+     ac0:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     ac3:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     aca:	00 00 00 
+  flush(&stdout);
+  umtxunlock(&stdoutlock);
+     acd:	83 ec 0c             	sub    $0xc,%esp
+     ad0:	68 18 22 00 00       	push   $0x2218
+     ad5:	e8 16 fe ff ff       	call   8f0 <umtxunlock>
+}
+     ada:	83 c4 10             	add    $0x10,%esp
+     add:	c9                   	leave
+     ade:	c3                   	ret
+     adf:	90                   	nop
+
+00000ae0 <printint>:
+    flush(b);
+}
+
+static void
+printint(struct outbuf *b, int xx, int base, int sgn)
+{
+     ae0:	55                   	push   %ebp
+     ae1:	89 e5                	mov    %esp,%ebp
+     ae3:	57                   	push   %edi
+     ae4:	89 cf                	mov    %ecx,%edi
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     ae6:	89 d1                	mov    %edx,%ecx
+{
+     ae8:	56                   	push   %esi
+     ae9:	53                   	push   %ebx
+     aea:	89 c3                	mov    %eax,%ebx
+     aec:	83 ec 2c             	sub    $0x2c,%esp
+  if(sgn && xx < 0){
+     aef:	85 d2                	test   %edx,%edx
+     af1:	0f 89 b9 00 00 00    	jns    bb0 <printint+0xd0>
+     af7:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     afb:	0f 84 af 00 00 00    	je     bb0 <printint+0xd0>
+    x = -xx;
+     b01:	f7 d9                	neg    %ecx
+    neg = 1;
+     b03:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     b08:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     b0b:	31 f6                	xor    %esi,%esi
+     b0d:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     b10:	89 c8                	mov    %ecx,%eax
+     b12:	31 d2                	xor    %edx,%edx
+     b14:	89 f3                	mov    %esi,%ebx
+     b16:	f7 f7                	div    %edi
+     b18:	8d 76 01             	lea    0x1(%esi),%esi
+     b1b:	0f b6 92 a8 18 00 00 	movzbl 0x18a8(%edx),%edx
+     b22:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     b26:	89 ca                	mov    %ecx,%edx
+     b28:	89 c1                	mov    %eax,%ecx
+     b2a:	39 fa                	cmp    %edi,%edx
+     b2c:	73 e2                	jae    b10 <printint+0x30>
+  if(neg)
+     b2e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     b31:	89 d9                	mov    %ebx,%ecx
+     b33:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     b36:	85 c0                	test   %eax,%eax
+     b38:	74 07                	je     b41 <printint+0x61>
+    buf[i++] = '-';
+     b3a:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     b3f:	89 f1                	mov    %esi,%ecx
+     b41:	8d 75 d8             	lea    -0x28(%ebp),%esi
+     b44:	89 cf                	mov    %ecx,%edi
+     b46:	01 f7                	add    %esi,%edi
+     b48:	eb 1a                	jmp    b64 <printint+0x84>
+     b4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    *b->str++ = c;
+     b50:	8d 48 01             	lea    0x1(%eax),%ecx
+     b53:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+     b59:	88 10                	mov    %dl,(%eax)
+
+  while(--i >= 0)
+     b5b:	8d 47 ff             	lea    -0x1(%edi),%eax
+     b5e:	39 fe                	cmp    %edi,%esi
+     b60:	74 40                	je     ba2 <printint+0xc2>
+     b62:	89 c7                	mov    %eax,%edi
+  if(b->str){
+     b64:	8b 83 0c 02 00 00    	mov    0x20c(%ebx),%eax
+    putc(b, buf[i]);
+     b6a:	0f b6 17             	movzbl (%edi),%edx
+  if(b->str){
+     b6d:	85 c0                	test   %eax,%eax
+     b6f:	75 df                	jne    b50 <printint+0x70>
+  b->buf[b->n++] = c;
+     b71:	8b 4b 08             	mov    0x8(%ebx),%ecx
+     b74:	8d 41 01             	lea    0x1(%ecx),%eax
+     b77:	89 43 08             	mov    %eax,0x8(%ebx)
+     b7a:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+     b7e:	3d 00 02 00 00       	cmp    $0x200,%eax
+     b83:	74 3b                	je     bc0 <printint+0xe0>
+     b85:	80 fa 0a             	cmp    $0xa,%dl
+     b88:	75 d1                	jne    b5b <printint+0x7b>
+     b8a:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+     b8e:	75 cb                	jne    b5b <printint+0x7b>
+  if(b->n > 0)
+     b90:	85 c0                	test   %eax,%eax
+     b92:	7f 2c                	jg     bc0 <printint+0xe0>
+  b->n = 0;
+     b94:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  while(--i >= 0)
+     b9b:	8d 47 ff             	lea    -0x1(%edi),%eax
+     b9e:	39 fe                	cmp    %edi,%esi
+     ba0:	75 c0                	jne    b62 <printint+0x82>
+}
+     ba2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ba5:	5b                   	pop    %ebx
+     ba6:	5e                   	pop    %esi
+     ba7:	5f                   	pop    %edi
+     ba8:	5d                   	pop    %ebp
+     ba9:	c3                   	ret
+     baa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  neg = 0;
+     bb0:	31 c0                	xor    %eax,%eax
+     bb2:	e9 51 ff ff ff       	jmp    b08 <printint+0x28>
+     bb7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bbe:	66 90                	xchg   %ax,%ax
+    _write(b->fd, b->buf, b->n);
+     bc0:	83 ec 04             	sub    $0x4,%esp
+     bc3:	50                   	push   %eax
+     bc4:	8d 43 0c             	lea    0xc(%ebx),%eax
+     bc7:	50                   	push   %eax
+     bc8:	ff 33                	push   (%ebx)
+     bca:	e8 71 fd ff ff       	call   940 <_write>
+     bcf:	83 c4 10             	add    $0x10,%esp
+     bd2:	eb c0                	jmp    b94 <printint+0xb4>
+     bd4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bdb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     bdf:	90                   	nop
+
+00000be0 <putc>:
+{
+     be0:	55                   	push   %ebp
+     be1:	89 e5                	mov    %esp,%ebp
+     be3:	53                   	push   %ebx
+     be4:	89 c3                	mov    %eax,%ebx
+     be6:	83 ec 04             	sub    $0x4,%esp
+  if(b->str){
+     be9:	8b 80 0c 02 00 00    	mov    0x20c(%eax),%eax
+     bef:	85 c0                	test   %eax,%eax
+     bf1:	74 15                	je     c08 <putc+0x28>
+    *b->str++ = c;
+     bf3:	8d 48 01             	lea    0x1(%eax),%ecx
+     bf6:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+     bfc:	88 10                	mov    %dl,(%eax)
+}
+     bfe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     c01:	c9                   	leave
+     c02:	c3                   	ret
+     c03:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c07:	90                   	nop
+  b->buf[b->n++] = c;
+     c08:	8b 4b 08             	mov    0x8(%ebx),%ecx
+     c0b:	8d 41 01             	lea    0x1(%ecx),%eax
+     c0e:	89 43 08             	mov    %eax,0x8(%ebx)
+     c11:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+     c15:	3d 00 02 00 00       	cmp    $0x200,%eax
+     c1a:	74 14                	je     c30 <putc+0x50>
+     c1c:	80 fa 0a             	cmp    $0xa,%dl
+     c1f:	75 dd                	jne    bfe <putc+0x1e>
+     c21:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+     c25:	75 d7                	jne    bfe <putc+0x1e>
+  if(b->n > 0)
+     c27:	85 c0                	test   %eax,%eax
+     c29:	7e 17                	jle    c42 <putc+0x62>
+     c2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c2f:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     c30:	83 ec 04             	sub    $0x4,%esp
+     c33:	50                   	push   %eax
+     c34:	8d 43 0c             	lea    0xc(%ebx),%eax
+     c37:	50                   	push   %eax
+     c38:	ff 33                	push   (%ebx)
+     c3a:	e8 01 fd ff ff       	call   940 <_write>
+     c3f:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     c42:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+     c49:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     c4c:	c9                   	leave
+     c4d:	c3                   	ret
+     c4e:	66 90                	xchg   %ax,%ax
+
+00000c50 <format>:
+
+// Format fmt and the arguments at ap into b.
+// Only understands %d, %x, %p, %s, %c.
+static void
+format(struct outbuf *b, const char *fmt, uint *ap)
+{
+     c50:	55                   	push   %ebp
+     c51:	89 e5                	mov    %esp,%ebp
+     c53:	57                   	push   %edi
+     c54:	89 c7                	mov    %eax,%edi
+     c56:	56                   	push   %esi
+     c57:	53                   	push   %ebx
+     c58:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+     c5b:	0f b6 02             	movzbl (%edx),%eax
+{
+     c5e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  for(i = 0; fmt[i]; i++){
+     c61:	84 c0                	test   %al,%al
+     c63:	74 5a                	je     cbf <format+0x6f>
+     c65:	8d 5a 01             	lea    0x1(%edx),%ebx
+     c68:	31 f6                	xor    %esi,%esi
+     c6a:	eb 1c                	jmp    c88 <format+0x38>
+     c6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     c70:	83 f8 25             	cmp    $0x25,%eax
+     c73:	74 3b                	je     cb0 <format+0x60>
+        state = '%';
+      } else {
+        putc(b, c);
+     c75:	89 ca                	mov    %ecx,%edx
+     c77:	89 f8                	mov    %edi,%eax
+     c79:	e8 62 ff ff ff       	call   be0 <putc>
+  for(i = 0; fmt[i]; i++){
+     c7e:	0f b6 03             	movzbl (%ebx),%eax
+     c81:	83 c3 01             	add    $0x1,%ebx
+     c84:	84 c0                	test   %al,%al
+     c86:	74 37                	je     cbf <format+0x6f>
+    c = fmt[i] & 0xff;
+     c88:	0f be c8             	movsbl %al,%ecx
+     c8b:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     c8e:	85 f6                	test   %esi,%esi
+     c90:	74 de                	je     c70 <format+0x20>
+      }
+    } else if(state == '%'){
+     c92:	83 fe 25             	cmp    $0x25,%esi
+     c95:	75 e7                	jne    c7e <format+0x2e>
+      if(c == 'd'){
+     c97:	83 f8 25             	cmp    $0x25,%eax
+     c9a:	74 46                	je     ce2 <format+0x92>
+     c9c:	83 e8 63             	sub    $0x63,%eax
+     c9f:	83 f8 15             	cmp    $0x15,%eax
+     ca2:	77 2c                	ja     cd0 <format+0x80>
+     ca4:	ff 24 85 50 18 00 00 	jmp    *0x1850(,%eax,4)
+     cab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     caf:	90                   	nop
+  for(i = 0; fmt[i]; i++){
+     cb0:	0f b6 03             	movzbl (%ebx),%eax
+     cb3:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+     cb6:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+     cbb:	84 c0                	test   %al,%al
+     cbd:	75 c9                	jne    c88 <format+0x38>
+        putc(b, c);
+      }
+      state = 0;
+    }
+  }
+}
+     cbf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     cc2:	5b                   	pop    %ebx
+     cc3:	5e                   	pop    %esi
+     cc4:	5f                   	pop    %edi
+     cc5:	5d                   	pop    %ebp
+     cc6:	c3                   	ret
+     cc7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cce:	66 90                	xchg   %ax,%ax
+        putc(b, '%');
+     cd0:	ba 25 00 00 00       	mov    $0x25,%edx
+     cd5:	89 f8                	mov    %edi,%eax
+     cd7:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     cda:	e8 01 ff ff ff       	call   be0 <putc>
+        putc(b, c);
+     cdf:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     ce2:	89 ca                	mov    %ecx,%edx
+     ce4:	89 f8                	mov    %edi,%eax
+      state = 0;
+     ce6:	31 f6                	xor    %esi,%esi
+        putc(b, c);
+     ce8:	e8 f3 fe ff ff       	call   be0 <putc>
+     ced:	eb 8f                	jmp    c7e <format+0x2e>
+     cef:	90                   	nop
+        printint(b, *ap, 16, 0);
+     cf0:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     cf3:	83 ec 0c             	sub    $0xc,%esp
+     cf6:	b9 10 00 00 00       	mov    $0x10,%ecx
+     cfb:	8b 16                	mov    (%esi),%edx
+     cfd:	6a 00                	push   $0x0
+        ap++;
+     cff:	83 c6 04             	add    $0x4,%esi
+        printint(b, *ap, 16, 0);
+     d02:	89 f8                	mov    %edi,%eax
+     d04:	e8 d7 fd ff ff       	call   ae0 <printint>
+        ap++;
+     d09:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+     d0c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     d0f:	31 f6                	xor    %esi,%esi
+     d11:	e9 68 ff ff ff       	jmp    c7e <format+0x2e>
+     d16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d1d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     d20:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     d23:	8b 30                	mov    (%eax),%esi
+        ap++;
+     d25:	83 c0 04             	add    $0x4,%eax
+     d28:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+     d2b:	85 f6                	test   %esi,%esi
+     d2d:	75 1b                	jne    d4a <format+0xfa>
+     d2f:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+     d34:	be 48 18 00 00       	mov    $0x1848,%esi
+     d39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+          putc(b, *s);
+     d40:	89 f8                	mov    %edi,%eax
+          s++;
+     d42:	83 c6 01             	add    $0x1,%esi
+          putc(b, *s);
+     d45:	e8 96 fe ff ff       	call   be0 <putc>
+        while(*s != 0){
+     d4a:	0f be 16             	movsbl (%esi),%edx
+     d4d:	84 d2                	test   %dl,%dl
+     d4f:	75 ef                	jne    d40 <format+0xf0>
+      state = 0;
+     d51:	31 f6                	xor    %esi,%esi
+     d53:	e9 26 ff ff ff       	jmp    c7e <format+0x2e>
+     d58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d5f:	90                   	nop
+        printint(b, *ap, 10, 1);
+     d60:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     d63:	83 ec 0c             	sub    $0xc,%esp
+     d66:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     d6b:	8b 16                	mov    (%esi),%edx
+     d6d:	6a 01                	push   $0x1
+     d6f:	eb 8e                	jmp    cff <format+0xaf>
+     d71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(b, *ap);
+     d78:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     d7b:	89 f8                	mov    %edi,%eax
+     d7d:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+     d80:	83 c6 04             	add    $0x4,%esi
+        putc(b, *ap);
+     d83:	e8 58 fe ff ff       	call   be0 <putc>
+        ap++;
+     d88:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      state = 0;
+     d8b:	31 f6                	xor    %esi,%esi
+     d8d:	e9 ec fe ff ff       	jmp    c7e <format+0x2e>
+     d92:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d99:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000da0 <fflush>:
+{
+     da0:	55                   	push   %ebp
+     da1:	89 e5                	mov    %esp,%ebp
+     da3:	83 ec 08             	sub    $0x8,%esp
+  if(fd == stdout.fd)
+     da6:	8b 45 08             	mov    0x8(%ebp),%eax
+     da9:	39 05 00 20 00 00    	cmp    %eax,0x2000
+     daf:	74 07                	je     db8 <fflush+0x18>
+}
+     db1:	c9                   	leave
+     db2:	c3                   	ret
+     db3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     db7:	90                   	nop
+  umtxlock(&stdoutlock);
+     db8:	83 ec 0c             	sub    $0xc,%esp
+     dbb:	68 18 22 00 00       	push   $0x2218
+     dc0:	e8 db fa ff ff       	call   8a0 <umtxlock>
+  if(b->n > 0)
+     dc5:	a1 08 20 00 00       	mov    0x2008,%eax
+     dca:	83 c4 10             	add    $0x10,%esp
+     dcd:	85 c0                	test   %eax,%eax
+     dcf:	7f 1f                	jg     df0 <fflush+0x50>
+  b->n = 0;
+     dd1:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     dd8:	00 00 00 
+  umtxunlock(&stdoutlock);
+     ddb:	c7 45 08 18 22 00 00 	movl   $0x2218,0x8(%ebp)
+}
+     de2:	c9                   	leave
+  umtxunlock(&stdoutlock);
+     de3:	e9 08 fb ff ff       	jmp    8f0 <umtxunlock>
+     de8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     def:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     df0:	83 ec 04             	sub    $0x4,%esp
+     df3:	50                   	push   %eax
+     df4:	68 0c 20 00 00       	push   $0x200c
+     df9:	ff 35 00 20 00 00    	push   0x2000
+     dff:	e8 3c fb ff ff       	call   940 <_write>
+     e04:	83 c4 10             	add    $0x10,%esp
+     e07:	eb c8                	jmp    dd1 <fflush+0x31>
+     e09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000e10 <setvbuf>:
+{
+     e10:	55                   	push   %ebp
+     e11:	89 e5                	mov    %esp,%ebp
+     e13:	53                   	push   %ebx
+     e14:	83 ec 04             	sub    $0x4,%esp
+     e17:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd != stdout.fd)
+     e1a:	8b 45 08             	mov    0x8(%ebp),%eax
+     e1d:	39 05 00 20 00 00    	cmp    %eax,0x2000
+     e23:	74 0b                	je     e30 <setvbuf+0x20>
+}
+     e25:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     e28:	c9                   	leave
+     e29:	c3                   	ret
+     e2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  umtxlock(&stdoutlock);
+     e30:	83 ec 0c             	sub    $0xc,%esp
+     e33:	68 18 22 00 00       	push   $0x2218
+     e38:	e8 63 fa ff ff       	call   8a0 <umtxlock>
+  if(b->n > 0)
+     e3d:	a1 08 20 00 00       	mov    0x2008,%eax
+     e42:	83 c4 10             	add    $0x10,%esp
+     e45:	85 c0                	test   %eax,%eax
+     e47:	7f 2f                	jg     e78 <setvbuf+0x68>
+  b->n = 0;
+     e49:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     e50:	00 00 00 
+  stdout.mode = mode;
+     e53:	89 1d 04 20 00 00    	mov    %ebx,0x2004
+  flushhook = flushall;
+     e59:	c7 05 14 22 00 00 90 	movl   $0xa90,0x2214
+     e60:	0a 00 00 
+}
+     e63:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&stdoutlock);
+     e66:	c7 45 08 18 22 00 00 	movl   $0x2218,0x8(%ebp)
+}
+     e6d:	c9                   	leave
+  umtxunlock(&stdoutlock);
+     e6e:	e9 7d fa ff ff       	jmp    8f0 <umtxunlock>
+     e73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e77:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     e78:	83 ec 04             	sub    $0x4,%esp
+     e7b:	50                   	push   %eax
+     e7c:	68 0c 20 00 00       	push   $0x200c
+     e81:	ff 35 00 20 00 00    	push   0x2000
+     e87:	e8 b4 fa ff ff       	call   940 <_write>
+     e8c:	83 c4 10             	add    $0x10,%esp
+     e8f:	eb b8                	jmp    e49 <setvbuf+0x39>
+     e91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e9f:	90                   	nop
+
+00000ea0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s, %c.
+void
+printf(int fd, const char *fmt, ...)
+{
+     ea0:	55                   	push   %ebp
+     ea1:	89 e5                	mov    %esp,%ebp
+     ea3:	53                   	push   %ebx
+     ea4:	81 ec 14 02 00 00    	sub    $0x214,%esp
+     eaa:	8b 45 08             	mov    0x8(%ebp),%eax
+    local.mode = _IONBF;
+    local.n = 0;
+    local.str = 0;
+    b = &local;
+  }
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     ead:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd == stdout.fd){
+     eb0:	39 05 00 20 00 00    	cmp    %eax,0x2000
+     eb6:	74 48                	je     f00 <printf+0x60>
+    local.fd = fd;
+     eb8:	89 85 e8 fd ff ff    	mov    %eax,-0x218(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     ebe:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     ec1:	89 da                	mov    %ebx,%edx
+     ec3:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+    local.mode = _IONBF;
+     ec9:	c7 85 ec fd ff ff 03 	movl   $0x3,-0x214(%ebp)
+     ed0:	00 00 00 
+    local.n = 0;
+     ed3:	c7 85 f0 fd ff ff 00 	movl   $0x0,-0x210(%ebp)
+     eda:	00 00 00 
+    local.str = 0;
+     edd:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     ee4:	e8 67 fd ff ff       	call   c50 <format>
+  if(b->mode == _IONBF)
+     ee9:	83 bd ec fd ff ff 03 	cmpl   $0x3,-0x214(%ebp)
+     ef0:	0f 84 a2 00 00 00    	je     f98 <printf+0xf8>
+    flush(b);
+  if(b == &stdout)
+    umtxunlock(&stdoutlock);
+}
+     ef6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     ef9:	c9                   	leave
+     efa:	c3                   	ret
+     efb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     eff:	90                   	nop
+    umtxlock(&stdoutlock);
+     f00:	83 ec 0c             	sub    $0xc,%esp
+     f03:	68 18 22 00 00       	push   $0x2218
+     f08:	e8 93 f9 ff ff       	call   8a0 <umtxlock>
+  if(stdout.mode == 0){
+     f0d:	a1 04 20 00 00       	mov    0x2004,%eax
+     f12:	83 c4 10             	add    $0x10,%esp
+     f15:	85 c0                	test   %eax,%eax
+     f17:	74 37                	je     f50 <printf+0xb0>
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     f19:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     f1c:	89 da                	mov    %ebx,%edx
+     f1e:	b8 00 20 00 00       	mov    $0x2000,%eax
+     f23:	e8 28 fd ff ff       	call   c50 <format>
+  if(b->mode == _IONBF)
+     f28:	83 3d 04 20 00 00 03 	cmpl   $0x3,0x2004
+     f2f:	0f 84 ab 00 00 00    	je     fe0 <printf+0x140>
+    umtxunlock(&stdoutlock);
+     f35:	83 ec 0c             	sub    $0xc,%esp
+     f38:	68 18 22 00 00       	push   $0x2218
+     f3d:	e8 ae f9 ff ff       	call   8f0 <umtxunlock>
+}
+     f42:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    umtxunlock(&stdoutlock);
+     f45:	83 c4 10             	add    $0x10,%esp
+}
+     f48:	c9                   	leave
+     f49:	c3                   	ret
+     f4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+     f50:	83 ec 08             	sub    $0x8,%esp
+     f53:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+     f59:	50                   	push   %eax
+     f5a:	ff 35 00 20 00 00    	push   0x2000
+     f60:	e8 13 fa ff ff       	call   978 <fstat>
+     f65:	83 c4 10             	add    $0x10,%esp
+     f68:	89 c2                	mov    %eax,%edx
+      stdout.mode = _IOFBF;
+     f6a:	b8 01 00 00 00       	mov    $0x1,%eax
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+     f6f:	85 d2                	test   %edx,%edx
+     f71:	75 10                	jne    f83 <printf+0xe3>
+      stdout.mode = _IOLBF;
+     f73:	31 c0                	xor    %eax,%eax
+     f75:	66 83 bd e8 fd ff ff 	cmpw   $0x3,-0x218(%ebp)
+     f7c:	03 
+     f7d:	0f 94 c0             	sete   %al
+     f80:	83 c0 01             	add    $0x1,%eax
+     f83:	a3 04 20 00 00       	mov    %eax,0x2004
+    flushhook = flushall;
+     f88:	c7 05 14 22 00 00 90 	movl   $0xa90,0x2214
+     f8f:	0a 00 00 
+     f92:	eb 85                	jmp    f19 <printf+0x79>
+     f94:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(b->n > 0)
+     f98:	8b 85 f0 fd ff ff    	mov    -0x210(%ebp),%eax
+     f9e:	85 c0                	test   %eax,%eax
+     fa0:	0f 8e 50 ff ff ff    	jle    ef6 <printf+0x56>
+    b = &local;
+     fa6:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+    _write(b->fd, b->buf, b->n);
+     fac:	83 ec 04             	sub    $0x4,%esp
+     faf:	50                   	push   %eax
+     fb0:	8d 43 0c             	lea    0xc(%ebx),%eax
+     fb3:	50                   	push   %eax
+     fb4:	ff 33                	push   (%ebx)
+     fb6:	e8 85 f9 ff ff       	call   940 <_write>
+  b->n = 0;
+     fbb:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  if(b == &stdout)
+     fc2:	83 c4 10             	add    $0x10,%esp
+     fc5:	81 fb 00 20 00 00    	cmp    $0x2000,%ebx
+     fcb:	0f 85 25 ff ff ff    	jne    ef6 <printf+0x56>
+     fd1:	e9 5f ff ff ff       	jmp    f35 <printf+0x95>
+     fd6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fdd:	8d 76 00             	lea    0x0(%esi),%esi
+  if(b->n > 0)
+     fe0:	a1 08 20 00 00       	mov    0x2008,%eax
+    b = getstdout();
+     fe5:	bb 00 20 00 00       	mov    $0x2000,%ebx
+  if(b->n > 0)
+     fea:	85 c0                	test   %eax,%eax
+     fec:	7f be                	jg     fac <printf+0x10c>
+  b->n = 0;
+     fee:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     ff5:	00 00 00 
+  if(b == &stdout)
+     ff8:	e9 38 ff ff ff       	jmp    f35 <printf+0x95>
+     ffd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001000 <sprintf>:
+
+// Print to the given buffer. Only understands %d, %x, %p, %s, %c.
+int
+sprintf(char *str, const char *fmt, ...)
+{
+    1000:	55                   	push   %ebp
+    1001:	89 e5                	mov    %esp,%ebp
+    1003:	53                   	push   %ebx
+  struct outbuf b;
+
+  b.str = str;
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+    1004:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+    100a:	8d 4d 10             	lea    0x10(%ebp),%ecx
+{
+    100d:	81 ec 14 02 00 00    	sub    $0x214,%esp
+    1013:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+    1016:	8b 55 0c             	mov    0xc(%ebp),%edx
+  b.str = str;
+    1019:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+    101c:	e8 2f fc ff ff       	call   c50 <format>
+  *b.str = '\0';
+    1021:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1024:	c6 00 00             	movb   $0x0,(%eax)
+  return b.str - str;
+    1027:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    102a:	29 d8                	sub    %ebx,%eax
+}
+    102c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    102f:	c9                   	leave
+    1030:	c3                   	ret
+    1031:	66 90                	xchg   %ax,%ax
+    1033:	66 90                	xchg   %ax,%ax
+    1035:	66 90                	xchg   %ax,%ax
+    1037:	66 90                	xchg   %ax,%ax
+    1039:	66 90                	xchg   %ax,%ax
+    103b:	66 90                	xchg   %ax,%ax
+    103d:	66 90                	xchg   %ax,%ax
+    103f:	90                   	nop
+
+00001040 <freeblock>:
+static Header *freep;
+static struct umutex lock;  // threads made by clone() share the heap
+
+static void
+freeblock(void *ap)
+{
+    1040:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+    1041:	8d 48 f8             	lea    -0x8(%eax),%ecx
+{
+    1044:	89 e5                	mov    %esp,%ebp
+    1046:	57                   	push   %edi
+    1047:	56                   	push   %esi
+    1048:	53                   	push   %ebx
+    1049:	89 c3                	mov    %eax,%ebx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    104b:	a1 20 22 00 00       	mov    0x2220,%eax
+    1050:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1052:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1054:	39 ca                	cmp    %ecx,%edx
+    1056:	73 30                	jae    1088 <freeblock+0x48>
+    1058:	39 c1                	cmp    %eax,%ecx
+    105a:	72 04                	jb     1060 <freeblock+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    105c:	39 c2                	cmp    %eax,%edx
+    105e:	72 f0                	jb     1050 <freeblock+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1060:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    1063:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    1066:	39 f8                	cmp    %edi,%eax
+    1068:	74 26                	je     1090 <freeblock+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    106a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    106d:	8b 42 04             	mov    0x4(%edx),%eax
+    1070:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    1073:	39 f1                	cmp    %esi,%ecx
+    1075:	74 30                	je     10a7 <freeblock+0x67>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    1077:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    1079:	5b                   	pop    %ebx
+  freep = p;
+    107a:	89 15 20 22 00 00    	mov    %edx,0x2220
+}
+    1080:	5e                   	pop    %esi
+    1081:	5f                   	pop    %edi
+    1082:	5d                   	pop    %ebp
+    1083:	c3                   	ret
+    1084:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1088:	39 c1                	cmp    %eax,%ecx
+    108a:	72 d0                	jb     105c <freeblock+0x1c>
+    108c:	eb c2                	jmp    1050 <freeblock+0x10>
+    108e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+    1090:	03 70 04             	add    0x4(%eax),%esi
+    1093:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1096:	8b 02                	mov    (%edx),%eax
+    1098:	8b 00                	mov    (%eax),%eax
+    109a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    109d:	8b 42 04             	mov    0x4(%edx),%eax
+    10a0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    10a3:	39 f1                	cmp    %esi,%ecx
+    10a5:	75 d0                	jne    1077 <freeblock+0x37>
+    p->s.size += bp->s.size;
+    10a7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    10aa:	89 15 20 22 00 00    	mov    %edx,0x2220
+    p->s.size += bp->s.size;
+    10b0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    10b3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    10b6:	89 0a                	mov    %ecx,(%edx)
+}
+    10b8:	5b                   	pop    %ebx
+    10b9:	5e                   	pop    %esi
+    10ba:	5f                   	pop    %edi
+    10bb:	5d                   	pop    %ebp
+    10bc:	c3                   	ret
+    10bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000010c0 <free>:
+
+void
+free(void *ap)
+{
+    10c0:	55                   	push   %ebp
+    10c1:	89 e5                	mov    %esp,%ebp
+    10c3:	53                   	push   %ebx
+    10c4:	83 ec 10             	sub    $0x10,%esp
+    10c7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  umtxlock(&lock);
+    10ca:	68 1c 22 00 00       	push   $0x221c
+    10cf:	e8 cc f7 ff ff       	call   8a0 <umtxlock>
+  freeblock(ap);
+    10d4:	89 d8                	mov    %ebx,%eax
+    10d6:	e8 65 ff ff ff       	call   1040 <freeblock>
+  umtxunlock(&lock);
+    10db:	c7 45 08 1c 22 00 00 	movl   $0x221c,0x8(%ebp)
+}
+    10e2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&lock);
+    10e5:	83 c4 10             	add    $0x10,%esp
+}
+    10e8:	c9                   	leave
+  umtxunlock(&lock);
+    10e9:	e9 02 f8 ff ff       	jmp    8f0 <umtxunlock>
+    10ee:	66 90                	xchg   %ax,%ax
+
+000010f0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    10f0:	55                   	push   %ebp
+    10f1:	89 e5                	mov    %esp,%ebp
+    10f3:	57                   	push   %edi
+    10f4:	56                   	push   %esi
+    10f5:	53                   	push   %ebx
+    10f6:	83 ec 28             	sub    $0x28,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    10f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  umtxlock(&lock);
+    10fc:	68 1c 22 00 00       	push   $0x221c
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1101:	8d 48 07             	lea    0x7(%eax),%ecx
+    1104:	c1 e9 03             	shr    $0x3,%ecx
+    1107:	8d 71 01             	lea    0x1(%ecx),%esi
+  umtxlock(&lock);
+    110a:	e8 91 f7 ff ff       	call   8a0 <umtxlock>
+  if((prevp = freep) == 0){
+    110f:	8b 15 20 22 00 00    	mov    0x2220,%edx
+    1115:	83 c4 10             	add    $0x10,%esp
+    1118:	85 d2                	test   %edx,%edx
+    111a:	0f 84 b0 00 00 00    	je     11d0 <malloc+0xe0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1120:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+    1122:	8b 47 04             	mov    0x4(%edi),%eax
+    1125:	39 f0                	cmp    %esi,%eax
+    1127:	73 6f                	jae    1198 <malloc+0xa8>
+  if(nu < 4096)
+    1129:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    112e:	39 de                	cmp    %ebx,%esi
+    1130:	0f 43 de             	cmovae %esi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    1133:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+    113a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    113d:	eb 0a                	jmp    1149 <malloc+0x59>
+    113f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1140:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+    1142:	8b 47 04             	mov    0x4(%edi),%eax
+    1145:	39 f0                	cmp    %esi,%eax
+    1147:	73 4f                	jae    1198 <malloc+0xa8>
+      }
+      freep = prevp;
+      umtxunlock(&lock);
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    1149:	89 fa                	mov    %edi,%edx
+    114b:	39 3d 20 22 00 00    	cmp    %edi,0x2220
+    1151:	75 ed                	jne    1140 <malloc+0x50>
+  p = sbrk(nu * sizeof(Header));
+    1153:	83 ec 0c             	sub    $0xc,%esp
+    1156:	ff 75 e4             	push   -0x1c(%ebp)
+    1159:	e8 4a f8 ff ff       	call   9a8 <sbrk>
+  if(p == (char*)-1)
+    115e:	83 c4 10             	add    $0x10,%esp
+    1161:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1164:	74 15                	je     117b <malloc+0x8b>
+  hp->s.size = nu;
+    1166:	89 58 04             	mov    %ebx,0x4(%eax)
+  freeblock((void*)(hp + 1));
+    1169:	83 c0 08             	add    $0x8,%eax
+    116c:	e8 cf fe ff ff       	call   1040 <freeblock>
+  return freep;
+    1171:	8b 15 20 22 00 00    	mov    0x2220,%edx
+      if((p = morecore(nunits)) == 0){
+    1177:	85 d2                	test   %edx,%edx
+    1179:	75 c5                	jne    1140 <malloc+0x50>
+        umtxunlock(&lock);
+    117b:	83 ec 0c             	sub    $0xc,%esp
+    117e:	68 1c 22 00 00       	push   $0x221c
+    1183:	e8 68 f7 ff ff       	call   8f0 <umtxunlock>
+        return 0;
+    1188:	83 c4 10             	add    $0x10,%esp
+      }
+  }
+}
+    118b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    118e:	31 c0                	xor    %eax,%eax
+}
+    1190:	5b                   	pop    %ebx
+    1191:	5e                   	pop    %esi
+    1192:	5f                   	pop    %edi
+    1193:	5d                   	pop    %ebp
+    1194:	c3                   	ret
+    1195:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1198:	39 c6                	cmp    %eax,%esi
+    119a:	74 64                	je     1200 <malloc+0x110>
+        p->s.size -= nunits;
+    119c:	29 f0                	sub    %esi,%eax
+    119e:	89 47 04             	mov    %eax,0x4(%edi)
+        p += p->s.size;
+    11a1:	8d 3c c7             	lea    (%edi,%eax,8),%edi
+        p->s.size = nunits;
+    11a4:	89 77 04             	mov    %esi,0x4(%edi)
+      umtxunlock(&lock);
+    11a7:	83 ec 0c             	sub    $0xc,%esp
+      freep = prevp;
+    11aa:	89 15 20 22 00 00    	mov    %edx,0x2220
+      umtxunlock(&lock);
+    11b0:	68 1c 22 00 00       	push   $0x221c
+    11b5:	e8 36 f7 ff ff       	call   8f0 <umtxunlock>
+      return (void*)(p + 1);
+    11ba:	83 c4 10             	add    $0x10,%esp
+}
+    11bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    11c0:	8d 47 08             	lea    0x8(%edi),%eax
+}
+    11c3:	5b                   	pop    %ebx
+    11c4:	5e                   	pop    %esi
+    11c5:	5f                   	pop    %edi
+    11c6:	5d                   	pop    %ebp
+    11c7:	c3                   	ret
+    11c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11cf:	90                   	nop
+    base.s.ptr = freep = prevp = &base;
+    11d0:	c7 05 20 22 00 00 24 	movl   $0x2224,0x2220
+    11d7:	22 00 00 
+    base.s.size = 0;
+    11da:	bf 24 22 00 00       	mov    $0x2224,%edi
+    base.s.ptr = freep = prevp = &base;
+    11df:	c7 05 24 22 00 00 24 	movl   $0x2224,0x2224
+    11e6:	22 00 00 
+    base.s.size = 0;
+    11e9:	c7 05 28 22 00 00 00 	movl   $0x0,0x2228
+    11f0:	00 00 00 
+    if(p->s.size >= nunits){
+    11f3:	e9 31 ff ff ff       	jmp    1129 <malloc+0x39>
+    11f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11ff:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1200:	8b 07                	mov    (%edi),%eax
+    1202:	89 02                	mov    %eax,(%edx)
+    1204:	eb a1                	jmp    11a7 <malloc+0xb7>
+    1206:	66 90                	xchg   %ax,%ax
+    1208:	66 90                	xchg   %ax,%ax
+    120a:	66 90                	xchg   %ax,%ax
+    120c:	66 90                	xchg   %ax,%ax
+    120e:	66 90                	xchg   %ax,%ax
+
+00001210 <threadstart>:
+
+#define TSTACKSZ 4096
+
+static void
+threadstart(void *fn, void *arg)
+{
+    1210:	55                   	push   %ebp
+    1211:	89 e5                	mov    %esp,%ebp
+    1213:	83 ec 14             	sub    $0x14,%esp
+  ((void (*)(void*))fn)(arg);
+    1216:	ff 75 0c             	push   0xc(%ebp)
+    1219:	ff 55 08             	call   *0x8(%ebp)
+  exit();
+    121c:	e8 ef f4 ff ff       	call   710 <exit>
+    1221:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1228:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    122f:	90                   	nop
+
+00001230 <thread_create>:
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    1230:	55                   	push   %ebp
+    1231:	89 e5                	mov    %esp,%ebp
+    1233:	53                   	push   %ebx
+    1234:	83 ec 20             	sub    $0x20,%esp
+  char *mem, *stack;
+  int pid;
+
+  if((mem = malloc(2*TSTACKSZ)) == 0)
+    1237:	68 00 20 00 00       	push   $0x2000
+    123c:	e8 af fe ff ff       	call   10f0 <malloc>
+    1241:	83 c4 10             	add    $0x10,%esp
+    1244:	85 c0                	test   %eax,%eax
+    1246:	74 47                	je     128f <thread_create+0x5f>
+    1248:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)(((uint)mem + TSTACKSZ - 1) & ~(TSTACKSZ - 1));
+    124a:	8d 80 ff 0f 00 00    	lea    0xfff(%eax),%eax
+    1250:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  *(char**)stack = mem;
+    1255:	89 18                	mov    %ebx,(%eax)
+  if((pid = clone(threadstart, (void*)fn, arg, stack)) < 0)
+    1257:	50                   	push   %eax
+    1258:	ff 75 0c             	push   0xc(%ebp)
+    125b:	ff 75 08             	push   0x8(%ebp)
+    125e:	68 10 12 00 00       	push   $0x1210
+    1263:	e8 08 f8 ff ff       	call   a70 <clone>
+    1268:	83 c4 10             	add    $0x10,%esp
+    126b:	85 c0                	test   %eax,%eax
+    126d:	78 09                	js     1278 <thread_create+0x48>
+    free(mem);
+  return pid;
+}
+    126f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1272:	c9                   	leave
+    1273:	c3                   	ret
+    1274:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    free(mem);
+    1278:	83 ec 0c             	sub    $0xc,%esp
+    127b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    127e:	53                   	push   %ebx
+    127f:	e8 3c fe ff ff       	call   10c0 <free>
+    1284:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    1287:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+    128a:	83 c4 10             	add    $0x10,%esp
+}
+    128d:	c9                   	leave
+    128e:	c3                   	ret
+    return -1;
+    128f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1294:	eb d9                	jmp    126f <thread_create+0x3f>
+    1296:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    129d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000012a0 <thread_join>:
+
+int
+thread_join(void)
+{
+    12a0:	55                   	push   %ebp
+    12a1:	89 e5                	mov    %esp,%ebp
+    12a3:	83 ec 34             	sub    $0x34,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    12a6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    12a9:	50                   	push   %eax
+    12aa:	e8 c9 f7 ff ff       	call   a78 <join>
+    12af:	83 c4 10             	add    $0x10,%esp
+    12b2:	85 c0                	test   %eax,%eax
+    12b4:	79 0a                	jns    12c0 <thread_join+0x20>
+    free(*(char**)stack);
+  return pid;
+}
+    12b6:	c9                   	leave
+    12b7:	c3                   	ret
+    12b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12bf:	90                   	nop
+    free(*(char**)stack);
+    12c0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    12c3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    12c6:	83 ec 0c             	sub    $0xc,%esp
+    12c9:	ff 32                	push   (%edx)
+    12cb:	e8 f0 fd ff ff       	call   10c0 <free>
+    12d0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    12d3:	83 c4 10             	add    $0x10,%esp
+}
+    12d6:	c9                   	leave
+    12d7:	c3                   	ret
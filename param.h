@@ -7,8 +7,22 @@
 #define NDEV         10  // maximum major device number
 #define ROOTDEV       1  // device number of file system root disk
 #define MAXARG       32  // max exec arguments
+#define MAXPATH     128  // max file path name
 #define MAXOPBLOCKS  10  // max # of blocks any FS op writes
 #define LOGSIZE      (MAXOPBLOCKS*3)  // max data blocks in on-disk log
 #define NBUF         (MAXOPBLOCKS*3)  // size of disk block cache
-#define FSSIZE       2000  // size of file system in blocks
+#define NPCACHE    2048  // max pages in file page cache
+#define FSSIZE       4000  // size of file system in blocks
+#define NGROUP          4  // block groups in file system
+#define NVMA         16  // mapped regions per process
+#define NPIN          8  // user buffers the system calls of one vm pin
+#define NSHM         16  // shared memory segments per system
+#define NSHMPAGE     64  // max pages in a shared memory segment
+#define NMUTEX      100  // kernel mutexes per system
+#define NLOCKCLASS   64  // lock names with contention counters
+#define NZEROPAGE  1024  // free pages kept zeroed by idle CPUs
+#define PIPESIZE   4096  // bytes in a pipe's ring, at most PGSIZE
+#define SWAPSIZE 655360  // blocks of swap space after the file system
+#define STACKLIMIT (8*1024*1024)  // default bytes a user stack may grow to
+#define STACKAHEAD    4  // default pages the stack grows past a fault
 
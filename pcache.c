@@ -0,0 +1,367 @@
+// Page cache.
+//
+// The page cache keeps the contents of regular files in memory
+// a page at a time, in page frames taken from kalloc(), so that
+// re-reading a file much larger than the buffer cache does not
+// go back to the disk. readi() copies file data out of the page
+// cache; writei() writes through the log as before and then
+// updates any cached copy, so the page cache never holds data
+// that is not also in the buffer cache or on disk.
+//
+// Interface:
+// * pcget() returns a referenced page for a file page, which
+//     the caller fills in if it is not yet valid, between
+//     pcfill() and pcfilled().
+// * pcput() drops the reference.
+// * pctext() counts a page mapped as a program's text by exec(),
+//     and pcshared() one mapped in a MAP_SHARED region; pcframe()
+//     finds such a page again by its frame to unmap it.
+// * pcwrite() copies newly written file data into cached pages.
+// * pcinval() drops all pages of a file that is being freed.
+// * pcreclaim() gives idle page frames back to kalloc() when
+//     it runs out of memory.
+//
+// The file's inode lock keeps writers away from a page while it
+// is filled or updated; readers may share the inode lock, so
+// pcfill() lets only one of them fill a page. pcache.lock
+// protects the hash chains, the LRU list, ref and filling.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "pcache.h"
+#include "iostat.h"
+
+#define NPCHASH 127
+#define NRECLAIM 32  // frames freed per pcreclaim()
+
+struct {
+  struct spinlock lock;
+  struct page page[NPCACHE];
+  struct page *hash[NPCHASH];
+
+  // Linked list of all pages, through prev/next.
+  // head.next is most recently used.
+  struct page head;
+
+  uint nhit;
+  uint nmiss;
+} pcache;
+
+static uint
+pchash(uint dev, uint inum, uint pgno)
+{
+  return (dev*31 + inum*131 + pgno) % NPCHASH;
+}
+
+void
+pcinit(void)
+{
+  struct page *p;
+
+  initlock(&pcache.lock, "pcache");
+  pcache.head.prev = &pcache.head;
+  pcache.head.next = &pcache.head;
+  for(p = pcache.page; p < pcache.page+NPCACHE; p++){
+    p->next = pcache.head.next;
+    p->prev = &pcache.head;
+    pcache.head.next->prev = p;
+    pcache.head.next = p;
+  }
+}
+
+// Find a cached page. Caller must hold pcache.lock.
+static struct page*
+pclookup(uint dev, uint inum, uint pgno)
+{
+  struct page *p;
+
+  for(p = pcache.hash[pchash(dev, inum, pgno)]; p; p = p->hnext)
+    if(p->dev == dev && p->inum == inum && p->pgno == pgno)
+      return p;
+  return 0;
+}
+
+// Remove p from its hash chain. Caller must hold pcache.lock.
+static void
+pcunhash(struct page *p)
+{
+  struct page **pp;
+
+  for(pp = &pcache.hash[pchash(p->dev, p->inum, p->pgno)]; *pp; pp = &(*pp)->hnext){
+    if(*pp == p){
+      *pp = p->hnext;
+      break;
+    }
+  }
+  p->hnext = 0;
+  p->valid = 0;
+}
+
+// Return a referenced page for page pgno of inode inum.
+// The page is not valid if it was not cached; the caller
+// must then fill in data and set valid while still
+// holding the inode lock. Returns 0 if out of memory.
+struct page*
+pcget(uint dev, uint inum, uint pgno)
+{
+  struct page *p;
+  char *mem;
+
+  acquire(&pcache.lock);
+  if((p = pclookup(dev, inum, pgno)) != 0){
+    p->ref++;
+    pcache.nhit++;
+    release(&pcache.lock);
+    return p;
+  }
+  pcache.nmiss++;
+  release(&pcache.lock);
+
+  // Allocate without holding pcache.lock: kalloc() may
+  // call pcreclaim() to make room.
+  mem = kalloc();
+
+  acquire(&pcache.lock);
+  // Another reader may have added the page meanwhile.
+  if((p = pclookup(dev, inum, pgno)) != 0){
+    p->ref++;
+    release(&pcache.lock);
+    if(mem)
+      kfree(mem);
+    return p;
+  }
+  // Recycle the least recently used idle page.
+  for(p = pcache.head.prev; p != &pcache.head; p = p->prev)
+    if(p->ref == 0)
+      break;
+  if(p == &pcache.head){
+    release(&pcache.lock);
+    if(mem)
+      kfree(mem);
+    return 0;
+  }
+  if(p->data){
+    if(p->valid)
+      pcunhash(p);
+    if(mem)
+      kfree(mem);
+    mem = p->data;
+  }
+  if(mem == 0){
+    release(&pcache.lock);
+    return 0;
+  }
+  p->dev = dev;
+  p->inum = inum;
+  p->pgno = pgno;
+  p->ref = 1;
+  p->valid = 0;
+  p->filling = 0;
+  p->data = mem;
+  p->hnext = pcache.hash[pchash(dev, inum, pgno)];
+  pcache.hash[pchash(dev, inum, pgno)] = p;
+  release(&pcache.lock);
+  return p;
+}
+
+// Claim the job of filling in referenced page p. Returns 1 if
+// the caller is to fill it in and then call pcfilled(), or 0 if
+// another reader has filled it in meanwhile.
+int
+pcfill(struct page *p)
+{
+  acquire(&pcache.lock);
+  while(p->filling)
+    sleep(p, &pcache.lock);
+  if(p->valid){
+    release(&pcache.lock);
+    return 0;
+  }
+  p->filling = 1;
+  release(&pcache.lock);
+  return 1;
+}
+
+// Mark p, claimed with pcfill(), filled in.
+void
+pcfilled(struct page *p)
+{
+  acquire(&pcache.lock);
+  p->valid = 1;
+  p->filling = 0;
+  wakeup(p);
+  release(&pcache.lock);
+}
+
+// Return the page of inode inum whose frame is data, which
+// the caller maps. Program text may no longer be cached
+// under pgno, if the file has been written since.
+struct page*
+pcframe(uint dev, uint inum, uint pgno, char *data)
+{
+  struct page *p;
+
+  acquire(&pcache.lock);
+  if((p = pclookup(dev, inum, pgno)) == 0 || p->data != data){
+    for(p = pcache.page; p < pcache.page+NPCACHE; p++)
+      if(p->data == data)
+        break;
+    if(p == pcache.page+NPCACHE)
+      panic("pcframe");
+  }
+  release(&pcache.lock);
+  return p;
+}
+
+// Drop a reference to p. Caller must hold pcache.lock.
+static void
+pcrelse(struct page *p)
+{
+  if(p->ref < 1)
+    panic("pcput");
+  p->ref--;
+  if(p->ref == 0){
+    p->next->prev = p->prev;
+    p->prev->next = p->next;
+    p->next = pcache.head.next;
+    p->prev = &pcache.head;
+    pcache.head.next->prev = p;
+    pcache.head.next = p;
+  }
+}
+
+// Release a page from pcget().
+// Move to the head of the MRU list.
+void
+pcput(struct page *p)
+{
+  acquire(&pcache.lock);
+  pcrelse(p);
+  release(&pcache.lock);
+}
+
+// Add n, 1 or -1, to the mappings *count of page p, and
+// take or drop the reference each mapping holds.
+// Caller must hold pcache.lock.
+static void
+pcmapped(struct page *p, int *count, int n)
+{
+  if(*count + n < 0)
+    panic("pcmapped");
+  *count += n;
+  if(n > 0)
+    p->ref += n;
+  else
+    pcrelse(p);
+}
+
+// Count one more (n = 1) or one fewer (n = -1) mapping of
+// referenced page p as program text.
+void
+pctext(struct page *p, int n)
+{
+  acquire(&pcache.lock);
+  pcmapped(p, &p->text, n);
+  release(&pcache.lock);
+}
+
+// Count one more (n = 1) or one fewer (n = -1) mapping of
+// referenced page p in a MAP_SHARED region.
+void
+pcshared(struct page *p, int n)
+{
+  acquire(&pcache.lock);
+  pcmapped(p, &p->shared, n);
+  release(&pcache.lock);
+}
+
+// Copy n bytes just written at offset off of inode inum
+// into the cached pages that hold them, if any. A page that
+// programs are running as text is dropped from the cache
+// instead: they keep the text they started with, and the
+// next exec() reads the new contents. But a page that is
+// also mapped in a MAP_SHARED region stays, and is updated:
+// the region must see every write, so the programs running
+// it as text do too.
+// Caller must hold the inode lock.
+void
+pcwrite(uint dev, uint inum, char *src, uint off, uint n)
+{
+  struct page *p;
+  uint tot, m;
+
+  for(tot=0; tot<n; tot+=m, off+=m, src+=m){
+    m = n - tot;
+    if(m > PGSIZE - off%PGSIZE)
+      m = PGSIZE - off%PGSIZE;
+    acquire(&pcache.lock);
+    if((p = pclookup(dev, inum, off/PGSIZE)) != 0 && p->valid &&
+       p->text && !p->shared)
+      pcunhash(p);
+    if(p && p->valid)
+      p->ref++;
+    else
+      p = 0;
+    release(&pcache.lock);
+    if(p){
+      memmove(p->data + off%PGSIZE, src, m);
+      pcput(p);
+    }
+  }
+}
+
+// Drop every cached page of inode inum, whose
+// contents are being freed.
+void
+pcinval(uint dev, uint inum)
+{
+  struct page *p;
+
+  acquire(&pcache.lock);
+  for(p = pcache.page; p < pcache.page+NPCACHE; p++){
+    if(p->data && p->valid && p->dev == dev && p->inum == inum){
+      pcunhash(p);
+      if(p->ref == 0){
+        kfree(p->data);
+        p->data = 0;
+      }
+    }
+  }
+  release(&pcache.lock);
+}
+
+// Free the frames of up to NRECLAIM least recently
+// used idle pages. Returns the number freed.
+int
+pcreclaim(void)
+{
+  struct page *p;
+  int n;
+
+  n = 0;
+  acquire(&pcache.lock);
+  for(p = pcache.head.prev; p != &pcache.head && n < NRECLAIM; p = p->prev){
+    if(p->ref == 0 && p->data){
+      if(p->valid)
+        pcunhash(p);
+      kfree(p->data);
+      p->data = 0;
+      n++;
+    }
+  }
+  release(&pcache.lock);
+  return n;
+}
+
+// Fill in the page cache counters of *st.
+void
+pcstat(struct iostat *st)
+{
+  acquire(&pcache.lock);
+  st->pchit = pcache.nhit;
+  st->pcmiss = pcache.nmiss;
+  release(&pcache.lock);
+}
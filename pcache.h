@@ -0,0 +1,15 @@
+struct page {
+  uint dev;
+  uint inum;
+  uint pgno;          // page number within the file
+  int ref;            // users of the page; only idle pages are recycled
+  int text;           // mappings of it as program text, see pctext()
+  int shared;         // mappings of it in MAP_SHARED regions, see pcshared()
+  int valid;          // data holds the file's contents
+  int filling;        // a reader is filling in data
+  char *data;         // page frame from kalloc(), or 0 if none
+  struct page *hnext; // hash chain
+  struct page *prev;  // LRU list
+  struct page *next;
+};
+
@@ -0,0 +1,2472 @@
+
+_pcbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <readpass>:
+
+char buf[BSIZE];
+
+void
+readpass(int pass)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	57                   	push   %edi
+       4:	56                   	push   %esi
+  int fd, t0, t1;
+  struct iostat st0, st1;
+
+  iostat(&st0);
+       5:	8d 45 98             	lea    -0x68(%ebp),%eax
+{
+       8:	53                   	push   %ebx
+       9:	83 ec 68             	sub    $0x68,%esp
+  iostat(&st0);
+       c:	50                   	push   %eax
+       d:	e8 7e 08 00 00       	call   890 <iostat>
+  t0 = uptime();
+      12:	e8 41 08 00 00       	call   858 <uptime>
+  if((fd = open("pcfile", O_RDONLY)) < 0){
+      17:	59                   	pop    %ecx
+      18:	5b                   	pop    %ebx
+      19:	6a 00                	push   $0x0
+      1b:	68 82 11 00 00       	push   $0x1182
+  t0 = uptime();
+      20:	89 c6                	mov    %eax,%esi
+  if((fd = open("pcfile", O_RDONLY)) < 0){
+      22:	e8 d9 07 00 00       	call   800 <open>
+      27:	83 c4 10             	add    $0x10,%esp
+      2a:	85 c0                	test   %eax,%eax
+      2c:	78 7f                	js     ad <readpass+0xad>
+      2e:	89 c3                	mov    %eax,%ebx
+    printf(1, "pcbench: open pcfile failed\n");
+    exit();
+  }
+  while(read(fd, buf, sizeof(buf)) > 0)
+      30:	83 ec 04             	sub    $0x4,%esp
+      33:	68 00 02 00 00       	push   $0x200
+      38:	68 20 22 00 00       	push   $0x2220
+      3d:	53                   	push   %ebx
+      3e:	e8 bd 05 00 00       	call   600 <read>
+      43:	83 c4 10             	add    $0x10,%esp
+      46:	85 c0                	test   %eax,%eax
+      48:	7f e6                	jg     30 <readpass+0x30>
+    ;
+  close(fd);
+      4a:	83 ec 0c             	sub    $0xc,%esp
+      4d:	53                   	push   %ebx
+      4e:	e8 ad 06 00 00       	call   700 <close>
+  t1 = uptime();
+      53:	e8 00 08 00 00       	call   858 <uptime>
+      58:	89 c3                	mov    %eax,%ebx
+  iostat(&st1);
+      5a:	8d 45 c0             	lea    -0x40(%ebp),%eax
+      5d:	89 04 24             	mov    %eax,(%esp)
+
+  printf(1, "pcbench: pass %d (%s): %d ticks, %d disk reads, "
+      60:	29 f3                	sub    %esi,%ebx
+      62:	be 7d 11 00 00       	mov    $0x117d,%esi
+  iostat(&st1);
+      67:	e8 24 08 00 00       	call   890 <iostat>
+  printf(1, "pcbench: pass %d (%s): %d ticks, %d disk reads, "
+      6c:	8b 45 08             	mov    0x8(%ebp),%eax
+      6f:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+      72:	83 c4 10             	add    $0x10,%esp
+      75:	2b 7d ac             	sub    -0x54(%ebp),%edi
+      78:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+      7b:	8b 55 c0             	mov    -0x40(%ebp),%edx
+      7e:	2b 4d a8             	sub    -0x58(%ebp),%ecx
+      81:	2b 55 98             	sub    -0x68(%ebp),%edx
+      84:	85 c0                	test   %eax,%eax
+      86:	b8 78 11 00 00       	mov    $0x1178,%eax
+      8b:	57                   	push   %edi
+      8c:	0f 45 c6             	cmovne %esi,%eax
+      8f:	51                   	push   %ecx
+      90:	52                   	push   %edx
+      91:	53                   	push   %ebx
+      92:	50                   	push   %eax
+      93:	ff 75 08             	push   0x8(%ebp)
+      96:	68 f8 11 00 00       	push   $0x11f8
+      9b:	6a 01                	push   $0x1
+      9d:	e8 9e 0c 00 00       	call   d40 <printf>
+         "%d page hits, %d page misses\n", pass, pass == 0 ? "cold" : "warm",
+         t1 - t0, st1.nread - st0.nread, st1.pchit - st0.pchit,
+         st1.pcmiss - st0.pcmiss);
+}
+      a2:	83 c4 20             	add    $0x20,%esp
+      a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      a8:	5b                   	pop    %ebx
+      a9:	5e                   	pop    %esi
+      aa:	5f                   	pop    %edi
+      ab:	5d                   	pop    %ebp
+      ac:	c3                   	ret
+    printf(1, "pcbench: open pcfile failed\n");
+      ad:	52                   	push   %edx
+      ae:	52                   	push   %edx
+      af:	68 89 11 00 00       	push   $0x1189
+      b4:	6a 01                	push   $0x1
+      b6:	e8 85 0c 00 00       	call   d40 <printf>
+    exit();
+      bb:	e8 f0 04 00 00       	call   5b0 <exit>
+
+000000c0 <grep>:
+
+void
+grep(int run)
+{
+      c0:	55                   	push   %ebp
+      c1:	89 e5                	mov    %esp,%ebp
+      c3:	56                   	push   %esi
+      c4:	53                   	push   %ebx
+  int pid, t0, t1;
+  struct iostat st0, st1;
+  char *argv[] = { "grep", "zzzz", "pcfile", 0 };
+
+  iostat(&st0);
+      c5:	8d 45 a8             	lea    -0x58(%ebp),%eax
+{
+      c8:	83 ec 6c             	sub    $0x6c,%esp
+  char *argv[] = { "grep", "zzzz", "pcfile", 0 };
+      cb:	c7 45 98 a6 11 00 00 	movl   $0x11a6,-0x68(%ebp)
+      d2:	c7 45 9c ab 11 00 00 	movl   $0x11ab,-0x64(%ebp)
+      d9:	c7 45 a0 82 11 00 00 	movl   $0x1182,-0x60(%ebp)
+      e0:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  iostat(&st0);
+      e7:	50                   	push   %eax
+      e8:	e8 a3 07 00 00       	call   890 <iostat>
+  t0 = uptime();
+      ed:	e8 66 07 00 00       	call   858 <uptime>
+      f2:	89 c6                	mov    %eax,%esi
+  pid = fork();
+      f4:	e8 87 04 00 00       	call   580 <fork>
+  if(pid < 0){
+      f9:	83 c4 10             	add    $0x10,%esp
+      fc:	85 c0                	test   %eax,%eax
+      fe:	78 3f                	js     13f <grep+0x7f>
+    printf(1, "pcbench: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+     100:	74 50                	je     152 <grep+0x92>
+    exec("grep", argv);
+    printf(1, "pcbench: exec grep failed\n");
+    exit();
+  }
+  wait();
+     102:	e8 c1 06 00 00       	call   7c8 <wait>
+  t1 = uptime();
+     107:	e8 4c 07 00 00       	call   858 <uptime>
+  iostat(&st1);
+     10c:	83 ec 0c             	sub    $0xc,%esp
+  t1 = uptime();
+     10f:	89 c3                	mov    %eax,%ebx
+  iostat(&st1);
+     111:	8d 45 d0             	lea    -0x30(%ebp),%eax
+     114:	50                   	push   %eax
+
+  printf(1, "pcbench: grep %d: %d ticks, %d disk reads\n",
+     115:	29 f3                	sub    %esi,%ebx
+  iostat(&st1);
+     117:	e8 74 07 00 00       	call   890 <iostat>
+  printf(1, "pcbench: grep %d: %d ticks, %d disk reads\n",
+     11c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     11f:	2b 45 a8             	sub    -0x58(%ebp),%eax
+     122:	89 04 24             	mov    %eax,(%esp)
+     125:	53                   	push   %ebx
+     126:	ff 75 08             	push   0x8(%ebp)
+     129:	68 48 12 00 00       	push   $0x1248
+     12e:	6a 01                	push   $0x1
+     130:	e8 0b 0c 00 00       	call   d40 <printf>
+         run, t1 - t0, st1.nread - st0.nread);
+}
+     135:	83 c4 20             	add    $0x20,%esp
+     138:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     13b:	5b                   	pop    %ebx
+     13c:	5e                   	pop    %esi
+     13d:	5d                   	pop    %ebp
+     13e:	c3                   	ret
+    printf(1, "pcbench: fork failed\n");
+     13f:	53                   	push   %ebx
+     140:	53                   	push   %ebx
+     141:	68 b0 11 00 00       	push   $0x11b0
+     146:	6a 01                	push   $0x1
+     148:	e8 f3 0b 00 00       	call   d40 <printf>
+    exit();
+     14d:	e8 5e 04 00 00       	call   5b0 <exit>
+    exec("grep", argv);
+     152:	50                   	push   %eax
+     153:	50                   	push   %eax
+     154:	8d 45 98             	lea    -0x68(%ebp),%eax
+     157:	50                   	push   %eax
+     158:	68 a6 11 00 00       	push   $0x11a6
+     15d:	e8 6e 04 00 00       	call   5d0 <exec>
+    printf(1, "pcbench: exec grep failed\n");
+     162:	5a                   	pop    %edx
+     163:	59                   	pop    %ecx
+     164:	68 c6 11 00 00       	push   $0x11c6
+     169:	6a 01                	push   $0x1
+     16b:	e8 d0 0b 00 00       	call   d40 <printf>
+    exit();
+     170:	e8 3b 04 00 00       	call   5b0 <exit>
+     175:	66 90                	xchg   %ax,%ax
+     177:	66 90                	xchg   %ax,%ax
+     179:	66 90                	xchg   %ax,%ax
+     17b:	66 90                	xchg   %ax,%ax
+     17d:	66 90                	xchg   %ax,%ax
+     17f:	90                   	nop
+
+00000180 <main>:
+
+int
+main(int argc, char *argv[])
+{
+     180:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     184:	83 e4 f0             	and    $0xfffffff0,%esp
+     187:	ff 71 fc             	push   -0x4(%ecx)
+     18a:	55                   	push   %ebp
+     18b:	89 e5                	mov    %esp,%ebp
+     18d:	57                   	push   %edi
+     18e:	56                   	push   %esi
+     18f:	53                   	push   %ebx
+     190:	51                   	push   %ecx
+     191:	83 ec 24             	sub    $0x24,%esp
+  int fd, i, j;
+
+  unlink("pcfile");
+     194:	68 82 11 00 00       	push   $0x1182
+     199:	e8 72 06 00 00       	call   810 <unlink>
+  if((fd = open("pcfile", O_CREATE|O_RDWR)) < 0){
+     19e:	5e                   	pop    %esi
+     19f:	5f                   	pop    %edi
+     1a0:	68 02 02 00 00       	push   $0x202
+     1a5:	68 82 11 00 00       	push   $0x1182
+     1aa:	e8 51 06 00 00       	call   800 <open>
+     1af:	83 c4 10             	add    $0x10,%esp
+     1b2:	85 c0                	test   %eax,%eax
+     1b4:	0f 88 0e 01 00 00    	js     2c8 <main+0x148>
+     1ba:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     1bd:	31 f6                	xor    %esi,%esi
+     1bf:	bf 4f ec c4 4e       	mov    $0x4ec4ec4f,%edi
+     1c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    printf(1, "pcbench: create pcfile failed\n");
+    exit();
+  }
+  for(i = 0; i < FILESZ/BSIZE; i++){
+    for(j = 0; j < BSIZE; j++)
+     1c8:	31 db                	xor    %ebx,%ebx
+     1ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      buf[j] = (j % 64 == 63) ? '\n' : 'a' + (i + j) % 26;
+     1d0:	89 da                	mov    %ebx,%edx
+     1d2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     1d7:	83 e2 3f             	and    $0x3f,%edx
+     1da:	83 fa 3f             	cmp    $0x3f,%edx
+     1dd:	74 12                	je     1f1 <main+0x71>
+     1df:	8d 0c 33             	lea    (%ebx,%esi,1),%ecx
+     1e2:	89 c8                	mov    %ecx,%eax
+     1e4:	f7 e7                	mul    %edi
+     1e6:	c1 ea 03             	shr    $0x3,%edx
+     1e9:	6b d2 1a             	imul   $0x1a,%edx,%edx
+     1ec:	29 d1                	sub    %edx,%ecx
+     1ee:	83 c1 61             	add    $0x61,%ecx
+     1f1:	88 8b 20 22 00 00    	mov    %cl,0x2220(%ebx)
+    for(j = 0; j < BSIZE; j++)
+     1f7:	83 c3 01             	add    $0x1,%ebx
+     1fa:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+     200:	75 ce                	jne    1d0 <main+0x50>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+     202:	83 ec 04             	sub    $0x4,%esp
+     205:	68 00 02 00 00       	push   $0x200
+     20a:	68 20 22 00 00       	push   $0x2220
+     20f:	ff 75 e4             	push   -0x1c(%ebp)
+     212:	e8 69 04 00 00       	call   680 <write>
+     217:	83 c4 10             	add    $0x10,%esp
+     21a:	3d 00 02 00 00       	cmp    $0x200,%eax
+     21f:	0f 85 90 00 00 00    	jne    2b5 <main+0x135>
+  for(i = 0; i < FILESZ/BSIZE; i++){
+     225:	83 c6 01             	add    $0x1,%esi
+     228:	81 fe 80 00 00 00    	cmp    $0x80,%esi
+     22e:	75 98                	jne    1c8 <main+0x48>
+      printf(1, "pcbench: write failed\n");
+      exit();
+    }
+  }
+  close(fd);
+     230:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+     233:	83 ec 0c             	sub    $0xc,%esp
+     236:	51                   	push   %ecx
+     237:	e8 c4 04 00 00       	call   700 <close>
+
+  // The writes went through the buffer cache but did not fill
+  // the page cache, so the first pass starts cold.
+  for(i = 0; i < NPASS; i++)
+    readpass(i);
+     23c:	31 c0                	xor    %eax,%eax
+     23e:	89 04 24             	mov    %eax,(%esp)
+     241:	e8 ba fd ff ff       	call   0 <readpass>
+     246:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     24d:	e8 ae fd ff ff       	call   0 <readpass>
+     252:	c7 04 24 02 00 00 00 	movl   $0x2,(%esp)
+     259:	e8 a2 fd ff ff       	call   0 <readpass>
+     25e:	c7 04 24 03 00 00 00 	movl   $0x3,(%esp)
+     265:	e8 96 fd ff ff       	call   0 <readpass>
+     26a:	c7 04 24 04 00 00 00 	movl   $0x4,(%esp)
+     271:	e8 8a fd ff ff       	call   0 <readpass>
+  for(i = 0; i < NGREP; i++)
+    grep(i);
+     276:	31 d2                	xor    %edx,%edx
+     278:	89 14 24             	mov    %edx,(%esp)
+     27b:	e8 40 fe ff ff       	call   c0 <grep>
+     280:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     287:	e8 34 fe ff ff       	call   c0 <grep>
+     28c:	c7 04 24 02 00 00 00 	movl   $0x2,(%esp)
+     293:	e8 28 fe ff ff       	call   c0 <grep>
+     298:	c7 04 24 03 00 00 00 	movl   $0x3,(%esp)
+     29f:	e8 1c fe ff ff       	call   c0 <grep>
+
+  unlink("pcfile");
+     2a4:	c7 04 24 82 11 00 00 	movl   $0x1182,(%esp)
+     2ab:	e8 60 05 00 00       	call   810 <unlink>
+  exit();
+     2b0:	e8 fb 02 00 00       	call   5b0 <exit>
+      printf(1, "pcbench: write failed\n");
+     2b5:	51                   	push   %ecx
+     2b6:	51                   	push   %ecx
+     2b7:	68 e1 11 00 00       	push   $0x11e1
+     2bc:	6a 01                	push   $0x1
+     2be:	e8 7d 0a 00 00       	call   d40 <printf>
+      exit();
+     2c3:	e8 e8 02 00 00       	call   5b0 <exit>
+    printf(1, "pcbench: create pcfile failed\n");
+     2c8:	53                   	push   %ebx
+     2c9:	53                   	push   %ebx
+     2ca:	68 74 12 00 00       	push   $0x1274
+     2cf:	6a 01                	push   $0x1
+     2d1:	e8 6a 0a 00 00       	call   d40 <printf>
+    exit();
+     2d6:	e8 d5 02 00 00       	call   5b0 <exit>
+     2db:	66 90                	xchg   %ax,%ax
+     2dd:	66 90                	xchg   %ax,%ax
+     2df:	90                   	nop
+
+000002e0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     2e0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     2e1:	31 c0                	xor    %eax,%eax
+{
+     2e3:	89 e5                	mov    %esp,%ebp
+     2e5:	53                   	push   %ebx
+     2e6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     2e9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     2ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     2f0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     2f4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     2f7:	83 c0 01             	add    $0x1,%eax
+     2fa:	84 d2                	test   %dl,%dl
+     2fc:	75 f2                	jne    2f0 <strcpy+0x10>
+    ;
+  return os;
+}
+     2fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     301:	89 c8                	mov    %ecx,%eax
+     303:	c9                   	leave
+     304:	c3                   	ret
+     305:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     30c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000310 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     310:	55                   	push   %ebp
+     311:	89 e5                	mov    %esp,%ebp
+     313:	53                   	push   %ebx
+     314:	8b 55 08             	mov    0x8(%ebp),%edx
+     317:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     31a:	0f b6 02             	movzbl (%edx),%eax
+     31d:	84 c0                	test   %al,%al
+     31f:	75 17                	jne    338 <strcmp+0x28>
+     321:	eb 3a                	jmp    35d <strcmp+0x4d>
+     323:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     327:	90                   	nop
+     328:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     32c:	83 c2 01             	add    $0x1,%edx
+     32f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     332:	84 c0                	test   %al,%al
+     334:	74 1a                	je     350 <strcmp+0x40>
+    p++, q++;
+     336:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     338:	0f b6 19             	movzbl (%ecx),%ebx
+     33b:	38 c3                	cmp    %al,%bl
+     33d:	74 e9                	je     328 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     33f:	29 d8                	sub    %ebx,%eax
+}
+     341:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     344:	c9                   	leave
+     345:	c3                   	ret
+     346:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     34d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     350:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     354:	31 c0                	xor    %eax,%eax
+     356:	29 d8                	sub    %ebx,%eax
+}
+     358:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     35b:	c9                   	leave
+     35c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     35d:	0f b6 19             	movzbl (%ecx),%ebx
+     360:	31 c0                	xor    %eax,%eax
+     362:	eb db                	jmp    33f <strcmp+0x2f>
+     364:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     36b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     36f:	90                   	nop
+
+00000370 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     370:	55                   	push   %ebp
+     371:	89 e5                	mov    %esp,%ebp
+     373:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     376:	80 3a 00             	cmpb   $0x0,(%edx)
+     379:	74 15                	je     390 <strlen+0x20>
+     37b:	31 c0                	xor    %eax,%eax
+     37d:	8d 76 00             	lea    0x0(%esi),%esi
+     380:	83 c0 01             	add    $0x1,%eax
+     383:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     387:	89 c1                	mov    %eax,%ecx
+     389:	75 f5                	jne    380 <strlen+0x10>
+    ;
+  return n;
+}
+     38b:	89 c8                	mov    %ecx,%eax
+     38d:	5d                   	pop    %ebp
+     38e:	c3                   	ret
+     38f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     390:	31 c9                	xor    %ecx,%ecx
+}
+     392:	5d                   	pop    %ebp
+     393:	89 c8                	mov    %ecx,%eax
+     395:	c3                   	ret
+     396:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     39d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003a0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     3a0:	55                   	push   %ebp
+     3a1:	89 e5                	mov    %esp,%ebp
+     3a3:	57                   	push   %edi
+     3a4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     3a7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     3aa:	8b 45 0c             	mov    0xc(%ebp),%eax
+     3ad:	89 d7                	mov    %edx,%edi
+     3af:	fc                   	cld
+     3b0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     3b2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     3b5:	89 d0                	mov    %edx,%eax
+     3b7:	c9                   	leave
+     3b8:	c3                   	ret
+     3b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003c0 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     3c0:	55                   	push   %ebp
+     3c1:	89 e5                	mov    %esp,%ebp
+     3c3:	56                   	push   %esi
+     3c4:	53                   	push   %ebx
+     3c5:	8b 75 10             	mov    0x10(%ebp),%esi
+     3c8:	8b 55 08             	mov    0x8(%ebp),%edx
+     3cb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+     3ce:	85 f6                	test   %esi,%esi
+     3d0:	74 2e                	je     400 <memcmp+0x40>
+     3d2:	01 c6                	add    %eax,%esi
+     3d4:	eb 14                	jmp    3ea <memcmp+0x2a>
+     3d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3dd:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+     3e0:	83 c0 01             	add    $0x1,%eax
+     3e3:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+     3e6:	39 f0                	cmp    %esi,%eax
+     3e8:	74 16                	je     400 <memcmp+0x40>
+    if(*s1 != *s2)
+     3ea:	0f b6 0a             	movzbl (%edx),%ecx
+     3ed:	0f b6 18             	movzbl (%eax),%ebx
+     3f0:	38 d9                	cmp    %bl,%cl
+     3f2:	74 ec                	je     3e0 <memcmp+0x20>
+      return *s1 - *s2;
+     3f4:	0f b6 c1             	movzbl %cl,%eax
+     3f7:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+     3f9:	5b                   	pop    %ebx
+     3fa:	5e                   	pop    %esi
+     3fb:	5d                   	pop    %ebp
+     3fc:	c3                   	ret
+     3fd:	8d 76 00             	lea    0x0(%esi),%esi
+     400:	5b                   	pop    %ebx
+  return 0;
+     401:	31 c0                	xor    %eax,%eax
+}
+     403:	5e                   	pop    %esi
+     404:	5d                   	pop    %ebp
+     405:	c3                   	ret
+     406:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     40d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000410 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     410:	55                   	push   %ebp
+     411:	89 e5                	mov    %esp,%ebp
+     413:	8b 45 08             	mov    0x8(%ebp),%eax
+     416:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     41a:	0f b6 10             	movzbl (%eax),%edx
+     41d:	84 d2                	test   %dl,%dl
+     41f:	75 12                	jne    433 <strchr+0x23>
+     421:	eb 1d                	jmp    440 <strchr+0x30>
+     423:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     427:	90                   	nop
+     428:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     42c:	83 c0 01             	add    $0x1,%eax
+     42f:	84 d2                	test   %dl,%dl
+     431:	74 0d                	je     440 <strchr+0x30>
+    if(*s == c)
+     433:	38 d1                	cmp    %dl,%cl
+     435:	75 f1                	jne    428 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     437:	5d                   	pop    %ebp
+     438:	c3                   	ret
+     439:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     440:	31 c0                	xor    %eax,%eax
+}
+     442:	5d                   	pop    %ebp
+     443:	c3                   	ret
+     444:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     44b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     44f:	90                   	nop
+
+00000450 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     450:	55                   	push   %ebp
+     451:	89 e5                	mov    %esp,%ebp
+     453:	57                   	push   %edi
+     454:	56                   	push   %esi
+int
+read(int fd, void *buf, int n)
+{
+  if(flushhook)
+    flushhook();
+  return _read(fd, buf, n);
+     455:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     458:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     459:	31 db                	xor    %ebx,%ebx
+{
+     45b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     45e:	eb 32                	jmp    492 <gets+0x42>
+  if(flushhook)
+     460:	a1 20 24 00 00       	mov    0x2420,%eax
+     465:	85 c0                	test   %eax,%eax
+     467:	74 02                	je     46b <gets+0x1b>
+    flushhook();
+     469:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+     46b:	83 ec 04             	sub    $0x4,%esp
+     46e:	6a 01                	push   $0x1
+     470:	56                   	push   %esi
+     471:	6a 00                	push   $0x0
+     473:	e8 60 03 00 00       	call   7d8 <_read>
+    if(cc < 1)
+     478:	83 c4 10             	add    $0x10,%esp
+     47b:	85 c0                	test   %eax,%eax
+     47d:	7e 1d                	jle    49c <gets+0x4c>
+    buf[i++] = c;
+     47f:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     483:	8b 55 08             	mov    0x8(%ebp),%edx
+     486:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     48a:	3c 0a                	cmp    $0xa,%al
+     48c:	74 10                	je     49e <gets+0x4e>
+     48e:	3c 0d                	cmp    $0xd,%al
+     490:	74 0c                	je     49e <gets+0x4e>
+  for(i=0; i+1 < max; ){
+     492:	89 df                	mov    %ebx,%edi
+     494:	83 c3 01             	add    $0x1,%ebx
+     497:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     49a:	7c c4                	jl     460 <gets+0x10>
+     49c:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+     49e:	8b 45 08             	mov    0x8(%ebp),%eax
+     4a1:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+     4a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     4a8:	5b                   	pop    %ebx
+     4a9:	5e                   	pop    %esi
+     4aa:	5f                   	pop    %edi
+     4ab:	5d                   	pop    %ebp
+     4ac:	c3                   	ret
+     4ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000004b0 <stat>:
+{
+     4b0:	55                   	push   %ebp
+     4b1:	89 e5                	mov    %esp,%ebp
+     4b3:	56                   	push   %esi
+     4b4:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+     4b5:	83 ec 08             	sub    $0x8,%esp
+     4b8:	6a 00                	push   $0x0
+     4ba:	ff 75 08             	push   0x8(%ebp)
+     4bd:	e8 3e 03 00 00       	call   800 <open>
+  if(fd < 0)
+     4c2:	83 c4 10             	add    $0x10,%esp
+     4c5:	85 c0                	test   %eax,%eax
+     4c7:	78 37                	js     500 <stat+0x50>
+  r = fstat(fd, st);
+     4c9:	83 ec 08             	sub    $0x8,%esp
+     4cc:	ff 75 0c             	push   0xc(%ebp)
+     4cf:	89 c3                	mov    %eax,%ebx
+     4d1:	50                   	push   %eax
+     4d2:	e8 41 03 00 00       	call   818 <fstat>
+}
+
+int
+close(int fd)
+{
+  if(flushhook)
+     4d7:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+     4da:	89 c6                	mov    %eax,%esi
+  if(flushhook)
+     4dc:	a1 20 24 00 00       	mov    0x2420,%eax
+     4e1:	85 c0                	test   %eax,%eax
+     4e3:	74 02                	je     4e7 <stat+0x37>
+    flushhook();
+     4e5:	ff d0                	call   *%eax
+  return _close(fd);
+     4e7:	83 ec 0c             	sub    $0xc,%esp
+     4ea:	53                   	push   %ebx
+     4eb:	e8 f8 02 00 00       	call   7e8 <_close>
+     4f0:	83 c4 10             	add    $0x10,%esp
+}
+     4f3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     4f6:	89 f0                	mov    %esi,%eax
+     4f8:	5b                   	pop    %ebx
+     4f9:	5e                   	pop    %esi
+     4fa:	5d                   	pop    %ebp
+     4fb:	c3                   	ret
+     4fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+     500:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     505:	eb ec                	jmp    4f3 <stat+0x43>
+     507:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     50e:	66 90                	xchg   %ax,%ax
+
+00000510 <atoi>:
+{
+     510:	55                   	push   %ebp
+     511:	89 e5                	mov    %esp,%ebp
+     513:	53                   	push   %ebx
+     514:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+     517:	0f be 02             	movsbl (%edx),%eax
+     51a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     51d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     520:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     525:	77 1e                	ja     545 <atoi+0x35>
+     527:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     52e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     530:	83 c2 01             	add    $0x1,%edx
+     533:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     536:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     53a:	0f be 02             	movsbl (%edx),%eax
+     53d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     540:	80 fb 09             	cmp    $0x9,%bl
+     543:	76 eb                	jbe    530 <atoi+0x20>
+}
+     545:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     548:	89 c8                	mov    %ecx,%eax
+     54a:	c9                   	leave
+     54b:	c3                   	ret
+     54c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000550 <memmove>:
+{
+     550:	55                   	push   %ebp
+     551:	89 e5                	mov    %esp,%ebp
+     553:	57                   	push   %edi
+     554:	56                   	push   %esi
+     555:	8b 45 10             	mov    0x10(%ebp),%eax
+     558:	8b 55 08             	mov    0x8(%ebp),%edx
+     55b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+     55e:	85 c0                	test   %eax,%eax
+     560:	7e 13                	jle    575 <memmove+0x25>
+     562:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     564:	89 d7                	mov    %edx,%edi
+     566:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     56d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     570:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     571:	39 f8                	cmp    %edi,%eax
+     573:	75 fb                	jne    570 <memmove+0x20>
+}
+     575:	5e                   	pop    %esi
+     576:	89 d0                	mov    %edx,%eax
+     578:	5f                   	pop    %edi
+     579:	5d                   	pop    %ebp
+     57a:	c3                   	ret
+     57b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     57f:	90                   	nop
+
+00000580 <fork>:
+  if(flushhook)
+     580:	a1 20 24 00 00       	mov    0x2420,%eax
+     585:	85 c0                	test   %eax,%eax
+     587:	74 17                	je     5a0 <fork+0x20>
+{
+     589:	55                   	push   %ebp
+     58a:	89 e5                	mov    %esp,%ebp
+     58c:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+     58f:	ff d0                	call   *%eax
+}
+     591:	c9                   	leave
+  return _fork();
+     592:	e9 21 02 00 00       	jmp    7b8 <_fork>
+     597:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     59e:	66 90                	xchg   %ax,%ax
+     5a0:	e9 13 02 00 00       	jmp    7b8 <_fork>
+     5a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005b0 <exit>:
+{
+     5b0:	55                   	push   %ebp
+     5b1:	89 e5                	mov    %esp,%ebp
+     5b3:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+     5b6:	a1 20 24 00 00       	mov    0x2420,%eax
+     5bb:	85 c0                	test   %eax,%eax
+     5bd:	74 02                	je     5c1 <exit+0x11>
+    flushhook();
+     5bf:	ff d0                	call   *%eax
+  _exit();
+     5c1:	e8 fa 01 00 00       	call   7c0 <_exit>
+     5c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000005d0 <exec>:
+{
+     5d0:	55                   	push   %ebp
+  if(flushhook)
+     5d1:	a1 20 24 00 00       	mov    0x2420,%eax
+{
+     5d6:	89 e5                	mov    %esp,%ebp
+     5d8:	56                   	push   %esi
+     5d9:	53                   	push   %ebx
+     5da:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     5dd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+     5e0:	85 c0                	test   %eax,%eax
+     5e2:	74 02                	je     5e6 <exec+0x16>
+    flushhook();
+     5e4:	ff d0                	call   *%eax
+  return _exec(path, argv);
+     5e6:	89 75 0c             	mov    %esi,0xc(%ebp)
+     5e9:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     5ec:	5b                   	pop    %ebx
+     5ed:	5e                   	pop    %esi
+     5ee:	5d                   	pop    %ebp
+  return _exec(path, argv);
+     5ef:	e9 04 02 00 00       	jmp    7f8 <_exec>
+     5f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     5ff:	90                   	nop
+
+00000600 <read>:
+{
+     600:	55                   	push   %ebp
+     601:	89 e5                	mov    %esp,%ebp
+     603:	57                   	push   %edi
+     604:	56                   	push   %esi
+     605:	53                   	push   %ebx
+     606:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     609:	a1 20 24 00 00       	mov    0x2420,%eax
+{
+     60e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     611:	8b 75 0c             	mov    0xc(%ebp),%esi
+     614:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     617:	85 c0                	test   %eax,%eax
+     619:	74 02                	je     61d <read+0x1d>
+    flushhook();
+     61b:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+     61d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     620:	89 75 0c             	mov    %esi,0xc(%ebp)
+     623:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     626:	83 c4 0c             	add    $0xc,%esp
+     629:	5b                   	pop    %ebx
+     62a:	5e                   	pop    %esi
+     62b:	5f                   	pop    %edi
+     62c:	5d                   	pop    %ebp
+  return _read(fd, buf, n);
+     62d:	e9 a6 01 00 00       	jmp    7d8 <_read>
+     632:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     639:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000640 <readv>:
+{
+     640:	55                   	push   %ebp
+     641:	89 e5                	mov    %esp,%ebp
+     643:	57                   	push   %edi
+     644:	56                   	push   %esi
+     645:	53                   	push   %ebx
+     646:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     649:	a1 20 24 00 00       	mov    0x2420,%eax
+{
+     64e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     651:	8b 75 0c             	mov    0xc(%ebp),%esi
+     654:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     657:	85 c0                	test   %eax,%eax
+     659:	74 02                	je     65d <readv+0x1d>
+    flushhook();
+     65b:	ff d0                	call   *%eax
+  return _readv(fd, iov, cnt);
+     65d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     660:	89 75 0c             	mov    %esi,0xc(%ebp)
+     663:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     666:	83 c4 0c             	add    $0xc,%esp
+     669:	5b                   	pop    %ebx
+     66a:	5e                   	pop    %esi
+     66b:	5f                   	pop    %edi
+     66c:	5d                   	pop    %ebp
+  return _readv(fd, iov, cnt);
+     66d:	e9 76 02 00 00       	jmp    8e8 <_readv>
+     672:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     679:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000680 <write>:
+{
+     680:	55                   	push   %ebp
+     681:	89 e5                	mov    %esp,%ebp
+     683:	57                   	push   %edi
+     684:	56                   	push   %esi
+     685:	53                   	push   %ebx
+     686:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     689:	a1 20 24 00 00       	mov    0x2420,%eax
+{
+     68e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     691:	8b 75 0c             	mov    0xc(%ebp),%esi
+     694:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     697:	85 c0                	test   %eax,%eax
+     699:	74 02                	je     69d <write+0x1d>
+    flushhook();
+     69b:	ff d0                	call   *%eax
+  return _write(fd, buf, n);
+     69d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     6a0:	89 75 0c             	mov    %esi,0xc(%ebp)
+     6a3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     6a6:	83 c4 0c             	add    $0xc,%esp
+     6a9:	5b                   	pop    %ebx
+     6aa:	5e                   	pop    %esi
+     6ab:	5f                   	pop    %edi
+     6ac:	5d                   	pop    %ebp
+  return _write(fd, buf, n);
+     6ad:	e9 2e 01 00 00       	jmp    7e0 <_write>
+     6b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000006c0 <writev>:
+{
+     6c0:	55                   	push   %ebp
+     6c1:	89 e5                	mov    %esp,%ebp
+     6c3:	57                   	push   %edi
+     6c4:	56                   	push   %esi
+     6c5:	53                   	push   %ebx
+     6c6:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     6c9:	a1 20 24 00 00       	mov    0x2420,%eax
+{
+     6ce:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     6d1:	8b 75 0c             	mov    0xc(%ebp),%esi
+     6d4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     6d7:	85 c0                	test   %eax,%eax
+     6d9:	74 02                	je     6dd <writev+0x1d>
+    flushhook();
+     6db:	ff d0                	call   *%eax
+  return _writev(fd, iov, cnt);
+     6dd:	89 7d 10             	mov    %edi,0x10(%ebp)
+     6e0:	89 75 0c             	mov    %esi,0xc(%ebp)
+     6e3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     6e6:	83 c4 0c             	add    $0xc,%esp
+     6e9:	5b                   	pop    %ebx
+     6ea:	5e                   	pop    %esi
+     6eb:	5f                   	pop    %edi
+     6ec:	5d                   	pop    %ebp
+  return _writev(fd, iov, cnt);
+     6ed:	e9 fe 01 00 00       	jmp    8f0 <_writev>
+     6f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000700 <close>:
+{
+     700:	55                   	push   %ebp
+     701:	89 e5                	mov    %esp,%ebp
+     703:	53                   	push   %ebx
+     704:	83 ec 04             	sub    $0x4,%esp
+  if(flushhook)
+     707:	a1 20 24 00 00       	mov    0x2420,%eax
+{
+     70c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(flushhook)
+     70f:	85 c0                	test   %eax,%eax
+     711:	74 02                	je     715 <close+0x15>
+    flushhook();
+     713:	ff d0                	call   *%eax
+  return _close(fd);
+     715:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     718:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     71b:	c9                   	leave
+  return _close(fd);
+     71c:	e9 c7 00 00 00       	jmp    7e8 <_close>
+     721:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     728:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     72f:	90                   	nop
+
+00000730 <umtxinit>:
+// process that finds the mutex held enters the kernel, to sleep
+// in futexwait() until the holder's umtxunlock() wakes it.
+
+void
+umtxinit(struct umutex *m)
+{
+     730:	55                   	push   %ebp
+     731:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+     733:	8b 45 08             	mov    0x8(%ebp),%eax
+     736:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     73c:	5d                   	pop    %ebp
+     73d:	c3                   	ret
+     73e:	66 90                	xchg   %ax,%ax
+
+00000740 <umtxlock>:
+
+void
+umtxlock(struct umutex *m)
+{
+     740:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+     741:	b8 01 00 00 00       	mov    $0x1,%eax
+     746:	89 e5                	mov    %esp,%ebp
+     748:	56                   	push   %esi
+     749:	53                   	push   %ebx
+     74a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     74d:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 1) == 0)
+     750:	85 c0                	test   %eax,%eax
+     752:	74 2b                	je     77f <umtxlock+0x3f>
+     754:	b8 02 00 00 00       	mov    $0x2,%eax
+     759:	f0 87 03             	lock xchg %eax,(%ebx)
+    return;
+  // Mark the mutex contended, so that its holder
+  // wakes a waiter on release, and wait.
+  while(xchg(&m->state, 2) != 0)
+     75c:	85 c0                	test   %eax,%eax
+     75e:	74 1f                	je     77f <umtxlock+0x3f>
+     760:	be 02 00 00 00       	mov    $0x2,%esi
+     765:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwait(&m->state, 2);
+     768:	83 ec 08             	sub    $0x8,%esp
+     76b:	6a 02                	push   $0x2
+     76d:	53                   	push   %ebx
+     76e:	e8 85 01 00 00       	call   8f8 <futexwait>
+     773:	89 f0                	mov    %esi,%eax
+     775:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+     778:	83 c4 10             	add    $0x10,%esp
+     77b:	85 c0                	test   %eax,%eax
+     77d:	75 e9                	jne    768 <umtxlock+0x28>
+}
+     77f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     782:	5b                   	pop    %ebx
+     783:	5e                   	pop    %esi
+     784:	5d                   	pop    %ebp
+     785:	c3                   	ret
+     786:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     78d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000790 <umtxunlock>:
+
+void
+umtxunlock(struct umutex *m)
+{
+     790:	55                   	push   %ebp
+     791:	31 c0                	xor    %eax,%eax
+     793:	89 e5                	mov    %esp,%ebp
+     795:	83 ec 08             	sub    $0x8,%esp
+     798:	8b 55 08             	mov    0x8(%ebp),%edx
+     79b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+     79e:	83 f8 02             	cmp    $0x2,%eax
+     7a1:	74 05                	je     7a8 <umtxunlock+0x18>
+    futexwake(&m->state, 1);
+}
+     7a3:	c9                   	leave
+     7a4:	c3                   	ret
+     7a5:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwake(&m->state, 1);
+     7a8:	83 ec 08             	sub    $0x8,%esp
+     7ab:	6a 01                	push   $0x1
+     7ad:	52                   	push   %edx
+     7ae:	e8 4d 01 00 00       	call   900 <futexwake>
+     7b3:	83 c4 10             	add    $0x10,%esp
+}
+     7b6:	c9                   	leave
+     7b7:	c3                   	ret
+
+000007b8 <_fork>:
+  _ ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+     7b8:	b8 01 00 00 00       	mov    $0x1,%eax
+     7bd:	cd 40                	int    $0x40
+     7bf:	c3                   	ret
+
+000007c0 <_exit>:
+RAWSYSCALL(exit)
+     7c0:	b8 02 00 00 00       	mov    $0x2,%eax
+     7c5:	cd 40                	int    $0x40
+     7c7:	c3                   	ret
+
+000007c8 <wait>:
+SYSCALL(wait)
+     7c8:	b8 03 00 00 00       	mov    $0x3,%eax
+     7cd:	cd 40                	int    $0x40
+     7cf:	c3                   	ret
+
+000007d0 <pipe>:
+SYSCALL(pipe)
+     7d0:	b8 04 00 00 00       	mov    $0x4,%eax
+     7d5:	cd 40                	int    $0x40
+     7d7:	c3                   	ret
+
+000007d8 <_read>:
+RAWSYSCALL(read)
+     7d8:	b8 05 00 00 00       	mov    $0x5,%eax
+     7dd:	cd 40                	int    $0x40
+     7df:	c3                   	ret
+
+000007e0 <_write>:
+RAWSYSCALL(write)
+     7e0:	b8 10 00 00 00       	mov    $0x10,%eax
+     7e5:	cd 40                	int    $0x40
+     7e7:	c3                   	ret
+
+000007e8 <_close>:
+RAWSYSCALL(close)
+     7e8:	b8 15 00 00 00       	mov    $0x15,%eax
+     7ed:	cd 40                	int    $0x40
+     7ef:	c3                   	ret
+
+000007f0 <kill>:
+SYSCALL(kill)
+     7f0:	b8 06 00 00 00       	mov    $0x6,%eax
+     7f5:	cd 40                	int    $0x40
+     7f7:	c3                   	ret
+
+000007f8 <_exec>:
+RAWSYSCALL(exec)
+     7f8:	b8 07 00 00 00       	mov    $0x7,%eax
+     7fd:	cd 40                	int    $0x40
+     7ff:	c3                   	ret
+
+00000800 <open>:
+SYSCALL(open)
+     800:	b8 0f 00 00 00       	mov    $0xf,%eax
+     805:	cd 40                	int    $0x40
+     807:	c3                   	ret
+
+00000808 <mknod>:
+SYSCALL(mknod)
+     808:	b8 11 00 00 00       	mov    $0x11,%eax
+     80d:	cd 40                	int    $0x40
+     80f:	c3                   	ret
+
+00000810 <unlink>:
+SYSCALL(unlink)
+     810:	b8 12 00 00 00       	mov    $0x12,%eax
+     815:	cd 40                	int    $0x40
+     817:	c3                   	ret
+
+00000818 <fstat>:
+SYSCALL(fstat)
+     818:	b8 08 00 00 00       	mov    $0x8,%eax
+     81d:	cd 40                	int    $0x40
+     81f:	c3                   	ret
+
+00000820 <link>:
+SYSCALL(link)
+     820:	b8 13 00 00 00       	mov    $0x13,%eax
+     825:	cd 40                	int    $0x40
+     827:	c3                   	ret
+
+00000828 <mkdir>:
+SYSCALL(mkdir)
+     828:	b8 14 00 00 00       	mov    $0x14,%eax
+     82d:	cd 40                	int    $0x40
+     82f:	c3                   	ret
+
+00000830 <chdir>:
+SYSCALL(chdir)
+     830:	b8 09 00 00 00       	mov    $0x9,%eax
+     835:	cd 40                	int    $0x40
+     837:	c3                   	ret
+
+00000838 <dup>:
+SYSCALL(dup)
+     838:	b8 0a 00 00 00       	mov    $0xa,%eax
+     83d:	cd 40                	int    $0x40
+     83f:	c3                   	ret
+
+00000840 <getpid>:
+SYSCALL(getpid)
+     840:	b8 0b 00 00 00       	mov    $0xb,%eax
+     845:	cd 40                	int    $0x40
+     847:	c3                   	ret
+
+00000848 <sbrk>:
+SYSCALL(sbrk)
+     848:	b8 0c 00 00 00       	mov    $0xc,%eax
+     84d:	cd 40                	int    $0x40
+     84f:	c3                   	ret
+
+00000850 <sleep>:
+SYSCALL(sleep)
+     850:	b8 0d 00 00 00       	mov    $0xd,%eax
+     855:	cd 40                	int    $0x40
+     857:	c3                   	ret
+
+00000858 <uptime>:
+SYSCALL(uptime)
+     858:	b8 0e 00 00 00       	mov    $0xe,%eax
+     85d:	cd 40                	int    $0x40
+     85f:	c3                   	ret
+
+00000860 <wolfie>:
+SYSCALL(wolfie)
+     860:	b8 16 00 00 00       	mov    $0x16,%eax
+     865:	cd 40                	int    $0x40
+     867:	c3                   	ret
+
+00000868 <nice>:
+SYSCALL(nice)
+     868:	b8 17 00 00 00       	mov    $0x17,%eax
+     86d:	cd 40                	int    $0x40
+     86f:	c3                   	ret
+
+00000870 <mtxget>:
+SYSCALL(mtxget)
+     870:	b8 18 00 00 00       	mov    $0x18,%eax
+     875:	cd 40                	int    $0x40
+     877:	c3                   	ret
+
+00000878 <mtxrel>:
+SYSCALL(mtxrel)
+     878:	b8 19 00 00 00       	mov    $0x19,%eax
+     87d:	cd 40                	int    $0x40
+     87f:	c3                   	ret
+
+00000880 <mtxacq>:
+SYSCALL(mtxacq)
+     880:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     885:	cd 40                	int    $0x40
+     887:	c3                   	ret
+
+00000888 <mtxdel>:
+SYSCALL(mtxdel)
+     888:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     88d:	cd 40                	int    $0x40
+     88f:	c3                   	ret
+
+00000890 <iostat>:
+SYSCALL(iostat)
+     890:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     895:	cd 40                	int    $0x40
+     897:	c3                   	ret
+
+00000898 <mmap>:
+SYSCALL(mmap)
+     898:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     89d:	cd 40                	int    $0x40
+     89f:	c3                   	ret
+
+000008a0 <munmap>:
+SYSCALL(munmap)
+     8a0:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     8a5:	cd 40                	int    $0x40
+     8a7:	c3                   	ret
+
+000008a8 <shmget>:
+SYSCALL(shmget)
+     8a8:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     8ad:	cd 40                	int    $0x40
+     8af:	c3                   	ret
+
+000008b0 <shmat>:
+SYSCALL(shmat)
+     8b0:	b8 20 00 00 00       	mov    $0x20,%eax
+     8b5:	cd 40                	int    $0x40
+     8b7:	c3                   	ret
+
+000008b8 <shmdt>:
+SYSCALL(shmdt)
+     8b8:	b8 21 00 00 00       	mov    $0x21,%eax
+     8bd:	cd 40                	int    $0x40
+     8bf:	c3                   	ret
+
+000008c0 <shmdel>:
+SYSCALL(shmdel)
+     8c0:	b8 22 00 00 00       	mov    $0x22,%eax
+     8c5:	cd 40                	int    $0x40
+     8c7:	c3                   	ret
+
+000008c8 <syscount>:
+SYSCALL(syscount)
+     8c8:	b8 23 00 00 00       	mov    $0x23,%eax
+     8cd:	cd 40                	int    $0x40
+     8cf:	c3                   	ret
+
+000008d0 <splice>:
+SYSCALL(splice)
+     8d0:	b8 24 00 00 00       	mov    $0x24,%eax
+     8d5:	cd 40                	int    $0x40
+     8d7:	c3                   	ret
+
+000008d8 <tee>:
+SYSCALL(tee)
+     8d8:	b8 25 00 00 00       	mov    $0x25,%eax
+     8dd:	cd 40                	int    $0x40
+     8df:	c3                   	ret
+
+000008e0 <sendfile>:
+SYSCALL(sendfile)
+     8e0:	b8 26 00 00 00       	mov    $0x26,%eax
+     8e5:	cd 40                	int    $0x40
+     8e7:	c3                   	ret
+
+000008e8 <_readv>:
+RAWSYSCALL(readv)
+     8e8:	b8 27 00 00 00       	mov    $0x27,%eax
+     8ed:	cd 40                	int    $0x40
+     8ef:	c3                   	ret
+
+000008f0 <_writev>:
+RAWSYSCALL(writev)
+     8f0:	b8 28 00 00 00       	mov    $0x28,%eax
+     8f5:	cd 40                	int    $0x40
+     8f7:	c3                   	ret
+
+000008f8 <futexwait>:
+SYSCALL(futexwait)
+     8f8:	b8 29 00 00 00       	mov    $0x29,%eax
+     8fd:	cd 40                	int    $0x40
+     8ff:	c3                   	ret
+
+00000900 <futexwake>:
+SYSCALL(futexwake)
+     900:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     905:	cd 40                	int    $0x40
+     907:	c3                   	ret
+
+00000908 <lockstat>:
+SYSCALL(lockstat)
+     908:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     90d:	cd 40                	int    $0x40
+     90f:	c3                   	ret
+
+00000910 <clone>:
+SYSCALL(clone)
+     910:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     915:	cd 40                	int    $0x40
+     917:	c3                   	ret
+
+00000918 <join>:
+SYSCALL(join)
+     918:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     91d:	cd 40                	int    $0x40
+     91f:	c3                   	ret
+
+00000920 <stacklimit>:
+SYSCALL(stacklimit)
+     920:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     925:	cd 40                	int    $0x40
+     927:	c3                   	ret
+     928:	66 90                	xchg   %ax,%ax
+     92a:	66 90                	xchg   %ax,%ax
+     92c:	66 90                	xchg   %ax,%ax
+     92e:	66 90                	xchg   %ax,%ax
+
+00000930 <flushall>:
+  b->n = 0;
+}
+
+static void
+flushall(void)
+{
+     930:	55                   	push   %ebp
+     931:	89 e5                	mov    %esp,%ebp
+     933:	83 ec 14             	sub    $0x14,%esp
+  umtxlock(&stdoutlock);
+     936:	68 24 24 00 00       	push   $0x2424
+     93b:	e8 00 fe ff ff       	call   740 <umtxlock>
+  if(b->n > 0)
+     940:	a1 08 20 00 00       	mov    0x2008,%eax
+     945:	83 c4 10             	add    $0x10,%esp
+     948:	85 c0                	test   %eax,%eax
+     94a:	7e 17                	jle    963 <flushall+0x33>
+    _write(b->fd, b->buf, b->n);
+     94c:	83 ec 04             	sub    $0x4,%esp
+     94f:	50                   	push   %eax
+     950:	68 0c 20 00 00       	push   $0x200c
+     955:	ff 35 00 20 00 00    	push   0x2000
+     95b:	e8 80 fe ff ff       	call   7e0 <_write>
+     960:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     963:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     96a:	00 00 00 
+  flush(&stdout);
+  umtxunlock(&stdoutlock);
+     96d:	83 ec 0c             	sub    $0xc,%esp
+     970:	68 24 24 00 00       	push   $0x2424
+     975:	e8 16 fe ff ff       	call   790 <umtxunlock>
+}
+     97a:	83 c4 10             	add    $0x10,%esp
+     97d:	c9                   	leave
+     97e:	c3                   	ret
+     97f:	90                   	nop
+
+00000980 <printint>:
+    flush(b);
+}
+
+static void
+printint(struct outbuf *b, int xx, int base, int sgn)
+{
+     980:	55                   	push   %ebp
+     981:	89 e5                	mov    %esp,%ebp
+     983:	57                   	push   %edi
+     984:	89 cf                	mov    %ecx,%edi
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     986:	89 d1                	mov    %edx,%ecx
+{
+     988:	56                   	push   %esi
+     989:	53                   	push   %ebx
+     98a:	89 c3                	mov    %eax,%ebx
+     98c:	83 ec 2c             	sub    $0x2c,%esp
+  if(sgn && xx < 0){
+     98f:	85 d2                	test   %edx,%edx
+     991:	0f 89 b9 00 00 00    	jns    a50 <printint+0xd0>
+     997:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     99b:	0f 84 af 00 00 00    	je     a50 <printint+0xd0>
+    x = -xx;
+     9a1:	f7 d9                	neg    %ecx
+    neg = 1;
+     9a3:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     9a8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     9ab:	31 f6                	xor    %esi,%esi
+     9ad:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     9b0:	89 c8                	mov    %ecx,%eax
+     9b2:	31 d2                	xor    %edx,%edx
+     9b4:	89 f3                	mov    %esi,%ebx
+     9b6:	f7 f7                	div    %edi
+     9b8:	8d 76 01             	lea    0x1(%esi),%esi
+     9bb:	0f b6 92 fc 16 00 00 	movzbl 0x16fc(%edx),%edx
+     9c2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     9c6:	89 ca                	mov    %ecx,%edx
+     9c8:	89 c1                	mov    %eax,%ecx
+     9ca:	39 fa                	cmp    %edi,%edx
+     9cc:	73 e2                	jae    9b0 <printint+0x30>
+  if(neg)
+     9ce:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     9d1:	89 d9                	mov    %ebx,%ecx
+     9d3:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     9d6:	85 c0                	test   %eax,%eax
+     9d8:	74 07                	je     9e1 <printint+0x61>
+    buf[i++] = '-';
+     9da:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     9df:	89 f1                	mov    %esi,%ecx
+     9e1:	8d 75 d8             	lea    -0x28(%ebp),%esi
+     9e4:	89 cf                	mov    %ecx,%edi
+     9e6:	01 f7                	add    %esi,%edi
+     9e8:	eb 1a                	jmp    a04 <printint+0x84>
+     9ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    *b->str++ = c;
+     9f0:	8d 48 01             	lea    0x1(%eax),%ecx
+     9f3:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+     9f9:	88 10                	mov    %dl,(%eax)
+
+  while(--i >= 0)
+     9fb:	8d 47 ff             	lea    -0x1(%edi),%eax
+     9fe:	39 fe                	cmp    %edi,%esi
+     a00:	74 40                	je     a42 <printint+0xc2>
+     a02:	89 c7                	mov    %eax,%edi
+  if(b->str){
+     a04:	8b 83 0c 02 00 00    	mov    0x20c(%ebx),%eax
+    putc(b, buf[i]);
+     a0a:	0f b6 17             	movzbl (%edi),%edx
+  if(b->str){
+     a0d:	85 c0                	test   %eax,%eax
+     a0f:	75 df                	jne    9f0 <printint+0x70>
+  b->buf[b->n++] = c;
+     a11:	8b 4b 08             	mov    0x8(%ebx),%ecx
+     a14:	8d 41 01             	lea    0x1(%ecx),%eax
+     a17:	89 43 08             	mov    %eax,0x8(%ebx)
+     a1a:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+     a1e:	3d 00 02 00 00       	cmp    $0x200,%eax
+     a23:	74 3b                	je     a60 <printint+0xe0>
+     a25:	80 fa 0a             	cmp    $0xa,%dl
+     a28:	75 d1                	jne    9fb <printint+0x7b>
+     a2a:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+     a2e:	75 cb                	jne    9fb <printint+0x7b>
+  if(b->n > 0)
+     a30:	85 c0                	test   %eax,%eax
+     a32:	7f 2c                	jg     a60 <printint+0xe0>
+  b->n = 0;
+     a34:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  while(--i >= 0)
+     a3b:	8d 47 ff             	lea    -0x1(%edi),%eax
+     a3e:	39 fe                	cmp    %edi,%esi
+     a40:	75 c0                	jne    a02 <printint+0x82>
+}
+     a42:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a45:	5b                   	pop    %ebx
+     a46:	5e                   	pop    %esi
+     a47:	5f                   	pop    %edi
+     a48:	5d                   	pop    %ebp
+     a49:	c3                   	ret
+     a4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  neg = 0;
+     a50:	31 c0                	xor    %eax,%eax
+     a52:	e9 51 ff ff ff       	jmp    9a8 <printint+0x28>
+     a57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a5e:	66 90                	xchg   %ax,%ax
+    _write(b->fd, b->buf, b->n);
+     a60:	83 ec 04             	sub    $0x4,%esp
+     a63:	50                   	push   %eax
+     a64:	8d 43 0c             	lea    0xc(%ebx),%eax
+     a67:	50                   	push   %eax
+     a68:	ff 33                	push   (%ebx)
+     a6a:	e8 71 fd ff ff       	call   7e0 <_write>
+     a6f:	83 c4 10             	add    $0x10,%esp
+     a72:	eb c0                	jmp    a34 <printint+0xb4>
+     a74:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     a7f:	90                   	nop
+
+00000a80 <putc>:
+{
+     a80:	55                   	push   %ebp
+     a81:	89 e5                	mov    %esp,%ebp
+     a83:	53                   	push   %ebx
+     a84:	89 c3                	mov    %eax,%ebx
+     a86:	83 ec 04             	sub    $0x4,%esp
+  if(b->str){
+     a89:	8b 80 0c 02 00 00    	mov    0x20c(%eax),%eax
+     a8f:	85 c0                	test   %eax,%eax
+     a91:	74 15                	je     aa8 <putc+0x28>
+    *b->str++ = c;
+     a93:	8d 48 01             	lea    0x1(%eax),%ecx
+     a96:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+     a9c:	88 10                	mov    %dl,(%eax)
+}
+     a9e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     aa1:	c9                   	leave
+     aa2:	c3                   	ret
+     aa3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     aa7:	90                   	nop
+  b->buf[b->n++] = c;
+     aa8:	8b 4b 08             	mov    0x8(%ebx),%ecx
+     aab:	8d 41 01             	lea    0x1(%ecx),%eax
+     aae:	89 43 08             	mov    %eax,0x8(%ebx)
+     ab1:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+     ab5:	3d 00 02 00 00       	cmp    $0x200,%eax
+     aba:	74 14                	je     ad0 <putc+0x50>
+     abc:	80 fa 0a             	cmp    $0xa,%dl
+     abf:	75 dd                	jne    a9e <putc+0x1e>
+     ac1:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+     ac5:	75 d7                	jne    a9e <putc+0x1e>
+  if(b->n > 0)
+     ac7:	85 c0                	test   %eax,%eax
+     ac9:	7e 17                	jle    ae2 <putc+0x62>
+     acb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     acf:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     ad0:	83 ec 04             	sub    $0x4,%esp
+     ad3:	50                   	push   %eax
+     ad4:	8d 43 0c             	lea    0xc(%ebx),%eax
+     ad7:	50                   	push   %eax
+     ad8:	ff 33                	push   (%ebx)
+     ada:	e8 01 fd ff ff       	call   7e0 <_write>
+     adf:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     ae2:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+     ae9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     aec:	c9                   	leave
+     aed:	c3                   	ret
+     aee:	66 90                	xchg   %ax,%ax
+
+00000af0 <format>:
+
+// Format fmt and the arguments at ap into b.
+// Only understands %d, %x, %p, %s, %c.
+static void
+format(struct outbuf *b, const char *fmt, uint *ap)
+{
+     af0:	55                   	push   %ebp
+     af1:	89 e5                	mov    %esp,%ebp
+     af3:	57                   	push   %edi
+     af4:	89 c7                	mov    %eax,%edi
+     af6:	56                   	push   %esi
+     af7:	53                   	push   %ebx
+     af8:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+     afb:	0f b6 02             	movzbl (%edx),%eax
+{
+     afe:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  for(i = 0; fmt[i]; i++){
+     b01:	84 c0                	test   %al,%al
+     b03:	74 5a                	je     b5f <format+0x6f>
+     b05:	8d 5a 01             	lea    0x1(%edx),%ebx
+     b08:	31 f6                	xor    %esi,%esi
+     b0a:	eb 1c                	jmp    b28 <format+0x38>
+     b0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     b10:	83 f8 25             	cmp    $0x25,%eax
+     b13:	74 3b                	je     b50 <format+0x60>
+        state = '%';
+      } else {
+        putc(b, c);
+     b15:	89 ca                	mov    %ecx,%edx
+     b17:	89 f8                	mov    %edi,%eax
+     b19:	e8 62 ff ff ff       	call   a80 <putc>
+  for(i = 0; fmt[i]; i++){
+     b1e:	0f b6 03             	movzbl (%ebx),%eax
+     b21:	83 c3 01             	add    $0x1,%ebx
+     b24:	84 c0                	test   %al,%al
+     b26:	74 37                	je     b5f <format+0x6f>
+    c = fmt[i] & 0xff;
+     b28:	0f be c8             	movsbl %al,%ecx
+     b2b:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     b2e:	85 f6                	test   %esi,%esi
+     b30:	74 de                	je     b10 <format+0x20>
+      }
+    } else if(state == '%'){
+     b32:	83 fe 25             	cmp    $0x25,%esi
+     b35:	75 e7                	jne    b1e <format+0x2e>
+      if(c == 'd'){
+     b37:	83 f8 25             	cmp    $0x25,%eax
+     b3a:	74 46                	je     b82 <format+0x92>
+     b3c:	83 e8 63             	sub    $0x63,%eax
+     b3f:	83 f8 15             	cmp    $0x15,%eax
+     b42:	77 2c                	ja     b70 <format+0x80>
+     b44:	ff 24 85 a4 16 00 00 	jmp    *0x16a4(,%eax,4)
+     b4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b4f:	90                   	nop
+  for(i = 0; fmt[i]; i++){
+     b50:	0f b6 03             	movzbl (%ebx),%eax
+     b53:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+     b56:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+     b5b:	84 c0                	test   %al,%al
+     b5d:	75 c9                	jne    b28 <format+0x38>
+        putc(b, c);
+      }
+      state = 0;
+    }
+  }
+}
+     b5f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     b62:	5b                   	pop    %ebx
+     b63:	5e                   	pop    %esi
+     b64:	5f                   	pop    %edi
+     b65:	5d                   	pop    %ebp
+     b66:	c3                   	ret
+     b67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b6e:	66 90                	xchg   %ax,%ax
+        putc(b, '%');
+     b70:	ba 25 00 00 00       	mov    $0x25,%edx
+     b75:	89 f8                	mov    %edi,%eax
+     b77:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     b7a:	e8 01 ff ff ff       	call   a80 <putc>
+        putc(b, c);
+     b7f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     b82:	89 ca                	mov    %ecx,%edx
+     b84:	89 f8                	mov    %edi,%eax
+      state = 0;
+     b86:	31 f6                	xor    %esi,%esi
+        putc(b, c);
+     b88:	e8 f3 fe ff ff       	call   a80 <putc>
+     b8d:	eb 8f                	jmp    b1e <format+0x2e>
+     b8f:	90                   	nop
+        printint(b, *ap, 16, 0);
+     b90:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     b93:	83 ec 0c             	sub    $0xc,%esp
+     b96:	b9 10 00 00 00       	mov    $0x10,%ecx
+     b9b:	8b 16                	mov    (%esi),%edx
+     b9d:	6a 00                	push   $0x0
+        ap++;
+     b9f:	83 c6 04             	add    $0x4,%esi
+        printint(b, *ap, 16, 0);
+     ba2:	89 f8                	mov    %edi,%eax
+     ba4:	e8 d7 fd ff ff       	call   980 <printint>
+        ap++;
+     ba9:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+     bac:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     baf:	31 f6                	xor    %esi,%esi
+     bb1:	e9 68 ff ff ff       	jmp    b1e <format+0x2e>
+     bb6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bbd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     bc0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     bc3:	8b 30                	mov    (%eax),%esi
+        ap++;
+     bc5:	83 c0 04             	add    $0x4,%eax
+     bc8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+     bcb:	85 f6                	test   %esi,%esi
+     bcd:	75 1b                	jne    bea <format+0xfa>
+     bcf:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+     bd4:	be 9c 16 00 00       	mov    $0x169c,%esi
+     bd9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+          putc(b, *s);
+     be0:	89 f8                	mov    %edi,%eax
+          s++;
+     be2:	83 c6 01             	add    $0x1,%esi
+          putc(b, *s);
+     be5:	e8 96 fe ff ff       	call   a80 <putc>
+        while(*s != 0){
+     bea:	0f be 16             	movsbl (%esi),%edx
+     bed:	84 d2                	test   %dl,%dl
+     bef:	75 ef                	jne    be0 <format+0xf0>
+      state = 0;
+     bf1:	31 f6                	xor    %esi,%esi
+     bf3:	e9 26 ff ff ff       	jmp    b1e <format+0x2e>
+     bf8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bff:	90                   	nop
+        printint(b, *ap, 10, 1);
+     c00:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     c03:	83 ec 0c             	sub    $0xc,%esp
+     c06:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     c0b:	8b 16                	mov    (%esi),%edx
+     c0d:	6a 01                	push   $0x1
+     c0f:	eb 8e                	jmp    b9f <format+0xaf>
+     c11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(b, *ap);
+     c18:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     c1b:	89 f8                	mov    %edi,%eax
+     c1d:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+     c20:	83 c6 04             	add    $0x4,%esi
+        putc(b, *ap);
+     c23:	e8 58 fe ff ff       	call   a80 <putc>
+        ap++;
+     c28:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      state = 0;
+     c2b:	31 f6                	xor    %esi,%esi
+     c2d:	e9 ec fe ff ff       	jmp    b1e <format+0x2e>
+     c32:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000c40 <fflush>:
+{
+     c40:	55                   	push   %ebp
+     c41:	89 e5                	mov    %esp,%ebp
+     c43:	83 ec 08             	sub    $0x8,%esp
+  if(fd == stdout.fd)
+     c46:	8b 45 08             	mov    0x8(%ebp),%eax
+     c49:	39 05 00 20 00 00    	cmp    %eax,0x2000
+     c4f:	74 07                	je     c58 <fflush+0x18>
+}
+     c51:	c9                   	leave
+     c52:	c3                   	ret
+     c53:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c57:	90                   	nop
+  umtxlock(&stdoutlock);
+     c58:	83 ec 0c             	sub    $0xc,%esp
+     c5b:	68 24 24 00 00       	push   $0x2424
+     c60:	e8 db fa ff ff       	call   740 <umtxlock>
+  if(b->n > 0)
+     c65:	a1 08 20 00 00       	mov    0x2008,%eax
+     c6a:	83 c4 10             	add    $0x10,%esp
+     c6d:	85 c0                	test   %eax,%eax
+     c6f:	7f 1f                	jg     c90 <fflush+0x50>
+  b->n = 0;
+     c71:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     c78:	00 00 00 
+  umtxunlock(&stdoutlock);
+     c7b:	c7 45 08 24 24 00 00 	movl   $0x2424,0x8(%ebp)
+}
+     c82:	c9                   	leave
+  umtxunlock(&stdoutlock);
+     c83:	e9 08 fb ff ff       	jmp    790 <umtxunlock>
+     c88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c8f:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     c90:	83 ec 04             	sub    $0x4,%esp
+     c93:	50                   	push   %eax
+     c94:	68 0c 20 00 00       	push   $0x200c
+     c99:	ff 35 00 20 00 00    	push   0x2000
+     c9f:	e8 3c fb ff ff       	call   7e0 <_write>
+     ca4:	83 c4 10             	add    $0x10,%esp
+     ca7:	eb c8                	jmp    c71 <fflush+0x31>
+     ca9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000cb0 <setvbuf>:
+{
+     cb0:	55                   	push   %ebp
+     cb1:	89 e5                	mov    %esp,%ebp
+     cb3:	53                   	push   %ebx
+     cb4:	83 ec 04             	sub    $0x4,%esp
+     cb7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd != stdout.fd)
+     cba:	8b 45 08             	mov    0x8(%ebp),%eax
+     cbd:	39 05 00 20 00 00    	cmp    %eax,0x2000
+     cc3:	74 0b                	je     cd0 <setvbuf+0x20>
+}
+     cc5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     cc8:	c9                   	leave
+     cc9:	c3                   	ret
+     cca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  umtxlock(&stdoutlock);
+     cd0:	83 ec 0c             	sub    $0xc,%esp
+     cd3:	68 24 24 00 00       	push   $0x2424
+     cd8:	e8 63 fa ff ff       	call   740 <umtxlock>
+  if(b->n > 0)
+     cdd:	a1 08 20 00 00       	mov    0x2008,%eax
+     ce2:	83 c4 10             	add    $0x10,%esp
+     ce5:	85 c0                	test   %eax,%eax
+     ce7:	7f 2f                	jg     d18 <setvbuf+0x68>
+  b->n = 0;
+     ce9:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     cf0:	00 00 00 
+  stdout.mode = mode;
+     cf3:	89 1d 04 20 00 00    	mov    %ebx,0x2004
+  flushhook = flushall;
+     cf9:	c7 05 20 24 00 00 30 	movl   $0x930,0x2420
+     d00:	09 00 00 
+}
+     d03:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&stdoutlock);
+     d06:	c7 45 08 24 24 00 00 	movl   $0x2424,0x8(%ebp)
+}
+     d0d:	c9                   	leave
+  umtxunlock(&stdoutlock);
+     d0e:	e9 7d fa ff ff       	jmp    790 <umtxunlock>
+     d13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d17:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     d18:	83 ec 04             	sub    $0x4,%esp
+     d1b:	50                   	push   %eax
+     d1c:	68 0c 20 00 00       	push   $0x200c
+     d21:	ff 35 00 20 00 00    	push   0x2000
+     d27:	e8 b4 fa ff ff       	call   7e0 <_write>
+     d2c:	83 c4 10             	add    $0x10,%esp
+     d2f:	eb b8                	jmp    ce9 <setvbuf+0x39>
+     d31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d3f:	90                   	nop
+
+00000d40 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s, %c.
+void
+printf(int fd, const char *fmt, ...)
+{
+     d40:	55                   	push   %ebp
+     d41:	89 e5                	mov    %esp,%ebp
+     d43:	53                   	push   %ebx
+     d44:	81 ec 14 02 00 00    	sub    $0x214,%esp
+     d4a:	8b 45 08             	mov    0x8(%ebp),%eax
+    local.mode = _IONBF;
+    local.n = 0;
+    local.str = 0;
+    b = &local;
+  }
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     d4d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd == stdout.fd){
+     d50:	39 05 00 20 00 00    	cmp    %eax,0x2000
+     d56:	74 48                	je     da0 <printf+0x60>
+    local.fd = fd;
+     d58:	89 85 e8 fd ff ff    	mov    %eax,-0x218(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     d5e:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     d61:	89 da                	mov    %ebx,%edx
+     d63:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+    local.mode = _IONBF;
+     d69:	c7 85 ec fd ff ff 03 	movl   $0x3,-0x214(%ebp)
+     d70:	00 00 00 
+    local.n = 0;
+     d73:	c7 85 f0 fd ff ff 00 	movl   $0x0,-0x210(%ebp)
+     d7a:	00 00 00 
+    local.str = 0;
+     d7d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     d84:	e8 67 fd ff ff       	call   af0 <format>
+  if(b->mode == _IONBF)
+     d89:	83 bd ec fd ff ff 03 	cmpl   $0x3,-0x214(%ebp)
+     d90:	0f 84 a2 00 00 00    	je     e38 <printf+0xf8>
+    flush(b);
+  if(b == &stdout)
+    umtxunlock(&stdoutlock);
+}
+     d96:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     d99:	c9                   	leave
+     d9a:	c3                   	ret
+     d9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d9f:	90                   	nop
+    umtxlock(&stdoutlock);
+     da0:	83 ec 0c             	sub    $0xc,%esp
+     da3:	68 24 24 00 00       	push   $0x2424
+     da8:	e8 93 f9 ff ff       	call   740 <umtxlock>
+  if(stdout.mode == 0){
+     dad:	a1 04 20 00 00       	mov    0x2004,%eax
+     db2:	83 c4 10             	add    $0x10,%esp
+     db5:	85 c0                	test   %eax,%eax
+     db7:	74 37                	je     df0 <printf+0xb0>
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     db9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     dbc:	89 da                	mov    %ebx,%edx
+     dbe:	b8 00 20 00 00       	mov    $0x2000,%eax
+     dc3:	e8 28 fd ff ff       	call   af0 <format>
+  if(b->mode == _IONBF)
+     dc8:	83 3d 04 20 00 00 03 	cmpl   $0x3,0x2004
+     dcf:	0f 84 ab 00 00 00    	je     e80 <printf+0x140>
+    umtxunlock(&stdoutlock);
+     dd5:	83 ec 0c             	sub    $0xc,%esp
+     dd8:	68 24 24 00 00       	push   $0x2424
+     ddd:	e8 ae f9 ff ff       	call   790 <umtxunlock>
+}
+     de2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    umtxunlock(&stdoutlock);
+     de5:	83 c4 10             	add    $0x10,%esp
+}
+     de8:	c9                   	leave
+     de9:	c3                   	ret
+     dea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+     df0:	83 ec 08             	sub    $0x8,%esp
+     df3:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+     df9:	50                   	push   %eax
+     dfa:	ff 35 00 20 00 00    	push   0x2000
+     e00:	e8 13 fa ff ff       	call   818 <fstat>
+     e05:	83 c4 10             	add    $0x10,%esp
+     e08:	89 c2                	mov    %eax,%edx
+      stdout.mode = _IOFBF;
+     e0a:	b8 01 00 00 00       	mov    $0x1,%eax
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+     e0f:	85 d2                	test   %edx,%edx
+     e11:	75 10                	jne    e23 <printf+0xe3>
+      stdout.mode = _IOLBF;
+     e13:	31 c0                	xor    %eax,%eax
+     e15:	66 83 bd e8 fd ff ff 	cmpw   $0x3,-0x218(%ebp)
+     e1c:	03 
+     e1d:	0f 94 c0             	sete   %al
+     e20:	83 c0 01             	add    $0x1,%eax
+     e23:	a3 04 20 00 00       	mov    %eax,0x2004
+    flushhook = flushall;
+     e28:	c7 05 20 24 00 00 30 	movl   $0x930,0x2420
+     e2f:	09 00 00 
+     e32:	eb 85                	jmp    db9 <printf+0x79>
+     e34:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(b->n > 0)
+     e38:	8b 85 f0 fd ff ff    	mov    -0x210(%ebp),%eax
+     e3e:	85 c0                	test   %eax,%eax
+     e40:	0f 8e 50 ff ff ff    	jle    d96 <printf+0x56>
+    b = &local;
+     e46:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+    _write(b->fd, b->buf, b->n);
+     e4c:	83 ec 04             	sub    $0x4,%esp
+     e4f:	50                   	push   %eax
+     e50:	8d 43 0c             	lea    0xc(%ebx),%eax
+     e53:	50                   	push   %eax
+     e54:	ff 33                	push   (%ebx)
+     e56:	e8 85 f9 ff ff       	call   7e0 <_write>
+  b->n = 0;
+     e5b:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  if(b == &stdout)
+     e62:	83 c4 10             	add    $0x10,%esp
+     e65:	81 fb 00 20 00 00    	cmp    $0x2000,%ebx
+     e6b:	0f 85 25 ff ff ff    	jne    d96 <printf+0x56>
+     e71:	e9 5f ff ff ff       	jmp    dd5 <printf+0x95>
+     e76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e7d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(b->n > 0)
+     e80:	a1 08 20 00 00       	mov    0x2008,%eax
+    b = getstdout();
+     e85:	bb 00 20 00 00       	mov    $0x2000,%ebx
+  if(b->n > 0)
+     e8a:	85 c0                	test   %eax,%eax
+     e8c:	7f be                	jg     e4c <printf+0x10c>
+  b->n = 0;
+     e8e:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     e95:	00 00 00 
+  if(b == &stdout)
+     e98:	e9 38 ff ff ff       	jmp    dd5 <printf+0x95>
+     e9d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ea0 <sprintf>:
+
+// Print to the given buffer. Only understands %d, %x, %p, %s, %c.
+int
+sprintf(char *str, const char *fmt, ...)
+{
+     ea0:	55                   	push   %ebp
+     ea1:	89 e5                	mov    %esp,%ebp
+     ea3:	53                   	push   %ebx
+  struct outbuf b;
+
+  b.str = str;
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+     ea4:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+     eaa:	8d 4d 10             	lea    0x10(%ebp),%ecx
+{
+     ead:	81 ec 14 02 00 00    	sub    $0x214,%esp
+     eb3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+     eb6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  b.str = str;
+     eb9:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+     ebc:	e8 2f fc ff ff       	call   af0 <format>
+  *b.str = '\0';
+     ec1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ec4:	c6 00 00             	movb   $0x0,(%eax)
+  return b.str - str;
+     ec7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     eca:	29 d8                	sub    %ebx,%eax
+}
+     ecc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     ecf:	c9                   	leave
+     ed0:	c3                   	ret
+     ed1:	66 90                	xchg   %ax,%ax
+     ed3:	66 90                	xchg   %ax,%ax
+     ed5:	66 90                	xchg   %ax,%ax
+     ed7:	66 90                	xchg   %ax,%ax
+     ed9:	66 90                	xchg   %ax,%ax
+     edb:	66 90                	xchg   %ax,%ax
+     edd:	66 90                	xchg   %ax,%ax
+     edf:	90                   	nop
+
+00000ee0 <freeblock>:
+static Header *freep;
+static struct umutex lock;  // threads made by clone() share the heap
+
+static void
+freeblock(void *ap)
+{
+     ee0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+     ee1:	8d 48 f8             	lea    -0x8(%eax),%ecx
+{
+     ee4:	89 e5                	mov    %esp,%ebp
+     ee6:	57                   	push   %edi
+     ee7:	56                   	push   %esi
+     ee8:	53                   	push   %ebx
+     ee9:	89 c3                	mov    %eax,%ebx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     eeb:	a1 2c 24 00 00       	mov    0x242c,%eax
+     ef0:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     ef2:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     ef4:	39 ca                	cmp    %ecx,%edx
+     ef6:	73 30                	jae    f28 <freeblock+0x48>
+     ef8:	39 c1                	cmp    %eax,%ecx
+     efa:	72 04                	jb     f00 <freeblock+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     efc:	39 c2                	cmp    %eax,%edx
+     efe:	72 f0                	jb     ef0 <freeblock+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     f00:	8b 73 fc             	mov    -0x4(%ebx),%esi
+     f03:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+     f06:	39 f8                	cmp    %edi,%eax
+     f08:	74 26                	je     f30 <freeblock+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+     f0a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+     f0d:	8b 42 04             	mov    0x4(%edx),%eax
+     f10:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     f13:	39 f1                	cmp    %esi,%ecx
+     f15:	74 30                	je     f47 <freeblock+0x67>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+     f17:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+     f19:	5b                   	pop    %ebx
+  freep = p;
+     f1a:	89 15 2c 24 00 00    	mov    %edx,0x242c
+}
+     f20:	5e                   	pop    %esi
+     f21:	5f                   	pop    %edi
+     f22:	5d                   	pop    %ebp
+     f23:	c3                   	ret
+     f24:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     f28:	39 c1                	cmp    %eax,%ecx
+     f2a:	72 d0                	jb     efc <freeblock+0x1c>
+     f2c:	eb c2                	jmp    ef0 <freeblock+0x10>
+     f2e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+     f30:	03 70 04             	add    0x4(%eax),%esi
+     f33:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     f36:	8b 02                	mov    (%edx),%eax
+     f38:	8b 00                	mov    (%eax),%eax
+     f3a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+     f3d:	8b 42 04             	mov    0x4(%edx),%eax
+     f40:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     f43:	39 f1                	cmp    %esi,%ecx
+     f45:	75 d0                	jne    f17 <freeblock+0x37>
+    p->s.size += bp->s.size;
+     f47:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+     f4a:	89 15 2c 24 00 00    	mov    %edx,0x242c
+    p->s.size += bp->s.size;
+     f50:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+     f53:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+     f56:	89 0a                	mov    %ecx,(%edx)
+}
+     f58:	5b                   	pop    %ebx
+     f59:	5e                   	pop    %esi
+     f5a:	5f                   	pop    %edi
+     f5b:	5d                   	pop    %ebp
+     f5c:	c3                   	ret
+     f5d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000f60 <free>:
+
+void
+free(void *ap)
+{
+     f60:	55                   	push   %ebp
+     f61:	89 e5                	mov    %esp,%ebp
+     f63:	53                   	push   %ebx
+     f64:	83 ec 10             	sub    $0x10,%esp
+     f67:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  umtxlock(&lock);
+     f6a:	68 28 24 00 00       	push   $0x2428
+     f6f:	e8 cc f7 ff ff       	call   740 <umtxlock>
+  freeblock(ap);
+     f74:	89 d8                	mov    %ebx,%eax
+     f76:	e8 65 ff ff ff       	call   ee0 <freeblock>
+  umtxunlock(&lock);
+     f7b:	c7 45 08 28 24 00 00 	movl   $0x2428,0x8(%ebp)
+}
+     f82:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&lock);
+     f85:	83 c4 10             	add    $0x10,%esp
+}
+     f88:	c9                   	leave
+  umtxunlock(&lock);
+     f89:	e9 02 f8 ff ff       	jmp    790 <umtxunlock>
+     f8e:	66 90                	xchg   %ax,%ax
+
+00000f90 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+     f90:	55                   	push   %ebp
+     f91:	89 e5                	mov    %esp,%ebp
+     f93:	57                   	push   %edi
+     f94:	56                   	push   %esi
+     f95:	53                   	push   %ebx
+     f96:	83 ec 28             	sub    $0x28,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     f99:	8b 45 08             	mov    0x8(%ebp),%eax
+  umtxlock(&lock);
+     f9c:	68 28 24 00 00       	push   $0x2428
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     fa1:	8d 48 07             	lea    0x7(%eax),%ecx
+     fa4:	c1 e9 03             	shr    $0x3,%ecx
+     fa7:	8d 71 01             	lea    0x1(%ecx),%esi
+  umtxlock(&lock);
+     faa:	e8 91 f7 ff ff       	call   740 <umtxlock>
+  if((prevp = freep) == 0){
+     faf:	8b 15 2c 24 00 00    	mov    0x242c,%edx
+     fb5:	83 c4 10             	add    $0x10,%esp
+     fb8:	85 d2                	test   %edx,%edx
+     fba:	0f 84 b0 00 00 00    	je     1070 <malloc+0xe0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     fc0:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+     fc2:	8b 47 04             	mov    0x4(%edi),%eax
+     fc5:	39 f0                	cmp    %esi,%eax
+     fc7:	73 6f                	jae    1038 <malloc+0xa8>
+  if(nu < 4096)
+     fc9:	bb 00 10 00 00       	mov    $0x1000,%ebx
+     fce:	39 de                	cmp    %ebx,%esi
+     fd0:	0f 43 de             	cmovae %esi,%ebx
+  p = sbrk(nu * sizeof(Header));
+     fd3:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+     fda:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     fdd:	eb 0a                	jmp    fe9 <malloc+0x59>
+     fdf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     fe0:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+     fe2:	8b 47 04             	mov    0x4(%edi),%eax
+     fe5:	39 f0                	cmp    %esi,%eax
+     fe7:	73 4f                	jae    1038 <malloc+0xa8>
+      }
+      freep = prevp;
+      umtxunlock(&lock);
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+     fe9:	89 fa                	mov    %edi,%edx
+     feb:	39 3d 2c 24 00 00    	cmp    %edi,0x242c
+     ff1:	75 ed                	jne    fe0 <malloc+0x50>
+  p = sbrk(nu * sizeof(Header));
+     ff3:	83 ec 0c             	sub    $0xc,%esp
+     ff6:	ff 75 e4             	push   -0x1c(%ebp)
+     ff9:	e8 4a f8 ff ff       	call   848 <sbrk>
+  if(p == (char*)-1)
+     ffe:	83 c4 10             	add    $0x10,%esp
+    1001:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1004:	74 15                	je     101b <malloc+0x8b>
+  hp->s.size = nu;
+    1006:	89 58 04             	mov    %ebx,0x4(%eax)
+  freeblock((void*)(hp + 1));
+    1009:	83 c0 08             	add    $0x8,%eax
+    100c:	e8 cf fe ff ff       	call   ee0 <freeblock>
+  return freep;
+    1011:	8b 15 2c 24 00 00    	mov    0x242c,%edx
+      if((p = morecore(nunits)) == 0){
+    1017:	85 d2                	test   %edx,%edx
+    1019:	75 c5                	jne    fe0 <malloc+0x50>
+        umtxunlock(&lock);
+    101b:	83 ec 0c             	sub    $0xc,%esp
+    101e:	68 28 24 00 00       	push   $0x2428
+    1023:	e8 68 f7 ff ff       	call   790 <umtxunlock>
+        return 0;
+    1028:	83 c4 10             	add    $0x10,%esp
+      }
+  }
+}
+    102b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    102e:	31 c0                	xor    %eax,%eax
+}
+    1030:	5b                   	pop    %ebx
+    1031:	5e                   	pop    %esi
+    1032:	5f                   	pop    %edi
+    1033:	5d                   	pop    %ebp
+    1034:	c3                   	ret
+    1035:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1038:	39 c6                	cmp    %eax,%esi
+    103a:	74 64                	je     10a0 <malloc+0x110>
+        p->s.size -= nunits;
+    103c:	29 f0                	sub    %esi,%eax
+    103e:	89 47 04             	mov    %eax,0x4(%edi)
+        p += p->s.size;
+    1041:	8d 3c c7             	lea    (%edi,%eax,8),%edi
+        p->s.size = nunits;
+    1044:	89 77 04             	mov    %esi,0x4(%edi)
+      umtxunlock(&lock);
+    1047:	83 ec 0c             	sub    $0xc,%esp
+      freep = prevp;
+    104a:	89 15 2c 24 00 00    	mov    %edx,0x242c
+      umtxunlock(&lock);
+    1050:	68 28 24 00 00       	push   $0x2428
+    1055:	e8 36 f7 ff ff       	call   790 <umtxunlock>
+      return (void*)(p + 1);
+    105a:	83 c4 10             	add    $0x10,%esp
+}
+    105d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    1060:	8d 47 08             	lea    0x8(%edi),%eax
+}
+    1063:	5b                   	pop    %ebx
+    1064:	5e                   	pop    %esi
+    1065:	5f                   	pop    %edi
+    1066:	5d                   	pop    %ebp
+    1067:	c3                   	ret
+    1068:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    106f:	90                   	nop
+    base.s.ptr = freep = prevp = &base;
+    1070:	c7 05 2c 24 00 00 30 	movl   $0x2430,0x242c
+    1077:	24 00 00 
+    base.s.size = 0;
+    107a:	bf 30 24 00 00       	mov    $0x2430,%edi
+    base.s.ptr = freep = prevp = &base;
+    107f:	c7 05 30 24 00 00 30 	movl   $0x2430,0x2430
+    1086:	24 00 00 
+    base.s.size = 0;
+    1089:	c7 05 34 24 00 00 00 	movl   $0x0,0x2434
+    1090:	00 00 00 
+    if(p->s.size >= nunits){
+    1093:	e9 31 ff ff ff       	jmp    fc9 <malloc+0x39>
+    1098:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    109f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    10a0:	8b 07                	mov    (%edi),%eax
+    10a2:	89 02                	mov    %eax,(%edx)
+    10a4:	eb a1                	jmp    1047 <malloc+0xb7>
+    10a6:	66 90                	xchg   %ax,%ax
+    10a8:	66 90                	xchg   %ax,%ax
+    10aa:	66 90                	xchg   %ax,%ax
+    10ac:	66 90                	xchg   %ax,%ax
+    10ae:	66 90                	xchg   %ax,%ax
+
+000010b0 <threadstart>:
+
+#define TSTACKSZ 4096
+
+static void
+threadstart(void *fn, void *arg)
+{
+    10b0:	55                   	push   %ebp
+    10b1:	89 e5                	mov    %esp,%ebp
+    10b3:	83 ec 14             	sub    $0x14,%esp
+  ((void (*)(void*))fn)(arg);
+    10b6:	ff 75 0c             	push   0xc(%ebp)
+    10b9:	ff 55 08             	call   *0x8(%ebp)
+  exit();
+    10bc:	e8 ef f4 ff ff       	call   5b0 <exit>
+    10c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10cf:	90                   	nop
+
+000010d0 <thread_create>:
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    10d0:	55                   	push   %ebp
+    10d1:	89 e5                	mov    %esp,%ebp
+    10d3:	53                   	push   %ebx
+    10d4:	83 ec 20             	sub    $0x20,%esp
+  char *mem, *stack;
+  int pid;
+
+  if((mem = malloc(2*TSTACKSZ)) == 0)
+    10d7:	68 00 20 00 00       	push   $0x2000
+    10dc:	e8 af fe ff ff       	call   f90 <malloc>
+    10e1:	83 c4 10             	add    $0x10,%esp
+    10e4:	85 c0                	test   %eax,%eax
+    10e6:	74 47                	je     112f <thread_create+0x5f>
+    10e8:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)(((uint)mem + TSTACKSZ - 1) & ~(TSTACKSZ - 1));
+    10ea:	8d 80 ff 0f 00 00    	lea    0xfff(%eax),%eax
+    10f0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  *(char**)stack = mem;
+    10f5:	89 18                	mov    %ebx,(%eax)
+  if((pid = clone(threadstart, (void*)fn, arg, stack)) < 0)
+    10f7:	50                   	push   %eax
+    10f8:	ff 75 0c             	push   0xc(%ebp)
+    10fb:	ff 75 08             	push   0x8(%ebp)
+    10fe:	68 b0 10 00 00       	push   $0x10b0
+    1103:	e8 08 f8 ff ff       	call   910 <clone>
+    1108:	83 c4 10             	add    $0x10,%esp
+    110b:	85 c0                	test   %eax,%eax
+    110d:	78 09                	js     1118 <thread_create+0x48>
+    free(mem);
+  return pid;
+}
+    110f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1112:	c9                   	leave
+    1113:	c3                   	ret
+    1114:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    free(mem);
+    1118:	83 ec 0c             	sub    $0xc,%esp
+    111b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    111e:	53                   	push   %ebx
+    111f:	e8 3c fe ff ff       	call   f60 <free>
+    1124:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    1127:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+    112a:	83 c4 10             	add    $0x10,%esp
+}
+    112d:	c9                   	leave
+    112e:	c3                   	ret
+    return -1;
+    112f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1134:	eb d9                	jmp    110f <thread_create+0x3f>
+    1136:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    113d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001140 <thread_join>:
+
+int
+thread_join(void)
+{
+    1140:	55                   	push   %ebp
+    1141:	89 e5                	mov    %esp,%ebp
+    1143:	83 ec 34             	sub    $0x34,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    1146:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    1149:	50                   	push   %eax
+    114a:	e8 c9 f7 ff ff       	call   918 <join>
+    114f:	83 c4 10             	add    $0x10,%esp
+    1152:	85 c0                	test   %eax,%eax
+    1154:	79 0a                	jns    1160 <thread_join+0x20>
+    free(*(char**)stack);
+  return pid;
+}
+    1156:	c9                   	leave
+    1157:	c3                   	ret
+    1158:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    115f:	90                   	nop
+    free(*(char**)stack);
+    1160:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1163:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1166:	83 ec 0c             	sub    $0xc,%esp
+    1169:	ff 32                	push   (%edx)
+    116b:	e8 f0 fd ff ff       	call   f60 <free>
+    1170:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1173:	83 c4 10             	add    $0x10,%esp
+}
+    1176:	c9                   	leave
+    1177:	c3                   	ret
@@ -0,0 +1,99 @@
+// Measure the file page cache: read the same file several
+// times and report disk reads, page cache hits and ticks for
+// the first (cold) pass and the later (warm) passes, then time
+// running grep over the file, as a repeated grep would.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fs.h"
+#include "fcntl.h"
+#include "iostat.h"
+
+#define FILESZ  (64*1024)  // bytes in the test file
+#define NPASS   5          // read passes
+#define NGREP   4          // grep runs
+
+char buf[BSIZE];
+
+void
+readpass(int pass)
+{
+  int fd, t0, t1;
+  struct iostat st0, st1;
+
+  iostat(&st0);
+  t0 = uptime();
+  if((fd = open("pcfile", O_RDONLY)) < 0){
+    printf(1, "pcbench: open pcfile failed\n");
+    exit();
+  }
+  while(read(fd, buf, sizeof(buf)) > 0)
+    ;
+  close(fd);
+  t1 = uptime();
+  iostat(&st1);
+
+  printf(1, "pcbench: pass %d (%s): %d ticks, %d disk reads, "
+         "%d page hits, %d page misses\n", pass, pass == 0 ? "cold" : "warm",
+         t1 - t0, st1.nread - st0.nread, st1.pchit - st0.pchit,
+         st1.pcmiss - st0.pcmiss);
+}
+
+void
+grep(int run)
+{
+  int pid, t0, t1;
+  struct iostat st0, st1;
+  char *argv[] = { "grep", "zzzz", "pcfile", 0 };
+
+  iostat(&st0);
+  t0 = uptime();
+  pid = fork();
+  if(pid < 0){
+    printf(1, "pcbench: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    exec("grep", argv);
+    printf(1, "pcbench: exec grep failed\n");
+    exit();
+  }
+  wait();
+  t1 = uptime();
+  iostat(&st1);
+
+  printf(1, "pcbench: grep %d: %d ticks, %d disk reads\n",
+         run, t1 - t0, st1.nread - st0.nread);
+}
+
+int
+main(int argc, char *argv[])
+{
+  int fd, i, j;
+
+  unlink("pcfile");
+  if((fd = open("pcfile", O_CREATE|O_RDWR)) < 0){
+    printf(1, "pcbench: create pcfile failed\n");
+    exit();
+  }
+  for(i = 0; i < FILESZ/BSIZE; i++){
+    for(j = 0; j < BSIZE; j++)
+      buf[j] = (j % 64 == 63) ? '\n' : 'a' + (i + j) % 26;
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+      printf(1, "pcbench: write failed\n");
+      exit();
+    }
+  }
+  close(fd);
+
+  // The writes went through the buffer cache but did not fill
+  // the page cache, so the first pass starts cold.
+  for(i = 0; i < NPASS; i++)
+    readpass(i);
+  for(i = 0; i < NGREP; i++)
+    grep(i);
+
+  unlink("pcfile");
+  exit();
+}
@@ -0,0 +1,112 @@
+// Priority inversion latency. A high-priority process waits for
+// a kernel mutex held by a low-priority one while medium-priority
+// processes hog the CPU. Priority inheritance runs the holder at
+// the waiter's priority, so the wait should last about as long as
+// the holder's remaining work rather than until the hogs finish.
+// In the chained case the high-priority process waits for a
+// middle one, which in turn waits for the low one.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+#define NHOG     3
+#define HOGTICKS 200
+#define WORK     20000000
+
+void
+setnice(int n)
+{
+  nice(getpid(), n - nice(getpid(), 0));
+}
+
+void
+work(void)
+{
+  volatile int i;
+
+  for(i = 0; i < WORK; i++)
+    ;
+}
+
+int
+run(int chain)
+{
+  int m1, m2, p[2], i, t0, end, nproc;
+  char c;
+
+  m1 = mtxget();
+  m2 = mtxget();
+  if(m1 < 0 || m2 < 0 || pipe(p) < 0){
+    printf(1, "pibench: mtxget/pipe failed\n");
+    exit();
+  }
+  setnice(0);
+
+  // The low-priority holder.
+  if(fork() == 0){
+    setnice(25);
+    mtxacq(chain ? m2 : m1);
+    write(p[1], "l", 1);
+    work();
+    mtxrel(chain ? m2 : m1);
+    exit();
+  }
+  read(p[0], &c, 1);
+  nproc = 1;
+
+  // The middle holder, waiting for the low one.
+  if(chain){
+    if(fork() == 0){
+      setnice(20);
+      mtxacq(m1);
+      write(p[1], "m", 1);
+      mtxacq(m2);
+      mtxrel(m2);
+      mtxrel(m1);
+      exit();
+    }
+    read(p[0], &c, 1);
+    nproc++;
+  }
+
+  for(i = 0; i < NHOG; i++){
+    if(fork() == 0){
+      setnice(10);
+      end = uptime() + HOGTICKS;
+      while(uptime() < end)
+        ;
+      exit();
+    }
+    nproc++;
+  }
+
+  t0 = uptime();
+  mtxacq(m1);
+  t0 = uptime() - t0;
+  mtxrel(m1);
+  for(i = 0; i < nproc; i++)
+    wait();
+  close(p[0]);
+  close(p[1]);
+  mtxdel(m1);
+  mtxdel(m2);
+  return t0;
+}
+
+int
+main(int argc, char *argv[])
+{
+  int t0, tw, td, tc;
+
+  setnice(0);
+  t0 = uptime();
+  work();
+  tw = uptime() - t0;
+  td = run(0);
+  tc = run(1);
+  printf(1, "pibench: holder's work alone: %d ticks; hogs run %d ticks\n", tw, HOGTICKS);
+  printf(1, "pibench: direct inversion: waited %d ticks\n", td);
+  printf(1, "pibench: chained inversion: waited %d ticks\n", tc);
+  exit();
+}
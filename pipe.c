@@ -7,16 +7,27 @@
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "file.h"
+#include "uio.h"
 
-#define PIPESIZE 512
+#if PIPESIZE > PGSIZE
+#error "PIPESIZE must fit in a page"
+#endif
+
+// A sleeping writer is woken once a reader has made at least
+// PIPEWAKE bytes of room, and a sleeping reader once a writer
+// has queued PIPEWAKE bytes or finished its write, rather than
+// after every byte.
+#define PIPEWAKE (PIPESIZE / 4)
 
 struct pipe {
   struct spinlock lock;
-  char data[PIPESIZE];
+  char *data;     // ring of PIPESIZE bytes
   uint nread;     // number of bytes read
   uint nwrite;    // number of bytes written
   int readopen;   // read fd is still open
   int writeopen;  // write fd is still open
+  int readwait;   // a reader is sleeping on nread
+  int writewait;  // a writer is sleeping on nwrite
 };
 
 int
@@ -30,10 +41,14 @@ pipealloc(struct file **f0, struct file **f1)
     goto bad;
   if((p = (struct pipe*)kalloc()) == 0)
     goto bad;
+  if((p->data = kalloc()) == 0)
+    goto bad;
   p->readopen = 1;
   p->writeopen = 1;
   p->nwrite = 0;
   p->nread = 0;
+  p->readwait = 0;
+  p->writewait = 0;
   initlock(&p->lock, "pipe");
   (*f0)->type = FD_PIPE;
   (*f0)->readable = 1;
@@ -47,8 +62,11 @@ pipealloc(struct file **f0, struct file **f1)
 
 //PAGEBREAK: 20
  bad:
-  if(p)
+  if(p){
+    if(p->data)
+      kfree(p->data);
     kfree((char*)p);
+  }
   if(*f0)
     fileclose(*f0);
   if(*f1)
@@ -69,38 +87,89 @@ pipeclose(struct pipe *p, int writable)
   }
   if(p->readopen == 0 && p->writeopen == 0){
     release(&p->lock);
+    kfree(p->data);
     kfree((char*)p);
   } else
     release(&p->lock);
 }
 
 //PAGEBREAK: 40
+// Copy the buffers of iov into p in order, under one hold of
+// p->lock. Copy in as much as fits before the end of the ring
+// each time around, so that a write wraps around at most once
+// per ring's worth of data. The buffers may be user memory,
+// which checkptr() has brought in; if some of it is gone or
+// unreadable anyway, stop there and return what was written.
 int
-pipewrite(struct pipe *p, char *addr, int n)
+pipewritev(struct pipe *p, struct iovec *iov, int cnt)
 {
-  int i;
+  int k, n;
+  uint i, off, m, left;
+  char *addr;
 
   acquire(&p->lock);
-  for(i = 0; i < n; i++){
-    while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
-      if(p->readopen == 0 || myproc()->killed){
-        release(&p->lock);
-        return -1;
+  n = 0;
+  left = 0;
+  for(k = 0; k < cnt; k++){
+    addr = iov[k].iov_base;
+    for(i = 0; i < iov[k].iov_len; i += m){
+      while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
+        if(p->readopen == 0 || myproc()->killed){
+          release(&p->lock);
+          return -1;
+        }
+        p->writewait = 1;
+        sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
+      }
+      off = p->nwrite % PIPESIZE;
+      m = PIPESIZE - (p->nwrite - p->nread);
+      if(m > PIPESIZE - off)
+        m = PIPESIZE - off;
+      if(m > iov[k].iov_len - i)
+        m = iov[k].iov_len - i;
+      left = umove(p->data + off, addr + i, m);
+      p->nwrite += m - left;
+      if(left){
+        n += i + m - left;
+        goto out;
+      }
+      if(p->readwait && p->nwrite - p->nread >= PIPEWAKE){
+        p->readwait = 0;
+        wakeup(&p->nread);
       }
-      wakeup(&p->nread);
-      sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
     }
-    p->data[p->nwrite++ % PIPESIZE] = addr[i];
+    n += iov[k].iov_len;
+  }
+out:
+  if(p->readwait){
+    p->readwait = 0;
+    wakeup(&p->nread);  //DOC: pipewrite-wakeup1
   }
-  wakeup(&p->nread);  //DOC: pipewrite-wakeup1
   release(&p->lock);
-  return n;
+  return left && n == 0 ? -1 : n;
 }
 
 int
-piperead(struct pipe *p, char *addr, int n)
+pipewrite(struct pipe *p, char *addr, int n)
 {
-  int i;
+  struct iovec iov;
+
+  iov.iov_base = addr;
+  iov.iov_len = n;
+  return pipewritev(p, &iov, 1);
+}
+
+// Copy what p holds into the buffers of iov in order,
+// waiting for some to arrive if it is empty. Consume
+// the bytes unless peeking. A buffer that cannot be
+// written, such as program text, ends the copy: return
+// what was copied before it, or -1 if nothing was.
+static int
+pipecopyout(struct pipe *p, struct iovec *iov, int cnt, int peek)
+{
+  int k, n;
+  uint i, off, m, nread, left;
+  char *addr;
 
   acquire(&p->lock);
   while(p->nread == p->nwrite && p->writeopen){  //DOC: pipe-empty
@@ -108,14 +177,65 @@ piperead(struct pipe *p, char *addr, int n)
       release(&p->lock);
       return -1;
     }
+    p->readwait = 1;
     sleep(&p->nread, &p->lock); //DOC: piperead-sleep
   }
-  for(i = 0; i < n; i++){  //DOC: piperead-copy
-    if(p->nread == p->nwrite)
-      break;
-    addr[i] = p->data[p->nread++ % PIPESIZE];
+  nread = p->nread;
+  n = 0;
+  left = 0;
+  for(k = 0; k < cnt && nread != p->nwrite && left == 0; k++){
+    addr = iov[k].iov_base;
+    for(i = 0; i < iov[k].iov_len && nread != p->nwrite; i += m){  //DOC: piperead-copy
+      off = nread % PIPESIZE;
+      m = p->nwrite - nread;
+      if(m > PIPESIZE - off)
+        m = PIPESIZE - off;
+      if(m > iov[k].iov_len - i)
+        m = iov[k].iov_len - i;
+      left = umove(addr + i, p->data + off, m);
+      nread += m - left;
+      if(left){
+        i += m - left;
+        break;
+      }
+    }
+    n += i;
+  }
+  if(!peek)
+    p->nread = nread;
+  if(p->writewait && PIPESIZE - (p->nwrite - p->nread) >= PIPEWAKE){
+    p->writewait = 0;
+    wakeup(&p->nwrite);  //DOC: piperead-wakeup
   }
-  wakeup(&p->nwrite);  //DOC: piperead-wakeup
   release(&p->lock);
-  return i;
+  return left && n == 0 ? -1 : n;
+}
+
+static int
+pipecopyout1(struct pipe *p, char *addr, int n, int peek)
+{
+  struct iovec iov;
+
+  iov.iov_base = addr;
+  iov.iov_len = n;
+  return pipecopyout(p, &iov, 1, peek);
+}
+
+int
+piperead(struct pipe *p, char *addr, int n)
+{
+  return pipecopyout1(p, addr, n, 0);
+}
+
+int
+pipereadv(struct pipe *p, struct iovec *iov, int cnt)
+{
+  return pipecopyout(p, iov, cnt, 0);
+}
+
+// Like piperead(), but leave the bytes in the pipe.
+int
+pipepeek(struct pipe *p, char *addr, int n)
+{
+  return pipecopyout1(p, addr, n, 1);
 }
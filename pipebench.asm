@@ -0,0 +1,2322 @@
+
+_pipebench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <run>:
+
+char buf[16384];
+
+void
+run(int chunk)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	57                   	push   %edi
+       4:	56                   	push   %esi
+  int p[2], n, got, t0, t, s0;
+
+  if(pipe(p) < 0){
+       5:	8d 45 e0             	lea    -0x20(%ebp),%eax
+{
+       8:	53                   	push   %ebx
+       9:	83 ec 38             	sub    $0x38,%esp
+       c:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(pipe(p) < 0){
+       f:	50                   	push   %eax
+      10:	e8 7b 06 00 00       	call   690 <pipe>
+      15:	83 c4 10             	add    $0x10,%esp
+      18:	85 c0                	test   %eax,%eax
+      1a:	0f 88 13 01 00 00    	js     133 <run+0x133>
+    printf(1, "pipebench: pipe failed\n");
+    exit();
+  }
+  t0 = uptime();
+      20:	e8 f3 06 00 00       	call   718 <uptime>
+      25:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  if(fork() == 0){
+      28:	e8 13 04 00 00       	call   440 <fork>
+      2d:	89 c3                	mov    %eax,%ebx
+      2f:	85 c0                	test   %eax,%eax
+      31:	75 55                	jne    88 <run+0x88>
+    close(p[0]);
+      33:	83 ec 0c             	sub    $0xc,%esp
+      36:	ff 75 e0             	push   -0x20(%ebp)
+      39:	e8 82 05 00 00       	call   5c0 <close>
+      3e:	83 c4 10             	add    $0x10,%esp
+      41:	eb 13                	jmp    56 <run+0x56>
+      43:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      47:	90                   	nop
+    for(n = 0; n < TOTAL; n += chunk){
+      48:	01 f3                	add    %esi,%ebx
+      4a:	81 fb ff ff 7f 00    	cmp    $0x7fffff,%ebx
+      50:	0f 8f d8 00 00 00    	jg     12e <run+0x12e>
+      if(write(p[1], buf, chunk) != chunk){
+      56:	83 ec 04             	sub    $0x4,%esp
+      59:	56                   	push   %esi
+      5a:	68 20 22 00 00       	push   $0x2220
+      5f:	ff 75 e4             	push   -0x1c(%ebp)
+      62:	e8 d9 04 00 00       	call   540 <write>
+      67:	83 c4 10             	add    $0x10,%esp
+      6a:	39 f0                	cmp    %esi,%eax
+      6c:	74 da                	je     48 <run+0x48>
+        printf(1, "pipebench: write failed\n");
+      6e:	83 ec 08             	sub    $0x8,%esp
+      71:	68 50 10 00 00       	push   $0x1050
+      76:	6a 01                	push   $0x1
+      78:	e8 83 0b 00 00       	call   c00 <printf>
+        exit();
+      7d:	e8 ee 03 00 00       	call   470 <exit>
+      82:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      }
+    }
+    exit();
+  }
+  close(p[1]);
+      88:	83 ec 0c             	sub    $0xc,%esp
+      8b:	ff 75 e4             	push   -0x1c(%ebp)
+  s0 = syscount();
+  for(got = 0; (n = read(p[0], buf, chunk)) > 0; got += n)
+      8e:	31 db                	xor    %ebx,%ebx
+  close(p[1]);
+      90:	e8 2b 05 00 00       	call   5c0 <close>
+  s0 = syscount();
+      95:	e8 ee 06 00 00       	call   788 <syscount>
+  for(got = 0; (n = read(p[0], buf, chunk)) > 0; got += n)
+      9a:	83 c4 10             	add    $0x10,%esp
+  s0 = syscount();
+      9d:	89 c7                	mov    %eax,%edi
+  for(got = 0; (n = read(p[0], buf, chunk)) > 0; got += n)
+      9f:	eb 09                	jmp    aa <run+0xaa>
+      a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      a8:	01 c3                	add    %eax,%ebx
+      aa:	83 ec 04             	sub    $0x4,%esp
+      ad:	56                   	push   %esi
+      ae:	68 20 22 00 00       	push   $0x2220
+      b3:	ff 75 e0             	push   -0x20(%ebp)
+      b6:	e8 05 04 00 00       	call   4c0 <read>
+      bb:	83 c4 10             	add    $0x10,%esp
+      be:	85 c0                	test   %eax,%eax
+      c0:	7f e6                	jg     a8 <run+0xa8>
+    ;
+  s0 = syscount() - s0 - 1;
+      c2:	e8 c1 06 00 00       	call   788 <syscount>
+  close(p[0]);
+      c7:	83 ec 0c             	sub    $0xc,%esp
+      ca:	ff 75 e0             	push   -0x20(%ebp)
+  s0 = syscount() - s0 - 1;
+      cd:	29 f8                	sub    %edi,%eax
+      cf:	8d 78 ff             	lea    -0x1(%eax),%edi
+  close(p[0]);
+      d2:	e8 e9 04 00 00       	call   5c0 <close>
+  wait();
+      d7:	e8 ac 05 00 00       	call   688 <wait>
+  t = uptime() - t0;
+      dc:	e8 37 06 00 00       	call   718 <uptime>
+      e1:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+  if(got != TOTAL)
+      e4:	83 c4 10             	add    $0x10,%esp
+  t = uptime() - t0;
+      e7:	29 d0                	sub    %edx,%eax
+  if(got != TOTAL)
+      e9:	81 fb 00 00 80 00    	cmp    $0x800000,%ebx
+      ef:	74 1b                	je     10c <run+0x10c>
+      f1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    printf(1, "pipebench: read %d bytes, expected %d\n", got, TOTAL);
+      f4:	68 00 00 80 00       	push   $0x800000
+      f9:	53                   	push   %ebx
+      fa:	68 6c 10 00 00       	push   $0x106c
+      ff:	6a 01                	push   $0x1
+     101:	e8 fa 0a 00 00       	call   c00 <printf>
+     106:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     109:	83 c4 10             	add    $0x10,%esp
+  printf(1, "pipebench: %d byte chunks: %d KB in %d ticks, %d reads\n",
+     10c:	83 ec 08             	sub    $0x8,%esp
+     10f:	57                   	push   %edi
+     110:	50                   	push   %eax
+     111:	68 00 20 00 00       	push   $0x2000
+     116:	56                   	push   %esi
+     117:	68 94 10 00 00       	push   $0x1094
+     11c:	6a 01                	push   $0x1
+     11e:	e8 dd 0a 00 00       	call   c00 <printf>
+         chunk, TOTAL/1024, t, s0);
+}
+     123:	83 c4 20             	add    $0x20,%esp
+     126:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     129:	5b                   	pop    %ebx
+     12a:	5e                   	pop    %esi
+     12b:	5f                   	pop    %edi
+     12c:	5d                   	pop    %ebp
+     12d:	c3                   	ret
+    exit();
+     12e:	e8 3d 03 00 00       	call   470 <exit>
+    printf(1, "pipebench: pipe failed\n");
+     133:	50                   	push   %eax
+     134:	50                   	push   %eax
+     135:	68 38 10 00 00       	push   $0x1038
+     13a:	6a 01                	push   $0x1
+     13c:	e8 bf 0a 00 00       	call   c00 <printf>
+    exit();
+     141:	e8 2a 03 00 00       	call   470 <exit>
+     146:	66 90                	xchg   %ax,%ax
+     148:	66 90                	xchg   %ax,%ax
+     14a:	66 90                	xchg   %ax,%ax
+     14c:	66 90                	xchg   %ax,%ax
+     14e:	66 90                	xchg   %ax,%ax
+
+00000150 <main>:
+
+int
+main(int argc, char *argv[])
+{
+     150:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     154:	83 e4 f0             	and    $0xfffffff0,%esp
+     157:	ff 71 fc             	push   -0x4(%ecx)
+     15a:	55                   	push   %ebp
+     15b:	89 e5                	mov    %esp,%ebp
+     15d:	51                   	push   %ecx
+     15e:	83 ec 10             	sub    $0x10,%esp
+  run(64);
+     161:	6a 40                	push   $0x40
+     163:	e8 98 fe ff ff       	call   0 <run>
+  run(512);
+     168:	c7 04 24 00 02 00 00 	movl   $0x200,(%esp)
+     16f:	e8 8c fe ff ff       	call   0 <run>
+  run(4096);
+     174:	c7 04 24 00 10 00 00 	movl   $0x1000,(%esp)
+     17b:	e8 80 fe ff ff       	call   0 <run>
+  run(16384);
+     180:	c7 04 24 00 40 00 00 	movl   $0x4000,(%esp)
+     187:	e8 74 fe ff ff       	call   0 <run>
+  exit();
+     18c:	e8 df 02 00 00       	call   470 <exit>
+     191:	66 90                	xchg   %ax,%ax
+     193:	66 90                	xchg   %ax,%ax
+     195:	66 90                	xchg   %ax,%ax
+     197:	66 90                	xchg   %ax,%ax
+     199:	66 90                	xchg   %ax,%ax
+     19b:	66 90                	xchg   %ax,%ax
+     19d:	66 90                	xchg   %ax,%ax
+     19f:	90                   	nop
+
+000001a0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     1a0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     1a1:	31 c0                	xor    %eax,%eax
+{
+     1a3:	89 e5                	mov    %esp,%ebp
+     1a5:	53                   	push   %ebx
+     1a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     1a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     1ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     1b0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     1b4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     1b7:	83 c0 01             	add    $0x1,%eax
+     1ba:	84 d2                	test   %dl,%dl
+     1bc:	75 f2                	jne    1b0 <strcpy+0x10>
+    ;
+  return os;
+}
+     1be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     1c1:	89 c8                	mov    %ecx,%eax
+     1c3:	c9                   	leave
+     1c4:	c3                   	ret
+     1c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000001d0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     1d0:	55                   	push   %ebp
+     1d1:	89 e5                	mov    %esp,%ebp
+     1d3:	53                   	push   %ebx
+     1d4:	8b 55 08             	mov    0x8(%ebp),%edx
+     1d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     1da:	0f b6 02             	movzbl (%edx),%eax
+     1dd:	84 c0                	test   %al,%al
+     1df:	75 17                	jne    1f8 <strcmp+0x28>
+     1e1:	eb 3a                	jmp    21d <strcmp+0x4d>
+     1e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     1e7:	90                   	nop
+     1e8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     1ec:	83 c2 01             	add    $0x1,%edx
+     1ef:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     1f2:	84 c0                	test   %al,%al
+     1f4:	74 1a                	je     210 <strcmp+0x40>
+    p++, q++;
+     1f6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     1f8:	0f b6 19             	movzbl (%ecx),%ebx
+     1fb:	38 c3                	cmp    %al,%bl
+     1fd:	74 e9                	je     1e8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     1ff:	29 d8                	sub    %ebx,%eax
+}
+     201:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     204:	c9                   	leave
+     205:	c3                   	ret
+     206:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     20d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     210:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     214:	31 c0                	xor    %eax,%eax
+     216:	29 d8                	sub    %ebx,%eax
+}
+     218:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     21b:	c9                   	leave
+     21c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     21d:	0f b6 19             	movzbl (%ecx),%ebx
+     220:	31 c0                	xor    %eax,%eax
+     222:	eb db                	jmp    1ff <strcmp+0x2f>
+     224:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     22b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     22f:	90                   	nop
+
+00000230 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     230:	55                   	push   %ebp
+     231:	89 e5                	mov    %esp,%ebp
+     233:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     236:	80 3a 00             	cmpb   $0x0,(%edx)
+     239:	74 15                	je     250 <strlen+0x20>
+     23b:	31 c0                	xor    %eax,%eax
+     23d:	8d 76 00             	lea    0x0(%esi),%esi
+     240:	83 c0 01             	add    $0x1,%eax
+     243:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     247:	89 c1                	mov    %eax,%ecx
+     249:	75 f5                	jne    240 <strlen+0x10>
+    ;
+  return n;
+}
+     24b:	89 c8                	mov    %ecx,%eax
+     24d:	5d                   	pop    %ebp
+     24e:	c3                   	ret
+     24f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     250:	31 c9                	xor    %ecx,%ecx
+}
+     252:	5d                   	pop    %ebp
+     253:	89 c8                	mov    %ecx,%eax
+     255:	c3                   	ret
+     256:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     25d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000260 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     260:	55                   	push   %ebp
+     261:	89 e5                	mov    %esp,%ebp
+     263:	57                   	push   %edi
+     264:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     267:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     26a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     26d:	89 d7                	mov    %edx,%edi
+     26f:	fc                   	cld
+     270:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     272:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     275:	89 d0                	mov    %edx,%eax
+     277:	c9                   	leave
+     278:	c3                   	ret
+     279:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000280 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     280:	55                   	push   %ebp
+     281:	89 e5                	mov    %esp,%ebp
+     283:	56                   	push   %esi
+     284:	53                   	push   %ebx
+     285:	8b 75 10             	mov    0x10(%ebp),%esi
+     288:	8b 55 08             	mov    0x8(%ebp),%edx
+     28b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+     28e:	85 f6                	test   %esi,%esi
+     290:	74 2e                	je     2c0 <memcmp+0x40>
+     292:	01 c6                	add    %eax,%esi
+     294:	eb 14                	jmp    2aa <memcmp+0x2a>
+     296:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     29d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+     2a0:	83 c0 01             	add    $0x1,%eax
+     2a3:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+     2a6:	39 f0                	cmp    %esi,%eax
+     2a8:	74 16                	je     2c0 <memcmp+0x40>
+    if(*s1 != *s2)
+     2aa:	0f b6 0a             	movzbl (%edx),%ecx
+     2ad:	0f b6 18             	movzbl (%eax),%ebx
+     2b0:	38 d9                	cmp    %bl,%cl
+     2b2:	74 ec                	je     2a0 <memcmp+0x20>
+      return *s1 - *s2;
+     2b4:	0f b6 c1             	movzbl %cl,%eax
+     2b7:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+     2b9:	5b                   	pop    %ebx
+     2ba:	5e                   	pop    %esi
+     2bb:	5d                   	pop    %ebp
+     2bc:	c3                   	ret
+     2bd:	8d 76 00             	lea    0x0(%esi),%esi
+     2c0:	5b                   	pop    %ebx
+  return 0;
+     2c1:	31 c0                	xor    %eax,%eax
+}
+     2c3:	5e                   	pop    %esi
+     2c4:	5d                   	pop    %ebp
+     2c5:	c3                   	ret
+     2c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002d0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     2d0:	55                   	push   %ebp
+     2d1:	89 e5                	mov    %esp,%ebp
+     2d3:	8b 45 08             	mov    0x8(%ebp),%eax
+     2d6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     2da:	0f b6 10             	movzbl (%eax),%edx
+     2dd:	84 d2                	test   %dl,%dl
+     2df:	75 12                	jne    2f3 <strchr+0x23>
+     2e1:	eb 1d                	jmp    300 <strchr+0x30>
+     2e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2e7:	90                   	nop
+     2e8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     2ec:	83 c0 01             	add    $0x1,%eax
+     2ef:	84 d2                	test   %dl,%dl
+     2f1:	74 0d                	je     300 <strchr+0x30>
+    if(*s == c)
+     2f3:	38 d1                	cmp    %dl,%cl
+     2f5:	75 f1                	jne    2e8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     2f7:	5d                   	pop    %ebp
+     2f8:	c3                   	ret
+     2f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     300:	31 c0                	xor    %eax,%eax
+}
+     302:	5d                   	pop    %ebp
+     303:	c3                   	ret
+     304:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     30b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     30f:	90                   	nop
+
+00000310 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     310:	55                   	push   %ebp
+     311:	89 e5                	mov    %esp,%ebp
+     313:	57                   	push   %edi
+     314:	56                   	push   %esi
+int
+read(int fd, void *buf, int n)
+{
+  if(flushhook)
+    flushhook();
+  return _read(fd, buf, n);
+     315:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     318:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     319:	31 db                	xor    %ebx,%ebx
+{
+     31b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     31e:	eb 32                	jmp    352 <gets+0x42>
+  if(flushhook)
+     320:	a1 20 62 00 00       	mov    0x6220,%eax
+     325:	85 c0                	test   %eax,%eax
+     327:	74 02                	je     32b <gets+0x1b>
+    flushhook();
+     329:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+     32b:	83 ec 04             	sub    $0x4,%esp
+     32e:	6a 01                	push   $0x1
+     330:	56                   	push   %esi
+     331:	6a 00                	push   $0x0
+     333:	e8 60 03 00 00       	call   698 <_read>
+    if(cc < 1)
+     338:	83 c4 10             	add    $0x10,%esp
+     33b:	85 c0                	test   %eax,%eax
+     33d:	7e 1d                	jle    35c <gets+0x4c>
+    buf[i++] = c;
+     33f:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     343:	8b 55 08             	mov    0x8(%ebp),%edx
+     346:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     34a:	3c 0a                	cmp    $0xa,%al
+     34c:	74 10                	je     35e <gets+0x4e>
+     34e:	3c 0d                	cmp    $0xd,%al
+     350:	74 0c                	je     35e <gets+0x4e>
+  for(i=0; i+1 < max; ){
+     352:	89 df                	mov    %ebx,%edi
+     354:	83 c3 01             	add    $0x1,%ebx
+     357:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     35a:	7c c4                	jl     320 <gets+0x10>
+     35c:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+     35e:	8b 45 08             	mov    0x8(%ebp),%eax
+     361:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+     365:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     368:	5b                   	pop    %ebx
+     369:	5e                   	pop    %esi
+     36a:	5f                   	pop    %edi
+     36b:	5d                   	pop    %ebp
+     36c:	c3                   	ret
+     36d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000370 <stat>:
+{
+     370:	55                   	push   %ebp
+     371:	89 e5                	mov    %esp,%ebp
+     373:	56                   	push   %esi
+     374:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+     375:	83 ec 08             	sub    $0x8,%esp
+     378:	6a 00                	push   $0x0
+     37a:	ff 75 08             	push   0x8(%ebp)
+     37d:	e8 3e 03 00 00       	call   6c0 <open>
+  if(fd < 0)
+     382:	83 c4 10             	add    $0x10,%esp
+     385:	85 c0                	test   %eax,%eax
+     387:	78 37                	js     3c0 <stat+0x50>
+  r = fstat(fd, st);
+     389:	83 ec 08             	sub    $0x8,%esp
+     38c:	ff 75 0c             	push   0xc(%ebp)
+     38f:	89 c3                	mov    %eax,%ebx
+     391:	50                   	push   %eax
+     392:	e8 41 03 00 00       	call   6d8 <fstat>
+}
+
+int
+close(int fd)
+{
+  if(flushhook)
+     397:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+     39a:	89 c6                	mov    %eax,%esi
+  if(flushhook)
+     39c:	a1 20 62 00 00       	mov    0x6220,%eax
+     3a1:	85 c0                	test   %eax,%eax
+     3a3:	74 02                	je     3a7 <stat+0x37>
+    flushhook();
+     3a5:	ff d0                	call   *%eax
+  return _close(fd);
+     3a7:	83 ec 0c             	sub    $0xc,%esp
+     3aa:	53                   	push   %ebx
+     3ab:	e8 f8 02 00 00       	call   6a8 <_close>
+     3b0:	83 c4 10             	add    $0x10,%esp
+}
+     3b3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     3b6:	89 f0                	mov    %esi,%eax
+     3b8:	5b                   	pop    %ebx
+     3b9:	5e                   	pop    %esi
+     3ba:	5d                   	pop    %ebp
+     3bb:	c3                   	ret
+     3bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+     3c0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     3c5:	eb ec                	jmp    3b3 <stat+0x43>
+     3c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3ce:	66 90                	xchg   %ax,%ax
+
+000003d0 <atoi>:
+{
+     3d0:	55                   	push   %ebp
+     3d1:	89 e5                	mov    %esp,%ebp
+     3d3:	53                   	push   %ebx
+     3d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+     3d7:	0f be 02             	movsbl (%edx),%eax
+     3da:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     3dd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     3e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     3e5:	77 1e                	ja     405 <atoi+0x35>
+     3e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3ee:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     3f0:	83 c2 01             	add    $0x1,%edx
+     3f3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     3f6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     3fa:	0f be 02             	movsbl (%edx),%eax
+     3fd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     400:	80 fb 09             	cmp    $0x9,%bl
+     403:	76 eb                	jbe    3f0 <atoi+0x20>
+}
+     405:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     408:	89 c8                	mov    %ecx,%eax
+     40a:	c9                   	leave
+     40b:	c3                   	ret
+     40c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000410 <memmove>:
+{
+     410:	55                   	push   %ebp
+     411:	89 e5                	mov    %esp,%ebp
+     413:	57                   	push   %edi
+     414:	56                   	push   %esi
+     415:	8b 45 10             	mov    0x10(%ebp),%eax
+     418:	8b 55 08             	mov    0x8(%ebp),%edx
+     41b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+     41e:	85 c0                	test   %eax,%eax
+     420:	7e 13                	jle    435 <memmove+0x25>
+     422:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     424:	89 d7                	mov    %edx,%edi
+     426:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     42d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     430:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     431:	39 f8                	cmp    %edi,%eax
+     433:	75 fb                	jne    430 <memmove+0x20>
+}
+     435:	5e                   	pop    %esi
+     436:	89 d0                	mov    %edx,%eax
+     438:	5f                   	pop    %edi
+     439:	5d                   	pop    %ebp
+     43a:	c3                   	ret
+     43b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     43f:	90                   	nop
+
+00000440 <fork>:
+  if(flushhook)
+     440:	a1 20 62 00 00       	mov    0x6220,%eax
+     445:	85 c0                	test   %eax,%eax
+     447:	74 17                	je     460 <fork+0x20>
+{
+     449:	55                   	push   %ebp
+     44a:	89 e5                	mov    %esp,%ebp
+     44c:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+     44f:	ff d0                	call   *%eax
+}
+     451:	c9                   	leave
+  return _fork();
+     452:	e9 21 02 00 00       	jmp    678 <_fork>
+     457:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     45e:	66 90                	xchg   %ax,%ax
+     460:	e9 13 02 00 00       	jmp    678 <_fork>
+     465:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     46c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000470 <exit>:
+{
+     470:	55                   	push   %ebp
+     471:	89 e5                	mov    %esp,%ebp
+     473:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+     476:	a1 20 62 00 00       	mov    0x6220,%eax
+     47b:	85 c0                	test   %eax,%eax
+     47d:	74 02                	je     481 <exit+0x11>
+    flushhook();
+     47f:	ff d0                	call   *%eax
+  _exit();
+     481:	e8 fa 01 00 00       	call   680 <_exit>
+     486:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     48d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000490 <exec>:
+{
+     490:	55                   	push   %ebp
+  if(flushhook)
+     491:	a1 20 62 00 00       	mov    0x6220,%eax
+{
+     496:	89 e5                	mov    %esp,%ebp
+     498:	56                   	push   %esi
+     499:	53                   	push   %ebx
+     49a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     49d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+     4a0:	85 c0                	test   %eax,%eax
+     4a2:	74 02                	je     4a6 <exec+0x16>
+    flushhook();
+     4a4:	ff d0                	call   *%eax
+  return _exec(path, argv);
+     4a6:	89 75 0c             	mov    %esi,0xc(%ebp)
+     4a9:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     4ac:	5b                   	pop    %ebx
+     4ad:	5e                   	pop    %esi
+     4ae:	5d                   	pop    %ebp
+  return _exec(path, argv);
+     4af:	e9 04 02 00 00       	jmp    6b8 <_exec>
+     4b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     4bf:	90                   	nop
+
+000004c0 <read>:
+{
+     4c0:	55                   	push   %ebp
+     4c1:	89 e5                	mov    %esp,%ebp
+     4c3:	57                   	push   %edi
+     4c4:	56                   	push   %esi
+     4c5:	53                   	push   %ebx
+     4c6:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     4c9:	a1 20 62 00 00       	mov    0x6220,%eax
+{
+     4ce:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     4d1:	8b 75 0c             	mov    0xc(%ebp),%esi
+     4d4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     4d7:	85 c0                	test   %eax,%eax
+     4d9:	74 02                	je     4dd <read+0x1d>
+    flushhook();
+     4db:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+     4dd:	89 7d 10             	mov    %edi,0x10(%ebp)
+     4e0:	89 75 0c             	mov    %esi,0xc(%ebp)
+     4e3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     4e6:	83 c4 0c             	add    $0xc,%esp
+     4e9:	5b                   	pop    %ebx
+     4ea:	5e                   	pop    %esi
+     4eb:	5f                   	pop    %edi
+     4ec:	5d                   	pop    %ebp
+  return _read(fd, buf, n);
+     4ed:	e9 a6 01 00 00       	jmp    698 <_read>
+     4f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000500 <readv>:
+{
+     500:	55                   	push   %ebp
+     501:	89 e5                	mov    %esp,%ebp
+     503:	57                   	push   %edi
+     504:	56                   	push   %esi
+     505:	53                   	push   %ebx
+     506:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     509:	a1 20 62 00 00       	mov    0x6220,%eax
+{
+     50e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     511:	8b 75 0c             	mov    0xc(%ebp),%esi
+     514:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     517:	85 c0                	test   %eax,%eax
+     519:	74 02                	je     51d <readv+0x1d>
+    flushhook();
+     51b:	ff d0                	call   *%eax
+  return _readv(fd, iov, cnt);
+     51d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     520:	89 75 0c             	mov    %esi,0xc(%ebp)
+     523:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     526:	83 c4 0c             	add    $0xc,%esp
+     529:	5b                   	pop    %ebx
+     52a:	5e                   	pop    %esi
+     52b:	5f                   	pop    %edi
+     52c:	5d                   	pop    %ebp
+  return _readv(fd, iov, cnt);
+     52d:	e9 76 02 00 00       	jmp    7a8 <_readv>
+     532:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     539:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000540 <write>:
+{
+     540:	55                   	push   %ebp
+     541:	89 e5                	mov    %esp,%ebp
+     543:	57                   	push   %edi
+     544:	56                   	push   %esi
+     545:	53                   	push   %ebx
+     546:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     549:	a1 20 62 00 00       	mov    0x6220,%eax
+{
+     54e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     551:	8b 75 0c             	mov    0xc(%ebp),%esi
+     554:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     557:	85 c0                	test   %eax,%eax
+     559:	74 02                	je     55d <write+0x1d>
+    flushhook();
+     55b:	ff d0                	call   *%eax
+  return _write(fd, buf, n);
+     55d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     560:	89 75 0c             	mov    %esi,0xc(%ebp)
+     563:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     566:	83 c4 0c             	add    $0xc,%esp
+     569:	5b                   	pop    %ebx
+     56a:	5e                   	pop    %esi
+     56b:	5f                   	pop    %edi
+     56c:	5d                   	pop    %ebp
+  return _write(fd, buf, n);
+     56d:	e9 2e 01 00 00       	jmp    6a0 <_write>
+     572:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     579:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000580 <writev>:
+{
+     580:	55                   	push   %ebp
+     581:	89 e5                	mov    %esp,%ebp
+     583:	57                   	push   %edi
+     584:	56                   	push   %esi
+     585:	53                   	push   %ebx
+     586:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     589:	a1 20 62 00 00       	mov    0x6220,%eax
+{
+     58e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     591:	8b 75 0c             	mov    0xc(%ebp),%esi
+     594:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     597:	85 c0                	test   %eax,%eax
+     599:	74 02                	je     59d <writev+0x1d>
+    flushhook();
+     59b:	ff d0                	call   *%eax
+  return _writev(fd, iov, cnt);
+     59d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     5a0:	89 75 0c             	mov    %esi,0xc(%ebp)
+     5a3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     5a6:	83 c4 0c             	add    $0xc,%esp
+     5a9:	5b                   	pop    %ebx
+     5aa:	5e                   	pop    %esi
+     5ab:	5f                   	pop    %edi
+     5ac:	5d                   	pop    %ebp
+  return _writev(fd, iov, cnt);
+     5ad:	e9 fe 01 00 00       	jmp    7b0 <_writev>
+     5b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000005c0 <close>:
+{
+     5c0:	55                   	push   %ebp
+     5c1:	89 e5                	mov    %esp,%ebp
+     5c3:	53                   	push   %ebx
+     5c4:	83 ec 04             	sub    $0x4,%esp
+  if(flushhook)
+     5c7:	a1 20 62 00 00       	mov    0x6220,%eax
+{
+     5cc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(flushhook)
+     5cf:	85 c0                	test   %eax,%eax
+     5d1:	74 02                	je     5d5 <close+0x15>
+    flushhook();
+     5d3:	ff d0                	call   *%eax
+  return _close(fd);
+     5d5:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     5d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     5db:	c9                   	leave
+  return _close(fd);
+     5dc:	e9 c7 00 00 00       	jmp    6a8 <_close>
+     5e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5ef:	90                   	nop
+
+000005f0 <umtxinit>:
+// process that finds the mutex held enters the kernel, to sleep
+// in futexwait() until the holder's umtxunlock() wakes it.
+
+void
+umtxinit(struct umutex *m)
+{
+     5f0:	55                   	push   %ebp
+     5f1:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+     5f3:	8b 45 08             	mov    0x8(%ebp),%eax
+     5f6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     5fc:	5d                   	pop    %ebp
+     5fd:	c3                   	ret
+     5fe:	66 90                	xchg   %ax,%ax
+
+00000600 <umtxlock>:
+
+void
+umtxlock(struct umutex *m)
+{
+     600:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+     601:	b8 01 00 00 00       	mov    $0x1,%eax
+     606:	89 e5                	mov    %esp,%ebp
+     608:	56                   	push   %esi
+     609:	53                   	push   %ebx
+     60a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     60d:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 1) == 0)
+     610:	85 c0                	test   %eax,%eax
+     612:	74 2b                	je     63f <umtxlock+0x3f>
+     614:	b8 02 00 00 00       	mov    $0x2,%eax
+     619:	f0 87 03             	lock xchg %eax,(%ebx)
+    return;
+  // Mark the mutex contended, so that its holder
+  // wakes a waiter on release, and wait.
+  while(xchg(&m->state, 2) != 0)
+     61c:	85 c0                	test   %eax,%eax
+     61e:	74 1f                	je     63f <umtxlock+0x3f>
+     620:	be 02 00 00 00       	mov    $0x2,%esi
+     625:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwait(&m->state, 2);
+     628:	83 ec 08             	sub    $0x8,%esp
+     62b:	6a 02                	push   $0x2
+     62d:	53                   	push   %ebx
+     62e:	e8 85 01 00 00       	call   7b8 <futexwait>
+     633:	89 f0                	mov    %esi,%eax
+     635:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+     638:	83 c4 10             	add    $0x10,%esp
+     63b:	85 c0                	test   %eax,%eax
+     63d:	75 e9                	jne    628 <umtxlock+0x28>
+}
+     63f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     642:	5b                   	pop    %ebx
+     643:	5e                   	pop    %esi
+     644:	5d                   	pop    %ebp
+     645:	c3                   	ret
+     646:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     64d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000650 <umtxunlock>:
+
+void
+umtxunlock(struct umutex *m)
+{
+     650:	55                   	push   %ebp
+     651:	31 c0                	xor    %eax,%eax
+     653:	89 e5                	mov    %esp,%ebp
+     655:	83 ec 08             	sub    $0x8,%esp
+     658:	8b 55 08             	mov    0x8(%ebp),%edx
+     65b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+     65e:	83 f8 02             	cmp    $0x2,%eax
+     661:	74 05                	je     668 <umtxunlock+0x18>
+    futexwake(&m->state, 1);
+}
+     663:	c9                   	leave
+     664:	c3                   	ret
+     665:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwake(&m->state, 1);
+     668:	83 ec 08             	sub    $0x8,%esp
+     66b:	6a 01                	push   $0x1
+     66d:	52                   	push   %edx
+     66e:	e8 4d 01 00 00       	call   7c0 <futexwake>
+     673:	83 c4 10             	add    $0x10,%esp
+}
+     676:	c9                   	leave
+     677:	c3                   	ret
+
+00000678 <_fork>:
+  _ ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+     678:	b8 01 00 00 00       	mov    $0x1,%eax
+     67d:	cd 40                	int    $0x40
+     67f:	c3                   	ret
+
+00000680 <_exit>:
+RAWSYSCALL(exit)
+     680:	b8 02 00 00 00       	mov    $0x2,%eax
+     685:	cd 40                	int    $0x40
+     687:	c3                   	ret
+
+00000688 <wait>:
+SYSCALL(wait)
+     688:	b8 03 00 00 00       	mov    $0x3,%eax
+     68d:	cd 40                	int    $0x40
+     68f:	c3                   	ret
+
+00000690 <pipe>:
+SYSCALL(pipe)
+     690:	b8 04 00 00 00       	mov    $0x4,%eax
+     695:	cd 40                	int    $0x40
+     697:	c3                   	ret
+
+00000698 <_read>:
+RAWSYSCALL(read)
+     698:	b8 05 00 00 00       	mov    $0x5,%eax
+     69d:	cd 40                	int    $0x40
+     69f:	c3                   	ret
+
+000006a0 <_write>:
+RAWSYSCALL(write)
+     6a0:	b8 10 00 00 00       	mov    $0x10,%eax
+     6a5:	cd 40                	int    $0x40
+     6a7:	c3                   	ret
+
+000006a8 <_close>:
+RAWSYSCALL(close)
+     6a8:	b8 15 00 00 00       	mov    $0x15,%eax
+     6ad:	cd 40                	int    $0x40
+     6af:	c3                   	ret
+
+000006b0 <kill>:
+SYSCALL(kill)
+     6b0:	b8 06 00 00 00       	mov    $0x6,%eax
+     6b5:	cd 40                	int    $0x40
+     6b7:	c3                   	ret
+
+000006b8 <_exec>:
+RAWSYSCALL(exec)
+     6b8:	b8 07 00 00 00       	mov    $0x7,%eax
+     6bd:	cd 40                	int    $0x40
+     6bf:	c3                   	ret
+
+000006c0 <open>:
+SYSCALL(open)
+     6c0:	b8 0f 00 00 00       	mov    $0xf,%eax
+     6c5:	cd 40                	int    $0x40
+     6c7:	c3                   	ret
+
+000006c8 <mknod>:
+SYSCALL(mknod)
+     6c8:	b8 11 00 00 00       	mov    $0x11,%eax
+     6cd:	cd 40                	int    $0x40
+     6cf:	c3                   	ret
+
+000006d0 <unlink>:
+SYSCALL(unlink)
+     6d0:	b8 12 00 00 00       	mov    $0x12,%eax
+     6d5:	cd 40                	int    $0x40
+     6d7:	c3                   	ret
+
+000006d8 <fstat>:
+SYSCALL(fstat)
+     6d8:	b8 08 00 00 00       	mov    $0x8,%eax
+     6dd:	cd 40                	int    $0x40
+     6df:	c3                   	ret
+
+000006e0 <link>:
+SYSCALL(link)
+     6e0:	b8 13 00 00 00       	mov    $0x13,%eax
+     6e5:	cd 40                	int    $0x40
+     6e7:	c3                   	ret
+
+000006e8 <mkdir>:
+SYSCALL(mkdir)
+     6e8:	b8 14 00 00 00       	mov    $0x14,%eax
+     6ed:	cd 40                	int    $0x40
+     6ef:	c3                   	ret
+
+000006f0 <chdir>:
+SYSCALL(chdir)
+     6f0:	b8 09 00 00 00       	mov    $0x9,%eax
+     6f5:	cd 40                	int    $0x40
+     6f7:	c3                   	ret
+
+000006f8 <dup>:
+SYSCALL(dup)
+     6f8:	b8 0a 00 00 00       	mov    $0xa,%eax
+     6fd:	cd 40                	int    $0x40
+     6ff:	c3                   	ret
+
+00000700 <getpid>:
+SYSCALL(getpid)
+     700:	b8 0b 00 00 00       	mov    $0xb,%eax
+     705:	cd 40                	int    $0x40
+     707:	c3                   	ret
+
+00000708 <sbrk>:
+SYSCALL(sbrk)
+     708:	b8 0c 00 00 00       	mov    $0xc,%eax
+     70d:	cd 40                	int    $0x40
+     70f:	c3                   	ret
+
+00000710 <sleep>:
+SYSCALL(sleep)
+     710:	b8 0d 00 00 00       	mov    $0xd,%eax
+     715:	cd 40                	int    $0x40
+     717:	c3                   	ret
+
+00000718 <uptime>:
+SYSCALL(uptime)
+     718:	b8 0e 00 00 00       	mov    $0xe,%eax
+     71d:	cd 40                	int    $0x40
+     71f:	c3                   	ret
+
+00000720 <wolfie>:
+SYSCALL(wolfie)
+     720:	b8 16 00 00 00       	mov    $0x16,%eax
+     725:	cd 40                	int    $0x40
+     727:	c3                   	ret
+
+00000728 <nice>:
+SYSCALL(nice)
+     728:	b8 17 00 00 00       	mov    $0x17,%eax
+     72d:	cd 40                	int    $0x40
+     72f:	c3                   	ret
+
+00000730 <mtxget>:
+SYSCALL(mtxget)
+     730:	b8 18 00 00 00       	mov    $0x18,%eax
+     735:	cd 40                	int    $0x40
+     737:	c3                   	ret
+
+00000738 <mtxrel>:
+SYSCALL(mtxrel)
+     738:	b8 19 00 00 00       	mov    $0x19,%eax
+     73d:	cd 40                	int    $0x40
+     73f:	c3                   	ret
+
+00000740 <mtxacq>:
+SYSCALL(mtxacq)
+     740:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     745:	cd 40                	int    $0x40
+     747:	c3                   	ret
+
+00000748 <mtxdel>:
+SYSCALL(mtxdel)
+     748:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     74d:	cd 40                	int    $0x40
+     74f:	c3                   	ret
+
+00000750 <iostat>:
+SYSCALL(iostat)
+     750:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     755:	cd 40                	int    $0x40
+     757:	c3                   	ret
+
+00000758 <mmap>:
+SYSCALL(mmap)
+     758:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     75d:	cd 40                	int    $0x40
+     75f:	c3                   	ret
+
+00000760 <munmap>:
+SYSCALL(munmap)
+     760:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     765:	cd 40                	int    $0x40
+     767:	c3                   	ret
+
+00000768 <shmget>:
+SYSCALL(shmget)
+     768:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     76d:	cd 40                	int    $0x40
+     76f:	c3                   	ret
+
+00000770 <shmat>:
+SYSCALL(shmat)
+     770:	b8 20 00 00 00       	mov    $0x20,%eax
+     775:	cd 40                	int    $0x40
+     777:	c3                   	ret
+
+00000778 <shmdt>:
+SYSCALL(shmdt)
+     778:	b8 21 00 00 00       	mov    $0x21,%eax
+     77d:	cd 40                	int    $0x40
+     77f:	c3                   	ret
+
+00000780 <shmdel>:
+SYSCALL(shmdel)
+     780:	b8 22 00 00 00       	mov    $0x22,%eax
+     785:	cd 40                	int    $0x40
+     787:	c3                   	ret
+
+00000788 <syscount>:
+SYSCALL(syscount)
+     788:	b8 23 00 00 00       	mov    $0x23,%eax
+     78d:	cd 40                	int    $0x40
+     78f:	c3                   	ret
+
+00000790 <splice>:
+SYSCALL(splice)
+     790:	b8 24 00 00 00       	mov    $0x24,%eax
+     795:	cd 40                	int    $0x40
+     797:	c3                   	ret
+
+00000798 <tee>:
+SYSCALL(tee)
+     798:	b8 25 00 00 00       	mov    $0x25,%eax
+     79d:	cd 40                	int    $0x40
+     79f:	c3                   	ret
+
+000007a0 <sendfile>:
+SYSCALL(sendfile)
+     7a0:	b8 26 00 00 00       	mov    $0x26,%eax
+     7a5:	cd 40                	int    $0x40
+     7a7:	c3                   	ret
+
+000007a8 <_readv>:
+RAWSYSCALL(readv)
+     7a8:	b8 27 00 00 00       	mov    $0x27,%eax
+     7ad:	cd 40                	int    $0x40
+     7af:	c3                   	ret
+
+000007b0 <_writev>:
+RAWSYSCALL(writev)
+     7b0:	b8 28 00 00 00       	mov    $0x28,%eax
+     7b5:	cd 40                	int    $0x40
+     7b7:	c3                   	ret
+
+000007b8 <futexwait>:
+SYSCALL(futexwait)
+     7b8:	b8 29 00 00 00       	mov    $0x29,%eax
+     7bd:	cd 40                	int    $0x40
+     7bf:	c3                   	ret
+
+000007c0 <futexwake>:
+SYSCALL(futexwake)
+     7c0:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     7c5:	cd 40                	int    $0x40
+     7c7:	c3                   	ret
+
+000007c8 <lockstat>:
+SYSCALL(lockstat)
+     7c8:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     7cd:	cd 40                	int    $0x40
+     7cf:	c3                   	ret
+
+000007d0 <clone>:
+SYSCALL(clone)
+     7d0:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     7d5:	cd 40                	int    $0x40
+     7d7:	c3                   	ret
+
+000007d8 <join>:
+SYSCALL(join)
+     7d8:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     7dd:	cd 40                	int    $0x40
+     7df:	c3                   	ret
+
+000007e0 <stacklimit>:
+SYSCALL(stacklimit)
+     7e0:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     7e5:	cd 40                	int    $0x40
+     7e7:	c3                   	ret
+     7e8:	66 90                	xchg   %ax,%ax
+     7ea:	66 90                	xchg   %ax,%ax
+     7ec:	66 90                	xchg   %ax,%ax
+     7ee:	66 90                	xchg   %ax,%ax
+
+000007f0 <flushall>:
+  b->n = 0;
+}
+
+static void
+flushall(void)
+{
+     7f0:	55                   	push   %ebp
+     7f1:	89 e5                	mov    %esp,%ebp
+     7f3:	83 ec 14             	sub    $0x14,%esp
+  umtxlock(&stdoutlock);
+     7f6:	68 24 62 00 00       	push   $0x6224
+     7fb:	e8 00 fe ff ff       	call   600 <umtxlock>
+  if(b->n > 0)
+     800:	a1 08 20 00 00       	mov    0x2008,%eax
+     805:	83 c4 10             	add    $0x10,%esp
+     808:	85 c0                	test   %eax,%eax
+     80a:	7e 17                	jle    823 <flushall+0x33>
+    _write(b->fd, b->buf, b->n);
+     80c:	83 ec 04             	sub    $0x4,%esp
+     80f:	50                   	push   %eax
+     810:	68 0c 20 00 00       	push   $0x200c
+     815:	ff 35 00 20 00 00    	push   0x2000
+     81b:	e8 80 fe ff ff       	call   6a0 <_write>
+     820:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     823:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     82a:	00 00 00 
+  flush(&stdout);
+  umtxunlock(&stdoutlock);
+     82d:	83 ec 0c             	sub    $0xc,%esp
+     830:	68 24 62 00 00       	push   $0x6224
+     835:	e8 16 fe ff ff       	call   650 <umtxunlock>
+}
+     83a:	83 c4 10             	add    $0x10,%esp
+     83d:	c9                   	leave
+     83e:	c3                   	ret
+     83f:	90                   	nop
+
+00000840 <printint>:
+    flush(b);
+}
+
+static void
+printint(struct outbuf *b, int xx, int base, int sgn)
+{
+     840:	55                   	push   %ebp
+     841:	89 e5                	mov    %esp,%ebp
+     843:	57                   	push   %edi
+     844:	89 cf                	mov    %ecx,%edi
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     846:	89 d1                	mov    %edx,%ecx
+{
+     848:	56                   	push   %esi
+     849:	53                   	push   %ebx
+     84a:	89 c3                	mov    %eax,%ebx
+     84c:	83 ec 2c             	sub    $0x2c,%esp
+  if(sgn && xx < 0){
+     84f:	85 d2                	test   %edx,%edx
+     851:	0f 89 b9 00 00 00    	jns    910 <printint+0xd0>
+     857:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     85b:	0f 84 af 00 00 00    	je     910 <printint+0xd0>
+    x = -xx;
+     861:	f7 d9                	neg    %ecx
+    neg = 1;
+     863:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     868:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     86b:	31 f6                	xor    %esi,%esi
+     86d:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     870:	89 c8                	mov    %ecx,%eax
+     872:	31 d2                	xor    %edx,%edx
+     874:	89 f3                	mov    %esi,%ebx
+     876:	f7 f7                	div    %edi
+     878:	8d 76 01             	lea    0x1(%esi),%esi
+     87b:	0f b6 92 fc 14 00 00 	movzbl 0x14fc(%edx),%edx
+     882:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     886:	89 ca                	mov    %ecx,%edx
+     888:	89 c1                	mov    %eax,%ecx
+     88a:	39 fa                	cmp    %edi,%edx
+     88c:	73 e2                	jae    870 <printint+0x30>
+  if(neg)
+     88e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     891:	89 d9                	mov    %ebx,%ecx
+     893:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     896:	85 c0                	test   %eax,%eax
+     898:	74 07                	je     8a1 <printint+0x61>
+    buf[i++] = '-';
+     89a:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     89f:	89 f1                	mov    %esi,%ecx
+     8a1:	8d 75 d8             	lea    -0x28(%ebp),%esi
+     8a4:	89 cf                	mov    %ecx,%edi
+     8a6:	01 f7                	add    %esi,%edi
+     8a8:	eb 1a                	jmp    8c4 <printint+0x84>
+     8aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    *b->str++ = c;
+     8b0:	8d 48 01             	lea    0x1(%eax),%ecx
+     8b3:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+     8b9:	88 10                	mov    %dl,(%eax)
+
+  while(--i >= 0)
+     8bb:	8d 47 ff             	lea    -0x1(%edi),%eax
+     8be:	39 fe                	cmp    %edi,%esi
+     8c0:	74 40                	je     902 <printint+0xc2>
+     8c2:	89 c7                	mov    %eax,%edi
+  if(b->str){
+     8c4:	8b 83 0c 02 00 00    	mov    0x20c(%ebx),%eax
+    putc(b, buf[i]);
+     8ca:	0f b6 17             	movzbl (%edi),%edx
+  if(b->str){
+     8cd:	85 c0                	test   %eax,%eax
+     8cf:	75 df                	jne    8b0 <printint+0x70>
+  b->buf[b->n++] = c;
+     8d1:	8b 4b 08             	mov    0x8(%ebx),%ecx
+     8d4:	8d 41 01             	lea    0x1(%ecx),%eax
+     8d7:	89 43 08             	mov    %eax,0x8(%ebx)
+     8da:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+     8de:	3d 00 02 00 00       	cmp    $0x200,%eax
+     8e3:	74 3b                	je     920 <printint+0xe0>
+     8e5:	80 fa 0a             	cmp    $0xa,%dl
+     8e8:	75 d1                	jne    8bb <printint+0x7b>
+     8ea:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+     8ee:	75 cb                	jne    8bb <printint+0x7b>
+  if(b->n > 0)
+     8f0:	85 c0                	test   %eax,%eax
+     8f2:	7f 2c                	jg     920 <printint+0xe0>
+  b->n = 0;
+     8f4:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  while(--i >= 0)
+     8fb:	8d 47 ff             	lea    -0x1(%edi),%eax
+     8fe:	39 fe                	cmp    %edi,%esi
+     900:	75 c0                	jne    8c2 <printint+0x82>
+}
+     902:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     905:	5b                   	pop    %ebx
+     906:	5e                   	pop    %esi
+     907:	5f                   	pop    %edi
+     908:	5d                   	pop    %ebp
+     909:	c3                   	ret
+     90a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  neg = 0;
+     910:	31 c0                	xor    %eax,%eax
+     912:	e9 51 ff ff ff       	jmp    868 <printint+0x28>
+     917:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     91e:	66 90                	xchg   %ax,%ax
+    _write(b->fd, b->buf, b->n);
+     920:	83 ec 04             	sub    $0x4,%esp
+     923:	50                   	push   %eax
+     924:	8d 43 0c             	lea    0xc(%ebx),%eax
+     927:	50                   	push   %eax
+     928:	ff 33                	push   (%ebx)
+     92a:	e8 71 fd ff ff       	call   6a0 <_write>
+     92f:	83 c4 10             	add    $0x10,%esp
+     932:	eb c0                	jmp    8f4 <printint+0xb4>
+     934:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     93b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     93f:	90                   	nop
+
+00000940 <putc>:
+{
+     940:	55                   	push   %ebp
+     941:	89 e5                	mov    %esp,%ebp
+     943:	53                   	push   %ebx
+     944:	89 c3                	mov    %eax,%ebx
+     946:	83 ec 04             	sub    $0x4,%esp
+  if(b->str){
+     949:	8b 80 0c 02 00 00    	mov    0x20c(%eax),%eax
+     94f:	85 c0                	test   %eax,%eax
+     951:	74 15                	je     968 <putc+0x28>
+    *b->str++ = c;
+     953:	8d 48 01             	lea    0x1(%eax),%ecx
+     956:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+     95c:	88 10                	mov    %dl,(%eax)
+}
+     95e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     961:	c9                   	leave
+     962:	c3                   	ret
+     963:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     967:	90                   	nop
+  b->buf[b->n++] = c;
+     968:	8b 4b 08             	mov    0x8(%ebx),%ecx
+     96b:	8d 41 01             	lea    0x1(%ecx),%eax
+     96e:	89 43 08             	mov    %eax,0x8(%ebx)
+     971:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+     975:	3d 00 02 00 00       	cmp    $0x200,%eax
+     97a:	74 14                	je     990 <putc+0x50>
+     97c:	80 fa 0a             	cmp    $0xa,%dl
+     97f:	75 dd                	jne    95e <putc+0x1e>
+     981:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+     985:	75 d7                	jne    95e <putc+0x1e>
+  if(b->n > 0)
+     987:	85 c0                	test   %eax,%eax
+     989:	7e 17                	jle    9a2 <putc+0x62>
+     98b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     98f:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     990:	83 ec 04             	sub    $0x4,%esp
+     993:	50                   	push   %eax
+     994:	8d 43 0c             	lea    0xc(%ebx),%eax
+     997:	50                   	push   %eax
+     998:	ff 33                	push   (%ebx)
+     99a:	e8 01 fd ff ff       	call   6a0 <_write>
+     99f:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     9a2:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+     9a9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     9ac:	c9                   	leave
+     9ad:	c3                   	ret
+     9ae:	66 90                	xchg   %ax,%ax
+
+000009b0 <format>:
+
+// Format fmt and the arguments at ap into b.
+// Only understands %d, %x, %p, %s, %c.
+static void
+format(struct outbuf *b, const char *fmt, uint *ap)
+{
+     9b0:	55                   	push   %ebp
+     9b1:	89 e5                	mov    %esp,%ebp
+     9b3:	57                   	push   %edi
+     9b4:	89 c7                	mov    %eax,%edi
+     9b6:	56                   	push   %esi
+     9b7:	53                   	push   %ebx
+     9b8:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+     9bb:	0f b6 02             	movzbl (%edx),%eax
+{
+     9be:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  for(i = 0; fmt[i]; i++){
+     9c1:	84 c0                	test   %al,%al
+     9c3:	74 5a                	je     a1f <format+0x6f>
+     9c5:	8d 5a 01             	lea    0x1(%edx),%ebx
+     9c8:	31 f6                	xor    %esi,%esi
+     9ca:	eb 1c                	jmp    9e8 <format+0x38>
+     9cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     9d0:	83 f8 25             	cmp    $0x25,%eax
+     9d3:	74 3b                	je     a10 <format+0x60>
+        state = '%';
+      } else {
+        putc(b, c);
+     9d5:	89 ca                	mov    %ecx,%edx
+     9d7:	89 f8                	mov    %edi,%eax
+     9d9:	e8 62 ff ff ff       	call   940 <putc>
+  for(i = 0; fmt[i]; i++){
+     9de:	0f b6 03             	movzbl (%ebx),%eax
+     9e1:	83 c3 01             	add    $0x1,%ebx
+     9e4:	84 c0                	test   %al,%al
+     9e6:	74 37                	je     a1f <format+0x6f>
+    c = fmt[i] & 0xff;
+     9e8:	0f be c8             	movsbl %al,%ecx
+     9eb:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     9ee:	85 f6                	test   %esi,%esi
+     9f0:	74 de                	je     9d0 <format+0x20>
+      }
+    } else if(state == '%'){
+     9f2:	83 fe 25             	cmp    $0x25,%esi
+     9f5:	75 e7                	jne    9de <format+0x2e>
+      if(c == 'd'){
+     9f7:	83 f8 25             	cmp    $0x25,%eax
+     9fa:	74 46                	je     a42 <format+0x92>
+     9fc:	83 e8 63             	sub    $0x63,%eax
+     9ff:	83 f8 15             	cmp    $0x15,%eax
+     a02:	77 2c                	ja     a30 <format+0x80>
+     a04:	ff 24 85 a4 14 00 00 	jmp    *0x14a4(,%eax,4)
+     a0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     a0f:	90                   	nop
+  for(i = 0; fmt[i]; i++){
+     a10:	0f b6 03             	movzbl (%ebx),%eax
+     a13:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+     a16:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+     a1b:	84 c0                	test   %al,%al
+     a1d:	75 c9                	jne    9e8 <format+0x38>
+        putc(b, c);
+      }
+      state = 0;
+    }
+  }
+}
+     a1f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a22:	5b                   	pop    %ebx
+     a23:	5e                   	pop    %esi
+     a24:	5f                   	pop    %edi
+     a25:	5d                   	pop    %ebp
+     a26:	c3                   	ret
+     a27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a2e:	66 90                	xchg   %ax,%ax
+        putc(b, '%');
+     a30:	ba 25 00 00 00       	mov    $0x25,%edx
+     a35:	89 f8                	mov    %edi,%eax
+     a37:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     a3a:	e8 01 ff ff ff       	call   940 <putc>
+        putc(b, c);
+     a3f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     a42:	89 ca                	mov    %ecx,%edx
+     a44:	89 f8                	mov    %edi,%eax
+      state = 0;
+     a46:	31 f6                	xor    %esi,%esi
+        putc(b, c);
+     a48:	e8 f3 fe ff ff       	call   940 <putc>
+     a4d:	eb 8f                	jmp    9de <format+0x2e>
+     a4f:	90                   	nop
+        printint(b, *ap, 16, 0);
+     a50:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     a53:	83 ec 0c             	sub    $0xc,%esp
+     a56:	b9 10 00 00 00       	mov    $0x10,%ecx
+     a5b:	8b 16                	mov    (%esi),%edx
+     a5d:	6a 00                	push   $0x0
+        ap++;
+     a5f:	83 c6 04             	add    $0x4,%esi
+        printint(b, *ap, 16, 0);
+     a62:	89 f8                	mov    %edi,%eax
+     a64:	e8 d7 fd ff ff       	call   840 <printint>
+        ap++;
+     a69:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+     a6c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     a6f:	31 f6                	xor    %esi,%esi
+     a71:	e9 68 ff ff ff       	jmp    9de <format+0x2e>
+     a76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a7d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     a80:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     a83:	8b 30                	mov    (%eax),%esi
+        ap++;
+     a85:	83 c0 04             	add    $0x4,%eax
+     a88:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+     a8b:	85 f6                	test   %esi,%esi
+     a8d:	75 1b                	jne    aaa <format+0xfa>
+     a8f:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+     a94:	be 9c 14 00 00       	mov    $0x149c,%esi
+     a99:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+          putc(b, *s);
+     aa0:	89 f8                	mov    %edi,%eax
+          s++;
+     aa2:	83 c6 01             	add    $0x1,%esi
+          putc(b, *s);
+     aa5:	e8 96 fe ff ff       	call   940 <putc>
+        while(*s != 0){
+     aaa:	0f be 16             	movsbl (%esi),%edx
+     aad:	84 d2                	test   %dl,%dl
+     aaf:	75 ef                	jne    aa0 <format+0xf0>
+      state = 0;
+     ab1:	31 f6                	xor    %esi,%esi
+     ab3:	e9 26 ff ff ff       	jmp    9de <format+0x2e>
+     ab8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     abf:	90                   	nop
+        printint(b, *ap, 10, 1);
+     ac0:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     ac3:	83 ec 0c             	sub    $0xc,%esp
+     ac6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     acb:	8b 16                	mov    (%esi),%edx
+     acd:	6a 01                	push   $0x1
+     acf:	eb 8e                	jmp    a5f <format+0xaf>
+     ad1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(b, *ap);
+     ad8:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     adb:	89 f8                	mov    %edi,%eax
+     add:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+     ae0:	83 c6 04             	add    $0x4,%esi
+        putc(b, *ap);
+     ae3:	e8 58 fe ff ff       	call   940 <putc>
+        ap++;
+     ae8:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      state = 0;
+     aeb:	31 f6                	xor    %esi,%esi
+     aed:	e9 ec fe ff ff       	jmp    9de <format+0x2e>
+     af2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     af9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000b00 <fflush>:
+{
+     b00:	55                   	push   %ebp
+     b01:	89 e5                	mov    %esp,%ebp
+     b03:	83 ec 08             	sub    $0x8,%esp
+  if(fd == stdout.fd)
+     b06:	8b 45 08             	mov    0x8(%ebp),%eax
+     b09:	39 05 00 20 00 00    	cmp    %eax,0x2000
+     b0f:	74 07                	je     b18 <fflush+0x18>
+}
+     b11:	c9                   	leave
+     b12:	c3                   	ret
+     b13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b17:	90                   	nop
+  umtxlock(&stdoutlock);
+     b18:	83 ec 0c             	sub    $0xc,%esp
+     b1b:	68 24 62 00 00       	push   $0x6224
+     b20:	e8 db fa ff ff       	call   600 <umtxlock>
+  if(b->n > 0)
+     b25:	a1 08 20 00 00       	mov    0x2008,%eax
+     b2a:	83 c4 10             	add    $0x10,%esp
+     b2d:	85 c0                	test   %eax,%eax
+     b2f:	7f 1f                	jg     b50 <fflush+0x50>
+  b->n = 0;
+     b31:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     b38:	00 00 00 
+  umtxunlock(&stdoutlock);
+     b3b:	c7 45 08 24 62 00 00 	movl   $0x6224,0x8(%ebp)
+}
+     b42:	c9                   	leave
+  umtxunlock(&stdoutlock);
+     b43:	e9 08 fb ff ff       	jmp    650 <umtxunlock>
+     b48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b4f:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     b50:	83 ec 04             	sub    $0x4,%esp
+     b53:	50                   	push   %eax
+     b54:	68 0c 20 00 00       	push   $0x200c
+     b59:	ff 35 00 20 00 00    	push   0x2000
+     b5f:	e8 3c fb ff ff       	call   6a0 <_write>
+     b64:	83 c4 10             	add    $0x10,%esp
+     b67:	eb c8                	jmp    b31 <fflush+0x31>
+     b69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000b70 <setvbuf>:
+{
+     b70:	55                   	push   %ebp
+     b71:	89 e5                	mov    %esp,%ebp
+     b73:	53                   	push   %ebx
+     b74:	83 ec 04             	sub    $0x4,%esp
+     b77:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd != stdout.fd)
+     b7a:	8b 45 08             	mov    0x8(%ebp),%eax
+     b7d:	39 05 00 20 00 00    	cmp    %eax,0x2000
+     b83:	74 0b                	je     b90 <setvbuf+0x20>
+}
+     b85:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     b88:	c9                   	leave
+     b89:	c3                   	ret
+     b8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  umtxlock(&stdoutlock);
+     b90:	83 ec 0c             	sub    $0xc,%esp
+     b93:	68 24 62 00 00       	push   $0x6224
+     b98:	e8 63 fa ff ff       	call   600 <umtxlock>
+  if(b->n > 0)
+     b9d:	a1 08 20 00 00       	mov    0x2008,%eax
+     ba2:	83 c4 10             	add    $0x10,%esp
+     ba5:	85 c0                	test   %eax,%eax
+     ba7:	7f 2f                	jg     bd8 <setvbuf+0x68>
+  b->n = 0;
+     ba9:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     bb0:	00 00 00 
+  stdout.mode = mode;
+     bb3:	89 1d 04 20 00 00    	mov    %ebx,0x2004
+  flushhook = flushall;
+     bb9:	c7 05 20 62 00 00 f0 	movl   $0x7f0,0x6220
+     bc0:	07 00 00 
+}
+     bc3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&stdoutlock);
+     bc6:	c7 45 08 24 62 00 00 	movl   $0x6224,0x8(%ebp)
+}
+     bcd:	c9                   	leave
+  umtxunlock(&stdoutlock);
+     bce:	e9 7d fa ff ff       	jmp    650 <umtxunlock>
+     bd3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     bd7:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     bd8:	83 ec 04             	sub    $0x4,%esp
+     bdb:	50                   	push   %eax
+     bdc:	68 0c 20 00 00       	push   $0x200c
+     be1:	ff 35 00 20 00 00    	push   0x2000
+     be7:	e8 b4 fa ff ff       	call   6a0 <_write>
+     bec:	83 c4 10             	add    $0x10,%esp
+     bef:	eb b8                	jmp    ba9 <setvbuf+0x39>
+     bf1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bf8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bff:	90                   	nop
+
+00000c00 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s, %c.
+void
+printf(int fd, const char *fmt, ...)
+{
+     c00:	55                   	push   %ebp
+     c01:	89 e5                	mov    %esp,%ebp
+     c03:	53                   	push   %ebx
+     c04:	81 ec 14 02 00 00    	sub    $0x214,%esp
+     c0a:	8b 45 08             	mov    0x8(%ebp),%eax
+    local.mode = _IONBF;
+    local.n = 0;
+    local.str = 0;
+    b = &local;
+  }
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     c0d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd == stdout.fd){
+     c10:	39 05 00 20 00 00    	cmp    %eax,0x2000
+     c16:	74 48                	je     c60 <printf+0x60>
+    local.fd = fd;
+     c18:	89 85 e8 fd ff ff    	mov    %eax,-0x218(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     c1e:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     c21:	89 da                	mov    %ebx,%edx
+     c23:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+    local.mode = _IONBF;
+     c29:	c7 85 ec fd ff ff 03 	movl   $0x3,-0x214(%ebp)
+     c30:	00 00 00 
+    local.n = 0;
+     c33:	c7 85 f0 fd ff ff 00 	movl   $0x0,-0x210(%ebp)
+     c3a:	00 00 00 
+    local.str = 0;
+     c3d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     c44:	e8 67 fd ff ff       	call   9b0 <format>
+  if(b->mode == _IONBF)
+     c49:	83 bd ec fd ff ff 03 	cmpl   $0x3,-0x214(%ebp)
+     c50:	0f 84 a2 00 00 00    	je     cf8 <printf+0xf8>
+    flush(b);
+  if(b == &stdout)
+    umtxunlock(&stdoutlock);
+}
+     c56:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     c59:	c9                   	leave
+     c5a:	c3                   	ret
+     c5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c5f:	90                   	nop
+    umtxlock(&stdoutlock);
+     c60:	83 ec 0c             	sub    $0xc,%esp
+     c63:	68 24 62 00 00       	push   $0x6224
+     c68:	e8 93 f9 ff ff       	call   600 <umtxlock>
+  if(stdout.mode == 0){
+     c6d:	a1 04 20 00 00       	mov    0x2004,%eax
+     c72:	83 c4 10             	add    $0x10,%esp
+     c75:	85 c0                	test   %eax,%eax
+     c77:	74 37                	je     cb0 <printf+0xb0>
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     c79:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     c7c:	89 da                	mov    %ebx,%edx
+     c7e:	b8 00 20 00 00       	mov    $0x2000,%eax
+     c83:	e8 28 fd ff ff       	call   9b0 <format>
+  if(b->mode == _IONBF)
+     c88:	83 3d 04 20 00 00 03 	cmpl   $0x3,0x2004
+     c8f:	0f 84 ab 00 00 00    	je     d40 <printf+0x140>
+    umtxunlock(&stdoutlock);
+     c95:	83 ec 0c             	sub    $0xc,%esp
+     c98:	68 24 62 00 00       	push   $0x6224
+     c9d:	e8 ae f9 ff ff       	call   650 <umtxunlock>
+}
+     ca2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    umtxunlock(&stdoutlock);
+     ca5:	83 c4 10             	add    $0x10,%esp
+}
+     ca8:	c9                   	leave
+     ca9:	c3                   	ret
+     caa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+     cb0:	83 ec 08             	sub    $0x8,%esp
+     cb3:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+     cb9:	50                   	push   %eax
+     cba:	ff 35 00 20 00 00    	push   0x2000
+     cc0:	e8 13 fa ff ff       	call   6d8 <fstat>
+     cc5:	83 c4 10             	add    $0x10,%esp
+     cc8:	89 c2                	mov    %eax,%edx
+      stdout.mode = _IOFBF;
+     cca:	b8 01 00 00 00       	mov    $0x1,%eax
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+     ccf:	85 d2                	test   %edx,%edx
+     cd1:	75 10                	jne    ce3 <printf+0xe3>
+      stdout.mode = _IOLBF;
+     cd3:	31 c0                	xor    %eax,%eax
+     cd5:	66 83 bd e8 fd ff ff 	cmpw   $0x3,-0x218(%ebp)
+     cdc:	03 
+     cdd:	0f 94 c0             	sete   %al
+     ce0:	83 c0 01             	add    $0x1,%eax
+     ce3:	a3 04 20 00 00       	mov    %eax,0x2004
+    flushhook = flushall;
+     ce8:	c7 05 20 62 00 00 f0 	movl   $0x7f0,0x6220
+     cef:	07 00 00 
+     cf2:	eb 85                	jmp    c79 <printf+0x79>
+     cf4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(b->n > 0)
+     cf8:	8b 85 f0 fd ff ff    	mov    -0x210(%ebp),%eax
+     cfe:	85 c0                	test   %eax,%eax
+     d00:	0f 8e 50 ff ff ff    	jle    c56 <printf+0x56>
+    b = &local;
+     d06:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+    _write(b->fd, b->buf, b->n);
+     d0c:	83 ec 04             	sub    $0x4,%esp
+     d0f:	50                   	push   %eax
+     d10:	8d 43 0c             	lea    0xc(%ebx),%eax
+     d13:	50                   	push   %eax
+     d14:	ff 33                	push   (%ebx)
+     d16:	e8 85 f9 ff ff       	call   6a0 <_write>
+  b->n = 0;
+     d1b:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  if(b == &stdout)
+     d22:	83 c4 10             	add    $0x10,%esp
+     d25:	81 fb 00 20 00 00    	cmp    $0x2000,%ebx
+     d2b:	0f 85 25 ff ff ff    	jne    c56 <printf+0x56>
+     d31:	e9 5f ff ff ff       	jmp    c95 <printf+0x95>
+     d36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d3d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(b->n > 0)
+     d40:	a1 08 20 00 00       	mov    0x2008,%eax
+    b = getstdout();
+     d45:	bb 00 20 00 00       	mov    $0x2000,%ebx
+  if(b->n > 0)
+     d4a:	85 c0                	test   %eax,%eax
+     d4c:	7f be                	jg     d0c <printf+0x10c>
+  b->n = 0;
+     d4e:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     d55:	00 00 00 
+  if(b == &stdout)
+     d58:	e9 38 ff ff ff       	jmp    c95 <printf+0x95>
+     d5d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000d60 <sprintf>:
+
+// Print to the given buffer. Only understands %d, %x, %p, %s, %c.
+int
+sprintf(char *str, const char *fmt, ...)
+{
+     d60:	55                   	push   %ebp
+     d61:	89 e5                	mov    %esp,%ebp
+     d63:	53                   	push   %ebx
+  struct outbuf b;
+
+  b.str = str;
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+     d64:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+     d6a:	8d 4d 10             	lea    0x10(%ebp),%ecx
+{
+     d6d:	81 ec 14 02 00 00    	sub    $0x214,%esp
+     d73:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+     d76:	8b 55 0c             	mov    0xc(%ebp),%edx
+  b.str = str;
+     d79:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+     d7c:	e8 2f fc ff ff       	call   9b0 <format>
+  *b.str = '\0';
+     d81:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d84:	c6 00 00             	movb   $0x0,(%eax)
+  return b.str - str;
+     d87:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d8a:	29 d8                	sub    %ebx,%eax
+}
+     d8c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     d8f:	c9                   	leave
+     d90:	c3                   	ret
+     d91:	66 90                	xchg   %ax,%ax
+     d93:	66 90                	xchg   %ax,%ax
+     d95:	66 90                	xchg   %ax,%ax
+     d97:	66 90                	xchg   %ax,%ax
+     d99:	66 90                	xchg   %ax,%ax
+     d9b:	66 90                	xchg   %ax,%ax
+     d9d:	66 90                	xchg   %ax,%ax
+     d9f:	90                   	nop
+
+00000da0 <freeblock>:
+static Header *freep;
+static struct umutex lock;  // threads made by clone() share the heap
+
+static void
+freeblock(void *ap)
+{
+     da0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+     da1:	8d 48 f8             	lea    -0x8(%eax),%ecx
+{
+     da4:	89 e5                	mov    %esp,%ebp
+     da6:	57                   	push   %edi
+     da7:	56                   	push   %esi
+     da8:	53                   	push   %ebx
+     da9:	89 c3                	mov    %eax,%ebx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     dab:	a1 2c 62 00 00       	mov    0x622c,%eax
+     db0:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     db2:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     db4:	39 ca                	cmp    %ecx,%edx
+     db6:	73 30                	jae    de8 <freeblock+0x48>
+     db8:	39 c1                	cmp    %eax,%ecx
+     dba:	72 04                	jb     dc0 <freeblock+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     dbc:	39 c2                	cmp    %eax,%edx
+     dbe:	72 f0                	jb     db0 <freeblock+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     dc0:	8b 73 fc             	mov    -0x4(%ebx),%esi
+     dc3:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+     dc6:	39 f8                	cmp    %edi,%eax
+     dc8:	74 26                	je     df0 <freeblock+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+     dca:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+     dcd:	8b 42 04             	mov    0x4(%edx),%eax
+     dd0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     dd3:	39 f1                	cmp    %esi,%ecx
+     dd5:	74 30                	je     e07 <freeblock+0x67>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+     dd7:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+     dd9:	5b                   	pop    %ebx
+  freep = p;
+     dda:	89 15 2c 62 00 00    	mov    %edx,0x622c
+}
+     de0:	5e                   	pop    %esi
+     de1:	5f                   	pop    %edi
+     de2:	5d                   	pop    %ebp
+     de3:	c3                   	ret
+     de4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     de8:	39 c1                	cmp    %eax,%ecx
+     dea:	72 d0                	jb     dbc <freeblock+0x1c>
+     dec:	eb c2                	jmp    db0 <freeblock+0x10>
+     dee:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+     df0:	03 70 04             	add    0x4(%eax),%esi
+     df3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     df6:	8b 02                	mov    (%edx),%eax
+     df8:	8b 00                	mov    (%eax),%eax
+     dfa:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+     dfd:	8b 42 04             	mov    0x4(%edx),%eax
+     e00:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     e03:	39 f1                	cmp    %esi,%ecx
+     e05:	75 d0                	jne    dd7 <freeblock+0x37>
+    p->s.size += bp->s.size;
+     e07:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+     e0a:	89 15 2c 62 00 00    	mov    %edx,0x622c
+    p->s.size += bp->s.size;
+     e10:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+     e13:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+     e16:	89 0a                	mov    %ecx,(%edx)
+}
+     e18:	5b                   	pop    %ebx
+     e19:	5e                   	pop    %esi
+     e1a:	5f                   	pop    %edi
+     e1b:	5d                   	pop    %ebp
+     e1c:	c3                   	ret
+     e1d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000e20 <free>:
+
+void
+free(void *ap)
+{
+     e20:	55                   	push   %ebp
+     e21:	89 e5                	mov    %esp,%ebp
+     e23:	53                   	push   %ebx
+     e24:	83 ec 10             	sub    $0x10,%esp
+     e27:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  umtxlock(&lock);
+     e2a:	68 28 62 00 00       	push   $0x6228
+     e2f:	e8 cc f7 ff ff       	call   600 <umtxlock>
+  freeblock(ap);
+     e34:	89 d8                	mov    %ebx,%eax
+     e36:	e8 65 ff ff ff       	call   da0 <freeblock>
+  umtxunlock(&lock);
+     e3b:	c7 45 08 28 62 00 00 	movl   $0x6228,0x8(%ebp)
+}
+     e42:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&lock);
+     e45:	83 c4 10             	add    $0x10,%esp
+}
+     e48:	c9                   	leave
+  umtxunlock(&lock);
+     e49:	e9 02 f8 ff ff       	jmp    650 <umtxunlock>
+     e4e:	66 90                	xchg   %ax,%ax
+
+00000e50 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+     e50:	55                   	push   %ebp
+     e51:	89 e5                	mov    %esp,%ebp
+     e53:	57                   	push   %edi
+     e54:	56                   	push   %esi
+     e55:	53                   	push   %ebx
+     e56:	83 ec 28             	sub    $0x28,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     e59:	8b 45 08             	mov    0x8(%ebp),%eax
+  umtxlock(&lock);
+     e5c:	68 28 62 00 00       	push   $0x6228
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     e61:	8d 48 07             	lea    0x7(%eax),%ecx
+     e64:	c1 e9 03             	shr    $0x3,%ecx
+     e67:	8d 71 01             	lea    0x1(%ecx),%esi
+  umtxlock(&lock);
+     e6a:	e8 91 f7 ff ff       	call   600 <umtxlock>
+  if((prevp = freep) == 0){
+     e6f:	8b 15 2c 62 00 00    	mov    0x622c,%edx
+     e75:	83 c4 10             	add    $0x10,%esp
+     e78:	85 d2                	test   %edx,%edx
+     e7a:	0f 84 b0 00 00 00    	je     f30 <malloc+0xe0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     e80:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+     e82:	8b 47 04             	mov    0x4(%edi),%eax
+     e85:	39 f0                	cmp    %esi,%eax
+     e87:	73 6f                	jae    ef8 <malloc+0xa8>
+  if(nu < 4096)
+     e89:	bb 00 10 00 00       	mov    $0x1000,%ebx
+     e8e:	39 de                	cmp    %ebx,%esi
+     e90:	0f 43 de             	cmovae %esi,%ebx
+  p = sbrk(nu * sizeof(Header));
+     e93:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+     e9a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     e9d:	eb 0a                	jmp    ea9 <malloc+0x59>
+     e9f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     ea0:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+     ea2:	8b 47 04             	mov    0x4(%edi),%eax
+     ea5:	39 f0                	cmp    %esi,%eax
+     ea7:	73 4f                	jae    ef8 <malloc+0xa8>
+      }
+      freep = prevp;
+      umtxunlock(&lock);
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+     ea9:	89 fa                	mov    %edi,%edx
+     eab:	39 3d 2c 62 00 00    	cmp    %edi,0x622c
+     eb1:	75 ed                	jne    ea0 <malloc+0x50>
+  p = sbrk(nu * sizeof(Header));
+     eb3:	83 ec 0c             	sub    $0xc,%esp
+     eb6:	ff 75 e4             	push   -0x1c(%ebp)
+     eb9:	e8 4a f8 ff ff       	call   708 <sbrk>
+  if(p == (char*)-1)
+     ebe:	83 c4 10             	add    $0x10,%esp
+     ec1:	83 f8 ff             	cmp    $0xffffffff,%eax
+     ec4:	74 15                	je     edb <malloc+0x8b>
+  hp->s.size = nu;
+     ec6:	89 58 04             	mov    %ebx,0x4(%eax)
+  freeblock((void*)(hp + 1));
+     ec9:	83 c0 08             	add    $0x8,%eax
+     ecc:	e8 cf fe ff ff       	call   da0 <freeblock>
+  return freep;
+     ed1:	8b 15 2c 62 00 00    	mov    0x622c,%edx
+      if((p = morecore(nunits)) == 0){
+     ed7:	85 d2                	test   %edx,%edx
+     ed9:	75 c5                	jne    ea0 <malloc+0x50>
+        umtxunlock(&lock);
+     edb:	83 ec 0c             	sub    $0xc,%esp
+     ede:	68 28 62 00 00       	push   $0x6228
+     ee3:	e8 68 f7 ff ff       	call   650 <umtxunlock>
+        return 0;
+     ee8:	83 c4 10             	add    $0x10,%esp
+      }
+  }
+}
+     eeb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+     eee:	31 c0                	xor    %eax,%eax
+}
+     ef0:	5b                   	pop    %ebx
+     ef1:	5e                   	pop    %esi
+     ef2:	5f                   	pop    %edi
+     ef3:	5d                   	pop    %ebp
+     ef4:	c3                   	ret
+     ef5:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+     ef8:	39 c6                	cmp    %eax,%esi
+     efa:	74 64                	je     f60 <malloc+0x110>
+        p->s.size -= nunits;
+     efc:	29 f0                	sub    %esi,%eax
+     efe:	89 47 04             	mov    %eax,0x4(%edi)
+        p += p->s.size;
+     f01:	8d 3c c7             	lea    (%edi,%eax,8),%edi
+        p->s.size = nunits;
+     f04:	89 77 04             	mov    %esi,0x4(%edi)
+      umtxunlock(&lock);
+     f07:	83 ec 0c             	sub    $0xc,%esp
+      freep = prevp;
+     f0a:	89 15 2c 62 00 00    	mov    %edx,0x622c
+      umtxunlock(&lock);
+     f10:	68 28 62 00 00       	push   $0x6228
+     f15:	e8 36 f7 ff ff       	call   650 <umtxunlock>
+      return (void*)(p + 1);
+     f1a:	83 c4 10             	add    $0x10,%esp
+}
+     f1d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+     f20:	8d 47 08             	lea    0x8(%edi),%eax
+}
+     f23:	5b                   	pop    %ebx
+     f24:	5e                   	pop    %esi
+     f25:	5f                   	pop    %edi
+     f26:	5d                   	pop    %ebp
+     f27:	c3                   	ret
+     f28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f2f:	90                   	nop
+    base.s.ptr = freep = prevp = &base;
+     f30:	c7 05 2c 62 00 00 30 	movl   $0x6230,0x622c
+     f37:	62 00 00 
+    base.s.size = 0;
+     f3a:	bf 30 62 00 00       	mov    $0x6230,%edi
+    base.s.ptr = freep = prevp = &base;
+     f3f:	c7 05 30 62 00 00 30 	movl   $0x6230,0x6230
+     f46:	62 00 00 
+    base.s.size = 0;
+     f49:	c7 05 34 62 00 00 00 	movl   $0x0,0x6234
+     f50:	00 00 00 
+    if(p->s.size >= nunits){
+     f53:	e9 31 ff ff ff       	jmp    e89 <malloc+0x39>
+     f58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f5f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+     f60:	8b 07                	mov    (%edi),%eax
+     f62:	89 02                	mov    %eax,(%edx)
+     f64:	eb a1                	jmp    f07 <malloc+0xb7>
+     f66:	66 90                	xchg   %ax,%ax
+     f68:	66 90                	xchg   %ax,%ax
+     f6a:	66 90                	xchg   %ax,%ax
+     f6c:	66 90                	xchg   %ax,%ax
+     f6e:	66 90                	xchg   %ax,%ax
+
+00000f70 <threadstart>:
+
+#define TSTACKSZ 4096
+
+static void
+threadstart(void *fn, void *arg)
+{
+     f70:	55                   	push   %ebp
+     f71:	89 e5                	mov    %esp,%ebp
+     f73:	83 ec 14             	sub    $0x14,%esp
+  ((void (*)(void*))fn)(arg);
+     f76:	ff 75 0c             	push   0xc(%ebp)
+     f79:	ff 55 08             	call   *0x8(%ebp)
+  exit();
+     f7c:	e8 ef f4 ff ff       	call   470 <exit>
+     f81:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f8f:	90                   	nop
+
+00000f90 <thread_create>:
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+     f90:	55                   	push   %ebp
+     f91:	89 e5                	mov    %esp,%ebp
+     f93:	53                   	push   %ebx
+     f94:	83 ec 20             	sub    $0x20,%esp
+  char *mem, *stack;
+  int pid;
+
+  if((mem = malloc(2*TSTACKSZ)) == 0)
+     f97:	68 00 20 00 00       	push   $0x2000
+     f9c:	e8 af fe ff ff       	call   e50 <malloc>
+     fa1:	83 c4 10             	add    $0x10,%esp
+     fa4:	85 c0                	test   %eax,%eax
+     fa6:	74 47                	je     fef <thread_create+0x5f>
+     fa8:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)(((uint)mem + TSTACKSZ - 1) & ~(TSTACKSZ - 1));
+     faa:	8d 80 ff 0f 00 00    	lea    0xfff(%eax),%eax
+     fb0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  *(char**)stack = mem;
+     fb5:	89 18                	mov    %ebx,(%eax)
+  if((pid = clone(threadstart, (void*)fn, arg, stack)) < 0)
+     fb7:	50                   	push   %eax
+     fb8:	ff 75 0c             	push   0xc(%ebp)
+     fbb:	ff 75 08             	push   0x8(%ebp)
+     fbe:	68 70 0f 00 00       	push   $0xf70
+     fc3:	e8 08 f8 ff ff       	call   7d0 <clone>
+     fc8:	83 c4 10             	add    $0x10,%esp
+     fcb:	85 c0                	test   %eax,%eax
+     fcd:	78 09                	js     fd8 <thread_create+0x48>
+    free(mem);
+  return pid;
+}
+     fcf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     fd2:	c9                   	leave
+     fd3:	c3                   	ret
+     fd4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    free(mem);
+     fd8:	83 ec 0c             	sub    $0xc,%esp
+     fdb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     fde:	53                   	push   %ebx
+     fdf:	e8 3c fe ff ff       	call   e20 <free>
+     fe4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     fe7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+     fea:	83 c4 10             	add    $0x10,%esp
+}
+     fed:	c9                   	leave
+     fee:	c3                   	ret
+    return -1;
+     fef:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     ff4:	eb d9                	jmp    fcf <thread_create+0x3f>
+     ff6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ffd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001000 <thread_join>:
+
+int
+thread_join(void)
+{
+    1000:	55                   	push   %ebp
+    1001:	89 e5                	mov    %esp,%ebp
+    1003:	83 ec 34             	sub    $0x34,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    1006:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    1009:	50                   	push   %eax
+    100a:	e8 c9 f7 ff ff       	call   7d8 <join>
+    100f:	83 c4 10             	add    $0x10,%esp
+    1012:	85 c0                	test   %eax,%eax
+    1014:	79 0a                	jns    1020 <thread_join+0x20>
+    free(*(char**)stack);
+  return pid;
+}
+    1016:	c9                   	leave
+    1017:	c3                   	ret
+    1018:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    101f:	90                   	nop
+    free(*(char**)stack);
+    1020:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1023:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1026:	83 ec 0c             	sub    $0xc,%esp
+    1029:	ff 32                	push   (%edx)
+    102b:	e8 f0 fd ff ff       	call   e20 <free>
+    1030:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1033:	83 c4 10             	add    $0x10,%esp
+}
+    1036:	c9                   	leave
+    1037:	c3                   	ret
@@ -0,0 +1,55 @@
+// Measure pipe bandwidth: a child writes TOTAL bytes into a
+// pipe in chunks of a given size while the parent reads them,
+// for several chunk sizes.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+#define TOTAL (8*1024*1024)
+
+char buf[16384];
+
+void
+run(int chunk)
+{
+  int p[2], n, got, t0, t, s0;
+
+  if(pipe(p) < 0){
+    printf(1, "pipebench: pipe failed\n");
+    exit();
+  }
+  t0 = uptime();
+  if(fork() == 0){
+    close(p[0]);
+    for(n = 0; n < TOTAL; n += chunk){
+      if(write(p[1], buf, chunk) != chunk){
+        printf(1, "pipebench: write failed\n");
+        exit();
+      }
+    }
+    exit();
+  }
+  close(p[1]);
+  s0 = syscount();
+  for(got = 0; (n = read(p[0], buf, chunk)) > 0; got += n)
+    ;
+  s0 = syscount() - s0 - 1;
+  close(p[0]);
+  wait();
+  t = uptime() - t0;
+  if(got != TOTAL)
+    printf(1, "pipebench: read %d bytes, expected %d\n", got, TOTAL);
+  printf(1, "pipebench: %d byte chunks: %d KB in %d ticks, %d reads\n",
+         chunk, TOTAL/1024, t, s0);
+}
+
+int
+main(int argc, char *argv[])
+{
+  run(64);
+  run(512);
+  run(4096);
+  run(16384);
+  exit();
+}
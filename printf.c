@@ -2,14 +2,99 @@
 #include "stat.h"
 #include "user.h"
 
+// Buffered output.
+//
+// printf() formats into a buffer and hands it to write() in one
+// piece rather than making a system call per character. Output
+// to fd 1 is kept in the stdout buffer: until a newline if fd 1
+// is the console, or until the buffer fills if it is a file or
+// pipe. ulib.c flushes it through flushhook before the process
+// exits, forks, execs, reads, writes or closes a file. Output to
+// other fds is written at the end of each printf() call, so
+// nothing is left behind when they are closed or reused, and
+// fflush() and setvbuf() only apply to fd 1. Threads made by
+// clone() share the stdout buffer under a umutex; this file
+// writes with _write(), which does not flush, as it holds it.
+
+#define BUFSZ 512
+
+struct outbuf {
+  int fd;
+  int mode;       // _IOFBF, _IOLBF, _IONBF, or 0 if not yet chosen
+  int n;          // bytes in buf
+  char buf[BUFSZ];
+  char *str;      // sprintf() destination, or 0
+};
+
+static struct outbuf stdout = { 1 };
+static struct umutex stdoutlock;
+
+static void
+flush(struct outbuf *b)
+{
+  if(b->n > 0)
+    _write(b->fd, b->buf, b->n);
+  b->n = 0;
+}
+
+static void
+flushall(void)
+{
+  umtxlock(&stdoutlock);
+  flush(&stdout);
+  umtxunlock(&stdoutlock);
+}
+
+// Flush buffered output for fd. Only fd 1 is buffered.
+void
+fflush(int fd)
+{
+  if(fd == stdout.fd)
+    flushall();
+}
+
+// Choose how output to fd 1 is buffered.
+void
+setvbuf(int fd, int mode)
+{
+  if(fd != stdout.fd)
+    return;
+  umtxlock(&stdoutlock);
+  flush(&stdout);
+  stdout.mode = mode;
+  flushhook = flushall;
+  umtxunlock(&stdoutlock);
+}
+
+static struct outbuf*
+getstdout(void)
+{
+  struct stat st;
+
+  if(stdout.mode == 0){
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+      stdout.mode = _IOLBF;
+    else
+      stdout.mode = _IOFBF;
+    flushhook = flushall;
+  }
+  return &stdout;
+}
+
 static void
-putc(int fd, char c)
+putc(struct outbuf *b, char c)
 {
-  write(fd, &c, 1);
+  if(b->str){
+    *b->str++ = c;
+    return;
+  }
+  b->buf[b->n++] = c;
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+    flush(b);
 }
 
 static void
-printint(int fd, int xx, int base, int sgn)
+printint(struct outbuf *b, int xx, int base, int sgn)
 {
   static char digits[] = "0123456789ABCDEF";
   char buf[16];
@@ -32,33 +117,32 @@ printint(int fd, int xx, int base, int sgn)
     buf[i++] = '-';
 
   while(--i >= 0)
-    putc(fd, buf[i]);
+    putc(b, buf[i]);
 }
 
-// Print to the given fd. Only understands %d, %x, %p, %s.
-void
-printf(int fd, const char *fmt, ...)
+// Format fmt and the arguments at ap into b.
+// Only understands %d, %x, %p, %s, %c.
+static void
+format(struct outbuf *b, const char *fmt, uint *ap)
 {
   char *s;
   int c, i, state;
-  uint *ap;
 
   state = 0;
-  ap = (uint*)(void*)&fmt + 1;
   for(i = 0; fmt[i]; i++){
     c = fmt[i] & 0xff;
     if(state == 0){
       if(c == '%'){
         state = '%';
       } else {
-        putc(fd, c);
+        putc(b, c);
       }
     } else if(state == '%'){
       if(c == 'd'){
-        printint(fd, *ap, 10, 1);
+        printint(b, *ap, 10, 1);
         ap++;
       } else if(c == 'x' || c == 'p'){
-        printint(fd, *ap, 16, 0);
+        printint(b, *ap, 16, 0);
         ap++;
       } else if(c == 's'){
         s = (char*)*ap;
@@ -66,107 +150,55 @@ printf(int fd, const char *fmt, ...)
         if(s == 0)
           s = "(null)";
         while(*s != 0){
-          putc(fd, *s);
+          putc(b, *s);
           s++;
         }
       } else if(c == 'c'){
-        putc(fd, *ap);
+        putc(b, *ap);
         ap++;
       } else if(c == '%'){
-        putc(fd, c);
+        putc(b, c);
       } else {
         // Unknown % sequence.  Print it to draw attention.
-        putc(fd, '%');
-        putc(fd, c);
+        putc(b, '%');
+        putc(b, c);
       }
       state = 0;
     }
   }
 }
 
-static int
-sprintint(char *str, int xx, int base, int sgn)
+// Print to the given fd. Only understands %d, %x, %p, %s, %c.
+void
+printf(int fd, const char *fmt, ...)
 {
-  static char digits[] = "0123456789ABCDEF";
-  char buf[16];
-  int i, neg, length;
-  uint x;
+  struct outbuf local, *b;
 
-  neg = 0;
-  if(sgn && xx < 0){
-    neg = 1;
-    x = -xx;
+  if(fd == stdout.fd){
+    umtxlock(&stdoutlock);
+    b = getstdout();
   } else {
-    x = xx;
+    local.fd = fd;
+    local.mode = _IONBF;
+    local.n = 0;
+    local.str = 0;
+    b = &local;
   }
-
-  i = 0;
-  do{
-    buf[i++] = digits[x % base];
-  }while((x /= base) != 0);
-  if(neg)
-    buf[i++] = '-';
-  length = i;
-  while(--i >= 0)
-    *str++ = buf[i];
-    // putc(fd, buf[i]);
-  return length;
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+  if(b->mode == _IONBF)
+    flush(b);
+  if(b == &stdout)
+    umtxunlock(&stdoutlock);
 }
 
-// Print to the given buffer. Only understands %d, %x, %p, %s.
+// Print to the given buffer. Only understands %d, %x, %p, %s, %c.
 int
 sprintf(char *str, const char *fmt, ...)
 {
-  char *original_str = str;
-  char *s;
-  int c, i, state;
-  uint *ap;
+  struct outbuf b;
 
-  state = 0;
-  ap = (uint*)(void*)&fmt + 1;
-  for(i = 0; fmt[i]; i++){
-    c = fmt[i] & 0xff;
-    if(state == 0){
-      if(c == '%'){
-        state = '%';
-      } else {
-        *str++ = c;
-        // putc(fd, c);
-      }
-    } else if(state == '%'){
-      if(c == 'd'){
-        str += sprintint(str, *ap, 10, 1);
-        ap++;
-      } else if(c == 'x' || c == 'p'){
-        str += sprintint(str, *ap, 16, 0);
-        ap++;
-      } else if(c == 's'){
-        s = (char*)*ap;
-        ap++;
-        if(s == 0)
-          s = "(null)";
-        while(*s != 0){
-          *str++ = *s;
-          // putc(fd, *s);
-          s++;
-        }
-      } else if(c == 'c'){
-        *str++ = *ap;
-        // putc(fd, *ap);
-        ap++;
-      } else if(c == '%'){
-        *str++ = c;
-        // putc(fd, c);
-      } else {
-        // Unknown % sequence.  Print it to draw attention.
-        *str++ = '%';
-        *str++ = c;
-        // putc(fd, '%');
-        // putc(fd, c);
-      }
-      state = 0;
-    }
-  }
-  *str = '\0';
-  return str - original_str;
+  b.str = str;
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+  *b.str = '\0';
+  return b.str - str;
 }
@@ -4,6 +4,7 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "x86.h"
+#include "traps.h"
 #include "proc.h"
 #include "spinlock.h"
 #define min(a, b) ((a) < (b) ? (a) : (b))
@@ -11,6 +12,7 @@
 struct {
   struct spinlock lock;
   struct proc proc[NPROC];
+  struct vm vm[NPROC];
 } ptable;
 
 static struct proc *initproc;
@@ -20,11 +22,30 @@ extern void forkret(void);
 extern void trapret(void);
 
 static void wakeup1(void *chan);
+static void mtxprio(struct proc *p);
+
+// Futexes: sleep until an int in user memory changes.
+//
+// A futex is named by the physical address of the int, so
+// processes that share the memory share the futex. A waiter
+// checks the int and sleeps under the lock of the futex's hash
+// bucket, which futexwake() also takes, so a wakeup cannot slip
+// in between the check and the sleep. Waiters sleep on the
+// kernel address of the int.
+#define NFUTEXHASH 16
+
+struct {
+  struct spinlock lock[NFUTEXHASH];
+} futextab;
 
 void
 pinit(void)
 {
+  int i;
+
   initlock(&ptable.lock, "ptable");
+  for(i = 0; i < NFUTEXHASH; i++)
+    initlock(&futextab.lock[i], "futex");
 }
 
 // Must be called with interrupts disabled
@@ -90,15 +111,22 @@ found:
   p->state = EMBRYO;
   p->pid = nextpid++;
 
-  p->nice = 15;
+  p->basenice = p->nice = 15;
+  p->held = 0;
+  p->waiting = 0;
+  p->nextwaiter = 0;
   p->ctime = ticks;
+  p->nsyscall = 0;
+  p->pinall = 0;
   p->sstime = ticks;
   p->estime = ticks;
   p->rutime = 0;
   p->retime = 0;
   p->sltime = 0; 
 
-  p->stacksz = KERNBASE - 2 * PGSIZE;
+  p->vm = 0;
+  p->thread = 0;
+  p->ustack = 0;
 
   release(&ptable.lock);
 
@@ -126,6 +154,237 @@ found:
   return p;
 }
 
+// Allocate memory for a process: an empty struct vm used by
+// one thread, whose page table the caller sets up.
+// A slot is free when no thread uses it and it has no
+// page table left to free.
+struct vm*
+allocvm(void)
+{
+  struct vm *vm;
+
+  acquire(&ptable.lock);
+  for(vm = ptable.vm; vm < &ptable.vm[NPROC]; vm++){
+    if(vm->ref == 0 && vm->pgdir == 0){
+      memset(vm, 0, sizeof(*vm));
+      vm->ref = 1;
+      vm->stacksz = KERNBASE - 2 * PGSIZE;
+      vm->stacklim = STACKLIMIT;
+      vm->stackahead = STACKAHEAD;
+      release(&ptable.lock);
+      return vm;
+    }
+  }
+  release(&ptable.lock);
+  return 0;
+}
+
+// Drop a thread's reference to vm. The last thread
+// to let go unmaps its regions and frees its page table,
+// which it must no longer be running on.
+void
+vmput(struct vm *vm)
+{
+  int last;
+
+  acquire(&ptable.lock);
+  last = --vm->ref == 0;
+  wakeup1(vm);  // vmsole() may be waiting
+  release(&ptable.lock);
+  if(!last)
+    return;
+  // Wait out any swapping out of its pages.
+  vmlock(vm);
+  vmafree(vm);
+  if(vm->pgdir)
+    freevm(vm->pgdir);
+  acquire(&ptable.lock);
+  vm->pgdir = 0;
+  vm->busy = 0;
+  release(&ptable.lock);
+}
+
+// Kill the threads other than p that use vm. They exit when
+// they next return to user space (see trap in trap.c).
+// Caller holds ptable.lock.
+static void
+vmkill(struct vm *vm, struct proc *p)
+{
+  struct proc *q;
+
+  for(q = ptable.proc; q < &ptable.proc[NPROC]; q++){
+    if(q != p && q->vm == vm && q->state != UNUSED && q->state != ZOMBIE){
+      q->killed = 1;
+      if(q->state == SLEEPING)
+        changeprocstate(q, RUNNABLE);
+    }
+  }
+}
+
+// Kill the other threads using the current thread's vm, and
+// wait for them to exit, so that the current thread is the
+// only one left using it; for exec(). The caller must hold
+// no locks they may need to exit. Returns -1 if the current
+// thread is killed meanwhile, as when two threads exec() at
+// once.
+int
+vmsole(void)
+{
+  struct proc *curproc = myproc();
+  struct vm *vm = curproc->vm;
+  struct proc *p;
+
+  acquire(&ptable.lock);
+  vmkill(vm, curproc);
+  while(vm->ref > 1){
+    if(curproc->killed){
+      release(&ptable.lock);
+      return -1;
+    }
+    sleep(vm, &ptable.lock);
+  }
+  // The new program will not join() them; init reaps them.
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    if(p->parent == curproc && p->thread){
+      p->parent = initproc;
+      p->thread = 0;
+      if(p->state == ZOMBIE)
+        wakeup1(initproc);
+    }
+  }
+  release(&ptable.lock);
+  return 0;
+}
+
+// Serialize changes to vm's mappings among its threads.
+// May sleep, so the caller must not hold spin locks.
+void
+vmlock(struct vm *vm)
+{
+  acquire(&ptable.lock);
+  while(vm->busy)
+    sleep(vm, &ptable.lock);
+  vm->busy = myproc();
+  release(&ptable.lock);
+}
+
+void
+vmunlock(struct vm *vm)
+{
+  acquire(&ptable.lock);
+  vm->busy = 0;
+  wakeup1(vm);
+  release(&ptable.lock);
+}
+
+// Take vmlock() on ptable.vm[i] without waiting, for swapping out
+// its pages, and return it; set *held if the current thread held
+// it already. Returns 0 if the vm is busy with another thread
+// or running on another CPU; see swap.c.
+struct vm*
+vmtrylock(int i, int *held)
+{
+  struct vm *vm;
+  struct cpu *c;
+
+  vm = &ptable.vm[i];
+  acquire(&ptable.lock);
+  if(vm->ref == 0 || vm->pgdir == 0 ||
+     (vm->busy && vm->busy != myproc()))
+    goto busy;
+  for(c = cpus; c < &cpus[ncpu]; c++)
+    if(c != mycpu() && c->pgdir == vm->pgdir)
+      goto busy;
+  *held = vm->busy != 0;
+  vm->busy = myproc();
+  release(&ptable.lock);
+  return vm;
+
+busy:
+  release(&ptable.lock);
+  return 0;
+}
+
+// Keep the pages of user memory [va, va+n) in until the current
+// system call returns, so the kernel may use them under a spin
+// lock; see swap.c. The ranges live in the vm, shared by all its
+// threads. When they run out, a thread that has one widens it;
+// one that has none pins the whole vm until unpin().
+void
+pin(uint va, uint n)
+{
+  struct proc *p = myproc();
+  struct vm *vm = p->vm;
+  struct pin *pn, *mine, *free;
+  uint start, end;
+
+  start = PGROUNDDOWN(va);
+  if(va >= KERNBASE || n > KERNBASE - va)
+    end = KERNBASE;
+  else
+    end = PGROUNDUP(va + n);
+  if(start >= end)
+    return;
+  acquire(&ptable.lock);
+  mine = free = 0;
+  for(pn = vm->pin; pn < &vm->pin[NPIN]; pn++){
+    if(pn->proc == p)
+      mine = pn;
+    else if(pn->proc == 0 && free == 0)
+      free = pn;
+  }
+  if(free){
+    free->proc = p;
+    free->va = start;
+    free->end = end;
+  } else if(mine){
+    if(start < mine->va)
+      mine->va = start;
+    if(end > mine->end)
+      mine->end = end;
+  } else if(!p->pinall){
+    p->pinall = 1;
+    vm->pinall++;
+  }
+  release(&ptable.lock);
+}
+
+// Drop the pins of p's system call.
+void
+unpin(struct proc *p)
+{
+  struct vm *vm = p->vm;
+  struct pin *pn;
+
+  if(vm == 0)
+    return;
+  acquire(&ptable.lock);
+  for(pn = vm->pin; pn < &vm->pin[NPIN]; pn++)
+    if(pn->proc == p)
+      pn->proc = 0;
+  if(p->pinall){
+    p->pinall = 0;
+    vm->pinall--;
+  }
+  release(&ptable.lock);
+}
+
+// Does a thread of vm in a system call have any of the pages
+// in [va, va+n) pinned?
+int
+vmpinned(struct vm *vm, uint va, uint n)
+{
+  struct pin *pn;
+  int r;
+
+  acquire(&ptable.lock);
+  r = vm->pinall > 0;
+  for(pn = vm->pin; pn < &vm->pin[NPIN] && !r; pn++)
+    r = pn->proc && va < pn->end && va + n > pn->va;
+  release(&ptable.lock);
+  return r;
+}
+
 //PAGEBREAK: 32
 // Set up first user process.
 void
@@ -137,10 +396,10 @@ userinit(void)
   p = allocproc();
   
   initproc = p;
-  if((p->pgdir = setupkvm()) == 0)
+  if((p->vm = allocvm()) == 0 || (p->vm->pgdir = setupkvm()) == 0)
     panic("userinit: out of memory?");
-  inituvm(p->pgdir, _binary_initcode_start, (int)_binary_initcode_size);
-  p->sz = PGSIZE;
+  inituvm(p->vm->pgdir, _binary_initcode_start, (int)_binary_initcode_size);
+  p->vm->sz = PGSIZE;
   memset(p->tf, 0, sizeof(*p->tf));
   p->tf->cs = (SEG_UCODE << 3) | DPL_USER;
   p->tf->ds = (SEG_UDATA << 3) | DPL_USER;
@@ -151,7 +410,7 @@ userinit(void)
   p->tf->eip = 0;  // beginning of initcode.S
 
   safestrcpy(p->name, "initcode", sizeof(p->name));
-  p->cwd = namei("/");
+  p->files = filesalloc(namei("/"));
 
   // this assignment to p->state lets other cores
   // run this process. the acquire forces the above
@@ -165,35 +424,129 @@ userinit(void)
 }
 
 // Grow current process's memory by n bytes.
-// Return 0 on success, -1 on failure.
+// Return the old size on success, -1 on failure.
 int
 growproc(int n)
 {
-  uint sz;
-  struct proc *curproc = myproc();
+  uint sz, oldsz;
+  struct vm *vm = myproc()->vm;
 
-  sz = curproc->sz;
+  vmlock(vm);
+  sz = oldsz = vm->sz;
   if(n > 0){
-    if((sz = allocuvm(curproc->pgdir, sz, sz + n)) == 0)
+    // Leave a guard page below the stack.
+    if(sz + n < sz || sz + n > vm->stacksz - PGSIZE ||
+       vmaoverlap(myproc(), sz, sz + n) ||
+       (sz = allocuvm(vm->pgdir, sz, sz + n)) == 0){
+      vmunlock(vm);
       return -1;
+    }
   } else if(n < 0){
-    if((sz = deallocuvm(curproc->pgdir, sz, sz + n)) == 0)
+    // Not into the program's text.
+    if(vmaoverlap(myproc(), sz + n, sz) ||
+       (sz = deallocuvm(vm->pgdir, sz, sz + n)) == 0){
+      vmunlock(vm);
       return -1;
+    }
   }
-  curproc->sz = sz;
-  switchuvm(curproc);
+  vm->sz = sz;
+  vmunlock(vm);
+  return oldsz;
+}
+
+// Grow curproc's stack down over va, after a fault there, and
+// stackahead pages further so that deeper calls do not each
+// fault. The stack may not grow past its limit, nor to within
+// a guard page of the heap or a mapped region. Returns -1 if
+// va lies outside its reach or memory runs out.
+int
+growstack(uint va)
+{
+  struct proc *curproc = myproc();
+  struct vm *vm = curproc->vm;
+  uint floor, low;
+
+  if(va >= KERNBASE - PGSIZE)
+    return -1;
+  vmlock(vm);
+  if(va >= vm->stacksz){
+    // Another thread grew the stack first.
+    vmunlock(vm);
+    return 0;
+  }
+  floor = KERNBASE - PGSIZE - vm->stacklim;
+  if(floor < PGROUNDUP(vm->sz) + PGSIZE)
+    floor = PGROUNDUP(vm->sz) + PGSIZE;
+  va = PGROUNDDOWN(va);
+  if(va < floor || vmaoverlap(curproc, va - PGSIZE, vm->stacksz)){
+    vmunlock(vm);
+    return -1;
+  }
+  low = va - floor > vm->stackahead*PGSIZE ? va - vm->stackahead*PGSIZE : floor;
+  if(vmaoverlap(curproc, low - PGSIZE, va))
+    low = va;
+  if(allocuvm(vm->pgdir, low, vm->stacksz) == 0){
+    vmunlock(vm);
+    return -1;
+  }
+  vm->stacksz = low;
+  vmunlock(vm);
+  return 0;
+}
+
+// Set the most bytes curproc's stack may grow to, and the
+// pages it grows past each fault, leaving either alone if
+// negative. Returns -1 if the stack is already bigger than
+// max, or either is too big for the address space.
+int
+stacklimit(int max, int ahead)
+{
+  struct vm *vm = myproc()->vm;
+
+  vmlock(vm);
+  if(max >= 0){
+    if(max < KERNBASE - PGSIZE - vm->stacksz || max > KERNBASE - 2*PGSIZE){
+      vmunlock(vm);
+      return -1;
+    }
+    vm->stacklim = PGROUNDUP(max);
+  }
+  if(ahead > KERNBASE / PGSIZE){
+    vmunlock(vm);
+    return -1;
+  }
+  if(ahead >= 0)
+    vm->stackahead = ahead;
+  vmunlock(vm);
   return 0;
 }
 
+// Give np what fork() and clone() both pass on from curproc:
+// its open files and working directory, shared with a thread,
+// and its name, priority and parent.
+static void
+inherit(struct proc *np, struct proc *curproc, int thread)
+{
+  if(thread)
+    np->files = filesdup(curproc->files);
+  else
+    np->files = filescopy(curproc->files);
+
+  safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+  np->basenice = np->nice = curproc->basenice;
+  np->parent = curproc;
+}
+
 // Create a new process copying p as the parent.
 // Sets up stack to return as if from system call.
 // Caller must set state of returned proc to RUNNABLE.
 int
 fork(void)
 {
-  int i, pid;
+  int pid;
   struct proc *np;
   struct proc *curproc = myproc();
+  struct vm *vm = curproc->vm;
 
   // Allocate process.
   if((np = allocproc()) == 0){
@@ -201,29 +554,89 @@ fork(void)
   }
 
   // Copy process state from proc.
-  if((np->pgdir = copyuvm(curproc->pgdir, curproc->sz, curproc->stacksz)) == 0){
+  if((np->vm = allocvm()) == 0){
     kfree(np->kstack);
     np->kstack = 0;
     np->state = UNUSED;
     return -1;
   }
-  np->sz = curproc->sz;
-  np->parent = curproc;
+  vmlock(vm);
+  np->vm->pgdir = copyuvm(vm->pgdir, vm->sz, vm->stacksz);
+  if(np->vm->pgdir == 0 || vmacopy(np, curproc) < 0){
+    vmunlock(vm);
+    vmput(np->vm);
+    np->vm = 0;
+    kfree(np->kstack);
+    np->kstack = 0;
+    np->state = UNUSED;
+    return -1;
+  }
+  np->vm->sz = vm->sz;
+  np->vm->stacksz = vm->stacksz;
+  np->vm->stacklim = vm->stacklim;
+  np->vm->stackahead = vm->stackahead;
+  vmunlock(vm);
   *np->tf = *curproc->tf;
 
   // Clear %eax so that fork returns 0 in the child.
   np->tf->eax = 0;
 
-  for(i = 0; i < NOFILE; i++)
-    if(curproc->ofile[i])
-      np->ofile[i] = filedup(curproc->ofile[i]);
-  np->cwd = idup(curproc->cwd);
-
-  safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+  inherit(np, curproc, 0);
 
   pid = np->pid;
 
-  np->nice = curproc->nice;
+  acquire(&ptable.lock);
+
+  changeprocstate(np, RUNNABLE);
+
+  release(&ptable.lock);
+
+  return pid;
+}
+
+// Create a thread: a process that shares curproc's memory,
+// open files and working directory, and starts in
+// fcn(arg1, arg2) on the page-sized user stack at stack.
+// It is reaped by join() rather than wait().
+int
+clone(uint fcn, uint arg1, uint arg2, uint stack)
+{
+  int pid;
+  uint ustack[3];
+  struct proc *np;
+  struct proc *curproc = myproc();
+
+  if(stack % PGSIZE != 0)
+    return -1;
+  if((np = allocproc()) == 0)
+    return -1;
+
+  // A fake return PC, then the arguments.
+  ustack[0] = 0xffffffff;
+  ustack[1] = arg1;
+  ustack[2] = arg2;
+  if(swapload(curproc->vm, stack + PGSIZE - sizeof(ustack), sizeof(ustack)) < 0 ||
+     copyoutuvm(curproc->vm->pgdir, stack + PGSIZE - sizeof(ustack),
+                ustack, sizeof(ustack)) < 0){
+    kfree(np->kstack);
+    np->kstack = 0;
+    np->state = UNUSED;
+    return -1;
+  }
+
+  acquire(&ptable.lock);
+  curproc->vm->ref++;
+  release(&ptable.lock);
+  np->vm = curproc->vm;
+  np->thread = 1;
+  np->ustack = stack;
+  *np->tf = *curproc->tf;
+  np->tf->eip = fcn;
+  np->tf->esp = stack + PGSIZE - sizeof(ustack);
+
+  inherit(np, curproc, 1);
+
+  pid = np->pid;
 
   acquire(&ptable.lock);
 
@@ -237,28 +650,40 @@ fork(void)
 // Exit the current process.  Does not return.
 // An exited process remains in the zombie state
 // until its parent calls wait() to find out it exited.
+// A process kills the threads it made on the way out;
+// a thread exits alone.
 void
 exit(void)
 {
   struct proc *curproc = myproc();
   struct proc *p;
-  int fd;
+  struct vm *vm;
 
   if(curproc == initproc)
     panic("init exiting");
 
-  // Close all open files.
-  for(fd = 0; fd < NOFILE; fd++){
-    if(curproc->ofile[fd]){
-      fileclose(curproc->ofile[fd]);
-      curproc->ofile[fd] = 0;
-    }
+  if(!curproc->thread){
+    acquire(&ptable.lock);
+    vmkill(curproc->vm, curproc);
+    release(&ptable.lock);
   }
 
-  begin_op();
-  iput(curproc->cwd);
-  end_op();
-  curproc->cwd = 0;
+  // Hand held mutexes to their waiters.
+  mtxexit(curproc);
+
+  // Let go of memory, switching to kpgdir first in case this
+  // is the last thread and its page table is freed. Unmapping
+  // regions writes back shared file pages.
+  unpin(curproc);
+  vm = curproc->vm;
+  curproc->vm = 0;
+  switchuvm(curproc);
+  vmput(vm);
+
+  // Close all open files, if no thread still uses them.
+  fdput(curproc);
+  filesput(curproc->files);
+  curproc->files = 0;
 
   acquire(&ptable.lock);
 
@@ -269,6 +694,7 @@ exit(void)
   for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
     if(p->parent == curproc){
       p->parent = initproc;
+      p->thread = 0;
       if(p->state == ZOMBIE)
         wakeup1(initproc);
     }
@@ -280,10 +706,11 @@ exit(void)
   panic("zombie exit");
 }
 
-// Wait for a child process to exit and return its pid.
-// Return -1 if this process has no children.
-int
-wait(void)
+// Wait for a child made by fork(), or by clone() if thread is
+// set, to exit, and return its pid. Return -1 if this process
+// has no such children. A thread's user stack goes in *ustack.
+static int
+reap(int thread, uint *ustack)
 {
   struct proc *p;
   int havekids, pid;
@@ -294,7 +721,7 @@ wait(void)
     // Scan through table looking for exited children.
     havekids = 0;
     for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(p->parent != curproc)
+      if(p->parent != curproc || p->thread != thread)
         continue;
       havekids = 1;
       if(p->state == ZOMBIE){
@@ -304,13 +731,15 @@ wait(void)
         cprintf("pid%d SLEEPING ticks: %d\n", pid, p->sltime);
         cprintf("pid%d RUNNABLE(wait) ticks: %d\n", pid, p->retime);
         cprintf("pid%d turnaround ticks: %d\n", pid, p->etime - p->ctime);
+        if(ustack)
+          *ustack = p->ustack;
         kfree(p->kstack);
         p->kstack = 0;
-        freevm(p->pgdir);
         p->pid = 0;
         p->parent = 0;
         p->name[0] = 0;
         p->killed = 0;
+        p->thread = 0;
         p->state = UNUSED;
         release(&ptable.lock);
         return pid;
@@ -328,6 +757,23 @@ wait(void)
   }
 }
 
+// Wait for a child process to exit and return its pid.
+// Return -1 if this process has no children.
+int
+wait(void)
+{
+  return reap(0, 0);
+}
+
+// Wait for a thread made by clone() to exit and return
+// its pid, with the user stack it was given in *ustack.
+// Return -1 if this process has no threads.
+int
+join(uint *ustack)
+{
+  return reap(1, ustack);
+}
+
 int nice(int pid, int inc)
 {
   struct proc *currproc = myproc();
@@ -359,19 +805,21 @@ int nice(int pid, int inc)
     return p->nice;
   }
 
-  // change the process's nice value
-  if (p->nice + inc > 31)
+  // change the process's own nice value; its effective
+  // nice may stay lower while it holds a contended mutex
+  if (p->basenice + inc > 31)
   {
-    p->nice = 31;
+    p->basenice = 31;
   }
-  else if (p->nice + inc < 0)
+  else if (p->basenice + inc < 0)
   {
-    p->nice = 0;
+    p->basenice = 0;
   }
   else
   {
-    p->nice += inc;
+    p->basenice += inc;
   }
+  mtxprio(p);
 
   // if the priority becomes lower than any process on the ready list, switch to that process
   int min_nice = currproc->nice;
@@ -402,6 +850,51 @@ int nice(int pid, int inc)
 }
 
 //PAGEBREAK: 42
+// Get a CPU halted in scheduler() to look for work again,
+// now that a process is RUNNABLE. Caller must hold ptable.lock.
+static void
+wakeidle(void)
+{
+  struct cpu *c;
+
+  if(mycpu()->idle){
+    // An interrupt on a CPU about to halt: it can just not.
+    mycpu()->idle = 0;
+    return;
+  }
+  for(c = cpus; c < &cpus[ncpu]; c++){
+    if(c->idle){
+      c->idle = 0;
+      lapicipi(c->apicid, T_IRQ0 + IRQ_WAKEUP);
+      return;
+    }
+  }
+}
+
+// Halt this CPU until an interrupt, which interrupts must be
+// off for. Unless tick is set, the timer interrupt stops too;
+// then on CPU 0, which counts ticks, catch up on the ticks
+// that went by.
+static void
+halt(int tick)
+{
+  int n;
+
+  if(!tick)
+    lapicstoptick();
+  stihlt();
+  if(tick)
+    return;
+  cli();
+  n = lapicstarttick();
+  if(cpuid() == 0 && n > 0){
+    acquire(&tickslock);
+    ticks += n;
+    wakeup(&ticks);
+    release(&tickslock);
+  }
+}
+
 // Per-CPU process scheduler.
 // Each CPU calls scheduler() after setting itself up.
 // Scheduler never returns.  It loops, doing:
@@ -416,18 +909,21 @@ scheduler(void)
   struct proc *pp;
   struct cpu *c = mycpu();
   double cur_nice;
+  int timed;
   c->proc = 0;
   
   for(;;){
     // Enable interrupts on this processor.
     sti();
-    if (c->apicid != 0) continue; // lock other cpu for debug
     // Loop over process table looking for process to run.
     acquire(&ptable.lock);
     double min_nice = 32.0;
     pp = (void *)0;
+    timed = 0;
     for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
     {
+      if(p->state == SLEEPING && p->chan == &ticks)
+        timed = 1;
       if(p->state != RUNNABLE)
         continue;
       cur_nice = (double)p->nice - (double)(ticks - p->sstime) / 20.0;
@@ -442,19 +938,34 @@ scheduler(void)
       // Switch to chosen process.  It is the process's job
       // to release ptable.lock and then reacquire it
       // before jumping back to us.
-      // cprintf("scheduler() on cpu%d: run %d\n", c->apicid, pp->pid); // debug
       c->proc = pp;
       switchuvm(pp);
       changeprocstate(pp, RUNNING);
 
       swtch(&(c->scheduler), pp->context);
-      switchkvm();
+      // Stay on pp's page table, which maps the kernel like
+      // any other, so that running pp again costs no cr3 load.
+      // (An exiting process has already left its own.)
 
       // Process is done running for now.
       // It should have changed its p->state before coming back.
       c->proc = 0;
+      release(&ptable.lock);
+    } else {
+      // Nothing to run: get pages ready for kzalloc(), or else
+      // halt until an interrupt, or wakeidle(), brings work.
+      // Once c->idle is set under ptable.lock, a process made
+      // RUNNABLE clears it, and sends an IPI if c may be halted.
+      // Keep the timer going if a process is in sleep().
+      c->idle = 1;
+      release(&ptable.lock);
+      if(!kzero()){
+        cli();
+        if(c->idle)
+          halt(timed);
+      }
+      c->idle = 0;
     }
-    release(&ptable.lock);
 
   }
 }
@@ -530,6 +1041,8 @@ changeprocstate(struct proc *p, int to)
     curproc->etime = ticks;
   }
   curproc->state = to;
+  if(to == RUNNABLE)
+    wakeidle();
 }
 
 // Give up the CPU for one scheduling round.
@@ -558,6 +1071,7 @@ forkret(void)
     first = 0;
     iinit(ROOTDEV);
     initlog(ROOTDEV);
+    swapinit(ROOTDEV);
   }
 
   // Return to "caller", actually trapret (see allocproc).
@@ -624,7 +1138,8 @@ wakeup(void *chan)
   release(&ptable.lock);
 }
 
-// Kill the process with the given pid.
+// Kill the process with the given pid, and the threads
+// that share its memory.
 // Process won't exit until it returns
 // to user space (see trap in trap.c).
 int
@@ -635,6 +1150,8 @@ kill(int pid)
   acquire(&ptable.lock);
   for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
     if(p->pid == pid){
+      if(p->vm)
+        vmkill(p->vm, p);
       p->killed = 1;
       // Wake process from sleep if necessary.
       if(p->state == SLEEPING)
@@ -684,101 +1201,279 @@ procdump(void)
   }
 }
 
-struct mutex
-{
-  int value;
-  struct spinlock lock;
-  struct proc *queue[NPROC];
-  struct proc *curproc;
-  int curnice, orinice;
-  int start;
-  int end;
+//PAGEBREAK!
+// Kernel mutexes with priority inheritance.
+//
+// A process waiting for a mutex lends its priority to the
+// holder: a process's nice is the lowest of its own, basenice,
+// and the nice of every process waiting for a mutex it holds.
+// Donation follows chains: if the holder is itself waiting for
+// a mutex, what it inherits passes on to that mutex's holder.
+// Each process lists the mutexes it holds, so releasing them
+// in any order recomputes its nice from the ones it still
+// holds. Release hands the mutex to the most urgent waiter,
+// first come first served among equals.
+//
+// ptable.lock guards all mutex state, since the scheduler
+// reads nice under it.
+
+struct mutex {
   int used;
+  struct proc *owner;        // Holder, or 0
+  struct proc *waiters;      // Waiting processes, linked by nextwaiter
+  struct mutex *nextheld;    // Next mutex in owner's held list
 };
-struct mutex mutexs[100];
+struct mutex mutexs[NMUTEX];
 
-int mtxget(void)
+// Return p's nice with what it inherits from the
+// waiters for the mutexes it holds.
+static int
+mtxnice(struct proc *p)
 {
   struct mutex *s;
-  for (int i = 0; i < 100; i++)
-  {
-    s = &mutexs[i];
-    if (!s->used)
-    {
-      s->value = 1;
-      initlock(&s->lock, "mutex_lock");
-      s->end = s->start = 0;
+  struct proc *w;
+  int n;
+
+  n = p->basenice;
+  for(s = p->held; s; s = s->nextheld)
+    for(w = s->waiters; w; w = w->nextwaiter)
+      if(w->nice < n)
+        n = w->nice;
+  return n;
+}
+
+// Recompute p's nice, and pass a change on along the
+// chain of holders that p waits for. The chain is cut
+// off after NPROC steps in case the waits deadlock.
+static void
+mtxprio(struct proc *p)
+{
+  int i, n;
+
+  for(i = 0; p && i < NPROC; i++){
+    n = mtxnice(p);
+    if(n == p->nice)
+      break;
+    p->nice = n;
+    p = p->waiting ? p->waiting->owner : 0;
+  }
+}
+
+// Take s off its holder's list and give it to the most
+// urgent waiter, if any. Returns the new holder, or 0.
+static struct proc*
+mtxhandoff(struct mutex *s)
+{
+  struct proc *p, *w, **pp, **best;
+  struct mutex **sp;
+
+  p = s->owner;
+  for(sp = &p->held; *sp != s; sp = &(*sp)->nextheld)
+    ;
+  *sp = s->nextheld;
+  s->nextheld = 0;
+  s->owner = 0;
+
+  best = 0;
+  for(pp = &s->waiters; *pp; pp = &(*pp)->nextwaiter)
+    if(best == 0 || (*pp)->nice < (*best)->nice)
+      best = pp;
+  w = 0;
+  if(best){
+    w = *best;
+    *best = w->nextwaiter;
+    w->nextwaiter = 0;
+    w->waiting = 0;
+    s->owner = w;
+    s->nextheld = w->held;
+    w->held = s;
+    mtxprio(w);
+    if(w->state == SLEEPING && w->chan == s)
+      changeprocstate(w, RUNNABLE);
+  }
+  mtxprio(p);
+  return w;
+}
+
+int
+mtxget(void)
+{
+  struct mutex *s;
+
+  acquire(&ptable.lock);
+  for(s = mutexs; s < &mutexs[NMUTEX]; s++){
+    if(!s->used){
+      memset(s, 0, sizeof(*s));
       s->used = 1;
-      return i;
+      release(&ptable.lock);
+      return s - mutexs;
     }
   }
+  release(&ptable.lock);
   return -1;
 }
 
-int mtxacq(int n)
+int
+mtxacq(int n)
 {
-  if (n < 0 || n > 100 || !mutexs[n].used)
-  {
+  struct proc *p = myproc();
+  struct proc **pp;
+  struct mutex *s;
+
+  if(n < 0 || n >= NMUTEX)
+    return -1;
+  s = &mutexs[n];
+  acquire(&ptable.lock);
+  if(!s->used || s->owner == p){
+    release(&ptable.lock);
     return -1;
   }
-  struct mutex *s = &mutexs[n];
-  acquire(&s->lock);
-  s->value--;
-  if (s->value < 0)
-  {
-    s->queue[s->end] = myproc();
-    s->end = (s->end + 1) % NPROC;
-    if (s->curnice > myproc()->nice)
-    {
-      nice(s->curproc->pid, myproc()->nice - s->curnice);
-      s->curnice = s->curproc->nice;
-      cprintf("priority donate %d nice to %d\n", s->curproc->pid, s->curnice);
+  if(s->owner == 0){
+    s->owner = p;
+    s->nextheld = p->held;
+    p->held = s;
+    release(&ptable.lock);
+    return 0;
+  }
+
+  for(pp = &s->waiters; *pp; pp = &(*pp)->nextwaiter)
+    ;
+  *pp = p;
+  p->waiting = s;
+  mtxprio(s->owner);
+  while(s->owner != p){
+    if(p->killed){
+      for(pp = &s->waiters; *pp != p; pp = &(*pp)->nextwaiter)
+        ;
+      *pp = p->nextwaiter;
+      p->nextwaiter = 0;
+      p->waiting = 0;
+      mtxprio(s->owner);
+      release(&ptable.lock);
+      return -1;
     }
-    sleep(myproc(), &s->lock);
+    sleep(s, &ptable.lock);
   }
-  s->curproc = myproc();
-  s->curnice = myproc()->nice;
-  s->orinice = s->curnice;
-  // cprintf("%d %d %d\n",s->curproc->pid,s->curnice,s->orinice);
-  
-  release(&s->lock);
+  release(&ptable.lock);
   return 0;
 }
 
-int mtxrel(int n)
+int
+mtxrel(int n)
 {
-  if (n < 0 || n > 100 || !mutexs[n].used)
-  {
+  struct proc *p = myproc();
+  struct proc *w;
+  struct mutex *s;
+  int preempt;
+
+  if(n < 0 || n >= NMUTEX)
+    return -1;
+  s = &mutexs[n];
+  acquire(&ptable.lock);
+  if(!s->used || s->owner != p){
+    release(&ptable.lock);
     return -1;
   }
-  struct mutex *s = &mutexs[n];
-  acquire(&s->lock);
-  s->value++;
-  if (s->value <= 0)
-  {
-    wakeup(s->queue[s->start]);
-    s->queue[s->start] = 0;
-    s->start = (s->start + 1) % NPROC;
-  }
-  //cprintf("%d %d %d\n",s->curproc->pid, s->curnice, s->orinice);
-  if (s->orinice - s->curnice > 0)
-  {
-    nice(s->curproc->pid, s->orinice - s->curnice);
-    s->curnice = s->orinice;
-    cprintf("priority drop %d original nice %d\n", s->curproc->pid, s->curnice);
-  }
+  w = mtxhandoff(s);
+  preempt = w && w->nice < p->nice;
+  release(&ptable.lock);
+  // Let a more urgent new holder run now.
+  if(preempt)
+    yield();
+  return 0;
+}
+
+int
+mtxdel(int n)
+{
+  struct mutex *s;
 
-  release(&s->lock);
+  if(n < 0 || n >= NMUTEX)
+    return -1;
+  s = &mutexs[n];
+  acquire(&ptable.lock);
+  if(!s->used || s->owner || s->waiters){
+    release(&ptable.lock);
+    return -1;
+  }
+  memset(s, 0, sizeof(*s));
+  release(&ptable.lock);
   return 0;
 }
 
-int mtxdel(int n)
+// Release the mutexes held by exiting process p.
+void
+mtxexit(struct proc *p)
 {
-  if (n < 0 || n > 100 || !mutexs[n].used)
-  {
+  acquire(&ptable.lock);
+  while(p->held)
+    mtxhandoff(p->held);
+  release(&ptable.lock);
+}
+
+// Return the kernel address of the int at user address addr,
+// faulting its page in, or 0 if it is not user memory.
+static int*
+futexaddr(uint addr)
+{
+  char *page;
+
+  if(addr % 4 != 0 || checkptr(addr, 4) < 0)
+    return 0;
+  if((page = uva2ka(myproc()->vm->pgdir, (char*)PGROUNDDOWN(addr))) == 0)
+    return 0;
+  return (int*)(page + addr % PGSIZE);
+}
+
+static struct spinlock*
+futexlock(int *kaddr)
+{
+  return &futextab.lock[(V2P(kaddr) / 4) % NFUTEXHASH];
+}
+
+// Sleep until woken by futexwake(), if the int at addr
+// holds val. Returns -1 at once if it does not.
+int
+futexwait(uint addr, int val)
+{
+  struct spinlock *lk;
+  int *kaddr;
+
+  if((kaddr = futexaddr(addr)) == 0)
+    return -1;
+  lk = futexlock(kaddr);
+  acquire(lk);
+  if(*kaddr != val){
+    release(lk);
     return -1;
   }
-  struct mutex *s = &mutexs[n];
-  memset(s, 0, sizeof(struct mutex));
+  sleep(kaddr, lk);
+  release(lk);
   return 0;
 }
+
+// Wake up to n processes waiting on the int at addr.
+// Returns the number woken.
+int
+futexwake(uint addr, int n)
+{
+  struct spinlock *lk;
+  struct proc *p;
+  int *kaddr, nwoken;
+
+  if((kaddr = futexaddr(addr)) == 0)
+    return -1;
+  lk = futexlock(kaddr);
+  nwoken = 0;
+  acquire(lk);
+  acquire(&ptable.lock);
+  for(p = ptable.proc; p < &ptable.proc[NPROC] && nwoken < n; p++){
+    if(p->state == SLEEPING && p->chan == kaddr){
+      changeprocstate(p, RUNNABLE);
+      nwoken++;
+    }
+  }
+  release(&ptable.lock);
+  release(lk);
+  return nwoken;
+}
@@ -8,6 +8,10 @@ struct cpu {
   int ncli;                    // Depth of pushcli nesting.
   int intena;                  // Were interrupts enabled before pushcli?
   struct proc *proc;           // The process running on this cpu or null
+  pde_t *pgdir;                // Page table loaded by switchuvm(), or 0
+  volatile int idle;           // Halting in scheduler(); clear to keep it up
+  pde_t * volatile tlbpgdir;   // Page table to forget entries of; see tlbshoot()
+  volatile int tlbdrop;        // Stop using tlbpgdir as well
 };
 
 extern struct cpu cpus[NCPU];
@@ -32,13 +36,45 @@ struct context {
   uint eip;
 };
 
-enum procstate { UNUSED, EMBRYO, SLEEPING, RUNNABLE, RUNNING, ZOMBIE };
+// A region of memory set up by mmap().
+struct vma {
+  uint start;                  // First address, page aligned
+  uint end;                    // Last address + 1; 0 if slot is free
+  int prot;                    // PROT_READ, PROT_WRITE
+  int flags;                   // MAP_SHARED or MAP_PRIVATE
+  struct file *f;              // Mapped file, or 0 for anonymous memory
+  uint off;                    // File offset of start
+  struct shm *shm;             // Mapped shared memory segment, or 0
+  struct inode *ip;            // Program text mapped by exec(), or 0
+};
 
-// Per-process state
-struct proc {
+// A process's memory, shared by the threads that clone() makes.
+// Changes to it are serialized by vmlock().
+// A range of user memory a thread's system call is using; see swap.c.
+struct pin {
+  struct proc *proc;           // Thread that pinned it, or 0 if free
+  uint va;                     // First page
+  uint end;                    // Past the last page
+};
+
+struct vm {
+  int ref;                     // Threads using it
+  struct proc *busy;           // Thread holding vmlock(), or 0
   uint sz;                     // Size of process memory (bytes), not including the stack
   uint stacksz;                // Stack's lowest address
+  uint stacklim;               // Most bytes the stack may grow to
+  uint stackahead;             // Pages to grow the stack past a fault
   pde_t* pgdir;                // Page table
+  struct vma vma[NVMA];        // Regions mapped by mmap()
+  struct pin pin[NPIN];        // Memory its threads' system calls use
+  int pinall;                  // Threads out of pins, pinning it all
+};
+
+enum procstate { UNUSED, EMBRYO, SLEEPING, RUNNABLE, RUNNING, ZOMBIE };
+
+// Per-process state
+struct proc {
+  struct vm *vm;               // Memory, shared with its threads
   char *kstack;                // Bottom of kernel stack for this process
   enum procstate state;        // Process state
   int pid;                     // Process ID
@@ -47,10 +83,18 @@ struct proc {
   struct context *context;     // swtch() here to run process
   void *chan;                  // If non-zero, sleeping on chan
   int killed;                  // If non-zero, have been killed
-  struct file *ofile[NOFILE];  // Open files
-  struct inode *cwd;           // Current directory
+  struct files *files;         // Open files and cwd, shared with its threads
+  struct file *fdref[2];       // Files held for this system call; see fdget()
   char name[16];               // Process name (debugging)
-  int nice;                    // Process priority
+  int nice;                    // Process priority, with any inherited
+  int basenice;                // Priority set by nice()
+  struct mutex *held;          // Kernel mutexes held, linked by nextheld
+  struct mutex *waiting;       // Kernel mutex waited for, or 0
+  struct proc *nextwaiter;     // Next process waiting for the same mutex
+  int thread;                  // Made by clone(); reaped by join()
+  uint ustack;                 // User stack given to clone()
+  uint nsyscall;               // System calls made
+  int pinall;                  // Counted in vm->pinall; see pin()
 
   int ctime;                   // Created time
   int rutime;                  // Running time
@@ -66,3 +110,5 @@ struct proc {
 //   original data and bss
 //   fixed-size stack
 //   expandable heap
+// mmap() regions start at MMAPBASE, between the heap and the
+// stack, which grows down from KERNBASE-PGSIZE.
@@ -0,0 +1,2391 @@
+
+_psumbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <sum>:
+uint part[MAXT];
+int nthread;
+
+void
+sum(void *arg)
+{
+       0:	55                   	push   %ebp
+  int t, i, pass, lo, hi;
+  uint s;
+
+  t = (int)arg;
+  lo = N / nthread * t;
+       1:	b8 00 00 40 00       	mov    $0x400000,%eax
+       6:	31 d2                	xor    %edx,%edx
+{
+       8:	89 e5                	mov    %esp,%ebp
+       a:	57                   	push   %edi
+       b:	56                   	push   %esi
+       c:	53                   	push   %ebx
+       d:	83 ec 04             	sub    $0x4,%esp
+  lo = N / nthread * t;
+      10:	8b 7d 08             	mov    0x8(%ebp),%edi
+      13:	f7 3d 20 22 00 00    	idivl  0x2220
+  hi = lo + N / nthread;
+  s = 0;
+      19:	31 d2                	xor    %edx,%edx
+  lo = N / nthread * t;
+      1b:	0f af f8             	imul   %eax,%edi
+  hi = lo + N / nthread;
+      1e:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  for(pass = 0; pass < NPASS; pass++)
+    for(i = lo; i < hi; i++)
+      s += a[i];
+      21:	a1 60 22 00 00       	mov    0x2260,%eax
+      26:	8d 1c b8             	lea    (%eax,%edi,4),%ebx
+      29:	8d 0c b0             	lea    (%eax,%esi,4),%ecx
+      2c:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+      2f:	bb 08 00 00 00       	mov    $0x8,%ebx
+      34:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    for(i = lo; i < hi; i++)
+      38:	8b 45 f0             	mov    -0x10(%ebp),%eax
+      3b:	39 f7                	cmp    %esi,%edi
+      3d:	7d 0a                	jge    49 <sum+0x49>
+      3f:	90                   	nop
+      s += a[i];
+      40:	03 10                	add    (%eax),%edx
+    for(i = lo; i < hi; i++)
+      42:	83 c0 04             	add    $0x4,%eax
+      45:	39 c8                	cmp    %ecx,%eax
+      47:	75 f7                	jne    40 <sum+0x40>
+  for(pass = 0; pass < NPASS; pass++)
+      49:	83 eb 01             	sub    $0x1,%ebx
+      4c:	75 ea                	jne    38 <sum+0x38>
+  part[t] = s;
+      4e:	8b 45 08             	mov    0x8(%ebp),%eax
+      51:	89 14 85 40 22 00 00 	mov    %edx,0x2240(,%eax,4)
+}
+      58:	83 c4 04             	add    $0x4,%esp
+      5b:	5b                   	pop    %ebx
+      5c:	5e                   	pop    %esi
+      5d:	5f                   	pop    %edi
+      5e:	5d                   	pop    %ebp
+      5f:	c3                   	ret
+
+00000060 <main>:
+
+int
+main(int argc, char *argv[])
+{
+      60:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+      64:	83 e4 f0             	and    $0xfffffff0,%esp
+      67:	ff 71 fc             	push   -0x4(%ecx)
+      6a:	55                   	push   %ebp
+      6b:	89 e5                	mov    %esp,%ebp
+      6d:	57                   	push   %edi
+      6e:	56                   	push   %esi
+      6f:	53                   	push   %ebx
+      70:	51                   	push   %ecx
+      71:	83 ec 24             	sub    $0x24,%esp
+  int i, t, t0, ticks, base;
+  uint s, expect;
+
+  if((a = malloc(N * sizeof(int))) == 0){
+      74:	68 00 00 00 01       	push   $0x1000000
+      79:	e8 32 0e 00 00       	call   eb0 <malloc>
+      7e:	83 c4 10             	add    $0x10,%esp
+      81:	a3 60 22 00 00       	mov    %eax,0x2260
+      86:	85 c0                	test   %eax,%eax
+      88:	0f 84 5b 01 00 00    	je     1e9 <main+0x189>
+    printf(1, "psumbench: malloc failed\n");
+    exit();
+  }
+  expect = 0;
+  for(i = 0; i < N; i++){
+    a[i] = i;
+      8e:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    expect += i;
+      94:	31 d2                	xor    %edx,%edx
+  for(i = 0; i < N; i++){
+      96:	b8 01 00 00 00       	mov    $0x1,%eax
+      9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      9f:	90                   	nop
+    a[i] = i;
+      a0:	8b 0d 60 22 00 00    	mov    0x2260,%ecx
+    expect += i;
+      a6:	01 c2                	add    %eax,%edx
+    a[i] = i;
+      a8:	89 04 81             	mov    %eax,(%ecx,%eax,4)
+  for(i = 0; i < N; i++){
+      ab:	83 c0 01             	add    $0x1,%eax
+      ae:	3d 00 00 40 00       	cmp    $0x400000,%eax
+      b3:	75 eb                	jne    a0 <main+0x40>
+  }
+  expect *= NPASS;
+      b5:	8d 04 d5 00 00 00 00 	lea    0x0(,%edx,8),%eax
+
+  base = 0;
+      bc:	31 ff                	xor    %edi,%edi
+  for(nthread = 1; nthread <= MAXT; nthread *= 2){
+      be:	c7 05 20 22 00 00 01 	movl   $0x1,0x2220
+      c5:	00 00 00 
+  expect *= NPASS;
+      c8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    t0 = uptime();
+      cb:	e8 a8 06 00 00       	call   778 <uptime>
+    for(t = 0; t < nthread; t++){
+      d0:	8b 15 20 22 00 00    	mov    0x2220,%edx
+      d6:	31 db                	xor    %ebx,%ebx
+    t0 = uptime();
+      d8:	89 c6                	mov    %eax,%esi
+    for(t = 0; t < nthread; t++){
+      da:	85 d2                	test   %edx,%edx
+      dc:	7f 0e                	jg     ec <main+0x8c>
+      de:	eb 50                	jmp    130 <main+0xd0>
+      e0:	a1 20 22 00 00       	mov    0x2220,%eax
+      e5:	83 c3 01             	add    $0x1,%ebx
+      e8:	39 d8                	cmp    %ebx,%eax
+      ea:	7e 29                	jle    115 <main+0xb5>
+      if(thread_create(sum, (void*)t) < 0){
+      ec:	83 ec 08             	sub    $0x8,%esp
+      ef:	53                   	push   %ebx
+      f0:	68 00 00 00 00       	push   $0x0
+      f5:	e8 f6 0e 00 00       	call   ff0 <thread_create>
+      fa:	83 c4 10             	add    $0x10,%esp
+      fd:	85 c0                	test   %eax,%eax
+      ff:	79 df                	jns    e0 <main+0x80>
+        printf(1, "psumbench: thread_create failed\n");
+     101:	83 ec 08             	sub    $0x8,%esp
+     104:	68 c4 10 00 00       	push   $0x10c4
+     109:	6a 01                	push   $0x1
+     10b:	e8 50 0b 00 00       	call   c60 <printf>
+        exit();
+     110:	e8 bb 03 00 00       	call   4d0 <exit>
+      }
+    }
+    for(t = 0; t < nthread; t++)
+     115:	85 c0                	test   %eax,%eax
+     117:	7e 17                	jle    130 <main+0xd0>
+     119:	31 db                	xor    %ebx,%ebx
+     11b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     11f:	90                   	nop
+      thread_join();
+     120:	e8 3b 0f 00 00       	call   1060 <thread_join>
+    for(t = 0; t < nthread; t++)
+     125:	83 c3 01             	add    $0x1,%ebx
+     128:	39 1d 20 22 00 00    	cmp    %ebx,0x2220
+     12e:	7f f0                	jg     120 <main+0xc0>
+    ticks = uptime() - t0;
+     130:	e8 43 06 00 00       	call   778 <uptime>
+    s = 0;
+     135:	31 d2                	xor    %edx,%edx
+    ticks = uptime() - t0;
+     137:	29 f0                	sub    %esi,%eax
+    for(t = 0; t < nthread; t++)
+     139:	8b 35 20 22 00 00    	mov    0x2220,%esi
+    ticks = uptime() - t0;
+     13f:	89 c3                	mov    %eax,%ebx
+    for(t = 0; t < nthread; t++)
+     141:	31 c0                	xor    %eax,%eax
+     143:	85 f6                	test   %esi,%esi
+     145:	7e 17                	jle    15e <main+0xfe>
+     147:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     14e:	66 90                	xchg   %ax,%ax
+      s += part[t];
+     150:	03 14 85 40 22 00 00 	add    0x2240(,%eax,4),%edx
+    for(t = 0; t < nthread; t++)
+     157:	83 c0 01             	add    $0x1,%eax
+     15a:	39 f0                	cmp    %esi,%eax
+     15c:	75 f2                	jne    150 <main+0xf0>
+    if(s != expect)
+     15e:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+     161:	75 47                	jne    1aa <main+0x14a>
+      printf(1, "psumbench: wrong sum with %d threads\n", nthread);
+    if(nthread == 1)
+      base = ticks;
+    printf(1, "psumbench: %d threads: %d ticks", nthread, ticks);
+     163:	53                   	push   %ebx
+    ticks = uptime() - t0;
+     164:	83 fe 01             	cmp    $0x1,%esi
+    printf(1, "psumbench: %d threads: %d ticks", nthread, ticks);
+     167:	56                   	push   %esi
+    ticks = uptime() - t0;
+     168:	0f 44 fb             	cmove  %ebx,%edi
+    printf(1, "psumbench: %d threads: %d ticks", nthread, ticks);
+     16b:	68 10 11 00 00       	push   $0x1110
+     170:	6a 01                	push   $0x1
+     172:	e8 e9 0a 00 00       	call   c60 <printf>
+    if(ticks > 0)
+     177:	83 c4 10             	add    $0x10,%esp
+     17a:	85 db                	test   %ebx,%ebx
+     17c:	7f 45                	jg     1c3 <main+0x163>
+      printf(1, " (speedup %d.%d)", base / ticks, base * 10 / ticks % 10);
+    printf(1, "\n");
+     17e:	83 ec 08             	sub    $0x8,%esp
+     181:	68 b0 10 00 00       	push   $0x10b0
+     186:	6a 01                	push   $0x1
+     188:	e8 d3 0a 00 00       	call   c60 <printf>
+  for(nthread = 1; nthread <= MAXT; nthread *= 2){
+     18d:	a1 20 22 00 00       	mov    0x2220,%eax
+     192:	83 c4 10             	add    $0x10,%esp
+     195:	01 c0                	add    %eax,%eax
+     197:	a3 20 22 00 00       	mov    %eax,0x2220
+     19c:	83 f8 08             	cmp    $0x8,%eax
+     19f:	0f 8e 26 ff ff ff    	jle    cb <main+0x6b>
+  }
+  exit();
+     1a5:	e8 26 03 00 00       	call   4d0 <exit>
+      printf(1, "psumbench: wrong sum with %d threads\n", nthread);
+     1aa:	50                   	push   %eax
+     1ab:	56                   	push   %esi
+     1ac:	68 e8 10 00 00       	push   $0x10e8
+     1b1:	6a 01                	push   $0x1
+     1b3:	e8 a8 0a 00 00       	call   c60 <printf>
+     1b8:	8b 35 20 22 00 00    	mov    0x2220,%esi
+     1be:	83 c4 10             	add    $0x10,%esp
+     1c1:	eb a0                	jmp    163 <main+0x103>
+      printf(1, " (speedup %d.%d)", base / ticks, base * 10 / ticks % 10);
+     1c3:	6b c7 0a             	imul   $0xa,%edi,%eax
+     1c6:	be 0a 00 00 00       	mov    $0xa,%esi
+     1cb:	99                   	cltd
+     1cc:	f7 fb                	idiv   %ebx
+     1ce:	99                   	cltd
+     1cf:	f7 fe                	idiv   %esi
+     1d1:	89 f8                	mov    %edi,%eax
+     1d3:	52                   	push   %edx
+     1d4:	99                   	cltd
+     1d5:	f7 fb                	idiv   %ebx
+     1d7:	50                   	push   %eax
+     1d8:	68 b2 10 00 00       	push   $0x10b2
+     1dd:	6a 01                	push   $0x1
+     1df:	e8 7c 0a 00 00       	call   c60 <printf>
+     1e4:	83 c4 10             	add    $0x10,%esp
+     1e7:	eb 95                	jmp    17e <main+0x11e>
+    printf(1, "psumbench: malloc failed\n");
+     1e9:	51                   	push   %ecx
+     1ea:	51                   	push   %ecx
+     1eb:	68 98 10 00 00       	push   $0x1098
+     1f0:	6a 01                	push   $0x1
+     1f2:	e8 69 0a 00 00       	call   c60 <printf>
+    exit();
+     1f7:	e8 d4 02 00 00       	call   4d0 <exit>
+     1fc:	66 90                	xchg   %ax,%ax
+     1fe:	66 90                	xchg   %ax,%ax
+
+00000200 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     200:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     201:	31 c0                	xor    %eax,%eax
+{
+     203:	89 e5                	mov    %esp,%ebp
+     205:	53                   	push   %ebx
+     206:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     209:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     20c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     210:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     214:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     217:	83 c0 01             	add    $0x1,%eax
+     21a:	84 d2                	test   %dl,%dl
+     21c:	75 f2                	jne    210 <strcpy+0x10>
+    ;
+  return os;
+}
+     21e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     221:	89 c8                	mov    %ecx,%eax
+     223:	c9                   	leave
+     224:	c3                   	ret
+     225:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     22c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000230 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     230:	55                   	push   %ebp
+     231:	89 e5                	mov    %esp,%ebp
+     233:	53                   	push   %ebx
+     234:	8b 55 08             	mov    0x8(%ebp),%edx
+     237:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     23a:	0f b6 02             	movzbl (%edx),%eax
+     23d:	84 c0                	test   %al,%al
+     23f:	75 17                	jne    258 <strcmp+0x28>
+     241:	eb 3a                	jmp    27d <strcmp+0x4d>
+     243:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     247:	90                   	nop
+     248:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     24c:	83 c2 01             	add    $0x1,%edx
+     24f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     252:	84 c0                	test   %al,%al
+     254:	74 1a                	je     270 <strcmp+0x40>
+    p++, q++;
+     256:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     258:	0f b6 19             	movzbl (%ecx),%ebx
+     25b:	38 c3                	cmp    %al,%bl
+     25d:	74 e9                	je     248 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     25f:	29 d8                	sub    %ebx,%eax
+}
+     261:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     264:	c9                   	leave
+     265:	c3                   	ret
+     266:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     26d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     270:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     274:	31 c0                	xor    %eax,%eax
+     276:	29 d8                	sub    %ebx,%eax
+}
+     278:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     27b:	c9                   	leave
+     27c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     27d:	0f b6 19             	movzbl (%ecx),%ebx
+     280:	31 c0                	xor    %eax,%eax
+     282:	eb db                	jmp    25f <strcmp+0x2f>
+     284:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     28b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     28f:	90                   	nop
+
+00000290 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     290:	55                   	push   %ebp
+     291:	89 e5                	mov    %esp,%ebp
+     293:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     296:	80 3a 00             	cmpb   $0x0,(%edx)
+     299:	74 15                	je     2b0 <strlen+0x20>
+     29b:	31 c0                	xor    %eax,%eax
+     29d:	8d 76 00             	lea    0x0(%esi),%esi
+     2a0:	83 c0 01             	add    $0x1,%eax
+     2a3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     2a7:	89 c1                	mov    %eax,%ecx
+     2a9:	75 f5                	jne    2a0 <strlen+0x10>
+    ;
+  return n;
+}
+     2ab:	89 c8                	mov    %ecx,%eax
+     2ad:	5d                   	pop    %ebp
+     2ae:	c3                   	ret
+     2af:	90                   	nop
+  for(n = 0; s[n]; n++)
+     2b0:	31 c9                	xor    %ecx,%ecx
+}
+     2b2:	5d                   	pop    %ebp
+     2b3:	89 c8                	mov    %ecx,%eax
+     2b5:	c3                   	ret
+     2b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002c0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     2c0:	55                   	push   %ebp
+     2c1:	89 e5                	mov    %esp,%ebp
+     2c3:	57                   	push   %edi
+     2c4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     2c7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     2ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+     2cd:	89 d7                	mov    %edx,%edi
+     2cf:	fc                   	cld
+     2d0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     2d2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     2d5:	89 d0                	mov    %edx,%eax
+     2d7:	c9                   	leave
+     2d8:	c3                   	ret
+     2d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002e0 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     2e0:	55                   	push   %ebp
+     2e1:	89 e5                	mov    %esp,%ebp
+     2e3:	56                   	push   %esi
+     2e4:	53                   	push   %ebx
+     2e5:	8b 75 10             	mov    0x10(%ebp),%esi
+     2e8:	8b 55 08             	mov    0x8(%ebp),%edx
+     2eb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+     2ee:	85 f6                	test   %esi,%esi
+     2f0:	74 2e                	je     320 <memcmp+0x40>
+     2f2:	01 c6                	add    %eax,%esi
+     2f4:	eb 14                	jmp    30a <memcmp+0x2a>
+     2f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2fd:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+     300:	83 c0 01             	add    $0x1,%eax
+     303:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+     306:	39 f0                	cmp    %esi,%eax
+     308:	74 16                	je     320 <memcmp+0x40>
+    if(*s1 != *s2)
+     30a:	0f b6 0a             	movzbl (%edx),%ecx
+     30d:	0f b6 18             	movzbl (%eax),%ebx
+     310:	38 d9                	cmp    %bl,%cl
+     312:	74 ec                	je     300 <memcmp+0x20>
+      return *s1 - *s2;
+     314:	0f b6 c1             	movzbl %cl,%eax
+     317:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+     319:	5b                   	pop    %ebx
+     31a:	5e                   	pop    %esi
+     31b:	5d                   	pop    %ebp
+     31c:	c3                   	ret
+     31d:	8d 76 00             	lea    0x0(%esi),%esi
+     320:	5b                   	pop    %ebx
+  return 0;
+     321:	31 c0                	xor    %eax,%eax
+}
+     323:	5e                   	pop    %esi
+     324:	5d                   	pop    %ebp
+     325:	c3                   	ret
+     326:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     32d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000330 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     330:	55                   	push   %ebp
+     331:	89 e5                	mov    %esp,%ebp
+     333:	8b 45 08             	mov    0x8(%ebp),%eax
+     336:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     33a:	0f b6 10             	movzbl (%eax),%edx
+     33d:	84 d2                	test   %dl,%dl
+     33f:	75 12                	jne    353 <strchr+0x23>
+     341:	eb 1d                	jmp    360 <strchr+0x30>
+     343:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     347:	90                   	nop
+     348:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     34c:	83 c0 01             	add    $0x1,%eax
+     34f:	84 d2                	test   %dl,%dl
+     351:	74 0d                	je     360 <strchr+0x30>
+    if(*s == c)
+     353:	38 d1                	cmp    %dl,%cl
+     355:	75 f1                	jne    348 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     357:	5d                   	pop    %ebp
+     358:	c3                   	ret
+     359:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     360:	31 c0                	xor    %eax,%eax
+}
+     362:	5d                   	pop    %ebp
+     363:	c3                   	ret
+     364:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     36b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     36f:	90                   	nop
+
+00000370 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     370:	55                   	push   %ebp
+     371:	89 e5                	mov    %esp,%ebp
+     373:	57                   	push   %edi
+     374:	56                   	push   %esi
+int
+read(int fd, void *buf, int n)
+{
+  if(flushhook)
+    flushhook();
+  return _read(fd, buf, n);
+     375:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     378:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     379:	31 db                	xor    %ebx,%ebx
+{
+     37b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     37e:	eb 32                	jmp    3b2 <gets+0x42>
+  if(flushhook)
+     380:	a1 64 22 00 00       	mov    0x2264,%eax
+     385:	85 c0                	test   %eax,%eax
+     387:	74 02                	je     38b <gets+0x1b>
+    flushhook();
+     389:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+     38b:	83 ec 04             	sub    $0x4,%esp
+     38e:	6a 01                	push   $0x1
+     390:	56                   	push   %esi
+     391:	6a 00                	push   $0x0
+     393:	e8 60 03 00 00       	call   6f8 <_read>
+    if(cc < 1)
+     398:	83 c4 10             	add    $0x10,%esp
+     39b:	85 c0                	test   %eax,%eax
+     39d:	7e 1d                	jle    3bc <gets+0x4c>
+    buf[i++] = c;
+     39f:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     3a3:	8b 55 08             	mov    0x8(%ebp),%edx
+     3a6:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     3aa:	3c 0a                	cmp    $0xa,%al
+     3ac:	74 10                	je     3be <gets+0x4e>
+     3ae:	3c 0d                	cmp    $0xd,%al
+     3b0:	74 0c                	je     3be <gets+0x4e>
+  for(i=0; i+1 < max; ){
+     3b2:	89 df                	mov    %ebx,%edi
+     3b4:	83 c3 01             	add    $0x1,%ebx
+     3b7:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     3ba:	7c c4                	jl     380 <gets+0x10>
+     3bc:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+     3be:	8b 45 08             	mov    0x8(%ebp),%eax
+     3c1:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+     3c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     3c8:	5b                   	pop    %ebx
+     3c9:	5e                   	pop    %esi
+     3ca:	5f                   	pop    %edi
+     3cb:	5d                   	pop    %ebp
+     3cc:	c3                   	ret
+     3cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003d0 <stat>:
+{
+     3d0:	55                   	push   %ebp
+     3d1:	89 e5                	mov    %esp,%ebp
+     3d3:	56                   	push   %esi
+     3d4:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+     3d5:	83 ec 08             	sub    $0x8,%esp
+     3d8:	6a 00                	push   $0x0
+     3da:	ff 75 08             	push   0x8(%ebp)
+     3dd:	e8 3e 03 00 00       	call   720 <open>
+  if(fd < 0)
+     3e2:	83 c4 10             	add    $0x10,%esp
+     3e5:	85 c0                	test   %eax,%eax
+     3e7:	78 37                	js     420 <stat+0x50>
+  r = fstat(fd, st);
+     3e9:	83 ec 08             	sub    $0x8,%esp
+     3ec:	ff 75 0c             	push   0xc(%ebp)
+     3ef:	89 c3                	mov    %eax,%ebx
+     3f1:	50                   	push   %eax
+     3f2:	e8 41 03 00 00       	call   738 <fstat>
+}
+
+int
+close(int fd)
+{
+  if(flushhook)
+     3f7:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+     3fa:	89 c6                	mov    %eax,%esi
+  if(flushhook)
+     3fc:	a1 64 22 00 00       	mov    0x2264,%eax
+     401:	85 c0                	test   %eax,%eax
+     403:	74 02                	je     407 <stat+0x37>
+    flushhook();
+     405:	ff d0                	call   *%eax
+  return _close(fd);
+     407:	83 ec 0c             	sub    $0xc,%esp
+     40a:	53                   	push   %ebx
+     40b:	e8 f8 02 00 00       	call   708 <_close>
+     410:	83 c4 10             	add    $0x10,%esp
+}
+     413:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     416:	89 f0                	mov    %esi,%eax
+     418:	5b                   	pop    %ebx
+     419:	5e                   	pop    %esi
+     41a:	5d                   	pop    %ebp
+     41b:	c3                   	ret
+     41c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+     420:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     425:	eb ec                	jmp    413 <stat+0x43>
+     427:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     42e:	66 90                	xchg   %ax,%ax
+
+00000430 <atoi>:
+{
+     430:	55                   	push   %ebp
+     431:	89 e5                	mov    %esp,%ebp
+     433:	53                   	push   %ebx
+     434:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+     437:	0f be 02             	movsbl (%edx),%eax
+     43a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     43d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     440:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     445:	77 1e                	ja     465 <atoi+0x35>
+     447:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     44e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     450:	83 c2 01             	add    $0x1,%edx
+     453:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     456:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     45a:	0f be 02             	movsbl (%edx),%eax
+     45d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     460:	80 fb 09             	cmp    $0x9,%bl
+     463:	76 eb                	jbe    450 <atoi+0x20>
+}
+     465:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     468:	89 c8                	mov    %ecx,%eax
+     46a:	c9                   	leave
+     46b:	c3                   	ret
+     46c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000470 <memmove>:
+{
+     470:	55                   	push   %ebp
+     471:	89 e5                	mov    %esp,%ebp
+     473:	57                   	push   %edi
+     474:	56                   	push   %esi
+     475:	8b 45 10             	mov    0x10(%ebp),%eax
+     478:	8b 55 08             	mov    0x8(%ebp),%edx
+     47b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+     47e:	85 c0                	test   %eax,%eax
+     480:	7e 13                	jle    495 <memmove+0x25>
+     482:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     484:	89 d7                	mov    %edx,%edi
+     486:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     48d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     490:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     491:	39 f8                	cmp    %edi,%eax
+     493:	75 fb                	jne    490 <memmove+0x20>
+}
+     495:	5e                   	pop    %esi
+     496:	89 d0                	mov    %edx,%eax
+     498:	5f                   	pop    %edi
+     499:	5d                   	pop    %ebp
+     49a:	c3                   	ret
+     49b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     49f:	90                   	nop
+
+000004a0 <fork>:
+  if(flushhook)
+     4a0:	a1 64 22 00 00       	mov    0x2264,%eax
+     4a5:	85 c0                	test   %eax,%eax
+     4a7:	74 17                	je     4c0 <fork+0x20>
+{
+     4a9:	55                   	push   %ebp
+     4aa:	89 e5                	mov    %esp,%ebp
+     4ac:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+     4af:	ff d0                	call   *%eax
+}
+     4b1:	c9                   	leave
+  return _fork();
+     4b2:	e9 21 02 00 00       	jmp    6d8 <_fork>
+     4b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4be:	66 90                	xchg   %ax,%ax
+     4c0:	e9 13 02 00 00       	jmp    6d8 <_fork>
+     4c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004d0 <exit>:
+{
+     4d0:	55                   	push   %ebp
+     4d1:	89 e5                	mov    %esp,%ebp
+     4d3:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+     4d6:	a1 64 22 00 00       	mov    0x2264,%eax
+     4db:	85 c0                	test   %eax,%eax
+     4dd:	74 02                	je     4e1 <exit+0x11>
+    flushhook();
+     4df:	ff d0                	call   *%eax
+  _exit();
+     4e1:	e8 fa 01 00 00       	call   6e0 <_exit>
+     4e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000004f0 <exec>:
+{
+     4f0:	55                   	push   %ebp
+  if(flushhook)
+     4f1:	a1 64 22 00 00       	mov    0x2264,%eax
+{
+     4f6:	89 e5                	mov    %esp,%ebp
+     4f8:	56                   	push   %esi
+     4f9:	53                   	push   %ebx
+     4fa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     4fd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+     500:	85 c0                	test   %eax,%eax
+     502:	74 02                	je     506 <exec+0x16>
+    flushhook();
+     504:	ff d0                	call   *%eax
+  return _exec(path, argv);
+     506:	89 75 0c             	mov    %esi,0xc(%ebp)
+     509:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     50c:	5b                   	pop    %ebx
+     50d:	5e                   	pop    %esi
+     50e:	5d                   	pop    %ebp
+  return _exec(path, argv);
+     50f:	e9 04 02 00 00       	jmp    718 <_exec>
+     514:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     51b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     51f:	90                   	nop
+
+00000520 <read>:
+{
+     520:	55                   	push   %ebp
+     521:	89 e5                	mov    %esp,%ebp
+     523:	57                   	push   %edi
+     524:	56                   	push   %esi
+     525:	53                   	push   %ebx
+     526:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     529:	a1 64 22 00 00       	mov    0x2264,%eax
+{
+     52e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     531:	8b 75 0c             	mov    0xc(%ebp),%esi
+     534:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     537:	85 c0                	test   %eax,%eax
+     539:	74 02                	je     53d <read+0x1d>
+    flushhook();
+     53b:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+     53d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     540:	89 75 0c             	mov    %esi,0xc(%ebp)
+     543:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     546:	83 c4 0c             	add    $0xc,%esp
+     549:	5b                   	pop    %ebx
+     54a:	5e                   	pop    %esi
+     54b:	5f                   	pop    %edi
+     54c:	5d                   	pop    %ebp
+  return _read(fd, buf, n);
+     54d:	e9 a6 01 00 00       	jmp    6f8 <_read>
+     552:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     559:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000560 <readv>:
+{
+     560:	55                   	push   %ebp
+     561:	89 e5                	mov    %esp,%ebp
+     563:	57                   	push   %edi
+     564:	56                   	push   %esi
+     565:	53                   	push   %ebx
+     566:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     569:	a1 64 22 00 00       	mov    0x2264,%eax
+{
+     56e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     571:	8b 75 0c             	mov    0xc(%ebp),%esi
+     574:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     577:	85 c0                	test   %eax,%eax
+     579:	74 02                	je     57d <readv+0x1d>
+    flushhook();
+     57b:	ff d0                	call   *%eax
+  return _readv(fd, iov, cnt);
+     57d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     580:	89 75 0c             	mov    %esi,0xc(%ebp)
+     583:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     586:	83 c4 0c             	add    $0xc,%esp
+     589:	5b                   	pop    %ebx
+     58a:	5e                   	pop    %esi
+     58b:	5f                   	pop    %edi
+     58c:	5d                   	pop    %ebp
+  return _readv(fd, iov, cnt);
+     58d:	e9 76 02 00 00       	jmp    808 <_readv>
+     592:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     599:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000005a0 <write>:
+{
+     5a0:	55                   	push   %ebp
+     5a1:	89 e5                	mov    %esp,%ebp
+     5a3:	57                   	push   %edi
+     5a4:	56                   	push   %esi
+     5a5:	53                   	push   %ebx
+     5a6:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     5a9:	a1 64 22 00 00       	mov    0x2264,%eax
+{
+     5ae:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     5b1:	8b 75 0c             	mov    0xc(%ebp),%esi
+     5b4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     5b7:	85 c0                	test   %eax,%eax
+     5b9:	74 02                	je     5bd <write+0x1d>
+    flushhook();
+     5bb:	ff d0                	call   *%eax
+  return _write(fd, buf, n);
+     5bd:	89 7d 10             	mov    %edi,0x10(%ebp)
+     5c0:	89 75 0c             	mov    %esi,0xc(%ebp)
+     5c3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     5c6:	83 c4 0c             	add    $0xc,%esp
+     5c9:	5b                   	pop    %ebx
+     5ca:	5e                   	pop    %esi
+     5cb:	5f                   	pop    %edi
+     5cc:	5d                   	pop    %ebp
+  return _write(fd, buf, n);
+     5cd:	e9 2e 01 00 00       	jmp    700 <_write>
+     5d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000005e0 <writev>:
+{
+     5e0:	55                   	push   %ebp
+     5e1:	89 e5                	mov    %esp,%ebp
+     5e3:	57                   	push   %edi
+     5e4:	56                   	push   %esi
+     5e5:	53                   	push   %ebx
+     5e6:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     5e9:	a1 64 22 00 00       	mov    0x2264,%eax
+{
+     5ee:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     5f1:	8b 75 0c             	mov    0xc(%ebp),%esi
+     5f4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     5f7:	85 c0                	test   %eax,%eax
+     5f9:	74 02                	je     5fd <writev+0x1d>
+    flushhook();
+     5fb:	ff d0                	call   *%eax
+  return _writev(fd, iov, cnt);
+     5fd:	89 7d 10             	mov    %edi,0x10(%ebp)
+     600:	89 75 0c             	mov    %esi,0xc(%ebp)
+     603:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     606:	83 c4 0c             	add    $0xc,%esp
+     609:	5b                   	pop    %ebx
+     60a:	5e                   	pop    %esi
+     60b:	5f                   	pop    %edi
+     60c:	5d                   	pop    %ebp
+  return _writev(fd, iov, cnt);
+     60d:	e9 fe 01 00 00       	jmp    810 <_writev>
+     612:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     619:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000620 <close>:
+{
+     620:	55                   	push   %ebp
+     621:	89 e5                	mov    %esp,%ebp
+     623:	53                   	push   %ebx
+     624:	83 ec 04             	sub    $0x4,%esp
+  if(flushhook)
+     627:	a1 64 22 00 00       	mov    0x2264,%eax
+{
+     62c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(flushhook)
+     62f:	85 c0                	test   %eax,%eax
+     631:	74 02                	je     635 <close+0x15>
+    flushhook();
+     633:	ff d0                	call   *%eax
+  return _close(fd);
+     635:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     638:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     63b:	c9                   	leave
+  return _close(fd);
+     63c:	e9 c7 00 00 00       	jmp    708 <_close>
+     641:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     648:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     64f:	90                   	nop
+
+00000650 <umtxinit>:
+// process that finds the mutex held enters the kernel, to sleep
+// in futexwait() until the holder's umtxunlock() wakes it.
+
+void
+umtxinit(struct umutex *m)
+{
+     650:	55                   	push   %ebp
+     651:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+     653:	8b 45 08             	mov    0x8(%ebp),%eax
+     656:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     65c:	5d                   	pop    %ebp
+     65d:	c3                   	ret
+     65e:	66 90                	xchg   %ax,%ax
+
+00000660 <umtxlock>:
+
+void
+umtxlock(struct umutex *m)
+{
+     660:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+     661:	b8 01 00 00 00       	mov    $0x1,%eax
+     666:	89 e5                	mov    %esp,%ebp
+     668:	56                   	push   %esi
+     669:	53                   	push   %ebx
+     66a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     66d:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 1) == 0)
+     670:	85 c0                	test   %eax,%eax
+     672:	74 2b                	je     69f <umtxlock+0x3f>
+     674:	b8 02 00 00 00       	mov    $0x2,%eax
+     679:	f0 87 03             	lock xchg %eax,(%ebx)
+    return;
+  // Mark the mutex contended, so that its holder
+  // wakes a waiter on release, and wait.
+  while(xchg(&m->state, 2) != 0)
+     67c:	85 c0                	test   %eax,%eax
+     67e:	74 1f                	je     69f <umtxlock+0x3f>
+     680:	be 02 00 00 00       	mov    $0x2,%esi
+     685:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwait(&m->state, 2);
+     688:	83 ec 08             	sub    $0x8,%esp
+     68b:	6a 02                	push   $0x2
+     68d:	53                   	push   %ebx
+     68e:	e8 85 01 00 00       	call   818 <futexwait>
+     693:	89 f0                	mov    %esi,%eax
+     695:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+     698:	83 c4 10             	add    $0x10,%esp
+     69b:	85 c0                	test   %eax,%eax
+     69d:	75 e9                	jne    688 <umtxlock+0x28>
+}
+     69f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     6a2:	5b                   	pop    %ebx
+     6a3:	5e                   	pop    %esi
+     6a4:	5d                   	pop    %ebp
+     6a5:	c3                   	ret
+     6a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000006b0 <umtxunlock>:
+
+void
+umtxunlock(struct umutex *m)
+{
+     6b0:	55                   	push   %ebp
+     6b1:	31 c0                	xor    %eax,%eax
+     6b3:	89 e5                	mov    %esp,%ebp
+     6b5:	83 ec 08             	sub    $0x8,%esp
+     6b8:	8b 55 08             	mov    0x8(%ebp),%edx
+     6bb:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+     6be:	83 f8 02             	cmp    $0x2,%eax
+     6c1:	74 05                	je     6c8 <umtxunlock+0x18>
+    futexwake(&m->state, 1);
+}
+     6c3:	c9                   	leave
+     6c4:	c3                   	ret
+     6c5:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwake(&m->state, 1);
+     6c8:	83 ec 08             	sub    $0x8,%esp
+     6cb:	6a 01                	push   $0x1
+     6cd:	52                   	push   %edx
+     6ce:	e8 4d 01 00 00       	call   820 <futexwake>
+     6d3:	83 c4 10             	add    $0x10,%esp
+}
+     6d6:	c9                   	leave
+     6d7:	c3                   	ret
+
+000006d8 <_fork>:
+  _ ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+     6d8:	b8 01 00 00 00       	mov    $0x1,%eax
+     6dd:	cd 40                	int    $0x40
+     6df:	c3                   	ret
+
+000006e0 <_exit>:
+RAWSYSCALL(exit)
+     6e0:	b8 02 00 00 00       	mov    $0x2,%eax
+     6e5:	cd 40                	int    $0x40
+     6e7:	c3                   	ret
+
+000006e8 <wait>:
+SYSCALL(wait)
+     6e8:	b8 03 00 00 00       	mov    $0x3,%eax
+     6ed:	cd 40                	int    $0x40
+     6ef:	c3                   	ret
+
+000006f0 <pipe>:
+SYSCALL(pipe)
+     6f0:	b8 04 00 00 00       	mov    $0x4,%eax
+     6f5:	cd 40                	int    $0x40
+     6f7:	c3                   	ret
+
+000006f8 <_read>:
+RAWSYSCALL(read)
+     6f8:	b8 05 00 00 00       	mov    $0x5,%eax
+     6fd:	cd 40                	int    $0x40
+     6ff:	c3                   	ret
+
+00000700 <_write>:
+RAWSYSCALL(write)
+     700:	b8 10 00 00 00       	mov    $0x10,%eax
+     705:	cd 40                	int    $0x40
+     707:	c3                   	ret
+
+00000708 <_close>:
+RAWSYSCALL(close)
+     708:	b8 15 00 00 00       	mov    $0x15,%eax
+     70d:	cd 40                	int    $0x40
+     70f:	c3                   	ret
+
+00000710 <kill>:
+SYSCALL(kill)
+     710:	b8 06 00 00 00       	mov    $0x6,%eax
+     715:	cd 40                	int    $0x40
+     717:	c3                   	ret
+
+00000718 <_exec>:
+RAWSYSCALL(exec)
+     718:	b8 07 00 00 00       	mov    $0x7,%eax
+     71d:	cd 40                	int    $0x40
+     71f:	c3                   	ret
+
+00000720 <open>:
+SYSCALL(open)
+     720:	b8 0f 00 00 00       	mov    $0xf,%eax
+     725:	cd 40                	int    $0x40
+     727:	c3                   	ret
+
+00000728 <mknod>:
+SYSCALL(mknod)
+     728:	b8 11 00 00 00       	mov    $0x11,%eax
+     72d:	cd 40                	int    $0x40
+     72f:	c3                   	ret
+
+00000730 <unlink>:
+SYSCALL(unlink)
+     730:	b8 12 00 00 00       	mov    $0x12,%eax
+     735:	cd 40                	int    $0x40
+     737:	c3                   	ret
+
+00000738 <fstat>:
+SYSCALL(fstat)
+     738:	b8 08 00 00 00       	mov    $0x8,%eax
+     73d:	cd 40                	int    $0x40
+     73f:	c3                   	ret
+
+00000740 <link>:
+SYSCALL(link)
+     740:	b8 13 00 00 00       	mov    $0x13,%eax
+     745:	cd 40                	int    $0x40
+     747:	c3                   	ret
+
+00000748 <mkdir>:
+SYSCALL(mkdir)
+     748:	b8 14 00 00 00       	mov    $0x14,%eax
+     74d:	cd 40                	int    $0x40
+     74f:	c3                   	ret
+
+00000750 <chdir>:
+SYSCALL(chdir)
+     750:	b8 09 00 00 00       	mov    $0x9,%eax
+     755:	cd 40                	int    $0x40
+     757:	c3                   	ret
+
+00000758 <dup>:
+SYSCALL(dup)
+     758:	b8 0a 00 00 00       	mov    $0xa,%eax
+     75d:	cd 40                	int    $0x40
+     75f:	c3                   	ret
+
+00000760 <getpid>:
+SYSCALL(getpid)
+     760:	b8 0b 00 00 00       	mov    $0xb,%eax
+     765:	cd 40                	int    $0x40
+     767:	c3                   	ret
+
+00000768 <sbrk>:
+SYSCALL(sbrk)
+     768:	b8 0c 00 00 00       	mov    $0xc,%eax
+     76d:	cd 40                	int    $0x40
+     76f:	c3                   	ret
+
+00000770 <sleep>:
+SYSCALL(sleep)
+     770:	b8 0d 00 00 00       	mov    $0xd,%eax
+     775:	cd 40                	int    $0x40
+     777:	c3                   	ret
+
+00000778 <uptime>:
+SYSCALL(uptime)
+     778:	b8 0e 00 00 00       	mov    $0xe,%eax
+     77d:	cd 40                	int    $0x40
+     77f:	c3                   	ret
+
+00000780 <wolfie>:
+SYSCALL(wolfie)
+     780:	b8 16 00 00 00       	mov    $0x16,%eax
+     785:	cd 40                	int    $0x40
+     787:	c3                   	ret
+
+00000788 <nice>:
+SYSCALL(nice)
+     788:	b8 17 00 00 00       	mov    $0x17,%eax
+     78d:	cd 40                	int    $0x40
+     78f:	c3                   	ret
+
+00000790 <mtxget>:
+SYSCALL(mtxget)
+     790:	b8 18 00 00 00       	mov    $0x18,%eax
+     795:	cd 40                	int    $0x40
+     797:	c3                   	ret
+
+00000798 <mtxrel>:
+SYSCALL(mtxrel)
+     798:	b8 19 00 00 00       	mov    $0x19,%eax
+     79d:	cd 40                	int    $0x40
+     79f:	c3                   	ret
+
+000007a0 <mtxacq>:
+SYSCALL(mtxacq)
+     7a0:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     7a5:	cd 40                	int    $0x40
+     7a7:	c3                   	ret
+
+000007a8 <mtxdel>:
+SYSCALL(mtxdel)
+     7a8:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     7ad:	cd 40                	int    $0x40
+     7af:	c3                   	ret
+
+000007b0 <iostat>:
+SYSCALL(iostat)
+     7b0:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     7b5:	cd 40                	int    $0x40
+     7b7:	c3                   	ret
+
+000007b8 <mmap>:
+SYSCALL(mmap)
+     7b8:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     7bd:	cd 40                	int    $0x40
+     7bf:	c3                   	ret
+
+000007c0 <munmap>:
+SYSCALL(munmap)
+     7c0:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     7c5:	cd 40                	int    $0x40
+     7c7:	c3                   	ret
+
+000007c8 <shmget>:
+SYSCALL(shmget)
+     7c8:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     7cd:	cd 40                	int    $0x40
+     7cf:	c3                   	ret
+
+000007d0 <shmat>:
+SYSCALL(shmat)
+     7d0:	b8 20 00 00 00       	mov    $0x20,%eax
+     7d5:	cd 40                	int    $0x40
+     7d7:	c3                   	ret
+
+000007d8 <shmdt>:
+SYSCALL(shmdt)
+     7d8:	b8 21 00 00 00       	mov    $0x21,%eax
+     7dd:	cd 40                	int    $0x40
+     7df:	c3                   	ret
+
+000007e0 <shmdel>:
+SYSCALL(shmdel)
+     7e0:	b8 22 00 00 00       	mov    $0x22,%eax
+     7e5:	cd 40                	int    $0x40
+     7e7:	c3                   	ret
+
+000007e8 <syscount>:
+SYSCALL(syscount)
+     7e8:	b8 23 00 00 00       	mov    $0x23,%eax
+     7ed:	cd 40                	int    $0x40
+     7ef:	c3                   	ret
+
+000007f0 <splice>:
+SYSCALL(splice)
+     7f0:	b8 24 00 00 00       	mov    $0x24,%eax
+     7f5:	cd 40                	int    $0x40
+     7f7:	c3                   	ret
+
+000007f8 <tee>:
+SYSCALL(tee)
+     7f8:	b8 25 00 00 00       	mov    $0x25,%eax
+     7fd:	cd 40                	int    $0x40
+     7ff:	c3                   	ret
+
+00000800 <sendfile>:
+SYSCALL(sendfile)
+     800:	b8 26 00 00 00       	mov    $0x26,%eax
+     805:	cd 40                	int    $0x40
+     807:	c3                   	ret
+
+00000808 <_readv>:
+RAWSYSCALL(readv)
+     808:	b8 27 00 00 00       	mov    $0x27,%eax
+     80d:	cd 40                	int    $0x40
+     80f:	c3                   	ret
+
+00000810 <_writev>:
+RAWSYSCALL(writev)
+     810:	b8 28 00 00 00       	mov    $0x28,%eax
+     815:	cd 40                	int    $0x40
+     817:	c3                   	ret
+
+00000818 <futexwait>:
+SYSCALL(futexwait)
+     818:	b8 29 00 00 00       	mov    $0x29,%eax
+     81d:	cd 40                	int    $0x40
+     81f:	c3                   	ret
+
+00000820 <futexwake>:
+SYSCALL(futexwake)
+     820:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     825:	cd 40                	int    $0x40
+     827:	c3                   	ret
+
+00000828 <lockstat>:
+SYSCALL(lockstat)
+     828:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     82d:	cd 40                	int    $0x40
+     82f:	c3                   	ret
+
+00000830 <clone>:
+SYSCALL(clone)
+     830:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     835:	cd 40                	int    $0x40
+     837:	c3                   	ret
+
+00000838 <join>:
+SYSCALL(join)
+     838:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     83d:	cd 40                	int    $0x40
+     83f:	c3                   	ret
+
+00000840 <stacklimit>:
+SYSCALL(stacklimit)
+     840:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     845:	cd 40                	int    $0x40
+     847:	c3                   	ret
+     848:	66 90                	xchg   %ax,%ax
+     84a:	66 90                	xchg   %ax,%ax
+     84c:	66 90                	xchg   %ax,%ax
+     84e:	66 90                	xchg   %ax,%ax
+
+00000850 <flushall>:
+  b->n = 0;
+}
+
+static void
+flushall(void)
+{
+     850:	55                   	push   %ebp
+     851:	89 e5                	mov    %esp,%ebp
+     853:	83 ec 14             	sub    $0x14,%esp
+  umtxlock(&stdoutlock);
+     856:	68 68 22 00 00       	push   $0x2268
+     85b:	e8 00 fe ff ff       	call   660 <umtxlock>
+  if(b->n > 0)
+     860:	a1 08 20 00 00       	mov    0x2008,%eax
+     865:	83 c4 10             	add    $0x10,%esp
+     868:	85 c0                	test   %eax,%eax
+     86a:	7e 17                	jle    883 <flushall+0x33>
+    _write(b->fd, b->buf, b->n);
+     86c:	83 ec 04             	sub    $0x4,%esp
+     86f:	50                   	push   %eax
+     870:	68 0c 20 00 00       	push   $0x200c
+     875:	ff 35 00 20 00 00    	push   0x2000
+     87b:	e8 80 fe ff ff       	call   700 <_write>
+     880:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     883:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     88a:	00 00 00 
+  flush(&stdout);
+  umtxunlock(&stdoutlock);
+     88d:	83 ec 0c             	sub    $0xc,%esp
+     890:	68 68 22 00 00       	push   $0x2268
+     895:	e8 16 fe ff ff       	call   6b0 <umtxunlock>
+}
+     89a:	83 c4 10             	add    $0x10,%esp
+     89d:	c9                   	leave
+     89e:	c3                   	ret
+     89f:	90                   	nop
+
+000008a0 <printint>:
+    flush(b);
+}
+
+static void
+printint(struct outbuf *b, int xx, int base, int sgn)
+{
+     8a0:	55                   	push   %ebp
+     8a1:	89 e5                	mov    %esp,%ebp
+     8a3:	57                   	push   %edi
+     8a4:	89 cf                	mov    %ecx,%edi
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     8a6:	89 d1                	mov    %edx,%ecx
+{
+     8a8:	56                   	push   %esi
+     8a9:	53                   	push   %ebx
+     8aa:	89 c3                	mov    %eax,%ebx
+     8ac:	83 ec 2c             	sub    $0x2c,%esp
+  if(sgn && xx < 0){
+     8af:	85 d2                	test   %edx,%edx
+     8b1:	0f 89 b9 00 00 00    	jns    970 <printint+0xd0>
+     8b7:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     8bb:	0f 84 af 00 00 00    	je     970 <printint+0xd0>
+    x = -xx;
+     8c1:	f7 d9                	neg    %ecx
+    neg = 1;
+     8c3:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     8c8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     8cb:	31 f6                	xor    %esi,%esi
+     8cd:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     8d0:	89 c8                	mov    %ecx,%eax
+     8d2:	31 d2                	xor    %edx,%edx
+     8d4:	89 f3                	mov    %esi,%ebx
+     8d6:	f7 f7                	div    %edi
+     8d8:	8d 76 01             	lea    0x1(%esi),%esi
+     8db:	0f b6 92 68 15 00 00 	movzbl 0x1568(%edx),%edx
+     8e2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     8e6:	89 ca                	mov    %ecx,%edx
+     8e8:	89 c1                	mov    %eax,%ecx
+     8ea:	39 fa                	cmp    %edi,%edx
+     8ec:	73 e2                	jae    8d0 <printint+0x30>
+  if(neg)
+     8ee:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     8f1:	89 d9                	mov    %ebx,%ecx
+     8f3:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     8f6:	85 c0                	test   %eax,%eax
+     8f8:	74 07                	je     901 <printint+0x61>
+    buf[i++] = '-';
+     8fa:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     8ff:	89 f1                	mov    %esi,%ecx
+     901:	8d 75 d8             	lea    -0x28(%ebp),%esi
+     904:	89 cf                	mov    %ecx,%edi
+     906:	01 f7                	add    %esi,%edi
+     908:	eb 1a                	jmp    924 <printint+0x84>
+     90a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    *b->str++ = c;
+     910:	8d 48 01             	lea    0x1(%eax),%ecx
+     913:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+     919:	88 10                	mov    %dl,(%eax)
+
+  while(--i >= 0)
+     91b:	8d 47 ff             	lea    -0x1(%edi),%eax
+     91e:	39 fe                	cmp    %edi,%esi
+     920:	74 40                	je     962 <printint+0xc2>
+     922:	89 c7                	mov    %eax,%edi
+  if(b->str){
+     924:	8b 83 0c 02 00 00    	mov    0x20c(%ebx),%eax
+    putc(b, buf[i]);
+     92a:	0f b6 17             	movzbl (%edi),%edx
+  if(b->str){
+     92d:	85 c0                	test   %eax,%eax
+     92f:	75 df                	jne    910 <printint+0x70>
+  b->buf[b->n++] = c;
+     931:	8b 4b 08             	mov    0x8(%ebx),%ecx
+     934:	8d 41 01             	lea    0x1(%ecx),%eax
+     937:	89 43 08             	mov    %eax,0x8(%ebx)
+     93a:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+     93e:	3d 00 02 00 00       	cmp    $0x200,%eax
+     943:	74 3b                	je     980 <printint+0xe0>
+     945:	80 fa 0a             	cmp    $0xa,%dl
+     948:	75 d1                	jne    91b <printint+0x7b>
+     94a:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+     94e:	75 cb                	jne    91b <printint+0x7b>
+  if(b->n > 0)
+     950:	85 c0                	test   %eax,%eax
+     952:	7f 2c                	jg     980 <printint+0xe0>
+  b->n = 0;
+     954:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  while(--i >= 0)
+     95b:	8d 47 ff             	lea    -0x1(%edi),%eax
+     95e:	39 fe                	cmp    %edi,%esi
+     960:	75 c0                	jne    922 <printint+0x82>
+}
+     962:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     965:	5b                   	pop    %ebx
+     966:	5e                   	pop    %esi
+     967:	5f                   	pop    %edi
+     968:	5d                   	pop    %ebp
+     969:	c3                   	ret
+     96a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  neg = 0;
+     970:	31 c0                	xor    %eax,%eax
+     972:	e9 51 ff ff ff       	jmp    8c8 <printint+0x28>
+     977:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     97e:	66 90                	xchg   %ax,%ax
+    _write(b->fd, b->buf, b->n);
+     980:	83 ec 04             	sub    $0x4,%esp
+     983:	50                   	push   %eax
+     984:	8d 43 0c             	lea    0xc(%ebx),%eax
+     987:	50                   	push   %eax
+     988:	ff 33                	push   (%ebx)
+     98a:	e8 71 fd ff ff       	call   700 <_write>
+     98f:	83 c4 10             	add    $0x10,%esp
+     992:	eb c0                	jmp    954 <printint+0xb4>
+     994:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     99b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     99f:	90                   	nop
+
+000009a0 <putc>:
+{
+     9a0:	55                   	push   %ebp
+     9a1:	89 e5                	mov    %esp,%ebp
+     9a3:	53                   	push   %ebx
+     9a4:	89 c3                	mov    %eax,%ebx
+     9a6:	83 ec 04             	sub    $0x4,%esp
+  if(b->str){
+     9a9:	8b 80 0c 02 00 00    	mov    0x20c(%eax),%eax
+     9af:	85 c0                	test   %eax,%eax
+     9b1:	74 15                	je     9c8 <putc+0x28>
+    *b->str++ = c;
+     9b3:	8d 48 01             	lea    0x1(%eax),%ecx
+     9b6:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+     9bc:	88 10                	mov    %dl,(%eax)
+}
+     9be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     9c1:	c9                   	leave
+     9c2:	c3                   	ret
+     9c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     9c7:	90                   	nop
+  b->buf[b->n++] = c;
+     9c8:	8b 4b 08             	mov    0x8(%ebx),%ecx
+     9cb:	8d 41 01             	lea    0x1(%ecx),%eax
+     9ce:	89 43 08             	mov    %eax,0x8(%ebx)
+     9d1:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+     9d5:	3d 00 02 00 00       	cmp    $0x200,%eax
+     9da:	74 14                	je     9f0 <putc+0x50>
+     9dc:	80 fa 0a             	cmp    $0xa,%dl
+     9df:	75 dd                	jne    9be <putc+0x1e>
+     9e1:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+     9e5:	75 d7                	jne    9be <putc+0x1e>
+  if(b->n > 0)
+     9e7:	85 c0                	test   %eax,%eax
+     9e9:	7e 17                	jle    a02 <putc+0x62>
+     9eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     9ef:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     9f0:	83 ec 04             	sub    $0x4,%esp
+     9f3:	50                   	push   %eax
+     9f4:	8d 43 0c             	lea    0xc(%ebx),%eax
+     9f7:	50                   	push   %eax
+     9f8:	ff 33                	push   (%ebx)
+     9fa:	e8 01 fd ff ff       	call   700 <_write>
+     9ff:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     a02:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+     a09:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     a0c:	c9                   	leave
+     a0d:	c3                   	ret
+     a0e:	66 90                	xchg   %ax,%ax
+
+00000a10 <format>:
+
+// Format fmt and the arguments at ap into b.
+// Only understands %d, %x, %p, %s, %c.
+static void
+format(struct outbuf *b, const char *fmt, uint *ap)
+{
+     a10:	55                   	push   %ebp
+     a11:	89 e5                	mov    %esp,%ebp
+     a13:	57                   	push   %edi
+     a14:	89 c7                	mov    %eax,%edi
+     a16:	56                   	push   %esi
+     a17:	53                   	push   %ebx
+     a18:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+     a1b:	0f b6 02             	movzbl (%edx),%eax
+{
+     a1e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  for(i = 0; fmt[i]; i++){
+     a21:	84 c0                	test   %al,%al
+     a23:	74 5a                	je     a7f <format+0x6f>
+     a25:	8d 5a 01             	lea    0x1(%edx),%ebx
+     a28:	31 f6                	xor    %esi,%esi
+     a2a:	eb 1c                	jmp    a48 <format+0x38>
+     a2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     a30:	83 f8 25             	cmp    $0x25,%eax
+     a33:	74 3b                	je     a70 <format+0x60>
+        state = '%';
+      } else {
+        putc(b, c);
+     a35:	89 ca                	mov    %ecx,%edx
+     a37:	89 f8                	mov    %edi,%eax
+     a39:	e8 62 ff ff ff       	call   9a0 <putc>
+  for(i = 0; fmt[i]; i++){
+     a3e:	0f b6 03             	movzbl (%ebx),%eax
+     a41:	83 c3 01             	add    $0x1,%ebx
+     a44:	84 c0                	test   %al,%al
+     a46:	74 37                	je     a7f <format+0x6f>
+    c = fmt[i] & 0xff;
+     a48:	0f be c8             	movsbl %al,%ecx
+     a4b:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     a4e:	85 f6                	test   %esi,%esi
+     a50:	74 de                	je     a30 <format+0x20>
+      }
+    } else if(state == '%'){
+     a52:	83 fe 25             	cmp    $0x25,%esi
+     a55:	75 e7                	jne    a3e <format+0x2e>
+      if(c == 'd'){
+     a57:	83 f8 25             	cmp    $0x25,%eax
+     a5a:	74 46                	je     aa2 <format+0x92>
+     a5c:	83 e8 63             	sub    $0x63,%eax
+     a5f:	83 f8 15             	cmp    $0x15,%eax
+     a62:	77 2c                	ja     a90 <format+0x80>
+     a64:	ff 24 85 10 15 00 00 	jmp    *0x1510(,%eax,4)
+     a6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     a6f:	90                   	nop
+  for(i = 0; fmt[i]; i++){
+     a70:	0f b6 03             	movzbl (%ebx),%eax
+     a73:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+     a76:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+     a7b:	84 c0                	test   %al,%al
+     a7d:	75 c9                	jne    a48 <format+0x38>
+        putc(b, c);
+      }
+      state = 0;
+    }
+  }
+}
+     a7f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a82:	5b                   	pop    %ebx
+     a83:	5e                   	pop    %esi
+     a84:	5f                   	pop    %edi
+     a85:	5d                   	pop    %ebp
+     a86:	c3                   	ret
+     a87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a8e:	66 90                	xchg   %ax,%ax
+        putc(b, '%');
+     a90:	ba 25 00 00 00       	mov    $0x25,%edx
+     a95:	89 f8                	mov    %edi,%eax
+     a97:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     a9a:	e8 01 ff ff ff       	call   9a0 <putc>
+        putc(b, c);
+     a9f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     aa2:	89 ca                	mov    %ecx,%edx
+     aa4:	89 f8                	mov    %edi,%eax
+      state = 0;
+     aa6:	31 f6                	xor    %esi,%esi
+        putc(b, c);
+     aa8:	e8 f3 fe ff ff       	call   9a0 <putc>
+     aad:	eb 8f                	jmp    a3e <format+0x2e>
+     aaf:	90                   	nop
+        printint(b, *ap, 16, 0);
+     ab0:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     ab3:	83 ec 0c             	sub    $0xc,%esp
+     ab6:	b9 10 00 00 00       	mov    $0x10,%ecx
+     abb:	8b 16                	mov    (%esi),%edx
+     abd:	6a 00                	push   $0x0
+        ap++;
+     abf:	83 c6 04             	add    $0x4,%esi
+        printint(b, *ap, 16, 0);
+     ac2:	89 f8                	mov    %edi,%eax
+     ac4:	e8 d7 fd ff ff       	call   8a0 <printint>
+        ap++;
+     ac9:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+     acc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     acf:	31 f6                	xor    %esi,%esi
+     ad1:	e9 68 ff ff ff       	jmp    a3e <format+0x2e>
+     ad6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     add:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     ae0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     ae3:	8b 30                	mov    (%eax),%esi
+        ap++;
+     ae5:	83 c0 04             	add    $0x4,%eax
+     ae8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+     aeb:	85 f6                	test   %esi,%esi
+     aed:	75 1b                	jne    b0a <format+0xfa>
+     aef:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+     af4:	be 08 15 00 00       	mov    $0x1508,%esi
+     af9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+          putc(b, *s);
+     b00:	89 f8                	mov    %edi,%eax
+          s++;
+     b02:	83 c6 01             	add    $0x1,%esi
+          putc(b, *s);
+     b05:	e8 96 fe ff ff       	call   9a0 <putc>
+        while(*s != 0){
+     b0a:	0f be 16             	movsbl (%esi),%edx
+     b0d:	84 d2                	test   %dl,%dl
+     b0f:	75 ef                	jne    b00 <format+0xf0>
+      state = 0;
+     b11:	31 f6                	xor    %esi,%esi
+     b13:	e9 26 ff ff ff       	jmp    a3e <format+0x2e>
+     b18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b1f:	90                   	nop
+        printint(b, *ap, 10, 1);
+     b20:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     b23:	83 ec 0c             	sub    $0xc,%esp
+     b26:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     b2b:	8b 16                	mov    (%esi),%edx
+     b2d:	6a 01                	push   $0x1
+     b2f:	eb 8e                	jmp    abf <format+0xaf>
+     b31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(b, *ap);
+     b38:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     b3b:	89 f8                	mov    %edi,%eax
+     b3d:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+     b40:	83 c6 04             	add    $0x4,%esi
+        putc(b, *ap);
+     b43:	e8 58 fe ff ff       	call   9a0 <putc>
+        ap++;
+     b48:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      state = 0;
+     b4b:	31 f6                	xor    %esi,%esi
+     b4d:	e9 ec fe ff ff       	jmp    a3e <format+0x2e>
+     b52:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b59:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000b60 <fflush>:
+{
+     b60:	55                   	push   %ebp
+     b61:	89 e5                	mov    %esp,%ebp
+     b63:	83 ec 08             	sub    $0x8,%esp
+  if(fd == stdout.fd)
+     b66:	8b 45 08             	mov    0x8(%ebp),%eax
+     b69:	39 05 00 20 00 00    	cmp    %eax,0x2000
+     b6f:	74 07                	je     b78 <fflush+0x18>
+}
+     b71:	c9                   	leave
+     b72:	c3                   	ret
+     b73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b77:	90                   	nop
+  umtxlock(&stdoutlock);
+     b78:	83 ec 0c             	sub    $0xc,%esp
+     b7b:	68 68 22 00 00       	push   $0x2268
+     b80:	e8 db fa ff ff       	call   660 <umtxlock>
+  if(b->n > 0)
+     b85:	a1 08 20 00 00       	mov    0x2008,%eax
+     b8a:	83 c4 10             	add    $0x10,%esp
+     b8d:	85 c0                	test   %eax,%eax
+     b8f:	7f 1f                	jg     bb0 <fflush+0x50>
+  b->n = 0;
+     b91:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     b98:	00 00 00 
+  umtxunlock(&stdoutlock);
+     b9b:	c7 45 08 68 22 00 00 	movl   $0x2268,0x8(%ebp)
+}
+     ba2:	c9                   	leave
+  umtxunlock(&stdoutlock);
+     ba3:	e9 08 fb ff ff       	jmp    6b0 <umtxunlock>
+     ba8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     baf:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     bb0:	83 ec 04             	sub    $0x4,%esp
+     bb3:	50                   	push   %eax
+     bb4:	68 0c 20 00 00       	push   $0x200c
+     bb9:	ff 35 00 20 00 00    	push   0x2000
+     bbf:	e8 3c fb ff ff       	call   700 <_write>
+     bc4:	83 c4 10             	add    $0x10,%esp
+     bc7:	eb c8                	jmp    b91 <fflush+0x31>
+     bc9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000bd0 <setvbuf>:
+{
+     bd0:	55                   	push   %ebp
+     bd1:	89 e5                	mov    %esp,%ebp
+     bd3:	53                   	push   %ebx
+     bd4:	83 ec 04             	sub    $0x4,%esp
+     bd7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd != stdout.fd)
+     bda:	8b 45 08             	mov    0x8(%ebp),%eax
+     bdd:	39 05 00 20 00 00    	cmp    %eax,0x2000
+     be3:	74 0b                	je     bf0 <setvbuf+0x20>
+}
+     be5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     be8:	c9                   	leave
+     be9:	c3                   	ret
+     bea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  umtxlock(&stdoutlock);
+     bf0:	83 ec 0c             	sub    $0xc,%esp
+     bf3:	68 68 22 00 00       	push   $0x2268
+     bf8:	e8 63 fa ff ff       	call   660 <umtxlock>
+  if(b->n > 0)
+     bfd:	a1 08 20 00 00       	mov    0x2008,%eax
+     c02:	83 c4 10             	add    $0x10,%esp
+     c05:	85 c0                	test   %eax,%eax
+     c07:	7f 2f                	jg     c38 <setvbuf+0x68>
+  b->n = 0;
+     c09:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     c10:	00 00 00 
+  stdout.mode = mode;
+     c13:	89 1d 04 20 00 00    	mov    %ebx,0x2004
+  flushhook = flushall;
+     c19:	c7 05 64 22 00 00 50 	movl   $0x850,0x2264
+     c20:	08 00 00 
+}
+     c23:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&stdoutlock);
+     c26:	c7 45 08 68 22 00 00 	movl   $0x2268,0x8(%ebp)
+}
+     c2d:	c9                   	leave
+  umtxunlock(&stdoutlock);
+     c2e:	e9 7d fa ff ff       	jmp    6b0 <umtxunlock>
+     c33:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c37:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     c38:	83 ec 04             	sub    $0x4,%esp
+     c3b:	50                   	push   %eax
+     c3c:	68 0c 20 00 00       	push   $0x200c
+     c41:	ff 35 00 20 00 00    	push   0x2000
+     c47:	e8 b4 fa ff ff       	call   700 <_write>
+     c4c:	83 c4 10             	add    $0x10,%esp
+     c4f:	eb b8                	jmp    c09 <setvbuf+0x39>
+     c51:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c5f:	90                   	nop
+
+00000c60 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s, %c.
+void
+printf(int fd, const char *fmt, ...)
+{
+     c60:	55                   	push   %ebp
+     c61:	89 e5                	mov    %esp,%ebp
+     c63:	53                   	push   %ebx
+     c64:	81 ec 14 02 00 00    	sub    $0x214,%esp
+     c6a:	8b 45 08             	mov    0x8(%ebp),%eax
+    local.mode = _IONBF;
+    local.n = 0;
+    local.str = 0;
+    b = &local;
+  }
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     c6d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd == stdout.fd){
+     c70:	39 05 00 20 00 00    	cmp    %eax,0x2000
+     c76:	74 48                	je     cc0 <printf+0x60>
+    local.fd = fd;
+     c78:	89 85 e8 fd ff ff    	mov    %eax,-0x218(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     c7e:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     c81:	89 da                	mov    %ebx,%edx
+     c83:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+    local.mode = _IONBF;
+     c89:	c7 85 ec fd ff ff 03 	movl   $0x3,-0x214(%ebp)
+     c90:	00 00 00 
+    local.n = 0;
+     c93:	c7 85 f0 fd ff ff 00 	movl   $0x0,-0x210(%ebp)
+     c9a:	00 00 00 
+    local.str = 0;
+     c9d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     ca4:	e8 67 fd ff ff       	call   a10 <format>
+  if(b->mode == _IONBF)
+     ca9:	83 bd ec fd ff ff 03 	cmpl   $0x3,-0x214(%ebp)
+     cb0:	0f 84 a2 00 00 00    	je     d58 <printf+0xf8>
+    flush(b);
+  if(b == &stdout)
+    umtxunlock(&stdoutlock);
+}
+     cb6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     cb9:	c9                   	leave
+     cba:	c3                   	ret
+     cbb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     cbf:	90                   	nop
+    umtxlock(&stdoutlock);
+     cc0:	83 ec 0c             	sub    $0xc,%esp
+     cc3:	68 68 22 00 00       	push   $0x2268
+     cc8:	e8 93 f9 ff ff       	call   660 <umtxlock>
+  if(stdout.mode == 0){
+     ccd:	a1 04 20 00 00       	mov    0x2004,%eax
+     cd2:	83 c4 10             	add    $0x10,%esp
+     cd5:	85 c0                	test   %eax,%eax
+     cd7:	74 37                	je     d10 <printf+0xb0>
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     cd9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     cdc:	89 da                	mov    %ebx,%edx
+     cde:	b8 00 20 00 00       	mov    $0x2000,%eax
+     ce3:	e8 28 fd ff ff       	call   a10 <format>
+  if(b->mode == _IONBF)
+     ce8:	83 3d 04 20 00 00 03 	cmpl   $0x3,0x2004
+     cef:	0f 84 ab 00 00 00    	je     da0 <printf+0x140>
+    umtxunlock(&stdoutlock);
+     cf5:	83 ec 0c             	sub    $0xc,%esp
+     cf8:	68 68 22 00 00       	push   $0x2268
+     cfd:	e8 ae f9 ff ff       	call   6b0 <umtxunlock>
+}
+     d02:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    umtxunlock(&stdoutlock);
+     d05:	83 c4 10             	add    $0x10,%esp
+}
+     d08:	c9                   	leave
+     d09:	c3                   	ret
+     d0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+     d10:	83 ec 08             	sub    $0x8,%esp
+     d13:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+     d19:	50                   	push   %eax
+     d1a:	ff 35 00 20 00 00    	push   0x2000
+     d20:	e8 13 fa ff ff       	call   738 <fstat>
+     d25:	83 c4 10             	add    $0x10,%esp
+     d28:	89 c2                	mov    %eax,%edx
+      stdout.mode = _IOFBF;
+     d2a:	b8 01 00 00 00       	mov    $0x1,%eax
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+     d2f:	85 d2                	test   %edx,%edx
+     d31:	75 10                	jne    d43 <printf+0xe3>
+      stdout.mode = _IOLBF;
+     d33:	31 c0                	xor    %eax,%eax
+     d35:	66 83 bd e8 fd ff ff 	cmpw   $0x3,-0x218(%ebp)
+     d3c:	03 
+     d3d:	0f 94 c0             	sete   %al
+     d40:	83 c0 01             	add    $0x1,%eax
+     d43:	a3 04 20 00 00       	mov    %eax,0x2004
+    flushhook = flushall;
+     d48:	c7 05 64 22 00 00 50 	movl   $0x850,0x2264
+     d4f:	08 00 00 
+     d52:	eb 85                	jmp    cd9 <printf+0x79>
+     d54:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(b->n > 0)
+     d58:	8b 85 f0 fd ff ff    	mov    -0x210(%ebp),%eax
+     d5e:	85 c0                	test   %eax,%eax
+     d60:	0f 8e 50 ff ff ff    	jle    cb6 <printf+0x56>
+    b = &local;
+     d66:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+    _write(b->fd, b->buf, b->n);
+     d6c:	83 ec 04             	sub    $0x4,%esp
+     d6f:	50                   	push   %eax
+     d70:	8d 43 0c             	lea    0xc(%ebx),%eax
+     d73:	50                   	push   %eax
+     d74:	ff 33                	push   (%ebx)
+     d76:	e8 85 f9 ff ff       	call   700 <_write>
+  b->n = 0;
+     d7b:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  if(b == &stdout)
+     d82:	83 c4 10             	add    $0x10,%esp
+     d85:	81 fb 00 20 00 00    	cmp    $0x2000,%ebx
+     d8b:	0f 85 25 ff ff ff    	jne    cb6 <printf+0x56>
+     d91:	e9 5f ff ff ff       	jmp    cf5 <printf+0x95>
+     d96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d9d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(b->n > 0)
+     da0:	a1 08 20 00 00       	mov    0x2008,%eax
+    b = getstdout();
+     da5:	bb 00 20 00 00       	mov    $0x2000,%ebx
+  if(b->n > 0)
+     daa:	85 c0                	test   %eax,%eax
+     dac:	7f be                	jg     d6c <printf+0x10c>
+  b->n = 0;
+     dae:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     db5:	00 00 00 
+  if(b == &stdout)
+     db8:	e9 38 ff ff ff       	jmp    cf5 <printf+0x95>
+     dbd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000dc0 <sprintf>:
+
+// Print to the given buffer. Only understands %d, %x, %p, %s, %c.
+int
+sprintf(char *str, const char *fmt, ...)
+{
+     dc0:	55                   	push   %ebp
+     dc1:	89 e5                	mov    %esp,%ebp
+     dc3:	53                   	push   %ebx
+  struct outbuf b;
+
+  b.str = str;
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+     dc4:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+     dca:	8d 4d 10             	lea    0x10(%ebp),%ecx
+{
+     dcd:	81 ec 14 02 00 00    	sub    $0x214,%esp
+     dd3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+     dd6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  b.str = str;
+     dd9:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+     ddc:	e8 2f fc ff ff       	call   a10 <format>
+  *b.str = '\0';
+     de1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     de4:	c6 00 00             	movb   $0x0,(%eax)
+  return b.str - str;
+     de7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     dea:	29 d8                	sub    %ebx,%eax
+}
+     dec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     def:	c9                   	leave
+     df0:	c3                   	ret
+     df1:	66 90                	xchg   %ax,%ax
+     df3:	66 90                	xchg   %ax,%ax
+     df5:	66 90                	xchg   %ax,%ax
+     df7:	66 90                	xchg   %ax,%ax
+     df9:	66 90                	xchg   %ax,%ax
+     dfb:	66 90                	xchg   %ax,%ax
+     dfd:	66 90                	xchg   %ax,%ax
+     dff:	90                   	nop
+
+00000e00 <freeblock>:
+static Header *freep;
+static struct umutex lock;  // threads made by clone() share the heap
+
+static void
+freeblock(void *ap)
+{
+     e00:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+     e01:	8d 48 f8             	lea    -0x8(%eax),%ecx
+{
+     e04:	89 e5                	mov    %esp,%ebp
+     e06:	57                   	push   %edi
+     e07:	56                   	push   %esi
+     e08:	53                   	push   %ebx
+     e09:	89 c3                	mov    %eax,%ebx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     e0b:	a1 70 22 00 00       	mov    0x2270,%eax
+     e10:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     e12:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     e14:	39 ca                	cmp    %ecx,%edx
+     e16:	73 30                	jae    e48 <freeblock+0x48>
+     e18:	39 c1                	cmp    %eax,%ecx
+     e1a:	72 04                	jb     e20 <freeblock+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     e1c:	39 c2                	cmp    %eax,%edx
+     e1e:	72 f0                	jb     e10 <freeblock+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     e20:	8b 73 fc             	mov    -0x4(%ebx),%esi
+     e23:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+     e26:	39 f8                	cmp    %edi,%eax
+     e28:	74 26                	je     e50 <freeblock+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+     e2a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+     e2d:	8b 42 04             	mov    0x4(%edx),%eax
+     e30:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     e33:	39 f1                	cmp    %esi,%ecx
+     e35:	74 30                	je     e67 <freeblock+0x67>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+     e37:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+     e39:	5b                   	pop    %ebx
+  freep = p;
+     e3a:	89 15 70 22 00 00    	mov    %edx,0x2270
+}
+     e40:	5e                   	pop    %esi
+     e41:	5f                   	pop    %edi
+     e42:	5d                   	pop    %ebp
+     e43:	c3                   	ret
+     e44:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     e48:	39 c1                	cmp    %eax,%ecx
+     e4a:	72 d0                	jb     e1c <freeblock+0x1c>
+     e4c:	eb c2                	jmp    e10 <freeblock+0x10>
+     e4e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+     e50:	03 70 04             	add    0x4(%eax),%esi
+     e53:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     e56:	8b 02                	mov    (%edx),%eax
+     e58:	8b 00                	mov    (%eax),%eax
+     e5a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+     e5d:	8b 42 04             	mov    0x4(%edx),%eax
+     e60:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     e63:	39 f1                	cmp    %esi,%ecx
+     e65:	75 d0                	jne    e37 <freeblock+0x37>
+    p->s.size += bp->s.size;
+     e67:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+     e6a:	89 15 70 22 00 00    	mov    %edx,0x2270
+    p->s.size += bp->s.size;
+     e70:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+     e73:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+     e76:	89 0a                	mov    %ecx,(%edx)
+}
+     e78:	5b                   	pop    %ebx
+     e79:	5e                   	pop    %esi
+     e7a:	5f                   	pop    %edi
+     e7b:	5d                   	pop    %ebp
+     e7c:	c3                   	ret
+     e7d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000e80 <free>:
+
+void
+free(void *ap)
+{
+     e80:	55                   	push   %ebp
+     e81:	89 e5                	mov    %esp,%ebp
+     e83:	53                   	push   %ebx
+     e84:	83 ec 10             	sub    $0x10,%esp
+     e87:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  umtxlock(&lock);
+     e8a:	68 6c 22 00 00       	push   $0x226c
+     e8f:	e8 cc f7 ff ff       	call   660 <umtxlock>
+  freeblock(ap);
+     e94:	89 d8                	mov    %ebx,%eax
+     e96:	e8 65 ff ff ff       	call   e00 <freeblock>
+  umtxunlock(&lock);
+     e9b:	c7 45 08 6c 22 00 00 	movl   $0x226c,0x8(%ebp)
+}
+     ea2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&lock);
+     ea5:	83 c4 10             	add    $0x10,%esp
+}
+     ea8:	c9                   	leave
+  umtxunlock(&lock);
+     ea9:	e9 02 f8 ff ff       	jmp    6b0 <umtxunlock>
+     eae:	66 90                	xchg   %ax,%ax
+
+00000eb0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+     eb0:	55                   	push   %ebp
+     eb1:	89 e5                	mov    %esp,%ebp
+     eb3:	57                   	push   %edi
+     eb4:	56                   	push   %esi
+     eb5:	53                   	push   %ebx
+     eb6:	83 ec 28             	sub    $0x28,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     eb9:	8b 45 08             	mov    0x8(%ebp),%eax
+  umtxlock(&lock);
+     ebc:	68 6c 22 00 00       	push   $0x226c
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     ec1:	8d 48 07             	lea    0x7(%eax),%ecx
+     ec4:	c1 e9 03             	shr    $0x3,%ecx
+     ec7:	8d 71 01             	lea    0x1(%ecx),%esi
+  umtxlock(&lock);
+     eca:	e8 91 f7 ff ff       	call   660 <umtxlock>
+  if((prevp = freep) == 0){
+     ecf:	8b 15 70 22 00 00    	mov    0x2270,%edx
+     ed5:	83 c4 10             	add    $0x10,%esp
+     ed8:	85 d2                	test   %edx,%edx
+     eda:	0f 84 b0 00 00 00    	je     f90 <malloc+0xe0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     ee0:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+     ee2:	8b 47 04             	mov    0x4(%edi),%eax
+     ee5:	39 f0                	cmp    %esi,%eax
+     ee7:	73 6f                	jae    f58 <malloc+0xa8>
+  if(nu < 4096)
+     ee9:	bb 00 10 00 00       	mov    $0x1000,%ebx
+     eee:	39 de                	cmp    %ebx,%esi
+     ef0:	0f 43 de             	cmovae %esi,%ebx
+  p = sbrk(nu * sizeof(Header));
+     ef3:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+     efa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     efd:	eb 0a                	jmp    f09 <malloc+0x59>
+     eff:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     f00:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+     f02:	8b 47 04             	mov    0x4(%edi),%eax
+     f05:	39 f0                	cmp    %esi,%eax
+     f07:	73 4f                	jae    f58 <malloc+0xa8>
+      }
+      freep = prevp;
+      umtxunlock(&lock);
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+     f09:	89 fa                	mov    %edi,%edx
+     f0b:	39 3d 70 22 00 00    	cmp    %edi,0x2270
+     f11:	75 ed                	jne    f00 <malloc+0x50>
+  p = sbrk(nu * sizeof(Header));
+     f13:	83 ec 0c             	sub    $0xc,%esp
+     f16:	ff 75 e4             	push   -0x1c(%ebp)
+     f19:	e8 4a f8 ff ff       	call   768 <sbrk>
+  if(p == (char*)-1)
+     f1e:	83 c4 10             	add    $0x10,%esp
+     f21:	83 f8 ff             	cmp    $0xffffffff,%eax
+     f24:	74 15                	je     f3b <malloc+0x8b>
+  hp->s.size = nu;
+     f26:	89 58 04             	mov    %ebx,0x4(%eax)
+  freeblock((void*)(hp + 1));
+     f29:	83 c0 08             	add    $0x8,%eax
+     f2c:	e8 cf fe ff ff       	call   e00 <freeblock>
+  return freep;
+     f31:	8b 15 70 22 00 00    	mov    0x2270,%edx
+      if((p = morecore(nunits)) == 0){
+     f37:	85 d2                	test   %edx,%edx
+     f39:	75 c5                	jne    f00 <malloc+0x50>
+        umtxunlock(&lock);
+     f3b:	83 ec 0c             	sub    $0xc,%esp
+     f3e:	68 6c 22 00 00       	push   $0x226c
+     f43:	e8 68 f7 ff ff       	call   6b0 <umtxunlock>
+        return 0;
+     f48:	83 c4 10             	add    $0x10,%esp
+      }
+  }
+}
+     f4b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+     f4e:	31 c0                	xor    %eax,%eax
+}
+     f50:	5b                   	pop    %ebx
+     f51:	5e                   	pop    %esi
+     f52:	5f                   	pop    %edi
+     f53:	5d                   	pop    %ebp
+     f54:	c3                   	ret
+     f55:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+     f58:	39 c6                	cmp    %eax,%esi
+     f5a:	74 64                	je     fc0 <malloc+0x110>
+        p->s.size -= nunits;
+     f5c:	29 f0                	sub    %esi,%eax
+     f5e:	89 47 04             	mov    %eax,0x4(%edi)
+        p += p->s.size;
+     f61:	8d 3c c7             	lea    (%edi,%eax,8),%edi
+        p->s.size = nunits;
+     f64:	89 77 04             	mov    %esi,0x4(%edi)
+      umtxunlock(&lock);
+     f67:	83 ec 0c             	sub    $0xc,%esp
+      freep = prevp;
+     f6a:	89 15 70 22 00 00    	mov    %edx,0x2270
+      umtxunlock(&lock);
+     f70:	68 6c 22 00 00       	push   $0x226c
+     f75:	e8 36 f7 ff ff       	call   6b0 <umtxunlock>
+      return (void*)(p + 1);
+     f7a:	83 c4 10             	add    $0x10,%esp
+}
+     f7d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+     f80:	8d 47 08             	lea    0x8(%edi),%eax
+}
+     f83:	5b                   	pop    %ebx
+     f84:	5e                   	pop    %esi
+     f85:	5f                   	pop    %edi
+     f86:	5d                   	pop    %ebp
+     f87:	c3                   	ret
+     f88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f8f:	90                   	nop
+    base.s.ptr = freep = prevp = &base;
+     f90:	c7 05 70 22 00 00 74 	movl   $0x2274,0x2270
+     f97:	22 00 00 
+    base.s.size = 0;
+     f9a:	bf 74 22 00 00       	mov    $0x2274,%edi
+    base.s.ptr = freep = prevp = &base;
+     f9f:	c7 05 74 22 00 00 74 	movl   $0x2274,0x2274
+     fa6:	22 00 00 
+    base.s.size = 0;
+     fa9:	c7 05 78 22 00 00 00 	movl   $0x0,0x2278
+     fb0:	00 00 00 
+    if(p->s.size >= nunits){
+     fb3:	e9 31 ff ff ff       	jmp    ee9 <malloc+0x39>
+     fb8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fbf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+     fc0:	8b 07                	mov    (%edi),%eax
+     fc2:	89 02                	mov    %eax,(%edx)
+     fc4:	eb a1                	jmp    f67 <malloc+0xb7>
+     fc6:	66 90                	xchg   %ax,%ax
+     fc8:	66 90                	xchg   %ax,%ax
+     fca:	66 90                	xchg   %ax,%ax
+     fcc:	66 90                	xchg   %ax,%ax
+     fce:	66 90                	xchg   %ax,%ax
+
+00000fd0 <threadstart>:
+
+#define TSTACKSZ 4096
+
+static void
+threadstart(void *fn, void *arg)
+{
+     fd0:	55                   	push   %ebp
+     fd1:	89 e5                	mov    %esp,%ebp
+     fd3:	83 ec 14             	sub    $0x14,%esp
+  ((void (*)(void*))fn)(arg);
+     fd6:	ff 75 0c             	push   0xc(%ebp)
+     fd9:	ff 55 08             	call   *0x8(%ebp)
+  exit();
+     fdc:	e8 ef f4 ff ff       	call   4d0 <exit>
+     fe1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fe8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fef:	90                   	nop
+
+00000ff0 <thread_create>:
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+     ff0:	55                   	push   %ebp
+     ff1:	89 e5                	mov    %esp,%ebp
+     ff3:	53                   	push   %ebx
+     ff4:	83 ec 20             	sub    $0x20,%esp
+  char *mem, *stack;
+  int pid;
+
+  if((mem = malloc(2*TSTACKSZ)) == 0)
+     ff7:	68 00 20 00 00       	push   $0x2000
+     ffc:	e8 af fe ff ff       	call   eb0 <malloc>
+    1001:	83 c4 10             	add    $0x10,%esp
+    1004:	85 c0                	test   %eax,%eax
+    1006:	74 47                	je     104f <thread_create+0x5f>
+    1008:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)(((uint)mem + TSTACKSZ - 1) & ~(TSTACKSZ - 1));
+    100a:	8d 80 ff 0f 00 00    	lea    0xfff(%eax),%eax
+    1010:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  *(char**)stack = mem;
+    1015:	89 18                	mov    %ebx,(%eax)
+  if((pid = clone(threadstart, (void*)fn, arg, stack)) < 0)
+    1017:	50                   	push   %eax
+    1018:	ff 75 0c             	push   0xc(%ebp)
+    101b:	ff 75 08             	push   0x8(%ebp)
+    101e:	68 d0 0f 00 00       	push   $0xfd0
+    1023:	e8 08 f8 ff ff       	call   830 <clone>
+    1028:	83 c4 10             	add    $0x10,%esp
+    102b:	85 c0                	test   %eax,%eax
+    102d:	78 09                	js     1038 <thread_create+0x48>
+    free(mem);
+  return pid;
+}
+    102f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1032:	c9                   	leave
+    1033:	c3                   	ret
+    1034:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    free(mem);
+    1038:	83 ec 0c             	sub    $0xc,%esp
+    103b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    103e:	53                   	push   %ebx
+    103f:	e8 3c fe ff ff       	call   e80 <free>
+    1044:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    1047:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+    104a:	83 c4 10             	add    $0x10,%esp
+}
+    104d:	c9                   	leave
+    104e:	c3                   	ret
+    return -1;
+    104f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1054:	eb d9                	jmp    102f <thread_create+0x3f>
+    1056:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    105d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001060 <thread_join>:
+
+int
+thread_join(void)
+{
+    1060:	55                   	push   %ebp
+    1061:	89 e5                	mov    %esp,%ebp
+    1063:	83 ec 34             	sub    $0x34,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    1066:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    1069:	50                   	push   %eax
+    106a:	e8 c9 f7 ff ff       	call   838 <join>
+    106f:	83 c4 10             	add    $0x10,%esp
+    1072:	85 c0                	test   %eax,%eax
+    1074:	79 0a                	jns    1080 <thread_join+0x20>
+    free(*(char**)stack);
+  return pid;
+}
+    1076:	c9                   	leave
+    1077:	c3                   	ret
+    1078:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    107f:	90                   	nop
+    free(*(char**)stack);
+    1080:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1083:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1086:	83 ec 0c             	sub    $0xc,%esp
+    1089:	ff 32                	push   (%edx)
+    108b:	e8 f0 fd ff ff       	call   e80 <free>
+    1090:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1093:	83 c4 10             	add    $0x10,%esp
+}
+    1096:	c9                   	leave
+    1097:	c3                   	ret
@@ -0,0 +1,78 @@
+// Parallel sum: 1, 2, 4 and 8 threads made by thread_create()
+// each add up an equal slice of one shared array, and the main
+// thread adds up their totals. Each thread writes its total
+// once, so they share no cache lines while summing, and the
+// speedup should track the number of CPUs (make CPUS=n) until
+// there are more threads than CPUs.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+#define N       (4*1024*1024)   // ints in the array
+#define NPASS   8               // times each slice is summed
+#define MAXT    8
+
+int *a;
+uint part[MAXT];
+int nthread;
+
+void
+sum(void *arg)
+{
+  int t, i, pass, lo, hi;
+  uint s;
+
+  t = (int)arg;
+  lo = N / nthread * t;
+  hi = lo + N / nthread;
+  s = 0;
+  for(pass = 0; pass < NPASS; pass++)
+    for(i = lo; i < hi; i++)
+      s += a[i];
+  part[t] = s;
+}
+
+int
+main(int argc, char *argv[])
+{
+  int i, t, t0, ticks, base;
+  uint s, expect;
+
+  if((a = malloc(N * sizeof(int))) == 0){
+    printf(1, "psumbench: malloc failed\n");
+    exit();
+  }
+  expect = 0;
+  for(i = 0; i < N; i++){
+    a[i] = i;
+    expect += i;
+  }
+  expect *= NPASS;
+
+  base = 0;
+  for(nthread = 1; nthread <= MAXT; nthread *= 2){
+    t0 = uptime();
+    for(t = 0; t < nthread; t++){
+      if(thread_create(sum, (void*)t) < 0){
+        printf(1, "psumbench: thread_create failed\n");
+        exit();
+      }
+    }
+    for(t = 0; t < nthread; t++)
+      thread_join();
+    ticks = uptime() - t0;
+    s = 0;
+    for(t = 0; t < nthread; t++)
+      s += part[t];
+    if(s != expect)
+      printf(1, "psumbench: wrong sum with %d threads\n", nthread);
+    if(nthread == 1)
+      base = ticks;
+    printf(1, "psumbench: %d threads: %d ticks", nthread, ticks);
+    if(ticks > 0)
+      printf(1, " (speedup %d.%d)", base / ticks, base * 10 / ticks % 10);
+    printf(1, "\n");
+  }
+  exit();
+}
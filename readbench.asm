@@ -0,0 +1,2501 @@
+
+_readbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <reader>:
+
+char buf[4096];
+
+void
+reader(void)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	56                   	push   %esi
+       4:	53                   	push   %ebx
+  int fd, n, tot;
+
+  if((fd = open("readbench.file", O_RDONLY)) < 0){
+       5:	83 ec 08             	sub    $0x8,%esp
+       8:	6a 00                	push   $0x0
+       a:	68 98 11 00 00       	push   $0x1198
+       f:	e8 0c 08 00 00       	call   820 <open>
+      14:	83 c4 10             	add    $0x10,%esp
+      17:	85 c0                	test   %eax,%eax
+      19:	78 63                	js     7e <reader+0x7e>
+      1b:	89 c3                	mov    %eax,%ebx
+    printf(1, "readbench: cannot open readbench.file\n");
+    exit();
+  }
+  for(tot = 0; tot < NREAD; tot += n){
+      1d:	31 f6                	xor    %esi,%esi
+      1f:	90                   	nop
+    if((n = read(fd, buf, sizeof(buf))) <= 0){
+      20:	83 ec 04             	sub    $0x4,%esp
+      23:	68 00 10 00 00       	push   $0x1000
+      28:	68 20 22 00 00       	push   $0x2220
+      2d:	53                   	push   %ebx
+      2e:	e8 ed 05 00 00       	call   620 <read>
+      33:	83 c4 10             	add    $0x10,%esp
+      36:	85 c0                	test   %eax,%eax
+      38:	7e 26                	jle    60 <reader+0x60>
+  for(tot = 0; tot < NREAD; tot += n){
+      3a:	01 c6                	add    %eax,%esi
+      3c:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+      42:	7e dc                	jle    20 <reader+0x20>
+      close(fd);
+      fd = open("readbench.file", O_RDONLY);
+      n = 0;
+    }
+  }
+  close(fd);
+      44:	83 ec 0c             	sub    $0xc,%esp
+      47:	53                   	push   %ebx
+      48:	e8 d3 06 00 00       	call   720 <close>
+}
+      4d:	83 c4 10             	add    $0x10,%esp
+      50:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      53:	5b                   	pop    %ebx
+      54:	5e                   	pop    %esi
+      55:	5d                   	pop    %ebp
+      56:	c3                   	ret
+      57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      5e:	66 90                	xchg   %ax,%ax
+      close(fd);
+      60:	83 ec 0c             	sub    $0xc,%esp
+      63:	53                   	push   %ebx
+      64:	e8 b7 06 00 00       	call   720 <close>
+      fd = open("readbench.file", O_RDONLY);
+      69:	58                   	pop    %eax
+      6a:	5a                   	pop    %edx
+      6b:	6a 00                	push   $0x0
+      6d:	68 98 11 00 00       	push   $0x1198
+      72:	e8 a9 07 00 00       	call   820 <open>
+      77:	83 c4 10             	add    $0x10,%esp
+      7a:	89 c3                	mov    %eax,%ebx
+  for(tot = 0; tot < NREAD; tot += n){
+      7c:	eb a2                	jmp    20 <reader+0x20>
+    printf(1, "readbench: cannot open readbench.file\n");
+      7e:	51                   	push   %ecx
+      7f:	51                   	push   %ecx
+      80:	68 d0 11 00 00       	push   $0x11d0
+      85:	6a 01                	push   $0x1
+      87:	e8 d4 0c 00 00       	call   d60 <printf>
+    exit();
+      8c:	e8 3f 05 00 00       	call   5d0 <exit>
+      91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      9f:	90                   	nop
+
+000000a0 <lookup>:
+
+void
+lookup(void)
+{
+      a0:	55                   	push   %ebp
+      a1:	89 e5                	mov    %esp,%ebp
+      a3:	56                   	push   %esi
+      a4:	53                   	push   %ebx
+      a5:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+      a8:	bb f4 01 00 00       	mov    $0x1f4,%ebx
+      ad:	83 ec 20             	sub    $0x20,%esp
+  struct stat st;
+  int i;
+
+  for(i = 0; i < NLOOKUP; i++){
+    if(stat("/readbench.dir/../readbench.file", &st) < 0){
+      b0:	83 ec 08             	sub    $0x8,%esp
+      b3:	56                   	push   %esi
+      b4:	68 f8 11 00 00       	push   $0x11f8
+      b9:	e8 12 04 00 00       	call   4d0 <stat>
+      be:	83 c4 10             	add    $0x10,%esp
+      c1:	85 c0                	test   %eax,%eax
+      c3:	78 0c                	js     d1 <lookup+0x31>
+  for(i = 0; i < NLOOKUP; i++){
+      c5:	83 eb 01             	sub    $0x1,%ebx
+      c8:	75 e6                	jne    b0 <lookup+0x10>
+      printf(1, "readbench: stat failed\n");
+      exit();
+    }
+  }
+}
+      ca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      cd:	5b                   	pop    %ebx
+      ce:	5e                   	pop    %esi
+      cf:	5d                   	pop    %ebp
+      d0:	c3                   	ret
+      printf(1, "readbench: stat failed\n");
+      d1:	83 ec 08             	sub    $0x8,%esp
+      d4:	68 a7 11 00 00       	push   $0x11a7
+      d9:	6a 01                	push   $0x1
+      db:	e8 80 0c 00 00       	call   d60 <printf>
+      exit();
+      e0:	e8 eb 04 00 00       	call   5d0 <exit>
+      e5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000f0 <run>:
+
+void
+run(int nproc)
+{
+      f0:	55                   	push   %ebp
+      f1:	89 e5                	mov    %esp,%ebp
+      f3:	57                   	push   %edi
+      f4:	56                   	push   %esi
+      f5:	53                   	push   %ebx
+      f6:	83 ec 3c             	sub    $0x3c,%esp
+      f9:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i, t0, tr, tl;
+
+  t0 = uptime();
+      fc:	e8 77 07 00 00       	call   878 <uptime>
+     101:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  for(i = 0; i < nproc; i++){
+     104:	85 f6                	test   %esi,%esi
+     106:	0f 8e ad 00 00 00    	jle    1b9 <run+0xc9>
+     10c:	31 db                	xor    %ebx,%ebx
+     10e:	eb 02                	jmp    112 <run+0x22>
+     110:	89 c3                	mov    %eax,%ebx
+    if(fork() == 0){
+     112:	e8 89 04 00 00       	call   5a0 <fork>
+     117:	85 c0                	test   %eax,%eax
+     119:	0f 84 b1 00 00 00    	je     1d0 <run+0xe0>
+  for(i = 0; i < nproc; i++){
+     11f:	8d 43 01             	lea    0x1(%ebx),%eax
+     122:	39 c6                	cmp    %eax,%esi
+     124:	75 ea                	jne    110 <run+0x20>
+      reader();
+      exit();
+    }
+  }
+  for(i = 0; i < nproc; i++)
+     126:	31 ff                	xor    %edi,%edi
+     128:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     12f:	90                   	nop
+    wait();
+     130:	e8 b3 06 00 00       	call   7e8 <wait>
+  for(i = 0; i < nproc; i++)
+     135:	89 f8                	mov    %edi,%eax
+     137:	83 c7 01             	add    $0x1,%edi
+     13a:	39 c3                	cmp    %eax,%ebx
+     13c:	75 f2                	jne    130 <run+0x40>
+  tr = uptime() - t0;
+     13e:	e8 35 07 00 00       	call   878 <uptime>
+     143:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+
+  t0 = uptime();
+  for(i = 0; i < nproc; i++){
+     146:	31 ff                	xor    %edi,%edi
+  tr = uptime() - t0;
+     148:	29 c8                	sub    %ecx,%eax
+     14a:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  t0 = uptime();
+     14d:	e8 26 07 00 00       	call   878 <uptime>
+     152:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  for(i = 0; i < nproc; i++){
+     155:	eb 0b                	jmp    162 <run+0x72>
+     157:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     15e:	66 90                	xchg   %ax,%ax
+     160:	89 c7                	mov    %eax,%edi
+    if(fork() == 0){
+     162:	e8 39 04 00 00       	call   5a0 <fork>
+     167:	85 c0                	test   %eax,%eax
+     169:	74 6f                	je     1da <run+0xea>
+  for(i = 0; i < nproc; i++){
+     16b:	8d 47 01             	lea    0x1(%edi),%eax
+     16e:	39 fb                	cmp    %edi,%ebx
+     170:	75 ee                	jne    160 <run+0x70>
+      lookup();
+      exit();
+    }
+  }
+  for(i = 0; i < nproc; i++)
+     172:	31 ff                	xor    %edi,%edi
+     174:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    wait();
+     178:	e8 6b 06 00 00       	call   7e8 <wait>
+  for(i = 0; i < nproc; i++)
+     17d:	89 f8                	mov    %edi,%eax
+     17f:	83 c7 01             	add    $0x1,%edi
+     182:	39 c3                	cmp    %eax,%ebx
+     184:	75 f2                	jne    178 <run+0x88>
+  tl = uptime() - t0;
+     186:	e8 ed 06 00 00       	call   878 <uptime>
+     18b:	8b 55 c0             	mov    -0x40(%ebp),%edx
+
+  printf(1, "readbench: %d readers: %d KB in %d ticks; %d lookups in %d ticks\n",
+     18e:	83 ec 04             	sub    $0x4,%esp
+  tl = uptime() - t0;
+     191:	29 d0                	sub    %edx,%eax
+  printf(1, "readbench: %d readers: %d KB in %d ticks; %d lookups in %d ticks\n",
+     193:	50                   	push   %eax
+     194:	69 c6 f4 01 00 00    	imul   $0x1f4,%esi,%eax
+     19a:	50                   	push   %eax
+     19b:	89 f0                	mov    %esi,%eax
+     19d:	c1 e0 0a             	shl    $0xa,%eax
+     1a0:	ff 75 c4             	push   -0x3c(%ebp)
+     1a3:	50                   	push   %eax
+     1a4:	56                   	push   %esi
+     1a5:	68 1c 12 00 00       	push   $0x121c
+     1aa:	6a 01                	push   $0x1
+     1ac:	e8 af 0b 00 00       	call   d60 <printf>
+         nproc, nproc * NREAD / 1024, tr, nproc * NLOOKUP, tl);
+}
+     1b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     1b4:	5b                   	pop    %ebx
+     1b5:	5e                   	pop    %esi
+     1b6:	5f                   	pop    %edi
+     1b7:	5d                   	pop    %ebp
+     1b8:	c3                   	ret
+  tr = uptime() - t0;
+     1b9:	e8 ba 06 00 00       	call   878 <uptime>
+     1be:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+     1c1:	29 c8                	sub    %ecx,%eax
+     1c3:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  t0 = uptime();
+     1c6:	e8 ad 06 00 00       	call   878 <uptime>
+     1cb:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  for(i = 0; i < nproc; i++)
+     1ce:	eb b6                	jmp    186 <run+0x96>
+      reader();
+     1d0:	e8 2b fe ff ff       	call   0 <reader>
+      exit();
+     1d5:	e8 f6 03 00 00       	call   5d0 <exit>
+     1da:	bb f4 01 00 00       	mov    $0x1f4,%ebx
+     1df:	8d 75 d4             	lea    -0x2c(%ebp),%esi
+     1e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(stat("/readbench.dir/../readbench.file", &st) < 0){
+     1e8:	83 ec 08             	sub    $0x8,%esp
+     1eb:	56                   	push   %esi
+     1ec:	68 f8 11 00 00       	push   $0x11f8
+     1f1:	e8 da 02 00 00       	call   4d0 <stat>
+     1f6:	83 c4 10             	add    $0x10,%esp
+     1f9:	85 c0                	test   %eax,%eax
+     1fb:	78 0a                	js     207 <run+0x117>
+  for(i = 0; i < NLOOKUP; i++){
+     1fd:	83 eb 01             	sub    $0x1,%ebx
+     200:	75 e6                	jne    1e8 <run+0xf8>
+      exit();
+     202:	e8 c9 03 00 00       	call   5d0 <exit>
+      printf(1, "readbench: stat failed\n");
+     207:	50                   	push   %eax
+     208:	50                   	push   %eax
+     209:	68 a7 11 00 00       	push   $0x11a7
+     20e:	6a 01                	push   $0x1
+     210:	e8 4b 0b 00 00       	call   d60 <printf>
+      exit();
+     215:	e8 b6 03 00 00       	call   5d0 <exit>
+     21a:	66 90                	xchg   %ax,%ax
+     21c:	66 90                	xchg   %ax,%ax
+     21e:	66 90                	xchg   %ax,%ax
+
+00000220 <main>:
+
+int
+main(int argc, char *argv[])
+{
+     220:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     224:	83 e4 f0             	and    $0xfffffff0,%esp
+     227:	ff 71 fc             	push   -0x4(%ecx)
+     22a:	55                   	push   %ebp
+     22b:	89 e5                	mov    %esp,%ebp
+     22d:	56                   	push   %esi
+     22e:	53                   	push   %ebx
+     22f:	51                   	push   %ecx
+     230:	83 ec 14             	sub    $0x14,%esp
+  int fd, i, n;
+
+  if((fd = open("readbench.file", O_CREATE|O_RDWR)) < 0 ||
+     233:	68 02 02 00 00       	push   $0x202
+     238:	68 98 11 00 00       	push   $0x1198
+     23d:	e8 de 05 00 00       	call   820 <open>
+     242:	83 c4 10             	add    $0x10,%esp
+     245:	85 c0                	test   %eax,%eax
+     247:	0f 88 a0 00 00 00    	js     2ed <main+0xcd>
+     mkdir("readbench.dir") < 0){
+     24d:	83 ec 0c             	sub    $0xc,%esp
+     250:	89 c6                	mov    %eax,%esi
+     252:	68 bf 11 00 00       	push   $0x11bf
+     257:	e8 ec 05 00 00       	call   848 <mkdir>
+  if((fd = open("readbench.file", O_CREATE|O_RDWR)) < 0 ||
+     25c:	83 c4 10             	add    $0x10,%esp
+     25f:	85 c0                	test   %eax,%eax
+     261:	0f 88 86 00 00 00    	js     2ed <main+0xcd>
+    printf(1, "readbench: cannot create readbench.file or readbench.dir\n");
+    exit();
+  }
+  for(i = 0; i < sizeof(buf); i++)
+     267:	31 c0                	xor    %eax,%eax
+     269:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    buf[i] = i;
+     270:	88 80 20 22 00 00    	mov    %al,0x2220(%eax)
+  for(i = 0; i < sizeof(buf); i++)
+     276:	83 c0 01             	add    $0x1,%eax
+     279:	3d 00 10 00 00       	cmp    $0x1000,%eax
+     27e:	75 f0                	jne    270 <main+0x50>
+     280:	bb 10 00 00 00       	mov    $0x10,%ebx
+     285:	8d 76 00             	lea    0x0(%esi),%esi
+  for(n = 0; n < FILESZ; n += sizeof(buf))
+    write(fd, buf, sizeof(buf));
+     288:	83 ec 04             	sub    $0x4,%esp
+     28b:	68 00 10 00 00       	push   $0x1000
+     290:	68 20 22 00 00       	push   $0x2220
+     295:	56                   	push   %esi
+     296:	e8 05 04 00 00       	call   6a0 <write>
+  for(n = 0; n < FILESZ; n += sizeof(buf))
+     29b:	83 c4 10             	add    $0x10,%esp
+     29e:	83 eb 01             	sub    $0x1,%ebx
+     2a1:	75 e5                	jne    288 <main+0x68>
+  close(fd);
+     2a3:	83 ec 0c             	sub    $0xc,%esp
+     2a6:	56                   	push   %esi
+     2a7:	e8 74 04 00 00       	call   720 <close>
+
+  for(n = 1; n <= 4; n *= 2)
+    run(n);
+     2ac:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     2b3:	e8 38 fe ff ff       	call   f0 <run>
+     2b8:	c7 04 24 02 00 00 00 	movl   $0x2,(%esp)
+     2bf:	e8 2c fe ff ff       	call   f0 <run>
+     2c4:	c7 04 24 04 00 00 00 	movl   $0x4,(%esp)
+     2cb:	e8 20 fe ff ff       	call   f0 <run>
+  unlink("readbench.dir");
+     2d0:	c7 04 24 bf 11 00 00 	movl   $0x11bf,(%esp)
+     2d7:	e8 54 05 00 00       	call   830 <unlink>
+  unlink("readbench.file");
+     2dc:	c7 04 24 98 11 00 00 	movl   $0x1198,(%esp)
+     2e3:	e8 48 05 00 00       	call   830 <unlink>
+  exit();
+     2e8:	e8 e3 02 00 00       	call   5d0 <exit>
+    printf(1, "readbench: cannot create readbench.file or readbench.dir\n");
+     2ed:	50                   	push   %eax
+     2ee:	50                   	push   %eax
+     2ef:	68 60 12 00 00       	push   $0x1260
+     2f4:	6a 01                	push   $0x1
+     2f6:	e8 65 0a 00 00       	call   d60 <printf>
+    exit();
+     2fb:	e8 d0 02 00 00       	call   5d0 <exit>
+
+00000300 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     300:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     301:	31 c0                	xor    %eax,%eax
+{
+     303:	89 e5                	mov    %esp,%ebp
+     305:	53                   	push   %ebx
+     306:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     309:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     30c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     310:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     314:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     317:	83 c0 01             	add    $0x1,%eax
+     31a:	84 d2                	test   %dl,%dl
+     31c:	75 f2                	jne    310 <strcpy+0x10>
+    ;
+  return os;
+}
+     31e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     321:	89 c8                	mov    %ecx,%eax
+     323:	c9                   	leave
+     324:	c3                   	ret
+     325:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     32c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000330 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     330:	55                   	push   %ebp
+     331:	89 e5                	mov    %esp,%ebp
+     333:	53                   	push   %ebx
+     334:	8b 55 08             	mov    0x8(%ebp),%edx
+     337:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     33a:	0f b6 02             	movzbl (%edx),%eax
+     33d:	84 c0                	test   %al,%al
+     33f:	75 17                	jne    358 <strcmp+0x28>
+     341:	eb 3a                	jmp    37d <strcmp+0x4d>
+     343:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     347:	90                   	nop
+     348:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     34c:	83 c2 01             	add    $0x1,%edx
+     34f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     352:	84 c0                	test   %al,%al
+     354:	74 1a                	je     370 <strcmp+0x40>
+    p++, q++;
+     356:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     358:	0f b6 19             	movzbl (%ecx),%ebx
+     35b:	38 c3                	cmp    %al,%bl
+     35d:	74 e9                	je     348 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     35f:	29 d8                	sub    %ebx,%eax
+}
+     361:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     364:	c9                   	leave
+     365:	c3                   	ret
+     366:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     36d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     370:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     374:	31 c0                	xor    %eax,%eax
+     376:	29 d8                	sub    %ebx,%eax
+}
+     378:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     37b:	c9                   	leave
+     37c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     37d:	0f b6 19             	movzbl (%ecx),%ebx
+     380:	31 c0                	xor    %eax,%eax
+     382:	eb db                	jmp    35f <strcmp+0x2f>
+     384:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     38b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     38f:	90                   	nop
+
+00000390 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     390:	55                   	push   %ebp
+     391:	89 e5                	mov    %esp,%ebp
+     393:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     396:	80 3a 00             	cmpb   $0x0,(%edx)
+     399:	74 15                	je     3b0 <strlen+0x20>
+     39b:	31 c0                	xor    %eax,%eax
+     39d:	8d 76 00             	lea    0x0(%esi),%esi
+     3a0:	83 c0 01             	add    $0x1,%eax
+     3a3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     3a7:	89 c1                	mov    %eax,%ecx
+     3a9:	75 f5                	jne    3a0 <strlen+0x10>
+    ;
+  return n;
+}
+     3ab:	89 c8                	mov    %ecx,%eax
+     3ad:	5d                   	pop    %ebp
+     3ae:	c3                   	ret
+     3af:	90                   	nop
+  for(n = 0; s[n]; n++)
+     3b0:	31 c9                	xor    %ecx,%ecx
+}
+     3b2:	5d                   	pop    %ebp
+     3b3:	89 c8                	mov    %ecx,%eax
+     3b5:	c3                   	ret
+     3b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003c0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     3c0:	55                   	push   %ebp
+     3c1:	89 e5                	mov    %esp,%ebp
+     3c3:	57                   	push   %edi
+     3c4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     3c7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     3ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+     3cd:	89 d7                	mov    %edx,%edi
+     3cf:	fc                   	cld
+     3d0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     3d2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     3d5:	89 d0                	mov    %edx,%eax
+     3d7:	c9                   	leave
+     3d8:	c3                   	ret
+     3d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003e0 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     3e0:	55                   	push   %ebp
+     3e1:	89 e5                	mov    %esp,%ebp
+     3e3:	56                   	push   %esi
+     3e4:	53                   	push   %ebx
+     3e5:	8b 75 10             	mov    0x10(%ebp),%esi
+     3e8:	8b 55 08             	mov    0x8(%ebp),%edx
+     3eb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+     3ee:	85 f6                	test   %esi,%esi
+     3f0:	74 2e                	je     420 <memcmp+0x40>
+     3f2:	01 c6                	add    %eax,%esi
+     3f4:	eb 14                	jmp    40a <memcmp+0x2a>
+     3f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3fd:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+     400:	83 c0 01             	add    $0x1,%eax
+     403:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+     406:	39 f0                	cmp    %esi,%eax
+     408:	74 16                	je     420 <memcmp+0x40>
+    if(*s1 != *s2)
+     40a:	0f b6 0a             	movzbl (%edx),%ecx
+     40d:	0f b6 18             	movzbl (%eax),%ebx
+     410:	38 d9                	cmp    %bl,%cl
+     412:	74 ec                	je     400 <memcmp+0x20>
+      return *s1 - *s2;
+     414:	0f b6 c1             	movzbl %cl,%eax
+     417:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+     419:	5b                   	pop    %ebx
+     41a:	5e                   	pop    %esi
+     41b:	5d                   	pop    %ebp
+     41c:	c3                   	ret
+     41d:	8d 76 00             	lea    0x0(%esi),%esi
+     420:	5b                   	pop    %ebx
+  return 0;
+     421:	31 c0                	xor    %eax,%eax
+}
+     423:	5e                   	pop    %esi
+     424:	5d                   	pop    %ebp
+     425:	c3                   	ret
+     426:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     42d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000430 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     430:	55                   	push   %ebp
+     431:	89 e5                	mov    %esp,%ebp
+     433:	8b 45 08             	mov    0x8(%ebp),%eax
+     436:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     43a:	0f b6 10             	movzbl (%eax),%edx
+     43d:	84 d2                	test   %dl,%dl
+     43f:	75 12                	jne    453 <strchr+0x23>
+     441:	eb 1d                	jmp    460 <strchr+0x30>
+     443:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     447:	90                   	nop
+     448:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     44c:	83 c0 01             	add    $0x1,%eax
+     44f:	84 d2                	test   %dl,%dl
+     451:	74 0d                	je     460 <strchr+0x30>
+    if(*s == c)
+     453:	38 d1                	cmp    %dl,%cl
+     455:	75 f1                	jne    448 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     457:	5d                   	pop    %ebp
+     458:	c3                   	ret
+     459:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     460:	31 c0                	xor    %eax,%eax
+}
+     462:	5d                   	pop    %ebp
+     463:	c3                   	ret
+     464:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     46b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     46f:	90                   	nop
+
+00000470 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     470:	55                   	push   %ebp
+     471:	89 e5                	mov    %esp,%ebp
+     473:	57                   	push   %edi
+     474:	56                   	push   %esi
+int
+read(int fd, void *buf, int n)
+{
+  if(flushhook)
+    flushhook();
+  return _read(fd, buf, n);
+     475:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     478:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     479:	31 db                	xor    %ebx,%ebx
+{
+     47b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     47e:	eb 32                	jmp    4b2 <gets+0x42>
+  if(flushhook)
+     480:	a1 20 32 00 00       	mov    0x3220,%eax
+     485:	85 c0                	test   %eax,%eax
+     487:	74 02                	je     48b <gets+0x1b>
+    flushhook();
+     489:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+     48b:	83 ec 04             	sub    $0x4,%esp
+     48e:	6a 01                	push   $0x1
+     490:	56                   	push   %esi
+     491:	6a 00                	push   $0x0
+     493:	e8 60 03 00 00       	call   7f8 <_read>
+    if(cc < 1)
+     498:	83 c4 10             	add    $0x10,%esp
+     49b:	85 c0                	test   %eax,%eax
+     49d:	7e 1d                	jle    4bc <gets+0x4c>
+    buf[i++] = c;
+     49f:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     4a3:	8b 55 08             	mov    0x8(%ebp),%edx
+     4a6:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     4aa:	3c 0a                	cmp    $0xa,%al
+     4ac:	74 10                	je     4be <gets+0x4e>
+     4ae:	3c 0d                	cmp    $0xd,%al
+     4b0:	74 0c                	je     4be <gets+0x4e>
+  for(i=0; i+1 < max; ){
+     4b2:	89 df                	mov    %ebx,%edi
+     4b4:	83 c3 01             	add    $0x1,%ebx
+     4b7:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     4ba:	7c c4                	jl     480 <gets+0x10>
+     4bc:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+     4be:	8b 45 08             	mov    0x8(%ebp),%eax
+     4c1:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+     4c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     4c8:	5b                   	pop    %ebx
+     4c9:	5e                   	pop    %esi
+     4ca:	5f                   	pop    %edi
+     4cb:	5d                   	pop    %ebp
+     4cc:	c3                   	ret
+     4cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000004d0 <stat>:
+{
+     4d0:	55                   	push   %ebp
+     4d1:	89 e5                	mov    %esp,%ebp
+     4d3:	56                   	push   %esi
+     4d4:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+     4d5:	83 ec 08             	sub    $0x8,%esp
+     4d8:	6a 00                	push   $0x0
+     4da:	ff 75 08             	push   0x8(%ebp)
+     4dd:	e8 3e 03 00 00       	call   820 <open>
+  if(fd < 0)
+     4e2:	83 c4 10             	add    $0x10,%esp
+     4e5:	85 c0                	test   %eax,%eax
+     4e7:	78 37                	js     520 <stat+0x50>
+  r = fstat(fd, st);
+     4e9:	83 ec 08             	sub    $0x8,%esp
+     4ec:	ff 75 0c             	push   0xc(%ebp)
+     4ef:	89 c3                	mov    %eax,%ebx
+     4f1:	50                   	push   %eax
+     4f2:	e8 41 03 00 00       	call   838 <fstat>
+}
+
+int
+close(int fd)
+{
+  if(flushhook)
+     4f7:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+     4fa:	89 c6                	mov    %eax,%esi
+  if(flushhook)
+     4fc:	a1 20 32 00 00       	mov    0x3220,%eax
+     501:	85 c0                	test   %eax,%eax
+     503:	74 02                	je     507 <stat+0x37>
+    flushhook();
+     505:	ff d0                	call   *%eax
+  return _close(fd);
+     507:	83 ec 0c             	sub    $0xc,%esp
+     50a:	53                   	push   %ebx
+     50b:	e8 f8 02 00 00       	call   808 <_close>
+     510:	83 c4 10             	add    $0x10,%esp
+}
+     513:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     516:	89 f0                	mov    %esi,%eax
+     518:	5b                   	pop    %ebx
+     519:	5e                   	pop    %esi
+     51a:	5d                   	pop    %ebp
+     51b:	c3                   	ret
+     51c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+     520:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     525:	eb ec                	jmp    513 <stat+0x43>
+     527:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     52e:	66 90                	xchg   %ax,%ax
+
+00000530 <atoi>:
+{
+     530:	55                   	push   %ebp
+     531:	89 e5                	mov    %esp,%ebp
+     533:	53                   	push   %ebx
+     534:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+     537:	0f be 02             	movsbl (%edx),%eax
+     53a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     53d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     540:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     545:	77 1e                	ja     565 <atoi+0x35>
+     547:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     54e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     550:	83 c2 01             	add    $0x1,%edx
+     553:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     556:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     55a:	0f be 02             	movsbl (%edx),%eax
+     55d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     560:	80 fb 09             	cmp    $0x9,%bl
+     563:	76 eb                	jbe    550 <atoi+0x20>
+}
+     565:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     568:	89 c8                	mov    %ecx,%eax
+     56a:	c9                   	leave
+     56b:	c3                   	ret
+     56c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000570 <memmove>:
+{
+     570:	55                   	push   %ebp
+     571:	89 e5                	mov    %esp,%ebp
+     573:	57                   	push   %edi
+     574:	56                   	push   %esi
+     575:	8b 45 10             	mov    0x10(%ebp),%eax
+     578:	8b 55 08             	mov    0x8(%ebp),%edx
+     57b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+     57e:	85 c0                	test   %eax,%eax
+     580:	7e 13                	jle    595 <memmove+0x25>
+     582:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     584:	89 d7                	mov    %edx,%edi
+     586:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     58d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     590:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     591:	39 f8                	cmp    %edi,%eax
+     593:	75 fb                	jne    590 <memmove+0x20>
+}
+     595:	5e                   	pop    %esi
+     596:	89 d0                	mov    %edx,%eax
+     598:	5f                   	pop    %edi
+     599:	5d                   	pop    %ebp
+     59a:	c3                   	ret
+     59b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     59f:	90                   	nop
+
+000005a0 <fork>:
+  if(flushhook)
+     5a0:	a1 20 32 00 00       	mov    0x3220,%eax
+     5a5:	85 c0                	test   %eax,%eax
+     5a7:	74 17                	je     5c0 <fork+0x20>
+{
+     5a9:	55                   	push   %ebp
+     5aa:	89 e5                	mov    %esp,%ebp
+     5ac:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+     5af:	ff d0                	call   *%eax
+}
+     5b1:	c9                   	leave
+  return _fork();
+     5b2:	e9 21 02 00 00       	jmp    7d8 <_fork>
+     5b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5be:	66 90                	xchg   %ax,%ax
+     5c0:	e9 13 02 00 00       	jmp    7d8 <_fork>
+     5c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005d0 <exit>:
+{
+     5d0:	55                   	push   %ebp
+     5d1:	89 e5                	mov    %esp,%ebp
+     5d3:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+     5d6:	a1 20 32 00 00       	mov    0x3220,%eax
+     5db:	85 c0                	test   %eax,%eax
+     5dd:	74 02                	je     5e1 <exit+0x11>
+    flushhook();
+     5df:	ff d0                	call   *%eax
+  _exit();
+     5e1:	e8 fa 01 00 00       	call   7e0 <_exit>
+     5e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000005f0 <exec>:
+{
+     5f0:	55                   	push   %ebp
+  if(flushhook)
+     5f1:	a1 20 32 00 00       	mov    0x3220,%eax
+{
+     5f6:	89 e5                	mov    %esp,%ebp
+     5f8:	56                   	push   %esi
+     5f9:	53                   	push   %ebx
+     5fa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     5fd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+     600:	85 c0                	test   %eax,%eax
+     602:	74 02                	je     606 <exec+0x16>
+    flushhook();
+     604:	ff d0                	call   *%eax
+  return _exec(path, argv);
+     606:	89 75 0c             	mov    %esi,0xc(%ebp)
+     609:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     60c:	5b                   	pop    %ebx
+     60d:	5e                   	pop    %esi
+     60e:	5d                   	pop    %ebp
+  return _exec(path, argv);
+     60f:	e9 04 02 00 00       	jmp    818 <_exec>
+     614:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     61b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     61f:	90                   	nop
+
+00000620 <read>:
+{
+     620:	55                   	push   %ebp
+     621:	89 e5                	mov    %esp,%ebp
+     623:	57                   	push   %edi
+     624:	56                   	push   %esi
+     625:	53                   	push   %ebx
+     626:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     629:	a1 20 32 00 00       	mov    0x3220,%eax
+{
+     62e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     631:	8b 75 0c             	mov    0xc(%ebp),%esi
+     634:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     637:	85 c0                	test   %eax,%eax
+     639:	74 02                	je     63d <read+0x1d>
+    flushhook();
+     63b:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+     63d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     640:	89 75 0c             	mov    %esi,0xc(%ebp)
+     643:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     646:	83 c4 0c             	add    $0xc,%esp
+     649:	5b                   	pop    %ebx
+     64a:	5e                   	pop    %esi
+     64b:	5f                   	pop    %edi
+     64c:	5d                   	pop    %ebp
+  return _read(fd, buf, n);
+     64d:	e9 a6 01 00 00       	jmp    7f8 <_read>
+     652:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     659:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000660 <readv>:
+{
+     660:	55                   	push   %ebp
+     661:	89 e5                	mov    %esp,%ebp
+     663:	57                   	push   %edi
+     664:	56                   	push   %esi
+     665:	53                   	push   %ebx
+     666:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     669:	a1 20 32 00 00       	mov    0x3220,%eax
+{
+     66e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     671:	8b 75 0c             	mov    0xc(%ebp),%esi
+     674:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     677:	85 c0                	test   %eax,%eax
+     679:	74 02                	je     67d <readv+0x1d>
+    flushhook();
+     67b:	ff d0                	call   *%eax
+  return _readv(fd, iov, cnt);
+     67d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     680:	89 75 0c             	mov    %esi,0xc(%ebp)
+     683:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     686:	83 c4 0c             	add    $0xc,%esp
+     689:	5b                   	pop    %ebx
+     68a:	5e                   	pop    %esi
+     68b:	5f                   	pop    %edi
+     68c:	5d                   	pop    %ebp
+  return _readv(fd, iov, cnt);
+     68d:	e9 76 02 00 00       	jmp    908 <_readv>
+     692:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     699:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000006a0 <write>:
+{
+     6a0:	55                   	push   %ebp
+     6a1:	89 e5                	mov    %esp,%ebp
+     6a3:	57                   	push   %edi
+     6a4:	56                   	push   %esi
+     6a5:	53                   	push   %ebx
+     6a6:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     6a9:	a1 20 32 00 00       	mov    0x3220,%eax
+{
+     6ae:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     6b1:	8b 75 0c             	mov    0xc(%ebp),%esi
+     6b4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     6b7:	85 c0                	test   %eax,%eax
+     6b9:	74 02                	je     6bd <write+0x1d>
+    flushhook();
+     6bb:	ff d0                	call   *%eax
+  return _write(fd, buf, n);
+     6bd:	89 7d 10             	mov    %edi,0x10(%ebp)
+     6c0:	89 75 0c             	mov    %esi,0xc(%ebp)
+     6c3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     6c6:	83 c4 0c             	add    $0xc,%esp
+     6c9:	5b                   	pop    %ebx
+     6ca:	5e                   	pop    %esi
+     6cb:	5f                   	pop    %edi
+     6cc:	5d                   	pop    %ebp
+  return _write(fd, buf, n);
+     6cd:	e9 2e 01 00 00       	jmp    800 <_write>
+     6d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000006e0 <writev>:
+{
+     6e0:	55                   	push   %ebp
+     6e1:	89 e5                	mov    %esp,%ebp
+     6e3:	57                   	push   %edi
+     6e4:	56                   	push   %esi
+     6e5:	53                   	push   %ebx
+     6e6:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     6e9:	a1 20 32 00 00       	mov    0x3220,%eax
+{
+     6ee:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     6f1:	8b 75 0c             	mov    0xc(%ebp),%esi
+     6f4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     6f7:	85 c0                	test   %eax,%eax
+     6f9:	74 02                	je     6fd <writev+0x1d>
+    flushhook();
+     6fb:	ff d0                	call   *%eax
+  return _writev(fd, iov, cnt);
+     6fd:	89 7d 10             	mov    %edi,0x10(%ebp)
+     700:	89 75 0c             	mov    %esi,0xc(%ebp)
+     703:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     706:	83 c4 0c             	add    $0xc,%esp
+     709:	5b                   	pop    %ebx
+     70a:	5e                   	pop    %esi
+     70b:	5f                   	pop    %edi
+     70c:	5d                   	pop    %ebp
+  return _writev(fd, iov, cnt);
+     70d:	e9 fe 01 00 00       	jmp    910 <_writev>
+     712:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     719:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000720 <close>:
+{
+     720:	55                   	push   %ebp
+     721:	89 e5                	mov    %esp,%ebp
+     723:	53                   	push   %ebx
+     724:	83 ec 04             	sub    $0x4,%esp
+  if(flushhook)
+     727:	a1 20 32 00 00       	mov    0x3220,%eax
+{
+     72c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(flushhook)
+     72f:	85 c0                	test   %eax,%eax
+     731:	74 02                	je     735 <close+0x15>
+    flushhook();
+     733:	ff d0                	call   *%eax
+  return _close(fd);
+     735:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     738:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     73b:	c9                   	leave
+  return _close(fd);
+     73c:	e9 c7 00 00 00       	jmp    808 <_close>
+     741:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     748:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     74f:	90                   	nop
+
+00000750 <umtxinit>:
+// process that finds the mutex held enters the kernel, to sleep
+// in futexwait() until the holder's umtxunlock() wakes it.
+
+void
+umtxinit(struct umutex *m)
+{
+     750:	55                   	push   %ebp
+     751:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+     753:	8b 45 08             	mov    0x8(%ebp),%eax
+     756:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     75c:	5d                   	pop    %ebp
+     75d:	c3                   	ret
+     75e:	66 90                	xchg   %ax,%ax
+
+00000760 <umtxlock>:
+
+void
+umtxlock(struct umutex *m)
+{
+     760:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+     761:	b8 01 00 00 00       	mov    $0x1,%eax
+     766:	89 e5                	mov    %esp,%ebp
+     768:	56                   	push   %esi
+     769:	53                   	push   %ebx
+     76a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     76d:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 1) == 0)
+     770:	85 c0                	test   %eax,%eax
+     772:	74 2b                	je     79f <umtxlock+0x3f>
+     774:	b8 02 00 00 00       	mov    $0x2,%eax
+     779:	f0 87 03             	lock xchg %eax,(%ebx)
+    return;
+  // Mark the mutex contended, so that its holder
+  // wakes a waiter on release, and wait.
+  while(xchg(&m->state, 2) != 0)
+     77c:	85 c0                	test   %eax,%eax
+     77e:	74 1f                	je     79f <umtxlock+0x3f>
+     780:	be 02 00 00 00       	mov    $0x2,%esi
+     785:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwait(&m->state, 2);
+     788:	83 ec 08             	sub    $0x8,%esp
+     78b:	6a 02                	push   $0x2
+     78d:	53                   	push   %ebx
+     78e:	e8 85 01 00 00       	call   918 <futexwait>
+     793:	89 f0                	mov    %esi,%eax
+     795:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+     798:	83 c4 10             	add    $0x10,%esp
+     79b:	85 c0                	test   %eax,%eax
+     79d:	75 e9                	jne    788 <umtxlock+0x28>
+}
+     79f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     7a2:	5b                   	pop    %ebx
+     7a3:	5e                   	pop    %esi
+     7a4:	5d                   	pop    %ebp
+     7a5:	c3                   	ret
+     7a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000007b0 <umtxunlock>:
+
+void
+umtxunlock(struct umutex *m)
+{
+     7b0:	55                   	push   %ebp
+     7b1:	31 c0                	xor    %eax,%eax
+     7b3:	89 e5                	mov    %esp,%ebp
+     7b5:	83 ec 08             	sub    $0x8,%esp
+     7b8:	8b 55 08             	mov    0x8(%ebp),%edx
+     7bb:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+     7be:	83 f8 02             	cmp    $0x2,%eax
+     7c1:	74 05                	je     7c8 <umtxunlock+0x18>
+    futexwake(&m->state, 1);
+}
+     7c3:	c9                   	leave
+     7c4:	c3                   	ret
+     7c5:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwake(&m->state, 1);
+     7c8:	83 ec 08             	sub    $0x8,%esp
+     7cb:	6a 01                	push   $0x1
+     7cd:	52                   	push   %edx
+     7ce:	e8 4d 01 00 00       	call   920 <futexwake>
+     7d3:	83 c4 10             	add    $0x10,%esp
+}
+     7d6:	c9                   	leave
+     7d7:	c3                   	ret
+
+000007d8 <_fork>:
+  _ ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+     7d8:	b8 01 00 00 00       	mov    $0x1,%eax
+     7dd:	cd 40                	int    $0x40
+     7df:	c3                   	ret
+
+000007e0 <_exit>:
+RAWSYSCALL(exit)
+     7e0:	b8 02 00 00 00       	mov    $0x2,%eax
+     7e5:	cd 40                	int    $0x40
+     7e7:	c3                   	ret
+
+000007e8 <wait>:
+SYSCALL(wait)
+     7e8:	b8 03 00 00 00       	mov    $0x3,%eax
+     7ed:	cd 40                	int    $0x40
+     7ef:	c3                   	ret
+
+000007f0 <pipe>:
+SYSCALL(pipe)
+     7f0:	b8 04 00 00 00       	mov    $0x4,%eax
+     7f5:	cd 40                	int    $0x40
+     7f7:	c3                   	ret
+
+000007f8 <_read>:
+RAWSYSCALL(read)
+     7f8:	b8 05 00 00 00       	mov    $0x5,%eax
+     7fd:	cd 40                	int    $0x40
+     7ff:	c3                   	ret
+
+00000800 <_write>:
+RAWSYSCALL(write)
+     800:	b8 10 00 00 00       	mov    $0x10,%eax
+     805:	cd 40                	int    $0x40
+     807:	c3                   	ret
+
+00000808 <_close>:
+RAWSYSCALL(close)
+     808:	b8 15 00 00 00       	mov    $0x15,%eax
+     80d:	cd 40                	int    $0x40
+     80f:	c3                   	ret
+
+00000810 <kill>:
+SYSCALL(kill)
+     810:	b8 06 00 00 00       	mov    $0x6,%eax
+     815:	cd 40                	int    $0x40
+     817:	c3                   	ret
+
+00000818 <_exec>:
+RAWSYSCALL(exec)
+     818:	b8 07 00 00 00       	mov    $0x7,%eax
+     81d:	cd 40                	int    $0x40
+     81f:	c3                   	ret
+
+00000820 <open>:
+SYSCALL(open)
+     820:	b8 0f 00 00 00       	mov    $0xf,%eax
+     825:	cd 40                	int    $0x40
+     827:	c3                   	ret
+
+00000828 <mknod>:
+SYSCALL(mknod)
+     828:	b8 11 00 00 00       	mov    $0x11,%eax
+     82d:	cd 40                	int    $0x40
+     82f:	c3                   	ret
+
+00000830 <unlink>:
+SYSCALL(unlink)
+     830:	b8 12 00 00 00       	mov    $0x12,%eax
+     835:	cd 40                	int    $0x40
+     837:	c3                   	ret
+
+00000838 <fstat>:
+SYSCALL(fstat)
+     838:	b8 08 00 00 00       	mov    $0x8,%eax
+     83d:	cd 40                	int    $0x40
+     83f:	c3                   	ret
+
+00000840 <link>:
+SYSCALL(link)
+     840:	b8 13 00 00 00       	mov    $0x13,%eax
+     845:	cd 40                	int    $0x40
+     847:	c3                   	ret
+
+00000848 <mkdir>:
+SYSCALL(mkdir)
+     848:	b8 14 00 00 00       	mov    $0x14,%eax
+     84d:	cd 40                	int    $0x40
+     84f:	c3                   	ret
+
+00000850 <chdir>:
+SYSCALL(chdir)
+     850:	b8 09 00 00 00       	mov    $0x9,%eax
+     855:	cd 40                	int    $0x40
+     857:	c3                   	ret
+
+00000858 <dup>:
+SYSCALL(dup)
+     858:	b8 0a 00 00 00       	mov    $0xa,%eax
+     85d:	cd 40                	int    $0x40
+     85f:	c3                   	ret
+
+00000860 <getpid>:
+SYSCALL(getpid)
+     860:	b8 0b 00 00 00       	mov    $0xb,%eax
+     865:	cd 40                	int    $0x40
+     867:	c3                   	ret
+
+00000868 <sbrk>:
+SYSCALL(sbrk)
+     868:	b8 0c 00 00 00       	mov    $0xc,%eax
+     86d:	cd 40                	int    $0x40
+     86f:	c3                   	ret
+
+00000870 <sleep>:
+SYSCALL(sleep)
+     870:	b8 0d 00 00 00       	mov    $0xd,%eax
+     875:	cd 40                	int    $0x40
+     877:	c3                   	ret
+
+00000878 <uptime>:
+SYSCALL(uptime)
+     878:	b8 0e 00 00 00       	mov    $0xe,%eax
+     87d:	cd 40                	int    $0x40
+     87f:	c3                   	ret
+
+00000880 <wolfie>:
+SYSCALL(wolfie)
+     880:	b8 16 00 00 00       	mov    $0x16,%eax
+     885:	cd 40                	int    $0x40
+     887:	c3                   	ret
+
+00000888 <nice>:
+SYSCALL(nice)
+     888:	b8 17 00 00 00       	mov    $0x17,%eax
+     88d:	cd 40                	int    $0x40
+     88f:	c3                   	ret
+
+00000890 <mtxget>:
+SYSCALL(mtxget)
+     890:	b8 18 00 00 00       	mov    $0x18,%eax
+     895:	cd 40                	int    $0x40
+     897:	c3                   	ret
+
+00000898 <mtxrel>:
+SYSCALL(mtxrel)
+     898:	b8 19 00 00 00       	mov    $0x19,%eax
+     89d:	cd 40                	int    $0x40
+     89f:	c3                   	ret
+
+000008a0 <mtxacq>:
+SYSCALL(mtxacq)
+     8a0:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     8a5:	cd 40                	int    $0x40
+     8a7:	c3                   	ret
+
+000008a8 <mtxdel>:
+SYSCALL(mtxdel)
+     8a8:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     8ad:	cd 40                	int    $0x40
+     8af:	c3                   	ret
+
+000008b0 <iostat>:
+SYSCALL(iostat)
+     8b0:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     8b5:	cd 40                	int    $0x40
+     8b7:	c3                   	ret
+
+000008b8 <mmap>:
+SYSCALL(mmap)
+     8b8:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     8bd:	cd 40                	int    $0x40
+     8bf:	c3                   	ret
+
+000008c0 <munmap>:
+SYSCALL(munmap)
+     8c0:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     8c5:	cd 40                	int    $0x40
+     8c7:	c3                   	ret
+
+000008c8 <shmget>:
+SYSCALL(shmget)
+     8c8:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     8cd:	cd 40                	int    $0x40
+     8cf:	c3                   	ret
+
+000008d0 <shmat>:
+SYSCALL(shmat)
+     8d0:	b8 20 00 00 00       	mov    $0x20,%eax
+     8d5:	cd 40                	int    $0x40
+     8d7:	c3                   	ret
+
+000008d8 <shmdt>:
+SYSCALL(shmdt)
+     8d8:	b8 21 00 00 00       	mov    $0x21,%eax
+     8dd:	cd 40                	int    $0x40
+     8df:	c3                   	ret
+
+000008e0 <shmdel>:
+SYSCALL(shmdel)
+     8e0:	b8 22 00 00 00       	mov    $0x22,%eax
+     8e5:	cd 40                	int    $0x40
+     8e7:	c3                   	ret
+
+000008e8 <syscount>:
+SYSCALL(syscount)
+     8e8:	b8 23 00 00 00       	mov    $0x23,%eax
+     8ed:	cd 40                	int    $0x40
+     8ef:	c3                   	ret
+
+000008f0 <splice>:
+SYSCALL(splice)
+     8f0:	b8 24 00 00 00       	mov    $0x24,%eax
+     8f5:	cd 40                	int    $0x40
+     8f7:	c3                   	ret
+
+000008f8 <tee>:
+SYSCALL(tee)
+     8f8:	b8 25 00 00 00       	mov    $0x25,%eax
+     8fd:	cd 40                	int    $0x40
+     8ff:	c3                   	ret
+
+00000900 <sendfile>:
+SYSCALL(sendfile)
+     900:	b8 26 00 00 00       	mov    $0x26,%eax
+     905:	cd 40                	int    $0x40
+     907:	c3                   	ret
+
+00000908 <_readv>:
+RAWSYSCALL(readv)
+     908:	b8 27 00 00 00       	mov    $0x27,%eax
+     90d:	cd 40                	int    $0x40
+     90f:	c3                   	ret
+
+00000910 <_writev>:
+RAWSYSCALL(writev)
+     910:	b8 28 00 00 00       	mov    $0x28,%eax
+     915:	cd 40                	int    $0x40
+     917:	c3                   	ret
+
+00000918 <futexwait>:
+SYSCALL(futexwait)
+     918:	b8 29 00 00 00       	mov    $0x29,%eax
+     91d:	cd 40                	int    $0x40
+     91f:	c3                   	ret
+
+00000920 <futexwake>:
+SYSCALL(futexwake)
+     920:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     925:	cd 40                	int    $0x40
+     927:	c3                   	ret
+
+00000928 <lockstat>:
+SYSCALL(lockstat)
+     928:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     92d:	cd 40                	int    $0x40
+     92f:	c3                   	ret
+
+00000930 <clone>:
+SYSCALL(clone)
+     930:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     935:	cd 40                	int    $0x40
+     937:	c3                   	ret
+
+00000938 <join>:
+SYSCALL(join)
+     938:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     93d:	cd 40                	int    $0x40
+     93f:	c3                   	ret
+
+00000940 <stacklimit>:
+SYSCALL(stacklimit)
+     940:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     945:	cd 40                	int    $0x40
+     947:	c3                   	ret
+     948:	66 90                	xchg   %ax,%ax
+     94a:	66 90                	xchg   %ax,%ax
+     94c:	66 90                	xchg   %ax,%ax
+     94e:	66 90                	xchg   %ax,%ax
+
+00000950 <flushall>:
+  b->n = 0;
+}
+
+static void
+flushall(void)
+{
+     950:	55                   	push   %ebp
+     951:	89 e5                	mov    %esp,%ebp
+     953:	83 ec 14             	sub    $0x14,%esp
+  umtxlock(&stdoutlock);
+     956:	68 24 32 00 00       	push   $0x3224
+     95b:	e8 00 fe ff ff       	call   760 <umtxlock>
+  if(b->n > 0)
+     960:	a1 08 20 00 00       	mov    0x2008,%eax
+     965:	83 c4 10             	add    $0x10,%esp
+     968:	85 c0                	test   %eax,%eax
+     96a:	7e 17                	jle    983 <flushall+0x33>
+    _write(b->fd, b->buf, b->n);
+     96c:	83 ec 04             	sub    $0x4,%esp
+     96f:	50                   	push   %eax
+     970:	68 0c 20 00 00       	push   $0x200c
+     975:	ff 35 00 20 00 00    	push   0x2000
+     97b:	e8 80 fe ff ff       	call   800 <_write>
+     980:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     983:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     98a:	00 00 00 
+  flush(&stdout);
+  umtxunlock(&stdoutlock);
+     98d:	83 ec 0c             	sub    $0xc,%esp
+     990:	68 24 32 00 00       	push   $0x3224
+     995:	e8 16 fe ff ff       	call   7b0 <umtxunlock>
+}
+     99a:	83 c4 10             	add    $0x10,%esp
+     99d:	c9                   	leave
+     99e:	c3                   	ret
+     99f:	90                   	nop
+
+000009a0 <printint>:
+    flush(b);
+}
+
+static void
+printint(struct outbuf *b, int xx, int base, int sgn)
+{
+     9a0:	55                   	push   %ebp
+     9a1:	89 e5                	mov    %esp,%ebp
+     9a3:	57                   	push   %edi
+     9a4:	89 cf                	mov    %ecx,%edi
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     9a6:	89 d1                	mov    %edx,%ecx
+{
+     9a8:	56                   	push   %esi
+     9a9:	53                   	push   %ebx
+     9aa:	89 c3                	mov    %eax,%ebx
+     9ac:	83 ec 2c             	sub    $0x2c,%esp
+  if(sgn && xx < 0){
+     9af:	85 d2                	test   %edx,%edx
+     9b1:	0f 89 b9 00 00 00    	jns    a70 <printint+0xd0>
+     9b7:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     9bb:	0f 84 af 00 00 00    	je     a70 <printint+0xd0>
+    x = -xx;
+     9c1:	f7 d9                	neg    %ecx
+    neg = 1;
+     9c3:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     9c8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     9cb:	31 f6                	xor    %esi,%esi
+     9cd:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     9d0:	89 c8                	mov    %ecx,%eax
+     9d2:	31 d2                	xor    %edx,%edx
+     9d4:	89 f3                	mov    %esi,%ebx
+     9d6:	f7 f7                	div    %edi
+     9d8:	8d 76 01             	lea    0x1(%esi),%esi
+     9db:	0f b6 92 2c 17 00 00 	movzbl 0x172c(%edx),%edx
+     9e2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     9e6:	89 ca                	mov    %ecx,%edx
+     9e8:	89 c1                	mov    %eax,%ecx
+     9ea:	39 fa                	cmp    %edi,%edx
+     9ec:	73 e2                	jae    9d0 <printint+0x30>
+  if(neg)
+     9ee:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     9f1:	89 d9                	mov    %ebx,%ecx
+     9f3:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     9f6:	85 c0                	test   %eax,%eax
+     9f8:	74 07                	je     a01 <printint+0x61>
+    buf[i++] = '-';
+     9fa:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     9ff:	89 f1                	mov    %esi,%ecx
+     a01:	8d 75 d8             	lea    -0x28(%ebp),%esi
+     a04:	89 cf                	mov    %ecx,%edi
+     a06:	01 f7                	add    %esi,%edi
+     a08:	eb 1a                	jmp    a24 <printint+0x84>
+     a0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    *b->str++ = c;
+     a10:	8d 48 01             	lea    0x1(%eax),%ecx
+     a13:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+     a19:	88 10                	mov    %dl,(%eax)
+
+  while(--i >= 0)
+     a1b:	8d 47 ff             	lea    -0x1(%edi),%eax
+     a1e:	39 fe                	cmp    %edi,%esi
+     a20:	74 40                	je     a62 <printint+0xc2>
+     a22:	89 c7                	mov    %eax,%edi
+  if(b->str){
+     a24:	8b 83 0c 02 00 00    	mov    0x20c(%ebx),%eax
+    putc(b, buf[i]);
+     a2a:	0f b6 17             	movzbl (%edi),%edx
+  if(b->str){
+     a2d:	85 c0                	test   %eax,%eax
+     a2f:	75 df                	jne    a10 <printint+0x70>
+  b->buf[b->n++] = c;
+     a31:	8b 4b 08             	mov    0x8(%ebx),%ecx
+     a34:	8d 41 01             	lea    0x1(%ecx),%eax
+     a37:	89 43 08             	mov    %eax,0x8(%ebx)
+     a3a:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+     a3e:	3d 00 02 00 00       	cmp    $0x200,%eax
+     a43:	74 3b                	je     a80 <printint+0xe0>
+     a45:	80 fa 0a             	cmp    $0xa,%dl
+     a48:	75 d1                	jne    a1b <printint+0x7b>
+     a4a:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+     a4e:	75 cb                	jne    a1b <printint+0x7b>
+  if(b->n > 0)
+     a50:	85 c0                	test   %eax,%eax
+     a52:	7f 2c                	jg     a80 <printint+0xe0>
+  b->n = 0;
+     a54:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  while(--i >= 0)
+     a5b:	8d 47 ff             	lea    -0x1(%edi),%eax
+     a5e:	39 fe                	cmp    %edi,%esi
+     a60:	75 c0                	jne    a22 <printint+0x82>
+}
+     a62:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a65:	5b                   	pop    %ebx
+     a66:	5e                   	pop    %esi
+     a67:	5f                   	pop    %edi
+     a68:	5d                   	pop    %ebp
+     a69:	c3                   	ret
+     a6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  neg = 0;
+     a70:	31 c0                	xor    %eax,%eax
+     a72:	e9 51 ff ff ff       	jmp    9c8 <printint+0x28>
+     a77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a7e:	66 90                	xchg   %ax,%ax
+    _write(b->fd, b->buf, b->n);
+     a80:	83 ec 04             	sub    $0x4,%esp
+     a83:	50                   	push   %eax
+     a84:	8d 43 0c             	lea    0xc(%ebx),%eax
+     a87:	50                   	push   %eax
+     a88:	ff 33                	push   (%ebx)
+     a8a:	e8 71 fd ff ff       	call   800 <_write>
+     a8f:	83 c4 10             	add    $0x10,%esp
+     a92:	eb c0                	jmp    a54 <printint+0xb4>
+     a94:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     a9f:	90                   	nop
+
+00000aa0 <putc>:
+{
+     aa0:	55                   	push   %ebp
+     aa1:	89 e5                	mov    %esp,%ebp
+     aa3:	53                   	push   %ebx
+     aa4:	89 c3                	mov    %eax,%ebx
+     aa6:	83 ec 04             	sub    $0x4,%esp
+  if(b->str){
+     aa9:	8b 80 0c 02 00 00    	mov    0x20c(%eax),%eax
+     aaf:	85 c0                	test   %eax,%eax
+     ab1:	74 15                	je     ac8 <putc+0x28>
+    *b->str++ = c;
+     ab3:	8d 48 01             	lea    0x1(%eax),%ecx
+     ab6:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+     abc:	88 10                	mov    %dl,(%eax)
+}
+     abe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     ac1:	c9                   	leave
+     ac2:	c3                   	ret
+     ac3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     ac7:	90                   	nop
+  b->buf[b->n++] = c;
+     ac8:	8b 4b 08             	mov    0x8(%ebx),%ecx
+     acb:	8d 41 01             	lea    0x1(%ecx),%eax
+     ace:	89 43 08             	mov    %eax,0x8(%ebx)
+     ad1:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+     ad5:	3d 00 02 00 00       	cmp    $0x200,%eax
+     ada:	74 14                	je     af0 <putc+0x50>
+     adc:	80 fa 0a             	cmp    $0xa,%dl
+     adf:	75 dd                	jne    abe <putc+0x1e>
+     ae1:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+     ae5:	75 d7                	jne    abe <putc+0x1e>
+  if(b->n > 0)
+     ae7:	85 c0                	test   %eax,%eax
+     ae9:	7e 17                	jle    b02 <putc+0x62>
+     aeb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     aef:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     af0:	83 ec 04             	sub    $0x4,%esp
+     af3:	50                   	push   %eax
+     af4:	8d 43 0c             	lea    0xc(%ebx),%eax
+     af7:	50                   	push   %eax
+     af8:	ff 33                	push   (%ebx)
+     afa:	e8 01 fd ff ff       	call   800 <_write>
+     aff:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     b02:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+     b09:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     b0c:	c9                   	leave
+     b0d:	c3                   	ret
+     b0e:	66 90                	xchg   %ax,%ax
+
+00000b10 <format>:
+
+// Format fmt and the arguments at ap into b.
+// Only understands %d, %x, %p, %s, %c.
+static void
+format(struct outbuf *b, const char *fmt, uint *ap)
+{
+     b10:	55                   	push   %ebp
+     b11:	89 e5                	mov    %esp,%ebp
+     b13:	57                   	push   %edi
+     b14:	89 c7                	mov    %eax,%edi
+     b16:	56                   	push   %esi
+     b17:	53                   	push   %ebx
+     b18:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+     b1b:	0f b6 02             	movzbl (%edx),%eax
+{
+     b1e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  for(i = 0; fmt[i]; i++){
+     b21:	84 c0                	test   %al,%al
+     b23:	74 5a                	je     b7f <format+0x6f>
+     b25:	8d 5a 01             	lea    0x1(%edx),%ebx
+     b28:	31 f6                	xor    %esi,%esi
+     b2a:	eb 1c                	jmp    b48 <format+0x38>
+     b2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     b30:	83 f8 25             	cmp    $0x25,%eax
+     b33:	74 3b                	je     b70 <format+0x60>
+        state = '%';
+      } else {
+        putc(b, c);
+     b35:	89 ca                	mov    %ecx,%edx
+     b37:	89 f8                	mov    %edi,%eax
+     b39:	e8 62 ff ff ff       	call   aa0 <putc>
+  for(i = 0; fmt[i]; i++){
+     b3e:	0f b6 03             	movzbl (%ebx),%eax
+     b41:	83 c3 01             	add    $0x1,%ebx
+     b44:	84 c0                	test   %al,%al
+     b46:	74 37                	je     b7f <format+0x6f>
+    c = fmt[i] & 0xff;
+     b48:	0f be c8             	movsbl %al,%ecx
+     b4b:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     b4e:	85 f6                	test   %esi,%esi
+     b50:	74 de                	je     b30 <format+0x20>
+      }
+    } else if(state == '%'){
+     b52:	83 fe 25             	cmp    $0x25,%esi
+     b55:	75 e7                	jne    b3e <format+0x2e>
+      if(c == 'd'){
+     b57:	83 f8 25             	cmp    $0x25,%eax
+     b5a:	74 46                	je     ba2 <format+0x92>
+     b5c:	83 e8 63             	sub    $0x63,%eax
+     b5f:	83 f8 15             	cmp    $0x15,%eax
+     b62:	77 2c                	ja     b90 <format+0x80>
+     b64:	ff 24 85 d4 16 00 00 	jmp    *0x16d4(,%eax,4)
+     b6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b6f:	90                   	nop
+  for(i = 0; fmt[i]; i++){
+     b70:	0f b6 03             	movzbl (%ebx),%eax
+     b73:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+     b76:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+     b7b:	84 c0                	test   %al,%al
+     b7d:	75 c9                	jne    b48 <format+0x38>
+        putc(b, c);
+      }
+      state = 0;
+    }
+  }
+}
+     b7f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     b82:	5b                   	pop    %ebx
+     b83:	5e                   	pop    %esi
+     b84:	5f                   	pop    %edi
+     b85:	5d                   	pop    %ebp
+     b86:	c3                   	ret
+     b87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b8e:	66 90                	xchg   %ax,%ax
+        putc(b, '%');
+     b90:	ba 25 00 00 00       	mov    $0x25,%edx
+     b95:	89 f8                	mov    %edi,%eax
+     b97:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     b9a:	e8 01 ff ff ff       	call   aa0 <putc>
+        putc(b, c);
+     b9f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     ba2:	89 ca                	mov    %ecx,%edx
+     ba4:	89 f8                	mov    %edi,%eax
+      state = 0;
+     ba6:	31 f6                	xor    %esi,%esi
+        putc(b, c);
+     ba8:	e8 f3 fe ff ff       	call   aa0 <putc>
+     bad:	eb 8f                	jmp    b3e <format+0x2e>
+     baf:	90                   	nop
+        printint(b, *ap, 16, 0);
+     bb0:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     bb3:	83 ec 0c             	sub    $0xc,%esp
+     bb6:	b9 10 00 00 00       	mov    $0x10,%ecx
+     bbb:	8b 16                	mov    (%esi),%edx
+     bbd:	6a 00                	push   $0x0
+        ap++;
+     bbf:	83 c6 04             	add    $0x4,%esi
+        printint(b, *ap, 16, 0);
+     bc2:	89 f8                	mov    %edi,%eax
+     bc4:	e8 d7 fd ff ff       	call   9a0 <printint>
+        ap++;
+     bc9:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+     bcc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     bcf:	31 f6                	xor    %esi,%esi
+     bd1:	e9 68 ff ff ff       	jmp    b3e <format+0x2e>
+     bd6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bdd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     be0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     be3:	8b 30                	mov    (%eax),%esi
+        ap++;
+     be5:	83 c0 04             	add    $0x4,%eax
+     be8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+     beb:	85 f6                	test   %esi,%esi
+     bed:	75 1b                	jne    c0a <format+0xfa>
+     bef:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+     bf4:	be cc 16 00 00       	mov    $0x16cc,%esi
+     bf9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+          putc(b, *s);
+     c00:	89 f8                	mov    %edi,%eax
+          s++;
+     c02:	83 c6 01             	add    $0x1,%esi
+          putc(b, *s);
+     c05:	e8 96 fe ff ff       	call   aa0 <putc>
+        while(*s != 0){
+     c0a:	0f be 16             	movsbl (%esi),%edx
+     c0d:	84 d2                	test   %dl,%dl
+     c0f:	75 ef                	jne    c00 <format+0xf0>
+      state = 0;
+     c11:	31 f6                	xor    %esi,%esi
+     c13:	e9 26 ff ff ff       	jmp    b3e <format+0x2e>
+     c18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c1f:	90                   	nop
+        printint(b, *ap, 10, 1);
+     c20:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     c23:	83 ec 0c             	sub    $0xc,%esp
+     c26:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     c2b:	8b 16                	mov    (%esi),%edx
+     c2d:	6a 01                	push   $0x1
+     c2f:	eb 8e                	jmp    bbf <format+0xaf>
+     c31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(b, *ap);
+     c38:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     c3b:	89 f8                	mov    %edi,%eax
+     c3d:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+     c40:	83 c6 04             	add    $0x4,%esi
+        putc(b, *ap);
+     c43:	e8 58 fe ff ff       	call   aa0 <putc>
+        ap++;
+     c48:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      state = 0;
+     c4b:	31 f6                	xor    %esi,%esi
+     c4d:	e9 ec fe ff ff       	jmp    b3e <format+0x2e>
+     c52:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c59:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000c60 <fflush>:
+{
+     c60:	55                   	push   %ebp
+     c61:	89 e5                	mov    %esp,%ebp
+     c63:	83 ec 08             	sub    $0x8,%esp
+  if(fd == stdout.fd)
+     c66:	8b 45 08             	mov    0x8(%ebp),%eax
+     c69:	39 05 00 20 00 00    	cmp    %eax,0x2000
+     c6f:	74 07                	je     c78 <fflush+0x18>
+}
+     c71:	c9                   	leave
+     c72:	c3                   	ret
+     c73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c77:	90                   	nop
+  umtxlock(&stdoutlock);
+     c78:	83 ec 0c             	sub    $0xc,%esp
+     c7b:	68 24 32 00 00       	push   $0x3224
+     c80:	e8 db fa ff ff       	call   760 <umtxlock>
+  if(b->n > 0)
+     c85:	a1 08 20 00 00       	mov    0x2008,%eax
+     c8a:	83 c4 10             	add    $0x10,%esp
+     c8d:	85 c0                	test   %eax,%eax
+     c8f:	7f 1f                	jg     cb0 <fflush+0x50>
+  b->n = 0;
+     c91:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     c98:	00 00 00 
+  umtxunlock(&stdoutlock);
+     c9b:	c7 45 08 24 32 00 00 	movl   $0x3224,0x8(%ebp)
+}
+     ca2:	c9                   	leave
+  umtxunlock(&stdoutlock);
+     ca3:	e9 08 fb ff ff       	jmp    7b0 <umtxunlock>
+     ca8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     caf:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     cb0:	83 ec 04             	sub    $0x4,%esp
+     cb3:	50                   	push   %eax
+     cb4:	68 0c 20 00 00       	push   $0x200c
+     cb9:	ff 35 00 20 00 00    	push   0x2000
+     cbf:	e8 3c fb ff ff       	call   800 <_write>
+     cc4:	83 c4 10             	add    $0x10,%esp
+     cc7:	eb c8                	jmp    c91 <fflush+0x31>
+     cc9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000cd0 <setvbuf>:
+{
+     cd0:	55                   	push   %ebp
+     cd1:	89 e5                	mov    %esp,%ebp
+     cd3:	53                   	push   %ebx
+     cd4:	83 ec 04             	sub    $0x4,%esp
+     cd7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd != stdout.fd)
+     cda:	8b 45 08             	mov    0x8(%ebp),%eax
+     cdd:	39 05 00 20 00 00    	cmp    %eax,0x2000
+     ce3:	74 0b                	je     cf0 <setvbuf+0x20>
+}
+     ce5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     ce8:	c9                   	leave
+     ce9:	c3                   	ret
+     cea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  umtxlock(&stdoutlock);
+     cf0:	83 ec 0c             	sub    $0xc,%esp
+     cf3:	68 24 32 00 00       	push   $0x3224
+     cf8:	e8 63 fa ff ff       	call   760 <umtxlock>
+  if(b->n > 0)
+     cfd:	a1 08 20 00 00       	mov    0x2008,%eax
+     d02:	83 c4 10             	add    $0x10,%esp
+     d05:	85 c0                	test   %eax,%eax
+     d07:	7f 2f                	jg     d38 <setvbuf+0x68>
+  b->n = 0;
+     d09:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     d10:	00 00 00 
+  stdout.mode = mode;
+     d13:	89 1d 04 20 00 00    	mov    %ebx,0x2004
+  flushhook = flushall;
+     d19:	c7 05 20 32 00 00 50 	movl   $0x950,0x3220
+     d20:	09 00 00 
+}
+     d23:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&stdoutlock);
+     d26:	c7 45 08 24 32 00 00 	movl   $0x3224,0x8(%ebp)
+}
+     d2d:	c9                   	leave
+  umtxunlock(&stdoutlock);
+     d2e:	e9 7d fa ff ff       	jmp    7b0 <umtxunlock>
+     d33:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d37:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     d38:	83 ec 04             	sub    $0x4,%esp
+     d3b:	50                   	push   %eax
+     d3c:	68 0c 20 00 00       	push   $0x200c
+     d41:	ff 35 00 20 00 00    	push   0x2000
+     d47:	e8 b4 fa ff ff       	call   800 <_write>
+     d4c:	83 c4 10             	add    $0x10,%esp
+     d4f:	eb b8                	jmp    d09 <setvbuf+0x39>
+     d51:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d5f:	90                   	nop
+
+00000d60 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s, %c.
+void
+printf(int fd, const char *fmt, ...)
+{
+     d60:	55                   	push   %ebp
+     d61:	89 e5                	mov    %esp,%ebp
+     d63:	53                   	push   %ebx
+     d64:	81 ec 14 02 00 00    	sub    $0x214,%esp
+     d6a:	8b 45 08             	mov    0x8(%ebp),%eax
+    local.mode = _IONBF;
+    local.n = 0;
+    local.str = 0;
+    b = &local;
+  }
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     d6d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd == stdout.fd){
+     d70:	39 05 00 20 00 00    	cmp    %eax,0x2000
+     d76:	74 48                	je     dc0 <printf+0x60>
+    local.fd = fd;
+     d78:	89 85 e8 fd ff ff    	mov    %eax,-0x218(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     d7e:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     d81:	89 da                	mov    %ebx,%edx
+     d83:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+    local.mode = _IONBF;
+     d89:	c7 85 ec fd ff ff 03 	movl   $0x3,-0x214(%ebp)
+     d90:	00 00 00 
+    local.n = 0;
+     d93:	c7 85 f0 fd ff ff 00 	movl   $0x0,-0x210(%ebp)
+     d9a:	00 00 00 
+    local.str = 0;
+     d9d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     da4:	e8 67 fd ff ff       	call   b10 <format>
+  if(b->mode == _IONBF)
+     da9:	83 bd ec fd ff ff 03 	cmpl   $0x3,-0x214(%ebp)
+     db0:	0f 84 a2 00 00 00    	je     e58 <printf+0xf8>
+    flush(b);
+  if(b == &stdout)
+    umtxunlock(&stdoutlock);
+}
+     db6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     db9:	c9                   	leave
+     dba:	c3                   	ret
+     dbb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     dbf:	90                   	nop
+    umtxlock(&stdoutlock);
+     dc0:	83 ec 0c             	sub    $0xc,%esp
+     dc3:	68 24 32 00 00       	push   $0x3224
+     dc8:	e8 93 f9 ff ff       	call   760 <umtxlock>
+  if(stdout.mode == 0){
+     dcd:	a1 04 20 00 00       	mov    0x2004,%eax
+     dd2:	83 c4 10             	add    $0x10,%esp
+     dd5:	85 c0                	test   %eax,%eax
+     dd7:	74 37                	je     e10 <printf+0xb0>
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     dd9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     ddc:	89 da                	mov    %ebx,%edx
+     dde:	b8 00 20 00 00       	mov    $0x2000,%eax
+     de3:	e8 28 fd ff ff       	call   b10 <format>
+  if(b->mode == _IONBF)
+     de8:	83 3d 04 20 00 00 03 	cmpl   $0x3,0x2004
+     def:	0f 84 ab 00 00 00    	je     ea0 <printf+0x140>
+    umtxunlock(&stdoutlock);
+     df5:	83 ec 0c             	sub    $0xc,%esp
+     df8:	68 24 32 00 00       	push   $0x3224
+     dfd:	e8 ae f9 ff ff       	call   7b0 <umtxunlock>
+}
+     e02:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    umtxunlock(&stdoutlock);
+     e05:	83 c4 10             	add    $0x10,%esp
+}
+     e08:	c9                   	leave
+     e09:	c3                   	ret
+     e0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+     e10:	83 ec 08             	sub    $0x8,%esp
+     e13:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+     e19:	50                   	push   %eax
+     e1a:	ff 35 00 20 00 00    	push   0x2000
+     e20:	e8 13 fa ff ff       	call   838 <fstat>
+     e25:	83 c4 10             	add    $0x10,%esp
+     e28:	89 c2                	mov    %eax,%edx
+      stdout.mode = _IOFBF;
+     e2a:	b8 01 00 00 00       	mov    $0x1,%eax
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+     e2f:	85 d2                	test   %edx,%edx
+     e31:	75 10                	jne    e43 <printf+0xe3>
+      stdout.mode = _IOLBF;
+     e33:	31 c0                	xor    %eax,%eax
+     e35:	66 83 bd e8 fd ff ff 	cmpw   $0x3,-0x218(%ebp)
+     e3c:	03 
+     e3d:	0f 94 c0             	sete   %al
+     e40:	83 c0 01             	add    $0x1,%eax
+     e43:	a3 04 20 00 00       	mov    %eax,0x2004
+    flushhook = flushall;
+     e48:	c7 05 20 32 00 00 50 	movl   $0x950,0x3220
+     e4f:	09 00 00 
+     e52:	eb 85                	jmp    dd9 <printf+0x79>
+     e54:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(b->n > 0)
+     e58:	8b 85 f0 fd ff ff    	mov    -0x210(%ebp),%eax
+     e5e:	85 c0                	test   %eax,%eax
+     e60:	0f 8e 50 ff ff ff    	jle    db6 <printf+0x56>
+    b = &local;
+     e66:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+    _write(b->fd, b->buf, b->n);
+     e6c:	83 ec 04             	sub    $0x4,%esp
+     e6f:	50                   	push   %eax
+     e70:	8d 43 0c             	lea    0xc(%ebx),%eax
+     e73:	50                   	push   %eax
+     e74:	ff 33                	push   (%ebx)
+     e76:	e8 85 f9 ff ff       	call   800 <_write>
+  b->n = 0;
+     e7b:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  if(b == &stdout)
+     e82:	83 c4 10             	add    $0x10,%esp
+     e85:	81 fb 00 20 00 00    	cmp    $0x2000,%ebx
+     e8b:	0f 85 25 ff ff ff    	jne    db6 <printf+0x56>
+     e91:	e9 5f ff ff ff       	jmp    df5 <printf+0x95>
+     e96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e9d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(b->n > 0)
+     ea0:	a1 08 20 00 00       	mov    0x2008,%eax
+    b = getstdout();
+     ea5:	bb 00 20 00 00       	mov    $0x2000,%ebx
+  if(b->n > 0)
+     eaa:	85 c0                	test   %eax,%eax
+     eac:	7f be                	jg     e6c <printf+0x10c>
+  b->n = 0;
+     eae:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     eb5:	00 00 00 
+  if(b == &stdout)
+     eb8:	e9 38 ff ff ff       	jmp    df5 <printf+0x95>
+     ebd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ec0 <sprintf>:
+
+// Print to the given buffer. Only understands %d, %x, %p, %s, %c.
+int
+sprintf(char *str, const char *fmt, ...)
+{
+     ec0:	55                   	push   %ebp
+     ec1:	89 e5                	mov    %esp,%ebp
+     ec3:	53                   	push   %ebx
+  struct outbuf b;
+
+  b.str = str;
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+     ec4:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+     eca:	8d 4d 10             	lea    0x10(%ebp),%ecx
+{
+     ecd:	81 ec 14 02 00 00    	sub    $0x214,%esp
+     ed3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+     ed6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  b.str = str;
+     ed9:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+     edc:	e8 2f fc ff ff       	call   b10 <format>
+  *b.str = '\0';
+     ee1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ee4:	c6 00 00             	movb   $0x0,(%eax)
+  return b.str - str;
+     ee7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     eea:	29 d8                	sub    %ebx,%eax
+}
+     eec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     eef:	c9                   	leave
+     ef0:	c3                   	ret
+     ef1:	66 90                	xchg   %ax,%ax
+     ef3:	66 90                	xchg   %ax,%ax
+     ef5:	66 90                	xchg   %ax,%ax
+     ef7:	66 90                	xchg   %ax,%ax
+     ef9:	66 90                	xchg   %ax,%ax
+     efb:	66 90                	xchg   %ax,%ax
+     efd:	66 90                	xchg   %ax,%ax
+     eff:	90                   	nop
+
+00000f00 <freeblock>:
+static Header *freep;
+static struct umutex lock;  // threads made by clone() share the heap
+
+static void
+freeblock(void *ap)
+{
+     f00:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+     f01:	8d 48 f8             	lea    -0x8(%eax),%ecx
+{
+     f04:	89 e5                	mov    %esp,%ebp
+     f06:	57                   	push   %edi
+     f07:	56                   	push   %esi
+     f08:	53                   	push   %ebx
+     f09:	89 c3                	mov    %eax,%ebx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     f0b:	a1 2c 32 00 00       	mov    0x322c,%eax
+     f10:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     f12:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     f14:	39 ca                	cmp    %ecx,%edx
+     f16:	73 30                	jae    f48 <freeblock+0x48>
+     f18:	39 c1                	cmp    %eax,%ecx
+     f1a:	72 04                	jb     f20 <freeblock+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     f1c:	39 c2                	cmp    %eax,%edx
+     f1e:	72 f0                	jb     f10 <freeblock+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     f20:	8b 73 fc             	mov    -0x4(%ebx),%esi
+     f23:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+     f26:	39 f8                	cmp    %edi,%eax
+     f28:	74 26                	je     f50 <freeblock+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+     f2a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+     f2d:	8b 42 04             	mov    0x4(%edx),%eax
+     f30:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     f33:	39 f1                	cmp    %esi,%ecx
+     f35:	74 30                	je     f67 <freeblock+0x67>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+     f37:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+     f39:	5b                   	pop    %ebx
+  freep = p;
+     f3a:	89 15 2c 32 00 00    	mov    %edx,0x322c
+}
+     f40:	5e                   	pop    %esi
+     f41:	5f                   	pop    %edi
+     f42:	5d                   	pop    %ebp
+     f43:	c3                   	ret
+     f44:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     f48:	39 c1                	cmp    %eax,%ecx
+     f4a:	72 d0                	jb     f1c <freeblock+0x1c>
+     f4c:	eb c2                	jmp    f10 <freeblock+0x10>
+     f4e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+     f50:	03 70 04             	add    0x4(%eax),%esi
+     f53:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     f56:	8b 02                	mov    (%edx),%eax
+     f58:	8b 00                	mov    (%eax),%eax
+     f5a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+     f5d:	8b 42 04             	mov    0x4(%edx),%eax
+     f60:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     f63:	39 f1                	cmp    %esi,%ecx
+     f65:	75 d0                	jne    f37 <freeblock+0x37>
+    p->s.size += bp->s.size;
+     f67:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+     f6a:	89 15 2c 32 00 00    	mov    %edx,0x322c
+    p->s.size += bp->s.size;
+     f70:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+     f73:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+     f76:	89 0a                	mov    %ecx,(%edx)
+}
+     f78:	5b                   	pop    %ebx
+     f79:	5e                   	pop    %esi
+     f7a:	5f                   	pop    %edi
+     f7b:	5d                   	pop    %ebp
+     f7c:	c3                   	ret
+     f7d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000f80 <free>:
+
+void
+free(void *ap)
+{
+     f80:	55                   	push   %ebp
+     f81:	89 e5                	mov    %esp,%ebp
+     f83:	53                   	push   %ebx
+     f84:	83 ec 10             	sub    $0x10,%esp
+     f87:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  umtxlock(&lock);
+     f8a:	68 28 32 00 00       	push   $0x3228
+     f8f:	e8 cc f7 ff ff       	call   760 <umtxlock>
+  freeblock(ap);
+     f94:	89 d8                	mov    %ebx,%eax
+     f96:	e8 65 ff ff ff       	call   f00 <freeblock>
+  umtxunlock(&lock);
+     f9b:	c7 45 08 28 32 00 00 	movl   $0x3228,0x8(%ebp)
+}
+     fa2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&lock);
+     fa5:	83 c4 10             	add    $0x10,%esp
+}
+     fa8:	c9                   	leave
+  umtxunlock(&lock);
+     fa9:	e9 02 f8 ff ff       	jmp    7b0 <umtxunlock>
+     fae:	66 90                	xchg   %ax,%ax
+
+00000fb0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+     fb0:	55                   	push   %ebp
+     fb1:	89 e5                	mov    %esp,%ebp
+     fb3:	57                   	push   %edi
+     fb4:	56                   	push   %esi
+     fb5:	53                   	push   %ebx
+     fb6:	83 ec 28             	sub    $0x28,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     fb9:	8b 45 08             	mov    0x8(%ebp),%eax
+  umtxlock(&lock);
+     fbc:	68 28 32 00 00       	push   $0x3228
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     fc1:	8d 48 07             	lea    0x7(%eax),%ecx
+     fc4:	c1 e9 03             	shr    $0x3,%ecx
+     fc7:	8d 71 01             	lea    0x1(%ecx),%esi
+  umtxlock(&lock);
+     fca:	e8 91 f7 ff ff       	call   760 <umtxlock>
+  if((prevp = freep) == 0){
+     fcf:	8b 15 2c 32 00 00    	mov    0x322c,%edx
+     fd5:	83 c4 10             	add    $0x10,%esp
+     fd8:	85 d2                	test   %edx,%edx
+     fda:	0f 84 b0 00 00 00    	je     1090 <malloc+0xe0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     fe0:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+     fe2:	8b 47 04             	mov    0x4(%edi),%eax
+     fe5:	39 f0                	cmp    %esi,%eax
+     fe7:	73 6f                	jae    1058 <malloc+0xa8>
+  if(nu < 4096)
+     fe9:	bb 00 10 00 00       	mov    $0x1000,%ebx
+     fee:	39 de                	cmp    %ebx,%esi
+     ff0:	0f 43 de             	cmovae %esi,%ebx
+  p = sbrk(nu * sizeof(Header));
+     ff3:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+     ffa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     ffd:	eb 0a                	jmp    1009 <malloc+0x59>
+     fff:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1000:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+    1002:	8b 47 04             	mov    0x4(%edi),%eax
+    1005:	39 f0                	cmp    %esi,%eax
+    1007:	73 4f                	jae    1058 <malloc+0xa8>
+      }
+      freep = prevp;
+      umtxunlock(&lock);
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    1009:	89 fa                	mov    %edi,%edx
+    100b:	39 3d 2c 32 00 00    	cmp    %edi,0x322c
+    1011:	75 ed                	jne    1000 <malloc+0x50>
+  p = sbrk(nu * sizeof(Header));
+    1013:	83 ec 0c             	sub    $0xc,%esp
+    1016:	ff 75 e4             	push   -0x1c(%ebp)
+    1019:	e8 4a f8 ff ff       	call   868 <sbrk>
+  if(p == (char*)-1)
+    101e:	83 c4 10             	add    $0x10,%esp
+    1021:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1024:	74 15                	je     103b <malloc+0x8b>
+  hp->s.size = nu;
+    1026:	89 58 04             	mov    %ebx,0x4(%eax)
+  freeblock((void*)(hp + 1));
+    1029:	83 c0 08             	add    $0x8,%eax
+    102c:	e8 cf fe ff ff       	call   f00 <freeblock>
+  return freep;
+    1031:	8b 15 2c 32 00 00    	mov    0x322c,%edx
+      if((p = morecore(nunits)) == 0){
+    1037:	85 d2                	test   %edx,%edx
+    1039:	75 c5                	jne    1000 <malloc+0x50>
+        umtxunlock(&lock);
+    103b:	83 ec 0c             	sub    $0xc,%esp
+    103e:	68 28 32 00 00       	push   $0x3228
+    1043:	e8 68 f7 ff ff       	call   7b0 <umtxunlock>
+        return 0;
+    1048:	83 c4 10             	add    $0x10,%esp
+      }
+  }
+}
+    104b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    104e:	31 c0                	xor    %eax,%eax
+}
+    1050:	5b                   	pop    %ebx
+    1051:	5e                   	pop    %esi
+    1052:	5f                   	pop    %edi
+    1053:	5d                   	pop    %ebp
+    1054:	c3                   	ret
+    1055:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1058:	39 c6                	cmp    %eax,%esi
+    105a:	74 64                	je     10c0 <malloc+0x110>
+        p->s.size -= nunits;
+    105c:	29 f0                	sub    %esi,%eax
+    105e:	89 47 04             	mov    %eax,0x4(%edi)
+        p += p->s.size;
+    1061:	8d 3c c7             	lea    (%edi,%eax,8),%edi
+        p->s.size = nunits;
+    1064:	89 77 04             	mov    %esi,0x4(%edi)
+      umtxunlock(&lock);
+    1067:	83 ec 0c             	sub    $0xc,%esp
+      freep = prevp;
+    106a:	89 15 2c 32 00 00    	mov    %edx,0x322c
+      umtxunlock(&lock);
+    1070:	68 28 32 00 00       	push   $0x3228
+    1075:	e8 36 f7 ff ff       	call   7b0 <umtxunlock>
+      return (void*)(p + 1);
+    107a:	83 c4 10             	add    $0x10,%esp
+}
+    107d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    1080:	8d 47 08             	lea    0x8(%edi),%eax
+}
+    1083:	5b                   	pop    %ebx
+    1084:	5e                   	pop    %esi
+    1085:	5f                   	pop    %edi
+    1086:	5d                   	pop    %ebp
+    1087:	c3                   	ret
+    1088:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    108f:	90                   	nop
+    base.s.ptr = freep = prevp = &base;
+    1090:	c7 05 2c 32 00 00 30 	movl   $0x3230,0x322c
+    1097:	32 00 00 
+    base.s.size = 0;
+    109a:	bf 30 32 00 00       	mov    $0x3230,%edi
+    base.s.ptr = freep = prevp = &base;
+    109f:	c7 05 30 32 00 00 30 	movl   $0x3230,0x3230
+    10a6:	32 00 00 
+    base.s.size = 0;
+    10a9:	c7 05 34 32 00 00 00 	movl   $0x0,0x3234
+    10b0:	00 00 00 
+    if(p->s.size >= nunits){
+    10b3:	e9 31 ff ff ff       	jmp    fe9 <malloc+0x39>
+    10b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10bf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    10c0:	8b 07                	mov    (%edi),%eax
+    10c2:	89 02                	mov    %eax,(%edx)
+    10c4:	eb a1                	jmp    1067 <malloc+0xb7>
+    10c6:	66 90                	xchg   %ax,%ax
+    10c8:	66 90                	xchg   %ax,%ax
+    10ca:	66 90                	xchg   %ax,%ax
+    10cc:	66 90                	xchg   %ax,%ax
+    10ce:	66 90                	xchg   %ax,%ax
+
+000010d0 <threadstart>:
+
+#define TSTACKSZ 4096
+
+static void
+threadstart(void *fn, void *arg)
+{
+    10d0:	55                   	push   %ebp
+    10d1:	89 e5                	mov    %esp,%ebp
+    10d3:	83 ec 14             	sub    $0x14,%esp
+  ((void (*)(void*))fn)(arg);
+    10d6:	ff 75 0c             	push   0xc(%ebp)
+    10d9:	ff 55 08             	call   *0x8(%ebp)
+  exit();
+    10dc:	e8 ef f4 ff ff       	call   5d0 <exit>
+    10e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10ef:	90                   	nop
+
+000010f0 <thread_create>:
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    10f0:	55                   	push   %ebp
+    10f1:	89 e5                	mov    %esp,%ebp
+    10f3:	53                   	push   %ebx
+    10f4:	83 ec 20             	sub    $0x20,%esp
+  char *mem, *stack;
+  int pid;
+
+  if((mem = malloc(2*TSTACKSZ)) == 0)
+    10f7:	68 00 20 00 00       	push   $0x2000
+    10fc:	e8 af fe ff ff       	call   fb0 <malloc>
+    1101:	83 c4 10             	add    $0x10,%esp
+    1104:	85 c0                	test   %eax,%eax
+    1106:	74 47                	je     114f <thread_create+0x5f>
+    1108:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)(((uint)mem + TSTACKSZ - 1) & ~(TSTACKSZ - 1));
+    110a:	8d 80 ff 0f 00 00    	lea    0xfff(%eax),%eax
+    1110:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  *(char**)stack = mem;
+    1115:	89 18                	mov    %ebx,(%eax)
+  if((pid = clone(threadstart, (void*)fn, arg, stack)) < 0)
+    1117:	50                   	push   %eax
+    1118:	ff 75 0c             	push   0xc(%ebp)
+    111b:	ff 75 08             	push   0x8(%ebp)
+    111e:	68 d0 10 00 00       	push   $0x10d0
+    1123:	e8 08 f8 ff ff       	call   930 <clone>
+    1128:	83 c4 10             	add    $0x10,%esp
+    112b:	85 c0                	test   %eax,%eax
+    112d:	78 09                	js     1138 <thread_create+0x48>
+    free(mem);
+  return pid;
+}
+    112f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1132:	c9                   	leave
+    1133:	c3                   	ret
+    1134:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    free(mem);
+    1138:	83 ec 0c             	sub    $0xc,%esp
+    113b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    113e:	53                   	push   %ebx
+    113f:	e8 3c fe ff ff       	call   f80 <free>
+    1144:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    1147:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+    114a:	83 c4 10             	add    $0x10,%esp
+}
+    114d:	c9                   	leave
+    114e:	c3                   	ret
+    return -1;
+    114f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1154:	eb d9                	jmp    112f <thread_create+0x3f>
+    1156:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    115d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001160 <thread_join>:
+
+int
+thread_join(void)
+{
+    1160:	55                   	push   %ebp
+    1161:	89 e5                	mov    %esp,%ebp
+    1163:	83 ec 34             	sub    $0x34,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    1166:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    1169:	50                   	push   %eax
+    116a:	e8 c9 f7 ff ff       	call   938 <join>
+    116f:	83 c4 10             	add    $0x10,%esp
+    1172:	85 c0                	test   %eax,%eax
+    1174:	79 0a                	jns    1180 <thread_join+0x20>
+    free(*(char**)stack);
+  return pid;
+}
+    1176:	c9                   	leave
+    1177:	c3                   	ret
+    1178:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    117f:	90                   	nop
+    free(*(char**)stack);
+    1180:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1183:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1186:	83 ec 0c             	sub    $0xc,%esp
+    1189:	ff 32                	push   (%edx)
+    118b:	e8 f0 fd ff ff       	call   f80 <free>
+    1190:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1193:	83 c4 10             	add    $0x10,%esp
+}
+    1196:	c9                   	leave
+    1197:	c3                   	ret
@@ -0,0 +1,103 @@
+// Read throughput on one file with several reader processes,
+// each with its own open of the file, and path lookups through
+// the same directories. Readers share the inode lock, so one
+// that waits for the disk or the CPU while it holds the lock
+// does not hold up the others.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+
+#define FILESZ  (64*1024)
+#define NREAD   (1024*1024)   // bytes read by each reader
+#define NLOOKUP 500           // path lookups by each reader
+
+char buf[4096];
+
+void
+reader(void)
+{
+  int fd, n, tot;
+
+  if((fd = open("readbench.file", O_RDONLY)) < 0){
+    printf(1, "readbench: cannot open readbench.file\n");
+    exit();
+  }
+  for(tot = 0; tot < NREAD; tot += n){
+    if((n = read(fd, buf, sizeof(buf))) <= 0){
+      close(fd);
+      fd = open("readbench.file", O_RDONLY);
+      n = 0;
+    }
+  }
+  close(fd);
+}
+
+void
+lookup(void)
+{
+  struct stat st;
+  int i;
+
+  for(i = 0; i < NLOOKUP; i++){
+    if(stat("/readbench.dir/../readbench.file", &st) < 0){
+      printf(1, "readbench: stat failed\n");
+      exit();
+    }
+  }
+}
+
+void
+run(int nproc)
+{
+  int i, t0, tr, tl;
+
+  t0 = uptime();
+  for(i = 0; i < nproc; i++){
+    if(fork() == 0){
+      reader();
+      exit();
+    }
+  }
+  for(i = 0; i < nproc; i++)
+    wait();
+  tr = uptime() - t0;
+
+  t0 = uptime();
+  for(i = 0; i < nproc; i++){
+    if(fork() == 0){
+      lookup();
+      exit();
+    }
+  }
+  for(i = 0; i < nproc; i++)
+    wait();
+  tl = uptime() - t0;
+
+  printf(1, "readbench: %d readers: %d KB in %d ticks; %d lookups in %d ticks\n",
+         nproc, nproc * NREAD / 1024, tr, nproc * NLOOKUP, tl);
+}
+
+int
+main(int argc, char *argv[])
+{
+  int fd, i, n;
+
+  if((fd = open("readbench.file", O_CREATE|O_RDWR)) < 0 ||
+     mkdir("readbench.dir") < 0){
+    printf(1, "readbench: cannot create readbench.file or readbench.dir\n");
+    exit();
+  }
+  for(i = 0; i < sizeof(buf); i++)
+    buf[i] = i;
+  for(n = 0; n < FILESZ; n += sizeof(buf))
+    write(fd, buf, sizeof(buf));
+  close(fd);
+
+  for(n = 1; n <= 4; n *= 2)
+    run(n);
+  unlink("readbench.dir");
+  unlink("readbench.file");
+  exit();
+}
@@ -0,0 +1,2444 @@
+
+_rwbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <report>:
+  return lo;
+}
+
+void
+report(char *name, int nbuf, int t, uint c)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	56                   	push   %esi
+       4:	53                   	push   %ebx
+  uint kb;
+
+  kb = nbuf * (BUFSZ / 1024);
+       5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+{
+       8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  kb = nbuf * (BUFSZ / 1024);
+       b:	c1 e1 06             	shl    $0x6,%ecx
+  if(t == 0)
+       e:	85 db                	test   %ebx,%ebx
+      10:	74 36                	je     48 <report+0x48>
+    t = 1;
+  printf(1, "rwbench: %s: %d KB in %d ticks, %d KB/tick, %d cycles/KB\n",
+      12:	89 c8                	mov    %ecx,%eax
+      14:	31 d2                	xor    %edx,%edx
+      16:	f7 f3                	div    %ebx
+      18:	89 c6                	mov    %eax,%esi
+      1a:	8b 45 14             	mov    0x14(%ebp),%eax
+      1d:	31 d2                	xor    %edx,%edx
+      1f:	83 ec 04             	sub    $0x4,%esp
+      22:	f7 f1                	div    %ecx
+      24:	50                   	push   %eax
+      25:	56                   	push   %esi
+      26:	53                   	push   %ebx
+      27:	51                   	push   %ecx
+      28:	ff 75 08             	push   0x8(%ebp)
+      2b:	68 18 11 00 00       	push   $0x1118
+      30:	6a 01                	push   $0x1
+      32:	e8 a9 0c 00 00       	call   ce0 <printf>
+         name, kb, t, kb / t, c / kb);
+}
+      37:	83 c4 20             	add    $0x20,%esp
+      3a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      3d:	5b                   	pop    %ebx
+      3e:	5e                   	pop    %esi
+      3f:	5d                   	pop    %ebp
+      40:	c3                   	ret
+      41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      48:	89 ce                	mov    %ecx,%esi
+    t = 1;
+      4a:	bb 01 00 00 00       	mov    $0x1,%ebx
+      4f:	eb c9                	jmp    1a <report+0x1a>
+      51:	66 90                	xchg   %ax,%ax
+      53:	66 90                	xchg   %ax,%ax
+      55:	66 90                	xchg   %ax,%ax
+      57:	66 90                	xchg   %ax,%ax
+      59:	66 90                	xchg   %ax,%ax
+      5b:	66 90                	xchg   %ax,%ax
+      5d:	66 90                	xchg   %ax,%ax
+      5f:	90                   	nop
+
+00000060 <main>:
+
+int
+main(int argc, char *argv[])
+{
+      60:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+      64:	83 e4 f0             	and    $0xfffffff0,%esp
+  int fd, i, j, t;
+  uint c;
+
+  for(i = 0; i < BUFSZ; i++)
+      67:	31 c0                	xor    %eax,%eax
+{
+      69:	ff 71 fc             	push   -0x4(%ecx)
+      6c:	55                   	push   %ebp
+      6d:	89 e5                	mov    %esp,%ebp
+      6f:	57                   	push   %edi
+      70:	56                   	push   %esi
+      71:	53                   	push   %ebx
+      72:	51                   	push   %ecx
+      73:	83 ec 18             	sub    $0x18,%esp
+      76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      7d:	8d 76 00             	lea    0x0(%esi),%esi
+    buf[i] = i;
+      80:	88 80 20 22 00 00    	mov    %al,0x2220(%eax)
+  for(i = 0; i < BUFSZ; i++)
+      86:	83 c0 01             	add    $0x1,%eax
+      89:	3d 00 00 01 00       	cmp    $0x10000,%eax
+      8e:	75 f0                	jne    80 <main+0x20>
+
+  if((fd = open("rwbench.tmp", O_CREATE|O_RDWR)) < 0){
+      90:	83 ec 08             	sub    $0x8,%esp
+      93:	68 02 02 00 00       	push   $0x202
+      98:	68 52 11 00 00       	push   $0x1152
+      9d:	e8 fe 06 00 00       	call   7a0 <open>
+      a2:	83 c4 10             	add    $0x10,%esp
+      a5:	89 c6                	mov    %eax,%esi
+      a7:	85 c0                	test   %eax,%eax
+      a9:	0f 88 4f 01 00 00    	js     1fe <main+0x19e>
+    printf(2, "rwbench: create failed\n");
+    exit();
+  }
+  t = uptime();
+      af:	e8 44 07 00 00       	call   7f8 <uptime>
+      b4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+      b7:	0f 31                	rdtsc
+      b9:	bb 04 00 00 00       	mov    $0x4,%ebx
+      be:	89 c7                	mov    %eax,%edi
+  c = cycles();
+  for(i = 0; i < NWRITE; i++){
+    close(fd);
+      c0:	83 ec 0c             	sub    $0xc,%esp
+      c3:	56                   	push   %esi
+      c4:	e8 d7 05 00 00       	call   6a0 <close>
+    if((fd = open("rwbench.tmp", O_RDWR)) < 0){
+      c9:	58                   	pop    %eax
+      ca:	5a                   	pop    %edx
+      cb:	6a 02                	push   $0x2
+      cd:	68 52 11 00 00       	push   $0x1152
+      d2:	e8 c9 06 00 00       	call   7a0 <open>
+      d7:	83 c4 10             	add    $0x10,%esp
+      da:	89 c6                	mov    %eax,%esi
+      dc:	85 c0                	test   %eax,%eax
+      de:	0f 88 2d 01 00 00    	js     211 <main+0x1b1>
+      printf(2, "rwbench: open failed\n");
+      exit();
+    }
+    for(j = 0; j < FILESZ / BUFSZ; j++){
+      if(write(fd, buf, BUFSZ) != BUFSZ){
+      e4:	83 ec 04             	sub    $0x4,%esp
+      e7:	68 00 00 01 00       	push   $0x10000
+      ec:	68 20 22 00 00       	push   $0x2220
+      f1:	50                   	push   %eax
+      f2:	e8 29 05 00 00       	call   620 <write>
+      f7:	83 c4 10             	add    $0x10,%esp
+      fa:	3d 00 00 01 00       	cmp    $0x10000,%eax
+      ff:	0f 85 1f 01 00 00    	jne    224 <main+0x1c4>
+     105:	83 ec 04             	sub    $0x4,%esp
+     108:	68 00 00 01 00       	push   $0x10000
+     10d:	68 20 22 00 00       	push   $0x2220
+     112:	56                   	push   %esi
+     113:	e8 08 05 00 00       	call   620 <write>
+     118:	83 c4 10             	add    $0x10,%esp
+     11b:	3d 00 00 01 00       	cmp    $0x10000,%eax
+     120:	0f 85 fe 00 00 00    	jne    224 <main+0x1c4>
+  for(i = 0; i < NWRITE; i++){
+     126:	83 eb 01             	sub    $0x1,%ebx
+     129:	75 95                	jne    c0 <main+0x60>
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+     12b:	0f 31                	rdtsc
+        printf(2, "rwbench: write failed\n");
+        exit();
+      }
+    }
+  }
+  c = cycles() - c;
+     12d:	29 f8                	sub    %edi,%eax
+     12f:	89 c3                	mov    %eax,%ebx
+  t = uptime() - t;
+     131:	e8 c2 06 00 00       	call   7f8 <uptime>
+  close(fd);
+     136:	83 ec 0c             	sub    $0xc,%esp
+  t = uptime() - t;
+     139:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  close(fd);
+     13c:	56                   	push   %esi
+  t = uptime() - t;
+     13d:	29 c8                	sub    %ecx,%eax
+     13f:	89 c7                	mov    %eax,%edi
+  close(fd);
+     141:	e8 5a 05 00 00       	call   6a0 <close>
+  report("write", NWRITE * FILESZ / BUFSZ, t, c);
+     146:	53                   	push   %ebx
+     147:	57                   	push   %edi
+     148:	6a 08                	push   $0x8
+     14a:	68 a3 11 00 00       	push   $0x11a3
+     14f:	e8 ac fe ff ff       	call   0 <report>
+
+  if((fd = open("rwbench.tmp", O_RDONLY)) < 0){
+     154:	83 c4 18             	add    $0x18,%esp
+     157:	6a 00                	push   $0x0
+     159:	68 52 11 00 00       	push   $0x1152
+     15e:	e8 3d 06 00 00       	call   7a0 <open>
+     163:	83 c4 10             	add    $0x10,%esp
+     166:	89 c6                	mov    %eax,%esi
+     168:	85 c0                	test   %eax,%eax
+     16a:	0f 88 a1 00 00 00    	js     211 <main+0x1b1>
+    printf(2, "rwbench: open failed\n");
+    exit();
+  }
+  t = uptime();
+     170:	e8 83 06 00 00       	call   7f8 <uptime>
+     175:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+     178:	0f 31                	rdtsc
+     17a:	bb 40 00 00 00       	mov    $0x40,%ebx
+     17f:	89 c7                	mov    %eax,%edi
+  c = cycles();
+  for(i = 0; i < NREAD; i++){
+     181:	eb 2b                	jmp    1ae <main+0x14e>
+     183:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     187:	90                   	nop
+    if((fd = open("rwbench.tmp", O_RDONLY)) < 0){
+      printf(2, "rwbench: open failed\n");
+      exit();
+    }
+    for(j = 0; j < FILESZ / BUFSZ; j++){
+      if(read(fd, buf, BUFSZ) != BUFSZ){
+     188:	83 ec 04             	sub    $0x4,%esp
+     18b:	68 00 00 01 00       	push   $0x10000
+     190:	68 20 22 00 00       	push   $0x2220
+     195:	56                   	push   %esi
+     196:	e8 05 04 00 00       	call   5a0 <read>
+     19b:	83 c4 10             	add    $0x10,%esp
+     19e:	3d 00 00 01 00       	cmp    $0x10000,%eax
+     1a3:	75 46                	jne    1eb <main+0x18b>
+  for(i = 0; i < NREAD; i++){
+     1a5:	83 eb 01             	sub    $0x1,%ebx
+     1a8:	0f 84 89 00 00 00    	je     237 <main+0x1d7>
+    close(fd);
+     1ae:	83 ec 0c             	sub    $0xc,%esp
+     1b1:	56                   	push   %esi
+     1b2:	e8 e9 04 00 00       	call   6a0 <close>
+    if((fd = open("rwbench.tmp", O_RDONLY)) < 0){
+     1b7:	5a                   	pop    %edx
+     1b8:	59                   	pop    %ecx
+     1b9:	6a 00                	push   $0x0
+     1bb:	68 52 11 00 00       	push   $0x1152
+     1c0:	e8 db 05 00 00       	call   7a0 <open>
+     1c5:	83 c4 10             	add    $0x10,%esp
+     1c8:	89 c6                	mov    %eax,%esi
+     1ca:	85 c0                	test   %eax,%eax
+     1cc:	78 43                	js     211 <main+0x1b1>
+      if(read(fd, buf, BUFSZ) != BUFSZ){
+     1ce:	83 ec 04             	sub    $0x4,%esp
+     1d1:	68 00 00 01 00       	push   $0x10000
+     1d6:	68 20 22 00 00       	push   $0x2220
+     1db:	50                   	push   %eax
+     1dc:	e8 bf 03 00 00       	call   5a0 <read>
+     1e1:	83 c4 10             	add    $0x10,%esp
+     1e4:	3d 00 00 01 00       	cmp    $0x10000,%eax
+     1e9:	74 9d                	je     188 <main+0x128>
+        printf(2, "rwbench: read failed\n");
+     1eb:	50                   	push   %eax
+     1ec:	50                   	push   %eax
+     1ed:	68 a9 11 00 00       	push   $0x11a9
+     1f2:	6a 02                	push   $0x2
+     1f4:	e8 e7 0a 00 00       	call   ce0 <printf>
+        exit();
+     1f9:	e8 52 03 00 00       	call   550 <exit>
+    printf(2, "rwbench: create failed\n");
+     1fe:	51                   	push   %ecx
+     1ff:	51                   	push   %ecx
+     200:	68 5e 11 00 00       	push   $0x115e
+     205:	6a 02                	push   $0x2
+     207:	e8 d4 0a 00 00       	call   ce0 <printf>
+    exit();
+     20c:	e8 3f 03 00 00       	call   550 <exit>
+      printf(2, "rwbench: open failed\n");
+     211:	56                   	push   %esi
+     212:	56                   	push   %esi
+     213:	68 76 11 00 00       	push   $0x1176
+     218:	6a 02                	push   $0x2
+     21a:	e8 c1 0a 00 00       	call   ce0 <printf>
+      exit();
+     21f:	e8 2c 03 00 00       	call   550 <exit>
+        printf(2, "rwbench: write failed\n");
+     224:	53                   	push   %ebx
+     225:	53                   	push   %ebx
+     226:	68 8c 11 00 00       	push   $0x118c
+     22b:	6a 02                	push   $0x2
+     22d:	e8 ae 0a 00 00       	call   ce0 <printf>
+        exit();
+     232:	e8 19 03 00 00       	call   550 <exit>
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+     237:	0f 31                	rdtsc
+      }
+    }
+  }
+  c = cycles() - c;
+     239:	29 f8                	sub    %edi,%eax
+     23b:	89 c3                	mov    %eax,%ebx
+  t = uptime() - t;
+     23d:	e8 b6 05 00 00       	call   7f8 <uptime>
+  close(fd);
+     242:	83 ec 0c             	sub    $0xc,%esp
+  t = uptime() - t;
+     245:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  close(fd);
+     248:	56                   	push   %esi
+  t = uptime() - t;
+     249:	29 c8                	sub    %ecx,%eax
+     24b:	89 c7                	mov    %eax,%edi
+  close(fd);
+     24d:	e8 4e 04 00 00       	call   6a0 <close>
+  report("read", NREAD * FILESZ / BUFSZ, t, c);
+     252:	53                   	push   %ebx
+     253:	57                   	push   %edi
+     254:	68 80 00 00 00       	push   $0x80
+     259:	68 bf 11 00 00       	push   $0x11bf
+     25e:	e8 9d fd ff ff       	call   0 <report>
+
+  unlink("rwbench.tmp");
+     263:	83 c4 14             	add    $0x14,%esp
+     266:	68 52 11 00 00       	push   $0x1152
+     26b:	e8 40 05 00 00       	call   7b0 <unlink>
+  exit();
+     270:	e8 db 02 00 00       	call   550 <exit>
+     275:	66 90                	xchg   %ax,%ax
+     277:	66 90                	xchg   %ax,%ax
+     279:	66 90                	xchg   %ax,%ax
+     27b:	66 90                	xchg   %ax,%ax
+     27d:	66 90                	xchg   %ax,%ax
+     27f:	90                   	nop
+
+00000280 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     280:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     281:	31 c0                	xor    %eax,%eax
+{
+     283:	89 e5                	mov    %esp,%ebp
+     285:	53                   	push   %ebx
+     286:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     289:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     28c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     290:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     294:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     297:	83 c0 01             	add    $0x1,%eax
+     29a:	84 d2                	test   %dl,%dl
+     29c:	75 f2                	jne    290 <strcpy+0x10>
+    ;
+  return os;
+}
+     29e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     2a1:	89 c8                	mov    %ecx,%eax
+     2a3:	c9                   	leave
+     2a4:	c3                   	ret
+     2a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002b0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     2b0:	55                   	push   %ebp
+     2b1:	89 e5                	mov    %esp,%ebp
+     2b3:	53                   	push   %ebx
+     2b4:	8b 55 08             	mov    0x8(%ebp),%edx
+     2b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     2ba:	0f b6 02             	movzbl (%edx),%eax
+     2bd:	84 c0                	test   %al,%al
+     2bf:	75 17                	jne    2d8 <strcmp+0x28>
+     2c1:	eb 3a                	jmp    2fd <strcmp+0x4d>
+     2c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2c7:	90                   	nop
+     2c8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     2cc:	83 c2 01             	add    $0x1,%edx
+     2cf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     2d2:	84 c0                	test   %al,%al
+     2d4:	74 1a                	je     2f0 <strcmp+0x40>
+    p++, q++;
+     2d6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     2d8:	0f b6 19             	movzbl (%ecx),%ebx
+     2db:	38 c3                	cmp    %al,%bl
+     2dd:	74 e9                	je     2c8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     2df:	29 d8                	sub    %ebx,%eax
+}
+     2e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     2e4:	c9                   	leave
+     2e5:	c3                   	ret
+     2e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2ed:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     2f0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     2f4:	31 c0                	xor    %eax,%eax
+     2f6:	29 d8                	sub    %ebx,%eax
+}
+     2f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     2fb:	c9                   	leave
+     2fc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     2fd:	0f b6 19             	movzbl (%ecx),%ebx
+     300:	31 c0                	xor    %eax,%eax
+     302:	eb db                	jmp    2df <strcmp+0x2f>
+     304:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     30b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     30f:	90                   	nop
+
+00000310 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     310:	55                   	push   %ebp
+     311:	89 e5                	mov    %esp,%ebp
+     313:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     316:	80 3a 00             	cmpb   $0x0,(%edx)
+     319:	74 15                	je     330 <strlen+0x20>
+     31b:	31 c0                	xor    %eax,%eax
+     31d:	8d 76 00             	lea    0x0(%esi),%esi
+     320:	83 c0 01             	add    $0x1,%eax
+     323:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     327:	89 c1                	mov    %eax,%ecx
+     329:	75 f5                	jne    320 <strlen+0x10>
+    ;
+  return n;
+}
+     32b:	89 c8                	mov    %ecx,%eax
+     32d:	5d                   	pop    %ebp
+     32e:	c3                   	ret
+     32f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     330:	31 c9                	xor    %ecx,%ecx
+}
+     332:	5d                   	pop    %ebp
+     333:	89 c8                	mov    %ecx,%eax
+     335:	c3                   	ret
+     336:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     33d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000340 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     340:	55                   	push   %ebp
+     341:	89 e5                	mov    %esp,%ebp
+     343:	57                   	push   %edi
+     344:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     347:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     34a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     34d:	89 d7                	mov    %edx,%edi
+     34f:	fc                   	cld
+     350:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     352:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     355:	89 d0                	mov    %edx,%eax
+     357:	c9                   	leave
+     358:	c3                   	ret
+     359:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000360 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     360:	55                   	push   %ebp
+     361:	89 e5                	mov    %esp,%ebp
+     363:	56                   	push   %esi
+     364:	53                   	push   %ebx
+     365:	8b 75 10             	mov    0x10(%ebp),%esi
+     368:	8b 55 08             	mov    0x8(%ebp),%edx
+     36b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+     36e:	85 f6                	test   %esi,%esi
+     370:	74 2e                	je     3a0 <memcmp+0x40>
+     372:	01 c6                	add    %eax,%esi
+     374:	eb 14                	jmp    38a <memcmp+0x2a>
+     376:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     37d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+     380:	83 c0 01             	add    $0x1,%eax
+     383:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+     386:	39 f0                	cmp    %esi,%eax
+     388:	74 16                	je     3a0 <memcmp+0x40>
+    if(*s1 != *s2)
+     38a:	0f b6 0a             	movzbl (%edx),%ecx
+     38d:	0f b6 18             	movzbl (%eax),%ebx
+     390:	38 d9                	cmp    %bl,%cl
+     392:	74 ec                	je     380 <memcmp+0x20>
+      return *s1 - *s2;
+     394:	0f b6 c1             	movzbl %cl,%eax
+     397:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+     399:	5b                   	pop    %ebx
+     39a:	5e                   	pop    %esi
+     39b:	5d                   	pop    %ebp
+     39c:	c3                   	ret
+     39d:	8d 76 00             	lea    0x0(%esi),%esi
+     3a0:	5b                   	pop    %ebx
+  return 0;
+     3a1:	31 c0                	xor    %eax,%eax
+}
+     3a3:	5e                   	pop    %esi
+     3a4:	5d                   	pop    %ebp
+     3a5:	c3                   	ret
+     3a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003b0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     3b0:	55                   	push   %ebp
+     3b1:	89 e5                	mov    %esp,%ebp
+     3b3:	8b 45 08             	mov    0x8(%ebp),%eax
+     3b6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     3ba:	0f b6 10             	movzbl (%eax),%edx
+     3bd:	84 d2                	test   %dl,%dl
+     3bf:	75 12                	jne    3d3 <strchr+0x23>
+     3c1:	eb 1d                	jmp    3e0 <strchr+0x30>
+     3c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     3c7:	90                   	nop
+     3c8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     3cc:	83 c0 01             	add    $0x1,%eax
+     3cf:	84 d2                	test   %dl,%dl
+     3d1:	74 0d                	je     3e0 <strchr+0x30>
+    if(*s == c)
+     3d3:	38 d1                	cmp    %dl,%cl
+     3d5:	75 f1                	jne    3c8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     3d7:	5d                   	pop    %ebp
+     3d8:	c3                   	ret
+     3d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     3e0:	31 c0                	xor    %eax,%eax
+}
+     3e2:	5d                   	pop    %ebp
+     3e3:	c3                   	ret
+     3e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     3ef:	90                   	nop
+
+000003f0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     3f0:	55                   	push   %ebp
+     3f1:	89 e5                	mov    %esp,%ebp
+     3f3:	57                   	push   %edi
+     3f4:	56                   	push   %esi
+int
+read(int fd, void *buf, int n)
+{
+  if(flushhook)
+    flushhook();
+  return _read(fd, buf, n);
+     3f5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     3f8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     3f9:	31 db                	xor    %ebx,%ebx
+{
+     3fb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     3fe:	eb 32                	jmp    432 <gets+0x42>
+  if(flushhook)
+     400:	a1 20 22 01 00       	mov    0x12220,%eax
+     405:	85 c0                	test   %eax,%eax
+     407:	74 02                	je     40b <gets+0x1b>
+    flushhook();
+     409:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+     40b:	83 ec 04             	sub    $0x4,%esp
+     40e:	6a 01                	push   $0x1
+     410:	56                   	push   %esi
+     411:	6a 00                	push   $0x0
+     413:	e8 60 03 00 00       	call   778 <_read>
+    if(cc < 1)
+     418:	83 c4 10             	add    $0x10,%esp
+     41b:	85 c0                	test   %eax,%eax
+     41d:	7e 1d                	jle    43c <gets+0x4c>
+    buf[i++] = c;
+     41f:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     423:	8b 55 08             	mov    0x8(%ebp),%edx
+     426:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     42a:	3c 0a                	cmp    $0xa,%al
+     42c:	74 10                	je     43e <gets+0x4e>
+     42e:	3c 0d                	cmp    $0xd,%al
+     430:	74 0c                	je     43e <gets+0x4e>
+  for(i=0; i+1 < max; ){
+     432:	89 df                	mov    %ebx,%edi
+     434:	83 c3 01             	add    $0x1,%ebx
+     437:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     43a:	7c c4                	jl     400 <gets+0x10>
+     43c:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+     43e:	8b 45 08             	mov    0x8(%ebp),%eax
+     441:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+     445:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     448:	5b                   	pop    %ebx
+     449:	5e                   	pop    %esi
+     44a:	5f                   	pop    %edi
+     44b:	5d                   	pop    %ebp
+     44c:	c3                   	ret
+     44d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000450 <stat>:
+{
+     450:	55                   	push   %ebp
+     451:	89 e5                	mov    %esp,%ebp
+     453:	56                   	push   %esi
+     454:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+     455:	83 ec 08             	sub    $0x8,%esp
+     458:	6a 00                	push   $0x0
+     45a:	ff 75 08             	push   0x8(%ebp)
+     45d:	e8 3e 03 00 00       	call   7a0 <open>
+  if(fd < 0)
+     462:	83 c4 10             	add    $0x10,%esp
+     465:	85 c0                	test   %eax,%eax
+     467:	78 37                	js     4a0 <stat+0x50>
+  r = fstat(fd, st);
+     469:	83 ec 08             	sub    $0x8,%esp
+     46c:	ff 75 0c             	push   0xc(%ebp)
+     46f:	89 c3                	mov    %eax,%ebx
+     471:	50                   	push   %eax
+     472:	e8 41 03 00 00       	call   7b8 <fstat>
+}
+
+int
+close(int fd)
+{
+  if(flushhook)
+     477:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+     47a:	89 c6                	mov    %eax,%esi
+  if(flushhook)
+     47c:	a1 20 22 01 00       	mov    0x12220,%eax
+     481:	85 c0                	test   %eax,%eax
+     483:	74 02                	je     487 <stat+0x37>
+    flushhook();
+     485:	ff d0                	call   *%eax
+  return _close(fd);
+     487:	83 ec 0c             	sub    $0xc,%esp
+     48a:	53                   	push   %ebx
+     48b:	e8 f8 02 00 00       	call   788 <_close>
+     490:	83 c4 10             	add    $0x10,%esp
+}
+     493:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     496:	89 f0                	mov    %esi,%eax
+     498:	5b                   	pop    %ebx
+     499:	5e                   	pop    %esi
+     49a:	5d                   	pop    %ebp
+     49b:	c3                   	ret
+     49c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+     4a0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     4a5:	eb ec                	jmp    493 <stat+0x43>
+     4a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4ae:	66 90                	xchg   %ax,%ax
+
+000004b0 <atoi>:
+{
+     4b0:	55                   	push   %ebp
+     4b1:	89 e5                	mov    %esp,%ebp
+     4b3:	53                   	push   %ebx
+     4b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+     4b7:	0f be 02             	movsbl (%edx),%eax
+     4ba:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     4bd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     4c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     4c5:	77 1e                	ja     4e5 <atoi+0x35>
+     4c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4ce:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     4d0:	83 c2 01             	add    $0x1,%edx
+     4d3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     4d6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     4da:	0f be 02             	movsbl (%edx),%eax
+     4dd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     4e0:	80 fb 09             	cmp    $0x9,%bl
+     4e3:	76 eb                	jbe    4d0 <atoi+0x20>
+}
+     4e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     4e8:	89 c8                	mov    %ecx,%eax
+     4ea:	c9                   	leave
+     4eb:	c3                   	ret
+     4ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004f0 <memmove>:
+{
+     4f0:	55                   	push   %ebp
+     4f1:	89 e5                	mov    %esp,%ebp
+     4f3:	57                   	push   %edi
+     4f4:	56                   	push   %esi
+     4f5:	8b 45 10             	mov    0x10(%ebp),%eax
+     4f8:	8b 55 08             	mov    0x8(%ebp),%edx
+     4fb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+     4fe:	85 c0                	test   %eax,%eax
+     500:	7e 13                	jle    515 <memmove+0x25>
+     502:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     504:	89 d7                	mov    %edx,%edi
+     506:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     50d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     510:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     511:	39 f8                	cmp    %edi,%eax
+     513:	75 fb                	jne    510 <memmove+0x20>
+}
+     515:	5e                   	pop    %esi
+     516:	89 d0                	mov    %edx,%eax
+     518:	5f                   	pop    %edi
+     519:	5d                   	pop    %ebp
+     51a:	c3                   	ret
+     51b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     51f:	90                   	nop
+
+00000520 <fork>:
+  if(flushhook)
+     520:	a1 20 22 01 00       	mov    0x12220,%eax
+     525:	85 c0                	test   %eax,%eax
+     527:	74 17                	je     540 <fork+0x20>
+{
+     529:	55                   	push   %ebp
+     52a:	89 e5                	mov    %esp,%ebp
+     52c:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+     52f:	ff d0                	call   *%eax
+}
+     531:	c9                   	leave
+  return _fork();
+     532:	e9 21 02 00 00       	jmp    758 <_fork>
+     537:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     53e:	66 90                	xchg   %ax,%ax
+     540:	e9 13 02 00 00       	jmp    758 <_fork>
+     545:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     54c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000550 <exit>:
+{
+     550:	55                   	push   %ebp
+     551:	89 e5                	mov    %esp,%ebp
+     553:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+     556:	a1 20 22 01 00       	mov    0x12220,%eax
+     55b:	85 c0                	test   %eax,%eax
+     55d:	74 02                	je     561 <exit+0x11>
+    flushhook();
+     55f:	ff d0                	call   *%eax
+  _exit();
+     561:	e8 fa 01 00 00       	call   760 <_exit>
+     566:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     56d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000570 <exec>:
+{
+     570:	55                   	push   %ebp
+  if(flushhook)
+     571:	a1 20 22 01 00       	mov    0x12220,%eax
+{
+     576:	89 e5                	mov    %esp,%ebp
+     578:	56                   	push   %esi
+     579:	53                   	push   %ebx
+     57a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     57d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+     580:	85 c0                	test   %eax,%eax
+     582:	74 02                	je     586 <exec+0x16>
+    flushhook();
+     584:	ff d0                	call   *%eax
+  return _exec(path, argv);
+     586:	89 75 0c             	mov    %esi,0xc(%ebp)
+     589:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     58c:	5b                   	pop    %ebx
+     58d:	5e                   	pop    %esi
+     58e:	5d                   	pop    %ebp
+  return _exec(path, argv);
+     58f:	e9 04 02 00 00       	jmp    798 <_exec>
+     594:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     59b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     59f:	90                   	nop
+
+000005a0 <read>:
+{
+     5a0:	55                   	push   %ebp
+     5a1:	89 e5                	mov    %esp,%ebp
+     5a3:	57                   	push   %edi
+     5a4:	56                   	push   %esi
+     5a5:	53                   	push   %ebx
+     5a6:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     5a9:	a1 20 22 01 00       	mov    0x12220,%eax
+{
+     5ae:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     5b1:	8b 75 0c             	mov    0xc(%ebp),%esi
+     5b4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     5b7:	85 c0                	test   %eax,%eax
+     5b9:	74 02                	je     5bd <read+0x1d>
+    flushhook();
+     5bb:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+     5bd:	89 7d 10             	mov    %edi,0x10(%ebp)
+     5c0:	89 75 0c             	mov    %esi,0xc(%ebp)
+     5c3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     5c6:	83 c4 0c             	add    $0xc,%esp
+     5c9:	5b                   	pop    %ebx
+     5ca:	5e                   	pop    %esi
+     5cb:	5f                   	pop    %edi
+     5cc:	5d                   	pop    %ebp
+  return _read(fd, buf, n);
+     5cd:	e9 a6 01 00 00       	jmp    778 <_read>
+     5d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000005e0 <readv>:
+{
+     5e0:	55                   	push   %ebp
+     5e1:	89 e5                	mov    %esp,%ebp
+     5e3:	57                   	push   %edi
+     5e4:	56                   	push   %esi
+     5e5:	53                   	push   %ebx
+     5e6:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     5e9:	a1 20 22 01 00       	mov    0x12220,%eax
+{
+     5ee:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     5f1:	8b 75 0c             	mov    0xc(%ebp),%esi
+     5f4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     5f7:	85 c0                	test   %eax,%eax
+     5f9:	74 02                	je     5fd <readv+0x1d>
+    flushhook();
+     5fb:	ff d0                	call   *%eax
+  return _readv(fd, iov, cnt);
+     5fd:	89 7d 10             	mov    %edi,0x10(%ebp)
+     600:	89 75 0c             	mov    %esi,0xc(%ebp)
+     603:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     606:	83 c4 0c             	add    $0xc,%esp
+     609:	5b                   	pop    %ebx
+     60a:	5e                   	pop    %esi
+     60b:	5f                   	pop    %edi
+     60c:	5d                   	pop    %ebp
+  return _readv(fd, iov, cnt);
+     60d:	e9 76 02 00 00       	jmp    888 <_readv>
+     612:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     619:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000620 <write>:
+{
+     620:	55                   	push   %ebp
+     621:	89 e5                	mov    %esp,%ebp
+     623:	57                   	push   %edi
+     624:	56                   	push   %esi
+     625:	53                   	push   %ebx
+     626:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     629:	a1 20 22 01 00       	mov    0x12220,%eax
+{
+     62e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     631:	8b 75 0c             	mov    0xc(%ebp),%esi
+     634:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     637:	85 c0                	test   %eax,%eax
+     639:	74 02                	je     63d <write+0x1d>
+    flushhook();
+     63b:	ff d0                	call   *%eax
+  return _write(fd, buf, n);
+     63d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     640:	89 75 0c             	mov    %esi,0xc(%ebp)
+     643:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     646:	83 c4 0c             	add    $0xc,%esp
+     649:	5b                   	pop    %ebx
+     64a:	5e                   	pop    %esi
+     64b:	5f                   	pop    %edi
+     64c:	5d                   	pop    %ebp
+  return _write(fd, buf, n);
+     64d:	e9 2e 01 00 00       	jmp    780 <_write>
+     652:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     659:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000660 <writev>:
+{
+     660:	55                   	push   %ebp
+     661:	89 e5                	mov    %esp,%ebp
+     663:	57                   	push   %edi
+     664:	56                   	push   %esi
+     665:	53                   	push   %ebx
+     666:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     669:	a1 20 22 01 00       	mov    0x12220,%eax
+{
+     66e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     671:	8b 75 0c             	mov    0xc(%ebp),%esi
+     674:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     677:	85 c0                	test   %eax,%eax
+     679:	74 02                	je     67d <writev+0x1d>
+    flushhook();
+     67b:	ff d0                	call   *%eax
+  return _writev(fd, iov, cnt);
+     67d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     680:	89 75 0c             	mov    %esi,0xc(%ebp)
+     683:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     686:	83 c4 0c             	add    $0xc,%esp
+     689:	5b                   	pop    %ebx
+     68a:	5e                   	pop    %esi
+     68b:	5f                   	pop    %edi
+     68c:	5d                   	pop    %ebp
+  return _writev(fd, iov, cnt);
+     68d:	e9 fe 01 00 00       	jmp    890 <_writev>
+     692:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     699:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000006a0 <close>:
+{
+     6a0:	55                   	push   %ebp
+     6a1:	89 e5                	mov    %esp,%ebp
+     6a3:	53                   	push   %ebx
+     6a4:	83 ec 04             	sub    $0x4,%esp
+  if(flushhook)
+     6a7:	a1 20 22 01 00       	mov    0x12220,%eax
+{
+     6ac:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(flushhook)
+     6af:	85 c0                	test   %eax,%eax
+     6b1:	74 02                	je     6b5 <close+0x15>
+    flushhook();
+     6b3:	ff d0                	call   *%eax
+  return _close(fd);
+     6b5:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     6b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     6bb:	c9                   	leave
+  return _close(fd);
+     6bc:	e9 c7 00 00 00       	jmp    788 <_close>
+     6c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6cf:	90                   	nop
+
+000006d0 <umtxinit>:
+// process that finds the mutex held enters the kernel, to sleep
+// in futexwait() until the holder's umtxunlock() wakes it.
+
+void
+umtxinit(struct umutex *m)
+{
+     6d0:	55                   	push   %ebp
+     6d1:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+     6d3:	8b 45 08             	mov    0x8(%ebp),%eax
+     6d6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     6dc:	5d                   	pop    %ebp
+     6dd:	c3                   	ret
+     6de:	66 90                	xchg   %ax,%ax
+
+000006e0 <umtxlock>:
+
+void
+umtxlock(struct umutex *m)
+{
+     6e0:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+     6e1:	b8 01 00 00 00       	mov    $0x1,%eax
+     6e6:	89 e5                	mov    %esp,%ebp
+     6e8:	56                   	push   %esi
+     6e9:	53                   	push   %ebx
+     6ea:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     6ed:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 1) == 0)
+     6f0:	85 c0                	test   %eax,%eax
+     6f2:	74 2b                	je     71f <umtxlock+0x3f>
+     6f4:	b8 02 00 00 00       	mov    $0x2,%eax
+     6f9:	f0 87 03             	lock xchg %eax,(%ebx)
+    return;
+  // Mark the mutex contended, so that its holder
+  // wakes a waiter on release, and wait.
+  while(xchg(&m->state, 2) != 0)
+     6fc:	85 c0                	test   %eax,%eax
+     6fe:	74 1f                	je     71f <umtxlock+0x3f>
+     700:	be 02 00 00 00       	mov    $0x2,%esi
+     705:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwait(&m->state, 2);
+     708:	83 ec 08             	sub    $0x8,%esp
+     70b:	6a 02                	push   $0x2
+     70d:	53                   	push   %ebx
+     70e:	e8 85 01 00 00       	call   898 <futexwait>
+     713:	89 f0                	mov    %esi,%eax
+     715:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+     718:	83 c4 10             	add    $0x10,%esp
+     71b:	85 c0                	test   %eax,%eax
+     71d:	75 e9                	jne    708 <umtxlock+0x28>
+}
+     71f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     722:	5b                   	pop    %ebx
+     723:	5e                   	pop    %esi
+     724:	5d                   	pop    %ebp
+     725:	c3                   	ret
+     726:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     72d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000730 <umtxunlock>:
+
+void
+umtxunlock(struct umutex *m)
+{
+     730:	55                   	push   %ebp
+     731:	31 c0                	xor    %eax,%eax
+     733:	89 e5                	mov    %esp,%ebp
+     735:	83 ec 08             	sub    $0x8,%esp
+     738:	8b 55 08             	mov    0x8(%ebp),%edx
+     73b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+     73e:	83 f8 02             	cmp    $0x2,%eax
+     741:	74 05                	je     748 <umtxunlock+0x18>
+    futexwake(&m->state, 1);
+}
+     743:	c9                   	leave
+     744:	c3                   	ret
+     745:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwake(&m->state, 1);
+     748:	83 ec 08             	sub    $0x8,%esp
+     74b:	6a 01                	push   $0x1
+     74d:	52                   	push   %edx
+     74e:	e8 4d 01 00 00       	call   8a0 <futexwake>
+     753:	83 c4 10             	add    $0x10,%esp
+}
+     756:	c9                   	leave
+     757:	c3                   	ret
+
+00000758 <_fork>:
+  _ ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+     758:	b8 01 00 00 00       	mov    $0x1,%eax
+     75d:	cd 40                	int    $0x40
+     75f:	c3                   	ret
+
+00000760 <_exit>:
+RAWSYSCALL(exit)
+     760:	b8 02 00 00 00       	mov    $0x2,%eax
+     765:	cd 40                	int    $0x40
+     767:	c3                   	ret
+
+00000768 <wait>:
+SYSCALL(wait)
+     768:	b8 03 00 00 00       	mov    $0x3,%eax
+     76d:	cd 40                	int    $0x40
+     76f:	c3                   	ret
+
+00000770 <pipe>:
+SYSCALL(pipe)
+     770:	b8 04 00 00 00       	mov    $0x4,%eax
+     775:	cd 40                	int    $0x40
+     777:	c3                   	ret
+
+00000778 <_read>:
+RAWSYSCALL(read)
+     778:	b8 05 00 00 00       	mov    $0x5,%eax
+     77d:	cd 40                	int    $0x40
+     77f:	c3                   	ret
+
+00000780 <_write>:
+RAWSYSCALL(write)
+     780:	b8 10 00 00 00       	mov    $0x10,%eax
+     785:	cd 40                	int    $0x40
+     787:	c3                   	ret
+
+00000788 <_close>:
+RAWSYSCALL(close)
+     788:	b8 15 00 00 00       	mov    $0x15,%eax
+     78d:	cd 40                	int    $0x40
+     78f:	c3                   	ret
+
+00000790 <kill>:
+SYSCALL(kill)
+     790:	b8 06 00 00 00       	mov    $0x6,%eax
+     795:	cd 40                	int    $0x40
+     797:	c3                   	ret
+
+00000798 <_exec>:
+RAWSYSCALL(exec)
+     798:	b8 07 00 00 00       	mov    $0x7,%eax
+     79d:	cd 40                	int    $0x40
+     79f:	c3                   	ret
+
+000007a0 <open>:
+SYSCALL(open)
+     7a0:	b8 0f 00 00 00       	mov    $0xf,%eax
+     7a5:	cd 40                	int    $0x40
+     7a7:	c3                   	ret
+
+000007a8 <mknod>:
+SYSCALL(mknod)
+     7a8:	b8 11 00 00 00       	mov    $0x11,%eax
+     7ad:	cd 40                	int    $0x40
+     7af:	c3                   	ret
+
+000007b0 <unlink>:
+SYSCALL(unlink)
+     7b0:	b8 12 00 00 00       	mov    $0x12,%eax
+     7b5:	cd 40                	int    $0x40
+     7b7:	c3                   	ret
+
+000007b8 <fstat>:
+SYSCALL(fstat)
+     7b8:	b8 08 00 00 00       	mov    $0x8,%eax
+     7bd:	cd 40                	int    $0x40
+     7bf:	c3                   	ret
+
+000007c0 <link>:
+SYSCALL(link)
+     7c0:	b8 13 00 00 00       	mov    $0x13,%eax
+     7c5:	cd 40                	int    $0x40
+     7c7:	c3                   	ret
+
+000007c8 <mkdir>:
+SYSCALL(mkdir)
+     7c8:	b8 14 00 00 00       	mov    $0x14,%eax
+     7cd:	cd 40                	int    $0x40
+     7cf:	c3                   	ret
+
+000007d0 <chdir>:
+SYSCALL(chdir)
+     7d0:	b8 09 00 00 00       	mov    $0x9,%eax
+     7d5:	cd 40                	int    $0x40
+     7d7:	c3                   	ret
+
+000007d8 <dup>:
+SYSCALL(dup)
+     7d8:	b8 0a 00 00 00       	mov    $0xa,%eax
+     7dd:	cd 40                	int    $0x40
+     7df:	c3                   	ret
+
+000007e0 <getpid>:
+SYSCALL(getpid)
+     7e0:	b8 0b 00 00 00       	mov    $0xb,%eax
+     7e5:	cd 40                	int    $0x40
+     7e7:	c3                   	ret
+
+000007e8 <sbrk>:
+SYSCALL(sbrk)
+     7e8:	b8 0c 00 00 00       	mov    $0xc,%eax
+     7ed:	cd 40                	int    $0x40
+     7ef:	c3                   	ret
+
+000007f0 <sleep>:
+SYSCALL(sleep)
+     7f0:	b8 0d 00 00 00       	mov    $0xd,%eax
+     7f5:	cd 40                	int    $0x40
+     7f7:	c3                   	ret
+
+000007f8 <uptime>:
+SYSCALL(uptime)
+     7f8:	b8 0e 00 00 00       	mov    $0xe,%eax
+     7fd:	cd 40                	int    $0x40
+     7ff:	c3                   	ret
+
+00000800 <wolfie>:
+SYSCALL(wolfie)
+     800:	b8 16 00 00 00       	mov    $0x16,%eax
+     805:	cd 40                	int    $0x40
+     807:	c3                   	ret
+
+00000808 <nice>:
+SYSCALL(nice)
+     808:	b8 17 00 00 00       	mov    $0x17,%eax
+     80d:	cd 40                	int    $0x40
+     80f:	c3                   	ret
+
+00000810 <mtxget>:
+SYSCALL(mtxget)
+     810:	b8 18 00 00 00       	mov    $0x18,%eax
+     815:	cd 40                	int    $0x40
+     817:	c3                   	ret
+
+00000818 <mtxrel>:
+SYSCALL(mtxrel)
+     818:	b8 19 00 00 00       	mov    $0x19,%eax
+     81d:	cd 40                	int    $0x40
+     81f:	c3                   	ret
+
+00000820 <mtxacq>:
+SYSCALL(mtxacq)
+     820:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     825:	cd 40                	int    $0x40
+     827:	c3                   	ret
+
+00000828 <mtxdel>:
+SYSCALL(mtxdel)
+     828:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     82d:	cd 40                	int    $0x40
+     82f:	c3                   	ret
+
+00000830 <iostat>:
+SYSCALL(iostat)
+     830:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     835:	cd 40                	int    $0x40
+     837:	c3                   	ret
+
+00000838 <mmap>:
+SYSCALL(mmap)
+     838:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     83d:	cd 40                	int    $0x40
+     83f:	c3                   	ret
+
+00000840 <munmap>:
+SYSCALL(munmap)
+     840:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     845:	cd 40                	int    $0x40
+     847:	c3                   	ret
+
+00000848 <shmget>:
+SYSCALL(shmget)
+     848:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     84d:	cd 40                	int    $0x40
+     84f:	c3                   	ret
+
+00000850 <shmat>:
+SYSCALL(shmat)
+     850:	b8 20 00 00 00       	mov    $0x20,%eax
+     855:	cd 40                	int    $0x40
+     857:	c3                   	ret
+
+00000858 <shmdt>:
+SYSCALL(shmdt)
+     858:	b8 21 00 00 00       	mov    $0x21,%eax
+     85d:	cd 40                	int    $0x40
+     85f:	c3                   	ret
+
+00000860 <shmdel>:
+SYSCALL(shmdel)
+     860:	b8 22 00 00 00       	mov    $0x22,%eax
+     865:	cd 40                	int    $0x40
+     867:	c3                   	ret
+
+00000868 <syscount>:
+SYSCALL(syscount)
+     868:	b8 23 00 00 00       	mov    $0x23,%eax
+     86d:	cd 40                	int    $0x40
+     86f:	c3                   	ret
+
+00000870 <splice>:
+SYSCALL(splice)
+     870:	b8 24 00 00 00       	mov    $0x24,%eax
+     875:	cd 40                	int    $0x40
+     877:	c3                   	ret
+
+00000878 <tee>:
+SYSCALL(tee)
+     878:	b8 25 00 00 00       	mov    $0x25,%eax
+     87d:	cd 40                	int    $0x40
+     87f:	c3                   	ret
+
+00000880 <sendfile>:
+SYSCALL(sendfile)
+     880:	b8 26 00 00 00       	mov    $0x26,%eax
+     885:	cd 40                	int    $0x40
+     887:	c3                   	ret
+
+00000888 <_readv>:
+RAWSYSCALL(readv)
+     888:	b8 27 00 00 00       	mov    $0x27,%eax
+     88d:	cd 40                	int    $0x40
+     88f:	c3                   	ret
+
+00000890 <_writev>:
+RAWSYSCALL(writev)
+     890:	b8 28 00 00 00       	mov    $0x28,%eax
+     895:	cd 40                	int    $0x40
+     897:	c3                   	ret
+
+00000898 <futexwait>:
+SYSCALL(futexwait)
+     898:	b8 29 00 00 00       	mov    $0x29,%eax
+     89d:	cd 40                	int    $0x40
+     89f:	c3                   	ret
+
+000008a0 <futexwake>:
+SYSCALL(futexwake)
+     8a0:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     8a5:	cd 40                	int    $0x40
+     8a7:	c3                   	ret
+
+000008a8 <lockstat>:
+SYSCALL(lockstat)
+     8a8:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     8ad:	cd 40                	int    $0x40
+     8af:	c3                   	ret
+
+000008b0 <clone>:
+SYSCALL(clone)
+     8b0:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     8b5:	cd 40                	int    $0x40
+     8b7:	c3                   	ret
+
+000008b8 <join>:
+SYSCALL(join)
+     8b8:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     8bd:	cd 40                	int    $0x40
+     8bf:	c3                   	ret
+
+000008c0 <stacklimit>:
+SYSCALL(stacklimit)
+     8c0:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     8c5:	cd 40                	int    $0x40
+     8c7:	c3                   	ret
+     8c8:	66 90                	xchg   %ax,%ax
+     8ca:	66 90                	xchg   %ax,%ax
+     8cc:	66 90                	xchg   %ax,%ax
+     8ce:	66 90                	xchg   %ax,%ax
+
+000008d0 <flushall>:
+  b->n = 0;
+}
+
+static void
+flushall(void)
+{
+     8d0:	55                   	push   %ebp
+     8d1:	89 e5                	mov    %esp,%ebp
+     8d3:	83 ec 14             	sub    $0x14,%esp
+  umtxlock(&stdoutlock);
+     8d6:	68 24 22 01 00       	push   $0x12224
+     8db:	e8 00 fe ff ff       	call   6e0 <umtxlock>
+  if(b->n > 0)
+     8e0:	a1 08 20 00 00       	mov    0x2008,%eax
+     8e5:	83 c4 10             	add    $0x10,%esp
+     8e8:	85 c0                	test   %eax,%eax
+     8ea:	7e 17                	jle    903 <flushall+0x33>
+    _write(b->fd, b->buf, b->n);
+     8ec:	83 ec 04             	sub    $0x4,%esp
+     8ef:	50                   	push   %eax
+     8f0:	68 0c 20 00 00       	push   $0x200c
+     8f5:	ff 35 00 20 00 00    	push   0x2000
+     8fb:	e8 80 fe ff ff       	call   780 <_write>
+     900:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     903:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     90a:	00 00 00 
+  flush(&stdout);
+  umtxunlock(&stdoutlock);
+     90d:	83 ec 0c             	sub    $0xc,%esp
+     910:	68 24 22 01 00       	push   $0x12224
+     915:	e8 16 fe ff ff       	call   730 <umtxunlock>
+}
+     91a:	83 c4 10             	add    $0x10,%esp
+     91d:	c9                   	leave
+     91e:	c3                   	ret
+     91f:	90                   	nop
+
+00000920 <printint>:
+    flush(b);
+}
+
+static void
+printint(struct outbuf *b, int xx, int base, int sgn)
+{
+     920:	55                   	push   %ebp
+     921:	89 e5                	mov    %esp,%ebp
+     923:	57                   	push   %edi
+     924:	89 cf                	mov    %ecx,%edi
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     926:	89 d1                	mov    %edx,%ecx
+{
+     928:	56                   	push   %esi
+     929:	53                   	push   %ebx
+     92a:	89 c3                	mov    %eax,%ebx
+     92c:	83 ec 2c             	sub    $0x2c,%esp
+  if(sgn && xx < 0){
+     92f:	85 d2                	test   %edx,%edx
+     931:	0f 89 b9 00 00 00    	jns    9f0 <printint+0xd0>
+     937:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     93b:	0f 84 af 00 00 00    	je     9f0 <printint+0xd0>
+    x = -xx;
+     941:	f7 d9                	neg    %ecx
+    neg = 1;
+     943:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     948:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     94b:	31 f6                	xor    %esi,%esi
+     94d:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     950:	89 c8                	mov    %ecx,%eax
+     952:	31 d2                	xor    %edx,%edx
+     954:	89 f3                	mov    %esi,%ebx
+     956:	f7 f7                	div    %edi
+     958:	8d 76 01             	lea    0x1(%esi),%esi
+     95b:	0f b6 92 fc 15 00 00 	movzbl 0x15fc(%edx),%edx
+     962:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     966:	89 ca                	mov    %ecx,%edx
+     968:	89 c1                	mov    %eax,%ecx
+     96a:	39 fa                	cmp    %edi,%edx
+     96c:	73 e2                	jae    950 <printint+0x30>
+  if(neg)
+     96e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     971:	89 d9                	mov    %ebx,%ecx
+     973:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     976:	85 c0                	test   %eax,%eax
+     978:	74 07                	je     981 <printint+0x61>
+    buf[i++] = '-';
+     97a:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     97f:	89 f1                	mov    %esi,%ecx
+     981:	8d 75 d8             	lea    -0x28(%ebp),%esi
+     984:	89 cf                	mov    %ecx,%edi
+     986:	01 f7                	add    %esi,%edi
+     988:	eb 1a                	jmp    9a4 <printint+0x84>
+     98a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    *b->str++ = c;
+     990:	8d 48 01             	lea    0x1(%eax),%ecx
+     993:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+     999:	88 10                	mov    %dl,(%eax)
+
+  while(--i >= 0)
+     99b:	8d 47 ff             	lea    -0x1(%edi),%eax
+     99e:	39 fe                	cmp    %edi,%esi
+     9a0:	74 40                	je     9e2 <printint+0xc2>
+     9a2:	89 c7                	mov    %eax,%edi
+  if(b->str){
+     9a4:	8b 83 0c 02 00 00    	mov    0x20c(%ebx),%eax
+    putc(b, buf[i]);
+     9aa:	0f b6 17             	movzbl (%edi),%edx
+  if(b->str){
+     9ad:	85 c0                	test   %eax,%eax
+     9af:	75 df                	jne    990 <printint+0x70>
+  b->buf[b->n++] = c;
+     9b1:	8b 4b 08             	mov    0x8(%ebx),%ecx
+     9b4:	8d 41 01             	lea    0x1(%ecx),%eax
+     9b7:	89 43 08             	mov    %eax,0x8(%ebx)
+     9ba:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+     9be:	3d 00 02 00 00       	cmp    $0x200,%eax
+     9c3:	74 3b                	je     a00 <printint+0xe0>
+     9c5:	80 fa 0a             	cmp    $0xa,%dl
+     9c8:	75 d1                	jne    99b <printint+0x7b>
+     9ca:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+     9ce:	75 cb                	jne    99b <printint+0x7b>
+  if(b->n > 0)
+     9d0:	85 c0                	test   %eax,%eax
+     9d2:	7f 2c                	jg     a00 <printint+0xe0>
+  b->n = 0;
+     9d4:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  while(--i >= 0)
+     9db:	8d 47 ff             	lea    -0x1(%edi),%eax
+     9de:	39 fe                	cmp    %edi,%esi
+     9e0:	75 c0                	jne    9a2 <printint+0x82>
+}
+     9e2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     9e5:	5b                   	pop    %ebx
+     9e6:	5e                   	pop    %esi
+     9e7:	5f                   	pop    %edi
+     9e8:	5d                   	pop    %ebp
+     9e9:	c3                   	ret
+     9ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  neg = 0;
+     9f0:	31 c0                	xor    %eax,%eax
+     9f2:	e9 51 ff ff ff       	jmp    948 <printint+0x28>
+     9f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9fe:	66 90                	xchg   %ax,%ax
+    _write(b->fd, b->buf, b->n);
+     a00:	83 ec 04             	sub    $0x4,%esp
+     a03:	50                   	push   %eax
+     a04:	8d 43 0c             	lea    0xc(%ebx),%eax
+     a07:	50                   	push   %eax
+     a08:	ff 33                	push   (%ebx)
+     a0a:	e8 71 fd ff ff       	call   780 <_write>
+     a0f:	83 c4 10             	add    $0x10,%esp
+     a12:	eb c0                	jmp    9d4 <printint+0xb4>
+     a14:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     a1f:	90                   	nop
+
+00000a20 <putc>:
+{
+     a20:	55                   	push   %ebp
+     a21:	89 e5                	mov    %esp,%ebp
+     a23:	53                   	push   %ebx
+     a24:	89 c3                	mov    %eax,%ebx
+     a26:	83 ec 04             	sub    $0x4,%esp
+  if(b->str){
+     a29:	8b 80 0c 02 00 00    	mov    0x20c(%eax),%eax
+     a2f:	85 c0                	test   %eax,%eax
+     a31:	74 15                	je     a48 <putc+0x28>
+    *b->str++ = c;
+     a33:	8d 48 01             	lea    0x1(%eax),%ecx
+     a36:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+     a3c:	88 10                	mov    %dl,(%eax)
+}
+     a3e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     a41:	c9                   	leave
+     a42:	c3                   	ret
+     a43:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     a47:	90                   	nop
+  b->buf[b->n++] = c;
+     a48:	8b 4b 08             	mov    0x8(%ebx),%ecx
+     a4b:	8d 41 01             	lea    0x1(%ecx),%eax
+     a4e:	89 43 08             	mov    %eax,0x8(%ebx)
+     a51:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+     a55:	3d 00 02 00 00       	cmp    $0x200,%eax
+     a5a:	74 14                	je     a70 <putc+0x50>
+     a5c:	80 fa 0a             	cmp    $0xa,%dl
+     a5f:	75 dd                	jne    a3e <putc+0x1e>
+     a61:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+     a65:	75 d7                	jne    a3e <putc+0x1e>
+  if(b->n > 0)
+     a67:	85 c0                	test   %eax,%eax
+     a69:	7e 17                	jle    a82 <putc+0x62>
+     a6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     a6f:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     a70:	83 ec 04             	sub    $0x4,%esp
+     a73:	50                   	push   %eax
+     a74:	8d 43 0c             	lea    0xc(%ebx),%eax
+     a77:	50                   	push   %eax
+     a78:	ff 33                	push   (%ebx)
+     a7a:	e8 01 fd ff ff       	call   780 <_write>
+     a7f:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     a82:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+     a89:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     a8c:	c9                   	leave
+     a8d:	c3                   	ret
+     a8e:	66 90                	xchg   %ax,%ax
+
+00000a90 <format>:
+
+// Format fmt and the arguments at ap into b.
+// Only understands %d, %x, %p, %s, %c.
+static void
+format(struct outbuf *b, const char *fmt, uint *ap)
+{
+     a90:	55                   	push   %ebp
+     a91:	89 e5                	mov    %esp,%ebp
+     a93:	57                   	push   %edi
+     a94:	89 c7                	mov    %eax,%edi
+     a96:	56                   	push   %esi
+     a97:	53                   	push   %ebx
+     a98:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+     a9b:	0f b6 02             	movzbl (%edx),%eax
+{
+     a9e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  for(i = 0; fmt[i]; i++){
+     aa1:	84 c0                	test   %al,%al
+     aa3:	74 5a                	je     aff <format+0x6f>
+     aa5:	8d 5a 01             	lea    0x1(%edx),%ebx
+     aa8:	31 f6                	xor    %esi,%esi
+     aaa:	eb 1c                	jmp    ac8 <format+0x38>
+     aac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     ab0:	83 f8 25             	cmp    $0x25,%eax
+     ab3:	74 3b                	je     af0 <format+0x60>
+        state = '%';
+      } else {
+        putc(b, c);
+     ab5:	89 ca                	mov    %ecx,%edx
+     ab7:	89 f8                	mov    %edi,%eax
+     ab9:	e8 62 ff ff ff       	call   a20 <putc>
+  for(i = 0; fmt[i]; i++){
+     abe:	0f b6 03             	movzbl (%ebx),%eax
+     ac1:	83 c3 01             	add    $0x1,%ebx
+     ac4:	84 c0                	test   %al,%al
+     ac6:	74 37                	je     aff <format+0x6f>
+    c = fmt[i] & 0xff;
+     ac8:	0f be c8             	movsbl %al,%ecx
+     acb:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     ace:	85 f6                	test   %esi,%esi
+     ad0:	74 de                	je     ab0 <format+0x20>
+      }
+    } else if(state == '%'){
+     ad2:	83 fe 25             	cmp    $0x25,%esi
+     ad5:	75 e7                	jne    abe <format+0x2e>
+      if(c == 'd'){
+     ad7:	83 f8 25             	cmp    $0x25,%eax
+     ada:	74 46                	je     b22 <format+0x92>
+     adc:	83 e8 63             	sub    $0x63,%eax
+     adf:	83 f8 15             	cmp    $0x15,%eax
+     ae2:	77 2c                	ja     b10 <format+0x80>
+     ae4:	ff 24 85 a4 15 00 00 	jmp    *0x15a4(,%eax,4)
+     aeb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     aef:	90                   	nop
+  for(i = 0; fmt[i]; i++){
+     af0:	0f b6 03             	movzbl (%ebx),%eax
+     af3:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+     af6:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+     afb:	84 c0                	test   %al,%al
+     afd:	75 c9                	jne    ac8 <format+0x38>
+        putc(b, c);
+      }
+      state = 0;
+    }
+  }
+}
+     aff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     b02:	5b                   	pop    %ebx
+     b03:	5e                   	pop    %esi
+     b04:	5f                   	pop    %edi
+     b05:	5d                   	pop    %ebp
+     b06:	c3                   	ret
+     b07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b0e:	66 90                	xchg   %ax,%ax
+        putc(b, '%');
+     b10:	ba 25 00 00 00       	mov    $0x25,%edx
+     b15:	89 f8                	mov    %edi,%eax
+     b17:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     b1a:	e8 01 ff ff ff       	call   a20 <putc>
+        putc(b, c);
+     b1f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     b22:	89 ca                	mov    %ecx,%edx
+     b24:	89 f8                	mov    %edi,%eax
+      state = 0;
+     b26:	31 f6                	xor    %esi,%esi
+        putc(b, c);
+     b28:	e8 f3 fe ff ff       	call   a20 <putc>
+     b2d:	eb 8f                	jmp    abe <format+0x2e>
+     b2f:	90                   	nop
+        printint(b, *ap, 16, 0);
+     b30:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     b33:	83 ec 0c             	sub    $0xc,%esp
+     b36:	b9 10 00 00 00       	mov    $0x10,%ecx
+     b3b:	8b 16                	mov    (%esi),%edx
+     b3d:	6a 00                	push   $0x0
+        ap++;
+     b3f:	83 c6 04             	add    $0x4,%esi
+        printint(b, *ap, 16, 0);
+     b42:	89 f8                	mov    %edi,%eax
+     b44:	e8 d7 fd ff ff       	call   920 <printint>
+        ap++;
+     b49:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+     b4c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     b4f:	31 f6                	xor    %esi,%esi
+     b51:	e9 68 ff ff ff       	jmp    abe <format+0x2e>
+     b56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b5d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     b60:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     b63:	8b 30                	mov    (%eax),%esi
+        ap++;
+     b65:	83 c0 04             	add    $0x4,%eax
+     b68:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+     b6b:	85 f6                	test   %esi,%esi
+     b6d:	75 1b                	jne    b8a <format+0xfa>
+     b6f:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+     b74:	be 9c 15 00 00       	mov    $0x159c,%esi
+     b79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+          putc(b, *s);
+     b80:	89 f8                	mov    %edi,%eax
+          s++;
+     b82:	83 c6 01             	add    $0x1,%esi
+          putc(b, *s);
+     b85:	e8 96 fe ff ff       	call   a20 <putc>
+        while(*s != 0){
+     b8a:	0f be 16             	movsbl (%esi),%edx
+     b8d:	84 d2                	test   %dl,%dl
+     b8f:	75 ef                	jne    b80 <format+0xf0>
+      state = 0;
+     b91:	31 f6                	xor    %esi,%esi
+     b93:	e9 26 ff ff ff       	jmp    abe <format+0x2e>
+     b98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b9f:	90                   	nop
+        printint(b, *ap, 10, 1);
+     ba0:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     ba3:	83 ec 0c             	sub    $0xc,%esp
+     ba6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     bab:	8b 16                	mov    (%esi),%edx
+     bad:	6a 01                	push   $0x1
+     baf:	eb 8e                	jmp    b3f <format+0xaf>
+     bb1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(b, *ap);
+     bb8:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     bbb:	89 f8                	mov    %edi,%eax
+     bbd:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+     bc0:	83 c6 04             	add    $0x4,%esi
+        putc(b, *ap);
+     bc3:	e8 58 fe ff ff       	call   a20 <putc>
+        ap++;
+     bc8:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      state = 0;
+     bcb:	31 f6                	xor    %esi,%esi
+     bcd:	e9 ec fe ff ff       	jmp    abe <format+0x2e>
+     bd2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bd9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000be0 <fflush>:
+{
+     be0:	55                   	push   %ebp
+     be1:	89 e5                	mov    %esp,%ebp
+     be3:	83 ec 08             	sub    $0x8,%esp
+  if(fd == stdout.fd)
+     be6:	8b 45 08             	mov    0x8(%ebp),%eax
+     be9:	39 05 00 20 00 00    	cmp    %eax,0x2000
+     bef:	74 07                	je     bf8 <fflush+0x18>
+}
+     bf1:	c9                   	leave
+     bf2:	c3                   	ret
+     bf3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     bf7:	90                   	nop
+  umtxlock(&stdoutlock);
+     bf8:	83 ec 0c             	sub    $0xc,%esp
+     bfb:	68 24 22 01 00       	push   $0x12224
+     c00:	e8 db fa ff ff       	call   6e0 <umtxlock>
+  if(b->n > 0)
+     c05:	a1 08 20 00 00       	mov    0x2008,%eax
+     c0a:	83 c4 10             	add    $0x10,%esp
+     c0d:	85 c0                	test   %eax,%eax
+     c0f:	7f 1f                	jg     c30 <fflush+0x50>
+  b->n = 0;
+     c11:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     c18:	00 00 00 
+  umtxunlock(&stdoutlock);
+     c1b:	c7 45 08 24 22 01 00 	movl   $0x12224,0x8(%ebp)
+}
+     c22:	c9                   	leave
+  umtxunlock(&stdoutlock);
+     c23:	e9 08 fb ff ff       	jmp    730 <umtxunlock>
+     c28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c2f:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     c30:	83 ec 04             	sub    $0x4,%esp
+     c33:	50                   	push   %eax
+     c34:	68 0c 20 00 00       	push   $0x200c
+     c39:	ff 35 00 20 00 00    	push   0x2000
+     c3f:	e8 3c fb ff ff       	call   780 <_write>
+     c44:	83 c4 10             	add    $0x10,%esp
+     c47:	eb c8                	jmp    c11 <fflush+0x31>
+     c49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000c50 <setvbuf>:
+{
+     c50:	55                   	push   %ebp
+     c51:	89 e5                	mov    %esp,%ebp
+     c53:	53                   	push   %ebx
+     c54:	83 ec 04             	sub    $0x4,%esp
+     c57:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd != stdout.fd)
+     c5a:	8b 45 08             	mov    0x8(%ebp),%eax
+     c5d:	39 05 00 20 00 00    	cmp    %eax,0x2000
+     c63:	74 0b                	je     c70 <setvbuf+0x20>
+}
+     c65:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     c68:	c9                   	leave
+     c69:	c3                   	ret
+     c6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  umtxlock(&stdoutlock);
+     c70:	83 ec 0c             	sub    $0xc,%esp
+     c73:	68 24 22 01 00       	push   $0x12224
+     c78:	e8 63 fa ff ff       	call   6e0 <umtxlock>
+  if(b->n > 0)
+     c7d:	a1 08 20 00 00       	mov    0x2008,%eax
+     c82:	83 c4 10             	add    $0x10,%esp
+     c85:	85 c0                	test   %eax,%eax
+     c87:	7f 2f                	jg     cb8 <setvbuf+0x68>
+  b->n = 0;
+     c89:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     c90:	00 00 00 
+  stdout.mode = mode;
+     c93:	89 1d 04 20 00 00    	mov    %ebx,0x2004
+  flushhook = flushall;
+     c99:	c7 05 20 22 01 00 d0 	movl   $0x8d0,0x12220
+     ca0:	08 00 00 
+}
+     ca3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&stdoutlock);
+     ca6:	c7 45 08 24 22 01 00 	movl   $0x12224,0x8(%ebp)
+}
+     cad:	c9                   	leave
+  umtxunlock(&stdoutlock);
+     cae:	e9 7d fa ff ff       	jmp    730 <umtxunlock>
+     cb3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     cb7:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     cb8:	83 ec 04             	sub    $0x4,%esp
+     cbb:	50                   	push   %eax
+     cbc:	68 0c 20 00 00       	push   $0x200c
+     cc1:	ff 35 00 20 00 00    	push   0x2000
+     cc7:	e8 b4 fa ff ff       	call   780 <_write>
+     ccc:	83 c4 10             	add    $0x10,%esp
+     ccf:	eb b8                	jmp    c89 <setvbuf+0x39>
+     cd1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cd8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cdf:	90                   	nop
+
+00000ce0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s, %c.
+void
+printf(int fd, const char *fmt, ...)
+{
+     ce0:	55                   	push   %ebp
+     ce1:	89 e5                	mov    %esp,%ebp
+     ce3:	53                   	push   %ebx
+     ce4:	81 ec 14 02 00 00    	sub    $0x214,%esp
+     cea:	8b 45 08             	mov    0x8(%ebp),%eax
+    local.mode = _IONBF;
+    local.n = 0;
+    local.str = 0;
+    b = &local;
+  }
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     ced:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd == stdout.fd){
+     cf0:	39 05 00 20 00 00    	cmp    %eax,0x2000
+     cf6:	74 48                	je     d40 <printf+0x60>
+    local.fd = fd;
+     cf8:	89 85 e8 fd ff ff    	mov    %eax,-0x218(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     cfe:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     d01:	89 da                	mov    %ebx,%edx
+     d03:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+    local.mode = _IONBF;
+     d09:	c7 85 ec fd ff ff 03 	movl   $0x3,-0x214(%ebp)
+     d10:	00 00 00 
+    local.n = 0;
+     d13:	c7 85 f0 fd ff ff 00 	movl   $0x0,-0x210(%ebp)
+     d1a:	00 00 00 
+    local.str = 0;
+     d1d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     d24:	e8 67 fd ff ff       	call   a90 <format>
+  if(b->mode == _IONBF)
+     d29:	83 bd ec fd ff ff 03 	cmpl   $0x3,-0x214(%ebp)
+     d30:	0f 84 a2 00 00 00    	je     dd8 <printf+0xf8>
+    flush(b);
+  if(b == &stdout)
+    umtxunlock(&stdoutlock);
+}
+     d36:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     d39:	c9                   	leave
+     d3a:	c3                   	ret
+     d3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d3f:	90                   	nop
+    umtxlock(&stdoutlock);
+     d40:	83 ec 0c             	sub    $0xc,%esp
+     d43:	68 24 22 01 00       	push   $0x12224
+     d48:	e8 93 f9 ff ff       	call   6e0 <umtxlock>
+  if(stdout.mode == 0){
+     d4d:	a1 04 20 00 00       	mov    0x2004,%eax
+     d52:	83 c4 10             	add    $0x10,%esp
+     d55:	85 c0                	test   %eax,%eax
+     d57:	74 37                	je     d90 <printf+0xb0>
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     d59:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     d5c:	89 da                	mov    %ebx,%edx
+     d5e:	b8 00 20 00 00       	mov    $0x2000,%eax
+     d63:	e8 28 fd ff ff       	call   a90 <format>
+  if(b->mode == _IONBF)
+     d68:	83 3d 04 20 00 00 03 	cmpl   $0x3,0x2004
+     d6f:	0f 84 ab 00 00 00    	je     e20 <printf+0x140>
+    umtxunlock(&stdoutlock);
+     d75:	83 ec 0c             	sub    $0xc,%esp
+     d78:	68 24 22 01 00       	push   $0x12224
+     d7d:	e8 ae f9 ff ff       	call   730 <umtxunlock>
+}
+     d82:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    umtxunlock(&stdoutlock);
+     d85:	83 c4 10             	add    $0x10,%esp
+}
+     d88:	c9                   	leave
+     d89:	c3                   	ret
+     d8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+     d90:	83 ec 08             	sub    $0x8,%esp
+     d93:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+     d99:	50                   	push   %eax
+     d9a:	ff 35 00 20 00 00    	push   0x2000
+     da0:	e8 13 fa ff ff       	call   7b8 <fstat>
+     da5:	83 c4 10             	add    $0x10,%esp
+     da8:	89 c2                	mov    %eax,%edx
+      stdout.mode = _IOFBF;
+     daa:	b8 01 00 00 00       	mov    $0x1,%eax
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+     daf:	85 d2                	test   %edx,%edx
+     db1:	75 10                	jne    dc3 <printf+0xe3>
+      stdout.mode = _IOLBF;
+     db3:	31 c0                	xor    %eax,%eax
+     db5:	66 83 bd e8 fd ff ff 	cmpw   $0x3,-0x218(%ebp)
+     dbc:	03 
+     dbd:	0f 94 c0             	sete   %al
+     dc0:	83 c0 01             	add    $0x1,%eax
+     dc3:	a3 04 20 00 00       	mov    %eax,0x2004
+    flushhook = flushall;
+     dc8:	c7 05 20 22 01 00 d0 	movl   $0x8d0,0x12220
+     dcf:	08 00 00 
+     dd2:	eb 85                	jmp    d59 <printf+0x79>
+     dd4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(b->n > 0)
+     dd8:	8b 85 f0 fd ff ff    	mov    -0x210(%ebp),%eax
+     dde:	85 c0                	test   %eax,%eax
+     de0:	0f 8e 50 ff ff ff    	jle    d36 <printf+0x56>
+    b = &local;
+     de6:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+    _write(b->fd, b->buf, b->n);
+     dec:	83 ec 04             	sub    $0x4,%esp
+     def:	50                   	push   %eax
+     df0:	8d 43 0c             	lea    0xc(%ebx),%eax
+     df3:	50                   	push   %eax
+     df4:	ff 33                	push   (%ebx)
+     df6:	e8 85 f9 ff ff       	call   780 <_write>
+  b->n = 0;
+     dfb:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  if(b == &stdout)
+     e02:	83 c4 10             	add    $0x10,%esp
+     e05:	81 fb 00 20 00 00    	cmp    $0x2000,%ebx
+     e0b:	0f 85 25 ff ff ff    	jne    d36 <printf+0x56>
+     e11:	e9 5f ff ff ff       	jmp    d75 <printf+0x95>
+     e16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e1d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(b->n > 0)
+     e20:	a1 08 20 00 00       	mov    0x2008,%eax
+    b = getstdout();
+     e25:	bb 00 20 00 00       	mov    $0x2000,%ebx
+  if(b->n > 0)
+     e2a:	85 c0                	test   %eax,%eax
+     e2c:	7f be                	jg     dec <printf+0x10c>
+  b->n = 0;
+     e2e:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     e35:	00 00 00 
+  if(b == &stdout)
+     e38:	e9 38 ff ff ff       	jmp    d75 <printf+0x95>
+     e3d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000e40 <sprintf>:
+
+// Print to the given buffer. Only understands %d, %x, %p, %s, %c.
+int
+sprintf(char *str, const char *fmt, ...)
+{
+     e40:	55                   	push   %ebp
+     e41:	89 e5                	mov    %esp,%ebp
+     e43:	53                   	push   %ebx
+  struct outbuf b;
+
+  b.str = str;
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+     e44:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+     e4a:	8d 4d 10             	lea    0x10(%ebp),%ecx
+{
+     e4d:	81 ec 14 02 00 00    	sub    $0x214,%esp
+     e53:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+     e56:	8b 55 0c             	mov    0xc(%ebp),%edx
+  b.str = str;
+     e59:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+     e5c:	e8 2f fc ff ff       	call   a90 <format>
+  *b.str = '\0';
+     e61:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e64:	c6 00 00             	movb   $0x0,(%eax)
+  return b.str - str;
+     e67:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e6a:	29 d8                	sub    %ebx,%eax
+}
+     e6c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     e6f:	c9                   	leave
+     e70:	c3                   	ret
+     e71:	66 90                	xchg   %ax,%ax
+     e73:	66 90                	xchg   %ax,%ax
+     e75:	66 90                	xchg   %ax,%ax
+     e77:	66 90                	xchg   %ax,%ax
+     e79:	66 90                	xchg   %ax,%ax
+     e7b:	66 90                	xchg   %ax,%ax
+     e7d:	66 90                	xchg   %ax,%ax
+     e7f:	90                   	nop
+
+00000e80 <freeblock>:
+static Header *freep;
+static struct umutex lock;  // threads made by clone() share the heap
+
+static void
+freeblock(void *ap)
+{
+     e80:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+     e81:	8d 48 f8             	lea    -0x8(%eax),%ecx
+{
+     e84:	89 e5                	mov    %esp,%ebp
+     e86:	57                   	push   %edi
+     e87:	56                   	push   %esi
+     e88:	53                   	push   %ebx
+     e89:	89 c3                	mov    %eax,%ebx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     e8b:	a1 2c 22 01 00       	mov    0x1222c,%eax
+     e90:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     e92:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     e94:	39 ca                	cmp    %ecx,%edx
+     e96:	73 30                	jae    ec8 <freeblock+0x48>
+     e98:	39 c1                	cmp    %eax,%ecx
+     e9a:	72 04                	jb     ea0 <freeblock+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     e9c:	39 c2                	cmp    %eax,%edx
+     e9e:	72 f0                	jb     e90 <freeblock+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     ea0:	8b 73 fc             	mov    -0x4(%ebx),%esi
+     ea3:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+     ea6:	39 f8                	cmp    %edi,%eax
+     ea8:	74 26                	je     ed0 <freeblock+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+     eaa:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+     ead:	8b 42 04             	mov    0x4(%edx),%eax
+     eb0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     eb3:	39 f1                	cmp    %esi,%ecx
+     eb5:	74 30                	je     ee7 <freeblock+0x67>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+     eb7:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+     eb9:	5b                   	pop    %ebx
+  freep = p;
+     eba:	89 15 2c 22 01 00    	mov    %edx,0x1222c
+}
+     ec0:	5e                   	pop    %esi
+     ec1:	5f                   	pop    %edi
+     ec2:	5d                   	pop    %ebp
+     ec3:	c3                   	ret
+     ec4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     ec8:	39 c1                	cmp    %eax,%ecx
+     eca:	72 d0                	jb     e9c <freeblock+0x1c>
+     ecc:	eb c2                	jmp    e90 <freeblock+0x10>
+     ece:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+     ed0:	03 70 04             	add    0x4(%eax),%esi
+     ed3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     ed6:	8b 02                	mov    (%edx),%eax
+     ed8:	8b 00                	mov    (%eax),%eax
+     eda:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+     edd:	8b 42 04             	mov    0x4(%edx),%eax
+     ee0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     ee3:	39 f1                	cmp    %esi,%ecx
+     ee5:	75 d0                	jne    eb7 <freeblock+0x37>
+    p->s.size += bp->s.size;
+     ee7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+     eea:	89 15 2c 22 01 00    	mov    %edx,0x1222c
+    p->s.size += bp->s.size;
+     ef0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+     ef3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+     ef6:	89 0a                	mov    %ecx,(%edx)
+}
+     ef8:	5b                   	pop    %ebx
+     ef9:	5e                   	pop    %esi
+     efa:	5f                   	pop    %edi
+     efb:	5d                   	pop    %ebp
+     efc:	c3                   	ret
+     efd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000f00 <free>:
+
+void
+free(void *ap)
+{
+     f00:	55                   	push   %ebp
+     f01:	89 e5                	mov    %esp,%ebp
+     f03:	53                   	push   %ebx
+     f04:	83 ec 10             	sub    $0x10,%esp
+     f07:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  umtxlock(&lock);
+     f0a:	68 28 22 01 00       	push   $0x12228
+     f0f:	e8 cc f7 ff ff       	call   6e0 <umtxlock>
+  freeblock(ap);
+     f14:	89 d8                	mov    %ebx,%eax
+     f16:	e8 65 ff ff ff       	call   e80 <freeblock>
+  umtxunlock(&lock);
+     f1b:	c7 45 08 28 22 01 00 	movl   $0x12228,0x8(%ebp)
+}
+     f22:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&lock);
+     f25:	83 c4 10             	add    $0x10,%esp
+}
+     f28:	c9                   	leave
+  umtxunlock(&lock);
+     f29:	e9 02 f8 ff ff       	jmp    730 <umtxunlock>
+     f2e:	66 90                	xchg   %ax,%ax
+
+00000f30 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+     f30:	55                   	push   %ebp
+     f31:	89 e5                	mov    %esp,%ebp
+     f33:	57                   	push   %edi
+     f34:	56                   	push   %esi
+     f35:	53                   	push   %ebx
+     f36:	83 ec 28             	sub    $0x28,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     f39:	8b 45 08             	mov    0x8(%ebp),%eax
+  umtxlock(&lock);
+     f3c:	68 28 22 01 00       	push   $0x12228
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     f41:	8d 48 07             	lea    0x7(%eax),%ecx
+     f44:	c1 e9 03             	shr    $0x3,%ecx
+     f47:	8d 71 01             	lea    0x1(%ecx),%esi
+  umtxlock(&lock);
+     f4a:	e8 91 f7 ff ff       	call   6e0 <umtxlock>
+  if((prevp = freep) == 0){
+     f4f:	8b 15 2c 22 01 00    	mov    0x1222c,%edx
+     f55:	83 c4 10             	add    $0x10,%esp
+     f58:	85 d2                	test   %edx,%edx
+     f5a:	0f 84 b0 00 00 00    	je     1010 <malloc+0xe0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     f60:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+     f62:	8b 47 04             	mov    0x4(%edi),%eax
+     f65:	39 f0                	cmp    %esi,%eax
+     f67:	73 6f                	jae    fd8 <malloc+0xa8>
+  if(nu < 4096)
+     f69:	bb 00 10 00 00       	mov    $0x1000,%ebx
+     f6e:	39 de                	cmp    %ebx,%esi
+     f70:	0f 43 de             	cmovae %esi,%ebx
+  p = sbrk(nu * sizeof(Header));
+     f73:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+     f7a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     f7d:	eb 0a                	jmp    f89 <malloc+0x59>
+     f7f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     f80:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+     f82:	8b 47 04             	mov    0x4(%edi),%eax
+     f85:	39 f0                	cmp    %esi,%eax
+     f87:	73 4f                	jae    fd8 <malloc+0xa8>
+      }
+      freep = prevp;
+      umtxunlock(&lock);
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+     f89:	89 fa                	mov    %edi,%edx
+     f8b:	39 3d 2c 22 01 00    	cmp    %edi,0x1222c
+     f91:	75 ed                	jne    f80 <malloc+0x50>
+  p = sbrk(nu * sizeof(Header));
+     f93:	83 ec 0c             	sub    $0xc,%esp
+     f96:	ff 75 e4             	push   -0x1c(%ebp)
+     f99:	e8 4a f8 ff ff       	call   7e8 <sbrk>
+  if(p == (char*)-1)
+     f9e:	83 c4 10             	add    $0x10,%esp
+     fa1:	83 f8 ff             	cmp    $0xffffffff,%eax
+     fa4:	74 15                	je     fbb <malloc+0x8b>
+  hp->s.size = nu;
+     fa6:	89 58 04             	mov    %ebx,0x4(%eax)
+  freeblock((void*)(hp + 1));
+     fa9:	83 c0 08             	add    $0x8,%eax
+     fac:	e8 cf fe ff ff       	call   e80 <freeblock>
+  return freep;
+     fb1:	8b 15 2c 22 01 00    	mov    0x1222c,%edx
+      if((p = morecore(nunits)) == 0){
+     fb7:	85 d2                	test   %edx,%edx
+     fb9:	75 c5                	jne    f80 <malloc+0x50>
+        umtxunlock(&lock);
+     fbb:	83 ec 0c             	sub    $0xc,%esp
+     fbe:	68 28 22 01 00       	push   $0x12228
+     fc3:	e8 68 f7 ff ff       	call   730 <umtxunlock>
+        return 0;
+     fc8:	83 c4 10             	add    $0x10,%esp
+      }
+  }
+}
+     fcb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+     fce:	31 c0                	xor    %eax,%eax
+}
+     fd0:	5b                   	pop    %ebx
+     fd1:	5e                   	pop    %esi
+     fd2:	5f                   	pop    %edi
+     fd3:	5d                   	pop    %ebp
+     fd4:	c3                   	ret
+     fd5:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+     fd8:	39 c6                	cmp    %eax,%esi
+     fda:	74 64                	je     1040 <malloc+0x110>
+        p->s.size -= nunits;
+     fdc:	29 f0                	sub    %esi,%eax
+     fde:	89 47 04             	mov    %eax,0x4(%edi)
+        p += p->s.size;
+     fe1:	8d 3c c7             	lea    (%edi,%eax,8),%edi
+        p->s.size = nunits;
+     fe4:	89 77 04             	mov    %esi,0x4(%edi)
+      umtxunlock(&lock);
+     fe7:	83 ec 0c             	sub    $0xc,%esp
+      freep = prevp;
+     fea:	89 15 2c 22 01 00    	mov    %edx,0x1222c
+      umtxunlock(&lock);
+     ff0:	68 28 22 01 00       	push   $0x12228
+     ff5:	e8 36 f7 ff ff       	call   730 <umtxunlock>
+      return (void*)(p + 1);
+     ffa:	83 c4 10             	add    $0x10,%esp
+}
+     ffd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    1000:	8d 47 08             	lea    0x8(%edi),%eax
+}
+    1003:	5b                   	pop    %ebx
+    1004:	5e                   	pop    %esi
+    1005:	5f                   	pop    %edi
+    1006:	5d                   	pop    %ebp
+    1007:	c3                   	ret
+    1008:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    100f:	90                   	nop
+    base.s.ptr = freep = prevp = &base;
+    1010:	c7 05 2c 22 01 00 30 	movl   $0x12230,0x1222c
+    1017:	22 01 00 
+    base.s.size = 0;
+    101a:	bf 30 22 01 00       	mov    $0x12230,%edi
+    base.s.ptr = freep = prevp = &base;
+    101f:	c7 05 30 22 01 00 30 	movl   $0x12230,0x12230
+    1026:	22 01 00 
+    base.s.size = 0;
+    1029:	c7 05 34 22 01 00 00 	movl   $0x0,0x12234
+    1030:	00 00 00 
+    if(p->s.size >= nunits){
+    1033:	e9 31 ff ff ff       	jmp    f69 <malloc+0x39>
+    1038:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    103f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1040:	8b 07                	mov    (%edi),%eax
+    1042:	89 02                	mov    %eax,(%edx)
+    1044:	eb a1                	jmp    fe7 <malloc+0xb7>
+    1046:	66 90                	xchg   %ax,%ax
+    1048:	66 90                	xchg   %ax,%ax
+    104a:	66 90                	xchg   %ax,%ax
+    104c:	66 90                	xchg   %ax,%ax
+    104e:	66 90                	xchg   %ax,%ax
+
+00001050 <threadstart>:
+
+#define TSTACKSZ 4096
+
+static void
+threadstart(void *fn, void *arg)
+{
+    1050:	55                   	push   %ebp
+    1051:	89 e5                	mov    %esp,%ebp
+    1053:	83 ec 14             	sub    $0x14,%esp
+  ((void (*)(void*))fn)(arg);
+    1056:	ff 75 0c             	push   0xc(%ebp)
+    1059:	ff 55 08             	call   *0x8(%ebp)
+  exit();
+    105c:	e8 ef f4 ff ff       	call   550 <exit>
+    1061:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1068:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    106f:	90                   	nop
+
+00001070 <thread_create>:
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    1070:	55                   	push   %ebp
+    1071:	89 e5                	mov    %esp,%ebp
+    1073:	53                   	push   %ebx
+    1074:	83 ec 20             	sub    $0x20,%esp
+  char *mem, *stack;
+  int pid;
+
+  if((mem = malloc(2*TSTACKSZ)) == 0)
+    1077:	68 00 20 00 00       	push   $0x2000
+    107c:	e8 af fe ff ff       	call   f30 <malloc>
+    1081:	83 c4 10             	add    $0x10,%esp
+    1084:	85 c0                	test   %eax,%eax
+    1086:	74 47                	je     10cf <thread_create+0x5f>
+    1088:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)(((uint)mem + TSTACKSZ - 1) & ~(TSTACKSZ - 1));
+    108a:	8d 80 ff 0f 00 00    	lea    0xfff(%eax),%eax
+    1090:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  *(char**)stack = mem;
+    1095:	89 18                	mov    %ebx,(%eax)
+  if((pid = clone(threadstart, (void*)fn, arg, stack)) < 0)
+    1097:	50                   	push   %eax
+    1098:	ff 75 0c             	push   0xc(%ebp)
+    109b:	ff 75 08             	push   0x8(%ebp)
+    109e:	68 50 10 00 00       	push   $0x1050
+    10a3:	e8 08 f8 ff ff       	call   8b0 <clone>
+    10a8:	83 c4 10             	add    $0x10,%esp
+    10ab:	85 c0                	test   %eax,%eax
+    10ad:	78 09                	js     10b8 <thread_create+0x48>
+    free(mem);
+  return pid;
+}
+    10af:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    10b2:	c9                   	leave
+    10b3:	c3                   	ret
+    10b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    free(mem);
+    10b8:	83 ec 0c             	sub    $0xc,%esp
+    10bb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    10be:	53                   	push   %ebx
+    10bf:	e8 3c fe ff ff       	call   f00 <free>
+    10c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    10c7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+    10ca:	83 c4 10             	add    $0x10,%esp
+}
+    10cd:	c9                   	leave
+    10ce:	c3                   	ret
+    return -1;
+    10cf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    10d4:	eb d9                	jmp    10af <thread_create+0x3f>
+    10d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000010e0 <thread_join>:
+
+int
+thread_join(void)
+{
+    10e0:	55                   	push   %ebp
+    10e1:	89 e5                	mov    %esp,%ebp
+    10e3:	83 ec 34             	sub    $0x34,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    10e6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    10e9:	50                   	push   %eax
+    10ea:	e8 c9 f7 ff ff       	call   8b8 <join>
+    10ef:	83 c4 10             	add    $0x10,%esp
+    10f2:	85 c0                	test   %eax,%eax
+    10f4:	79 0a                	jns    1100 <thread_join+0x20>
+    free(*(char**)stack);
+  return pid;
+}
+    10f6:	c9                   	leave
+    10f7:	c3                   	ret
+    10f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10ff:	90                   	nop
+    free(*(char**)stack);
+    1100:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1103:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1106:	83 ec 0c             	sub    $0xc,%esp
+    1109:	ff 32                	push   (%edx)
+    110b:	e8 f0 fd ff ff       	call   f00 <free>
+    1110:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1113:	83 c4 10             	add    $0x10,%esp
+}
+    1116:	c9                   	leave
+    1117:	c3                   	ret
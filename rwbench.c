@@ -0,0 +1,99 @@
+// System call bandwidth for large transfers: write a FILESZ
+// file in BUFSZ writes several times over, then read it back
+// over and over from the page cache. read() and write() copy
+// straight between the file and the buffer with rep movsl,
+// with no walk of the buffer's pages beforehand.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+
+#define BUFSZ   (64*1024)
+#define FILESZ  (128*1024)
+#define NWRITE  4
+#define NREAD   64
+
+char buf[BUFSZ];
+
+static inline uint
+cycles(void)
+{
+  uint lo, hi;
+
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+  return lo;
+}
+
+void
+report(char *name, int nbuf, int t, uint c)
+{
+  uint kb;
+
+  kb = nbuf * (BUFSZ / 1024);
+  if(t == 0)
+    t = 1;
+  printf(1, "rwbench: %s: %d KB in %d ticks, %d KB/tick, %d cycles/KB\n",
+         name, kb, t, kb / t, c / kb);
+}
+
+int
+main(int argc, char *argv[])
+{
+  int fd, i, j, t;
+  uint c;
+
+  for(i = 0; i < BUFSZ; i++)
+    buf[i] = i;
+
+  if((fd = open("rwbench.tmp", O_CREATE|O_RDWR)) < 0){
+    printf(2, "rwbench: create failed\n");
+    exit();
+  }
+  t = uptime();
+  c = cycles();
+  for(i = 0; i < NWRITE; i++){
+    close(fd);
+    if((fd = open("rwbench.tmp", O_RDWR)) < 0){
+      printf(2, "rwbench: open failed\n");
+      exit();
+    }
+    for(j = 0; j < FILESZ / BUFSZ; j++){
+      if(write(fd, buf, BUFSZ) != BUFSZ){
+        printf(2, "rwbench: write failed\n");
+        exit();
+      }
+    }
+  }
+  c = cycles() - c;
+  t = uptime() - t;
+  close(fd);
+  report("write", NWRITE * FILESZ / BUFSZ, t, c);
+
+  if((fd = open("rwbench.tmp", O_RDONLY)) < 0){
+    printf(2, "rwbench: open failed\n");
+    exit();
+  }
+  t = uptime();
+  c = cycles();
+  for(i = 0; i < NREAD; i++){
+    close(fd);
+    if((fd = open("rwbench.tmp", O_RDONLY)) < 0){
+      printf(2, "rwbench: open failed\n");
+      exit();
+    }
+    for(j = 0; j < FILESZ / BUFSZ; j++){
+      if(read(fd, buf, BUFSZ) != BUFSZ){
+        printf(2, "rwbench: read failed\n");
+        exit();
+      }
+    }
+  }
+  c = cycles() - c;
+  t = uptime() - t;
+  close(fd);
+  report("read", NREAD * FILESZ / BUFSZ, t, c);
+
+  unlink("rwbench.tmp");
+  exit();
+}
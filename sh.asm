@@ -0,0 +1,3714 @@
+
+_sh:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <getcmd>:
+  exit();
+}
+
+int
+getcmd(char *buf, int nbuf)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	56                   	push   %esi
+       4:	53                   	push   %ebx
+       5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+       8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  printf(2, "$ ");
+       b:	83 ec 08             	sub    $0x8,%esp
+       e:	68 68 1a 00 00       	push   $0x1a68
+      13:	6a 02                	push   $0x2
+      15:	e8 16 16 00 00       	call   1630 <printf>
+  memset(buf, 0, nbuf);
+      1a:	83 c4 0c             	add    $0xc,%esp
+      1d:	56                   	push   %esi
+      1e:	6a 00                	push   $0x0
+      20:	53                   	push   %ebx
+      21:	e8 6a 0c 00 00       	call   c90 <memset>
+  gets(buf, nbuf);
+      26:	58                   	pop    %eax
+      27:	5a                   	pop    %edx
+      28:	56                   	push   %esi
+      29:	53                   	push   %ebx
+      2a:	e8 11 0d 00 00       	call   d40 <gets>
+  if(buf[0] == 0) // EOF
+      2f:	83 c4 10             	add    $0x10,%esp
+      32:	80 3b 01             	cmpb   $0x1,(%ebx)
+      35:	19 c0                	sbb    %eax,%eax
+    return -1;
+  return 0;
+}
+      37:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      3a:	5b                   	pop    %ebx
+      3b:	5e                   	pop    %esi
+      3c:	5d                   	pop    %ebp
+      3d:	c3                   	ret
+      3e:	66 90                	xchg   %ax,%ax
+
+00000040 <panic>:
+  exit();
+}
+
+void
+panic(char *s)
+{
+      40:	55                   	push   %ebp
+      41:	89 e5                	mov    %esp,%ebp
+      43:	83 ec 0c             	sub    $0xc,%esp
+  printf(2, "%s\n", s);
+      46:	ff 75 08             	push   0x8(%ebp)
+      49:	68 05 1b 00 00       	push   $0x1b05
+      4e:	6a 02                	push   $0x2
+      50:	e8 db 15 00 00       	call   1630 <printf>
+  exit();
+      55:	e8 46 0e 00 00       	call   ea0 <exit>
+      5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000060 <fork1>:
+}
+
+int
+fork1(void)
+{
+      60:	55                   	push   %ebp
+      61:	89 e5                	mov    %esp,%ebp
+      63:	83 ec 08             	sub    $0x8,%esp
+  int pid;
+
+  pid = fork();
+      66:	e8 05 0e 00 00       	call   e70 <fork>
+  if(pid == -1)
+      6b:	83 f8 ff             	cmp    $0xffffffff,%eax
+      6e:	74 02                	je     72 <fork1+0x12>
+    panic("fork");
+  return pid;
+}
+      70:	c9                   	leave
+      71:	c3                   	ret
+    panic("fork");
+      72:	83 ec 0c             	sub    $0xc,%esp
+      75:	68 6b 1a 00 00       	push   $0x1a6b
+      7a:	e8 c1 ff ff ff       	call   40 <panic>
+      7f:	90                   	nop
+
+00000080 <runcmd>:
+{
+      80:	55                   	push   %ebp
+      81:	89 e5                	mov    %esp,%ebp
+      83:	53                   	push   %ebx
+      84:	83 ec 14             	sub    $0x14,%esp
+      87:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(cmd == 0)
+      8a:	85 db                	test   %ebx,%ebx
+      8c:	74 42                	je     d0 <runcmd+0x50>
+  switch(cmd->type){
+      8e:	83 3b 05             	cmpl   $0x5,(%ebx)
+      91:	0f 87 e3 00 00 00    	ja     17a <runcmd+0xfa>
+      97:	8b 03                	mov    (%ebx),%eax
+      99:	ff 24 85 20 1b 00 00 	jmp    *0x1b20(,%eax,4)
+    if(ecmd->argv[0] == 0)
+      a0:	8b 43 04             	mov    0x4(%ebx),%eax
+      a3:	85 c0                	test   %eax,%eax
+      a5:	74 29                	je     d0 <runcmd+0x50>
+    exec(ecmd->argv[0], ecmd->argv);
+      a7:	8d 53 04             	lea    0x4(%ebx),%edx
+      aa:	51                   	push   %ecx
+      ab:	51                   	push   %ecx
+      ac:	52                   	push   %edx
+      ad:	50                   	push   %eax
+      ae:	e8 0d 0e 00 00       	call   ec0 <exec>
+    printf(2, "exec %s failed\n", ecmd->argv[0]);
+      b3:	83 c4 0c             	add    $0xc,%esp
+      b6:	ff 73 04             	push   0x4(%ebx)
+      b9:	68 77 1a 00 00       	push   $0x1a77
+      be:	6a 02                	push   $0x2
+      c0:	e8 6b 15 00 00       	call   1630 <printf>
+    break;
+      c5:	83 c4 10             	add    $0x10,%esp
+      c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      cf:	90                   	nop
+    exit();
+      d0:	e8 cb 0d 00 00       	call   ea0 <exit>
+    if(fork1() == 0)
+      d5:	e8 86 ff ff ff       	call   60 <fork1>
+      da:	85 c0                	test   %eax,%eax
+      dc:	75 f2                	jne    d0 <runcmd+0x50>
+      de:	e9 8c 00 00 00       	jmp    16f <runcmd+0xef>
+    if(pipe(p) < 0)
+      e3:	83 ec 0c             	sub    $0xc,%esp
+      e6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+      e9:	50                   	push   %eax
+      ea:	e8 d1 0f 00 00       	call   10c0 <pipe>
+      ef:	83 c4 10             	add    $0x10,%esp
+      f2:	85 c0                	test   %eax,%eax
+      f4:	0f 88 a2 00 00 00    	js     19c <runcmd+0x11c>
+    if(fork1() == 0){
+      fa:	e8 61 ff ff ff       	call   60 <fork1>
+      ff:	85 c0                	test   %eax,%eax
+     101:	0f 84 a2 00 00 00    	je     1a9 <runcmd+0x129>
+    if(fork1() == 0){
+     107:	e8 54 ff ff ff       	call   60 <fork1>
+     10c:	85 c0                	test   %eax,%eax
+     10e:	0f 84 c3 00 00 00    	je     1d7 <runcmd+0x157>
+    close(p[0]);
+     114:	83 ec 0c             	sub    $0xc,%esp
+     117:	ff 75 f0             	push   -0x10(%ebp)
+     11a:	e8 d1 0e 00 00       	call   ff0 <close>
+    close(p[1]);
+     11f:	58                   	pop    %eax
+     120:	ff 75 f4             	push   -0xc(%ebp)
+     123:	e8 c8 0e 00 00       	call   ff0 <close>
+    wait();
+     128:	e8 8b 0f 00 00       	call   10b8 <wait>
+    wait();
+     12d:	e8 86 0f 00 00       	call   10b8 <wait>
+    break;
+     132:	83 c4 10             	add    $0x10,%esp
+     135:	eb 99                	jmp    d0 <runcmd+0x50>
+    if(fork1() == 0)
+     137:	e8 24 ff ff ff       	call   60 <fork1>
+     13c:	85 c0                	test   %eax,%eax
+     13e:	74 2f                	je     16f <runcmd+0xef>
+    wait();
+     140:	e8 73 0f 00 00       	call   10b8 <wait>
+    runcmd(lcmd->right);
+     145:	83 ec 0c             	sub    $0xc,%esp
+     148:	ff 73 08             	push   0x8(%ebx)
+     14b:	e8 30 ff ff ff       	call   80 <runcmd>
+    close(rcmd->fd);
+     150:	83 ec 0c             	sub    $0xc,%esp
+     153:	ff 73 14             	push   0x14(%ebx)
+     156:	e8 95 0e 00 00       	call   ff0 <close>
+    if(open(rcmd->file, rcmd->mode) < 0){
+     15b:	58                   	pop    %eax
+     15c:	5a                   	pop    %edx
+     15d:	ff 73 10             	push   0x10(%ebx)
+     160:	ff 73 08             	push   0x8(%ebx)
+     163:	e8 88 0f 00 00       	call   10f0 <open>
+     168:	83 c4 10             	add    $0x10,%esp
+     16b:	85 c0                	test   %eax,%eax
+     16d:	78 18                	js     187 <runcmd+0x107>
+      runcmd(bcmd->cmd);
+     16f:	83 ec 0c             	sub    $0xc,%esp
+     172:	ff 73 04             	push   0x4(%ebx)
+     175:	e8 06 ff ff ff       	call   80 <runcmd>
+    panic("runcmd");
+     17a:	83 ec 0c             	sub    $0xc,%esp
+     17d:	68 70 1a 00 00       	push   $0x1a70
+     182:	e8 b9 fe ff ff       	call   40 <panic>
+      printf(2, "open %s failed\n", rcmd->file);
+     187:	51                   	push   %ecx
+     188:	ff 73 08             	push   0x8(%ebx)
+     18b:	68 87 1a 00 00       	push   $0x1a87
+     190:	6a 02                	push   $0x2
+     192:	e8 99 14 00 00       	call   1630 <printf>
+      exit();
+     197:	e8 04 0d 00 00       	call   ea0 <exit>
+      panic("pipe");
+     19c:	83 ec 0c             	sub    $0xc,%esp
+     19f:	68 97 1a 00 00       	push   $0x1a97
+     1a4:	e8 97 fe ff ff       	call   40 <panic>
+      close(1);
+     1a9:	83 ec 0c             	sub    $0xc,%esp
+     1ac:	6a 01                	push   $0x1
+     1ae:	e8 3d 0e 00 00       	call   ff0 <close>
+      dup(p[1]);
+     1b3:	58                   	pop    %eax
+     1b4:	ff 75 f4             	push   -0xc(%ebp)
+     1b7:	e8 6c 0f 00 00       	call   1128 <dup>
+      close(p[0]);
+     1bc:	58                   	pop    %eax
+     1bd:	ff 75 f0             	push   -0x10(%ebp)
+     1c0:	e8 2b 0e 00 00       	call   ff0 <close>
+      close(p[1]);
+     1c5:	58                   	pop    %eax
+     1c6:	ff 75 f4             	push   -0xc(%ebp)
+     1c9:	e8 22 0e 00 00       	call   ff0 <close>
+      runcmd(pcmd->left);
+     1ce:	5a                   	pop    %edx
+     1cf:	ff 73 04             	push   0x4(%ebx)
+     1d2:	e8 a9 fe ff ff       	call   80 <runcmd>
+      close(0);
+     1d7:	83 ec 0c             	sub    $0xc,%esp
+     1da:	6a 00                	push   $0x0
+     1dc:	e8 0f 0e 00 00       	call   ff0 <close>
+      dup(p[0]);
+     1e1:	5a                   	pop    %edx
+     1e2:	ff 75 f0             	push   -0x10(%ebp)
+     1e5:	e8 3e 0f 00 00       	call   1128 <dup>
+      close(p[0]);
+     1ea:	59                   	pop    %ecx
+     1eb:	ff 75 f0             	push   -0x10(%ebp)
+     1ee:	e8 fd 0d 00 00       	call   ff0 <close>
+      close(p[1]);
+     1f3:	58                   	pop    %eax
+     1f4:	ff 75 f4             	push   -0xc(%ebp)
+     1f7:	e8 f4 0d 00 00       	call   ff0 <close>
+      runcmd(pcmd->right);
+     1fc:	58                   	pop    %eax
+     1fd:	ff 73 08             	push   0x8(%ebx)
+     200:	e8 7b fe ff ff       	call   80 <runcmd>
+     205:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     20c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000210 <execcmd>:
+//PAGEBREAK!
+// Constructors
+
+struct cmd*
+execcmd(void)
+{
+     210:	55                   	push   %ebp
+     211:	89 e5                	mov    %esp,%ebp
+     213:	53                   	push   %ebx
+     214:	83 ec 10             	sub    $0x10,%esp
+  struct execcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     217:	6a 54                	push   $0x54
+     219:	e8 62 16 00 00       	call   1880 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     21e:	83 c4 0c             	add    $0xc,%esp
+     221:	6a 54                	push   $0x54
+  cmd = malloc(sizeof(*cmd));
+     223:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     225:	6a 00                	push   $0x0
+     227:	50                   	push   %eax
+     228:	e8 63 0a 00 00       	call   c90 <memset>
+  cmd->type = EXEC;
+     22d:	c7 03 01 00 00 00    	movl   $0x1,(%ebx)
+  return (struct cmd*)cmd;
+}
+     233:	89 d8                	mov    %ebx,%eax
+     235:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     238:	c9                   	leave
+     239:	c3                   	ret
+     23a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000240 <redircmd>:
+
+struct cmd*
+redircmd(struct cmd *subcmd, char *file, char *efile, int mode, int fd)
+{
+     240:	55                   	push   %ebp
+     241:	89 e5                	mov    %esp,%ebp
+     243:	53                   	push   %ebx
+     244:	83 ec 10             	sub    $0x10,%esp
+  struct redircmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     247:	6a 18                	push   $0x18
+     249:	e8 32 16 00 00       	call   1880 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     24e:	83 c4 0c             	add    $0xc,%esp
+     251:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     253:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     255:	6a 00                	push   $0x0
+     257:	50                   	push   %eax
+     258:	e8 33 0a 00 00       	call   c90 <memset>
+  cmd->type = REDIR;
+  cmd->cmd = subcmd;
+     25d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = REDIR;
+     260:	c7 03 02 00 00 00    	movl   $0x2,(%ebx)
+  cmd->cmd = subcmd;
+     266:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->file = file;
+     269:	8b 45 0c             	mov    0xc(%ebp),%eax
+     26c:	89 43 08             	mov    %eax,0x8(%ebx)
+  cmd->efile = efile;
+     26f:	8b 45 10             	mov    0x10(%ebp),%eax
+     272:	89 43 0c             	mov    %eax,0xc(%ebx)
+  cmd->mode = mode;
+     275:	8b 45 14             	mov    0x14(%ebp),%eax
+     278:	89 43 10             	mov    %eax,0x10(%ebx)
+  cmd->fd = fd;
+     27b:	8b 45 18             	mov    0x18(%ebp),%eax
+     27e:	89 43 14             	mov    %eax,0x14(%ebx)
+  return (struct cmd*)cmd;
+}
+     281:	89 d8                	mov    %ebx,%eax
+     283:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     286:	c9                   	leave
+     287:	c3                   	ret
+     288:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     28f:	90                   	nop
+
+00000290 <pipecmd>:
+
+struct cmd*
+pipecmd(struct cmd *left, struct cmd *right)
+{
+     290:	55                   	push   %ebp
+     291:	89 e5                	mov    %esp,%ebp
+     293:	53                   	push   %ebx
+     294:	83 ec 10             	sub    $0x10,%esp
+  struct pipecmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     297:	6a 0c                	push   $0xc
+     299:	e8 e2 15 00 00       	call   1880 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     29e:	83 c4 0c             	add    $0xc,%esp
+     2a1:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     2a3:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     2a5:	6a 00                	push   $0x0
+     2a7:	50                   	push   %eax
+     2a8:	e8 e3 09 00 00       	call   c90 <memset>
+  cmd->type = PIPE;
+  cmd->left = left;
+     2ad:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = PIPE;
+     2b0:	c7 03 03 00 00 00    	movl   $0x3,(%ebx)
+  cmd->left = left;
+     2b6:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     2b9:	8b 45 0c             	mov    0xc(%ebp),%eax
+     2bc:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd*)cmd;
+}
+     2bf:	89 d8                	mov    %ebx,%eax
+     2c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     2c4:	c9                   	leave
+     2c5:	c3                   	ret
+     2c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002d0 <listcmd>:
+
+struct cmd*
+listcmd(struct cmd *left, struct cmd *right)
+{
+     2d0:	55                   	push   %ebp
+     2d1:	89 e5                	mov    %esp,%ebp
+     2d3:	53                   	push   %ebx
+     2d4:	83 ec 10             	sub    $0x10,%esp
+  struct listcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     2d7:	6a 0c                	push   $0xc
+     2d9:	e8 a2 15 00 00       	call   1880 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     2de:	83 c4 0c             	add    $0xc,%esp
+     2e1:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     2e3:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     2e5:	6a 00                	push   $0x0
+     2e7:	50                   	push   %eax
+     2e8:	e8 a3 09 00 00       	call   c90 <memset>
+  cmd->type = LIST;
+  cmd->left = left;
+     2ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = LIST;
+     2f0:	c7 03 04 00 00 00    	movl   $0x4,(%ebx)
+  cmd->left = left;
+     2f6:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     2f9:	8b 45 0c             	mov    0xc(%ebp),%eax
+     2fc:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd*)cmd;
+}
+     2ff:	89 d8                	mov    %ebx,%eax
+     301:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     304:	c9                   	leave
+     305:	c3                   	ret
+     306:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     30d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000310 <backcmd>:
+
+struct cmd*
+backcmd(struct cmd *subcmd)
+{
+     310:	55                   	push   %ebp
+     311:	89 e5                	mov    %esp,%ebp
+     313:	53                   	push   %ebx
+     314:	83 ec 10             	sub    $0x10,%esp
+  struct backcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     317:	6a 08                	push   $0x8
+     319:	e8 62 15 00 00       	call   1880 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     31e:	83 c4 0c             	add    $0xc,%esp
+     321:	6a 08                	push   $0x8
+  cmd = malloc(sizeof(*cmd));
+     323:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     325:	6a 00                	push   $0x0
+     327:	50                   	push   %eax
+     328:	e8 63 09 00 00       	call   c90 <memset>
+  cmd->type = BACK;
+  cmd->cmd = subcmd;
+     32d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = BACK;
+     330:	c7 03 05 00 00 00    	movl   $0x5,(%ebx)
+  cmd->cmd = subcmd;
+     336:	89 43 04             	mov    %eax,0x4(%ebx)
+  return (struct cmd*)cmd;
+}
+     339:	89 d8                	mov    %ebx,%eax
+     33b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     33e:	c9                   	leave
+     33f:	c3                   	ret
+
+00000340 <gettoken>:
+char whitespace[] = " \t\r\n\v";
+char symbols[] = "<|>&;()";
+
+int
+gettoken(char **ps, char *es, char **q, char **eq)
+{
+     340:	55                   	push   %ebp
+     341:	89 e5                	mov    %esp,%ebp
+     343:	57                   	push   %edi
+     344:	56                   	push   %esi
+     345:	53                   	push   %ebx
+     346:	83 ec 0c             	sub    $0xc,%esp
+  char *s;
+  int ret;
+
+  s = *ps;
+     349:	8b 45 08             	mov    0x8(%ebp),%eax
+{
+     34c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     34f:	8b 75 10             	mov    0x10(%ebp),%esi
+  s = *ps;
+     352:	8b 38                	mov    (%eax),%edi
+  while(s < es && strchr(whitespace, *s))
+     354:	39 df                	cmp    %ebx,%edi
+     356:	72 0f                	jb     367 <gettoken+0x27>
+     358:	eb 25                	jmp    37f <gettoken+0x3f>
+     35a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    s++;
+     360:	83 c7 01             	add    $0x1,%edi
+  while(s < es && strchr(whitespace, *s))
+     363:	39 fb                	cmp    %edi,%ebx
+     365:	74 18                	je     37f <gettoken+0x3f>
+     367:	0f be 07             	movsbl (%edi),%eax
+     36a:	83 ec 08             	sub    $0x8,%esp
+     36d:	50                   	push   %eax
+     36e:	68 08 30 00 00       	push   $0x3008
+     373:	e8 88 09 00 00       	call   d00 <strchr>
+     378:	83 c4 10             	add    $0x10,%esp
+     37b:	85 c0                	test   %eax,%eax
+     37d:	75 e1                	jne    360 <gettoken+0x20>
+  if(q)
+     37f:	85 f6                	test   %esi,%esi
+     381:	74 02                	je     385 <gettoken+0x45>
+    *q = s;
+     383:	89 3e                	mov    %edi,(%esi)
+  ret = *s;
+     385:	0f b6 07             	movzbl (%edi),%eax
+  switch(*s){
+     388:	3c 3c                	cmp    $0x3c,%al
+     38a:	0f 8f d0 00 00 00    	jg     460 <gettoken+0x120>
+     390:	3c 3a                	cmp    $0x3a,%al
+     392:	0f 8f bc 00 00 00    	jg     454 <gettoken+0x114>
+     398:	84 c0                	test   %al,%al
+     39a:	75 44                	jne    3e0 <gettoken+0xa0>
+     39c:	31 f6                	xor    %esi,%esi
+    ret = 'a';
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+      s++;
+    break;
+  }
+  if(eq)
+     39e:	8b 4d 14             	mov    0x14(%ebp),%ecx
+     3a1:	85 c9                	test   %ecx,%ecx
+     3a3:	74 05                	je     3aa <gettoken+0x6a>
+    *eq = s;
+     3a5:	8b 45 14             	mov    0x14(%ebp),%eax
+     3a8:	89 38                	mov    %edi,(%eax)
+
+  while(s < es && strchr(whitespace, *s))
+     3aa:	39 df                	cmp    %ebx,%edi
+     3ac:	72 09                	jb     3b7 <gettoken+0x77>
+     3ae:	eb 1f                	jmp    3cf <gettoken+0x8f>
+    s++;
+     3b0:	83 c7 01             	add    $0x1,%edi
+  while(s < es && strchr(whitespace, *s))
+     3b3:	39 fb                	cmp    %edi,%ebx
+     3b5:	74 18                	je     3cf <gettoken+0x8f>
+     3b7:	0f be 07             	movsbl (%edi),%eax
+     3ba:	83 ec 08             	sub    $0x8,%esp
+     3bd:	50                   	push   %eax
+     3be:	68 08 30 00 00       	push   $0x3008
+     3c3:	e8 38 09 00 00       	call   d00 <strchr>
+     3c8:	83 c4 10             	add    $0x10,%esp
+     3cb:	85 c0                	test   %eax,%eax
+     3cd:	75 e1                	jne    3b0 <gettoken+0x70>
+  *ps = s;
+     3cf:	8b 45 08             	mov    0x8(%ebp),%eax
+     3d2:	89 38                	mov    %edi,(%eax)
+  return ret;
+}
+     3d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     3d7:	89 f0                	mov    %esi,%eax
+     3d9:	5b                   	pop    %ebx
+     3da:	5e                   	pop    %esi
+     3db:	5f                   	pop    %edi
+     3dc:	5d                   	pop    %ebp
+     3dd:	c3                   	ret
+     3de:	66 90                	xchg   %ax,%ax
+  switch(*s){
+     3e0:	79 66                	jns    448 <gettoken+0x108>
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     3e2:	39 df                	cmp    %ebx,%edi
+     3e4:	72 39                	jb     41f <gettoken+0xdf>
+  if(eq)
+     3e6:	8b 55 14             	mov    0x14(%ebp),%edx
+     3e9:	85 d2                	test   %edx,%edx
+     3eb:	0f 84 b3 00 00 00    	je     4a4 <gettoken+0x164>
+    *eq = s;
+     3f1:	8b 45 14             	mov    0x14(%ebp),%eax
+     3f4:	89 38                	mov    %edi,(%eax)
+  while(s < es && strchr(whitespace, *s))
+     3f6:	e9 a9 00 00 00       	jmp    4a4 <gettoken+0x164>
+     3fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     3ff:	90                   	nop
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     400:	0f be 07             	movsbl (%edi),%eax
+     403:	83 ec 08             	sub    $0x8,%esp
+     406:	50                   	push   %eax
+     407:	68 00 30 00 00       	push   $0x3000
+     40c:	e8 ef 08 00 00       	call   d00 <strchr>
+     411:	83 c4 10             	add    $0x10,%esp
+     414:	85 c0                	test   %eax,%eax
+     416:	75 1f                	jne    437 <gettoken+0xf7>
+      s++;
+     418:	83 c7 01             	add    $0x1,%edi
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     41b:	39 fb                	cmp    %edi,%ebx
+     41d:	74 77                	je     496 <gettoken+0x156>
+     41f:	0f be 07             	movsbl (%edi),%eax
+     422:	83 ec 08             	sub    $0x8,%esp
+     425:	50                   	push   %eax
+     426:	68 08 30 00 00       	push   $0x3008
+     42b:	e8 d0 08 00 00       	call   d00 <strchr>
+     430:	83 c4 10             	add    $0x10,%esp
+     433:	85 c0                	test   %eax,%eax
+     435:	74 c9                	je     400 <gettoken+0xc0>
+    ret = 'a';
+     437:	be 61 00 00 00       	mov    $0x61,%esi
+     43c:	e9 5d ff ff ff       	jmp    39e <gettoken+0x5e>
+     441:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  switch(*s){
+     448:	3c 26                	cmp    $0x26,%al
+     44a:	74 08                	je     454 <gettoken+0x114>
+     44c:	8d 48 d8             	lea    -0x28(%eax),%ecx
+     44f:	80 f9 01             	cmp    $0x1,%cl
+     452:	77 8e                	ja     3e2 <gettoken+0xa2>
+  ret = *s;
+     454:	0f be f0             	movsbl %al,%esi
+    s++;
+     457:	83 c7 01             	add    $0x1,%edi
+    break;
+     45a:	e9 3f ff ff ff       	jmp    39e <gettoken+0x5e>
+     45f:	90                   	nop
+  switch(*s){
+     460:	3c 3e                	cmp    $0x3e,%al
+     462:	75 1c                	jne    480 <gettoken+0x140>
+    if(*s == '>'){
+     464:	80 7f 01 3e          	cmpb   $0x3e,0x1(%edi)
+     468:	74 1f                	je     489 <gettoken+0x149>
+    s++;
+     46a:	83 c7 01             	add    $0x1,%edi
+  ret = *s;
+     46d:	be 3e 00 00 00       	mov    $0x3e,%esi
+     472:	e9 27 ff ff ff       	jmp    39e <gettoken+0x5e>
+     477:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     47e:	66 90                	xchg   %ax,%ax
+  switch(*s){
+     480:	3c 7c                	cmp    $0x7c,%al
+     482:	74 d0                	je     454 <gettoken+0x114>
+     484:	e9 59 ff ff ff       	jmp    3e2 <gettoken+0xa2>
+      s++;
+     489:	83 c7 02             	add    $0x2,%edi
+      ret = '+';
+     48c:	be 2b 00 00 00       	mov    $0x2b,%esi
+     491:	e9 08 ff ff ff       	jmp    39e <gettoken+0x5e>
+  if(eq)
+     496:	8b 45 14             	mov    0x14(%ebp),%eax
+     499:	85 c0                	test   %eax,%eax
+     49b:	74 05                	je     4a2 <gettoken+0x162>
+    *eq = s;
+     49d:	8b 45 14             	mov    0x14(%ebp),%eax
+     4a0:	89 18                	mov    %ebx,(%eax)
+      s++;
+     4a2:	89 df                	mov    %ebx,%edi
+    ret = 'a';
+     4a4:	be 61 00 00 00       	mov    $0x61,%esi
+     4a9:	e9 21 ff ff ff       	jmp    3cf <gettoken+0x8f>
+     4ae:	66 90                	xchg   %ax,%ax
+
+000004b0 <peek>:
+
+int
+peek(char **ps, char *es, char *toks)
+{
+     4b0:	55                   	push   %ebp
+     4b1:	89 e5                	mov    %esp,%ebp
+     4b3:	57                   	push   %edi
+     4b4:	56                   	push   %esi
+     4b5:	53                   	push   %ebx
+     4b6:	83 ec 0c             	sub    $0xc,%esp
+     4b9:	8b 7d 08             	mov    0x8(%ebp),%edi
+     4bc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *s;
+
+  s = *ps;
+     4bf:	8b 1f                	mov    (%edi),%ebx
+  while(s < es && strchr(whitespace, *s))
+     4c1:	39 f3                	cmp    %esi,%ebx
+     4c3:	72 12                	jb     4d7 <peek+0x27>
+     4c5:	eb 28                	jmp    4ef <peek+0x3f>
+     4c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4ce:	66 90                	xchg   %ax,%ax
+    s++;
+     4d0:	83 c3 01             	add    $0x1,%ebx
+  while(s < es && strchr(whitespace, *s))
+     4d3:	39 de                	cmp    %ebx,%esi
+     4d5:	74 18                	je     4ef <peek+0x3f>
+     4d7:	0f be 03             	movsbl (%ebx),%eax
+     4da:	83 ec 08             	sub    $0x8,%esp
+     4dd:	50                   	push   %eax
+     4de:	68 08 30 00 00       	push   $0x3008
+     4e3:	e8 18 08 00 00       	call   d00 <strchr>
+     4e8:	83 c4 10             	add    $0x10,%esp
+     4eb:	85 c0                	test   %eax,%eax
+     4ed:	75 e1                	jne    4d0 <peek+0x20>
+  *ps = s;
+     4ef:	89 1f                	mov    %ebx,(%edi)
+  return *s && strchr(toks, *s);
+     4f1:	0f be 03             	movsbl (%ebx),%eax
+     4f4:	31 d2                	xor    %edx,%edx
+     4f6:	84 c0                	test   %al,%al
+     4f8:	75 0e                	jne    508 <peek+0x58>
+}
+     4fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     4fd:	89 d0                	mov    %edx,%eax
+     4ff:	5b                   	pop    %ebx
+     500:	5e                   	pop    %esi
+     501:	5f                   	pop    %edi
+     502:	5d                   	pop    %ebp
+     503:	c3                   	ret
+     504:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  return *s && strchr(toks, *s);
+     508:	83 ec 08             	sub    $0x8,%esp
+     50b:	50                   	push   %eax
+     50c:	ff 75 10             	push   0x10(%ebp)
+     50f:	e8 ec 07 00 00       	call   d00 <strchr>
+     514:	83 c4 10             	add    $0x10,%esp
+     517:	31 d2                	xor    %edx,%edx
+     519:	85 c0                	test   %eax,%eax
+     51b:	0f 95 c2             	setne  %dl
+}
+     51e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     521:	5b                   	pop    %ebx
+     522:	89 d0                	mov    %edx,%eax
+     524:	5e                   	pop    %esi
+     525:	5f                   	pop    %edi
+     526:	5d                   	pop    %ebp
+     527:	c3                   	ret
+     528:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     52f:	90                   	nop
+
+00000530 <parseredirs>:
+  return cmd;
+}
+
+struct cmd*
+parseredirs(struct cmd *cmd, char **ps, char *es)
+{
+     530:	55                   	push   %ebp
+     531:	89 e5                	mov    %esp,%ebp
+     533:	57                   	push   %edi
+     534:	56                   	push   %esi
+     535:	53                   	push   %ebx
+     536:	83 ec 2c             	sub    $0x2c,%esp
+     539:	8b 75 0c             	mov    0xc(%ebp),%esi
+     53c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int tok;
+  char *q, *eq;
+
+  while(peek(ps, es, "<>")){
+     53f:	90                   	nop
+     540:	83 ec 04             	sub    $0x4,%esp
+     543:	68 b9 1a 00 00       	push   $0x1ab9
+     548:	53                   	push   %ebx
+     549:	56                   	push   %esi
+     54a:	e8 61 ff ff ff       	call   4b0 <peek>
+     54f:	83 c4 10             	add    $0x10,%esp
+     552:	85 c0                	test   %eax,%eax
+     554:	0f 84 f6 00 00 00    	je     650 <parseredirs+0x120>
+    tok = gettoken(ps, es, 0, 0);
+     55a:	6a 00                	push   $0x0
+     55c:	6a 00                	push   $0x0
+     55e:	53                   	push   %ebx
+     55f:	56                   	push   %esi
+     560:	e8 db fd ff ff       	call   340 <gettoken>
+     565:	89 c7                	mov    %eax,%edi
+    if(gettoken(ps, es, &q, &eq) != 'a')
+     567:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     56a:	50                   	push   %eax
+     56b:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     56e:	50                   	push   %eax
+     56f:	53                   	push   %ebx
+     570:	56                   	push   %esi
+     571:	e8 ca fd ff ff       	call   340 <gettoken>
+     576:	83 c4 20             	add    $0x20,%esp
+     579:	83 f8 61             	cmp    $0x61,%eax
+     57c:	0f 85 d9 00 00 00    	jne    65b <parseredirs+0x12b>
+      panic("missing file for redirection");
+    switch(tok){
+     582:	83 ff 3c             	cmp    $0x3c,%edi
+     585:	74 69                	je     5f0 <parseredirs+0xc0>
+     587:	83 ff 3e             	cmp    $0x3e,%edi
+     58a:	74 05                	je     591 <parseredirs+0x61>
+     58c:	83 ff 2b             	cmp    $0x2b,%edi
+     58f:	75 af                	jne    540 <parseredirs+0x10>
+      break;
+    case '>':
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+      break;
+    case '+':  // >>
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     591:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     594:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  cmd = malloc(sizeof(*cmd));
+     597:	83 ec 0c             	sub    $0xc,%esp
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     59a:	89 55 d0             	mov    %edx,-0x30(%ebp)
+     59d:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  cmd = malloc(sizeof(*cmd));
+     5a0:	6a 18                	push   $0x18
+     5a2:	e8 d9 12 00 00       	call   1880 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     5a7:	83 c4 0c             	add    $0xc,%esp
+     5aa:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     5ac:	89 c7                	mov    %eax,%edi
+  memset(cmd, 0, sizeof(*cmd));
+     5ae:	6a 00                	push   $0x0
+     5b0:	50                   	push   %eax
+     5b1:	e8 da 06 00 00       	call   c90 <memset>
+  cmd->type = REDIR;
+     5b6:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+  cmd->cmd = subcmd;
+     5bc:	8b 45 08             	mov    0x8(%ebp),%eax
+      break;
+     5bf:	83 c4 10             	add    $0x10,%esp
+  cmd->cmd = subcmd;
+     5c2:	89 47 04             	mov    %eax,0x4(%edi)
+  cmd->file = file;
+     5c5:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+     5c8:	89 4f 08             	mov    %ecx,0x8(%edi)
+  cmd->efile = efile;
+     5cb:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  cmd->mode = mode;
+     5ce:	c7 47 10 01 02 00 00 	movl   $0x201,0x10(%edi)
+  cmd->efile = efile;
+     5d5:	89 57 0c             	mov    %edx,0xc(%edi)
+  cmd->fd = fd;
+     5d8:	c7 47 14 01 00 00 00 	movl   $0x1,0x14(%edi)
+      break;
+     5df:	89 7d 08             	mov    %edi,0x8(%ebp)
+     5e2:	e9 59 ff ff ff       	jmp    540 <parseredirs+0x10>
+     5e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5ee:	66 90                	xchg   %ax,%ax
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     5f0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     5f3:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  cmd = malloc(sizeof(*cmd));
+     5f6:	83 ec 0c             	sub    $0xc,%esp
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     5f9:	89 55 d0             	mov    %edx,-0x30(%ebp)
+     5fc:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  cmd = malloc(sizeof(*cmd));
+     5ff:	6a 18                	push   $0x18
+     601:	e8 7a 12 00 00       	call   1880 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     606:	83 c4 0c             	add    $0xc,%esp
+     609:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     60b:	89 c7                	mov    %eax,%edi
+  memset(cmd, 0, sizeof(*cmd));
+     60d:	6a 00                	push   $0x0
+     60f:	50                   	push   %eax
+     610:	e8 7b 06 00 00       	call   c90 <memset>
+  cmd->cmd = subcmd;
+     615:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->file = file;
+     618:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+      break;
+     61b:	89 7d 08             	mov    %edi,0x8(%ebp)
+  cmd->efile = efile;
+     61e:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  cmd->type = REDIR;
+     621:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+      break;
+     627:	83 c4 10             	add    $0x10,%esp
+  cmd->cmd = subcmd;
+     62a:	89 47 04             	mov    %eax,0x4(%edi)
+  cmd->file = file;
+     62d:	89 4f 08             	mov    %ecx,0x8(%edi)
+  cmd->efile = efile;
+     630:	89 57 0c             	mov    %edx,0xc(%edi)
+  cmd->mode = mode;
+     633:	c7 47 10 00 00 00 00 	movl   $0x0,0x10(%edi)
+  cmd->fd = fd;
+     63a:	c7 47 14 00 00 00 00 	movl   $0x0,0x14(%edi)
+      break;
+     641:	e9 fa fe ff ff       	jmp    540 <parseredirs+0x10>
+     646:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     64d:	8d 76 00             	lea    0x0(%esi),%esi
+    }
+  }
+  return cmd;
+}
+     650:	8b 45 08             	mov    0x8(%ebp),%eax
+     653:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     656:	5b                   	pop    %ebx
+     657:	5e                   	pop    %esi
+     658:	5f                   	pop    %edi
+     659:	5d                   	pop    %ebp
+     65a:	c3                   	ret
+      panic("missing file for redirection");
+     65b:	83 ec 0c             	sub    $0xc,%esp
+     65e:	68 9c 1a 00 00       	push   $0x1a9c
+     663:	e8 d8 f9 ff ff       	call   40 <panic>
+     668:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     66f:	90                   	nop
+
+00000670 <parseexec>:
+  return cmd;
+}
+
+struct cmd*
+parseexec(char **ps, char *es)
+{
+     670:	55                   	push   %ebp
+     671:	89 e5                	mov    %esp,%ebp
+     673:	57                   	push   %edi
+     674:	56                   	push   %esi
+     675:	53                   	push   %ebx
+     676:	83 ec 30             	sub    $0x30,%esp
+     679:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     67c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *q, *eq;
+  int tok, argc;
+  struct execcmd *cmd;
+  struct cmd *ret;
+
+  if(peek(ps, es, "("))
+     67f:	68 bc 1a 00 00       	push   $0x1abc
+     684:	56                   	push   %esi
+     685:	53                   	push   %ebx
+     686:	e8 25 fe ff ff       	call   4b0 <peek>
+     68b:	83 c4 10             	add    $0x10,%esp
+     68e:	85 c0                	test   %eax,%eax
+     690:	0f 85 aa 00 00 00    	jne    740 <parseexec+0xd0>
+  cmd = malloc(sizeof(*cmd));
+     696:	83 ec 0c             	sub    $0xc,%esp
+     699:	89 c7                	mov    %eax,%edi
+     69b:	6a 54                	push   $0x54
+     69d:	e8 de 11 00 00       	call   1880 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     6a2:	83 c4 0c             	add    $0xc,%esp
+     6a5:	6a 54                	push   $0x54
+     6a7:	6a 00                	push   $0x0
+     6a9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     6ac:	50                   	push   %eax
+     6ad:	e8 de 05 00 00       	call   c90 <memset>
+  cmd->type = EXEC;
+     6b2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+
+  ret = execcmd();
+  cmd = (struct execcmd*)ret;
+
+  argc = 0;
+  ret = parseredirs(ret, ps, es);
+     6b5:	83 c4 0c             	add    $0xc,%esp
+  cmd->type = EXEC;
+     6b8:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  ret = parseredirs(ret, ps, es);
+     6be:	56                   	push   %esi
+     6bf:	53                   	push   %ebx
+     6c0:	50                   	push   %eax
+     6c1:	e8 6a fe ff ff       	call   530 <parseredirs>
+  while(!peek(ps, es, "|)&;")){
+     6c6:	83 c4 10             	add    $0x10,%esp
+  ret = parseredirs(ret, ps, es);
+     6c9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while(!peek(ps, es, "|)&;")){
+     6cc:	eb 15                	jmp    6e3 <parseexec+0x73>
+     6ce:	66 90                	xchg   %ax,%ax
+    cmd->argv[argc] = q;
+    cmd->eargv[argc] = eq;
+    argc++;
+    if(argc >= MAXARGS)
+      panic("too many args");
+    ret = parseredirs(ret, ps, es);
+     6d0:	83 ec 04             	sub    $0x4,%esp
+     6d3:	56                   	push   %esi
+     6d4:	53                   	push   %ebx
+     6d5:	ff 75 d4             	push   -0x2c(%ebp)
+     6d8:	e8 53 fe ff ff       	call   530 <parseredirs>
+     6dd:	83 c4 10             	add    $0x10,%esp
+     6e0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while(!peek(ps, es, "|)&;")){
+     6e3:	83 ec 04             	sub    $0x4,%esp
+     6e6:	68 d3 1a 00 00       	push   $0x1ad3
+     6eb:	56                   	push   %esi
+     6ec:	53                   	push   %ebx
+     6ed:	e8 be fd ff ff       	call   4b0 <peek>
+     6f2:	83 c4 10             	add    $0x10,%esp
+     6f5:	85 c0                	test   %eax,%eax
+     6f7:	75 5f                	jne    758 <parseexec+0xe8>
+    if((tok=gettoken(ps, es, &q, &eq)) == 0)
+     6f9:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     6fc:	50                   	push   %eax
+     6fd:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     700:	50                   	push   %eax
+     701:	56                   	push   %esi
+     702:	53                   	push   %ebx
+     703:	e8 38 fc ff ff       	call   340 <gettoken>
+     708:	83 c4 10             	add    $0x10,%esp
+     70b:	85 c0                	test   %eax,%eax
+     70d:	74 49                	je     758 <parseexec+0xe8>
+    if(tok != 'a')
+     70f:	83 f8 61             	cmp    $0x61,%eax
+     712:	75 62                	jne    776 <parseexec+0x106>
+    cmd->argv[argc] = q;
+     714:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     717:	8b 55 d0             	mov    -0x30(%ebp),%edx
+     71a:	89 44 ba 04          	mov    %eax,0x4(%edx,%edi,4)
+    cmd->eargv[argc] = eq;
+     71e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     721:	89 44 ba 2c          	mov    %eax,0x2c(%edx,%edi,4)
+    argc++;
+     725:	83 c7 01             	add    $0x1,%edi
+    if(argc >= MAXARGS)
+     728:	83 ff 0a             	cmp    $0xa,%edi
+     72b:	75 a3                	jne    6d0 <parseexec+0x60>
+      panic("too many args");
+     72d:	83 ec 0c             	sub    $0xc,%esp
+     730:	68 c5 1a 00 00       	push   $0x1ac5
+     735:	e8 06 f9 ff ff       	call   40 <panic>
+     73a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return parseblock(ps, es);
+     740:	89 75 0c             	mov    %esi,0xc(%ebp)
+     743:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  }
+  cmd->argv[argc] = 0;
+  cmd->eargv[argc] = 0;
+  return ret;
+}
+     746:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     749:	5b                   	pop    %ebx
+     74a:	5e                   	pop    %esi
+     74b:	5f                   	pop    %edi
+     74c:	5d                   	pop    %ebp
+    return parseblock(ps, es);
+     74d:	e9 ae 01 00 00       	jmp    900 <parseblock>
+     752:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  cmd->argv[argc] = 0;
+     758:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     75b:	c7 44 b8 04 00 00 00 	movl   $0x0,0x4(%eax,%edi,4)
+     762:	00 
+  cmd->eargv[argc] = 0;
+     763:	c7 44 b8 2c 00 00 00 	movl   $0x0,0x2c(%eax,%edi,4)
+     76a:	00 
+}
+     76b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     76e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     771:	5b                   	pop    %ebx
+     772:	5e                   	pop    %esi
+     773:	5f                   	pop    %edi
+     774:	5d                   	pop    %ebp
+     775:	c3                   	ret
+      panic("syntax");
+     776:	83 ec 0c             	sub    $0xc,%esp
+     779:	68 be 1a 00 00       	push   $0x1abe
+     77e:	e8 bd f8 ff ff       	call   40 <panic>
+     783:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     78a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000790 <parsepipe>:
+{
+     790:	55                   	push   %ebp
+     791:	89 e5                	mov    %esp,%ebp
+     793:	57                   	push   %edi
+     794:	56                   	push   %esi
+     795:	53                   	push   %ebx
+     796:	83 ec 14             	sub    $0x14,%esp
+     799:	8b 75 08             	mov    0x8(%ebp),%esi
+     79c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parseexec(ps, es);
+     79f:	57                   	push   %edi
+     7a0:	56                   	push   %esi
+     7a1:	e8 ca fe ff ff       	call   670 <parseexec>
+  if(peek(ps, es, "|")){
+     7a6:	83 c4 0c             	add    $0xc,%esp
+     7a9:	68 d8 1a 00 00       	push   $0x1ad8
+  cmd = parseexec(ps, es);
+     7ae:	89 c3                	mov    %eax,%ebx
+  if(peek(ps, es, "|")){
+     7b0:	57                   	push   %edi
+     7b1:	56                   	push   %esi
+     7b2:	e8 f9 fc ff ff       	call   4b0 <peek>
+     7b7:	83 c4 10             	add    $0x10,%esp
+     7ba:	85 c0                	test   %eax,%eax
+     7bc:	75 12                	jne    7d0 <parsepipe+0x40>
+}
+     7be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     7c1:	89 d8                	mov    %ebx,%eax
+     7c3:	5b                   	pop    %ebx
+     7c4:	5e                   	pop    %esi
+     7c5:	5f                   	pop    %edi
+     7c6:	5d                   	pop    %ebp
+     7c7:	c3                   	ret
+     7c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7cf:	90                   	nop
+    gettoken(ps, es, 0, 0);
+     7d0:	6a 00                	push   $0x0
+     7d2:	6a 00                	push   $0x0
+     7d4:	57                   	push   %edi
+     7d5:	56                   	push   %esi
+     7d6:	e8 65 fb ff ff       	call   340 <gettoken>
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     7db:	58                   	pop    %eax
+     7dc:	5a                   	pop    %edx
+     7dd:	57                   	push   %edi
+     7de:	56                   	push   %esi
+     7df:	e8 ac ff ff ff       	call   790 <parsepipe>
+  cmd = malloc(sizeof(*cmd));
+     7e4:	c7 04 24 0c 00 00 00 	movl   $0xc,(%esp)
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     7eb:	89 c7                	mov    %eax,%edi
+  cmd = malloc(sizeof(*cmd));
+     7ed:	e8 8e 10 00 00       	call   1880 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     7f2:	83 c4 0c             	add    $0xc,%esp
+     7f5:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     7f7:	89 c6                	mov    %eax,%esi
+  memset(cmd, 0, sizeof(*cmd));
+     7f9:	6a 00                	push   $0x0
+     7fb:	50                   	push   %eax
+     7fc:	e8 8f 04 00 00       	call   c90 <memset>
+  cmd->left = left;
+     801:	89 5e 04             	mov    %ebx,0x4(%esi)
+  cmd->right = right;
+     804:	83 c4 10             	add    $0x10,%esp
+     807:	89 f3                	mov    %esi,%ebx
+  cmd->type = PIPE;
+     809:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+}
+     80f:	89 d8                	mov    %ebx,%eax
+  cmd->right = right;
+     811:	89 7e 08             	mov    %edi,0x8(%esi)
+}
+     814:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     817:	5b                   	pop    %ebx
+     818:	5e                   	pop    %esi
+     819:	5f                   	pop    %edi
+     81a:	5d                   	pop    %ebp
+     81b:	c3                   	ret
+     81c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000820 <parseline>:
+{
+     820:	55                   	push   %ebp
+     821:	89 e5                	mov    %esp,%ebp
+     823:	57                   	push   %edi
+     824:	56                   	push   %esi
+     825:	53                   	push   %ebx
+     826:	83 ec 24             	sub    $0x24,%esp
+     829:	8b 75 08             	mov    0x8(%ebp),%esi
+     82c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parsepipe(ps, es);
+     82f:	57                   	push   %edi
+     830:	56                   	push   %esi
+     831:	e8 5a ff ff ff       	call   790 <parsepipe>
+  while(peek(ps, es, "&")){
+     836:	83 c4 10             	add    $0x10,%esp
+  cmd = parsepipe(ps, es);
+     839:	89 c3                	mov    %eax,%ebx
+  while(peek(ps, es, "&")){
+     83b:	eb 3b                	jmp    878 <parseline+0x58>
+     83d:	8d 76 00             	lea    0x0(%esi),%esi
+    gettoken(ps, es, 0, 0);
+     840:	6a 00                	push   $0x0
+     842:	6a 00                	push   $0x0
+     844:	57                   	push   %edi
+     845:	56                   	push   %esi
+     846:	e8 f5 fa ff ff       	call   340 <gettoken>
+  cmd = malloc(sizeof(*cmd));
+     84b:	c7 04 24 08 00 00 00 	movl   $0x8,(%esp)
+     852:	e8 29 10 00 00       	call   1880 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     857:	83 c4 0c             	add    $0xc,%esp
+     85a:	6a 08                	push   $0x8
+     85c:	6a 00                	push   $0x0
+     85e:	50                   	push   %eax
+     85f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     862:	e8 29 04 00 00       	call   c90 <memset>
+  cmd->type = BACK;
+     867:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  cmd->cmd = subcmd;
+     86a:	83 c4 10             	add    $0x10,%esp
+  cmd->type = BACK;
+     86d:	c7 02 05 00 00 00    	movl   $0x5,(%edx)
+  cmd->cmd = subcmd;
+     873:	89 5a 04             	mov    %ebx,0x4(%edx)
+     876:	89 d3                	mov    %edx,%ebx
+  while(peek(ps, es, "&")){
+     878:	83 ec 04             	sub    $0x4,%esp
+     87b:	68 da 1a 00 00       	push   $0x1ada
+     880:	57                   	push   %edi
+     881:	56                   	push   %esi
+     882:	e8 29 fc ff ff       	call   4b0 <peek>
+     887:	83 c4 10             	add    $0x10,%esp
+     88a:	85 c0                	test   %eax,%eax
+     88c:	75 b2                	jne    840 <parseline+0x20>
+  if(peek(ps, es, ";")){
+     88e:	83 ec 04             	sub    $0x4,%esp
+     891:	68 d6 1a 00 00       	push   $0x1ad6
+     896:	57                   	push   %edi
+     897:	56                   	push   %esi
+     898:	e8 13 fc ff ff       	call   4b0 <peek>
+     89d:	83 c4 10             	add    $0x10,%esp
+     8a0:	85 c0                	test   %eax,%eax
+     8a2:	75 0c                	jne    8b0 <parseline+0x90>
+}
+     8a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     8a7:	89 d8                	mov    %ebx,%eax
+     8a9:	5b                   	pop    %ebx
+     8aa:	5e                   	pop    %esi
+     8ab:	5f                   	pop    %edi
+     8ac:	5d                   	pop    %ebp
+     8ad:	c3                   	ret
+     8ae:	66 90                	xchg   %ax,%ax
+    gettoken(ps, es, 0, 0);
+     8b0:	6a 00                	push   $0x0
+     8b2:	6a 00                	push   $0x0
+     8b4:	57                   	push   %edi
+     8b5:	56                   	push   %esi
+     8b6:	e8 85 fa ff ff       	call   340 <gettoken>
+    cmd = listcmd(cmd, parseline(ps, es));
+     8bb:	58                   	pop    %eax
+     8bc:	5a                   	pop    %edx
+     8bd:	57                   	push   %edi
+     8be:	56                   	push   %esi
+     8bf:	e8 5c ff ff ff       	call   820 <parseline>
+  cmd = malloc(sizeof(*cmd));
+     8c4:	c7 04 24 0c 00 00 00 	movl   $0xc,(%esp)
+    cmd = listcmd(cmd, parseline(ps, es));
+     8cb:	89 c7                	mov    %eax,%edi
+  cmd = malloc(sizeof(*cmd));
+     8cd:	e8 ae 0f 00 00       	call   1880 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     8d2:	83 c4 0c             	add    $0xc,%esp
+     8d5:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     8d7:	89 c6                	mov    %eax,%esi
+  memset(cmd, 0, sizeof(*cmd));
+     8d9:	6a 00                	push   $0x0
+     8db:	50                   	push   %eax
+     8dc:	e8 af 03 00 00       	call   c90 <memset>
+  cmd->left = left;
+     8e1:	89 5e 04             	mov    %ebx,0x4(%esi)
+  cmd->right = right;
+     8e4:	83 c4 10             	add    $0x10,%esp
+     8e7:	89 f3                	mov    %esi,%ebx
+  cmd->type = LIST;
+     8e9:	c7 06 04 00 00 00    	movl   $0x4,(%esi)
+}
+     8ef:	89 d8                	mov    %ebx,%eax
+  cmd->right = right;
+     8f1:	89 7e 08             	mov    %edi,0x8(%esi)
+}
+     8f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     8f7:	5b                   	pop    %ebx
+     8f8:	5e                   	pop    %esi
+     8f9:	5f                   	pop    %edi
+     8fa:	5d                   	pop    %ebp
+     8fb:	c3                   	ret
+     8fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000900 <parseblock>:
+{
+     900:	55                   	push   %ebp
+     901:	89 e5                	mov    %esp,%ebp
+     903:	57                   	push   %edi
+     904:	56                   	push   %esi
+     905:	53                   	push   %ebx
+     906:	83 ec 10             	sub    $0x10,%esp
+     909:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     90c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(!peek(ps, es, "("))
+     90f:	68 bc 1a 00 00       	push   $0x1abc
+     914:	56                   	push   %esi
+     915:	53                   	push   %ebx
+     916:	e8 95 fb ff ff       	call   4b0 <peek>
+     91b:	83 c4 10             	add    $0x10,%esp
+     91e:	85 c0                	test   %eax,%eax
+     920:	74 4a                	je     96c <parseblock+0x6c>
+  gettoken(ps, es, 0, 0);
+     922:	6a 00                	push   $0x0
+     924:	6a 00                	push   $0x0
+     926:	56                   	push   %esi
+     927:	53                   	push   %ebx
+     928:	e8 13 fa ff ff       	call   340 <gettoken>
+  cmd = parseline(ps, es);
+     92d:	58                   	pop    %eax
+     92e:	5a                   	pop    %edx
+     92f:	56                   	push   %esi
+     930:	53                   	push   %ebx
+     931:	e8 ea fe ff ff       	call   820 <parseline>
+  if(!peek(ps, es, ")"))
+     936:	83 c4 0c             	add    $0xc,%esp
+     939:	68 f8 1a 00 00       	push   $0x1af8
+  cmd = parseline(ps, es);
+     93e:	89 c7                	mov    %eax,%edi
+  if(!peek(ps, es, ")"))
+     940:	56                   	push   %esi
+     941:	53                   	push   %ebx
+     942:	e8 69 fb ff ff       	call   4b0 <peek>
+     947:	83 c4 10             	add    $0x10,%esp
+     94a:	85 c0                	test   %eax,%eax
+     94c:	74 2b                	je     979 <parseblock+0x79>
+  gettoken(ps, es, 0, 0);
+     94e:	6a 00                	push   $0x0
+     950:	6a 00                	push   $0x0
+     952:	56                   	push   %esi
+     953:	53                   	push   %ebx
+     954:	e8 e7 f9 ff ff       	call   340 <gettoken>
+  cmd = parseredirs(cmd, ps, es);
+     959:	83 c4 0c             	add    $0xc,%esp
+     95c:	56                   	push   %esi
+     95d:	53                   	push   %ebx
+     95e:	57                   	push   %edi
+     95f:	e8 cc fb ff ff       	call   530 <parseredirs>
+}
+     964:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     967:	5b                   	pop    %ebx
+     968:	5e                   	pop    %esi
+     969:	5f                   	pop    %edi
+     96a:	5d                   	pop    %ebp
+     96b:	c3                   	ret
+    panic("parseblock");
+     96c:	83 ec 0c             	sub    $0xc,%esp
+     96f:	68 dc 1a 00 00       	push   $0x1adc
+     974:	e8 c7 f6 ff ff       	call   40 <panic>
+    panic("syntax - missing )");
+     979:	83 ec 0c             	sub    $0xc,%esp
+     97c:	68 e7 1a 00 00       	push   $0x1ae7
+     981:	e8 ba f6 ff ff       	call   40 <panic>
+     986:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     98d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000990 <nulterminate>:
+
+// NUL-terminate all the counted strings.
+struct cmd*
+nulterminate(struct cmd *cmd)
+{
+     990:	55                   	push   %ebp
+     991:	89 e5                	mov    %esp,%ebp
+     993:	53                   	push   %ebx
+     994:	83 ec 04             	sub    $0x4,%esp
+     997:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct execcmd *ecmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if(cmd == 0)
+     99a:	85 db                	test   %ebx,%ebx
+     99c:	0f 84 7e 00 00 00    	je     a20 <nulterminate+0x90>
+    return 0;
+
+  switch(cmd->type){
+     9a2:	83 3b 05             	cmpl   $0x5,(%ebx)
+     9a5:	77 20                	ja     9c7 <nulterminate+0x37>
+     9a7:	8b 03                	mov    (%ebx),%eax
+     9a9:	ff 24 85 38 1b 00 00 	jmp    *0x1b38(,%eax,4)
+    nulterminate(pcmd->right);
+    break;
+
+  case LIST:
+    lcmd = (struct listcmd*)cmd;
+    nulterminate(lcmd->left);
+     9b0:	83 ec 0c             	sub    $0xc,%esp
+     9b3:	ff 73 04             	push   0x4(%ebx)
+     9b6:	e8 d5 ff ff ff       	call   990 <nulterminate>
+    nulterminate(lcmd->right);
+     9bb:	58                   	pop    %eax
+     9bc:	ff 73 08             	push   0x8(%ebx)
+     9bf:	e8 cc ff ff ff       	call   990 <nulterminate>
+    break;
+     9c4:	83 c4 10             	add    $0x10,%esp
+    return 0;
+     9c7:	89 d8                	mov    %ebx,%eax
+    bcmd = (struct backcmd*)cmd;
+    nulterminate(bcmd->cmd);
+    break;
+  }
+  return cmd;
+}
+     9c9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     9cc:	c9                   	leave
+     9cd:	c3                   	ret
+     9ce:	66 90                	xchg   %ax,%ax
+    nulterminate(bcmd->cmd);
+     9d0:	83 ec 0c             	sub    $0xc,%esp
+     9d3:	ff 73 04             	push   0x4(%ebx)
+     9d6:	e8 b5 ff ff ff       	call   990 <nulterminate>
+    break;
+     9db:	83 c4 10             	add    $0x10,%esp
+     9de:	eb e7                	jmp    9c7 <nulterminate+0x37>
+    for(i=0; ecmd->argv[i]; i++)
+     9e0:	8b 4b 04             	mov    0x4(%ebx),%ecx
+     9e3:	8d 43 08             	lea    0x8(%ebx),%eax
+     9e6:	85 c9                	test   %ecx,%ecx
+     9e8:	74 dd                	je     9c7 <nulterminate+0x37>
+     9ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      *ecmd->eargv[i] = 0;
+     9f0:	8b 50 24             	mov    0x24(%eax),%edx
+    for(i=0; ecmd->argv[i]; i++)
+     9f3:	83 c0 04             	add    $0x4,%eax
+      *ecmd->eargv[i] = 0;
+     9f6:	c6 02 00             	movb   $0x0,(%edx)
+    for(i=0; ecmd->argv[i]; i++)
+     9f9:	8b 50 fc             	mov    -0x4(%eax),%edx
+     9fc:	85 d2                	test   %edx,%edx
+     9fe:	75 f0                	jne    9f0 <nulterminate+0x60>
+     a00:	eb c5                	jmp    9c7 <nulterminate+0x37>
+     a02:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    nulterminate(rcmd->cmd);
+     a08:	83 ec 0c             	sub    $0xc,%esp
+     a0b:	ff 73 04             	push   0x4(%ebx)
+     a0e:	e8 7d ff ff ff       	call   990 <nulterminate>
+    *rcmd->efile = 0;
+     a13:	8b 43 0c             	mov    0xc(%ebx),%eax
+    break;
+     a16:	83 c4 10             	add    $0x10,%esp
+    *rcmd->efile = 0;
+     a19:	c6 00 00             	movb   $0x0,(%eax)
+    break;
+     a1c:	eb a9                	jmp    9c7 <nulterminate+0x37>
+     a1e:	66 90                	xchg   %ax,%ax
+    return 0;
+     a20:	31 c0                	xor    %eax,%eax
+     a22:	eb a5                	jmp    9c9 <nulterminate+0x39>
+     a24:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     a2f:	90                   	nop
+
+00000a30 <parsecmd>:
+{
+     a30:	55                   	push   %ebp
+     a31:	89 e5                	mov    %esp,%ebp
+     a33:	57                   	push   %edi
+     a34:	56                   	push   %esi
+  cmd = parseline(&s, es);
+     a35:	8d 7d 08             	lea    0x8(%ebp),%edi
+{
+     a38:	53                   	push   %ebx
+     a39:	83 ec 18             	sub    $0x18,%esp
+  es = s + strlen(s);
+     a3c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     a3f:	53                   	push   %ebx
+     a40:	e8 1b 02 00 00       	call   c60 <strlen>
+  cmd = parseline(&s, es);
+     a45:	59                   	pop    %ecx
+     a46:	5e                   	pop    %esi
+  es = s + strlen(s);
+     a47:	01 c3                	add    %eax,%ebx
+  cmd = parseline(&s, es);
+     a49:	53                   	push   %ebx
+     a4a:	57                   	push   %edi
+     a4b:	e8 d0 fd ff ff       	call   820 <parseline>
+  peek(&s, es, "");
+     a50:	83 c4 0c             	add    $0xc,%esp
+     a53:	68 86 1a 00 00       	push   $0x1a86
+  cmd = parseline(&s, es);
+     a58:	89 c6                	mov    %eax,%esi
+  peek(&s, es, "");
+     a5a:	53                   	push   %ebx
+     a5b:	57                   	push   %edi
+     a5c:	e8 4f fa ff ff       	call   4b0 <peek>
+  if(s != es){
+     a61:	8b 45 08             	mov    0x8(%ebp),%eax
+     a64:	83 c4 10             	add    $0x10,%esp
+     a67:	39 d8                	cmp    %ebx,%eax
+     a69:	75 13                	jne    a7e <parsecmd+0x4e>
+  nulterminate(cmd);
+     a6b:	83 ec 0c             	sub    $0xc,%esp
+     a6e:	56                   	push   %esi
+     a6f:	e8 1c ff ff ff       	call   990 <nulterminate>
+}
+     a74:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a77:	89 f0                	mov    %esi,%eax
+     a79:	5b                   	pop    %ebx
+     a7a:	5e                   	pop    %esi
+     a7b:	5f                   	pop    %edi
+     a7c:	5d                   	pop    %ebp
+     a7d:	c3                   	ret
+    printf(2, "leftovers: %s\n", s);
+     a7e:	52                   	push   %edx
+     a7f:	50                   	push   %eax
+     a80:	68 fa 1a 00 00       	push   $0x1afa
+     a85:	6a 02                	push   $0x2
+     a87:	e8 a4 0b 00 00       	call   1630 <printf>
+    panic("syntax");
+     a8c:	c7 04 24 be 1a 00 00 	movl   $0x1abe,(%esp)
+     a93:	e8 a8 f5 ff ff       	call   40 <panic>
+     a98:	66 90                	xchg   %ax,%ax
+     a9a:	66 90                	xchg   %ax,%ax
+     a9c:	66 90                	xchg   %ax,%ax
+     a9e:	66 90                	xchg   %ax,%ax
+
+00000aa0 <main>:
+{
+     aa0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     aa4:	83 e4 f0             	and    $0xfffffff0,%esp
+     aa7:	ff 71 fc             	push   -0x4(%ecx)
+     aaa:	55                   	push   %ebp
+     aab:	89 e5                	mov    %esp,%ebp
+     aad:	51                   	push   %ecx
+     aae:	83 ec 04             	sub    $0x4,%esp
+  while((fd = open("console", O_RDWR)) >= 0){
+     ab1:	eb 0e                	jmp    ac1 <main+0x21>
+     ab3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     ab7:	90                   	nop
+    if(fd >= 3){
+     ab8:	83 f8 02             	cmp    $0x2,%eax
+     abb:	0f 8f 96 00 00 00    	jg     b57 <main+0xb7>
+  while((fd = open("console", O_RDWR)) >= 0){
+     ac1:	83 ec 08             	sub    $0x8,%esp
+     ac4:	6a 02                	push   $0x2
+     ac6:	68 09 1b 00 00       	push   $0x1b09
+     acb:	e8 20 06 00 00       	call   10f0 <open>
+     ad0:	83 c4 10             	add    $0x10,%esp
+     ad3:	85 c0                	test   %eax,%eax
+     ad5:	79 e1                	jns    ab8 <main+0x18>
+     ad7:	eb 2e                	jmp    b07 <main+0x67>
+     ad9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
+     ae0:	80 3d 42 32 00 00 20 	cmpb   $0x20,0x3242
+     ae7:	0f 84 8d 00 00 00    	je     b7a <main+0xda>
+     aed:	8d 76 00             	lea    0x0(%esi),%esi
+  pid = fork();
+     af0:	e8 7b 03 00 00       	call   e70 <fork>
+  if(pid == -1)
+     af5:	83 f8 ff             	cmp    $0xffffffff,%eax
+     af8:	0f 84 c1 00 00 00    	je     bbf <main+0x11f>
+    if(fork1() == 0)
+     afe:	85 c0                	test   %eax,%eax
+     b00:	74 63                	je     b65 <main+0xc5>
+    wait();
+     b02:	e8 b1 05 00 00       	call   10b8 <wait>
+  printf(2, "$ ");
+     b07:	83 ec 08             	sub    $0x8,%esp
+     b0a:	68 68 1a 00 00       	push   $0x1a68
+     b0f:	6a 02                	push   $0x2
+     b11:	e8 1a 0b 00 00       	call   1630 <printf>
+  memset(buf, 0, nbuf);
+     b16:	83 c4 0c             	add    $0xc,%esp
+     b19:	6a 64                	push   $0x64
+     b1b:	6a 00                	push   $0x0
+     b1d:	68 40 32 00 00       	push   $0x3240
+     b22:	e8 69 01 00 00       	call   c90 <memset>
+  gets(buf, nbuf);
+     b27:	58                   	pop    %eax
+     b28:	5a                   	pop    %edx
+     b29:	6a 64                	push   $0x64
+     b2b:	68 40 32 00 00       	push   $0x3240
+     b30:	e8 0b 02 00 00       	call   d40 <gets>
+  if(buf[0] == 0) // EOF
+     b35:	0f b6 05 40 32 00 00 	movzbl 0x3240,%eax
+     b3c:	83 c4 10             	add    $0x10,%esp
+     b3f:	84 c0                	test   %al,%al
+     b41:	74 0f                	je     b52 <main+0xb2>
+    if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
+     b43:	3c 63                	cmp    $0x63,%al
+     b45:	75 a9                	jne    af0 <main+0x50>
+     b47:	80 3d 41 32 00 00 64 	cmpb   $0x64,0x3241
+     b4e:	75 a0                	jne    af0 <main+0x50>
+     b50:	eb 8e                	jmp    ae0 <main+0x40>
+  exit();
+     b52:	e8 49 03 00 00       	call   ea0 <exit>
+      close(fd);
+     b57:	83 ec 0c             	sub    $0xc,%esp
+     b5a:	50                   	push   %eax
+     b5b:	e8 90 04 00 00       	call   ff0 <close>
+      break;
+     b60:	83 c4 10             	add    $0x10,%esp
+     b63:	eb a2                	jmp    b07 <main+0x67>
+      runcmd(parsecmd(buf));
+     b65:	83 ec 0c             	sub    $0xc,%esp
+     b68:	68 40 32 00 00       	push   $0x3240
+     b6d:	e8 be fe ff ff       	call   a30 <parsecmd>
+     b72:	89 04 24             	mov    %eax,(%esp)
+     b75:	e8 06 f5 ff ff       	call   80 <runcmd>
+      buf[strlen(buf)-1] = 0;  // chop \n
+     b7a:	83 ec 0c             	sub    $0xc,%esp
+     b7d:	68 40 32 00 00       	push   $0x3240
+     b82:	e8 d9 00 00 00       	call   c60 <strlen>
+      if(chdir(buf+3) < 0)
+     b87:	c7 04 24 43 32 00 00 	movl   $0x3243,(%esp)
+      buf[strlen(buf)-1] = 0;  // chop \n
+     b8e:	c6 80 3f 32 00 00 00 	movb   $0x0,0x323f(%eax)
+      if(chdir(buf+3) < 0)
+     b95:	e8 86 05 00 00       	call   1120 <chdir>
+     b9a:	83 c4 10             	add    $0x10,%esp
+     b9d:	85 c0                	test   %eax,%eax
+     b9f:	0f 89 62 ff ff ff    	jns    b07 <main+0x67>
+        printf(2, "cannot cd %s\n", buf+3);
+     ba5:	51                   	push   %ecx
+     ba6:	68 43 32 00 00       	push   $0x3243
+     bab:	68 11 1b 00 00       	push   $0x1b11
+     bb0:	6a 02                	push   $0x2
+     bb2:	e8 79 0a 00 00       	call   1630 <printf>
+     bb7:	83 c4 10             	add    $0x10,%esp
+     bba:	e9 48 ff ff ff       	jmp    b07 <main+0x67>
+    panic("fork");
+     bbf:	83 ec 0c             	sub    $0xc,%esp
+     bc2:	68 6b 1a 00 00       	push   $0x1a6b
+     bc7:	e8 74 f4 ff ff       	call   40 <panic>
+     bcc:	66 90                	xchg   %ax,%ax
+     bce:	66 90                	xchg   %ax,%ax
+
+00000bd0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     bd0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     bd1:	31 c0                	xor    %eax,%eax
+{
+     bd3:	89 e5                	mov    %esp,%ebp
+     bd5:	53                   	push   %ebx
+     bd6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     bd9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     bdc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     be0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     be4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     be7:	83 c0 01             	add    $0x1,%eax
+     bea:	84 d2                	test   %dl,%dl
+     bec:	75 f2                	jne    be0 <strcpy+0x10>
+    ;
+  return os;
+}
+     bee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     bf1:	89 c8                	mov    %ecx,%eax
+     bf3:	c9                   	leave
+     bf4:	c3                   	ret
+     bf5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bfc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000c00 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     c00:	55                   	push   %ebp
+     c01:	89 e5                	mov    %esp,%ebp
+     c03:	53                   	push   %ebx
+     c04:	8b 55 08             	mov    0x8(%ebp),%edx
+     c07:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     c0a:	0f b6 02             	movzbl (%edx),%eax
+     c0d:	84 c0                	test   %al,%al
+     c0f:	75 17                	jne    c28 <strcmp+0x28>
+     c11:	eb 3a                	jmp    c4d <strcmp+0x4d>
+     c13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c17:	90                   	nop
+     c18:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     c1c:	83 c2 01             	add    $0x1,%edx
+     c1f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     c22:	84 c0                	test   %al,%al
+     c24:	74 1a                	je     c40 <strcmp+0x40>
+    p++, q++;
+     c26:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     c28:	0f b6 19             	movzbl (%ecx),%ebx
+     c2b:	38 c3                	cmp    %al,%bl
+     c2d:	74 e9                	je     c18 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     c2f:	29 d8                	sub    %ebx,%eax
+}
+     c31:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     c34:	c9                   	leave
+     c35:	c3                   	ret
+     c36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c3d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     c40:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     c44:	31 c0                	xor    %eax,%eax
+     c46:	29 d8                	sub    %ebx,%eax
+}
+     c48:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     c4b:	c9                   	leave
+     c4c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     c4d:	0f b6 19             	movzbl (%ecx),%ebx
+     c50:	31 c0                	xor    %eax,%eax
+     c52:	eb db                	jmp    c2f <strcmp+0x2f>
+     c54:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c5f:	90                   	nop
+
+00000c60 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     c60:	55                   	push   %ebp
+     c61:	89 e5                	mov    %esp,%ebp
+     c63:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     c66:	80 3a 00             	cmpb   $0x0,(%edx)
+     c69:	74 15                	je     c80 <strlen+0x20>
+     c6b:	31 c0                	xor    %eax,%eax
+     c6d:	8d 76 00             	lea    0x0(%esi),%esi
+     c70:	83 c0 01             	add    $0x1,%eax
+     c73:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     c77:	89 c1                	mov    %eax,%ecx
+     c79:	75 f5                	jne    c70 <strlen+0x10>
+    ;
+  return n;
+}
+     c7b:	89 c8                	mov    %ecx,%eax
+     c7d:	5d                   	pop    %ebp
+     c7e:	c3                   	ret
+     c7f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     c80:	31 c9                	xor    %ecx,%ecx
+}
+     c82:	5d                   	pop    %ebp
+     c83:	89 c8                	mov    %ecx,%eax
+     c85:	c3                   	ret
+     c86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c8d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000c90 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     c90:	55                   	push   %ebp
+     c91:	89 e5                	mov    %esp,%ebp
+     c93:	57                   	push   %edi
+     c94:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     c97:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     c9a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     c9d:	89 d7                	mov    %edx,%edi
+     c9f:	fc                   	cld
+     ca0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     ca2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     ca5:	89 d0                	mov    %edx,%eax
+     ca7:	c9                   	leave
+     ca8:	c3                   	ret
+     ca9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000cb0 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     cb0:	55                   	push   %ebp
+     cb1:	89 e5                	mov    %esp,%ebp
+     cb3:	56                   	push   %esi
+     cb4:	53                   	push   %ebx
+     cb5:	8b 75 10             	mov    0x10(%ebp),%esi
+     cb8:	8b 55 08             	mov    0x8(%ebp),%edx
+     cbb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+     cbe:	85 f6                	test   %esi,%esi
+     cc0:	74 2e                	je     cf0 <memcmp+0x40>
+     cc2:	01 c6                	add    %eax,%esi
+     cc4:	eb 14                	jmp    cda <memcmp+0x2a>
+     cc6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ccd:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+     cd0:	83 c0 01             	add    $0x1,%eax
+     cd3:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+     cd6:	39 f0                	cmp    %esi,%eax
+     cd8:	74 16                	je     cf0 <memcmp+0x40>
+    if(*s1 != *s2)
+     cda:	0f b6 0a             	movzbl (%edx),%ecx
+     cdd:	0f b6 18             	movzbl (%eax),%ebx
+     ce0:	38 d9                	cmp    %bl,%cl
+     ce2:	74 ec                	je     cd0 <memcmp+0x20>
+      return *s1 - *s2;
+     ce4:	0f b6 c1             	movzbl %cl,%eax
+     ce7:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+     ce9:	5b                   	pop    %ebx
+     cea:	5e                   	pop    %esi
+     ceb:	5d                   	pop    %ebp
+     cec:	c3                   	ret
+     ced:	8d 76 00             	lea    0x0(%esi),%esi
+     cf0:	5b                   	pop    %ebx
+  return 0;
+     cf1:	31 c0                	xor    %eax,%eax
+}
+     cf3:	5e                   	pop    %esi
+     cf4:	5d                   	pop    %ebp
+     cf5:	c3                   	ret
+     cf6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cfd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000d00 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     d00:	55                   	push   %ebp
+     d01:	89 e5                	mov    %esp,%ebp
+     d03:	8b 45 08             	mov    0x8(%ebp),%eax
+     d06:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     d0a:	0f b6 10             	movzbl (%eax),%edx
+     d0d:	84 d2                	test   %dl,%dl
+     d0f:	75 12                	jne    d23 <strchr+0x23>
+     d11:	eb 1d                	jmp    d30 <strchr+0x30>
+     d13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d17:	90                   	nop
+     d18:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     d1c:	83 c0 01             	add    $0x1,%eax
+     d1f:	84 d2                	test   %dl,%dl
+     d21:	74 0d                	je     d30 <strchr+0x30>
+    if(*s == c)
+     d23:	38 d1                	cmp    %dl,%cl
+     d25:	75 f1                	jne    d18 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     d27:	5d                   	pop    %ebp
+     d28:	c3                   	ret
+     d29:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     d30:	31 c0                	xor    %eax,%eax
+}
+     d32:	5d                   	pop    %ebp
+     d33:	c3                   	ret
+     d34:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d3f:	90                   	nop
+
+00000d40 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     d40:	55                   	push   %ebp
+     d41:	89 e5                	mov    %esp,%ebp
+     d43:	57                   	push   %edi
+     d44:	56                   	push   %esi
+int
+read(int fd, void *buf, int n)
+{
+  if(flushhook)
+    flushhook();
+  return _read(fd, buf, n);
+     d45:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     d48:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     d49:	31 db                	xor    %ebx,%ebx
+{
+     d4b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     d4e:	eb 32                	jmp    d82 <gets+0x42>
+  if(flushhook)
+     d50:	a1 a4 32 00 00       	mov    0x32a4,%eax
+     d55:	85 c0                	test   %eax,%eax
+     d57:	74 02                	je     d5b <gets+0x1b>
+    flushhook();
+     d59:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+     d5b:	83 ec 04             	sub    $0x4,%esp
+     d5e:	6a 01                	push   $0x1
+     d60:	56                   	push   %esi
+     d61:	6a 00                	push   $0x0
+     d63:	e8 60 03 00 00       	call   10c8 <_read>
+    if(cc < 1)
+     d68:	83 c4 10             	add    $0x10,%esp
+     d6b:	85 c0                	test   %eax,%eax
+     d6d:	7e 1d                	jle    d8c <gets+0x4c>
+    buf[i++] = c;
+     d6f:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     d73:	8b 55 08             	mov    0x8(%ebp),%edx
+     d76:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     d7a:	3c 0a                	cmp    $0xa,%al
+     d7c:	74 10                	je     d8e <gets+0x4e>
+     d7e:	3c 0d                	cmp    $0xd,%al
+     d80:	74 0c                	je     d8e <gets+0x4e>
+  for(i=0; i+1 < max; ){
+     d82:	89 df                	mov    %ebx,%edi
+     d84:	83 c3 01             	add    $0x1,%ebx
+     d87:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     d8a:	7c c4                	jl     d50 <gets+0x10>
+     d8c:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+     d8e:	8b 45 08             	mov    0x8(%ebp),%eax
+     d91:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+     d95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d98:	5b                   	pop    %ebx
+     d99:	5e                   	pop    %esi
+     d9a:	5f                   	pop    %edi
+     d9b:	5d                   	pop    %ebp
+     d9c:	c3                   	ret
+     d9d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000da0 <stat>:
+{
+     da0:	55                   	push   %ebp
+     da1:	89 e5                	mov    %esp,%ebp
+     da3:	56                   	push   %esi
+     da4:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+     da5:	83 ec 08             	sub    $0x8,%esp
+     da8:	6a 00                	push   $0x0
+     daa:	ff 75 08             	push   0x8(%ebp)
+     dad:	e8 3e 03 00 00       	call   10f0 <open>
+  if(fd < 0)
+     db2:	83 c4 10             	add    $0x10,%esp
+     db5:	85 c0                	test   %eax,%eax
+     db7:	78 37                	js     df0 <stat+0x50>
+  r = fstat(fd, st);
+     db9:	83 ec 08             	sub    $0x8,%esp
+     dbc:	ff 75 0c             	push   0xc(%ebp)
+     dbf:	89 c3                	mov    %eax,%ebx
+     dc1:	50                   	push   %eax
+     dc2:	e8 41 03 00 00       	call   1108 <fstat>
+}
+
+int
+close(int fd)
+{
+  if(flushhook)
+     dc7:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+     dca:	89 c6                	mov    %eax,%esi
+  if(flushhook)
+     dcc:	a1 a4 32 00 00       	mov    0x32a4,%eax
+     dd1:	85 c0                	test   %eax,%eax
+     dd3:	74 02                	je     dd7 <stat+0x37>
+    flushhook();
+     dd5:	ff d0                	call   *%eax
+  return _close(fd);
+     dd7:	83 ec 0c             	sub    $0xc,%esp
+     dda:	53                   	push   %ebx
+     ddb:	e8 f8 02 00 00       	call   10d8 <_close>
+     de0:	83 c4 10             	add    $0x10,%esp
+}
+     de3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     de6:	89 f0                	mov    %esi,%eax
+     de8:	5b                   	pop    %ebx
+     de9:	5e                   	pop    %esi
+     dea:	5d                   	pop    %ebp
+     deb:	c3                   	ret
+     dec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+     df0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     df5:	eb ec                	jmp    de3 <stat+0x43>
+     df7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dfe:	66 90                	xchg   %ax,%ax
+
+00000e00 <atoi>:
+{
+     e00:	55                   	push   %ebp
+     e01:	89 e5                	mov    %esp,%ebp
+     e03:	53                   	push   %ebx
+     e04:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+     e07:	0f be 02             	movsbl (%edx),%eax
+     e0a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     e0d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     e10:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     e15:	77 1e                	ja     e35 <atoi+0x35>
+     e17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e1e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     e20:	83 c2 01             	add    $0x1,%edx
+     e23:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     e26:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     e2a:	0f be 02             	movsbl (%edx),%eax
+     e2d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     e30:	80 fb 09             	cmp    $0x9,%bl
+     e33:	76 eb                	jbe    e20 <atoi+0x20>
+}
+     e35:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     e38:	89 c8                	mov    %ecx,%eax
+     e3a:	c9                   	leave
+     e3b:	c3                   	ret
+     e3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000e40 <memmove>:
+{
+     e40:	55                   	push   %ebp
+     e41:	89 e5                	mov    %esp,%ebp
+     e43:	57                   	push   %edi
+     e44:	56                   	push   %esi
+     e45:	8b 45 10             	mov    0x10(%ebp),%eax
+     e48:	8b 55 08             	mov    0x8(%ebp),%edx
+     e4b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+     e4e:	85 c0                	test   %eax,%eax
+     e50:	7e 13                	jle    e65 <memmove+0x25>
+     e52:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     e54:	89 d7                	mov    %edx,%edi
+     e56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e5d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     e60:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     e61:	39 f8                	cmp    %edi,%eax
+     e63:	75 fb                	jne    e60 <memmove+0x20>
+}
+     e65:	5e                   	pop    %esi
+     e66:	89 d0                	mov    %edx,%eax
+     e68:	5f                   	pop    %edi
+     e69:	5d                   	pop    %ebp
+     e6a:	c3                   	ret
+     e6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e6f:	90                   	nop
+
+00000e70 <fork>:
+  if(flushhook)
+     e70:	a1 a4 32 00 00       	mov    0x32a4,%eax
+     e75:	85 c0                	test   %eax,%eax
+     e77:	74 17                	je     e90 <fork+0x20>
+{
+     e79:	55                   	push   %ebp
+     e7a:	89 e5                	mov    %esp,%ebp
+     e7c:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+     e7f:	ff d0                	call   *%eax
+}
+     e81:	c9                   	leave
+  return _fork();
+     e82:	e9 21 02 00 00       	jmp    10a8 <_fork>
+     e87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e8e:	66 90                	xchg   %ax,%ax
+     e90:	e9 13 02 00 00       	jmp    10a8 <_fork>
+     e95:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000ea0 <exit>:
+{
+     ea0:	55                   	push   %ebp
+     ea1:	89 e5                	mov    %esp,%ebp
+     ea3:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+     ea6:	a1 a4 32 00 00       	mov    0x32a4,%eax
+     eab:	85 c0                	test   %eax,%eax
+     ead:	74 02                	je     eb1 <exit+0x11>
+    flushhook();
+     eaf:	ff d0                	call   *%eax
+  _exit();
+     eb1:	e8 fa 01 00 00       	call   10b0 <_exit>
+     eb6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ebd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ec0 <exec>:
+{
+     ec0:	55                   	push   %ebp
+  if(flushhook)
+     ec1:	a1 a4 32 00 00       	mov    0x32a4,%eax
+{
+     ec6:	89 e5                	mov    %esp,%ebp
+     ec8:	56                   	push   %esi
+     ec9:	53                   	push   %ebx
+     eca:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     ecd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+     ed0:	85 c0                	test   %eax,%eax
+     ed2:	74 02                	je     ed6 <exec+0x16>
+    flushhook();
+     ed4:	ff d0                	call   *%eax
+  return _exec(path, argv);
+     ed6:	89 75 0c             	mov    %esi,0xc(%ebp)
+     ed9:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     edc:	5b                   	pop    %ebx
+     edd:	5e                   	pop    %esi
+     ede:	5d                   	pop    %ebp
+  return _exec(path, argv);
+     edf:	e9 04 02 00 00       	jmp    10e8 <_exec>
+     ee4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     eeb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     eef:	90                   	nop
+
+00000ef0 <read>:
+{
+     ef0:	55                   	push   %ebp
+     ef1:	89 e5                	mov    %esp,%ebp
+     ef3:	57                   	push   %edi
+     ef4:	56                   	push   %esi
+     ef5:	53                   	push   %ebx
+     ef6:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     ef9:	a1 a4 32 00 00       	mov    0x32a4,%eax
+{
+     efe:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     f01:	8b 75 0c             	mov    0xc(%ebp),%esi
+     f04:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     f07:	85 c0                	test   %eax,%eax
+     f09:	74 02                	je     f0d <read+0x1d>
+    flushhook();
+     f0b:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+     f0d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     f10:	89 75 0c             	mov    %esi,0xc(%ebp)
+     f13:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     f16:	83 c4 0c             	add    $0xc,%esp
+     f19:	5b                   	pop    %ebx
+     f1a:	5e                   	pop    %esi
+     f1b:	5f                   	pop    %edi
+     f1c:	5d                   	pop    %ebp
+  return _read(fd, buf, n);
+     f1d:	e9 a6 01 00 00       	jmp    10c8 <_read>
+     f22:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f29:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000f30 <readv>:
+{
+     f30:	55                   	push   %ebp
+     f31:	89 e5                	mov    %esp,%ebp
+     f33:	57                   	push   %edi
+     f34:	56                   	push   %esi
+     f35:	53                   	push   %ebx
+     f36:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     f39:	a1 a4 32 00 00       	mov    0x32a4,%eax
+{
+     f3e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     f41:	8b 75 0c             	mov    0xc(%ebp),%esi
+     f44:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     f47:	85 c0                	test   %eax,%eax
+     f49:	74 02                	je     f4d <readv+0x1d>
+    flushhook();
+     f4b:	ff d0                	call   *%eax
+  return _readv(fd, iov, cnt);
+     f4d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     f50:	89 75 0c             	mov    %esi,0xc(%ebp)
+     f53:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     f56:	83 c4 0c             	add    $0xc,%esp
+     f59:	5b                   	pop    %ebx
+     f5a:	5e                   	pop    %esi
+     f5b:	5f                   	pop    %edi
+     f5c:	5d                   	pop    %ebp
+  return _readv(fd, iov, cnt);
+     f5d:	e9 76 02 00 00       	jmp    11d8 <_readv>
+     f62:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000f70 <write>:
+{
+     f70:	55                   	push   %ebp
+     f71:	89 e5                	mov    %esp,%ebp
+     f73:	57                   	push   %edi
+     f74:	56                   	push   %esi
+     f75:	53                   	push   %ebx
+     f76:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     f79:	a1 a4 32 00 00       	mov    0x32a4,%eax
+{
+     f7e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     f81:	8b 75 0c             	mov    0xc(%ebp),%esi
+     f84:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     f87:	85 c0                	test   %eax,%eax
+     f89:	74 02                	je     f8d <write+0x1d>
+    flushhook();
+     f8b:	ff d0                	call   *%eax
+  return _write(fd, buf, n);
+     f8d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     f90:	89 75 0c             	mov    %esi,0xc(%ebp)
+     f93:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     f96:	83 c4 0c             	add    $0xc,%esp
+     f99:	5b                   	pop    %ebx
+     f9a:	5e                   	pop    %esi
+     f9b:	5f                   	pop    %edi
+     f9c:	5d                   	pop    %ebp
+  return _write(fd, buf, n);
+     f9d:	e9 2e 01 00 00       	jmp    10d0 <_write>
+     fa2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fa9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000fb0 <writev>:
+{
+     fb0:	55                   	push   %ebp
+     fb1:	89 e5                	mov    %esp,%ebp
+     fb3:	57                   	push   %edi
+     fb4:	56                   	push   %esi
+     fb5:	53                   	push   %ebx
+     fb6:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     fb9:	a1 a4 32 00 00       	mov    0x32a4,%eax
+{
+     fbe:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     fc1:	8b 75 0c             	mov    0xc(%ebp),%esi
+     fc4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     fc7:	85 c0                	test   %eax,%eax
+     fc9:	74 02                	je     fcd <writev+0x1d>
+    flushhook();
+     fcb:	ff d0                	call   *%eax
+  return _writev(fd, iov, cnt);
+     fcd:	89 7d 10             	mov    %edi,0x10(%ebp)
+     fd0:	89 75 0c             	mov    %esi,0xc(%ebp)
+     fd3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     fd6:	83 c4 0c             	add    $0xc,%esp
+     fd9:	5b                   	pop    %ebx
+     fda:	5e                   	pop    %esi
+     fdb:	5f                   	pop    %edi
+     fdc:	5d                   	pop    %ebp
+  return _writev(fd, iov, cnt);
+     fdd:	e9 fe 01 00 00       	jmp    11e0 <_writev>
+     fe2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fe9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000ff0 <close>:
+{
+     ff0:	55                   	push   %ebp
+     ff1:	89 e5                	mov    %esp,%ebp
+     ff3:	53                   	push   %ebx
+     ff4:	83 ec 04             	sub    $0x4,%esp
+  if(flushhook)
+     ff7:	a1 a4 32 00 00       	mov    0x32a4,%eax
+{
+     ffc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(flushhook)
+     fff:	85 c0                	test   %eax,%eax
+    1001:	74 02                	je     1005 <close+0x15>
+    flushhook();
+    1003:	ff d0                	call   *%eax
+  return _close(fd);
+    1005:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+    1008:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    100b:	c9                   	leave
+  return _close(fd);
+    100c:	e9 c7 00 00 00       	jmp    10d8 <_close>
+    1011:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1018:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    101f:	90                   	nop
+
+00001020 <umtxinit>:
+// process that finds the mutex held enters the kernel, to sleep
+// in futexwait() until the holder's umtxunlock() wakes it.
+
+void
+umtxinit(struct umutex *m)
+{
+    1020:	55                   	push   %ebp
+    1021:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+    1023:	8b 45 08             	mov    0x8(%ebp),%eax
+    1026:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    102c:	5d                   	pop    %ebp
+    102d:	c3                   	ret
+    102e:	66 90                	xchg   %ax,%ax
+
+00001030 <umtxlock>:
+
+void
+umtxlock(struct umutex *m)
+{
+    1030:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+    1031:	b8 01 00 00 00       	mov    $0x1,%eax
+    1036:	89 e5                	mov    %esp,%ebp
+    1038:	56                   	push   %esi
+    1039:	53                   	push   %ebx
+    103a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    103d:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 1) == 0)
+    1040:	85 c0                	test   %eax,%eax
+    1042:	74 2b                	je     106f <umtxlock+0x3f>
+    1044:	b8 02 00 00 00       	mov    $0x2,%eax
+    1049:	f0 87 03             	lock xchg %eax,(%ebx)
+    return;
+  // Mark the mutex contended, so that its holder
+  // wakes a waiter on release, and wait.
+  while(xchg(&m->state, 2) != 0)
+    104c:	85 c0                	test   %eax,%eax
+    104e:	74 1f                	je     106f <umtxlock+0x3f>
+    1050:	be 02 00 00 00       	mov    $0x2,%esi
+    1055:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwait(&m->state, 2);
+    1058:	83 ec 08             	sub    $0x8,%esp
+    105b:	6a 02                	push   $0x2
+    105d:	53                   	push   %ebx
+    105e:	e8 85 01 00 00       	call   11e8 <futexwait>
+    1063:	89 f0                	mov    %esi,%eax
+    1065:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+    1068:	83 c4 10             	add    $0x10,%esp
+    106b:	85 c0                	test   %eax,%eax
+    106d:	75 e9                	jne    1058 <umtxlock+0x28>
+}
+    106f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1072:	5b                   	pop    %ebx
+    1073:	5e                   	pop    %esi
+    1074:	5d                   	pop    %ebp
+    1075:	c3                   	ret
+    1076:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    107d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001080 <umtxunlock>:
+
+void
+umtxunlock(struct umutex *m)
+{
+    1080:	55                   	push   %ebp
+    1081:	31 c0                	xor    %eax,%eax
+    1083:	89 e5                	mov    %esp,%ebp
+    1085:	83 ec 08             	sub    $0x8,%esp
+    1088:	8b 55 08             	mov    0x8(%ebp),%edx
+    108b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+    108e:	83 f8 02             	cmp    $0x2,%eax
+    1091:	74 05                	je     1098 <umtxunlock+0x18>
+    futexwake(&m->state, 1);
+}
+    1093:	c9                   	leave
+    1094:	c3                   	ret
+    1095:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwake(&m->state, 1);
+    1098:	83 ec 08             	sub    $0x8,%esp
+    109b:	6a 01                	push   $0x1
+    109d:	52                   	push   %edx
+    109e:	e8 4d 01 00 00       	call   11f0 <futexwake>
+    10a3:	83 c4 10             	add    $0x10,%esp
+}
+    10a6:	c9                   	leave
+    10a7:	c3                   	ret
+
+000010a8 <_fork>:
+  _ ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+    10a8:	b8 01 00 00 00       	mov    $0x1,%eax
+    10ad:	cd 40                	int    $0x40
+    10af:	c3                   	ret
+
+000010b0 <_exit>:
+RAWSYSCALL(exit)
+    10b0:	b8 02 00 00 00       	mov    $0x2,%eax
+    10b5:	cd 40                	int    $0x40
+    10b7:	c3                   	ret
+
+000010b8 <wait>:
+SYSCALL(wait)
+    10b8:	b8 03 00 00 00       	mov    $0x3,%eax
+    10bd:	cd 40                	int    $0x40
+    10bf:	c3                   	ret
+
+000010c0 <pipe>:
+SYSCALL(pipe)
+    10c0:	b8 04 00 00 00       	mov    $0x4,%eax
+    10c5:	cd 40                	int    $0x40
+    10c7:	c3                   	ret
+
+000010c8 <_read>:
+RAWSYSCALL(read)
+    10c8:	b8 05 00 00 00       	mov    $0x5,%eax
+    10cd:	cd 40                	int    $0x40
+    10cf:	c3                   	ret
+
+000010d0 <_write>:
+RAWSYSCALL(write)
+    10d0:	b8 10 00 00 00       	mov    $0x10,%eax
+    10d5:	cd 40                	int    $0x40
+    10d7:	c3                   	ret
+
+000010d8 <_close>:
+RAWSYSCALL(close)
+    10d8:	b8 15 00 00 00       	mov    $0x15,%eax
+    10dd:	cd 40                	int    $0x40
+    10df:	c3                   	ret
+
+000010e0 <kill>:
+SYSCALL(kill)
+    10e0:	b8 06 00 00 00       	mov    $0x6,%eax
+    10e5:	cd 40                	int    $0x40
+    10e7:	c3                   	ret
+
+000010e8 <_exec>:
+RAWSYSCALL(exec)
+    10e8:	b8 07 00 00 00       	mov    $0x7,%eax
+    10ed:	cd 40                	int    $0x40
+    10ef:	c3                   	ret
+
+000010f0 <open>:
+SYSCALL(open)
+    10f0:	b8 0f 00 00 00       	mov    $0xf,%eax
+    10f5:	cd 40                	int    $0x40
+    10f7:	c3                   	ret
+
+000010f8 <mknod>:
+SYSCALL(mknod)
+    10f8:	b8 11 00 00 00       	mov    $0x11,%eax
+    10fd:	cd 40                	int    $0x40
+    10ff:	c3                   	ret
+
+00001100 <unlink>:
+SYSCALL(unlink)
+    1100:	b8 12 00 00 00       	mov    $0x12,%eax
+    1105:	cd 40                	int    $0x40
+    1107:	c3                   	ret
+
+00001108 <fstat>:
+SYSCALL(fstat)
+    1108:	b8 08 00 00 00       	mov    $0x8,%eax
+    110d:	cd 40                	int    $0x40
+    110f:	c3                   	ret
+
+00001110 <link>:
+SYSCALL(link)
+    1110:	b8 13 00 00 00       	mov    $0x13,%eax
+    1115:	cd 40                	int    $0x40
+    1117:	c3                   	ret
+
+00001118 <mkdir>:
+SYSCALL(mkdir)
+    1118:	b8 14 00 00 00       	mov    $0x14,%eax
+    111d:	cd 40                	int    $0x40
+    111f:	c3                   	ret
+
+00001120 <chdir>:
+SYSCALL(chdir)
+    1120:	b8 09 00 00 00       	mov    $0x9,%eax
+    1125:	cd 40                	int    $0x40
+    1127:	c3                   	ret
+
+00001128 <dup>:
+SYSCALL(dup)
+    1128:	b8 0a 00 00 00       	mov    $0xa,%eax
+    112d:	cd 40                	int    $0x40
+    112f:	c3                   	ret
+
+00001130 <getpid>:
+SYSCALL(getpid)
+    1130:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1135:	cd 40                	int    $0x40
+    1137:	c3                   	ret
+
+00001138 <sbrk>:
+SYSCALL(sbrk)
+    1138:	b8 0c 00 00 00       	mov    $0xc,%eax
+    113d:	cd 40                	int    $0x40
+    113f:	c3                   	ret
+
+00001140 <sleep>:
+SYSCALL(sleep)
+    1140:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1145:	cd 40                	int    $0x40
+    1147:	c3                   	ret
+
+00001148 <uptime>:
+SYSCALL(uptime)
+    1148:	b8 0e 00 00 00       	mov    $0xe,%eax
+    114d:	cd 40                	int    $0x40
+    114f:	c3                   	ret
+
+00001150 <wolfie>:
+SYSCALL(wolfie)
+    1150:	b8 16 00 00 00       	mov    $0x16,%eax
+    1155:	cd 40                	int    $0x40
+    1157:	c3                   	ret
+
+00001158 <nice>:
+SYSCALL(nice)
+    1158:	b8 17 00 00 00       	mov    $0x17,%eax
+    115d:	cd 40                	int    $0x40
+    115f:	c3                   	ret
+
+00001160 <mtxget>:
+SYSCALL(mtxget)
+    1160:	b8 18 00 00 00       	mov    $0x18,%eax
+    1165:	cd 40                	int    $0x40
+    1167:	c3                   	ret
+
+00001168 <mtxrel>:
+SYSCALL(mtxrel)
+    1168:	b8 19 00 00 00       	mov    $0x19,%eax
+    116d:	cd 40                	int    $0x40
+    116f:	c3                   	ret
+
+00001170 <mtxacq>:
+SYSCALL(mtxacq)
+    1170:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1175:	cd 40                	int    $0x40
+    1177:	c3                   	ret
+
+00001178 <mtxdel>:
+SYSCALL(mtxdel)
+    1178:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    117d:	cd 40                	int    $0x40
+    117f:	c3                   	ret
+
+00001180 <iostat>:
+SYSCALL(iostat)
+    1180:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1185:	cd 40                	int    $0x40
+    1187:	c3                   	ret
+
+00001188 <mmap>:
+SYSCALL(mmap)
+    1188:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    118d:	cd 40                	int    $0x40
+    118f:	c3                   	ret
+
+00001190 <munmap>:
+SYSCALL(munmap)
+    1190:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1195:	cd 40                	int    $0x40
+    1197:	c3                   	ret
+
+00001198 <shmget>:
+SYSCALL(shmget)
+    1198:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    119d:	cd 40                	int    $0x40
+    119f:	c3                   	ret
+
+000011a0 <shmat>:
+SYSCALL(shmat)
+    11a0:	b8 20 00 00 00       	mov    $0x20,%eax
+    11a5:	cd 40                	int    $0x40
+    11a7:	c3                   	ret
+
+000011a8 <shmdt>:
+SYSCALL(shmdt)
+    11a8:	b8 21 00 00 00       	mov    $0x21,%eax
+    11ad:	cd 40                	int    $0x40
+    11af:	c3                   	ret
+
+000011b0 <shmdel>:
+SYSCALL(shmdel)
+    11b0:	b8 22 00 00 00       	mov    $0x22,%eax
+    11b5:	cd 40                	int    $0x40
+    11b7:	c3                   	ret
+
+000011b8 <syscount>:
+SYSCALL(syscount)
+    11b8:	b8 23 00 00 00       	mov    $0x23,%eax
+    11bd:	cd 40                	int    $0x40
+    11bf:	c3                   	ret
+
+000011c0 <splice>:
+SYSCALL(splice)
+    11c0:	b8 24 00 00 00       	mov    $0x24,%eax
+    11c5:	cd 40                	int    $0x40
+    11c7:	c3                   	ret
+
+000011c8 <tee>:
+SYSCALL(tee)
+    11c8:	b8 25 00 00 00       	mov    $0x25,%eax
+    11cd:	cd 40                	int    $0x40
+    11cf:	c3                   	ret
+
+000011d0 <sendfile>:
+SYSCALL(sendfile)
+    11d0:	b8 26 00 00 00       	mov    $0x26,%eax
+    11d5:	cd 40                	int    $0x40
+    11d7:	c3                   	ret
+
+000011d8 <_readv>:
+RAWSYSCALL(readv)
+    11d8:	b8 27 00 00 00       	mov    $0x27,%eax
+    11dd:	cd 40                	int    $0x40
+    11df:	c3                   	ret
+
+000011e0 <_writev>:
+RAWSYSCALL(writev)
+    11e0:	b8 28 00 00 00       	mov    $0x28,%eax
+    11e5:	cd 40                	int    $0x40
+    11e7:	c3                   	ret
+
+000011e8 <futexwait>:
+SYSCALL(futexwait)
+    11e8:	b8 29 00 00 00       	mov    $0x29,%eax
+    11ed:	cd 40                	int    $0x40
+    11ef:	c3                   	ret
+
+000011f0 <futexwake>:
+SYSCALL(futexwake)
+    11f0:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    11f5:	cd 40                	int    $0x40
+    11f7:	c3                   	ret
+
+000011f8 <lockstat>:
+SYSCALL(lockstat)
+    11f8:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    11fd:	cd 40                	int    $0x40
+    11ff:	c3                   	ret
+
+00001200 <clone>:
+SYSCALL(clone)
+    1200:	b8 2c 00 00 00       	mov    $0x2c,%eax
+    1205:	cd 40                	int    $0x40
+    1207:	c3                   	ret
+
+00001208 <join>:
+SYSCALL(join)
+    1208:	b8 2d 00 00 00       	mov    $0x2d,%eax
+    120d:	cd 40                	int    $0x40
+    120f:	c3                   	ret
+
+00001210 <stacklimit>:
+SYSCALL(stacklimit)
+    1210:	b8 2e 00 00 00       	mov    $0x2e,%eax
+    1215:	cd 40                	int    $0x40
+    1217:	c3                   	ret
+    1218:	66 90                	xchg   %ax,%ax
+    121a:	66 90                	xchg   %ax,%ax
+    121c:	66 90                	xchg   %ax,%ax
+    121e:	66 90                	xchg   %ax,%ax
+
+00001220 <flushall>:
+  b->n = 0;
+}
+
+static void
+flushall(void)
+{
+    1220:	55                   	push   %ebp
+    1221:	89 e5                	mov    %esp,%ebp
+    1223:	83 ec 14             	sub    $0x14,%esp
+  umtxlock(&stdoutlock);
+    1226:	68 a8 32 00 00       	push   $0x32a8
+    122b:	e8 00 fe ff ff       	call   1030 <umtxlock>
+  if(b->n > 0)
+    1230:	a1 28 30 00 00       	mov    0x3028,%eax
+    1235:	83 c4 10             	add    $0x10,%esp
+    1238:	85 c0                	test   %eax,%eax
+    123a:	7e 17                	jle    1253 <flushall+0x33>
+    _write(b->fd, b->buf, b->n);
+    123c:	83 ec 04             	sub    $0x4,%esp
+    123f:	50                   	push   %eax
+    1240:	68 2c 30 00 00       	push   $0x302c
+    1245:	ff 35 20 30 00 00    	push   0x3020
+    124b:	e8 80 fe ff ff       	call   10d0 <_write>
+    1250:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+    1253:	c7 05 28 30 00 00 00 	movl   $0x0,0x3028
+    125a:	00 00 00 
+  flush(&stdout);
+  umtxunlock(&stdoutlock);
+    125d:	83 ec 0c             	sub    $0xc,%esp
+    1260:	68 a8 32 00 00       	push   $0x32a8
+    1265:	e8 16 fe ff ff       	call   1080 <umtxunlock>
+}
+    126a:	83 c4 10             	add    $0x10,%esp
+    126d:	c9                   	leave
+    126e:	c3                   	ret
+    126f:	90                   	nop
+
+00001270 <printint>:
+    flush(b);
+}
+
+static void
+printint(struct outbuf *b, int xx, int base, int sgn)
+{
+    1270:	55                   	push   %ebp
+    1271:	89 e5                	mov    %esp,%ebp
+    1273:	57                   	push   %edi
+    1274:	89 cf                	mov    %ecx,%edi
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    1276:	89 d1                	mov    %edx,%ecx
+{
+    1278:	56                   	push   %esi
+    1279:	53                   	push   %ebx
+    127a:	89 c3                	mov    %eax,%ebx
+    127c:	83 ec 2c             	sub    $0x2c,%esp
+  if(sgn && xx < 0){
+    127f:	85 d2                	test   %edx,%edx
+    1281:	0f 89 b9 00 00 00    	jns    1340 <printint+0xd0>
+    1287:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    128b:	0f 84 af 00 00 00    	je     1340 <printint+0xd0>
+    x = -xx;
+    1291:	f7 d9                	neg    %ecx
+    neg = 1;
+    1293:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    1298:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    129b:	31 f6                	xor    %esi,%esi
+    129d:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+    12a0:	89 c8                	mov    %ecx,%eax
+    12a2:	31 d2                	xor    %edx,%edx
+    12a4:	89 f3                	mov    %esi,%ebx
+    12a6:	f7 f7                	div    %edi
+    12a8:	8d 76 01             	lea    0x1(%esi),%esi
+    12ab:	0f b6 92 64 22 00 00 	movzbl 0x2264(%edx),%edx
+    12b2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    12b6:	89 ca                	mov    %ecx,%edx
+    12b8:	89 c1                	mov    %eax,%ecx
+    12ba:	39 fa                	cmp    %edi,%edx
+    12bc:	73 e2                	jae    12a0 <printint+0x30>
+  if(neg)
+    12be:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    12c1:	89 d9                	mov    %ebx,%ecx
+    12c3:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    12c6:	85 c0                	test   %eax,%eax
+    12c8:	74 07                	je     12d1 <printint+0x61>
+    buf[i++] = '-';
+    12ca:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    12cf:	89 f1                	mov    %esi,%ecx
+    12d1:	8d 75 d8             	lea    -0x28(%ebp),%esi
+    12d4:	89 cf                	mov    %ecx,%edi
+    12d6:	01 f7                	add    %esi,%edi
+    12d8:	eb 1a                	jmp    12f4 <printint+0x84>
+    12da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    *b->str++ = c;
+    12e0:	8d 48 01             	lea    0x1(%eax),%ecx
+    12e3:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+    12e9:	88 10                	mov    %dl,(%eax)
+
+  while(--i >= 0)
+    12eb:	8d 47 ff             	lea    -0x1(%edi),%eax
+    12ee:	39 fe                	cmp    %edi,%esi
+    12f0:	74 40                	je     1332 <printint+0xc2>
+    12f2:	89 c7                	mov    %eax,%edi
+  if(b->str){
+    12f4:	8b 83 0c 02 00 00    	mov    0x20c(%ebx),%eax
+    putc(b, buf[i]);
+    12fa:	0f b6 17             	movzbl (%edi),%edx
+  if(b->str){
+    12fd:	85 c0                	test   %eax,%eax
+    12ff:	75 df                	jne    12e0 <printint+0x70>
+  b->buf[b->n++] = c;
+    1301:	8b 4b 08             	mov    0x8(%ebx),%ecx
+    1304:	8d 41 01             	lea    0x1(%ecx),%eax
+    1307:	89 43 08             	mov    %eax,0x8(%ebx)
+    130a:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+    130e:	3d 00 02 00 00       	cmp    $0x200,%eax
+    1313:	74 3b                	je     1350 <printint+0xe0>
+    1315:	80 fa 0a             	cmp    $0xa,%dl
+    1318:	75 d1                	jne    12eb <printint+0x7b>
+    131a:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+    131e:	75 cb                	jne    12eb <printint+0x7b>
+  if(b->n > 0)
+    1320:	85 c0                	test   %eax,%eax
+    1322:	7f 2c                	jg     1350 <printint+0xe0>
+  b->n = 0;
+    1324:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  while(--i >= 0)
+    132b:	8d 47 ff             	lea    -0x1(%edi),%eax
+    132e:	39 fe                	cmp    %edi,%esi
+    1330:	75 c0                	jne    12f2 <printint+0x82>
+}
+    1332:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1335:	5b                   	pop    %ebx
+    1336:	5e                   	pop    %esi
+    1337:	5f                   	pop    %edi
+    1338:	5d                   	pop    %ebp
+    1339:	c3                   	ret
+    133a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  neg = 0;
+    1340:	31 c0                	xor    %eax,%eax
+    1342:	e9 51 ff ff ff       	jmp    1298 <printint+0x28>
+    1347:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    134e:	66 90                	xchg   %ax,%ax
+    _write(b->fd, b->buf, b->n);
+    1350:	83 ec 04             	sub    $0x4,%esp
+    1353:	50                   	push   %eax
+    1354:	8d 43 0c             	lea    0xc(%ebx),%eax
+    1357:	50                   	push   %eax
+    1358:	ff 33                	push   (%ebx)
+    135a:	e8 71 fd ff ff       	call   10d0 <_write>
+    135f:	83 c4 10             	add    $0x10,%esp
+    1362:	eb c0                	jmp    1324 <printint+0xb4>
+    1364:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    136b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    136f:	90                   	nop
+
+00001370 <putc>:
+{
+    1370:	55                   	push   %ebp
+    1371:	89 e5                	mov    %esp,%ebp
+    1373:	53                   	push   %ebx
+    1374:	89 c3                	mov    %eax,%ebx
+    1376:	83 ec 04             	sub    $0x4,%esp
+  if(b->str){
+    1379:	8b 80 0c 02 00 00    	mov    0x20c(%eax),%eax
+    137f:	85 c0                	test   %eax,%eax
+    1381:	74 15                	je     1398 <putc+0x28>
+    *b->str++ = c;
+    1383:	8d 48 01             	lea    0x1(%eax),%ecx
+    1386:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+    138c:	88 10                	mov    %dl,(%eax)
+}
+    138e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1391:	c9                   	leave
+    1392:	c3                   	ret
+    1393:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1397:	90                   	nop
+  b->buf[b->n++] = c;
+    1398:	8b 4b 08             	mov    0x8(%ebx),%ecx
+    139b:	8d 41 01             	lea    0x1(%ecx),%eax
+    139e:	89 43 08             	mov    %eax,0x8(%ebx)
+    13a1:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+    13a5:	3d 00 02 00 00       	cmp    $0x200,%eax
+    13aa:	74 14                	je     13c0 <putc+0x50>
+    13ac:	80 fa 0a             	cmp    $0xa,%dl
+    13af:	75 dd                	jne    138e <putc+0x1e>
+    13b1:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+    13b5:	75 d7                	jne    138e <putc+0x1e>
+  if(b->n > 0)
+    13b7:	85 c0                	test   %eax,%eax
+    13b9:	7e 17                	jle    13d2 <putc+0x62>
+    13bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    13bf:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+    13c0:	83 ec 04             	sub    $0x4,%esp
+    13c3:	50                   	push   %eax
+    13c4:	8d 43 0c             	lea    0xc(%ebx),%eax
+    13c7:	50                   	push   %eax
+    13c8:	ff 33                	push   (%ebx)
+    13ca:	e8 01 fd ff ff       	call   10d0 <_write>
+    13cf:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+    13d2:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+    13d9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    13dc:	c9                   	leave
+    13dd:	c3                   	ret
+    13de:	66 90                	xchg   %ax,%ax
+
+000013e0 <format>:
+
+// Format fmt and the arguments at ap into b.
+// Only understands %d, %x, %p, %s, %c.
+static void
+format(struct outbuf *b, const char *fmt, uint *ap)
+{
+    13e0:	55                   	push   %ebp
+    13e1:	89 e5                	mov    %esp,%ebp
+    13e3:	57                   	push   %edi
+    13e4:	89 c7                	mov    %eax,%edi
+    13e6:	56                   	push   %esi
+    13e7:	53                   	push   %ebx
+    13e8:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+    13eb:	0f b6 02             	movzbl (%edx),%eax
+{
+    13ee:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  for(i = 0; fmt[i]; i++){
+    13f1:	84 c0                	test   %al,%al
+    13f3:	74 5a                	je     144f <format+0x6f>
+    13f5:	8d 5a 01             	lea    0x1(%edx),%ebx
+    13f8:	31 f6                	xor    %esi,%esi
+    13fa:	eb 1c                	jmp    1418 <format+0x38>
+    13fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+    1400:	83 f8 25             	cmp    $0x25,%eax
+    1403:	74 3b                	je     1440 <format+0x60>
+        state = '%';
+      } else {
+        putc(b, c);
+    1405:	89 ca                	mov    %ecx,%edx
+    1407:	89 f8                	mov    %edi,%eax
+    1409:	e8 62 ff ff ff       	call   1370 <putc>
+  for(i = 0; fmt[i]; i++){
+    140e:	0f b6 03             	movzbl (%ebx),%eax
+    1411:	83 c3 01             	add    $0x1,%ebx
+    1414:	84 c0                	test   %al,%al
+    1416:	74 37                	je     144f <format+0x6f>
+    c = fmt[i] & 0xff;
+    1418:	0f be c8             	movsbl %al,%ecx
+    141b:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+    141e:	85 f6                	test   %esi,%esi
+    1420:	74 de                	je     1400 <format+0x20>
+      }
+    } else if(state == '%'){
+    1422:	83 fe 25             	cmp    $0x25,%esi
+    1425:	75 e7                	jne    140e <format+0x2e>
+      if(c == 'd'){
+    1427:	83 f8 25             	cmp    $0x25,%eax
+    142a:	74 46                	je     1472 <format+0x92>
+    142c:	83 e8 63             	sub    $0x63,%eax
+    142f:	83 f8 15             	cmp    $0x15,%eax
+    1432:	77 2c                	ja     1460 <format+0x80>
+    1434:	ff 24 85 0c 22 00 00 	jmp    *0x220c(,%eax,4)
+    143b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    143f:	90                   	nop
+  for(i = 0; fmt[i]; i++){
+    1440:	0f b6 03             	movzbl (%ebx),%eax
+    1443:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+    1446:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+    144b:	84 c0                	test   %al,%al
+    144d:	75 c9                	jne    1418 <format+0x38>
+        putc(b, c);
+      }
+      state = 0;
+    }
+  }
+}
+    144f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1452:	5b                   	pop    %ebx
+    1453:	5e                   	pop    %esi
+    1454:	5f                   	pop    %edi
+    1455:	5d                   	pop    %ebp
+    1456:	c3                   	ret
+    1457:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    145e:	66 90                	xchg   %ax,%ax
+        putc(b, '%');
+    1460:	ba 25 00 00 00       	mov    $0x25,%edx
+    1465:	89 f8                	mov    %edi,%eax
+    1467:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+    146a:	e8 01 ff ff ff       	call   1370 <putc>
+        putc(b, c);
+    146f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    1472:	89 ca                	mov    %ecx,%edx
+    1474:	89 f8                	mov    %edi,%eax
+      state = 0;
+    1476:	31 f6                	xor    %esi,%esi
+        putc(b, c);
+    1478:	e8 f3 fe ff ff       	call   1370 <putc>
+    147d:	eb 8f                	jmp    140e <format+0x2e>
+    147f:	90                   	nop
+        printint(b, *ap, 16, 0);
+    1480:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1483:	83 ec 0c             	sub    $0xc,%esp
+    1486:	b9 10 00 00 00       	mov    $0x10,%ecx
+    148b:	8b 16                	mov    (%esi),%edx
+    148d:	6a 00                	push   $0x0
+        ap++;
+    148f:	83 c6 04             	add    $0x4,%esi
+        printint(b, *ap, 16, 0);
+    1492:	89 f8                	mov    %edi,%eax
+    1494:	e8 d7 fd ff ff       	call   1270 <printint>
+        ap++;
+    1499:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    149c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    149f:	31 f6                	xor    %esi,%esi
+    14a1:	e9 68 ff ff ff       	jmp    140e <format+0x2e>
+    14a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14ad:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    14b0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    14b3:	8b 30                	mov    (%eax),%esi
+        ap++;
+    14b5:	83 c0 04             	add    $0x4,%eax
+    14b8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+    14bb:	85 f6                	test   %esi,%esi
+    14bd:	75 1b                	jne    14da <format+0xfa>
+    14bf:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+    14c4:	be 04 22 00 00       	mov    $0x2204,%esi
+    14c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+          putc(b, *s);
+    14d0:	89 f8                	mov    %edi,%eax
+          s++;
+    14d2:	83 c6 01             	add    $0x1,%esi
+          putc(b, *s);
+    14d5:	e8 96 fe ff ff       	call   1370 <putc>
+        while(*s != 0){
+    14da:	0f be 16             	movsbl (%esi),%edx
+    14dd:	84 d2                	test   %dl,%dl
+    14df:	75 ef                	jne    14d0 <format+0xf0>
+      state = 0;
+    14e1:	31 f6                	xor    %esi,%esi
+    14e3:	e9 26 ff ff ff       	jmp    140e <format+0x2e>
+    14e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14ef:	90                   	nop
+        printint(b, *ap, 10, 1);
+    14f0:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    14f3:	83 ec 0c             	sub    $0xc,%esp
+    14f6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    14fb:	8b 16                	mov    (%esi),%edx
+    14fd:	6a 01                	push   $0x1
+    14ff:	eb 8e                	jmp    148f <format+0xaf>
+    1501:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(b, *ap);
+    1508:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    150b:	89 f8                	mov    %edi,%eax
+    150d:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+    1510:	83 c6 04             	add    $0x4,%esi
+        putc(b, *ap);
+    1513:	e8 58 fe ff ff       	call   1370 <putc>
+        ap++;
+    1518:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      state = 0;
+    151b:	31 f6                	xor    %esi,%esi
+    151d:	e9 ec fe ff ff       	jmp    140e <format+0x2e>
+    1522:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1529:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001530 <fflush>:
+{
+    1530:	55                   	push   %ebp
+    1531:	89 e5                	mov    %esp,%ebp
+    1533:	83 ec 08             	sub    $0x8,%esp
+  if(fd == stdout.fd)
+    1536:	8b 45 08             	mov    0x8(%ebp),%eax
+    1539:	39 05 20 30 00 00    	cmp    %eax,0x3020
+    153f:	74 07                	je     1548 <fflush+0x18>
+}
+    1541:	c9                   	leave
+    1542:	c3                   	ret
+    1543:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1547:	90                   	nop
+  umtxlock(&stdoutlock);
+    1548:	83 ec 0c             	sub    $0xc,%esp
+    154b:	68 a8 32 00 00       	push   $0x32a8
+    1550:	e8 db fa ff ff       	call   1030 <umtxlock>
+  if(b->n > 0)
+    1555:	a1 28 30 00 00       	mov    0x3028,%eax
+    155a:	83 c4 10             	add    $0x10,%esp
+    155d:	85 c0                	test   %eax,%eax
+    155f:	7f 1f                	jg     1580 <fflush+0x50>
+  b->n = 0;
+    1561:	c7 05 28 30 00 00 00 	movl   $0x0,0x3028
+    1568:	00 00 00 
+  umtxunlock(&stdoutlock);
+    156b:	c7 45 08 a8 32 00 00 	movl   $0x32a8,0x8(%ebp)
+}
+    1572:	c9                   	leave
+  umtxunlock(&stdoutlock);
+    1573:	e9 08 fb ff ff       	jmp    1080 <umtxunlock>
+    1578:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    157f:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+    1580:	83 ec 04             	sub    $0x4,%esp
+    1583:	50                   	push   %eax
+    1584:	68 2c 30 00 00       	push   $0x302c
+    1589:	ff 35 20 30 00 00    	push   0x3020
+    158f:	e8 3c fb ff ff       	call   10d0 <_write>
+    1594:	83 c4 10             	add    $0x10,%esp
+    1597:	eb c8                	jmp    1561 <fflush+0x31>
+    1599:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000015a0 <setvbuf>:
+{
+    15a0:	55                   	push   %ebp
+    15a1:	89 e5                	mov    %esp,%ebp
+    15a3:	53                   	push   %ebx
+    15a4:	83 ec 04             	sub    $0x4,%esp
+    15a7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd != stdout.fd)
+    15aa:	8b 45 08             	mov    0x8(%ebp),%eax
+    15ad:	39 05 20 30 00 00    	cmp    %eax,0x3020
+    15b3:	74 0b                	je     15c0 <setvbuf+0x20>
+}
+    15b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    15b8:	c9                   	leave
+    15b9:	c3                   	ret
+    15ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  umtxlock(&stdoutlock);
+    15c0:	83 ec 0c             	sub    $0xc,%esp
+    15c3:	68 a8 32 00 00       	push   $0x32a8
+    15c8:	e8 63 fa ff ff       	call   1030 <umtxlock>
+  if(b->n > 0)
+    15cd:	a1 28 30 00 00       	mov    0x3028,%eax
+    15d2:	83 c4 10             	add    $0x10,%esp
+    15d5:	85 c0                	test   %eax,%eax
+    15d7:	7f 2f                	jg     1608 <setvbuf+0x68>
+  b->n = 0;
+    15d9:	c7 05 28 30 00 00 00 	movl   $0x0,0x3028
+    15e0:	00 00 00 
+  stdout.mode = mode;
+    15e3:	89 1d 24 30 00 00    	mov    %ebx,0x3024
+  flushhook = flushall;
+    15e9:	c7 05 a4 32 00 00 20 	movl   $0x1220,0x32a4
+    15f0:	12 00 00 
+}
+    15f3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&stdoutlock);
+    15f6:	c7 45 08 a8 32 00 00 	movl   $0x32a8,0x8(%ebp)
+}
+    15fd:	c9                   	leave
+  umtxunlock(&stdoutlock);
+    15fe:	e9 7d fa ff ff       	jmp    1080 <umtxunlock>
+    1603:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1607:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+    1608:	83 ec 04             	sub    $0x4,%esp
+    160b:	50                   	push   %eax
+    160c:	68 2c 30 00 00       	push   $0x302c
+    1611:	ff 35 20 30 00 00    	push   0x3020
+    1617:	e8 b4 fa ff ff       	call   10d0 <_write>
+    161c:	83 c4 10             	add    $0x10,%esp
+    161f:	eb b8                	jmp    15d9 <setvbuf+0x39>
+    1621:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1628:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    162f:	90                   	nop
+
+00001630 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s, %c.
+void
+printf(int fd, const char *fmt, ...)
+{
+    1630:	55                   	push   %ebp
+    1631:	89 e5                	mov    %esp,%ebp
+    1633:	53                   	push   %ebx
+    1634:	81 ec 14 02 00 00    	sub    $0x214,%esp
+    163a:	8b 45 08             	mov    0x8(%ebp),%eax
+    local.mode = _IONBF;
+    local.n = 0;
+    local.str = 0;
+    b = &local;
+  }
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+    163d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd == stdout.fd){
+    1640:	39 05 20 30 00 00    	cmp    %eax,0x3020
+    1646:	74 48                	je     1690 <printf+0x60>
+    local.fd = fd;
+    1648:	89 85 e8 fd ff ff    	mov    %eax,-0x218(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+    164e:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    1651:	89 da                	mov    %ebx,%edx
+    1653:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+    local.mode = _IONBF;
+    1659:	c7 85 ec fd ff ff 03 	movl   $0x3,-0x214(%ebp)
+    1660:	00 00 00 
+    local.n = 0;
+    1663:	c7 85 f0 fd ff ff 00 	movl   $0x0,-0x210(%ebp)
+    166a:	00 00 00 
+    local.str = 0;
+    166d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+    1674:	e8 67 fd ff ff       	call   13e0 <format>
+  if(b->mode == _IONBF)
+    1679:	83 bd ec fd ff ff 03 	cmpl   $0x3,-0x214(%ebp)
+    1680:	0f 84 a2 00 00 00    	je     1728 <printf+0xf8>
+    flush(b);
+  if(b == &stdout)
+    umtxunlock(&stdoutlock);
+}
+    1686:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1689:	c9                   	leave
+    168a:	c3                   	ret
+    168b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    168f:	90                   	nop
+    umtxlock(&stdoutlock);
+    1690:	83 ec 0c             	sub    $0xc,%esp
+    1693:	68 a8 32 00 00       	push   $0x32a8
+    1698:	e8 93 f9 ff ff       	call   1030 <umtxlock>
+  if(stdout.mode == 0){
+    169d:	a1 24 30 00 00       	mov    0x3024,%eax
+    16a2:	83 c4 10             	add    $0x10,%esp
+    16a5:	85 c0                	test   %eax,%eax
+    16a7:	74 37                	je     16e0 <printf+0xb0>
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+    16a9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    16ac:	89 da                	mov    %ebx,%edx
+    16ae:	b8 20 30 00 00       	mov    $0x3020,%eax
+    16b3:	e8 28 fd ff ff       	call   13e0 <format>
+  if(b->mode == _IONBF)
+    16b8:	83 3d 24 30 00 00 03 	cmpl   $0x3,0x3024
+    16bf:	0f 84 ab 00 00 00    	je     1770 <printf+0x140>
+    umtxunlock(&stdoutlock);
+    16c5:	83 ec 0c             	sub    $0xc,%esp
+    16c8:	68 a8 32 00 00       	push   $0x32a8
+    16cd:	e8 ae f9 ff ff       	call   1080 <umtxunlock>
+}
+    16d2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    umtxunlock(&stdoutlock);
+    16d5:	83 c4 10             	add    $0x10,%esp
+}
+    16d8:	c9                   	leave
+    16d9:	c3                   	ret
+    16da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+    16e0:	83 ec 08             	sub    $0x8,%esp
+    16e3:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+    16e9:	50                   	push   %eax
+    16ea:	ff 35 20 30 00 00    	push   0x3020
+    16f0:	e8 13 fa ff ff       	call   1108 <fstat>
+    16f5:	83 c4 10             	add    $0x10,%esp
+    16f8:	89 c2                	mov    %eax,%edx
+      stdout.mode = _IOFBF;
+    16fa:	b8 01 00 00 00       	mov    $0x1,%eax
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+    16ff:	85 d2                	test   %edx,%edx
+    1701:	75 10                	jne    1713 <printf+0xe3>
+      stdout.mode = _IOLBF;
+    1703:	31 c0                	xor    %eax,%eax
+    1705:	66 83 bd e8 fd ff ff 	cmpw   $0x3,-0x218(%ebp)
+    170c:	03 
+    170d:	0f 94 c0             	sete   %al
+    1710:	83 c0 01             	add    $0x1,%eax
+    1713:	a3 24 30 00 00       	mov    %eax,0x3024
+    flushhook = flushall;
+    1718:	c7 05 a4 32 00 00 20 	movl   $0x1220,0x32a4
+    171f:	12 00 00 
+    1722:	eb 85                	jmp    16a9 <printf+0x79>
+    1724:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(b->n > 0)
+    1728:	8b 85 f0 fd ff ff    	mov    -0x210(%ebp),%eax
+    172e:	85 c0                	test   %eax,%eax
+    1730:	0f 8e 50 ff ff ff    	jle    1686 <printf+0x56>
+    b = &local;
+    1736:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+    _write(b->fd, b->buf, b->n);
+    173c:	83 ec 04             	sub    $0x4,%esp
+    173f:	50                   	push   %eax
+    1740:	8d 43 0c             	lea    0xc(%ebx),%eax
+    1743:	50                   	push   %eax
+    1744:	ff 33                	push   (%ebx)
+    1746:	e8 85 f9 ff ff       	call   10d0 <_write>
+  b->n = 0;
+    174b:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  if(b == &stdout)
+    1752:	83 c4 10             	add    $0x10,%esp
+    1755:	81 fb 20 30 00 00    	cmp    $0x3020,%ebx
+    175b:	0f 85 25 ff ff ff    	jne    1686 <printf+0x56>
+    1761:	e9 5f ff ff ff       	jmp    16c5 <printf+0x95>
+    1766:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    176d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(b->n > 0)
+    1770:	a1 28 30 00 00       	mov    0x3028,%eax
+    b = getstdout();
+    1775:	bb 20 30 00 00       	mov    $0x3020,%ebx
+  if(b->n > 0)
+    177a:	85 c0                	test   %eax,%eax
+    177c:	7f be                	jg     173c <printf+0x10c>
+  b->n = 0;
+    177e:	c7 05 28 30 00 00 00 	movl   $0x0,0x3028
+    1785:	00 00 00 
+  if(b == &stdout)
+    1788:	e9 38 ff ff ff       	jmp    16c5 <printf+0x95>
+    178d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001790 <sprintf>:
+
+// Print to the given buffer. Only understands %d, %x, %p, %s, %c.
+int
+sprintf(char *str, const char *fmt, ...)
+{
+    1790:	55                   	push   %ebp
+    1791:	89 e5                	mov    %esp,%ebp
+    1793:	53                   	push   %ebx
+  struct outbuf b;
+
+  b.str = str;
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+    1794:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+    179a:	8d 4d 10             	lea    0x10(%ebp),%ecx
+{
+    179d:	81 ec 14 02 00 00    	sub    $0x214,%esp
+    17a3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+    17a6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  b.str = str;
+    17a9:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+    17ac:	e8 2f fc ff ff       	call   13e0 <format>
+  *b.str = '\0';
+    17b1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    17b4:	c6 00 00             	movb   $0x0,(%eax)
+  return b.str - str;
+    17b7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    17ba:	29 d8                	sub    %ebx,%eax
+}
+    17bc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    17bf:	c9                   	leave
+    17c0:	c3                   	ret
+    17c1:	66 90                	xchg   %ax,%ax
+    17c3:	66 90                	xchg   %ax,%ax
+    17c5:	66 90                	xchg   %ax,%ax
+    17c7:	66 90                	xchg   %ax,%ax
+    17c9:	66 90                	xchg   %ax,%ax
+    17cb:	66 90                	xchg   %ax,%ax
+    17cd:	66 90                	xchg   %ax,%ax
+    17cf:	90                   	nop
+
+000017d0 <freeblock>:
+static Header *freep;
+static struct umutex lock;  // threads made by clone() share the heap
+
+static void
+freeblock(void *ap)
+{
+    17d0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+    17d1:	8d 48 f8             	lea    -0x8(%eax),%ecx
+{
+    17d4:	89 e5                	mov    %esp,%ebp
+    17d6:	57                   	push   %edi
+    17d7:	56                   	push   %esi
+    17d8:	53                   	push   %ebx
+    17d9:	89 c3                	mov    %eax,%ebx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    17db:	a1 b0 32 00 00       	mov    0x32b0,%eax
+    17e0:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    17e2:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    17e4:	39 ca                	cmp    %ecx,%edx
+    17e6:	73 30                	jae    1818 <freeblock+0x48>
+    17e8:	39 c1                	cmp    %eax,%ecx
+    17ea:	72 04                	jb     17f0 <freeblock+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    17ec:	39 c2                	cmp    %eax,%edx
+    17ee:	72 f0                	jb     17e0 <freeblock+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    17f0:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    17f3:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    17f6:	39 f8                	cmp    %edi,%eax
+    17f8:	74 26                	je     1820 <freeblock+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    17fa:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    17fd:	8b 42 04             	mov    0x4(%edx),%eax
+    1800:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    1803:	39 f1                	cmp    %esi,%ecx
+    1805:	74 30                	je     1837 <freeblock+0x67>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    1807:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    1809:	5b                   	pop    %ebx
+  freep = p;
+    180a:	89 15 b0 32 00 00    	mov    %edx,0x32b0
+}
+    1810:	5e                   	pop    %esi
+    1811:	5f                   	pop    %edi
+    1812:	5d                   	pop    %ebp
+    1813:	c3                   	ret
+    1814:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1818:	39 c1                	cmp    %eax,%ecx
+    181a:	72 d0                	jb     17ec <freeblock+0x1c>
+    181c:	eb c2                	jmp    17e0 <freeblock+0x10>
+    181e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+    1820:	03 70 04             	add    0x4(%eax),%esi
+    1823:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1826:	8b 02                	mov    (%edx),%eax
+    1828:	8b 00                	mov    (%eax),%eax
+    182a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    182d:	8b 42 04             	mov    0x4(%edx),%eax
+    1830:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    1833:	39 f1                	cmp    %esi,%ecx
+    1835:	75 d0                	jne    1807 <freeblock+0x37>
+    p->s.size += bp->s.size;
+    1837:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    183a:	89 15 b0 32 00 00    	mov    %edx,0x32b0
+    p->s.size += bp->s.size;
+    1840:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1843:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    1846:	89 0a                	mov    %ecx,(%edx)
+}
+    1848:	5b                   	pop    %ebx
+    1849:	5e                   	pop    %esi
+    184a:	5f                   	pop    %edi
+    184b:	5d                   	pop    %ebp
+    184c:	c3                   	ret
+    184d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001850 <free>:
+
+void
+free(void *ap)
+{
+    1850:	55                   	push   %ebp
+    1851:	89 e5                	mov    %esp,%ebp
+    1853:	53                   	push   %ebx
+    1854:	83 ec 10             	sub    $0x10,%esp
+    1857:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  umtxlock(&lock);
+    185a:	68 ac 32 00 00       	push   $0x32ac
+    185f:	e8 cc f7 ff ff       	call   1030 <umtxlock>
+  freeblock(ap);
+    1864:	89 d8                	mov    %ebx,%eax
+    1866:	e8 65 ff ff ff       	call   17d0 <freeblock>
+  umtxunlock(&lock);
+    186b:	c7 45 08 ac 32 00 00 	movl   $0x32ac,0x8(%ebp)
+}
+    1872:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&lock);
+    1875:	83 c4 10             	add    $0x10,%esp
+}
+    1878:	c9                   	leave
+  umtxunlock(&lock);
+    1879:	e9 02 f8 ff ff       	jmp    1080 <umtxunlock>
+    187e:	66 90                	xchg   %ax,%ax
+
+00001880 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    1880:	55                   	push   %ebp
+    1881:	89 e5                	mov    %esp,%ebp
+    1883:	57                   	push   %edi
+    1884:	56                   	push   %esi
+    1885:	53                   	push   %ebx
+    1886:	83 ec 28             	sub    $0x28,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1889:	8b 45 08             	mov    0x8(%ebp),%eax
+  umtxlock(&lock);
+    188c:	68 ac 32 00 00       	push   $0x32ac
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1891:	8d 48 07             	lea    0x7(%eax),%ecx
+    1894:	c1 e9 03             	shr    $0x3,%ecx
+    1897:	8d 71 01             	lea    0x1(%ecx),%esi
+  umtxlock(&lock);
+    189a:	e8 91 f7 ff ff       	call   1030 <umtxlock>
+  if((prevp = freep) == 0){
+    189f:	8b 15 b0 32 00 00    	mov    0x32b0,%edx
+    18a5:	83 c4 10             	add    $0x10,%esp
+    18a8:	85 d2                	test   %edx,%edx
+    18aa:	0f 84 b0 00 00 00    	je     1960 <malloc+0xe0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    18b0:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+    18b2:	8b 47 04             	mov    0x4(%edi),%eax
+    18b5:	39 f0                	cmp    %esi,%eax
+    18b7:	73 6f                	jae    1928 <malloc+0xa8>
+  if(nu < 4096)
+    18b9:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    18be:	39 de                	cmp    %ebx,%esi
+    18c0:	0f 43 de             	cmovae %esi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    18c3:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+    18ca:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    18cd:	eb 0a                	jmp    18d9 <malloc+0x59>
+    18cf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    18d0:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+    18d2:	8b 47 04             	mov    0x4(%edi),%eax
+    18d5:	39 f0                	cmp    %esi,%eax
+    18d7:	73 4f                	jae    1928 <malloc+0xa8>
+      }
+      freep = prevp;
+      umtxunlock(&lock);
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    18d9:	89 fa                	mov    %edi,%edx
+    18db:	39 3d b0 32 00 00    	cmp    %edi,0x32b0
+    18e1:	75 ed                	jne    18d0 <malloc+0x50>
+  p = sbrk(nu * sizeof(Header));
+    18e3:	83 ec 0c             	sub    $0xc,%esp
+    18e6:	ff 75 e4             	push   -0x1c(%ebp)
+    18e9:	e8 4a f8 ff ff       	call   1138 <sbrk>
+  if(p == (char*)-1)
+    18ee:	83 c4 10             	add    $0x10,%esp
+    18f1:	83 f8 ff             	cmp    $0xffffffff,%eax
+    18f4:	74 15                	je     190b <malloc+0x8b>
+  hp->s.size = nu;
+    18f6:	89 58 04             	mov    %ebx,0x4(%eax)
+  freeblock((void*)(hp + 1));
+    18f9:	83 c0 08             	add    $0x8,%eax
+    18fc:	e8 cf fe ff ff       	call   17d0 <freeblock>
+  return freep;
+    1901:	8b 15 b0 32 00 00    	mov    0x32b0,%edx
+      if((p = morecore(nunits)) == 0){
+    1907:	85 d2                	test   %edx,%edx
+    1909:	75 c5                	jne    18d0 <malloc+0x50>
+        umtxunlock(&lock);
+    190b:	83 ec 0c             	sub    $0xc,%esp
+    190e:	68 ac 32 00 00       	push   $0x32ac
+    1913:	e8 68 f7 ff ff       	call   1080 <umtxunlock>
+        return 0;
+    1918:	83 c4 10             	add    $0x10,%esp
+      }
+  }
+}
+    191b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    191e:	31 c0                	xor    %eax,%eax
+}
+    1920:	5b                   	pop    %ebx
+    1921:	5e                   	pop    %esi
+    1922:	5f                   	pop    %edi
+    1923:	5d                   	pop    %ebp
+    1924:	c3                   	ret
+    1925:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1928:	39 c6                	cmp    %eax,%esi
+    192a:	74 64                	je     1990 <malloc+0x110>
+        p->s.size -= nunits;
+    192c:	29 f0                	sub    %esi,%eax
+    192e:	89 47 04             	mov    %eax,0x4(%edi)
+        p += p->s.size;
+    1931:	8d 3c c7             	lea    (%edi,%eax,8),%edi
+        p->s.size = nunits;
+    1934:	89 77 04             	mov    %esi,0x4(%edi)
+      umtxunlock(&lock);
+    1937:	83 ec 0c             	sub    $0xc,%esp
+      freep = prevp;
+    193a:	89 15 b0 32 00 00    	mov    %edx,0x32b0
+      umtxunlock(&lock);
+    1940:	68 ac 32 00 00       	push   $0x32ac
+    1945:	e8 36 f7 ff ff       	call   1080 <umtxunlock>
+      return (void*)(p + 1);
+    194a:	83 c4 10             	add    $0x10,%esp
+}
+    194d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    1950:	8d 47 08             	lea    0x8(%edi),%eax
+}
+    1953:	5b                   	pop    %ebx
+    1954:	5e                   	pop    %esi
+    1955:	5f                   	pop    %edi
+    1956:	5d                   	pop    %ebp
+    1957:	c3                   	ret
+    1958:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    195f:	90                   	nop
+    base.s.ptr = freep = prevp = &base;
+    1960:	c7 05 b0 32 00 00 b4 	movl   $0x32b4,0x32b0
+    1967:	32 00 00 
+    base.s.size = 0;
+    196a:	bf b4 32 00 00       	mov    $0x32b4,%edi
+    base.s.ptr = freep = prevp = &base;
+    196f:	c7 05 b4 32 00 00 b4 	movl   $0x32b4,0x32b4
+    1976:	32 00 00 
+    base.s.size = 0;
+    1979:	c7 05 b8 32 00 00 00 	movl   $0x0,0x32b8
+    1980:	00 00 00 
+    if(p->s.size >= nunits){
+    1983:	e9 31 ff ff ff       	jmp    18b9 <malloc+0x39>
+    1988:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    198f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1990:	8b 07                	mov    (%edi),%eax
+    1992:	89 02                	mov    %eax,(%edx)
+    1994:	eb a1                	jmp    1937 <malloc+0xb7>
+    1996:	66 90                	xchg   %ax,%ax
+    1998:	66 90                	xchg   %ax,%ax
+    199a:	66 90                	xchg   %ax,%ax
+    199c:	66 90                	xchg   %ax,%ax
+    199e:	66 90                	xchg   %ax,%ax
+
+000019a0 <threadstart>:
+
+#define TSTACKSZ 4096
+
+static void
+threadstart(void *fn, void *arg)
+{
+    19a0:	55                   	push   %ebp
+    19a1:	89 e5                	mov    %esp,%ebp
+    19a3:	83 ec 14             	sub    $0x14,%esp
+  ((void (*)(void*))fn)(arg);
+    19a6:	ff 75 0c             	push   0xc(%ebp)
+    19a9:	ff 55 08             	call   *0x8(%ebp)
+  exit();
+    19ac:	e8 ef f4 ff ff       	call   ea0 <exit>
+    19b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    19b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    19bf:	90                   	nop
+
+000019c0 <thread_create>:
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    19c0:	55                   	push   %ebp
+    19c1:	89 e5                	mov    %esp,%ebp
+    19c3:	53                   	push   %ebx
+    19c4:	83 ec 20             	sub    $0x20,%esp
+  char *mem, *stack;
+  int pid;
+
+  if((mem = malloc(2*TSTACKSZ)) == 0)
+    19c7:	68 00 20 00 00       	push   $0x2000
+    19cc:	e8 af fe ff ff       	call   1880 <malloc>
+    19d1:	83 c4 10             	add    $0x10,%esp
+    19d4:	85 c0                	test   %eax,%eax
+    19d6:	74 47                	je     1a1f <thread_create+0x5f>
+    19d8:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)(((uint)mem + TSTACKSZ - 1) & ~(TSTACKSZ - 1));
+    19da:	8d 80 ff 0f 00 00    	lea    0xfff(%eax),%eax
+    19e0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  *(char**)stack = mem;
+    19e5:	89 18                	mov    %ebx,(%eax)
+  if((pid = clone(threadstart, (void*)fn, arg, stack)) < 0)
+    19e7:	50                   	push   %eax
+    19e8:	ff 75 0c             	push   0xc(%ebp)
+    19eb:	ff 75 08             	push   0x8(%ebp)
+    19ee:	68 a0 19 00 00       	push   $0x19a0
+    19f3:	e8 08 f8 ff ff       	call   1200 <clone>
+    19f8:	83 c4 10             	add    $0x10,%esp
+    19fb:	85 c0                	test   %eax,%eax
+    19fd:	78 09                	js     1a08 <thread_create+0x48>
+    free(mem);
+  return pid;
+}
+    19ff:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1a02:	c9                   	leave
+    1a03:	c3                   	ret
+    1a04:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    free(mem);
+    1a08:	83 ec 0c             	sub    $0xc,%esp
+    1a0b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1a0e:	53                   	push   %ebx
+    1a0f:	e8 3c fe ff ff       	call   1850 <free>
+    1a14:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    1a17:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+    1a1a:	83 c4 10             	add    $0x10,%esp
+}
+    1a1d:	c9                   	leave
+    1a1e:	c3                   	ret
+    return -1;
+    1a1f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1a24:	eb d9                	jmp    19ff <thread_create+0x3f>
+    1a26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a2d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001a30 <thread_join>:
+
+int
+thread_join(void)
+{
+    1a30:	55                   	push   %ebp
+    1a31:	89 e5                	mov    %esp,%ebp
+    1a33:	83 ec 34             	sub    $0x34,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    1a36:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    1a39:	50                   	push   %eax
+    1a3a:	e8 c9 f7 ff ff       	call   1208 <join>
+    1a3f:	83 c4 10             	add    $0x10,%esp
+    1a42:	85 c0                	test   %eax,%eax
+    1a44:	79 0a                	jns    1a50 <thread_join+0x20>
+    free(*(char**)stack);
+  return pid;
+}
+    1a46:	c9                   	leave
+    1a47:	c3                   	ret
+    1a48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a4f:	90                   	nop
+    free(*(char**)stack);
+    1a50:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1a53:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1a56:	83 ec 0c             	sub    $0xc,%esp
+    1a59:	ff 32                	push   (%edx)
+    1a5b:	e8 f0 fd ff ff       	call   1850 <free>
+    1a60:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1a63:	83 c4 10             	add    $0x10,%esp
+}
+    1a66:	c9                   	leave
+    1a67:	c3                   	ret
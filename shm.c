@@ -0,0 +1,187 @@
+// Shared memory segments.
+//
+// shmget() finds or creates a segment of zeroed pages by key;
+// shmat() maps all of a segment's pages into the caller's
+// address space as a mapped region (see mmap.c), so that every
+// attached process reads and writes the same physical pages.
+// fork() attaches the child to its parent's segments.
+//
+// A segment counts the regions that map it. shmdel() marks
+// a segment for removal; its pages are freed when the last
+// region mapping it is unmapped, by shmdt(), exit() or exec().
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "proc.h"
+#include "spinlock.h"
+
+struct shm {
+  int used;
+  int key;                 // 0 for a private segment
+  int ref;                 // regions mapping the segment
+  int removed;             // shmdel() called
+  uint npage;
+  char *page[NSHMPAGE];
+};
+
+struct {
+  struct spinlock lock;
+  struct shm shm[NSHM];
+} shmtab;
+
+void
+shminit(void)
+{
+  initlock(&shmtab.lock, "shm");
+}
+
+// Free s's pages once it is removed and unmapped.
+// Caller must hold shmtab.lock.
+static void
+shmfree(struct shm *s)
+{
+  uint i;
+
+  if(s->ref > 0 || !s->removed)
+    return;
+  for(i = 0; i < s->npage; i++)
+    kfree(s->page[i]);
+  memset(s, 0, sizeof(*s));
+}
+
+// Return the id of the segment with the given key, creating
+// it with at least size bytes if there is none. Key 0 always
+// creates a new segment. Returns -1 on failure.
+int
+shmget(int key, uint size)
+{
+  struct shm *s;
+  uint i, npage;
+
+  npage = PGROUNDUP(size) / PGSIZE;
+  if(npage == 0 || npage > NSHMPAGE)
+    return -1;
+
+  acquire(&shmtab.lock);
+  if(key != 0){
+    for(s = shmtab.shm; s < &shmtab.shm[NSHM]; s++){
+      if(s->used && !s->removed && s->key == key){
+        release(&shmtab.lock);
+        return npage <= s->npage ? s - shmtab.shm : -1;
+      }
+    }
+  }
+  for(s = shmtab.shm; s < &shmtab.shm[NSHM]; s++)
+    if(!s->used)
+      break;
+  if(s == &shmtab.shm[NSHM]){
+    release(&shmtab.lock);
+    return -1;
+  }
+  for(i = 0; i < npage; i++){
+    if((s->page[i] = kzalloc()) == 0){
+      s->npage = i;
+      s->removed = 1;
+      shmfree(s);
+      release(&shmtab.lock);
+      return -1;
+    }
+  }
+  s->used = 1;
+  s->key = key;
+  s->npage = npage;
+  release(&shmtab.lock);
+  return s - shmtab.shm;
+}
+
+// Map segment id into the current process.
+// Returns its address, or -1.
+int
+shmat(int id)
+{
+  struct shm *s;
+  int addr;
+
+  if(id < 0 || id >= NSHM)
+    return -1;
+  s = &shmtab.shm[id];
+  acquire(&shmtab.lock);
+  if(!s->used || s->removed){
+    release(&shmtab.lock);
+    return -1;
+  }
+  s->ref++;
+  release(&shmtab.lock);
+
+  if((addr = vmashm(myproc(), s, s->npage*PGSIZE)) < 0)
+    shmput(s);
+  return addr;
+}
+
+// Unmap the segment attached at addr.
+int
+shmdt(uint addr)
+{
+  struct proc *curproc = myproc();
+  struct vma *v;
+
+  if((v = vmalookup(curproc, addr)) == 0 || v->shm == 0 || v->start != addr)
+    return -1;
+  return vmaunmap(curproc, v->start, v->end - v->start);
+}
+
+// Mark segment id for removal. It can no longer be found
+// or attached, and is freed once nothing maps it.
+int
+shmdel(int id)
+{
+  struct shm *s;
+
+  if(id < 0 || id >= NSHM)
+    return -1;
+  s = &shmtab.shm[id];
+  acquire(&shmtab.lock);
+  if(!s->used || s->removed){
+    release(&shmtab.lock);
+    return -1;
+  }
+  s->removed = 1;
+  shmfree(s);
+  release(&shmtab.lock);
+  return 0;
+}
+
+// Return the kernel address of page pgno of s.
+char*
+shmpage(struct shm *s, uint pgno)
+{
+  if(pgno >= s->npage)
+    return 0;
+  return s->page[pgno];
+}
+
+// Count another region mapping s.
+void
+shmdup(struct shm *s)
+{
+  acquire(&shmtab.lock);
+  if(s->ref < 1)
+    panic("shmdup");
+  s->ref++;
+  release(&shmtab.lock);
+}
+
+// Drop a region mapping s.
+void
+shmput(struct shm *s)
+{
+  acquire(&shmtab.lock);
+  if(s->ref < 1)
+    panic("shmput");
+  s->ref--;
+  shmfree(s);
+  release(&shmtab.lock);
+}
@@ -0,0 +1,2864 @@
+
+_shmbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <fill>:
+
+char buf[CHUNK];
+
+void
+fill(char *p, int n, int seq)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	53                   	push   %ebx
+       4:	8b 45 08             	mov    0x8(%ebp),%eax
+       7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  int i;
+
+  for(i = 0; i < n; i++)
+    p[i] = seq + i;
+       a:	0f b6 4d 10          	movzbl 0x10(%ebp),%ecx
+       e:	8d 1c 02             	lea    (%edx,%eax,1),%ebx
+      11:	29 c1                	sub    %eax,%ecx
+  for(i = 0; i < n; i++)
+      13:	85 d2                	test   %edx,%edx
+      15:	7e 16                	jle    2d <fill+0x2d>
+      17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      1e:	66 90                	xchg   %ax,%ax
+    p[i] = seq + i;
+      20:	8d 14 01             	lea    (%ecx,%eax,1),%edx
+  for(i = 0; i < n; i++)
+      23:	83 c0 01             	add    $0x1,%eax
+    p[i] = seq + i;
+      26:	88 50 ff             	mov    %dl,-0x1(%eax)
+  for(i = 0; i < n; i++)
+      29:	39 d8                	cmp    %ebx,%eax
+      2b:	75 f3                	jne    20 <fill+0x20>
+}
+      2d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+      30:	c9                   	leave
+      31:	c3                   	ret
+      32:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000040 <sum>:
+
+uint
+sum(char *p, int n)
+{
+      40:	55                   	push   %ebp
+      41:	89 e5                	mov    %esp,%ebp
+      43:	53                   	push   %ebx
+      44:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int i;
+  uint s;
+
+  s = 0;
+  for(i = 0; i < n; i++)
+      47:	85 db                	test   %ebx,%ebx
+      49:	7e 25                	jle    70 <sum+0x30>
+      4b:	8b 45 08             	mov    0x8(%ebp),%eax
+  s = 0;
+      4e:	31 d2                	xor    %edx,%edx
+      50:	01 c3                	add    %eax,%ebx
+      52:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    s += (uchar)p[i];
+      58:	0f b6 08             	movzbl (%eax),%ecx
+  for(i = 0; i < n; i++)
+      5b:	83 c0 01             	add    $0x1,%eax
+    s += (uchar)p[i];
+      5e:	01 ca                	add    %ecx,%edx
+  for(i = 0; i < n; i++)
+      60:	39 c3                	cmp    %eax,%ebx
+      62:	75 f4                	jne    58 <sum+0x18>
+  return s;
+}
+      64:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+      67:	89 d0                	mov    %edx,%eax
+      69:	c9                   	leave
+      6a:	c3                   	ret
+      6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      6f:	90                   	nop
+  s = 0;
+      70:	31 d2                	xor    %edx,%edx
+}
+      72:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+      75:	c9                   	leave
+      76:	89 d0                	mov    %edx,%eax
+      78:	c3                   	ret
+      79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000080 <expect>:
+
+// Expected checksum of everything the producer sends.
+uint
+expect(void)
+{
+      80:	55                   	push   %ebp
+      81:	89 e5                	mov    %esp,%ebp
+      83:	56                   	push   %esi
+  int seq;
+  uint s;
+
+  s = 0;
+      84:	31 f6                	xor    %esi,%esi
+{
+      86:	53                   	push   %ebx
+  for(seq = 0; seq < TOTAL/CHUNK; seq++){
+      87:	31 db                	xor    %ebx,%ebx
+      89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; i < n; i++)
+      90:	89 d9                	mov    %ebx,%ecx
+      92:	31 c0                	xor    %eax,%eax
+      94:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    p[i] = seq + i;
+      98:	8d 14 01             	lea    (%ecx,%eax,1),%edx
+  for(i = 0; i < n; i++)
+      9b:	83 c0 01             	add    $0x1,%eax
+    p[i] = seq + i;
+      9e:	88 90 1f 22 00 00    	mov    %dl,0x221f(%eax)
+  for(i = 0; i < n; i++)
+      a4:	3d 00 80 00 00       	cmp    $0x8000,%eax
+      a9:	75 ed                	jne    98 <expect+0x18>
+  s = 0;
+      ab:	31 d2                	xor    %edx,%edx
+  for(i = 0; i < n; i++)
+      ad:	31 c0                	xor    %eax,%eax
+      af:	90                   	nop
+    s += (uchar)p[i];
+      b0:	0f b6 88 20 22 00 00 	movzbl 0x2220(%eax),%ecx
+  for(i = 0; i < n; i++)
+      b7:	83 c0 01             	add    $0x1,%eax
+    s += (uchar)p[i];
+      ba:	01 ca                	add    %ecx,%edx
+  for(i = 0; i < n; i++)
+      bc:	3d 00 80 00 00       	cmp    $0x8000,%eax
+      c1:	75 ed                	jne    b0 <expect+0x30>
+  for(seq = 0; seq < TOTAL/CHUNK; seq++){
+      c3:	83 c3 01             	add    $0x1,%ebx
+    fill(buf, CHUNK, seq);
+    s += sum(buf, CHUNK);
+      c6:	01 d6                	add    %edx,%esi
+  for(seq = 0; seq < TOTAL/CHUNK; seq++){
+      c8:	81 fb 80 00 00 00    	cmp    $0x80,%ebx
+      ce:	75 c0                	jne    90 <expect+0x10>
+  }
+  return s;
+}
+      d0:	89 f0                	mov    %esi,%eax
+      d2:	5b                   	pop    %ebx
+      d3:	5e                   	pop    %esi
+      d4:	5d                   	pop    %ebp
+      d5:	c3                   	ret
+      d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000000e0 <bypipe>:
+
+int
+bypipe(void)
+{
+      e0:	55                   	push   %ebp
+      e1:	89 e5                	mov    %esp,%ebp
+      e3:	57                   	push   %edi
+      e4:	56                   	push   %esi
+  int p[2], t0, n, seq, got;
+  uint s;
+
+  if(pipe(p) < 0){
+      e5:	8d 45 e0             	lea    -0x20(%ebp),%eax
+{
+      e8:	53                   	push   %ebx
+      e9:	83 ec 38             	sub    $0x38,%esp
+  if(pipe(p) < 0){
+      ec:	50                   	push   %eax
+      ed:	e8 8e 09 00 00       	call   a80 <pipe>
+      f2:	83 c4 10             	add    $0x10,%esp
+      f5:	85 c0                	test   %eax,%eax
+      f7:	0f 88 8d 01 00 00    	js     28a <bypipe+0x1aa>
+    printf(1, "shmbench: pipe failed\n");
+    exit();
+  }
+  t0 = uptime();
+      fd:	e8 06 0a 00 00       	call   b08 <uptime>
+     102:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  if(fork() == 0){
+     105:	e8 26 07 00 00       	call   830 <fork>
+     10a:	85 c0                	test   %eax,%eax
+     10c:	0f 84 f1 00 00 00    	je     203 <bypipe+0x123>
+        exit();
+      }
+    }
+    exit();
+  }
+  close(p[1]);
+     112:	83 ec 0c             	sub    $0xc,%esp
+     115:	ff 75 e4             	push   -0x1c(%ebp)
+  s = 0;
+     118:	31 db                	xor    %ebx,%ebx
+  for(got = 0; got < TOTAL; got += n){
+     11a:	31 f6                	xor    %esi,%esi
+  close(p[1]);
+     11c:	e8 8f 08 00 00       	call   9b0 <close>
+     121:	83 c4 10             	add    $0x10,%esp
+     124:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if((n = read(p[0], buf, CHUNK)) <= 0){
+     128:	83 ec 04             	sub    $0x4,%esp
+     12b:	68 00 80 00 00       	push   $0x8000
+     130:	68 20 22 00 00       	push   $0x2220
+     135:	ff 75 e0             	push   -0x20(%ebp)
+     138:	e8 73 07 00 00       	call   8b0 <read>
+     13d:	83 c4 10             	add    $0x10,%esp
+     140:	85 c0                	test   %eax,%eax
+     142:	0f 8e 1a 01 00 00    	jle    262 <bypipe+0x182>
+  s = 0;
+     148:	31 c9                	xor    %ecx,%ecx
+  for(i = 0; i < n; i++)
+     14a:	31 d2                	xor    %edx,%edx
+     14c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    s += (uchar)p[i];
+     150:	0f b6 ba 20 22 00 00 	movzbl 0x2220(%edx),%edi
+  for(i = 0; i < n; i++)
+     157:	83 c2 01             	add    $0x1,%edx
+    s += (uchar)p[i];
+     15a:	01 f9                	add    %edi,%ecx
+  for(i = 0; i < n; i++)
+     15c:	39 d0                	cmp    %edx,%eax
+     15e:	75 f0                	jne    150 <bypipe+0x70>
+  for(got = 0; got < TOTAL; got += n){
+     160:	01 c6                	add    %eax,%esi
+      printf(1, "shmbench: pipe read failed\n");
+      exit();
+    }
+    s += sum(buf, n);
+     162:	01 cb                	add    %ecx,%ebx
+  for(got = 0; got < TOTAL; got += n){
+     164:	81 fe ff ff 3f 00    	cmp    $0x3fffff,%esi
+     16a:	7e bc                	jle    128 <bypipe+0x48>
+  }
+  close(p[0]);
+     16c:	83 ec 0c             	sub    $0xc,%esp
+     16f:	ff 75 e0             	push   -0x20(%ebp)
+     172:	e8 39 08 00 00       	call   9b0 <close>
+  wait();
+     177:	e8 fc 08 00 00       	call   a78 <wait>
+  t0 = uptime() - t0;
+     17c:	e8 87 09 00 00       	call   b08 <uptime>
+     181:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+     184:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+     187:	83 c4 10             	add    $0x10,%esp
+  for(seq = 0; seq < TOTAL/CHUNK; seq++){
+     18a:	31 c9                	xor    %ecx,%ecx
+  t0 = uptime() - t0;
+     18c:	29 f0                	sub    %esi,%eax
+  s = 0;
+     18e:	31 f6                	xor    %esi,%esi
+  t0 = uptime() - t0;
+     190:	89 c7                	mov    %eax,%edi
+  for(seq = 0; seq < TOTAL/CHUNK; seq++){
+     192:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; i < n; i++)
+     198:	89 cb                	mov    %ecx,%ebx
+     19a:	31 c0                	xor    %eax,%eax
+     19c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    p[i] = seq + i;
+     1a0:	8d 14 03             	lea    (%ebx,%eax,1),%edx
+  for(i = 0; i < n; i++)
+     1a3:	83 c0 01             	add    $0x1,%eax
+    p[i] = seq + i;
+     1a6:	88 90 1f 22 00 00    	mov    %dl,0x221f(%eax)
+  for(i = 0; i < n; i++)
+     1ac:	3d 00 80 00 00       	cmp    $0x8000,%eax
+     1b1:	75 ed                	jne    1a0 <bypipe+0xc0>
+  s = 0;
+     1b3:	31 d2                	xor    %edx,%edx
+  for(i = 0; i < n; i++)
+     1b5:	31 c0                	xor    %eax,%eax
+     1b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1be:	66 90                	xchg   %ax,%ax
+    s += (uchar)p[i];
+     1c0:	0f b6 98 20 22 00 00 	movzbl 0x2220(%eax),%ebx
+  for(i = 0; i < n; i++)
+     1c7:	83 c0 01             	add    $0x1,%eax
+    s += (uchar)p[i];
+     1ca:	01 da                	add    %ebx,%edx
+  for(i = 0; i < n; i++)
+     1cc:	3d 00 80 00 00       	cmp    $0x8000,%eax
+     1d1:	75 ed                	jne    1c0 <bypipe+0xe0>
+  for(seq = 0; seq < TOTAL/CHUNK; seq++){
+     1d3:	83 c1 01             	add    $0x1,%ecx
+    s += sum(buf, CHUNK);
+     1d6:	01 d6                	add    %edx,%esi
+  for(seq = 0; seq < TOTAL/CHUNK; seq++){
+     1d8:	81 f9 80 00 00 00    	cmp    $0x80,%ecx
+     1de:	75 b8                	jne    198 <bypipe+0xb8>
+  if(s != expect())
+     1e0:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+     1e3:	39 f3                	cmp    %esi,%ebx
+     1e5:	74 12                	je     1f9 <bypipe+0x119>
+    printf(1, "shmbench: pipe data corrupt\n");
+     1e7:	83 ec 08             	sub    $0x8,%esp
+     1ea:	68 78 14 00 00       	push   $0x1478
+     1ef:	6a 01                	push   $0x1
+     1f1:	e8 fa 0d 00 00       	call   ff0 <printf>
+     1f6:	83 c4 10             	add    $0x10,%esp
+  return t0;
+}
+     1f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     1fc:	89 f8                	mov    %edi,%eax
+     1fe:	5b                   	pop    %ebx
+     1ff:	5e                   	pop    %esi
+     200:	5f                   	pop    %edi
+     201:	5d                   	pop    %ebp
+     202:	c3                   	ret
+    close(p[0]);
+     203:	83 ec 0c             	sub    $0xc,%esp
+     206:	ff 75 e0             	push   -0x20(%ebp)
+    for(seq = 0; seq < TOTAL/CHUNK; seq++){
+     209:	31 db                	xor    %ebx,%ebx
+    close(p[0]);
+     20b:	e8 a0 07 00 00       	call   9b0 <close>
+     210:	83 c4 10             	add    $0x10,%esp
+     213:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     217:	90                   	nop
+  for(i = 0; i < n; i++)
+     218:	89 d9                	mov    %ebx,%ecx
+     21a:	31 c0                	xor    %eax,%eax
+     21c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    p[i] = seq + i;
+     220:	8d 14 01             	lea    (%ecx,%eax,1),%edx
+  for(i = 0; i < n; i++)
+     223:	83 c0 01             	add    $0x1,%eax
+    p[i] = seq + i;
+     226:	88 90 1f 22 00 00    	mov    %dl,0x221f(%eax)
+  for(i = 0; i < n; i++)
+     22c:	3d 00 80 00 00       	cmp    $0x8000,%eax
+     231:	75 ed                	jne    220 <bypipe+0x140>
+      if(write(p[1], buf, CHUNK) != CHUNK){
+     233:	83 ec 04             	sub    $0x4,%esp
+     236:	68 00 80 00 00       	push   $0x8000
+     23b:	68 20 22 00 00       	push   $0x2220
+     240:	ff 75 e4             	push   -0x1c(%ebp)
+     243:	e8 e8 06 00 00       	call   930 <write>
+     248:	83 c4 10             	add    $0x10,%esp
+     24b:	3d 00 80 00 00       	cmp    $0x8000,%eax
+     250:	75 24                	jne    276 <bypipe+0x196>
+    for(seq = 0; seq < TOTAL/CHUNK; seq++){
+     252:	83 c3 01             	add    $0x1,%ebx
+     255:	81 fb 80 00 00 00    	cmp    $0x80,%ebx
+     25b:	75 bb                	jne    218 <bypipe+0x138>
+    exit();
+     25d:	e8 fe 05 00 00       	call   860 <exit>
+      printf(1, "shmbench: pipe read failed\n");
+     262:	83 ec 08             	sub    $0x8,%esp
+     265:	68 5c 14 00 00       	push   $0x145c
+     26a:	6a 01                	push   $0x1
+     26c:	e8 7f 0d 00 00       	call   ff0 <printf>
+      exit();
+     271:	e8 ea 05 00 00       	call   860 <exit>
+        printf(1, "shmbench: pipe write failed\n");
+     276:	83 ec 08             	sub    $0x8,%esp
+     279:	68 3f 14 00 00       	push   $0x143f
+     27e:	6a 01                	push   $0x1
+     280:	e8 6b 0d 00 00       	call   ff0 <printf>
+        exit();
+     285:	e8 d6 05 00 00       	call   860 <exit>
+    printf(1, "shmbench: pipe failed\n");
+     28a:	50                   	push   %eax
+     28b:	50                   	push   %eax
+     28c:	68 28 14 00 00       	push   $0x1428
+     291:	6a 01                	push   $0x1
+     293:	e8 58 0d 00 00       	call   ff0 <printf>
+    exit();
+     298:	e8 c3 05 00 00       	call   860 <exit>
+     29d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002a0 <byshm>:
+
+int
+byshm(void)
+{
+     2a0:	55                   	push   %ebp
+     2a1:	89 e5                	mov    %esp,%ebp
+     2a3:	57                   	push   %edi
+     2a4:	56                   	push   %esi
+     2a5:	53                   	push   %ebx
+     2a6:	83 ec 44             	sub    $0x44,%esp
+  int full[2], empty[2], id, t0, seq;
+  char *shm, c;
+  uint s;
+
+  if((id = shmget(0, 2*CHUNK)) < 0 || (shm = shmat(id)) == (char*)-1){
+     2a9:	68 00 00 01 00       	push   $0x10000
+     2ae:	6a 00                	push   $0x0
+     2b0:	e8 a3 08 00 00       	call   b58 <shmget>
+     2b5:	83 c4 10             	add    $0x10,%esp
+     2b8:	85 c0                	test   %eax,%eax
+     2ba:	0f 88 6c 02 00 00    	js     52c <byshm+0x28c>
+     2c0:	83 ec 0c             	sub    $0xc,%esp
+     2c3:	89 c3                	mov    %eax,%ebx
+     2c5:	50                   	push   %eax
+     2c6:	e8 95 08 00 00       	call   b60 <shmat>
+     2cb:	83 c4 10             	add    $0x10,%esp
+     2ce:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     2d1:	83 f8 ff             	cmp    $0xffffffff,%eax
+     2d4:	0f 84 52 02 00 00    	je     52c <byshm+0x28c>
+    printf(1, "shmbench: shmget/shmat failed\n");
+    exit();
+  }
+  // The segment lives until the last process detaches.
+  shmdel(id);
+     2da:	83 ec 0c             	sub    $0xc,%esp
+     2dd:	53                   	push   %ebx
+     2de:	e8 8d 08 00 00       	call   b70 <shmdel>
+  if(pipe(full) < 0 || pipe(empty) < 0){
+     2e3:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     2e6:	89 04 24             	mov    %eax,(%esp)
+     2e9:	e8 92 07 00 00       	call   a80 <pipe>
+     2ee:	83 c4 10             	add    $0x10,%esp
+     2f1:	85 c0                	test   %eax,%eax
+     2f3:	0f 88 20 02 00 00    	js     519 <byshm+0x279>
+     2f9:	83 ec 0c             	sub    $0xc,%esp
+     2fc:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     2ff:	50                   	push   %eax
+     300:	e8 7b 07 00 00       	call   a80 <pipe>
+     305:	83 c4 10             	add    $0x10,%esp
+     308:	85 c0                	test   %eax,%eax
+     30a:	0f 88 09 02 00 00    	js     519 <byshm+0x279>
+    printf(1, "shmbench: pipe failed\n");
+    exit();
+  }
+  c = 0;
+  write(empty[1], &c, 1);
+     310:	83 ec 04             	sub    $0x4,%esp
+     313:	8d 5d d7             	lea    -0x29(%ebp),%ebx
+  c = 0;
+     316:	c6 45 d7 00          	movb   $0x0,-0x29(%ebp)
+  write(empty[1], &c, 1);
+     31a:	6a 01                	push   $0x1
+     31c:	53                   	push   %ebx
+     31d:	ff 75 e4             	push   -0x1c(%ebp)
+     320:	e8 0b 06 00 00       	call   930 <write>
+  write(empty[1], &c, 1);
+     325:	83 c4 0c             	add    $0xc,%esp
+     328:	6a 01                	push   $0x1
+     32a:	53                   	push   %ebx
+     32b:	ff 75 e4             	push   -0x1c(%ebp)
+     32e:	e8 fd 05 00 00       	call   930 <write>
+
+  t0 = uptime();
+     333:	e8 d0 07 00 00       	call   b08 <uptime>
+     338:	89 45 b8             	mov    %eax,-0x48(%ebp)
+  if(fork() == 0){
+     33b:	e8 f0 04 00 00       	call   830 <fork>
+     340:	83 c4 10             	add    $0x10,%esp
+     343:	89 c7                	mov    %eax,%edi
+     345:	85 c0                	test   %eax,%eax
+     347:	75 7f                	jne    3c8 <byshm+0x128>
+     349:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+     34c:	89 c8                	mov    %ecx,%eax
+     34e:	f7 d8                	neg    %eax
+     350:	89 c6                	mov    %eax,%esi
+     352:	b8 80 ff ff ff       	mov    $0xffffff80,%eax
+     357:	29 c8                	sub    %ecx,%eax
+     359:	88 45 c0             	mov    %al,-0x40(%ebp)
+     35c:	8d 81 00 80 00 00    	lea    0x8000(%ecx),%eax
+     362:	89 45 bc             	mov    %eax,-0x44(%ebp)
+     365:	8d 76 00             	lea    0x0(%esi),%esi
+    for(seq = 0; seq < TOTAL/CHUNK; seq++){
+      if(read(empty[0], &c, 1) != 1){
+     368:	83 ec 04             	sub    $0x4,%esp
+     36b:	6a 01                	push   $0x1
+     36d:	53                   	push   %ebx
+     36e:	ff 75 e0             	push   -0x20(%ebp)
+     371:	e8 3a 05 00 00       	call   8b0 <read>
+     376:	83 c4 10             	add    $0x10,%esp
+     379:	83 f8 01             	cmp    $0x1,%eax
+     37c:	0f 85 83 01 00 00    	jne    505 <byshm+0x265>
+        printf(1, "shmbench: empty read failed\n");
+        exit();
+      }
+      fill(shm + (seq % 2) * CHUNK, CHUNK, seq);
+     382:	89 f9                	mov    %edi,%ecx
+     384:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     387:	8b 55 bc             	mov    -0x44(%ebp),%edx
+     38a:	83 e1 01             	and    $0x1,%ecx
+     38d:	c1 e1 0f             	shl    $0xf,%ecx
+  for(i = 0; i < n; i++)
+     390:	01 c8                	add    %ecx,%eax
+     392:	01 d1                	add    %edx,%ecx
+     394:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    p[i] = seq + i;
+     398:	8d 14 06             	lea    (%esi,%eax,1),%edx
+  for(i = 0; i < n; i++)
+     39b:	83 c0 01             	add    $0x1,%eax
+    p[i] = seq + i;
+     39e:	88 50 ff             	mov    %dl,-0x1(%eax)
+  for(i = 0; i < n; i++)
+     3a1:	39 c8                	cmp    %ecx,%eax
+     3a3:	75 f3                	jne    398 <byshm+0xf8>
+      write(full[1], &c, 1);
+     3a5:	83 ec 04             	sub    $0x4,%esp
+    for(seq = 0; seq < TOTAL/CHUNK; seq++){
+     3a8:	83 c6 01             	add    $0x1,%esi
+     3ab:	83 c7 01             	add    $0x1,%edi
+      write(full[1], &c, 1);
+     3ae:	6a 01                	push   $0x1
+     3b0:	53                   	push   %ebx
+     3b1:	ff 75 dc             	push   -0x24(%ebp)
+     3b4:	e8 77 05 00 00       	call   930 <write>
+    for(seq = 0; seq < TOTAL/CHUNK; seq++){
+     3b9:	83 c4 10             	add    $0x10,%esp
+     3bc:	89 f1                	mov    %esi,%ecx
+     3be:	38 4d c0             	cmp    %cl,-0x40(%ebp)
+     3c1:	75 a5                	jne    368 <byshm+0xc8>
+    }
+    exit();
+     3c3:	e8 98 04 00 00       	call   860 <exit>
+     3c8:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  }
+  s = 0;
+     3cb:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+  for(seq = 0; seq < TOTAL/CHUNK; seq++){
+     3d2:	31 f6                	xor    %esi,%esi
+     3d4:	05 00 80 00 00       	add    $0x8000,%eax
+     3d9:	89 45 bc             	mov    %eax,-0x44(%ebp)
+     3dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(read(full[0], &c, 1) != 1){
+     3e0:	83 ec 04             	sub    $0x4,%esp
+     3e3:	6a 01                	push   $0x1
+     3e5:	53                   	push   %ebx
+     3e6:	ff 75 d8             	push   -0x28(%ebp)
+     3e9:	e8 c2 04 00 00       	call   8b0 <read>
+     3ee:	83 c4 10             	add    $0x10,%esp
+     3f1:	83 f8 01             	cmp    $0x1,%eax
+     3f4:	0f 85 f7 00 00 00    	jne    4f1 <byshm+0x251>
+      printf(1, "shmbench: full read failed\n");
+      exit();
+    }
+    s += sum(shm + (seq % 2) * CHUNK, CHUNK);
+     3fa:	89 f7                	mov    %esi,%edi
+     3fc:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     3ff:	8b 4d bc             	mov    -0x44(%ebp),%ecx
+  s = 0;
+     402:	31 d2                	xor    %edx,%edx
+    s += sum(shm + (seq % 2) * CHUNK, CHUNK);
+     404:	83 e7 01             	and    $0x1,%edi
+     407:	c1 e7 0f             	shl    $0xf,%edi
+  for(i = 0; i < n; i++)
+     40a:	01 f8                	add    %edi,%eax
+     40c:	01 cf                	add    %ecx,%edi
+     40e:	66 90                	xchg   %ax,%ax
+    s += (uchar)p[i];
+     410:	0f b6 08             	movzbl (%eax),%ecx
+  for(i = 0; i < n; i++)
+     413:	83 c0 01             	add    $0x1,%eax
+    s += (uchar)p[i];
+     416:	01 ca                	add    %ecx,%edx
+  for(i = 0; i < n; i++)
+     418:	39 f8                	cmp    %edi,%eax
+     41a:	75 f4                	jne    410 <byshm+0x170>
+    write(empty[1], &c, 1);
+     41c:	83 ec 04             	sub    $0x4,%esp
+    s += sum(shm + (seq % 2) * CHUNK, CHUNK);
+     41f:	01 55 c0             	add    %edx,-0x40(%ebp)
+  for(seq = 0; seq < TOTAL/CHUNK; seq++){
+     422:	83 c6 01             	add    $0x1,%esi
+    write(empty[1], &c, 1);
+     425:	6a 01                	push   $0x1
+     427:	53                   	push   %ebx
+     428:	ff 75 e4             	push   -0x1c(%ebp)
+     42b:	e8 00 05 00 00       	call   930 <write>
+  for(seq = 0; seq < TOTAL/CHUNK; seq++){
+     430:	83 c4 10             	add    $0x10,%esp
+     433:	81 fe 80 00 00 00    	cmp    $0x80,%esi
+     439:	75 a5                	jne    3e0 <byshm+0x140>
+  }
+  wait();
+     43b:	e8 38 06 00 00       	call   a78 <wait>
+  t0 = uptime() - t0;
+     440:	e8 c3 06 00 00       	call   b08 <uptime>
+  close(full[0]);
+     445:	83 ec 0c             	sub    $0xc,%esp
+  t0 = uptime() - t0;
+     448:	8b 5d b8             	mov    -0x48(%ebp),%ebx
+  close(full[0]);
+     44b:	ff 75 d8             	push   -0x28(%ebp)
+  t0 = uptime() - t0;
+     44e:	29 d8                	sub    %ebx,%eax
+     450:	89 c6                	mov    %eax,%esi
+  close(full[0]);
+     452:	e8 59 05 00 00       	call   9b0 <close>
+  close(full[1]);
+     457:	58                   	pop    %eax
+     458:	ff 75 dc             	push   -0x24(%ebp)
+     45b:	e8 50 05 00 00       	call   9b0 <close>
+  close(empty[0]);
+     460:	5a                   	pop    %edx
+     461:	ff 75 e0             	push   -0x20(%ebp)
+     464:	e8 47 05 00 00       	call   9b0 <close>
+  close(empty[1]);
+     469:	59                   	pop    %ecx
+     46a:	ff 75 e4             	push   -0x1c(%ebp)
+     46d:	e8 3e 05 00 00       	call   9b0 <close>
+  shmdt(shm);
+     472:	5b                   	pop    %ebx
+     473:	ff 75 c4             	push   -0x3c(%ebp)
+  s = 0;
+     476:	31 db                	xor    %ebx,%ebx
+  shmdt(shm);
+     478:	e8 eb 06 00 00       	call   b68 <shmdt>
+     47d:	83 c4 10             	add    $0x10,%esp
+  for(seq = 0; seq < TOTAL/CHUNK; seq++){
+     480:	31 c9                	xor    %ecx,%ecx
+     482:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; i < n; i++)
+     488:	89 cf                	mov    %ecx,%edi
+     48a:	31 c0                	xor    %eax,%eax
+     48c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    p[i] = seq + i;
+     490:	8d 14 07             	lea    (%edi,%eax,1),%edx
+  for(i = 0; i < n; i++)
+     493:	83 c0 01             	add    $0x1,%eax
+    p[i] = seq + i;
+     496:	88 90 1f 22 00 00    	mov    %dl,0x221f(%eax)
+  for(i = 0; i < n; i++)
+     49c:	3d 00 80 00 00       	cmp    $0x8000,%eax
+     4a1:	75 ed                	jne    490 <byshm+0x1f0>
+  s = 0;
+     4a3:	31 d2                	xor    %edx,%edx
+  for(i = 0; i < n; i++)
+     4a5:	31 c0                	xor    %eax,%eax
+     4a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4ae:	66 90                	xchg   %ax,%ax
+    s += (uchar)p[i];
+     4b0:	0f b6 b8 20 22 00 00 	movzbl 0x2220(%eax),%edi
+  for(i = 0; i < n; i++)
+     4b7:	83 c0 01             	add    $0x1,%eax
+    s += (uchar)p[i];
+     4ba:	01 fa                	add    %edi,%edx
+  for(i = 0; i < n; i++)
+     4bc:	3d 00 80 00 00       	cmp    $0x8000,%eax
+     4c1:	75 ed                	jne    4b0 <byshm+0x210>
+  for(seq = 0; seq < TOTAL/CHUNK; seq++){
+     4c3:	83 c1 01             	add    $0x1,%ecx
+    s += sum(buf, CHUNK);
+     4c6:	01 d3                	add    %edx,%ebx
+  for(seq = 0; seq < TOTAL/CHUNK; seq++){
+     4c8:	81 f9 80 00 00 00    	cmp    $0x80,%ecx
+     4ce:	75 b8                	jne    488 <byshm+0x1e8>
+  if(s != expect())
+     4d0:	39 5d c0             	cmp    %ebx,-0x40(%ebp)
+     4d3:	74 12                	je     4e7 <byshm+0x247>
+    printf(1, "shmbench: shm data corrupt\n");
+     4d5:	83 ec 08             	sub    $0x8,%esp
+     4d8:	68 ce 14 00 00       	push   $0x14ce
+     4dd:	6a 01                	push   $0x1
+     4df:	e8 0c 0b 00 00       	call   ff0 <printf>
+     4e4:	83 c4 10             	add    $0x10,%esp
+  return t0;
+}
+     4e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     4ea:	89 f0                	mov    %esi,%eax
+     4ec:	5b                   	pop    %ebx
+     4ed:	5e                   	pop    %esi
+     4ee:	5f                   	pop    %edi
+     4ef:	5d                   	pop    %ebp
+     4f0:	c3                   	ret
+      printf(1, "shmbench: full read failed\n");
+     4f1:	83 ec 08             	sub    $0x8,%esp
+     4f4:	68 b2 14 00 00       	push   $0x14b2
+     4f9:	6a 01                	push   $0x1
+     4fb:	e8 f0 0a 00 00       	call   ff0 <printf>
+      exit();
+     500:	e8 5b 03 00 00       	call   860 <exit>
+        printf(1, "shmbench: empty read failed\n");
+     505:	83 ec 08             	sub    $0x8,%esp
+     508:	68 95 14 00 00       	push   $0x1495
+     50d:	6a 01                	push   $0x1
+     50f:	e8 dc 0a 00 00       	call   ff0 <printf>
+        exit();
+     514:	e8 47 03 00 00       	call   860 <exit>
+    printf(1, "shmbench: pipe failed\n");
+     519:	56                   	push   %esi
+     51a:	56                   	push   %esi
+     51b:	68 28 14 00 00       	push   $0x1428
+     520:	6a 01                	push   $0x1
+     522:	e8 c9 0a 00 00       	call   ff0 <printf>
+    exit();
+     527:	e8 34 03 00 00       	call   860 <exit>
+    printf(1, "shmbench: shmget/shmat failed\n");
+     52c:	57                   	push   %edi
+     52d:	57                   	push   %edi
+     52e:	68 ec 14 00 00       	push   $0x14ec
+     533:	6a 01                	push   $0x1
+     535:	e8 b6 0a 00 00       	call   ff0 <printf>
+    exit();
+     53a:	e8 21 03 00 00       	call   860 <exit>
+     53f:	90                   	nop
+
+00000540 <main>:
+
+int
+main(int argc, char *argv[])
+{
+     540:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     544:	83 e4 f0             	and    $0xfffffff0,%esp
+     547:	ff 71 fc             	push   -0x4(%ecx)
+     54a:	55                   	push   %ebp
+     54b:	89 e5                	mov    %esp,%ebp
+     54d:	56                   	push   %esi
+     54e:	53                   	push   %ebx
+     54f:	51                   	push   %ecx
+     550:	83 ec 0c             	sub    $0xc,%esp
+  int tp, ts;
+
+  tp = bypipe();
+     553:	e8 88 fb ff ff       	call   e0 <bypipe>
+     558:	89 c6                	mov    %eax,%esi
+  ts = byshm();
+     55a:	e8 41 fd ff ff       	call   2a0 <byshm>
+  printf(1, "shmbench: %d KB through a pipe: %d ticks\n", TOTAL/1024, tp);
+     55f:	56                   	push   %esi
+     560:	68 00 10 00 00       	push   $0x1000
+  ts = byshm();
+     565:	89 c3                	mov    %eax,%ebx
+  printf(1, "shmbench: %d KB through a pipe: %d ticks\n", TOTAL/1024, tp);
+     567:	68 0c 15 00 00       	push   $0x150c
+     56c:	6a 01                	push   $0x1
+     56e:	e8 7d 0a 00 00       	call   ff0 <printf>
+  printf(1, "shmbench: %d KB through shared memory: %d ticks\n", TOTAL/1024, ts);
+     573:	53                   	push   %ebx
+     574:	68 00 10 00 00       	push   $0x1000
+     579:	68 38 15 00 00       	push   $0x1538
+     57e:	6a 01                	push   $0x1
+     580:	e8 6b 0a 00 00       	call   ff0 <printf>
+  exit();
+     585:	83 c4 20             	add    $0x20,%esp
+     588:	e8 d3 02 00 00       	call   860 <exit>
+     58d:	66 90                	xchg   %ax,%ax
+     58f:	90                   	nop
+
+00000590 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     590:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     591:	31 c0                	xor    %eax,%eax
+{
+     593:	89 e5                	mov    %esp,%ebp
+     595:	53                   	push   %ebx
+     596:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     599:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     59c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     5a0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     5a4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     5a7:	83 c0 01             	add    $0x1,%eax
+     5aa:	84 d2                	test   %dl,%dl
+     5ac:	75 f2                	jne    5a0 <strcpy+0x10>
+    ;
+  return os;
+}
+     5ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     5b1:	89 c8                	mov    %ecx,%eax
+     5b3:	c9                   	leave
+     5b4:	c3                   	ret
+     5b5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005c0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     5c0:	55                   	push   %ebp
+     5c1:	89 e5                	mov    %esp,%ebp
+     5c3:	53                   	push   %ebx
+     5c4:	8b 55 08             	mov    0x8(%ebp),%edx
+     5c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     5ca:	0f b6 02             	movzbl (%edx),%eax
+     5cd:	84 c0                	test   %al,%al
+     5cf:	75 17                	jne    5e8 <strcmp+0x28>
+     5d1:	eb 3a                	jmp    60d <strcmp+0x4d>
+     5d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     5d7:	90                   	nop
+     5d8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     5dc:	83 c2 01             	add    $0x1,%edx
+     5df:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     5e2:	84 c0                	test   %al,%al
+     5e4:	74 1a                	je     600 <strcmp+0x40>
+    p++, q++;
+     5e6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     5e8:	0f b6 19             	movzbl (%ecx),%ebx
+     5eb:	38 c3                	cmp    %al,%bl
+     5ed:	74 e9                	je     5d8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     5ef:	29 d8                	sub    %ebx,%eax
+}
+     5f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     5f4:	c9                   	leave
+     5f5:	c3                   	ret
+     5f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5fd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     600:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     604:	31 c0                	xor    %eax,%eax
+     606:	29 d8                	sub    %ebx,%eax
+}
+     608:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     60b:	c9                   	leave
+     60c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     60d:	0f b6 19             	movzbl (%ecx),%ebx
+     610:	31 c0                	xor    %eax,%eax
+     612:	eb db                	jmp    5ef <strcmp+0x2f>
+     614:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     61b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     61f:	90                   	nop
+
+00000620 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     620:	55                   	push   %ebp
+     621:	89 e5                	mov    %esp,%ebp
+     623:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     626:	80 3a 00             	cmpb   $0x0,(%edx)
+     629:	74 15                	je     640 <strlen+0x20>
+     62b:	31 c0                	xor    %eax,%eax
+     62d:	8d 76 00             	lea    0x0(%esi),%esi
+     630:	83 c0 01             	add    $0x1,%eax
+     633:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     637:	89 c1                	mov    %eax,%ecx
+     639:	75 f5                	jne    630 <strlen+0x10>
+    ;
+  return n;
+}
+     63b:	89 c8                	mov    %ecx,%eax
+     63d:	5d                   	pop    %ebp
+     63e:	c3                   	ret
+     63f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     640:	31 c9                	xor    %ecx,%ecx
+}
+     642:	5d                   	pop    %ebp
+     643:	89 c8                	mov    %ecx,%eax
+     645:	c3                   	ret
+     646:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     64d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000650 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     650:	55                   	push   %ebp
+     651:	89 e5                	mov    %esp,%ebp
+     653:	57                   	push   %edi
+     654:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     657:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     65a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     65d:	89 d7                	mov    %edx,%edi
+     65f:	fc                   	cld
+     660:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     662:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     665:	89 d0                	mov    %edx,%eax
+     667:	c9                   	leave
+     668:	c3                   	ret
+     669:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000670 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     670:	55                   	push   %ebp
+     671:	89 e5                	mov    %esp,%ebp
+     673:	56                   	push   %esi
+     674:	53                   	push   %ebx
+     675:	8b 75 10             	mov    0x10(%ebp),%esi
+     678:	8b 55 08             	mov    0x8(%ebp),%edx
+     67b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+     67e:	85 f6                	test   %esi,%esi
+     680:	74 2e                	je     6b0 <memcmp+0x40>
+     682:	01 c6                	add    %eax,%esi
+     684:	eb 14                	jmp    69a <memcmp+0x2a>
+     686:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     68d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+     690:	83 c0 01             	add    $0x1,%eax
+     693:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+     696:	39 f0                	cmp    %esi,%eax
+     698:	74 16                	je     6b0 <memcmp+0x40>
+    if(*s1 != *s2)
+     69a:	0f b6 0a             	movzbl (%edx),%ecx
+     69d:	0f b6 18             	movzbl (%eax),%ebx
+     6a0:	38 d9                	cmp    %bl,%cl
+     6a2:	74 ec                	je     690 <memcmp+0x20>
+      return *s1 - *s2;
+     6a4:	0f b6 c1             	movzbl %cl,%eax
+     6a7:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+     6a9:	5b                   	pop    %ebx
+     6aa:	5e                   	pop    %esi
+     6ab:	5d                   	pop    %ebp
+     6ac:	c3                   	ret
+     6ad:	8d 76 00             	lea    0x0(%esi),%esi
+     6b0:	5b                   	pop    %ebx
+  return 0;
+     6b1:	31 c0                	xor    %eax,%eax
+}
+     6b3:	5e                   	pop    %esi
+     6b4:	5d                   	pop    %ebp
+     6b5:	c3                   	ret
+     6b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000006c0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     6c0:	55                   	push   %ebp
+     6c1:	89 e5                	mov    %esp,%ebp
+     6c3:	8b 45 08             	mov    0x8(%ebp),%eax
+     6c6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     6ca:	0f b6 10             	movzbl (%eax),%edx
+     6cd:	84 d2                	test   %dl,%dl
+     6cf:	75 12                	jne    6e3 <strchr+0x23>
+     6d1:	eb 1d                	jmp    6f0 <strchr+0x30>
+     6d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     6d7:	90                   	nop
+     6d8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     6dc:	83 c0 01             	add    $0x1,%eax
+     6df:	84 d2                	test   %dl,%dl
+     6e1:	74 0d                	je     6f0 <strchr+0x30>
+    if(*s == c)
+     6e3:	38 d1                	cmp    %dl,%cl
+     6e5:	75 f1                	jne    6d8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     6e7:	5d                   	pop    %ebp
+     6e8:	c3                   	ret
+     6e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     6f0:	31 c0                	xor    %eax,%eax
+}
+     6f2:	5d                   	pop    %ebp
+     6f3:	c3                   	ret
+     6f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     6ff:	90                   	nop
+
+00000700 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     700:	55                   	push   %ebp
+     701:	89 e5                	mov    %esp,%ebp
+     703:	57                   	push   %edi
+     704:	56                   	push   %esi
+int
+read(int fd, void *buf, int n)
+{
+  if(flushhook)
+    flushhook();
+  return _read(fd, buf, n);
+     705:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     708:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     709:	31 db                	xor    %ebx,%ebx
+{
+     70b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     70e:	eb 32                	jmp    742 <gets+0x42>
+  if(flushhook)
+     710:	a1 20 a2 00 00       	mov    0xa220,%eax
+     715:	85 c0                	test   %eax,%eax
+     717:	74 02                	je     71b <gets+0x1b>
+    flushhook();
+     719:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+     71b:	83 ec 04             	sub    $0x4,%esp
+     71e:	6a 01                	push   $0x1
+     720:	56                   	push   %esi
+     721:	6a 00                	push   $0x0
+     723:	e8 60 03 00 00       	call   a88 <_read>
+    if(cc < 1)
+     728:	83 c4 10             	add    $0x10,%esp
+     72b:	85 c0                	test   %eax,%eax
+     72d:	7e 1d                	jle    74c <gets+0x4c>
+    buf[i++] = c;
+     72f:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     733:	8b 55 08             	mov    0x8(%ebp),%edx
+     736:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     73a:	3c 0a                	cmp    $0xa,%al
+     73c:	74 10                	je     74e <gets+0x4e>
+     73e:	3c 0d                	cmp    $0xd,%al
+     740:	74 0c                	je     74e <gets+0x4e>
+  for(i=0; i+1 < max; ){
+     742:	89 df                	mov    %ebx,%edi
+     744:	83 c3 01             	add    $0x1,%ebx
+     747:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     74a:	7c c4                	jl     710 <gets+0x10>
+     74c:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+     74e:	8b 45 08             	mov    0x8(%ebp),%eax
+     751:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+     755:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     758:	5b                   	pop    %ebx
+     759:	5e                   	pop    %esi
+     75a:	5f                   	pop    %edi
+     75b:	5d                   	pop    %ebp
+     75c:	c3                   	ret
+     75d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000760 <stat>:
+{
+     760:	55                   	push   %ebp
+     761:	89 e5                	mov    %esp,%ebp
+     763:	56                   	push   %esi
+     764:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+     765:	83 ec 08             	sub    $0x8,%esp
+     768:	6a 00                	push   $0x0
+     76a:	ff 75 08             	push   0x8(%ebp)
+     76d:	e8 3e 03 00 00       	call   ab0 <open>
+  if(fd < 0)
+     772:	83 c4 10             	add    $0x10,%esp
+     775:	85 c0                	test   %eax,%eax
+     777:	78 37                	js     7b0 <stat+0x50>
+  r = fstat(fd, st);
+     779:	83 ec 08             	sub    $0x8,%esp
+     77c:	ff 75 0c             	push   0xc(%ebp)
+     77f:	89 c3                	mov    %eax,%ebx
+     781:	50                   	push   %eax
+     782:	e8 41 03 00 00       	call   ac8 <fstat>
+}
+
+int
+close(int fd)
+{
+  if(flushhook)
+     787:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+     78a:	89 c6                	mov    %eax,%esi
+  if(flushhook)
+     78c:	a1 20 a2 00 00       	mov    0xa220,%eax
+     791:	85 c0                	test   %eax,%eax
+     793:	74 02                	je     797 <stat+0x37>
+    flushhook();
+     795:	ff d0                	call   *%eax
+  return _close(fd);
+     797:	83 ec 0c             	sub    $0xc,%esp
+     79a:	53                   	push   %ebx
+     79b:	e8 f8 02 00 00       	call   a98 <_close>
+     7a0:	83 c4 10             	add    $0x10,%esp
+}
+     7a3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     7a6:	89 f0                	mov    %esi,%eax
+     7a8:	5b                   	pop    %ebx
+     7a9:	5e                   	pop    %esi
+     7aa:	5d                   	pop    %ebp
+     7ab:	c3                   	ret
+     7ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+     7b0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     7b5:	eb ec                	jmp    7a3 <stat+0x43>
+     7b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7be:	66 90                	xchg   %ax,%ax
+
+000007c0 <atoi>:
+{
+     7c0:	55                   	push   %ebp
+     7c1:	89 e5                	mov    %esp,%ebp
+     7c3:	53                   	push   %ebx
+     7c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+     7c7:	0f be 02             	movsbl (%edx),%eax
+     7ca:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     7cd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     7d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     7d5:	77 1e                	ja     7f5 <atoi+0x35>
+     7d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7de:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     7e0:	83 c2 01             	add    $0x1,%edx
+     7e3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     7e6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     7ea:	0f be 02             	movsbl (%edx),%eax
+     7ed:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     7f0:	80 fb 09             	cmp    $0x9,%bl
+     7f3:	76 eb                	jbe    7e0 <atoi+0x20>
+}
+     7f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     7f8:	89 c8                	mov    %ecx,%eax
+     7fa:	c9                   	leave
+     7fb:	c3                   	ret
+     7fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000800 <memmove>:
+{
+     800:	55                   	push   %ebp
+     801:	89 e5                	mov    %esp,%ebp
+     803:	57                   	push   %edi
+     804:	56                   	push   %esi
+     805:	8b 45 10             	mov    0x10(%ebp),%eax
+     808:	8b 55 08             	mov    0x8(%ebp),%edx
+     80b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+     80e:	85 c0                	test   %eax,%eax
+     810:	7e 13                	jle    825 <memmove+0x25>
+     812:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     814:	89 d7                	mov    %edx,%edi
+     816:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     81d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     820:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     821:	39 f8                	cmp    %edi,%eax
+     823:	75 fb                	jne    820 <memmove+0x20>
+}
+     825:	5e                   	pop    %esi
+     826:	89 d0                	mov    %edx,%eax
+     828:	5f                   	pop    %edi
+     829:	5d                   	pop    %ebp
+     82a:	c3                   	ret
+     82b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     82f:	90                   	nop
+
+00000830 <fork>:
+  if(flushhook)
+     830:	a1 20 a2 00 00       	mov    0xa220,%eax
+     835:	85 c0                	test   %eax,%eax
+     837:	74 17                	je     850 <fork+0x20>
+{
+     839:	55                   	push   %ebp
+     83a:	89 e5                	mov    %esp,%ebp
+     83c:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+     83f:	ff d0                	call   *%eax
+}
+     841:	c9                   	leave
+  return _fork();
+     842:	e9 21 02 00 00       	jmp    a68 <_fork>
+     847:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     84e:	66 90                	xchg   %ax,%ax
+     850:	e9 13 02 00 00       	jmp    a68 <_fork>
+     855:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     85c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000860 <exit>:
+{
+     860:	55                   	push   %ebp
+     861:	89 e5                	mov    %esp,%ebp
+     863:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+     866:	a1 20 a2 00 00       	mov    0xa220,%eax
+     86b:	85 c0                	test   %eax,%eax
+     86d:	74 02                	je     871 <exit+0x11>
+    flushhook();
+     86f:	ff d0                	call   *%eax
+  _exit();
+     871:	e8 fa 01 00 00       	call   a70 <_exit>
+     876:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     87d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000880 <exec>:
+{
+     880:	55                   	push   %ebp
+  if(flushhook)
+     881:	a1 20 a2 00 00       	mov    0xa220,%eax
+{
+     886:	89 e5                	mov    %esp,%ebp
+     888:	56                   	push   %esi
+     889:	53                   	push   %ebx
+     88a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     88d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+     890:	85 c0                	test   %eax,%eax
+     892:	74 02                	je     896 <exec+0x16>
+    flushhook();
+     894:	ff d0                	call   *%eax
+  return _exec(path, argv);
+     896:	89 75 0c             	mov    %esi,0xc(%ebp)
+     899:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     89c:	5b                   	pop    %ebx
+     89d:	5e                   	pop    %esi
+     89e:	5d                   	pop    %ebp
+  return _exec(path, argv);
+     89f:	e9 04 02 00 00       	jmp    aa8 <_exec>
+     8a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     8af:	90                   	nop
+
+000008b0 <read>:
+{
+     8b0:	55                   	push   %ebp
+     8b1:	89 e5                	mov    %esp,%ebp
+     8b3:	57                   	push   %edi
+     8b4:	56                   	push   %esi
+     8b5:	53                   	push   %ebx
+     8b6:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     8b9:	a1 20 a2 00 00       	mov    0xa220,%eax
+{
+     8be:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     8c1:	8b 75 0c             	mov    0xc(%ebp),%esi
+     8c4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     8c7:	85 c0                	test   %eax,%eax
+     8c9:	74 02                	je     8cd <read+0x1d>
+    flushhook();
+     8cb:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+     8cd:	89 7d 10             	mov    %edi,0x10(%ebp)
+     8d0:	89 75 0c             	mov    %esi,0xc(%ebp)
+     8d3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     8d6:	83 c4 0c             	add    $0xc,%esp
+     8d9:	5b                   	pop    %ebx
+     8da:	5e                   	pop    %esi
+     8db:	5f                   	pop    %edi
+     8dc:	5d                   	pop    %ebp
+  return _read(fd, buf, n);
+     8dd:	e9 a6 01 00 00       	jmp    a88 <_read>
+     8e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000008f0 <readv>:
+{
+     8f0:	55                   	push   %ebp
+     8f1:	89 e5                	mov    %esp,%ebp
+     8f3:	57                   	push   %edi
+     8f4:	56                   	push   %esi
+     8f5:	53                   	push   %ebx
+     8f6:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     8f9:	a1 20 a2 00 00       	mov    0xa220,%eax
+{
+     8fe:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     901:	8b 75 0c             	mov    0xc(%ebp),%esi
+     904:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     907:	85 c0                	test   %eax,%eax
+     909:	74 02                	je     90d <readv+0x1d>
+    flushhook();
+     90b:	ff d0                	call   *%eax
+  return _readv(fd, iov, cnt);
+     90d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     910:	89 75 0c             	mov    %esi,0xc(%ebp)
+     913:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     916:	83 c4 0c             	add    $0xc,%esp
+     919:	5b                   	pop    %ebx
+     91a:	5e                   	pop    %esi
+     91b:	5f                   	pop    %edi
+     91c:	5d                   	pop    %ebp
+  return _readv(fd, iov, cnt);
+     91d:	e9 76 02 00 00       	jmp    b98 <_readv>
+     922:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     929:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000930 <write>:
+{
+     930:	55                   	push   %ebp
+     931:	89 e5                	mov    %esp,%ebp
+     933:	57                   	push   %edi
+     934:	56                   	push   %esi
+     935:	53                   	push   %ebx
+     936:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     939:	a1 20 a2 00 00       	mov    0xa220,%eax
+{
+     93e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     941:	8b 75 0c             	mov    0xc(%ebp),%esi
+     944:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     947:	85 c0                	test   %eax,%eax
+     949:	74 02                	je     94d <write+0x1d>
+    flushhook();
+     94b:	ff d0                	call   *%eax
+  return _write(fd, buf, n);
+     94d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     950:	89 75 0c             	mov    %esi,0xc(%ebp)
+     953:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     956:	83 c4 0c             	add    $0xc,%esp
+     959:	5b                   	pop    %ebx
+     95a:	5e                   	pop    %esi
+     95b:	5f                   	pop    %edi
+     95c:	5d                   	pop    %ebp
+  return _write(fd, buf, n);
+     95d:	e9 2e 01 00 00       	jmp    a90 <_write>
+     962:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     969:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000970 <writev>:
+{
+     970:	55                   	push   %ebp
+     971:	89 e5                	mov    %esp,%ebp
+     973:	57                   	push   %edi
+     974:	56                   	push   %esi
+     975:	53                   	push   %ebx
+     976:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     979:	a1 20 a2 00 00       	mov    0xa220,%eax
+{
+     97e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     981:	8b 75 0c             	mov    0xc(%ebp),%esi
+     984:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     987:	85 c0                	test   %eax,%eax
+     989:	74 02                	je     98d <writev+0x1d>
+    flushhook();
+     98b:	ff d0                	call   *%eax
+  return _writev(fd, iov, cnt);
+     98d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     990:	89 75 0c             	mov    %esi,0xc(%ebp)
+     993:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     996:	83 c4 0c             	add    $0xc,%esp
+     999:	5b                   	pop    %ebx
+     99a:	5e                   	pop    %esi
+     99b:	5f                   	pop    %edi
+     99c:	5d                   	pop    %ebp
+  return _writev(fd, iov, cnt);
+     99d:	e9 fe 01 00 00       	jmp    ba0 <_writev>
+     9a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000009b0 <close>:
+{
+     9b0:	55                   	push   %ebp
+     9b1:	89 e5                	mov    %esp,%ebp
+     9b3:	53                   	push   %ebx
+     9b4:	83 ec 04             	sub    $0x4,%esp
+  if(flushhook)
+     9b7:	a1 20 a2 00 00       	mov    0xa220,%eax
+{
+     9bc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(flushhook)
+     9bf:	85 c0                	test   %eax,%eax
+     9c1:	74 02                	je     9c5 <close+0x15>
+    flushhook();
+     9c3:	ff d0                	call   *%eax
+  return _close(fd);
+     9c5:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     9c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     9cb:	c9                   	leave
+  return _close(fd);
+     9cc:	e9 c7 00 00 00       	jmp    a98 <_close>
+     9d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9df:	90                   	nop
+
+000009e0 <umtxinit>:
+// process that finds the mutex held enters the kernel, to sleep
+// in futexwait() until the holder's umtxunlock() wakes it.
+
+void
+umtxinit(struct umutex *m)
+{
+     9e0:	55                   	push   %ebp
+     9e1:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+     9e3:	8b 45 08             	mov    0x8(%ebp),%eax
+     9e6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     9ec:	5d                   	pop    %ebp
+     9ed:	c3                   	ret
+     9ee:	66 90                	xchg   %ax,%ax
+
+000009f0 <umtxlock>:
+
+void
+umtxlock(struct umutex *m)
+{
+     9f0:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+     9f1:	b8 01 00 00 00       	mov    $0x1,%eax
+     9f6:	89 e5                	mov    %esp,%ebp
+     9f8:	56                   	push   %esi
+     9f9:	53                   	push   %ebx
+     9fa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     9fd:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 1) == 0)
+     a00:	85 c0                	test   %eax,%eax
+     a02:	74 2b                	je     a2f <umtxlock+0x3f>
+     a04:	b8 02 00 00 00       	mov    $0x2,%eax
+     a09:	f0 87 03             	lock xchg %eax,(%ebx)
+    return;
+  // Mark the mutex contended, so that its holder
+  // wakes a waiter on release, and wait.
+  while(xchg(&m->state, 2) != 0)
+     a0c:	85 c0                	test   %eax,%eax
+     a0e:	74 1f                	je     a2f <umtxlock+0x3f>
+     a10:	be 02 00 00 00       	mov    $0x2,%esi
+     a15:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwait(&m->state, 2);
+     a18:	83 ec 08             	sub    $0x8,%esp
+     a1b:	6a 02                	push   $0x2
+     a1d:	53                   	push   %ebx
+     a1e:	e8 85 01 00 00       	call   ba8 <futexwait>
+     a23:	89 f0                	mov    %esi,%eax
+     a25:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+     a28:	83 c4 10             	add    $0x10,%esp
+     a2b:	85 c0                	test   %eax,%eax
+     a2d:	75 e9                	jne    a18 <umtxlock+0x28>
+}
+     a2f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     a32:	5b                   	pop    %ebx
+     a33:	5e                   	pop    %esi
+     a34:	5d                   	pop    %ebp
+     a35:	c3                   	ret
+     a36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a3d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a40 <umtxunlock>:
+
+void
+umtxunlock(struct umutex *m)
+{
+     a40:	55                   	push   %ebp
+     a41:	31 c0                	xor    %eax,%eax
+     a43:	89 e5                	mov    %esp,%ebp
+     a45:	83 ec 08             	sub    $0x8,%esp
+     a48:	8b 55 08             	mov    0x8(%ebp),%edx
+     a4b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+     a4e:	83 f8 02             	cmp    $0x2,%eax
+     a51:	74 05                	je     a58 <umtxunlock+0x18>
+    futexwake(&m->state, 1);
+}
+     a53:	c9                   	leave
+     a54:	c3                   	ret
+     a55:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwake(&m->state, 1);
+     a58:	83 ec 08             	sub    $0x8,%esp
+     a5b:	6a 01                	push   $0x1
+     a5d:	52                   	push   %edx
+     a5e:	e8 4d 01 00 00       	call   bb0 <futexwake>
+     a63:	83 c4 10             	add    $0x10,%esp
+}
+     a66:	c9                   	leave
+     a67:	c3                   	ret
+
+00000a68 <_fork>:
+  _ ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+     a68:	b8 01 00 00 00       	mov    $0x1,%eax
+     a6d:	cd 40                	int    $0x40
+     a6f:	c3                   	ret
+
+00000a70 <_exit>:
+RAWSYSCALL(exit)
+     a70:	b8 02 00 00 00       	mov    $0x2,%eax
+     a75:	cd 40                	int    $0x40
+     a77:	c3                   	ret
+
+00000a78 <wait>:
+SYSCALL(wait)
+     a78:	b8 03 00 00 00       	mov    $0x3,%eax
+     a7d:	cd 40                	int    $0x40
+     a7f:	c3                   	ret
+
+00000a80 <pipe>:
+SYSCALL(pipe)
+     a80:	b8 04 00 00 00       	mov    $0x4,%eax
+     a85:	cd 40                	int    $0x40
+     a87:	c3                   	ret
+
+00000a88 <_read>:
+RAWSYSCALL(read)
+     a88:	b8 05 00 00 00       	mov    $0x5,%eax
+     a8d:	cd 40                	int    $0x40
+     a8f:	c3                   	ret
+
+00000a90 <_write>:
+RAWSYSCALL(write)
+     a90:	b8 10 00 00 00       	mov    $0x10,%eax
+     a95:	cd 40                	int    $0x40
+     a97:	c3                   	ret
+
+00000a98 <_close>:
+RAWSYSCALL(close)
+     a98:	b8 15 00 00 00       	mov    $0x15,%eax
+     a9d:	cd 40                	int    $0x40
+     a9f:	c3                   	ret
+
+00000aa0 <kill>:
+SYSCALL(kill)
+     aa0:	b8 06 00 00 00       	mov    $0x6,%eax
+     aa5:	cd 40                	int    $0x40
+     aa7:	c3                   	ret
+
+00000aa8 <_exec>:
+RAWSYSCALL(exec)
+     aa8:	b8 07 00 00 00       	mov    $0x7,%eax
+     aad:	cd 40                	int    $0x40
+     aaf:	c3                   	ret
+
+00000ab0 <open>:
+SYSCALL(open)
+     ab0:	b8 0f 00 00 00       	mov    $0xf,%eax
+     ab5:	cd 40                	int    $0x40
+     ab7:	c3                   	ret
+
+00000ab8 <mknod>:
+SYSCALL(mknod)
+     ab8:	b8 11 00 00 00       	mov    $0x11,%eax
+     abd:	cd 40                	int    $0x40
+     abf:	c3                   	ret
+
+00000ac0 <unlink>:
+SYSCALL(unlink)
+     ac0:	b8 12 00 00 00       	mov    $0x12,%eax
+     ac5:	cd 40                	int    $0x40
+     ac7:	c3                   	ret
+
+00000ac8 <fstat>:
+SYSCALL(fstat)
+     ac8:	b8 08 00 00 00       	mov    $0x8,%eax
+     acd:	cd 40                	int    $0x40
+     acf:	c3                   	ret
+
+00000ad0 <link>:
+SYSCALL(link)
+     ad0:	b8 13 00 00 00       	mov    $0x13,%eax
+     ad5:	cd 40                	int    $0x40
+     ad7:	c3                   	ret
+
+00000ad8 <mkdir>:
+SYSCALL(mkdir)
+     ad8:	b8 14 00 00 00       	mov    $0x14,%eax
+     add:	cd 40                	int    $0x40
+     adf:	c3                   	ret
+
+00000ae0 <chdir>:
+SYSCALL(chdir)
+     ae0:	b8 09 00 00 00       	mov    $0x9,%eax
+     ae5:	cd 40                	int    $0x40
+     ae7:	c3                   	ret
+
+00000ae8 <dup>:
+SYSCALL(dup)
+     ae8:	b8 0a 00 00 00       	mov    $0xa,%eax
+     aed:	cd 40                	int    $0x40
+     aef:	c3                   	ret
+
+00000af0 <getpid>:
+SYSCALL(getpid)
+     af0:	b8 0b 00 00 00       	mov    $0xb,%eax
+     af5:	cd 40                	int    $0x40
+     af7:	c3                   	ret
+
+00000af8 <sbrk>:
+SYSCALL(sbrk)
+     af8:	b8 0c 00 00 00       	mov    $0xc,%eax
+     afd:	cd 40                	int    $0x40
+     aff:	c3                   	ret
+
+00000b00 <sleep>:
+SYSCALL(sleep)
+     b00:	b8 0d 00 00 00       	mov    $0xd,%eax
+     b05:	cd 40                	int    $0x40
+     b07:	c3                   	ret
+
+00000b08 <uptime>:
+SYSCALL(uptime)
+     b08:	b8 0e 00 00 00       	mov    $0xe,%eax
+     b0d:	cd 40                	int    $0x40
+     b0f:	c3                   	ret
+
+00000b10 <wolfie>:
+SYSCALL(wolfie)
+     b10:	b8 16 00 00 00       	mov    $0x16,%eax
+     b15:	cd 40                	int    $0x40
+     b17:	c3                   	ret
+
+00000b18 <nice>:
+SYSCALL(nice)
+     b18:	b8 17 00 00 00       	mov    $0x17,%eax
+     b1d:	cd 40                	int    $0x40
+     b1f:	c3                   	ret
+
+00000b20 <mtxget>:
+SYSCALL(mtxget)
+     b20:	b8 18 00 00 00       	mov    $0x18,%eax
+     b25:	cd 40                	int    $0x40
+     b27:	c3                   	ret
+
+00000b28 <mtxrel>:
+SYSCALL(mtxrel)
+     b28:	b8 19 00 00 00       	mov    $0x19,%eax
+     b2d:	cd 40                	int    $0x40
+     b2f:	c3                   	ret
+
+00000b30 <mtxacq>:
+SYSCALL(mtxacq)
+     b30:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     b35:	cd 40                	int    $0x40
+     b37:	c3                   	ret
+
+00000b38 <mtxdel>:
+SYSCALL(mtxdel)
+     b38:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     b3d:	cd 40                	int    $0x40
+     b3f:	c3                   	ret
+
+00000b40 <iostat>:
+SYSCALL(iostat)
+     b40:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     b45:	cd 40                	int    $0x40
+     b47:	c3                   	ret
+
+00000b48 <mmap>:
+SYSCALL(mmap)
+     b48:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     b4d:	cd 40                	int    $0x40
+     b4f:	c3                   	ret
+
+00000b50 <munmap>:
+SYSCALL(munmap)
+     b50:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     b55:	cd 40                	int    $0x40
+     b57:	c3                   	ret
+
+00000b58 <shmget>:
+SYSCALL(shmget)
+     b58:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     b5d:	cd 40                	int    $0x40
+     b5f:	c3                   	ret
+
+00000b60 <shmat>:
+SYSCALL(shmat)
+     b60:	b8 20 00 00 00       	mov    $0x20,%eax
+     b65:	cd 40                	int    $0x40
+     b67:	c3                   	ret
+
+00000b68 <shmdt>:
+SYSCALL(shmdt)
+     b68:	b8 21 00 00 00       	mov    $0x21,%eax
+     b6d:	cd 40                	int    $0x40
+     b6f:	c3                   	ret
+
+00000b70 <shmdel>:
+SYSCALL(shmdel)
+     b70:	b8 22 00 00 00       	mov    $0x22,%eax
+     b75:	cd 40                	int    $0x40
+     b77:	c3                   	ret
+
+00000b78 <syscount>:
+SYSCALL(syscount)
+     b78:	b8 23 00 00 00       	mov    $0x23,%eax
+     b7d:	cd 40                	int    $0x40
+     b7f:	c3                   	ret
+
+00000b80 <splice>:
+SYSCALL(splice)
+     b80:	b8 24 00 00 00       	mov    $0x24,%eax
+     b85:	cd 40                	int    $0x40
+     b87:	c3                   	ret
+
+00000b88 <tee>:
+SYSCALL(tee)
+     b88:	b8 25 00 00 00       	mov    $0x25,%eax
+     b8d:	cd 40                	int    $0x40
+     b8f:	c3                   	ret
+
+00000b90 <sendfile>:
+SYSCALL(sendfile)
+     b90:	b8 26 00 00 00       	mov    $0x26,%eax
+     b95:	cd 40                	int    $0x40
+     b97:	c3                   	ret
+
+00000b98 <_readv>:
+RAWSYSCALL(readv)
+     b98:	b8 27 00 00 00       	mov    $0x27,%eax
+     b9d:	cd 40                	int    $0x40
+     b9f:	c3                   	ret
+
+00000ba0 <_writev>:
+RAWSYSCALL(writev)
+     ba0:	b8 28 00 00 00       	mov    $0x28,%eax
+     ba5:	cd 40                	int    $0x40
+     ba7:	c3                   	ret
+
+00000ba8 <futexwait>:
+SYSCALL(futexwait)
+     ba8:	b8 29 00 00 00       	mov    $0x29,%eax
+     bad:	cd 40                	int    $0x40
+     baf:	c3                   	ret
+
+00000bb0 <futexwake>:
+SYSCALL(futexwake)
+     bb0:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     bb5:	cd 40                	int    $0x40
+     bb7:	c3                   	ret
+
+00000bb8 <lockstat>:
+SYSCALL(lockstat)
+     bb8:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     bbd:	cd 40                	int    $0x40
+     bbf:	c3                   	ret
+
+00000bc0 <clone>:
+SYSCALL(clone)
+     bc0:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     bc5:	cd 40                	int    $0x40
+     bc7:	c3                   	ret
+
+00000bc8 <join>:
+SYSCALL(join)
+     bc8:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     bcd:	cd 40                	int    $0x40
+     bcf:	c3                   	ret
+
+00000bd0 <stacklimit>:
+SYSCALL(stacklimit)
+     bd0:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     bd5:	cd 40                	int    $0x40
+     bd7:	c3                   	ret
+     bd8:	66 90                	xchg   %ax,%ax
+     bda:	66 90                	xchg   %ax,%ax
+     bdc:	66 90                	xchg   %ax,%ax
+     bde:	66 90                	xchg   %ax,%ax
+
+00000be0 <flushall>:
+  b->n = 0;
+}
+
+static void
+flushall(void)
+{
+     be0:	55                   	push   %ebp
+     be1:	89 e5                	mov    %esp,%ebp
+     be3:	83 ec 14             	sub    $0x14,%esp
+  umtxlock(&stdoutlock);
+     be6:	68 24 a2 00 00       	push   $0xa224
+     beb:	e8 00 fe ff ff       	call   9f0 <umtxlock>
+  if(b->n > 0)
+     bf0:	a1 08 20 00 00       	mov    0x2008,%eax
+     bf5:	83 c4 10             	add    $0x10,%esp
+     bf8:	85 c0                	test   %eax,%eax
+     bfa:	7e 17                	jle    c13 <flushall+0x33>
+    _write(b->fd, b->buf, b->n);
+     bfc:	83 ec 04             	sub    $0x4,%esp
+     bff:	50                   	push   %eax
+     c00:	68 0c 20 00 00       	push   $0x200c
+     c05:	ff 35 00 20 00 00    	push   0x2000
+     c0b:	e8 80 fe ff ff       	call   a90 <_write>
+     c10:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     c13:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     c1a:	00 00 00 
+  flush(&stdout);
+  umtxunlock(&stdoutlock);
+     c1d:	83 ec 0c             	sub    $0xc,%esp
+     c20:	68 24 a2 00 00       	push   $0xa224
+     c25:	e8 16 fe ff ff       	call   a40 <umtxunlock>
+}
+     c2a:	83 c4 10             	add    $0x10,%esp
+     c2d:	c9                   	leave
+     c2e:	c3                   	ret
+     c2f:	90                   	nop
+
+00000c30 <printint>:
+    flush(b);
+}
+
+static void
+printint(struct outbuf *b, int xx, int base, int sgn)
+{
+     c30:	55                   	push   %ebp
+     c31:	89 e5                	mov    %esp,%ebp
+     c33:	57                   	push   %edi
+     c34:	89 cf                	mov    %ecx,%edi
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     c36:	89 d1                	mov    %edx,%ecx
+{
+     c38:	56                   	push   %esi
+     c39:	53                   	push   %ebx
+     c3a:	89 c3                	mov    %eax,%ebx
+     c3c:	83 ec 2c             	sub    $0x2c,%esp
+  if(sgn && xx < 0){
+     c3f:	85 d2                	test   %edx,%edx
+     c41:	0f 89 b9 00 00 00    	jns    d00 <printint+0xd0>
+     c47:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     c4b:	0f 84 af 00 00 00    	je     d00 <printint+0xd0>
+    x = -xx;
+     c51:	f7 d9                	neg    %ecx
+    neg = 1;
+     c53:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     c58:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     c5b:	31 f6                	xor    %esi,%esi
+     c5d:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     c60:	89 c8                	mov    %ecx,%eax
+     c62:	31 d2                	xor    %edx,%edx
+     c64:	89 f3                	mov    %esi,%ebx
+     c66:	f7 f7                	div    %edi
+     c68:	8d 76 01             	lea    0x1(%esi),%esi
+     c6b:	0f b6 92 50 1a 00 00 	movzbl 0x1a50(%edx),%edx
+     c72:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     c76:	89 ca                	mov    %ecx,%edx
+     c78:	89 c1                	mov    %eax,%ecx
+     c7a:	39 fa                	cmp    %edi,%edx
+     c7c:	73 e2                	jae    c60 <printint+0x30>
+  if(neg)
+     c7e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     c81:	89 d9                	mov    %ebx,%ecx
+     c83:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     c86:	85 c0                	test   %eax,%eax
+     c88:	74 07                	je     c91 <printint+0x61>
+    buf[i++] = '-';
+     c8a:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     c8f:	89 f1                	mov    %esi,%ecx
+     c91:	8d 75 d8             	lea    -0x28(%ebp),%esi
+     c94:	89 cf                	mov    %ecx,%edi
+     c96:	01 f7                	add    %esi,%edi
+     c98:	eb 1a                	jmp    cb4 <printint+0x84>
+     c9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    *b->str++ = c;
+     ca0:	8d 48 01             	lea    0x1(%eax),%ecx
+     ca3:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+     ca9:	88 10                	mov    %dl,(%eax)
+
+  while(--i >= 0)
+     cab:	8d 47 ff             	lea    -0x1(%edi),%eax
+     cae:	39 fe                	cmp    %edi,%esi
+     cb0:	74 40                	je     cf2 <printint+0xc2>
+     cb2:	89 c7                	mov    %eax,%edi
+  if(b->str){
+     cb4:	8b 83 0c 02 00 00    	mov    0x20c(%ebx),%eax
+    putc(b, buf[i]);
+     cba:	0f b6 17             	movzbl (%edi),%edx
+  if(b->str){
+     cbd:	85 c0                	test   %eax,%eax
+     cbf:	75 df                	jne    ca0 <printint+0x70>
+  b->buf[b->n++] = c;
+     cc1:	8b 4b 08             	mov    0x8(%ebx),%ecx
+     cc4:	8d 41 01             	lea    0x1(%ecx),%eax
+     cc7:	89 43 08             	mov    %eax,0x8(%ebx)
+     cca:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+     cce:	3d 00 02 00 00       	cmp    $0x200,%eax
+     cd3:	74 3b                	je     d10 <printint+0xe0>
+     cd5:	80 fa 0a             	cmp    $0xa,%dl
+     cd8:	75 d1                	jne    cab <printint+0x7b>
+     cda:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+     cde:	75 cb                	jne    cab <printint+0x7b>
+  if(b->n > 0)
+     ce0:	85 c0                	test   %eax,%eax
+     ce2:	7f 2c                	jg     d10 <printint+0xe0>
+  b->n = 0;
+     ce4:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  while(--i >= 0)
+     ceb:	8d 47 ff             	lea    -0x1(%edi),%eax
+     cee:	39 fe                	cmp    %edi,%esi
+     cf0:	75 c0                	jne    cb2 <printint+0x82>
+}
+     cf2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     cf5:	5b                   	pop    %ebx
+     cf6:	5e                   	pop    %esi
+     cf7:	5f                   	pop    %edi
+     cf8:	5d                   	pop    %ebp
+     cf9:	c3                   	ret
+     cfa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  neg = 0;
+     d00:	31 c0                	xor    %eax,%eax
+     d02:	e9 51 ff ff ff       	jmp    c58 <printint+0x28>
+     d07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d0e:	66 90                	xchg   %ax,%ax
+    _write(b->fd, b->buf, b->n);
+     d10:	83 ec 04             	sub    $0x4,%esp
+     d13:	50                   	push   %eax
+     d14:	8d 43 0c             	lea    0xc(%ebx),%eax
+     d17:	50                   	push   %eax
+     d18:	ff 33                	push   (%ebx)
+     d1a:	e8 71 fd ff ff       	call   a90 <_write>
+     d1f:	83 c4 10             	add    $0x10,%esp
+     d22:	eb c0                	jmp    ce4 <printint+0xb4>
+     d24:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d2f:	90                   	nop
+
+00000d30 <putc>:
+{
+     d30:	55                   	push   %ebp
+     d31:	89 e5                	mov    %esp,%ebp
+     d33:	53                   	push   %ebx
+     d34:	89 c3                	mov    %eax,%ebx
+     d36:	83 ec 04             	sub    $0x4,%esp
+  if(b->str){
+     d39:	8b 80 0c 02 00 00    	mov    0x20c(%eax),%eax
+     d3f:	85 c0                	test   %eax,%eax
+     d41:	74 15                	je     d58 <putc+0x28>
+    *b->str++ = c;
+     d43:	8d 48 01             	lea    0x1(%eax),%ecx
+     d46:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+     d4c:	88 10                	mov    %dl,(%eax)
+}
+     d4e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     d51:	c9                   	leave
+     d52:	c3                   	ret
+     d53:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d57:	90                   	nop
+  b->buf[b->n++] = c;
+     d58:	8b 4b 08             	mov    0x8(%ebx),%ecx
+     d5b:	8d 41 01             	lea    0x1(%ecx),%eax
+     d5e:	89 43 08             	mov    %eax,0x8(%ebx)
+     d61:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+     d65:	3d 00 02 00 00       	cmp    $0x200,%eax
+     d6a:	74 14                	je     d80 <putc+0x50>
+     d6c:	80 fa 0a             	cmp    $0xa,%dl
+     d6f:	75 dd                	jne    d4e <putc+0x1e>
+     d71:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+     d75:	75 d7                	jne    d4e <putc+0x1e>
+  if(b->n > 0)
+     d77:	85 c0                	test   %eax,%eax
+     d79:	7e 17                	jle    d92 <putc+0x62>
+     d7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d7f:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     d80:	83 ec 04             	sub    $0x4,%esp
+     d83:	50                   	push   %eax
+     d84:	8d 43 0c             	lea    0xc(%ebx),%eax
+     d87:	50                   	push   %eax
+     d88:	ff 33                	push   (%ebx)
+     d8a:	e8 01 fd ff ff       	call   a90 <_write>
+     d8f:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     d92:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+     d99:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     d9c:	c9                   	leave
+     d9d:	c3                   	ret
+     d9e:	66 90                	xchg   %ax,%ax
+
+00000da0 <format>:
+
+// Format fmt and the arguments at ap into b.
+// Only understands %d, %x, %p, %s, %c.
+static void
+format(struct outbuf *b, const char *fmt, uint *ap)
+{
+     da0:	55                   	push   %ebp
+     da1:	89 e5                	mov    %esp,%ebp
+     da3:	57                   	push   %edi
+     da4:	89 c7                	mov    %eax,%edi
+     da6:	56                   	push   %esi
+     da7:	53                   	push   %ebx
+     da8:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+     dab:	0f b6 02             	movzbl (%edx),%eax
+{
+     dae:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  for(i = 0; fmt[i]; i++){
+     db1:	84 c0                	test   %al,%al
+     db3:	74 5a                	je     e0f <format+0x6f>
+     db5:	8d 5a 01             	lea    0x1(%edx),%ebx
+     db8:	31 f6                	xor    %esi,%esi
+     dba:	eb 1c                	jmp    dd8 <format+0x38>
+     dbc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     dc0:	83 f8 25             	cmp    $0x25,%eax
+     dc3:	74 3b                	je     e00 <format+0x60>
+        state = '%';
+      } else {
+        putc(b, c);
+     dc5:	89 ca                	mov    %ecx,%edx
+     dc7:	89 f8                	mov    %edi,%eax
+     dc9:	e8 62 ff ff ff       	call   d30 <putc>
+  for(i = 0; fmt[i]; i++){
+     dce:	0f b6 03             	movzbl (%ebx),%eax
+     dd1:	83 c3 01             	add    $0x1,%ebx
+     dd4:	84 c0                	test   %al,%al
+     dd6:	74 37                	je     e0f <format+0x6f>
+    c = fmt[i] & 0xff;
+     dd8:	0f be c8             	movsbl %al,%ecx
+     ddb:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     dde:	85 f6                	test   %esi,%esi
+     de0:	74 de                	je     dc0 <format+0x20>
+      }
+    } else if(state == '%'){
+     de2:	83 fe 25             	cmp    $0x25,%esi
+     de5:	75 e7                	jne    dce <format+0x2e>
+      if(c == 'd'){
+     de7:	83 f8 25             	cmp    $0x25,%eax
+     dea:	74 46                	je     e32 <format+0x92>
+     dec:	83 e8 63             	sub    $0x63,%eax
+     def:	83 f8 15             	cmp    $0x15,%eax
+     df2:	77 2c                	ja     e20 <format+0x80>
+     df4:	ff 24 85 f8 19 00 00 	jmp    *0x19f8(,%eax,4)
+     dfb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     dff:	90                   	nop
+  for(i = 0; fmt[i]; i++){
+     e00:	0f b6 03             	movzbl (%ebx),%eax
+     e03:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+     e06:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+     e0b:	84 c0                	test   %al,%al
+     e0d:	75 c9                	jne    dd8 <format+0x38>
+        putc(b, c);
+      }
+      state = 0;
+    }
+  }
+}
+     e0f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e12:	5b                   	pop    %ebx
+     e13:	5e                   	pop    %esi
+     e14:	5f                   	pop    %edi
+     e15:	5d                   	pop    %ebp
+     e16:	c3                   	ret
+     e17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e1e:	66 90                	xchg   %ax,%ax
+        putc(b, '%');
+     e20:	ba 25 00 00 00       	mov    $0x25,%edx
+     e25:	89 f8                	mov    %edi,%eax
+     e27:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     e2a:	e8 01 ff ff ff       	call   d30 <putc>
+        putc(b, c);
+     e2f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     e32:	89 ca                	mov    %ecx,%edx
+     e34:	89 f8                	mov    %edi,%eax
+      state = 0;
+     e36:	31 f6                	xor    %esi,%esi
+        putc(b, c);
+     e38:	e8 f3 fe ff ff       	call   d30 <putc>
+     e3d:	eb 8f                	jmp    dce <format+0x2e>
+     e3f:	90                   	nop
+        printint(b, *ap, 16, 0);
+     e40:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     e43:	83 ec 0c             	sub    $0xc,%esp
+     e46:	b9 10 00 00 00       	mov    $0x10,%ecx
+     e4b:	8b 16                	mov    (%esi),%edx
+     e4d:	6a 00                	push   $0x0
+        ap++;
+     e4f:	83 c6 04             	add    $0x4,%esi
+        printint(b, *ap, 16, 0);
+     e52:	89 f8                	mov    %edi,%eax
+     e54:	e8 d7 fd ff ff       	call   c30 <printint>
+        ap++;
+     e59:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+     e5c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     e5f:	31 f6                	xor    %esi,%esi
+     e61:	e9 68 ff ff ff       	jmp    dce <format+0x2e>
+     e66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e6d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     e70:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     e73:	8b 30                	mov    (%eax),%esi
+        ap++;
+     e75:	83 c0 04             	add    $0x4,%eax
+     e78:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+     e7b:	85 f6                	test   %esi,%esi
+     e7d:	75 1b                	jne    e9a <format+0xfa>
+     e7f:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+     e84:	be f0 19 00 00       	mov    $0x19f0,%esi
+     e89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+          putc(b, *s);
+     e90:	89 f8                	mov    %edi,%eax
+          s++;
+     e92:	83 c6 01             	add    $0x1,%esi
+          putc(b, *s);
+     e95:	e8 96 fe ff ff       	call   d30 <putc>
+        while(*s != 0){
+     e9a:	0f be 16             	movsbl (%esi),%edx
+     e9d:	84 d2                	test   %dl,%dl
+     e9f:	75 ef                	jne    e90 <format+0xf0>
+      state = 0;
+     ea1:	31 f6                	xor    %esi,%esi
+     ea3:	e9 26 ff ff ff       	jmp    dce <format+0x2e>
+     ea8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     eaf:	90                   	nop
+        printint(b, *ap, 10, 1);
+     eb0:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     eb3:	83 ec 0c             	sub    $0xc,%esp
+     eb6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     ebb:	8b 16                	mov    (%esi),%edx
+     ebd:	6a 01                	push   $0x1
+     ebf:	eb 8e                	jmp    e4f <format+0xaf>
+     ec1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(b, *ap);
+     ec8:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     ecb:	89 f8                	mov    %edi,%eax
+     ecd:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+     ed0:	83 c6 04             	add    $0x4,%esi
+        putc(b, *ap);
+     ed3:	e8 58 fe ff ff       	call   d30 <putc>
+        ap++;
+     ed8:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      state = 0;
+     edb:	31 f6                	xor    %esi,%esi
+     edd:	e9 ec fe ff ff       	jmp    dce <format+0x2e>
+     ee2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ee9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000ef0 <fflush>:
+{
+     ef0:	55                   	push   %ebp
+     ef1:	89 e5                	mov    %esp,%ebp
+     ef3:	83 ec 08             	sub    $0x8,%esp
+  if(fd == stdout.fd)
+     ef6:	8b 45 08             	mov    0x8(%ebp),%eax
+     ef9:	39 05 00 20 00 00    	cmp    %eax,0x2000
+     eff:	74 07                	je     f08 <fflush+0x18>
+}
+     f01:	c9                   	leave
+     f02:	c3                   	ret
+     f03:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     f07:	90                   	nop
+  umtxlock(&stdoutlock);
+     f08:	83 ec 0c             	sub    $0xc,%esp
+     f0b:	68 24 a2 00 00       	push   $0xa224
+     f10:	e8 db fa ff ff       	call   9f0 <umtxlock>
+  if(b->n > 0)
+     f15:	a1 08 20 00 00       	mov    0x2008,%eax
+     f1a:	83 c4 10             	add    $0x10,%esp
+     f1d:	85 c0                	test   %eax,%eax
+     f1f:	7f 1f                	jg     f40 <fflush+0x50>
+  b->n = 0;
+     f21:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     f28:	00 00 00 
+  umtxunlock(&stdoutlock);
+     f2b:	c7 45 08 24 a2 00 00 	movl   $0xa224,0x8(%ebp)
+}
+     f32:	c9                   	leave
+  umtxunlock(&stdoutlock);
+     f33:	e9 08 fb ff ff       	jmp    a40 <umtxunlock>
+     f38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f3f:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     f40:	83 ec 04             	sub    $0x4,%esp
+     f43:	50                   	push   %eax
+     f44:	68 0c 20 00 00       	push   $0x200c
+     f49:	ff 35 00 20 00 00    	push   0x2000
+     f4f:	e8 3c fb ff ff       	call   a90 <_write>
+     f54:	83 c4 10             	add    $0x10,%esp
+     f57:	eb c8                	jmp    f21 <fflush+0x31>
+     f59:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000f60 <setvbuf>:
+{
+     f60:	55                   	push   %ebp
+     f61:	89 e5                	mov    %esp,%ebp
+     f63:	53                   	push   %ebx
+     f64:	83 ec 04             	sub    $0x4,%esp
+     f67:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd != stdout.fd)
+     f6a:	8b 45 08             	mov    0x8(%ebp),%eax
+     f6d:	39 05 00 20 00 00    	cmp    %eax,0x2000
+     f73:	74 0b                	je     f80 <setvbuf+0x20>
+}
+     f75:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     f78:	c9                   	leave
+     f79:	c3                   	ret
+     f7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  umtxlock(&stdoutlock);
+     f80:	83 ec 0c             	sub    $0xc,%esp
+     f83:	68 24 a2 00 00       	push   $0xa224
+     f88:	e8 63 fa ff ff       	call   9f0 <umtxlock>
+  if(b->n > 0)
+     f8d:	a1 08 20 00 00       	mov    0x2008,%eax
+     f92:	83 c4 10             	add    $0x10,%esp
+     f95:	85 c0                	test   %eax,%eax
+     f97:	7f 2f                	jg     fc8 <setvbuf+0x68>
+  b->n = 0;
+     f99:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     fa0:	00 00 00 
+  stdout.mode = mode;
+     fa3:	89 1d 04 20 00 00    	mov    %ebx,0x2004
+  flushhook = flushall;
+     fa9:	c7 05 20 a2 00 00 e0 	movl   $0xbe0,0xa220
+     fb0:	0b 00 00 
+}
+     fb3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&stdoutlock);
+     fb6:	c7 45 08 24 a2 00 00 	movl   $0xa224,0x8(%ebp)
+}
+     fbd:	c9                   	leave
+  umtxunlock(&stdoutlock);
+     fbe:	e9 7d fa ff ff       	jmp    a40 <umtxunlock>
+     fc3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     fc7:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     fc8:	83 ec 04             	sub    $0x4,%esp
+     fcb:	50                   	push   %eax
+     fcc:	68 0c 20 00 00       	push   $0x200c
+     fd1:	ff 35 00 20 00 00    	push   0x2000
+     fd7:	e8 b4 fa ff ff       	call   a90 <_write>
+     fdc:	83 c4 10             	add    $0x10,%esp
+     fdf:	eb b8                	jmp    f99 <setvbuf+0x39>
+     fe1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fe8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fef:	90                   	nop
+
+00000ff0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s, %c.
+void
+printf(int fd, const char *fmt, ...)
+{
+     ff0:	55                   	push   %ebp
+     ff1:	89 e5                	mov    %esp,%ebp
+     ff3:	53                   	push   %ebx
+     ff4:	81 ec 14 02 00 00    	sub    $0x214,%esp
+     ffa:	8b 45 08             	mov    0x8(%ebp),%eax
+    local.mode = _IONBF;
+    local.n = 0;
+    local.str = 0;
+    b = &local;
+  }
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     ffd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd == stdout.fd){
+    1000:	39 05 00 20 00 00    	cmp    %eax,0x2000
+    1006:	74 48                	je     1050 <printf+0x60>
+    local.fd = fd;
+    1008:	89 85 e8 fd ff ff    	mov    %eax,-0x218(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+    100e:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    1011:	89 da                	mov    %ebx,%edx
+    1013:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+    local.mode = _IONBF;
+    1019:	c7 85 ec fd ff ff 03 	movl   $0x3,-0x214(%ebp)
+    1020:	00 00 00 
+    local.n = 0;
+    1023:	c7 85 f0 fd ff ff 00 	movl   $0x0,-0x210(%ebp)
+    102a:	00 00 00 
+    local.str = 0;
+    102d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+    1034:	e8 67 fd ff ff       	call   da0 <format>
+  if(b->mode == _IONBF)
+    1039:	83 bd ec fd ff ff 03 	cmpl   $0x3,-0x214(%ebp)
+    1040:	0f 84 a2 00 00 00    	je     10e8 <printf+0xf8>
+    flush(b);
+  if(b == &stdout)
+    umtxunlock(&stdoutlock);
+}
+    1046:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1049:	c9                   	leave
+    104a:	c3                   	ret
+    104b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    104f:	90                   	nop
+    umtxlock(&stdoutlock);
+    1050:	83 ec 0c             	sub    $0xc,%esp
+    1053:	68 24 a2 00 00       	push   $0xa224
+    1058:	e8 93 f9 ff ff       	call   9f0 <umtxlock>
+  if(stdout.mode == 0){
+    105d:	a1 04 20 00 00       	mov    0x2004,%eax
+    1062:	83 c4 10             	add    $0x10,%esp
+    1065:	85 c0                	test   %eax,%eax
+    1067:	74 37                	je     10a0 <printf+0xb0>
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+    1069:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    106c:	89 da                	mov    %ebx,%edx
+    106e:	b8 00 20 00 00       	mov    $0x2000,%eax
+    1073:	e8 28 fd ff ff       	call   da0 <format>
+  if(b->mode == _IONBF)
+    1078:	83 3d 04 20 00 00 03 	cmpl   $0x3,0x2004
+    107f:	0f 84 ab 00 00 00    	je     1130 <printf+0x140>
+    umtxunlock(&stdoutlock);
+    1085:	83 ec 0c             	sub    $0xc,%esp
+    1088:	68 24 a2 00 00       	push   $0xa224
+    108d:	e8 ae f9 ff ff       	call   a40 <umtxunlock>
+}
+    1092:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    umtxunlock(&stdoutlock);
+    1095:	83 c4 10             	add    $0x10,%esp
+}
+    1098:	c9                   	leave
+    1099:	c3                   	ret
+    109a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+    10a0:	83 ec 08             	sub    $0x8,%esp
+    10a3:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+    10a9:	50                   	push   %eax
+    10aa:	ff 35 00 20 00 00    	push   0x2000
+    10b0:	e8 13 fa ff ff       	call   ac8 <fstat>
+    10b5:	83 c4 10             	add    $0x10,%esp
+    10b8:	89 c2                	mov    %eax,%edx
+      stdout.mode = _IOFBF;
+    10ba:	b8 01 00 00 00       	mov    $0x1,%eax
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+    10bf:	85 d2                	test   %edx,%edx
+    10c1:	75 10                	jne    10d3 <printf+0xe3>
+      stdout.mode = _IOLBF;
+    10c3:	31 c0                	xor    %eax,%eax
+    10c5:	66 83 bd e8 fd ff ff 	cmpw   $0x3,-0x218(%ebp)
+    10cc:	03 
+    10cd:	0f 94 c0             	sete   %al
+    10d0:	83 c0 01             	add    $0x1,%eax
+    10d3:	a3 04 20 00 00       	mov    %eax,0x2004
+    flushhook = flushall;
+    10d8:	c7 05 20 a2 00 00 e0 	movl   $0xbe0,0xa220
+    10df:	0b 00 00 
+    10e2:	eb 85                	jmp    1069 <printf+0x79>
+    10e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(b->n > 0)
+    10e8:	8b 85 f0 fd ff ff    	mov    -0x210(%ebp),%eax
+    10ee:	85 c0                	test   %eax,%eax
+    10f0:	0f 8e 50 ff ff ff    	jle    1046 <printf+0x56>
+    b = &local;
+    10f6:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+    _write(b->fd, b->buf, b->n);
+    10fc:	83 ec 04             	sub    $0x4,%esp
+    10ff:	50                   	push   %eax
+    1100:	8d 43 0c             	lea    0xc(%ebx),%eax
+    1103:	50                   	push   %eax
+    1104:	ff 33                	push   (%ebx)
+    1106:	e8 85 f9 ff ff       	call   a90 <_write>
+  b->n = 0;
+    110b:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  if(b == &stdout)
+    1112:	83 c4 10             	add    $0x10,%esp
+    1115:	81 fb 00 20 00 00    	cmp    $0x2000,%ebx
+    111b:	0f 85 25 ff ff ff    	jne    1046 <printf+0x56>
+    1121:	e9 5f ff ff ff       	jmp    1085 <printf+0x95>
+    1126:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    112d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(b->n > 0)
+    1130:	a1 08 20 00 00       	mov    0x2008,%eax
+    b = getstdout();
+    1135:	bb 00 20 00 00       	mov    $0x2000,%ebx
+  if(b->n > 0)
+    113a:	85 c0                	test   %eax,%eax
+    113c:	7f be                	jg     10fc <printf+0x10c>
+  b->n = 0;
+    113e:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+    1145:	00 00 00 
+  if(b == &stdout)
+    1148:	e9 38 ff ff ff       	jmp    1085 <printf+0x95>
+    114d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001150 <sprintf>:
+
+// Print to the given buffer. Only understands %d, %x, %p, %s, %c.
+int
+sprintf(char *str, const char *fmt, ...)
+{
+    1150:	55                   	push   %ebp
+    1151:	89 e5                	mov    %esp,%ebp
+    1153:	53                   	push   %ebx
+  struct outbuf b;
+
+  b.str = str;
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+    1154:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+    115a:	8d 4d 10             	lea    0x10(%ebp),%ecx
+{
+    115d:	81 ec 14 02 00 00    	sub    $0x214,%esp
+    1163:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+    1166:	8b 55 0c             	mov    0xc(%ebp),%edx
+  b.str = str;
+    1169:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+    116c:	e8 2f fc ff ff       	call   da0 <format>
+  *b.str = '\0';
+    1171:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1174:	c6 00 00             	movb   $0x0,(%eax)
+  return b.str - str;
+    1177:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    117a:	29 d8                	sub    %ebx,%eax
+}
+    117c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    117f:	c9                   	leave
+    1180:	c3                   	ret
+    1181:	66 90                	xchg   %ax,%ax
+    1183:	66 90                	xchg   %ax,%ax
+    1185:	66 90                	xchg   %ax,%ax
+    1187:	66 90                	xchg   %ax,%ax
+    1189:	66 90                	xchg   %ax,%ax
+    118b:	66 90                	xchg   %ax,%ax
+    118d:	66 90                	xchg   %ax,%ax
+    118f:	90                   	nop
+
+00001190 <freeblock>:
+static Header *freep;
+static struct umutex lock;  // threads made by clone() share the heap
+
+static void
+freeblock(void *ap)
+{
+    1190:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+    1191:	8d 48 f8             	lea    -0x8(%eax),%ecx
+{
+    1194:	89 e5                	mov    %esp,%ebp
+    1196:	57                   	push   %edi
+    1197:	56                   	push   %esi
+    1198:	53                   	push   %ebx
+    1199:	89 c3                	mov    %eax,%ebx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    119b:	a1 2c a2 00 00       	mov    0xa22c,%eax
+    11a0:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    11a2:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    11a4:	39 ca                	cmp    %ecx,%edx
+    11a6:	73 30                	jae    11d8 <freeblock+0x48>
+    11a8:	39 c1                	cmp    %eax,%ecx
+    11aa:	72 04                	jb     11b0 <freeblock+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    11ac:	39 c2                	cmp    %eax,%edx
+    11ae:	72 f0                	jb     11a0 <freeblock+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    11b0:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    11b3:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    11b6:	39 f8                	cmp    %edi,%eax
+    11b8:	74 26                	je     11e0 <freeblock+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    11ba:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    11bd:	8b 42 04             	mov    0x4(%edx),%eax
+    11c0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    11c3:	39 f1                	cmp    %esi,%ecx
+    11c5:	74 30                	je     11f7 <freeblock+0x67>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    11c7:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    11c9:	5b                   	pop    %ebx
+  freep = p;
+    11ca:	89 15 2c a2 00 00    	mov    %edx,0xa22c
+}
+    11d0:	5e                   	pop    %esi
+    11d1:	5f                   	pop    %edi
+    11d2:	5d                   	pop    %ebp
+    11d3:	c3                   	ret
+    11d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    11d8:	39 c1                	cmp    %eax,%ecx
+    11da:	72 d0                	jb     11ac <freeblock+0x1c>
+    11dc:	eb c2                	jmp    11a0 <freeblock+0x10>
+    11de:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+    11e0:	03 70 04             	add    0x4(%eax),%esi
+    11e3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    11e6:	8b 02                	mov    (%edx),%eax
+    11e8:	8b 00                	mov    (%eax),%eax
+    11ea:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    11ed:	8b 42 04             	mov    0x4(%edx),%eax
+    11f0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    11f3:	39 f1                	cmp    %esi,%ecx
+    11f5:	75 d0                	jne    11c7 <freeblock+0x37>
+    p->s.size += bp->s.size;
+    11f7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    11fa:	89 15 2c a2 00 00    	mov    %edx,0xa22c
+    p->s.size += bp->s.size;
+    1200:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1203:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    1206:	89 0a                	mov    %ecx,(%edx)
+}
+    1208:	5b                   	pop    %ebx
+    1209:	5e                   	pop    %esi
+    120a:	5f                   	pop    %edi
+    120b:	5d                   	pop    %ebp
+    120c:	c3                   	ret
+    120d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001210 <free>:
+
+void
+free(void *ap)
+{
+    1210:	55                   	push   %ebp
+    1211:	89 e5                	mov    %esp,%ebp
+    1213:	53                   	push   %ebx
+    1214:	83 ec 10             	sub    $0x10,%esp
+    1217:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  umtxlock(&lock);
+    121a:	68 28 a2 00 00       	push   $0xa228
+    121f:	e8 cc f7 ff ff       	call   9f0 <umtxlock>
+  freeblock(ap);
+    1224:	89 d8                	mov    %ebx,%eax
+    1226:	e8 65 ff ff ff       	call   1190 <freeblock>
+  umtxunlock(&lock);
+    122b:	c7 45 08 28 a2 00 00 	movl   $0xa228,0x8(%ebp)
+}
+    1232:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&lock);
+    1235:	83 c4 10             	add    $0x10,%esp
+}
+    1238:	c9                   	leave
+  umtxunlock(&lock);
+    1239:	e9 02 f8 ff ff       	jmp    a40 <umtxunlock>
+    123e:	66 90                	xchg   %ax,%ax
+
+00001240 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    1240:	55                   	push   %ebp
+    1241:	89 e5                	mov    %esp,%ebp
+    1243:	57                   	push   %edi
+    1244:	56                   	push   %esi
+    1245:	53                   	push   %ebx
+    1246:	83 ec 28             	sub    $0x28,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1249:	8b 45 08             	mov    0x8(%ebp),%eax
+  umtxlock(&lock);
+    124c:	68 28 a2 00 00       	push   $0xa228
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1251:	8d 48 07             	lea    0x7(%eax),%ecx
+    1254:	c1 e9 03             	shr    $0x3,%ecx
+    1257:	8d 71 01             	lea    0x1(%ecx),%esi
+  umtxlock(&lock);
+    125a:	e8 91 f7 ff ff       	call   9f0 <umtxlock>
+  if((prevp = freep) == 0){
+    125f:	8b 15 2c a2 00 00    	mov    0xa22c,%edx
+    1265:	83 c4 10             	add    $0x10,%esp
+    1268:	85 d2                	test   %edx,%edx
+    126a:	0f 84 b0 00 00 00    	je     1320 <malloc+0xe0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1270:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+    1272:	8b 47 04             	mov    0x4(%edi),%eax
+    1275:	39 f0                	cmp    %esi,%eax
+    1277:	73 6f                	jae    12e8 <malloc+0xa8>
+  if(nu < 4096)
+    1279:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    127e:	39 de                	cmp    %ebx,%esi
+    1280:	0f 43 de             	cmovae %esi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    1283:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+    128a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    128d:	eb 0a                	jmp    1299 <malloc+0x59>
+    128f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1290:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+    1292:	8b 47 04             	mov    0x4(%edi),%eax
+    1295:	39 f0                	cmp    %esi,%eax
+    1297:	73 4f                	jae    12e8 <malloc+0xa8>
+      }
+      freep = prevp;
+      umtxunlock(&lock);
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    1299:	89 fa                	mov    %edi,%edx
+    129b:	39 3d 2c a2 00 00    	cmp    %edi,0xa22c
+    12a1:	75 ed                	jne    1290 <malloc+0x50>
+  p = sbrk(nu * sizeof(Header));
+    12a3:	83 ec 0c             	sub    $0xc,%esp
+    12a6:	ff 75 e4             	push   -0x1c(%ebp)
+    12a9:	e8 4a f8 ff ff       	call   af8 <sbrk>
+  if(p == (char*)-1)
+    12ae:	83 c4 10             	add    $0x10,%esp
+    12b1:	83 f8 ff             	cmp    $0xffffffff,%eax
+    12b4:	74 15                	je     12cb <malloc+0x8b>
+  hp->s.size = nu;
+    12b6:	89 58 04             	mov    %ebx,0x4(%eax)
+  freeblock((void*)(hp + 1));
+    12b9:	83 c0 08             	add    $0x8,%eax
+    12bc:	e8 cf fe ff ff       	call   1190 <freeblock>
+  return freep;
+    12c1:	8b 15 2c a2 00 00    	mov    0xa22c,%edx
+      if((p = morecore(nunits)) == 0){
+    12c7:	85 d2                	test   %edx,%edx
+    12c9:	75 c5                	jne    1290 <malloc+0x50>
+        umtxunlock(&lock);
+    12cb:	83 ec 0c             	sub    $0xc,%esp
+    12ce:	68 28 a2 00 00       	push   $0xa228
+    12d3:	e8 68 f7 ff ff       	call   a40 <umtxunlock>
+        return 0;
+    12d8:	83 c4 10             	add    $0x10,%esp
+      }
+  }
+}
+    12db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    12de:	31 c0                	xor    %eax,%eax
+}
+    12e0:	5b                   	pop    %ebx
+    12e1:	5e                   	pop    %esi
+    12e2:	5f                   	pop    %edi
+    12e3:	5d                   	pop    %ebp
+    12e4:	c3                   	ret
+    12e5:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    12e8:	39 c6                	cmp    %eax,%esi
+    12ea:	74 64                	je     1350 <malloc+0x110>
+        p->s.size -= nunits;
+    12ec:	29 f0                	sub    %esi,%eax
+    12ee:	89 47 04             	mov    %eax,0x4(%edi)
+        p += p->s.size;
+    12f1:	8d 3c c7             	lea    (%edi,%eax,8),%edi
+        p->s.size = nunits;
+    12f4:	89 77 04             	mov    %esi,0x4(%edi)
+      umtxunlock(&lock);
+    12f7:	83 ec 0c             	sub    $0xc,%esp
+      freep = prevp;
+    12fa:	89 15 2c a2 00 00    	mov    %edx,0xa22c
+      umtxunlock(&lock);
+    1300:	68 28 a2 00 00       	push   $0xa228
+    1305:	e8 36 f7 ff ff       	call   a40 <umtxunlock>
+      return (void*)(p + 1);
+    130a:	83 c4 10             	add    $0x10,%esp
+}
+    130d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    1310:	8d 47 08             	lea    0x8(%edi),%eax
+}
+    1313:	5b                   	pop    %ebx
+    1314:	5e                   	pop    %esi
+    1315:	5f                   	pop    %edi
+    1316:	5d                   	pop    %ebp
+    1317:	c3                   	ret
+    1318:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    131f:	90                   	nop
+    base.s.ptr = freep = prevp = &base;
+    1320:	c7 05 2c a2 00 00 30 	movl   $0xa230,0xa22c
+    1327:	a2 00 00 
+    base.s.size = 0;
+    132a:	bf 30 a2 00 00       	mov    $0xa230,%edi
+    base.s.ptr = freep = prevp = &base;
+    132f:	c7 05 30 a2 00 00 30 	movl   $0xa230,0xa230
+    1336:	a2 00 00 
+    base.s.size = 0;
+    1339:	c7 05 34 a2 00 00 00 	movl   $0x0,0xa234
+    1340:	00 00 00 
+    if(p->s.size >= nunits){
+    1343:	e9 31 ff ff ff       	jmp    1279 <malloc+0x39>
+    1348:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    134f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1350:	8b 07                	mov    (%edi),%eax
+    1352:	89 02                	mov    %eax,(%edx)
+    1354:	eb a1                	jmp    12f7 <malloc+0xb7>
+    1356:	66 90                	xchg   %ax,%ax
+    1358:	66 90                	xchg   %ax,%ax
+    135a:	66 90                	xchg   %ax,%ax
+    135c:	66 90                	xchg   %ax,%ax
+    135e:	66 90                	xchg   %ax,%ax
+
+00001360 <threadstart>:
+
+#define TSTACKSZ 4096
+
+static void
+threadstart(void *fn, void *arg)
+{
+    1360:	55                   	push   %ebp
+    1361:	89 e5                	mov    %esp,%ebp
+    1363:	83 ec 14             	sub    $0x14,%esp
+  ((void (*)(void*))fn)(arg);
+    1366:	ff 75 0c             	push   0xc(%ebp)
+    1369:	ff 55 08             	call   *0x8(%ebp)
+  exit();
+    136c:	e8 ef f4 ff ff       	call   860 <exit>
+    1371:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1378:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    137f:	90                   	nop
+
+00001380 <thread_create>:
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    1380:	55                   	push   %ebp
+    1381:	89 e5                	mov    %esp,%ebp
+    1383:	53                   	push   %ebx
+    1384:	83 ec 20             	sub    $0x20,%esp
+  char *mem, *stack;
+  int pid;
+
+  if((mem = malloc(2*TSTACKSZ)) == 0)
+    1387:	68 00 20 00 00       	push   $0x2000
+    138c:	e8 af fe ff ff       	call   1240 <malloc>
+    1391:	83 c4 10             	add    $0x10,%esp
+    1394:	85 c0                	test   %eax,%eax
+    1396:	74 47                	je     13df <thread_create+0x5f>
+    1398:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)(((uint)mem + TSTACKSZ - 1) & ~(TSTACKSZ - 1));
+    139a:	8d 80 ff 0f 00 00    	lea    0xfff(%eax),%eax
+    13a0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  *(char**)stack = mem;
+    13a5:	89 18                	mov    %ebx,(%eax)
+  if((pid = clone(threadstart, (void*)fn, arg, stack)) < 0)
+    13a7:	50                   	push   %eax
+    13a8:	ff 75 0c             	push   0xc(%ebp)
+    13ab:	ff 75 08             	push   0x8(%ebp)
+    13ae:	68 60 13 00 00       	push   $0x1360
+    13b3:	e8 08 f8 ff ff       	call   bc0 <clone>
+    13b8:	83 c4 10             	add    $0x10,%esp
+    13bb:	85 c0                	test   %eax,%eax
+    13bd:	78 09                	js     13c8 <thread_create+0x48>
+    free(mem);
+  return pid;
+}
+    13bf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    13c2:	c9                   	leave
+    13c3:	c3                   	ret
+    13c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    free(mem);
+    13c8:	83 ec 0c             	sub    $0xc,%esp
+    13cb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    13ce:	53                   	push   %ebx
+    13cf:	e8 3c fe ff ff       	call   1210 <free>
+    13d4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    13d7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+    13da:	83 c4 10             	add    $0x10,%esp
+}
+    13dd:	c9                   	leave
+    13de:	c3                   	ret
+    return -1;
+    13df:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    13e4:	eb d9                	jmp    13bf <thread_create+0x3f>
+    13e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000013f0 <thread_join>:
+
+int
+thread_join(void)
+{
+    13f0:	55                   	push   %ebp
+    13f1:	89 e5                	mov    %esp,%ebp
+    13f3:	83 ec 34             	sub    $0x34,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    13f6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    13f9:	50                   	push   %eax
+    13fa:	e8 c9 f7 ff ff       	call   bc8 <join>
+    13ff:	83 c4 10             	add    $0x10,%esp
+    1402:	85 c0                	test   %eax,%eax
+    1404:	79 0a                	jns    1410 <thread_join+0x20>
+    free(*(char**)stack);
+  return pid;
+}
+    1406:	c9                   	leave
+    1407:	c3                   	ret
+    1408:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    140f:	90                   	nop
+    free(*(char**)stack);
+    1410:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1413:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1416:	83 ec 0c             	sub    $0xc,%esp
+    1419:	ff 32                	push   (%edx)
+    141b:	e8 f0 fd ff ff       	call   1210 <free>
+    1420:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1423:	83 c4 10             	add    $0x10,%esp
+}
+    1426:	c9                   	leave
+    1427:	c3                   	ret
@@ -0,0 +1,159 @@
+// Compare moving data between a producer and a consumer
+// process through a pipe with moving it through a shared
+// memory segment.
+//
+// Through the pipe, every byte is copied into and out of
+// the kernel's 512-byte pipe buffer. Through shared memory,
+// the producer writes each chunk straight into one half of
+// a double buffer that the consumer reads in place; one-byte
+// pipe messages only say which half is full or free again.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+#define CHUNK  (32*1024)          // bytes per shared buffer half
+#define TOTAL  (4*1024*1024)      // bytes moved per run
+
+char buf[CHUNK];
+
+void
+fill(char *p, int n, int seq)
+{
+  int i;
+
+  for(i = 0; i < n; i++)
+    p[i] = seq + i;
+}
+
+uint
+sum(char *p, int n)
+{
+  int i;
+  uint s;
+
+  s = 0;
+  for(i = 0; i < n; i++)
+    s += (uchar)p[i];
+  return s;
+}
+
+// Expected checksum of everything the producer sends.
+uint
+expect(void)
+{
+  int seq;
+  uint s;
+
+  s = 0;
+  for(seq = 0; seq < TOTAL/CHUNK; seq++){
+    fill(buf, CHUNK, seq);
+    s += sum(buf, CHUNK);
+  }
+  return s;
+}
+
+int
+bypipe(void)
+{
+  int p[2], t0, n, seq, got;
+  uint s;
+
+  if(pipe(p) < 0){
+    printf(1, "shmbench: pipe failed\n");
+    exit();
+  }
+  t0 = uptime();
+  if(fork() == 0){
+    close(p[0]);
+    for(seq = 0; seq < TOTAL/CHUNK; seq++){
+      fill(buf, CHUNK, seq);
+      if(write(p[1], buf, CHUNK) != CHUNK){
+        printf(1, "shmbench: pipe write failed\n");
+        exit();
+      }
+    }
+    exit();
+  }
+  close(p[1]);
+  s = 0;
+  for(got = 0; got < TOTAL; got += n){
+    if((n = read(p[0], buf, CHUNK)) <= 0){
+      printf(1, "shmbench: pipe read failed\n");
+      exit();
+    }
+    s += sum(buf, n);
+  }
+  close(p[0]);
+  wait();
+  t0 = uptime() - t0;
+  if(s != expect())
+    printf(1, "shmbench: pipe data corrupt\n");
+  return t0;
+}
+
+int
+byshm(void)
+{
+  int full[2], empty[2], id, t0, seq;
+  char *shm, c;
+  uint s;
+
+  if((id = shmget(0, 2*CHUNK)) < 0 || (shm = shmat(id)) == (char*)-1){
+    printf(1, "shmbench: shmget/shmat failed\n");
+    exit();
+  }
+  // The segment lives until the last process detaches.
+  shmdel(id);
+  if(pipe(full) < 0 || pipe(empty) < 0){
+    printf(1, "shmbench: pipe failed\n");
+    exit();
+  }
+  c = 0;
+  write(empty[1], &c, 1);
+  write(empty[1], &c, 1);
+
+  t0 = uptime();
+  if(fork() == 0){
+    for(seq = 0; seq < TOTAL/CHUNK; seq++){
+      if(read(empty[0], &c, 1) != 1){
+        printf(1, "shmbench: empty read failed\n");
+        exit();
+      }
+      fill(shm + (seq % 2) * CHUNK, CHUNK, seq);
+      write(full[1], &c, 1);
+    }
+    exit();
+  }
+  s = 0;
+  for(seq = 0; seq < TOTAL/CHUNK; seq++){
+    if(read(full[0], &c, 1) != 1){
+      printf(1, "shmbench: full read failed\n");
+      exit();
+    }
+    s += sum(shm + (seq % 2) * CHUNK, CHUNK);
+    write(empty[1], &c, 1);
+  }
+  wait();
+  t0 = uptime() - t0;
+  close(full[0]);
+  close(full[1]);
+  close(empty[0]);
+  close(empty[1]);
+  shmdt(shm);
+  if(s != expect())
+    printf(1, "shmbench: shm data corrupt\n");
+  return t0;
+}
+
+int
+main(int argc, char *argv[])
+{
+  int tp, ts;
+
+  tp = bypipe();
+  ts = byshm();
+  printf(1, "shmbench: %d KB through a pipe: %d ticks\n", TOTAL/1024, tp);
+  printf(1, "shmbench: %d KB through shared memory: %d ticks\n", TOTAL/1024, ts);
+  exit();
+}
@@ -13,21 +13,65 @@
 void
 initsleeplock(struct sleeplock *lk, char *name)
 {
-  initlock(&lk->lk, "sleep lock");
+  initlock(&lk->lk, name);
   lk->name = name;
   lk->locked = 0;
+  lk->readers = 0;
+  lk->wwait = 0;
   lk->pid = 0;
+  lk->owner = 0;
+}
+
+// Is lk still held exclusively by owner, and owner running?
+static int
+ownerrunning(struct sleeplock *lk, struct proc *owner)
+{
+  volatile struct sleeplock *vlk = lk;
+  volatile struct proc *vp = owner;
+
+  return vlk->locked && vlk->owner == owner && vp->state == RUNNING;
+}
+
+// Wait for lk to change, with lk->lk held. A holder that is
+// running on another CPU is likely to let go soon, so spin
+// until it does or stops running, rather than pay for a
+// switch away and back; otherwise sleep. Returns 1 if it
+// slept.
+static int
+waitsleep(struct sleeplock *lk)
+{
+  struct proc *owner;
+
+  owner = lk->owner;
+  if(owner && owner != myproc() && ownerrunning(lk, owner)){
+    release(&lk->lk);
+    while(ownerrunning(lk, owner))
+      pause();
+    acquire(&lk->lk);
+    return 0;
+  }
+  sleep(lk, &lk->lk);
+  return 1;
 }
 
 void
 acquiresleep(struct sleeplock *lk)
 {
+  int waited, slept;
+
   acquire(&lk->lk);
-  while (lk->locked) {
-    sleep(lk, &lk->lk);
+  lk->wwait++;
+  waited = slept = 0;
+  while (lk->locked || lk->readers) {
+    slept |= waitsleep(lk);
+    waited = 1;
   }
+  lk->wwait--;
   lk->locked = 1;
   lk->pid = myproc()->pid;
+  lk->owner = myproc();
+  if(waited)
+    lockwaited(&lk->lk, slept);
   release(&lk->lk);
 }
 
@@ -37,10 +81,43 @@ releasesleep(struct sleeplock *lk)
   acquire(&lk->lk);
   lk->locked = 0;
   lk->pid = 0;
+  lk->owner = 0;
   wakeup(lk);
   release(&lk->lk);
 }
 
+// Acquire lk shared with other readers. New readers wait
+// while a process waits to acquire lk exclusively, so that
+// a stream of readers cannot starve it.
+void
+acquiresleepshared(struct sleeplock *lk)
+{
+  int waited, slept;
+
+  acquire(&lk->lk);
+  waited = slept = 0;
+  while (lk->locked || lk->wwait) {
+    slept |= waitsleep(lk);
+    waited = 1;
+  }
+  lk->readers++;
+  if(waited)
+    lockwaited(&lk->lk, slept);
+  release(&lk->lk);
+}
+
+void
+releasesleepshared(struct sleeplock *lk)
+{
+  acquire(&lk->lk);
+  if(lk->readers < 1)
+    panic("releasesleepshared");
+  lk->readers--;
+  if(lk->readers == 0)
+    wakeup(lk);
+  release(&lk->lk);
+}
+
 int
 holdingsleep(struct sleeplock *lk)
 {
@@ -51,6 +128,3 @@ holdingsleep(struct sleeplock *lk)
   release(&lk->lk);
   return r;
 }
-
-
-
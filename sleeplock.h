@@ -1,10 +1,15 @@
 // Long-term locks for processes
+// Held either exclusively by one process, or shared by
+// any number of readers.
 struct sleeplock {
-  uint locked;       // Is the lock held?
+  uint locked;       // Is the lock held exclusively?
+  int readers;       // Processes holding the lock shared
+  int wwait;         // Processes waiting to hold it exclusively
   struct spinlock lk; // spinlock protecting this sleep lock
   
   // For debugging:
   char *name;        // Name of lock.
   int pid;           // Process holding lock
+  struct proc *owner; // Process holding lock exclusively, for waiters
 };
 
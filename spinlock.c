@@ -8,13 +8,54 @@
 #include "mmu.h"
 #include "proc.h"
 #include "spinlock.h"
+#include "lockstat.h"
+
+// Contention counters, shared by all locks of one name and
+// kept per CPU so that acquire() and release(), which run with
+// interrupts off, can update them without a lock. Slots are
+// claimed with cmpxchg and never freed, so initlock() can find
+// or add a name before the other CPUs or even mycpu() work.
+struct lockclass {
+  char *name;
+  struct {
+    uint nacquire;
+    uint ncontend;
+    uint nspin;
+    uint64 hold;
+    uint nsleep;
+    uint nspinwait;
+  } cpu[NCPU];
+};
+
+static struct lockclass lockclass[NLOCKCLASS];
+
+static struct lockclass*
+findclass(char *name)
+{
+  struct lockclass *c;
+  char *n;
+
+  for(c = lockclass; c < &lockclass[NLOCKCLASS]; c++){
+    n = c->name;
+    if(n == 0){
+      n = (char*)cmpxchg((uint*)&c->name, 0, (uint)name);
+      if(n == 0)
+        return c;
+    }
+    if(n == name || strncmp(n, name, sizeof(((struct lockstat*)0)->name)) == 0)
+      return c;
+  }
+  return 0;
+}
 
 void
 initlock(struct spinlock *lk, char *name)
 {
   lk->name = name;
-  lk->locked = 0;
+  lk->next = 0;
+  lk->owner = 0;
   lk->cpu = 0;
+  lk->class = findclass(name);
 }
 
 // Acquire the lock.
@@ -24,13 +65,26 @@ initlock(struct spinlock *lk, char *name)
 void
 acquire(struct spinlock *lk)
 {
+  uint ticket, nspin;
+  struct cpu *c;
+
   pushcli(); // disable interrupts to avoid deadlock.
   if(holding(lk))
     panic("acquire");
 
-  // The xchg is atomic.
-  while(xchg(&lk->locked, 1) != 0)
-    ;
+  // The xadd is atomic. Waiters only read owner, so
+  // they do not fight over the lock's cache line.
+  // The holder may be waiting, in tlbshoot(), for this CPU
+  // to take an interrupt it cannot while it spins; answer.
+  ticket = fetchadd(&lk->next, 1);
+  nspin = 0;
+  c = mycpu();
+  while(*(volatile uint*)&lk->owner != ticket){
+    pause();
+    nspin++;
+    if(c->tlbpgdir)
+      tlbintr();
+  }
 
   // Tell the C compiler and the processor to not move loads or stores
   // past this point, to ensure that the critical section's memory
@@ -38,8 +92,17 @@ acquire(struct spinlock *lk)
   __sync_synchronize();
 
   // Record info about lock acquisition for debugging.
-  lk->cpu = mycpu();
+  lk->cpu = c;
   getcallerpcs(&lk, lk->pcs);
+
+  if(lk->class){
+    lk->class->cpu[c - cpus].nacquire++;
+    if(nspin > 0){
+      lk->class->cpu[c - cpus].ncontend++;
+      lk->class->cpu[c - cpus].nspin += nspin;
+    }
+    lk->tacquire = rdtsc();
+  }
 }
 
 // Release the lock.
@@ -49,6 +112,9 @@ release(struct spinlock *lk)
   if(!holding(lk))
     panic("release");
 
+  if(lk->class)
+    lk->class->cpu[lk->cpu - cpus].hold += rdtsc() - lk->tacquire;
+
   lk->pcs[0] = 0;
   lk->cpu = 0;
 
@@ -59,14 +125,51 @@ release(struct spinlock *lk)
   // stores; __sync_synchronize() tells them both not to.
   __sync_synchronize();
 
-  // Release the lock, equivalent to lk->locked = 0.
-  // This code can't use a C assignment, since it might
-  // not be atomic. A real OS would use C atomics here.
-  asm volatile("movl $0, %0" : "+m" (lk->locked) : );
+  // Hand the lock to the next ticket. Only the holder
+  // writes owner, so a plain aligned store will do.
+  *(volatile uint*)&lk->owner = lk->owner + 1;
 
   popcli();
 }
 
+// Count a wait for the sleep lock whose spin lock is lk,
+// which the caller holds: one that slept, or one that spun
+// while the holder ran on another CPU.
+void
+lockwaited(struct spinlock *lk, int slept)
+{
+  if(lk->class == 0)
+    return;
+  if(slept)
+    lk->class->cpu[lk->cpu - cpus].nsleep++;
+  else
+    lk->class->cpu[lk->cpu - cpus].nspinwait++;
+}
+
+// Copy the contention counters of the kth lock name to st.
+// Returns -1 if there are not that many names.
+int
+lockstat(int k, struct lockstat *st)
+{
+  struct lockclass *c;
+  int i;
+
+  if(k < 0 || k >= NLOCKCLASS || lockclass[k].name == 0)
+    return -1;
+  c = &lockclass[k];
+  memset(st, 0, sizeof(*st));
+  safestrcpy(st->name, c->name, sizeof(st->name));
+  for(i = 0; i < NCPU; i++){
+    st->nacquire += c->cpu[i].nacquire;
+    st->ncontend += c->cpu[i].ncontend;
+    st->nspin += c->cpu[i].nspin;
+    st->holdkc += c->cpu[i].hold >> 10;
+    st->nsleep += c->cpu[i].nsleep;
+    st->nspinwait += c->cpu[i].nspinwait;
+  }
+  return 0;
+}
+
 // Record the current call stack in pcs[] by following the %ebp chain.
 void
 getcallerpcs(void *v, uint pcs[])
@@ -91,7 +194,7 @@ holding(struct spinlock *lock)
 {
   int r;
   pushcli();
-  r = lock->locked && lock->cpu == mycpu();
+  r = lock->owner != lock->next && lock->cpu == mycpu();
   popcli();
   return r;
 }
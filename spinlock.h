@@ -1,11 +1,18 @@
 // Mutual exclusion lock.
+// A ticket lock: acquire() takes the next ticket and waits
+// until owner reaches it, so waiters get the lock in the order
+// they asked for it. All zeroes is a valid unlocked lock.
 struct spinlock {
-  uint locked;       // Is the lock held?
+  uint next;         // Next ticket to hand out.
+  uint owner;        // Ticket now holding the lock.
 
   // For debugging:
   char *name;        // Name of lock.
   struct cpu *cpu;   // The cpu holding the lock.
   uint pcs[10];      // The call stack (an array of program counters)
                      // that locked the lock.
-};
 
+  // For lockstat():
+  struct lockclass *class;  // Counters shared by locks of this name, or 0
+  uint64 tacquire;          // TSC when acquired
+};
@@ -0,0 +1,2380 @@
+
+_splicebench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <feed>:
+
+char buf[4096];
+
+int
+feed(int usesplice)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	57                   	push   %edi
+       4:	56                   	push   %esi
+       5:	8d 7d e0             	lea    -0x20(%ebp),%edi
+  int p[2], fd, n, got, r, t0;
+
+  t0 = uptime();
+       8:	be 20 00 00 00       	mov    $0x20,%esi
+{
+       d:	53                   	push   %ebx
+       e:	83 ec 2c             	sub    $0x2c,%esp
+  t0 = uptime();
+      11:	e8 92 07 00 00       	call   7a8 <uptime>
+      16:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  for(r = 0; r < NROUND; r++){
+      19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(pipe(p) < 0){
+      20:	83 ec 0c             	sub    $0xc,%esp
+      23:	57                   	push   %edi
+      24:	e8 f7 06 00 00       	call   720 <pipe>
+      29:	83 c4 10             	add    $0x10,%esp
+      2c:	85 c0                	test   %eax,%eax
+      2e:	0f 88 ec 00 00 00    	js     120 <feed+0x120>
+      printf(1, "splicebench: pipe failed\n");
+      exit();
+    }
+    if(fork() == 0){
+      34:	e8 97 04 00 00       	call   4d0 <fork>
+      39:	85 c0                	test   %eax,%eax
+      3b:	74 67                	je     a4 <feed+0xa4>
+        while((n = read(fd, buf, sizeof(buf))) > 0)
+          write(p[1], buf, n);
+      }
+      exit();
+    }
+    close(p[1]);
+      3d:	83 ec 0c             	sub    $0xc,%esp
+      40:	ff 75 e4             	push   -0x1c(%ebp)
+    for(got = 0; (n = read(p[0], buf, sizeof(buf))) > 0; got += n)
+      43:	31 db                	xor    %ebx,%ebx
+    close(p[1]);
+      45:	e8 06 06 00 00       	call   650 <close>
+    for(got = 0; (n = read(p[0], buf, sizeof(buf))) > 0; got += n)
+      4a:	83 c4 10             	add    $0x10,%esp
+      4d:	eb 03                	jmp    52 <feed+0x52>
+      4f:	90                   	nop
+      50:	01 c3                	add    %eax,%ebx
+      52:	83 ec 04             	sub    $0x4,%esp
+      55:	68 00 10 00 00       	push   $0x1000
+      5a:	68 20 22 00 00       	push   $0x2220
+      5f:	ff 75 e0             	push   -0x20(%ebp)
+      62:	e8 e9 04 00 00       	call   550 <read>
+      67:	83 c4 10             	add    $0x10,%esp
+      6a:	85 c0                	test   %eax,%eax
+      6c:	7f e2                	jg     50 <feed+0x50>
+      ;
+    close(p[0]);
+      6e:	83 ec 0c             	sub    $0xc,%esp
+      71:	ff 75 e0             	push   -0x20(%ebp)
+      74:	e8 d7 05 00 00       	call   650 <close>
+    wait();
+      79:	e8 9a 06 00 00       	call   718 <wait>
+    if(got != FILESZ){
+      7e:	83 c4 10             	add    $0x10,%esp
+      81:	81 fb 00 00 01 00    	cmp    $0x10000,%ebx
+      87:	0f 85 a7 00 00 00    	jne    134 <feed+0x134>
+  for(r = 0; r < NROUND; r++){
+      8d:	83 ee 01             	sub    $0x1,%esi
+      90:	75 8e                	jne    20 <feed+0x20>
+      printf(1, "splicebench: got %d bytes, expected %d\n", got, FILESZ);
+      exit();
+    }
+  }
+  return uptime() - t0;
+      92:	e8 11 07 00 00       	call   7a8 <uptime>
+      97:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+}
+      9a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      9d:	5b                   	pop    %ebx
+      9e:	5e                   	pop    %esi
+  return uptime() - t0;
+      9f:	29 d0                	sub    %edx,%eax
+}
+      a1:	5f                   	pop    %edi
+      a2:	5d                   	pop    %ebp
+      a3:	c3                   	ret
+      close(p[0]);
+      a4:	83 ec 0c             	sub    $0xc,%esp
+      a7:	ff 75 e0             	push   -0x20(%ebp)
+      aa:	e8 a1 05 00 00       	call   650 <close>
+      if((fd = open("splicefile", O_RDONLY)) < 0)
+      af:	5a                   	pop    %edx
+      b0:	59                   	pop    %ecx
+      b1:	6a 00                	push   $0x0
+      b3:	68 e2 10 00 00       	push   $0x10e2
+      b8:	e8 93 06 00 00       	call   750 <open>
+      bd:	83 c4 10             	add    $0x10,%esp
+      c0:	89 c3                	mov    %eax,%ebx
+      c2:	85 c0                	test   %eax,%eax
+      c4:	78 22                	js     e8 <feed+0xe8>
+      if(usesplice){
+      c6:	8b 45 08             	mov    0x8(%ebp),%eax
+      c9:	85 c0                	test   %eax,%eax
+      cb:	74 34                	je     101 <feed+0x101>
+      cd:	8d 76 00             	lea    0x0(%esi),%esi
+        while(splice(fd, p[1], sizeof(buf)) > 0)
+      d0:	83 ec 04             	sub    $0x4,%esp
+      d3:	68 00 10 00 00       	push   $0x1000
+      d8:	ff 75 e4             	push   -0x1c(%ebp)
+      db:	53                   	push   %ebx
+      dc:	e8 3f 07 00 00       	call   820 <splice>
+      e1:	83 c4 10             	add    $0x10,%esp
+      e4:	85 c0                	test   %eax,%eax
+      e6:	7f e8                	jg     d0 <feed+0xd0>
+        exit();
+      e8:	e8 13 04 00 00       	call   500 <exit>
+          write(p[1], buf, n);
+      ed:	83 ec 04             	sub    $0x4,%esp
+      f0:	50                   	push   %eax
+      f1:	68 20 22 00 00       	push   $0x2220
+      f6:	ff 75 e4             	push   -0x1c(%ebp)
+      f9:	e8 d2 04 00 00       	call   5d0 <write>
+      fe:	83 c4 10             	add    $0x10,%esp
+        while((n = read(fd, buf, sizeof(buf))) > 0)
+     101:	83 ec 04             	sub    $0x4,%esp
+     104:	68 00 10 00 00       	push   $0x1000
+     109:	68 20 22 00 00       	push   $0x2220
+     10e:	53                   	push   %ebx
+     10f:	e8 3c 04 00 00       	call   550 <read>
+     114:	83 c4 10             	add    $0x10,%esp
+     117:	85 c0                	test   %eax,%eax
+     119:	7f d2                	jg     ed <feed+0xed>
+        exit();
+     11b:	e8 e0 03 00 00       	call   500 <exit>
+      printf(1, "splicebench: pipe failed\n");
+     120:	83 ec 08             	sub    $0x8,%esp
+     123:	68 c8 10 00 00       	push   $0x10c8
+     128:	6a 01                	push   $0x1
+     12a:	e8 61 0b 00 00       	call   c90 <printf>
+      exit();
+     12f:	e8 cc 03 00 00       	call   500 <exit>
+      printf(1, "splicebench: got %d bytes, expected %d\n", got, FILESZ);
+     134:	68 00 00 01 00       	push   $0x10000
+     139:	53                   	push   %ebx
+     13a:	68 f0 10 00 00       	push   $0x10f0
+     13f:	6a 01                	push   $0x1
+     141:	e8 4a 0b 00 00       	call   c90 <printf>
+      exit();
+     146:	e8 b5 03 00 00       	call   500 <exit>
+     14b:	66 90                	xchg   %ax,%ax
+     14d:	66 90                	xchg   %ax,%ax
+     14f:	90                   	nop
+
+00000150 <main>:
+
+int
+main(int argc, char *argv[])
+{
+     150:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     154:	83 e4 f0             	and    $0xfffffff0,%esp
+     157:	ff 71 fc             	push   -0x4(%ecx)
+     15a:	55                   	push   %ebp
+     15b:	89 e5                	mov    %esp,%ebp
+     15d:	56                   	push   %esi
+     15e:	53                   	push   %ebx
+     15f:	51                   	push   %ecx
+     160:	83 ec 14             	sub    $0x14,%esp
+  int fd, i;
+
+  if((fd = open("splicefile", O_CREATE|O_RDWR)) < 0){
+     163:	68 02 02 00 00       	push   $0x202
+     168:	68 e2 10 00 00       	push   $0x10e2
+     16d:	e8 de 05 00 00       	call   750 <open>
+     172:	83 c4 10             	add    $0x10,%esp
+     175:	85 c0                	test   %eax,%eax
+     177:	0f 88 99 00 00 00    	js     216 <main+0xc6>
+    printf(1, "splicebench: cannot create splicefile\n");
+    exit();
+  }
+  memset(buf, 'x', sizeof(buf));
+     17d:	52                   	push   %edx
+     17e:	89 c6                	mov    %eax,%esi
+     180:	bb 10 00 00 00       	mov    $0x10,%ebx
+     185:	68 00 10 00 00       	push   $0x1000
+     18a:	6a 78                	push   $0x78
+     18c:	68 20 22 00 00       	push   $0x2220
+     191:	e8 5a 01 00 00       	call   2f0 <memset>
+     196:	83 c4 10             	add    $0x10,%esp
+     199:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; i < FILESZ/sizeof(buf); i++)
+    write(fd, buf, sizeof(buf));
+     1a0:	83 ec 04             	sub    $0x4,%esp
+     1a3:	68 00 10 00 00       	push   $0x1000
+     1a8:	68 20 22 00 00       	push   $0x2220
+     1ad:	56                   	push   %esi
+     1ae:	e8 1d 04 00 00       	call   5d0 <write>
+  for(i = 0; i < FILESZ/sizeof(buf); i++)
+     1b3:	83 c4 10             	add    $0x10,%esp
+     1b6:	83 eb 01             	sub    $0x1,%ebx
+     1b9:	75 e5                	jne    1a0 <main+0x50>
+  close(fd);
+     1bb:	83 ec 0c             	sub    $0xc,%esp
+     1be:	56                   	push   %esi
+     1bf:	e8 8c 04 00 00       	call   650 <close>
+
+  printf(1, "splicebench: read/write: %d ticks for %d x %d KB\n",
+     1c4:	31 c0                	xor    %eax,%eax
+     1c6:	89 04 24             	mov    %eax,(%esp)
+     1c9:	e8 32 fe ff ff       	call   0 <feed>
+     1ce:	c7 04 24 40 00 00 00 	movl   $0x40,(%esp)
+     1d5:	6a 20                	push   $0x20
+     1d7:	50                   	push   %eax
+     1d8:	68 40 11 00 00       	push   $0x1140
+     1dd:	6a 01                	push   $0x1
+     1df:	e8 ac 0a 00 00       	call   c90 <printf>
+         feed(0), NROUND, FILESZ/1024);
+  printf(1, "splicebench: splice: %d ticks for %d x %d KB\n",
+     1e4:	83 c4 14             	add    $0x14,%esp
+     1e7:	6a 01                	push   $0x1
+     1e9:	e8 12 fe ff ff       	call   0 <feed>
+     1ee:	c7 04 24 40 00 00 00 	movl   $0x40,(%esp)
+     1f5:	6a 20                	push   $0x20
+     1f7:	50                   	push   %eax
+     1f8:	68 74 11 00 00       	push   $0x1174
+     1fd:	6a 01                	push   $0x1
+     1ff:	e8 8c 0a 00 00       	call   c90 <printf>
+         feed(1), NROUND, FILESZ/1024);
+  unlink("splicefile");
+     204:	83 c4 14             	add    $0x14,%esp
+     207:	68 e2 10 00 00       	push   $0x10e2
+     20c:	e8 4f 05 00 00       	call   760 <unlink>
+  exit();
+     211:	e8 ea 02 00 00       	call   500 <exit>
+    printf(1, "splicebench: cannot create splicefile\n");
+     216:	51                   	push   %ecx
+     217:	51                   	push   %ecx
+     218:	68 18 11 00 00       	push   $0x1118
+     21d:	6a 01                	push   $0x1
+     21f:	e8 6c 0a 00 00       	call   c90 <printf>
+    exit();
+     224:	e8 d7 02 00 00       	call   500 <exit>
+     229:	66 90                	xchg   %ax,%ax
+     22b:	66 90                	xchg   %ax,%ax
+     22d:	66 90                	xchg   %ax,%ax
+     22f:	90                   	nop
+
+00000230 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     230:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     231:	31 c0                	xor    %eax,%eax
+{
+     233:	89 e5                	mov    %esp,%ebp
+     235:	53                   	push   %ebx
+     236:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     239:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     23c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     240:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     244:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     247:	83 c0 01             	add    $0x1,%eax
+     24a:	84 d2                	test   %dl,%dl
+     24c:	75 f2                	jne    240 <strcpy+0x10>
+    ;
+  return os;
+}
+     24e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     251:	89 c8                	mov    %ecx,%eax
+     253:	c9                   	leave
+     254:	c3                   	ret
+     255:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     25c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000260 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     260:	55                   	push   %ebp
+     261:	89 e5                	mov    %esp,%ebp
+     263:	53                   	push   %ebx
+     264:	8b 55 08             	mov    0x8(%ebp),%edx
+     267:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     26a:	0f b6 02             	movzbl (%edx),%eax
+     26d:	84 c0                	test   %al,%al
+     26f:	75 17                	jne    288 <strcmp+0x28>
+     271:	eb 3a                	jmp    2ad <strcmp+0x4d>
+     273:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     277:	90                   	nop
+     278:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     27c:	83 c2 01             	add    $0x1,%edx
+     27f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     282:	84 c0                	test   %al,%al
+     284:	74 1a                	je     2a0 <strcmp+0x40>
+    p++, q++;
+     286:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     288:	0f b6 19             	movzbl (%ecx),%ebx
+     28b:	38 c3                	cmp    %al,%bl
+     28d:	74 e9                	je     278 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     28f:	29 d8                	sub    %ebx,%eax
+}
+     291:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     294:	c9                   	leave
+     295:	c3                   	ret
+     296:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     29d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     2a0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     2a4:	31 c0                	xor    %eax,%eax
+     2a6:	29 d8                	sub    %ebx,%eax
+}
+     2a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     2ab:	c9                   	leave
+     2ac:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     2ad:	0f b6 19             	movzbl (%ecx),%ebx
+     2b0:	31 c0                	xor    %eax,%eax
+     2b2:	eb db                	jmp    28f <strcmp+0x2f>
+     2b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2bf:	90                   	nop
+
+000002c0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     2c0:	55                   	push   %ebp
+     2c1:	89 e5                	mov    %esp,%ebp
+     2c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     2c6:	80 3a 00             	cmpb   $0x0,(%edx)
+     2c9:	74 15                	je     2e0 <strlen+0x20>
+     2cb:	31 c0                	xor    %eax,%eax
+     2cd:	8d 76 00             	lea    0x0(%esi),%esi
+     2d0:	83 c0 01             	add    $0x1,%eax
+     2d3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     2d7:	89 c1                	mov    %eax,%ecx
+     2d9:	75 f5                	jne    2d0 <strlen+0x10>
+    ;
+  return n;
+}
+     2db:	89 c8                	mov    %ecx,%eax
+     2dd:	5d                   	pop    %ebp
+     2de:	c3                   	ret
+     2df:	90                   	nop
+  for(n = 0; s[n]; n++)
+     2e0:	31 c9                	xor    %ecx,%ecx
+}
+     2e2:	5d                   	pop    %ebp
+     2e3:	89 c8                	mov    %ecx,%eax
+     2e5:	c3                   	ret
+     2e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002f0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     2f0:	55                   	push   %ebp
+     2f1:	89 e5                	mov    %esp,%ebp
+     2f3:	57                   	push   %edi
+     2f4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     2f7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     2fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+     2fd:	89 d7                	mov    %edx,%edi
+     2ff:	fc                   	cld
+     300:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     302:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     305:	89 d0                	mov    %edx,%eax
+     307:	c9                   	leave
+     308:	c3                   	ret
+     309:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000310 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     310:	55                   	push   %ebp
+     311:	89 e5                	mov    %esp,%ebp
+     313:	56                   	push   %esi
+     314:	53                   	push   %ebx
+     315:	8b 75 10             	mov    0x10(%ebp),%esi
+     318:	8b 55 08             	mov    0x8(%ebp),%edx
+     31b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+     31e:	85 f6                	test   %esi,%esi
+     320:	74 2e                	je     350 <memcmp+0x40>
+     322:	01 c6                	add    %eax,%esi
+     324:	eb 14                	jmp    33a <memcmp+0x2a>
+     326:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     32d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+     330:	83 c0 01             	add    $0x1,%eax
+     333:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+     336:	39 f0                	cmp    %esi,%eax
+     338:	74 16                	je     350 <memcmp+0x40>
+    if(*s1 != *s2)
+     33a:	0f b6 0a             	movzbl (%edx),%ecx
+     33d:	0f b6 18             	movzbl (%eax),%ebx
+     340:	38 d9                	cmp    %bl,%cl
+     342:	74 ec                	je     330 <memcmp+0x20>
+      return *s1 - *s2;
+     344:	0f b6 c1             	movzbl %cl,%eax
+     347:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+     349:	5b                   	pop    %ebx
+     34a:	5e                   	pop    %esi
+     34b:	5d                   	pop    %ebp
+     34c:	c3                   	ret
+     34d:	8d 76 00             	lea    0x0(%esi),%esi
+     350:	5b                   	pop    %ebx
+  return 0;
+     351:	31 c0                	xor    %eax,%eax
+}
+     353:	5e                   	pop    %esi
+     354:	5d                   	pop    %ebp
+     355:	c3                   	ret
+     356:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     35d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000360 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     360:	55                   	push   %ebp
+     361:	89 e5                	mov    %esp,%ebp
+     363:	8b 45 08             	mov    0x8(%ebp),%eax
+     366:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     36a:	0f b6 10             	movzbl (%eax),%edx
+     36d:	84 d2                	test   %dl,%dl
+     36f:	75 12                	jne    383 <strchr+0x23>
+     371:	eb 1d                	jmp    390 <strchr+0x30>
+     373:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     377:	90                   	nop
+     378:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     37c:	83 c0 01             	add    $0x1,%eax
+     37f:	84 d2                	test   %dl,%dl
+     381:	74 0d                	je     390 <strchr+0x30>
+    if(*s == c)
+     383:	38 d1                	cmp    %dl,%cl
+     385:	75 f1                	jne    378 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     387:	5d                   	pop    %ebp
+     388:	c3                   	ret
+     389:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     390:	31 c0                	xor    %eax,%eax
+}
+     392:	5d                   	pop    %ebp
+     393:	c3                   	ret
+     394:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     39b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     39f:	90                   	nop
+
+000003a0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     3a0:	55                   	push   %ebp
+     3a1:	89 e5                	mov    %esp,%ebp
+     3a3:	57                   	push   %edi
+     3a4:	56                   	push   %esi
+int
+read(int fd, void *buf, int n)
+{
+  if(flushhook)
+    flushhook();
+  return _read(fd, buf, n);
+     3a5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     3a8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     3a9:	31 db                	xor    %ebx,%ebx
+{
+     3ab:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     3ae:	eb 32                	jmp    3e2 <gets+0x42>
+  if(flushhook)
+     3b0:	a1 20 32 00 00       	mov    0x3220,%eax
+     3b5:	85 c0                	test   %eax,%eax
+     3b7:	74 02                	je     3bb <gets+0x1b>
+    flushhook();
+     3b9:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+     3bb:	83 ec 04             	sub    $0x4,%esp
+     3be:	6a 01                	push   $0x1
+     3c0:	56                   	push   %esi
+     3c1:	6a 00                	push   $0x0
+     3c3:	e8 60 03 00 00       	call   728 <_read>
+    if(cc < 1)
+     3c8:	83 c4 10             	add    $0x10,%esp
+     3cb:	85 c0                	test   %eax,%eax
+     3cd:	7e 1d                	jle    3ec <gets+0x4c>
+    buf[i++] = c;
+     3cf:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     3d3:	8b 55 08             	mov    0x8(%ebp),%edx
+     3d6:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     3da:	3c 0a                	cmp    $0xa,%al
+     3dc:	74 10                	je     3ee <gets+0x4e>
+     3de:	3c 0d                	cmp    $0xd,%al
+     3e0:	74 0c                	je     3ee <gets+0x4e>
+  for(i=0; i+1 < max; ){
+     3e2:	89 df                	mov    %ebx,%edi
+     3e4:	83 c3 01             	add    $0x1,%ebx
+     3e7:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     3ea:	7c c4                	jl     3b0 <gets+0x10>
+     3ec:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+     3ee:	8b 45 08             	mov    0x8(%ebp),%eax
+     3f1:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+     3f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     3f8:	5b                   	pop    %ebx
+     3f9:	5e                   	pop    %esi
+     3fa:	5f                   	pop    %edi
+     3fb:	5d                   	pop    %ebp
+     3fc:	c3                   	ret
+     3fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000400 <stat>:
+{
+     400:	55                   	push   %ebp
+     401:	89 e5                	mov    %esp,%ebp
+     403:	56                   	push   %esi
+     404:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+     405:	83 ec 08             	sub    $0x8,%esp
+     408:	6a 00                	push   $0x0
+     40a:	ff 75 08             	push   0x8(%ebp)
+     40d:	e8 3e 03 00 00       	call   750 <open>
+  if(fd < 0)
+     412:	83 c4 10             	add    $0x10,%esp
+     415:	85 c0                	test   %eax,%eax
+     417:	78 37                	js     450 <stat+0x50>
+  r = fstat(fd, st);
+     419:	83 ec 08             	sub    $0x8,%esp
+     41c:	ff 75 0c             	push   0xc(%ebp)
+     41f:	89 c3                	mov    %eax,%ebx
+     421:	50                   	push   %eax
+     422:	e8 41 03 00 00       	call   768 <fstat>
+}
+
+int
+close(int fd)
+{
+  if(flushhook)
+     427:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+     42a:	89 c6                	mov    %eax,%esi
+  if(flushhook)
+     42c:	a1 20 32 00 00       	mov    0x3220,%eax
+     431:	85 c0                	test   %eax,%eax
+     433:	74 02                	je     437 <stat+0x37>
+    flushhook();
+     435:	ff d0                	call   *%eax
+  return _close(fd);
+     437:	83 ec 0c             	sub    $0xc,%esp
+     43a:	53                   	push   %ebx
+     43b:	e8 f8 02 00 00       	call   738 <_close>
+     440:	83 c4 10             	add    $0x10,%esp
+}
+     443:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     446:	89 f0                	mov    %esi,%eax
+     448:	5b                   	pop    %ebx
+     449:	5e                   	pop    %esi
+     44a:	5d                   	pop    %ebp
+     44b:	c3                   	ret
+     44c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+     450:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     455:	eb ec                	jmp    443 <stat+0x43>
+     457:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     45e:	66 90                	xchg   %ax,%ax
+
+00000460 <atoi>:
+{
+     460:	55                   	push   %ebp
+     461:	89 e5                	mov    %esp,%ebp
+     463:	53                   	push   %ebx
+     464:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+     467:	0f be 02             	movsbl (%edx),%eax
+     46a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     46d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     470:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     475:	77 1e                	ja     495 <atoi+0x35>
+     477:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     47e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     480:	83 c2 01             	add    $0x1,%edx
+     483:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     486:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     48a:	0f be 02             	movsbl (%edx),%eax
+     48d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     490:	80 fb 09             	cmp    $0x9,%bl
+     493:	76 eb                	jbe    480 <atoi+0x20>
+}
+     495:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     498:	89 c8                	mov    %ecx,%eax
+     49a:	c9                   	leave
+     49b:	c3                   	ret
+     49c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004a0 <memmove>:
+{
+     4a0:	55                   	push   %ebp
+     4a1:	89 e5                	mov    %esp,%ebp
+     4a3:	57                   	push   %edi
+     4a4:	56                   	push   %esi
+     4a5:	8b 45 10             	mov    0x10(%ebp),%eax
+     4a8:	8b 55 08             	mov    0x8(%ebp),%edx
+     4ab:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+     4ae:	85 c0                	test   %eax,%eax
+     4b0:	7e 13                	jle    4c5 <memmove+0x25>
+     4b2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     4b4:	89 d7                	mov    %edx,%edi
+     4b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4bd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     4c0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     4c1:	39 f8                	cmp    %edi,%eax
+     4c3:	75 fb                	jne    4c0 <memmove+0x20>
+}
+     4c5:	5e                   	pop    %esi
+     4c6:	89 d0                	mov    %edx,%eax
+     4c8:	5f                   	pop    %edi
+     4c9:	5d                   	pop    %ebp
+     4ca:	c3                   	ret
+     4cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     4cf:	90                   	nop
+
+000004d0 <fork>:
+  if(flushhook)
+     4d0:	a1 20 32 00 00       	mov    0x3220,%eax
+     4d5:	85 c0                	test   %eax,%eax
+     4d7:	74 17                	je     4f0 <fork+0x20>
+{
+     4d9:	55                   	push   %ebp
+     4da:	89 e5                	mov    %esp,%ebp
+     4dc:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+     4df:	ff d0                	call   *%eax
+}
+     4e1:	c9                   	leave
+  return _fork();
+     4e2:	e9 21 02 00 00       	jmp    708 <_fork>
+     4e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4ee:	66 90                	xchg   %ax,%ax
+     4f0:	e9 13 02 00 00       	jmp    708 <_fork>
+     4f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000500 <exit>:
+{
+     500:	55                   	push   %ebp
+     501:	89 e5                	mov    %esp,%ebp
+     503:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+     506:	a1 20 32 00 00       	mov    0x3220,%eax
+     50b:	85 c0                	test   %eax,%eax
+     50d:	74 02                	je     511 <exit+0x11>
+    flushhook();
+     50f:	ff d0                	call   *%eax
+  _exit();
+     511:	e8 fa 01 00 00       	call   710 <_exit>
+     516:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     51d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000520 <exec>:
+{
+     520:	55                   	push   %ebp
+  if(flushhook)
+     521:	a1 20 32 00 00       	mov    0x3220,%eax
+{
+     526:	89 e5                	mov    %esp,%ebp
+     528:	56                   	push   %esi
+     529:	53                   	push   %ebx
+     52a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     52d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+     530:	85 c0                	test   %eax,%eax
+     532:	74 02                	je     536 <exec+0x16>
+    flushhook();
+     534:	ff d0                	call   *%eax
+  return _exec(path, argv);
+     536:	89 75 0c             	mov    %esi,0xc(%ebp)
+     539:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     53c:	5b                   	pop    %ebx
+     53d:	5e                   	pop    %esi
+     53e:	5d                   	pop    %ebp
+  return _exec(path, argv);
+     53f:	e9 04 02 00 00       	jmp    748 <_exec>
+     544:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     54b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     54f:	90                   	nop
+
+00000550 <read>:
+{
+     550:	55                   	push   %ebp
+     551:	89 e5                	mov    %esp,%ebp
+     553:	57                   	push   %edi
+     554:	56                   	push   %esi
+     555:	53                   	push   %ebx
+     556:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     559:	a1 20 32 00 00       	mov    0x3220,%eax
+{
+     55e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     561:	8b 75 0c             	mov    0xc(%ebp),%esi
+     564:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     567:	85 c0                	test   %eax,%eax
+     569:	74 02                	je     56d <read+0x1d>
+    flushhook();
+     56b:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+     56d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     570:	89 75 0c             	mov    %esi,0xc(%ebp)
+     573:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     576:	83 c4 0c             	add    $0xc,%esp
+     579:	5b                   	pop    %ebx
+     57a:	5e                   	pop    %esi
+     57b:	5f                   	pop    %edi
+     57c:	5d                   	pop    %ebp
+  return _read(fd, buf, n);
+     57d:	e9 a6 01 00 00       	jmp    728 <_read>
+     582:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     589:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000590 <readv>:
+{
+     590:	55                   	push   %ebp
+     591:	89 e5                	mov    %esp,%ebp
+     593:	57                   	push   %edi
+     594:	56                   	push   %esi
+     595:	53                   	push   %ebx
+     596:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     599:	a1 20 32 00 00       	mov    0x3220,%eax
+{
+     59e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     5a1:	8b 75 0c             	mov    0xc(%ebp),%esi
+     5a4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     5a7:	85 c0                	test   %eax,%eax
+     5a9:	74 02                	je     5ad <readv+0x1d>
+    flushhook();
+     5ab:	ff d0                	call   *%eax
+  return _readv(fd, iov, cnt);
+     5ad:	89 7d 10             	mov    %edi,0x10(%ebp)
+     5b0:	89 75 0c             	mov    %esi,0xc(%ebp)
+     5b3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     5b6:	83 c4 0c             	add    $0xc,%esp
+     5b9:	5b                   	pop    %ebx
+     5ba:	5e                   	pop    %esi
+     5bb:	5f                   	pop    %edi
+     5bc:	5d                   	pop    %ebp
+  return _readv(fd, iov, cnt);
+     5bd:	e9 76 02 00 00       	jmp    838 <_readv>
+     5c2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000005d0 <write>:
+{
+     5d0:	55                   	push   %ebp
+     5d1:	89 e5                	mov    %esp,%ebp
+     5d3:	57                   	push   %edi
+     5d4:	56                   	push   %esi
+     5d5:	53                   	push   %ebx
+     5d6:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     5d9:	a1 20 32 00 00       	mov    0x3220,%eax
+{
+     5de:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     5e1:	8b 75 0c             	mov    0xc(%ebp),%esi
+     5e4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     5e7:	85 c0                	test   %eax,%eax
+     5e9:	74 02                	je     5ed <write+0x1d>
+    flushhook();
+     5eb:	ff d0                	call   *%eax
+  return _write(fd, buf, n);
+     5ed:	89 7d 10             	mov    %edi,0x10(%ebp)
+     5f0:	89 75 0c             	mov    %esi,0xc(%ebp)
+     5f3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     5f6:	83 c4 0c             	add    $0xc,%esp
+     5f9:	5b                   	pop    %ebx
+     5fa:	5e                   	pop    %esi
+     5fb:	5f                   	pop    %edi
+     5fc:	5d                   	pop    %ebp
+  return _write(fd, buf, n);
+     5fd:	e9 2e 01 00 00       	jmp    730 <_write>
+     602:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     609:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000610 <writev>:
+{
+     610:	55                   	push   %ebp
+     611:	89 e5                	mov    %esp,%ebp
+     613:	57                   	push   %edi
+     614:	56                   	push   %esi
+     615:	53                   	push   %ebx
+     616:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     619:	a1 20 32 00 00       	mov    0x3220,%eax
+{
+     61e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     621:	8b 75 0c             	mov    0xc(%ebp),%esi
+     624:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     627:	85 c0                	test   %eax,%eax
+     629:	74 02                	je     62d <writev+0x1d>
+    flushhook();
+     62b:	ff d0                	call   *%eax
+  return _writev(fd, iov, cnt);
+     62d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     630:	89 75 0c             	mov    %esi,0xc(%ebp)
+     633:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     636:	83 c4 0c             	add    $0xc,%esp
+     639:	5b                   	pop    %ebx
+     63a:	5e                   	pop    %esi
+     63b:	5f                   	pop    %edi
+     63c:	5d                   	pop    %ebp
+  return _writev(fd, iov, cnt);
+     63d:	e9 fe 01 00 00       	jmp    840 <_writev>
+     642:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     649:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000650 <close>:
+{
+     650:	55                   	push   %ebp
+     651:	89 e5                	mov    %esp,%ebp
+     653:	53                   	push   %ebx
+     654:	83 ec 04             	sub    $0x4,%esp
+  if(flushhook)
+     657:	a1 20 32 00 00       	mov    0x3220,%eax
+{
+     65c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(flushhook)
+     65f:	85 c0                	test   %eax,%eax
+     661:	74 02                	je     665 <close+0x15>
+    flushhook();
+     663:	ff d0                	call   *%eax
+  return _close(fd);
+     665:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     668:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     66b:	c9                   	leave
+  return _close(fd);
+     66c:	e9 c7 00 00 00       	jmp    738 <_close>
+     671:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     678:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     67f:	90                   	nop
+
+00000680 <umtxinit>:
+// process that finds the mutex held enters the kernel, to sleep
+// in futexwait() until the holder's umtxunlock() wakes it.
+
+void
+umtxinit(struct umutex *m)
+{
+     680:	55                   	push   %ebp
+     681:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+     683:	8b 45 08             	mov    0x8(%ebp),%eax
+     686:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     68c:	5d                   	pop    %ebp
+     68d:	c3                   	ret
+     68e:	66 90                	xchg   %ax,%ax
+
+00000690 <umtxlock>:
+
+void
+umtxlock(struct umutex *m)
+{
+     690:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+     691:	b8 01 00 00 00       	mov    $0x1,%eax
+     696:	89 e5                	mov    %esp,%ebp
+     698:	56                   	push   %esi
+     699:	53                   	push   %ebx
+     69a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     69d:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 1) == 0)
+     6a0:	85 c0                	test   %eax,%eax
+     6a2:	74 2b                	je     6cf <umtxlock+0x3f>
+     6a4:	b8 02 00 00 00       	mov    $0x2,%eax
+     6a9:	f0 87 03             	lock xchg %eax,(%ebx)
+    return;
+  // Mark the mutex contended, so that its holder
+  // wakes a waiter on release, and wait.
+  while(xchg(&m->state, 2) != 0)
+     6ac:	85 c0                	test   %eax,%eax
+     6ae:	74 1f                	je     6cf <umtxlock+0x3f>
+     6b0:	be 02 00 00 00       	mov    $0x2,%esi
+     6b5:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwait(&m->state, 2);
+     6b8:	83 ec 08             	sub    $0x8,%esp
+     6bb:	6a 02                	push   $0x2
+     6bd:	53                   	push   %ebx
+     6be:	e8 85 01 00 00       	call   848 <futexwait>
+     6c3:	89 f0                	mov    %esi,%eax
+     6c5:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+     6c8:	83 c4 10             	add    $0x10,%esp
+     6cb:	85 c0                	test   %eax,%eax
+     6cd:	75 e9                	jne    6b8 <umtxlock+0x28>
+}
+     6cf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     6d2:	5b                   	pop    %ebx
+     6d3:	5e                   	pop    %esi
+     6d4:	5d                   	pop    %ebp
+     6d5:	c3                   	ret
+     6d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000006e0 <umtxunlock>:
+
+void
+umtxunlock(struct umutex *m)
+{
+     6e0:	55                   	push   %ebp
+     6e1:	31 c0                	xor    %eax,%eax
+     6e3:	89 e5                	mov    %esp,%ebp
+     6e5:	83 ec 08             	sub    $0x8,%esp
+     6e8:	8b 55 08             	mov    0x8(%ebp),%edx
+     6eb:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+     6ee:	83 f8 02             	cmp    $0x2,%eax
+     6f1:	74 05                	je     6f8 <umtxunlock+0x18>
+    futexwake(&m->state, 1);
+}
+     6f3:	c9                   	leave
+     6f4:	c3                   	ret
+     6f5:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwake(&m->state, 1);
+     6f8:	83 ec 08             	sub    $0x8,%esp
+     6fb:	6a 01                	push   $0x1
+     6fd:	52                   	push   %edx
+     6fe:	e8 4d 01 00 00       	call   850 <futexwake>
+     703:	83 c4 10             	add    $0x10,%esp
+}
+     706:	c9                   	leave
+     707:	c3                   	ret
+
+00000708 <_fork>:
+  _ ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+     708:	b8 01 00 00 00       	mov    $0x1,%eax
+     70d:	cd 40                	int    $0x40
+     70f:	c3                   	ret
+
+00000710 <_exit>:
+RAWSYSCALL(exit)
+     710:	b8 02 00 00 00       	mov    $0x2,%eax
+     715:	cd 40                	int    $0x40
+     717:	c3                   	ret
+
+00000718 <wait>:
+SYSCALL(wait)
+     718:	b8 03 00 00 00       	mov    $0x3,%eax
+     71d:	cd 40                	int    $0x40
+     71f:	c3                   	ret
+
+00000720 <pipe>:
+SYSCALL(pipe)
+     720:	b8 04 00 00 00       	mov    $0x4,%eax
+     725:	cd 40                	int    $0x40
+     727:	c3                   	ret
+
+00000728 <_read>:
+RAWSYSCALL(read)
+     728:	b8 05 00 00 00       	mov    $0x5,%eax
+     72d:	cd 40                	int    $0x40
+     72f:	c3                   	ret
+
+00000730 <_write>:
+RAWSYSCALL(write)
+     730:	b8 10 00 00 00       	mov    $0x10,%eax
+     735:	cd 40                	int    $0x40
+     737:	c3                   	ret
+
+00000738 <_close>:
+RAWSYSCALL(close)
+     738:	b8 15 00 00 00       	mov    $0x15,%eax
+     73d:	cd 40                	int    $0x40
+     73f:	c3                   	ret
+
+00000740 <kill>:
+SYSCALL(kill)
+     740:	b8 06 00 00 00       	mov    $0x6,%eax
+     745:	cd 40                	int    $0x40
+     747:	c3                   	ret
+
+00000748 <_exec>:
+RAWSYSCALL(exec)
+     748:	b8 07 00 00 00       	mov    $0x7,%eax
+     74d:	cd 40                	int    $0x40
+     74f:	c3                   	ret
+
+00000750 <open>:
+SYSCALL(open)
+     750:	b8 0f 00 00 00       	mov    $0xf,%eax
+     755:	cd 40                	int    $0x40
+     757:	c3                   	ret
+
+00000758 <mknod>:
+SYSCALL(mknod)
+     758:	b8 11 00 00 00       	mov    $0x11,%eax
+     75d:	cd 40                	int    $0x40
+     75f:	c3                   	ret
+
+00000760 <unlink>:
+SYSCALL(unlink)
+     760:	b8 12 00 00 00       	mov    $0x12,%eax
+     765:	cd 40                	int    $0x40
+     767:	c3                   	ret
+
+00000768 <fstat>:
+SYSCALL(fstat)
+     768:	b8 08 00 00 00       	mov    $0x8,%eax
+     76d:	cd 40                	int    $0x40
+     76f:	c3                   	ret
+
+00000770 <link>:
+SYSCALL(link)
+     770:	b8 13 00 00 00       	mov    $0x13,%eax
+     775:	cd 40                	int    $0x40
+     777:	c3                   	ret
+
+00000778 <mkdir>:
+SYSCALL(mkdir)
+     778:	b8 14 00 00 00       	mov    $0x14,%eax
+     77d:	cd 40                	int    $0x40
+     77f:	c3                   	ret
+
+00000780 <chdir>:
+SYSCALL(chdir)
+     780:	b8 09 00 00 00       	mov    $0x9,%eax
+     785:	cd 40                	int    $0x40
+     787:	c3                   	ret
+
+00000788 <dup>:
+SYSCALL(dup)
+     788:	b8 0a 00 00 00       	mov    $0xa,%eax
+     78d:	cd 40                	int    $0x40
+     78f:	c3                   	ret
+
+00000790 <getpid>:
+SYSCALL(getpid)
+     790:	b8 0b 00 00 00       	mov    $0xb,%eax
+     795:	cd 40                	int    $0x40
+     797:	c3                   	ret
+
+00000798 <sbrk>:
+SYSCALL(sbrk)
+     798:	b8 0c 00 00 00       	mov    $0xc,%eax
+     79d:	cd 40                	int    $0x40
+     79f:	c3                   	ret
+
+000007a0 <sleep>:
+SYSCALL(sleep)
+     7a0:	b8 0d 00 00 00       	mov    $0xd,%eax
+     7a5:	cd 40                	int    $0x40
+     7a7:	c3                   	ret
+
+000007a8 <uptime>:
+SYSCALL(uptime)
+     7a8:	b8 0e 00 00 00       	mov    $0xe,%eax
+     7ad:	cd 40                	int    $0x40
+     7af:	c3                   	ret
+
+000007b0 <wolfie>:
+SYSCALL(wolfie)
+     7b0:	b8 16 00 00 00       	mov    $0x16,%eax
+     7b5:	cd 40                	int    $0x40
+     7b7:	c3                   	ret
+
+000007b8 <nice>:
+SYSCALL(nice)
+     7b8:	b8 17 00 00 00       	mov    $0x17,%eax
+     7bd:	cd 40                	int    $0x40
+     7bf:	c3                   	ret
+
+000007c0 <mtxget>:
+SYSCALL(mtxget)
+     7c0:	b8 18 00 00 00       	mov    $0x18,%eax
+     7c5:	cd 40                	int    $0x40
+     7c7:	c3                   	ret
+
+000007c8 <mtxrel>:
+SYSCALL(mtxrel)
+     7c8:	b8 19 00 00 00       	mov    $0x19,%eax
+     7cd:	cd 40                	int    $0x40
+     7cf:	c3                   	ret
+
+000007d0 <mtxacq>:
+SYSCALL(mtxacq)
+     7d0:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     7d5:	cd 40                	int    $0x40
+     7d7:	c3                   	ret
+
+000007d8 <mtxdel>:
+SYSCALL(mtxdel)
+     7d8:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     7dd:	cd 40                	int    $0x40
+     7df:	c3                   	ret
+
+000007e0 <iostat>:
+SYSCALL(iostat)
+     7e0:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     7e5:	cd 40                	int    $0x40
+     7e7:	c3                   	ret
+
+000007e8 <mmap>:
+SYSCALL(mmap)
+     7e8:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     7ed:	cd 40                	int    $0x40
+     7ef:	c3                   	ret
+
+000007f0 <munmap>:
+SYSCALL(munmap)
+     7f0:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     7f5:	cd 40                	int    $0x40
+     7f7:	c3                   	ret
+
+000007f8 <shmget>:
+SYSCALL(shmget)
+     7f8:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     7fd:	cd 40                	int    $0x40
+     7ff:	c3                   	ret
+
+00000800 <shmat>:
+SYSCALL(shmat)
+     800:	b8 20 00 00 00       	mov    $0x20,%eax
+     805:	cd 40                	int    $0x40
+     807:	c3                   	ret
+
+00000808 <shmdt>:
+SYSCALL(shmdt)
+     808:	b8 21 00 00 00       	mov    $0x21,%eax
+     80d:	cd 40                	int    $0x40
+     80f:	c3                   	ret
+
+00000810 <shmdel>:
+SYSCALL(shmdel)
+     810:	b8 22 00 00 00       	mov    $0x22,%eax
+     815:	cd 40                	int    $0x40
+     817:	c3                   	ret
+
+00000818 <syscount>:
+SYSCALL(syscount)
+     818:	b8 23 00 00 00       	mov    $0x23,%eax
+     81d:	cd 40                	int    $0x40
+     81f:	c3                   	ret
+
+00000820 <splice>:
+SYSCALL(splice)
+     820:	b8 24 00 00 00       	mov    $0x24,%eax
+     825:	cd 40                	int    $0x40
+     827:	c3                   	ret
+
+00000828 <tee>:
+SYSCALL(tee)
+     828:	b8 25 00 00 00       	mov    $0x25,%eax
+     82d:	cd 40                	int    $0x40
+     82f:	c3                   	ret
+
+00000830 <sendfile>:
+SYSCALL(sendfile)
+     830:	b8 26 00 00 00       	mov    $0x26,%eax
+     835:	cd 40                	int    $0x40
+     837:	c3                   	ret
+
+00000838 <_readv>:
+RAWSYSCALL(readv)
+     838:	b8 27 00 00 00       	mov    $0x27,%eax
+     83d:	cd 40                	int    $0x40
+     83f:	c3                   	ret
+
+00000840 <_writev>:
+RAWSYSCALL(writev)
+     840:	b8 28 00 00 00       	mov    $0x28,%eax
+     845:	cd 40                	int    $0x40
+     847:	c3                   	ret
+
+00000848 <futexwait>:
+SYSCALL(futexwait)
+     848:	b8 29 00 00 00       	mov    $0x29,%eax
+     84d:	cd 40                	int    $0x40
+     84f:	c3                   	ret
+
+00000850 <futexwake>:
+SYSCALL(futexwake)
+     850:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     855:	cd 40                	int    $0x40
+     857:	c3                   	ret
+
+00000858 <lockstat>:
+SYSCALL(lockstat)
+     858:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     85d:	cd 40                	int    $0x40
+     85f:	c3                   	ret
+
+00000860 <clone>:
+SYSCALL(clone)
+     860:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     865:	cd 40                	int    $0x40
+     867:	c3                   	ret
+
+00000868 <join>:
+SYSCALL(join)
+     868:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     86d:	cd 40                	int    $0x40
+     86f:	c3                   	ret
+
+00000870 <stacklimit>:
+SYSCALL(stacklimit)
+     870:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     875:	cd 40                	int    $0x40
+     877:	c3                   	ret
+     878:	66 90                	xchg   %ax,%ax
+     87a:	66 90                	xchg   %ax,%ax
+     87c:	66 90                	xchg   %ax,%ax
+     87e:	66 90                	xchg   %ax,%ax
+
+00000880 <flushall>:
+  b->n = 0;
+}
+
+static void
+flushall(void)
+{
+     880:	55                   	push   %ebp
+     881:	89 e5                	mov    %esp,%ebp
+     883:	83 ec 14             	sub    $0x14,%esp
+  umtxlock(&stdoutlock);
+     886:	68 24 32 00 00       	push   $0x3224
+     88b:	e8 00 fe ff ff       	call   690 <umtxlock>
+  if(b->n > 0)
+     890:	a1 08 20 00 00       	mov    0x2008,%eax
+     895:	83 c4 10             	add    $0x10,%esp
+     898:	85 c0                	test   %eax,%eax
+     89a:	7e 17                	jle    8b3 <flushall+0x33>
+    _write(b->fd, b->buf, b->n);
+     89c:	83 ec 04             	sub    $0x4,%esp
+     89f:	50                   	push   %eax
+     8a0:	68 0c 20 00 00       	push   $0x200c
+     8a5:	ff 35 00 20 00 00    	push   0x2000
+     8ab:	e8 80 fe ff ff       	call   730 <_write>
+     8b0:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     8b3:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     8ba:	00 00 00 
+  flush(&stdout);
+  umtxunlock(&stdoutlock);
+     8bd:	83 ec 0c             	sub    $0xc,%esp
+     8c0:	68 24 32 00 00       	push   $0x3224
+     8c5:	e8 16 fe ff ff       	call   6e0 <umtxunlock>
+}
+     8ca:	83 c4 10             	add    $0x10,%esp
+     8cd:	c9                   	leave
+     8ce:	c3                   	ret
+     8cf:	90                   	nop
+
+000008d0 <printint>:
+    flush(b);
+}
+
+static void
+printint(struct outbuf *b, int xx, int base, int sgn)
+{
+     8d0:	55                   	push   %ebp
+     8d1:	89 e5                	mov    %esp,%ebp
+     8d3:	57                   	push   %edi
+     8d4:	89 cf                	mov    %ecx,%edi
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     8d6:	89 d1                	mov    %edx,%ecx
+{
+     8d8:	56                   	push   %esi
+     8d9:	53                   	push   %ebx
+     8da:	89 c3                	mov    %eax,%ebx
+     8dc:	83 ec 2c             	sub    $0x2c,%esp
+  if(sgn && xx < 0){
+     8df:	85 d2                	test   %edx,%edx
+     8e1:	0f 89 b9 00 00 00    	jns    9a0 <printint+0xd0>
+     8e7:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     8eb:	0f 84 af 00 00 00    	je     9a0 <printint+0xd0>
+    x = -xx;
+     8f1:	f7 d9                	neg    %ecx
+    neg = 1;
+     8f3:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     8f8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     8fb:	31 f6                	xor    %esi,%esi
+     8fd:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     900:	89 c8                	mov    %ecx,%eax
+     902:	31 d2                	xor    %edx,%edx
+     904:	89 f3                	mov    %esi,%ebx
+     906:	f7 f7                	div    %edi
+     908:	8d 76 01             	lea    0x1(%esi),%esi
+     90b:	0f b6 92 dc 15 00 00 	movzbl 0x15dc(%edx),%edx
+     912:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     916:	89 ca                	mov    %ecx,%edx
+     918:	89 c1                	mov    %eax,%ecx
+     91a:	39 fa                	cmp    %edi,%edx
+     91c:	73 e2                	jae    900 <printint+0x30>
+  if(neg)
+     91e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     921:	89 d9                	mov    %ebx,%ecx
+     923:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     926:	85 c0                	test   %eax,%eax
+     928:	74 07                	je     931 <printint+0x61>
+    buf[i++] = '-';
+     92a:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     92f:	89 f1                	mov    %esi,%ecx
+     931:	8d 75 d8             	lea    -0x28(%ebp),%esi
+     934:	89 cf                	mov    %ecx,%edi
+     936:	01 f7                	add    %esi,%edi
+     938:	eb 1a                	jmp    954 <printint+0x84>
+     93a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    *b->str++ = c;
+     940:	8d 48 01             	lea    0x1(%eax),%ecx
+     943:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+     949:	88 10                	mov    %dl,(%eax)
+
+  while(--i >= 0)
+     94b:	8d 47 ff             	lea    -0x1(%edi),%eax
+     94e:	39 fe                	cmp    %edi,%esi
+     950:	74 40                	je     992 <printint+0xc2>
+     952:	89 c7                	mov    %eax,%edi
+  if(b->str){
+     954:	8b 83 0c 02 00 00    	mov    0x20c(%ebx),%eax
+    putc(b, buf[i]);
+     95a:	0f b6 17             	movzbl (%edi),%edx
+  if(b->str){
+     95d:	85 c0                	test   %eax,%eax
+     95f:	75 df                	jne    940 <printint+0x70>
+  b->buf[b->n++] = c;
+     961:	8b 4b 08             	mov    0x8(%ebx),%ecx
+     964:	8d 41 01             	lea    0x1(%ecx),%eax
+     967:	89 43 08             	mov    %eax,0x8(%ebx)
+     96a:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+     96e:	3d 00 02 00 00       	cmp    $0x200,%eax
+     973:	74 3b                	je     9b0 <printint+0xe0>
+     975:	80 fa 0a             	cmp    $0xa,%dl
+     978:	75 d1                	jne    94b <printint+0x7b>
+     97a:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+     97e:	75 cb                	jne    94b <printint+0x7b>
+  if(b->n > 0)
+     980:	85 c0                	test   %eax,%eax
+     982:	7f 2c                	jg     9b0 <printint+0xe0>
+  b->n = 0;
+     984:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  while(--i >= 0)
+     98b:	8d 47 ff             	lea    -0x1(%edi),%eax
+     98e:	39 fe                	cmp    %edi,%esi
+     990:	75 c0                	jne    952 <printint+0x82>
+}
+     992:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     995:	5b                   	pop    %ebx
+     996:	5e                   	pop    %esi
+     997:	5f                   	pop    %edi
+     998:	5d                   	pop    %ebp
+     999:	c3                   	ret
+     99a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  neg = 0;
+     9a0:	31 c0                	xor    %eax,%eax
+     9a2:	e9 51 ff ff ff       	jmp    8f8 <printint+0x28>
+     9a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9ae:	66 90                	xchg   %ax,%ax
+    _write(b->fd, b->buf, b->n);
+     9b0:	83 ec 04             	sub    $0x4,%esp
+     9b3:	50                   	push   %eax
+     9b4:	8d 43 0c             	lea    0xc(%ebx),%eax
+     9b7:	50                   	push   %eax
+     9b8:	ff 33                	push   (%ebx)
+     9ba:	e8 71 fd ff ff       	call   730 <_write>
+     9bf:	83 c4 10             	add    $0x10,%esp
+     9c2:	eb c0                	jmp    984 <printint+0xb4>
+     9c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     9cf:	90                   	nop
+
+000009d0 <putc>:
+{
+     9d0:	55                   	push   %ebp
+     9d1:	89 e5                	mov    %esp,%ebp
+     9d3:	53                   	push   %ebx
+     9d4:	89 c3                	mov    %eax,%ebx
+     9d6:	83 ec 04             	sub    $0x4,%esp
+  if(b->str){
+     9d9:	8b 80 0c 02 00 00    	mov    0x20c(%eax),%eax
+     9df:	85 c0                	test   %eax,%eax
+     9e1:	74 15                	je     9f8 <putc+0x28>
+    *b->str++ = c;
+     9e3:	8d 48 01             	lea    0x1(%eax),%ecx
+     9e6:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+     9ec:	88 10                	mov    %dl,(%eax)
+}
+     9ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     9f1:	c9                   	leave
+     9f2:	c3                   	ret
+     9f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     9f7:	90                   	nop
+  b->buf[b->n++] = c;
+     9f8:	8b 4b 08             	mov    0x8(%ebx),%ecx
+     9fb:	8d 41 01             	lea    0x1(%ecx),%eax
+     9fe:	89 43 08             	mov    %eax,0x8(%ebx)
+     a01:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+     a05:	3d 00 02 00 00       	cmp    $0x200,%eax
+     a0a:	74 14                	je     a20 <putc+0x50>
+     a0c:	80 fa 0a             	cmp    $0xa,%dl
+     a0f:	75 dd                	jne    9ee <putc+0x1e>
+     a11:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+     a15:	75 d7                	jne    9ee <putc+0x1e>
+  if(b->n > 0)
+     a17:	85 c0                	test   %eax,%eax
+     a19:	7e 17                	jle    a32 <putc+0x62>
+     a1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     a1f:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     a20:	83 ec 04             	sub    $0x4,%esp
+     a23:	50                   	push   %eax
+     a24:	8d 43 0c             	lea    0xc(%ebx),%eax
+     a27:	50                   	push   %eax
+     a28:	ff 33                	push   (%ebx)
+     a2a:	e8 01 fd ff ff       	call   730 <_write>
+     a2f:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     a32:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+     a39:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     a3c:	c9                   	leave
+     a3d:	c3                   	ret
+     a3e:	66 90                	xchg   %ax,%ax
+
+00000a40 <format>:
+
+// Format fmt and the arguments at ap into b.
+// Only understands %d, %x, %p, %s, %c.
+static void
+format(struct outbuf *b, const char *fmt, uint *ap)
+{
+     a40:	55                   	push   %ebp
+     a41:	89 e5                	mov    %esp,%ebp
+     a43:	57                   	push   %edi
+     a44:	89 c7                	mov    %eax,%edi
+     a46:	56                   	push   %esi
+     a47:	53                   	push   %ebx
+     a48:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+     a4b:	0f b6 02             	movzbl (%edx),%eax
+{
+     a4e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  for(i = 0; fmt[i]; i++){
+     a51:	84 c0                	test   %al,%al
+     a53:	74 5a                	je     aaf <format+0x6f>
+     a55:	8d 5a 01             	lea    0x1(%edx),%ebx
+     a58:	31 f6                	xor    %esi,%esi
+     a5a:	eb 1c                	jmp    a78 <format+0x38>
+     a5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     a60:	83 f8 25             	cmp    $0x25,%eax
+     a63:	74 3b                	je     aa0 <format+0x60>
+        state = '%';
+      } else {
+        putc(b, c);
+     a65:	89 ca                	mov    %ecx,%edx
+     a67:	89 f8                	mov    %edi,%eax
+     a69:	e8 62 ff ff ff       	call   9d0 <putc>
+  for(i = 0; fmt[i]; i++){
+     a6e:	0f b6 03             	movzbl (%ebx),%eax
+     a71:	83 c3 01             	add    $0x1,%ebx
+     a74:	84 c0                	test   %al,%al
+     a76:	74 37                	je     aaf <format+0x6f>
+    c = fmt[i] & 0xff;
+     a78:	0f be c8             	movsbl %al,%ecx
+     a7b:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     a7e:	85 f6                	test   %esi,%esi
+     a80:	74 de                	je     a60 <format+0x20>
+      }
+    } else if(state == '%'){
+     a82:	83 fe 25             	cmp    $0x25,%esi
+     a85:	75 e7                	jne    a6e <format+0x2e>
+      if(c == 'd'){
+     a87:	83 f8 25             	cmp    $0x25,%eax
+     a8a:	74 46                	je     ad2 <format+0x92>
+     a8c:	83 e8 63             	sub    $0x63,%eax
+     a8f:	83 f8 15             	cmp    $0x15,%eax
+     a92:	77 2c                	ja     ac0 <format+0x80>
+     a94:	ff 24 85 84 15 00 00 	jmp    *0x1584(,%eax,4)
+     a9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     a9f:	90                   	nop
+  for(i = 0; fmt[i]; i++){
+     aa0:	0f b6 03             	movzbl (%ebx),%eax
+     aa3:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+     aa6:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+     aab:	84 c0                	test   %al,%al
+     aad:	75 c9                	jne    a78 <format+0x38>
+        putc(b, c);
+      }
+      state = 0;
+    }
+  }
+}
+     aaf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ab2:	5b                   	pop    %ebx
+     ab3:	5e                   	pop    %esi
+     ab4:	5f                   	pop    %edi
+     ab5:	5d                   	pop    %ebp
+     ab6:	c3                   	ret
+     ab7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     abe:	66 90                	xchg   %ax,%ax
+        putc(b, '%');
+     ac0:	ba 25 00 00 00       	mov    $0x25,%edx
+     ac5:	89 f8                	mov    %edi,%eax
+     ac7:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     aca:	e8 01 ff ff ff       	call   9d0 <putc>
+        putc(b, c);
+     acf:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     ad2:	89 ca                	mov    %ecx,%edx
+     ad4:	89 f8                	mov    %edi,%eax
+      state = 0;
+     ad6:	31 f6                	xor    %esi,%esi
+        putc(b, c);
+     ad8:	e8 f3 fe ff ff       	call   9d0 <putc>
+     add:	eb 8f                	jmp    a6e <format+0x2e>
+     adf:	90                   	nop
+        printint(b, *ap, 16, 0);
+     ae0:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     ae3:	83 ec 0c             	sub    $0xc,%esp
+     ae6:	b9 10 00 00 00       	mov    $0x10,%ecx
+     aeb:	8b 16                	mov    (%esi),%edx
+     aed:	6a 00                	push   $0x0
+        ap++;
+     aef:	83 c6 04             	add    $0x4,%esi
+        printint(b, *ap, 16, 0);
+     af2:	89 f8                	mov    %edi,%eax
+     af4:	e8 d7 fd ff ff       	call   8d0 <printint>
+        ap++;
+     af9:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+     afc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     aff:	31 f6                	xor    %esi,%esi
+     b01:	e9 68 ff ff ff       	jmp    a6e <format+0x2e>
+     b06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b0d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     b10:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     b13:	8b 30                	mov    (%eax),%esi
+        ap++;
+     b15:	83 c0 04             	add    $0x4,%eax
+     b18:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+     b1b:	85 f6                	test   %esi,%esi
+     b1d:	75 1b                	jne    b3a <format+0xfa>
+     b1f:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+     b24:	be 7c 15 00 00       	mov    $0x157c,%esi
+     b29:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+          putc(b, *s);
+     b30:	89 f8                	mov    %edi,%eax
+          s++;
+     b32:	83 c6 01             	add    $0x1,%esi
+          putc(b, *s);
+     b35:	e8 96 fe ff ff       	call   9d0 <putc>
+        while(*s != 0){
+     b3a:	0f be 16             	movsbl (%esi),%edx
+     b3d:	84 d2                	test   %dl,%dl
+     b3f:	75 ef                	jne    b30 <format+0xf0>
+      state = 0;
+     b41:	31 f6                	xor    %esi,%esi
+     b43:	e9 26 ff ff ff       	jmp    a6e <format+0x2e>
+     b48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b4f:	90                   	nop
+        printint(b, *ap, 10, 1);
+     b50:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     b53:	83 ec 0c             	sub    $0xc,%esp
+     b56:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     b5b:	8b 16                	mov    (%esi),%edx
+     b5d:	6a 01                	push   $0x1
+     b5f:	eb 8e                	jmp    aef <format+0xaf>
+     b61:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(b, *ap);
+     b68:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     b6b:	89 f8                	mov    %edi,%eax
+     b6d:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+     b70:	83 c6 04             	add    $0x4,%esi
+        putc(b, *ap);
+     b73:	e8 58 fe ff ff       	call   9d0 <putc>
+        ap++;
+     b78:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      state = 0;
+     b7b:	31 f6                	xor    %esi,%esi
+     b7d:	e9 ec fe ff ff       	jmp    a6e <format+0x2e>
+     b82:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000b90 <fflush>:
+{
+     b90:	55                   	push   %ebp
+     b91:	89 e5                	mov    %esp,%ebp
+     b93:	83 ec 08             	sub    $0x8,%esp
+  if(fd == stdout.fd)
+     b96:	8b 45 08             	mov    0x8(%ebp),%eax
+     b99:	39 05 00 20 00 00    	cmp    %eax,0x2000
+     b9f:	74 07                	je     ba8 <fflush+0x18>
+}
+     ba1:	c9                   	leave
+     ba2:	c3                   	ret
+     ba3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     ba7:	90                   	nop
+  umtxlock(&stdoutlock);
+     ba8:	83 ec 0c             	sub    $0xc,%esp
+     bab:	68 24 32 00 00       	push   $0x3224
+     bb0:	e8 db fa ff ff       	call   690 <umtxlock>
+  if(b->n > 0)
+     bb5:	a1 08 20 00 00       	mov    0x2008,%eax
+     bba:	83 c4 10             	add    $0x10,%esp
+     bbd:	85 c0                	test   %eax,%eax
+     bbf:	7f 1f                	jg     be0 <fflush+0x50>
+  b->n = 0;
+     bc1:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     bc8:	00 00 00 
+  umtxunlock(&stdoutlock);
+     bcb:	c7 45 08 24 32 00 00 	movl   $0x3224,0x8(%ebp)
+}
+     bd2:	c9                   	leave
+  umtxunlock(&stdoutlock);
+     bd3:	e9 08 fb ff ff       	jmp    6e0 <umtxunlock>
+     bd8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bdf:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     be0:	83 ec 04             	sub    $0x4,%esp
+     be3:	50                   	push   %eax
+     be4:	68 0c 20 00 00       	push   $0x200c
+     be9:	ff 35 00 20 00 00    	push   0x2000
+     bef:	e8 3c fb ff ff       	call   730 <_write>
+     bf4:	83 c4 10             	add    $0x10,%esp
+     bf7:	eb c8                	jmp    bc1 <fflush+0x31>
+     bf9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000c00 <setvbuf>:
+{
+     c00:	55                   	push   %ebp
+     c01:	89 e5                	mov    %esp,%ebp
+     c03:	53                   	push   %ebx
+     c04:	83 ec 04             	sub    $0x4,%esp
+     c07:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd != stdout.fd)
+     c0a:	8b 45 08             	mov    0x8(%ebp),%eax
+     c0d:	39 05 00 20 00 00    	cmp    %eax,0x2000
+     c13:	74 0b                	je     c20 <setvbuf+0x20>
+}
+     c15:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     c18:	c9                   	leave
+     c19:	c3                   	ret
+     c1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  umtxlock(&stdoutlock);
+     c20:	83 ec 0c             	sub    $0xc,%esp
+     c23:	68 24 32 00 00       	push   $0x3224
+     c28:	e8 63 fa ff ff       	call   690 <umtxlock>
+  if(b->n > 0)
+     c2d:	a1 08 20 00 00       	mov    0x2008,%eax
+     c32:	83 c4 10             	add    $0x10,%esp
+     c35:	85 c0                	test   %eax,%eax
+     c37:	7f 2f                	jg     c68 <setvbuf+0x68>
+  b->n = 0;
+     c39:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     c40:	00 00 00 
+  stdout.mode = mode;
+     c43:	89 1d 04 20 00 00    	mov    %ebx,0x2004
+  flushhook = flushall;
+     c49:	c7 05 20 32 00 00 80 	movl   $0x880,0x3220
+     c50:	08 00 00 
+}
+     c53:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&stdoutlock);
+     c56:	c7 45 08 24 32 00 00 	movl   $0x3224,0x8(%ebp)
+}
+     c5d:	c9                   	leave
+  umtxunlock(&stdoutlock);
+     c5e:	e9 7d fa ff ff       	jmp    6e0 <umtxunlock>
+     c63:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c67:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     c68:	83 ec 04             	sub    $0x4,%esp
+     c6b:	50                   	push   %eax
+     c6c:	68 0c 20 00 00       	push   $0x200c
+     c71:	ff 35 00 20 00 00    	push   0x2000
+     c77:	e8 b4 fa ff ff       	call   730 <_write>
+     c7c:	83 c4 10             	add    $0x10,%esp
+     c7f:	eb b8                	jmp    c39 <setvbuf+0x39>
+     c81:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c8f:	90                   	nop
+
+00000c90 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s, %c.
+void
+printf(int fd, const char *fmt, ...)
+{
+     c90:	55                   	push   %ebp
+     c91:	89 e5                	mov    %esp,%ebp
+     c93:	53                   	push   %ebx
+     c94:	81 ec 14 02 00 00    	sub    $0x214,%esp
+     c9a:	8b 45 08             	mov    0x8(%ebp),%eax
+    local.mode = _IONBF;
+    local.n = 0;
+    local.str = 0;
+    b = &local;
+  }
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     c9d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd == stdout.fd){
+     ca0:	39 05 00 20 00 00    	cmp    %eax,0x2000
+     ca6:	74 48                	je     cf0 <printf+0x60>
+    local.fd = fd;
+     ca8:	89 85 e8 fd ff ff    	mov    %eax,-0x218(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     cae:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     cb1:	89 da                	mov    %ebx,%edx
+     cb3:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+    local.mode = _IONBF;
+     cb9:	c7 85 ec fd ff ff 03 	movl   $0x3,-0x214(%ebp)
+     cc0:	00 00 00 
+    local.n = 0;
+     cc3:	c7 85 f0 fd ff ff 00 	movl   $0x0,-0x210(%ebp)
+     cca:	00 00 00 
+    local.str = 0;
+     ccd:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     cd4:	e8 67 fd ff ff       	call   a40 <format>
+  if(b->mode == _IONBF)
+     cd9:	83 bd ec fd ff ff 03 	cmpl   $0x3,-0x214(%ebp)
+     ce0:	0f 84 a2 00 00 00    	je     d88 <printf+0xf8>
+    flush(b);
+  if(b == &stdout)
+    umtxunlock(&stdoutlock);
+}
+     ce6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     ce9:	c9                   	leave
+     cea:	c3                   	ret
+     ceb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     cef:	90                   	nop
+    umtxlock(&stdoutlock);
+     cf0:	83 ec 0c             	sub    $0xc,%esp
+     cf3:	68 24 32 00 00       	push   $0x3224
+     cf8:	e8 93 f9 ff ff       	call   690 <umtxlock>
+  if(stdout.mode == 0){
+     cfd:	a1 04 20 00 00       	mov    0x2004,%eax
+     d02:	83 c4 10             	add    $0x10,%esp
+     d05:	85 c0                	test   %eax,%eax
+     d07:	74 37                	je     d40 <printf+0xb0>
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     d09:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     d0c:	89 da                	mov    %ebx,%edx
+     d0e:	b8 00 20 00 00       	mov    $0x2000,%eax
+     d13:	e8 28 fd ff ff       	call   a40 <format>
+  if(b->mode == _IONBF)
+     d18:	83 3d 04 20 00 00 03 	cmpl   $0x3,0x2004
+     d1f:	0f 84 ab 00 00 00    	je     dd0 <printf+0x140>
+    umtxunlock(&stdoutlock);
+     d25:	83 ec 0c             	sub    $0xc,%esp
+     d28:	68 24 32 00 00       	push   $0x3224
+     d2d:	e8 ae f9 ff ff       	call   6e0 <umtxunlock>
+}
+     d32:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    umtxunlock(&stdoutlock);
+     d35:	83 c4 10             	add    $0x10,%esp
+}
+     d38:	c9                   	leave
+     d39:	c3                   	ret
+     d3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+     d40:	83 ec 08             	sub    $0x8,%esp
+     d43:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+     d49:	50                   	push   %eax
+     d4a:	ff 35 00 20 00 00    	push   0x2000
+     d50:	e8 13 fa ff ff       	call   768 <fstat>
+     d55:	83 c4 10             	add    $0x10,%esp
+     d58:	89 c2                	mov    %eax,%edx
+      stdout.mode = _IOFBF;
+     d5a:	b8 01 00 00 00       	mov    $0x1,%eax
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+     d5f:	85 d2                	test   %edx,%edx
+     d61:	75 10                	jne    d73 <printf+0xe3>
+      stdout.mode = _IOLBF;
+     d63:	31 c0                	xor    %eax,%eax
+     d65:	66 83 bd e8 fd ff ff 	cmpw   $0x3,-0x218(%ebp)
+     d6c:	03 
+     d6d:	0f 94 c0             	sete   %al
+     d70:	83 c0 01             	add    $0x1,%eax
+     d73:	a3 04 20 00 00       	mov    %eax,0x2004
+    flushhook = flushall;
+     d78:	c7 05 20 32 00 00 80 	movl   $0x880,0x3220
+     d7f:	08 00 00 
+     d82:	eb 85                	jmp    d09 <printf+0x79>
+     d84:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(b->n > 0)
+     d88:	8b 85 f0 fd ff ff    	mov    -0x210(%ebp),%eax
+     d8e:	85 c0                	test   %eax,%eax
+     d90:	0f 8e 50 ff ff ff    	jle    ce6 <printf+0x56>
+    b = &local;
+     d96:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+    _write(b->fd, b->buf, b->n);
+     d9c:	83 ec 04             	sub    $0x4,%esp
+     d9f:	50                   	push   %eax
+     da0:	8d 43 0c             	lea    0xc(%ebx),%eax
+     da3:	50                   	push   %eax
+     da4:	ff 33                	push   (%ebx)
+     da6:	e8 85 f9 ff ff       	call   730 <_write>
+  b->n = 0;
+     dab:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  if(b == &stdout)
+     db2:	83 c4 10             	add    $0x10,%esp
+     db5:	81 fb 00 20 00 00    	cmp    $0x2000,%ebx
+     dbb:	0f 85 25 ff ff ff    	jne    ce6 <printf+0x56>
+     dc1:	e9 5f ff ff ff       	jmp    d25 <printf+0x95>
+     dc6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dcd:	8d 76 00             	lea    0x0(%esi),%esi
+  if(b->n > 0)
+     dd0:	a1 08 20 00 00       	mov    0x2008,%eax
+    b = getstdout();
+     dd5:	bb 00 20 00 00       	mov    $0x2000,%ebx
+  if(b->n > 0)
+     dda:	85 c0                	test   %eax,%eax
+     ddc:	7f be                	jg     d9c <printf+0x10c>
+  b->n = 0;
+     dde:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     de5:	00 00 00 
+  if(b == &stdout)
+     de8:	e9 38 ff ff ff       	jmp    d25 <printf+0x95>
+     ded:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000df0 <sprintf>:
+
+// Print to the given buffer. Only understands %d, %x, %p, %s, %c.
+int
+sprintf(char *str, const char *fmt, ...)
+{
+     df0:	55                   	push   %ebp
+     df1:	89 e5                	mov    %esp,%ebp
+     df3:	53                   	push   %ebx
+  struct outbuf b;
+
+  b.str = str;
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+     df4:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+     dfa:	8d 4d 10             	lea    0x10(%ebp),%ecx
+{
+     dfd:	81 ec 14 02 00 00    	sub    $0x214,%esp
+     e03:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+     e06:	8b 55 0c             	mov    0xc(%ebp),%edx
+  b.str = str;
+     e09:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+     e0c:	e8 2f fc ff ff       	call   a40 <format>
+  *b.str = '\0';
+     e11:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e14:	c6 00 00             	movb   $0x0,(%eax)
+  return b.str - str;
+     e17:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e1a:	29 d8                	sub    %ebx,%eax
+}
+     e1c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     e1f:	c9                   	leave
+     e20:	c3                   	ret
+     e21:	66 90                	xchg   %ax,%ax
+     e23:	66 90                	xchg   %ax,%ax
+     e25:	66 90                	xchg   %ax,%ax
+     e27:	66 90                	xchg   %ax,%ax
+     e29:	66 90                	xchg   %ax,%ax
+     e2b:	66 90                	xchg   %ax,%ax
+     e2d:	66 90                	xchg   %ax,%ax
+     e2f:	90                   	nop
+
+00000e30 <freeblock>:
+static Header *freep;
+static struct umutex lock;  // threads made by clone() share the heap
+
+static void
+freeblock(void *ap)
+{
+     e30:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+     e31:	8d 48 f8             	lea    -0x8(%eax),%ecx
+{
+     e34:	89 e5                	mov    %esp,%ebp
+     e36:	57                   	push   %edi
+     e37:	56                   	push   %esi
+     e38:	53                   	push   %ebx
+     e39:	89 c3                	mov    %eax,%ebx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     e3b:	a1 2c 32 00 00       	mov    0x322c,%eax
+     e40:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     e42:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     e44:	39 ca                	cmp    %ecx,%edx
+     e46:	73 30                	jae    e78 <freeblock+0x48>
+     e48:	39 c1                	cmp    %eax,%ecx
+     e4a:	72 04                	jb     e50 <freeblock+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     e4c:	39 c2                	cmp    %eax,%edx
+     e4e:	72 f0                	jb     e40 <freeblock+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     e50:	8b 73 fc             	mov    -0x4(%ebx),%esi
+     e53:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+     e56:	39 f8                	cmp    %edi,%eax
+     e58:	74 26                	je     e80 <freeblock+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+     e5a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+     e5d:	8b 42 04             	mov    0x4(%edx),%eax
+     e60:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     e63:	39 f1                	cmp    %esi,%ecx
+     e65:	74 30                	je     e97 <freeblock+0x67>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+     e67:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+     e69:	5b                   	pop    %ebx
+  freep = p;
+     e6a:	89 15 2c 32 00 00    	mov    %edx,0x322c
+}
+     e70:	5e                   	pop    %esi
+     e71:	5f                   	pop    %edi
+     e72:	5d                   	pop    %ebp
+     e73:	c3                   	ret
+     e74:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     e78:	39 c1                	cmp    %eax,%ecx
+     e7a:	72 d0                	jb     e4c <freeblock+0x1c>
+     e7c:	eb c2                	jmp    e40 <freeblock+0x10>
+     e7e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+     e80:	03 70 04             	add    0x4(%eax),%esi
+     e83:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     e86:	8b 02                	mov    (%edx),%eax
+     e88:	8b 00                	mov    (%eax),%eax
+     e8a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+     e8d:	8b 42 04             	mov    0x4(%edx),%eax
+     e90:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     e93:	39 f1                	cmp    %esi,%ecx
+     e95:	75 d0                	jne    e67 <freeblock+0x37>
+    p->s.size += bp->s.size;
+     e97:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+     e9a:	89 15 2c 32 00 00    	mov    %edx,0x322c
+    p->s.size += bp->s.size;
+     ea0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+     ea3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+     ea6:	89 0a                	mov    %ecx,(%edx)
+}
+     ea8:	5b                   	pop    %ebx
+     ea9:	5e                   	pop    %esi
+     eaa:	5f                   	pop    %edi
+     eab:	5d                   	pop    %ebp
+     eac:	c3                   	ret
+     ead:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000eb0 <free>:
+
+void
+free(void *ap)
+{
+     eb0:	55                   	push   %ebp
+     eb1:	89 e5                	mov    %esp,%ebp
+     eb3:	53                   	push   %ebx
+     eb4:	83 ec 10             	sub    $0x10,%esp
+     eb7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  umtxlock(&lock);
+     eba:	68 28 32 00 00       	push   $0x3228
+     ebf:	e8 cc f7 ff ff       	call   690 <umtxlock>
+  freeblock(ap);
+     ec4:	89 d8                	mov    %ebx,%eax
+     ec6:	e8 65 ff ff ff       	call   e30 <freeblock>
+  umtxunlock(&lock);
+     ecb:	c7 45 08 28 32 00 00 	movl   $0x3228,0x8(%ebp)
+}
+     ed2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&lock);
+     ed5:	83 c4 10             	add    $0x10,%esp
+}
+     ed8:	c9                   	leave
+  umtxunlock(&lock);
+     ed9:	e9 02 f8 ff ff       	jmp    6e0 <umtxunlock>
+     ede:	66 90                	xchg   %ax,%ax
+
+00000ee0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+     ee0:	55                   	push   %ebp
+     ee1:	89 e5                	mov    %esp,%ebp
+     ee3:	57                   	push   %edi
+     ee4:	56                   	push   %esi
+     ee5:	53                   	push   %ebx
+     ee6:	83 ec 28             	sub    $0x28,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     ee9:	8b 45 08             	mov    0x8(%ebp),%eax
+  umtxlock(&lock);
+     eec:	68 28 32 00 00       	push   $0x3228
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     ef1:	8d 48 07             	lea    0x7(%eax),%ecx
+     ef4:	c1 e9 03             	shr    $0x3,%ecx
+     ef7:	8d 71 01             	lea    0x1(%ecx),%esi
+  umtxlock(&lock);
+     efa:	e8 91 f7 ff ff       	call   690 <umtxlock>
+  if((prevp = freep) == 0){
+     eff:	8b 15 2c 32 00 00    	mov    0x322c,%edx
+     f05:	83 c4 10             	add    $0x10,%esp
+     f08:	85 d2                	test   %edx,%edx
+     f0a:	0f 84 b0 00 00 00    	je     fc0 <malloc+0xe0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     f10:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+     f12:	8b 47 04             	mov    0x4(%edi),%eax
+     f15:	39 f0                	cmp    %esi,%eax
+     f17:	73 6f                	jae    f88 <malloc+0xa8>
+  if(nu < 4096)
+     f19:	bb 00 10 00 00       	mov    $0x1000,%ebx
+     f1e:	39 de                	cmp    %ebx,%esi
+     f20:	0f 43 de             	cmovae %esi,%ebx
+  p = sbrk(nu * sizeof(Header));
+     f23:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+     f2a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     f2d:	eb 0a                	jmp    f39 <malloc+0x59>
+     f2f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     f30:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+     f32:	8b 47 04             	mov    0x4(%edi),%eax
+     f35:	39 f0                	cmp    %esi,%eax
+     f37:	73 4f                	jae    f88 <malloc+0xa8>
+      }
+      freep = prevp;
+      umtxunlock(&lock);
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+     f39:	89 fa                	mov    %edi,%edx
+     f3b:	39 3d 2c 32 00 00    	cmp    %edi,0x322c
+     f41:	75 ed                	jne    f30 <malloc+0x50>
+  p = sbrk(nu * sizeof(Header));
+     f43:	83 ec 0c             	sub    $0xc,%esp
+     f46:	ff 75 e4             	push   -0x1c(%ebp)
+     f49:	e8 4a f8 ff ff       	call   798 <sbrk>
+  if(p == (char*)-1)
+     f4e:	83 c4 10             	add    $0x10,%esp
+     f51:	83 f8 ff             	cmp    $0xffffffff,%eax
+     f54:	74 15                	je     f6b <malloc+0x8b>
+  hp->s.size = nu;
+     f56:	89 58 04             	mov    %ebx,0x4(%eax)
+  freeblock((void*)(hp + 1));
+     f59:	83 c0 08             	add    $0x8,%eax
+     f5c:	e8 cf fe ff ff       	call   e30 <freeblock>
+  return freep;
+     f61:	8b 15 2c 32 00 00    	mov    0x322c,%edx
+      if((p = morecore(nunits)) == 0){
+     f67:	85 d2                	test   %edx,%edx
+     f69:	75 c5                	jne    f30 <malloc+0x50>
+        umtxunlock(&lock);
+     f6b:	83 ec 0c             	sub    $0xc,%esp
+     f6e:	68 28 32 00 00       	push   $0x3228
+     f73:	e8 68 f7 ff ff       	call   6e0 <umtxunlock>
+        return 0;
+     f78:	83 c4 10             	add    $0x10,%esp
+      }
+  }
+}
+     f7b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+     f7e:	31 c0                	xor    %eax,%eax
+}
+     f80:	5b                   	pop    %ebx
+     f81:	5e                   	pop    %esi
+     f82:	5f                   	pop    %edi
+     f83:	5d                   	pop    %ebp
+     f84:	c3                   	ret
+     f85:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+     f88:	39 c6                	cmp    %eax,%esi
+     f8a:	74 64                	je     ff0 <malloc+0x110>
+        p->s.size -= nunits;
+     f8c:	29 f0                	sub    %esi,%eax
+     f8e:	89 47 04             	mov    %eax,0x4(%edi)
+        p += p->s.size;
+     f91:	8d 3c c7             	lea    (%edi,%eax,8),%edi
+        p->s.size = nunits;
+     f94:	89 77 04             	mov    %esi,0x4(%edi)
+      umtxunlock(&lock);
+     f97:	83 ec 0c             	sub    $0xc,%esp
+      freep = prevp;
+     f9a:	89 15 2c 32 00 00    	mov    %edx,0x322c
+      umtxunlock(&lock);
+     fa0:	68 28 32 00 00       	push   $0x3228
+     fa5:	e8 36 f7 ff ff       	call   6e0 <umtxunlock>
+      return (void*)(p + 1);
+     faa:	83 c4 10             	add    $0x10,%esp
+}
+     fad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+     fb0:	8d 47 08             	lea    0x8(%edi),%eax
+}
+     fb3:	5b                   	pop    %ebx
+     fb4:	5e                   	pop    %esi
+     fb5:	5f                   	pop    %edi
+     fb6:	5d                   	pop    %ebp
+     fb7:	c3                   	ret
+     fb8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fbf:	90                   	nop
+    base.s.ptr = freep = prevp = &base;
+     fc0:	c7 05 2c 32 00 00 30 	movl   $0x3230,0x322c
+     fc7:	32 00 00 
+    base.s.size = 0;
+     fca:	bf 30 32 00 00       	mov    $0x3230,%edi
+    base.s.ptr = freep = prevp = &base;
+     fcf:	c7 05 30 32 00 00 30 	movl   $0x3230,0x3230
+     fd6:	32 00 00 
+    base.s.size = 0;
+     fd9:	c7 05 34 32 00 00 00 	movl   $0x0,0x3234
+     fe0:	00 00 00 
+    if(p->s.size >= nunits){
+     fe3:	e9 31 ff ff ff       	jmp    f19 <malloc+0x39>
+     fe8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fef:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+     ff0:	8b 07                	mov    (%edi),%eax
+     ff2:	89 02                	mov    %eax,(%edx)
+     ff4:	eb a1                	jmp    f97 <malloc+0xb7>
+     ff6:	66 90                	xchg   %ax,%ax
+     ff8:	66 90                	xchg   %ax,%ax
+     ffa:	66 90                	xchg   %ax,%ax
+     ffc:	66 90                	xchg   %ax,%ax
+     ffe:	66 90                	xchg   %ax,%ax
+
+00001000 <threadstart>:
+
+#define TSTACKSZ 4096
+
+static void
+threadstart(void *fn, void *arg)
+{
+    1000:	55                   	push   %ebp
+    1001:	89 e5                	mov    %esp,%ebp
+    1003:	83 ec 14             	sub    $0x14,%esp
+  ((void (*)(void*))fn)(arg);
+    1006:	ff 75 0c             	push   0xc(%ebp)
+    1009:	ff 55 08             	call   *0x8(%ebp)
+  exit();
+    100c:	e8 ef f4 ff ff       	call   500 <exit>
+    1011:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1018:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    101f:	90                   	nop
+
+00001020 <thread_create>:
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    1020:	55                   	push   %ebp
+    1021:	89 e5                	mov    %esp,%ebp
+    1023:	53                   	push   %ebx
+    1024:	83 ec 20             	sub    $0x20,%esp
+  char *mem, *stack;
+  int pid;
+
+  if((mem = malloc(2*TSTACKSZ)) == 0)
+    1027:	68 00 20 00 00       	push   $0x2000
+    102c:	e8 af fe ff ff       	call   ee0 <malloc>
+    1031:	83 c4 10             	add    $0x10,%esp
+    1034:	85 c0                	test   %eax,%eax
+    1036:	74 47                	je     107f <thread_create+0x5f>
+    1038:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)(((uint)mem + TSTACKSZ - 1) & ~(TSTACKSZ - 1));
+    103a:	8d 80 ff 0f 00 00    	lea    0xfff(%eax),%eax
+    1040:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  *(char**)stack = mem;
+    1045:	89 18                	mov    %ebx,(%eax)
+  if((pid = clone(threadstart, (void*)fn, arg, stack)) < 0)
+    1047:	50                   	push   %eax
+    1048:	ff 75 0c             	push   0xc(%ebp)
+    104b:	ff 75 08             	push   0x8(%ebp)
+    104e:	68 00 10 00 00       	push   $0x1000
+    1053:	e8 08 f8 ff ff       	call   860 <clone>
+    1058:	83 c4 10             	add    $0x10,%esp
+    105b:	85 c0                	test   %eax,%eax
+    105d:	78 09                	js     1068 <thread_create+0x48>
+    free(mem);
+  return pid;
+}
+    105f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1062:	c9                   	leave
+    1063:	c3                   	ret
+    1064:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    free(mem);
+    1068:	83 ec 0c             	sub    $0xc,%esp
+    106b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    106e:	53                   	push   %ebx
+    106f:	e8 3c fe ff ff       	call   eb0 <free>
+    1074:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    1077:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+    107a:	83 c4 10             	add    $0x10,%esp
+}
+    107d:	c9                   	leave
+    107e:	c3                   	ret
+    return -1;
+    107f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1084:	eb d9                	jmp    105f <thread_create+0x3f>
+    1086:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    108d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001090 <thread_join>:
+
+int
+thread_join(void)
+{
+    1090:	55                   	push   %ebp
+    1091:	89 e5                	mov    %esp,%ebp
+    1093:	83 ec 34             	sub    $0x34,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    1096:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    1099:	50                   	push   %eax
+    109a:	e8 c9 f7 ff ff       	call   868 <join>
+    109f:	83 c4 10             	add    $0x10,%esp
+    10a2:	85 c0                	test   %eax,%eax
+    10a4:	79 0a                	jns    10b0 <thread_join+0x20>
+    free(*(char**)stack);
+  return pid;
+}
+    10a6:	c9                   	leave
+    10a7:	c3                   	ret
+    10a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10af:	90                   	nop
+    free(*(char**)stack);
+    10b0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    10b3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    10b6:	83 ec 0c             	sub    $0xc,%esp
+    10b9:	ff 32                	push   (%edx)
+    10bb:	e8 f0 fd ff ff       	call   eb0 <free>
+    10c0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    10c3:	83 c4 10             	add    $0x10,%esp
+}
+    10c6:	c9                   	leave
+    10c7:	c3                   	ret
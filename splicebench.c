@@ -0,0 +1,72 @@
+// Compare feeding a file into a pipe with a read()/write()
+// loop against splice(), as in cat file | wc. A child streams
+// the file into the pipe; the parent counts the bytes.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+
+#define FILESZ  (64*1024)
+#define NROUND  32
+
+char buf[4096];
+
+int
+feed(int usesplice)
+{
+  int p[2], fd, n, got, r, t0;
+
+  t0 = uptime();
+  for(r = 0; r < NROUND; r++){
+    if(pipe(p) < 0){
+      printf(1, "splicebench: pipe failed\n");
+      exit();
+    }
+    if(fork() == 0){
+      close(p[0]);
+      if((fd = open("splicefile", O_RDONLY)) < 0)
+        exit();
+      if(usesplice){
+        while(splice(fd, p[1], sizeof(buf)) > 0)
+          ;
+      } else {
+        while((n = read(fd, buf, sizeof(buf))) > 0)
+          write(p[1], buf, n);
+      }
+      exit();
+    }
+    close(p[1]);
+    for(got = 0; (n = read(p[0], buf, sizeof(buf))) > 0; got += n)
+      ;
+    close(p[0]);
+    wait();
+    if(got != FILESZ){
+      printf(1, "splicebench: got %d bytes, expected %d\n", got, FILESZ);
+      exit();
+    }
+  }
+  return uptime() - t0;
+}
+
+int
+main(int argc, char *argv[])
+{
+  int fd, i;
+
+  if((fd = open("splicefile", O_CREATE|O_RDWR)) < 0){
+    printf(1, "splicebench: cannot create splicefile\n");
+    exit();
+  }
+  memset(buf, 'x', sizeof(buf));
+  for(i = 0; i < FILESZ/sizeof(buf); i++)
+    write(fd, buf, sizeof(buf));
+  close(fd);
+
+  printf(1, "splicebench: read/write: %d ticks for %d x %d KB\n",
+         feed(0), NROUND, FILESZ/1024);
+  printf(1, "splicebench: splice: %d ticks for %d x %d KB\n",
+         feed(1), NROUND, FILESZ/1024);
+  unlink("splicefile");
+  exit();
+}
@@ -0,0 +1,2434 @@
+
+_stackbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <recurse>:
+
+uint lowest;
+
+int
+recurse(int n)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	81 ec d8 07 00 00    	sub    $0x7d8,%esp
+       9:	8b 45 08             	mov    0x8(%ebp),%eax
+  volatile char buf[FRAME];
+
+  buf[0] = n;
+       c:	88 85 28 f8 ff ff    	mov    %al,-0x7d8(%ebp)
+  if(n == 0){
+      12:	85 c0                	test   %eax,%eax
+      14:	75 12                	jne    28 <recurse+0x28>
+    lowest = (uint)buf;
+      16:	8d 85 28 f8 ff ff    	lea    -0x7d8(%ebp),%eax
+      1c:	a3 10 22 00 00       	mov    %eax,0x2210
+    return 0;
+      21:	31 c0                	xor    %eax,%eax
+  }
+  return recurse(n - 1) + buf[0];
+}
+      23:	c9                   	leave
+      24:	c3                   	ret
+      25:	8d 76 00             	lea    0x0(%esi),%esi
+  return recurse(n - 1) + buf[0];
+      28:	8d 50 ff             	lea    -0x1(%eax),%edx
+  buf[0] = n;
+      2b:	88 95 1c fa ff ff    	mov    %dl,-0x5e4(%ebp)
+  if(n == 0){
+      31:	85 d2                	test   %edx,%edx
+      33:	75 1b                	jne    50 <recurse+0x50>
+    lowest = (uint)buf;
+      35:	8d 85 1c fa ff ff    	lea    -0x5e4(%ebp),%eax
+      3b:	a3 10 22 00 00       	mov    %eax,0x2210
+  return recurse(n - 1) + buf[0];
+      40:	0f be 85 28 f8 ff ff 	movsbl -0x7d8(%ebp),%eax
+}
+      47:	c9                   	leave
+  return recurse(n - 1) + buf[0];
+      48:	01 d0                	add    %edx,%eax
+}
+      4a:	c3                   	ret
+      4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      4f:	90                   	nop
+  return recurse(n - 1) + buf[0];
+      50:	8d 48 fe             	lea    -0x2(%eax),%ecx
+  buf[0] = n;
+      53:	88 8d 10 fc ff ff    	mov    %cl,-0x3f0(%ebp)
+  if(n == 0){
+      59:	85 c9                	test   %ecx,%ecx
+      5b:	75 1b                	jne    78 <recurse+0x78>
+    lowest = (uint)buf;
+      5d:	8d 85 10 fc ff ff    	lea    -0x3f0(%ebp),%eax
+      63:	a3 10 22 00 00       	mov    %eax,0x2210
+  return recurse(n - 1) + buf[0];
+      68:	0f be 95 1c fa ff ff 	movsbl -0x5e4(%ebp),%edx
+      6f:	01 ca                	add    %ecx,%edx
+      71:	eb cd                	jmp    40 <recurse+0x40>
+      73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      77:	90                   	nop
+      78:	8d 50 fd             	lea    -0x3(%eax),%edx
+  buf[0] = n;
+      7b:	88 95 04 fe ff ff    	mov    %dl,-0x1fc(%ebp)
+  if(n == 0){
+      81:	85 d2                	test   %edx,%edx
+      83:	75 1b                	jne    a0 <recurse+0xa0>
+    lowest = (uint)buf;
+      85:	8d 85 04 fe ff ff    	lea    -0x1fc(%ebp),%eax
+      8b:	a3 10 22 00 00       	mov    %eax,0x2210
+  return recurse(n - 1) + buf[0];
+      90:	0f be 8d 10 fc ff ff 	movsbl -0x3f0(%ebp),%ecx
+      97:	01 d1                	add    %edx,%ecx
+      99:	eb cd                	jmp    68 <recurse+0x68>
+      9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      9f:	90                   	nop
+      a0:	83 ec 0c             	sub    $0xc,%esp
+      a3:	83 e8 04             	sub    $0x4,%eax
+      a6:	50                   	push   %eax
+      a7:	e8 54 ff ff ff       	call   0 <recurse>
+      ac:	0f be 95 04 fe ff ff 	movsbl -0x1fc(%ebp),%edx
+      b3:	83 c4 10             	add    $0x10,%esp
+      b6:	01 c2                	add    %eax,%edx
+      b8:	eb d6                	jmp    90 <recurse+0x90>
+      ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000000c0 <big>:
+
+int
+big(void)
+{
+      c0:	55                   	push   %ebp
+      c1:	89 e5                	mov    %esp,%ebp
+      c3:	81 ec 00 00 04 00    	sub    $0x40000,%esp
+  volatile char buf[BIGSZ];
+
+  buf[0] = 1;
+  lowest = (uint)buf;
+      c9:	8d 85 00 00 fc ff    	lea    -0x40000(%ebp),%eax
+  buf[0] = 1;
+      cf:	c6 85 00 00 fc ff 01 	movb   $0x1,-0x40000(%ebp)
+  lowest = (uint)buf;
+      d6:	a3 10 22 00 00       	mov    %eax,0x2210
+  return buf[0];
+      db:	0f be 85 00 00 fc ff 	movsbl -0x40000(%ebp),%eax
+}
+      e2:	c9                   	leave
+      e3:	c3                   	ret
+      e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      ef:	90                   	nop
+
+000000f0 <run>:
+
+void
+run(char *name, int ahead, int bigframe)
+{
+      f0:	55                   	push   %ebp
+      f1:	89 e5                	mov    %esp,%ebp
+      f3:	57                   	push   %edi
+      f4:	56                   	push   %esi
+      f5:	53                   	push   %ebx
+      f6:	81 ec 4c 04 00 00    	sub    $0x44c,%esp
+      fc:	8b 75 08             	mov    0x8(%ebp),%esi
+      ff:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     102:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  struct iostat s0, s1;
+  uint top, kb;
+  int t, nfault;
+
+  if(fork() != 0){
+     105:	e8 26 04 00 00       	call   530 <fork>
+     10a:	85 c0                	test   %eax,%eax
+     10c:	0f 85 f6 00 00 00    	jne    208 <run+0x118>
+    wait();
+    return;
+  }
+  if(stacklimit(-1, ahead) < 0){
+     112:	83 ec 08             	sub    $0x8,%esp
+     115:	57                   	push   %edi
+     116:	6a ff                	push   $0xffffffff
+     118:	e8 b3 07 00 00       	call   8d0 <stacklimit>
+     11d:	83 c4 10             	add    $0x10,%esp
+     120:	85 c0                	test   %eax,%eax
+     122:	0f 88 c8 00 00 00    	js     1f0 <run+0x100>
+    printf(2, "stackbench: stacklimit failed\n");
+    exit();
+  }
+  top = (uint)&top;
+     128:	8d 85 ac fb ff ff    	lea    -0x454(%ebp),%eax
+  iostat(&s0);
+     12e:	83 ec 0c             	sub    $0xc,%esp
+  top = (uint)&top;
+     131:	89 85 ac fb ff ff    	mov    %eax,-0x454(%ebp)
+  iostat(&s0);
+     137:	8d 85 b0 fb ff ff    	lea    -0x450(%ebp),%eax
+     13d:	50                   	push   %eax
+     13e:	e8 fd 06 00 00       	call   840 <iostat>
+  t = uptime();
+     143:	e8 c0 06 00 00       	call   808 <uptime>
+  if(bigframe)
+     148:	83 c4 10             	add    $0x10,%esp
+  t = uptime();
+     14b:	89 c7                	mov    %eax,%edi
+  if(bigframe)
+     14d:	85 db                	test   %ebx,%ebx
+     14f:	0f 85 c3 00 00 00    	jne    218 <run+0x128>
+  return recurse(n - 1) + buf[0];
+     155:	83 ec 0c             	sub    $0xc,%esp
+  buf[0] = n;
+     158:	c6 85 00 fc ff ff c4 	movb   $0xc4,-0x400(%ebp)
+     15f:	c6 85 f4 fd ff ff c3 	movb   $0xc3,-0x20c(%ebp)
+  return recurse(n - 1) + buf[0];
+     166:	68 c2 20 00 00       	push   $0x20c2
+     16b:	e8 90 fe ff ff       	call   0 <recurse>
+     170:	0f b6 85 f4 fd ff ff 	movzbl -0x20c(%ebp),%eax
+     177:	83 c4 10             	add    $0x10,%esp
+     17a:	0f b6 85 00 fc ff ff 	movzbl -0x400(%ebp),%eax
+    big();
+  else
+    recurse(STACKSZ / FRAME);
+  t = uptime() - t;
+     181:	e8 82 06 00 00       	call   808 <uptime>
+  iostat(&s1);
+     186:	83 ec 0c             	sub    $0xc,%esp
+  t = uptime() - t;
+     189:	29 f8                	sub    %edi,%eax
+     18b:	89 c3                	mov    %eax,%ebx
+  iostat(&s1);
+     18d:	8d 85 d8 fb ff ff    	lea    -0x428(%ebp),%eax
+     193:	50                   	push   %eax
+     194:	e8 a7 06 00 00       	call   840 <iostat>
+  // The iostat() calls themselves take no faults: s1 is on
+  // the stack pages already in use.
+  nfault = s1.pgfault - s0.pgfault;
+  kb = (top - lowest) / 1024;
+     199:	8b 85 ac fb ff ff    	mov    -0x454(%ebp),%eax
+  if(kb == 0)
+     19f:	83 c4 0c             	add    $0xc,%esp
+  kb = (top - lowest) / 1024;
+     1a2:	2b 05 10 22 00 00    	sub    0x2210,%eax
+     1a8:	89 c1                	mov    %eax,%ecx
+  nfault = s1.pgfault - s0.pgfault;
+     1aa:	8b bd fc fb ff ff    	mov    -0x404(%ebp),%edi
+     1b0:	2b bd d4 fb ff ff    	sub    -0x42c(%ebp),%edi
+    kb = 1;
+  printf(1, "stackbench: %s: %d KB of stack, %d faults, %d per MB, %d ticks\n",
+     1b6:	53                   	push   %ebx
+  kb = (top - lowest) / 1024;
+     1b7:	c1 e9 0a             	shr    $0xa,%ecx
+     1ba:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+     1bf:	b8 01 00 00 00       	mov    $0x1,%eax
+     1c4:	0f 46 c8             	cmovbe %eax,%ecx
+         name, kb, nfault, nfault * 1024 / kb, t);
+     1c7:	89 f8                	mov    %edi,%eax
+  printf(1, "stackbench: %s: %d KB of stack, %d faults, %d per MB, %d ticks\n",
+     1c9:	31 d2                	xor    %edx,%edx
+         name, kb, nfault, nfault * 1024 / kb, t);
+     1cb:	c1 e0 0a             	shl    $0xa,%eax
+  printf(1, "stackbench: %s: %d KB of stack, %d faults, %d per MB, %d ticks\n",
+     1ce:	f7 f1                	div    %ecx
+     1d0:	50                   	push   %eax
+     1d1:	57                   	push   %edi
+     1d2:	51                   	push   %ecx
+     1d3:	56                   	push   %esi
+     1d4:	68 48 11 00 00       	push   $0x1148
+     1d9:	6a 01                	push   $0x1
+     1db:	e8 10 0b 00 00       	call   cf0 <printf>
+  exit();
+     1e0:	83 c4 20             	add    $0x20,%esp
+     1e3:	e8 78 03 00 00       	call   560 <exit>
+     1e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1ef:	90                   	nop
+    printf(2, "stackbench: stacklimit failed\n");
+     1f0:	83 ec 08             	sub    $0x8,%esp
+     1f3:	68 28 11 00 00       	push   $0x1128
+     1f8:	6a 02                	push   $0x2
+     1fa:	e8 f1 0a 00 00       	call   cf0 <printf>
+    exit();
+     1ff:	e8 5c 03 00 00       	call   560 <exit>
+     204:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+     208:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     20b:	5b                   	pop    %ebx
+     20c:	5e                   	pop    %esi
+     20d:	5f                   	pop    %edi
+     20e:	5d                   	pop    %ebp
+    wait();
+     20f:	e9 64 05 00 00       	jmp    778 <wait>
+     214:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    big();
+     218:	e8 a3 fe ff ff       	call   c0 <big>
+     21d:	e9 5f ff ff ff       	jmp    181 <run+0x91>
+     222:	66 90                	xchg   %ax,%ax
+     224:	66 90                	xchg   %ax,%ax
+     226:	66 90                	xchg   %ax,%ax
+     228:	66 90                	xchg   %ax,%ax
+     22a:	66 90                	xchg   %ax,%ax
+     22c:	66 90                	xchg   %ax,%ax
+     22e:	66 90                	xchg   %ax,%ax
+
+00000230 <main>:
+
+int
+main(int argc, char *argv[])
+{
+     230:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     234:	83 e4 f0             	and    $0xfffffff0,%esp
+     237:	ff 71 fc             	push   -0x4(%ecx)
+     23a:	55                   	push   %ebp
+     23b:	89 e5                	mov    %esp,%ebp
+     23d:	51                   	push   %ecx
+     23e:	83 ec 08             	sub    $0x8,%esp
+  run("recursion, no growth ahead", 0, 0);
+     241:	6a 00                	push   $0x0
+     243:	6a 00                	push   $0x0
+     245:	68 88 11 00 00       	push   $0x1188
+     24a:	e8 a1 fe ff ff       	call   f0 <run>
+  run("recursion, 4 pages ahead", 4, 0);
+     24f:	83 c4 0c             	add    $0xc,%esp
+     252:	6a 00                	push   $0x0
+     254:	6a 04                	push   $0x4
+     256:	68 a3 11 00 00       	push   $0x11a3
+     25b:	e8 90 fe ff ff       	call   f0 <run>
+  run("recursion, 16 pages ahead", 16, 0);
+     260:	83 c4 0c             	add    $0xc,%esp
+     263:	6a 00                	push   $0x0
+     265:	6a 10                	push   $0x10
+     267:	68 bc 11 00 00       	push   $0x11bc
+     26c:	e8 7f fe ff ff       	call   f0 <run>
+  run("256KB local array", 0, 1);
+     271:	83 c4 0c             	add    $0xc,%esp
+     274:	6a 01                	push   $0x1
+     276:	6a 00                	push   $0x0
+     278:	68 d6 11 00 00       	push   $0x11d6
+     27d:	e8 6e fe ff ff       	call   f0 <run>
+  exit();
+     282:	e8 d9 02 00 00       	call   560 <exit>
+     287:	66 90                	xchg   %ax,%ax
+     289:	66 90                	xchg   %ax,%ax
+     28b:	66 90                	xchg   %ax,%ax
+     28d:	66 90                	xchg   %ax,%ax
+     28f:	90                   	nop
+
+00000290 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     290:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     291:	31 c0                	xor    %eax,%eax
+{
+     293:	89 e5                	mov    %esp,%ebp
+     295:	53                   	push   %ebx
+     296:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     299:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     29c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     2a0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     2a4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     2a7:	83 c0 01             	add    $0x1,%eax
+     2aa:	84 d2                	test   %dl,%dl
+     2ac:	75 f2                	jne    2a0 <strcpy+0x10>
+    ;
+  return os;
+}
+     2ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     2b1:	89 c8                	mov    %ecx,%eax
+     2b3:	c9                   	leave
+     2b4:	c3                   	ret
+     2b5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002c0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     2c0:	55                   	push   %ebp
+     2c1:	89 e5                	mov    %esp,%ebp
+     2c3:	53                   	push   %ebx
+     2c4:	8b 55 08             	mov    0x8(%ebp),%edx
+     2c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     2ca:	0f b6 02             	movzbl (%edx),%eax
+     2cd:	84 c0                	test   %al,%al
+     2cf:	75 17                	jne    2e8 <strcmp+0x28>
+     2d1:	eb 3a                	jmp    30d <strcmp+0x4d>
+     2d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2d7:	90                   	nop
+     2d8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     2dc:	83 c2 01             	add    $0x1,%edx
+     2df:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     2e2:	84 c0                	test   %al,%al
+     2e4:	74 1a                	je     300 <strcmp+0x40>
+    p++, q++;
+     2e6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     2e8:	0f b6 19             	movzbl (%ecx),%ebx
+     2eb:	38 c3                	cmp    %al,%bl
+     2ed:	74 e9                	je     2d8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     2ef:	29 d8                	sub    %ebx,%eax
+}
+     2f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     2f4:	c9                   	leave
+     2f5:	c3                   	ret
+     2f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2fd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     300:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     304:	31 c0                	xor    %eax,%eax
+     306:	29 d8                	sub    %ebx,%eax
+}
+     308:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     30b:	c9                   	leave
+     30c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     30d:	0f b6 19             	movzbl (%ecx),%ebx
+     310:	31 c0                	xor    %eax,%eax
+     312:	eb db                	jmp    2ef <strcmp+0x2f>
+     314:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     31b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     31f:	90                   	nop
+
+00000320 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     320:	55                   	push   %ebp
+     321:	89 e5                	mov    %esp,%ebp
+     323:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     326:	80 3a 00             	cmpb   $0x0,(%edx)
+     329:	74 15                	je     340 <strlen+0x20>
+     32b:	31 c0                	xor    %eax,%eax
+     32d:	8d 76 00             	lea    0x0(%esi),%esi
+     330:	83 c0 01             	add    $0x1,%eax
+     333:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     337:	89 c1                	mov    %eax,%ecx
+     339:	75 f5                	jne    330 <strlen+0x10>
+    ;
+  return n;
+}
+     33b:	89 c8                	mov    %ecx,%eax
+     33d:	5d                   	pop    %ebp
+     33e:	c3                   	ret
+     33f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     340:	31 c9                	xor    %ecx,%ecx
+}
+     342:	5d                   	pop    %ebp
+     343:	89 c8                	mov    %ecx,%eax
+     345:	c3                   	ret
+     346:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     34d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000350 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     350:	55                   	push   %ebp
+     351:	89 e5                	mov    %esp,%ebp
+     353:	57                   	push   %edi
+     354:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     357:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     35a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     35d:	89 d7                	mov    %edx,%edi
+     35f:	fc                   	cld
+     360:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     362:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     365:	89 d0                	mov    %edx,%eax
+     367:	c9                   	leave
+     368:	c3                   	ret
+     369:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000370 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     370:	55                   	push   %ebp
+     371:	89 e5                	mov    %esp,%ebp
+     373:	56                   	push   %esi
+     374:	53                   	push   %ebx
+     375:	8b 75 10             	mov    0x10(%ebp),%esi
+     378:	8b 55 08             	mov    0x8(%ebp),%edx
+     37b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+     37e:	85 f6                	test   %esi,%esi
+     380:	74 2e                	je     3b0 <memcmp+0x40>
+     382:	01 c6                	add    %eax,%esi
+     384:	eb 14                	jmp    39a <memcmp+0x2a>
+     386:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     38d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+     390:	83 c0 01             	add    $0x1,%eax
+     393:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+     396:	39 f0                	cmp    %esi,%eax
+     398:	74 16                	je     3b0 <memcmp+0x40>
+    if(*s1 != *s2)
+     39a:	0f b6 0a             	movzbl (%edx),%ecx
+     39d:	0f b6 18             	movzbl (%eax),%ebx
+     3a0:	38 d9                	cmp    %bl,%cl
+     3a2:	74 ec                	je     390 <memcmp+0x20>
+      return *s1 - *s2;
+     3a4:	0f b6 c1             	movzbl %cl,%eax
+     3a7:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+     3a9:	5b                   	pop    %ebx
+     3aa:	5e                   	pop    %esi
+     3ab:	5d                   	pop    %ebp
+     3ac:	c3                   	ret
+     3ad:	8d 76 00             	lea    0x0(%esi),%esi
+     3b0:	5b                   	pop    %ebx
+  return 0;
+     3b1:	31 c0                	xor    %eax,%eax
+}
+     3b3:	5e                   	pop    %esi
+     3b4:	5d                   	pop    %ebp
+     3b5:	c3                   	ret
+     3b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003c0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     3c0:	55                   	push   %ebp
+     3c1:	89 e5                	mov    %esp,%ebp
+     3c3:	8b 45 08             	mov    0x8(%ebp),%eax
+     3c6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     3ca:	0f b6 10             	movzbl (%eax),%edx
+     3cd:	84 d2                	test   %dl,%dl
+     3cf:	75 12                	jne    3e3 <strchr+0x23>
+     3d1:	eb 1d                	jmp    3f0 <strchr+0x30>
+     3d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     3d7:	90                   	nop
+     3d8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     3dc:	83 c0 01             	add    $0x1,%eax
+     3df:	84 d2                	test   %dl,%dl
+     3e1:	74 0d                	je     3f0 <strchr+0x30>
+    if(*s == c)
+     3e3:	38 d1                	cmp    %dl,%cl
+     3e5:	75 f1                	jne    3d8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     3e7:	5d                   	pop    %ebp
+     3e8:	c3                   	ret
+     3e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     3f0:	31 c0                	xor    %eax,%eax
+}
+     3f2:	5d                   	pop    %ebp
+     3f3:	c3                   	ret
+     3f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     3ff:	90                   	nop
+
+00000400 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     400:	55                   	push   %ebp
+     401:	89 e5                	mov    %esp,%ebp
+     403:	57                   	push   %edi
+     404:	56                   	push   %esi
+int
+read(int fd, void *buf, int n)
+{
+  if(flushhook)
+    flushhook();
+  return _read(fd, buf, n);
+     405:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     408:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     409:	31 db                	xor    %ebx,%ebx
+{
+     40b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     40e:	eb 32                	jmp    442 <gets+0x42>
+  if(flushhook)
+     410:	a1 14 22 00 00       	mov    0x2214,%eax
+     415:	85 c0                	test   %eax,%eax
+     417:	74 02                	je     41b <gets+0x1b>
+    flushhook();
+     419:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+     41b:	83 ec 04             	sub    $0x4,%esp
+     41e:	6a 01                	push   $0x1
+     420:	56                   	push   %esi
+     421:	6a 00                	push   $0x0
+     423:	e8 60 03 00 00       	call   788 <_read>
+    if(cc < 1)
+     428:	83 c4 10             	add    $0x10,%esp
+     42b:	85 c0                	test   %eax,%eax
+     42d:	7e 1d                	jle    44c <gets+0x4c>
+    buf[i++] = c;
+     42f:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     433:	8b 55 08             	mov    0x8(%ebp),%edx
+     436:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     43a:	3c 0a                	cmp    $0xa,%al
+     43c:	74 10                	je     44e <gets+0x4e>
+     43e:	3c 0d                	cmp    $0xd,%al
+     440:	74 0c                	je     44e <gets+0x4e>
+  for(i=0; i+1 < max; ){
+     442:	89 df                	mov    %ebx,%edi
+     444:	83 c3 01             	add    $0x1,%ebx
+     447:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     44a:	7c c4                	jl     410 <gets+0x10>
+     44c:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+     44e:	8b 45 08             	mov    0x8(%ebp),%eax
+     451:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+     455:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     458:	5b                   	pop    %ebx
+     459:	5e                   	pop    %esi
+     45a:	5f                   	pop    %edi
+     45b:	5d                   	pop    %ebp
+     45c:	c3                   	ret
+     45d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000460 <stat>:
+{
+     460:	55                   	push   %ebp
+     461:	89 e5                	mov    %esp,%ebp
+     463:	56                   	push   %esi
+     464:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+     465:	83 ec 08             	sub    $0x8,%esp
+     468:	6a 00                	push   $0x0
+     46a:	ff 75 08             	push   0x8(%ebp)
+     46d:	e8 3e 03 00 00       	call   7b0 <open>
+  if(fd < 0)
+     472:	83 c4 10             	add    $0x10,%esp
+     475:	85 c0                	test   %eax,%eax
+     477:	78 37                	js     4b0 <stat+0x50>
+  r = fstat(fd, st);
+     479:	83 ec 08             	sub    $0x8,%esp
+     47c:	ff 75 0c             	push   0xc(%ebp)
+     47f:	89 c3                	mov    %eax,%ebx
+     481:	50                   	push   %eax
+     482:	e8 41 03 00 00       	call   7c8 <fstat>
+}
+
+int
+close(int fd)
+{
+  if(flushhook)
+     487:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+     48a:	89 c6                	mov    %eax,%esi
+  if(flushhook)
+     48c:	a1 14 22 00 00       	mov    0x2214,%eax
+     491:	85 c0                	test   %eax,%eax
+     493:	74 02                	je     497 <stat+0x37>
+    flushhook();
+     495:	ff d0                	call   *%eax
+  return _close(fd);
+     497:	83 ec 0c             	sub    $0xc,%esp
+     49a:	53                   	push   %ebx
+     49b:	e8 f8 02 00 00       	call   798 <_close>
+     4a0:	83 c4 10             	add    $0x10,%esp
+}
+     4a3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     4a6:	89 f0                	mov    %esi,%eax
+     4a8:	5b                   	pop    %ebx
+     4a9:	5e                   	pop    %esi
+     4aa:	5d                   	pop    %ebp
+     4ab:	c3                   	ret
+     4ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+     4b0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     4b5:	eb ec                	jmp    4a3 <stat+0x43>
+     4b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4be:	66 90                	xchg   %ax,%ax
+
+000004c0 <atoi>:
+{
+     4c0:	55                   	push   %ebp
+     4c1:	89 e5                	mov    %esp,%ebp
+     4c3:	53                   	push   %ebx
+     4c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+     4c7:	0f be 02             	movsbl (%edx),%eax
+     4ca:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     4cd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     4d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     4d5:	77 1e                	ja     4f5 <atoi+0x35>
+     4d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4de:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     4e0:	83 c2 01             	add    $0x1,%edx
+     4e3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     4e6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     4ea:	0f be 02             	movsbl (%edx),%eax
+     4ed:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     4f0:	80 fb 09             	cmp    $0x9,%bl
+     4f3:	76 eb                	jbe    4e0 <atoi+0x20>
+}
+     4f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     4f8:	89 c8                	mov    %ecx,%eax
+     4fa:	c9                   	leave
+     4fb:	c3                   	ret
+     4fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000500 <memmove>:
+{
+     500:	55                   	push   %ebp
+     501:	89 e5                	mov    %esp,%ebp
+     503:	57                   	push   %edi
+     504:	56                   	push   %esi
+     505:	8b 45 10             	mov    0x10(%ebp),%eax
+     508:	8b 55 08             	mov    0x8(%ebp),%edx
+     50b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+     50e:	85 c0                	test   %eax,%eax
+     510:	7e 13                	jle    525 <memmove+0x25>
+     512:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     514:	89 d7                	mov    %edx,%edi
+     516:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     51d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     520:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     521:	39 f8                	cmp    %edi,%eax
+     523:	75 fb                	jne    520 <memmove+0x20>
+}
+     525:	5e                   	pop    %esi
+     526:	89 d0                	mov    %edx,%eax
+     528:	5f                   	pop    %edi
+     529:	5d                   	pop    %ebp
+     52a:	c3                   	ret
+     52b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     52f:	90                   	nop
+
+00000530 <fork>:
+  if(flushhook)
+     530:	a1 14 22 00 00       	mov    0x2214,%eax
+     535:	85 c0                	test   %eax,%eax
+     537:	74 17                	je     550 <fork+0x20>
+{
+     539:	55                   	push   %ebp
+     53a:	89 e5                	mov    %esp,%ebp
+     53c:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+     53f:	ff d0                	call   *%eax
+}
+     541:	c9                   	leave
+  return _fork();
+     542:	e9 21 02 00 00       	jmp    768 <_fork>
+     547:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     54e:	66 90                	xchg   %ax,%ax
+     550:	e9 13 02 00 00       	jmp    768 <_fork>
+     555:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     55c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000560 <exit>:
+{
+     560:	55                   	push   %ebp
+     561:	89 e5                	mov    %esp,%ebp
+     563:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+     566:	a1 14 22 00 00       	mov    0x2214,%eax
+     56b:	85 c0                	test   %eax,%eax
+     56d:	74 02                	je     571 <exit+0x11>
+    flushhook();
+     56f:	ff d0                	call   *%eax
+  _exit();
+     571:	e8 fa 01 00 00       	call   770 <_exit>
+     576:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     57d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000580 <exec>:
+{
+     580:	55                   	push   %ebp
+  if(flushhook)
+     581:	a1 14 22 00 00       	mov    0x2214,%eax
+{
+     586:	89 e5                	mov    %esp,%ebp
+     588:	56                   	push   %esi
+     589:	53                   	push   %ebx
+     58a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     58d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+     590:	85 c0                	test   %eax,%eax
+     592:	74 02                	je     596 <exec+0x16>
+    flushhook();
+     594:	ff d0                	call   *%eax
+  return _exec(path, argv);
+     596:	89 75 0c             	mov    %esi,0xc(%ebp)
+     599:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     59c:	5b                   	pop    %ebx
+     59d:	5e                   	pop    %esi
+     59e:	5d                   	pop    %ebp
+  return _exec(path, argv);
+     59f:	e9 04 02 00 00       	jmp    7a8 <_exec>
+     5a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     5af:	90                   	nop
+
+000005b0 <read>:
+{
+     5b0:	55                   	push   %ebp
+     5b1:	89 e5                	mov    %esp,%ebp
+     5b3:	57                   	push   %edi
+     5b4:	56                   	push   %esi
+     5b5:	53                   	push   %ebx
+     5b6:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     5b9:	a1 14 22 00 00       	mov    0x2214,%eax
+{
+     5be:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     5c1:	8b 75 0c             	mov    0xc(%ebp),%esi
+     5c4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     5c7:	85 c0                	test   %eax,%eax
+     5c9:	74 02                	je     5cd <read+0x1d>
+    flushhook();
+     5cb:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+     5cd:	89 7d 10             	mov    %edi,0x10(%ebp)
+     5d0:	89 75 0c             	mov    %esi,0xc(%ebp)
+     5d3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     5d6:	83 c4 0c             	add    $0xc,%esp
+     5d9:	5b                   	pop    %ebx
+     5da:	5e                   	pop    %esi
+     5db:	5f                   	pop    %edi
+     5dc:	5d                   	pop    %ebp
+  return _read(fd, buf, n);
+     5dd:	e9 a6 01 00 00       	jmp    788 <_read>
+     5e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000005f0 <readv>:
+{
+     5f0:	55                   	push   %ebp
+     5f1:	89 e5                	mov    %esp,%ebp
+     5f3:	57                   	push   %edi
+     5f4:	56                   	push   %esi
+     5f5:	53                   	push   %ebx
+     5f6:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     5f9:	a1 14 22 00 00       	mov    0x2214,%eax
+{
+     5fe:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     601:	8b 75 0c             	mov    0xc(%ebp),%esi
+     604:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     607:	85 c0                	test   %eax,%eax
+     609:	74 02                	je     60d <readv+0x1d>
+    flushhook();
+     60b:	ff d0                	call   *%eax
+  return _readv(fd, iov, cnt);
+     60d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     610:	89 75 0c             	mov    %esi,0xc(%ebp)
+     613:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     616:	83 c4 0c             	add    $0xc,%esp
+     619:	5b                   	pop    %ebx
+     61a:	5e                   	pop    %esi
+     61b:	5f                   	pop    %edi
+     61c:	5d                   	pop    %ebp
+  return _readv(fd, iov, cnt);
+     61d:	e9 76 02 00 00       	jmp    898 <_readv>
+     622:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     629:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000630 <write>:
+{
+     630:	55                   	push   %ebp
+     631:	89 e5                	mov    %esp,%ebp
+     633:	57                   	push   %edi
+     634:	56                   	push   %esi
+     635:	53                   	push   %ebx
+     636:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     639:	a1 14 22 00 00       	mov    0x2214,%eax
+{
+     63e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     641:	8b 75 0c             	mov    0xc(%ebp),%esi
+     644:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     647:	85 c0                	test   %eax,%eax
+     649:	74 02                	je     64d <write+0x1d>
+    flushhook();
+     64b:	ff d0                	call   *%eax
+  return _write(fd, buf, n);
+     64d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     650:	89 75 0c             	mov    %esi,0xc(%ebp)
+     653:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     656:	83 c4 0c             	add    $0xc,%esp
+     659:	5b                   	pop    %ebx
+     65a:	5e                   	pop    %esi
+     65b:	5f                   	pop    %edi
+     65c:	5d                   	pop    %ebp
+  return _write(fd, buf, n);
+     65d:	e9 2e 01 00 00       	jmp    790 <_write>
+     662:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     669:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000670 <writev>:
+{
+     670:	55                   	push   %ebp
+     671:	89 e5                	mov    %esp,%ebp
+     673:	57                   	push   %edi
+     674:	56                   	push   %esi
+     675:	53                   	push   %ebx
+     676:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     679:	a1 14 22 00 00       	mov    0x2214,%eax
+{
+     67e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     681:	8b 75 0c             	mov    0xc(%ebp),%esi
+     684:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     687:	85 c0                	test   %eax,%eax
+     689:	74 02                	je     68d <writev+0x1d>
+    flushhook();
+     68b:	ff d0                	call   *%eax
+  return _writev(fd, iov, cnt);
+     68d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     690:	89 75 0c             	mov    %esi,0xc(%ebp)
+     693:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     696:	83 c4 0c             	add    $0xc,%esp
+     699:	5b                   	pop    %ebx
+     69a:	5e                   	pop    %esi
+     69b:	5f                   	pop    %edi
+     69c:	5d                   	pop    %ebp
+  return _writev(fd, iov, cnt);
+     69d:	e9 fe 01 00 00       	jmp    8a0 <_writev>
+     6a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000006b0 <close>:
+{
+     6b0:	55                   	push   %ebp
+     6b1:	89 e5                	mov    %esp,%ebp
+     6b3:	53                   	push   %ebx
+     6b4:	83 ec 04             	sub    $0x4,%esp
+  if(flushhook)
+     6b7:	a1 14 22 00 00       	mov    0x2214,%eax
+{
+     6bc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(flushhook)
+     6bf:	85 c0                	test   %eax,%eax
+     6c1:	74 02                	je     6c5 <close+0x15>
+    flushhook();
+     6c3:	ff d0                	call   *%eax
+  return _close(fd);
+     6c5:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     6c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     6cb:	c9                   	leave
+  return _close(fd);
+     6cc:	e9 c7 00 00 00       	jmp    798 <_close>
+     6d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6df:	90                   	nop
+
+000006e0 <umtxinit>:
+// process that finds the mutex held enters the kernel, to sleep
+// in futexwait() until the holder's umtxunlock() wakes it.
+
+void
+umtxinit(struct umutex *m)
+{
+     6e0:	55                   	push   %ebp
+     6e1:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+     6e3:	8b 45 08             	mov    0x8(%ebp),%eax
+     6e6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     6ec:	5d                   	pop    %ebp
+     6ed:	c3                   	ret
+     6ee:	66 90                	xchg   %ax,%ax
+
+000006f0 <umtxlock>:
+
+void
+umtxlock(struct umutex *m)
+{
+     6f0:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+     6f1:	b8 01 00 00 00       	mov    $0x1,%eax
+     6f6:	89 e5                	mov    %esp,%ebp
+     6f8:	56                   	push   %esi
+     6f9:	53                   	push   %ebx
+     6fa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     6fd:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 1) == 0)
+     700:	85 c0                	test   %eax,%eax
+     702:	74 2b                	je     72f <umtxlock+0x3f>
+     704:	b8 02 00 00 00       	mov    $0x2,%eax
+     709:	f0 87 03             	lock xchg %eax,(%ebx)
+    return;
+  // Mark the mutex contended, so that its holder
+  // wakes a waiter on release, and wait.
+  while(xchg(&m->state, 2) != 0)
+     70c:	85 c0                	test   %eax,%eax
+     70e:	74 1f                	je     72f <umtxlock+0x3f>
+     710:	be 02 00 00 00       	mov    $0x2,%esi
+     715:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwait(&m->state, 2);
+     718:	83 ec 08             	sub    $0x8,%esp
+     71b:	6a 02                	push   $0x2
+     71d:	53                   	push   %ebx
+     71e:	e8 85 01 00 00       	call   8a8 <futexwait>
+     723:	89 f0                	mov    %esi,%eax
+     725:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+     728:	83 c4 10             	add    $0x10,%esp
+     72b:	85 c0                	test   %eax,%eax
+     72d:	75 e9                	jne    718 <umtxlock+0x28>
+}
+     72f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     732:	5b                   	pop    %ebx
+     733:	5e                   	pop    %esi
+     734:	5d                   	pop    %ebp
+     735:	c3                   	ret
+     736:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     73d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000740 <umtxunlock>:
+
+void
+umtxunlock(struct umutex *m)
+{
+     740:	55                   	push   %ebp
+     741:	31 c0                	xor    %eax,%eax
+     743:	89 e5                	mov    %esp,%ebp
+     745:	83 ec 08             	sub    $0x8,%esp
+     748:	8b 55 08             	mov    0x8(%ebp),%edx
+     74b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+     74e:	83 f8 02             	cmp    $0x2,%eax
+     751:	74 05                	je     758 <umtxunlock+0x18>
+    futexwake(&m->state, 1);
+}
+     753:	c9                   	leave
+     754:	c3                   	ret
+     755:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwake(&m->state, 1);
+     758:	83 ec 08             	sub    $0x8,%esp
+     75b:	6a 01                	push   $0x1
+     75d:	52                   	push   %edx
+     75e:	e8 4d 01 00 00       	call   8b0 <futexwake>
+     763:	83 c4 10             	add    $0x10,%esp
+}
+     766:	c9                   	leave
+     767:	c3                   	ret
+
+00000768 <_fork>:
+  _ ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+     768:	b8 01 00 00 00       	mov    $0x1,%eax
+     76d:	cd 40                	int    $0x40
+     76f:	c3                   	ret
+
+00000770 <_exit>:
+RAWSYSCALL(exit)
+     770:	b8 02 00 00 00       	mov    $0x2,%eax
+     775:	cd 40                	int    $0x40
+     777:	c3                   	ret
+
+00000778 <wait>:
+SYSCALL(wait)
+     778:	b8 03 00 00 00       	mov    $0x3,%eax
+     77d:	cd 40                	int    $0x40
+     77f:	c3                   	ret
+
+00000780 <pipe>:
+SYSCALL(pipe)
+     780:	b8 04 00 00 00       	mov    $0x4,%eax
+     785:	cd 40                	int    $0x40
+     787:	c3                   	ret
+
+00000788 <_read>:
+RAWSYSCALL(read)
+     788:	b8 05 00 00 00       	mov    $0x5,%eax
+     78d:	cd 40                	int    $0x40
+     78f:	c3                   	ret
+
+00000790 <_write>:
+RAWSYSCALL(write)
+     790:	b8 10 00 00 00       	mov    $0x10,%eax
+     795:	cd 40                	int    $0x40
+     797:	c3                   	ret
+
+00000798 <_close>:
+RAWSYSCALL(close)
+     798:	b8 15 00 00 00       	mov    $0x15,%eax
+     79d:	cd 40                	int    $0x40
+     79f:	c3                   	ret
+
+000007a0 <kill>:
+SYSCALL(kill)
+     7a0:	b8 06 00 00 00       	mov    $0x6,%eax
+     7a5:	cd 40                	int    $0x40
+     7a7:	c3                   	ret
+
+000007a8 <_exec>:
+RAWSYSCALL(exec)
+     7a8:	b8 07 00 00 00       	mov    $0x7,%eax
+     7ad:	cd 40                	int    $0x40
+     7af:	c3                   	ret
+
+000007b0 <open>:
+SYSCALL(open)
+     7b0:	b8 0f 00 00 00       	mov    $0xf,%eax
+     7b5:	cd 40                	int    $0x40
+     7b7:	c3                   	ret
+
+000007b8 <mknod>:
+SYSCALL(mknod)
+     7b8:	b8 11 00 00 00       	mov    $0x11,%eax
+     7bd:	cd 40                	int    $0x40
+     7bf:	c3                   	ret
+
+000007c0 <unlink>:
+SYSCALL(unlink)
+     7c0:	b8 12 00 00 00       	mov    $0x12,%eax
+     7c5:	cd 40                	int    $0x40
+     7c7:	c3                   	ret
+
+000007c8 <fstat>:
+SYSCALL(fstat)
+     7c8:	b8 08 00 00 00       	mov    $0x8,%eax
+     7cd:	cd 40                	int    $0x40
+     7cf:	c3                   	ret
+
+000007d0 <link>:
+SYSCALL(link)
+     7d0:	b8 13 00 00 00       	mov    $0x13,%eax
+     7d5:	cd 40                	int    $0x40
+     7d7:	c3                   	ret
+
+000007d8 <mkdir>:
+SYSCALL(mkdir)
+     7d8:	b8 14 00 00 00       	mov    $0x14,%eax
+     7dd:	cd 40                	int    $0x40
+     7df:	c3                   	ret
+
+000007e0 <chdir>:
+SYSCALL(chdir)
+     7e0:	b8 09 00 00 00       	mov    $0x9,%eax
+     7e5:	cd 40                	int    $0x40
+     7e7:	c3                   	ret
+
+000007e8 <dup>:
+SYSCALL(dup)
+     7e8:	b8 0a 00 00 00       	mov    $0xa,%eax
+     7ed:	cd 40                	int    $0x40
+     7ef:	c3                   	ret
+
+000007f0 <getpid>:
+SYSCALL(getpid)
+     7f0:	b8 0b 00 00 00       	mov    $0xb,%eax
+     7f5:	cd 40                	int    $0x40
+     7f7:	c3                   	ret
+
+000007f8 <sbrk>:
+SYSCALL(sbrk)
+     7f8:	b8 0c 00 00 00       	mov    $0xc,%eax
+     7fd:	cd 40                	int    $0x40
+     7ff:	c3                   	ret
+
+00000800 <sleep>:
+SYSCALL(sleep)
+     800:	b8 0d 00 00 00       	mov    $0xd,%eax
+     805:	cd 40                	int    $0x40
+     807:	c3                   	ret
+
+00000808 <uptime>:
+SYSCALL(uptime)
+     808:	b8 0e 00 00 00       	mov    $0xe,%eax
+     80d:	cd 40                	int    $0x40
+     80f:	c3                   	ret
+
+00000810 <wolfie>:
+SYSCALL(wolfie)
+     810:	b8 16 00 00 00       	mov    $0x16,%eax
+     815:	cd 40                	int    $0x40
+     817:	c3                   	ret
+
+00000818 <nice>:
+SYSCALL(nice)
+     818:	b8 17 00 00 00       	mov    $0x17,%eax
+     81d:	cd 40                	int    $0x40
+     81f:	c3                   	ret
+
+00000820 <mtxget>:
+SYSCALL(mtxget)
+     820:	b8 18 00 00 00       	mov    $0x18,%eax
+     825:	cd 40                	int    $0x40
+     827:	c3                   	ret
+
+00000828 <mtxrel>:
+SYSCALL(mtxrel)
+     828:	b8 19 00 00 00       	mov    $0x19,%eax
+     82d:	cd 40                	int    $0x40
+     82f:	c3                   	ret
+
+00000830 <mtxacq>:
+SYSCALL(mtxacq)
+     830:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     835:	cd 40                	int    $0x40
+     837:	c3                   	ret
+
+00000838 <mtxdel>:
+SYSCALL(mtxdel)
+     838:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     83d:	cd 40                	int    $0x40
+     83f:	c3                   	ret
+
+00000840 <iostat>:
+SYSCALL(iostat)
+     840:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     845:	cd 40                	int    $0x40
+     847:	c3                   	ret
+
+00000848 <mmap>:
+SYSCALL(mmap)
+     848:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     84d:	cd 40                	int    $0x40
+     84f:	c3                   	ret
+
+00000850 <munmap>:
+SYSCALL(munmap)
+     850:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     855:	cd 40                	int    $0x40
+     857:	c3                   	ret
+
+00000858 <shmget>:
+SYSCALL(shmget)
+     858:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     85d:	cd 40                	int    $0x40
+     85f:	c3                   	ret
+
+00000860 <shmat>:
+SYSCALL(shmat)
+     860:	b8 20 00 00 00       	mov    $0x20,%eax
+     865:	cd 40                	int    $0x40
+     867:	c3                   	ret
+
+00000868 <shmdt>:
+SYSCALL(shmdt)
+     868:	b8 21 00 00 00       	mov    $0x21,%eax
+     86d:	cd 40                	int    $0x40
+     86f:	c3                   	ret
+
+00000870 <shmdel>:
+SYSCALL(shmdel)
+     870:	b8 22 00 00 00       	mov    $0x22,%eax
+     875:	cd 40                	int    $0x40
+     877:	c3                   	ret
+
+00000878 <syscount>:
+SYSCALL(syscount)
+     878:	b8 23 00 00 00       	mov    $0x23,%eax
+     87d:	cd 40                	int    $0x40
+     87f:	c3                   	ret
+
+00000880 <splice>:
+SYSCALL(splice)
+     880:	b8 24 00 00 00       	mov    $0x24,%eax
+     885:	cd 40                	int    $0x40
+     887:	c3                   	ret
+
+00000888 <tee>:
+SYSCALL(tee)
+     888:	b8 25 00 00 00       	mov    $0x25,%eax
+     88d:	cd 40                	int    $0x40
+     88f:	c3                   	ret
+
+00000890 <sendfile>:
+SYSCALL(sendfile)
+     890:	b8 26 00 00 00       	mov    $0x26,%eax
+     895:	cd 40                	int    $0x40
+     897:	c3                   	ret
+
+00000898 <_readv>:
+RAWSYSCALL(readv)
+     898:	b8 27 00 00 00       	mov    $0x27,%eax
+     89d:	cd 40                	int    $0x40
+     89f:	c3                   	ret
+
+000008a0 <_writev>:
+RAWSYSCALL(writev)
+     8a0:	b8 28 00 00 00       	mov    $0x28,%eax
+     8a5:	cd 40                	int    $0x40
+     8a7:	c3                   	ret
+
+000008a8 <futexwait>:
+SYSCALL(futexwait)
+     8a8:	b8 29 00 00 00       	mov    $0x29,%eax
+     8ad:	cd 40                	int    $0x40
+     8af:	c3                   	ret
+
+000008b0 <futexwake>:
+SYSCALL(futexwake)
+     8b0:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     8b5:	cd 40                	int    $0x40
+     8b7:	c3                   	ret
+
+000008b8 <lockstat>:
+SYSCALL(lockstat)
+     8b8:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     8bd:	cd 40                	int    $0x40
+     8bf:	c3                   	ret
+
+000008c0 <clone>:
+SYSCALL(clone)
+     8c0:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     8c5:	cd 40                	int    $0x40
+     8c7:	c3                   	ret
+
+000008c8 <join>:
+SYSCALL(join)
+     8c8:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     8cd:	cd 40                	int    $0x40
+     8cf:	c3                   	ret
+
+000008d0 <stacklimit>:
+SYSCALL(stacklimit)
+     8d0:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     8d5:	cd 40                	int    $0x40
+     8d7:	c3                   	ret
+     8d8:	66 90                	xchg   %ax,%ax
+     8da:	66 90                	xchg   %ax,%ax
+     8dc:	66 90                	xchg   %ax,%ax
+     8de:	66 90                	xchg   %ax,%ax
+
+000008e0 <flushall>:
+  b->n = 0;
+}
+
+static void
+flushall(void)
+{
+     8e0:	55                   	push   %ebp
+     8e1:	89 e5                	mov    %esp,%ebp
+     8e3:	83 ec 14             	sub    $0x14,%esp
+  umtxlock(&stdoutlock);
+     8e6:	68 18 22 00 00       	push   $0x2218
+     8eb:	e8 00 fe ff ff       	call   6f0 <umtxlock>
+  if(b->n > 0)
+     8f0:	a1 08 20 00 00       	mov    0x2008,%eax
+     8f5:	83 c4 10             	add    $0x10,%esp
+     8f8:	85 c0                	test   %eax,%eax
+     8fa:	7e 17                	jle    913 <flushall+0x33>
+    _write(b->fd, b->buf, b->n);
+     8fc:	83 ec 04             	sub    $0x4,%esp
+     8ff:	50                   	push   %eax
+     900:	68 0c 20 00 00       	push   $0x200c
+     905:	ff 35 00 20 00 00    	push   0x2000
+     90b:	e8 80 fe ff ff       	call   790 <_write>
+     910:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     913:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     91a:	00 00 00 
+  flush(&stdout);
+  umtxunlock(&stdoutlock);
+     91d:	83 ec 0c             	sub    $0xc,%esp
+     920:	68 18 22 00 00       	push   $0x2218
+     925:	e8 16 fe ff ff       	call   740 <umtxunlock>
+}
+     92a:	83 c4 10             	add    $0x10,%esp
+     92d:	c9                   	leave
+     92e:	c3                   	ret
+     92f:	90                   	nop
+
+00000930 <printint>:
+    flush(b);
+}
+
+static void
+printint(struct outbuf *b, int xx, int base, int sgn)
+{
+     930:	55                   	push   %ebp
+     931:	89 e5                	mov    %esp,%ebp
+     933:	57                   	push   %edi
+     934:	89 cf                	mov    %ecx,%edi
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     936:	89 d1                	mov    %edx,%ecx
+{
+     938:	56                   	push   %esi
+     939:	53                   	push   %ebx
+     93a:	89 c3                	mov    %eax,%ebx
+     93c:	83 ec 2c             	sub    $0x2c,%esp
+  if(sgn && xx < 0){
+     93f:	85 d2                	test   %edx,%edx
+     941:	0f 89 b9 00 00 00    	jns    a00 <printint+0xd0>
+     947:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     94b:	0f 84 af 00 00 00    	je     a00 <printint+0xd0>
+    x = -xx;
+     951:	f7 d9                	neg    %ecx
+    neg = 1;
+     953:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     958:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     95b:	31 f6                	xor    %esi,%esi
+     95d:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     960:	89 c8                	mov    %ecx,%eax
+     962:	31 d2                	xor    %edx,%edx
+     964:	89 f3                	mov    %esi,%ebx
+     966:	f7 f7                	div    %edi
+     968:	8d 76 01             	lea    0x1(%esi),%esi
+     96b:	0f b6 92 64 16 00 00 	movzbl 0x1664(%edx),%edx
+     972:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     976:	89 ca                	mov    %ecx,%edx
+     978:	89 c1                	mov    %eax,%ecx
+     97a:	39 fa                	cmp    %edi,%edx
+     97c:	73 e2                	jae    960 <printint+0x30>
+  if(neg)
+     97e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     981:	89 d9                	mov    %ebx,%ecx
+     983:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     986:	85 c0                	test   %eax,%eax
+     988:	74 07                	je     991 <printint+0x61>
+    buf[i++] = '-';
+     98a:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     98f:	89 f1                	mov    %esi,%ecx
+     991:	8d 75 d8             	lea    -0x28(%ebp),%esi
+     994:	89 cf                	mov    %ecx,%edi
+     996:	01 f7                	add    %esi,%edi
+     998:	eb 1a                	jmp    9b4 <printint+0x84>
+     99a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    *b->str++ = c;
+     9a0:	8d 48 01             	lea    0x1(%eax),%ecx
+     9a3:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+     9a9:	88 10                	mov    %dl,(%eax)
+
+  while(--i >= 0)
+     9ab:	8d 47 ff             	lea    -0x1(%edi),%eax
+     9ae:	39 fe                	cmp    %edi,%esi
+     9b0:	74 40                	je     9f2 <printint+0xc2>
+     9b2:	89 c7                	mov    %eax,%edi
+  if(b->str){
+     9b4:	8b 83 0c 02 00 00    	mov    0x20c(%ebx),%eax
+    putc(b, buf[i]);
+     9ba:	0f b6 17             	movzbl (%edi),%edx
+  if(b->str){
+     9bd:	85 c0                	test   %eax,%eax
+     9bf:	75 df                	jne    9a0 <printint+0x70>
+  b->buf[b->n++] = c;
+     9c1:	8b 4b 08             	mov    0x8(%ebx),%ecx
+     9c4:	8d 41 01             	lea    0x1(%ecx),%eax
+     9c7:	89 43 08             	mov    %eax,0x8(%ebx)
+     9ca:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+     9ce:	3d 00 02 00 00       	cmp    $0x200,%eax
+     9d3:	74 3b                	je     a10 <printint+0xe0>
+     9d5:	80 fa 0a             	cmp    $0xa,%dl
+     9d8:	75 d1                	jne    9ab <printint+0x7b>
+     9da:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+     9de:	75 cb                	jne    9ab <printint+0x7b>
+  if(b->n > 0)
+     9e0:	85 c0                	test   %eax,%eax
+     9e2:	7f 2c                	jg     a10 <printint+0xe0>
+  b->n = 0;
+     9e4:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  while(--i >= 0)
+     9eb:	8d 47 ff             	lea    -0x1(%edi),%eax
+     9ee:	39 fe                	cmp    %edi,%esi
+     9f0:	75 c0                	jne    9b2 <printint+0x82>
+}
+     9f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     9f5:	5b                   	pop    %ebx
+     9f6:	5e                   	pop    %esi
+     9f7:	5f                   	pop    %edi
+     9f8:	5d                   	pop    %ebp
+     9f9:	c3                   	ret
+     9fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  neg = 0;
+     a00:	31 c0                	xor    %eax,%eax
+     a02:	e9 51 ff ff ff       	jmp    958 <printint+0x28>
+     a07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a0e:	66 90                	xchg   %ax,%ax
+    _write(b->fd, b->buf, b->n);
+     a10:	83 ec 04             	sub    $0x4,%esp
+     a13:	50                   	push   %eax
+     a14:	8d 43 0c             	lea    0xc(%ebx),%eax
+     a17:	50                   	push   %eax
+     a18:	ff 33                	push   (%ebx)
+     a1a:	e8 71 fd ff ff       	call   790 <_write>
+     a1f:	83 c4 10             	add    $0x10,%esp
+     a22:	eb c0                	jmp    9e4 <printint+0xb4>
+     a24:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     a2f:	90                   	nop
+
+00000a30 <putc>:
+{
+     a30:	55                   	push   %ebp
+     a31:	89 e5                	mov    %esp,%ebp
+     a33:	53                   	push   %ebx
+     a34:	89 c3                	mov    %eax,%ebx
+     a36:	83 ec 04             	sub    $0x4,%esp
+  if(b->str){
+     a39:	8b 80 0c 02 00 00    	mov    0x20c(%eax),%eax
+     a3f:	85 c0                	test   %eax,%eax
+     a41:	74 15                	je     a58 <putc+0x28>
+    *b->str++ = c;
+     a43:	8d 48 01             	lea    0x1(%eax),%ecx
+     a46:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+     a4c:	88 10                	mov    %dl,(%eax)
+}
+     a4e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     a51:	c9                   	leave
+     a52:	c3                   	ret
+     a53:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     a57:	90                   	nop
+  b->buf[b->n++] = c;
+     a58:	8b 4b 08             	mov    0x8(%ebx),%ecx
+     a5b:	8d 41 01             	lea    0x1(%ecx),%eax
+     a5e:	89 43 08             	mov    %eax,0x8(%ebx)
+     a61:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+     a65:	3d 00 02 00 00       	cmp    $0x200,%eax
+     a6a:	74 14                	je     a80 <putc+0x50>
+     a6c:	80 fa 0a             	cmp    $0xa,%dl
+     a6f:	75 dd                	jne    a4e <putc+0x1e>
+     a71:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+     a75:	75 d7                	jne    a4e <putc+0x1e>
+  if(b->n > 0)
+     a77:	85 c0                	test   %eax,%eax
+     a79:	7e 17                	jle    a92 <putc+0x62>
+     a7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     a7f:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     a80:	83 ec 04             	sub    $0x4,%esp
+     a83:	50                   	push   %eax
+     a84:	8d 43 0c             	lea    0xc(%ebx),%eax
+     a87:	50                   	push   %eax
+     a88:	ff 33                	push   (%ebx)
+     a8a:	e8 01 fd ff ff       	call   790 <_write>
+     a8f:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     a92:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+     a99:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     a9c:	c9                   	leave
+     a9d:	c3                   	ret
+     a9e:	66 90                	xchg   %ax,%ax
+
+00000aa0 <format>:
+
+// Format fmt and the arguments at ap into b.
+// Only understands %d, %x, %p, %s, %c.
+static void
+format(struct outbuf *b, const char *fmt, uint *ap)
+{
+     aa0:	55                   	push   %ebp
+     aa1:	89 e5                	mov    %esp,%ebp
+     aa3:	57                   	push   %edi
+     aa4:	89 c7                	mov    %eax,%edi
+     aa6:	56                   	push   %esi
+     aa7:	53                   	push   %ebx
+     aa8:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+     aab:	0f b6 02             	movzbl (%edx),%eax
+{
+     aae:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  for(i = 0; fmt[i]; i++){
+     ab1:	84 c0                	test   %al,%al
+     ab3:	74 5a                	je     b0f <format+0x6f>
+     ab5:	8d 5a 01             	lea    0x1(%edx),%ebx
+     ab8:	31 f6                	xor    %esi,%esi
+     aba:	eb 1c                	jmp    ad8 <format+0x38>
+     abc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     ac0:	83 f8 25             	cmp    $0x25,%eax
+     ac3:	74 3b                	je     b00 <format+0x60>
+        state = '%';
+      } else {
+        putc(b, c);
+     ac5:	89 ca                	mov    %ecx,%edx
+     ac7:	89 f8                	mov    %edi,%eax
+     ac9:	e8 62 ff ff ff       	call   a30 <putc>
+  for(i = 0; fmt[i]; i++){
+     ace:	0f b6 03             	movzbl (%ebx),%eax
+     ad1:	83 c3 01             	add    $0x1,%ebx
+     ad4:	84 c0                	test   %al,%al
+     ad6:	74 37                	je     b0f <format+0x6f>
+    c = fmt[i] & 0xff;
+     ad8:	0f be c8             	movsbl %al,%ecx
+     adb:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     ade:	85 f6                	test   %esi,%esi
+     ae0:	74 de                	je     ac0 <format+0x20>
+      }
+    } else if(state == '%'){
+     ae2:	83 fe 25             	cmp    $0x25,%esi
+     ae5:	75 e7                	jne    ace <format+0x2e>
+      if(c == 'd'){
+     ae7:	83 f8 25             	cmp    $0x25,%eax
+     aea:	74 46                	je     b32 <format+0x92>
+     aec:	83 e8 63             	sub    $0x63,%eax
+     aef:	83 f8 15             	cmp    $0x15,%eax
+     af2:	77 2c                	ja     b20 <format+0x80>
+     af4:	ff 24 85 0c 16 00 00 	jmp    *0x160c(,%eax,4)
+     afb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     aff:	90                   	nop
+  for(i = 0; fmt[i]; i++){
+     b00:	0f b6 03             	movzbl (%ebx),%eax
+     b03:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+     b06:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+     b0b:	84 c0                	test   %al,%al
+     b0d:	75 c9                	jne    ad8 <format+0x38>
+        putc(b, c);
+      }
+      state = 0;
+    }
+  }
+}
+     b0f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     b12:	5b                   	pop    %ebx
+     b13:	5e                   	pop    %esi
+     b14:	5f                   	pop    %edi
+     b15:	5d                   	pop    %ebp
+     b16:	c3                   	ret
+     b17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b1e:	66 90                	xchg   %ax,%ax
+        putc(b, '%');
+     b20:	ba 25 00 00 00       	mov    $0x25,%edx
+     b25:	89 f8                	mov    %edi,%eax
+     b27:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     b2a:	e8 01 ff ff ff       	call   a30 <putc>
+        putc(b, c);
+     b2f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     b32:	89 ca                	mov    %ecx,%edx
+     b34:	89 f8                	mov    %edi,%eax
+      state = 0;
+     b36:	31 f6                	xor    %esi,%esi
+        putc(b, c);
+     b38:	e8 f3 fe ff ff       	call   a30 <putc>
+     b3d:	eb 8f                	jmp    ace <format+0x2e>
+     b3f:	90                   	nop
+        printint(b, *ap, 16, 0);
+     b40:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     b43:	83 ec 0c             	sub    $0xc,%esp
+     b46:	b9 10 00 00 00       	mov    $0x10,%ecx
+     b4b:	8b 16                	mov    (%esi),%edx
+     b4d:	6a 00                	push   $0x0
+        ap++;
+     b4f:	83 c6 04             	add    $0x4,%esi
+        printint(b, *ap, 16, 0);
+     b52:	89 f8                	mov    %edi,%eax
+     b54:	e8 d7 fd ff ff       	call   930 <printint>
+        ap++;
+     b59:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+     b5c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     b5f:	31 f6                	xor    %esi,%esi
+     b61:	e9 68 ff ff ff       	jmp    ace <format+0x2e>
+     b66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b6d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     b70:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     b73:	8b 30                	mov    (%eax),%esi
+        ap++;
+     b75:	83 c0 04             	add    $0x4,%eax
+     b78:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+     b7b:	85 f6                	test   %esi,%esi
+     b7d:	75 1b                	jne    b9a <format+0xfa>
+     b7f:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+     b84:	be 04 16 00 00       	mov    $0x1604,%esi
+     b89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+          putc(b, *s);
+     b90:	89 f8                	mov    %edi,%eax
+          s++;
+     b92:	83 c6 01             	add    $0x1,%esi
+          putc(b, *s);
+     b95:	e8 96 fe ff ff       	call   a30 <putc>
+        while(*s != 0){
+     b9a:	0f be 16             	movsbl (%esi),%edx
+     b9d:	84 d2                	test   %dl,%dl
+     b9f:	75 ef                	jne    b90 <format+0xf0>
+      state = 0;
+     ba1:	31 f6                	xor    %esi,%esi
+     ba3:	e9 26 ff ff ff       	jmp    ace <format+0x2e>
+     ba8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     baf:	90                   	nop
+        printint(b, *ap, 10, 1);
+     bb0:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     bb3:	83 ec 0c             	sub    $0xc,%esp
+     bb6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     bbb:	8b 16                	mov    (%esi),%edx
+     bbd:	6a 01                	push   $0x1
+     bbf:	eb 8e                	jmp    b4f <format+0xaf>
+     bc1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(b, *ap);
+     bc8:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     bcb:	89 f8                	mov    %edi,%eax
+     bcd:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+     bd0:	83 c6 04             	add    $0x4,%esi
+        putc(b, *ap);
+     bd3:	e8 58 fe ff ff       	call   a30 <putc>
+        ap++;
+     bd8:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      state = 0;
+     bdb:	31 f6                	xor    %esi,%esi
+     bdd:	e9 ec fe ff ff       	jmp    ace <format+0x2e>
+     be2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     be9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000bf0 <fflush>:
+{
+     bf0:	55                   	push   %ebp
+     bf1:	89 e5                	mov    %esp,%ebp
+     bf3:	83 ec 08             	sub    $0x8,%esp
+  if(fd == stdout.fd)
+     bf6:	8b 45 08             	mov    0x8(%ebp),%eax
+     bf9:	39 05 00 20 00 00    	cmp    %eax,0x2000
+     bff:	74 07                	je     c08 <fflush+0x18>
+}
+     c01:	c9                   	leave
+     c02:	c3                   	ret
+     c03:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c07:	90                   	nop
+  umtxlock(&stdoutlock);
+     c08:	83 ec 0c             	sub    $0xc,%esp
+     c0b:	68 18 22 00 00       	push   $0x2218
+     c10:	e8 db fa ff ff       	call   6f0 <umtxlock>
+  if(b->n > 0)
+     c15:	a1 08 20 00 00       	mov    0x2008,%eax
+     c1a:	83 c4 10             	add    $0x10,%esp
+     c1d:	85 c0                	test   %eax,%eax
+     c1f:	7f 1f                	jg     c40 <fflush+0x50>
+  b->n = 0;
+     c21:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     c28:	00 00 00 
+  umtxunlock(&stdoutlock);
+     c2b:	c7 45 08 18 22 00 00 	movl   $0x2218,0x8(%ebp)
+}
+     c32:	c9                   	leave
+  umtxunlock(&stdoutlock);
+     c33:	e9 08 fb ff ff       	jmp    740 <umtxunlock>
+     c38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c3f:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     c40:	83 ec 04             	sub    $0x4,%esp
+     c43:	50                   	push   %eax
+     c44:	68 0c 20 00 00       	push   $0x200c
+     c49:	ff 35 00 20 00 00    	push   0x2000
+     c4f:	e8 3c fb ff ff       	call   790 <_write>
+     c54:	83 c4 10             	add    $0x10,%esp
+     c57:	eb c8                	jmp    c21 <fflush+0x31>
+     c59:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000c60 <setvbuf>:
+{
+     c60:	55                   	push   %ebp
+     c61:	89 e5                	mov    %esp,%ebp
+     c63:	53                   	push   %ebx
+     c64:	83 ec 04             	sub    $0x4,%esp
+     c67:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd != stdout.fd)
+     c6a:	8b 45 08             	mov    0x8(%ebp),%eax
+     c6d:	39 05 00 20 00 00    	cmp    %eax,0x2000
+     c73:	74 0b                	je     c80 <setvbuf+0x20>
+}
+     c75:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     c78:	c9                   	leave
+     c79:	c3                   	ret
+     c7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  umtxlock(&stdoutlock);
+     c80:	83 ec 0c             	sub    $0xc,%esp
+     c83:	68 18 22 00 00       	push   $0x2218
+     c88:	e8 63 fa ff ff       	call   6f0 <umtxlock>
+  if(b->n > 0)
+     c8d:	a1 08 20 00 00       	mov    0x2008,%eax
+     c92:	83 c4 10             	add    $0x10,%esp
+     c95:	85 c0                	test   %eax,%eax
+     c97:	7f 2f                	jg     cc8 <setvbuf+0x68>
+  b->n = 0;
+     c99:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     ca0:	00 00 00 
+  stdout.mode = mode;
+     ca3:	89 1d 04 20 00 00    	mov    %ebx,0x2004
+  flushhook = flushall;
+     ca9:	c7 05 14 22 00 00 e0 	movl   $0x8e0,0x2214
+     cb0:	08 00 00 
+}
+     cb3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&stdoutlock);
+     cb6:	c7 45 08 18 22 00 00 	movl   $0x2218,0x8(%ebp)
+}
+     cbd:	c9                   	leave
+  umtxunlock(&stdoutlock);
+     cbe:	e9 7d fa ff ff       	jmp    740 <umtxunlock>
+     cc3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     cc7:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     cc8:	83 ec 04             	sub    $0x4,%esp
+     ccb:	50                   	push   %eax
+     ccc:	68 0c 20 00 00       	push   $0x200c
+     cd1:	ff 35 00 20 00 00    	push   0x2000
+     cd7:	e8 b4 fa ff ff       	call   790 <_write>
+     cdc:	83 c4 10             	add    $0x10,%esp
+     cdf:	eb b8                	jmp    c99 <setvbuf+0x39>
+     ce1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ce8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cef:	90                   	nop
+
+00000cf0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s, %c.
+void
+printf(int fd, const char *fmt, ...)
+{
+     cf0:	55                   	push   %ebp
+     cf1:	89 e5                	mov    %esp,%ebp
+     cf3:	53                   	push   %ebx
+     cf4:	81 ec 14 02 00 00    	sub    $0x214,%esp
+     cfa:	8b 45 08             	mov    0x8(%ebp),%eax
+    local.mode = _IONBF;
+    local.n = 0;
+    local.str = 0;
+    b = &local;
+  }
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     cfd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd == stdout.fd){
+     d00:	39 05 00 20 00 00    	cmp    %eax,0x2000
+     d06:	74 48                	je     d50 <printf+0x60>
+    local.fd = fd;
+     d08:	89 85 e8 fd ff ff    	mov    %eax,-0x218(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     d0e:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     d11:	89 da                	mov    %ebx,%edx
+     d13:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+    local.mode = _IONBF;
+     d19:	c7 85 ec fd ff ff 03 	movl   $0x3,-0x214(%ebp)
+     d20:	00 00 00 
+    local.n = 0;
+     d23:	c7 85 f0 fd ff ff 00 	movl   $0x0,-0x210(%ebp)
+     d2a:	00 00 00 
+    local.str = 0;
+     d2d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     d34:	e8 67 fd ff ff       	call   aa0 <format>
+  if(b->mode == _IONBF)
+     d39:	83 bd ec fd ff ff 03 	cmpl   $0x3,-0x214(%ebp)
+     d40:	0f 84 a2 00 00 00    	je     de8 <printf+0xf8>
+    flush(b);
+  if(b == &stdout)
+    umtxunlock(&stdoutlock);
+}
+     d46:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     d49:	c9                   	leave
+     d4a:	c3                   	ret
+     d4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d4f:	90                   	nop
+    umtxlock(&stdoutlock);
+     d50:	83 ec 0c             	sub    $0xc,%esp
+     d53:	68 18 22 00 00       	push   $0x2218
+     d58:	e8 93 f9 ff ff       	call   6f0 <umtxlock>
+  if(stdout.mode == 0){
+     d5d:	a1 04 20 00 00       	mov    0x2004,%eax
+     d62:	83 c4 10             	add    $0x10,%esp
+     d65:	85 c0                	test   %eax,%eax
+     d67:	74 37                	je     da0 <printf+0xb0>
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     d69:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     d6c:	89 da                	mov    %ebx,%edx
+     d6e:	b8 00 20 00 00       	mov    $0x2000,%eax
+     d73:	e8 28 fd ff ff       	call   aa0 <format>
+  if(b->mode == _IONBF)
+     d78:	83 3d 04 20 00 00 03 	cmpl   $0x3,0x2004
+     d7f:	0f 84 ab 00 00 00    	je     e30 <printf+0x140>
+    umtxunlock(&stdoutlock);
+     d85:	83 ec 0c             	sub    $0xc,%esp
+     d88:	68 18 22 00 00       	push   $0x2218
+     d8d:	e8 ae f9 ff ff       	call   740 <umtxunlock>
+}
+     d92:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    umtxunlock(&stdoutlock);
+     d95:	83 c4 10             	add    $0x10,%esp
+}
+     d98:	c9                   	leave
+     d99:	c3                   	ret
+     d9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+     da0:	83 ec 08             	sub    $0x8,%esp
+     da3:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+     da9:	50                   	push   %eax
+     daa:	ff 35 00 20 00 00    	push   0x2000
+     db0:	e8 13 fa ff ff       	call   7c8 <fstat>
+     db5:	83 c4 10             	add    $0x10,%esp
+     db8:	89 c2                	mov    %eax,%edx
+      stdout.mode = _IOFBF;
+     dba:	b8 01 00 00 00       	mov    $0x1,%eax
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+     dbf:	85 d2                	test   %edx,%edx
+     dc1:	75 10                	jne    dd3 <printf+0xe3>
+      stdout.mode = _IOLBF;
+     dc3:	31 c0                	xor    %eax,%eax
+     dc5:	66 83 bd e8 fd ff ff 	cmpw   $0x3,-0x218(%ebp)
+     dcc:	03 
+     dcd:	0f 94 c0             	sete   %al
+     dd0:	83 c0 01             	add    $0x1,%eax
+     dd3:	a3 04 20 00 00       	mov    %eax,0x2004
+    flushhook = flushall;
+     dd8:	c7 05 14 22 00 00 e0 	movl   $0x8e0,0x2214
+     ddf:	08 00 00 
+     de2:	eb 85                	jmp    d69 <printf+0x79>
+     de4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(b->n > 0)
+     de8:	8b 85 f0 fd ff ff    	mov    -0x210(%ebp),%eax
+     dee:	85 c0                	test   %eax,%eax
+     df0:	0f 8e 50 ff ff ff    	jle    d46 <printf+0x56>
+    b = &local;
+     df6:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+    _write(b->fd, b->buf, b->n);
+     dfc:	83 ec 04             	sub    $0x4,%esp
+     dff:	50                   	push   %eax
+     e00:	8d 43 0c             	lea    0xc(%ebx),%eax
+     e03:	50                   	push   %eax
+     e04:	ff 33                	push   (%ebx)
+     e06:	e8 85 f9 ff ff       	call   790 <_write>
+  b->n = 0;
+     e0b:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  if(b == &stdout)
+     e12:	83 c4 10             	add    $0x10,%esp
+     e15:	81 fb 00 20 00 00    	cmp    $0x2000,%ebx
+     e1b:	0f 85 25 ff ff ff    	jne    d46 <printf+0x56>
+     e21:	e9 5f ff ff ff       	jmp    d85 <printf+0x95>
+     e26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e2d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(b->n > 0)
+     e30:	a1 08 20 00 00       	mov    0x2008,%eax
+    b = getstdout();
+     e35:	bb 00 20 00 00       	mov    $0x2000,%ebx
+  if(b->n > 0)
+     e3a:	85 c0                	test   %eax,%eax
+     e3c:	7f be                	jg     dfc <printf+0x10c>
+  b->n = 0;
+     e3e:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     e45:	00 00 00 
+  if(b == &stdout)
+     e48:	e9 38 ff ff ff       	jmp    d85 <printf+0x95>
+     e4d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000e50 <sprintf>:
+
+// Print to the given buffer. Only understands %d, %x, %p, %s, %c.
+int
+sprintf(char *str, const char *fmt, ...)
+{
+     e50:	55                   	push   %ebp
+     e51:	89 e5                	mov    %esp,%ebp
+     e53:	53                   	push   %ebx
+  struct outbuf b;
+
+  b.str = str;
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+     e54:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+     e5a:	8d 4d 10             	lea    0x10(%ebp),%ecx
+{
+     e5d:	81 ec 14 02 00 00    	sub    $0x214,%esp
+     e63:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+     e66:	8b 55 0c             	mov    0xc(%ebp),%edx
+  b.str = str;
+     e69:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+     e6c:	e8 2f fc ff ff       	call   aa0 <format>
+  *b.str = '\0';
+     e71:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e74:	c6 00 00             	movb   $0x0,(%eax)
+  return b.str - str;
+     e77:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e7a:	29 d8                	sub    %ebx,%eax
+}
+     e7c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     e7f:	c9                   	leave
+     e80:	c3                   	ret
+     e81:	66 90                	xchg   %ax,%ax
+     e83:	66 90                	xchg   %ax,%ax
+     e85:	66 90                	xchg   %ax,%ax
+     e87:	66 90                	xchg   %ax,%ax
+     e89:	66 90                	xchg   %ax,%ax
+     e8b:	66 90                	xchg   %ax,%ax
+     e8d:	66 90                	xchg   %ax,%ax
+     e8f:	90                   	nop
+
+00000e90 <freeblock>:
+static Header *freep;
+static struct umutex lock;  // threads made by clone() share the heap
+
+static void
+freeblock(void *ap)
+{
+     e90:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+     e91:	8d 48 f8             	lea    -0x8(%eax),%ecx
+{
+     e94:	89 e5                	mov    %esp,%ebp
+     e96:	57                   	push   %edi
+     e97:	56                   	push   %esi
+     e98:	53                   	push   %ebx
+     e99:	89 c3                	mov    %eax,%ebx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     e9b:	a1 20 22 00 00       	mov    0x2220,%eax
+     ea0:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     ea2:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     ea4:	39 ca                	cmp    %ecx,%edx
+     ea6:	73 30                	jae    ed8 <freeblock+0x48>
+     ea8:	39 c1                	cmp    %eax,%ecx
+     eaa:	72 04                	jb     eb0 <freeblock+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     eac:	39 c2                	cmp    %eax,%edx
+     eae:	72 f0                	jb     ea0 <freeblock+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     eb0:	8b 73 fc             	mov    -0x4(%ebx),%esi
+     eb3:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+     eb6:	39 f8                	cmp    %edi,%eax
+     eb8:	74 26                	je     ee0 <freeblock+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+     eba:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+     ebd:	8b 42 04             	mov    0x4(%edx),%eax
+     ec0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     ec3:	39 f1                	cmp    %esi,%ecx
+     ec5:	74 30                	je     ef7 <freeblock+0x67>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+     ec7:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+     ec9:	5b                   	pop    %ebx
+  freep = p;
+     eca:	89 15 20 22 00 00    	mov    %edx,0x2220
+}
+     ed0:	5e                   	pop    %esi
+     ed1:	5f                   	pop    %edi
+     ed2:	5d                   	pop    %ebp
+     ed3:	c3                   	ret
+     ed4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     ed8:	39 c1                	cmp    %eax,%ecx
+     eda:	72 d0                	jb     eac <freeblock+0x1c>
+     edc:	eb c2                	jmp    ea0 <freeblock+0x10>
+     ede:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+     ee0:	03 70 04             	add    0x4(%eax),%esi
+     ee3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     ee6:	8b 02                	mov    (%edx),%eax
+     ee8:	8b 00                	mov    (%eax),%eax
+     eea:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+     eed:	8b 42 04             	mov    0x4(%edx),%eax
+     ef0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     ef3:	39 f1                	cmp    %esi,%ecx
+     ef5:	75 d0                	jne    ec7 <freeblock+0x37>
+    p->s.size += bp->s.size;
+     ef7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+     efa:	89 15 20 22 00 00    	mov    %edx,0x2220
+    p->s.size += bp->s.size;
+     f00:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+     f03:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+     f06:	89 0a                	mov    %ecx,(%edx)
+}
+     f08:	5b                   	pop    %ebx
+     f09:	5e                   	pop    %esi
+     f0a:	5f                   	pop    %edi
+     f0b:	5d                   	pop    %ebp
+     f0c:	c3                   	ret
+     f0d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000f10 <free>:
+
+void
+free(void *ap)
+{
+     f10:	55                   	push   %ebp
+     f11:	89 e5                	mov    %esp,%ebp
+     f13:	53                   	push   %ebx
+     f14:	83 ec 10             	sub    $0x10,%esp
+     f17:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  umtxlock(&lock);
+     f1a:	68 1c 22 00 00       	push   $0x221c
+     f1f:	e8 cc f7 ff ff       	call   6f0 <umtxlock>
+  freeblock(ap);
+     f24:	89 d8                	mov    %ebx,%eax
+     f26:	e8 65 ff ff ff       	call   e90 <freeblock>
+  umtxunlock(&lock);
+     f2b:	c7 45 08 1c 22 00 00 	movl   $0x221c,0x8(%ebp)
+}
+     f32:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&lock);
+     f35:	83 c4 10             	add    $0x10,%esp
+}
+     f38:	c9                   	leave
+  umtxunlock(&lock);
+     f39:	e9 02 f8 ff ff       	jmp    740 <umtxunlock>
+     f3e:	66 90                	xchg   %ax,%ax
+
+00000f40 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+     f40:	55                   	push   %ebp
+     f41:	89 e5                	mov    %esp,%ebp
+     f43:	57                   	push   %edi
+     f44:	56                   	push   %esi
+     f45:	53                   	push   %ebx
+     f46:	83 ec 28             	sub    $0x28,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     f49:	8b 45 08             	mov    0x8(%ebp),%eax
+  umtxlock(&lock);
+     f4c:	68 1c 22 00 00       	push   $0x221c
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     f51:	8d 48 07             	lea    0x7(%eax),%ecx
+     f54:	c1 e9 03             	shr    $0x3,%ecx
+     f57:	8d 71 01             	lea    0x1(%ecx),%esi
+  umtxlock(&lock);
+     f5a:	e8 91 f7 ff ff       	call   6f0 <umtxlock>
+  if((prevp = freep) == 0){
+     f5f:	8b 15 20 22 00 00    	mov    0x2220,%edx
+     f65:	83 c4 10             	add    $0x10,%esp
+     f68:	85 d2                	test   %edx,%edx
+     f6a:	0f 84 b0 00 00 00    	je     1020 <malloc+0xe0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     f70:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+     f72:	8b 47 04             	mov    0x4(%edi),%eax
+     f75:	39 f0                	cmp    %esi,%eax
+     f77:	73 6f                	jae    fe8 <malloc+0xa8>
+  if(nu < 4096)
+     f79:	bb 00 10 00 00       	mov    $0x1000,%ebx
+     f7e:	39 de                	cmp    %ebx,%esi
+     f80:	0f 43 de             	cmovae %esi,%ebx
+  p = sbrk(nu * sizeof(Header));
+     f83:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+     f8a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     f8d:	eb 0a                	jmp    f99 <malloc+0x59>
+     f8f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     f90:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+     f92:	8b 47 04             	mov    0x4(%edi),%eax
+     f95:	39 f0                	cmp    %esi,%eax
+     f97:	73 4f                	jae    fe8 <malloc+0xa8>
+      }
+      freep = prevp;
+      umtxunlock(&lock);
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+     f99:	89 fa                	mov    %edi,%edx
+     f9b:	39 3d 20 22 00 00    	cmp    %edi,0x2220
+     fa1:	75 ed                	jne    f90 <malloc+0x50>
+  p = sbrk(nu * sizeof(Header));
+     fa3:	83 ec 0c             	sub    $0xc,%esp
+     fa6:	ff 75 e4             	push   -0x1c(%ebp)
+     fa9:	e8 4a f8 ff ff       	call   7f8 <sbrk>
+  if(p == (char*)-1)
+     fae:	83 c4 10             	add    $0x10,%esp
+     fb1:	83 f8 ff             	cmp    $0xffffffff,%eax
+     fb4:	74 15                	je     fcb <malloc+0x8b>
+  hp->s.size = nu;
+     fb6:	89 58 04             	mov    %ebx,0x4(%eax)
+  freeblock((void*)(hp + 1));
+     fb9:	83 c0 08             	add    $0x8,%eax
+     fbc:	e8 cf fe ff ff       	call   e90 <freeblock>
+  return freep;
+     fc1:	8b 15 20 22 00 00    	mov    0x2220,%edx
+      if((p = morecore(nunits)) == 0){
+     fc7:	85 d2                	test   %edx,%edx
+     fc9:	75 c5                	jne    f90 <malloc+0x50>
+        umtxunlock(&lock);
+     fcb:	83 ec 0c             	sub    $0xc,%esp
+     fce:	68 1c 22 00 00       	push   $0x221c
+     fd3:	e8 68 f7 ff ff       	call   740 <umtxunlock>
+        return 0;
+     fd8:	83 c4 10             	add    $0x10,%esp
+      }
+  }
+}
+     fdb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+     fde:	31 c0                	xor    %eax,%eax
+}
+     fe0:	5b                   	pop    %ebx
+     fe1:	5e                   	pop    %esi
+     fe2:	5f                   	pop    %edi
+     fe3:	5d                   	pop    %ebp
+     fe4:	c3                   	ret
+     fe5:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+     fe8:	39 c6                	cmp    %eax,%esi
+     fea:	74 64                	je     1050 <malloc+0x110>
+        p->s.size -= nunits;
+     fec:	29 f0                	sub    %esi,%eax
+     fee:	89 47 04             	mov    %eax,0x4(%edi)
+        p += p->s.size;
+     ff1:	8d 3c c7             	lea    (%edi,%eax,8),%edi
+        p->s.size = nunits;
+     ff4:	89 77 04             	mov    %esi,0x4(%edi)
+      umtxunlock(&lock);
+     ff7:	83 ec 0c             	sub    $0xc,%esp
+      freep = prevp;
+     ffa:	89 15 20 22 00 00    	mov    %edx,0x2220
+      umtxunlock(&lock);
+    1000:	68 1c 22 00 00       	push   $0x221c
+    1005:	e8 36 f7 ff ff       	call   740 <umtxunlock>
+      return (void*)(p + 1);
+    100a:	83 c4 10             	add    $0x10,%esp
+}
+    100d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    1010:	8d 47 08             	lea    0x8(%edi),%eax
+}
+    1013:	5b                   	pop    %ebx
+    1014:	5e                   	pop    %esi
+    1015:	5f                   	pop    %edi
+    1016:	5d                   	pop    %ebp
+    1017:	c3                   	ret
+    1018:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    101f:	90                   	nop
+    base.s.ptr = freep = prevp = &base;
+    1020:	c7 05 20 22 00 00 24 	movl   $0x2224,0x2220
+    1027:	22 00 00 
+    base.s.size = 0;
+    102a:	bf 24 22 00 00       	mov    $0x2224,%edi
+    base.s.ptr = freep = prevp = &base;
+    102f:	c7 05 24 22 00 00 24 	movl   $0x2224,0x2224
+    1036:	22 00 00 
+    base.s.size = 0;
+    1039:	c7 05 28 22 00 00 00 	movl   $0x0,0x2228
+    1040:	00 00 00 
+    if(p->s.size >= nunits){
+    1043:	e9 31 ff ff ff       	jmp    f79 <malloc+0x39>
+    1048:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    104f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1050:	8b 07                	mov    (%edi),%eax
+    1052:	89 02                	mov    %eax,(%edx)
+    1054:	eb a1                	jmp    ff7 <malloc+0xb7>
+    1056:	66 90                	xchg   %ax,%ax
+    1058:	66 90                	xchg   %ax,%ax
+    105a:	66 90                	xchg   %ax,%ax
+    105c:	66 90                	xchg   %ax,%ax
+    105e:	66 90                	xchg   %ax,%ax
+
+00001060 <threadstart>:
+
+#define TSTACKSZ 4096
+
+static void
+threadstart(void *fn, void *arg)
+{
+    1060:	55                   	push   %ebp
+    1061:	89 e5                	mov    %esp,%ebp
+    1063:	83 ec 14             	sub    $0x14,%esp
+  ((void (*)(void*))fn)(arg);
+    1066:	ff 75 0c             	push   0xc(%ebp)
+    1069:	ff 55 08             	call   *0x8(%ebp)
+  exit();
+    106c:	e8 ef f4 ff ff       	call   560 <exit>
+    1071:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1078:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    107f:	90                   	nop
+
+00001080 <thread_create>:
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    1080:	55                   	push   %ebp
+    1081:	89 e5                	mov    %esp,%ebp
+    1083:	53                   	push   %ebx
+    1084:	83 ec 20             	sub    $0x20,%esp
+  char *mem, *stack;
+  int pid;
+
+  if((mem = malloc(2*TSTACKSZ)) == 0)
+    1087:	68 00 20 00 00       	push   $0x2000
+    108c:	e8 af fe ff ff       	call   f40 <malloc>
+    1091:	83 c4 10             	add    $0x10,%esp
+    1094:	85 c0                	test   %eax,%eax
+    1096:	74 47                	je     10df <thread_create+0x5f>
+    1098:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)(((uint)mem + TSTACKSZ - 1) & ~(TSTACKSZ - 1));
+    109a:	8d 80 ff 0f 00 00    	lea    0xfff(%eax),%eax
+    10a0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  *(char**)stack = mem;
+    10a5:	89 18                	mov    %ebx,(%eax)
+  if((pid = clone(threadstart, (void*)fn, arg, stack)) < 0)
+    10a7:	50                   	push   %eax
+    10a8:	ff 75 0c             	push   0xc(%ebp)
+    10ab:	ff 75 08             	push   0x8(%ebp)
+    10ae:	68 60 10 00 00       	push   $0x1060
+    10b3:	e8 08 f8 ff ff       	call   8c0 <clone>
+    10b8:	83 c4 10             	add    $0x10,%esp
+    10bb:	85 c0                	test   %eax,%eax
+    10bd:	78 09                	js     10c8 <thread_create+0x48>
+    free(mem);
+  return pid;
+}
+    10bf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    10c2:	c9                   	leave
+    10c3:	c3                   	ret
+    10c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    free(mem);
+    10c8:	83 ec 0c             	sub    $0xc,%esp
+    10cb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    10ce:	53                   	push   %ebx
+    10cf:	e8 3c fe ff ff       	call   f10 <free>
+    10d4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    10d7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+    10da:	83 c4 10             	add    $0x10,%esp
+}
+    10dd:	c9                   	leave
+    10de:	c3                   	ret
+    return -1;
+    10df:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    10e4:	eb d9                	jmp    10bf <thread_create+0x3f>
+    10e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000010f0 <thread_join>:
+
+int
+thread_join(void)
+{
+    10f0:	55                   	push   %ebp
+    10f1:	89 e5                	mov    %esp,%ebp
+    10f3:	83 ec 34             	sub    $0x34,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    10f6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    10f9:	50                   	push   %eax
+    10fa:	e8 c9 f7 ff ff       	call   8c8 <join>
+    10ff:	83 c4 10             	add    $0x10,%esp
+    1102:	85 c0                	test   %eax,%eax
+    1104:	79 0a                	jns    1110 <thread_join+0x20>
+    free(*(char**)stack);
+  return pid;
+}
+    1106:	c9                   	leave
+    1107:	c3                   	ret
+    1108:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    110f:	90                   	nop
+    free(*(char**)stack);
+    1110:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1113:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1116:	83 ec 0c             	sub    $0xc,%esp
+    1119:	ff 32                	push   (%edx)
+    111b:	e8 f0 fd ff ff       	call   f10 <free>
+    1120:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1123:	83 c4 10             	add    $0x10,%esp
+}
+    1126:	c9                   	leave
+    1127:	c3                   	ret
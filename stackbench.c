@@ -0,0 +1,84 @@
+// Page faults taken per MB of stack as a fresh stack grows: by
+// recursing through STACKSZ of frames with the stack growing a
+// page per fault, and growing ahead of each fault by several
+// pages; then by a single function whose local array spans
+// BIGSZ, which grows the stack over it in one fault.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "iostat.h"
+
+#define STACKSZ (4*1024*1024)
+#define FRAME   500
+#define BIGSZ   (256*1024)
+
+uint lowest;
+
+int
+recurse(int n)
+{
+  volatile char buf[FRAME];
+
+  buf[0] = n;
+  if(n == 0){
+    lowest = (uint)buf;
+    return 0;
+  }
+  return recurse(n - 1) + buf[0];
+}
+
+int
+big(void)
+{
+  volatile char buf[BIGSZ];
+
+  buf[0] = 1;
+  lowest = (uint)buf;
+  return buf[0];
+}
+
+void
+run(char *name, int ahead, int bigframe)
+{
+  struct iostat s0, s1;
+  uint top, kb;
+  int t, nfault;
+
+  if(fork() != 0){
+    wait();
+    return;
+  }
+  if(stacklimit(-1, ahead) < 0){
+    printf(2, "stackbench: stacklimit failed\n");
+    exit();
+  }
+  top = (uint)&top;
+  iostat(&s0);
+  t = uptime();
+  if(bigframe)
+    big();
+  else
+    recurse(STACKSZ / FRAME);
+  t = uptime() - t;
+  iostat(&s1);
+  // The iostat() calls themselves take no faults: s1 is on
+  // the stack pages already in use.
+  nfault = s1.pgfault - s0.pgfault;
+  kb = (top - lowest) / 1024;
+  if(kb == 0)
+    kb = 1;
+  printf(1, "stackbench: %s: %d KB of stack, %d faults, %d per MB, %d ticks\n",
+         name, kb, nfault, nfault * 1024 / kb, t);
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+  run("recursion, no growth ahead", 0, 0);
+  run("recursion, 4 pages ahead", 4, 0);
+  run("recursion, 16 pages ahead", 16, 0);
+  run("256KB local array", 0, 1);
+  exit();
+}
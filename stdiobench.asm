@@ -0,0 +1,2480 @@
+
+_stdiobench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <perchar>:
+
+#define NLINE 200
+
+void
+perchar(void)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	57                   	push   %edi
+       4:	56                   	push   %esi
+  char line[64];
+  int i, j, n;
+
+  for(i = 0; i < NLINE; i++){
+       5:	31 f6                	xor    %esi,%esi
+{
+       7:	53                   	push   %ebx
+       8:	83 ec 4c             	sub    $0x4c,%esp
+       b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+       f:	90                   	nop
+    n = sprintf(line, "line %d: the quick brown fox jumps\n", i);
+      10:	83 ec 04             	sub    $0x4,%esp
+      13:	8d 45 a8             	lea    -0x58(%ebp),%eax
+      16:	56                   	push   %esi
+      17:	68 48 11 00 00       	push   $0x1148
+      1c:	50                   	push   %eax
+      1d:	e8 4e 0e 00 00       	call   e70 <sprintf>
+    for(j = 0; j < n; j++)
+      22:	83 c4 10             	add    $0x10,%esp
+      25:	85 c0                	test   %eax,%eax
+      27:	7e 1e                	jle    47 <perchar+0x47>
+      29:	8d 7d a8             	lea    -0x58(%ebp),%edi
+      2c:	8d 1c 07             	lea    (%edi,%eax,1),%ebx
+      2f:	90                   	nop
+      write(1, &line[j], 1);
+      30:	83 ec 04             	sub    $0x4,%esp
+      33:	6a 01                	push   $0x1
+      35:	57                   	push   %edi
+    for(j = 0; j < n; j++)
+      36:	83 c7 01             	add    $0x1,%edi
+      write(1, &line[j], 1);
+      39:	6a 01                	push   $0x1
+      3b:	e8 10 06 00 00       	call   650 <write>
+    for(j = 0; j < n; j++)
+      40:	83 c4 10             	add    $0x10,%esp
+      43:	39 df                	cmp    %ebx,%edi
+      45:	75 e9                	jne    30 <perchar+0x30>
+  for(i = 0; i < NLINE; i++){
+      47:	83 c6 01             	add    $0x1,%esi
+      4a:	81 fe c8 00 00 00    	cmp    $0xc8,%esi
+      50:	75 be                	jne    10 <perchar+0x10>
+  }
+}
+      52:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      55:	5b                   	pop    %ebx
+      56:	5e                   	pop    %esi
+      57:	5f                   	pop    %edi
+      58:	5d                   	pop    %ebp
+      59:	c3                   	ret
+      5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000060 <buffered>:
+
+void
+buffered(int mode)
+{
+      60:	55                   	push   %ebp
+      61:	89 e5                	mov    %esp,%ebp
+      63:	53                   	push   %ebx
+  int i;
+
+  setvbuf(1, mode);
+  for(i = 0; i < NLINE; i++)
+      64:	31 db                	xor    %ebx,%ebx
+{
+      66:	83 ec 0c             	sub    $0xc,%esp
+  setvbuf(1, mode);
+      69:	ff 75 08             	push   0x8(%ebp)
+      6c:	6a 01                	push   $0x1
+      6e:	e8 0d 0c 00 00       	call   c80 <setvbuf>
+      73:	83 c4 10             	add    $0x10,%esp
+      76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      7d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, "line %d: the quick brown fox jumps\n", i);
+      80:	83 ec 04             	sub    $0x4,%esp
+      83:	53                   	push   %ebx
+  for(i = 0; i < NLINE; i++)
+      84:	83 c3 01             	add    $0x1,%ebx
+    printf(1, "line %d: the quick brown fox jumps\n", i);
+      87:	68 48 11 00 00       	push   $0x1148
+      8c:	6a 01                	push   $0x1
+      8e:	e8 7d 0c 00 00       	call   d10 <printf>
+  for(i = 0; i < NLINE; i++)
+      93:	83 c4 10             	add    $0x10,%esp
+      96:	81 fb c8 00 00 00    	cmp    $0xc8,%ebx
+      9c:	75 e2                	jne    80 <buffered+0x20>
+  fflush(1);
+      9e:	c7 45 08 01 00 00 00 	movl   $0x1,0x8(%ebp)
+}
+      a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+      a8:	c9                   	leave
+  fflush(1);
+      a9:	e9 62 0b 00 00       	jmp    c10 <fflush>
+      ae:	66 90                	xchg   %ax,%ax
+
+000000b0 <report>:
+
+void
+report(char *name, int mode)
+{
+      b0:	55                   	push   %ebp
+      b1:	89 e5                	mov    %esp,%ebp
+      b3:	57                   	push   %edi
+      b4:	56                   	push   %esi
+      b5:	53                   	push   %ebx
+      b6:	83 ec 5c             	sub    $0x5c,%esp
+      b9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  int s0, t0, n, t;
+
+  s0 = syscount();
+      bc:	e8 d7 07 00 00       	call   898 <syscount>
+      c1:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  t0 = uptime();
+      c4:	e8 5f 07 00 00       	call   828 <uptime>
+      c9:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  if(mode == 0)
+      cc:	85 ff                	test   %edi,%edi
+      ce:	0f 85 f8 00 00 00    	jne    1cc <report+0x11c>
+      d4:	8d 75 a8             	lea    -0x58(%ebp),%esi
+      d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      de:	66 90                	xchg   %ax,%ax
+    n = sprintf(line, "line %d: the quick brown fox jumps\n", i);
+      e0:	83 ec 04             	sub    $0x4,%esp
+      e3:	57                   	push   %edi
+      e4:	68 48 11 00 00       	push   $0x1148
+      e9:	56                   	push   %esi
+      ea:	e8 81 0d 00 00       	call   e70 <sprintf>
+    for(j = 0; j < n; j++)
+      ef:	83 c4 10             	add    $0x10,%esp
+      f2:	85 c0                	test   %eax,%eax
+      f4:	7e 31                	jle    127 <report+0x77>
+      f6:	89 7d 0c             	mov    %edi,0xc(%ebp)
+      f9:	8d 1c 06             	lea    (%esi,%eax,1),%ebx
+      fc:	8b 55 0c             	mov    0xc(%ebp),%edx
+      ff:	89 df                	mov    %ebx,%edi
+     101:	89 f3                	mov    %esi,%ebx
+     103:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     107:	90                   	nop
+      write(1, &line[j], 1);
+     108:	83 ec 04             	sub    $0x4,%esp
+     10b:	89 55 0c             	mov    %edx,0xc(%ebp)
+     10e:	6a 01                	push   $0x1
+     110:	53                   	push   %ebx
+    for(j = 0; j < n; j++)
+     111:	83 c3 01             	add    $0x1,%ebx
+      write(1, &line[j], 1);
+     114:	6a 01                	push   $0x1
+     116:	e8 35 05 00 00       	call   650 <write>
+    for(j = 0; j < n; j++)
+     11b:	83 c4 10             	add    $0x10,%esp
+     11e:	39 df                	cmp    %ebx,%edi
+     120:	8b 55 0c             	mov    0xc(%ebp),%edx
+     123:	75 e3                	jne    108 <report+0x58>
+     125:	89 d7                	mov    %edx,%edi
+  for(i = 0; i < NLINE; i++){
+     127:	83 c7 01             	add    $0x1,%edi
+     12a:	81 ff c8 00 00 00    	cmp    $0xc8,%edi
+     130:	75 ae                	jne    e0 <report+0x30>
+    perchar();
+  else
+    buffered(mode);
+  t = uptime() - t0;
+     132:	e8 f1 06 00 00       	call   828 <uptime>
+     137:	8b 4d a0             	mov    -0x60(%ebp),%ecx
+     13a:	29 c8                	sub    %ecx,%eax
+     13c:	89 c3                	mov    %eax,%ebx
+  // Leave out the two uptime() calls and this syscount().
+  n = syscount() - s0 - 3;
+     13e:	e8 55 07 00 00       	call   898 <syscount>
+     143:	8b 4d a4             	mov    -0x5c(%ebp),%ecx
+  printf(2, "stdiobench: %s: %d syscalls for %d lines (%d.%d%d per line), %d ticks\n",
+     146:	83 ec 0c             	sub    $0xc,%esp
+     149:	53                   	push   %ebx
+     14a:	bb 67 66 66 66       	mov    $0x66666667,%ebx
+  n = syscount() - s0 - 3;
+     14f:	29 c8                	sub    %ecx,%eax
+     151:	89 c1                	mov    %eax,%ecx
+     153:	83 e9 03             	sub    $0x3,%ecx
+         name, n, NLINE, n / NLINE, n * 10 / NLINE % 10, n * 100 / NLINE % 10, t);
+     156:	89 cf                	mov    %ecx,%edi
+     158:	c1 ef 1f             	shr    $0x1f,%edi
+     15b:	01 cf                	add    %ecx,%edi
+     15d:	89 fe                	mov    %edi,%esi
+  printf(2, "stdiobench: %s: %d syscalls for %d lines (%d.%d%d per line), %d ticks\n",
+     15f:	c1 ff 1f             	sar    $0x1f,%edi
+         name, n, NLINE, n / NLINE, n * 10 / NLINE % 10, n * 100 / NLINE % 10, t);
+     162:	d1 fe                	sar    %esi
+  printf(2, "stdiobench: %s: %d syscalls for %d lines (%d.%d%d per line), %d ticks\n",
+     164:	89 f0                	mov    %esi,%eax
+     166:	f7 eb                	imul   %ebx
+     168:	89 d0                	mov    %edx,%eax
+     16a:	c1 f8 02             	sar    $0x2,%eax
+     16d:	29 f8                	sub    %edi,%eax
+         name, n, NLINE, n / NLINE, n * 10 / NLINE % 10, n * 100 / NLINE % 10, t);
+     16f:	89 cf                	mov    %ecx,%edi
+  printf(2, "stdiobench: %s: %d syscalls for %d lines (%d.%d%d per line), %d ticks\n",
+     171:	8d 04 80             	lea    (%eax,%eax,4),%eax
+         name, n, NLINE, n / NLINE, n * 10 / NLINE % 10, n * 100 / NLINE % 10, t);
+     174:	c1 ff 1f             	sar    $0x1f,%edi
+  printf(2, "stdiobench: %s: %d syscalls for %d lines (%d.%d%d per line), %d ticks\n",
+     177:	01 c0                	add    %eax,%eax
+     179:	29 c6                	sub    %eax,%esi
+         name, n, NLINE, n / NLINE, n * 10 / NLINE % 10, n * 100 / NLINE % 10, t);
+     17b:	89 c8                	mov    %ecx,%eax
+     17d:	f7 eb                	imul   %ebx
+  printf(2, "stdiobench: %s: %d syscalls for %d lines (%d.%d%d per line), %d ticks\n",
+     17f:	56                   	push   %esi
+         name, n, NLINE, n / NLINE, n * 10 / NLINE % 10, n * 100 / NLINE % 10, t);
+     180:	c1 fa 03             	sar    $0x3,%edx
+     183:	89 d6                	mov    %edx,%esi
+     185:	29 fe                	sub    %edi,%esi
+  printf(2, "stdiobench: %s: %d syscalls for %d lines (%d.%d%d per line), %d ticks\n",
+     187:	89 f0                	mov    %esi,%eax
+     189:	f7 eb                	imul   %ebx
+     18b:	89 d0                	mov    %edx,%eax
+     18d:	89 f2                	mov    %esi,%edx
+     18f:	c1 fa 1f             	sar    $0x1f,%edx
+     192:	c1 f8 02             	sar    $0x2,%eax
+     195:	29 d0                	sub    %edx,%eax
+     197:	8d 04 80             	lea    (%eax,%eax,4),%eax
+     19a:	01 c0                	add    %eax,%eax
+     19c:	29 c6                	sub    %eax,%esi
+     19e:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+     1a3:	f7 e9                	imul   %ecx
+     1a5:	56                   	push   %esi
+     1a6:	c1 fa 06             	sar    $0x6,%edx
+     1a9:	29 fa                	sub    %edi,%edx
+     1ab:	52                   	push   %edx
+     1ac:	68 c8 00 00 00       	push   $0xc8
+     1b1:	51                   	push   %ecx
+     1b2:	ff 75 08             	push   0x8(%ebp)
+     1b5:	68 6c 11 00 00       	push   $0x116c
+     1ba:	6a 02                	push   $0x2
+     1bc:	e8 4f 0b 00 00       	call   d10 <printf>
+}
+     1c1:	83 c4 30             	add    $0x30,%esp
+     1c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     1c7:	5b                   	pop    %ebx
+     1c8:	5e                   	pop    %esi
+     1c9:	5f                   	pop    %edi
+     1ca:	5d                   	pop    %ebp
+     1cb:	c3                   	ret
+  setvbuf(1, mode);
+     1cc:	83 ec 08             	sub    $0x8,%esp
+  for(i = 0; i < NLINE; i++)
+     1cf:	31 db                	xor    %ebx,%ebx
+  setvbuf(1, mode);
+     1d1:	57                   	push   %edi
+     1d2:	6a 01                	push   $0x1
+     1d4:	e8 a7 0a 00 00       	call   c80 <setvbuf>
+     1d9:	83 c4 10             	add    $0x10,%esp
+     1dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    printf(1, "line %d: the quick brown fox jumps\n", i);
+     1e0:	83 ec 04             	sub    $0x4,%esp
+     1e3:	53                   	push   %ebx
+  for(i = 0; i < NLINE; i++)
+     1e4:	83 c3 01             	add    $0x1,%ebx
+    printf(1, "line %d: the quick brown fox jumps\n", i);
+     1e7:	68 48 11 00 00       	push   $0x1148
+     1ec:	6a 01                	push   $0x1
+     1ee:	e8 1d 0b 00 00       	call   d10 <printf>
+  for(i = 0; i < NLINE; i++)
+     1f3:	83 c4 10             	add    $0x10,%esp
+     1f6:	81 fb c8 00 00 00    	cmp    $0xc8,%ebx
+     1fc:	75 e2                	jne    1e0 <report+0x130>
+  fflush(1);
+     1fe:	83 ec 0c             	sub    $0xc,%esp
+     201:	6a 01                	push   $0x1
+     203:	e8 08 0a 00 00       	call   c10 <fflush>
+}
+     208:	83 c4 10             	add    $0x10,%esp
+     20b:	e9 22 ff ff ff       	jmp    132 <report+0x82>
+
+00000210 <main>:
+
+int
+main(int argc, char *argv[])
+{
+     210:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     214:	83 e4 f0             	and    $0xfffffff0,%esp
+     217:	ff 71 fc             	push   -0x4(%ecx)
+     21a:	55                   	push   %ebp
+     21b:	89 e5                	mov    %esp,%ebp
+     21d:	51                   	push   %ecx
+     21e:	83 ec 10             	sub    $0x10,%esp
+  close(1);
+     221:	6a 01                	push   $0x1
+     223:	e8 a8 04 00 00       	call   6d0 <close>
+  if(open("stdiobench.out", O_CREATE|O_RDWR) != 1){
+     228:	58                   	pop    %eax
+     229:	5a                   	pop    %edx
+     22a:	68 02 02 00 00       	push   $0x202
+     22f:	68 dc 11 00 00       	push   $0x11dc
+     234:	e8 97 05 00 00       	call   7d0 <open>
+     239:	83 c4 10             	add    $0x10,%esp
+     23c:	83 f8 01             	cmp    $0x1,%eax
+     23f:	74 13                	je     254 <main+0x44>
+    printf(2, "stdiobench: cannot open stdiobench.out\n");
+     241:	50                   	push   %eax
+     242:	50                   	push   %eax
+     243:	68 b4 11 00 00       	push   $0x11b4
+     248:	6a 02                	push   $0x2
+     24a:	e8 c1 0a 00 00       	call   d10 <printf>
+    exit();
+     24f:	e8 2c 03 00 00       	call   580 <exit>
+  }
+  report("write per char", 0);
+     254:	50                   	push   %eax
+     255:	50                   	push   %eax
+     256:	6a 00                	push   $0x0
+     258:	68 eb 11 00 00       	push   $0x11eb
+     25d:	e8 4e fe ff ff       	call   b0 <report>
+  report("no buffering", _IONBF);
+     262:	5a                   	pop    %edx
+     263:	59                   	pop    %ecx
+     264:	6a 03                	push   $0x3
+     266:	68 fa 11 00 00       	push   $0x11fa
+     26b:	e8 40 fe ff ff       	call   b0 <report>
+  report("line buffering", _IOLBF);
+     270:	58                   	pop    %eax
+     271:	5a                   	pop    %edx
+     272:	6a 02                	push   $0x2
+     274:	68 07 12 00 00       	push   $0x1207
+     279:	e8 32 fe ff ff       	call   b0 <report>
+  report("full buffering", _IOFBF);
+     27e:	59                   	pop    %ecx
+     27f:	58                   	pop    %eax
+     280:	6a 01                	push   $0x1
+     282:	68 16 12 00 00       	push   $0x1216
+     287:	e8 24 fe ff ff       	call   b0 <report>
+  close(1);
+     28c:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     293:	e8 38 04 00 00       	call   6d0 <close>
+  unlink("stdiobench.out");
+     298:	c7 04 24 dc 11 00 00 	movl   $0x11dc,(%esp)
+     29f:	e8 3c 05 00 00       	call   7e0 <unlink>
+  exit();
+     2a4:	e8 d7 02 00 00       	call   580 <exit>
+     2a9:	66 90                	xchg   %ax,%ax
+     2ab:	66 90                	xchg   %ax,%ax
+     2ad:	66 90                	xchg   %ax,%ax
+     2af:	90                   	nop
+
+000002b0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     2b0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     2b1:	31 c0                	xor    %eax,%eax
+{
+     2b3:	89 e5                	mov    %esp,%ebp
+     2b5:	53                   	push   %ebx
+     2b6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     2b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     2bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     2c0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     2c4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     2c7:	83 c0 01             	add    $0x1,%eax
+     2ca:	84 d2                	test   %dl,%dl
+     2cc:	75 f2                	jne    2c0 <strcpy+0x10>
+    ;
+  return os;
+}
+     2ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     2d1:	89 c8                	mov    %ecx,%eax
+     2d3:	c9                   	leave
+     2d4:	c3                   	ret
+     2d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002e0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     2e0:	55                   	push   %ebp
+     2e1:	89 e5                	mov    %esp,%ebp
+     2e3:	53                   	push   %ebx
+     2e4:	8b 55 08             	mov    0x8(%ebp),%edx
+     2e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     2ea:	0f b6 02             	movzbl (%edx),%eax
+     2ed:	84 c0                	test   %al,%al
+     2ef:	75 17                	jne    308 <strcmp+0x28>
+     2f1:	eb 3a                	jmp    32d <strcmp+0x4d>
+     2f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2f7:	90                   	nop
+     2f8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     2fc:	83 c2 01             	add    $0x1,%edx
+     2ff:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     302:	84 c0                	test   %al,%al
+     304:	74 1a                	je     320 <strcmp+0x40>
+    p++, q++;
+     306:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     308:	0f b6 19             	movzbl (%ecx),%ebx
+     30b:	38 c3                	cmp    %al,%bl
+     30d:	74 e9                	je     2f8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     30f:	29 d8                	sub    %ebx,%eax
+}
+     311:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     314:	c9                   	leave
+     315:	c3                   	ret
+     316:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     31d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     320:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     324:	31 c0                	xor    %eax,%eax
+     326:	29 d8                	sub    %ebx,%eax
+}
+     328:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     32b:	c9                   	leave
+     32c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     32d:	0f b6 19             	movzbl (%ecx),%ebx
+     330:	31 c0                	xor    %eax,%eax
+     332:	eb db                	jmp    30f <strcmp+0x2f>
+     334:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     33b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     33f:	90                   	nop
+
+00000340 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     340:	55                   	push   %ebp
+     341:	89 e5                	mov    %esp,%ebp
+     343:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     346:	80 3a 00             	cmpb   $0x0,(%edx)
+     349:	74 15                	je     360 <strlen+0x20>
+     34b:	31 c0                	xor    %eax,%eax
+     34d:	8d 76 00             	lea    0x0(%esi),%esi
+     350:	83 c0 01             	add    $0x1,%eax
+     353:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     357:	89 c1                	mov    %eax,%ecx
+     359:	75 f5                	jne    350 <strlen+0x10>
+    ;
+  return n;
+}
+     35b:	89 c8                	mov    %ecx,%eax
+     35d:	5d                   	pop    %ebp
+     35e:	c3                   	ret
+     35f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     360:	31 c9                	xor    %ecx,%ecx
+}
+     362:	5d                   	pop    %ebp
+     363:	89 c8                	mov    %ecx,%eax
+     365:	c3                   	ret
+     366:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     36d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000370 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     370:	55                   	push   %ebp
+     371:	89 e5                	mov    %esp,%ebp
+     373:	57                   	push   %edi
+     374:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     377:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     37a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     37d:	89 d7                	mov    %edx,%edi
+     37f:	fc                   	cld
+     380:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     382:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     385:	89 d0                	mov    %edx,%eax
+     387:	c9                   	leave
+     388:	c3                   	ret
+     389:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000390 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     390:	55                   	push   %ebp
+     391:	89 e5                	mov    %esp,%ebp
+     393:	56                   	push   %esi
+     394:	53                   	push   %ebx
+     395:	8b 75 10             	mov    0x10(%ebp),%esi
+     398:	8b 55 08             	mov    0x8(%ebp),%edx
+     39b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+     39e:	85 f6                	test   %esi,%esi
+     3a0:	74 2e                	je     3d0 <memcmp+0x40>
+     3a2:	01 c6                	add    %eax,%esi
+     3a4:	eb 14                	jmp    3ba <memcmp+0x2a>
+     3a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3ad:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+     3b0:	83 c0 01             	add    $0x1,%eax
+     3b3:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+     3b6:	39 f0                	cmp    %esi,%eax
+     3b8:	74 16                	je     3d0 <memcmp+0x40>
+    if(*s1 != *s2)
+     3ba:	0f b6 0a             	movzbl (%edx),%ecx
+     3bd:	0f b6 18             	movzbl (%eax),%ebx
+     3c0:	38 d9                	cmp    %bl,%cl
+     3c2:	74 ec                	je     3b0 <memcmp+0x20>
+      return *s1 - *s2;
+     3c4:	0f b6 c1             	movzbl %cl,%eax
+     3c7:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+     3c9:	5b                   	pop    %ebx
+     3ca:	5e                   	pop    %esi
+     3cb:	5d                   	pop    %ebp
+     3cc:	c3                   	ret
+     3cd:	8d 76 00             	lea    0x0(%esi),%esi
+     3d0:	5b                   	pop    %ebx
+  return 0;
+     3d1:	31 c0                	xor    %eax,%eax
+}
+     3d3:	5e                   	pop    %esi
+     3d4:	5d                   	pop    %ebp
+     3d5:	c3                   	ret
+     3d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003e0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     3e0:	55                   	push   %ebp
+     3e1:	89 e5                	mov    %esp,%ebp
+     3e3:	8b 45 08             	mov    0x8(%ebp),%eax
+     3e6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     3ea:	0f b6 10             	movzbl (%eax),%edx
+     3ed:	84 d2                	test   %dl,%dl
+     3ef:	75 12                	jne    403 <strchr+0x23>
+     3f1:	eb 1d                	jmp    410 <strchr+0x30>
+     3f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     3f7:	90                   	nop
+     3f8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     3fc:	83 c0 01             	add    $0x1,%eax
+     3ff:	84 d2                	test   %dl,%dl
+     401:	74 0d                	je     410 <strchr+0x30>
+    if(*s == c)
+     403:	38 d1                	cmp    %dl,%cl
+     405:	75 f1                	jne    3f8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     407:	5d                   	pop    %ebp
+     408:	c3                   	ret
+     409:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     410:	31 c0                	xor    %eax,%eax
+}
+     412:	5d                   	pop    %ebp
+     413:	c3                   	ret
+     414:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     41b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     41f:	90                   	nop
+
+00000420 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     420:	55                   	push   %ebp
+     421:	89 e5                	mov    %esp,%ebp
+     423:	57                   	push   %edi
+     424:	56                   	push   %esi
+int
+read(int fd, void *buf, int n)
+{
+  if(flushhook)
+    flushhook();
+  return _read(fd, buf, n);
+     425:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     428:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     429:	31 db                	xor    %ebx,%ebx
+{
+     42b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     42e:	eb 32                	jmp    462 <gets+0x42>
+  if(flushhook)
+     430:	a1 10 22 00 00       	mov    0x2210,%eax
+     435:	85 c0                	test   %eax,%eax
+     437:	74 02                	je     43b <gets+0x1b>
+    flushhook();
+     439:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+     43b:	83 ec 04             	sub    $0x4,%esp
+     43e:	6a 01                	push   $0x1
+     440:	56                   	push   %esi
+     441:	6a 00                	push   $0x0
+     443:	e8 60 03 00 00       	call   7a8 <_read>
+    if(cc < 1)
+     448:	83 c4 10             	add    $0x10,%esp
+     44b:	85 c0                	test   %eax,%eax
+     44d:	7e 1d                	jle    46c <gets+0x4c>
+    buf[i++] = c;
+     44f:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     453:	8b 55 08             	mov    0x8(%ebp),%edx
+     456:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     45a:	3c 0a                	cmp    $0xa,%al
+     45c:	74 10                	je     46e <gets+0x4e>
+     45e:	3c 0d                	cmp    $0xd,%al
+     460:	74 0c                	je     46e <gets+0x4e>
+  for(i=0; i+1 < max; ){
+     462:	89 df                	mov    %ebx,%edi
+     464:	83 c3 01             	add    $0x1,%ebx
+     467:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     46a:	7c c4                	jl     430 <gets+0x10>
+     46c:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+     46e:	8b 45 08             	mov    0x8(%ebp),%eax
+     471:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+     475:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     478:	5b                   	pop    %ebx
+     479:	5e                   	pop    %esi
+     47a:	5f                   	pop    %edi
+     47b:	5d                   	pop    %ebp
+     47c:	c3                   	ret
+     47d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000480 <stat>:
+{
+     480:	55                   	push   %ebp
+     481:	89 e5                	mov    %esp,%ebp
+     483:	56                   	push   %esi
+     484:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+     485:	83 ec 08             	sub    $0x8,%esp
+     488:	6a 00                	push   $0x0
+     48a:	ff 75 08             	push   0x8(%ebp)
+     48d:	e8 3e 03 00 00       	call   7d0 <open>
+  if(fd < 0)
+     492:	83 c4 10             	add    $0x10,%esp
+     495:	85 c0                	test   %eax,%eax
+     497:	78 37                	js     4d0 <stat+0x50>
+  r = fstat(fd, st);
+     499:	83 ec 08             	sub    $0x8,%esp
+     49c:	ff 75 0c             	push   0xc(%ebp)
+     49f:	89 c3                	mov    %eax,%ebx
+     4a1:	50                   	push   %eax
+     4a2:	e8 41 03 00 00       	call   7e8 <fstat>
+}
+
+int
+close(int fd)
+{
+  if(flushhook)
+     4a7:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+     4aa:	89 c6                	mov    %eax,%esi
+  if(flushhook)
+     4ac:	a1 10 22 00 00       	mov    0x2210,%eax
+     4b1:	85 c0                	test   %eax,%eax
+     4b3:	74 02                	je     4b7 <stat+0x37>
+    flushhook();
+     4b5:	ff d0                	call   *%eax
+  return _close(fd);
+     4b7:	83 ec 0c             	sub    $0xc,%esp
+     4ba:	53                   	push   %ebx
+     4bb:	e8 f8 02 00 00       	call   7b8 <_close>
+     4c0:	83 c4 10             	add    $0x10,%esp
+}
+     4c3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     4c6:	89 f0                	mov    %esi,%eax
+     4c8:	5b                   	pop    %ebx
+     4c9:	5e                   	pop    %esi
+     4ca:	5d                   	pop    %ebp
+     4cb:	c3                   	ret
+     4cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+     4d0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     4d5:	eb ec                	jmp    4c3 <stat+0x43>
+     4d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4de:	66 90                	xchg   %ax,%ax
+
+000004e0 <atoi>:
+{
+     4e0:	55                   	push   %ebp
+     4e1:	89 e5                	mov    %esp,%ebp
+     4e3:	53                   	push   %ebx
+     4e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+     4e7:	0f be 02             	movsbl (%edx),%eax
+     4ea:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     4ed:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     4f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     4f5:	77 1e                	ja     515 <atoi+0x35>
+     4f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4fe:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     500:	83 c2 01             	add    $0x1,%edx
+     503:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     506:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     50a:	0f be 02             	movsbl (%edx),%eax
+     50d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     510:	80 fb 09             	cmp    $0x9,%bl
+     513:	76 eb                	jbe    500 <atoi+0x20>
+}
+     515:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     518:	89 c8                	mov    %ecx,%eax
+     51a:	c9                   	leave
+     51b:	c3                   	ret
+     51c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000520 <memmove>:
+{
+     520:	55                   	push   %ebp
+     521:	89 e5                	mov    %esp,%ebp
+     523:	57                   	push   %edi
+     524:	56                   	push   %esi
+     525:	8b 45 10             	mov    0x10(%ebp),%eax
+     528:	8b 55 08             	mov    0x8(%ebp),%edx
+     52b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+     52e:	85 c0                	test   %eax,%eax
+     530:	7e 13                	jle    545 <memmove+0x25>
+     532:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     534:	89 d7                	mov    %edx,%edi
+     536:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     53d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     540:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     541:	39 f8                	cmp    %edi,%eax
+     543:	75 fb                	jne    540 <memmove+0x20>
+}
+     545:	5e                   	pop    %esi
+     546:	89 d0                	mov    %edx,%eax
+     548:	5f                   	pop    %edi
+     549:	5d                   	pop    %ebp
+     54a:	c3                   	ret
+     54b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     54f:	90                   	nop
+
+00000550 <fork>:
+  if(flushhook)
+     550:	a1 10 22 00 00       	mov    0x2210,%eax
+     555:	85 c0                	test   %eax,%eax
+     557:	74 17                	je     570 <fork+0x20>
+{
+     559:	55                   	push   %ebp
+     55a:	89 e5                	mov    %esp,%ebp
+     55c:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+     55f:	ff d0                	call   *%eax
+}
+     561:	c9                   	leave
+  return _fork();
+     562:	e9 21 02 00 00       	jmp    788 <_fork>
+     567:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     56e:	66 90                	xchg   %ax,%ax
+     570:	e9 13 02 00 00       	jmp    788 <_fork>
+     575:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     57c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000580 <exit>:
+{
+     580:	55                   	push   %ebp
+     581:	89 e5                	mov    %esp,%ebp
+     583:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+     586:	a1 10 22 00 00       	mov    0x2210,%eax
+     58b:	85 c0                	test   %eax,%eax
+     58d:	74 02                	je     591 <exit+0x11>
+    flushhook();
+     58f:	ff d0                	call   *%eax
+  _exit();
+     591:	e8 fa 01 00 00       	call   790 <_exit>
+     596:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     59d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000005a0 <exec>:
+{
+     5a0:	55                   	push   %ebp
+  if(flushhook)
+     5a1:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+     5a6:	89 e5                	mov    %esp,%ebp
+     5a8:	56                   	push   %esi
+     5a9:	53                   	push   %ebx
+     5aa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     5ad:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+     5b0:	85 c0                	test   %eax,%eax
+     5b2:	74 02                	je     5b6 <exec+0x16>
+    flushhook();
+     5b4:	ff d0                	call   *%eax
+  return _exec(path, argv);
+     5b6:	89 75 0c             	mov    %esi,0xc(%ebp)
+     5b9:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     5bc:	5b                   	pop    %ebx
+     5bd:	5e                   	pop    %esi
+     5be:	5d                   	pop    %ebp
+  return _exec(path, argv);
+     5bf:	e9 04 02 00 00       	jmp    7c8 <_exec>
+     5c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     5cf:	90                   	nop
+
+000005d0 <read>:
+{
+     5d0:	55                   	push   %ebp
+     5d1:	89 e5                	mov    %esp,%ebp
+     5d3:	57                   	push   %edi
+     5d4:	56                   	push   %esi
+     5d5:	53                   	push   %ebx
+     5d6:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     5d9:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+     5de:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     5e1:	8b 75 0c             	mov    0xc(%ebp),%esi
+     5e4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     5e7:	85 c0                	test   %eax,%eax
+     5e9:	74 02                	je     5ed <read+0x1d>
+    flushhook();
+     5eb:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+     5ed:	89 7d 10             	mov    %edi,0x10(%ebp)
+     5f0:	89 75 0c             	mov    %esi,0xc(%ebp)
+     5f3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     5f6:	83 c4 0c             	add    $0xc,%esp
+     5f9:	5b                   	pop    %ebx
+     5fa:	5e                   	pop    %esi
+     5fb:	5f                   	pop    %edi
+     5fc:	5d                   	pop    %ebp
+  return _read(fd, buf, n);
+     5fd:	e9 a6 01 00 00       	jmp    7a8 <_read>
+     602:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     609:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000610 <readv>:
+{
+     610:	55                   	push   %ebp
+     611:	89 e5                	mov    %esp,%ebp
+     613:	57                   	push   %edi
+     614:	56                   	push   %esi
+     615:	53                   	push   %ebx
+     616:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     619:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+     61e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     621:	8b 75 0c             	mov    0xc(%ebp),%esi
+     624:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     627:	85 c0                	test   %eax,%eax
+     629:	74 02                	je     62d <readv+0x1d>
+    flushhook();
+     62b:	ff d0                	call   *%eax
+  return _readv(fd, iov, cnt);
+     62d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     630:	89 75 0c             	mov    %esi,0xc(%ebp)
+     633:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     636:	83 c4 0c             	add    $0xc,%esp
+     639:	5b                   	pop    %ebx
+     63a:	5e                   	pop    %esi
+     63b:	5f                   	pop    %edi
+     63c:	5d                   	pop    %ebp
+  return _readv(fd, iov, cnt);
+     63d:	e9 76 02 00 00       	jmp    8b8 <_readv>
+     642:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     649:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000650 <write>:
+{
+     650:	55                   	push   %ebp
+     651:	89 e5                	mov    %esp,%ebp
+     653:	57                   	push   %edi
+     654:	56                   	push   %esi
+     655:	53                   	push   %ebx
+     656:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     659:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+     65e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     661:	8b 75 0c             	mov    0xc(%ebp),%esi
+     664:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     667:	85 c0                	test   %eax,%eax
+     669:	74 02                	je     66d <write+0x1d>
+    flushhook();
+     66b:	ff d0                	call   *%eax
+  return _write(fd, buf, n);
+     66d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     670:	89 75 0c             	mov    %esi,0xc(%ebp)
+     673:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     676:	83 c4 0c             	add    $0xc,%esp
+     679:	5b                   	pop    %ebx
+     67a:	5e                   	pop    %esi
+     67b:	5f                   	pop    %edi
+     67c:	5d                   	pop    %ebp
+  return _write(fd, buf, n);
+     67d:	e9 2e 01 00 00       	jmp    7b0 <_write>
+     682:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     689:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000690 <writev>:
+{
+     690:	55                   	push   %ebp
+     691:	89 e5                	mov    %esp,%ebp
+     693:	57                   	push   %edi
+     694:	56                   	push   %esi
+     695:	53                   	push   %ebx
+     696:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     699:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+     69e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     6a1:	8b 75 0c             	mov    0xc(%ebp),%esi
+     6a4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     6a7:	85 c0                	test   %eax,%eax
+     6a9:	74 02                	je     6ad <writev+0x1d>
+    flushhook();
+     6ab:	ff d0                	call   *%eax
+  return _writev(fd, iov, cnt);
+     6ad:	89 7d 10             	mov    %edi,0x10(%ebp)
+     6b0:	89 75 0c             	mov    %esi,0xc(%ebp)
+     6b3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     6b6:	83 c4 0c             	add    $0xc,%esp
+     6b9:	5b                   	pop    %ebx
+     6ba:	5e                   	pop    %esi
+     6bb:	5f                   	pop    %edi
+     6bc:	5d                   	pop    %ebp
+  return _writev(fd, iov, cnt);
+     6bd:	e9 fe 01 00 00       	jmp    8c0 <_writev>
+     6c2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000006d0 <close>:
+{
+     6d0:	55                   	push   %ebp
+     6d1:	89 e5                	mov    %esp,%ebp
+     6d3:	53                   	push   %ebx
+     6d4:	83 ec 04             	sub    $0x4,%esp
+  if(flushhook)
+     6d7:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+     6dc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(flushhook)
+     6df:	85 c0                	test   %eax,%eax
+     6e1:	74 02                	je     6e5 <close+0x15>
+    flushhook();
+     6e3:	ff d0                	call   *%eax
+  return _close(fd);
+     6e5:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     6e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     6eb:	c9                   	leave
+  return _close(fd);
+     6ec:	e9 c7 00 00 00       	jmp    7b8 <_close>
+     6f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6ff:	90                   	nop
+
+00000700 <umtxinit>:
+// process that finds the mutex held enters the kernel, to sleep
+// in futexwait() until the holder's umtxunlock() wakes it.
+
+void
+umtxinit(struct umutex *m)
+{
+     700:	55                   	push   %ebp
+     701:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+     703:	8b 45 08             	mov    0x8(%ebp),%eax
+     706:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     70c:	5d                   	pop    %ebp
+     70d:	c3                   	ret
+     70e:	66 90                	xchg   %ax,%ax
+
+00000710 <umtxlock>:
+
+void
+umtxlock(struct umutex *m)
+{
+     710:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+     711:	b8 01 00 00 00       	mov    $0x1,%eax
+     716:	89 e5                	mov    %esp,%ebp
+     718:	56                   	push   %esi
+     719:	53                   	push   %ebx
+     71a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     71d:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 1) == 0)
+     720:	85 c0                	test   %eax,%eax
+     722:	74 2b                	je     74f <umtxlock+0x3f>
+     724:	b8 02 00 00 00       	mov    $0x2,%eax
+     729:	f0 87 03             	lock xchg %eax,(%ebx)
+    return;
+  // Mark the mutex contended, so that its holder
+  // wakes a waiter on release, and wait.
+  while(xchg(&m->state, 2) != 0)
+     72c:	85 c0                	test   %eax,%eax
+     72e:	74 1f                	je     74f <umtxlock+0x3f>
+     730:	be 02 00 00 00       	mov    $0x2,%esi
+     735:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwait(&m->state, 2);
+     738:	83 ec 08             	sub    $0x8,%esp
+     73b:	6a 02                	push   $0x2
+     73d:	53                   	push   %ebx
+     73e:	e8 85 01 00 00       	call   8c8 <futexwait>
+     743:	89 f0                	mov    %esi,%eax
+     745:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+     748:	83 c4 10             	add    $0x10,%esp
+     74b:	85 c0                	test   %eax,%eax
+     74d:	75 e9                	jne    738 <umtxlock+0x28>
+}
+     74f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     752:	5b                   	pop    %ebx
+     753:	5e                   	pop    %esi
+     754:	5d                   	pop    %ebp
+     755:	c3                   	ret
+     756:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     75d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000760 <umtxunlock>:
+
+void
+umtxunlock(struct umutex *m)
+{
+     760:	55                   	push   %ebp
+     761:	31 c0                	xor    %eax,%eax
+     763:	89 e5                	mov    %esp,%ebp
+     765:	83 ec 08             	sub    $0x8,%esp
+     768:	8b 55 08             	mov    0x8(%ebp),%edx
+     76b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+     76e:	83 f8 02             	cmp    $0x2,%eax
+     771:	74 05                	je     778 <umtxunlock+0x18>
+    futexwake(&m->state, 1);
+}
+     773:	c9                   	leave
+     774:	c3                   	ret
+     775:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwake(&m->state, 1);
+     778:	83 ec 08             	sub    $0x8,%esp
+     77b:	6a 01                	push   $0x1
+     77d:	52                   	push   %edx
+     77e:	e8 4d 01 00 00       	call   8d0 <futexwake>
+     783:	83 c4 10             	add    $0x10,%esp
+}
+     786:	c9                   	leave
+     787:	c3                   	ret
+
+00000788 <_fork>:
+  _ ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+     788:	b8 01 00 00 00       	mov    $0x1,%eax
+     78d:	cd 40                	int    $0x40
+     78f:	c3                   	ret
+
+00000790 <_exit>:
+RAWSYSCALL(exit)
+     790:	b8 02 00 00 00       	mov    $0x2,%eax
+     795:	cd 40                	int    $0x40
+     797:	c3                   	ret
+
+00000798 <wait>:
+SYSCALL(wait)
+     798:	b8 03 00 00 00       	mov    $0x3,%eax
+     79d:	cd 40                	int    $0x40
+     79f:	c3                   	ret
+
+000007a0 <pipe>:
+SYSCALL(pipe)
+     7a0:	b8 04 00 00 00       	mov    $0x4,%eax
+     7a5:	cd 40                	int    $0x40
+     7a7:	c3                   	ret
+
+000007a8 <_read>:
+RAWSYSCALL(read)
+     7a8:	b8 05 00 00 00       	mov    $0x5,%eax
+     7ad:	cd 40                	int    $0x40
+     7af:	c3                   	ret
+
+000007b0 <_write>:
+RAWSYSCALL(write)
+     7b0:	b8 10 00 00 00       	mov    $0x10,%eax
+     7b5:	cd 40                	int    $0x40
+     7b7:	c3                   	ret
+
+000007b8 <_close>:
+RAWSYSCALL(close)
+     7b8:	b8 15 00 00 00       	mov    $0x15,%eax
+     7bd:	cd 40                	int    $0x40
+     7bf:	c3                   	ret
+
+000007c0 <kill>:
+SYSCALL(kill)
+     7c0:	b8 06 00 00 00       	mov    $0x6,%eax
+     7c5:	cd 40                	int    $0x40
+     7c7:	c3                   	ret
+
+000007c8 <_exec>:
+RAWSYSCALL(exec)
+     7c8:	b8 07 00 00 00       	mov    $0x7,%eax
+     7cd:	cd 40                	int    $0x40
+     7cf:	c3                   	ret
+
+000007d0 <open>:
+SYSCALL(open)
+     7d0:	b8 0f 00 00 00       	mov    $0xf,%eax
+     7d5:	cd 40                	int    $0x40
+     7d7:	c3                   	ret
+
+000007d8 <mknod>:
+SYSCALL(mknod)
+     7d8:	b8 11 00 00 00       	mov    $0x11,%eax
+     7dd:	cd 40                	int    $0x40
+     7df:	c3                   	ret
+
+000007e0 <unlink>:
+SYSCALL(unlink)
+     7e0:	b8 12 00 00 00       	mov    $0x12,%eax
+     7e5:	cd 40                	int    $0x40
+     7e7:	c3                   	ret
+
+000007e8 <fstat>:
+SYSCALL(fstat)
+     7e8:	b8 08 00 00 00       	mov    $0x8,%eax
+     7ed:	cd 40                	int    $0x40
+     7ef:	c3                   	ret
+
+000007f0 <link>:
+SYSCALL(link)
+     7f0:	b8 13 00 00 00       	mov    $0x13,%eax
+     7f5:	cd 40                	int    $0x40
+     7f7:	c3                   	ret
+
+000007f8 <mkdir>:
+SYSCALL(mkdir)
+     7f8:	b8 14 00 00 00       	mov    $0x14,%eax
+     7fd:	cd 40                	int    $0x40
+     7ff:	c3                   	ret
+
+00000800 <chdir>:
+SYSCALL(chdir)
+     800:	b8 09 00 00 00       	mov    $0x9,%eax
+     805:	cd 40                	int    $0x40
+     807:	c3                   	ret
+
+00000808 <dup>:
+SYSCALL(dup)
+     808:	b8 0a 00 00 00       	mov    $0xa,%eax
+     80d:	cd 40                	int    $0x40
+     80f:	c3                   	ret
+
+00000810 <getpid>:
+SYSCALL(getpid)
+     810:	b8 0b 00 00 00       	mov    $0xb,%eax
+     815:	cd 40                	int    $0x40
+     817:	c3                   	ret
+
+00000818 <sbrk>:
+SYSCALL(sbrk)
+     818:	b8 0c 00 00 00       	mov    $0xc,%eax
+     81d:	cd 40                	int    $0x40
+     81f:	c3                   	ret
+
+00000820 <sleep>:
+SYSCALL(sleep)
+     820:	b8 0d 00 00 00       	mov    $0xd,%eax
+     825:	cd 40                	int    $0x40
+     827:	c3                   	ret
+
+00000828 <uptime>:
+SYSCALL(uptime)
+     828:	b8 0e 00 00 00       	mov    $0xe,%eax
+     82d:	cd 40                	int    $0x40
+     82f:	c3                   	ret
+
+00000830 <wolfie>:
+SYSCALL(wolfie)
+     830:	b8 16 00 00 00       	mov    $0x16,%eax
+     835:	cd 40                	int    $0x40
+     837:	c3                   	ret
+
+00000838 <nice>:
+SYSCALL(nice)
+     838:	b8 17 00 00 00       	mov    $0x17,%eax
+     83d:	cd 40                	int    $0x40
+     83f:	c3                   	ret
+
+00000840 <mtxget>:
+SYSCALL(mtxget)
+     840:	b8 18 00 00 00       	mov    $0x18,%eax
+     845:	cd 40                	int    $0x40
+     847:	c3                   	ret
+
+00000848 <mtxrel>:
+SYSCALL(mtxrel)
+     848:	b8 19 00 00 00       	mov    $0x19,%eax
+     84d:	cd 40                	int    $0x40
+     84f:	c3                   	ret
+
+00000850 <mtxacq>:
+SYSCALL(mtxacq)
+     850:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     855:	cd 40                	int    $0x40
+     857:	c3                   	ret
+
+00000858 <mtxdel>:
+SYSCALL(mtxdel)
+     858:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     85d:	cd 40                	int    $0x40
+     85f:	c3                   	ret
+
+00000860 <iostat>:
+SYSCALL(iostat)
+     860:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     865:	cd 40                	int    $0x40
+     867:	c3                   	ret
+
+00000868 <mmap>:
+SYSCALL(mmap)
+     868:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     86d:	cd 40                	int    $0x40
+     86f:	c3                   	ret
+
+00000870 <munmap>:
+SYSCALL(munmap)
+     870:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     875:	cd 40                	int    $0x40
+     877:	c3                   	ret
+
+00000878 <shmget>:
+SYSCALL(shmget)
+     878:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     87d:	cd 40                	int    $0x40
+     87f:	c3                   	ret
+
+00000880 <shmat>:
+SYSCALL(shmat)
+     880:	b8 20 00 00 00       	mov    $0x20,%eax
+     885:	cd 40                	int    $0x40
+     887:	c3                   	ret
+
+00000888 <shmdt>:
+SYSCALL(shmdt)
+     888:	b8 21 00 00 00       	mov    $0x21,%eax
+     88d:	cd 40                	int    $0x40
+     88f:	c3                   	ret
+
+00000890 <shmdel>:
+SYSCALL(shmdel)
+     890:	b8 22 00 00 00       	mov    $0x22,%eax
+     895:	cd 40                	int    $0x40
+     897:	c3                   	ret
+
+00000898 <syscount>:
+SYSCALL(syscount)
+     898:	b8 23 00 00 00       	mov    $0x23,%eax
+     89d:	cd 40                	int    $0x40
+     89f:	c3                   	ret
+
+000008a0 <splice>:
+SYSCALL(splice)
+     8a0:	b8 24 00 00 00       	mov    $0x24,%eax
+     8a5:	cd 40                	int    $0x40
+     8a7:	c3                   	ret
+
+000008a8 <tee>:
+SYSCALL(tee)
+     8a8:	b8 25 00 00 00       	mov    $0x25,%eax
+     8ad:	cd 40                	int    $0x40
+     8af:	c3                   	ret
+
+000008b0 <sendfile>:
+SYSCALL(sendfile)
+     8b0:	b8 26 00 00 00       	mov    $0x26,%eax
+     8b5:	cd 40                	int    $0x40
+     8b7:	c3                   	ret
+
+000008b8 <_readv>:
+RAWSYSCALL(readv)
+     8b8:	b8 27 00 00 00       	mov    $0x27,%eax
+     8bd:	cd 40                	int    $0x40
+     8bf:	c3                   	ret
+
+000008c0 <_writev>:
+RAWSYSCALL(writev)
+     8c0:	b8 28 00 00 00       	mov    $0x28,%eax
+     8c5:	cd 40                	int    $0x40
+     8c7:	c3                   	ret
+
+000008c8 <futexwait>:
+SYSCALL(futexwait)
+     8c8:	b8 29 00 00 00       	mov    $0x29,%eax
+     8cd:	cd 40                	int    $0x40
+     8cf:	c3                   	ret
+
+000008d0 <futexwake>:
+SYSCALL(futexwake)
+     8d0:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     8d5:	cd 40                	int    $0x40
+     8d7:	c3                   	ret
+
+000008d8 <lockstat>:
+SYSCALL(lockstat)
+     8d8:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     8dd:	cd 40                	int    $0x40
+     8df:	c3                   	ret
+
+000008e0 <clone>:
+SYSCALL(clone)
+     8e0:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     8e5:	cd 40                	int    $0x40
+     8e7:	c3                   	ret
+
+000008e8 <join>:
+SYSCALL(join)
+     8e8:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     8ed:	cd 40                	int    $0x40
+     8ef:	c3                   	ret
+
+000008f0 <stacklimit>:
+SYSCALL(stacklimit)
+     8f0:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     8f5:	cd 40                	int    $0x40
+     8f7:	c3                   	ret
+     8f8:	66 90                	xchg   %ax,%ax
+     8fa:	66 90                	xchg   %ax,%ax
+     8fc:	66 90                	xchg   %ax,%ax
+     8fe:	66 90                	xchg   %ax,%ax
+
+00000900 <flushall>:
+  b->n = 0;
+}
+
+static void
+flushall(void)
+{
+     900:	55                   	push   %ebp
+     901:	89 e5                	mov    %esp,%ebp
+     903:	83 ec 14             	sub    $0x14,%esp
+  umtxlock(&stdoutlock);
+     906:	68 14 22 00 00       	push   $0x2214
+     90b:	e8 00 fe ff ff       	call   710 <umtxlock>
+  if(b->n > 0)
+     910:	a1 08 20 00 00       	mov    0x2008,%eax
+     915:	83 c4 10             	add    $0x10,%esp
+     918:	85 c0                	test   %eax,%eax
+     91a:	7e 17                	jle    933 <flushall+0x33>
+    _write(b->fd, b->buf, b->n);
+     91c:	83 ec 04             	sub    $0x4,%esp
+     91f:	50                   	push   %eax
+     920:	68 0c 20 00 00       	push   $0x200c
+     925:	ff 35 00 20 00 00    	push   0x2000
+     92b:	e8 80 fe ff ff       	call   7b0 <_write>
+     930:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     933:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     93a:	00 00 00 
+  flush(&stdout);
+  umtxunlock(&stdoutlock);
+     93d:	83 ec 0c             	sub    $0xc,%esp
+     940:	68 14 22 00 00       	push   $0x2214
+     945:	e8 16 fe ff ff       	call   760 <umtxunlock>
+}
+     94a:	83 c4 10             	add    $0x10,%esp
+     94d:	c9                   	leave
+     94e:	c3                   	ret
+     94f:	90                   	nop
+
+00000950 <printint>:
+    flush(b);
+}
+
+static void
+printint(struct outbuf *b, int xx, int base, int sgn)
+{
+     950:	55                   	push   %ebp
+     951:	89 e5                	mov    %esp,%ebp
+     953:	57                   	push   %edi
+     954:	89 cf                	mov    %ecx,%edi
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     956:	89 d1                	mov    %edx,%ecx
+{
+     958:	56                   	push   %esi
+     959:	53                   	push   %ebx
+     95a:	89 c3                	mov    %eax,%ebx
+     95c:	83 ec 2c             	sub    $0x2c,%esp
+  if(sgn && xx < 0){
+     95f:	85 d2                	test   %edx,%edx
+     961:	0f 89 b9 00 00 00    	jns    a20 <printint+0xd0>
+     967:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     96b:	0f 84 af 00 00 00    	je     a20 <printint+0xd0>
+    x = -xx;
+     971:	f7 d9                	neg    %ecx
+    neg = 1;
+     973:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     978:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     97b:	31 f6                	xor    %esi,%esi
+     97d:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     980:	89 c8                	mov    %ecx,%eax
+     982:	31 d2                	xor    %edx,%edx
+     984:	89 f3                	mov    %esi,%ebx
+     986:	f7 f7                	div    %edi
+     988:	8d 76 01             	lea    0x1(%esi),%esi
+     98b:	0f b6 92 ac 16 00 00 	movzbl 0x16ac(%edx),%edx
+     992:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     996:	89 ca                	mov    %ecx,%edx
+     998:	89 c1                	mov    %eax,%ecx
+     99a:	39 fa                	cmp    %edi,%edx
+     99c:	73 e2                	jae    980 <printint+0x30>
+  if(neg)
+     99e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     9a1:	89 d9                	mov    %ebx,%ecx
+     9a3:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     9a6:	85 c0                	test   %eax,%eax
+     9a8:	74 07                	je     9b1 <printint+0x61>
+    buf[i++] = '-';
+     9aa:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     9af:	89 f1                	mov    %esi,%ecx
+     9b1:	8d 75 d8             	lea    -0x28(%ebp),%esi
+     9b4:	89 cf                	mov    %ecx,%edi
+     9b6:	01 f7                	add    %esi,%edi
+     9b8:	eb 1a                	jmp    9d4 <printint+0x84>
+     9ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    *b->str++ = c;
+     9c0:	8d 48 01             	lea    0x1(%eax),%ecx
+     9c3:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+     9c9:	88 10                	mov    %dl,(%eax)
+
+  while(--i >= 0)
+     9cb:	8d 47 ff             	lea    -0x1(%edi),%eax
+     9ce:	39 fe                	cmp    %edi,%esi
+     9d0:	74 40                	je     a12 <printint+0xc2>
+     9d2:	89 c7                	mov    %eax,%edi
+  if(b->str){
+     9d4:	8b 83 0c 02 00 00    	mov    0x20c(%ebx),%eax
+    putc(b, buf[i]);
+     9da:	0f b6 17             	movzbl (%edi),%edx
+  if(b->str){
+     9dd:	85 c0                	test   %eax,%eax
+     9df:	75 df                	jne    9c0 <printint+0x70>
+  b->buf[b->n++] = c;
+     9e1:	8b 4b 08             	mov    0x8(%ebx),%ecx
+     9e4:	8d 41 01             	lea    0x1(%ecx),%eax
+     9e7:	89 43 08             	mov    %eax,0x8(%ebx)
+     9ea:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+     9ee:	3d 00 02 00 00       	cmp    $0x200,%eax
+     9f3:	74 3b                	je     a30 <printint+0xe0>
+     9f5:	80 fa 0a             	cmp    $0xa,%dl
+     9f8:	75 d1                	jne    9cb <printint+0x7b>
+     9fa:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+     9fe:	75 cb                	jne    9cb <printint+0x7b>
+  if(b->n > 0)
+     a00:	85 c0                	test   %eax,%eax
+     a02:	7f 2c                	jg     a30 <printint+0xe0>
+  b->n = 0;
+     a04:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  while(--i >= 0)
+     a0b:	8d 47 ff             	lea    -0x1(%edi),%eax
+     a0e:	39 fe                	cmp    %edi,%esi
+     a10:	75 c0                	jne    9d2 <printint+0x82>
+}
+     a12:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a15:	5b                   	pop    %ebx
+     a16:	5e                   	pop    %esi
+     a17:	5f                   	pop    %edi
+     a18:	5d                   	pop    %ebp
+     a19:	c3                   	ret
+     a1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  neg = 0;
+     a20:	31 c0                	xor    %eax,%eax
+     a22:	e9 51 ff ff ff       	jmp    978 <printint+0x28>
+     a27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a2e:	66 90                	xchg   %ax,%ax
+    _write(b->fd, b->buf, b->n);
+     a30:	83 ec 04             	sub    $0x4,%esp
+     a33:	50                   	push   %eax
+     a34:	8d 43 0c             	lea    0xc(%ebx),%eax
+     a37:	50                   	push   %eax
+     a38:	ff 33                	push   (%ebx)
+     a3a:	e8 71 fd ff ff       	call   7b0 <_write>
+     a3f:	83 c4 10             	add    $0x10,%esp
+     a42:	eb c0                	jmp    a04 <printint+0xb4>
+     a44:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     a4f:	90                   	nop
+
+00000a50 <putc>:
+{
+     a50:	55                   	push   %ebp
+     a51:	89 e5                	mov    %esp,%ebp
+     a53:	53                   	push   %ebx
+     a54:	89 c3                	mov    %eax,%ebx
+     a56:	83 ec 04             	sub    $0x4,%esp
+  if(b->str){
+     a59:	8b 80 0c 02 00 00    	mov    0x20c(%eax),%eax
+     a5f:	85 c0                	test   %eax,%eax
+     a61:	74 15                	je     a78 <putc+0x28>
+    *b->str++ = c;
+     a63:	8d 48 01             	lea    0x1(%eax),%ecx
+     a66:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+     a6c:	88 10                	mov    %dl,(%eax)
+}
+     a6e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     a71:	c9                   	leave
+     a72:	c3                   	ret
+     a73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     a77:	90                   	nop
+  b->buf[b->n++] = c;
+     a78:	8b 4b 08             	mov    0x8(%ebx),%ecx
+     a7b:	8d 41 01             	lea    0x1(%ecx),%eax
+     a7e:	89 43 08             	mov    %eax,0x8(%ebx)
+     a81:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+     a85:	3d 00 02 00 00       	cmp    $0x200,%eax
+     a8a:	74 14                	je     aa0 <putc+0x50>
+     a8c:	80 fa 0a             	cmp    $0xa,%dl
+     a8f:	75 dd                	jne    a6e <putc+0x1e>
+     a91:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+     a95:	75 d7                	jne    a6e <putc+0x1e>
+  if(b->n > 0)
+     a97:	85 c0                	test   %eax,%eax
+     a99:	7e 17                	jle    ab2 <putc+0x62>
+     a9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     a9f:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     aa0:	83 ec 04             	sub    $0x4,%esp
+     aa3:	50                   	push   %eax
+     aa4:	8d 43 0c             	lea    0xc(%ebx),%eax
+     aa7:	50                   	push   %eax
+     aa8:	ff 33                	push   (%ebx)
+     aaa:	e8 01 fd ff ff       	call   7b0 <_write>
+     aaf:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     ab2:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+     ab9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     abc:	c9                   	leave
+     abd:	c3                   	ret
+     abe:	66 90                	xchg   %ax,%ax
+
+00000ac0 <format>:
+
+// Format fmt and the arguments at ap into b.
+// Only understands %d, %x, %p, %s, %c.
+static void
+format(struct outbuf *b, const char *fmt, uint *ap)
+{
+     ac0:	55                   	push   %ebp
+     ac1:	89 e5                	mov    %esp,%ebp
+     ac3:	57                   	push   %edi
+     ac4:	89 c7                	mov    %eax,%edi
+     ac6:	56                   	push   %esi
+     ac7:	53                   	push   %ebx
+     ac8:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+     acb:	0f b6 02             	movzbl (%edx),%eax
+{
+     ace:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  for(i = 0; fmt[i]; i++){
+     ad1:	84 c0                	test   %al,%al
+     ad3:	74 5a                	je     b2f <format+0x6f>
+     ad5:	8d 5a 01             	lea    0x1(%edx),%ebx
+     ad8:	31 f6                	xor    %esi,%esi
+     ada:	eb 1c                	jmp    af8 <format+0x38>
+     adc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     ae0:	83 f8 25             	cmp    $0x25,%eax
+     ae3:	74 3b                	je     b20 <format+0x60>
+        state = '%';
+      } else {
+        putc(b, c);
+     ae5:	89 ca                	mov    %ecx,%edx
+     ae7:	89 f8                	mov    %edi,%eax
+     ae9:	e8 62 ff ff ff       	call   a50 <putc>
+  for(i = 0; fmt[i]; i++){
+     aee:	0f b6 03             	movzbl (%ebx),%eax
+     af1:	83 c3 01             	add    $0x1,%ebx
+     af4:	84 c0                	test   %al,%al
+     af6:	74 37                	je     b2f <format+0x6f>
+    c = fmt[i] & 0xff;
+     af8:	0f be c8             	movsbl %al,%ecx
+     afb:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     afe:	85 f6                	test   %esi,%esi
+     b00:	74 de                	je     ae0 <format+0x20>
+      }
+    } else if(state == '%'){
+     b02:	83 fe 25             	cmp    $0x25,%esi
+     b05:	75 e7                	jne    aee <format+0x2e>
+      if(c == 'd'){
+     b07:	83 f8 25             	cmp    $0x25,%eax
+     b0a:	74 46                	je     b52 <format+0x92>
+     b0c:	83 e8 63             	sub    $0x63,%eax
+     b0f:	83 f8 15             	cmp    $0x15,%eax
+     b12:	77 2c                	ja     b40 <format+0x80>
+     b14:	ff 24 85 54 16 00 00 	jmp    *0x1654(,%eax,4)
+     b1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b1f:	90                   	nop
+  for(i = 0; fmt[i]; i++){
+     b20:	0f b6 03             	movzbl (%ebx),%eax
+     b23:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+     b26:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+     b2b:	84 c0                	test   %al,%al
+     b2d:	75 c9                	jne    af8 <format+0x38>
+        putc(b, c);
+      }
+      state = 0;
+    }
+  }
+}
+     b2f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     b32:	5b                   	pop    %ebx
+     b33:	5e                   	pop    %esi
+     b34:	5f                   	pop    %edi
+     b35:	5d                   	pop    %ebp
+     b36:	c3                   	ret
+     b37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b3e:	66 90                	xchg   %ax,%ax
+        putc(b, '%');
+     b40:	ba 25 00 00 00       	mov    $0x25,%edx
+     b45:	89 f8                	mov    %edi,%eax
+     b47:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     b4a:	e8 01 ff ff ff       	call   a50 <putc>
+        putc(b, c);
+     b4f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     b52:	89 ca                	mov    %ecx,%edx
+     b54:	89 f8                	mov    %edi,%eax
+      state = 0;
+     b56:	31 f6                	xor    %esi,%esi
+        putc(b, c);
+     b58:	e8 f3 fe ff ff       	call   a50 <putc>
+     b5d:	eb 8f                	jmp    aee <format+0x2e>
+     b5f:	90                   	nop
+        printint(b, *ap, 16, 0);
+     b60:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     b63:	83 ec 0c             	sub    $0xc,%esp
+     b66:	b9 10 00 00 00       	mov    $0x10,%ecx
+     b6b:	8b 16                	mov    (%esi),%edx
+     b6d:	6a 00                	push   $0x0
+        ap++;
+     b6f:	83 c6 04             	add    $0x4,%esi
+        printint(b, *ap, 16, 0);
+     b72:	89 f8                	mov    %edi,%eax
+     b74:	e8 d7 fd ff ff       	call   950 <printint>
+        ap++;
+     b79:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+     b7c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     b7f:	31 f6                	xor    %esi,%esi
+     b81:	e9 68 ff ff ff       	jmp    aee <format+0x2e>
+     b86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b8d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     b90:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     b93:	8b 30                	mov    (%eax),%esi
+        ap++;
+     b95:	83 c0 04             	add    $0x4,%eax
+     b98:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+     b9b:	85 f6                	test   %esi,%esi
+     b9d:	75 1b                	jne    bba <format+0xfa>
+     b9f:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+     ba4:	be 4c 16 00 00       	mov    $0x164c,%esi
+     ba9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+          putc(b, *s);
+     bb0:	89 f8                	mov    %edi,%eax
+          s++;
+     bb2:	83 c6 01             	add    $0x1,%esi
+          putc(b, *s);
+     bb5:	e8 96 fe ff ff       	call   a50 <putc>
+        while(*s != 0){
+     bba:	0f be 16             	movsbl (%esi),%edx
+     bbd:	84 d2                	test   %dl,%dl
+     bbf:	75 ef                	jne    bb0 <format+0xf0>
+      state = 0;
+     bc1:	31 f6                	xor    %esi,%esi
+     bc3:	e9 26 ff ff ff       	jmp    aee <format+0x2e>
+     bc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bcf:	90                   	nop
+        printint(b, *ap, 10, 1);
+     bd0:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     bd3:	83 ec 0c             	sub    $0xc,%esp
+     bd6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     bdb:	8b 16                	mov    (%esi),%edx
+     bdd:	6a 01                	push   $0x1
+     bdf:	eb 8e                	jmp    b6f <format+0xaf>
+     be1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(b, *ap);
+     be8:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     beb:	89 f8                	mov    %edi,%eax
+     bed:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+     bf0:	83 c6 04             	add    $0x4,%esi
+        putc(b, *ap);
+     bf3:	e8 58 fe ff ff       	call   a50 <putc>
+        ap++;
+     bf8:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      state = 0;
+     bfb:	31 f6                	xor    %esi,%esi
+     bfd:	e9 ec fe ff ff       	jmp    aee <format+0x2e>
+     c02:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000c10 <fflush>:
+{
+     c10:	55                   	push   %ebp
+     c11:	89 e5                	mov    %esp,%ebp
+     c13:	83 ec 08             	sub    $0x8,%esp
+  if(fd == stdout.fd)
+     c16:	8b 45 08             	mov    0x8(%ebp),%eax
+     c19:	39 05 00 20 00 00    	cmp    %eax,0x2000
+     c1f:	74 07                	je     c28 <fflush+0x18>
+}
+     c21:	c9                   	leave
+     c22:	c3                   	ret
+     c23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c27:	90                   	nop
+  umtxlock(&stdoutlock);
+     c28:	83 ec 0c             	sub    $0xc,%esp
+     c2b:	68 14 22 00 00       	push   $0x2214
+     c30:	e8 db fa ff ff       	call   710 <umtxlock>
+  if(b->n > 0)
+     c35:	a1 08 20 00 00       	mov    0x2008,%eax
+     c3a:	83 c4 10             	add    $0x10,%esp
+     c3d:	85 c0                	test   %eax,%eax
+     c3f:	7f 1f                	jg     c60 <fflush+0x50>
+  b->n = 0;
+     c41:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     c48:	00 00 00 
+  umtxunlock(&stdoutlock);
+     c4b:	c7 45 08 14 22 00 00 	movl   $0x2214,0x8(%ebp)
+}
+     c52:	c9                   	leave
+  umtxunlock(&stdoutlock);
+     c53:	e9 08 fb ff ff       	jmp    760 <umtxunlock>
+     c58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c5f:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     c60:	83 ec 04             	sub    $0x4,%esp
+     c63:	50                   	push   %eax
+     c64:	68 0c 20 00 00       	push   $0x200c
+     c69:	ff 35 00 20 00 00    	push   0x2000
+     c6f:	e8 3c fb ff ff       	call   7b0 <_write>
+     c74:	83 c4 10             	add    $0x10,%esp
+     c77:	eb c8                	jmp    c41 <fflush+0x31>
+     c79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000c80 <setvbuf>:
+{
+     c80:	55                   	push   %ebp
+     c81:	89 e5                	mov    %esp,%ebp
+     c83:	53                   	push   %ebx
+     c84:	83 ec 04             	sub    $0x4,%esp
+     c87:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd != stdout.fd)
+     c8a:	8b 45 08             	mov    0x8(%ebp),%eax
+     c8d:	39 05 00 20 00 00    	cmp    %eax,0x2000
+     c93:	74 0b                	je     ca0 <setvbuf+0x20>
+}
+     c95:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     c98:	c9                   	leave
+     c99:	c3                   	ret
+     c9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  umtxlock(&stdoutlock);
+     ca0:	83 ec 0c             	sub    $0xc,%esp
+     ca3:	68 14 22 00 00       	push   $0x2214
+     ca8:	e8 63 fa ff ff       	call   710 <umtxlock>
+  if(b->n > 0)
+     cad:	a1 08 20 00 00       	mov    0x2008,%eax
+     cb2:	83 c4 10             	add    $0x10,%esp
+     cb5:	85 c0                	test   %eax,%eax
+     cb7:	7f 2f                	jg     ce8 <setvbuf+0x68>
+  b->n = 0;
+     cb9:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     cc0:	00 00 00 
+  stdout.mode = mode;
+     cc3:	89 1d 04 20 00 00    	mov    %ebx,0x2004
+  flushhook = flushall;
+     cc9:	c7 05 10 22 00 00 00 	movl   $0x900,0x2210
+     cd0:	09 00 00 
+}
+     cd3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&stdoutlock);
+     cd6:	c7 45 08 14 22 00 00 	movl   $0x2214,0x8(%ebp)
+}
+     cdd:	c9                   	leave
+  umtxunlock(&stdoutlock);
+     cde:	e9 7d fa ff ff       	jmp    760 <umtxunlock>
+     ce3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     ce7:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     ce8:	83 ec 04             	sub    $0x4,%esp
+     ceb:	50                   	push   %eax
+     cec:	68 0c 20 00 00       	push   $0x200c
+     cf1:	ff 35 00 20 00 00    	push   0x2000
+     cf7:	e8 b4 fa ff ff       	call   7b0 <_write>
+     cfc:	83 c4 10             	add    $0x10,%esp
+     cff:	eb b8                	jmp    cb9 <setvbuf+0x39>
+     d01:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d0f:	90                   	nop
+
+00000d10 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s, %c.
+void
+printf(int fd, const char *fmt, ...)
+{
+     d10:	55                   	push   %ebp
+     d11:	89 e5                	mov    %esp,%ebp
+     d13:	53                   	push   %ebx
+     d14:	81 ec 14 02 00 00    	sub    $0x214,%esp
+     d1a:	8b 45 08             	mov    0x8(%ebp),%eax
+    local.mode = _IONBF;
+    local.n = 0;
+    local.str = 0;
+    b = &local;
+  }
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     d1d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd == stdout.fd){
+     d20:	39 05 00 20 00 00    	cmp    %eax,0x2000
+     d26:	74 48                	je     d70 <printf+0x60>
+    local.fd = fd;
+     d28:	89 85 e8 fd ff ff    	mov    %eax,-0x218(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     d2e:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     d31:	89 da                	mov    %ebx,%edx
+     d33:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+    local.mode = _IONBF;
+     d39:	c7 85 ec fd ff ff 03 	movl   $0x3,-0x214(%ebp)
+     d40:	00 00 00 
+    local.n = 0;
+     d43:	c7 85 f0 fd ff ff 00 	movl   $0x0,-0x210(%ebp)
+     d4a:	00 00 00 
+    local.str = 0;
+     d4d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     d54:	e8 67 fd ff ff       	call   ac0 <format>
+  if(b->mode == _IONBF)
+     d59:	83 bd ec fd ff ff 03 	cmpl   $0x3,-0x214(%ebp)
+     d60:	0f 84 a2 00 00 00    	je     e08 <printf+0xf8>
+    flush(b);
+  if(b == &stdout)
+    umtxunlock(&stdoutlock);
+}
+     d66:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     d69:	c9                   	leave
+     d6a:	c3                   	ret
+     d6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d6f:	90                   	nop
+    umtxlock(&stdoutlock);
+     d70:	83 ec 0c             	sub    $0xc,%esp
+     d73:	68 14 22 00 00       	push   $0x2214
+     d78:	e8 93 f9 ff ff       	call   710 <umtxlock>
+  if(stdout.mode == 0){
+     d7d:	a1 04 20 00 00       	mov    0x2004,%eax
+     d82:	83 c4 10             	add    $0x10,%esp
+     d85:	85 c0                	test   %eax,%eax
+     d87:	74 37                	je     dc0 <printf+0xb0>
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     d89:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     d8c:	89 da                	mov    %ebx,%edx
+     d8e:	b8 00 20 00 00       	mov    $0x2000,%eax
+     d93:	e8 28 fd ff ff       	call   ac0 <format>
+  if(b->mode == _IONBF)
+     d98:	83 3d 04 20 00 00 03 	cmpl   $0x3,0x2004
+     d9f:	0f 84 ab 00 00 00    	je     e50 <printf+0x140>
+    umtxunlock(&stdoutlock);
+     da5:	83 ec 0c             	sub    $0xc,%esp
+     da8:	68 14 22 00 00       	push   $0x2214
+     dad:	e8 ae f9 ff ff       	call   760 <umtxunlock>
+}
+     db2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    umtxunlock(&stdoutlock);
+     db5:	83 c4 10             	add    $0x10,%esp
+}
+     db8:	c9                   	leave
+     db9:	c3                   	ret
+     dba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+     dc0:	83 ec 08             	sub    $0x8,%esp
+     dc3:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+     dc9:	50                   	push   %eax
+     dca:	ff 35 00 20 00 00    	push   0x2000
+     dd0:	e8 13 fa ff ff       	call   7e8 <fstat>
+     dd5:	83 c4 10             	add    $0x10,%esp
+     dd8:	89 c2                	mov    %eax,%edx
+      stdout.mode = _IOFBF;
+     dda:	b8 01 00 00 00       	mov    $0x1,%eax
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+     ddf:	85 d2                	test   %edx,%edx
+     de1:	75 10                	jne    df3 <printf+0xe3>
+      stdout.mode = _IOLBF;
+     de3:	31 c0                	xor    %eax,%eax
+     de5:	66 83 bd e8 fd ff ff 	cmpw   $0x3,-0x218(%ebp)
+     dec:	03 
+     ded:	0f 94 c0             	sete   %al
+     df0:	83 c0 01             	add    $0x1,%eax
+     df3:	a3 04 20 00 00       	mov    %eax,0x2004
+    flushhook = flushall;
+     df8:	c7 05 10 22 00 00 00 	movl   $0x900,0x2210
+     dff:	09 00 00 
+     e02:	eb 85                	jmp    d89 <printf+0x79>
+     e04:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(b->n > 0)
+     e08:	8b 85 f0 fd ff ff    	mov    -0x210(%ebp),%eax
+     e0e:	85 c0                	test   %eax,%eax
+     e10:	0f 8e 50 ff ff ff    	jle    d66 <printf+0x56>
+    b = &local;
+     e16:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+    _write(b->fd, b->buf, b->n);
+     e1c:	83 ec 04             	sub    $0x4,%esp
+     e1f:	50                   	push   %eax
+     e20:	8d 43 0c             	lea    0xc(%ebx),%eax
+     e23:	50                   	push   %eax
+     e24:	ff 33                	push   (%ebx)
+     e26:	e8 85 f9 ff ff       	call   7b0 <_write>
+  b->n = 0;
+     e2b:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  if(b == &stdout)
+     e32:	83 c4 10             	add    $0x10,%esp
+     e35:	81 fb 00 20 00 00    	cmp    $0x2000,%ebx
+     e3b:	0f 85 25 ff ff ff    	jne    d66 <printf+0x56>
+     e41:	e9 5f ff ff ff       	jmp    da5 <printf+0x95>
+     e46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e4d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(b->n > 0)
+     e50:	a1 08 20 00 00       	mov    0x2008,%eax
+    b = getstdout();
+     e55:	bb 00 20 00 00       	mov    $0x2000,%ebx
+  if(b->n > 0)
+     e5a:	85 c0                	test   %eax,%eax
+     e5c:	7f be                	jg     e1c <printf+0x10c>
+  b->n = 0;
+     e5e:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     e65:	00 00 00 
+  if(b == &stdout)
+     e68:	e9 38 ff ff ff       	jmp    da5 <printf+0x95>
+     e6d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000e70 <sprintf>:
+
+// Print to the given buffer. Only understands %d, %x, %p, %s, %c.
+int
+sprintf(char *str, const char *fmt, ...)
+{
+     e70:	55                   	push   %ebp
+     e71:	89 e5                	mov    %esp,%ebp
+     e73:	53                   	push   %ebx
+  struct outbuf b;
+
+  b.str = str;
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+     e74:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+     e7a:	8d 4d 10             	lea    0x10(%ebp),%ecx
+{
+     e7d:	81 ec 14 02 00 00    	sub    $0x214,%esp
+     e83:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+     e86:	8b 55 0c             	mov    0xc(%ebp),%edx
+  b.str = str;
+     e89:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+     e8c:	e8 2f fc ff ff       	call   ac0 <format>
+  *b.str = '\0';
+     e91:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e94:	c6 00 00             	movb   $0x0,(%eax)
+  return b.str - str;
+     e97:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e9a:	29 d8                	sub    %ebx,%eax
+}
+     e9c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     e9f:	c9                   	leave
+     ea0:	c3                   	ret
+     ea1:	66 90                	xchg   %ax,%ax
+     ea3:	66 90                	xchg   %ax,%ax
+     ea5:	66 90                	xchg   %ax,%ax
+     ea7:	66 90                	xchg   %ax,%ax
+     ea9:	66 90                	xchg   %ax,%ax
+     eab:	66 90                	xchg   %ax,%ax
+     ead:	66 90                	xchg   %ax,%ax
+     eaf:	90                   	nop
+
+00000eb0 <freeblock>:
+static Header *freep;
+static struct umutex lock;  // threads made by clone() share the heap
+
+static void
+freeblock(void *ap)
+{
+     eb0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+     eb1:	8d 48 f8             	lea    -0x8(%eax),%ecx
+{
+     eb4:	89 e5                	mov    %esp,%ebp
+     eb6:	57                   	push   %edi
+     eb7:	56                   	push   %esi
+     eb8:	53                   	push   %ebx
+     eb9:	89 c3                	mov    %eax,%ebx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     ebb:	a1 1c 22 00 00       	mov    0x221c,%eax
+     ec0:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     ec2:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     ec4:	39 ca                	cmp    %ecx,%edx
+     ec6:	73 30                	jae    ef8 <freeblock+0x48>
+     ec8:	39 c1                	cmp    %eax,%ecx
+     eca:	72 04                	jb     ed0 <freeblock+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     ecc:	39 c2                	cmp    %eax,%edx
+     ece:	72 f0                	jb     ec0 <freeblock+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     ed0:	8b 73 fc             	mov    -0x4(%ebx),%esi
+     ed3:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+     ed6:	39 f8                	cmp    %edi,%eax
+     ed8:	74 26                	je     f00 <freeblock+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+     eda:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+     edd:	8b 42 04             	mov    0x4(%edx),%eax
+     ee0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     ee3:	39 f1                	cmp    %esi,%ecx
+     ee5:	74 30                	je     f17 <freeblock+0x67>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+     ee7:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+     ee9:	5b                   	pop    %ebx
+  freep = p;
+     eea:	89 15 1c 22 00 00    	mov    %edx,0x221c
+}
+     ef0:	5e                   	pop    %esi
+     ef1:	5f                   	pop    %edi
+     ef2:	5d                   	pop    %ebp
+     ef3:	c3                   	ret
+     ef4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     ef8:	39 c1                	cmp    %eax,%ecx
+     efa:	72 d0                	jb     ecc <freeblock+0x1c>
+     efc:	eb c2                	jmp    ec0 <freeblock+0x10>
+     efe:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+     f00:	03 70 04             	add    0x4(%eax),%esi
+     f03:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     f06:	8b 02                	mov    (%edx),%eax
+     f08:	8b 00                	mov    (%eax),%eax
+     f0a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+     f0d:	8b 42 04             	mov    0x4(%edx),%eax
+     f10:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     f13:	39 f1                	cmp    %esi,%ecx
+     f15:	75 d0                	jne    ee7 <freeblock+0x37>
+    p->s.size += bp->s.size;
+     f17:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+     f1a:	89 15 1c 22 00 00    	mov    %edx,0x221c
+    p->s.size += bp->s.size;
+     f20:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+     f23:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+     f26:	89 0a                	mov    %ecx,(%edx)
+}
+     f28:	5b                   	pop    %ebx
+     f29:	5e                   	pop    %esi
+     f2a:	5f                   	pop    %edi
+     f2b:	5d                   	pop    %ebp
+     f2c:	c3                   	ret
+     f2d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000f30 <free>:
+
+void
+free(void *ap)
+{
+     f30:	55                   	push   %ebp
+     f31:	89 e5                	mov    %esp,%ebp
+     f33:	53                   	push   %ebx
+     f34:	83 ec 10             	sub    $0x10,%esp
+     f37:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  umtxlock(&lock);
+     f3a:	68 18 22 00 00       	push   $0x2218
+     f3f:	e8 cc f7 ff ff       	call   710 <umtxlock>
+  freeblock(ap);
+     f44:	89 d8                	mov    %ebx,%eax
+     f46:	e8 65 ff ff ff       	call   eb0 <freeblock>
+  umtxunlock(&lock);
+     f4b:	c7 45 08 18 22 00 00 	movl   $0x2218,0x8(%ebp)
+}
+     f52:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&lock);
+     f55:	83 c4 10             	add    $0x10,%esp
+}
+     f58:	c9                   	leave
+  umtxunlock(&lock);
+     f59:	e9 02 f8 ff ff       	jmp    760 <umtxunlock>
+     f5e:	66 90                	xchg   %ax,%ax
+
+00000f60 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+     f60:	55                   	push   %ebp
+     f61:	89 e5                	mov    %esp,%ebp
+     f63:	57                   	push   %edi
+     f64:	56                   	push   %esi
+     f65:	53                   	push   %ebx
+     f66:	83 ec 28             	sub    $0x28,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     f69:	8b 45 08             	mov    0x8(%ebp),%eax
+  umtxlock(&lock);
+     f6c:	68 18 22 00 00       	push   $0x2218
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     f71:	8d 48 07             	lea    0x7(%eax),%ecx
+     f74:	c1 e9 03             	shr    $0x3,%ecx
+     f77:	8d 71 01             	lea    0x1(%ecx),%esi
+  umtxlock(&lock);
+     f7a:	e8 91 f7 ff ff       	call   710 <umtxlock>
+  if((prevp = freep) == 0){
+     f7f:	8b 15 1c 22 00 00    	mov    0x221c,%edx
+     f85:	83 c4 10             	add    $0x10,%esp
+     f88:	85 d2                	test   %edx,%edx
+     f8a:	0f 84 b0 00 00 00    	je     1040 <malloc+0xe0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     f90:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+     f92:	8b 47 04             	mov    0x4(%edi),%eax
+     f95:	39 f0                	cmp    %esi,%eax
+     f97:	73 6f                	jae    1008 <malloc+0xa8>
+  if(nu < 4096)
+     f99:	bb 00 10 00 00       	mov    $0x1000,%ebx
+     f9e:	39 de                	cmp    %ebx,%esi
+     fa0:	0f 43 de             	cmovae %esi,%ebx
+  p = sbrk(nu * sizeof(Header));
+     fa3:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+     faa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     fad:	eb 0a                	jmp    fb9 <malloc+0x59>
+     faf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     fb0:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+     fb2:	8b 47 04             	mov    0x4(%edi),%eax
+     fb5:	39 f0                	cmp    %esi,%eax
+     fb7:	73 4f                	jae    1008 <malloc+0xa8>
+      }
+      freep = prevp;
+      umtxunlock(&lock);
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+     fb9:	89 fa                	mov    %edi,%edx
+     fbb:	39 3d 1c 22 00 00    	cmp    %edi,0x221c
+     fc1:	75 ed                	jne    fb0 <malloc+0x50>
+  p = sbrk(nu * sizeof(Header));
+     fc3:	83 ec 0c             	sub    $0xc,%esp
+     fc6:	ff 75 e4             	push   -0x1c(%ebp)
+     fc9:	e8 4a f8 ff ff       	call   818 <sbrk>
+  if(p == (char*)-1)
+     fce:	83 c4 10             	add    $0x10,%esp
+     fd1:	83 f8 ff             	cmp    $0xffffffff,%eax
+     fd4:	74 15                	je     feb <malloc+0x8b>
+  hp->s.size = nu;
+     fd6:	89 58 04             	mov    %ebx,0x4(%eax)
+  freeblock((void*)(hp + 1));
+     fd9:	83 c0 08             	add    $0x8,%eax
+     fdc:	e8 cf fe ff ff       	call   eb0 <freeblock>
+  return freep;
+     fe1:	8b 15 1c 22 00 00    	mov    0x221c,%edx
+      if((p = morecore(nunits)) == 0){
+     fe7:	85 d2                	test   %edx,%edx
+     fe9:	75 c5                	jne    fb0 <malloc+0x50>
+        umtxunlock(&lock);
+     feb:	83 ec 0c             	sub    $0xc,%esp
+     fee:	68 18 22 00 00       	push   $0x2218
+     ff3:	e8 68 f7 ff ff       	call   760 <umtxunlock>
+        return 0;
+     ff8:	83 c4 10             	add    $0x10,%esp
+      }
+  }
+}
+     ffb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+     ffe:	31 c0                	xor    %eax,%eax
+}
+    1000:	5b                   	pop    %ebx
+    1001:	5e                   	pop    %esi
+    1002:	5f                   	pop    %edi
+    1003:	5d                   	pop    %ebp
+    1004:	c3                   	ret
+    1005:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1008:	39 c6                	cmp    %eax,%esi
+    100a:	74 64                	je     1070 <malloc+0x110>
+        p->s.size -= nunits;
+    100c:	29 f0                	sub    %esi,%eax
+    100e:	89 47 04             	mov    %eax,0x4(%edi)
+        p += p->s.size;
+    1011:	8d 3c c7             	lea    (%edi,%eax,8),%edi
+        p->s.size = nunits;
+    1014:	89 77 04             	mov    %esi,0x4(%edi)
+      umtxunlock(&lock);
+    1017:	83 ec 0c             	sub    $0xc,%esp
+      freep = prevp;
+    101a:	89 15 1c 22 00 00    	mov    %edx,0x221c
+      umtxunlock(&lock);
+    1020:	68 18 22 00 00       	push   $0x2218
+    1025:	e8 36 f7 ff ff       	call   760 <umtxunlock>
+      return (void*)(p + 1);
+    102a:	83 c4 10             	add    $0x10,%esp
+}
+    102d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    1030:	8d 47 08             	lea    0x8(%edi),%eax
+}
+    1033:	5b                   	pop    %ebx
+    1034:	5e                   	pop    %esi
+    1035:	5f                   	pop    %edi
+    1036:	5d                   	pop    %ebp
+    1037:	c3                   	ret
+    1038:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    103f:	90                   	nop
+    base.s.ptr = freep = prevp = &base;
+    1040:	c7 05 1c 22 00 00 20 	movl   $0x2220,0x221c
+    1047:	22 00 00 
+    base.s.size = 0;
+    104a:	bf 20 22 00 00       	mov    $0x2220,%edi
+    base.s.ptr = freep = prevp = &base;
+    104f:	c7 05 20 22 00 00 20 	movl   $0x2220,0x2220
+    1056:	22 00 00 
+    base.s.size = 0;
+    1059:	c7 05 24 22 00 00 00 	movl   $0x0,0x2224
+    1060:	00 00 00 
+    if(p->s.size >= nunits){
+    1063:	e9 31 ff ff ff       	jmp    f99 <malloc+0x39>
+    1068:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    106f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1070:	8b 07                	mov    (%edi),%eax
+    1072:	89 02                	mov    %eax,(%edx)
+    1074:	eb a1                	jmp    1017 <malloc+0xb7>
+    1076:	66 90                	xchg   %ax,%ax
+    1078:	66 90                	xchg   %ax,%ax
+    107a:	66 90                	xchg   %ax,%ax
+    107c:	66 90                	xchg   %ax,%ax
+    107e:	66 90                	xchg   %ax,%ax
+
+00001080 <threadstart>:
+
+#define TSTACKSZ 4096
+
+static void
+threadstart(void *fn, void *arg)
+{
+    1080:	55                   	push   %ebp
+    1081:	89 e5                	mov    %esp,%ebp
+    1083:	83 ec 14             	sub    $0x14,%esp
+  ((void (*)(void*))fn)(arg);
+    1086:	ff 75 0c             	push   0xc(%ebp)
+    1089:	ff 55 08             	call   *0x8(%ebp)
+  exit();
+    108c:	e8 ef f4 ff ff       	call   580 <exit>
+    1091:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1098:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    109f:	90                   	nop
+
+000010a0 <thread_create>:
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    10a0:	55                   	push   %ebp
+    10a1:	89 e5                	mov    %esp,%ebp
+    10a3:	53                   	push   %ebx
+    10a4:	83 ec 20             	sub    $0x20,%esp
+  char *mem, *stack;
+  int pid;
+
+  if((mem = malloc(2*TSTACKSZ)) == 0)
+    10a7:	68 00 20 00 00       	push   $0x2000
+    10ac:	e8 af fe ff ff       	call   f60 <malloc>
+    10b1:	83 c4 10             	add    $0x10,%esp
+    10b4:	85 c0                	test   %eax,%eax
+    10b6:	74 47                	je     10ff <thread_create+0x5f>
+    10b8:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)(((uint)mem + TSTACKSZ - 1) & ~(TSTACKSZ - 1));
+    10ba:	8d 80 ff 0f 00 00    	lea    0xfff(%eax),%eax
+    10c0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  *(char**)stack = mem;
+    10c5:	89 18                	mov    %ebx,(%eax)
+  if((pid = clone(threadstart, (void*)fn, arg, stack)) < 0)
+    10c7:	50                   	push   %eax
+    10c8:	ff 75 0c             	push   0xc(%ebp)
+    10cb:	ff 75 08             	push   0x8(%ebp)
+    10ce:	68 80 10 00 00       	push   $0x1080
+    10d3:	e8 08 f8 ff ff       	call   8e0 <clone>
+    10d8:	83 c4 10             	add    $0x10,%esp
+    10db:	85 c0                	test   %eax,%eax
+    10dd:	78 09                	js     10e8 <thread_create+0x48>
+    free(mem);
+  return pid;
+}
+    10df:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    10e2:	c9                   	leave
+    10e3:	c3                   	ret
+    10e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    free(mem);
+    10e8:	83 ec 0c             	sub    $0xc,%esp
+    10eb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    10ee:	53                   	push   %ebx
+    10ef:	e8 3c fe ff ff       	call   f30 <free>
+    10f4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    10f7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+    10fa:	83 c4 10             	add    $0x10,%esp
+}
+    10fd:	c9                   	leave
+    10fe:	c3                   	ret
+    return -1;
+    10ff:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1104:	eb d9                	jmp    10df <thread_create+0x3f>
+    1106:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    110d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001110 <thread_join>:
+
+int
+thread_join(void)
+{
+    1110:	55                   	push   %ebp
+    1111:	89 e5                	mov    %esp,%ebp
+    1113:	83 ec 34             	sub    $0x34,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    1116:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    1119:	50                   	push   %eax
+    111a:	e8 c9 f7 ff ff       	call   8e8 <join>
+    111f:	83 c4 10             	add    $0x10,%esp
+    1122:	85 c0                	test   %eax,%eax
+    1124:	79 0a                	jns    1130 <thread_join+0x20>
+    free(*(char**)stack);
+  return pid;
+}
+    1126:	c9                   	leave
+    1127:	c3                   	ret
+    1128:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    112f:	90                   	nop
+    free(*(char**)stack);
+    1130:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1133:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1136:	83 ec 0c             	sub    $0xc,%esp
+    1139:	ff 32                	push   (%edx)
+    113b:	e8 f0 fd ff ff       	call   f30 <free>
+    1140:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1143:	83 c4 10             	add    $0x10,%esp
+}
+    1146:	c9                   	leave
+    1147:	c3                   	ret
@@ -0,0 +1,70 @@
+// Count the system calls it takes to print lines: one write()
+// per character, as printf() used to do, against printf() with
+// each kind of buffering. Output goes to a scratch file on fd 1;
+// results go to the console on fd 2.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+
+#define NLINE 200
+
+void
+perchar(void)
+{
+  char line[64];
+  int i, j, n;
+
+  for(i = 0; i < NLINE; i++){
+    n = sprintf(line, "line %d: the quick brown fox jumps\n", i);
+    for(j = 0; j < n; j++)
+      write(1, &line[j], 1);
+  }
+}
+
+void
+buffered(int mode)
+{
+  int i;
+
+  setvbuf(1, mode);
+  for(i = 0; i < NLINE; i++)
+    printf(1, "line %d: the quick brown fox jumps\n", i);
+  fflush(1);
+}
+
+void
+report(char *name, int mode)
+{
+  int s0, t0, n, t;
+
+  s0 = syscount();
+  t0 = uptime();
+  if(mode == 0)
+    perchar();
+  else
+    buffered(mode);
+  t = uptime() - t0;
+  // Leave out the two uptime() calls and this syscount().
+  n = syscount() - s0 - 3;
+  printf(2, "stdiobench: %s: %d syscalls for %d lines (%d.%d%d per line), %d ticks\n",
+         name, n, NLINE, n / NLINE, n * 10 / NLINE % 10, n * 100 / NLINE % 10, t);
+}
+
+int
+main(int argc, char *argv[])
+{
+  close(1);
+  if(open("stdiobench.out", O_CREATE|O_RDWR) != 1){
+    printf(2, "stdiobench: cannot open stdiobench.out\n");
+    exit();
+  }
+  report("write per char", 0);
+  report("no buffering", _IONBF);
+  report("line buffering", _IOLBF);
+  report("full buffering", _IOFBF);
+  close(1);
+  unlink("stdiobench.out");
+  exit();
+}
@@ -0,0 +1,2263 @@
+
+_stressfs:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "fs.h"
+#include "fcntl.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+  int fd, i;
+  char path[] = "stressfs0";
+   7:	b8 30 00 00 00       	mov    $0x30,%eax
+{
+   c:	ff 71 fc             	push   -0x4(%ecx)
+   f:	55                   	push   %ebp
+  10:	89 e5                	mov    %esp,%ebp
+  12:	57                   	push   %edi
+  13:	56                   	push   %esi
+  char data[512];
+
+  printf(1, "stressfs starting\n");
+  memset(data, 'a', sizeof(data));
+  14:	8d b5 e8 fd ff ff    	lea    -0x218(%ebp),%esi
+{
+  1a:	53                   	push   %ebx
+
+  for(i = 0; i < 4; i++)
+  1b:	31 db                	xor    %ebx,%ebx
+{
+  1d:	51                   	push   %ecx
+  1e:	81 ec 20 02 00 00    	sub    $0x220,%esp
+  char path[] = "stressfs0";
+  24:	66 89 85 e6 fd ff ff 	mov    %ax,-0x21a(%ebp)
+  2b:	c7 85 de fd ff ff 73 	movl   $0x65727473,-0x222(%ebp)
+  32:	74 72 65 
+  35:	c7 85 e2 fd ff ff 73 	movl   $0x73667373,-0x21e(%ebp)
+  3c:	73 66 73 
+  printf(1, "stressfs starting\n");
+  3f:	68 b8 0f 00 00       	push   $0xfb8
+  44:	6a 01                	push   $0x1
+  46:	e8 35 0b 00 00       	call   b80 <printf>
+  memset(data, 'a', sizeof(data));
+  4b:	83 c4 0c             	add    $0xc,%esp
+  4e:	68 00 02 00 00       	push   $0x200
+  53:	6a 61                	push   $0x61
+  55:	56                   	push   %esi
+  56:	e8 85 01 00 00       	call   1e0 <memset>
+  5b:	83 c4 10             	add    $0x10,%esp
+    if(fork() > 0)
+  5e:	e8 5d 03 00 00       	call   3c0 <fork>
+  63:	85 c0                	test   %eax,%eax
+  65:	7f 08                	jg     6f <main+0x6f>
+  for(i = 0; i < 4; i++)
+  67:	83 c3 01             	add    $0x1,%ebx
+  6a:	83 fb 04             	cmp    $0x4,%ebx
+  6d:	75 ef                	jne    5e <main+0x5e>
+      break;
+
+  printf(1, "write %d\n", i);
+  6f:	83 ec 04             	sub    $0x4,%esp
+  72:	53                   	push   %ebx
+  73:	68 cb 0f 00 00       	push   $0xfcb
+  78:	6a 01                	push   $0x1
+  7a:	e8 01 0b 00 00       	call   b80 <printf>
+
+  path[8] += i;
+  7f:	00 9d e6 fd ff ff    	add    %bl,-0x21a(%ebp)
+  fd = open(path, O_CREATE | O_RDWR);
+  85:	5f                   	pop    %edi
+  86:	bb 14 00 00 00       	mov    $0x14,%ebx
+  8b:	58                   	pop    %eax
+  8c:	8d 85 de fd ff ff    	lea    -0x222(%ebp),%eax
+  92:	68 02 02 00 00       	push   $0x202
+  97:	50                   	push   %eax
+  98:	e8 a3 05 00 00       	call   640 <open>
+  9d:	83 c4 10             	add    $0x10,%esp
+  a0:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < 20; i++)
+  a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+//    printf(fd, "%d\n", i);
+    write(fd, data, sizeof(data));
+  a8:	83 ec 04             	sub    $0x4,%esp
+  ab:	68 00 02 00 00       	push   $0x200
+  b0:	56                   	push   %esi
+  b1:	57                   	push   %edi
+  b2:	e8 09 04 00 00       	call   4c0 <write>
+  for(i = 0; i < 20; i++)
+  b7:	83 c4 10             	add    $0x10,%esp
+  ba:	83 eb 01             	sub    $0x1,%ebx
+  bd:	75 e9                	jne    a8 <main+0xa8>
+  close(fd);
+  bf:	83 ec 0c             	sub    $0xc,%esp
+  c2:	57                   	push   %edi
+  c3:	e8 78 04 00 00       	call   540 <close>
+
+  printf(1, "read\n");
+  c8:	58                   	pop    %eax
+  c9:	5a                   	pop    %edx
+  ca:	68 d5 0f 00 00       	push   $0xfd5
+  cf:	6a 01                	push   $0x1
+  d1:	e8 aa 0a 00 00       	call   b80 <printf>
+
+  fd = open(path, O_RDONLY);
+  d6:	8d 85 de fd ff ff    	lea    -0x222(%ebp),%eax
+  dc:	59                   	pop    %ecx
+  dd:	5b                   	pop    %ebx
+  de:	6a 00                	push   $0x0
+  e0:	bb 14 00 00 00       	mov    $0x14,%ebx
+  e5:	50                   	push   %eax
+  e6:	e8 55 05 00 00       	call   640 <open>
+  eb:	83 c4 10             	add    $0x10,%esp
+  ee:	89 c7                	mov    %eax,%edi
+  for (i = 0; i < 20; i++)
+    read(fd, data, sizeof(data));
+  f0:	83 ec 04             	sub    $0x4,%esp
+  f3:	68 00 02 00 00       	push   $0x200
+  f8:	56                   	push   %esi
+  f9:	57                   	push   %edi
+  fa:	e8 41 03 00 00       	call   440 <read>
+  for (i = 0; i < 20; i++)
+  ff:	83 c4 10             	add    $0x10,%esp
+ 102:	83 eb 01             	sub    $0x1,%ebx
+ 105:	75 e9                	jne    f0 <main+0xf0>
+  close(fd);
+ 107:	83 ec 0c             	sub    $0xc,%esp
+ 10a:	57                   	push   %edi
+ 10b:	e8 30 04 00 00       	call   540 <close>
+
+  wait();
+ 110:	e8 f3 04 00 00       	call   608 <wait>
+
+  exit();
+ 115:	e8 d6 02 00 00       	call   3f0 <exit>
+ 11a:	66 90                	xchg   %ax,%ax
+ 11c:	66 90                	xchg   %ax,%ax
+ 11e:	66 90                	xchg   %ax,%ax
+
+00000120 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 120:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 121:	31 c0                	xor    %eax,%eax
+{
+ 123:	89 e5                	mov    %esp,%ebp
+ 125:	53                   	push   %ebx
+ 126:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 129:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 12c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 130:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 134:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 137:	83 c0 01             	add    $0x1,%eax
+ 13a:	84 d2                	test   %dl,%dl
+ 13c:	75 f2                	jne    130 <strcpy+0x10>
+    ;
+  return os;
+}
+ 13e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 141:	89 c8                	mov    %ecx,%eax
+ 143:	c9                   	leave
+ 144:	c3                   	ret
+ 145:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000150 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	53                   	push   %ebx
+ 154:	8b 55 08             	mov    0x8(%ebp),%edx
+ 157:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 15a:	0f b6 02             	movzbl (%edx),%eax
+ 15d:	84 c0                	test   %al,%al
+ 15f:	75 17                	jne    178 <strcmp+0x28>
+ 161:	eb 3a                	jmp    19d <strcmp+0x4d>
+ 163:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 167:	90                   	nop
+ 168:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 16c:	83 c2 01             	add    $0x1,%edx
+ 16f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 172:	84 c0                	test   %al,%al
+ 174:	74 1a                	je     190 <strcmp+0x40>
+    p++, q++;
+ 176:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 178:	0f b6 19             	movzbl (%ecx),%ebx
+ 17b:	38 c3                	cmp    %al,%bl
+ 17d:	74 e9                	je     168 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 17f:	29 d8                	sub    %ebx,%eax
+}
+ 181:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 184:	c9                   	leave
+ 185:	c3                   	ret
+ 186:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 18d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 190:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 194:	31 c0                	xor    %eax,%eax
+ 196:	29 d8                	sub    %ebx,%eax
+}
+ 198:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 19b:	c9                   	leave
+ 19c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 19d:	0f b6 19             	movzbl (%ecx),%ebx
+ 1a0:	31 c0                	xor    %eax,%eax
+ 1a2:	eb db                	jmp    17f <strcmp+0x2f>
+ 1a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1af:	90                   	nop
+
+000001b0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1b6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1b9:	74 15                	je     1d0 <strlen+0x20>
+ 1bb:	31 c0                	xor    %eax,%eax
+ 1bd:	8d 76 00             	lea    0x0(%esi),%esi
+ 1c0:	83 c0 01             	add    $0x1,%eax
+ 1c3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1c7:	89 c1                	mov    %eax,%ecx
+ 1c9:	75 f5                	jne    1c0 <strlen+0x10>
+    ;
+  return n;
+}
+ 1cb:	89 c8                	mov    %ecx,%eax
+ 1cd:	5d                   	pop    %ebp
+ 1ce:	c3                   	ret
+ 1cf:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 1d0:	31 c9                	xor    %ecx,%ecx
+}
+ 1d2:	5d                   	pop    %ebp
+ 1d3:	89 c8                	mov    %ecx,%eax
+ 1d5:	c3                   	ret
+ 1d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001e0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	57                   	push   %edi
+ 1e4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1e7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1ed:	89 d7                	mov    %edx,%edi
+ 1ef:	fc                   	cld
+ 1f0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1f2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1f5:	89 d0                	mov    %edx,%eax
+ 1f7:	c9                   	leave
+ 1f8:	c3                   	ret
+ 1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000200 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	56                   	push   %esi
+ 204:	53                   	push   %ebx
+ 205:	8b 75 10             	mov    0x10(%ebp),%esi
+ 208:	8b 55 08             	mov    0x8(%ebp),%edx
+ 20b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+ 20e:	85 f6                	test   %esi,%esi
+ 210:	74 2e                	je     240 <memcmp+0x40>
+ 212:	01 c6                	add    %eax,%esi
+ 214:	eb 14                	jmp    22a <memcmp+0x2a>
+ 216:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 21d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+ 220:	83 c0 01             	add    $0x1,%eax
+ 223:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+ 226:	39 f0                	cmp    %esi,%eax
+ 228:	74 16                	je     240 <memcmp+0x40>
+    if(*s1 != *s2)
+ 22a:	0f b6 0a             	movzbl (%edx),%ecx
+ 22d:	0f b6 18             	movzbl (%eax),%ebx
+ 230:	38 d9                	cmp    %bl,%cl
+ 232:	74 ec                	je     220 <memcmp+0x20>
+      return *s1 - *s2;
+ 234:	0f b6 c1             	movzbl %cl,%eax
+ 237:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+ 239:	5b                   	pop    %ebx
+ 23a:	5e                   	pop    %esi
+ 23b:	5d                   	pop    %ebp
+ 23c:	c3                   	ret
+ 23d:	8d 76 00             	lea    0x0(%esi),%esi
+ 240:	5b                   	pop    %ebx
+  return 0;
+ 241:	31 c0                	xor    %eax,%eax
+}
+ 243:	5e                   	pop    %esi
+ 244:	5d                   	pop    %ebp
+ 245:	c3                   	ret
+ 246:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000250 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	8b 45 08             	mov    0x8(%ebp),%eax
+ 256:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 25a:	0f b6 10             	movzbl (%eax),%edx
+ 25d:	84 d2                	test   %dl,%dl
+ 25f:	75 12                	jne    273 <strchr+0x23>
+ 261:	eb 1d                	jmp    280 <strchr+0x30>
+ 263:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 267:	90                   	nop
+ 268:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 26c:	83 c0 01             	add    $0x1,%eax
+ 26f:	84 d2                	test   %dl,%dl
+ 271:	74 0d                	je     280 <strchr+0x30>
+    if(*s == c)
+ 273:	38 d1                	cmp    %dl,%cl
+ 275:	75 f1                	jne    268 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 277:	5d                   	pop    %ebp
+ 278:	c3                   	ret
+ 279:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 280:	31 c0                	xor    %eax,%eax
+}
+ 282:	5d                   	pop    %ebp
+ 283:	c3                   	ret
+ 284:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 28f:	90                   	nop
+
+00000290 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	57                   	push   %edi
+ 294:	56                   	push   %esi
+int
+read(int fd, void *buf, int n)
+{
+  if(flushhook)
+    flushhook();
+  return _read(fd, buf, n);
+ 295:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 298:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 299:	31 db                	xor    %ebx,%ebx
+{
+ 29b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 29e:	eb 32                	jmp    2d2 <gets+0x42>
+  if(flushhook)
+ 2a0:	a1 10 22 00 00       	mov    0x2210,%eax
+ 2a5:	85 c0                	test   %eax,%eax
+ 2a7:	74 02                	je     2ab <gets+0x1b>
+    flushhook();
+ 2a9:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+ 2ab:	83 ec 04             	sub    $0x4,%esp
+ 2ae:	6a 01                	push   $0x1
+ 2b0:	56                   	push   %esi
+ 2b1:	6a 00                	push   $0x0
+ 2b3:	e8 60 03 00 00       	call   618 <_read>
+    if(cc < 1)
+ 2b8:	83 c4 10             	add    $0x10,%esp
+ 2bb:	85 c0                	test   %eax,%eax
+ 2bd:	7e 1d                	jle    2dc <gets+0x4c>
+    buf[i++] = c;
+ 2bf:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 2c3:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2c6:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 2ca:	3c 0a                	cmp    $0xa,%al
+ 2cc:	74 10                	je     2de <gets+0x4e>
+ 2ce:	3c 0d                	cmp    $0xd,%al
+ 2d0:	74 0c                	je     2de <gets+0x4e>
+  for(i=0; i+1 < max; ){
+ 2d2:	89 df                	mov    %ebx,%edi
+ 2d4:	83 c3 01             	add    $0x1,%ebx
+ 2d7:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 2da:	7c c4                	jl     2a0 <gets+0x10>
+ 2dc:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+ 2de:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2e1:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+ 2e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2e8:	5b                   	pop    %ebx
+ 2e9:	5e                   	pop    %esi
+ 2ea:	5f                   	pop    %edi
+ 2eb:	5d                   	pop    %ebp
+ 2ec:	c3                   	ret
+ 2ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002f0 <stat>:
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	56                   	push   %esi
+ 2f4:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+ 2f5:	83 ec 08             	sub    $0x8,%esp
+ 2f8:	6a 00                	push   $0x0
+ 2fa:	ff 75 08             	push   0x8(%ebp)
+ 2fd:	e8 3e 03 00 00       	call   640 <open>
+  if(fd < 0)
+ 302:	83 c4 10             	add    $0x10,%esp
+ 305:	85 c0                	test   %eax,%eax
+ 307:	78 37                	js     340 <stat+0x50>
+  r = fstat(fd, st);
+ 309:	83 ec 08             	sub    $0x8,%esp
+ 30c:	ff 75 0c             	push   0xc(%ebp)
+ 30f:	89 c3                	mov    %eax,%ebx
+ 311:	50                   	push   %eax
+ 312:	e8 41 03 00 00       	call   658 <fstat>
+}
+
+int
+close(int fd)
+{
+  if(flushhook)
+ 317:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+ 31a:	89 c6                	mov    %eax,%esi
+  if(flushhook)
+ 31c:	a1 10 22 00 00       	mov    0x2210,%eax
+ 321:	85 c0                	test   %eax,%eax
+ 323:	74 02                	je     327 <stat+0x37>
+    flushhook();
+ 325:	ff d0                	call   *%eax
+  return _close(fd);
+ 327:	83 ec 0c             	sub    $0xc,%esp
+ 32a:	53                   	push   %ebx
+ 32b:	e8 f8 02 00 00       	call   628 <_close>
+ 330:	83 c4 10             	add    $0x10,%esp
+}
+ 333:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 336:	89 f0                	mov    %esi,%eax
+ 338:	5b                   	pop    %ebx
+ 339:	5e                   	pop    %esi
+ 33a:	5d                   	pop    %ebp
+ 33b:	c3                   	ret
+ 33c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+ 340:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 345:	eb ec                	jmp    333 <stat+0x43>
+ 347:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34e:	66 90                	xchg   %ax,%ax
+
+00000350 <atoi>:
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	53                   	push   %ebx
+ 354:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+ 357:	0f be 02             	movsbl (%edx),%eax
+ 35a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 35d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 360:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 365:	77 1e                	ja     385 <atoi+0x35>
+ 367:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 370:	83 c2 01             	add    $0x1,%edx
+ 373:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 376:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 37a:	0f be 02             	movsbl (%edx),%eax
+ 37d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 380:	80 fb 09             	cmp    $0x9,%bl
+ 383:	76 eb                	jbe    370 <atoi+0x20>
+}
+ 385:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 388:	89 c8                	mov    %ecx,%eax
+ 38a:	c9                   	leave
+ 38b:	c3                   	ret
+ 38c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000390 <memmove>:
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	57                   	push   %edi
+ 394:	56                   	push   %esi
+ 395:	8b 45 10             	mov    0x10(%ebp),%eax
+ 398:	8b 55 08             	mov    0x8(%ebp),%edx
+ 39b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+ 39e:	85 c0                	test   %eax,%eax
+ 3a0:	7e 13                	jle    3b5 <memmove+0x25>
+ 3a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 3a4:	89 d7                	mov    %edx,%edi
+ 3a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 3b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 3b1:	39 f8                	cmp    %edi,%eax
+ 3b3:	75 fb                	jne    3b0 <memmove+0x20>
+}
+ 3b5:	5e                   	pop    %esi
+ 3b6:	89 d0                	mov    %edx,%eax
+ 3b8:	5f                   	pop    %edi
+ 3b9:	5d                   	pop    %ebp
+ 3ba:	c3                   	ret
+ 3bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3bf:	90                   	nop
+
+000003c0 <fork>:
+  if(flushhook)
+ 3c0:	a1 10 22 00 00       	mov    0x2210,%eax
+ 3c5:	85 c0                	test   %eax,%eax
+ 3c7:	74 17                	je     3e0 <fork+0x20>
+{
+ 3c9:	55                   	push   %ebp
+ 3ca:	89 e5                	mov    %esp,%ebp
+ 3cc:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+ 3cf:	ff d0                	call   *%eax
+}
+ 3d1:	c9                   	leave
+  return _fork();
+ 3d2:	e9 21 02 00 00       	jmp    5f8 <_fork>
+ 3d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3de:	66 90                	xchg   %ax,%ax
+ 3e0:	e9 13 02 00 00       	jmp    5f8 <_fork>
+ 3e5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003f0 <exit>:
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+ 3f3:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+ 3f6:	a1 10 22 00 00       	mov    0x2210,%eax
+ 3fb:	85 c0                	test   %eax,%eax
+ 3fd:	74 02                	je     401 <exit+0x11>
+    flushhook();
+ 3ff:	ff d0                	call   *%eax
+  _exit();
+ 401:	e8 fa 01 00 00       	call   600 <_exit>
+ 406:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 40d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000410 <exec>:
+{
+ 410:	55                   	push   %ebp
+  if(flushhook)
+ 411:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+ 416:	89 e5                	mov    %esp,%ebp
+ 418:	56                   	push   %esi
+ 419:	53                   	push   %ebx
+ 41a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 41d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+ 420:	85 c0                	test   %eax,%eax
+ 422:	74 02                	je     426 <exec+0x16>
+    flushhook();
+ 424:	ff d0                	call   *%eax
+  return _exec(path, argv);
+ 426:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 429:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 42c:	5b                   	pop    %ebx
+ 42d:	5e                   	pop    %esi
+ 42e:	5d                   	pop    %ebp
+  return _exec(path, argv);
+ 42f:	e9 04 02 00 00       	jmp    638 <_exec>
+ 434:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 43b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 43f:	90                   	nop
+
+00000440 <read>:
+{
+ 440:	55                   	push   %ebp
+ 441:	89 e5                	mov    %esp,%ebp
+ 443:	57                   	push   %edi
+ 444:	56                   	push   %esi
+ 445:	53                   	push   %ebx
+ 446:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+ 449:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+ 44e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 451:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 454:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+ 457:	85 c0                	test   %eax,%eax
+ 459:	74 02                	je     45d <read+0x1d>
+    flushhook();
+ 45b:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+ 45d:	89 7d 10             	mov    %edi,0x10(%ebp)
+ 460:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 463:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 466:	83 c4 0c             	add    $0xc,%esp
+ 469:	5b                   	pop    %ebx
+ 46a:	5e                   	pop    %esi
+ 46b:	5f                   	pop    %edi
+ 46c:	5d                   	pop    %ebp
+  return _read(fd, buf, n);
+ 46d:	e9 a6 01 00 00       	jmp    618 <_read>
+ 472:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 479:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000480 <readv>:
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	57                   	push   %edi
+ 484:	56                   	push   %esi
+ 485:	53                   	push   %ebx
+ 486:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+ 489:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+ 48e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 491:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 494:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+ 497:	85 c0                	test   %eax,%eax
+ 499:	74 02                	je     49d <readv+0x1d>
+    flushhook();
+ 49b:	ff d0                	call   *%eax
+  return _readv(fd, iov, cnt);
+ 49d:	89 7d 10             	mov    %edi,0x10(%ebp)
+ 4a0:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 4a3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 4a6:	83 c4 0c             	add    $0xc,%esp
+ 4a9:	5b                   	pop    %ebx
+ 4aa:	5e                   	pop    %esi
+ 4ab:	5f                   	pop    %edi
+ 4ac:	5d                   	pop    %ebp
+  return _readv(fd, iov, cnt);
+ 4ad:	e9 76 02 00 00       	jmp    728 <_readv>
+ 4b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004c0 <write>:
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	57                   	push   %edi
+ 4c4:	56                   	push   %esi
+ 4c5:	53                   	push   %ebx
+ 4c6:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+ 4c9:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+ 4ce:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 4d1:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 4d4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+ 4d7:	85 c0                	test   %eax,%eax
+ 4d9:	74 02                	je     4dd <write+0x1d>
+    flushhook();
+ 4db:	ff d0                	call   *%eax
+  return _write(fd, buf, n);
+ 4dd:	89 7d 10             	mov    %edi,0x10(%ebp)
+ 4e0:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 4e3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 4e6:	83 c4 0c             	add    $0xc,%esp
+ 4e9:	5b                   	pop    %ebx
+ 4ea:	5e                   	pop    %esi
+ 4eb:	5f                   	pop    %edi
+ 4ec:	5d                   	pop    %ebp
+  return _write(fd, buf, n);
+ 4ed:	e9 2e 01 00 00       	jmp    620 <_write>
+ 4f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000500 <writev>:
+{
+ 500:	55                   	push   %ebp
+ 501:	89 e5                	mov    %esp,%ebp
+ 503:	57                   	push   %edi
+ 504:	56                   	push   %esi
+ 505:	53                   	push   %ebx
+ 506:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+ 509:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+ 50e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 511:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 514:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+ 517:	85 c0                	test   %eax,%eax
+ 519:	74 02                	je     51d <writev+0x1d>
+    flushhook();
+ 51b:	ff d0                	call   *%eax
+  return _writev(fd, iov, cnt);
+ 51d:	89 7d 10             	mov    %edi,0x10(%ebp)
+ 520:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 523:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 526:	83 c4 0c             	add    $0xc,%esp
+ 529:	5b                   	pop    %ebx
+ 52a:	5e                   	pop    %esi
+ 52b:	5f                   	pop    %edi
+ 52c:	5d                   	pop    %ebp
+  return _writev(fd, iov, cnt);
+ 52d:	e9 fe 01 00 00       	jmp    730 <_writev>
+ 532:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 539:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000540 <close>:
+{
+ 540:	55                   	push   %ebp
+ 541:	89 e5                	mov    %esp,%ebp
+ 543:	53                   	push   %ebx
+ 544:	83 ec 04             	sub    $0x4,%esp
+  if(flushhook)
+ 547:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+ 54c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(flushhook)
+ 54f:	85 c0                	test   %eax,%eax
+ 551:	74 02                	je     555 <close+0x15>
+    flushhook();
+ 553:	ff d0                	call   *%eax
+  return _close(fd);
+ 555:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 558:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 55b:	c9                   	leave
+  return _close(fd);
+ 55c:	e9 c7 00 00 00       	jmp    628 <_close>
+ 561:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 568:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 56f:	90                   	nop
+
+00000570 <umtxinit>:
+// process that finds the mutex held enters the kernel, to sleep
+// in futexwait() until the holder's umtxunlock() wakes it.
+
+void
+umtxinit(struct umutex *m)
+{
+ 570:	55                   	push   %ebp
+ 571:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 573:	8b 45 08             	mov    0x8(%ebp),%eax
+ 576:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 57c:	5d                   	pop    %ebp
+ 57d:	c3                   	ret
+ 57e:	66 90                	xchg   %ax,%ax
+
+00000580 <umtxlock>:
+
+void
+umtxlock(struct umutex *m)
+{
+ 580:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 581:	b8 01 00 00 00       	mov    $0x1,%eax
+ 586:	89 e5                	mov    %esp,%ebp
+ 588:	56                   	push   %esi
+ 589:	53                   	push   %ebx
+ 58a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 58d:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 1) == 0)
+ 590:	85 c0                	test   %eax,%eax
+ 592:	74 2b                	je     5bf <umtxlock+0x3f>
+ 594:	b8 02 00 00 00       	mov    $0x2,%eax
+ 599:	f0 87 03             	lock xchg %eax,(%ebx)
+    return;
+  // Mark the mutex contended, so that its holder
+  // wakes a waiter on release, and wait.
+  while(xchg(&m->state, 2) != 0)
+ 59c:	85 c0                	test   %eax,%eax
+ 59e:	74 1f                	je     5bf <umtxlock+0x3f>
+ 5a0:	be 02 00 00 00       	mov    $0x2,%esi
+ 5a5:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwait(&m->state, 2);
+ 5a8:	83 ec 08             	sub    $0x8,%esp
+ 5ab:	6a 02                	push   $0x2
+ 5ad:	53                   	push   %ebx
+ 5ae:	e8 85 01 00 00       	call   738 <futexwait>
+ 5b3:	89 f0                	mov    %esi,%eax
+ 5b5:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+ 5b8:	83 c4 10             	add    $0x10,%esp
+ 5bb:	85 c0                	test   %eax,%eax
+ 5bd:	75 e9                	jne    5a8 <umtxlock+0x28>
+}
+ 5bf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 5c2:	5b                   	pop    %ebx
+ 5c3:	5e                   	pop    %esi
+ 5c4:	5d                   	pop    %ebp
+ 5c5:	c3                   	ret
+ 5c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000005d0 <umtxunlock>:
+
+void
+umtxunlock(struct umutex *m)
+{
+ 5d0:	55                   	push   %ebp
+ 5d1:	31 c0                	xor    %eax,%eax
+ 5d3:	89 e5                	mov    %esp,%ebp
+ 5d5:	83 ec 08             	sub    $0x8,%esp
+ 5d8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 5db:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 5de:	83 f8 02             	cmp    $0x2,%eax
+ 5e1:	74 05                	je     5e8 <umtxunlock+0x18>
+    futexwake(&m->state, 1);
+}
+ 5e3:	c9                   	leave
+ 5e4:	c3                   	ret
+ 5e5:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwake(&m->state, 1);
+ 5e8:	83 ec 08             	sub    $0x8,%esp
+ 5eb:	6a 01                	push   $0x1
+ 5ed:	52                   	push   %edx
+ 5ee:	e8 4d 01 00 00       	call   740 <futexwake>
+ 5f3:	83 c4 10             	add    $0x10,%esp
+}
+ 5f6:	c9                   	leave
+ 5f7:	c3                   	ret
+
+000005f8 <_fork>:
+  _ ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+ 5f8:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5fd:	cd 40                	int    $0x40
+ 5ff:	c3                   	ret
+
+00000600 <_exit>:
+RAWSYSCALL(exit)
+ 600:	b8 02 00 00 00       	mov    $0x2,%eax
+ 605:	cd 40                	int    $0x40
+ 607:	c3                   	ret
+
+00000608 <wait>:
+SYSCALL(wait)
+ 608:	b8 03 00 00 00       	mov    $0x3,%eax
+ 60d:	cd 40                	int    $0x40
+ 60f:	c3                   	ret
+
+00000610 <pipe>:
+SYSCALL(pipe)
+ 610:	b8 04 00 00 00       	mov    $0x4,%eax
+ 615:	cd 40                	int    $0x40
+ 617:	c3                   	ret
+
+00000618 <_read>:
+RAWSYSCALL(read)
+ 618:	b8 05 00 00 00       	mov    $0x5,%eax
+ 61d:	cd 40                	int    $0x40
+ 61f:	c3                   	ret
+
+00000620 <_write>:
+RAWSYSCALL(write)
+ 620:	b8 10 00 00 00       	mov    $0x10,%eax
+ 625:	cd 40                	int    $0x40
+ 627:	c3                   	ret
+
+00000628 <_close>:
+RAWSYSCALL(close)
+ 628:	b8 15 00 00 00       	mov    $0x15,%eax
+ 62d:	cd 40                	int    $0x40
+ 62f:	c3                   	ret
+
+00000630 <kill>:
+SYSCALL(kill)
+ 630:	b8 06 00 00 00       	mov    $0x6,%eax
+ 635:	cd 40                	int    $0x40
+ 637:	c3                   	ret
+
+00000638 <_exec>:
+RAWSYSCALL(exec)
+ 638:	b8 07 00 00 00       	mov    $0x7,%eax
+ 63d:	cd 40                	int    $0x40
+ 63f:	c3                   	ret
+
+00000640 <open>:
+SYSCALL(open)
+ 640:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 645:	cd 40                	int    $0x40
+ 647:	c3                   	ret
+
+00000648 <mknod>:
+SYSCALL(mknod)
+ 648:	b8 11 00 00 00       	mov    $0x11,%eax
+ 64d:	cd 40                	int    $0x40
+ 64f:	c3                   	ret
+
+00000650 <unlink>:
+SYSCALL(unlink)
+ 650:	b8 12 00 00 00       	mov    $0x12,%eax
+ 655:	cd 40                	int    $0x40
+ 657:	c3                   	ret
+
+00000658 <fstat>:
+SYSCALL(fstat)
+ 658:	b8 08 00 00 00       	mov    $0x8,%eax
+ 65d:	cd 40                	int    $0x40
+ 65f:	c3                   	ret
+
+00000660 <link>:
+SYSCALL(link)
+ 660:	b8 13 00 00 00       	mov    $0x13,%eax
+ 665:	cd 40                	int    $0x40
+ 667:	c3                   	ret
+
+00000668 <mkdir>:
+SYSCALL(mkdir)
+ 668:	b8 14 00 00 00       	mov    $0x14,%eax
+ 66d:	cd 40                	int    $0x40
+ 66f:	c3                   	ret
+
+00000670 <chdir>:
+SYSCALL(chdir)
+ 670:	b8 09 00 00 00       	mov    $0x9,%eax
+ 675:	cd 40                	int    $0x40
+ 677:	c3                   	ret
+
+00000678 <dup>:
+SYSCALL(dup)
+ 678:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 67d:	cd 40                	int    $0x40
+ 67f:	c3                   	ret
+
+00000680 <getpid>:
+SYSCALL(getpid)
+ 680:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 685:	cd 40                	int    $0x40
+ 687:	c3                   	ret
+
+00000688 <sbrk>:
+SYSCALL(sbrk)
+ 688:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 68d:	cd 40                	int    $0x40
+ 68f:	c3                   	ret
+
+00000690 <sleep>:
+SYSCALL(sleep)
+ 690:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 695:	cd 40                	int    $0x40
+ 697:	c3                   	ret
+
+00000698 <uptime>:
+SYSCALL(uptime)
+ 698:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 69d:	cd 40                	int    $0x40
+ 69f:	c3                   	ret
+
+000006a0 <wolfie>:
+SYSCALL(wolfie)
+ 6a0:	b8 16 00 00 00       	mov    $0x16,%eax
+ 6a5:	cd 40                	int    $0x40
+ 6a7:	c3                   	ret
+
+000006a8 <nice>:
+SYSCALL(nice)
+ 6a8:	b8 17 00 00 00       	mov    $0x17,%eax
+ 6ad:	cd 40                	int    $0x40
+ 6af:	c3                   	ret
+
+000006b0 <mtxget>:
+SYSCALL(mtxget)
+ 6b0:	b8 18 00 00 00       	mov    $0x18,%eax
+ 6b5:	cd 40                	int    $0x40
+ 6b7:	c3                   	ret
+
+000006b8 <mtxrel>:
+SYSCALL(mtxrel)
+ 6b8:	b8 19 00 00 00       	mov    $0x19,%eax
+ 6bd:	cd 40                	int    $0x40
+ 6bf:	c3                   	ret
+
+000006c0 <mtxacq>:
+SYSCALL(mtxacq)
+ 6c0:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 6c5:	cd 40                	int    $0x40
+ 6c7:	c3                   	ret
+
+000006c8 <mtxdel>:
+SYSCALL(mtxdel)
+ 6c8:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 6cd:	cd 40                	int    $0x40
+ 6cf:	c3                   	ret
+
+000006d0 <iostat>:
+SYSCALL(iostat)
+ 6d0:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 6d5:	cd 40                	int    $0x40
+ 6d7:	c3                   	ret
+
+000006d8 <mmap>:
+SYSCALL(mmap)
+ 6d8:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 6dd:	cd 40                	int    $0x40
+ 6df:	c3                   	ret
+
+000006e0 <munmap>:
+SYSCALL(munmap)
+ 6e0:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 6e5:	cd 40                	int    $0x40
+ 6e7:	c3                   	ret
+
+000006e8 <shmget>:
+SYSCALL(shmget)
+ 6e8:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 6ed:	cd 40                	int    $0x40
+ 6ef:	c3                   	ret
+
+000006f0 <shmat>:
+SYSCALL(shmat)
+ 6f0:	b8 20 00 00 00       	mov    $0x20,%eax
+ 6f5:	cd 40                	int    $0x40
+ 6f7:	c3                   	ret
+
+000006f8 <shmdt>:
+SYSCALL(shmdt)
+ 6f8:	b8 21 00 00 00       	mov    $0x21,%eax
+ 6fd:	cd 40                	int    $0x40
+ 6ff:	c3                   	ret
+
+00000700 <shmdel>:
+SYSCALL(shmdel)
+ 700:	b8 22 00 00 00       	mov    $0x22,%eax
+ 705:	cd 40                	int    $0x40
+ 707:	c3                   	ret
+
+00000708 <syscount>:
+SYSCALL(syscount)
+ 708:	b8 23 00 00 00       	mov    $0x23,%eax
+ 70d:	cd 40                	int    $0x40
+ 70f:	c3                   	ret
+
+00000710 <splice>:
+SYSCALL(splice)
+ 710:	b8 24 00 00 00       	mov    $0x24,%eax
+ 715:	cd 40                	int    $0x40
+ 717:	c3                   	ret
+
+00000718 <tee>:
+SYSCALL(tee)
+ 718:	b8 25 00 00 00       	mov    $0x25,%eax
+ 71d:	cd 40                	int    $0x40
+ 71f:	c3                   	ret
+
+00000720 <sendfile>:
+SYSCALL(sendfile)
+ 720:	b8 26 00 00 00       	mov    $0x26,%eax
+ 725:	cd 40                	int    $0x40
+ 727:	c3                   	ret
+
+00000728 <_readv>:
+RAWSYSCALL(readv)
+ 728:	b8 27 00 00 00       	mov    $0x27,%eax
+ 72d:	cd 40                	int    $0x40
+ 72f:	c3                   	ret
+
+00000730 <_writev>:
+RAWSYSCALL(writev)
+ 730:	b8 28 00 00 00       	mov    $0x28,%eax
+ 735:	cd 40                	int    $0x40
+ 737:	c3                   	ret
+
+00000738 <futexwait>:
+SYSCALL(futexwait)
+ 738:	b8 29 00 00 00       	mov    $0x29,%eax
+ 73d:	cd 40                	int    $0x40
+ 73f:	c3                   	ret
+
+00000740 <futexwake>:
+SYSCALL(futexwake)
+ 740:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 745:	cd 40                	int    $0x40
+ 747:	c3                   	ret
+
+00000748 <lockstat>:
+SYSCALL(lockstat)
+ 748:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 74d:	cd 40                	int    $0x40
+ 74f:	c3                   	ret
+
+00000750 <clone>:
+SYSCALL(clone)
+ 750:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 755:	cd 40                	int    $0x40
+ 757:	c3                   	ret
+
+00000758 <join>:
+SYSCALL(join)
+ 758:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 75d:	cd 40                	int    $0x40
+ 75f:	c3                   	ret
+
+00000760 <stacklimit>:
+SYSCALL(stacklimit)
+ 760:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 765:	cd 40                	int    $0x40
+ 767:	c3                   	ret
+ 768:	66 90                	xchg   %ax,%ax
+ 76a:	66 90                	xchg   %ax,%ax
+ 76c:	66 90                	xchg   %ax,%ax
+ 76e:	66 90                	xchg   %ax,%ax
+
+00000770 <flushall>:
+  b->n = 0;
+}
+
+static void
+flushall(void)
+{
+ 770:	55                   	push   %ebp
+ 771:	89 e5                	mov    %esp,%ebp
+ 773:	83 ec 14             	sub    $0x14,%esp
+  umtxlock(&stdoutlock);
+ 776:	68 14 22 00 00       	push   $0x2214
+ 77b:	e8 00 fe ff ff       	call   580 <umtxlock>
+  if(b->n > 0)
+ 780:	a1 08 20 00 00       	mov    0x2008,%eax
+ 785:	83 c4 10             	add    $0x10,%esp
+ 788:	85 c0                	test   %eax,%eax
+ 78a:	7e 17                	jle    7a3 <flushall+0x33>
+    _write(b->fd, b->buf, b->n);
+ 78c:	83 ec 04             	sub    $0x4,%esp
+ 78f:	50                   	push   %eax
+ 790:	68 0c 20 00 00       	push   $0x200c
+ 795:	ff 35 00 20 00 00    	push   0x2000
+ 79b:	e8 80 fe ff ff       	call   620 <_write>
+ 7a0:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+ 7a3:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+ 7aa:	00 00 00 
+  flush(&stdout);
+  umtxunlock(&stdoutlock);
+ 7ad:	83 ec 0c             	sub    $0xc,%esp
+ 7b0:	68 14 22 00 00       	push   $0x2214
+ 7b5:	e8 16 fe ff ff       	call   5d0 <umtxunlock>
+}
+ 7ba:	83 c4 10             	add    $0x10,%esp
+ 7bd:	c9                   	leave
+ 7be:	c3                   	ret
+ 7bf:	90                   	nop
+
+000007c0 <printint>:
+    flush(b);
+}
+
+static void
+printint(struct outbuf *b, int xx, int base, int sgn)
+{
+ 7c0:	55                   	push   %ebp
+ 7c1:	89 e5                	mov    %esp,%ebp
+ 7c3:	57                   	push   %edi
+ 7c4:	89 cf                	mov    %ecx,%edi
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 7c6:	89 d1                	mov    %edx,%ecx
+{
+ 7c8:	56                   	push   %esi
+ 7c9:	53                   	push   %ebx
+ 7ca:	89 c3                	mov    %eax,%ebx
+ 7cc:	83 ec 2c             	sub    $0x2c,%esp
+  if(sgn && xx < 0){
+ 7cf:	85 d2                	test   %edx,%edx
+ 7d1:	0f 89 b9 00 00 00    	jns    890 <printint+0xd0>
+ 7d7:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 7db:	0f 84 af 00 00 00    	je     890 <printint+0xd0>
+    x = -xx;
+ 7e1:	f7 d9                	neg    %ecx
+    neg = 1;
+ 7e3:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 7e8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 7eb:	31 f6                	xor    %esi,%esi
+ 7ed:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 7f0:	89 c8                	mov    %ecx,%eax
+ 7f2:	31 d2                	xor    %edx,%edx
+ 7f4:	89 f3                	mov    %esi,%ebx
+ 7f6:	f7 f7                	div    %edi
+ 7f8:	8d 76 01             	lea    0x1(%esi),%esi
+ 7fb:	0f b6 92 ec 13 00 00 	movzbl 0x13ec(%edx),%edx
+ 802:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 806:	89 ca                	mov    %ecx,%edx
+ 808:	89 c1                	mov    %eax,%ecx
+ 80a:	39 fa                	cmp    %edi,%edx
+ 80c:	73 e2                	jae    7f0 <printint+0x30>
+  if(neg)
+ 80e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 811:	89 d9                	mov    %ebx,%ecx
+ 813:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 816:	85 c0                	test   %eax,%eax
+ 818:	74 07                	je     821 <printint+0x61>
+    buf[i++] = '-';
+ 81a:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 81f:	89 f1                	mov    %esi,%ecx
+ 821:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 824:	89 cf                	mov    %ecx,%edi
+ 826:	01 f7                	add    %esi,%edi
+ 828:	eb 1a                	jmp    844 <printint+0x84>
+ 82a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    *b->str++ = c;
+ 830:	8d 48 01             	lea    0x1(%eax),%ecx
+ 833:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+ 839:	88 10                	mov    %dl,(%eax)
+
+  while(--i >= 0)
+ 83b:	8d 47 ff             	lea    -0x1(%edi),%eax
+ 83e:	39 fe                	cmp    %edi,%esi
+ 840:	74 40                	je     882 <printint+0xc2>
+ 842:	89 c7                	mov    %eax,%edi
+  if(b->str){
+ 844:	8b 83 0c 02 00 00    	mov    0x20c(%ebx),%eax
+    putc(b, buf[i]);
+ 84a:	0f b6 17             	movzbl (%edi),%edx
+  if(b->str){
+ 84d:	85 c0                	test   %eax,%eax
+ 84f:	75 df                	jne    830 <printint+0x70>
+  b->buf[b->n++] = c;
+ 851:	8b 4b 08             	mov    0x8(%ebx),%ecx
+ 854:	8d 41 01             	lea    0x1(%ecx),%eax
+ 857:	89 43 08             	mov    %eax,0x8(%ebx)
+ 85a:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+ 85e:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 863:	74 3b                	je     8a0 <printint+0xe0>
+ 865:	80 fa 0a             	cmp    $0xa,%dl
+ 868:	75 d1                	jne    83b <printint+0x7b>
+ 86a:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+ 86e:	75 cb                	jne    83b <printint+0x7b>
+  if(b->n > 0)
+ 870:	85 c0                	test   %eax,%eax
+ 872:	7f 2c                	jg     8a0 <printint+0xe0>
+  b->n = 0;
+ 874:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  while(--i >= 0)
+ 87b:	8d 47 ff             	lea    -0x1(%edi),%eax
+ 87e:	39 fe                	cmp    %edi,%esi
+ 880:	75 c0                	jne    842 <printint+0x82>
+}
+ 882:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 885:	5b                   	pop    %ebx
+ 886:	5e                   	pop    %esi
+ 887:	5f                   	pop    %edi
+ 888:	5d                   	pop    %ebp
+ 889:	c3                   	ret
+ 88a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  neg = 0;
+ 890:	31 c0                	xor    %eax,%eax
+ 892:	e9 51 ff ff ff       	jmp    7e8 <printint+0x28>
+ 897:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 89e:	66 90                	xchg   %ax,%ax
+    _write(b->fd, b->buf, b->n);
+ 8a0:	83 ec 04             	sub    $0x4,%esp
+ 8a3:	50                   	push   %eax
+ 8a4:	8d 43 0c             	lea    0xc(%ebx),%eax
+ 8a7:	50                   	push   %eax
+ 8a8:	ff 33                	push   (%ebx)
+ 8aa:	e8 71 fd ff ff       	call   620 <_write>
+ 8af:	83 c4 10             	add    $0x10,%esp
+ 8b2:	eb c0                	jmp    874 <printint+0xb4>
+ 8b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8bf:	90                   	nop
+
+000008c0 <putc>:
+{
+ 8c0:	55                   	push   %ebp
+ 8c1:	89 e5                	mov    %esp,%ebp
+ 8c3:	53                   	push   %ebx
+ 8c4:	89 c3                	mov    %eax,%ebx
+ 8c6:	83 ec 04             	sub    $0x4,%esp
+  if(b->str){
+ 8c9:	8b 80 0c 02 00 00    	mov    0x20c(%eax),%eax
+ 8cf:	85 c0                	test   %eax,%eax
+ 8d1:	74 15                	je     8e8 <putc+0x28>
+    *b->str++ = c;
+ 8d3:	8d 48 01             	lea    0x1(%eax),%ecx
+ 8d6:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+ 8dc:	88 10                	mov    %dl,(%eax)
+}
+ 8de:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 8e1:	c9                   	leave
+ 8e2:	c3                   	ret
+ 8e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8e7:	90                   	nop
+  b->buf[b->n++] = c;
+ 8e8:	8b 4b 08             	mov    0x8(%ebx),%ecx
+ 8eb:	8d 41 01             	lea    0x1(%ecx),%eax
+ 8ee:	89 43 08             	mov    %eax,0x8(%ebx)
+ 8f1:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+ 8f5:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 8fa:	74 14                	je     910 <putc+0x50>
+ 8fc:	80 fa 0a             	cmp    $0xa,%dl
+ 8ff:	75 dd                	jne    8de <putc+0x1e>
+ 901:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+ 905:	75 d7                	jne    8de <putc+0x1e>
+  if(b->n > 0)
+ 907:	85 c0                	test   %eax,%eax
+ 909:	7e 17                	jle    922 <putc+0x62>
+ 90b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 90f:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+ 910:	83 ec 04             	sub    $0x4,%esp
+ 913:	50                   	push   %eax
+ 914:	8d 43 0c             	lea    0xc(%ebx),%eax
+ 917:	50                   	push   %eax
+ 918:	ff 33                	push   (%ebx)
+ 91a:	e8 01 fd ff ff       	call   620 <_write>
+ 91f:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+ 922:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+ 929:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 92c:	c9                   	leave
+ 92d:	c3                   	ret
+ 92e:	66 90                	xchg   %ax,%ax
+
+00000930 <format>:
+
+// Format fmt and the arguments at ap into b.
+// Only understands %d, %x, %p, %s, %c.
+static void
+format(struct outbuf *b, const char *fmt, uint *ap)
+{
+ 930:	55                   	push   %ebp
+ 931:	89 e5                	mov    %esp,%ebp
+ 933:	57                   	push   %edi
+ 934:	89 c7                	mov    %eax,%edi
+ 936:	56                   	push   %esi
+ 937:	53                   	push   %ebx
+ 938:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+ 93b:	0f b6 02             	movzbl (%edx),%eax
+{
+ 93e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 941:	84 c0                	test   %al,%al
+ 943:	74 5a                	je     99f <format+0x6f>
+ 945:	8d 5a 01             	lea    0x1(%edx),%ebx
+ 948:	31 f6                	xor    %esi,%esi
+ 94a:	eb 1c                	jmp    968 <format+0x38>
+ 94c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+ 950:	83 f8 25             	cmp    $0x25,%eax
+ 953:	74 3b                	je     990 <format+0x60>
+        state = '%';
+      } else {
+        putc(b, c);
+ 955:	89 ca                	mov    %ecx,%edx
+ 957:	89 f8                	mov    %edi,%eax
+ 959:	e8 62 ff ff ff       	call   8c0 <putc>
+  for(i = 0; fmt[i]; i++){
+ 95e:	0f b6 03             	movzbl (%ebx),%eax
+ 961:	83 c3 01             	add    $0x1,%ebx
+ 964:	84 c0                	test   %al,%al
+ 966:	74 37                	je     99f <format+0x6f>
+    c = fmt[i] & 0xff;
+ 968:	0f be c8             	movsbl %al,%ecx
+ 96b:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 96e:	85 f6                	test   %esi,%esi
+ 970:	74 de                	je     950 <format+0x20>
+      }
+    } else if(state == '%'){
+ 972:	83 fe 25             	cmp    $0x25,%esi
+ 975:	75 e7                	jne    95e <format+0x2e>
+      if(c == 'd'){
+ 977:	83 f8 25             	cmp    $0x25,%eax
+ 97a:	74 46                	je     9c2 <format+0x92>
+ 97c:	83 e8 63             	sub    $0x63,%eax
+ 97f:	83 f8 15             	cmp    $0x15,%eax
+ 982:	77 2c                	ja     9b0 <format+0x80>
+ 984:	ff 24 85 94 13 00 00 	jmp    *0x1394(,%eax,4)
+ 98b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 98f:	90                   	nop
+  for(i = 0; fmt[i]; i++){
+ 990:	0f b6 03             	movzbl (%ebx),%eax
+ 993:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+ 996:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+ 99b:	84 c0                	test   %al,%al
+ 99d:	75 c9                	jne    968 <format+0x38>
+        putc(b, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 99f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 9a2:	5b                   	pop    %ebx
+ 9a3:	5e                   	pop    %esi
+ 9a4:	5f                   	pop    %edi
+ 9a5:	5d                   	pop    %ebp
+ 9a6:	c3                   	ret
+ 9a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9ae:	66 90                	xchg   %ax,%ax
+        putc(b, '%');
+ 9b0:	ba 25 00 00 00       	mov    $0x25,%edx
+ 9b5:	89 f8                	mov    %edi,%eax
+ 9b7:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+ 9ba:	e8 01 ff ff ff       	call   8c0 <putc>
+        putc(b, c);
+ 9bf:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ 9c2:	89 ca                	mov    %ecx,%edx
+ 9c4:	89 f8                	mov    %edi,%eax
+      state = 0;
+ 9c6:	31 f6                	xor    %esi,%esi
+        putc(b, c);
+ 9c8:	e8 f3 fe ff ff       	call   8c0 <putc>
+ 9cd:	eb 8f                	jmp    95e <format+0x2e>
+ 9cf:	90                   	nop
+        printint(b, *ap, 16, 0);
+ 9d0:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+ 9d3:	83 ec 0c             	sub    $0xc,%esp
+ 9d6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 9db:	8b 16                	mov    (%esi),%edx
+ 9dd:	6a 00                	push   $0x0
+        ap++;
+ 9df:	83 c6 04             	add    $0x4,%esi
+        printint(b, *ap, 16, 0);
+ 9e2:	89 f8                	mov    %edi,%eax
+ 9e4:	e8 d7 fd ff ff       	call   7c0 <printint>
+        ap++;
+ 9e9:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+ 9ec:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 9ef:	31 f6                	xor    %esi,%esi
+ 9f1:	e9 68 ff ff ff       	jmp    95e <format+0x2e>
+ 9f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9fd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ a00:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ a03:	8b 30                	mov    (%eax),%esi
+        ap++;
+ a05:	83 c0 04             	add    $0x4,%eax
+ a08:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ a0b:	85 f6                	test   %esi,%esi
+ a0d:	75 1b                	jne    a2a <format+0xfa>
+ a0f:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+ a14:	be 8c 13 00 00       	mov    $0x138c,%esi
+ a19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+          putc(b, *s);
+ a20:	89 f8                	mov    %edi,%eax
+          s++;
+ a22:	83 c6 01             	add    $0x1,%esi
+          putc(b, *s);
+ a25:	e8 96 fe ff ff       	call   8c0 <putc>
+        while(*s != 0){
+ a2a:	0f be 16             	movsbl (%esi),%edx
+ a2d:	84 d2                	test   %dl,%dl
+ a2f:	75 ef                	jne    a20 <format+0xf0>
+      state = 0;
+ a31:	31 f6                	xor    %esi,%esi
+ a33:	e9 26 ff ff ff       	jmp    95e <format+0x2e>
+ a38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a3f:	90                   	nop
+        printint(b, *ap, 10, 1);
+ a40:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+ a43:	83 ec 0c             	sub    $0xc,%esp
+ a46:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ a4b:	8b 16                	mov    (%esi),%edx
+ a4d:	6a 01                	push   $0x1
+ a4f:	eb 8e                	jmp    9df <format+0xaf>
+ a51:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(b, *ap);
+ a58:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+ a5b:	89 f8                	mov    %edi,%eax
+ a5d:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+ a60:	83 c6 04             	add    $0x4,%esi
+        putc(b, *ap);
+ a63:	e8 58 fe ff ff       	call   8c0 <putc>
+        ap++;
+ a68:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      state = 0;
+ a6b:	31 f6                	xor    %esi,%esi
+ a6d:	e9 ec fe ff ff       	jmp    95e <format+0x2e>
+ a72:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000a80 <fflush>:
+{
+ a80:	55                   	push   %ebp
+ a81:	89 e5                	mov    %esp,%ebp
+ a83:	83 ec 08             	sub    $0x8,%esp
+  if(fd == stdout.fd)
+ a86:	8b 45 08             	mov    0x8(%ebp),%eax
+ a89:	39 05 00 20 00 00    	cmp    %eax,0x2000
+ a8f:	74 07                	je     a98 <fflush+0x18>
+}
+ a91:	c9                   	leave
+ a92:	c3                   	ret
+ a93:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a97:	90                   	nop
+  umtxlock(&stdoutlock);
+ a98:	83 ec 0c             	sub    $0xc,%esp
+ a9b:	68 14 22 00 00       	push   $0x2214
+ aa0:	e8 db fa ff ff       	call   580 <umtxlock>
+  if(b->n > 0)
+ aa5:	a1 08 20 00 00       	mov    0x2008,%eax
+ aaa:	83 c4 10             	add    $0x10,%esp
+ aad:	85 c0                	test   %eax,%eax
+ aaf:	7f 1f                	jg     ad0 <fflush+0x50>
+  b->n = 0;
+ ab1:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+ ab8:	00 00 00 
+  umtxunlock(&stdoutlock);
+ abb:	c7 45 08 14 22 00 00 	movl   $0x2214,0x8(%ebp)
+}
+ ac2:	c9                   	leave
+  umtxunlock(&stdoutlock);
+ ac3:	e9 08 fb ff ff       	jmp    5d0 <umtxunlock>
+ ac8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ acf:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+ ad0:	83 ec 04             	sub    $0x4,%esp
+ ad3:	50                   	push   %eax
+ ad4:	68 0c 20 00 00       	push   $0x200c
+ ad9:	ff 35 00 20 00 00    	push   0x2000
+ adf:	e8 3c fb ff ff       	call   620 <_write>
+ ae4:	83 c4 10             	add    $0x10,%esp
+ ae7:	eb c8                	jmp    ab1 <fflush+0x31>
+ ae9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000af0 <setvbuf>:
+{
+ af0:	55                   	push   %ebp
+ af1:	89 e5                	mov    %esp,%ebp
+ af3:	53                   	push   %ebx
+ af4:	83 ec 04             	sub    $0x4,%esp
+ af7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd != stdout.fd)
+ afa:	8b 45 08             	mov    0x8(%ebp),%eax
+ afd:	39 05 00 20 00 00    	cmp    %eax,0x2000
+ b03:	74 0b                	je     b10 <setvbuf+0x20>
+}
+ b05:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ b08:	c9                   	leave
+ b09:	c3                   	ret
+ b0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  umtxlock(&stdoutlock);
+ b10:	83 ec 0c             	sub    $0xc,%esp
+ b13:	68 14 22 00 00       	push   $0x2214
+ b18:	e8 63 fa ff ff       	call   580 <umtxlock>
+  if(b->n > 0)
+ b1d:	a1 08 20 00 00       	mov    0x2008,%eax
+ b22:	83 c4 10             	add    $0x10,%esp
+ b25:	85 c0                	test   %eax,%eax
+ b27:	7f 2f                	jg     b58 <setvbuf+0x68>
+  b->n = 0;
+ b29:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+ b30:	00 00 00 
+  stdout.mode = mode;
+ b33:	89 1d 04 20 00 00    	mov    %ebx,0x2004
+  flushhook = flushall;
+ b39:	c7 05 10 22 00 00 70 	movl   $0x770,0x2210
+ b40:	07 00 00 
+}
+ b43:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&stdoutlock);
+ b46:	c7 45 08 14 22 00 00 	movl   $0x2214,0x8(%ebp)
+}
+ b4d:	c9                   	leave
+  umtxunlock(&stdoutlock);
+ b4e:	e9 7d fa ff ff       	jmp    5d0 <umtxunlock>
+ b53:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b57:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+ b58:	83 ec 04             	sub    $0x4,%esp
+ b5b:	50                   	push   %eax
+ b5c:	68 0c 20 00 00       	push   $0x200c
+ b61:	ff 35 00 20 00 00    	push   0x2000
+ b67:	e8 b4 fa ff ff       	call   620 <_write>
+ b6c:	83 c4 10             	add    $0x10,%esp
+ b6f:	eb b8                	jmp    b29 <setvbuf+0x39>
+ b71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b7f:	90                   	nop
+
+00000b80 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s, %c.
+void
+printf(int fd, const char *fmt, ...)
+{
+ b80:	55                   	push   %ebp
+ b81:	89 e5                	mov    %esp,%ebp
+ b83:	53                   	push   %ebx
+ b84:	81 ec 14 02 00 00    	sub    $0x214,%esp
+ b8a:	8b 45 08             	mov    0x8(%ebp),%eax
+    local.mode = _IONBF;
+    local.n = 0;
+    local.str = 0;
+    b = &local;
+  }
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+ b8d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd == stdout.fd){
+ b90:	39 05 00 20 00 00    	cmp    %eax,0x2000
+ b96:	74 48                	je     be0 <printf+0x60>
+    local.fd = fd;
+ b98:	89 85 e8 fd ff ff    	mov    %eax,-0x218(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+ b9e:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ ba1:	89 da                	mov    %ebx,%edx
+ ba3:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+    local.mode = _IONBF;
+ ba9:	c7 85 ec fd ff ff 03 	movl   $0x3,-0x214(%ebp)
+ bb0:	00 00 00 
+    local.n = 0;
+ bb3:	c7 85 f0 fd ff ff 00 	movl   $0x0,-0x210(%ebp)
+ bba:	00 00 00 
+    local.str = 0;
+ bbd:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+ bc4:	e8 67 fd ff ff       	call   930 <format>
+  if(b->mode == _IONBF)
+ bc9:	83 bd ec fd ff ff 03 	cmpl   $0x3,-0x214(%ebp)
+ bd0:	0f 84 a2 00 00 00    	je     c78 <printf+0xf8>
+    flush(b);
+  if(b == &stdout)
+    umtxunlock(&stdoutlock);
+}
+ bd6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ bd9:	c9                   	leave
+ bda:	c3                   	ret
+ bdb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ bdf:	90                   	nop
+    umtxlock(&stdoutlock);
+ be0:	83 ec 0c             	sub    $0xc,%esp
+ be3:	68 14 22 00 00       	push   $0x2214
+ be8:	e8 93 f9 ff ff       	call   580 <umtxlock>
+  if(stdout.mode == 0){
+ bed:	a1 04 20 00 00       	mov    0x2004,%eax
+ bf2:	83 c4 10             	add    $0x10,%esp
+ bf5:	85 c0                	test   %eax,%eax
+ bf7:	74 37                	je     c30 <printf+0xb0>
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+ bf9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ bfc:	89 da                	mov    %ebx,%edx
+ bfe:	b8 00 20 00 00       	mov    $0x2000,%eax
+ c03:	e8 28 fd ff ff       	call   930 <format>
+  if(b->mode == _IONBF)
+ c08:	83 3d 04 20 00 00 03 	cmpl   $0x3,0x2004
+ c0f:	0f 84 ab 00 00 00    	je     cc0 <printf+0x140>
+    umtxunlock(&stdoutlock);
+ c15:	83 ec 0c             	sub    $0xc,%esp
+ c18:	68 14 22 00 00       	push   $0x2214
+ c1d:	e8 ae f9 ff ff       	call   5d0 <umtxunlock>
+}
+ c22:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    umtxunlock(&stdoutlock);
+ c25:	83 c4 10             	add    $0x10,%esp
+}
+ c28:	c9                   	leave
+ c29:	c3                   	ret
+ c2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+ c30:	83 ec 08             	sub    $0x8,%esp
+ c33:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+ c39:	50                   	push   %eax
+ c3a:	ff 35 00 20 00 00    	push   0x2000
+ c40:	e8 13 fa ff ff       	call   658 <fstat>
+ c45:	83 c4 10             	add    $0x10,%esp
+ c48:	89 c2                	mov    %eax,%edx
+      stdout.mode = _IOFBF;
+ c4a:	b8 01 00 00 00       	mov    $0x1,%eax
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+ c4f:	85 d2                	test   %edx,%edx
+ c51:	75 10                	jne    c63 <printf+0xe3>
+      stdout.mode = _IOLBF;
+ c53:	31 c0                	xor    %eax,%eax
+ c55:	66 83 bd e8 fd ff ff 	cmpw   $0x3,-0x218(%ebp)
+ c5c:	03 
+ c5d:	0f 94 c0             	sete   %al
+ c60:	83 c0 01             	add    $0x1,%eax
+ c63:	a3 04 20 00 00       	mov    %eax,0x2004
+    flushhook = flushall;
+ c68:	c7 05 10 22 00 00 70 	movl   $0x770,0x2210
+ c6f:	07 00 00 
+ c72:	eb 85                	jmp    bf9 <printf+0x79>
+ c74:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(b->n > 0)
+ c78:	8b 85 f0 fd ff ff    	mov    -0x210(%ebp),%eax
+ c7e:	85 c0                	test   %eax,%eax
+ c80:	0f 8e 50 ff ff ff    	jle    bd6 <printf+0x56>
+    b = &local;
+ c86:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+    _write(b->fd, b->buf, b->n);
+ c8c:	83 ec 04             	sub    $0x4,%esp
+ c8f:	50                   	push   %eax
+ c90:	8d 43 0c             	lea    0xc(%ebx),%eax
+ c93:	50                   	push   %eax
+ c94:	ff 33                	push   (%ebx)
+ c96:	e8 85 f9 ff ff       	call   620 <_write>
+  b->n = 0;
+ c9b:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  if(b == &stdout)
+ ca2:	83 c4 10             	add    $0x10,%esp
+ ca5:	81 fb 00 20 00 00    	cmp    $0x2000,%ebx
+ cab:	0f 85 25 ff ff ff    	jne    bd6 <printf+0x56>
+ cb1:	e9 5f ff ff ff       	jmp    c15 <printf+0x95>
+ cb6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cbd:	8d 76 00             	lea    0x0(%esi),%esi
+  if(b->n > 0)
+ cc0:	a1 08 20 00 00       	mov    0x2008,%eax
+    b = getstdout();
+ cc5:	bb 00 20 00 00       	mov    $0x2000,%ebx
+  if(b->n > 0)
+ cca:	85 c0                	test   %eax,%eax
+ ccc:	7f be                	jg     c8c <printf+0x10c>
+  b->n = 0;
+ cce:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+ cd5:	00 00 00 
+  if(b == &stdout)
+ cd8:	e9 38 ff ff ff       	jmp    c15 <printf+0x95>
+ cdd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ce0 <sprintf>:
+
+// Print to the given buffer. Only understands %d, %x, %p, %s, %c.
+int
+sprintf(char *str, const char *fmt, ...)
+{
+ ce0:	55                   	push   %ebp
+ ce1:	89 e5                	mov    %esp,%ebp
+ ce3:	53                   	push   %ebx
+  struct outbuf b;
+
+  b.str = str;
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+ ce4:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+ cea:	8d 4d 10             	lea    0x10(%ebp),%ecx
+{
+ ced:	81 ec 14 02 00 00    	sub    $0x214,%esp
+ cf3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+ cf6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  b.str = str;
+ cf9:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+ cfc:	e8 2f fc ff ff       	call   930 <format>
+  *b.str = '\0';
+ d01:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d04:	c6 00 00             	movb   $0x0,(%eax)
+  return b.str - str;
+ d07:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d0a:	29 d8                	sub    %ebx,%eax
+}
+ d0c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ d0f:	c9                   	leave
+ d10:	c3                   	ret
+ d11:	66 90                	xchg   %ax,%ax
+ d13:	66 90                	xchg   %ax,%ax
+ d15:	66 90                	xchg   %ax,%ax
+ d17:	66 90                	xchg   %ax,%ax
+ d19:	66 90                	xchg   %ax,%ax
+ d1b:	66 90                	xchg   %ax,%ax
+ d1d:	66 90                	xchg   %ax,%ax
+ d1f:	90                   	nop
+
+00000d20 <freeblock>:
+static Header *freep;
+static struct umutex lock;  // threads made by clone() share the heap
+
+static void
+freeblock(void *ap)
+{
+ d20:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ d21:	8d 48 f8             	lea    -0x8(%eax),%ecx
+{
+ d24:	89 e5                	mov    %esp,%ebp
+ d26:	57                   	push   %edi
+ d27:	56                   	push   %esi
+ d28:	53                   	push   %ebx
+ d29:	89 c3                	mov    %eax,%ebx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ d2b:	a1 1c 22 00 00       	mov    0x221c,%eax
+ d30:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d32:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ d34:	39 ca                	cmp    %ecx,%edx
+ d36:	73 30                	jae    d68 <freeblock+0x48>
+ d38:	39 c1                	cmp    %eax,%ecx
+ d3a:	72 04                	jb     d40 <freeblock+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d3c:	39 c2                	cmp    %eax,%edx
+ d3e:	72 f0                	jb     d30 <freeblock+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ d40:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ d43:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ d46:	39 f8                	cmp    %edi,%eax
+ d48:	74 26                	je     d70 <freeblock+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ d4a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ d4d:	8b 42 04             	mov    0x4(%edx),%eax
+ d50:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ d53:	39 f1                	cmp    %esi,%ecx
+ d55:	74 30                	je     d87 <freeblock+0x67>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ d57:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ d59:	5b                   	pop    %ebx
+  freep = p;
+ d5a:	89 15 1c 22 00 00    	mov    %edx,0x221c
+}
+ d60:	5e                   	pop    %esi
+ d61:	5f                   	pop    %edi
+ d62:	5d                   	pop    %ebp
+ d63:	c3                   	ret
+ d64:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d68:	39 c1                	cmp    %eax,%ecx
+ d6a:	72 d0                	jb     d3c <freeblock+0x1c>
+ d6c:	eb c2                	jmp    d30 <freeblock+0x10>
+ d6e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ d70:	03 70 04             	add    0x4(%eax),%esi
+ d73:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ d76:	8b 02                	mov    (%edx),%eax
+ d78:	8b 00                	mov    (%eax),%eax
+ d7a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ d7d:	8b 42 04             	mov    0x4(%edx),%eax
+ d80:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ d83:	39 f1                	cmp    %esi,%ecx
+ d85:	75 d0                	jne    d57 <freeblock+0x37>
+    p->s.size += bp->s.size;
+ d87:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ d8a:	89 15 1c 22 00 00    	mov    %edx,0x221c
+    p->s.size += bp->s.size;
+ d90:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ d93:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ d96:	89 0a                	mov    %ecx,(%edx)
+}
+ d98:	5b                   	pop    %ebx
+ d99:	5e                   	pop    %esi
+ d9a:	5f                   	pop    %edi
+ d9b:	5d                   	pop    %ebp
+ d9c:	c3                   	ret
+ d9d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000da0 <free>:
+
+void
+free(void *ap)
+{
+ da0:	55                   	push   %ebp
+ da1:	89 e5                	mov    %esp,%ebp
+ da3:	53                   	push   %ebx
+ da4:	83 ec 10             	sub    $0x10,%esp
+ da7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  umtxlock(&lock);
+ daa:	68 18 22 00 00       	push   $0x2218
+ daf:	e8 cc f7 ff ff       	call   580 <umtxlock>
+  freeblock(ap);
+ db4:	89 d8                	mov    %ebx,%eax
+ db6:	e8 65 ff ff ff       	call   d20 <freeblock>
+  umtxunlock(&lock);
+ dbb:	c7 45 08 18 22 00 00 	movl   $0x2218,0x8(%ebp)
+}
+ dc2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&lock);
+ dc5:	83 c4 10             	add    $0x10,%esp
+}
+ dc8:	c9                   	leave
+  umtxunlock(&lock);
+ dc9:	e9 02 f8 ff ff       	jmp    5d0 <umtxunlock>
+ dce:	66 90                	xchg   %ax,%ax
+
+00000dd0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ dd0:	55                   	push   %ebp
+ dd1:	89 e5                	mov    %esp,%ebp
+ dd3:	57                   	push   %edi
+ dd4:	56                   	push   %esi
+ dd5:	53                   	push   %ebx
+ dd6:	83 ec 28             	sub    $0x28,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ dd9:	8b 45 08             	mov    0x8(%ebp),%eax
+  umtxlock(&lock);
+ ddc:	68 18 22 00 00       	push   $0x2218
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ de1:	8d 48 07             	lea    0x7(%eax),%ecx
+ de4:	c1 e9 03             	shr    $0x3,%ecx
+ de7:	8d 71 01             	lea    0x1(%ecx),%esi
+  umtxlock(&lock);
+ dea:	e8 91 f7 ff ff       	call   580 <umtxlock>
+  if((prevp = freep) == 0){
+ def:	8b 15 1c 22 00 00    	mov    0x221c,%edx
+ df5:	83 c4 10             	add    $0x10,%esp
+ df8:	85 d2                	test   %edx,%edx
+ dfa:	0f 84 b0 00 00 00    	je     eb0 <malloc+0xe0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ e00:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ e02:	8b 47 04             	mov    0x4(%edi),%eax
+ e05:	39 f0                	cmp    %esi,%eax
+ e07:	73 6f                	jae    e78 <malloc+0xa8>
+  if(nu < 4096)
+ e09:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ e0e:	39 de                	cmp    %ebx,%esi
+ e10:	0f 43 de             	cmovae %esi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ e13:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ e1a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ e1d:	eb 0a                	jmp    e29 <malloc+0x59>
+ e1f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ e20:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ e22:	8b 47 04             	mov    0x4(%edi),%eax
+ e25:	39 f0                	cmp    %esi,%eax
+ e27:	73 4f                	jae    e78 <malloc+0xa8>
+      }
+      freep = prevp;
+      umtxunlock(&lock);
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ e29:	89 fa                	mov    %edi,%edx
+ e2b:	39 3d 1c 22 00 00    	cmp    %edi,0x221c
+ e31:	75 ed                	jne    e20 <malloc+0x50>
+  p = sbrk(nu * sizeof(Header));
+ e33:	83 ec 0c             	sub    $0xc,%esp
+ e36:	ff 75 e4             	push   -0x1c(%ebp)
+ e39:	e8 4a f8 ff ff       	call   688 <sbrk>
+  if(p == (char*)-1)
+ e3e:	83 c4 10             	add    $0x10,%esp
+ e41:	83 f8 ff             	cmp    $0xffffffff,%eax
+ e44:	74 15                	je     e5b <malloc+0x8b>
+  hp->s.size = nu;
+ e46:	89 58 04             	mov    %ebx,0x4(%eax)
+  freeblock((void*)(hp + 1));
+ e49:	83 c0 08             	add    $0x8,%eax
+ e4c:	e8 cf fe ff ff       	call   d20 <freeblock>
+  return freep;
+ e51:	8b 15 1c 22 00 00    	mov    0x221c,%edx
+      if((p = morecore(nunits)) == 0){
+ e57:	85 d2                	test   %edx,%edx
+ e59:	75 c5                	jne    e20 <malloc+0x50>
+        umtxunlock(&lock);
+ e5b:	83 ec 0c             	sub    $0xc,%esp
+ e5e:	68 18 22 00 00       	push   $0x2218
+ e63:	e8 68 f7 ff ff       	call   5d0 <umtxunlock>
+        return 0;
+ e68:	83 c4 10             	add    $0x10,%esp
+      }
+  }
+}
+ e6b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ e6e:	31 c0                	xor    %eax,%eax
+}
+ e70:	5b                   	pop    %ebx
+ e71:	5e                   	pop    %esi
+ e72:	5f                   	pop    %edi
+ e73:	5d                   	pop    %ebp
+ e74:	c3                   	ret
+ e75:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ e78:	39 c6                	cmp    %eax,%esi
+ e7a:	74 64                	je     ee0 <malloc+0x110>
+        p->s.size -= nunits;
+ e7c:	29 f0                	sub    %esi,%eax
+ e7e:	89 47 04             	mov    %eax,0x4(%edi)
+        p += p->s.size;
+ e81:	8d 3c c7             	lea    (%edi,%eax,8),%edi
+        p->s.size = nunits;
+ e84:	89 77 04             	mov    %esi,0x4(%edi)
+      umtxunlock(&lock);
+ e87:	83 ec 0c             	sub    $0xc,%esp
+      freep = prevp;
+ e8a:	89 15 1c 22 00 00    	mov    %edx,0x221c
+      umtxunlock(&lock);
+ e90:	68 18 22 00 00       	push   $0x2218
+ e95:	e8 36 f7 ff ff       	call   5d0 <umtxunlock>
+      return (void*)(p + 1);
+ e9a:	83 c4 10             	add    $0x10,%esp
+}
+ e9d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ ea0:	8d 47 08             	lea    0x8(%edi),%eax
+}
+ ea3:	5b                   	pop    %ebx
+ ea4:	5e                   	pop    %esi
+ ea5:	5f                   	pop    %edi
+ ea6:	5d                   	pop    %ebp
+ ea7:	c3                   	ret
+ ea8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ eaf:	90                   	nop
+    base.s.ptr = freep = prevp = &base;
+ eb0:	c7 05 1c 22 00 00 20 	movl   $0x2220,0x221c
+ eb7:	22 00 00 
+    base.s.size = 0;
+ eba:	bf 20 22 00 00       	mov    $0x2220,%edi
+    base.s.ptr = freep = prevp = &base;
+ ebf:	c7 05 20 22 00 00 20 	movl   $0x2220,0x2220
+ ec6:	22 00 00 
+    base.s.size = 0;
+ ec9:	c7 05 24 22 00 00 00 	movl   $0x0,0x2224
+ ed0:	00 00 00 
+    if(p->s.size >= nunits){
+ ed3:	e9 31 ff ff ff       	jmp    e09 <malloc+0x39>
+ ed8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ edf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ ee0:	8b 07                	mov    (%edi),%eax
+ ee2:	89 02                	mov    %eax,(%edx)
+ ee4:	eb a1                	jmp    e87 <malloc+0xb7>
+ ee6:	66 90                	xchg   %ax,%ax
+ ee8:	66 90                	xchg   %ax,%ax
+ eea:	66 90                	xchg   %ax,%ax
+ eec:	66 90                	xchg   %ax,%ax
+ eee:	66 90                	xchg   %ax,%ax
+
+00000ef0 <threadstart>:
+
+#define TSTACKSZ 4096
+
+static void
+threadstart(void *fn, void *arg)
+{
+ ef0:	55                   	push   %ebp
+ ef1:	89 e5                	mov    %esp,%ebp
+ ef3:	83 ec 14             	sub    $0x14,%esp
+  ((void (*)(void*))fn)(arg);
+ ef6:	ff 75 0c             	push   0xc(%ebp)
+ ef9:	ff 55 08             	call   *0x8(%ebp)
+  exit();
+ efc:	e8 ef f4 ff ff       	call   3f0 <exit>
+ f01:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ f08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ f0f:	90                   	nop
+
+00000f10 <thread_create>:
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ f10:	55                   	push   %ebp
+ f11:	89 e5                	mov    %esp,%ebp
+ f13:	53                   	push   %ebx
+ f14:	83 ec 20             	sub    $0x20,%esp
+  char *mem, *stack;
+  int pid;
+
+  if((mem = malloc(2*TSTACKSZ)) == 0)
+ f17:	68 00 20 00 00       	push   $0x2000
+ f1c:	e8 af fe ff ff       	call   dd0 <malloc>
+ f21:	83 c4 10             	add    $0x10,%esp
+ f24:	85 c0                	test   %eax,%eax
+ f26:	74 47                	je     f6f <thread_create+0x5f>
+ f28:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)(((uint)mem + TSTACKSZ - 1) & ~(TSTACKSZ - 1));
+ f2a:	8d 80 ff 0f 00 00    	lea    0xfff(%eax),%eax
+ f30:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  *(char**)stack = mem;
+ f35:	89 18                	mov    %ebx,(%eax)
+  if((pid = clone(threadstart, (void*)fn, arg, stack)) < 0)
+ f37:	50                   	push   %eax
+ f38:	ff 75 0c             	push   0xc(%ebp)
+ f3b:	ff 75 08             	push   0x8(%ebp)
+ f3e:	68 f0 0e 00 00       	push   $0xef0
+ f43:	e8 08 f8 ff ff       	call   750 <clone>
+ f48:	83 c4 10             	add    $0x10,%esp
+ f4b:	85 c0                	test   %eax,%eax
+ f4d:	78 09                	js     f58 <thread_create+0x48>
+    free(mem);
+  return pid;
+}
+ f4f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ f52:	c9                   	leave
+ f53:	c3                   	ret
+ f54:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    free(mem);
+ f58:	83 ec 0c             	sub    $0xc,%esp
+ f5b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ f5e:	53                   	push   %ebx
+ f5f:	e8 3c fe ff ff       	call   da0 <free>
+ f64:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ f67:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+ f6a:	83 c4 10             	add    $0x10,%esp
+}
+ f6d:	c9                   	leave
+ f6e:	c3                   	ret
+    return -1;
+ f6f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ f74:	eb d9                	jmp    f4f <thread_create+0x3f>
+ f76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ f7d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000f80 <thread_join>:
+
+int
+thread_join(void)
+{
+ f80:	55                   	push   %ebp
+ f81:	89 e5                	mov    %esp,%ebp
+ f83:	83 ec 34             	sub    $0x34,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+ f86:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ f89:	50                   	push   %eax
+ f8a:	e8 c9 f7 ff ff       	call   758 <join>
+ f8f:	83 c4 10             	add    $0x10,%esp
+ f92:	85 c0                	test   %eax,%eax
+ f94:	79 0a                	jns    fa0 <thread_join+0x20>
+    free(*(char**)stack);
+  return pid;
+}
+ f96:	c9                   	leave
+ f97:	c3                   	ret
+ f98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ f9f:	90                   	nop
+    free(*(char**)stack);
+ fa0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ fa3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ fa6:	83 ec 0c             	sub    $0xc,%esp
+ fa9:	ff 32                	push   (%edx)
+ fab:	e8 f0 fd ff ff       	call   da0 <free>
+ fb0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ fb3:	83 c4 10             	add    $0x10,%esp
+}
+ fb6:	c9                   	leave
+ fb7:	c3                   	ret
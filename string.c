@@ -41,9 +41,12 @@ memmove(void *dst, const void *src, uint n)
     d += n;
     while(n-- > 0)
       *--d = *--s;
-  } else
-    while(n-- > 0)
-      *d++ = *s++;
+  } else {
+    // Forwards a word at a time, which is safe even when
+    // dst overlaps the start of src.
+    movsl(d, s, n/4);
+    movsb(d + n/4*4, s + n/4*4, n%4);
+  }
 
   return dst;
 }
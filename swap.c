@@ -0,0 +1,445 @@
+// Swapping process memory out to disk.
+//
+// When memory runs out, ualloc() and uzalloc() make room for user
+// memory by writing out a page of some process to the swap area
+// that mkfs leaves after the file system, and reusing its frame.
+// A swapped out page's entry keeps PTE_SWAP and the number of the
+// swap slot holding it in place of the frame; the next access
+// faults, and swapfault() reads it back in. fork() shares swap
+// slots between parent and child, so each counts its references.
+//
+// Pages are chosen by a clock that sweeps each process's private
+// user pages in turn: a page that has been used since the hand
+// last passed it (PTE_A) gets a second chance, one that has not
+// is swapped out. A 4MB page is split when it comes up unused,
+// its last page being swapped out to make room for its page table.
+// Shared memory segments, shared file mappings and program text
+// stay put.
+//
+// The pages of a process are only swapped out under vmlock(),
+// and not while the kernel might use them under a spin lock,
+// where it could not wait for them to come back: checkptr(),
+// which brings in a pipe's or a device's buffer before the
+// copy, pins the buffer's pages with pin() and swaps them in,
+// and the clock passes over them until the system call
+// returns. Only those pages stay put, so a thread asleep in
+// read() on a pipe or the console does not keep the rest of its
+// process in memory. A few pages are kept in reserve for swapping
+// in such a buffer when every other page in use is pinned too.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "proc.h"
+#include "x86.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "buf.h"
+#include "iostat.h"
+#include "mman.h"
+
+#define NRESERVE 16                       // pages kept for pinned processes
+#define SLOTBLOCKS (PGSIZE/BSIZE)         // blocks per swap slot
+#define NSLOT (SWAPSIZE/SLOTBLOCKS)
+
+struct {
+  struct spinlock lock;
+  uint dev;
+  uint start;                 // first block of the swap area
+  uint nslot;                 // pages the swap area holds
+  uint next;                  // slot to look at first for a free one
+  ushort ref[NSLOT];          // page table entries naming each slot
+  char *reserve[NRESERVE];
+  int nreserve;
+  int hand;                   // clock: ptable.vm[hand] is next,
+  uint handva;                // from this address on
+  uint nin, nout;             // pages swapped in and out
+  struct buf buf;             // for disk I/O, under buf.lock
+} swap;
+
+void
+swapinit(int dev)
+{
+  struct superblock sb;
+
+  initlock(&swap.lock, "swap");
+  initsleeplock(&swap.buf.lock, "swapbuf");
+  readsb(dev, &sb);
+  swap.dev = dev;
+  swap.start = sb.swapstart;
+  swap.nslot = sb.nswap / SLOTBLOCKS;
+  if(swap.nslot > NSLOT)
+    swap.nslot = NSLOT;
+}
+
+// Allocate a swap slot. Returns -1 if the swap area is full.
+static int
+slotalloc(void)
+{
+  uint i, s;
+
+  acquire(&swap.lock);
+  for(i = 0; i < swap.nslot; i++){
+    s = (swap.next + i) % swap.nslot;
+    if(swap.ref[s] == 0){
+      swap.ref[s] = 1;
+      swap.next = s + 1;
+      release(&swap.lock);
+      return s;
+    }
+  }
+  release(&swap.lock);
+  return -1;
+}
+
+// Drop a reference to the swap slot that pte names.
+void
+swapfree(pte_t pte)
+{
+  uint s;
+
+  s = PTE_ADDR(pte) >> PTXSHIFT;
+  acquire(&swap.lock);
+  if(s >= swap.nslot || swap.ref[s] == 0)
+    panic("swapfree");
+  swap.ref[s]--;
+  release(&swap.lock);
+}
+
+// Give pgdir a reference to the swapped out page that pte
+// names, at va. Returns -1 if there is no memory for a page
+// table page.
+int
+swapdup(pde_t *pgdir, uint va, pte_t pte)
+{
+  pte_t *npte;
+
+  if((npte = walkpgdir(pgdir, (char*)va, 1)) == 0)
+    return -1;
+  acquire(&swap.lock);
+  swap.ref[PTE_ADDR(pte) >> PTXSHIFT]++;
+  release(&swap.lock);
+  *npte = pte;
+  return 0;
+}
+
+// Write the page at mem to slot s, or read it from there.
+static void
+swaprw(uint s, char *mem, int write)
+{
+  struct buf *b = &swap.buf;
+  uint i;
+
+  acquiresleep(&b->lock);
+  for(i = 0; i < SLOTBLOCKS; i++){
+    b->dev = swap.dev;
+    b->blockno = swap.start + s*SLOTBLOCKS + i;
+    if(write){
+      memmove(b->data, mem + i*BSIZE, BSIZE);
+      b->flags = B_DIRTY;
+    } else {
+      b->flags = 0;
+    }
+    iderw(b);
+    if(!write)
+      memmove(mem + i*BSIZE, b->data, BSIZE);
+  }
+  releasesleep(&b->lock);
+}
+
+// Make every CPU forget vm's old entries; see tlbshoot().
+static void
+flush(struct vm *vm)
+{
+  tlbshoot(vm->pgdir, 0);
+}
+
+// Is the page at va of vm its own, rather than shared?
+static int
+private(struct vm *vm, uint va)
+{
+  struct vma *v;
+
+  for(v = vm->vma; v < &vm->vma[NVMA]; v++)
+    if(v->end && va >= v->start && va < v->end)
+      return v->shm == 0 && v->ip == 0 && !(v->f && (v->flags & MAP_SHARED));
+  return 1;
+}
+
+// Swap out the page that pte maps, and return its frame.
+// The entry changes first, so that threads of vm that
+// touch the page meanwhile fault and wait for vmlock().
+static char*
+swapout(struct vm *vm, pte_t *pte)
+{
+  char *mem;
+  int s;
+
+  if((s = slotalloc()) < 0)
+    return 0;
+  mem = P2V(PTE_ADDR(*pte));
+  *pte = (s << PTXSHIFT) | (*pte & (PTE_W|PTE_U)) | PTE_SWAP;
+  flush(vm);
+  swaprw(s, mem, 1);
+  acquire(&swap.lock);
+  swap.nout++;
+  release(&swap.lock);
+  return mem;
+}
+
+// Turn the 4MB page that pde maps into a page table mapping the
+// same memory in 4096-byte pages, swapping out the last of them
+// to hold the page table. Returns -1 if the swap area is full.
+static int
+split(struct vm *vm, pde_t *pde)
+{
+  pte_t *pgtab;
+  uint pa, flags, i;
+  int s;
+
+  if((s = slotalloc()) < 0)
+    return -1;
+  pa = PTE_ADDR(*pde);
+  flags = PTE_FLAGS(*pde) & (PTE_P|PTE_W|PTE_U);
+  pgtab = (pte_t*)P2V(pa + LPGSIZE - PGSIZE);
+  *pde = 0;
+  flush(vm);
+  swaprw(s, (char*)pgtab, 1);
+  for(i = 0; i < NPTENTRIES - 1; i++)
+    pgtab[i] = (pa + i*PGSIZE) | flags;
+  pgtab[NPTENTRIES - 1] = (s << PTXSHIFT) | (flags & (PTE_W|PTE_U)) | PTE_SWAP;
+  *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
+  acquire(&swap.lock);
+  swap.nout++;
+  release(&swap.lock);
+  return 0;
+}
+
+// Move the clock hand on from vm over its pages, from va on,
+// clearing PTE_A on used ones, and swap out the first unused
+// one. Returns its frame, or 0 if the hand got to the end of
+// vm first. Caller must hold vmlock(vm).
+static char*
+sweep(struct vm *vm, uint va)
+{
+  pde_t *pde;
+  pte_t *pte;
+  char *mem;
+  int used;
+
+  mem = 0;
+  used = 0;
+  for(va = PGROUNDDOWN(va); va < KERNBASE; va += PGSIZE){
+    pde = &vm->pgdir[PDX(va)];
+    if((*pde & PTE_P) == 0){
+      va = PGADDR(PDX(va) + 1, 0, 0) - PGSIZE;
+      continue;
+    }
+    if(*pde & PTE_PS){
+      if((*pde & PTE_U) == 0 || !private(vm, va) || (*pde & PTE_A) ||
+         vmpinned(vm, PGADDR(PDX(va), 0, 0), LPGSIZE)){
+        used |= *pde & PTE_A;
+        *pde &= ~PTE_A;
+        va = PGADDR(PDX(va) + 1, 0, 0) - PGSIZE;
+        continue;
+      }
+      if(split(vm, pde) < 0)
+        break;
+    }
+    pte = walkpgdir(vm->pgdir, (char*)va, 0);
+    if((*pte & (PTE_P|PTE_U)) != (PTE_P|PTE_U) || !private(vm, va))
+      continue;
+    if(*pte & PTE_A){
+      used = 1;
+      *pte &= ~PTE_A;
+      continue;
+    }
+    if(vmpinned(vm, va, PGSIZE))
+      continue;
+    mem = swapout(vm, pte);
+    va += PGSIZE;
+    break;
+  }
+  // The TLB may cache entries with PTE_A set, which
+  // the CPU would not set again when it uses them.
+  if(used)
+    flush(vm);
+
+  acquire(&swap.lock);
+  swap.handva = va;
+  release(&swap.lock);
+  return mem;
+}
+
+// Swap out a page chosen by the clock and return its frame,
+// or 0 if no page can be swapped out.
+static char*
+evict(void)
+{
+  struct vm *vm;
+  char *mem;
+  uint va;
+  int i, n, held;
+
+  if(myproc() == 0 || swap.nslot == 0)
+    return 0;
+  // Two times round: the first may only clear PTE_A bits.
+  mem = 0;
+  for(n = 0; n <= 2*NPROC && mem == 0; n++){
+    acquire(&swap.lock);
+    i = swap.hand;
+    va = swap.handva;
+    release(&swap.lock);
+    if((vm = vmtrylock(i, &held)) != 0){
+      mem = sweep(vm, va);
+      if(!held)
+        vmunlock(vm);
+    }
+    if(mem == 0){
+      acquire(&swap.lock);
+      if(swap.hand == i){
+        swap.hand = (i + 1) % NPROC;
+        swap.handva = 0;
+      }
+      release(&swap.lock);
+    }
+  }
+  return mem;
+}
+
+// Allocate a page for user memory, which may hold anything.
+// If memory has run out, swap out a page to make room, or
+// as a last resort use one kept in reserve.
+// Caller must not hold spin locks, but may hold vmlock().
+char*
+ualloc(void)
+{
+  char *mem;
+
+  if((mem = kalloc()) != 0)
+    return mem;
+  // Refill the reserve while pages can be swapped out.
+  while(swap.nreserve < NRESERVE && (mem = evict()) != 0){
+    acquire(&swap.lock);
+    if(swap.nreserve < NRESERVE){
+      swap.reserve[swap.nreserve++] = mem;
+      mem = 0;
+    }
+    release(&swap.lock);
+    if(mem)
+      return mem;
+  }
+  if((mem = evict()) != 0)
+    return mem;
+  acquire(&swap.lock);
+  if(swap.nreserve > 0)
+    mem = swap.reserve[--swap.nreserve];
+  release(&swap.lock);
+  return mem;
+}
+
+// Allocate a zeroed page for user memory; see ualloc().
+char*
+uzalloc(void)
+{
+  char *mem;
+
+  if((mem = kzalloc()) != 0)
+    return mem;
+  if((mem = ualloc()) != 0)
+    memset(mem, 0, PGSIZE);
+  return mem;
+}
+
+// Read the swapped out page at va of vm back in.
+// Returns -1 if there is no memory for it.
+// Caller must hold vmlock(vm).
+int
+swapin(struct vm *vm, uint va)
+{
+  pte_t *pte;
+  char *mem;
+  uint s;
+
+  if((mem = ualloc()) == 0)
+    return -1;
+  // ualloc() may have swapped out other pages, but
+  // cannot have touched this one's entry.
+  pte = walkpgdir(vm->pgdir, (char*)va, 0);
+  if(pte == 0 || (*pte & PTE_SWAP) == 0)
+    panic("swapin");
+  s = PTE_ADDR(*pte) >> PTXSHIFT;
+  swaprw(s, mem, 0);
+  swapfree(*pte);
+  *pte = V2P(mem) | (*pte & (PTE_W|PTE_U)) | PTE_P;
+  acquire(&swap.lock);
+  swap.nin++;
+  release(&swap.lock);
+  return 0;
+}
+
+// Handle a page fault at va in vm, for a write if write is set,
+// if the page is swapped out, or another thread has just swapped
+// it in or was in the midst of swapping it out. Returns 1 if the
+// access can be tried again, 0 if the fault is for the caller
+// to handle, and -1 if there is no memory to swap the page in.
+int
+swapfault(struct vm *vm, uint va, int write)
+{
+  pte_t *pte;
+  int r;
+
+  if(va >= KERNBASE)
+    return 0;
+  vmlock(vm);
+  r = 0;
+  pte = walkpgdir(vm->pgdir, (char*)va, 0);
+  if(pte && (*pte & PTE_SWAP))
+    r = swapin(vm, va) < 0 ? -1 : 1;
+  else if(pte && (*pte & (PTE_P|PTE_U)) == (PTE_P|PTE_U) &&
+          (!write || (*pte & PTE_W)))
+    r = 1;
+  vmunlock(vm);
+  return r;
+}
+
+// Swap in the pages of vm holding [va, va+n) that are out.
+// Returns -1 if there is no memory for them.
+int
+swapload(struct vm *vm, uint va, uint n)
+{
+  pte_t *pte;
+  uint a, last;
+  int r;
+
+  if(n == 0 || va >= KERNBASE)
+    return 0;
+  a = PGROUNDDOWN(va);
+  last = PGROUNDDOWN(va + n - 1);
+  for(r = 0; r == 0 && a < KERNBASE; a += PGSIZE){
+    pte = walkpgdir(vm->pgdir, (char*)a, 0);
+    if(pte && (*pte & PTE_SWAP)){
+      vmlock(vm);
+      pte = walkpgdir(vm->pgdir, (char*)a, 0);
+      if(pte && (*pte & PTE_SWAP))
+        r = swapin(vm, a);
+      vmunlock(vm);
+    }
+    if(a == last)
+      break;
+  }
+  return r;
+}
+
+// Copy the swapping counters into *st.
+void
+swapstat(struct iostat *st)
+{
+  acquire(&swap.lock);
+  st->swapin = swap.nin;
+  st->swapout = swap.nout;
+  release(&swap.lock);
+}
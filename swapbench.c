@@ -0,0 +1,54 @@
+// Page through more memory than the machine has: grow the heap
+// to twice physical memory, write a word to every page and read
+// each back. Pages that do not fit are written to swap and read
+// in again when touched. Reports throughput for a heap that fits
+// and for one that does not, with the swap traffic for each.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "iostat.h"
+#include "memlayout.h"
+
+#define PGSIZE 4096
+
+void
+run(char *name, uint size)
+{
+  struct iostat s0, s1;
+  char *base;
+  uint i, npage;
+  int t0, t;
+
+  npage = size / PGSIZE;
+  if((base = sbrk(size)) == (char*)-1){
+    printf(2, "swapbench: sbrk %d failed\n", size);
+    exit();
+  }
+  iostat(&s0);
+  t0 = uptime();
+  for(i = 0; i < npage; i++)
+    *(uint*)(base + i*PGSIZE) = i;
+  for(i = 0; i < npage; i++){
+    if(*(uint*)(base + i*PGSIZE) != i){
+      printf(2, "swapbench: page %d lost its contents\n", i);
+      exit();
+    }
+  }
+  t = uptime() - t0;
+  iostat(&s1);
+  sbrk(-size);
+  if(t == 0)
+    t = 1;
+  printf(1, "swapbench: %s: %d pages touched twice in %d ticks (%d pages/tick), "
+         "%d swapped out, %d swapped in\n", name, npage, t, 2*npage / t,
+         s1.swapout - s0.swapout, s1.swapin - s0.swapin);
+}
+
+int
+main(int argc, char *argv[])
+{
+  run("half of memory", PHYSTOP / 2);
+  run("twice memory", 2 * PHYSTOP);
+  exit();
+}
@@ -13,6 +13,11 @@
   | code data heap | invalid address |   stack    |  invalid   | kernel space
   |----------------|-----------------|------------|------------|------
   0                                          0x7ffff000  0x80000000
+
+  Regions mapped by mmap() lie in the invalid addresses between sz and
+  stacksz; their pages are faulted in by vmaload() before use. The
+  stack grows down into them, up to its limit, as it is used; see
+  growstack().
 */
 // User code makes a system call with INT T_SYSCALL.
 // System call number in %eax.
@@ -20,39 +25,62 @@
 // library system call function. The saved user %esp points
 // to a saved program counter, and then the first argument.
 
+// Copy the n bytes at addr in the current process to dst.
+// Almost always its pages are there and copyin() does it;
+// otherwise checkptr() grows the stack or faults in a
+// region or swapped page first.
+int
+fetchbuf(uint addr, void *dst, int n)
+{
+  if(copyin(dst, addr, n) == 0)
+    return 0;
+  if(checkptr(addr, n) < 0)
+    return -1;
+  return copyin(dst, addr, n);
+}
+
+// Copy n bytes from src to addr in the current process,
+// as fetchbuf() does. Fails if the memory is read-only.
+int
+putbuf(uint addr, void *src, int n)
+{
+  if(copyout(addr, src, n) == 0)
+    return 0;
+  if(checkptr(addr, n) < 0)
+    return -1;
+  return copyout(addr, src, n);
+}
+
 // Fetch the int at addr from the current process.
 int
 fetchint(uint addr, int *ip)
 {
-  struct proc *curproc = myproc();
-  if ((addr >= curproc->sz && addr < curproc->stacksz) ||     // sz <-> stacksz
-      (addr + 4 > curproc->sz && addr < curproc->stacksz) ||  // sz-3 <-> sz-1
-      (addr + 4 > KERNBASE - PGSIZE))                           // KERNBASE <-> PGSIZE ++
-    return -1;
-  *ip = *(int*)(addr);
-  return 0;
+  return fetchbuf(addr, ip, 4);
 }
 
-// Fetch the nul-terminated string at addr from the current process.
-// Doesn't actually copy the string - just sets *pp to point at it.
-// Returns length of string, not including nul.
+// Fetch the nul-terminated string at addr from the current
+// process into buf, which holds max bytes. The string is
+// copied a page at a time with copyin(), so that another
+// thread unmapping it meanwhile makes this fail rather than
+// the kernel fault; a page that is not there yet is brought
+// in with checkptr() first.
+// Returns length of string, not including nul, or -1.
 int
-fetchstr(uint addr, char **pp)
+fetchstr(uint addr, char *buf, int max)
 {
-  char *s, *ep;
-  struct proc *curproc = myproc();
+  uint tot, n;
+  char *s;
 
-  if ((addr >= curproc->sz && addr < curproc->stacksz) || (addr >= KERNBASE - PGSIZE))
-    return -1;
-  *pp = (char*)addr;
-
-  if (addr < curproc->sz) // address before sz
-    ep = (char *)curproc->sz;
-  else                    // stack
-    ep = (char *)(KERNBASE - PGSIZE);
-  for(s = *pp; s < ep; s++){
-    if(*s == 0)
-      return s - *pp;
+  for(tot = 0; tot < max; tot += n){
+    n = PGSIZE - (addr + tot) % PGSIZE;
+    if(n > max - tot)
+      n = max - tot;
+    if(copyin(buf + tot, addr + tot, n) < 0 &&
+       (checkptr(addr + tot, 1) < 0 || copyin(buf + tot, addr + tot, n) < 0))
+      return -1;
+    for(s = buf + tot; s < buf + tot + n; s++)
+      if(*s == 0)
+        return s - buf;
   }
   return -1;
 }
@@ -64,37 +92,59 @@ argint(int n, int *ip)
   return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
 }
 
+// Check that the block of memory of size bytes at ptr
+// lies within the process address space, and bring its
+// pages in. For memory that the kernel will use under a
+// spin lock, and for a copy that found it missing.
+int
+checkptr(uint ptr, int size)
+{
+  struct proc *curproc = myproc();
+
+  if (size < 0)
+    return -1;
+  // The kernel may use the block under a spin lock, so keep
+  // its pages in until the system call returns; see swap.c.
+  pin(ptr, size);
+  // A buffer on the stack, below where it has grown to so far.
+  if (ptr >= curproc->vm->sz && ptr < curproc->vm->stacksz && !vmalookup(curproc, ptr))
+    growstack(ptr);
+  if (((ptr >= curproc->vm->sz && ptr < curproc->vm->stacksz) ||
+       (ptr + size > curproc->vm->sz && ptr + size < curproc->vm->stacksz)||
+       (ptr + size > KERNBASE - PGSIZE)) &&
+      vmaload(curproc, ptr, size) < 0)
+    return -1;
+  return swapload(curproc->vm, ptr, size);
+}
+
 // Fetch the nth word-sized system call argument as a pointer
-// to a block of memory of size bytes.  Check that the pointer
-// lies within the process address space.
+// to a block of memory of size bytes.  Check that the block
+// lies in user space, without walking its pages: the kernel
+// uses it through fetchbuf() and putbuf(), or readi() and
+// writei(), which cope with pages that are not there.
 int
 argptr(int n, char **pp, int size)
 {
   uint ptr;
-  struct proc *curproc = myproc();
- 
+
   if(argint(n, (int *)&ptr) < 0)
     return -1;
-  if ((size < 0) ||
-      (ptr >= curproc->sz && ptr < curproc->stacksz) ||
-      (ptr + size > curproc->sz && ptr + size < curproc->stacksz)||
-      (ptr + size > KERNBASE - PGSIZE))
+  if(size < 0 || ptr >= KERNBASE || size > KERNBASE - ptr)
     return -1;
   *pp = (char*)ptr;
   return 0;
 }
 
-// Fetch the nth word-sized system call argument as a string pointer.
-// Check that the pointer is valid and the string is nul-terminated.
-// (There is no shared writable memory, so the string can't change
-// between this check and being used by the kernel.)
+// Fetch the nth word-sized system call argument as a string
+// into buf, which holds max bytes with the nul.
+// Returns length of string, not including nul, or -1.
 int
-argstr(int n, char **pp)
+argstr(int n, char *buf, int max)
 {
   int addr;
   if(argint(n, &addr) < 0)
     return -1;
-  return fetchstr(addr, pp);
+  return fetchstr(addr, buf, max);
 }
 
 extern int sys_chdir(void);
@@ -124,6 +174,25 @@ extern int sys_mtxget(void);
 extern int sys_mtxrel(void);
 extern int sys_mtxacq(void);
 extern int sys_mtxdel(void);
+extern int sys_iostat(void);
+extern int sys_mmap(void);
+extern int sys_munmap(void);
+extern int sys_shmget(void);
+extern int sys_shmat(void);
+extern int sys_shmdt(void);
+extern int sys_shmdel(void);
+extern int sys_syscount(void);
+extern int sys_splice(void);
+extern int sys_tee(void);
+extern int sys_sendfile(void);
+extern int sys_readv(void);
+extern int sys_writev(void);
+extern int sys_futexwait(void);
+extern int sys_futexwake(void);
+extern int sys_lockstat(void);
+extern int sys_clone(void);
+extern int sys_join(void);
+extern int sys_stacklimit(void);
 
 
 static int (*syscalls[])(void) = {
@@ -154,6 +223,25 @@ static int (*syscalls[])(void) = {
 [SYS_mtxrel]  sys_mtxrel,
 [SYS_mtxacq]  sys_mtxacq,
 [SYS_mtxdel]  sys_mtxdel,
+[SYS_iostat]  sys_iostat,
+[SYS_mmap]    sys_mmap,
+[SYS_munmap]  sys_munmap,
+[SYS_shmget]  sys_shmget,
+[SYS_shmat]   sys_shmat,
+[SYS_shmdt]   sys_shmdt,
+[SYS_shmdel]  sys_shmdel,
+[SYS_syscount] sys_syscount,
+[SYS_splice]  sys_splice,
+[SYS_tee]     sys_tee,
+[SYS_sendfile] sys_sendfile,
+[SYS_readv]   sys_readv,
+[SYS_writev]  sys_writev,
+[SYS_futexwait] sys_futexwait,
+[SYS_futexwake] sys_futexwake,
+[SYS_lockstat] sys_lockstat,
+[SYS_clone]   sys_clone,
+[SYS_join]    sys_join,
+[SYS_stacklimit] sys_stacklimit,
 };
 
 void
@@ -163,6 +251,7 @@ syscall(void)
   struct proc *curproc = myproc();
 
   num = curproc->tf->eax;
+  curproc->nsyscall++;
   if(num > 0 && num < NELEM(syscalls) && syscalls[num]) {
     curproc->tf->eax = syscalls[num]();
   } else {
@@ -170,4 +259,6 @@ syscall(void)
             curproc->pid, curproc->name, num);
     curproc->tf->eax = -1;
   }
+  unpin(curproc);
+  fdput(curproc);
 }
@@ -26,3 +26,22 @@
 #define SYS_mtxrel 25
 #define SYS_mtxacq 26
 #define SYS_mtxdel 27
+#define SYS_iostat 28
+#define SYS_mmap   29
+#define SYS_munmap 30
+#define SYS_shmget 31
+#define SYS_shmat  32
+#define SYS_shmdt  33
+#define SYS_shmdel 34
+#define SYS_syscount 35
+#define SYS_splice 36
+#define SYS_tee    37
+#define SYS_sendfile 38
+#define SYS_readv  39
+#define SYS_writev 40
+#define SYS_futexwait 41
+#define SYS_futexwake 42
+#define SYS_lockstat 43
+#define SYS_clone  44
+#define SYS_join   45
+#define SYS_stacklimit 46
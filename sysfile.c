@@ -9,12 +9,16 @@
 #include "param.h"
 #include "stat.h"
 #include "mmu.h"
+#include "memlayout.h"
 #include "proc.h"
 #include "fs.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "file.h"
 #include "fcntl.h"
+#include "mman.h"
+#include "iostat.h"
+#include "uio.h"
 
 // Fetch the nth word-sized system call argument as a file descriptor
 // and return both the descriptor and the corresponding struct file.
@@ -26,7 +30,7 @@ argfd(int n, int *pfd, struct file **pf)
 
   if(argint(n, &fd) < 0)
     return -1;
-  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+  if((f = fdget(fd)) == 0)
     return -1;
   if(pfd)
     *pfd = fd;
@@ -35,23 +39,72 @@ argfd(int n, int *pfd, struct file **pf)
   return 0;
 }
 
+// Check the size bytes at ptr that file f is to be read
+// into or written from. readi() and writei() copy a file's
+// data with copyin() and copyout(), which cope with missing
+// pages, so for a file or directory it is enough that the
+// buffer is in user space. A pipe or a device copies under
+// a spin lock, where it cannot wait for a page to come in,
+// so for those checkptr() brings the pages in first.
+static int
+checkbuf(struct file *f, uint ptr, int size)
+{
+  if(size < 0 || ptr >= KERNBASE || size > KERNBASE - ptr)
+    return -1;
+  if(f->type != FD_INODE || f->ip->type == T_DEV)
+    return checkptr(ptr, size);
+  return 0;
+}
+
+// Fetch the nth word-sized system call argument as a pointer
+// to size bytes that file f is read into or written from.
+static int
+argbuf(int n, char **pp, int size, struct file *f)
+{
+  uint ptr;
+
+  if(argint(n, (int*)&ptr) < 0 || checkbuf(f, ptr, size) < 0)
+    return -1;
+  *pp = (char*)ptr;
+  return 0;
+}
+
 // Allocate a file descriptor for the given file.
 // Takes over file reference from caller on success.
 static int
 fdalloc(struct file *f)
 {
   int fd;
-  struct proc *curproc = myproc();
+  struct files *fs = myproc()->files;
 
+  acquire(&fs->lock);
   for(fd = 0; fd < NOFILE; fd++){
-    if(curproc->ofile[fd] == 0){
-      curproc->ofile[fd] = f;
+    if(fs->ofile[fd] == 0){
+      fs->ofile[fd] = f;
+      release(&fs->lock);
       return fd;
     }
   }
+  release(&fs->lock);
   return -1;
 }
 
+// Remove fd from the file table and return its file,
+// whose reference passes to the caller, or 0 if another
+// thread closed it first.
+static struct file*
+fdfree(int fd)
+{
+  struct files *fs = myproc()->files;
+  struct file *f;
+
+  acquire(&fs->lock);
+  f = fs->ofile[fd];
+  fs->ofile[fd] = 0;
+  release(&fs->lock);
+  return f;
+}
+
 int
 sys_dup(void)
 {
@@ -73,7 +126,7 @@ sys_read(void)
   int n;
   char *p;
 
-  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argbuf(1, &p, n, f) < 0)
     return -1;
   return fileread(f, p, n);
 }
@@ -85,20 +138,66 @@ sys_write(void)
   int n;
   char *p;
 
-  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argbuf(1, &p, n, f) < 0)
     return -1;
   return filewrite(f, p, n);
 }
 
+// Fetch the array of cnt buffers that is the nth system call
+// argument into iov, checking each as argbuf() does.
+static int
+argiov(int n, int cnt, struct iovec *iov, struct file *f)
+{
+  uint uiov, tot;
+  int k;
+
+  if(cnt < 0 || cnt > IOV_MAX)
+    return -1;
+  if(argint(n, (int*)&uiov) < 0 || fetchbuf(uiov, iov, cnt*sizeof(iov[0])) < 0)
+    return -1;
+  tot = 0;
+  for(k = 0; k < cnt; k++){
+    if(iov[k].iov_len > 0x7fffffff - tot)
+      return -1;
+    tot += iov[k].iov_len;
+    if(checkbuf(f, (uint)iov[k].iov_base, iov[k].iov_len) < 0)
+      return -1;
+  }
+  return 0;
+}
+
+int
+sys_readv(void)
+{
+  struct file *f;
+  struct iovec iov[IOV_MAX];
+  int cnt;
+
+  if(argfd(0, 0, &f) < 0 || argint(2, &cnt) < 0 || argiov(1, cnt, iov, f) < 0)
+    return -1;
+  return filereadv(f, iov, cnt);
+}
+
+int
+sys_writev(void)
+{
+  struct file *f;
+  struct iovec iov[IOV_MAX];
+  int cnt;
+
+  if(argfd(0, 0, &f) < 0 || argint(2, &cnt) < 0 || argiov(1, cnt, iov, f) < 0)
+    return -1;
+  return filewritev(f, iov, cnt);
+}
+
 int
 sys_close(void)
 {
   int fd;
   struct file *f;
 
-  if(argfd(0, &fd, &f) < 0)
+  if(argfd(0, &fd, &f) < 0 || (f = fdfree(fd)) == 0)
     return -1;
-  myproc()->ofile[fd] = 0;
   fileclose(f);
   return 0;
 }
@@ -107,21 +206,24 @@ int
 sys_fstat(void)
 {
   struct file *f;
-  struct stat *st;
+  struct stat st;
+  char *p;
 
-  if(argfd(0, 0, &f) < 0 || argptr(1, (void*)&st, sizeof(*st)) < 0)
+  if(argfd(0, 0, &f) < 0 || argptr(1, &p, sizeof(st)) < 0)
+    return -1;
+  if(filestat(f, &st) < 0)
     return -1;
-  return filestat(f, st);
+  return putbuf((uint)p, &st, sizeof(st));
 }
 
 // Create the path new as a link to the same inode as old.
 int
 sys_link(void)
 {
-  char name[DIRSIZ], *new, *old;
+  char name[DIRSIZ], new[MAXPATH], old[MAXPATH];
   struct inode *dp, *ip;
 
-  if(argstr(0, &old) < 0 || argstr(1, &new) < 0)
+  if(argstr(0, old, MAXPATH) < 0 || argstr(1, new, MAXPATH) < 0)
     return -1;
 
   begin_op();
@@ -186,10 +288,10 @@ sys_unlink(void)
 {
   struct inode *ip, *dp;
   struct dirent de;
-  char name[DIRSIZ], *path;
+  char name[DIRSIZ], path[MAXPATH];
   uint off;
 
-  if(argstr(0, &path) < 0)
+  if(argstr(0, path, MAXPATH) < 0)
     return -1;
 
   begin_op();
@@ -257,7 +359,7 @@ create(char *path, short type, short major, short minor)
     return 0;
   }
 
-  if((ip = ialloc(dp->dev, type)) == 0)
+  if((ip = ialloc(dp->dev, type, dp->inum)) == 0)
     panic("create: ialloc");
 
   ilock(ip);
@@ -285,12 +387,12 @@ create(char *path, short type, short major, short minor)
 int
 sys_open(void)
 {
-  char *path;
+  char path[MAXPATH];
   int fd, omode;
   struct file *f;
   struct inode *ip;
 
-  if(argstr(0, &path) < 0 || argint(1, &omode) < 0)
+  if(argstr(0, path, MAXPATH) < 0 || argint(1, &omode) < 0)
     return -1;
 
   begin_op();
@@ -335,11 +437,13 @@ sys_open(void)
 int
 sys_mkdir(void)
 {
-  char *path;
+  char path[MAXPATH];
   struct inode *ip;
 
+  if(argstr(0, path, MAXPATH) < 0)
+    return -1;
   begin_op();
-  if(argstr(0, &path) < 0 || (ip = create(path, T_DIR, 0, 0)) == 0){
+  if((ip = create(path, T_DIR, 0, 0)) == 0){
     end_op();
     return -1;
   }
@@ -352,14 +456,15 @@ int
 sys_mknod(void)
 {
   struct inode *ip;
-  char *path;
+  char path[MAXPATH];
   int major, minor;
 
-  begin_op();
-  if((argstr(0, &path)) < 0 ||
+  if(argstr(0, path, MAXPATH) < 0 ||
      argint(1, &major) < 0 ||
-     argint(2, &minor) < 0 ||
-     (ip = create(path, T_DEV, major, minor)) == 0){
+     argint(2, &minor) < 0)
+    return -1;
+  begin_op();
+  if((ip = create(path, T_DEV, major, minor)) == 0){
     end_op();
     return -1;
   }
@@ -371,12 +476,14 @@ sys_mknod(void)
 int
 sys_chdir(void)
 {
-  char *path;
-  struct inode *ip;
-  struct proc *curproc = myproc();
+  char path[MAXPATH];
+  struct inode *ip, *old;
+  struct files *fs = myproc()->files;
   
+  if(argstr(0, path, MAXPATH) < 0)
+    return -1;
   begin_op();
-  if(argstr(0, &path) < 0 || (ip = namei(path)) == 0){
+  if((ip = namei(path)) == 0){
     end_op();
     return -1;
   }
@@ -387,58 +494,156 @@ sys_chdir(void)
     return -1;
   }
   iunlock(ip);
-  iput(curproc->cwd);
+  acquire(&fs->lock);
+  old = fs->cwd;
+  fs->cwd = ip;
+  release(&fs->lock);
+  iput(old);
   end_op();
-  curproc->cwd = ip;
   return 0;
 }
 
 int
 sys_exec(void)
 {
-  char *path, *argv[MAXARG];
-  int i;
-  uint uargv, uarg;
+  char path[MAXPATH], *argv[MAXARG], *strs;
+  int i, n, r;
+  uint uargv, uarg, off;
 
-  if(argstr(0, &path) < 0 || argint(1, (int*)&uargv) < 0){
+  if(argstr(0, path, MAXPATH) < 0 || argint(1, (int*)&uargv) < 0){
     return -1;
   }
+  // The argument strings are copied into one page, as
+  // they must fit on the new program's one-page stack.
+  if((strs = kalloc()) == 0)
+    return -1;
+  r = -1;
+  off = 0;
   memset(argv, 0, sizeof(argv));
   for(i=0;; i++){
     if(i >= NELEM(argv))
-      return -1;
+      goto out;
     if(fetchint(uargv+4*i, (int*)&uarg) < 0)
-      return -1;
+      goto out;
     if(uarg == 0){
       argv[i] = 0;
       break;
     }
-    if(fetchstr(uarg, &argv[i]) < 0)
-      return -1;
+    if((n = fetchstr(uarg, strs + off, PGSIZE - off)) < 0)
+      goto out;
+    argv[i] = strs + off;
+    off += n + 1;
   }
-  return exec(path, argv);
+  r = exec(path, argv);
+
+out:
+  kfree(strs);
+  return r;
 }
 
 int
 sys_pipe(void)
 {
-  int *fd;
+  char *p;
   struct file *rf, *wf;
-  int fd0, fd1;
+  int fd[2];
 
-  if(argptr(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
+  if(argptr(0, &p, sizeof(fd)) < 0)
     return -1;
   if(pipealloc(&rf, &wf) < 0)
     return -1;
-  fd0 = -1;
-  if((fd0 = fdalloc(rf)) < 0 || (fd1 = fdalloc(wf)) < 0){
-    if(fd0 >= 0)
-      myproc()->ofile[fd0] = 0;
-    fileclose(rf);
-    fileclose(wf);
+  fd[0] = fd[1] = -1;
+  if((fd[0] = fdalloc(rf)) < 0 || (fd[1] = fdalloc(wf)) < 0 ||
+     putbuf((uint)p, fd, sizeof(fd)) < 0){
+    // Undo as close() would: another thread may have
+    // closed the descriptors already.
+    if(fd[0] < 0)
+      fileclose(rf);
+    else if((rf = fdfree(fd[0])) != 0)
+      fileclose(rf);
+    if(fd[1] < 0)
+      fileclose(wf);
+    else if((wf = fdfree(fd[1])) != 0)
+      fileclose(wf);
     return -1;
   }
-  fd[0] = fd0;
-  fd[1] = fd1;
   return 0;
 }
+
+int
+sys_iostat(void)
+{
+  struct iostat st;
+  char *p;
+
+  if(argptr(0, &p, sizeof(st)) < 0)
+    return -1;
+  ideiostat(&st);
+  pcstat(&st);
+  swapstat(&st);
+  kmemstat(&st);
+  st.pgfault = npgfault;
+  return putbuf((uint)p, &st, sizeof(st));
+}
+
+int
+sys_splice(void)
+{
+  struct file *in, *out;
+  int n;
+
+  if(argfd(0, 0, &in) < 0 || argfd(1, 0, &out) < 0 || argint(2, &n) < 0)
+    return -1;
+  return filesplice(in, out, n);
+}
+
+int
+sys_tee(void)
+{
+  struct file *in, *out;
+  int n;
+
+  if(argfd(0, 0, &in) < 0 || argfd(1, 0, &out) < 0 || argint(2, &n) < 0)
+    return -1;
+  return filetee(in, out, n);
+}
+
+int
+sys_sendfile(void)
+{
+  struct file *in, *out;
+  int n;
+
+  if(argfd(0, 0, &out) < 0 || argfd(1, 0, &in) < 0 || argint(2, &n) < 0)
+    return -1;
+  return filecopy(in, out, n);
+}
+
+int
+sys_mmap(void)
+{
+  int len, prot, flags, fd, off;
+  struct file *f;
+
+  if(argint(1, &len) < 0 || argint(2, &prot) < 0 || argint(3, &flags) < 0 ||
+     argint(4, &fd) < 0 || argint(5, &off) < 0)
+    return -1;
+  if(len <= 0 || off < 0)
+    return -1;
+  f = 0;
+  if(!(flags & MAP_ANON) && argfd(4, 0, &f) < 0)
+    return -1;
+  return vmamap(myproc(), f, len, prot, flags, off);
+}
+
+int
+sys_munmap(void)
+{
+  int addr, len;
+
+  if(argint(0, &addr) < 0 || argint(1, &len) < 0)
+    return -1;
+  if(len <= 0)
+    return -1;
+  return vmaunmap(myproc(), addr, len);
+}
@@ -6,6 +6,7 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "proc.h"
+#include "lockstat.h"
 
 int
 sys_fork(void)
@@ -26,6 +27,33 @@ sys_wait(void)
   return wait();
 }
 
+int
+sys_clone(void)
+{
+  int fcn, arg1, arg2, stack;
+
+  if(argint(0, &fcn) < 0 || argint(1, &arg1) < 0 ||
+     argint(2, &arg2) < 0 || argint(3, &stack) < 0)
+    return -1;
+  return clone(fcn, arg1, arg2, stack);
+}
+
+int
+sys_join(void)
+{
+  uint stack;
+  char *p;
+  int pid;
+
+  if(argptr(0, &p, sizeof(stack)) < 0)
+    return -1;
+  if((pid = join(&stack)) < 0)
+    return -1;
+  if(putbuf((uint)p, &stack, sizeof(stack)) < 0)
+    return -1;
+  return pid;
+}
+
 int
 sys_kill(void)
 {
@@ -50,12 +78,23 @@ sys_sbrk(void)
 
   if(argint(0, &n) < 0)
     return -1;
-  addr = myproc()->sz;
-  if(growproc(n) < 0)
+  if((addr = growproc(n)) < 0)
     return -1;
   return addr;
 }
 
+// Set the stack's size limit and how far it grows past a
+// fault; see stacklimit().
+int
+sys_stacklimit(void)
+{
+  int max, ahead;
+
+  if(argint(0, &max) < 0 || argint(1, &ahead) < 0)
+    return -1;
+  return stacklimit(max, ahead);
+}
+
 int
 sys_sleep(void)
 {
@@ -137,3 +176,94 @@ sys_mtxdel(void)
   }
   return mtxdel(n);
 }
+
+int
+sys_futexwait(void)
+{
+  int addr, val;
+
+  if(argint(0, &addr) < 0 || argint(1, &val) < 0)
+    return -1;
+  return futexwait(addr, val);
+}
+
+int
+sys_futexwake(void)
+{
+  int addr, n;
+
+  if(argint(0, &addr) < 0 || argint(1, &n) < 0)
+    return -1;
+  return futexwake(addr, n);
+}
+
+int
+sys_shmget(void)
+{
+  int key, size;
+
+  if(argint(0, &key) < 0 || argint(1, &size) < 0 || size <= 0)
+    return -1;
+  return shmget(key, size);
+}
+
+int
+sys_shmat(void)
+{
+  int id;
+
+  if(argint(0, &id) < 0)
+    return -1;
+  return shmat(id);
+}
+
+int
+sys_shmdt(void)
+{
+  int addr;
+
+  if(argint(0, &addr) < 0)
+    return -1;
+  return shmdt(addr);
+}
+
+int
+sys_shmdel(void)
+{
+  int id;
+
+  if(argint(0, &id) < 0)
+    return -1;
+  return shmdel(id);
+}
+
+// Return the number of system calls the process has made,
+// including this one.
+int
+sys_syscount(void)
+{
+  return myproc()->nsyscall;
+}
+
+// Copy the spin lock contention counters of up to n
+// lock names to the array st. Returns the number copied.
+int
+sys_lockstat(void)
+{
+  struct lockstat st;
+  char *p;
+  int n, k;
+
+  if(argint(1, &n) < 0 || n < 0)
+    return -1;
+  // No more than there are lock names, so n*sizeof(st)
+  // cannot overflow.
+  if(n > NLOCKCLASS)
+    n = NLOCKCLASS;
+  if(argptr(0, &p, n*sizeof(st)) < 0)
+    return -1;
+  for(k = 0; k < n && lockstat(k, &st) == 0; k++)
+    if(putbuf((uint)p + k*sizeof(st), &st, sizeof(st)) < 0)
+      return -1;
+  return k;
+}
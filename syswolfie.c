@@ -24,6 +24,9 @@ int sys_wolfie(void)
     {
         return -1;
     }
-    strncpy(buf, wolfie_data, wolfie_len);
+    if (putbuf((uint)buf, (void*)wolfie_data, wolfie_len) < 0)
+    {
+        return -1;
+    }
     return wolfie_len;
 }
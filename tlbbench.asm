@@ -0,0 +1,2372 @@
+
+_tlbbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <walk>:
+#define STEP    (1024*1024)
+#define NACCESS (4*1024*1024)
+
+uint
+walk(int *a)
+{
+       0:	55                   	push   %ebp
+       1:	b9 00 00 40 00       	mov    $0x400000,%ecx
+  uint x, s;
+  int i;
+
+  x = 1;
+       6:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+  s = 0;
+       f:	31 f6                	xor    %esi,%esi
+{
+      11:	53                   	push   %ebx
+      12:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; i < NACCESS; i++){
+    x = x * 1103515245 + 12345;
+      18:	69 d2 6d 4e c6 41    	imul   $0x41c64e6d,%edx,%edx
+      1e:	81 c2 39 30 00 00    	add    $0x3039,%edx
+    s += a[(x >> 8) % (SIZE / sizeof(int))]++;
+      24:	89 d0                	mov    %edx,%eax
+      26:	c1 e8 06             	shr    $0x6,%eax
+      29:	25 fc ff ff 01       	and    $0x1fffffc,%eax
+      2e:	03 45 08             	add    0x8(%ebp),%eax
+      31:	8b 18                	mov    (%eax),%ebx
+      33:	8d 7b 01             	lea    0x1(%ebx),%edi
+      36:	01 de                	add    %ebx,%esi
+      38:	89 38                	mov    %edi,(%eax)
+  for(i = 0; i < NACCESS; i++){
+      3a:	83 e9 01             	sub    $0x1,%ecx
+      3d:	75 d9                	jne    18 <walk+0x18>
+  }
+  return s;
+}
+      3f:	5b                   	pop    %ebx
+      40:	89 f0                	mov    %esi,%eax
+      42:	5e                   	pop    %esi
+      43:	5f                   	pop    %edi
+      44:	5d                   	pop    %ebp
+      45:	c3                   	ret
+      46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      4d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000050 <run>:
+
+void
+run(char *name, int large)
+{
+      50:	55                   	push   %ebp
+      51:	89 e5                	mov    %esp,%ebp
+      53:	57                   	push   %edi
+      54:	56                   	push   %esi
+      55:	53                   	push   %ebx
+      56:	83 ec 28             	sub    $0x28,%esp
+      59:	8b 45 08             	mov    0x8(%ebp),%eax
+      5c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+      5f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  char *oldbrk, *a;
+  int i, t0, tsbrk, tfork, twalk;
+
+  oldbrk = sbrk(0);
+      62:	6a 00                	push   $0x0
+      64:	e8 ef 06 00 00       	call   758 <sbrk>
+  if((uint)oldbrk % LPG != 0)
+      69:	83 c4 10             	add    $0x10,%esp
+  oldbrk = sbrk(0);
+      6c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if((uint)oldbrk % LPG != 0)
+      6f:	25 ff ff 3f 00       	and    $0x3fffff,%eax
+      74:	0f 85 16 01 00 00    	jne    190 <run+0x140>
+    sbrk(LPG - (uint)oldbrk % LPG);
+
+  t0 = uptime();
+      7a:	e8 e9 06 00 00       	call   768 <uptime>
+      7f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if(large){
+      82:	85 db                	test   %ebx,%ebx
+      84:	0f 84 cd 00 00 00    	je     157 <run+0x107>
+    a = sbrk(SIZE);
+      8a:	83 ec 0c             	sub    $0xc,%esp
+      8d:	68 00 00 00 02       	push   $0x2000000
+      92:	e8 c1 06 00 00       	call   758 <sbrk>
+      97:	83 c4 10             	add    $0x10,%esp
+      9a:	89 c7                	mov    %eax,%edi
+    a = sbrk(0);
+    for(i = 0; i < SIZE; i += STEP)
+      if(sbrk(STEP) == (char*)-1)
+        a = (char*)-1;
+  }
+  tsbrk = uptime() - t0;
+      9c:	e8 c7 06 00 00       	call   768 <uptime>
+      a1:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+      a4:	29 c8                	sub    %ecx,%eax
+      a6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if(a == (char*)-1){
+      a9:	83 ff ff             	cmp    $0xffffffff,%edi
+      ac:	0f 84 fb 00 00 00    	je     1ad <run+0x15d>
+    printf(1, "tlbbench: sbrk failed\n");
+    exit();
+  }
+
+  t0 = uptime();
+      b2:	e8 b1 06 00 00       	call   768 <uptime>
+      b7:	89 c3                	mov    %eax,%ebx
+  if(fork() == 0)
+      b9:	e8 d2 03 00 00       	call   490 <fork>
+      be:	85 c0                	test   %eax,%eax
+      c0:	0f 84 e2 00 00 00    	je     1a8 <run+0x158>
+    exit();
+  wait();
+      c6:	e8 0d 06 00 00       	call   6d8 <wait>
+  tfork = uptime() - t0;
+
+  t0 = uptime();
+      cb:	be 00 00 40 00       	mov    $0x400000,%esi
+  tfork = uptime() - t0;
+      d0:	e8 93 06 00 00       	call   768 <uptime>
+      d5:	29 d8                	sub    %ebx,%eax
+      d7:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  t0 = uptime();
+      da:	e8 89 06 00 00       	call   768 <uptime>
+      df:	89 c3                	mov    %eax,%ebx
+  x = 1;
+      e1:	b8 01 00 00 00       	mov    $0x1,%eax
+      e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      ed:	8d 76 00             	lea    0x0(%esi),%esi
+    x = x * 1103515245 + 12345;
+      f0:	69 c0 6d 4e c6 41    	imul   $0x41c64e6d,%eax,%eax
+      f6:	05 39 30 00 00       	add    $0x3039,%eax
+    s += a[(x >> 8) % (SIZE / sizeof(int))]++;
+      fb:	89 c2                	mov    %eax,%edx
+      fd:	c1 ea 06             	shr    $0x6,%edx
+     100:	81 e2 fc ff ff 01    	and    $0x1fffffc,%edx
+     106:	83 04 17 01          	addl   $0x1,(%edi,%edx,1)
+  for(i = 0; i < NACCESS; i++){
+     10a:	83 ee 01             	sub    $0x1,%esi
+     10d:	75 e1                	jne    f0 <run+0xa0>
+  walk((int*)a);
+  twalk = uptime() - t0;
+     10f:	e8 54 06 00 00       	call   768 <uptime>
+
+  printf(1, "tlbbench: %s: sbrk %d ticks, fork %d ticks, %d random accesses %d ticks\n",
+     114:	83 ec 04             	sub    $0x4,%esp
+  twalk = uptime() - t0;
+     117:	29 d8                	sub    %ebx,%eax
+  printf(1, "tlbbench: %s: sbrk %d ticks, fork %d ticks, %d random accesses %d ticks\n",
+     119:	50                   	push   %eax
+     11a:	68 00 00 40 00       	push   $0x400000
+     11f:	ff 75 dc             	push   -0x24(%ebp)
+     122:	ff 75 e0             	push   -0x20(%ebp)
+     125:	ff 75 d8             	push   -0x28(%ebp)
+     128:	68 b4 10 00 00       	push   $0x10b4
+     12d:	6a 01                	push   $0x1
+     12f:	e8 1c 0b 00 00       	call   c50 <printf>
+         name, tsbrk, tfork, NACCESS, twalk);
+  sbrk(oldbrk - sbrk(0));
+     134:	83 c4 14             	add    $0x14,%esp
+     137:	6a 00                	push   $0x0
+     139:	e8 1a 06 00 00       	call   758 <sbrk>
+     13e:	83 c4 10             	add    $0x10,%esp
+     141:	89 c2                	mov    %eax,%edx
+     143:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     146:	29 d0                	sub    %edx,%eax
+     148:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+     14b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     14e:	5b                   	pop    %ebx
+     14f:	5e                   	pop    %esi
+     150:	5f                   	pop    %edi
+     151:	5d                   	pop    %ebp
+  sbrk(oldbrk - sbrk(0));
+     152:	e9 01 06 00 00       	jmp    758 <sbrk>
+    a = sbrk(0);
+     157:	83 ec 0c             	sub    $0xc,%esp
+     15a:	bb 20 00 00 00       	mov    $0x20,%ebx
+        a = (char*)-1;
+     15f:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    a = sbrk(0);
+     164:	6a 00                	push   $0x0
+     166:	e8 ed 05 00 00       	call   758 <sbrk>
+     16b:	83 c4 10             	add    $0x10,%esp
+     16e:	89 c7                	mov    %eax,%edi
+      if(sbrk(STEP) == (char*)-1)
+     170:	83 ec 0c             	sub    $0xc,%esp
+     173:	68 00 00 10 00       	push   $0x100000
+     178:	e8 db 05 00 00       	call   758 <sbrk>
+     17d:	83 c4 10             	add    $0x10,%esp
+        a = (char*)-1;
+     180:	83 f8 ff             	cmp    $0xffffffff,%eax
+     183:	0f 44 fe             	cmove  %esi,%edi
+    for(i = 0; i < SIZE; i += STEP)
+     186:	83 eb 01             	sub    $0x1,%ebx
+     189:	75 e5                	jne    170 <run+0x120>
+     18b:	e9 0c ff ff ff       	jmp    9c <run+0x4c>
+    sbrk(LPG - (uint)oldbrk % LPG);
+     190:	ba 00 00 40 00       	mov    $0x400000,%edx
+     195:	83 ec 0c             	sub    $0xc,%esp
+     198:	29 c2                	sub    %eax,%edx
+     19a:	52                   	push   %edx
+     19b:	e8 b8 05 00 00       	call   758 <sbrk>
+     1a0:	83 c4 10             	add    $0x10,%esp
+     1a3:	e9 d2 fe ff ff       	jmp    7a <run+0x2a>
+    exit();
+     1a8:	e8 13 03 00 00       	call   4c0 <exit>
+    printf(1, "tlbbench: sbrk failed\n");
+     1ad:	50                   	push   %eax
+     1ae:	50                   	push   %eax
+     1af:	68 88 10 00 00       	push   $0x1088
+     1b4:	6a 01                	push   $0x1
+     1b6:	e8 95 0a 00 00       	call   c50 <printf>
+    exit();
+     1bb:	e8 00 03 00 00       	call   4c0 <exit>
+
+000001c0 <main>:
+
+int
+main(int argc, char *argv[])
+{
+     1c0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     1c4:	83 e4 f0             	and    $0xfffffff0,%esp
+     1c7:	ff 71 fc             	push   -0x4(%ecx)
+     1ca:	55                   	push   %ebp
+     1cb:	89 e5                	mov    %esp,%ebp
+     1cd:	51                   	push   %ecx
+     1ce:	83 ec 0c             	sub    $0xc,%esp
+  run("4MB pages", 1);
+     1d1:	6a 01                	push   $0x1
+     1d3:	68 9f 10 00 00       	push   $0x109f
+     1d8:	e8 73 fe ff ff       	call   50 <run>
+  run("4KB pages", 0);
+     1dd:	58                   	pop    %eax
+     1de:	5a                   	pop    %edx
+     1df:	6a 00                	push   $0x0
+     1e1:	68 a9 10 00 00       	push   $0x10a9
+     1e6:	e8 65 fe ff ff       	call   50 <run>
+  exit();
+     1eb:	e8 d0 02 00 00       	call   4c0 <exit>
+
+000001f0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     1f0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     1f1:	31 c0                	xor    %eax,%eax
+{
+     1f3:	89 e5                	mov    %esp,%ebp
+     1f5:	53                   	push   %ebx
+     1f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     1f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     1fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     200:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     204:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     207:	83 c0 01             	add    $0x1,%eax
+     20a:	84 d2                	test   %dl,%dl
+     20c:	75 f2                	jne    200 <strcpy+0x10>
+    ;
+  return os;
+}
+     20e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     211:	89 c8                	mov    %ecx,%eax
+     213:	c9                   	leave
+     214:	c3                   	ret
+     215:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     21c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000220 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     220:	55                   	push   %ebp
+     221:	89 e5                	mov    %esp,%ebp
+     223:	53                   	push   %ebx
+     224:	8b 55 08             	mov    0x8(%ebp),%edx
+     227:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     22a:	0f b6 02             	movzbl (%edx),%eax
+     22d:	84 c0                	test   %al,%al
+     22f:	75 17                	jne    248 <strcmp+0x28>
+     231:	eb 3a                	jmp    26d <strcmp+0x4d>
+     233:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     237:	90                   	nop
+     238:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     23c:	83 c2 01             	add    $0x1,%edx
+     23f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     242:	84 c0                	test   %al,%al
+     244:	74 1a                	je     260 <strcmp+0x40>
+    p++, q++;
+     246:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     248:	0f b6 19             	movzbl (%ecx),%ebx
+     24b:	38 c3                	cmp    %al,%bl
+     24d:	74 e9                	je     238 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     24f:	29 d8                	sub    %ebx,%eax
+}
+     251:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     254:	c9                   	leave
+     255:	c3                   	ret
+     256:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     25d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     260:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     264:	31 c0                	xor    %eax,%eax
+     266:	29 d8                	sub    %ebx,%eax
+}
+     268:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     26b:	c9                   	leave
+     26c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     26d:	0f b6 19             	movzbl (%ecx),%ebx
+     270:	31 c0                	xor    %eax,%eax
+     272:	eb db                	jmp    24f <strcmp+0x2f>
+     274:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     27b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     27f:	90                   	nop
+
+00000280 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     280:	55                   	push   %ebp
+     281:	89 e5                	mov    %esp,%ebp
+     283:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     286:	80 3a 00             	cmpb   $0x0,(%edx)
+     289:	74 15                	je     2a0 <strlen+0x20>
+     28b:	31 c0                	xor    %eax,%eax
+     28d:	8d 76 00             	lea    0x0(%esi),%esi
+     290:	83 c0 01             	add    $0x1,%eax
+     293:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     297:	89 c1                	mov    %eax,%ecx
+     299:	75 f5                	jne    290 <strlen+0x10>
+    ;
+  return n;
+}
+     29b:	89 c8                	mov    %ecx,%eax
+     29d:	5d                   	pop    %ebp
+     29e:	c3                   	ret
+     29f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     2a0:	31 c9                	xor    %ecx,%ecx
+}
+     2a2:	5d                   	pop    %ebp
+     2a3:	89 c8                	mov    %ecx,%eax
+     2a5:	c3                   	ret
+     2a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002b0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     2b0:	55                   	push   %ebp
+     2b1:	89 e5                	mov    %esp,%ebp
+     2b3:	57                   	push   %edi
+     2b4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     2b7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     2ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+     2bd:	89 d7                	mov    %edx,%edi
+     2bf:	fc                   	cld
+     2c0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     2c2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     2c5:	89 d0                	mov    %edx,%eax
+     2c7:	c9                   	leave
+     2c8:	c3                   	ret
+     2c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002d0 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     2d0:	55                   	push   %ebp
+     2d1:	89 e5                	mov    %esp,%ebp
+     2d3:	56                   	push   %esi
+     2d4:	53                   	push   %ebx
+     2d5:	8b 75 10             	mov    0x10(%ebp),%esi
+     2d8:	8b 55 08             	mov    0x8(%ebp),%edx
+     2db:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+     2de:	85 f6                	test   %esi,%esi
+     2e0:	74 2e                	je     310 <memcmp+0x40>
+     2e2:	01 c6                	add    %eax,%esi
+     2e4:	eb 14                	jmp    2fa <memcmp+0x2a>
+     2e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2ed:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+     2f0:	83 c0 01             	add    $0x1,%eax
+     2f3:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+     2f6:	39 f0                	cmp    %esi,%eax
+     2f8:	74 16                	je     310 <memcmp+0x40>
+    if(*s1 != *s2)
+     2fa:	0f b6 0a             	movzbl (%edx),%ecx
+     2fd:	0f b6 18             	movzbl (%eax),%ebx
+     300:	38 d9                	cmp    %bl,%cl
+     302:	74 ec                	je     2f0 <memcmp+0x20>
+      return *s1 - *s2;
+     304:	0f b6 c1             	movzbl %cl,%eax
+     307:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+     309:	5b                   	pop    %ebx
+     30a:	5e                   	pop    %esi
+     30b:	5d                   	pop    %ebp
+     30c:	c3                   	ret
+     30d:	8d 76 00             	lea    0x0(%esi),%esi
+     310:	5b                   	pop    %ebx
+  return 0;
+     311:	31 c0                	xor    %eax,%eax
+}
+     313:	5e                   	pop    %esi
+     314:	5d                   	pop    %ebp
+     315:	c3                   	ret
+     316:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     31d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000320 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     320:	55                   	push   %ebp
+     321:	89 e5                	mov    %esp,%ebp
+     323:	8b 45 08             	mov    0x8(%ebp),%eax
+     326:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     32a:	0f b6 10             	movzbl (%eax),%edx
+     32d:	84 d2                	test   %dl,%dl
+     32f:	75 12                	jne    343 <strchr+0x23>
+     331:	eb 1d                	jmp    350 <strchr+0x30>
+     333:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     337:	90                   	nop
+     338:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     33c:	83 c0 01             	add    $0x1,%eax
+     33f:	84 d2                	test   %dl,%dl
+     341:	74 0d                	je     350 <strchr+0x30>
+    if(*s == c)
+     343:	38 d1                	cmp    %dl,%cl
+     345:	75 f1                	jne    338 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     347:	5d                   	pop    %ebp
+     348:	c3                   	ret
+     349:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     350:	31 c0                	xor    %eax,%eax
+}
+     352:	5d                   	pop    %ebp
+     353:	c3                   	ret
+     354:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     35b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     35f:	90                   	nop
+
+00000360 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     360:	55                   	push   %ebp
+     361:	89 e5                	mov    %esp,%ebp
+     363:	57                   	push   %edi
+     364:	56                   	push   %esi
+int
+read(int fd, void *buf, int n)
+{
+  if(flushhook)
+    flushhook();
+  return _read(fd, buf, n);
+     365:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     368:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     369:	31 db                	xor    %ebx,%ebx
+{
+     36b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     36e:	eb 32                	jmp    3a2 <gets+0x42>
+  if(flushhook)
+     370:	a1 10 22 00 00       	mov    0x2210,%eax
+     375:	85 c0                	test   %eax,%eax
+     377:	74 02                	je     37b <gets+0x1b>
+    flushhook();
+     379:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+     37b:	83 ec 04             	sub    $0x4,%esp
+     37e:	6a 01                	push   $0x1
+     380:	56                   	push   %esi
+     381:	6a 00                	push   $0x0
+     383:	e8 60 03 00 00       	call   6e8 <_read>
+    if(cc < 1)
+     388:	83 c4 10             	add    $0x10,%esp
+     38b:	85 c0                	test   %eax,%eax
+     38d:	7e 1d                	jle    3ac <gets+0x4c>
+    buf[i++] = c;
+     38f:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     393:	8b 55 08             	mov    0x8(%ebp),%edx
+     396:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     39a:	3c 0a                	cmp    $0xa,%al
+     39c:	74 10                	je     3ae <gets+0x4e>
+     39e:	3c 0d                	cmp    $0xd,%al
+     3a0:	74 0c                	je     3ae <gets+0x4e>
+  for(i=0; i+1 < max; ){
+     3a2:	89 df                	mov    %ebx,%edi
+     3a4:	83 c3 01             	add    $0x1,%ebx
+     3a7:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     3aa:	7c c4                	jl     370 <gets+0x10>
+     3ac:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+     3ae:	8b 45 08             	mov    0x8(%ebp),%eax
+     3b1:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+     3b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     3b8:	5b                   	pop    %ebx
+     3b9:	5e                   	pop    %esi
+     3ba:	5f                   	pop    %edi
+     3bb:	5d                   	pop    %ebp
+     3bc:	c3                   	ret
+     3bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003c0 <stat>:
+{
+     3c0:	55                   	push   %ebp
+     3c1:	89 e5                	mov    %esp,%ebp
+     3c3:	56                   	push   %esi
+     3c4:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+     3c5:	83 ec 08             	sub    $0x8,%esp
+     3c8:	6a 00                	push   $0x0
+     3ca:	ff 75 08             	push   0x8(%ebp)
+     3cd:	e8 3e 03 00 00       	call   710 <open>
+  if(fd < 0)
+     3d2:	83 c4 10             	add    $0x10,%esp
+     3d5:	85 c0                	test   %eax,%eax
+     3d7:	78 37                	js     410 <stat+0x50>
+  r = fstat(fd, st);
+     3d9:	83 ec 08             	sub    $0x8,%esp
+     3dc:	ff 75 0c             	push   0xc(%ebp)
+     3df:	89 c3                	mov    %eax,%ebx
+     3e1:	50                   	push   %eax
+     3e2:	e8 41 03 00 00       	call   728 <fstat>
+}
+
+int
+close(int fd)
+{
+  if(flushhook)
+     3e7:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+     3ea:	89 c6                	mov    %eax,%esi
+  if(flushhook)
+     3ec:	a1 10 22 00 00       	mov    0x2210,%eax
+     3f1:	85 c0                	test   %eax,%eax
+     3f3:	74 02                	je     3f7 <stat+0x37>
+    flushhook();
+     3f5:	ff d0                	call   *%eax
+  return _close(fd);
+     3f7:	83 ec 0c             	sub    $0xc,%esp
+     3fa:	53                   	push   %ebx
+     3fb:	e8 f8 02 00 00       	call   6f8 <_close>
+     400:	83 c4 10             	add    $0x10,%esp
+}
+     403:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     406:	89 f0                	mov    %esi,%eax
+     408:	5b                   	pop    %ebx
+     409:	5e                   	pop    %esi
+     40a:	5d                   	pop    %ebp
+     40b:	c3                   	ret
+     40c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+     410:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     415:	eb ec                	jmp    403 <stat+0x43>
+     417:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     41e:	66 90                	xchg   %ax,%ax
+
+00000420 <atoi>:
+{
+     420:	55                   	push   %ebp
+     421:	89 e5                	mov    %esp,%ebp
+     423:	53                   	push   %ebx
+     424:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+     427:	0f be 02             	movsbl (%edx),%eax
+     42a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     42d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     430:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     435:	77 1e                	ja     455 <atoi+0x35>
+     437:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     43e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     440:	83 c2 01             	add    $0x1,%edx
+     443:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     446:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     44a:	0f be 02             	movsbl (%edx),%eax
+     44d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     450:	80 fb 09             	cmp    $0x9,%bl
+     453:	76 eb                	jbe    440 <atoi+0x20>
+}
+     455:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     458:	89 c8                	mov    %ecx,%eax
+     45a:	c9                   	leave
+     45b:	c3                   	ret
+     45c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000460 <memmove>:
+{
+     460:	55                   	push   %ebp
+     461:	89 e5                	mov    %esp,%ebp
+     463:	57                   	push   %edi
+     464:	56                   	push   %esi
+     465:	8b 45 10             	mov    0x10(%ebp),%eax
+     468:	8b 55 08             	mov    0x8(%ebp),%edx
+     46b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+     46e:	85 c0                	test   %eax,%eax
+     470:	7e 13                	jle    485 <memmove+0x25>
+     472:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     474:	89 d7                	mov    %edx,%edi
+     476:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     47d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     480:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     481:	39 f8                	cmp    %edi,%eax
+     483:	75 fb                	jne    480 <memmove+0x20>
+}
+     485:	5e                   	pop    %esi
+     486:	89 d0                	mov    %edx,%eax
+     488:	5f                   	pop    %edi
+     489:	5d                   	pop    %ebp
+     48a:	c3                   	ret
+     48b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     48f:	90                   	nop
+
+00000490 <fork>:
+  if(flushhook)
+     490:	a1 10 22 00 00       	mov    0x2210,%eax
+     495:	85 c0                	test   %eax,%eax
+     497:	74 17                	je     4b0 <fork+0x20>
+{
+     499:	55                   	push   %ebp
+     49a:	89 e5                	mov    %esp,%ebp
+     49c:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+     49f:	ff d0                	call   *%eax
+}
+     4a1:	c9                   	leave
+  return _fork();
+     4a2:	e9 21 02 00 00       	jmp    6c8 <_fork>
+     4a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4ae:	66 90                	xchg   %ax,%ax
+     4b0:	e9 13 02 00 00       	jmp    6c8 <_fork>
+     4b5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004c0 <exit>:
+{
+     4c0:	55                   	push   %ebp
+     4c1:	89 e5                	mov    %esp,%ebp
+     4c3:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+     4c6:	a1 10 22 00 00       	mov    0x2210,%eax
+     4cb:	85 c0                	test   %eax,%eax
+     4cd:	74 02                	je     4d1 <exit+0x11>
+    flushhook();
+     4cf:	ff d0                	call   *%eax
+  _exit();
+     4d1:	e8 fa 01 00 00       	call   6d0 <_exit>
+     4d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000004e0 <exec>:
+{
+     4e0:	55                   	push   %ebp
+  if(flushhook)
+     4e1:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+     4e6:	89 e5                	mov    %esp,%ebp
+     4e8:	56                   	push   %esi
+     4e9:	53                   	push   %ebx
+     4ea:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     4ed:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+     4f0:	85 c0                	test   %eax,%eax
+     4f2:	74 02                	je     4f6 <exec+0x16>
+    flushhook();
+     4f4:	ff d0                	call   *%eax
+  return _exec(path, argv);
+     4f6:	89 75 0c             	mov    %esi,0xc(%ebp)
+     4f9:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     4fc:	5b                   	pop    %ebx
+     4fd:	5e                   	pop    %esi
+     4fe:	5d                   	pop    %ebp
+  return _exec(path, argv);
+     4ff:	e9 04 02 00 00       	jmp    708 <_exec>
+     504:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     50b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     50f:	90                   	nop
+
+00000510 <read>:
+{
+     510:	55                   	push   %ebp
+     511:	89 e5                	mov    %esp,%ebp
+     513:	57                   	push   %edi
+     514:	56                   	push   %esi
+     515:	53                   	push   %ebx
+     516:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     519:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+     51e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     521:	8b 75 0c             	mov    0xc(%ebp),%esi
+     524:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     527:	85 c0                	test   %eax,%eax
+     529:	74 02                	je     52d <read+0x1d>
+    flushhook();
+     52b:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+     52d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     530:	89 75 0c             	mov    %esi,0xc(%ebp)
+     533:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     536:	83 c4 0c             	add    $0xc,%esp
+     539:	5b                   	pop    %ebx
+     53a:	5e                   	pop    %esi
+     53b:	5f                   	pop    %edi
+     53c:	5d                   	pop    %ebp
+  return _read(fd, buf, n);
+     53d:	e9 a6 01 00 00       	jmp    6e8 <_read>
+     542:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     549:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000550 <readv>:
+{
+     550:	55                   	push   %ebp
+     551:	89 e5                	mov    %esp,%ebp
+     553:	57                   	push   %edi
+     554:	56                   	push   %esi
+     555:	53                   	push   %ebx
+     556:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     559:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+     55e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     561:	8b 75 0c             	mov    0xc(%ebp),%esi
+     564:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     567:	85 c0                	test   %eax,%eax
+     569:	74 02                	je     56d <readv+0x1d>
+    flushhook();
+     56b:	ff d0                	call   *%eax
+  return _readv(fd, iov, cnt);
+     56d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     570:	89 75 0c             	mov    %esi,0xc(%ebp)
+     573:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     576:	83 c4 0c             	add    $0xc,%esp
+     579:	5b                   	pop    %ebx
+     57a:	5e                   	pop    %esi
+     57b:	5f                   	pop    %edi
+     57c:	5d                   	pop    %ebp
+  return _readv(fd, iov, cnt);
+     57d:	e9 76 02 00 00       	jmp    7f8 <_readv>
+     582:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     589:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000590 <write>:
+{
+     590:	55                   	push   %ebp
+     591:	89 e5                	mov    %esp,%ebp
+     593:	57                   	push   %edi
+     594:	56                   	push   %esi
+     595:	53                   	push   %ebx
+     596:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     599:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+     59e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     5a1:	8b 75 0c             	mov    0xc(%ebp),%esi
+     5a4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     5a7:	85 c0                	test   %eax,%eax
+     5a9:	74 02                	je     5ad <write+0x1d>
+    flushhook();
+     5ab:	ff d0                	call   *%eax
+  return _write(fd, buf, n);
+     5ad:	89 7d 10             	mov    %edi,0x10(%ebp)
+     5b0:	89 75 0c             	mov    %esi,0xc(%ebp)
+     5b3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     5b6:	83 c4 0c             	add    $0xc,%esp
+     5b9:	5b                   	pop    %ebx
+     5ba:	5e                   	pop    %esi
+     5bb:	5f                   	pop    %edi
+     5bc:	5d                   	pop    %ebp
+  return _write(fd, buf, n);
+     5bd:	e9 2e 01 00 00       	jmp    6f0 <_write>
+     5c2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000005d0 <writev>:
+{
+     5d0:	55                   	push   %ebp
+     5d1:	89 e5                	mov    %esp,%ebp
+     5d3:	57                   	push   %edi
+     5d4:	56                   	push   %esi
+     5d5:	53                   	push   %ebx
+     5d6:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     5d9:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+     5de:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     5e1:	8b 75 0c             	mov    0xc(%ebp),%esi
+     5e4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     5e7:	85 c0                	test   %eax,%eax
+     5e9:	74 02                	je     5ed <writev+0x1d>
+    flushhook();
+     5eb:	ff d0                	call   *%eax
+  return _writev(fd, iov, cnt);
+     5ed:	89 7d 10             	mov    %edi,0x10(%ebp)
+     5f0:	89 75 0c             	mov    %esi,0xc(%ebp)
+     5f3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     5f6:	83 c4 0c             	add    $0xc,%esp
+     5f9:	5b                   	pop    %ebx
+     5fa:	5e                   	pop    %esi
+     5fb:	5f                   	pop    %edi
+     5fc:	5d                   	pop    %ebp
+  return _writev(fd, iov, cnt);
+     5fd:	e9 fe 01 00 00       	jmp    800 <_writev>
+     602:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     609:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000610 <close>:
+{
+     610:	55                   	push   %ebp
+     611:	89 e5                	mov    %esp,%ebp
+     613:	53                   	push   %ebx
+     614:	83 ec 04             	sub    $0x4,%esp
+  if(flushhook)
+     617:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+     61c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(flushhook)
+     61f:	85 c0                	test   %eax,%eax
+     621:	74 02                	je     625 <close+0x15>
+    flushhook();
+     623:	ff d0                	call   *%eax
+  return _close(fd);
+     625:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     628:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     62b:	c9                   	leave
+  return _close(fd);
+     62c:	e9 c7 00 00 00       	jmp    6f8 <_close>
+     631:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     638:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     63f:	90                   	nop
+
+00000640 <umtxinit>:
+// process that finds the mutex held enters the kernel, to sleep
+// in futexwait() until the holder's umtxunlock() wakes it.
+
+void
+umtxinit(struct umutex *m)
+{
+     640:	55                   	push   %ebp
+     641:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+     643:	8b 45 08             	mov    0x8(%ebp),%eax
+     646:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     64c:	5d                   	pop    %ebp
+     64d:	c3                   	ret
+     64e:	66 90                	xchg   %ax,%ax
+
+00000650 <umtxlock>:
+
+void
+umtxlock(struct umutex *m)
+{
+     650:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+     651:	b8 01 00 00 00       	mov    $0x1,%eax
+     656:	89 e5                	mov    %esp,%ebp
+     658:	56                   	push   %esi
+     659:	53                   	push   %ebx
+     65a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     65d:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 1) == 0)
+     660:	85 c0                	test   %eax,%eax
+     662:	74 2b                	je     68f <umtxlock+0x3f>
+     664:	b8 02 00 00 00       	mov    $0x2,%eax
+     669:	f0 87 03             	lock xchg %eax,(%ebx)
+    return;
+  // Mark the mutex contended, so that its holder
+  // wakes a waiter on release, and wait.
+  while(xchg(&m->state, 2) != 0)
+     66c:	85 c0                	test   %eax,%eax
+     66e:	74 1f                	je     68f <umtxlock+0x3f>
+     670:	be 02 00 00 00       	mov    $0x2,%esi
+     675:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwait(&m->state, 2);
+     678:	83 ec 08             	sub    $0x8,%esp
+     67b:	6a 02                	push   $0x2
+     67d:	53                   	push   %ebx
+     67e:	e8 85 01 00 00       	call   808 <futexwait>
+     683:	89 f0                	mov    %esi,%eax
+     685:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+     688:	83 c4 10             	add    $0x10,%esp
+     68b:	85 c0                	test   %eax,%eax
+     68d:	75 e9                	jne    678 <umtxlock+0x28>
+}
+     68f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     692:	5b                   	pop    %ebx
+     693:	5e                   	pop    %esi
+     694:	5d                   	pop    %ebp
+     695:	c3                   	ret
+     696:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     69d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000006a0 <umtxunlock>:
+
+void
+umtxunlock(struct umutex *m)
+{
+     6a0:	55                   	push   %ebp
+     6a1:	31 c0                	xor    %eax,%eax
+     6a3:	89 e5                	mov    %esp,%ebp
+     6a5:	83 ec 08             	sub    $0x8,%esp
+     6a8:	8b 55 08             	mov    0x8(%ebp),%edx
+     6ab:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+     6ae:	83 f8 02             	cmp    $0x2,%eax
+     6b1:	74 05                	je     6b8 <umtxunlock+0x18>
+    futexwake(&m->state, 1);
+}
+     6b3:	c9                   	leave
+     6b4:	c3                   	ret
+     6b5:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwake(&m->state, 1);
+     6b8:	83 ec 08             	sub    $0x8,%esp
+     6bb:	6a 01                	push   $0x1
+     6bd:	52                   	push   %edx
+     6be:	e8 4d 01 00 00       	call   810 <futexwake>
+     6c3:	83 c4 10             	add    $0x10,%esp
+}
+     6c6:	c9                   	leave
+     6c7:	c3                   	ret
+
+000006c8 <_fork>:
+  _ ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+     6c8:	b8 01 00 00 00       	mov    $0x1,%eax
+     6cd:	cd 40                	int    $0x40
+     6cf:	c3                   	ret
+
+000006d0 <_exit>:
+RAWSYSCALL(exit)
+     6d0:	b8 02 00 00 00       	mov    $0x2,%eax
+     6d5:	cd 40                	int    $0x40
+     6d7:	c3                   	ret
+
+000006d8 <wait>:
+SYSCALL(wait)
+     6d8:	b8 03 00 00 00       	mov    $0x3,%eax
+     6dd:	cd 40                	int    $0x40
+     6df:	c3                   	ret
+
+000006e0 <pipe>:
+SYSCALL(pipe)
+     6e0:	b8 04 00 00 00       	mov    $0x4,%eax
+     6e5:	cd 40                	int    $0x40
+     6e7:	c3                   	ret
+
+000006e8 <_read>:
+RAWSYSCALL(read)
+     6e8:	b8 05 00 00 00       	mov    $0x5,%eax
+     6ed:	cd 40                	int    $0x40
+     6ef:	c3                   	ret
+
+000006f0 <_write>:
+RAWSYSCALL(write)
+     6f0:	b8 10 00 00 00       	mov    $0x10,%eax
+     6f5:	cd 40                	int    $0x40
+     6f7:	c3                   	ret
+
+000006f8 <_close>:
+RAWSYSCALL(close)
+     6f8:	b8 15 00 00 00       	mov    $0x15,%eax
+     6fd:	cd 40                	int    $0x40
+     6ff:	c3                   	ret
+
+00000700 <kill>:
+SYSCALL(kill)
+     700:	b8 06 00 00 00       	mov    $0x6,%eax
+     705:	cd 40                	int    $0x40
+     707:	c3                   	ret
+
+00000708 <_exec>:
+RAWSYSCALL(exec)
+     708:	b8 07 00 00 00       	mov    $0x7,%eax
+     70d:	cd 40                	int    $0x40
+     70f:	c3                   	ret
+
+00000710 <open>:
+SYSCALL(open)
+     710:	b8 0f 00 00 00       	mov    $0xf,%eax
+     715:	cd 40                	int    $0x40
+     717:	c3                   	ret
+
+00000718 <mknod>:
+SYSCALL(mknod)
+     718:	b8 11 00 00 00       	mov    $0x11,%eax
+     71d:	cd 40                	int    $0x40
+     71f:	c3                   	ret
+
+00000720 <unlink>:
+SYSCALL(unlink)
+     720:	b8 12 00 00 00       	mov    $0x12,%eax
+     725:	cd 40                	int    $0x40
+     727:	c3                   	ret
+
+00000728 <fstat>:
+SYSCALL(fstat)
+     728:	b8 08 00 00 00       	mov    $0x8,%eax
+     72d:	cd 40                	int    $0x40
+     72f:	c3                   	ret
+
+00000730 <link>:
+SYSCALL(link)
+     730:	b8 13 00 00 00       	mov    $0x13,%eax
+     735:	cd 40                	int    $0x40
+     737:	c3                   	ret
+
+00000738 <mkdir>:
+SYSCALL(mkdir)
+     738:	b8 14 00 00 00       	mov    $0x14,%eax
+     73d:	cd 40                	int    $0x40
+     73f:	c3                   	ret
+
+00000740 <chdir>:
+SYSCALL(chdir)
+     740:	b8 09 00 00 00       	mov    $0x9,%eax
+     745:	cd 40                	int    $0x40
+     747:	c3                   	ret
+
+00000748 <dup>:
+SYSCALL(dup)
+     748:	b8 0a 00 00 00       	mov    $0xa,%eax
+     74d:	cd 40                	int    $0x40
+     74f:	c3                   	ret
+
+00000750 <getpid>:
+SYSCALL(getpid)
+     750:	b8 0b 00 00 00       	mov    $0xb,%eax
+     755:	cd 40                	int    $0x40
+     757:	c3                   	ret
+
+00000758 <sbrk>:
+SYSCALL(sbrk)
+     758:	b8 0c 00 00 00       	mov    $0xc,%eax
+     75d:	cd 40                	int    $0x40
+     75f:	c3                   	ret
+
+00000760 <sleep>:
+SYSCALL(sleep)
+     760:	b8 0d 00 00 00       	mov    $0xd,%eax
+     765:	cd 40                	int    $0x40
+     767:	c3                   	ret
+
+00000768 <uptime>:
+SYSCALL(uptime)
+     768:	b8 0e 00 00 00       	mov    $0xe,%eax
+     76d:	cd 40                	int    $0x40
+     76f:	c3                   	ret
+
+00000770 <wolfie>:
+SYSCALL(wolfie)
+     770:	b8 16 00 00 00       	mov    $0x16,%eax
+     775:	cd 40                	int    $0x40
+     777:	c3                   	ret
+
+00000778 <nice>:
+SYSCALL(nice)
+     778:	b8 17 00 00 00       	mov    $0x17,%eax
+     77d:	cd 40                	int    $0x40
+     77f:	c3                   	ret
+
+00000780 <mtxget>:
+SYSCALL(mtxget)
+     780:	b8 18 00 00 00       	mov    $0x18,%eax
+     785:	cd 40                	int    $0x40
+     787:	c3                   	ret
+
+00000788 <mtxrel>:
+SYSCALL(mtxrel)
+     788:	b8 19 00 00 00       	mov    $0x19,%eax
+     78d:	cd 40                	int    $0x40
+     78f:	c3                   	ret
+
+00000790 <mtxacq>:
+SYSCALL(mtxacq)
+     790:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     795:	cd 40                	int    $0x40
+     797:	c3                   	ret
+
+00000798 <mtxdel>:
+SYSCALL(mtxdel)
+     798:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     79d:	cd 40                	int    $0x40
+     79f:	c3                   	ret
+
+000007a0 <iostat>:
+SYSCALL(iostat)
+     7a0:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     7a5:	cd 40                	int    $0x40
+     7a7:	c3                   	ret
+
+000007a8 <mmap>:
+SYSCALL(mmap)
+     7a8:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     7ad:	cd 40                	int    $0x40
+     7af:	c3                   	ret
+
+000007b0 <munmap>:
+SYSCALL(munmap)
+     7b0:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     7b5:	cd 40                	int    $0x40
+     7b7:	c3                   	ret
+
+000007b8 <shmget>:
+SYSCALL(shmget)
+     7b8:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     7bd:	cd 40                	int    $0x40
+     7bf:	c3                   	ret
+
+000007c0 <shmat>:
+SYSCALL(shmat)
+     7c0:	b8 20 00 00 00       	mov    $0x20,%eax
+     7c5:	cd 40                	int    $0x40
+     7c7:	c3                   	ret
+
+000007c8 <shmdt>:
+SYSCALL(shmdt)
+     7c8:	b8 21 00 00 00       	mov    $0x21,%eax
+     7cd:	cd 40                	int    $0x40
+     7cf:	c3                   	ret
+
+000007d0 <shmdel>:
+SYSCALL(shmdel)
+     7d0:	b8 22 00 00 00       	mov    $0x22,%eax
+     7d5:	cd 40                	int    $0x40
+     7d7:	c3                   	ret
+
+000007d8 <syscount>:
+SYSCALL(syscount)
+     7d8:	b8 23 00 00 00       	mov    $0x23,%eax
+     7dd:	cd 40                	int    $0x40
+     7df:	c3                   	ret
+
+000007e0 <splice>:
+SYSCALL(splice)
+     7e0:	b8 24 00 00 00       	mov    $0x24,%eax
+     7e5:	cd 40                	int    $0x40
+     7e7:	c3                   	ret
+
+000007e8 <tee>:
+SYSCALL(tee)
+     7e8:	b8 25 00 00 00       	mov    $0x25,%eax
+     7ed:	cd 40                	int    $0x40
+     7ef:	c3                   	ret
+
+000007f0 <sendfile>:
+SYSCALL(sendfile)
+     7f0:	b8 26 00 00 00       	mov    $0x26,%eax
+     7f5:	cd 40                	int    $0x40
+     7f7:	c3                   	ret
+
+000007f8 <_readv>:
+RAWSYSCALL(readv)
+     7f8:	b8 27 00 00 00       	mov    $0x27,%eax
+     7fd:	cd 40                	int    $0x40
+     7ff:	c3                   	ret
+
+00000800 <_writev>:
+RAWSYSCALL(writev)
+     800:	b8 28 00 00 00       	mov    $0x28,%eax
+     805:	cd 40                	int    $0x40
+     807:	c3                   	ret
+
+00000808 <futexwait>:
+SYSCALL(futexwait)
+     808:	b8 29 00 00 00       	mov    $0x29,%eax
+     80d:	cd 40                	int    $0x40
+     80f:	c3                   	ret
+
+00000810 <futexwake>:
+SYSCALL(futexwake)
+     810:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     815:	cd 40                	int    $0x40
+     817:	c3                   	ret
+
+00000818 <lockstat>:
+SYSCALL(lockstat)
+     818:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     81d:	cd 40                	int    $0x40
+     81f:	c3                   	ret
+
+00000820 <clone>:
+SYSCALL(clone)
+     820:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     825:	cd 40                	int    $0x40
+     827:	c3                   	ret
+
+00000828 <join>:
+SYSCALL(join)
+     828:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     82d:	cd 40                	int    $0x40
+     82f:	c3                   	ret
+
+00000830 <stacklimit>:
+SYSCALL(stacklimit)
+     830:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     835:	cd 40                	int    $0x40
+     837:	c3                   	ret
+     838:	66 90                	xchg   %ax,%ax
+     83a:	66 90                	xchg   %ax,%ax
+     83c:	66 90                	xchg   %ax,%ax
+     83e:	66 90                	xchg   %ax,%ax
+
+00000840 <flushall>:
+  b->n = 0;
+}
+
+static void
+flushall(void)
+{
+     840:	55                   	push   %ebp
+     841:	89 e5                	mov    %esp,%ebp
+     843:	83 ec 14             	sub    $0x14,%esp
+  umtxlock(&stdoutlock);
+     846:	68 14 22 00 00       	push   $0x2214
+     84b:	e8 00 fe ff ff       	call   650 <umtxlock>
+  if(b->n > 0)
+     850:	a1 08 20 00 00       	mov    0x2008,%eax
+     855:	83 c4 10             	add    $0x10,%esp
+     858:	85 c0                	test   %eax,%eax
+     85a:	7e 17                	jle    873 <flushall+0x33>
+    _write(b->fd, b->buf, b->n);
+     85c:	83 ec 04             	sub    $0x4,%esp
+     85f:	50                   	push   %eax
+     860:	68 0c 20 00 00       	push   $0x200c
+     865:	ff 35 00 20 00 00    	push   0x2000
+     86b:	e8 80 fe ff ff       	call   6f0 <_write>
+     870:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     873:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     87a:	00 00 00 
+  flush(&stdout);
+  umtxunlock(&stdoutlock);
+     87d:	83 ec 0c             	sub    $0xc,%esp
+     880:	68 14 22 00 00       	push   $0x2214
+     885:	e8 16 fe ff ff       	call   6a0 <umtxunlock>
+}
+     88a:	83 c4 10             	add    $0x10,%esp
+     88d:	c9                   	leave
+     88e:	c3                   	ret
+     88f:	90                   	nop
+
+00000890 <printint>:
+    flush(b);
+}
+
+static void
+printint(struct outbuf *b, int xx, int base, int sgn)
+{
+     890:	55                   	push   %ebp
+     891:	89 e5                	mov    %esp,%ebp
+     893:	57                   	push   %edi
+     894:	89 cf                	mov    %ecx,%edi
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     896:	89 d1                	mov    %edx,%ecx
+{
+     898:	56                   	push   %esi
+     899:	53                   	push   %ebx
+     89a:	89 c3                	mov    %eax,%ebx
+     89c:	83 ec 2c             	sub    $0x2c,%esp
+  if(sgn && xx < 0){
+     89f:	85 d2                	test   %edx,%edx
+     8a1:	0f 89 b9 00 00 00    	jns    960 <printint+0xd0>
+     8a7:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     8ab:	0f 84 af 00 00 00    	je     960 <printint+0xd0>
+    x = -xx;
+     8b1:	f7 d9                	neg    %ecx
+    neg = 1;
+     8b3:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     8b8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     8bb:	31 f6                	xor    %esi,%esi
+     8bd:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     8c0:	89 c8                	mov    %ecx,%eax
+     8c2:	31 d2                	xor    %edx,%edx
+     8c4:	89 f3                	mov    %esi,%ebx
+     8c6:	f7 f7                	div    %edi
+     8c8:	8d 76 01             	lea    0x1(%esi),%esi
+     8cb:	0f b6 92 5c 15 00 00 	movzbl 0x155c(%edx),%edx
+     8d2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     8d6:	89 ca                	mov    %ecx,%edx
+     8d8:	89 c1                	mov    %eax,%ecx
+     8da:	39 fa                	cmp    %edi,%edx
+     8dc:	73 e2                	jae    8c0 <printint+0x30>
+  if(neg)
+     8de:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     8e1:	89 d9                	mov    %ebx,%ecx
+     8e3:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     8e6:	85 c0                	test   %eax,%eax
+     8e8:	74 07                	je     8f1 <printint+0x61>
+    buf[i++] = '-';
+     8ea:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     8ef:	89 f1                	mov    %esi,%ecx
+     8f1:	8d 75 d8             	lea    -0x28(%ebp),%esi
+     8f4:	89 cf                	mov    %ecx,%edi
+     8f6:	01 f7                	add    %esi,%edi
+     8f8:	eb 1a                	jmp    914 <printint+0x84>
+     8fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    *b->str++ = c;
+     900:	8d 48 01             	lea    0x1(%eax),%ecx
+     903:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+     909:	88 10                	mov    %dl,(%eax)
+
+  while(--i >= 0)
+     90b:	8d 47 ff             	lea    -0x1(%edi),%eax
+     90e:	39 fe                	cmp    %edi,%esi
+     910:	74 40                	je     952 <printint+0xc2>
+     912:	89 c7                	mov    %eax,%edi
+  if(b->str){
+     914:	8b 83 0c 02 00 00    	mov    0x20c(%ebx),%eax
+    putc(b, buf[i]);
+     91a:	0f b6 17             	movzbl (%edi),%edx
+  if(b->str){
+     91d:	85 c0                	test   %eax,%eax
+     91f:	75 df                	jne    900 <printint+0x70>
+  b->buf[b->n++] = c;
+     921:	8b 4b 08             	mov    0x8(%ebx),%ecx
+     924:	8d 41 01             	lea    0x1(%ecx),%eax
+     927:	89 43 08             	mov    %eax,0x8(%ebx)
+     92a:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+     92e:	3d 00 02 00 00       	cmp    $0x200,%eax
+     933:	74 3b                	je     970 <printint+0xe0>
+     935:	80 fa 0a             	cmp    $0xa,%dl
+     938:	75 d1                	jne    90b <printint+0x7b>
+     93a:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+     93e:	75 cb                	jne    90b <printint+0x7b>
+  if(b->n > 0)
+     940:	85 c0                	test   %eax,%eax
+     942:	7f 2c                	jg     970 <printint+0xe0>
+  b->n = 0;
+     944:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  while(--i >= 0)
+     94b:	8d 47 ff             	lea    -0x1(%edi),%eax
+     94e:	39 fe                	cmp    %edi,%esi
+     950:	75 c0                	jne    912 <printint+0x82>
+}
+     952:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     955:	5b                   	pop    %ebx
+     956:	5e                   	pop    %esi
+     957:	5f                   	pop    %edi
+     958:	5d                   	pop    %ebp
+     959:	c3                   	ret
+     95a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  neg = 0;
+     960:	31 c0                	xor    %eax,%eax
+     962:	e9 51 ff ff ff       	jmp    8b8 <printint+0x28>
+     967:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     96e:	66 90                	xchg   %ax,%ax
+    _write(b->fd, b->buf, b->n);
+     970:	83 ec 04             	sub    $0x4,%esp
+     973:	50                   	push   %eax
+     974:	8d 43 0c             	lea    0xc(%ebx),%eax
+     977:	50                   	push   %eax
+     978:	ff 33                	push   (%ebx)
+     97a:	e8 71 fd ff ff       	call   6f0 <_write>
+     97f:	83 c4 10             	add    $0x10,%esp
+     982:	eb c0                	jmp    944 <printint+0xb4>
+     984:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     98b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     98f:	90                   	nop
+
+00000990 <putc>:
+{
+     990:	55                   	push   %ebp
+     991:	89 e5                	mov    %esp,%ebp
+     993:	53                   	push   %ebx
+     994:	89 c3                	mov    %eax,%ebx
+     996:	83 ec 04             	sub    $0x4,%esp
+  if(b->str){
+     999:	8b 80 0c 02 00 00    	mov    0x20c(%eax),%eax
+     99f:	85 c0                	test   %eax,%eax
+     9a1:	74 15                	je     9b8 <putc+0x28>
+    *b->str++ = c;
+     9a3:	8d 48 01             	lea    0x1(%eax),%ecx
+     9a6:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+     9ac:	88 10                	mov    %dl,(%eax)
+}
+     9ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     9b1:	c9                   	leave
+     9b2:	c3                   	ret
+     9b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     9b7:	90                   	nop
+  b->buf[b->n++] = c;
+     9b8:	8b 4b 08             	mov    0x8(%ebx),%ecx
+     9bb:	8d 41 01             	lea    0x1(%ecx),%eax
+     9be:	89 43 08             	mov    %eax,0x8(%ebx)
+     9c1:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+     9c5:	3d 00 02 00 00       	cmp    $0x200,%eax
+     9ca:	74 14                	je     9e0 <putc+0x50>
+     9cc:	80 fa 0a             	cmp    $0xa,%dl
+     9cf:	75 dd                	jne    9ae <putc+0x1e>
+     9d1:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+     9d5:	75 d7                	jne    9ae <putc+0x1e>
+  if(b->n > 0)
+     9d7:	85 c0                	test   %eax,%eax
+     9d9:	7e 17                	jle    9f2 <putc+0x62>
+     9db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     9df:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     9e0:	83 ec 04             	sub    $0x4,%esp
+     9e3:	50                   	push   %eax
+     9e4:	8d 43 0c             	lea    0xc(%ebx),%eax
+     9e7:	50                   	push   %eax
+     9e8:	ff 33                	push   (%ebx)
+     9ea:	e8 01 fd ff ff       	call   6f0 <_write>
+     9ef:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     9f2:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+     9f9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     9fc:	c9                   	leave
+     9fd:	c3                   	ret
+     9fe:	66 90                	xchg   %ax,%ax
+
+00000a00 <format>:
+
+// Format fmt and the arguments at ap into b.
+// Only understands %d, %x, %p, %s, %c.
+static void
+format(struct outbuf *b, const char *fmt, uint *ap)
+{
+     a00:	55                   	push   %ebp
+     a01:	89 e5                	mov    %esp,%ebp
+     a03:	57                   	push   %edi
+     a04:	89 c7                	mov    %eax,%edi
+     a06:	56                   	push   %esi
+     a07:	53                   	push   %ebx
+     a08:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+     a0b:	0f b6 02             	movzbl (%edx),%eax
+{
+     a0e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  for(i = 0; fmt[i]; i++){
+     a11:	84 c0                	test   %al,%al
+     a13:	74 5a                	je     a6f <format+0x6f>
+     a15:	8d 5a 01             	lea    0x1(%edx),%ebx
+     a18:	31 f6                	xor    %esi,%esi
+     a1a:	eb 1c                	jmp    a38 <format+0x38>
+     a1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     a20:	83 f8 25             	cmp    $0x25,%eax
+     a23:	74 3b                	je     a60 <format+0x60>
+        state = '%';
+      } else {
+        putc(b, c);
+     a25:	89 ca                	mov    %ecx,%edx
+     a27:	89 f8                	mov    %edi,%eax
+     a29:	e8 62 ff ff ff       	call   990 <putc>
+  for(i = 0; fmt[i]; i++){
+     a2e:	0f b6 03             	movzbl (%ebx),%eax
+     a31:	83 c3 01             	add    $0x1,%ebx
+     a34:	84 c0                	test   %al,%al
+     a36:	74 37                	je     a6f <format+0x6f>
+    c = fmt[i] & 0xff;
+     a38:	0f be c8             	movsbl %al,%ecx
+     a3b:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     a3e:	85 f6                	test   %esi,%esi
+     a40:	74 de                	je     a20 <format+0x20>
+      }
+    } else if(state == '%'){
+     a42:	83 fe 25             	cmp    $0x25,%esi
+     a45:	75 e7                	jne    a2e <format+0x2e>
+      if(c == 'd'){
+     a47:	83 f8 25             	cmp    $0x25,%eax
+     a4a:	74 46                	je     a92 <format+0x92>
+     a4c:	83 e8 63             	sub    $0x63,%eax
+     a4f:	83 f8 15             	cmp    $0x15,%eax
+     a52:	77 2c                	ja     a80 <format+0x80>
+     a54:	ff 24 85 04 15 00 00 	jmp    *0x1504(,%eax,4)
+     a5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     a5f:	90                   	nop
+  for(i = 0; fmt[i]; i++){
+     a60:	0f b6 03             	movzbl (%ebx),%eax
+     a63:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+     a66:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+     a6b:	84 c0                	test   %al,%al
+     a6d:	75 c9                	jne    a38 <format+0x38>
+        putc(b, c);
+      }
+      state = 0;
+    }
+  }
+}
+     a6f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a72:	5b                   	pop    %ebx
+     a73:	5e                   	pop    %esi
+     a74:	5f                   	pop    %edi
+     a75:	5d                   	pop    %ebp
+     a76:	c3                   	ret
+     a77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a7e:	66 90                	xchg   %ax,%ax
+        putc(b, '%');
+     a80:	ba 25 00 00 00       	mov    $0x25,%edx
+     a85:	89 f8                	mov    %edi,%eax
+     a87:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     a8a:	e8 01 ff ff ff       	call   990 <putc>
+        putc(b, c);
+     a8f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     a92:	89 ca                	mov    %ecx,%edx
+     a94:	89 f8                	mov    %edi,%eax
+      state = 0;
+     a96:	31 f6                	xor    %esi,%esi
+        putc(b, c);
+     a98:	e8 f3 fe ff ff       	call   990 <putc>
+     a9d:	eb 8f                	jmp    a2e <format+0x2e>
+     a9f:	90                   	nop
+        printint(b, *ap, 16, 0);
+     aa0:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     aa3:	83 ec 0c             	sub    $0xc,%esp
+     aa6:	b9 10 00 00 00       	mov    $0x10,%ecx
+     aab:	8b 16                	mov    (%esi),%edx
+     aad:	6a 00                	push   $0x0
+        ap++;
+     aaf:	83 c6 04             	add    $0x4,%esi
+        printint(b, *ap, 16, 0);
+     ab2:	89 f8                	mov    %edi,%eax
+     ab4:	e8 d7 fd ff ff       	call   890 <printint>
+        ap++;
+     ab9:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+     abc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     abf:	31 f6                	xor    %esi,%esi
+     ac1:	e9 68 ff ff ff       	jmp    a2e <format+0x2e>
+     ac6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     acd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     ad0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     ad3:	8b 30                	mov    (%eax),%esi
+        ap++;
+     ad5:	83 c0 04             	add    $0x4,%eax
+     ad8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+     adb:	85 f6                	test   %esi,%esi
+     add:	75 1b                	jne    afa <format+0xfa>
+     adf:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+     ae4:	be fc 14 00 00       	mov    $0x14fc,%esi
+     ae9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+          putc(b, *s);
+     af0:	89 f8                	mov    %edi,%eax
+          s++;
+     af2:	83 c6 01             	add    $0x1,%esi
+          putc(b, *s);
+     af5:	e8 96 fe ff ff       	call   990 <putc>
+        while(*s != 0){
+     afa:	0f be 16             	movsbl (%esi),%edx
+     afd:	84 d2                	test   %dl,%dl
+     aff:	75 ef                	jne    af0 <format+0xf0>
+      state = 0;
+     b01:	31 f6                	xor    %esi,%esi
+     b03:	e9 26 ff ff ff       	jmp    a2e <format+0x2e>
+     b08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b0f:	90                   	nop
+        printint(b, *ap, 10, 1);
+     b10:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     b13:	83 ec 0c             	sub    $0xc,%esp
+     b16:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     b1b:	8b 16                	mov    (%esi),%edx
+     b1d:	6a 01                	push   $0x1
+     b1f:	eb 8e                	jmp    aaf <format+0xaf>
+     b21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(b, *ap);
+     b28:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     b2b:	89 f8                	mov    %edi,%eax
+     b2d:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+     b30:	83 c6 04             	add    $0x4,%esi
+        putc(b, *ap);
+     b33:	e8 58 fe ff ff       	call   990 <putc>
+        ap++;
+     b38:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      state = 0;
+     b3b:	31 f6                	xor    %esi,%esi
+     b3d:	e9 ec fe ff ff       	jmp    a2e <format+0x2e>
+     b42:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000b50 <fflush>:
+{
+     b50:	55                   	push   %ebp
+     b51:	89 e5                	mov    %esp,%ebp
+     b53:	83 ec 08             	sub    $0x8,%esp
+  if(fd == stdout.fd)
+     b56:	8b 45 08             	mov    0x8(%ebp),%eax
+     b59:	39 05 00 20 00 00    	cmp    %eax,0x2000
+     b5f:	74 07                	je     b68 <fflush+0x18>
+}
+     b61:	c9                   	leave
+     b62:	c3                   	ret
+     b63:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b67:	90                   	nop
+  umtxlock(&stdoutlock);
+     b68:	83 ec 0c             	sub    $0xc,%esp
+     b6b:	68 14 22 00 00       	push   $0x2214
+     b70:	e8 db fa ff ff       	call   650 <umtxlock>
+  if(b->n > 0)
+     b75:	a1 08 20 00 00       	mov    0x2008,%eax
+     b7a:	83 c4 10             	add    $0x10,%esp
+     b7d:	85 c0                	test   %eax,%eax
+     b7f:	7f 1f                	jg     ba0 <fflush+0x50>
+  b->n = 0;
+     b81:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     b88:	00 00 00 
+  umtxunlock(&stdoutlock);
+     b8b:	c7 45 08 14 22 00 00 	movl   $0x2214,0x8(%ebp)
+}
+     b92:	c9                   	leave
+  umtxunlock(&stdoutlock);
+     b93:	e9 08 fb ff ff       	jmp    6a0 <umtxunlock>
+     b98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b9f:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     ba0:	83 ec 04             	sub    $0x4,%esp
+     ba3:	50                   	push   %eax
+     ba4:	68 0c 20 00 00       	push   $0x200c
+     ba9:	ff 35 00 20 00 00    	push   0x2000
+     baf:	e8 3c fb ff ff       	call   6f0 <_write>
+     bb4:	83 c4 10             	add    $0x10,%esp
+     bb7:	eb c8                	jmp    b81 <fflush+0x31>
+     bb9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000bc0 <setvbuf>:
+{
+     bc0:	55                   	push   %ebp
+     bc1:	89 e5                	mov    %esp,%ebp
+     bc3:	53                   	push   %ebx
+     bc4:	83 ec 04             	sub    $0x4,%esp
+     bc7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd != stdout.fd)
+     bca:	8b 45 08             	mov    0x8(%ebp),%eax
+     bcd:	39 05 00 20 00 00    	cmp    %eax,0x2000
+     bd3:	74 0b                	je     be0 <setvbuf+0x20>
+}
+     bd5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     bd8:	c9                   	leave
+     bd9:	c3                   	ret
+     bda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  umtxlock(&stdoutlock);
+     be0:	83 ec 0c             	sub    $0xc,%esp
+     be3:	68 14 22 00 00       	push   $0x2214
+     be8:	e8 63 fa ff ff       	call   650 <umtxlock>
+  if(b->n > 0)
+     bed:	a1 08 20 00 00       	mov    0x2008,%eax
+     bf2:	83 c4 10             	add    $0x10,%esp
+     bf5:	85 c0                	test   %eax,%eax
+     bf7:	7f 2f                	jg     c28 <setvbuf+0x68>
+  b->n = 0;
+     bf9:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     c00:	00 00 00 
+  stdout.mode = mode;
+     c03:	89 1d 04 20 00 00    	mov    %ebx,0x2004
+  flushhook = flushall;
+     c09:	c7 05 10 22 00 00 40 	movl   $0x840,0x2210
+     c10:	08 00 00 
+}
+     c13:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&stdoutlock);
+     c16:	c7 45 08 14 22 00 00 	movl   $0x2214,0x8(%ebp)
+}
+     c1d:	c9                   	leave
+  umtxunlock(&stdoutlock);
+     c1e:	e9 7d fa ff ff       	jmp    6a0 <umtxunlock>
+     c23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c27:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     c28:	83 ec 04             	sub    $0x4,%esp
+     c2b:	50                   	push   %eax
+     c2c:	68 0c 20 00 00       	push   $0x200c
+     c31:	ff 35 00 20 00 00    	push   0x2000
+     c37:	e8 b4 fa ff ff       	call   6f0 <_write>
+     c3c:	83 c4 10             	add    $0x10,%esp
+     c3f:	eb b8                	jmp    bf9 <setvbuf+0x39>
+     c41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c4f:	90                   	nop
+
+00000c50 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s, %c.
+void
+printf(int fd, const char *fmt, ...)
+{
+     c50:	55                   	push   %ebp
+     c51:	89 e5                	mov    %esp,%ebp
+     c53:	53                   	push   %ebx
+     c54:	81 ec 14 02 00 00    	sub    $0x214,%esp
+     c5a:	8b 45 08             	mov    0x8(%ebp),%eax
+    local.mode = _IONBF;
+    local.n = 0;
+    local.str = 0;
+    b = &local;
+  }
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     c5d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd == stdout.fd){
+     c60:	39 05 00 20 00 00    	cmp    %eax,0x2000
+     c66:	74 48                	je     cb0 <printf+0x60>
+    local.fd = fd;
+     c68:	89 85 e8 fd ff ff    	mov    %eax,-0x218(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     c6e:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     c71:	89 da                	mov    %ebx,%edx
+     c73:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+    local.mode = _IONBF;
+     c79:	c7 85 ec fd ff ff 03 	movl   $0x3,-0x214(%ebp)
+     c80:	00 00 00 
+    local.n = 0;
+     c83:	c7 85 f0 fd ff ff 00 	movl   $0x0,-0x210(%ebp)
+     c8a:	00 00 00 
+    local.str = 0;
+     c8d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     c94:	e8 67 fd ff ff       	call   a00 <format>
+  if(b->mode == _IONBF)
+     c99:	83 bd ec fd ff ff 03 	cmpl   $0x3,-0x214(%ebp)
+     ca0:	0f 84 a2 00 00 00    	je     d48 <printf+0xf8>
+    flush(b);
+  if(b == &stdout)
+    umtxunlock(&stdoutlock);
+}
+     ca6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     ca9:	c9                   	leave
+     caa:	c3                   	ret
+     cab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     caf:	90                   	nop
+    umtxlock(&stdoutlock);
+     cb0:	83 ec 0c             	sub    $0xc,%esp
+     cb3:	68 14 22 00 00       	push   $0x2214
+     cb8:	e8 93 f9 ff ff       	call   650 <umtxlock>
+  if(stdout.mode == 0){
+     cbd:	a1 04 20 00 00       	mov    0x2004,%eax
+     cc2:	83 c4 10             	add    $0x10,%esp
+     cc5:	85 c0                	test   %eax,%eax
+     cc7:	74 37                	je     d00 <printf+0xb0>
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     cc9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     ccc:	89 da                	mov    %ebx,%edx
+     cce:	b8 00 20 00 00       	mov    $0x2000,%eax
+     cd3:	e8 28 fd ff ff       	call   a00 <format>
+  if(b->mode == _IONBF)
+     cd8:	83 3d 04 20 00 00 03 	cmpl   $0x3,0x2004
+     cdf:	0f 84 ab 00 00 00    	je     d90 <printf+0x140>
+    umtxunlock(&stdoutlock);
+     ce5:	83 ec 0c             	sub    $0xc,%esp
+     ce8:	68 14 22 00 00       	push   $0x2214
+     ced:	e8 ae f9 ff ff       	call   6a0 <umtxunlock>
+}
+     cf2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    umtxunlock(&stdoutlock);
+     cf5:	83 c4 10             	add    $0x10,%esp
+}
+     cf8:	c9                   	leave
+     cf9:	c3                   	ret
+     cfa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+     d00:	83 ec 08             	sub    $0x8,%esp
+     d03:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+     d09:	50                   	push   %eax
+     d0a:	ff 35 00 20 00 00    	push   0x2000
+     d10:	e8 13 fa ff ff       	call   728 <fstat>
+     d15:	83 c4 10             	add    $0x10,%esp
+     d18:	89 c2                	mov    %eax,%edx
+      stdout.mode = _IOFBF;
+     d1a:	b8 01 00 00 00       	mov    $0x1,%eax
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+     d1f:	85 d2                	test   %edx,%edx
+     d21:	75 10                	jne    d33 <printf+0xe3>
+      stdout.mode = _IOLBF;
+     d23:	31 c0                	xor    %eax,%eax
+     d25:	66 83 bd e8 fd ff ff 	cmpw   $0x3,-0x218(%ebp)
+     d2c:	03 
+     d2d:	0f 94 c0             	sete   %al
+     d30:	83 c0 01             	add    $0x1,%eax
+     d33:	a3 04 20 00 00       	mov    %eax,0x2004
+    flushhook = flushall;
+     d38:	c7 05 10 22 00 00 40 	movl   $0x840,0x2210
+     d3f:	08 00 00 
+     d42:	eb 85                	jmp    cc9 <printf+0x79>
+     d44:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(b->n > 0)
+     d48:	8b 85 f0 fd ff ff    	mov    -0x210(%ebp),%eax
+     d4e:	85 c0                	test   %eax,%eax
+     d50:	0f 8e 50 ff ff ff    	jle    ca6 <printf+0x56>
+    b = &local;
+     d56:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+    _write(b->fd, b->buf, b->n);
+     d5c:	83 ec 04             	sub    $0x4,%esp
+     d5f:	50                   	push   %eax
+     d60:	8d 43 0c             	lea    0xc(%ebx),%eax
+     d63:	50                   	push   %eax
+     d64:	ff 33                	push   (%ebx)
+     d66:	e8 85 f9 ff ff       	call   6f0 <_write>
+  b->n = 0;
+     d6b:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  if(b == &stdout)
+     d72:	83 c4 10             	add    $0x10,%esp
+     d75:	81 fb 00 20 00 00    	cmp    $0x2000,%ebx
+     d7b:	0f 85 25 ff ff ff    	jne    ca6 <printf+0x56>
+     d81:	e9 5f ff ff ff       	jmp    ce5 <printf+0x95>
+     d86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d8d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(b->n > 0)
+     d90:	a1 08 20 00 00       	mov    0x2008,%eax
+    b = getstdout();
+     d95:	bb 00 20 00 00       	mov    $0x2000,%ebx
+  if(b->n > 0)
+     d9a:	85 c0                	test   %eax,%eax
+     d9c:	7f be                	jg     d5c <printf+0x10c>
+  b->n = 0;
+     d9e:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     da5:	00 00 00 
+  if(b == &stdout)
+     da8:	e9 38 ff ff ff       	jmp    ce5 <printf+0x95>
+     dad:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000db0 <sprintf>:
+
+// Print to the given buffer. Only understands %d, %x, %p, %s, %c.
+int
+sprintf(char *str, const char *fmt, ...)
+{
+     db0:	55                   	push   %ebp
+     db1:	89 e5                	mov    %esp,%ebp
+     db3:	53                   	push   %ebx
+  struct outbuf b;
+
+  b.str = str;
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+     db4:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+     dba:	8d 4d 10             	lea    0x10(%ebp),%ecx
+{
+     dbd:	81 ec 14 02 00 00    	sub    $0x214,%esp
+     dc3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+     dc6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  b.str = str;
+     dc9:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+     dcc:	e8 2f fc ff ff       	call   a00 <format>
+  *b.str = '\0';
+     dd1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     dd4:	c6 00 00             	movb   $0x0,(%eax)
+  return b.str - str;
+     dd7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     dda:	29 d8                	sub    %ebx,%eax
+}
+     ddc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     ddf:	c9                   	leave
+     de0:	c3                   	ret
+     de1:	66 90                	xchg   %ax,%ax
+     de3:	66 90                	xchg   %ax,%ax
+     de5:	66 90                	xchg   %ax,%ax
+     de7:	66 90                	xchg   %ax,%ax
+     de9:	66 90                	xchg   %ax,%ax
+     deb:	66 90                	xchg   %ax,%ax
+     ded:	66 90                	xchg   %ax,%ax
+     def:	90                   	nop
+
+00000df0 <freeblock>:
+static Header *freep;
+static struct umutex lock;  // threads made by clone() share the heap
+
+static void
+freeblock(void *ap)
+{
+     df0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+     df1:	8d 48 f8             	lea    -0x8(%eax),%ecx
+{
+     df4:	89 e5                	mov    %esp,%ebp
+     df6:	57                   	push   %edi
+     df7:	56                   	push   %esi
+     df8:	53                   	push   %ebx
+     df9:	89 c3                	mov    %eax,%ebx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     dfb:	a1 1c 22 00 00       	mov    0x221c,%eax
+     e00:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     e02:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     e04:	39 ca                	cmp    %ecx,%edx
+     e06:	73 30                	jae    e38 <freeblock+0x48>
+     e08:	39 c1                	cmp    %eax,%ecx
+     e0a:	72 04                	jb     e10 <freeblock+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     e0c:	39 c2                	cmp    %eax,%edx
+     e0e:	72 f0                	jb     e00 <freeblock+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     e10:	8b 73 fc             	mov    -0x4(%ebx),%esi
+     e13:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+     e16:	39 f8                	cmp    %edi,%eax
+     e18:	74 26                	je     e40 <freeblock+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+     e1a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+     e1d:	8b 42 04             	mov    0x4(%edx),%eax
+     e20:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     e23:	39 f1                	cmp    %esi,%ecx
+     e25:	74 30                	je     e57 <freeblock+0x67>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+     e27:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+     e29:	5b                   	pop    %ebx
+  freep = p;
+     e2a:	89 15 1c 22 00 00    	mov    %edx,0x221c
+}
+     e30:	5e                   	pop    %esi
+     e31:	5f                   	pop    %edi
+     e32:	5d                   	pop    %ebp
+     e33:	c3                   	ret
+     e34:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     e38:	39 c1                	cmp    %eax,%ecx
+     e3a:	72 d0                	jb     e0c <freeblock+0x1c>
+     e3c:	eb c2                	jmp    e00 <freeblock+0x10>
+     e3e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+     e40:	03 70 04             	add    0x4(%eax),%esi
+     e43:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     e46:	8b 02                	mov    (%edx),%eax
+     e48:	8b 00                	mov    (%eax),%eax
+     e4a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+     e4d:	8b 42 04             	mov    0x4(%edx),%eax
+     e50:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     e53:	39 f1                	cmp    %esi,%ecx
+     e55:	75 d0                	jne    e27 <freeblock+0x37>
+    p->s.size += bp->s.size;
+     e57:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+     e5a:	89 15 1c 22 00 00    	mov    %edx,0x221c
+    p->s.size += bp->s.size;
+     e60:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+     e63:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+     e66:	89 0a                	mov    %ecx,(%edx)
+}
+     e68:	5b                   	pop    %ebx
+     e69:	5e                   	pop    %esi
+     e6a:	5f                   	pop    %edi
+     e6b:	5d                   	pop    %ebp
+     e6c:	c3                   	ret
+     e6d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000e70 <free>:
+
+void
+free(void *ap)
+{
+     e70:	55                   	push   %ebp
+     e71:	89 e5                	mov    %esp,%ebp
+     e73:	53                   	push   %ebx
+     e74:	83 ec 10             	sub    $0x10,%esp
+     e77:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  umtxlock(&lock);
+     e7a:	68 18 22 00 00       	push   $0x2218
+     e7f:	e8 cc f7 ff ff       	call   650 <umtxlock>
+  freeblock(ap);
+     e84:	89 d8                	mov    %ebx,%eax
+     e86:	e8 65 ff ff ff       	call   df0 <freeblock>
+  umtxunlock(&lock);
+     e8b:	c7 45 08 18 22 00 00 	movl   $0x2218,0x8(%ebp)
+}
+     e92:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&lock);
+     e95:	83 c4 10             	add    $0x10,%esp
+}
+     e98:	c9                   	leave
+  umtxunlock(&lock);
+     e99:	e9 02 f8 ff ff       	jmp    6a0 <umtxunlock>
+     e9e:	66 90                	xchg   %ax,%ax
+
+00000ea0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+     ea0:	55                   	push   %ebp
+     ea1:	89 e5                	mov    %esp,%ebp
+     ea3:	57                   	push   %edi
+     ea4:	56                   	push   %esi
+     ea5:	53                   	push   %ebx
+     ea6:	83 ec 28             	sub    $0x28,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     ea9:	8b 45 08             	mov    0x8(%ebp),%eax
+  umtxlock(&lock);
+     eac:	68 18 22 00 00       	push   $0x2218
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     eb1:	8d 48 07             	lea    0x7(%eax),%ecx
+     eb4:	c1 e9 03             	shr    $0x3,%ecx
+     eb7:	8d 71 01             	lea    0x1(%ecx),%esi
+  umtxlock(&lock);
+     eba:	e8 91 f7 ff ff       	call   650 <umtxlock>
+  if((prevp = freep) == 0){
+     ebf:	8b 15 1c 22 00 00    	mov    0x221c,%edx
+     ec5:	83 c4 10             	add    $0x10,%esp
+     ec8:	85 d2                	test   %edx,%edx
+     eca:	0f 84 b0 00 00 00    	je     f80 <malloc+0xe0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     ed0:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+     ed2:	8b 47 04             	mov    0x4(%edi),%eax
+     ed5:	39 f0                	cmp    %esi,%eax
+     ed7:	73 6f                	jae    f48 <malloc+0xa8>
+  if(nu < 4096)
+     ed9:	bb 00 10 00 00       	mov    $0x1000,%ebx
+     ede:	39 de                	cmp    %ebx,%esi
+     ee0:	0f 43 de             	cmovae %esi,%ebx
+  p = sbrk(nu * sizeof(Header));
+     ee3:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+     eea:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     eed:	eb 0a                	jmp    ef9 <malloc+0x59>
+     eef:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     ef0:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+     ef2:	8b 47 04             	mov    0x4(%edi),%eax
+     ef5:	39 f0                	cmp    %esi,%eax
+     ef7:	73 4f                	jae    f48 <malloc+0xa8>
+      }
+      freep = prevp;
+      umtxunlock(&lock);
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+     ef9:	89 fa                	mov    %edi,%edx
+     efb:	39 3d 1c 22 00 00    	cmp    %edi,0x221c
+     f01:	75 ed                	jne    ef0 <malloc+0x50>
+  p = sbrk(nu * sizeof(Header));
+     f03:	83 ec 0c             	sub    $0xc,%esp
+     f06:	ff 75 e4             	push   -0x1c(%ebp)
+     f09:	e8 4a f8 ff ff       	call   758 <sbrk>
+  if(p == (char*)-1)
+     f0e:	83 c4 10             	add    $0x10,%esp
+     f11:	83 f8 ff             	cmp    $0xffffffff,%eax
+     f14:	74 15                	je     f2b <malloc+0x8b>
+  hp->s.size = nu;
+     f16:	89 58 04             	mov    %ebx,0x4(%eax)
+  freeblock((void*)(hp + 1));
+     f19:	83 c0 08             	add    $0x8,%eax
+     f1c:	e8 cf fe ff ff       	call   df0 <freeblock>
+  return freep;
+     f21:	8b 15 1c 22 00 00    	mov    0x221c,%edx
+      if((p = morecore(nunits)) == 0){
+     f27:	85 d2                	test   %edx,%edx
+     f29:	75 c5                	jne    ef0 <malloc+0x50>
+        umtxunlock(&lock);
+     f2b:	83 ec 0c             	sub    $0xc,%esp
+     f2e:	68 18 22 00 00       	push   $0x2218
+     f33:	e8 68 f7 ff ff       	call   6a0 <umtxunlock>
+        return 0;
+     f38:	83 c4 10             	add    $0x10,%esp
+      }
+  }
+}
+     f3b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+     f3e:	31 c0                	xor    %eax,%eax
+}
+     f40:	5b                   	pop    %ebx
+     f41:	5e                   	pop    %esi
+     f42:	5f                   	pop    %edi
+     f43:	5d                   	pop    %ebp
+     f44:	c3                   	ret
+     f45:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+     f48:	39 c6                	cmp    %eax,%esi
+     f4a:	74 64                	je     fb0 <malloc+0x110>
+        p->s.size -= nunits;
+     f4c:	29 f0                	sub    %esi,%eax
+     f4e:	89 47 04             	mov    %eax,0x4(%edi)
+        p += p->s.size;
+     f51:	8d 3c c7             	lea    (%edi,%eax,8),%edi
+        p->s.size = nunits;
+     f54:	89 77 04             	mov    %esi,0x4(%edi)
+      umtxunlock(&lock);
+     f57:	83 ec 0c             	sub    $0xc,%esp
+      freep = prevp;
+     f5a:	89 15 1c 22 00 00    	mov    %edx,0x221c
+      umtxunlock(&lock);
+     f60:	68 18 22 00 00       	push   $0x2218
+     f65:	e8 36 f7 ff ff       	call   6a0 <umtxunlock>
+      return (void*)(p + 1);
+     f6a:	83 c4 10             	add    $0x10,%esp
+}
+     f6d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+     f70:	8d 47 08             	lea    0x8(%edi),%eax
+}
+     f73:	5b                   	pop    %ebx
+     f74:	5e                   	pop    %esi
+     f75:	5f                   	pop    %edi
+     f76:	5d                   	pop    %ebp
+     f77:	c3                   	ret
+     f78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f7f:	90                   	nop
+    base.s.ptr = freep = prevp = &base;
+     f80:	c7 05 1c 22 00 00 20 	movl   $0x2220,0x221c
+     f87:	22 00 00 
+    base.s.size = 0;
+     f8a:	bf 20 22 00 00       	mov    $0x2220,%edi
+    base.s.ptr = freep = prevp = &base;
+     f8f:	c7 05 20 22 00 00 20 	movl   $0x2220,0x2220
+     f96:	22 00 00 
+    base.s.size = 0;
+     f99:	c7 05 24 22 00 00 00 	movl   $0x0,0x2224
+     fa0:	00 00 00 
+    if(p->s.size >= nunits){
+     fa3:	e9 31 ff ff ff       	jmp    ed9 <malloc+0x39>
+     fa8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     faf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+     fb0:	8b 07                	mov    (%edi),%eax
+     fb2:	89 02                	mov    %eax,(%edx)
+     fb4:	eb a1                	jmp    f57 <malloc+0xb7>
+     fb6:	66 90                	xchg   %ax,%ax
+     fb8:	66 90                	xchg   %ax,%ax
+     fba:	66 90                	xchg   %ax,%ax
+     fbc:	66 90                	xchg   %ax,%ax
+     fbe:	66 90                	xchg   %ax,%ax
+
+00000fc0 <threadstart>:
+
+#define TSTACKSZ 4096
+
+static void
+threadstart(void *fn, void *arg)
+{
+     fc0:	55                   	push   %ebp
+     fc1:	89 e5                	mov    %esp,%ebp
+     fc3:	83 ec 14             	sub    $0x14,%esp
+  ((void (*)(void*))fn)(arg);
+     fc6:	ff 75 0c             	push   0xc(%ebp)
+     fc9:	ff 55 08             	call   *0x8(%ebp)
+  exit();
+     fcc:	e8 ef f4 ff ff       	call   4c0 <exit>
+     fd1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fd8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fdf:	90                   	nop
+
+00000fe0 <thread_create>:
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+     fe0:	55                   	push   %ebp
+     fe1:	89 e5                	mov    %esp,%ebp
+     fe3:	53                   	push   %ebx
+     fe4:	83 ec 20             	sub    $0x20,%esp
+  char *mem, *stack;
+  int pid;
+
+  if((mem = malloc(2*TSTACKSZ)) == 0)
+     fe7:	68 00 20 00 00       	push   $0x2000
+     fec:	e8 af fe ff ff       	call   ea0 <malloc>
+     ff1:	83 c4 10             	add    $0x10,%esp
+     ff4:	85 c0                	test   %eax,%eax
+     ff6:	74 47                	je     103f <thread_create+0x5f>
+     ff8:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)(((uint)mem + TSTACKSZ - 1) & ~(TSTACKSZ - 1));
+     ffa:	8d 80 ff 0f 00 00    	lea    0xfff(%eax),%eax
+    1000:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  *(char**)stack = mem;
+    1005:	89 18                	mov    %ebx,(%eax)
+  if((pid = clone(threadstart, (void*)fn, arg, stack)) < 0)
+    1007:	50                   	push   %eax
+    1008:	ff 75 0c             	push   0xc(%ebp)
+    100b:	ff 75 08             	push   0x8(%ebp)
+    100e:	68 c0 0f 00 00       	push   $0xfc0
+    1013:	e8 08 f8 ff ff       	call   820 <clone>
+    1018:	83 c4 10             	add    $0x10,%esp
+    101b:	85 c0                	test   %eax,%eax
+    101d:	78 09                	js     1028 <thread_create+0x48>
+    free(mem);
+  return pid;
+}
+    101f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1022:	c9                   	leave
+    1023:	c3                   	ret
+    1024:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    free(mem);
+    1028:	83 ec 0c             	sub    $0xc,%esp
+    102b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    102e:	53                   	push   %ebx
+    102f:	e8 3c fe ff ff       	call   e70 <free>
+    1034:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    1037:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+    103a:	83 c4 10             	add    $0x10,%esp
+}
+    103d:	c9                   	leave
+    103e:	c3                   	ret
+    return -1;
+    103f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1044:	eb d9                	jmp    101f <thread_create+0x3f>
+    1046:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    104d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001050 <thread_join>:
+
+int
+thread_join(void)
+{
+    1050:	55                   	push   %ebp
+    1051:	89 e5                	mov    %esp,%ebp
+    1053:	83 ec 34             	sub    $0x34,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    1056:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    1059:	50                   	push   %eax
+    105a:	e8 c9 f7 ff ff       	call   828 <join>
+    105f:	83 c4 10             	add    $0x10,%esp
+    1062:	85 c0                	test   %eax,%eax
+    1064:	79 0a                	jns    1070 <thread_join+0x20>
+    free(*(char**)stack);
+  return pid;
+}
+    1066:	c9                   	leave
+    1067:	c3                   	ret
+    1068:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    106f:	90                   	nop
+    free(*(char**)stack);
+    1070:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1073:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1076:	83 ec 0c             	sub    $0xc,%esp
+    1079:	ff 32                	push   (%edx)
+    107b:	e8 f0 fd ff ff       	call   e70 <free>
+    1080:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1083:	83 c4 10             	add    $0x10,%esp
+}
+    1086:	c9                   	leave
+    1087:	c3                   	ret
@@ -0,0 +1,82 @@
+// Random access over a 32MB heap array, mapped once with 4MB
+// pages (one sbrk() of the whole array) and once with 4KB pages
+// (the same array grown 1MB at a time, so that no sbrk() covers
+// an aligned 4MB stretch). Each access lands on a random page,
+// so the 4KB mapping needs a TLB entry per page touched while
+// the 4MB mapping needs one per 1024 pages. Also times growing
+// the heap and forking a copy of it.
+//
+// The 4MB run goes first: 4MB chunks that the kernel breaks up
+// for 4KB pages are not put back together.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+#define LPG     (4*1024*1024)
+#define SIZE    (32*1024*1024)
+#define STEP    (1024*1024)
+#define NACCESS (4*1024*1024)
+
+uint
+walk(int *a)
+{
+  uint x, s;
+  int i;
+
+  x = 1;
+  s = 0;
+  for(i = 0; i < NACCESS; i++){
+    x = x * 1103515245 + 12345;
+    s += a[(x >> 8) % (SIZE / sizeof(int))]++;
+  }
+  return s;
+}
+
+void
+run(char *name, int large)
+{
+  char *oldbrk, *a;
+  int i, t0, tsbrk, tfork, twalk;
+
+  oldbrk = sbrk(0);
+  if((uint)oldbrk % LPG != 0)
+    sbrk(LPG - (uint)oldbrk % LPG);
+
+  t0 = uptime();
+  if(large){
+    a = sbrk(SIZE);
+  } else {
+    a = sbrk(0);
+    for(i = 0; i < SIZE; i += STEP)
+      if(sbrk(STEP) == (char*)-1)
+        a = (char*)-1;
+  }
+  tsbrk = uptime() - t0;
+  if(a == (char*)-1){
+    printf(1, "tlbbench: sbrk failed\n");
+    exit();
+  }
+
+  t0 = uptime();
+  if(fork() == 0)
+    exit();
+  wait();
+  tfork = uptime() - t0;
+
+  t0 = uptime();
+  walk((int*)a);
+  twalk = uptime() - t0;
+
+  printf(1, "tlbbench: %s: sbrk %d ticks, fork %d ticks, %d random accesses %d ticks\n",
+         name, tsbrk, tfork, NACCESS, twalk);
+  sbrk(oldbrk - sbrk(0));
+}
+
+int
+main(int argc, char *argv[])
+{
+  run("4MB pages", 1);
+  run("4KB pages", 0);
+  exit();
+}
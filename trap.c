@@ -13,6 +13,33 @@ struct gatedesc idt[256];
 extern uint vectors[];  // in vectors.S: array of 256 entry pointers
 struct spinlock tickslock;
 uint ticks;
+uint npgfault;  // page faults taken, for iostat()
+
+// Kernel instructions that may fault on user memory, and
+// where each resumes if it does; in copyuser.S.
+struct extable {
+  uint insn;
+  uint fixup;
+};
+extern struct extable extable[];
+
+// If the kernel faulted on user memory at an instruction in
+// extable, resume at its fixup and return 1.
+static int
+fixup(struct trapframe *tf, uint faultaddr)
+{
+  struct extable *e;
+
+  if((tf->cs&3) != 0 || faultaddr >= KERNBASE)
+    return 0;
+  for(e = extable; e->insn; e++){
+    if(tf->eip == e->insn){
+      tf->eip = e->fixup;
+      return 1;
+    }
+  }
+  return 0;
+}
 
 void
 tvinit(void)
@@ -50,24 +77,52 @@ trap(struct trapframe *tf)
   {
     uint faultaddr;
     struct proc *curproc = myproc();
-    if(curproc->killed)
-      exit();
-    curproc->tf = tf;
+    int r, user;
+
     faultaddr = rcr2();
-    if (faultaddr < curproc->stacksz - PGSIZE || faultaddr >= KERNBASE - PGSIZE)
-    {
-      cprintf("T_PGFLT@%p: not stack, DIE!\n", faultaddr);
-      goto trap_panic_kill; 
+    __sync_fetch_and_add(&npgfault, 1);
+    // copyin() or copyout() found user memory missing: the
+    // caller may hold locks, so let it fail rather than sleep
+    // here bringing the page in.
+    if(fixup(tf, faultaddr))
+      return;
+    // Swapped out pages fault in the kernel too, when it
+    // reads or writes system call arguments.
+    if(curproc && curproc->vm &&
+       (r = swapfault(curproc->vm, faultaddr, tf->err & FEC_WR)) != 0){
+      if(r < 0){
+        cprintf("T_PGFLT@%p: no memory to swap in, DIE!\n", faultaddr);
+        goto trap_panic_kill;
+      }
+      if(curproc->killed && (tf->cs&3) == DPL_USER)
+        exit();
+      return;
     }
-
-    if(allocuvm(curproc->pgdir, curproc->stacksz - PGSIZE, curproc->stacksz) == 0)
-    {
-      cprintf("T_PGFLT@%p: WTF alloc fail, DIE!\n", faultaddr);
+    if(curproc == 0)
+      goto trap_panic_kill;
+    // A fault in the kernel, in the middle of a system call,
+    // must leave the call's trap frame alone and not exit()
+    // with locks held; the call notices the kill on return.
+    user = (tf->cs&3) == DPL_USER;
+    if(user){
+      if(curproc->killed)
+        exit();
+      curproc->tf = tf;
+    }
+    if(vmalookup(curproc, faultaddr)){
+      if(vmafault(curproc, faultaddr, tf->err & FEC_WR) < 0){
+        cprintf("T_PGFLT@%p: bad access to mapped region, DIE!\n", faultaddr);
+        goto trap_panic_kill;
+      }
+      if(user && curproc->killed)
+        exit();
+      return;
+    }
+    if(growstack(faultaddr) < 0){
+      cprintf("T_PGFLT@%p: not stack, DIE!\n", faultaddr);
       goto trap_panic_kill;
     }
-    curproc->stacksz -= PGSIZE;
-    // cprintf("T_PGFLT@%p: increase stack from %p to %p \n", faultaddr, curproc->stacksz + PGSIZE, curproc->stacksz);
-    if(curproc->killed)
+    if(user && curproc->killed)
       exit();
     return;
   }
@@ -82,6 +137,14 @@ trap(struct trapframe *tf)
     }
     lapiceoi();
     break;
+  case T_IRQ0 + IRQ_WAKEUP:
+    // Only there to end an idle CPU's hlt.
+    lapiceoi();
+    break;
+  case T_IRQ0 + IRQ_TLB:
+    tlbintr();
+    lapiceoi();
+    break;
   case T_IRQ0 + IRQ_IDE:
     ideintr();
     lapiceoi();
@@ -118,7 +181,7 @@ trap(struct trapframe *tf)
             "eip 0x%x addr 0x%x--kill proc\n",
             myproc()->pid, myproc()->name, tf->trapno,
             tf->err, cpuid(), tf->eip, rcr2());
-    myproc()->killed = 1;
+    kill(myproc()->pid);
   }
 
   // Force process exit if it has been killed and is in user space.
@@ -40,6 +40,21 @@ memset(void *dst, int c, uint n)
   return dst;
 }
 
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+  }
+  return 0;
+}
+
 char*
 strchr(const char *s, char c)
 {
@@ -104,3 +119,105 @@ memmove(void *vdst, const void *vsrc, int n)
     *dst++ = *src++;
   return vdst;
 }
+
+// Buffered output from printf.c must reach its fd before the
+// process exits, forks (or the child would print it again),
+// runs a new program, reads (which may wait on the user for
+// a prompt still in the buffer), writes (or a write to fd 1
+// would land ahead of it) or closes a file. printf.c
+// sets flushhook the first time it buffers anything, so that
+// programs that never print do not link it in.
+void (*flushhook)(void);
+
+int
+fork(void)
+{
+  if(flushhook)
+    flushhook();
+  return _fork();
+}
+
+int
+exit(void)
+{
+  if(flushhook)
+    flushhook();
+  _exit();
+}
+
+int
+exec(char *path, char **argv)
+{
+  if(flushhook)
+    flushhook();
+  return _exec(path, argv);
+}
+
+int
+read(int fd, void *buf, int n)
+{
+  if(flushhook)
+    flushhook();
+  return _read(fd, buf, n);
+}
+
+int
+readv(int fd, const struct iovec *iov, int cnt)
+{
+  if(flushhook)
+    flushhook();
+  return _readv(fd, iov, cnt);
+}
+
+int
+write(int fd, const void *buf, int n)
+{
+  if(flushhook)
+    flushhook();
+  return _write(fd, buf, n);
+}
+
+int
+writev(int fd, const struct iovec *iov, int cnt)
+{
+  if(flushhook)
+    flushhook();
+  return _writev(fd, iov, cnt);
+}
+
+int
+close(int fd)
+{
+  if(flushhook)
+    flushhook();
+  return _close(fd);
+}
+
+// User-space mutexes. Taking a free mutex and releasing one
+// nobody waits for are a single atomic exchange each; only a
+// process that finds the mutex held enters the kernel, to sleep
+// in futexwait() until the holder's umtxunlock() wakes it.
+
+void
+umtxinit(struct umutex *m)
+{
+  m->state = 0;
+}
+
+void
+umtxlock(struct umutex *m)
+{
+  if(xchg(&m->state, 1) == 0)
+    return;
+  // Mark the mutex contended, so that its holder
+  // wakes a waiter on release, and wait.
+  while(xchg(&m->state, 2) != 0)
+    futexwait(&m->state, 2);
+}
+
+void
+umtxunlock(struct umutex *m)
+{
+  if(xchg(&m->state, 0) == 2)
+    futexwake(&m->state, 1);
+}
@@ -1,5 +1,8 @@
 struct stat;
 struct rtcdate;
+struct iostat;
+struct iovec;
+struct lockstat;
 
 // system calls
 int fork(void);
@@ -29,6 +32,35 @@ int mtxget(void);
 int mtxrel(int);
 int mtxacq(int);
 int mtxdel(int);
+int iostat(struct iostat*);
+void* mmap(void*, int, int, int, int, int);
+int munmap(void*, int);
+int shmget(int, int);
+void* shmat(int);
+int shmdt(void*);
+int shmdel(int);
+int syscount(void);
+int splice(int, int, int);
+int tee(int, int, int);
+int sendfile(int, int, int);
+int readv(int, const struct iovec*, int);
+int writev(int, const struct iovec*, int);
+int futexwait(volatile uint*, int);
+int futexwake(volatile uint*, int);
+int lockstat(struct lockstat*, int);
+int clone(void (*)(void*, void*), void*, void*, void*);
+int join(void**);
+int stacklimit(int, int);
+
+// raw system calls, which do not flush buffered output
+int _fork(void);
+int _exit(void) __attribute__((noreturn));
+int _read(int, void*, int);
+int _readv(int, const struct iovec*, int);
+int _write(int, const void*, int);
+int _writev(int, const struct iovec*, int);
+int _close(int);
+int _exec(char*, char**);
 
 // ulib.c
 int stat(const char*, struct stat*);
@@ -38,9 +70,29 @@ char* strchr(const char*, char c);
 int strcmp(const char*, const char*);
 void printf(int, const char*, ...);
 int sprintf(char*, const char*, ...);
+void fflush(int);        // fd 1 is the only one buffered
+void setvbuf(int, int);
+#define _IOFBF 1  // buffer output until the buffer fills
+#define _IOLBF 2  // buffer output until a newline
+#define _IONBF 3  // write output at the end of each printf()
 char* gets(char*, int max);
 uint strlen(const char*);
 void* memset(void*, int, uint);
+int memcmp(const void*, const void*, uint);
 void* malloc(uint);
 void free(void*);
 int atoi(const char*);
+extern void (*flushhook)(void);
+
+// A mutex in memory shared by the processes that use it.
+// Zero-filled, as in a new shared memory segment, is unlocked.
+struct umutex {
+  volatile uint state;  // 0 unlocked, 1 locked, 2 locked with waiters
+};
+void umtxinit(struct umutex*);
+void umtxlock(struct umutex*);
+void umtxunlock(struct umutex*);
+
+// uthread.c
+int thread_create(void (*)(void*), void*);
+int thread_join(void);
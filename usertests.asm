@@ -0,0 +1,11284 @@
+
+_usertests:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <threadspin>:
+// clone() threads share memory, including memory one
+// of them allocates, and join() reaps them.
+void
+threadspin(void *arg)
+{
+  for(;;)
+       0:	eb fe                	jmp    0 <threadspin>
+       2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+       9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000010 <threadclose>:
+}
+
+void
+threadclose(void *arg)
+{
+  close((int)arg);
+      10:	e9 0b 5c 00 00       	jmp    5c20 <close>
+      15:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000020 <texttest>:
+{
+      20:	55                   	push   %ebp
+      21:	89 e5                	mov    %esp,%ebp
+      23:	57                   	push   %edi
+      24:	56                   	push   %esi
+      25:	53                   	push   %ebx
+      26:	83 ec 34             	sub    $0x34,%esp
+  char *args[] = { "echo", "texttest", "ok", 0 };
+      29:	c7 45 d8 98 66 00 00 	movl   $0x6698,-0x28(%ebp)
+      30:	c7 45 dc 9d 66 00 00 	movl   $0x669d,-0x24(%ebp)
+      37:	c7 45 e0 1c 7e 00 00 	movl   $0x7e1c,-0x20(%ebp)
+      3e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  printf(1, "text test\n");
+      45:	68 a6 66 00 00       	push   $0x66a6
+      4a:	6a 01                	push   $0x1
+      4c:	e8 0f 62 00 00       	call   6260 <printf>
+  ppid = getpid();
+      51:	e8 0a 5d 00 00       	call   5d60 <getpid>
+      56:	89 c3                	mov    %eax,%ebx
+  pid = fork();
+      58:	e8 43 5a 00 00       	call   5aa0 <fork>
+  if(pid < 0){
+      5d:	83 c4 10             	add    $0x10,%esp
+      60:	85 c0                	test   %eax,%eax
+      62:	0f 88 ae 01 00 00    	js     216 <texttest+0x1f6>
+  if(pid == 0){
+      68:	0f 84 cf 01 00 00    	je     23d <texttest+0x21d>
+  wait();
+      6e:	e8 75 5c 00 00       	call   5ce8 <wait>
+  if(munmap((void*)((uint)texttest & ~4095), 4096) != -1){
+      73:	b8 20 00 00 00       	mov    $0x20,%eax
+      78:	83 ec 08             	sub    $0x8,%esp
+      7b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+      80:	68 00 10 00 00       	push   $0x1000
+      85:	50                   	push   %eax
+      86:	e8 35 5d 00 00       	call   5dc0 <munmap>
+      8b:	83 c4 10             	add    $0x10,%esp
+      8e:	83 f8 ff             	cmp    $0xffffffff,%eax
+      91:	0f 85 93 01 00 00    	jne    22a <texttest+0x20a>
+  if((fd = open("usertests", O_RDONLY)) < 0 ||
+      97:	83 ec 08             	sub    $0x8,%esp
+      9a:	6a 00                	push   $0x0
+      9c:	68 cb 66 00 00       	push   $0x66cb
+      a1:	e8 7a 5c 00 00       	call   5d20 <open>
+      a6:	83 c4 10             	add    $0x10,%esp
+      a9:	89 c3                	mov    %eax,%ebx
+      ab:	85 c0                	test   %eax,%eax
+      ad:	0f 88 4f 01 00 00    	js     202 <texttest+0x1e2>
+     read(fd, buf, 4096) != 4096 || read(fd, &c, 1) != 1){
+      b3:	83 ec 04             	sub    $0x4,%esp
+      b6:	68 00 10 00 00       	push   $0x1000
+      bb:	68 60 c9 00 00       	push   $0xc960
+      c0:	50                   	push   %eax
+      c1:	e8 5a 5a 00 00       	call   5b20 <read>
+  if((fd = open("usertests", O_RDONLY)) < 0 ||
+      c6:	83 c4 10             	add    $0x10,%esp
+      c9:	3d 00 10 00 00       	cmp    $0x1000,%eax
+      ce:	0f 85 2e 01 00 00    	jne    202 <texttest+0x1e2>
+     read(fd, buf, 4096) != 4096 || read(fd, &c, 1) != 1){
+      d4:	83 ec 04             	sub    $0x4,%esp
+      d7:	8d 75 d7             	lea    -0x29(%ebp),%esi
+      da:	6a 01                	push   $0x1
+      dc:	56                   	push   %esi
+      dd:	53                   	push   %ebx
+      de:	e8 3d 5a 00 00       	call   5b20 <read>
+      e3:	83 c4 10             	add    $0x10,%esp
+      e6:	83 f8 01             	cmp    $0x1,%eax
+      e9:	0f 85 13 01 00 00    	jne    202 <texttest+0x1e2>
+  close(fd);
+      ef:	83 ec 0c             	sub    $0xc,%esp
+      f2:	53                   	push   %ebx
+      f3:	e8 28 5b 00 00       	call   5c20 <close>
+  if((fd = open("usertests", O_RDWR)) < 0 ||
+      f8:	5f                   	pop    %edi
+      f9:	58                   	pop    %eax
+      fa:	6a 02                	push   $0x2
+      fc:	68 cb 66 00 00       	push   $0x66cb
+     101:	e8 1a 5c 00 00       	call   5d20 <open>
+     106:	83 c4 10             	add    $0x10,%esp
+     109:	89 c3                	mov    %eax,%ebx
+     10b:	85 c0                	test   %eax,%eax
+     10d:	0f 88 db 00 00 00    	js     1ee <texttest+0x1ce>
+     (p = mmap(0, 4096, PROT_READ, MAP_SHARED, fd, 4096)) == MAP_FAILED ||
+     113:	83 ec 08             	sub    $0x8,%esp
+     116:	68 00 10 00 00       	push   $0x1000
+     11b:	50                   	push   %eax
+     11c:	6a 01                	push   $0x1
+     11e:	6a 01                	push   $0x1
+     120:	68 00 10 00 00       	push   $0x1000
+     125:	6a 00                	push   $0x0
+     127:	e8 8c 5c 00 00       	call   5db8 <mmap>
+  if((fd = open("usertests", O_RDWR)) < 0 ||
+     12c:	83 c4 20             	add    $0x20,%esp
+     (p = mmap(0, 4096, PROT_READ, MAP_SHARED, fd, 4096)) == MAP_FAILED ||
+     12f:	89 c7                	mov    %eax,%edi
+  if((fd = open("usertests", O_RDWR)) < 0 ||
+     131:	83 f8 ff             	cmp    $0xffffffff,%eax
+     134:	0f 84 b4 00 00 00    	je     1ee <texttest+0x1ce>
+     (p = mmap(0, 4096, PROT_READ, MAP_SHARED, fd, 4096)) == MAP_FAILED ||
+     13a:	0f b6 45 d7          	movzbl -0x29(%ebp),%eax
+     13e:	38 07                	cmp    %al,(%edi)
+     140:	0f 85 a8 00 00 00    	jne    1ee <texttest+0x1ce>
+     p[0] != c || read(fd, buf, 4096) != 4096 || write(fd, &c, 1) != 1){
+     146:	83 ec 04             	sub    $0x4,%esp
+     149:	68 00 10 00 00       	push   $0x1000
+     14e:	68 60 c9 00 00       	push   $0xc960
+     153:	53                   	push   %ebx
+     154:	e8 c7 59 00 00       	call   5b20 <read>
+     159:	83 c4 10             	add    $0x10,%esp
+     15c:	3d 00 10 00 00       	cmp    $0x1000,%eax
+     161:	0f 85 87 00 00 00    	jne    1ee <texttest+0x1ce>
+     167:	83 ec 04             	sub    $0x4,%esp
+     16a:	6a 01                	push   $0x1
+     16c:	56                   	push   %esi
+     16d:	53                   	push   %ebx
+     16e:	e8 2d 5a 00 00       	call   5ba0 <write>
+     173:	83 c4 10             	add    $0x10,%esp
+     176:	83 f8 01             	cmp    $0x1,%eax
+     179:	75 73                	jne    1ee <texttest+0x1ce>
+  close(fd);
+     17b:	83 ec 0c             	sub    $0xc,%esp
+     17e:	53                   	push   %ebx
+     17f:	e8 9c 5a 00 00       	call   5c20 <close>
+  if(p[0] != c){
+     184:	0f b6 45 d7          	movzbl -0x29(%ebp),%eax
+     188:	83 c4 10             	add    $0x10,%esp
+     18b:	38 07                	cmp    %al,(%edi)
+     18d:	0f 85 07 01 00 00    	jne    29a <texttest+0x27a>
+  pid = fork();
+     193:	e8 08 59 00 00       	call   5aa0 <fork>
+  if(pid < 0){
+     198:	85 c0                	test   %eax,%eax
+     19a:	78 7a                	js     216 <texttest+0x1f6>
+  if(pid == 0)
+     19c:	0f 84 f3 00 00 00    	je     295 <texttest+0x275>
+  wait();
+     1a2:	e8 41 5b 00 00       	call   5ce8 <wait>
+  if(munmap(p, 4096) < 0){
+     1a7:	83 ec 08             	sub    $0x8,%esp
+     1aa:	68 00 10 00 00       	push   $0x1000
+     1af:	57                   	push   %edi
+     1b0:	e8 0b 5c 00 00       	call   5dc0 <munmap>
+     1b5:	83 c4 10             	add    $0x10,%esp
+     1b8:	85 c0                	test   %eax,%eax
+     1ba:	0f 88 c2 00 00 00    	js     282 <texttest+0x262>
+  pid = fork();
+     1c0:	e8 db 58 00 00       	call   5aa0 <fork>
+  if(pid < 0){
+     1c5:	85 c0                	test   %eax,%eax
+     1c7:	78 4d                	js     216 <texttest+0x1f6>
+  if(pid == 0){
+     1c9:	0f 84 90 00 00 00    	je     25f <texttest+0x23f>
+  wait();
+     1cf:	e8 14 5b 00 00       	call   5ce8 <wait>
+  printf(1, "text test ok\n");
+     1d4:	83 ec 08             	sub    $0x8,%esp
+     1d7:	68 27 67 00 00       	push   $0x6727
+     1dc:	6a 01                	push   $0x1
+     1de:	e8 7d 60 00 00       	call   6260 <printf>
+}
+     1e3:	83 c4 10             	add    $0x10,%esp
+     1e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     1e9:	5b                   	pop    %ebx
+     1ea:	5e                   	pop    %esi
+     1eb:	5f                   	pop    %edi
+     1ec:	5d                   	pop    %ebp
+     1ed:	c3                   	ret
+    printf(1, "rewrite usertests failed\n");
+     1ee:	83 ec 08             	sub    $0x8,%esp
+     1f1:	68 ec 66 00 00       	push   $0x66ec
+     1f6:	6a 01                	push   $0x1
+     1f8:	e8 63 60 00 00       	call   6260 <printf>
+    exit();
+     1fd:	e8 ce 58 00 00       	call   5ad0 <exit>
+    printf(1, "read usertests failed\n");
+     202:	83 ec 08             	sub    $0x8,%esp
+     205:	68 d5 66 00 00       	push   $0x66d5
+     20a:	6a 01                	push   $0x1
+     20c:	e8 4f 60 00 00       	call   6260 <printf>
+    exit();
+     211:	e8 ba 58 00 00       	call   5ad0 <exit>
+    printf(1, "fork failed\n");
+     216:	83 ec 08             	sub    $0x8,%esp
+     219:	68 48 7e 00 00       	push   $0x7e48
+     21e:	6a 01                	push   $0x1
+     220:	e8 3b 60 00 00       	call   6260 <printf>
+    exit();
+     225:	e8 a6 58 00 00       	call   5ad0 <exit>
+    printf(1, "munmap of program text succeeded\n");
+     22a:	50                   	push   %eax
+     22b:	50                   	push   %eax
+     22c:	68 28 7f 00 00       	push   $0x7f28
+     231:	6a 01                	push   $0x1
+     233:	e8 28 60 00 00       	call   6260 <printf>
+    exit();
+     238:	e8 93 58 00 00       	call   5ad0 <exit>
+    *(volatile char*)texttest = 0;
+     23d:	c6 05 20 00 00 00 00 	movb   $0x0,0x20
+    printf(1, "could write program text\n");
+     244:	50                   	push   %eax
+     245:	50                   	push   %eax
+     246:	68 b1 66 00 00       	push   $0x66b1
+     24b:	6a 01                	push   $0x1
+     24d:	e8 0e 60 00 00       	call   6260 <printf>
+    kill(ppid);
+     252:	89 1c 24             	mov    %ebx,(%esp)
+     255:	e8 b6 5a 00 00       	call   5d10 <kill>
+    exit();
+     25a:	e8 71 58 00 00       	call   5ad0 <exit>
+    exec("echo", args);
+     25f:	50                   	push   %eax
+     260:	50                   	push   %eax
+     261:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     264:	50                   	push   %eax
+     265:	68 98 66 00 00       	push   $0x6698
+     26a:	e8 81 58 00 00       	call   5af0 <exec>
+    printf(1, "exec echo failed\n");
+     26f:	5a                   	pop    %edx
+     270:	59                   	pop    %ecx
+     271:	68 15 67 00 00       	push   $0x6715
+     276:	6a 01                	push   $0x1
+     278:	e8 e3 5f 00 00       	call   6260 <printf>
+    exit();
+     27d:	e8 4e 58 00 00       	call   5ad0 <exit>
+    printf(1, "munmap failed\n");
+     282:	53                   	push   %ebx
+     283:	53                   	push   %ebx
+     284:	68 06 67 00 00       	push   $0x6706
+     289:	6a 01                	push   $0x1
+     28b:	e8 d0 5f 00 00       	call   6260 <printf>
+    exit();
+     290:	e8 3b 58 00 00       	call   5ad0 <exit>
+    exit();
+     295:	e8 36 58 00 00       	call   5ad0 <exit>
+    printf(1, "shared mapping of text lost the write\n");
+     29a:	56                   	push   %esi
+     29b:	56                   	push   %esi
+     29c:	68 4c 7f 00 00       	push   $0x7f4c
+     2a1:	6a 01                	push   $0x1
+     2a3:	e8 b8 5f 00 00       	call   6260 <printf>
+    exit();
+     2a8:	e8 23 58 00 00       	call   5ad0 <exit>
+     2ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002b0 <copytest>:
+{
+     2b0:	55                   	push   %ebp
+     2b1:	89 e5                	mov    %esp,%ebp
+     2b3:	57                   	push   %edi
+     2b4:	56                   	push   %esi
+     2b5:	53                   	push   %ebx
+     2b6:	83 ec 34             	sub    $0x34,%esp
+  printf(1, "copy test\n");
+     2b9:	68 35 67 00 00       	push   $0x6735
+     2be:	6a 01                	push   $0x1
+     2c0:	e8 9b 5f 00 00       	call   6260 <printf>
+  if((fd = open("usertests", O_RDONLY)) < 0){
+     2c5:	58                   	pop    %eax
+     2c6:	5a                   	pop    %edx
+     2c7:	6a 00                	push   $0x0
+     2c9:	68 cb 66 00 00       	push   $0x66cb
+     2ce:	e8 4d 5a 00 00       	call   5d20 <open>
+     2d3:	83 c4 10             	add    $0x10,%esp
+     2d6:	85 c0                	test   %eax,%eax
+     2d8:	0f 88 08 03 00 00    	js     5e6 <copytest+0x336>
+  if(read(fd, (char*)copytest, 16) != -1){
+     2de:	83 ec 04             	sub    $0x4,%esp
+     2e1:	89 c3                	mov    %eax,%ebx
+     2e3:	6a 10                	push   $0x10
+     2e5:	68 b0 02 00 00       	push   $0x2b0
+     2ea:	50                   	push   %eax
+     2eb:	e8 30 58 00 00       	call   5b20 <read>
+     2f0:	83 c4 10             	add    $0x10,%esp
+     2f3:	83 f8 ff             	cmp    $0xffffffff,%eax
+     2f6:	0f 85 fd 02 00 00    	jne    5f9 <copytest+0x349>
+  close(fd);
+     2fc:	83 ec 0c             	sub    $0xc,%esp
+     2ff:	53                   	push   %ebx
+     300:	e8 1b 59 00 00       	call   5c20 <close>
+  if(pipe(fds) < 0 || write(fds[1], "0123", 4) != 4){
+     305:	8d 45 cc             	lea    -0x34(%ebp),%eax
+     308:	89 04 24             	mov    %eax,(%esp)
+     30b:	e8 e0 59 00 00       	call   5cf0 <pipe>
+     310:	83 c4 10             	add    $0x10,%esp
+     313:	85 c0                	test   %eax,%eax
+     315:	0f 88 a5 02 00 00    	js     5c0 <copytest+0x310>
+     31b:	83 ec 04             	sub    $0x4,%esp
+     31e:	6a 04                	push   $0x4
+     320:	68 57 67 00 00       	push   $0x6757
+     325:	ff 75 d0             	push   -0x30(%ebp)
+     328:	e8 73 58 00 00       	call   5ba0 <write>
+     32d:	83 c4 10             	add    $0x10,%esp
+     330:	83 f8 04             	cmp    $0x4,%eax
+     333:	0f 85 87 02 00 00    	jne    5c0 <copytest+0x310>
+  if(read(fds[0], (char*)copytest, 4) != -1){
+     339:	83 ec 04             	sub    $0x4,%esp
+     33c:	6a 04                	push   $0x4
+     33e:	68 b0 02 00 00       	push   $0x2b0
+     343:	ff 75 cc             	push   -0x34(%ebp)
+     346:	e8 d5 57 00 00       	call   5b20 <read>
+     34b:	83 c4 10             	add    $0x10,%esp
+     34e:	83 f8 ff             	cmp    $0xffffffff,%eax
+     351:	0f 85 7c 02 00 00    	jne    5d3 <copytest+0x323>
+  if(read(fds[0], buf, 4) != 4 || memcmp(buf, "0123", 4) != 0){
+     357:	83 ec 04             	sub    $0x4,%esp
+     35a:	6a 04                	push   $0x4
+     35c:	68 60 c9 00 00       	push   $0xc960
+     361:	ff 75 cc             	push   -0x34(%ebp)
+     364:	e8 b7 57 00 00       	call   5b20 <read>
+     369:	83 c4 10             	add    $0x10,%esp
+     36c:	83 f8 04             	cmp    $0x4,%eax
+     36f:	0f 85 38 02 00 00    	jne    5ad <copytest+0x2fd>
+     375:	83 ec 04             	sub    $0x4,%esp
+     378:	6a 04                	push   $0x4
+     37a:	68 57 67 00 00       	push   $0x6757
+     37f:	68 60 c9 00 00       	push   $0xc960
+     384:	e8 57 55 00 00       	call   58e0 <memcmp>
+     389:	83 c4 10             	add    $0x10,%esp
+     38c:	85 c0                	test   %eax,%eax
+     38e:	0f 85 19 02 00 00    	jne    5ad <copytest+0x2fd>
+  close(fds[0]);
+     394:	83 ec 0c             	sub    $0xc,%esp
+     397:	ff 75 cc             	push   -0x34(%ebp)
+     39a:	e8 81 58 00 00       	call   5c20 <close>
+  close(fds[1]);
+     39f:	58                   	pop    %eax
+     3a0:	ff 75 d0             	push   -0x30(%ebp)
+     3a3:	e8 78 58 00 00       	call   5c20 <close>
+  p = (char*)(((uint)sbrk(0) + 4095) & ~4095) - 8;
+     3a8:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+     3af:	e8 b4 59 00 00       	call   5d68 <sbrk>
+  memmove(p, "01234567", 8);
+     3b4:	83 c4 0c             	add    $0xc,%esp
+  p = (char*)(((uint)sbrk(0) + 4095) & ~4095) - 8;
+     3b7:	05 ff 0f 00 00       	add    $0xfff,%eax
+  memmove(p, "01234567", 8);
+     3bc:	6a 08                	push   $0x8
+  p = (char*)(((uint)sbrk(0) + 4095) & ~4095) - 8;
+     3be:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  memmove(p, "01234567", 8);
+     3c3:	68 17 68 00 00       	push   $0x6817
+  p = (char*)(((uint)sbrk(0) + 4095) & ~4095) - 8;
+     3c8:	8d 70 f8             	lea    -0x8(%eax),%esi
+  memmove(p, "01234567", 8);
+     3cb:	56                   	push   %esi
+     3cc:	e8 9f 56 00 00       	call   5a70 <memmove>
+  fd = open("copyfile", O_CREATE|O_RDWR);
+     3d1:	58                   	pop    %eax
+     3d2:	5a                   	pop    %edx
+     3d3:	68 02 02 00 00       	push   $0x202
+     3d8:	68 8d 67 00 00       	push   $0x678d
+     3dd:	e8 3e 59 00 00       	call   5d20 <open>
+  if(fd < 0){
+     3e2:	83 c4 10             	add    $0x10,%esp
+  fd = open("copyfile", O_CREATE|O_RDWR);
+     3e5:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+     3e7:	85 c0                	test   %eax,%eax
+     3e9:	0f 88 1d 02 00 00    	js     60c <copytest+0x35c>
+  if(write(fd, p, 16) != 8 || write(fd, (char*)0x80000000, 16) != -1){
+     3ef:	83 ec 04             	sub    $0x4,%esp
+     3f2:	6a 10                	push   $0x10
+     3f4:	56                   	push   %esi
+     3f5:	50                   	push   %eax
+     3f6:	e8 a5 57 00 00       	call   5ba0 <write>
+     3fb:	83 c4 10             	add    $0x10,%esp
+     3fe:	83 f8 08             	cmp    $0x8,%eax
+     401:	0f 85 7f 01 00 00    	jne    586 <copytest+0x2d6>
+     407:	83 ec 04             	sub    $0x4,%esp
+     40a:	6a 10                	push   $0x10
+     40c:	68 00 00 00 80       	push   $0x80000000
+     411:	53                   	push   %ebx
+     412:	e8 89 57 00 00       	call   5ba0 <write>
+     417:	83 c4 10             	add    $0x10,%esp
+     41a:	83 f8 ff             	cmp    $0xffffffff,%eax
+     41d:	0f 85 63 01 00 00    	jne    586 <copytest+0x2d6>
+  if(fstat(fd, &st) < 0 || st.size != 8){
+     423:	83 ec 08             	sub    $0x8,%esp
+     426:	8d 7d d4             	lea    -0x2c(%ebp),%edi
+     429:	57                   	push   %edi
+     42a:	53                   	push   %ebx
+     42b:	e8 08 59 00 00       	call   5d38 <fstat>
+     430:	83 c4 10             	add    $0x10,%esp
+     433:	85 c0                	test   %eax,%eax
+     435:	0f 88 34 01 00 00    	js     56f <copytest+0x2bf>
+     43b:	83 7d e4 08          	cmpl   $0x8,-0x1c(%ebp)
+     43f:	0f 85 2a 01 00 00    	jne    56f <copytest+0x2bf>
+  if(write(fd, "89abcdef", 8) != 8){
+     445:	83 ec 04             	sub    $0x4,%esp
+     448:	6a 08                	push   $0x8
+     44a:	68 ca 67 00 00       	push   $0x67ca
+     44f:	53                   	push   %ebx
+     450:	e8 4b 57 00 00       	call   5ba0 <write>
+     455:	83 c4 10             	add    $0x10,%esp
+     458:	83 f8 08             	cmp    $0x8,%eax
+     45b:	0f 85 39 01 00 00    	jne    59a <copytest+0x2ea>
+  if(write(fd, p, 64) != 8){
+     461:	83 ec 04             	sub    $0x4,%esp
+     464:	6a 40                	push   $0x40
+     466:	56                   	push   %esi
+     467:	53                   	push   %ebx
+     468:	e8 33 57 00 00       	call   5ba0 <write>
+     46d:	83 c4 10             	add    $0x10,%esp
+     470:	83 f8 08             	cmp    $0x8,%eax
+     473:	0f 85 0d 01 00 00    	jne    586 <copytest+0x2d6>
+  if(fstat(fd, &st) < 0 || st.size != 24){
+     479:	83 ec 08             	sub    $0x8,%esp
+     47c:	57                   	push   %edi
+     47d:	53                   	push   %ebx
+     47e:	e8 b5 58 00 00       	call   5d38 <fstat>
+     483:	83 c4 10             	add    $0x10,%esp
+     486:	85 c0                	test   %eax,%eax
+     488:	0f 88 e1 00 00 00    	js     56f <copytest+0x2bf>
+     48e:	83 7d e4 18          	cmpl   $0x18,-0x1c(%ebp)
+     492:	0f 85 d7 00 00 00    	jne    56f <copytest+0x2bf>
+  memset(buf, 'x', 100);
+     498:	83 ec 04             	sub    $0x4,%esp
+     49b:	6a 64                	push   $0x64
+     49d:	6a 78                	push   $0x78
+     49f:	68 60 c9 00 00       	push   $0xc960
+     4a4:	e8 17 54 00 00       	call   58c0 <memset>
+  if(write(fd, buf, 100) != 100){
+     4a9:	83 c4 0c             	add    $0xc,%esp
+     4ac:	6a 64                	push   $0x64
+     4ae:	68 60 c9 00 00       	push   $0xc960
+     4b3:	53                   	push   %ebx
+     4b4:	e8 e7 56 00 00       	call   5ba0 <write>
+     4b9:	83 c4 10             	add    $0x10,%esp
+     4bc:	83 f8 64             	cmp    $0x64,%eax
+     4bf:	0f 85 d5 00 00 00    	jne    59a <copytest+0x2ea>
+  close(fd);
+     4c5:	83 ec 0c             	sub    $0xc,%esp
+     4c8:	53                   	push   %ebx
+     4c9:	e8 52 57 00 00       	call   5c20 <close>
+  fd = open("copyfile", O_RDONLY);
+     4ce:	59                   	pop    %ecx
+     4cf:	5b                   	pop    %ebx
+     4d0:	6a 00                	push   $0x0
+     4d2:	68 8d 67 00 00       	push   $0x678d
+     4d7:	e8 44 58 00 00       	call   5d20 <open>
+  if(fd < 0 || read(fd, buf, sizeof(buf)) != 124 ||
+     4dc:	83 c4 10             	add    $0x10,%esp
+  fd = open("copyfile", O_RDONLY);
+     4df:	89 c3                	mov    %eax,%ebx
+  if(fd < 0 || read(fd, buf, sizeof(buf)) != 124 ||
+     4e1:	85 c0                	test   %eax,%eax
+     4e3:	78 76                	js     55b <copytest+0x2ab>
+     4e5:	83 ec 04             	sub    $0x4,%esp
+     4e8:	68 00 20 00 00       	push   $0x2000
+     4ed:	68 60 c9 00 00       	push   $0xc960
+     4f2:	50                   	push   %eax
+     4f3:	e8 28 56 00 00       	call   5b20 <read>
+     4f8:	83 c4 10             	add    $0x10,%esp
+     4fb:	83 f8 7c             	cmp    $0x7c,%eax
+     4fe:	75 5b                	jne    55b <copytest+0x2ab>
+     memcmp(buf, "0123456789abcdef01234567", 24) != 0 ||
+     500:	83 ec 04             	sub    $0x4,%esp
+     503:	6a 18                	push   $0x18
+     505:	68 07 68 00 00       	push   $0x6807
+     50a:	68 60 c9 00 00       	push   $0xc960
+     50f:	e8 cc 53 00 00       	call   58e0 <memcmp>
+  if(fd < 0 || read(fd, buf, sizeof(buf)) != 124 ||
+     514:	83 c4 10             	add    $0x10,%esp
+     517:	85 c0                	test   %eax,%eax
+     519:	75 40                	jne    55b <copytest+0x2ab>
+     memcmp(buf, "0123456789abcdef01234567", 24) != 0 ||
+     51b:	80 3d 78 c9 00 00 78 	cmpb   $0x78,0xc978
+     522:	75 37                	jne    55b <copytest+0x2ab>
+     buf[24] != 'x' || buf[123] != 'x'){
+     524:	80 3d db c9 00 00 78 	cmpb   $0x78,0xc9db
+     52b:	75 2e                	jne    55b <copytest+0x2ab>
+  close(fd);
+     52d:	83 ec 0c             	sub    $0xc,%esp
+     530:	53                   	push   %ebx
+     531:	e8 ea 56 00 00       	call   5c20 <close>
+  unlink("copyfile");
+     536:	c7 04 24 8d 67 00 00 	movl   $0x678d,(%esp)
+     53d:	e8 ee 57 00 00       	call   5d30 <unlink>
+  printf(1, "copy test ok\n");
+     542:	58                   	pop    %eax
+     543:	5a                   	pop    %edx
+     544:	68 20 68 00 00       	push   $0x6820
+     549:	6a 01                	push   $0x1
+     54b:	e8 10 5d 00 00       	call   6260 <printf>
+}
+     550:	83 c4 10             	add    $0x10,%esp
+     553:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     556:	5b                   	pop    %ebx
+     557:	5e                   	pop    %esi
+     558:	5f                   	pop    %edi
+     559:	5d                   	pop    %ebp
+     55a:	c3                   	ret
+    printf(1, "copyfile has wrong contents\n");
+     55b:	83 ec 08             	sub    $0x8,%esp
+     55e:	68 ea 67 00 00       	push   $0x67ea
+     563:	6a 01                	push   $0x1
+     565:	e8 f6 5c 00 00       	call   6260 <printf>
+    exit();
+     56a:	e8 61 55 00 00       	call   5ad0 <exit>
+    printf(1, "short write left copyfile size %d\n", st.size);
+     56f:	83 ec 04             	sub    $0x4,%esp
+     572:	ff 75 e4             	push   -0x1c(%ebp)
+     575:	68 74 7f 00 00       	push   $0x7f74
+     57a:	6a 01                	push   $0x1
+     57c:	e8 df 5c 00 00       	call   6260 <printf>
+    exit();
+     581:	e8 4a 55 00 00       	call   5ad0 <exit>
+    printf(1, "write from unmapped memory\n");
+     586:	83 ec 08             	sub    $0x8,%esp
+     589:	68 ae 67 00 00       	push   $0x67ae
+     58e:	6a 01                	push   $0x1
+     590:	e8 cb 5c 00 00       	call   6260 <printf>
+    exit();
+     595:	e8 36 55 00 00       	call   5ad0 <exit>
+    printf(1, "write copyfile failed\n");
+     59a:	56                   	push   %esi
+     59b:	56                   	push   %esi
+     59c:	68 d3 67 00 00       	push   $0x67d3
+     5a1:	6a 01                	push   $0x1
+     5a3:	e8 b8 5c 00 00       	call   6260 <printf>
+    exit();
+     5a8:	e8 23 55 00 00       	call   5ad0 <exit>
+    printf(1, "pipe lost its data\n");
+     5ad:	51                   	push   %ecx
+     5ae:	51                   	push   %ecx
+     5af:	68 79 67 00 00       	push   $0x6779
+     5b4:	6a 01                	push   $0x1
+     5b6:	e8 a5 5c 00 00       	call   6260 <printf>
+    exit();
+     5bb:	e8 10 55 00 00       	call   5ad0 <exit>
+    printf(1, "pipe failed\n");
+     5c0:	56                   	push   %esi
+     5c1:	56                   	push   %esi
+     5c2:	68 bb 75 00 00       	push   $0x75bb
+     5c7:	6a 01                	push   $0x1
+     5c9:	e8 92 5c 00 00       	call   6260 <printf>
+    exit();
+     5ce:	e8 fd 54 00 00       	call   5ad0 <exit>
+    printf(1, "pipe read into program text\n");
+     5d3:	53                   	push   %ebx
+     5d4:	53                   	push   %ebx
+     5d5:	68 5c 67 00 00       	push   $0x675c
+     5da:	6a 01                	push   $0x1
+     5dc:	e8 7f 5c 00 00       	call   6260 <printf>
+    exit();
+     5e1:	e8 ea 54 00 00       	call   5ad0 <exit>
+    printf(1, "open usertests failed\n");
+     5e6:	50                   	push   %eax
+     5e7:	50                   	push   %eax
+     5e8:	68 40 67 00 00       	push   $0x6740
+     5ed:	6a 01                	push   $0x1
+     5ef:	e8 6c 5c 00 00       	call   6260 <printf>
+    exit();
+     5f4:	e8 d7 54 00 00       	call   5ad0 <exit>
+    printf(1, "read into program text\n");
+     5f9:	57                   	push   %edi
+     5fa:	57                   	push   %edi
+     5fb:	68 61 67 00 00       	push   $0x6761
+     600:	6a 01                	push   $0x1
+     602:	e8 59 5c 00 00       	call   6260 <printf>
+    exit();
+     607:	e8 c4 54 00 00       	call   5ad0 <exit>
+    printf(1, "create copyfile failed\n");
+     60c:	57                   	push   %edi
+     60d:	57                   	push   %edi
+     60e:	68 96 67 00 00       	push   $0x6796
+     613:	6a 01                	push   $0x1
+     615:	e8 46 5c 00 00       	call   6260 <printf>
+    exit();
+     61a:	e8 b1 54 00 00       	call   5ad0 <exit>
+     61f:	90                   	nop
+
+00000620 <threadinc>:
+{
+     620:	55                   	push   %ebp
+     621:	89 e5                	mov    %esp,%ebp
+     623:	53                   	push   %ebx
+     624:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+     629:	83 ec 04             	sub    $0x4,%esp
+     62c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    umtxlock(&tlock);
+     630:	83 ec 0c             	sub    $0xc,%esp
+     633:	68 54 c9 00 00       	push   $0xc954
+     638:	e8 23 56 00 00       	call   5c60 <umtxlock>
+    tcount++;
+     63d:	83 05 58 c9 00 00 01 	addl   $0x1,0xc958
+    umtxunlock(&tlock);
+     644:	c7 04 24 54 c9 00 00 	movl   $0xc954,(%esp)
+     64b:	e8 60 56 00 00       	call   5cb0 <umtxunlock>
+  for(i = 0; i < 1000; i++){
+     650:	83 c4 10             	add    $0x10,%esp
+     653:	83 eb 01             	sub    $0x1,%ebx
+     656:	75 d8                	jne    630 <threadinc+0x10>
+  if((int)arg == 0){
+     658:	8b 45 08             	mov    0x8(%ebp),%eax
+     65b:	85 c0                	test   %eax,%eax
+     65d:	74 05                	je     664 <threadinc+0x44>
+}
+     65f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     662:	c9                   	leave
+     663:	c3                   	ret
+    tmem = sbrk(4096);
+     664:	83 ec 0c             	sub    $0xc,%esp
+     667:	68 00 10 00 00       	push   $0x1000
+     66c:	e8 f7 56 00 00       	call   5d68 <sbrk>
+}
+     671:	83 c4 10             	add    $0x10,%esp
+    tmem = sbrk(4096);
+     674:	a3 50 c9 00 00       	mov    %eax,0xc950
+    tmem[0] = 'T';
+     679:	c6 00 54             	movb   $0x54,(%eax)
+}
+     67c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     67f:	c9                   	leave
+     680:	c3                   	ret
+     681:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     688:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     68f:	90                   	nop
+
+00000690 <iputtest>:
+{
+     690:	55                   	push   %ebp
+     691:	89 e5                	mov    %esp,%ebp
+     693:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "iput test\n");
+     696:	68 b4 68 00 00       	push   $0x68b4
+     69b:	ff 35 04 a0 00 00    	push   0xa004
+     6a1:	e8 ba 5b 00 00       	call   6260 <printf>
+  if(mkdir("iputdir") < 0){
+     6a6:	c7 04 24 47 68 00 00 	movl   $0x6847,(%esp)
+     6ad:	e8 96 56 00 00       	call   5d48 <mkdir>
+     6b2:	83 c4 10             	add    $0x10,%esp
+     6b5:	85 c0                	test   %eax,%eax
+     6b7:	78 58                	js     711 <iputtest+0x81>
+  if(chdir("iputdir") < 0){
+     6b9:	83 ec 0c             	sub    $0xc,%esp
+     6bc:	68 47 68 00 00       	push   $0x6847
+     6c1:	e8 8a 56 00 00       	call   5d50 <chdir>
+     6c6:	83 c4 10             	add    $0x10,%esp
+     6c9:	85 c0                	test   %eax,%eax
+     6cb:	0f 88 85 00 00 00    	js     756 <iputtest+0xc6>
+  if(unlink("../iputdir") < 0){
+     6d1:	83 ec 0c             	sub    $0xc,%esp
+     6d4:	68 44 68 00 00       	push   $0x6844
+     6d9:	e8 52 56 00 00       	call   5d30 <unlink>
+     6de:	83 c4 10             	add    $0x10,%esp
+     6e1:	85 c0                	test   %eax,%eax
+     6e3:	78 5a                	js     73f <iputtest+0xaf>
+  if(chdir("/") < 0){
+     6e5:	83 ec 0c             	sub    $0xc,%esp
+     6e8:	68 69 68 00 00       	push   $0x6869
+     6ed:	e8 5e 56 00 00       	call   5d50 <chdir>
+     6f2:	83 c4 10             	add    $0x10,%esp
+     6f5:	85 c0                	test   %eax,%eax
+     6f7:	78 2f                	js     728 <iputtest+0x98>
+  printf(stdout, "iput test ok\n");
+     6f9:	83 ec 08             	sub    $0x8,%esp
+     6fc:	68 dd 68 00 00       	push   $0x68dd
+     701:	ff 35 04 a0 00 00    	push   0xa004
+     707:	e8 54 5b 00 00       	call   6260 <printf>
+}
+     70c:	83 c4 10             	add    $0x10,%esp
+     70f:	c9                   	leave
+     710:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     711:	50                   	push   %eax
+     712:	50                   	push   %eax
+     713:	68 44 73 00 00       	push   $0x7344
+     718:	ff 35 04 a0 00 00    	push   0xa004
+     71e:	e8 3d 5b 00 00       	call   6260 <printf>
+    exit();
+     723:	e8 a8 53 00 00       	call   5ad0 <exit>
+    printf(stdout, "chdir / failed\n");
+     728:	50                   	push   %eax
+     729:	50                   	push   %eax
+     72a:	68 6b 68 00 00       	push   $0x686b
+     72f:	ff 35 04 a0 00 00    	push   0xa004
+     735:	e8 26 5b 00 00       	call   6260 <printf>
+    exit();
+     73a:	e8 91 53 00 00       	call   5ad0 <exit>
+    printf(stdout, "unlink ../iputdir failed\n");
+     73f:	52                   	push   %edx
+     740:	52                   	push   %edx
+     741:	68 4f 68 00 00       	push   $0x684f
+     746:	ff 35 04 a0 00 00    	push   0xa004
+     74c:	e8 0f 5b 00 00       	call   6260 <printf>
+    exit();
+     751:	e8 7a 53 00 00       	call   5ad0 <exit>
+    printf(stdout, "chdir iputdir failed\n");
+     756:	51                   	push   %ecx
+     757:	51                   	push   %ecx
+     758:	68 2e 68 00 00       	push   $0x682e
+     75d:	ff 35 04 a0 00 00    	push   0xa004
+     763:	e8 f8 5a 00 00       	call   6260 <printf>
+    exit();
+     768:	e8 63 53 00 00       	call   5ad0 <exit>
+     76d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000770 <exitiputtest>:
+{
+     770:	55                   	push   %ebp
+     771:	89 e5                	mov    %esp,%ebp
+     773:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exitiput test\n");
+     776:	68 7b 68 00 00       	push   $0x687b
+     77b:	ff 35 04 a0 00 00    	push   0xa004
+     781:	e8 da 5a 00 00       	call   6260 <printf>
+  pid = fork();
+     786:	e8 15 53 00 00       	call   5aa0 <fork>
+  if(pid < 0){
+     78b:	83 c4 10             	add    $0x10,%esp
+     78e:	85 c0                	test   %eax,%eax
+     790:	0f 88 8a 00 00 00    	js     820 <exitiputtest+0xb0>
+  if(pid == 0){
+     796:	75 50                	jne    7e8 <exitiputtest+0x78>
+    if(mkdir("iputdir") < 0){
+     798:	83 ec 0c             	sub    $0xc,%esp
+     79b:	68 47 68 00 00       	push   $0x6847
+     7a0:	e8 a3 55 00 00       	call   5d48 <mkdir>
+     7a5:	83 c4 10             	add    $0x10,%esp
+     7a8:	85 c0                	test   %eax,%eax
+     7aa:	0f 88 87 00 00 00    	js     837 <exitiputtest+0xc7>
+    if(chdir("iputdir") < 0){
+     7b0:	83 ec 0c             	sub    $0xc,%esp
+     7b3:	68 47 68 00 00       	push   $0x6847
+     7b8:	e8 93 55 00 00       	call   5d50 <chdir>
+     7bd:	83 c4 10             	add    $0x10,%esp
+     7c0:	85 c0                	test   %eax,%eax
+     7c2:	0f 88 86 00 00 00    	js     84e <exitiputtest+0xde>
+    if(unlink("../iputdir") < 0){
+     7c8:	83 ec 0c             	sub    $0xc,%esp
+     7cb:	68 44 68 00 00       	push   $0x6844
+     7d0:	e8 5b 55 00 00       	call   5d30 <unlink>
+     7d5:	83 c4 10             	add    $0x10,%esp
+     7d8:	85 c0                	test   %eax,%eax
+     7da:	78 2c                	js     808 <exitiputtest+0x98>
+    exit();
+     7dc:	e8 ef 52 00 00       	call   5ad0 <exit>
+     7e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  wait();
+     7e8:	e8 fb 54 00 00       	call   5ce8 <wait>
+  printf(stdout, "exitiput test ok\n");
+     7ed:	83 ec 08             	sub    $0x8,%esp
+     7f0:	68 9e 68 00 00       	push   $0x689e
+     7f5:	ff 35 04 a0 00 00    	push   0xa004
+     7fb:	e8 60 5a 00 00       	call   6260 <printf>
+}
+     800:	83 c4 10             	add    $0x10,%esp
+     803:	c9                   	leave
+     804:	c3                   	ret
+     805:	8d 76 00             	lea    0x0(%esi),%esi
+      printf(stdout, "unlink ../iputdir failed\n");
+     808:	83 ec 08             	sub    $0x8,%esp
+     80b:	68 4f 68 00 00       	push   $0x684f
+     810:	ff 35 04 a0 00 00    	push   0xa004
+     816:	e8 45 5a 00 00       	call   6260 <printf>
+      exit();
+     81b:	e8 b0 52 00 00       	call   5ad0 <exit>
+    printf(stdout, "fork failed\n");
+     820:	51                   	push   %ecx
+     821:	51                   	push   %ecx
+     822:	68 48 7e 00 00       	push   $0x7e48
+     827:	ff 35 04 a0 00 00    	push   0xa004
+     82d:	e8 2e 5a 00 00       	call   6260 <printf>
+    exit();
+     832:	e8 99 52 00 00       	call   5ad0 <exit>
+      printf(stdout, "mkdir failed\n");
+     837:	52                   	push   %edx
+     838:	52                   	push   %edx
+     839:	68 44 73 00 00       	push   $0x7344
+     83e:	ff 35 04 a0 00 00    	push   0xa004
+     844:	e8 17 5a 00 00       	call   6260 <printf>
+      exit();
+     849:	e8 82 52 00 00       	call   5ad0 <exit>
+      printf(stdout, "child chdir failed\n");
+     84e:	50                   	push   %eax
+     84f:	50                   	push   %eax
+     850:	68 8a 68 00 00       	push   $0x688a
+     855:	ff 35 04 a0 00 00    	push   0xa004
+     85b:	e8 00 5a 00 00       	call   6260 <printf>
+      exit();
+     860:	e8 6b 52 00 00       	call   5ad0 <exit>
+     865:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     86c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000870 <openiputtest>:
+{
+     870:	55                   	push   %ebp
+     871:	89 e5                	mov    %esp,%ebp
+     873:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "openiput test\n");
+     876:	68 b0 68 00 00       	push   $0x68b0
+     87b:	ff 35 04 a0 00 00    	push   0xa004
+     881:	e8 da 59 00 00       	call   6260 <printf>
+  if(mkdir("oidir") < 0){
+     886:	c7 04 24 bf 68 00 00 	movl   $0x68bf,(%esp)
+     88d:	e8 b6 54 00 00       	call   5d48 <mkdir>
+     892:	83 c4 10             	add    $0x10,%esp
+     895:	85 c0                	test   %eax,%eax
+     897:	0f 88 9f 00 00 00    	js     93c <openiputtest+0xcc>
+  pid = fork();
+     89d:	e8 fe 51 00 00       	call   5aa0 <fork>
+  if(pid < 0){
+     8a2:	85 c0                	test   %eax,%eax
+     8a4:	78 7f                	js     925 <openiputtest+0xb5>
+  if(pid == 0){
+     8a6:	75 38                	jne    8e0 <openiputtest+0x70>
+    int fd = open("oidir", O_RDWR);
+     8a8:	83 ec 08             	sub    $0x8,%esp
+     8ab:	6a 02                	push   $0x2
+     8ad:	68 bf 68 00 00       	push   $0x68bf
+     8b2:	e8 69 54 00 00       	call   5d20 <open>
+    if(fd >= 0){
+     8b7:	83 c4 10             	add    $0x10,%esp
+     8ba:	85 c0                	test   %eax,%eax
+     8bc:	78 62                	js     920 <openiputtest+0xb0>
+      printf(stdout, "open directory for write succeeded\n");
+     8be:	83 ec 08             	sub    $0x8,%esp
+     8c1:	68 98 7f 00 00       	push   $0x7f98
+     8c6:	ff 35 04 a0 00 00    	push   0xa004
+     8cc:	e8 8f 59 00 00       	call   6260 <printf>
+      exit();
+     8d1:	e8 fa 51 00 00       	call   5ad0 <exit>
+     8d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8dd:	8d 76 00             	lea    0x0(%esi),%esi
+  sleep(1);
+     8e0:	83 ec 0c             	sub    $0xc,%esp
+     8e3:	6a 01                	push   $0x1
+     8e5:	e8 86 54 00 00       	call   5d70 <sleep>
+  if(unlink("oidir") != 0){
+     8ea:	c7 04 24 bf 68 00 00 	movl   $0x68bf,(%esp)
+     8f1:	e8 3a 54 00 00       	call   5d30 <unlink>
+     8f6:	83 c4 10             	add    $0x10,%esp
+     8f9:	85 c0                	test   %eax,%eax
+     8fb:	75 56                	jne    953 <openiputtest+0xe3>
+  wait();
+     8fd:	e8 e6 53 00 00       	call   5ce8 <wait>
+  printf(stdout, "openiput test ok\n");
+     902:	83 ec 08             	sub    $0x8,%esp
+     905:	68 d9 68 00 00       	push   $0x68d9
+     90a:	ff 35 04 a0 00 00    	push   0xa004
+     910:	e8 4b 59 00 00       	call   6260 <printf>
+}
+     915:	83 c4 10             	add    $0x10,%esp
+     918:	c9                   	leave
+     919:	c3                   	ret
+     91a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    exit();
+     920:	e8 ab 51 00 00       	call   5ad0 <exit>
+    printf(stdout, "fork failed\n");
+     925:	52                   	push   %edx
+     926:	52                   	push   %edx
+     927:	68 48 7e 00 00       	push   $0x7e48
+     92c:	ff 35 04 a0 00 00    	push   0xa004
+     932:	e8 29 59 00 00       	call   6260 <printf>
+    exit();
+     937:	e8 94 51 00 00       	call   5ad0 <exit>
+    printf(stdout, "mkdir oidir failed\n");
+     93c:	51                   	push   %ecx
+     93d:	51                   	push   %ecx
+     93e:	68 c5 68 00 00       	push   $0x68c5
+     943:	ff 35 04 a0 00 00    	push   0xa004
+     949:	e8 12 59 00 00       	call   6260 <printf>
+    exit();
+     94e:	e8 7d 51 00 00       	call   5ad0 <exit>
+    printf(stdout, "unlink failed\n");
+     953:	50                   	push   %eax
+     954:	50                   	push   %eax
+     955:	68 7a 73 00 00       	push   $0x737a
+     95a:	ff 35 04 a0 00 00    	push   0xa004
+     960:	e8 fb 58 00 00       	call   6260 <printf>
+    exit();
+     965:	e8 66 51 00 00       	call   5ad0 <exit>
+     96a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000970 <opentest>:
+{
+     970:	55                   	push   %ebp
+     971:	89 e5                	mov    %esp,%ebp
+     973:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "open test\n");
+     976:	68 eb 68 00 00       	push   $0x68eb
+     97b:	ff 35 04 a0 00 00    	push   0xa004
+     981:	e8 da 58 00 00       	call   6260 <printf>
+  fd = open("echo", 0);
+     986:	58                   	pop    %eax
+     987:	5a                   	pop    %edx
+     988:	6a 00                	push   $0x0
+     98a:	68 98 66 00 00       	push   $0x6698
+     98f:	e8 8c 53 00 00       	call   5d20 <open>
+  if(fd < 0){
+     994:	83 c4 10             	add    $0x10,%esp
+     997:	85 c0                	test   %eax,%eax
+     999:	78 36                	js     9d1 <opentest+0x61>
+  close(fd);
+     99b:	83 ec 0c             	sub    $0xc,%esp
+     99e:	50                   	push   %eax
+     99f:	e8 7c 52 00 00       	call   5c20 <close>
+  fd = open("doesnotexist", 0);
+     9a4:	5a                   	pop    %edx
+     9a5:	59                   	pop    %ecx
+     9a6:	6a 00                	push   $0x0
+     9a8:	68 09 69 00 00       	push   $0x6909
+     9ad:	e8 6e 53 00 00       	call   5d20 <open>
+  if(fd >= 0){
+     9b2:	83 c4 10             	add    $0x10,%esp
+     9b5:	85 c0                	test   %eax,%eax
+     9b7:	79 2f                	jns    9e8 <opentest+0x78>
+  printf(stdout, "open test ok\n");
+     9b9:	83 ec 08             	sub    $0x8,%esp
+     9bc:	68 34 69 00 00       	push   $0x6934
+     9c1:	ff 35 04 a0 00 00    	push   0xa004
+     9c7:	e8 94 58 00 00       	call   6260 <printf>
+}
+     9cc:	83 c4 10             	add    $0x10,%esp
+     9cf:	c9                   	leave
+     9d0:	c3                   	ret
+    printf(stdout, "open echo failed!\n");
+     9d1:	50                   	push   %eax
+     9d2:	50                   	push   %eax
+     9d3:	68 f6 68 00 00       	push   $0x68f6
+     9d8:	ff 35 04 a0 00 00    	push   0xa004
+     9de:	e8 7d 58 00 00       	call   6260 <printf>
+    exit();
+     9e3:	e8 e8 50 00 00       	call   5ad0 <exit>
+    printf(stdout, "open doesnotexist succeeded!\n");
+     9e8:	50                   	push   %eax
+     9e9:	50                   	push   %eax
+     9ea:	68 16 69 00 00       	push   $0x6916
+     9ef:	ff 35 04 a0 00 00    	push   0xa004
+     9f5:	e8 66 58 00 00       	call   6260 <printf>
+    exit();
+     9fa:	e8 d1 50 00 00       	call   5ad0 <exit>
+     9ff:	90                   	nop
+
+00000a00 <writetest>:
+{
+     a00:	55                   	push   %ebp
+     a01:	89 e5                	mov    %esp,%ebp
+     a03:	56                   	push   %esi
+     a04:	53                   	push   %ebx
+  printf(stdout, "small file test\n");
+     a05:	83 ec 08             	sub    $0x8,%esp
+     a08:	68 42 69 00 00       	push   $0x6942
+     a0d:	ff 35 04 a0 00 00    	push   0xa004
+     a13:	e8 48 58 00 00       	call   6260 <printf>
+  fd = open("small", O_CREATE|O_RDWR);
+     a18:	58                   	pop    %eax
+     a19:	5a                   	pop    %edx
+     a1a:	68 02 02 00 00       	push   $0x202
+     a1f:	68 53 69 00 00       	push   $0x6953
+     a24:	e8 f7 52 00 00       	call   5d20 <open>
+  if(fd >= 0){
+     a29:	83 c4 10             	add    $0x10,%esp
+     a2c:	85 c0                	test   %eax,%eax
+     a2e:	0f 88 88 01 00 00    	js     bbc <writetest+0x1bc>
+    printf(stdout, "creat small succeeded; ok\n");
+     a34:	83 ec 08             	sub    $0x8,%esp
+     a37:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 100; i++){
+     a39:	31 db                	xor    %ebx,%ebx
+    printf(stdout, "creat small succeeded; ok\n");
+     a3b:	68 59 69 00 00       	push   $0x6959
+     a40:	ff 35 04 a0 00 00    	push   0xa004
+     a46:	e8 15 58 00 00       	call   6260 <printf>
+     a4b:	83 c4 10             	add    $0x10,%esp
+     a4e:	66 90                	xchg   %ax,%ax
+    if(write(fd, "aaaaaaaaaa", 10) != 10){
+     a50:	83 ec 04             	sub    $0x4,%esp
+     a53:	6a 0a                	push   $0xa
+     a55:	68 90 69 00 00       	push   $0x6990
+     a5a:	56                   	push   %esi
+     a5b:	e8 40 51 00 00       	call   5ba0 <write>
+     a60:	83 c4 10             	add    $0x10,%esp
+     a63:	83 f8 0a             	cmp    $0xa,%eax
+     a66:	0f 85 d9 00 00 00    	jne    b45 <writetest+0x145>
+    if(write(fd, "bbbbbbbbbb", 10) != 10){
+     a6c:	83 ec 04             	sub    $0x4,%esp
+     a6f:	6a 0a                	push   $0xa
+     a71:	68 9b 69 00 00       	push   $0x699b
+     a76:	56                   	push   %esi
+     a77:	e8 24 51 00 00       	call   5ba0 <write>
+     a7c:	83 c4 10             	add    $0x10,%esp
+     a7f:	83 f8 0a             	cmp    $0xa,%eax
+     a82:	0f 85 d6 00 00 00    	jne    b5e <writetest+0x15e>
+  for(i = 0; i < 100; i++){
+     a88:	83 c3 01             	add    $0x1,%ebx
+     a8b:	83 fb 64             	cmp    $0x64,%ebx
+     a8e:	75 c0                	jne    a50 <writetest+0x50>
+  printf(stdout, "writes ok\n");
+     a90:	83 ec 08             	sub    $0x8,%esp
+     a93:	68 a6 69 00 00       	push   $0x69a6
+     a98:	ff 35 04 a0 00 00    	push   0xa004
+     a9e:	e8 bd 57 00 00       	call   6260 <printf>
+  close(fd);
+     aa3:	89 34 24             	mov    %esi,(%esp)
+     aa6:	e8 75 51 00 00       	call   5c20 <close>
+  fd = open("small", O_RDONLY);
+     aab:	5b                   	pop    %ebx
+     aac:	5e                   	pop    %esi
+     aad:	6a 00                	push   $0x0
+     aaf:	68 53 69 00 00       	push   $0x6953
+     ab4:	e8 67 52 00 00       	call   5d20 <open>
+  if(fd >= 0){
+     ab9:	83 c4 10             	add    $0x10,%esp
+  fd = open("small", O_RDONLY);
+     abc:	89 c3                	mov    %eax,%ebx
+  if(fd >= 0){
+     abe:	85 c0                	test   %eax,%eax
+     ac0:	0f 88 b1 00 00 00    	js     b77 <writetest+0x177>
+    printf(stdout, "open small succeeded ok\n");
+     ac6:	83 ec 08             	sub    $0x8,%esp
+     ac9:	68 b1 69 00 00       	push   $0x69b1
+     ace:	ff 35 04 a0 00 00    	push   0xa004
+     ad4:	e8 87 57 00 00       	call   6260 <printf>
+  i = read(fd, buf, 2000);
+     ad9:	83 c4 0c             	add    $0xc,%esp
+     adc:	68 d0 07 00 00       	push   $0x7d0
+     ae1:	68 60 c9 00 00       	push   $0xc960
+     ae6:	53                   	push   %ebx
+     ae7:	e8 34 50 00 00       	call   5b20 <read>
+  if(i == 2000){
+     aec:	83 c4 10             	add    $0x10,%esp
+     aef:	3d d0 07 00 00       	cmp    $0x7d0,%eax
+     af4:	0f 85 94 00 00 00    	jne    b8e <writetest+0x18e>
+    printf(stdout, "read succeeded ok\n");
+     afa:	83 ec 08             	sub    $0x8,%esp
+     afd:	68 e5 69 00 00       	push   $0x69e5
+     b02:	ff 35 04 a0 00 00    	push   0xa004
+     b08:	e8 53 57 00 00       	call   6260 <printf>
+  close(fd);
+     b0d:	89 1c 24             	mov    %ebx,(%esp)
+     b10:	e8 0b 51 00 00       	call   5c20 <close>
+  if(unlink("small") < 0){
+     b15:	c7 04 24 53 69 00 00 	movl   $0x6953,(%esp)
+     b1c:	e8 0f 52 00 00       	call   5d30 <unlink>
+     b21:	83 c4 10             	add    $0x10,%esp
+     b24:	85 c0                	test   %eax,%eax
+     b26:	78 7d                	js     ba5 <writetest+0x1a5>
+  printf(stdout, "small file test ok\n");
+     b28:	83 ec 08             	sub    $0x8,%esp
+     b2b:	68 0d 6a 00 00       	push   $0x6a0d
+     b30:	ff 35 04 a0 00 00    	push   0xa004
+     b36:	e8 25 57 00 00       	call   6260 <printf>
+}
+     b3b:	83 c4 10             	add    $0x10,%esp
+     b3e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     b41:	5b                   	pop    %ebx
+     b42:	5e                   	pop    %esi
+     b43:	5d                   	pop    %ebp
+     b44:	c3                   	ret
+      printf(stdout, "error: write aa %d new file failed\n", i);
+     b45:	83 ec 04             	sub    $0x4,%esp
+     b48:	53                   	push   %ebx
+     b49:	68 bc 7f 00 00       	push   $0x7fbc
+     b4e:	ff 35 04 a0 00 00    	push   0xa004
+     b54:	e8 07 57 00 00       	call   6260 <printf>
+      exit();
+     b59:	e8 72 4f 00 00       	call   5ad0 <exit>
+      printf(stdout, "error: write bb %d new file failed\n", i);
+     b5e:	83 ec 04             	sub    $0x4,%esp
+     b61:	53                   	push   %ebx
+     b62:	68 e0 7f 00 00       	push   $0x7fe0
+     b67:	ff 35 04 a0 00 00    	push   0xa004
+     b6d:	e8 ee 56 00 00       	call   6260 <printf>
+      exit();
+     b72:	e8 59 4f 00 00       	call   5ad0 <exit>
+    printf(stdout, "error: open small failed!\n");
+     b77:	51                   	push   %ecx
+     b78:	51                   	push   %ecx
+     b79:	68 ca 69 00 00       	push   $0x69ca
+     b7e:	ff 35 04 a0 00 00    	push   0xa004
+     b84:	e8 d7 56 00 00       	call   6260 <printf>
+    exit();
+     b89:	e8 42 4f 00 00       	call   5ad0 <exit>
+    printf(stdout, "read failed\n");
+     b8e:	52                   	push   %edx
+     b8f:	52                   	push   %edx
+     b90:	68 ff 6c 00 00       	push   $0x6cff
+     b95:	ff 35 04 a0 00 00    	push   0xa004
+     b9b:	e8 c0 56 00 00       	call   6260 <printf>
+    exit();
+     ba0:	e8 2b 4f 00 00       	call   5ad0 <exit>
+    printf(stdout, "unlink small failed\n");
+     ba5:	50                   	push   %eax
+     ba6:	50                   	push   %eax
+     ba7:	68 f8 69 00 00       	push   $0x69f8
+     bac:	ff 35 04 a0 00 00    	push   0xa004
+     bb2:	e8 a9 56 00 00       	call   6260 <printf>
+    exit();
+     bb7:	e8 14 4f 00 00       	call   5ad0 <exit>
+    printf(stdout, "error: creat small failed!\n");
+     bbc:	50                   	push   %eax
+     bbd:	50                   	push   %eax
+     bbe:	68 74 69 00 00       	push   $0x6974
+     bc3:	ff 35 04 a0 00 00    	push   0xa004
+     bc9:	e8 92 56 00 00       	call   6260 <printf>
+    exit();
+     bce:	e8 fd 4e 00 00       	call   5ad0 <exit>
+     bd3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000be0 <writetest1>:
+{
+     be0:	55                   	push   %ebp
+     be1:	89 e5                	mov    %esp,%ebp
+     be3:	56                   	push   %esi
+     be4:	53                   	push   %ebx
+  printf(stdout, "big files test\n");
+     be5:	83 ec 08             	sub    $0x8,%esp
+     be8:	68 21 6a 00 00       	push   $0x6a21
+     bed:	ff 35 04 a0 00 00    	push   0xa004
+     bf3:	e8 68 56 00 00       	call   6260 <printf>
+  fd = open("big", O_CREATE|O_RDWR);
+     bf8:	58                   	pop    %eax
+     bf9:	5a                   	pop    %edx
+     bfa:	68 02 02 00 00       	push   $0x202
+     bff:	68 9b 6a 00 00       	push   $0x6a9b
+     c04:	e8 17 51 00 00       	call   5d20 <open>
+  if(fd < 0){
+     c09:	83 c4 10             	add    $0x10,%esp
+     c0c:	85 c0                	test   %eax,%eax
+     c0e:	0f 88 5d 01 00 00    	js     d71 <writetest1+0x191>
+     c14:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < NBIG; i++){
+     c16:	31 db                	xor    %ebx,%ebx
+     c18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c1f:	90                   	nop
+    if(write(fd, buf, 512) != 512){
+     c20:	83 ec 04             	sub    $0x4,%esp
+    ((int*)buf)[0] = i;
+     c23:	89 1d 60 c9 00 00    	mov    %ebx,0xc960
+    if(write(fd, buf, 512) != 512){
+     c29:	68 00 02 00 00       	push   $0x200
+     c2e:	68 60 c9 00 00       	push   $0xc960
+     c33:	56                   	push   %esi
+     c34:	e8 67 4f 00 00       	call   5ba0 <write>
+     c39:	83 c4 10             	add    $0x10,%esp
+     c3c:	3d 00 02 00 00       	cmp    $0x200,%eax
+     c41:	0f 85 b3 00 00 00    	jne    cfa <writetest1+0x11a>
+  for(i = 0; i < NBIG; i++){
+     c47:	83 c3 01             	add    $0x1,%ebx
+     c4a:	81 fb 0c 01 00 00    	cmp    $0x10c,%ebx
+     c50:	75 ce                	jne    c20 <writetest1+0x40>
+  close(fd);
+     c52:	83 ec 0c             	sub    $0xc,%esp
+     c55:	56                   	push   %esi
+     c56:	e8 c5 4f 00 00       	call   5c20 <close>
+  fd = open("big", O_RDONLY);
+     c5b:	5b                   	pop    %ebx
+     c5c:	5e                   	pop    %esi
+     c5d:	6a 00                	push   $0x0
+     c5f:	68 9b 6a 00 00       	push   $0x6a9b
+     c64:	e8 b7 50 00 00       	call   5d20 <open>
+  if(fd < 0){
+     c69:	83 c4 10             	add    $0x10,%esp
+  fd = open("big", O_RDONLY);
+     c6c:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+     c6e:	85 c0                	test   %eax,%eax
+     c70:	0f 88 e4 00 00 00    	js     d5a <writetest1+0x17a>
+  n = 0;
+     c76:	31 f6                	xor    %esi,%esi
+     c78:	eb 1d                	jmp    c97 <writetest1+0xb7>
+     c7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    } else if(i != 512){
+     c80:	3d 00 02 00 00       	cmp    $0x200,%eax
+     c85:	0f 85 9f 00 00 00    	jne    d2a <writetest1+0x14a>
+    if(((int*)buf)[0] != n){
+     c8b:	a1 60 c9 00 00       	mov    0xc960,%eax
+     c90:	39 f0                	cmp    %esi,%eax
+     c92:	75 7f                	jne    d13 <writetest1+0x133>
+    n++;
+     c94:	83 c6 01             	add    $0x1,%esi
+    i = read(fd, buf, 512);
+     c97:	83 ec 04             	sub    $0x4,%esp
+     c9a:	68 00 02 00 00       	push   $0x200
+     c9f:	68 60 c9 00 00       	push   $0xc960
+     ca4:	53                   	push   %ebx
+     ca5:	e8 76 4e 00 00       	call   5b20 <read>
+    if(i == 0){
+     caa:	83 c4 10             	add    $0x10,%esp
+     cad:	85 c0                	test   %eax,%eax
+     caf:	75 cf                	jne    c80 <writetest1+0xa0>
+      if(n != NBIG){
+     cb1:	81 fe 0c 01 00 00    	cmp    $0x10c,%esi
+     cb7:	0f 85 86 00 00 00    	jne    d43 <writetest1+0x163>
+  close(fd);
+     cbd:	83 ec 0c             	sub    $0xc,%esp
+     cc0:	53                   	push   %ebx
+     cc1:	e8 5a 4f 00 00       	call   5c20 <close>
+  if(unlink("big") < 0){
+     cc6:	c7 04 24 9b 6a 00 00 	movl   $0x6a9b,(%esp)
+     ccd:	e8 5e 50 00 00       	call   5d30 <unlink>
+     cd2:	83 c4 10             	add    $0x10,%esp
+     cd5:	85 c0                	test   %eax,%eax
+     cd7:	0f 88 ab 00 00 00    	js     d88 <writetest1+0x1a8>
+  printf(stdout, "big files ok\n");
+     cdd:	83 ec 08             	sub    $0x8,%esp
+     ce0:	68 c2 6a 00 00       	push   $0x6ac2
+     ce5:	ff 35 04 a0 00 00    	push   0xa004
+     ceb:	e8 70 55 00 00       	call   6260 <printf>
+}
+     cf0:	83 c4 10             	add    $0x10,%esp
+     cf3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     cf6:	5b                   	pop    %ebx
+     cf7:	5e                   	pop    %esi
+     cf8:	5d                   	pop    %ebp
+     cf9:	c3                   	ret
+      printf(stdout, "error: write big file failed\n", i);
+     cfa:	83 ec 04             	sub    $0x4,%esp
+     cfd:	53                   	push   %ebx
+     cfe:	68 4b 6a 00 00       	push   $0x6a4b
+     d03:	ff 35 04 a0 00 00    	push   0xa004
+     d09:	e8 52 55 00 00       	call   6260 <printf>
+      exit();
+     d0e:	e8 bd 4d 00 00       	call   5ad0 <exit>
+      printf(stdout, "read content of block %d is %d\n",
+     d13:	50                   	push   %eax
+     d14:	56                   	push   %esi
+     d15:	68 04 80 00 00       	push   $0x8004
+     d1a:	ff 35 04 a0 00 00    	push   0xa004
+     d20:	e8 3b 55 00 00       	call   6260 <printf>
+      exit();
+     d25:	e8 a6 4d 00 00       	call   5ad0 <exit>
+      printf(stdout, "read failed %d\n", i);
+     d2a:	83 ec 04             	sub    $0x4,%esp
+     d2d:	50                   	push   %eax
+     d2e:	68 9f 6a 00 00       	push   $0x6a9f
+     d33:	ff 35 04 a0 00 00    	push   0xa004
+     d39:	e8 22 55 00 00       	call   6260 <printf>
+      exit();
+     d3e:	e8 8d 4d 00 00       	call   5ad0 <exit>
+        printf(stdout, "read only %d blocks from big", n);
+     d43:	52                   	push   %edx
+     d44:	56                   	push   %esi
+     d45:	68 82 6a 00 00       	push   $0x6a82
+     d4a:	ff 35 04 a0 00 00    	push   0xa004
+     d50:	e8 0b 55 00 00       	call   6260 <printf>
+        exit();
+     d55:	e8 76 4d 00 00       	call   5ad0 <exit>
+    printf(stdout, "error: open big failed!\n");
+     d5a:	51                   	push   %ecx
+     d5b:	51                   	push   %ecx
+     d5c:	68 69 6a 00 00       	push   $0x6a69
+     d61:	ff 35 04 a0 00 00    	push   0xa004
+     d67:	e8 f4 54 00 00       	call   6260 <printf>
+    exit();
+     d6c:	e8 5f 4d 00 00       	call   5ad0 <exit>
+    printf(stdout, "error: creat big failed!\n");
+     d71:	50                   	push   %eax
+     d72:	50                   	push   %eax
+     d73:	68 31 6a 00 00       	push   $0x6a31
+     d78:	ff 35 04 a0 00 00    	push   0xa004
+     d7e:	e8 dd 54 00 00       	call   6260 <printf>
+    exit();
+     d83:	e8 48 4d 00 00       	call   5ad0 <exit>
+    printf(stdout, "unlink big failed\n");
+     d88:	50                   	push   %eax
+     d89:	50                   	push   %eax
+     d8a:	68 af 6a 00 00       	push   $0x6aaf
+     d8f:	ff 35 04 a0 00 00    	push   0xa004
+     d95:	e8 c6 54 00 00       	call   6260 <printf>
+    exit();
+     d9a:	e8 31 4d 00 00       	call   5ad0 <exit>
+     d9f:	90                   	nop
+
+00000da0 <createtest>:
+{
+     da0:	55                   	push   %ebp
+     da1:	89 e5                	mov    %esp,%ebp
+     da3:	53                   	push   %ebx
+  name[2] = '\0';
+     da4:	bb 30 00 00 00       	mov    $0x30,%ebx
+{
+     da9:	83 ec 0c             	sub    $0xc,%esp
+  printf(stdout, "many creates, followed by unlink test\n");
+     dac:	68 24 80 00 00       	push   $0x8024
+     db1:	ff 35 04 a0 00 00    	push   0xa004
+     db7:	e8 a4 54 00 00       	call   6260 <printf>
+  name[0] = 'a';
+     dbc:	c6 05 5c c9 00 00 61 	movb   $0x61,0xc95c
+  name[2] = '\0';
+     dc3:	83 c4 10             	add    $0x10,%esp
+     dc6:	c6 05 5e c9 00 00 00 	movb   $0x0,0xc95e
+  for(i = 0; i < 52; i++){
+     dcd:	8d 76 00             	lea    0x0(%esi),%esi
+    fd = open(name, O_CREATE|O_RDWR);
+     dd0:	83 ec 08             	sub    $0x8,%esp
+    name[1] = '0' + i;
+     dd3:	88 1d 5d c9 00 00    	mov    %bl,0xc95d
+  for(i = 0; i < 52; i++){
+     dd9:	83 c3 01             	add    $0x1,%ebx
+    fd = open(name, O_CREATE|O_RDWR);
+     ddc:	68 02 02 00 00       	push   $0x202
+     de1:	68 5c c9 00 00       	push   $0xc95c
+     de6:	e8 35 4f 00 00       	call   5d20 <open>
+    close(fd);
+     deb:	89 04 24             	mov    %eax,(%esp)
+     dee:	e8 2d 4e 00 00       	call   5c20 <close>
+  for(i = 0; i < 52; i++){
+     df3:	83 c4 10             	add    $0x10,%esp
+     df6:	80 fb 64             	cmp    $0x64,%bl
+     df9:	75 d5                	jne    dd0 <createtest+0x30>
+  name[0] = 'a';
+     dfb:	c6 05 5c c9 00 00 61 	movb   $0x61,0xc95c
+  name[2] = '\0';
+     e02:	bb 30 00 00 00       	mov    $0x30,%ebx
+     e07:	c6 05 5e c9 00 00 00 	movb   $0x0,0xc95e
+  for(i = 0; i < 52; i++){
+     e0e:	66 90                	xchg   %ax,%ax
+    unlink(name);
+     e10:	83 ec 0c             	sub    $0xc,%esp
+    name[1] = '0' + i;
+     e13:	88 1d 5d c9 00 00    	mov    %bl,0xc95d
+  for(i = 0; i < 52; i++){
+     e19:	83 c3 01             	add    $0x1,%ebx
+    unlink(name);
+     e1c:	68 5c c9 00 00       	push   $0xc95c
+     e21:	e8 0a 4f 00 00       	call   5d30 <unlink>
+  for(i = 0; i < 52; i++){
+     e26:	83 c4 10             	add    $0x10,%esp
+     e29:	80 fb 64             	cmp    $0x64,%bl
+     e2c:	75 e2                	jne    e10 <createtest+0x70>
+  printf(stdout, "many creates, followed by unlink; ok\n");
+     e2e:	83 ec 08             	sub    $0x8,%esp
+     e31:	68 4c 80 00 00       	push   $0x804c
+     e36:	ff 35 04 a0 00 00    	push   0xa004
+     e3c:	e8 1f 54 00 00       	call   6260 <printf>
+}
+     e41:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     e44:	83 c4 10             	add    $0x10,%esp
+     e47:	c9                   	leave
+     e48:	c3                   	ret
+     e49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000e50 <dirtest>:
+{
+     e50:	55                   	push   %ebp
+     e51:	89 e5                	mov    %esp,%ebp
+     e53:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "mkdir test\n");
+     e56:	68 d0 6a 00 00       	push   $0x6ad0
+     e5b:	ff 35 04 a0 00 00    	push   0xa004
+     e61:	e8 fa 53 00 00       	call   6260 <printf>
+  if(mkdir("dir0") < 0){
+     e66:	c7 04 24 dc 6a 00 00 	movl   $0x6adc,(%esp)
+     e6d:	e8 d6 4e 00 00       	call   5d48 <mkdir>
+     e72:	83 c4 10             	add    $0x10,%esp
+     e75:	85 c0                	test   %eax,%eax
+     e77:	78 58                	js     ed1 <dirtest+0x81>
+  if(chdir("dir0") < 0){
+     e79:	83 ec 0c             	sub    $0xc,%esp
+     e7c:	68 dc 6a 00 00       	push   $0x6adc
+     e81:	e8 ca 4e 00 00       	call   5d50 <chdir>
+     e86:	83 c4 10             	add    $0x10,%esp
+     e89:	85 c0                	test   %eax,%eax
+     e8b:	0f 88 85 00 00 00    	js     f16 <dirtest+0xc6>
+  if(chdir("..") < 0){
+     e91:	83 ec 0c             	sub    $0xc,%esp
+     e94:	68 6f 70 00 00       	push   $0x706f
+     e99:	e8 b2 4e 00 00       	call   5d50 <chdir>
+     e9e:	83 c4 10             	add    $0x10,%esp
+     ea1:	85 c0                	test   %eax,%eax
+     ea3:	78 5a                	js     eff <dirtest+0xaf>
+  if(unlink("dir0") < 0){
+     ea5:	83 ec 0c             	sub    $0xc,%esp
+     ea8:	68 dc 6a 00 00       	push   $0x6adc
+     ead:	e8 7e 4e 00 00       	call   5d30 <unlink>
+     eb2:	83 c4 10             	add    $0x10,%esp
+     eb5:	85 c0                	test   %eax,%eax
+     eb7:	78 2f                	js     ee8 <dirtest+0x98>
+  printf(stdout, "mkdir test ok\n");
+     eb9:	83 ec 08             	sub    $0x8,%esp
+     ebc:	68 19 6b 00 00       	push   $0x6b19
+     ec1:	ff 35 04 a0 00 00    	push   0xa004
+     ec7:	e8 94 53 00 00       	call   6260 <printf>
+}
+     ecc:	83 c4 10             	add    $0x10,%esp
+     ecf:	c9                   	leave
+     ed0:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     ed1:	50                   	push   %eax
+     ed2:	50                   	push   %eax
+     ed3:	68 44 73 00 00       	push   $0x7344
+     ed8:	ff 35 04 a0 00 00    	push   0xa004
+     ede:	e8 7d 53 00 00       	call   6260 <printf>
+    exit();
+     ee3:	e8 e8 4b 00 00       	call   5ad0 <exit>
+    printf(stdout, "unlink dir0 failed\n");
+     ee8:	50                   	push   %eax
+     ee9:	50                   	push   %eax
+     eea:	68 05 6b 00 00       	push   $0x6b05
+     eef:	ff 35 04 a0 00 00    	push   0xa004
+     ef5:	e8 66 53 00 00       	call   6260 <printf>
+    exit();
+     efa:	e8 d1 4b 00 00       	call   5ad0 <exit>
+    printf(stdout, "chdir .. failed\n");
+     eff:	52                   	push   %edx
+     f00:	52                   	push   %edx
+     f01:	68 f4 6a 00 00       	push   $0x6af4
+     f06:	ff 35 04 a0 00 00    	push   0xa004
+     f0c:	e8 4f 53 00 00       	call   6260 <printf>
+    exit();
+     f11:	e8 ba 4b 00 00       	call   5ad0 <exit>
+    printf(stdout, "chdir dir0 failed\n");
+     f16:	51                   	push   %ecx
+     f17:	51                   	push   %ecx
+     f18:	68 e1 6a 00 00       	push   $0x6ae1
+     f1d:	ff 35 04 a0 00 00    	push   0xa004
+     f23:	e8 38 53 00 00       	call   6260 <printf>
+    exit();
+     f28:	e8 a3 4b 00 00       	call   5ad0 <exit>
+     f2d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000f30 <exectest>:
+{
+     f30:	55                   	push   %ebp
+     f31:	89 e5                	mov    %esp,%ebp
+     f33:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exec test\n");
+     f36:	68 28 6b 00 00       	push   $0x6b28
+     f3b:	ff 35 04 a0 00 00    	push   0xa004
+     f41:	e8 1a 53 00 00       	call   6260 <printf>
+  if(exec("echo", echoargv) < 0){
+     f46:	5a                   	pop    %edx
+     f47:	59                   	pop    %ecx
+     f48:	68 08 a0 00 00       	push   $0xa008
+     f4d:	68 98 66 00 00       	push   $0x6698
+     f52:	e8 99 4b 00 00       	call   5af0 <exec>
+     f57:	83 c4 10             	add    $0x10,%esp
+     f5a:	85 c0                	test   %eax,%eax
+     f5c:	78 02                	js     f60 <exectest+0x30>
+}
+     f5e:	c9                   	leave
+     f5f:	c3                   	ret
+    printf(stdout, "exec echo failed\n");
+     f60:	50                   	push   %eax
+     f61:	50                   	push   %eax
+     f62:	68 15 67 00 00       	push   $0x6715
+     f67:	ff 35 04 a0 00 00    	push   0xa004
+     f6d:	e8 ee 52 00 00       	call   6260 <printf>
+    exit();
+     f72:	e8 59 4b 00 00       	call   5ad0 <exit>
+     f77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f7e:	66 90                	xchg   %ax,%ax
+
+00000f80 <pipe1>:
+{
+     f80:	55                   	push   %ebp
+     f81:	89 e5                	mov    %esp,%ebp
+     f83:	57                   	push   %edi
+     f84:	56                   	push   %esi
+  if(pipe(fds) != 0){
+     f85:	8d 45 e0             	lea    -0x20(%ebp),%eax
+{
+     f88:	53                   	push   %ebx
+     f89:	83 ec 28             	sub    $0x28,%esp
+  if(pipe(fds) != 0){
+     f8c:	50                   	push   %eax
+     f8d:	e8 5e 4d 00 00       	call   5cf0 <pipe>
+     f92:	83 c4 10             	add    $0x10,%esp
+     f95:	85 c0                	test   %eax,%eax
+     f97:	0f 85 41 01 00 00    	jne    10de <pipe1+0x15e>
+     f9d:	89 c6                	mov    %eax,%esi
+  pid = fork();
+     f9f:	e8 fc 4a 00 00       	call   5aa0 <fork>
+  if(pid == 0){
+     fa4:	85 c0                	test   %eax,%eax
+     fa6:	0f 84 92 00 00 00    	je     103e <pipe1+0xbe>
+  } else if(pid > 0){
+     fac:	0f 8e 3f 01 00 00    	jle    10f1 <pipe1+0x171>
+    close(fds[1]);
+     fb2:	83 ec 0c             	sub    $0xc,%esp
+     fb5:	ff 75 e4             	push   -0x1c(%ebp)
+    total = 0;
+     fb8:	31 db                	xor    %ebx,%ebx
+    cc = 1;
+     fba:	bf 01 00 00 00       	mov    $0x1,%edi
+    close(fds[1]);
+     fbf:	e8 5c 4c 00 00       	call   5c20 <close>
+    while((n = read(fds[0], buf, cc)) > 0){
+     fc4:	83 c4 10             	add    $0x10,%esp
+     fc7:	83 ec 04             	sub    $0x4,%esp
+     fca:	57                   	push   %edi
+     fcb:	68 60 c9 00 00       	push   $0xc960
+     fd0:	ff 75 e0             	push   -0x20(%ebp)
+     fd3:	e8 48 4b 00 00       	call   5b20 <read>
+     fd8:	83 c4 10             	add    $0x10,%esp
+     fdb:	89 c1                	mov    %eax,%ecx
+     fdd:	85 c0                	test   %eax,%eax
+     fdf:	0f 8e b8 00 00 00    	jle    109d <pipe1+0x11d>
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+     fe5:	89 f0                	mov    %esi,%eax
+     fe7:	32 05 60 c9 00 00    	xor    0xc960,%al
+     fed:	0f b6 c0             	movzbl %al,%eax
+     ff0:	85 c0                	test   %eax,%eax
+     ff2:	75 30                	jne    1024 <pipe1+0xa4>
+     ff4:	83 c6 01             	add    $0x1,%esi
+     ff7:	eb 0f                	jmp    1008 <pipe1+0x88>
+     ff9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1000:	38 90 60 c9 00 00    	cmp    %dl,0xc960(%eax)
+    1006:	75 1c                	jne    1024 <pipe1+0xa4>
+    1008:	8d 14 06             	lea    (%esi,%eax,1),%edx
+      for(i = 0; i < n; i++){
+    100b:	83 c0 01             	add    $0x1,%eax
+    100e:	39 c1                	cmp    %eax,%ecx
+    1010:	75 ee                	jne    1000 <pipe1+0x80>
+      cc = cc * 2;
+    1012:	01 ff                	add    %edi,%edi
+      if(cc > sizeof(buf))
+    1014:	b8 00 20 00 00       	mov    $0x2000,%eax
+      total += n;
+    1019:	01 cb                	add    %ecx,%ebx
+      if(cc > sizeof(buf))
+    101b:	89 d6                	mov    %edx,%esi
+    101d:	39 c7                	cmp    %eax,%edi
+    101f:	0f 4f f8             	cmovg  %eax,%edi
+    1022:	eb a3                	jmp    fc7 <pipe1+0x47>
+          printf(1, "pipe1 oops 2\n");
+    1024:	83 ec 08             	sub    $0x8,%esp
+    1027:	68 50 6b 00 00       	push   $0x6b50
+    102c:	6a 01                	push   $0x1
+    102e:	e8 2d 52 00 00       	call   6260 <printf>
+    1033:	83 c4 10             	add    $0x10,%esp
+}
+    1036:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1039:	5b                   	pop    %ebx
+    103a:	5e                   	pop    %esi
+    103b:	5f                   	pop    %edi
+    103c:	5d                   	pop    %ebp
+    103d:	c3                   	ret
+    close(fds[0]);
+    103e:	83 ec 0c             	sub    $0xc,%esp
+    1041:	ff 75 e0             	push   -0x20(%ebp)
+  seq = 0;
+    1044:	31 db                	xor    %ebx,%ebx
+    close(fds[0]);
+    1046:	e8 d5 4b 00 00       	call   5c20 <close>
+    104b:	83 c4 10             	add    $0x10,%esp
+    104e:	66 90                	xchg   %ax,%ax
+      for(i = 0; i < 1033; i++)
+    1050:	31 c0                	xor    %eax,%eax
+    1052:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        buf[i] = seq++;
+    1058:	8d 14 03             	lea    (%ebx,%eax,1),%edx
+      for(i = 0; i < 1033; i++)
+    105b:	83 c0 01             	add    $0x1,%eax
+        buf[i] = seq++;
+    105e:	88 90 5f c9 00 00    	mov    %dl,0xc95f(%eax)
+      for(i = 0; i < 1033; i++)
+    1064:	3d 09 04 00 00       	cmp    $0x409,%eax
+    1069:	75 ed                	jne    1058 <pipe1+0xd8>
+      if(write(fds[1], buf, 1033) != 1033){
+    106b:	83 ec 04             	sub    $0x4,%esp
+        buf[i] = seq++;
+    106e:	81 c3 09 04 00 00    	add    $0x409,%ebx
+      if(write(fds[1], buf, 1033) != 1033){
+    1074:	68 09 04 00 00       	push   $0x409
+    1079:	68 60 c9 00 00       	push   $0xc960
+    107e:	ff 75 e4             	push   -0x1c(%ebp)
+    1081:	e8 1a 4b 00 00       	call   5ba0 <write>
+    1086:	83 c4 10             	add    $0x10,%esp
+    1089:	3d 09 04 00 00       	cmp    $0x409,%eax
+    108e:	75 74                	jne    1104 <pipe1+0x184>
+    for(n = 0; n < 5; n++){
+    1090:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+    1096:	75 b8                	jne    1050 <pipe1+0xd0>
+    exit();
+    1098:	e8 33 4a 00 00       	call   5ad0 <exit>
+    if(total != 5 * 1033){
+    109d:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+    10a3:	75 26                	jne    10cb <pipe1+0x14b>
+    close(fds[0]);
+    10a5:	83 ec 0c             	sub    $0xc,%esp
+    10a8:	ff 75 e0             	push   -0x20(%ebp)
+    10ab:	e8 70 4b 00 00       	call   5c20 <close>
+    wait();
+    10b0:	e8 33 4c 00 00       	call   5ce8 <wait>
+  printf(1, "pipe1 ok\n");
+    10b5:	5a                   	pop    %edx
+    10b6:	59                   	pop    %ecx
+    10b7:	68 75 6b 00 00       	push   $0x6b75
+    10bc:	6a 01                	push   $0x1
+    10be:	e8 9d 51 00 00       	call   6260 <printf>
+    10c3:	83 c4 10             	add    $0x10,%esp
+    10c6:	e9 6b ff ff ff       	jmp    1036 <pipe1+0xb6>
+      printf(1, "pipe1 oops 3 total %d\n", total);
+    10cb:	56                   	push   %esi
+    10cc:	53                   	push   %ebx
+    10cd:	68 5e 6b 00 00       	push   $0x6b5e
+    10d2:	6a 01                	push   $0x1
+    10d4:	e8 87 51 00 00       	call   6260 <printf>
+      exit();
+    10d9:	e8 f2 49 00 00       	call   5ad0 <exit>
+    printf(1, "pipe() failed\n");
+    10de:	50                   	push   %eax
+    10df:	50                   	push   %eax
+    10e0:	68 33 6b 00 00       	push   $0x6b33
+    10e5:	6a 01                	push   $0x1
+    10e7:	e8 74 51 00 00       	call   6260 <printf>
+    exit();
+    10ec:	e8 df 49 00 00       	call   5ad0 <exit>
+    printf(1, "fork() failed\n");
+    10f1:	50                   	push   %eax
+    10f2:	50                   	push   %eax
+    10f3:	68 7f 6b 00 00       	push   $0x6b7f
+    10f8:	6a 01                	push   $0x1
+    10fa:	e8 61 51 00 00       	call   6260 <printf>
+    exit();
+    10ff:	e8 cc 49 00 00       	call   5ad0 <exit>
+        printf(1, "pipe1 oops 1\n");
+    1104:	57                   	push   %edi
+    1105:	57                   	push   %edi
+    1106:	68 42 6b 00 00       	push   $0x6b42
+    110b:	6a 01                	push   $0x1
+    110d:	e8 4e 51 00 00       	call   6260 <printf>
+        exit();
+    1112:	e8 b9 49 00 00       	call   5ad0 <exit>
+    1117:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    111e:	66 90                	xchg   %ax,%ax
+
+00001120 <preempt>:
+{
+    1120:	55                   	push   %ebp
+    1121:	89 e5                	mov    %esp,%ebp
+    1123:	57                   	push   %edi
+    1124:	56                   	push   %esi
+    1125:	53                   	push   %ebx
+    1126:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "preempt: ");
+    1129:	68 8e 6b 00 00       	push   $0x6b8e
+    112e:	6a 01                	push   $0x1
+    1130:	e8 2b 51 00 00       	call   6260 <printf>
+  pid1 = fork();
+    1135:	e8 66 49 00 00       	call   5aa0 <fork>
+  if(pid1 == 0)
+    113a:	83 c4 10             	add    $0x10,%esp
+    113d:	85 c0                	test   %eax,%eax
+    113f:	75 07                	jne    1148 <preempt+0x28>
+    for(;;)
+    1141:	eb fe                	jmp    1141 <preempt+0x21>
+    1143:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1147:	90                   	nop
+    1148:	89 c3                	mov    %eax,%ebx
+  pid2 = fork();
+    114a:	e8 51 49 00 00       	call   5aa0 <fork>
+    114f:	89 c6                	mov    %eax,%esi
+  if(pid2 == 0)
+    1151:	85 c0                	test   %eax,%eax
+    1153:	75 0b                	jne    1160 <preempt+0x40>
+    for(;;)
+    1155:	eb fe                	jmp    1155 <preempt+0x35>
+    1157:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    115e:	66 90                	xchg   %ax,%ax
+  pipe(pfds);
+    1160:	83 ec 0c             	sub    $0xc,%esp
+    1163:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    1166:	50                   	push   %eax
+    1167:	e8 84 4b 00 00       	call   5cf0 <pipe>
+  pid3 = fork();
+    116c:	e8 2f 49 00 00       	call   5aa0 <fork>
+  if(pid3 == 0){
+    1171:	83 c4 10             	add    $0x10,%esp
+  pid3 = fork();
+    1174:	89 c7                	mov    %eax,%edi
+  if(pid3 == 0){
+    1176:	85 c0                	test   %eax,%eax
+    1178:	75 3e                	jne    11b8 <preempt+0x98>
+    close(pfds[0]);
+    117a:	83 ec 0c             	sub    $0xc,%esp
+    117d:	ff 75 e0             	push   -0x20(%ebp)
+    1180:	e8 9b 4a 00 00       	call   5c20 <close>
+    if(write(pfds[1], "x", 1) != 1)
+    1185:	83 c4 0c             	add    $0xc,%esp
+    1188:	6a 01                	push   $0x1
+    118a:	68 53 71 00 00       	push   $0x7153
+    118f:	ff 75 e4             	push   -0x1c(%ebp)
+    1192:	e8 09 4a 00 00       	call   5ba0 <write>
+    1197:	83 c4 10             	add    $0x10,%esp
+    119a:	83 f8 01             	cmp    $0x1,%eax
+    119d:	0f 85 b8 00 00 00    	jne    125b <preempt+0x13b>
+    close(pfds[1]);
+    11a3:	83 ec 0c             	sub    $0xc,%esp
+    11a6:	ff 75 e4             	push   -0x1c(%ebp)
+    11a9:	e8 72 4a 00 00       	call   5c20 <close>
+    11ae:	83 c4 10             	add    $0x10,%esp
+    for(;;)
+    11b1:	eb fe                	jmp    11b1 <preempt+0x91>
+    11b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    11b7:	90                   	nop
+  close(pfds[1]);
+    11b8:	83 ec 0c             	sub    $0xc,%esp
+    11bb:	ff 75 e4             	push   -0x1c(%ebp)
+    11be:	e8 5d 4a 00 00       	call   5c20 <close>
+  if(read(pfds[0], buf, sizeof(buf)) != 1){
+    11c3:	83 c4 0c             	add    $0xc,%esp
+    11c6:	68 00 20 00 00       	push   $0x2000
+    11cb:	68 60 c9 00 00       	push   $0xc960
+    11d0:	ff 75 e0             	push   -0x20(%ebp)
+    11d3:	e8 48 49 00 00       	call   5b20 <read>
+    11d8:	83 c4 10             	add    $0x10,%esp
+    11db:	83 f8 01             	cmp    $0x1,%eax
+    11de:	75 67                	jne    1247 <preempt+0x127>
+  close(pfds[0]);
+    11e0:	83 ec 0c             	sub    $0xc,%esp
+    11e3:	ff 75 e0             	push   -0x20(%ebp)
+    11e6:	e8 35 4a 00 00       	call   5c20 <close>
+  printf(1, "kill... ");
+    11eb:	58                   	pop    %eax
+    11ec:	5a                   	pop    %edx
+    11ed:	68 bf 6b 00 00       	push   $0x6bbf
+    11f2:	6a 01                	push   $0x1
+    11f4:	e8 67 50 00 00       	call   6260 <printf>
+  kill(pid1);
+    11f9:	89 1c 24             	mov    %ebx,(%esp)
+    11fc:	e8 0f 4b 00 00       	call   5d10 <kill>
+  kill(pid2);
+    1201:	89 34 24             	mov    %esi,(%esp)
+    1204:	e8 07 4b 00 00       	call   5d10 <kill>
+  kill(pid3);
+    1209:	89 3c 24             	mov    %edi,(%esp)
+    120c:	e8 ff 4a 00 00       	call   5d10 <kill>
+  printf(1, "wait... ");
+    1211:	59                   	pop    %ecx
+    1212:	5b                   	pop    %ebx
+    1213:	68 c8 6b 00 00       	push   $0x6bc8
+    1218:	6a 01                	push   $0x1
+    121a:	e8 41 50 00 00       	call   6260 <printf>
+  wait();
+    121f:	e8 c4 4a 00 00       	call   5ce8 <wait>
+  wait();
+    1224:	e8 bf 4a 00 00       	call   5ce8 <wait>
+  wait();
+    1229:	e8 ba 4a 00 00       	call   5ce8 <wait>
+  printf(1, "preempt ok\n");
+    122e:	5e                   	pop    %esi
+    122f:	5f                   	pop    %edi
+    1230:	68 d1 6b 00 00       	push   $0x6bd1
+    1235:	6a 01                	push   $0x1
+    1237:	e8 24 50 00 00       	call   6260 <printf>
+    123c:	83 c4 10             	add    $0x10,%esp
+}
+    123f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1242:	5b                   	pop    %ebx
+    1243:	5e                   	pop    %esi
+    1244:	5f                   	pop    %edi
+    1245:	5d                   	pop    %ebp
+    1246:	c3                   	ret
+    printf(1, "preempt read error");
+    1247:	83 ec 08             	sub    $0x8,%esp
+    124a:	68 ac 6b 00 00       	push   $0x6bac
+    124f:	6a 01                	push   $0x1
+    1251:	e8 0a 50 00 00       	call   6260 <printf>
+    1256:	83 c4 10             	add    $0x10,%esp
+    1259:	eb e4                	jmp    123f <preempt+0x11f>
+      printf(1, "preempt write error");
+    125b:	83 ec 08             	sub    $0x8,%esp
+    125e:	68 98 6b 00 00       	push   $0x6b98
+    1263:	6a 01                	push   $0x1
+    1265:	e8 f6 4f 00 00       	call   6260 <printf>
+    126a:	83 c4 10             	add    $0x10,%esp
+    126d:	e9 31 ff ff ff       	jmp    11a3 <preempt+0x83>
+    1272:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1279:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001280 <exitwait>:
+{
+    1280:	55                   	push   %ebp
+    1281:	89 e5                	mov    %esp,%ebp
+    1283:	56                   	push   %esi
+    1284:	be 64 00 00 00       	mov    $0x64,%esi
+    1289:	53                   	push   %ebx
+    128a:	eb 14                	jmp    12a0 <exitwait+0x20>
+    128c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(pid){
+    1290:	74 68                	je     12fa <exitwait+0x7a>
+      if(wait() != pid){
+    1292:	e8 51 4a 00 00       	call   5ce8 <wait>
+    1297:	39 d8                	cmp    %ebx,%eax
+    1299:	75 2d                	jne    12c8 <exitwait+0x48>
+  for(i = 0; i < 100; i++){
+    129b:	83 ee 01             	sub    $0x1,%esi
+    129e:	74 41                	je     12e1 <exitwait+0x61>
+    pid = fork();
+    12a0:	e8 fb 47 00 00       	call   5aa0 <fork>
+    12a5:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+    12a7:	85 c0                	test   %eax,%eax
+    12a9:	79 e5                	jns    1290 <exitwait+0x10>
+      printf(1, "fork failed\n");
+    12ab:	83 ec 08             	sub    $0x8,%esp
+    12ae:	68 48 7e 00 00       	push   $0x7e48
+    12b3:	6a 01                	push   $0x1
+    12b5:	e8 a6 4f 00 00       	call   6260 <printf>
+      return;
+    12ba:	83 c4 10             	add    $0x10,%esp
+}
+    12bd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    12c0:	5b                   	pop    %ebx
+    12c1:	5e                   	pop    %esi
+    12c2:	5d                   	pop    %ebp
+    12c3:	c3                   	ret
+    12c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "wait wrong pid\n");
+    12c8:	83 ec 08             	sub    $0x8,%esp
+    12cb:	68 dd 6b 00 00       	push   $0x6bdd
+    12d0:	6a 01                	push   $0x1
+    12d2:	e8 89 4f 00 00       	call   6260 <printf>
+        return;
+    12d7:	83 c4 10             	add    $0x10,%esp
+}
+    12da:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    12dd:	5b                   	pop    %ebx
+    12de:	5e                   	pop    %esi
+    12df:	5d                   	pop    %ebp
+    12e0:	c3                   	ret
+  printf(1, "exitwait ok\n");
+    12e1:	83 ec 08             	sub    $0x8,%esp
+    12e4:	68 ed 6b 00 00       	push   $0x6bed
+    12e9:	6a 01                	push   $0x1
+    12eb:	e8 70 4f 00 00       	call   6260 <printf>
+    12f0:	83 c4 10             	add    $0x10,%esp
+}
+    12f3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    12f6:	5b                   	pop    %ebx
+    12f7:	5e                   	pop    %esi
+    12f8:	5d                   	pop    %ebp
+    12f9:	c3                   	ret
+      exit();
+    12fa:	e8 d1 47 00 00       	call   5ad0 <exit>
+    12ff:	90                   	nop
+
+00001300 <mem>:
+{
+    1300:	55                   	push   %ebp
+    1301:	89 e5                	mov    %esp,%ebp
+    1303:	56                   	push   %esi
+    1304:	31 f6                	xor    %esi,%esi
+    1306:	53                   	push   %ebx
+  printf(1, "mem test\n");
+    1307:	83 ec 08             	sub    $0x8,%esp
+    130a:	68 fa 6b 00 00       	push   $0x6bfa
+    130f:	6a 01                	push   $0x1
+    1311:	e8 4a 4f 00 00       	call   6260 <printf>
+  ppid = getpid();
+    1316:	e8 45 4a 00 00       	call   5d60 <getpid>
+    131b:	89 c3                	mov    %eax,%ebx
+  if((pid = fork()) == 0){
+    131d:	e8 7e 47 00 00       	call   5aa0 <fork>
+    1322:	83 c4 10             	add    $0x10,%esp
+    1325:	85 c0                	test   %eax,%eax
+    1327:	74 0b                	je     1334 <mem+0x34>
+    1329:	e9 8a 00 00 00       	jmp    13b8 <mem+0xb8>
+    132e:	66 90                	xchg   %ax,%ax
+      *(char**)m2 = m1;
+    1330:	89 30                	mov    %esi,(%eax)
+    1332:	89 c6                	mov    %eax,%esi
+    while((m2 = malloc(10001)) != 0){
+    1334:	83 ec 0c             	sub    $0xc,%esp
+    1337:	68 11 27 00 00       	push   $0x2711
+    133c:	e8 6f 51 00 00       	call   64b0 <malloc>
+    1341:	83 c4 10             	add    $0x10,%esp
+    1344:	85 c0                	test   %eax,%eax
+    1346:	75 e8                	jne    1330 <mem+0x30>
+    while(m1){
+    1348:	85 f6                	test   %esi,%esi
+    134a:	74 18                	je     1364 <mem+0x64>
+    134c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      m2 = *(char**)m1;
+    1350:	89 f0                	mov    %esi,%eax
+      free(m1);
+    1352:	83 ec 0c             	sub    $0xc,%esp
+      m2 = *(char**)m1;
+    1355:	8b 36                	mov    (%esi),%esi
+      free(m1);
+    1357:	50                   	push   %eax
+    1358:	e8 23 51 00 00       	call   6480 <free>
+    while(m1){
+    135d:	83 c4 10             	add    $0x10,%esp
+    1360:	85 f6                	test   %esi,%esi
+    1362:	75 ec                	jne    1350 <mem+0x50>
+    m1 = malloc(1024*20);
+    1364:	83 ec 0c             	sub    $0xc,%esp
+    1367:	68 00 50 00 00       	push   $0x5000
+    136c:	e8 3f 51 00 00       	call   64b0 <malloc>
+    if(m1 == 0){
+    1371:	83 c4 10             	add    $0x10,%esp
+    1374:	85 c0                	test   %eax,%eax
+    1376:	74 20                	je     1398 <mem+0x98>
+    free(m1);
+    1378:	83 ec 0c             	sub    $0xc,%esp
+    137b:	50                   	push   %eax
+    137c:	e8 ff 50 00 00       	call   6480 <free>
+    printf(1, "mem ok\n");
+    1381:	58                   	pop    %eax
+    1382:	5a                   	pop    %edx
+    1383:	68 1e 6c 00 00       	push   $0x6c1e
+    1388:	6a 01                	push   $0x1
+    138a:	e8 d1 4e 00 00       	call   6260 <printf>
+    exit();
+    138f:	e8 3c 47 00 00       	call   5ad0 <exit>
+    1394:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      printf(1, "couldn't allocate mem?!!\n");
+    1398:	83 ec 08             	sub    $0x8,%esp
+    139b:	68 04 6c 00 00       	push   $0x6c04
+    13a0:	6a 01                	push   $0x1
+    13a2:	e8 b9 4e 00 00       	call   6260 <printf>
+      kill(ppid);
+    13a7:	89 1c 24             	mov    %ebx,(%esp)
+    13aa:	e8 61 49 00 00       	call   5d10 <kill>
+      exit();
+    13af:	e8 1c 47 00 00       	call   5ad0 <exit>
+    13b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+    13b8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    13bb:	5b                   	pop    %ebx
+    13bc:	5e                   	pop    %esi
+    13bd:	5d                   	pop    %ebp
+    wait();
+    13be:	e9 25 49 00 00       	jmp    5ce8 <wait>
+    13c3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000013d0 <sharedfd>:
+{
+    13d0:	55                   	push   %ebp
+    13d1:	89 e5                	mov    %esp,%ebp
+    13d3:	57                   	push   %edi
+    13d4:	56                   	push   %esi
+    13d5:	53                   	push   %ebx
+    13d6:	83 ec 34             	sub    $0x34,%esp
+  printf(1, "sharedfd test\n");
+    13d9:	68 26 6c 00 00       	push   $0x6c26
+    13de:	6a 01                	push   $0x1
+    13e0:	e8 7b 4e 00 00       	call   6260 <printf>
+  unlink("sharedfd");
+    13e5:	c7 04 24 35 6c 00 00 	movl   $0x6c35,(%esp)
+    13ec:	e8 3f 49 00 00       	call   5d30 <unlink>
+  fd = open("sharedfd", O_CREATE|O_RDWR);
+    13f1:	5b                   	pop    %ebx
+    13f2:	5e                   	pop    %esi
+    13f3:	68 02 02 00 00       	push   $0x202
+    13f8:	68 35 6c 00 00       	push   $0x6c35
+    13fd:	e8 1e 49 00 00       	call   5d20 <open>
+  if(fd < 0){
+    1402:	83 c4 10             	add    $0x10,%esp
+    1405:	85 c0                	test   %eax,%eax
+    1407:	0f 88 2a 01 00 00    	js     1537 <sharedfd+0x167>
+    140d:	89 c7                	mov    %eax,%edi
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    140f:	8d 75 de             	lea    -0x22(%ebp),%esi
+    1412:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+  pid = fork();
+    1417:	e8 84 46 00 00       	call   5aa0 <fork>
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    141c:	83 f8 01             	cmp    $0x1,%eax
+  pid = fork();
+    141f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    1422:	19 c0                	sbb    %eax,%eax
+    1424:	83 ec 04             	sub    $0x4,%esp
+    1427:	83 e0 f3             	and    $0xfffffff3,%eax
+    142a:	6a 0a                	push   $0xa
+    142c:	83 c0 70             	add    $0x70,%eax
+    142f:	50                   	push   %eax
+    1430:	56                   	push   %esi
+    1431:	e8 8a 44 00 00       	call   58c0 <memset>
+    1436:	83 c4 10             	add    $0x10,%esp
+    1439:	eb 0a                	jmp    1445 <sharedfd+0x75>
+    143b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    143f:	90                   	nop
+  for(i = 0; i < 1000; i++){
+    1440:	83 eb 01             	sub    $0x1,%ebx
+    1443:	74 26                	je     146b <sharedfd+0x9b>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+    1445:	83 ec 04             	sub    $0x4,%esp
+    1448:	6a 0a                	push   $0xa
+    144a:	56                   	push   %esi
+    144b:	57                   	push   %edi
+    144c:	e8 4f 47 00 00       	call   5ba0 <write>
+    1451:	83 c4 10             	add    $0x10,%esp
+    1454:	83 f8 0a             	cmp    $0xa,%eax
+    1457:	74 e7                	je     1440 <sharedfd+0x70>
+      printf(1, "fstests: write sharedfd failed\n");
+    1459:	83 ec 08             	sub    $0x8,%esp
+    145c:	68 a0 80 00 00       	push   $0x80a0
+    1461:	6a 01                	push   $0x1
+    1463:	e8 f8 4d 00 00       	call   6260 <printf>
+      break;
+    1468:	83 c4 10             	add    $0x10,%esp
+  if(pid == 0)
+    146b:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    146e:	85 c9                	test   %ecx,%ecx
+    1470:	0f 84 f5 00 00 00    	je     156b <sharedfd+0x19b>
+    wait();
+    1476:	e8 6d 48 00 00       	call   5ce8 <wait>
+  close(fd);
+    147b:	83 ec 0c             	sub    $0xc,%esp
+  nc = np = 0;
+    147e:	31 db                	xor    %ebx,%ebx
+  close(fd);
+    1480:	57                   	push   %edi
+    1481:	8d 7d e8             	lea    -0x18(%ebp),%edi
+    1484:	e8 97 47 00 00       	call   5c20 <close>
+  fd = open("sharedfd", 0);
+    1489:	58                   	pop    %eax
+    148a:	5a                   	pop    %edx
+    148b:	6a 00                	push   $0x0
+    148d:	68 35 6c 00 00       	push   $0x6c35
+    1492:	e8 89 48 00 00       	call   5d20 <open>
+  if(fd < 0){
+    1497:	83 c4 10             	add    $0x10,%esp
+  nc = np = 0;
+    149a:	31 d2                	xor    %edx,%edx
+  fd = open("sharedfd", 0);
+    149c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(fd < 0){
+    149f:	85 c0                	test   %eax,%eax
+    14a1:	0f 88 aa 00 00 00    	js     1551 <sharedfd+0x181>
+    14a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14ae:	66 90                	xchg   %ax,%ax
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+    14b0:	83 ec 04             	sub    $0x4,%esp
+    14b3:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    14b6:	6a 0a                	push   $0xa
+    14b8:	56                   	push   %esi
+    14b9:	ff 75 d0             	push   -0x30(%ebp)
+    14bc:	e8 5f 46 00 00       	call   5b20 <read>
+    14c1:	83 c4 10             	add    $0x10,%esp
+    14c4:	85 c0                	test   %eax,%eax
+    14c6:	7e 28                	jle    14f0 <sharedfd+0x120>
+    14c8:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    14cb:	89 f0                	mov    %esi,%eax
+    14cd:	eb 13                	jmp    14e2 <sharedfd+0x112>
+    14cf:	90                   	nop
+        np++;
+    14d0:	80 f9 70             	cmp    $0x70,%cl
+    14d3:	0f 94 c1             	sete   %cl
+    14d6:	0f b6 c9             	movzbl %cl,%ecx
+    14d9:	01 cb                	add    %ecx,%ebx
+    for(i = 0; i < sizeof(buf); i++){
+    14db:	83 c0 01             	add    $0x1,%eax
+    14de:	39 f8                	cmp    %edi,%eax
+    14e0:	74 ce                	je     14b0 <sharedfd+0xe0>
+      if(buf[i] == 'c')
+    14e2:	0f b6 08             	movzbl (%eax),%ecx
+    14e5:	80 f9 63             	cmp    $0x63,%cl
+    14e8:	75 e6                	jne    14d0 <sharedfd+0x100>
+        nc++;
+    14ea:	83 c2 01             	add    $0x1,%edx
+      if(buf[i] == 'p')
+    14ed:	eb ec                	jmp    14db <sharedfd+0x10b>
+    14ef:	90                   	nop
+  close(fd);
+    14f0:	83 ec 0c             	sub    $0xc,%esp
+    14f3:	ff 75 d0             	push   -0x30(%ebp)
+    14f6:	e8 25 47 00 00       	call   5c20 <close>
+  unlink("sharedfd");
+    14fb:	c7 04 24 35 6c 00 00 	movl   $0x6c35,(%esp)
+    1502:	e8 29 48 00 00       	call   5d30 <unlink>
+  if(nc == 10000 && np == 10000){
+    1507:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    150a:	83 c4 10             	add    $0x10,%esp
+    150d:	81 fa 10 27 00 00    	cmp    $0x2710,%edx
+    1513:	75 5b                	jne    1570 <sharedfd+0x1a0>
+    1515:	81 fb 10 27 00 00    	cmp    $0x2710,%ebx
+    151b:	75 53                	jne    1570 <sharedfd+0x1a0>
+    printf(1, "sharedfd ok\n");
+    151d:	83 ec 08             	sub    $0x8,%esp
+    1520:	68 3e 6c 00 00       	push   $0x6c3e
+    1525:	6a 01                	push   $0x1
+    1527:	e8 34 4d 00 00       	call   6260 <printf>
+    152c:	83 c4 10             	add    $0x10,%esp
+}
+    152f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1532:	5b                   	pop    %ebx
+    1533:	5e                   	pop    %esi
+    1534:	5f                   	pop    %edi
+    1535:	5d                   	pop    %ebp
+    1536:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for writing");
+    1537:	83 ec 08             	sub    $0x8,%esp
+    153a:	68 74 80 00 00       	push   $0x8074
+    153f:	6a 01                	push   $0x1
+    1541:	e8 1a 4d 00 00       	call   6260 <printf>
+    return;
+    1546:	83 c4 10             	add    $0x10,%esp
+}
+    1549:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    154c:	5b                   	pop    %ebx
+    154d:	5e                   	pop    %esi
+    154e:	5f                   	pop    %edi
+    154f:	5d                   	pop    %ebp
+    1550:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for reading\n");
+    1551:	83 ec 08             	sub    $0x8,%esp
+    1554:	68 c0 80 00 00       	push   $0x80c0
+    1559:	6a 01                	push   $0x1
+    155b:	e8 00 4d 00 00       	call   6260 <printf>
+    return;
+    1560:	83 c4 10             	add    $0x10,%esp
+}
+    1563:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1566:	5b                   	pop    %ebx
+    1567:	5e                   	pop    %esi
+    1568:	5f                   	pop    %edi
+    1569:	5d                   	pop    %ebp
+    156a:	c3                   	ret
+    exit();
+    156b:	e8 60 45 00 00       	call   5ad0 <exit>
+    printf(1, "sharedfd oops %d %d\n", nc, np);
+    1570:	53                   	push   %ebx
+    1571:	52                   	push   %edx
+    1572:	68 4b 6c 00 00       	push   $0x6c4b
+    1577:	6a 01                	push   $0x1
+    1579:	e8 e2 4c 00 00       	call   6260 <printf>
+    exit();
+    157e:	e8 4d 45 00 00       	call   5ad0 <exit>
+    1583:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    158a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001590 <fourfiles>:
+{
+    1590:	55                   	push   %ebp
+    1591:	89 e5                	mov    %esp,%ebp
+    1593:	57                   	push   %edi
+    1594:	56                   	push   %esi
+    1595:	53                   	push   %ebx
+  for(pi = 0; pi < 4; pi++){
+    1596:	31 db                	xor    %ebx,%ebx
+{
+    1598:	83 ec 34             	sub    $0x34,%esp
+  char *names[] = { "f0", "f1", "f2", "f3" };
+    159b:	c7 45 d8 60 6c 00 00 	movl   $0x6c60,-0x28(%ebp)
+    15a2:	c7 45 dc a9 6d 00 00 	movl   $0x6da9,-0x24(%ebp)
+    15a9:	c7 45 e0 ad 6d 00 00 	movl   $0x6dad,-0x20(%ebp)
+    15b0:	c7 45 e4 63 6c 00 00 	movl   $0x6c63,-0x1c(%ebp)
+  printf(1, "fourfiles test\n");
+    15b7:	68 66 6c 00 00       	push   $0x6c66
+    15bc:	6a 01                	push   $0x1
+    15be:	e8 9d 4c 00 00       	call   6260 <printf>
+    15c3:	83 c4 10             	add    $0x10,%esp
+    fname = names[pi];
+    15c6:	8b 74 9d d8          	mov    -0x28(%ebp,%ebx,4),%esi
+    unlink(fname);
+    15ca:	83 ec 0c             	sub    $0xc,%esp
+    15cd:	56                   	push   %esi
+    15ce:	e8 5d 47 00 00       	call   5d30 <unlink>
+    pid = fork();
+    15d3:	e8 c8 44 00 00       	call   5aa0 <fork>
+    if(pid < 0){
+    15d8:	83 c4 10             	add    $0x10,%esp
+    15db:	85 c0                	test   %eax,%eax
+    15dd:	0f 88 65 01 00 00    	js     1748 <fourfiles+0x1b8>
+    if(pid == 0){
+    15e3:	0f 84 eb 00 00 00    	je     16d4 <fourfiles+0x144>
+  for(pi = 0; pi < 4; pi++){
+    15e9:	83 c3 01             	add    $0x1,%ebx
+    15ec:	83 fb 04             	cmp    $0x4,%ebx
+    15ef:	75 d5                	jne    15c6 <fourfiles+0x36>
+    wait();
+    15f1:	e8 f2 46 00 00       	call   5ce8 <wait>
+  for(i = 0; i < 2; i++){
+    15f6:	31 f6                	xor    %esi,%esi
+    wait();
+    15f8:	e8 eb 46 00 00       	call   5ce8 <wait>
+    15fd:	e8 e6 46 00 00       	call   5ce8 <wait>
+    1602:	e8 e1 46 00 00       	call   5ce8 <wait>
+    fname = names[i];
+    1607:	8b 5c b5 d8          	mov    -0x28(%ebp,%esi,4),%ebx
+    fd = open(fname, 0);
+    160b:	83 ec 08             	sub    $0x8,%esp
+    total = 0;
+    160e:	31 ff                	xor    %edi,%edi
+    fd = open(fname, 0);
+    1610:	6a 00                	push   $0x0
+    1612:	53                   	push   %ebx
+    1613:	e8 08 47 00 00       	call   5d20 <open>
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    1618:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    161b:	83 c4 10             	add    $0x10,%esp
+    161e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    1621:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1628:	83 ec 04             	sub    $0x4,%esp
+    162b:	68 00 20 00 00       	push   $0x2000
+    1630:	68 60 c9 00 00       	push   $0xc960
+    1635:	ff 75 d4             	push   -0x2c(%ebp)
+    1638:	e8 e3 44 00 00       	call   5b20 <read>
+    163d:	83 c4 10             	add    $0x10,%esp
+    1640:	89 c3                	mov    %eax,%ebx
+    1642:	85 c0                	test   %eax,%eax
+    1644:	7e 28                	jle    166e <fourfiles+0xde>
+      for(j = 0; j < n; j++){
+    1646:	31 c0                	xor    %eax,%eax
+    1648:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    164f:	90                   	nop
+        if(buf[j] != '0'+i){
+    1650:	83 fe 01             	cmp    $0x1,%esi
+    1653:	0f be 88 60 c9 00 00 	movsbl 0xc960(%eax),%ecx
+    165a:	19 d2                	sbb    %edx,%edx
+    165c:	83 c2 31             	add    $0x31,%edx
+    165f:	39 d1                	cmp    %edx,%ecx
+    1661:	75 5d                	jne    16c0 <fourfiles+0x130>
+      for(j = 0; j < n; j++){
+    1663:	83 c0 01             	add    $0x1,%eax
+    1666:	39 c3                	cmp    %eax,%ebx
+    1668:	75 e6                	jne    1650 <fourfiles+0xc0>
+      total += n;
+    166a:	01 df                	add    %ebx,%edi
+    166c:	eb ba                	jmp    1628 <fourfiles+0x98>
+    close(fd);
+    166e:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    1671:	83 ec 0c             	sub    $0xc,%esp
+    1674:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1677:	51                   	push   %ecx
+    1678:	e8 a3 45 00 00       	call   5c20 <close>
+    if(total != 12*500){
+    167d:	83 c4 10             	add    $0x10,%esp
+    1680:	81 ff 70 17 00 00    	cmp    $0x1770,%edi
+    1686:	0f 85 d0 00 00 00    	jne    175c <fourfiles+0x1cc>
+    unlink(fname);
+    168c:	83 ec 0c             	sub    $0xc,%esp
+    168f:	53                   	push   %ebx
+    1690:	e8 9b 46 00 00       	call   5d30 <unlink>
+  for(i = 0; i < 2; i++){
+    1695:	83 c4 10             	add    $0x10,%esp
+    1698:	85 f6                	test   %esi,%esi
+    169a:	75 0a                	jne    16a6 <fourfiles+0x116>
+    169c:	be 01 00 00 00       	mov    $0x1,%esi
+    16a1:	e9 61 ff ff ff       	jmp    1607 <fourfiles+0x77>
+  printf(1, "fourfiles ok\n");
+    16a6:	83 ec 08             	sub    $0x8,%esp
+    16a9:	68 a4 6c 00 00       	push   $0x6ca4
+    16ae:	6a 01                	push   $0x1
+    16b0:	e8 ab 4b 00 00       	call   6260 <printf>
+}
+    16b5:	83 c4 10             	add    $0x10,%esp
+    16b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    16bb:	5b                   	pop    %ebx
+    16bc:	5e                   	pop    %esi
+    16bd:	5f                   	pop    %edi
+    16be:	5d                   	pop    %ebp
+    16bf:	c3                   	ret
+          printf(1, "wrong char\n");
+    16c0:	83 ec 08             	sub    $0x8,%esp
+    16c3:	68 87 6c 00 00       	push   $0x6c87
+    16c8:	6a 01                	push   $0x1
+    16ca:	e8 91 4b 00 00       	call   6260 <printf>
+          exit();
+    16cf:	e8 fc 43 00 00       	call   5ad0 <exit>
+      fd = open(fname, O_CREATE | O_RDWR);
+    16d4:	83 ec 08             	sub    $0x8,%esp
+    16d7:	68 02 02 00 00       	push   $0x202
+    16dc:	56                   	push   %esi
+    16dd:	e8 3e 46 00 00       	call   5d20 <open>
+      if(fd < 0){
+    16e2:	83 c4 10             	add    $0x10,%esp
+      fd = open(fname, O_CREATE | O_RDWR);
+    16e5:	89 c6                	mov    %eax,%esi
+      if(fd < 0){
+    16e7:	85 c0                	test   %eax,%eax
+    16e9:	78 45                	js     1730 <fourfiles+0x1a0>
+      memset(buf, '0'+pi, 512);
+    16eb:	83 ec 04             	sub    $0x4,%esp
+    16ee:	83 c3 30             	add    $0x30,%ebx
+    16f1:	68 00 02 00 00       	push   $0x200
+    16f6:	53                   	push   %ebx
+    16f7:	bb 0c 00 00 00       	mov    $0xc,%ebx
+    16fc:	68 60 c9 00 00       	push   $0xc960
+    1701:	e8 ba 41 00 00       	call   58c0 <memset>
+    1706:	83 c4 10             	add    $0x10,%esp
+        if((n = write(fd, buf, 500)) != 500){
+    1709:	83 ec 04             	sub    $0x4,%esp
+    170c:	68 f4 01 00 00       	push   $0x1f4
+    1711:	68 60 c9 00 00       	push   $0xc960
+    1716:	56                   	push   %esi
+    1717:	e8 84 44 00 00       	call   5ba0 <write>
+    171c:	83 c4 10             	add    $0x10,%esp
+    171f:	3d f4 01 00 00       	cmp    $0x1f4,%eax
+    1724:	75 49                	jne    176f <fourfiles+0x1df>
+      for(i = 0; i < 12; i++){
+    1726:	83 eb 01             	sub    $0x1,%ebx
+    1729:	75 de                	jne    1709 <fourfiles+0x179>
+      exit();
+    172b:	e8 a0 43 00 00       	call   5ad0 <exit>
+        printf(1, "create failed\n");
+    1730:	51                   	push   %ecx
+    1731:	51                   	push   %ecx
+    1732:	68 a5 75 00 00       	push   $0x75a5
+    1737:	6a 01                	push   $0x1
+    1739:	e8 22 4b 00 00       	call   6260 <printf>
+        exit();
+    173e:	e8 8d 43 00 00       	call   5ad0 <exit>
+    1743:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1747:	90                   	nop
+      printf(1, "fork failed\n");
+    1748:	83 ec 08             	sub    $0x8,%esp
+    174b:	68 48 7e 00 00       	push   $0x7e48
+    1750:	6a 01                	push   $0x1
+    1752:	e8 09 4b 00 00       	call   6260 <printf>
+      exit();
+    1757:	e8 74 43 00 00       	call   5ad0 <exit>
+      printf(1, "wrong length %d\n", total);
+    175c:	50                   	push   %eax
+    175d:	57                   	push   %edi
+    175e:	68 93 6c 00 00       	push   $0x6c93
+    1763:	6a 01                	push   $0x1
+    1765:	e8 f6 4a 00 00       	call   6260 <printf>
+      exit();
+    176a:	e8 61 43 00 00       	call   5ad0 <exit>
+          printf(1, "write failed %d\n", n);
+    176f:	52                   	push   %edx
+    1770:	50                   	push   %eax
+    1771:	68 76 6c 00 00       	push   $0x6c76
+    1776:	6a 01                	push   $0x1
+    1778:	e8 e3 4a 00 00       	call   6260 <printf>
+          exit();
+    177d:	e8 4e 43 00 00       	call   5ad0 <exit>
+    1782:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1789:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001790 <createdelete>:
+{
+    1790:	55                   	push   %ebp
+    1791:	89 e5                	mov    %esp,%ebp
+    1793:	57                   	push   %edi
+    1794:	56                   	push   %esi
+  for(pi = 0; pi < 4; pi++){
+    1795:	31 f6                	xor    %esi,%esi
+{
+    1797:	53                   	push   %ebx
+    1798:	83 ec 44             	sub    $0x44,%esp
+  printf(1, "createdelete test\n");
+    179b:	68 b2 6c 00 00       	push   $0x6cb2
+    17a0:	6a 01                	push   $0x1
+    17a2:	e8 b9 4a 00 00       	call   6260 <printf>
+    17a7:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+    17aa:	e8 f1 42 00 00       	call   5aa0 <fork>
+    17af:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+    17b1:	85 c0                	test   %eax,%eax
+    17b3:	0f 88 ac 01 00 00    	js     1965 <createdelete+0x1d5>
+    if(pid == 0){
+    17b9:	0f 84 01 01 00 00    	je     18c0 <createdelete+0x130>
+  for(pi = 0; pi < 4; pi++){
+    17bf:	83 c6 01             	add    $0x1,%esi
+    17c2:	83 fe 04             	cmp    $0x4,%esi
+    17c5:	75 e3                	jne    17aa <createdelete+0x1a>
+    wait();
+    17c7:	e8 1c 45 00 00       	call   5ce8 <wait>
+  for(i = 0; i < N; i++){
+    17cc:	31 ff                	xor    %edi,%edi
+    17ce:	8d 75 c8             	lea    -0x38(%ebp),%esi
+    wait();
+    17d1:	e8 12 45 00 00       	call   5ce8 <wait>
+    17d6:	e8 0d 45 00 00       	call   5ce8 <wait>
+    17db:	e8 08 45 00 00       	call   5ce8 <wait>
+  name[0] = name[1] = name[2] = 0;
+    17e0:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+  for(i = 0; i < N; i++){
+    17e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if((i == 0 || i >= N/2) && fd < 0){
+    17e8:	85 ff                	test   %edi,%edi
+      name[1] = '0' + i;
+    17ea:	8d 47 30             	lea    0x30(%edi),%eax
+      if((i == 0 || i >= N/2) && fd < 0){
+    17ed:	bb 70 00 00 00       	mov    $0x70,%ebx
+    17f2:	0f 94 c2             	sete   %dl
+    17f5:	83 ff 09             	cmp    $0x9,%edi
+      name[1] = '0' + i;
+    17f8:	88 45 c6             	mov    %al,-0x3a(%ebp)
+      if((i == 0 || i >= N/2) && fd < 0){
+    17fb:	0f 9f c0             	setg   %al
+    17fe:	09 c2                	or     %eax,%edx
+    1800:	88 55 c7             	mov    %dl,-0x39(%ebp)
+      name[1] = '0' + i;
+    1803:	0f b6 45 c6          	movzbl -0x3a(%ebp),%eax
+      fd = open(name, 0);
+    1807:	83 ec 08             	sub    $0x8,%esp
+      name[0] = 'p' + pi;
+    180a:	88 5d c8             	mov    %bl,-0x38(%ebp)
+      name[1] = '0' + i;
+    180d:	88 45 c9             	mov    %al,-0x37(%ebp)
+      fd = open(name, 0);
+    1810:	6a 00                	push   $0x0
+    1812:	56                   	push   %esi
+    1813:	e8 08 45 00 00       	call   5d20 <open>
+      if((i == 0 || i >= N/2) && fd < 0){
+    1818:	83 c4 10             	add    $0x10,%esp
+    181b:	80 7d c7 00          	cmpb   $0x0,-0x39(%ebp)
+    181f:	74 7f                	je     18a0 <createdelete+0x110>
+    1821:	85 c0                	test   %eax,%eax
+    1823:	0f 88 27 01 00 00    	js     1950 <createdelete+0x1c0>
+        close(fd);
+    1829:	83 ec 0c             	sub    $0xc,%esp
+    182c:	50                   	push   %eax
+    182d:	e8 ee 43 00 00       	call   5c20 <close>
+    1832:	83 c4 10             	add    $0x10,%esp
+    for(pi = 0; pi < 4; pi++){
+    1835:	83 c3 01             	add    $0x1,%ebx
+    1838:	80 fb 74             	cmp    $0x74,%bl
+    183b:	75 c6                	jne    1803 <createdelete+0x73>
+  for(i = 0; i < N; i++){
+    183d:	83 c7 01             	add    $0x1,%edi
+    1840:	83 ff 14             	cmp    $0x14,%edi
+    1843:	75 a3                	jne    17e8 <createdelete+0x58>
+    1845:	bf 70 00 00 00       	mov    $0x70,%edi
+    184a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      name[1] = '0' + i;
+    1850:	8d 47 c0             	lea    -0x40(%edi),%eax
+    1853:	bb 04 00 00 00       	mov    $0x4,%ebx
+    1858:	88 45 c7             	mov    %al,-0x39(%ebp)
+      name[0] = 'p' + i;
+    185b:	89 f8                	mov    %edi,%eax
+      unlink(name);
+    185d:	83 ec 0c             	sub    $0xc,%esp
+      name[0] = 'p' + i;
+    1860:	88 45 c8             	mov    %al,-0x38(%ebp)
+      name[1] = '0' + i;
+    1863:	0f b6 45 c7          	movzbl -0x39(%ebp),%eax
+    1867:	88 45 c9             	mov    %al,-0x37(%ebp)
+      unlink(name);
+    186a:	56                   	push   %esi
+    186b:	e8 c0 44 00 00       	call   5d30 <unlink>
+    for(pi = 0; pi < 4; pi++){
+    1870:	83 c4 10             	add    $0x10,%esp
+    1873:	83 eb 01             	sub    $0x1,%ebx
+    1876:	75 e3                	jne    185b <createdelete+0xcb>
+  for(i = 0; i < N; i++){
+    1878:	83 c7 01             	add    $0x1,%edi
+    187b:	89 f8                	mov    %edi,%eax
+    187d:	3c 84                	cmp    $0x84,%al
+    187f:	75 cf                	jne    1850 <createdelete+0xc0>
+  printf(1, "createdelete ok\n");
+    1881:	83 ec 08             	sub    $0x8,%esp
+    1884:	68 c5 6c 00 00       	push   $0x6cc5
+    1889:	6a 01                	push   $0x1
+    188b:	e8 d0 49 00 00       	call   6260 <printf>
+}
+    1890:	83 c4 10             	add    $0x10,%esp
+    1893:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1896:	5b                   	pop    %ebx
+    1897:	5e                   	pop    %esi
+    1898:	5f                   	pop    %edi
+    1899:	5d                   	pop    %ebp
+    189a:	c3                   	ret
+    189b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    189f:	90                   	nop
+      } else if((i >= 1 && i < N/2) && fd >= 0){
+    18a0:	85 c0                	test   %eax,%eax
+    18a2:	78 91                	js     1835 <createdelete+0xa5>
+        printf(1, "oops createdelete %s did exist\n", name);
+    18a4:	50                   	push   %eax
+    18a5:	56                   	push   %esi
+    18a6:	68 10 81 00 00       	push   $0x8110
+    18ab:	6a 01                	push   $0x1
+    18ad:	e8 ae 49 00 00       	call   6260 <printf>
+        exit();
+    18b2:	e8 19 42 00 00       	call   5ad0 <exit>
+    18b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18be:	66 90                	xchg   %ax,%ax
+      name[0] = 'p' + pi;
+    18c0:	8d 46 70             	lea    0x70(%esi),%eax
+      name[2] = '\0';
+    18c3:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+    18c7:	8d 75 c8             	lea    -0x38(%ebp),%esi
+      name[0] = 'p' + pi;
+    18ca:	88 45 c8             	mov    %al,-0x38(%ebp)
+      for(i = 0; i < N; i++){
+    18cd:	8d 76 00             	lea    0x0(%esi),%esi
+        fd = open(name, O_CREATE | O_RDWR);
+    18d0:	83 ec 08             	sub    $0x8,%esp
+        name[1] = '0' + i;
+    18d3:	8d 43 30             	lea    0x30(%ebx),%eax
+    18d6:	88 45 c9             	mov    %al,-0x37(%ebp)
+        fd = open(name, O_CREATE | O_RDWR);
+    18d9:	68 02 02 00 00       	push   $0x202
+    18de:	56                   	push   %esi
+    18df:	e8 3c 44 00 00       	call   5d20 <open>
+        if(fd < 0){
+    18e4:	83 c4 10             	add    $0x10,%esp
+    18e7:	85 c0                	test   %eax,%eax
+    18e9:	0f 88 8a 00 00 00    	js     1979 <createdelete+0x1e9>
+        close(fd);
+    18ef:	83 ec 0c             	sub    $0xc,%esp
+    18f2:	50                   	push   %eax
+    18f3:	e8 28 43 00 00       	call   5c20 <close>
+        if(i > 0 && (i % 2 ) == 0){
+    18f8:	83 c4 10             	add    $0x10,%esp
+    18fb:	85 db                	test   %ebx,%ebx
+    18fd:	74 19                	je     1918 <createdelete+0x188>
+    18ff:	f6 c3 01             	test   $0x1,%bl
+    1902:	74 1b                	je     191f <createdelete+0x18f>
+      for(i = 0; i < N; i++){
+    1904:	83 c3 01             	add    $0x1,%ebx
+    1907:	83 fb 14             	cmp    $0x14,%ebx
+    190a:	75 c4                	jne    18d0 <createdelete+0x140>
+      exit();
+    190c:	e8 bf 41 00 00       	call   5ad0 <exit>
+    1911:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      for(i = 0; i < N; i++){
+    1918:	bb 01 00 00 00       	mov    $0x1,%ebx
+    191d:	eb b1                	jmp    18d0 <createdelete+0x140>
+          name[1] = '0' + (i / 2);
+    191f:	89 d8                	mov    %ebx,%eax
+          if(unlink(name) < 0){
+    1921:	83 ec 0c             	sub    $0xc,%esp
+          name[1] = '0' + (i / 2);
+    1924:	d1 f8                	sar    %eax
+    1926:	83 c0 30             	add    $0x30,%eax
+    1929:	88 45 c9             	mov    %al,-0x37(%ebp)
+          if(unlink(name) < 0){
+    192c:	56                   	push   %esi
+    192d:	e8 fe 43 00 00       	call   5d30 <unlink>
+    1932:	83 c4 10             	add    $0x10,%esp
+    1935:	85 c0                	test   %eax,%eax
+    1937:	79 cb                	jns    1904 <createdelete+0x174>
+            printf(1, "unlink failed\n");
+    1939:	52                   	push   %edx
+    193a:	52                   	push   %edx
+    193b:	68 7a 73 00 00       	push   $0x737a
+    1940:	6a 01                	push   $0x1
+    1942:	e8 19 49 00 00       	call   6260 <printf>
+            exit();
+    1947:	e8 84 41 00 00       	call   5ad0 <exit>
+    194c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "oops createdelete %s didn't exist\n", name);
+    1950:	83 ec 04             	sub    $0x4,%esp
+    1953:	56                   	push   %esi
+    1954:	68 ec 80 00 00       	push   $0x80ec
+    1959:	6a 01                	push   $0x1
+    195b:	e8 00 49 00 00       	call   6260 <printf>
+        exit();
+    1960:	e8 6b 41 00 00       	call   5ad0 <exit>
+      printf(1, "fork failed\n");
+    1965:	83 ec 08             	sub    $0x8,%esp
+    1968:	68 48 7e 00 00       	push   $0x7e48
+    196d:	6a 01                	push   $0x1
+    196f:	e8 ec 48 00 00       	call   6260 <printf>
+      exit();
+    1974:	e8 57 41 00 00       	call   5ad0 <exit>
+          printf(1, "create failed\n");
+    1979:	83 ec 08             	sub    $0x8,%esp
+    197c:	68 a5 75 00 00       	push   $0x75a5
+    1981:	6a 01                	push   $0x1
+    1983:	e8 d8 48 00 00       	call   6260 <printf>
+          exit();
+    1988:	e8 43 41 00 00       	call   5ad0 <exit>
+    198d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001990 <unlinkread>:
+{
+    1990:	55                   	push   %ebp
+    1991:	89 e5                	mov    %esp,%ebp
+    1993:	56                   	push   %esi
+    1994:	53                   	push   %ebx
+  printf(1, "unlinkread test\n");
+    1995:	83 ec 08             	sub    $0x8,%esp
+    1998:	68 d6 6c 00 00       	push   $0x6cd6
+    199d:	6a 01                	push   $0x1
+    199f:	e8 bc 48 00 00       	call   6260 <printf>
+  fd = open("unlinkread", O_CREATE | O_RDWR);
+    19a4:	5b                   	pop    %ebx
+    19a5:	5e                   	pop    %esi
+    19a6:	68 02 02 00 00       	push   $0x202
+    19ab:	68 e7 6c 00 00       	push   $0x6ce7
+    19b0:	e8 6b 43 00 00       	call   5d20 <open>
+  if(fd < 0){
+    19b5:	83 c4 10             	add    $0x10,%esp
+    19b8:	85 c0                	test   %eax,%eax
+    19ba:	0f 88 e6 00 00 00    	js     1aa6 <unlinkread+0x116>
+  write(fd, "hello", 5);
+    19c0:	83 ec 04             	sub    $0x4,%esp
+    19c3:	89 c3                	mov    %eax,%ebx
+    19c5:	6a 05                	push   $0x5
+    19c7:	68 0c 6d 00 00       	push   $0x6d0c
+    19cc:	50                   	push   %eax
+    19cd:	e8 ce 41 00 00       	call   5ba0 <write>
+  close(fd);
+    19d2:	89 1c 24             	mov    %ebx,(%esp)
+    19d5:	e8 46 42 00 00       	call   5c20 <close>
+  fd = open("unlinkread", O_RDWR);
+    19da:	58                   	pop    %eax
+    19db:	5a                   	pop    %edx
+    19dc:	6a 02                	push   $0x2
+    19de:	68 e7 6c 00 00       	push   $0x6ce7
+    19e3:	e8 38 43 00 00       	call   5d20 <open>
+  if(fd < 0){
+    19e8:	83 c4 10             	add    $0x10,%esp
+  fd = open("unlinkread", O_RDWR);
+    19eb:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    19ed:	85 c0                	test   %eax,%eax
+    19ef:	0f 88 10 01 00 00    	js     1b05 <unlinkread+0x175>
+  if(unlink("unlinkread") != 0){
+    19f5:	83 ec 0c             	sub    $0xc,%esp
+    19f8:	68 e7 6c 00 00       	push   $0x6ce7
+    19fd:	e8 2e 43 00 00       	call   5d30 <unlink>
+    1a02:	83 c4 10             	add    $0x10,%esp
+    1a05:	85 c0                	test   %eax,%eax
+    1a07:	0f 85 e5 00 00 00    	jne    1af2 <unlinkread+0x162>
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    1a0d:	83 ec 08             	sub    $0x8,%esp
+    1a10:	68 02 02 00 00       	push   $0x202
+    1a15:	68 e7 6c 00 00       	push   $0x6ce7
+    1a1a:	e8 01 43 00 00       	call   5d20 <open>
+  write(fd1, "yyy", 3);
+    1a1f:	83 c4 0c             	add    $0xc,%esp
+    1a22:	6a 03                	push   $0x3
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    1a24:	89 c6                	mov    %eax,%esi
+  write(fd1, "yyy", 3);
+    1a26:	68 44 6d 00 00       	push   $0x6d44
+    1a2b:	50                   	push   %eax
+    1a2c:	e8 6f 41 00 00       	call   5ba0 <write>
+  close(fd1);
+    1a31:	89 34 24             	mov    %esi,(%esp)
+    1a34:	e8 e7 41 00 00       	call   5c20 <close>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    1a39:	83 c4 0c             	add    $0xc,%esp
+    1a3c:	68 00 20 00 00       	push   $0x2000
+    1a41:	68 60 c9 00 00       	push   $0xc960
+    1a46:	53                   	push   %ebx
+    1a47:	e8 d4 40 00 00       	call   5b20 <read>
+    1a4c:	83 c4 10             	add    $0x10,%esp
+    1a4f:	83 f8 05             	cmp    $0x5,%eax
+    1a52:	0f 85 87 00 00 00    	jne    1adf <unlinkread+0x14f>
+  if(buf[0] != 'h'){
+    1a58:	80 3d 60 c9 00 00 68 	cmpb   $0x68,0xc960
+    1a5f:	75 6b                	jne    1acc <unlinkread+0x13c>
+  if(write(fd, buf, 10) != 10){
+    1a61:	83 ec 04             	sub    $0x4,%esp
+    1a64:	6a 0a                	push   $0xa
+    1a66:	68 60 c9 00 00       	push   $0xc960
+    1a6b:	53                   	push   %ebx
+    1a6c:	e8 2f 41 00 00       	call   5ba0 <write>
+    1a71:	83 c4 10             	add    $0x10,%esp
+    1a74:	83 f8 0a             	cmp    $0xa,%eax
+    1a77:	75 40                	jne    1ab9 <unlinkread+0x129>
+  close(fd);
+    1a79:	83 ec 0c             	sub    $0xc,%esp
+    1a7c:	53                   	push   %ebx
+    1a7d:	e8 9e 41 00 00       	call   5c20 <close>
+  unlink("unlinkread");
+    1a82:	c7 04 24 e7 6c 00 00 	movl   $0x6ce7,(%esp)
+    1a89:	e8 a2 42 00 00       	call   5d30 <unlink>
+  printf(1, "unlinkread ok\n");
+    1a8e:	58                   	pop    %eax
+    1a8f:	5a                   	pop    %edx
+    1a90:	68 8f 6d 00 00       	push   $0x6d8f
+    1a95:	6a 01                	push   $0x1
+    1a97:	e8 c4 47 00 00       	call   6260 <printf>
+}
+    1a9c:	83 c4 10             	add    $0x10,%esp
+    1a9f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1aa2:	5b                   	pop    %ebx
+    1aa3:	5e                   	pop    %esi
+    1aa4:	5d                   	pop    %ebp
+    1aa5:	c3                   	ret
+    printf(1, "create unlinkread failed\n");
+    1aa6:	51                   	push   %ecx
+    1aa7:	51                   	push   %ecx
+    1aa8:	68 f2 6c 00 00       	push   $0x6cf2
+    1aad:	6a 01                	push   $0x1
+    1aaf:	e8 ac 47 00 00       	call   6260 <printf>
+    exit();
+    1ab4:	e8 17 40 00 00       	call   5ad0 <exit>
+    printf(1, "unlinkread write failed\n");
+    1ab9:	51                   	push   %ecx
+    1aba:	51                   	push   %ecx
+    1abb:	68 76 6d 00 00       	push   $0x6d76
+    1ac0:	6a 01                	push   $0x1
+    1ac2:	e8 99 47 00 00       	call   6260 <printf>
+    exit();
+    1ac7:	e8 04 40 00 00       	call   5ad0 <exit>
+    printf(1, "unlinkread wrong data\n");
+    1acc:	53                   	push   %ebx
+    1acd:	53                   	push   %ebx
+    1ace:	68 5f 6d 00 00       	push   $0x6d5f
+    1ad3:	6a 01                	push   $0x1
+    1ad5:	e8 86 47 00 00       	call   6260 <printf>
+    exit();
+    1ada:	e8 f1 3f 00 00       	call   5ad0 <exit>
+    printf(1, "unlinkread read failed");
+    1adf:	56                   	push   %esi
+    1ae0:	56                   	push   %esi
+    1ae1:	68 48 6d 00 00       	push   $0x6d48
+    1ae6:	6a 01                	push   $0x1
+    1ae8:	e8 73 47 00 00       	call   6260 <printf>
+    exit();
+    1aed:	e8 de 3f 00 00       	call   5ad0 <exit>
+    printf(1, "unlink unlinkread failed\n");
+    1af2:	50                   	push   %eax
+    1af3:	50                   	push   %eax
+    1af4:	68 2a 6d 00 00       	push   $0x6d2a
+    1af9:	6a 01                	push   $0x1
+    1afb:	e8 60 47 00 00       	call   6260 <printf>
+    exit();
+    1b00:	e8 cb 3f 00 00       	call   5ad0 <exit>
+    printf(1, "open unlinkread failed\n");
+    1b05:	50                   	push   %eax
+    1b06:	50                   	push   %eax
+    1b07:	68 12 6d 00 00       	push   $0x6d12
+    1b0c:	6a 01                	push   $0x1
+    1b0e:	e8 4d 47 00 00       	call   6260 <printf>
+    exit();
+    1b13:	e8 b8 3f 00 00       	call   5ad0 <exit>
+    1b18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b1f:	90                   	nop
+
+00001b20 <linktest>:
+{
+    1b20:	55                   	push   %ebp
+    1b21:	89 e5                	mov    %esp,%ebp
+    1b23:	53                   	push   %ebx
+    1b24:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "linktest\n");
+    1b27:	68 9e 6d 00 00       	push   $0x6d9e
+    1b2c:	6a 01                	push   $0x1
+    1b2e:	e8 2d 47 00 00       	call   6260 <printf>
+  unlink("lf1");
+    1b33:	c7 04 24 a8 6d 00 00 	movl   $0x6da8,(%esp)
+    1b3a:	e8 f1 41 00 00       	call   5d30 <unlink>
+  unlink("lf2");
+    1b3f:	c7 04 24 ac 6d 00 00 	movl   $0x6dac,(%esp)
+    1b46:	e8 e5 41 00 00       	call   5d30 <unlink>
+  fd = open("lf1", O_CREATE|O_RDWR);
+    1b4b:	58                   	pop    %eax
+    1b4c:	5a                   	pop    %edx
+    1b4d:	68 02 02 00 00       	push   $0x202
+    1b52:	68 a8 6d 00 00       	push   $0x6da8
+    1b57:	e8 c4 41 00 00       	call   5d20 <open>
+  if(fd < 0){
+    1b5c:	83 c4 10             	add    $0x10,%esp
+    1b5f:	85 c0                	test   %eax,%eax
+    1b61:	0f 88 1e 01 00 00    	js     1c85 <linktest+0x165>
+  if(write(fd, "hello", 5) != 5){
+    1b67:	83 ec 04             	sub    $0x4,%esp
+    1b6a:	89 c3                	mov    %eax,%ebx
+    1b6c:	6a 05                	push   $0x5
+    1b6e:	68 0c 6d 00 00       	push   $0x6d0c
+    1b73:	50                   	push   %eax
+    1b74:	e8 27 40 00 00       	call   5ba0 <write>
+    1b79:	83 c4 10             	add    $0x10,%esp
+    1b7c:	83 f8 05             	cmp    $0x5,%eax
+    1b7f:	0f 85 98 01 00 00    	jne    1d1d <linktest+0x1fd>
+  close(fd);
+    1b85:	83 ec 0c             	sub    $0xc,%esp
+    1b88:	53                   	push   %ebx
+    1b89:	e8 92 40 00 00       	call   5c20 <close>
+  if(link("lf1", "lf2") < 0){
+    1b8e:	5b                   	pop    %ebx
+    1b8f:	58                   	pop    %eax
+    1b90:	68 ac 6d 00 00       	push   $0x6dac
+    1b95:	68 a8 6d 00 00       	push   $0x6da8
+    1b9a:	e8 a1 41 00 00       	call   5d40 <link>
+    1b9f:	83 c4 10             	add    $0x10,%esp
+    1ba2:	85 c0                	test   %eax,%eax
+    1ba4:	0f 88 60 01 00 00    	js     1d0a <linktest+0x1ea>
+  unlink("lf1");
+    1baa:	83 ec 0c             	sub    $0xc,%esp
+    1bad:	68 a8 6d 00 00       	push   $0x6da8
+    1bb2:	e8 79 41 00 00       	call   5d30 <unlink>
+  if(open("lf1", 0) >= 0){
+    1bb7:	58                   	pop    %eax
+    1bb8:	5a                   	pop    %edx
+    1bb9:	6a 00                	push   $0x0
+    1bbb:	68 a8 6d 00 00       	push   $0x6da8
+    1bc0:	e8 5b 41 00 00       	call   5d20 <open>
+    1bc5:	83 c4 10             	add    $0x10,%esp
+    1bc8:	85 c0                	test   %eax,%eax
+    1bca:	0f 89 27 01 00 00    	jns    1cf7 <linktest+0x1d7>
+  fd = open("lf2", 0);
+    1bd0:	83 ec 08             	sub    $0x8,%esp
+    1bd3:	6a 00                	push   $0x0
+    1bd5:	68 ac 6d 00 00       	push   $0x6dac
+    1bda:	e8 41 41 00 00       	call   5d20 <open>
+  if(fd < 0){
+    1bdf:	83 c4 10             	add    $0x10,%esp
+  fd = open("lf2", 0);
+    1be2:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1be4:	85 c0                	test   %eax,%eax
+    1be6:	0f 88 f8 00 00 00    	js     1ce4 <linktest+0x1c4>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    1bec:	83 ec 04             	sub    $0x4,%esp
+    1bef:	68 00 20 00 00       	push   $0x2000
+    1bf4:	68 60 c9 00 00       	push   $0xc960
+    1bf9:	50                   	push   %eax
+    1bfa:	e8 21 3f 00 00       	call   5b20 <read>
+    1bff:	83 c4 10             	add    $0x10,%esp
+    1c02:	83 f8 05             	cmp    $0x5,%eax
+    1c05:	0f 85 c6 00 00 00    	jne    1cd1 <linktest+0x1b1>
+  close(fd);
+    1c0b:	83 ec 0c             	sub    $0xc,%esp
+    1c0e:	53                   	push   %ebx
+    1c0f:	e8 0c 40 00 00       	call   5c20 <close>
+  if(link("lf2", "lf2") >= 0){
+    1c14:	58                   	pop    %eax
+    1c15:	5a                   	pop    %edx
+    1c16:	68 ac 6d 00 00       	push   $0x6dac
+    1c1b:	68 ac 6d 00 00       	push   $0x6dac
+    1c20:	e8 1b 41 00 00       	call   5d40 <link>
+    1c25:	83 c4 10             	add    $0x10,%esp
+    1c28:	85 c0                	test   %eax,%eax
+    1c2a:	0f 89 8e 00 00 00    	jns    1cbe <linktest+0x19e>
+  unlink("lf2");
+    1c30:	83 ec 0c             	sub    $0xc,%esp
+    1c33:	68 ac 6d 00 00       	push   $0x6dac
+    1c38:	e8 f3 40 00 00       	call   5d30 <unlink>
+  if(link("lf2", "lf1") >= 0){
+    1c3d:	59                   	pop    %ecx
+    1c3e:	5b                   	pop    %ebx
+    1c3f:	68 a8 6d 00 00       	push   $0x6da8
+    1c44:	68 ac 6d 00 00       	push   $0x6dac
+    1c49:	e8 f2 40 00 00       	call   5d40 <link>
+    1c4e:	83 c4 10             	add    $0x10,%esp
+    1c51:	85 c0                	test   %eax,%eax
+    1c53:	79 56                	jns    1cab <linktest+0x18b>
+  if(link(".", "lf1") >= 0){
+    1c55:	83 ec 08             	sub    $0x8,%esp
+    1c58:	68 a8 6d 00 00       	push   $0x6da8
+    1c5d:	68 70 70 00 00       	push   $0x7070
+    1c62:	e8 d9 40 00 00       	call   5d40 <link>
+    1c67:	83 c4 10             	add    $0x10,%esp
+    1c6a:	85 c0                	test   %eax,%eax
+    1c6c:	79 2a                	jns    1c98 <linktest+0x178>
+  printf(1, "linktest ok\n");
+    1c6e:	83 ec 08             	sub    $0x8,%esp
+    1c71:	68 46 6e 00 00       	push   $0x6e46
+    1c76:	6a 01                	push   $0x1
+    1c78:	e8 e3 45 00 00       	call   6260 <printf>
+}
+    1c7d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1c80:	83 c4 10             	add    $0x10,%esp
+    1c83:	c9                   	leave
+    1c84:	c3                   	ret
+    printf(1, "create lf1 failed\n");
+    1c85:	50                   	push   %eax
+    1c86:	50                   	push   %eax
+    1c87:	68 b0 6d 00 00       	push   $0x6db0
+    1c8c:	6a 01                	push   $0x1
+    1c8e:	e8 cd 45 00 00       	call   6260 <printf>
+    exit();
+    1c93:	e8 38 3e 00 00       	call   5ad0 <exit>
+    printf(1, "link . lf1 succeeded! oops\n");
+    1c98:	50                   	push   %eax
+    1c99:	50                   	push   %eax
+    1c9a:	68 2a 6e 00 00       	push   $0x6e2a
+    1c9f:	6a 01                	push   $0x1
+    1ca1:	e8 ba 45 00 00       	call   6260 <printf>
+    exit();
+    1ca6:	e8 25 3e 00 00       	call   5ad0 <exit>
+    printf(1, "link non-existant succeeded! oops\n");
+    1cab:	52                   	push   %edx
+    1cac:	52                   	push   %edx
+    1cad:	68 58 81 00 00       	push   $0x8158
+    1cb2:	6a 01                	push   $0x1
+    1cb4:	e8 a7 45 00 00       	call   6260 <printf>
+    exit();
+    1cb9:	e8 12 3e 00 00       	call   5ad0 <exit>
+    printf(1, "link lf2 lf2 succeeded! oops\n");
+    1cbe:	50                   	push   %eax
+    1cbf:	50                   	push   %eax
+    1cc0:	68 0c 6e 00 00       	push   $0x6e0c
+    1cc5:	6a 01                	push   $0x1
+    1cc7:	e8 94 45 00 00       	call   6260 <printf>
+    exit();
+    1ccc:	e8 ff 3d 00 00       	call   5ad0 <exit>
+    printf(1, "read lf2 failed\n");
+    1cd1:	51                   	push   %ecx
+    1cd2:	51                   	push   %ecx
+    1cd3:	68 fb 6d 00 00       	push   $0x6dfb
+    1cd8:	6a 01                	push   $0x1
+    1cda:	e8 81 45 00 00       	call   6260 <printf>
+    exit();
+    1cdf:	e8 ec 3d 00 00       	call   5ad0 <exit>
+    printf(1, "open lf2 failed\n");
+    1ce4:	53                   	push   %ebx
+    1ce5:	53                   	push   %ebx
+    1ce6:	68 ea 6d 00 00       	push   $0x6dea
+    1ceb:	6a 01                	push   $0x1
+    1ced:	e8 6e 45 00 00       	call   6260 <printf>
+    exit();
+    1cf2:	e8 d9 3d 00 00       	call   5ad0 <exit>
+    printf(1, "unlinked lf1 but it is still there!\n");
+    1cf7:	50                   	push   %eax
+    1cf8:	50                   	push   %eax
+    1cf9:	68 30 81 00 00       	push   $0x8130
+    1cfe:	6a 01                	push   $0x1
+    1d00:	e8 5b 45 00 00       	call   6260 <printf>
+    exit();
+    1d05:	e8 c6 3d 00 00       	call   5ad0 <exit>
+    printf(1, "link lf1 lf2 failed\n");
+    1d0a:	51                   	push   %ecx
+    1d0b:	51                   	push   %ecx
+    1d0c:	68 d5 6d 00 00       	push   $0x6dd5
+    1d11:	6a 01                	push   $0x1
+    1d13:	e8 48 45 00 00       	call   6260 <printf>
+    exit();
+    1d18:	e8 b3 3d 00 00       	call   5ad0 <exit>
+    printf(1, "write lf1 failed\n");
+    1d1d:	50                   	push   %eax
+    1d1e:	50                   	push   %eax
+    1d1f:	68 c3 6d 00 00       	push   $0x6dc3
+    1d24:	6a 01                	push   $0x1
+    1d26:	e8 35 45 00 00       	call   6260 <printf>
+    exit();
+    1d2b:	e8 a0 3d 00 00       	call   5ad0 <exit>
+
+00001d30 <concreate>:
+{
+    1d30:	55                   	push   %ebp
+    1d31:	89 e5                	mov    %esp,%ebp
+    1d33:	57                   	push   %edi
+    1d34:	56                   	push   %esi
+  for(i = 0; i < 40; i++){
+    1d35:	31 f6                	xor    %esi,%esi
+{
+    1d37:	53                   	push   %ebx
+    1d38:	8d 5d ad             	lea    -0x53(%ebp),%ebx
+    1d3b:	83 ec 64             	sub    $0x64,%esp
+  printf(1, "concreate test\n");
+    1d3e:	68 53 6e 00 00       	push   $0x6e53
+    1d43:	6a 01                	push   $0x1
+    1d45:	e8 16 45 00 00       	call   6260 <printf>
+  file[0] = 'C';
+    1d4a:	c6 45 ad 43          	movb   $0x43,-0x53(%ebp)
+  file[2] = '\0';
+    1d4e:	83 c4 10             	add    $0x10,%esp
+    1d51:	c6 45 af 00          	movb   $0x0,-0x51(%ebp)
+  for(i = 0; i < 40; i++){
+    1d55:	eb 4c                	jmp    1da3 <concreate+0x73>
+    1d57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d5e:	66 90                	xchg   %ax,%ax
+    1d60:	69 c6 ab aa aa aa    	imul   $0xaaaaaaab,%esi,%eax
+    if(pid && (i % 3) == 1){
+    1d66:	3d ab aa aa aa       	cmp    $0xaaaaaaab,%eax
+    1d6b:	0f 83 8f 00 00 00    	jae    1e00 <concreate+0xd0>
+      fd = open(file, O_CREATE | O_RDWR);
+    1d71:	83 ec 08             	sub    $0x8,%esp
+    1d74:	68 02 02 00 00       	push   $0x202
+    1d79:	53                   	push   %ebx
+    1d7a:	e8 a1 3f 00 00       	call   5d20 <open>
+      if(fd < 0){
+    1d7f:	83 c4 10             	add    $0x10,%esp
+    1d82:	85 c0                	test   %eax,%eax
+    1d84:	78 63                	js     1de9 <concreate+0xb9>
+      close(fd);
+    1d86:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 40; i++){
+    1d89:	83 c6 01             	add    $0x1,%esi
+      close(fd);
+    1d8c:	50                   	push   %eax
+    1d8d:	e8 8e 3e 00 00       	call   5c20 <close>
+    1d92:	83 c4 10             	add    $0x10,%esp
+      wait();
+    1d95:	e8 4e 3f 00 00       	call   5ce8 <wait>
+  for(i = 0; i < 40; i++){
+    1d9a:	83 fe 28             	cmp    $0x28,%esi
+    1d9d:	0f 84 7f 00 00 00    	je     1e22 <concreate+0xf2>
+    unlink(file);
+    1da3:	83 ec 0c             	sub    $0xc,%esp
+    file[1] = '0' + i;
+    1da6:	8d 46 30             	lea    0x30(%esi),%eax
+    1da9:	88 45 ae             	mov    %al,-0x52(%ebp)
+    unlink(file);
+    1dac:	53                   	push   %ebx
+    1dad:	e8 7e 3f 00 00       	call   5d30 <unlink>
+    pid = fork();
+    1db2:	e8 e9 3c 00 00       	call   5aa0 <fork>
+    if(pid && (i % 3) == 1){
+    1db7:	83 c4 10             	add    $0x10,%esp
+    1dba:	85 c0                	test   %eax,%eax
+    1dbc:	75 a2                	jne    1d60 <concreate+0x30>
+      link("C0", file);
+    1dbe:	69 f6 cd cc cc cc    	imul   $0xcccccccd,%esi,%esi
+    } else if(pid == 0 && (i % 5) == 1){
+    1dc4:	81 fe cd cc cc cc    	cmp    $0xcccccccd,%esi
+    1dca:	0f 83 d0 00 00 00    	jae    1ea0 <concreate+0x170>
+      fd = open(file, O_CREATE | O_RDWR);
+    1dd0:	83 ec 08             	sub    $0x8,%esp
+    1dd3:	68 02 02 00 00       	push   $0x202
+    1dd8:	53                   	push   %ebx
+    1dd9:	e8 42 3f 00 00       	call   5d20 <open>
+      if(fd < 0){
+    1dde:	83 c4 10             	add    $0x10,%esp
+    1de1:	85 c0                	test   %eax,%eax
+    1de3:	0f 89 ea 01 00 00    	jns    1fd3 <concreate+0x2a3>
+        printf(1, "concreate create %s failed\n", file);
+    1de9:	83 ec 04             	sub    $0x4,%esp
+    1dec:	53                   	push   %ebx
+    1ded:	68 66 6e 00 00       	push   $0x6e66
+    1df2:	6a 01                	push   $0x1
+    1df4:	e8 67 44 00 00       	call   6260 <printf>
+        exit();
+    1df9:	e8 d2 3c 00 00       	call   5ad0 <exit>
+    1dfe:	66 90                	xchg   %ax,%ax
+      link("C0", file);
+    1e00:	83 ec 08             	sub    $0x8,%esp
+  for(i = 0; i < 40; i++){
+    1e03:	83 c6 01             	add    $0x1,%esi
+      link("C0", file);
+    1e06:	53                   	push   %ebx
+    1e07:	68 63 6e 00 00       	push   $0x6e63
+    1e0c:	e8 2f 3f 00 00       	call   5d40 <link>
+    1e11:	83 c4 10             	add    $0x10,%esp
+      wait();
+    1e14:	e8 cf 3e 00 00       	call   5ce8 <wait>
+  for(i = 0; i < 40; i++){
+    1e19:	83 fe 28             	cmp    $0x28,%esi
+    1e1c:	0f 85 81 ff ff ff    	jne    1da3 <concreate+0x73>
+  memset(fa, 0, sizeof(fa));
+    1e22:	83 ec 04             	sub    $0x4,%esp
+    1e25:	8d 45 c0             	lea    -0x40(%ebp),%eax
+    1e28:	6a 28                	push   $0x28
+    1e2a:	6a 00                	push   $0x0
+    1e2c:	50                   	push   %eax
+    1e2d:	e8 8e 3a 00 00       	call   58c0 <memset>
+  fd = open(".", 0);
+    1e32:	5e                   	pop    %esi
+    1e33:	5f                   	pop    %edi
+    1e34:	6a 00                	push   $0x0
+    1e36:	68 70 70 00 00       	push   $0x7070
+    1e3b:	8d 7d b0             	lea    -0x50(%ebp),%edi
+    1e3e:	e8 dd 3e 00 00       	call   5d20 <open>
+  n = 0;
+    1e43:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  while(read(fd, &de, sizeof(de)) > 0){
+    1e4a:	83 c4 10             	add    $0x10,%esp
+  fd = open(".", 0);
+    1e4d:	89 c6                	mov    %eax,%esi
+  while(read(fd, &de, sizeof(de)) > 0){
+    1e4f:	90                   	nop
+    1e50:	83 ec 04             	sub    $0x4,%esp
+    1e53:	6a 10                	push   $0x10
+    1e55:	57                   	push   %edi
+    1e56:	56                   	push   %esi
+    1e57:	e8 c4 3c 00 00       	call   5b20 <read>
+    1e5c:	83 c4 10             	add    $0x10,%esp
+    1e5f:	85 c0                	test   %eax,%eax
+    1e61:	7e 5d                	jle    1ec0 <concreate+0x190>
+    if(de.inum == 0)
+    1e63:	66 83 7d b0 00       	cmpw   $0x0,-0x50(%ebp)
+    1e68:	74 e6                	je     1e50 <concreate+0x120>
+    if(de.name[0] == 'C' && de.name[2] == '\0'){
+    1e6a:	80 7d b2 43          	cmpb   $0x43,-0x4e(%ebp)
+    1e6e:	75 e0                	jne    1e50 <concreate+0x120>
+    1e70:	80 7d b4 00          	cmpb   $0x0,-0x4c(%ebp)
+    1e74:	75 da                	jne    1e50 <concreate+0x120>
+      i = de.name[1] - '0';
+    1e76:	0f be 45 b3          	movsbl -0x4d(%ebp),%eax
+    1e7a:	83 e8 30             	sub    $0x30,%eax
+      if(i < 0 || i >= sizeof(fa)){
+    1e7d:	83 f8 27             	cmp    $0x27,%eax
+    1e80:	0f 87 5e 01 00 00    	ja     1fe4 <concreate+0x2b4>
+      if(fa[i]){
+    1e86:	80 7c 05 c0 00       	cmpb   $0x0,-0x40(%ebp,%eax,1)
+    1e8b:	0f 85 7e 01 00 00    	jne    200f <concreate+0x2df>
+      n++;
+    1e91:	83 45 a4 01          	addl   $0x1,-0x5c(%ebp)
+      fa[i] = 1;
+    1e95:	c6 44 05 c0 01       	movb   $0x1,-0x40(%ebp,%eax,1)
+      n++;
+    1e9a:	eb b4                	jmp    1e50 <concreate+0x120>
+    1e9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      link("C0", file);
+    1ea0:	83 ec 08             	sub    $0x8,%esp
+    1ea3:	53                   	push   %ebx
+    1ea4:	68 63 6e 00 00       	push   $0x6e63
+    1ea9:	e8 92 3e 00 00       	call   5d40 <link>
+    1eae:	83 c4 10             	add    $0x10,%esp
+      exit();
+    1eb1:	e8 1a 3c 00 00       	call   5ad0 <exit>
+    1eb6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1ebd:	8d 76 00             	lea    0x0(%esi),%esi
+  close(fd);
+    1ec0:	83 ec 0c             	sub    $0xc,%esp
+    1ec3:	56                   	push   %esi
+    1ec4:	e8 57 3d 00 00       	call   5c20 <close>
+  if(n != 40){
+    1ec9:	83 c4 10             	add    $0x10,%esp
+    1ecc:	83 7d a4 28          	cmpl   $0x28,-0x5c(%ebp)
+    1ed0:	0f 85 26 01 00 00    	jne    1ffc <concreate+0x2cc>
+  for(i = 0; i < 40; i++){
+    1ed6:	31 f6                	xor    %esi,%esi
+    1ed8:	eb 48                	jmp    1f22 <concreate+0x1f2>
+    1eda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+       ((i % 3) == 1 && pid != 0)){
+    1ee0:	85 ff                	test   %edi,%edi
+    1ee2:	74 05                	je     1ee9 <concreate+0x1b9>
+    1ee4:	83 f8 01             	cmp    $0x1,%eax
+    1ee7:	74 68                	je     1f51 <concreate+0x221>
+      unlink(file);
+    1ee9:	83 ec 0c             	sub    $0xc,%esp
+    1eec:	53                   	push   %ebx
+    1eed:	e8 3e 3e 00 00       	call   5d30 <unlink>
+      unlink(file);
+    1ef2:	89 1c 24             	mov    %ebx,(%esp)
+    1ef5:	e8 36 3e 00 00       	call   5d30 <unlink>
+      unlink(file);
+    1efa:	89 1c 24             	mov    %ebx,(%esp)
+    1efd:	e8 2e 3e 00 00       	call   5d30 <unlink>
+      unlink(file);
+    1f02:	89 1c 24             	mov    %ebx,(%esp)
+    1f05:	e8 26 3e 00 00       	call   5d30 <unlink>
+    1f0a:	83 c4 10             	add    $0x10,%esp
+    if(pid == 0)
+    1f0d:	85 ff                	test   %edi,%edi
+    1f0f:	74 a0                	je     1eb1 <concreate+0x181>
+      wait();
+    1f11:	e8 d2 3d 00 00       	call   5ce8 <wait>
+  for(i = 0; i < 40; i++){
+    1f16:	83 c6 01             	add    $0x1,%esi
+    1f19:	83 fe 28             	cmp    $0x28,%esi
+    1f1c:	0f 84 86 00 00 00    	je     1fa8 <concreate+0x278>
+    file[1] = '0' + i;
+    1f22:	8d 46 30             	lea    0x30(%esi),%eax
+    1f25:	88 45 ae             	mov    %al,-0x52(%ebp)
+    pid = fork();
+    1f28:	e8 73 3b 00 00       	call   5aa0 <fork>
+    1f2d:	89 c7                	mov    %eax,%edi
+    if(pid < 0){
+    1f2f:	85 c0                	test   %eax,%eax
+    1f31:	0f 88 88 00 00 00    	js     1fbf <concreate+0x28f>
+    if(((i % 3) == 0 && pid == 0) ||
+    1f37:	b8 ab aa aa aa       	mov    $0xaaaaaaab,%eax
+    1f3c:	f7 e6                	mul    %esi
+    1f3e:	89 d0                	mov    %edx,%eax
+    1f40:	83 e2 fe             	and    $0xfffffffe,%edx
+    1f43:	d1 e8                	shr    %eax
+    1f45:	01 c2                	add    %eax,%edx
+    1f47:	89 f0                	mov    %esi,%eax
+    1f49:	29 d0                	sub    %edx,%eax
+    1f4b:	89 c1                	mov    %eax,%ecx
+    1f4d:	09 f9                	or     %edi,%ecx
+    1f4f:	75 8f                	jne    1ee0 <concreate+0x1b0>
+      close(open(file, 0));
+    1f51:	83 ec 08             	sub    $0x8,%esp
+    1f54:	6a 00                	push   $0x0
+    1f56:	53                   	push   %ebx
+    1f57:	e8 c4 3d 00 00       	call   5d20 <open>
+    1f5c:	89 04 24             	mov    %eax,(%esp)
+    1f5f:	e8 bc 3c 00 00       	call   5c20 <close>
+      close(open(file, 0));
+    1f64:	58                   	pop    %eax
+    1f65:	5a                   	pop    %edx
+    1f66:	6a 00                	push   $0x0
+    1f68:	53                   	push   %ebx
+    1f69:	e8 b2 3d 00 00       	call   5d20 <open>
+    1f6e:	89 04 24             	mov    %eax,(%esp)
+    1f71:	e8 aa 3c 00 00       	call   5c20 <close>
+      close(open(file, 0));
+    1f76:	59                   	pop    %ecx
+    1f77:	58                   	pop    %eax
+    1f78:	6a 00                	push   $0x0
+    1f7a:	53                   	push   %ebx
+    1f7b:	e8 a0 3d 00 00       	call   5d20 <open>
+    1f80:	89 04 24             	mov    %eax,(%esp)
+    1f83:	e8 98 3c 00 00       	call   5c20 <close>
+      close(open(file, 0));
+    1f88:	58                   	pop    %eax
+    1f89:	5a                   	pop    %edx
+    1f8a:	6a 00                	push   $0x0
+    1f8c:	53                   	push   %ebx
+    1f8d:	e8 8e 3d 00 00       	call   5d20 <open>
+    1f92:	89 04 24             	mov    %eax,(%esp)
+    1f95:	e8 86 3c 00 00       	call   5c20 <close>
+    1f9a:	83 c4 10             	add    $0x10,%esp
+    1f9d:	e9 6b ff ff ff       	jmp    1f0d <concreate+0x1dd>
+    1fa2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  printf(1, "concreate ok\n");
+    1fa8:	83 ec 08             	sub    $0x8,%esp
+    1fab:	68 b8 6e 00 00       	push   $0x6eb8
+    1fb0:	6a 01                	push   $0x1
+    1fb2:	e8 a9 42 00 00       	call   6260 <printf>
+}
+    1fb7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1fba:	5b                   	pop    %ebx
+    1fbb:	5e                   	pop    %esi
+    1fbc:	5f                   	pop    %edi
+    1fbd:	5d                   	pop    %ebp
+    1fbe:	c3                   	ret
+      printf(1, "fork failed\n");
+    1fbf:	83 ec 08             	sub    $0x8,%esp
+    1fc2:	68 48 7e 00 00       	push   $0x7e48
+    1fc7:	6a 01                	push   $0x1
+    1fc9:	e8 92 42 00 00       	call   6260 <printf>
+      exit();
+    1fce:	e8 fd 3a 00 00       	call   5ad0 <exit>
+      close(fd);
+    1fd3:	83 ec 0c             	sub    $0xc,%esp
+    1fd6:	50                   	push   %eax
+    1fd7:	e8 44 3c 00 00       	call   5c20 <close>
+    1fdc:	83 c4 10             	add    $0x10,%esp
+    1fdf:	e9 cd fe ff ff       	jmp    1eb1 <concreate+0x181>
+        printf(1, "concreate weird file %s\n", de.name);
+    1fe4:	83 ec 04             	sub    $0x4,%esp
+    1fe7:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    1fea:	50                   	push   %eax
+    1feb:	68 82 6e 00 00       	push   $0x6e82
+    1ff0:	6a 01                	push   $0x1
+    1ff2:	e8 69 42 00 00       	call   6260 <printf>
+        exit();
+    1ff7:	e8 d4 3a 00 00       	call   5ad0 <exit>
+    printf(1, "concreate not enough files in directory listing\n");
+    1ffc:	51                   	push   %ecx
+    1ffd:	51                   	push   %ecx
+    1ffe:	68 7c 81 00 00       	push   $0x817c
+    2003:	6a 01                	push   $0x1
+    2005:	e8 56 42 00 00       	call   6260 <printf>
+    exit();
+    200a:	e8 c1 3a 00 00       	call   5ad0 <exit>
+        printf(1, "concreate duplicate file %s\n", de.name);
+    200f:	83 ec 04             	sub    $0x4,%esp
+    2012:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    2015:	50                   	push   %eax
+    2016:	68 9b 6e 00 00       	push   $0x6e9b
+    201b:	6a 01                	push   $0x1
+    201d:	e8 3e 42 00 00       	call   6260 <printf>
+        exit();
+    2022:	e8 a9 3a 00 00       	call   5ad0 <exit>
+    2027:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    202e:	66 90                	xchg   %ax,%ax
+
+00002030 <linkunlink>:
+{
+    2030:	55                   	push   %ebp
+    2031:	89 e5                	mov    %esp,%ebp
+    2033:	57                   	push   %edi
+    2034:	56                   	push   %esi
+    2035:	53                   	push   %ebx
+    2036:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "linkunlink test\n");
+    2039:	68 c6 6e 00 00       	push   $0x6ec6
+    203e:	6a 01                	push   $0x1
+    2040:	e8 1b 42 00 00       	call   6260 <printf>
+  unlink("x");
+    2045:	c7 04 24 53 71 00 00 	movl   $0x7153,(%esp)
+    204c:	e8 df 3c 00 00       	call   5d30 <unlink>
+  pid = fork();
+    2051:	e8 4a 3a 00 00       	call   5aa0 <fork>
+  if(pid < 0){
+    2056:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+    2059:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(pid < 0){
+    205c:	85 c0                	test   %eax,%eax
+    205e:	0f 88 b6 00 00 00    	js     211a <linkunlink+0xea>
+  unsigned int x = (pid ? 1 : 97);
+    2064:	83 7d e4 01          	cmpl   $0x1,-0x1c(%ebp)
+    2068:	bb 64 00 00 00       	mov    $0x64,%ebx
+    if((x % 3) == 0){
+    206d:	be ab aa aa aa       	mov    $0xaaaaaaab,%esi
+  unsigned int x = (pid ? 1 : 97);
+    2072:	19 ff                	sbb    %edi,%edi
+    2074:	83 e7 60             	and    $0x60,%edi
+    2077:	83 c7 01             	add    $0x1,%edi
+    207a:	eb 1e                	jmp    209a <linkunlink+0x6a>
+    207c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    } else if((x % 3) == 1){
+    2080:	83 f8 01             	cmp    $0x1,%eax
+    2083:	74 7b                	je     2100 <linkunlink+0xd0>
+      unlink("x");
+    2085:	83 ec 0c             	sub    $0xc,%esp
+    2088:	68 53 71 00 00       	push   $0x7153
+    208d:	e8 9e 3c 00 00       	call   5d30 <unlink>
+    2092:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    2095:	83 eb 01             	sub    $0x1,%ebx
+    2098:	74 41                	je     20db <linkunlink+0xab>
+    x = x * 1103515245 + 12345;
+    209a:	69 cf 6d 4e c6 41    	imul   $0x41c64e6d,%edi,%ecx
+    20a0:	8d b9 39 30 00 00    	lea    0x3039(%ecx),%edi
+    if((x % 3) == 0){
+    20a6:	89 f8                	mov    %edi,%eax
+    20a8:	f7 e6                	mul    %esi
+    20aa:	89 d0                	mov    %edx,%eax
+    20ac:	83 e2 fe             	and    $0xfffffffe,%edx
+    20af:	d1 e8                	shr    %eax
+    20b1:	01 c2                	add    %eax,%edx
+    20b3:	89 f8                	mov    %edi,%eax
+    20b5:	29 d0                	sub    %edx,%eax
+    20b7:	75 c7                	jne    2080 <linkunlink+0x50>
+      close(open("x", O_RDWR | O_CREATE));
+    20b9:	83 ec 08             	sub    $0x8,%esp
+    20bc:	68 02 02 00 00       	push   $0x202
+    20c1:	68 53 71 00 00       	push   $0x7153
+    20c6:	e8 55 3c 00 00       	call   5d20 <open>
+    20cb:	89 04 24             	mov    %eax,(%esp)
+    20ce:	e8 4d 3b 00 00       	call   5c20 <close>
+    20d3:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    20d6:	83 eb 01             	sub    $0x1,%ebx
+    20d9:	75 bf                	jne    209a <linkunlink+0x6a>
+  if(pid)
+    20db:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    20de:	85 c0                	test   %eax,%eax
+    20e0:	74 4b                	je     212d <linkunlink+0xfd>
+    wait();
+    20e2:	e8 01 3c 00 00       	call   5ce8 <wait>
+  printf(1, "linkunlink ok\n");
+    20e7:	83 ec 08             	sub    $0x8,%esp
+    20ea:	68 db 6e 00 00       	push   $0x6edb
+    20ef:	6a 01                	push   $0x1
+    20f1:	e8 6a 41 00 00       	call   6260 <printf>
+}
+    20f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    20f9:	5b                   	pop    %ebx
+    20fa:	5e                   	pop    %esi
+    20fb:	5f                   	pop    %edi
+    20fc:	5d                   	pop    %ebp
+    20fd:	c3                   	ret
+    20fe:	66 90                	xchg   %ax,%ax
+      link("cat", "x");
+    2100:	83 ec 08             	sub    $0x8,%esp
+    2103:	68 53 71 00 00       	push   $0x7153
+    2108:	68 d7 6e 00 00       	push   $0x6ed7
+    210d:	e8 2e 3c 00 00       	call   5d40 <link>
+    2112:	83 c4 10             	add    $0x10,%esp
+    2115:	e9 7b ff ff ff       	jmp    2095 <linkunlink+0x65>
+    printf(1, "fork failed\n");
+    211a:	52                   	push   %edx
+    211b:	52                   	push   %edx
+    211c:	68 48 7e 00 00       	push   $0x7e48
+    2121:	6a 01                	push   $0x1
+    2123:	e8 38 41 00 00       	call   6260 <printf>
+    exit();
+    2128:	e8 a3 39 00 00       	call   5ad0 <exit>
+    exit();
+    212d:	e8 9e 39 00 00       	call   5ad0 <exit>
+    2132:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2139:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00002140 <bigdir>:
+{
+    2140:	55                   	push   %ebp
+    2141:	89 e5                	mov    %esp,%ebp
+    2143:	57                   	push   %edi
+    2144:	56                   	push   %esi
+    2145:	53                   	push   %ebx
+    2146:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "bigdir test\n");
+    2149:	68 ea 6e 00 00       	push   $0x6eea
+    214e:	6a 01                	push   $0x1
+    2150:	e8 0b 41 00 00       	call   6260 <printf>
+  unlink("bd");
+    2155:	c7 04 24 f7 6e 00 00 	movl   $0x6ef7,(%esp)
+    215c:	e8 cf 3b 00 00       	call   5d30 <unlink>
+  fd = open("bd", O_CREATE);
+    2161:	5a                   	pop    %edx
+    2162:	59                   	pop    %ecx
+    2163:	68 00 02 00 00       	push   $0x200
+    2168:	68 f7 6e 00 00       	push   $0x6ef7
+    216d:	e8 ae 3b 00 00       	call   5d20 <open>
+  if(fd < 0){
+    2172:	83 c4 10             	add    $0x10,%esp
+    2175:	85 c0                	test   %eax,%eax
+    2177:	0f 88 de 00 00 00    	js     225b <bigdir+0x11b>
+  close(fd);
+    217d:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 500; i++){
+    2180:	31 f6                	xor    %esi,%esi
+    2182:	8d 7d de             	lea    -0x22(%ebp),%edi
+  close(fd);
+    2185:	50                   	push   %eax
+    2186:	e8 95 3a 00 00       	call   5c20 <close>
+    218b:	83 c4 10             	add    $0x10,%esp
+    218e:	66 90                	xchg   %ax,%ax
+    name[1] = '0' + (i / 64);
+    2190:	89 f0                	mov    %esi,%eax
+    if(link("bd", name) != 0){
+    2192:	83 ec 08             	sub    $0x8,%esp
+    name[0] = 'x';
+    2195:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    2199:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    219c:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    21a0:	83 c0 30             	add    $0x30,%eax
+    21a3:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    21a6:	89 f0                	mov    %esi,%eax
+    21a8:	83 e0 3f             	and    $0x3f,%eax
+    21ab:	83 c0 30             	add    $0x30,%eax
+    21ae:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(link("bd", name) != 0){
+    21b1:	57                   	push   %edi
+    21b2:	68 f7 6e 00 00       	push   $0x6ef7
+    21b7:	e8 84 3b 00 00       	call   5d40 <link>
+    21bc:	83 c4 10             	add    $0x10,%esp
+    21bf:	89 c3                	mov    %eax,%ebx
+    21c1:	85 c0                	test   %eax,%eax
+    21c3:	75 6e                	jne    2233 <bigdir+0xf3>
+  for(i = 0; i < 500; i++){
+    21c5:	83 c6 01             	add    $0x1,%esi
+    21c8:	81 fe f4 01 00 00    	cmp    $0x1f4,%esi
+    21ce:	75 c0                	jne    2190 <bigdir+0x50>
+  unlink("bd");
+    21d0:	83 ec 0c             	sub    $0xc,%esp
+    21d3:	68 f7 6e 00 00       	push   $0x6ef7
+    21d8:	e8 53 3b 00 00       	call   5d30 <unlink>
+    21dd:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + (i / 64);
+    21e0:	89 d8                	mov    %ebx,%eax
+    if(unlink(name) != 0){
+    21e2:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'x';
+    21e5:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    21e9:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    21ec:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    21f0:	83 c0 30             	add    $0x30,%eax
+    21f3:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    21f6:	89 d8                	mov    %ebx,%eax
+    21f8:	83 e0 3f             	and    $0x3f,%eax
+    21fb:	83 c0 30             	add    $0x30,%eax
+    21fe:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(unlink(name) != 0){
+    2201:	57                   	push   %edi
+    2202:	e8 29 3b 00 00       	call   5d30 <unlink>
+    2207:	83 c4 10             	add    $0x10,%esp
+    220a:	85 c0                	test   %eax,%eax
+    220c:	75 39                	jne    2247 <bigdir+0x107>
+  for(i = 0; i < 500; i++){
+    220e:	83 c3 01             	add    $0x1,%ebx
+    2211:	81 fb f4 01 00 00    	cmp    $0x1f4,%ebx
+    2217:	75 c7                	jne    21e0 <bigdir+0xa0>
+  printf(1, "bigdir ok\n");
+    2219:	83 ec 08             	sub    $0x8,%esp
+    221c:	68 39 6f 00 00       	push   $0x6f39
+    2221:	6a 01                	push   $0x1
+    2223:	e8 38 40 00 00       	call   6260 <printf>
+    2228:	83 c4 10             	add    $0x10,%esp
+}
+    222b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    222e:	5b                   	pop    %ebx
+    222f:	5e                   	pop    %esi
+    2230:	5f                   	pop    %edi
+    2231:	5d                   	pop    %ebp
+    2232:	c3                   	ret
+      printf(1, "bigdir link failed\n");
+    2233:	83 ec 08             	sub    $0x8,%esp
+    2236:	68 10 6f 00 00       	push   $0x6f10
+    223b:	6a 01                	push   $0x1
+    223d:	e8 1e 40 00 00       	call   6260 <printf>
+      exit();
+    2242:	e8 89 38 00 00       	call   5ad0 <exit>
+      printf(1, "bigdir unlink failed");
+    2247:	83 ec 08             	sub    $0x8,%esp
+    224a:	68 24 6f 00 00       	push   $0x6f24
+    224f:	6a 01                	push   $0x1
+    2251:	e8 0a 40 00 00       	call   6260 <printf>
+      exit();
+    2256:	e8 75 38 00 00       	call   5ad0 <exit>
+    printf(1, "bigdir create failed\n");
+    225b:	50                   	push   %eax
+    225c:	50                   	push   %eax
+    225d:	68 fa 6e 00 00       	push   $0x6efa
+    2262:	6a 01                	push   $0x1
+    2264:	e8 f7 3f 00 00       	call   6260 <printf>
+    exit();
+    2269:	e8 62 38 00 00       	call   5ad0 <exit>
+    226e:	66 90                	xchg   %ax,%ax
+
+00002270 <subdir>:
+{
+    2270:	55                   	push   %ebp
+    2271:	89 e5                	mov    %esp,%ebp
+    2273:	53                   	push   %ebx
+    2274:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "subdir test\n");
+    2277:	68 44 6f 00 00       	push   $0x6f44
+    227c:	6a 01                	push   $0x1
+    227e:	e8 dd 3f 00 00       	call   6260 <printf>
+  unlink("ff");
+    2283:	c7 04 24 cd 6f 00 00 	movl   $0x6fcd,(%esp)
+    228a:	e8 a1 3a 00 00       	call   5d30 <unlink>
+  if(mkdir("dd") != 0){
+    228f:	c7 04 24 6a 70 00 00 	movl   $0x706a,(%esp)
+    2296:	e8 ad 3a 00 00       	call   5d48 <mkdir>
+    229b:	83 c4 10             	add    $0x10,%esp
+    229e:	85 c0                	test   %eax,%eax
+    22a0:	0f 85 b3 05 00 00    	jne    2859 <subdir+0x5e9>
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    22a6:	83 ec 08             	sub    $0x8,%esp
+    22a9:	68 02 02 00 00       	push   $0x202
+    22ae:	68 a3 6f 00 00       	push   $0x6fa3
+    22b3:	e8 68 3a 00 00       	call   5d20 <open>
+  if(fd < 0){
+    22b8:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    22bb:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    22bd:	85 c0                	test   %eax,%eax
+    22bf:	0f 88 81 05 00 00    	js     2846 <subdir+0x5d6>
+  write(fd, "ff", 2);
+    22c5:	83 ec 04             	sub    $0x4,%esp
+    22c8:	6a 02                	push   $0x2
+    22ca:	68 cd 6f 00 00       	push   $0x6fcd
+    22cf:	50                   	push   %eax
+    22d0:	e8 cb 38 00 00       	call   5ba0 <write>
+  close(fd);
+    22d5:	89 1c 24             	mov    %ebx,(%esp)
+    22d8:	e8 43 39 00 00       	call   5c20 <close>
+  if(unlink("dd") >= 0){
+    22dd:	c7 04 24 6a 70 00 00 	movl   $0x706a,(%esp)
+    22e4:	e8 47 3a 00 00       	call   5d30 <unlink>
+    22e9:	83 c4 10             	add    $0x10,%esp
+    22ec:	85 c0                	test   %eax,%eax
+    22ee:	0f 89 3f 05 00 00    	jns    2833 <subdir+0x5c3>
+  if(mkdir("/dd/dd") != 0){
+    22f4:	83 ec 0c             	sub    $0xc,%esp
+    22f7:	68 7e 6f 00 00       	push   $0x6f7e
+    22fc:	e8 47 3a 00 00       	call   5d48 <mkdir>
+    2301:	83 c4 10             	add    $0x10,%esp
+    2304:	85 c0                	test   %eax,%eax
+    2306:	0f 85 14 05 00 00    	jne    2820 <subdir+0x5b0>
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    230c:	83 ec 08             	sub    $0x8,%esp
+    230f:	68 02 02 00 00       	push   $0x202
+    2314:	68 a0 6f 00 00       	push   $0x6fa0
+    2319:	e8 02 3a 00 00       	call   5d20 <open>
+  if(fd < 0){
+    231e:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    2321:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    2323:	85 c0                	test   %eax,%eax
+    2325:	0f 88 24 04 00 00    	js     274f <subdir+0x4df>
+  write(fd, "FF", 2);
+    232b:	83 ec 04             	sub    $0x4,%esp
+    232e:	6a 02                	push   $0x2
+    2330:	68 c1 6f 00 00       	push   $0x6fc1
+    2335:	50                   	push   %eax
+    2336:	e8 65 38 00 00       	call   5ba0 <write>
+  close(fd);
+    233b:	89 1c 24             	mov    %ebx,(%esp)
+    233e:	e8 dd 38 00 00       	call   5c20 <close>
+  fd = open("dd/dd/../ff", 0);
+    2343:	58                   	pop    %eax
+    2344:	5a                   	pop    %edx
+    2345:	6a 00                	push   $0x0
+    2347:	68 c4 6f 00 00       	push   $0x6fc4
+    234c:	e8 cf 39 00 00       	call   5d20 <open>
+  if(fd < 0){
+    2351:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/../ff", 0);
+    2354:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    2356:	85 c0                	test   %eax,%eax
+    2358:	0f 88 de 03 00 00    	js     273c <subdir+0x4cc>
+  cc = read(fd, buf, sizeof(buf));
+    235e:	83 ec 04             	sub    $0x4,%esp
+    2361:	68 00 20 00 00       	push   $0x2000
+    2366:	68 60 c9 00 00       	push   $0xc960
+    236b:	50                   	push   %eax
+    236c:	e8 af 37 00 00       	call   5b20 <read>
+  if(cc != 2 || buf[0] != 'f'){
+    2371:	83 c4 10             	add    $0x10,%esp
+    2374:	83 f8 02             	cmp    $0x2,%eax
+    2377:	0f 85 3a 03 00 00    	jne    26b7 <subdir+0x447>
+    237d:	80 3d 60 c9 00 00 66 	cmpb   $0x66,0xc960
+    2384:	0f 85 2d 03 00 00    	jne    26b7 <subdir+0x447>
+  close(fd);
+    238a:	83 ec 0c             	sub    $0xc,%esp
+    238d:	53                   	push   %ebx
+    238e:	e8 8d 38 00 00       	call   5c20 <close>
+  if(link("dd/dd/ff", "dd/dd/ffff") != 0){
+    2393:	59                   	pop    %ecx
+    2394:	5b                   	pop    %ebx
+    2395:	68 04 70 00 00       	push   $0x7004
+    239a:	68 a0 6f 00 00       	push   $0x6fa0
+    239f:	e8 9c 39 00 00       	call   5d40 <link>
+    23a4:	83 c4 10             	add    $0x10,%esp
+    23a7:	85 c0                	test   %eax,%eax
+    23a9:	0f 85 c6 03 00 00    	jne    2775 <subdir+0x505>
+  if(unlink("dd/dd/ff") != 0){
+    23af:	83 ec 0c             	sub    $0xc,%esp
+    23b2:	68 a0 6f 00 00       	push   $0x6fa0
+    23b7:	e8 74 39 00 00       	call   5d30 <unlink>
+    23bc:	83 c4 10             	add    $0x10,%esp
+    23bf:	85 c0                	test   %eax,%eax
+    23c1:	0f 85 16 03 00 00    	jne    26dd <subdir+0x46d>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    23c7:	83 ec 08             	sub    $0x8,%esp
+    23ca:	6a 00                	push   $0x0
+    23cc:	68 a0 6f 00 00       	push   $0x6fa0
+    23d1:	e8 4a 39 00 00       	call   5d20 <open>
+    23d6:	83 c4 10             	add    $0x10,%esp
+    23d9:	85 c0                	test   %eax,%eax
+    23db:	0f 89 2c 04 00 00    	jns    280d <subdir+0x59d>
+  if(chdir("dd") != 0){
+    23e1:	83 ec 0c             	sub    $0xc,%esp
+    23e4:	68 6a 70 00 00       	push   $0x706a
+    23e9:	e8 62 39 00 00       	call   5d50 <chdir>
+    23ee:	83 c4 10             	add    $0x10,%esp
+    23f1:	85 c0                	test   %eax,%eax
+    23f3:	0f 85 01 04 00 00    	jne    27fa <subdir+0x58a>
+  if(chdir("dd/../../dd") != 0){
+    23f9:	83 ec 0c             	sub    $0xc,%esp
+    23fc:	68 38 70 00 00       	push   $0x7038
+    2401:	e8 4a 39 00 00       	call   5d50 <chdir>
+    2406:	83 c4 10             	add    $0x10,%esp
+    2409:	85 c0                	test   %eax,%eax
+    240b:	0f 85 b9 02 00 00    	jne    26ca <subdir+0x45a>
+  if(chdir("dd/../../../dd") != 0){
+    2411:	83 ec 0c             	sub    $0xc,%esp
+    2414:	68 5e 70 00 00       	push   $0x705e
+    2419:	e8 32 39 00 00       	call   5d50 <chdir>
+    241e:	83 c4 10             	add    $0x10,%esp
+    2421:	85 c0                	test   %eax,%eax
+    2423:	0f 85 a1 02 00 00    	jne    26ca <subdir+0x45a>
+  if(chdir("./..") != 0){
+    2429:	83 ec 0c             	sub    $0xc,%esp
+    242c:	68 6d 70 00 00       	push   $0x706d
+    2431:	e8 1a 39 00 00       	call   5d50 <chdir>
+    2436:	83 c4 10             	add    $0x10,%esp
+    2439:	85 c0                	test   %eax,%eax
+    243b:	0f 85 21 03 00 00    	jne    2762 <subdir+0x4f2>
+  fd = open("dd/dd/ffff", 0);
+    2441:	83 ec 08             	sub    $0x8,%esp
+    2444:	6a 00                	push   $0x0
+    2446:	68 04 70 00 00       	push   $0x7004
+    244b:	e8 d0 38 00 00       	call   5d20 <open>
+  if(fd < 0){
+    2450:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ffff", 0);
+    2453:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    2455:	85 c0                	test   %eax,%eax
+    2457:	0f 88 e0 04 00 00    	js     293d <subdir+0x6cd>
+  if(read(fd, buf, sizeof(buf)) != 2){
+    245d:	83 ec 04             	sub    $0x4,%esp
+    2460:	68 00 20 00 00       	push   $0x2000
+    2465:	68 60 c9 00 00       	push   $0xc960
+    246a:	50                   	push   %eax
+    246b:	e8 b0 36 00 00       	call   5b20 <read>
+    2470:	83 c4 10             	add    $0x10,%esp
+    2473:	83 f8 02             	cmp    $0x2,%eax
+    2476:	0f 85 ae 04 00 00    	jne    292a <subdir+0x6ba>
+  close(fd);
+    247c:	83 ec 0c             	sub    $0xc,%esp
+    247f:	53                   	push   %ebx
+    2480:	e8 9b 37 00 00       	call   5c20 <close>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    2485:	58                   	pop    %eax
+    2486:	5a                   	pop    %edx
+    2487:	6a 00                	push   $0x0
+    2489:	68 a0 6f 00 00       	push   $0x6fa0
+    248e:	e8 8d 38 00 00       	call   5d20 <open>
+    2493:	83 c4 10             	add    $0x10,%esp
+    2496:	85 c0                	test   %eax,%eax
+    2498:	0f 89 65 02 00 00    	jns    2703 <subdir+0x493>
+  if(open("dd/ff/ff", O_CREATE|O_RDWR) >= 0){
+    249e:	83 ec 08             	sub    $0x8,%esp
+    24a1:	68 02 02 00 00       	push   $0x202
+    24a6:	68 b8 70 00 00       	push   $0x70b8
+    24ab:	e8 70 38 00 00       	call   5d20 <open>
+    24b0:	83 c4 10             	add    $0x10,%esp
+    24b3:	85 c0                	test   %eax,%eax
+    24b5:	0f 89 35 02 00 00    	jns    26f0 <subdir+0x480>
+  if(open("dd/xx/ff", O_CREATE|O_RDWR) >= 0){
+    24bb:	83 ec 08             	sub    $0x8,%esp
+    24be:	68 02 02 00 00       	push   $0x202
+    24c3:	68 dd 70 00 00       	push   $0x70dd
+    24c8:	e8 53 38 00 00       	call   5d20 <open>
+    24cd:	83 c4 10             	add    $0x10,%esp
+    24d0:	85 c0                	test   %eax,%eax
+    24d2:	0f 89 0f 03 00 00    	jns    27e7 <subdir+0x577>
+  if(open("dd", O_CREATE) >= 0){
+    24d8:	83 ec 08             	sub    $0x8,%esp
+    24db:	68 00 02 00 00       	push   $0x200
+    24e0:	68 6a 70 00 00       	push   $0x706a
+    24e5:	e8 36 38 00 00       	call   5d20 <open>
+    24ea:	83 c4 10             	add    $0x10,%esp
+    24ed:	85 c0                	test   %eax,%eax
+    24ef:	0f 89 df 02 00 00    	jns    27d4 <subdir+0x564>
+  if(open("dd", O_RDWR) >= 0){
+    24f5:	83 ec 08             	sub    $0x8,%esp
+    24f8:	6a 02                	push   $0x2
+    24fa:	68 6a 70 00 00       	push   $0x706a
+    24ff:	e8 1c 38 00 00       	call   5d20 <open>
+    2504:	83 c4 10             	add    $0x10,%esp
+    2507:	85 c0                	test   %eax,%eax
+    2509:	0f 89 b2 02 00 00    	jns    27c1 <subdir+0x551>
+  if(open("dd", O_WRONLY) >= 0){
+    250f:	83 ec 08             	sub    $0x8,%esp
+    2512:	6a 01                	push   $0x1
+    2514:	68 6a 70 00 00       	push   $0x706a
+    2519:	e8 02 38 00 00       	call   5d20 <open>
+    251e:	83 c4 10             	add    $0x10,%esp
+    2521:	85 c0                	test   %eax,%eax
+    2523:	0f 89 85 02 00 00    	jns    27ae <subdir+0x53e>
+  if(link("dd/ff/ff", "dd/dd/xx") == 0){
+    2529:	83 ec 08             	sub    $0x8,%esp
+    252c:	68 4c 71 00 00       	push   $0x714c
+    2531:	68 b8 70 00 00       	push   $0x70b8
+    2536:	e8 05 38 00 00       	call   5d40 <link>
+    253b:	83 c4 10             	add    $0x10,%esp
+    253e:	85 c0                	test   %eax,%eax
+    2540:	0f 84 55 02 00 00    	je     279b <subdir+0x52b>
+  if(link("dd/xx/ff", "dd/dd/xx") == 0){
+    2546:	83 ec 08             	sub    $0x8,%esp
+    2549:	68 4c 71 00 00       	push   $0x714c
+    254e:	68 dd 70 00 00       	push   $0x70dd
+    2553:	e8 e8 37 00 00       	call   5d40 <link>
+    2558:	83 c4 10             	add    $0x10,%esp
+    255b:	85 c0                	test   %eax,%eax
+    255d:	0f 84 25 02 00 00    	je     2788 <subdir+0x518>
+  if(link("dd/ff", "dd/dd/ffff") == 0){
+    2563:	83 ec 08             	sub    $0x8,%esp
+    2566:	68 04 70 00 00       	push   $0x7004
+    256b:	68 a3 6f 00 00       	push   $0x6fa3
+    2570:	e8 cb 37 00 00       	call   5d40 <link>
+    2575:	83 c4 10             	add    $0x10,%esp
+    2578:	85 c0                	test   %eax,%eax
+    257a:	0f 84 a9 01 00 00    	je     2729 <subdir+0x4b9>
+  if(mkdir("dd/ff/ff") == 0){
+    2580:	83 ec 0c             	sub    $0xc,%esp
+    2583:	68 b8 70 00 00       	push   $0x70b8
+    2588:	e8 bb 37 00 00       	call   5d48 <mkdir>
+    258d:	83 c4 10             	add    $0x10,%esp
+    2590:	85 c0                	test   %eax,%eax
+    2592:	0f 84 7e 01 00 00    	je     2716 <subdir+0x4a6>
+  if(mkdir("dd/xx/ff") == 0){
+    2598:	83 ec 0c             	sub    $0xc,%esp
+    259b:	68 dd 70 00 00       	push   $0x70dd
+    25a0:	e8 a3 37 00 00       	call   5d48 <mkdir>
+    25a5:	83 c4 10             	add    $0x10,%esp
+    25a8:	85 c0                	test   %eax,%eax
+    25aa:	0f 84 67 03 00 00    	je     2917 <subdir+0x6a7>
+  if(mkdir("dd/dd/ffff") == 0){
+    25b0:	83 ec 0c             	sub    $0xc,%esp
+    25b3:	68 04 70 00 00       	push   $0x7004
+    25b8:	e8 8b 37 00 00       	call   5d48 <mkdir>
+    25bd:	83 c4 10             	add    $0x10,%esp
+    25c0:	85 c0                	test   %eax,%eax
+    25c2:	0f 84 3c 03 00 00    	je     2904 <subdir+0x694>
+  if(unlink("dd/xx/ff") == 0){
+    25c8:	83 ec 0c             	sub    $0xc,%esp
+    25cb:	68 dd 70 00 00       	push   $0x70dd
+    25d0:	e8 5b 37 00 00       	call   5d30 <unlink>
+    25d5:	83 c4 10             	add    $0x10,%esp
+    25d8:	85 c0                	test   %eax,%eax
+    25da:	0f 84 11 03 00 00    	je     28f1 <subdir+0x681>
+  if(unlink("dd/ff/ff") == 0){
+    25e0:	83 ec 0c             	sub    $0xc,%esp
+    25e3:	68 b8 70 00 00       	push   $0x70b8
+    25e8:	e8 43 37 00 00       	call   5d30 <unlink>
+    25ed:	83 c4 10             	add    $0x10,%esp
+    25f0:	85 c0                	test   %eax,%eax
+    25f2:	0f 84 e6 02 00 00    	je     28de <subdir+0x66e>
+  if(chdir("dd/ff") == 0){
+    25f8:	83 ec 0c             	sub    $0xc,%esp
+    25fb:	68 a3 6f 00 00       	push   $0x6fa3
+    2600:	e8 4b 37 00 00       	call   5d50 <chdir>
+    2605:	83 c4 10             	add    $0x10,%esp
+    2608:	85 c0                	test   %eax,%eax
+    260a:	0f 84 bb 02 00 00    	je     28cb <subdir+0x65b>
+  if(chdir("dd/xx") == 0){
+    2610:	83 ec 0c             	sub    $0xc,%esp
+    2613:	68 4f 71 00 00       	push   $0x714f
+    2618:	e8 33 37 00 00       	call   5d50 <chdir>
+    261d:	83 c4 10             	add    $0x10,%esp
+    2620:	85 c0                	test   %eax,%eax
+    2622:	0f 84 90 02 00 00    	je     28b8 <subdir+0x648>
+  if(unlink("dd/dd/ffff") != 0){
+    2628:	83 ec 0c             	sub    $0xc,%esp
+    262b:	68 04 70 00 00       	push   $0x7004
+    2630:	e8 fb 36 00 00       	call   5d30 <unlink>
+    2635:	83 c4 10             	add    $0x10,%esp
+    2638:	85 c0                	test   %eax,%eax
+    263a:	0f 85 9d 00 00 00    	jne    26dd <subdir+0x46d>
+  if(unlink("dd/ff") != 0){
+    2640:	83 ec 0c             	sub    $0xc,%esp
+    2643:	68 a3 6f 00 00       	push   $0x6fa3
+    2648:	e8 e3 36 00 00       	call   5d30 <unlink>
+    264d:	83 c4 10             	add    $0x10,%esp
+    2650:	85 c0                	test   %eax,%eax
+    2652:	0f 85 4d 02 00 00    	jne    28a5 <subdir+0x635>
+  if(unlink("dd") == 0){
+    2658:	83 ec 0c             	sub    $0xc,%esp
+    265b:	68 6a 70 00 00       	push   $0x706a
+    2660:	e8 cb 36 00 00       	call   5d30 <unlink>
+    2665:	83 c4 10             	add    $0x10,%esp
+    2668:	85 c0                	test   %eax,%eax
+    266a:	0f 84 22 02 00 00    	je     2892 <subdir+0x622>
+  if(unlink("dd/dd") < 0){
+    2670:	83 ec 0c             	sub    $0xc,%esp
+    2673:	68 7f 6f 00 00       	push   $0x6f7f
+    2678:	e8 b3 36 00 00       	call   5d30 <unlink>
+    267d:	83 c4 10             	add    $0x10,%esp
+    2680:	85 c0                	test   %eax,%eax
+    2682:	0f 88 f7 01 00 00    	js     287f <subdir+0x60f>
+  if(unlink("dd") < 0){
+    2688:	83 ec 0c             	sub    $0xc,%esp
+    268b:	68 6a 70 00 00       	push   $0x706a
+    2690:	e8 9b 36 00 00       	call   5d30 <unlink>
+    2695:	83 c4 10             	add    $0x10,%esp
+    2698:	85 c0                	test   %eax,%eax
+    269a:	0f 88 cc 01 00 00    	js     286c <subdir+0x5fc>
+  printf(1, "subdir ok\n");
+    26a0:	83 ec 08             	sub    $0x8,%esp
+    26a3:	68 4c 72 00 00       	push   $0x724c
+    26a8:	6a 01                	push   $0x1
+    26aa:	e8 b1 3b 00 00       	call   6260 <printf>
+}
+    26af:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    26b2:	83 c4 10             	add    $0x10,%esp
+    26b5:	c9                   	leave
+    26b6:	c3                   	ret
+    printf(1, "dd/dd/../ff wrong content\n");
+    26b7:	50                   	push   %eax
+    26b8:	50                   	push   %eax
+    26b9:	68 e9 6f 00 00       	push   $0x6fe9
+    26be:	6a 01                	push   $0x1
+    26c0:	e8 9b 3b 00 00       	call   6260 <printf>
+    exit();
+    26c5:	e8 06 34 00 00       	call   5ad0 <exit>
+    printf(1, "chdir dd/../../dd failed\n");
+    26ca:	50                   	push   %eax
+    26cb:	50                   	push   %eax
+    26cc:	68 44 70 00 00       	push   $0x7044
+    26d1:	6a 01                	push   $0x1
+    26d3:	e8 88 3b 00 00       	call   6260 <printf>
+    exit();
+    26d8:	e8 f3 33 00 00       	call   5ad0 <exit>
+    printf(1, "unlink dd/dd/ff failed\n");
+    26dd:	50                   	push   %eax
+    26de:	50                   	push   %eax
+    26df:	68 0f 70 00 00       	push   $0x700f
+    26e4:	6a 01                	push   $0x1
+    26e6:	e8 75 3b 00 00       	call   6260 <printf>
+    exit();
+    26eb:	e8 e0 33 00 00       	call   5ad0 <exit>
+    printf(1, "create dd/ff/ff succeeded!\n");
+    26f0:	51                   	push   %ecx
+    26f1:	51                   	push   %ecx
+    26f2:	68 c1 70 00 00       	push   $0x70c1
+    26f7:	6a 01                	push   $0x1
+    26f9:	e8 62 3b 00 00       	call   6260 <printf>
+    exit();
+    26fe:	e8 cd 33 00 00       	call   5ad0 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    2703:	53                   	push   %ebx
+    2704:	53                   	push   %ebx
+    2705:	68 20 82 00 00       	push   $0x8220
+    270a:	6a 01                	push   $0x1
+    270c:	e8 4f 3b 00 00       	call   6260 <printf>
+    exit();
+    2711:	e8 ba 33 00 00       	call   5ad0 <exit>
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    2716:	51                   	push   %ecx
+    2717:	51                   	push   %ecx
+    2718:	68 55 71 00 00       	push   $0x7155
+    271d:	6a 01                	push   $0x1
+    271f:	e8 3c 3b 00 00       	call   6260 <printf>
+    exit();
+    2724:	e8 a7 33 00 00       	call   5ad0 <exit>
+    printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    2729:	53                   	push   %ebx
+    272a:	53                   	push   %ebx
+    272b:	68 90 82 00 00       	push   $0x8290
+    2730:	6a 01                	push   $0x1
+    2732:	e8 29 3b 00 00       	call   6260 <printf>
+    exit();
+    2737:	e8 94 33 00 00       	call   5ad0 <exit>
+    printf(1, "open dd/dd/../ff failed\n");
+    273c:	50                   	push   %eax
+    273d:	50                   	push   %eax
+    273e:	68 d0 6f 00 00       	push   $0x6fd0
+    2743:	6a 01                	push   $0x1
+    2745:	e8 16 3b 00 00       	call   6260 <printf>
+    exit();
+    274a:	e8 81 33 00 00       	call   5ad0 <exit>
+    printf(1, "create dd/dd/ff failed\n");
+    274f:	51                   	push   %ecx
+    2750:	51                   	push   %ecx
+    2751:	68 a9 6f 00 00       	push   $0x6fa9
+    2756:	6a 01                	push   $0x1
+    2758:	e8 03 3b 00 00       	call   6260 <printf>
+    exit();
+    275d:	e8 6e 33 00 00       	call   5ad0 <exit>
+    printf(1, "chdir ./.. failed\n");
+    2762:	50                   	push   %eax
+    2763:	50                   	push   %eax
+    2764:	68 72 70 00 00       	push   $0x7072
+    2769:	6a 01                	push   $0x1
+    276b:	e8 f0 3a 00 00       	call   6260 <printf>
+    exit();
+    2770:	e8 5b 33 00 00       	call   5ad0 <exit>
+    printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    2775:	52                   	push   %edx
+    2776:	52                   	push   %edx
+    2777:	68 d8 81 00 00       	push   $0x81d8
+    277c:	6a 01                	push   $0x1
+    277e:	e8 dd 3a 00 00       	call   6260 <printf>
+    exit();
+    2783:	e8 48 33 00 00       	call   5ad0 <exit>
+    printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    2788:	50                   	push   %eax
+    2789:	50                   	push   %eax
+    278a:	68 6c 82 00 00       	push   $0x826c
+    278f:	6a 01                	push   $0x1
+    2791:	e8 ca 3a 00 00       	call   6260 <printf>
+    exit();
+    2796:	e8 35 33 00 00       	call   5ad0 <exit>
+    printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    279b:	50                   	push   %eax
+    279c:	50                   	push   %eax
+    279d:	68 48 82 00 00       	push   $0x8248
+    27a2:	6a 01                	push   $0x1
+    27a4:	e8 b7 3a 00 00       	call   6260 <printf>
+    exit();
+    27a9:	e8 22 33 00 00       	call   5ad0 <exit>
+    printf(1, "open dd wronly succeeded!\n");
+    27ae:	50                   	push   %eax
+    27af:	50                   	push   %eax
+    27b0:	68 31 71 00 00       	push   $0x7131
+    27b5:	6a 01                	push   $0x1
+    27b7:	e8 a4 3a 00 00       	call   6260 <printf>
+    exit();
+    27bc:	e8 0f 33 00 00       	call   5ad0 <exit>
+    printf(1, "open dd rdwr succeeded!\n");
+    27c1:	50                   	push   %eax
+    27c2:	50                   	push   %eax
+    27c3:	68 18 71 00 00       	push   $0x7118
+    27c8:	6a 01                	push   $0x1
+    27ca:	e8 91 3a 00 00       	call   6260 <printf>
+    exit();
+    27cf:	e8 fc 32 00 00       	call   5ad0 <exit>
+    printf(1, "create dd succeeded!\n");
+    27d4:	50                   	push   %eax
+    27d5:	50                   	push   %eax
+    27d6:	68 02 71 00 00       	push   $0x7102
+    27db:	6a 01                	push   $0x1
+    27dd:	e8 7e 3a 00 00       	call   6260 <printf>
+    exit();
+    27e2:	e8 e9 32 00 00       	call   5ad0 <exit>
+    printf(1, "create dd/xx/ff succeeded!\n");
+    27e7:	52                   	push   %edx
+    27e8:	52                   	push   %edx
+    27e9:	68 e6 70 00 00       	push   $0x70e6
+    27ee:	6a 01                	push   $0x1
+    27f0:	e8 6b 3a 00 00       	call   6260 <printf>
+    exit();
+    27f5:	e8 d6 32 00 00       	call   5ad0 <exit>
+    printf(1, "chdir dd failed\n");
+    27fa:	50                   	push   %eax
+    27fb:	50                   	push   %eax
+    27fc:	68 27 70 00 00       	push   $0x7027
+    2801:	6a 01                	push   $0x1
+    2803:	e8 58 3a 00 00       	call   6260 <printf>
+    exit();
+    2808:	e8 c3 32 00 00       	call   5ad0 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    280d:	50                   	push   %eax
+    280e:	50                   	push   %eax
+    280f:	68 fc 81 00 00       	push   $0x81fc
+    2814:	6a 01                	push   $0x1
+    2816:	e8 45 3a 00 00       	call   6260 <printf>
+    exit();
+    281b:	e8 b0 32 00 00       	call   5ad0 <exit>
+    printf(1, "subdir mkdir dd/dd failed\n");
+    2820:	53                   	push   %ebx
+    2821:	53                   	push   %ebx
+    2822:	68 85 6f 00 00       	push   $0x6f85
+    2827:	6a 01                	push   $0x1
+    2829:	e8 32 3a 00 00       	call   6260 <printf>
+    exit();
+    282e:	e8 9d 32 00 00       	call   5ad0 <exit>
+    printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    2833:	50                   	push   %eax
+    2834:	50                   	push   %eax
+    2835:	68 b0 81 00 00       	push   $0x81b0
+    283a:	6a 01                	push   $0x1
+    283c:	e8 1f 3a 00 00       	call   6260 <printf>
+    exit();
+    2841:	e8 8a 32 00 00       	call   5ad0 <exit>
+    printf(1, "create dd/ff failed\n");
+    2846:	50                   	push   %eax
+    2847:	50                   	push   %eax
+    2848:	68 69 6f 00 00       	push   $0x6f69
+    284d:	6a 01                	push   $0x1
+    284f:	e8 0c 3a 00 00       	call   6260 <printf>
+    exit();
+    2854:	e8 77 32 00 00       	call   5ad0 <exit>
+    printf(1, "subdir mkdir dd failed\n");
+    2859:	50                   	push   %eax
+    285a:	50                   	push   %eax
+    285b:	68 51 6f 00 00       	push   $0x6f51
+    2860:	6a 01                	push   $0x1
+    2862:	e8 f9 39 00 00       	call   6260 <printf>
+    exit();
+    2867:	e8 64 32 00 00       	call   5ad0 <exit>
+    printf(1, "unlink dd failed\n");
+    286c:	50                   	push   %eax
+    286d:	50                   	push   %eax
+    286e:	68 3a 72 00 00       	push   $0x723a
+    2873:	6a 01                	push   $0x1
+    2875:	e8 e6 39 00 00       	call   6260 <printf>
+    exit();
+    287a:	e8 51 32 00 00       	call   5ad0 <exit>
+    printf(1, "unlink dd/dd failed\n");
+    287f:	52                   	push   %edx
+    2880:	52                   	push   %edx
+    2881:	68 25 72 00 00       	push   $0x7225
+    2886:	6a 01                	push   $0x1
+    2888:	e8 d3 39 00 00       	call   6260 <printf>
+    exit();
+    288d:	e8 3e 32 00 00       	call   5ad0 <exit>
+    printf(1, "unlink non-empty dd succeeded!\n");
+    2892:	51                   	push   %ecx
+    2893:	51                   	push   %ecx
+    2894:	68 b4 82 00 00       	push   $0x82b4
+    2899:	6a 01                	push   $0x1
+    289b:	e8 c0 39 00 00       	call   6260 <printf>
+    exit();
+    28a0:	e8 2b 32 00 00       	call   5ad0 <exit>
+    printf(1, "unlink dd/ff failed\n");
+    28a5:	53                   	push   %ebx
+    28a6:	53                   	push   %ebx
+    28a7:	68 10 72 00 00       	push   $0x7210
+    28ac:	6a 01                	push   $0x1
+    28ae:	e8 ad 39 00 00       	call   6260 <printf>
+    exit();
+    28b3:	e8 18 32 00 00       	call   5ad0 <exit>
+    printf(1, "chdir dd/xx succeeded!\n");
+    28b8:	50                   	push   %eax
+    28b9:	50                   	push   %eax
+    28ba:	68 f8 71 00 00       	push   $0x71f8
+    28bf:	6a 01                	push   $0x1
+    28c1:	e8 9a 39 00 00       	call   6260 <printf>
+    exit();
+    28c6:	e8 05 32 00 00       	call   5ad0 <exit>
+    printf(1, "chdir dd/ff succeeded!\n");
+    28cb:	50                   	push   %eax
+    28cc:	50                   	push   %eax
+    28cd:	68 e0 71 00 00       	push   $0x71e0
+    28d2:	6a 01                	push   $0x1
+    28d4:	e8 87 39 00 00       	call   6260 <printf>
+    exit();
+    28d9:	e8 f2 31 00 00       	call   5ad0 <exit>
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    28de:	50                   	push   %eax
+    28df:	50                   	push   %eax
+    28e0:	68 c4 71 00 00       	push   $0x71c4
+    28e5:	6a 01                	push   $0x1
+    28e7:	e8 74 39 00 00       	call   6260 <printf>
+    exit();
+    28ec:	e8 df 31 00 00       	call   5ad0 <exit>
+    printf(1, "unlink dd/xx/ff succeeded!\n");
+    28f1:	50                   	push   %eax
+    28f2:	50                   	push   %eax
+    28f3:	68 a8 71 00 00       	push   $0x71a8
+    28f8:	6a 01                	push   $0x1
+    28fa:	e8 61 39 00 00       	call   6260 <printf>
+    exit();
+    28ff:	e8 cc 31 00 00       	call   5ad0 <exit>
+    printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    2904:	50                   	push   %eax
+    2905:	50                   	push   %eax
+    2906:	68 8b 71 00 00       	push   $0x718b
+    290b:	6a 01                	push   $0x1
+    290d:	e8 4e 39 00 00       	call   6260 <printf>
+    exit();
+    2912:	e8 b9 31 00 00       	call   5ad0 <exit>
+    printf(1, "mkdir dd/xx/ff succeeded!\n");
+    2917:	52                   	push   %edx
+    2918:	52                   	push   %edx
+    2919:	68 70 71 00 00       	push   $0x7170
+    291e:	6a 01                	push   $0x1
+    2920:	e8 3b 39 00 00       	call   6260 <printf>
+    exit();
+    2925:	e8 a6 31 00 00       	call   5ad0 <exit>
+    printf(1, "read dd/dd/ffff wrong len\n");
+    292a:	51                   	push   %ecx
+    292b:	51                   	push   %ecx
+    292c:	68 9d 70 00 00       	push   $0x709d
+    2931:	6a 01                	push   $0x1
+    2933:	e8 28 39 00 00       	call   6260 <printf>
+    exit();
+    2938:	e8 93 31 00 00       	call   5ad0 <exit>
+    printf(1, "open dd/dd/ffff failed\n");
+    293d:	53                   	push   %ebx
+    293e:	53                   	push   %ebx
+    293f:	68 85 70 00 00       	push   $0x7085
+    2944:	6a 01                	push   $0x1
+    2946:	e8 15 39 00 00       	call   6260 <printf>
+    exit();
+    294b:	e8 80 31 00 00       	call   5ad0 <exit>
+
+00002950 <bigwrite>:
+{
+    2950:	55                   	push   %ebp
+    2951:	89 e5                	mov    %esp,%ebp
+    2953:	56                   	push   %esi
+    2954:	53                   	push   %ebx
+  for(sz = 499; sz < 12*512; sz += 471){
+    2955:	bb f3 01 00 00       	mov    $0x1f3,%ebx
+  printf(1, "bigwrite test\n");
+    295a:	83 ec 08             	sub    $0x8,%esp
+    295d:	68 57 72 00 00       	push   $0x7257
+    2962:	6a 01                	push   $0x1
+    2964:	e8 f7 38 00 00       	call   6260 <printf>
+  unlink("bigwrite");
+    2969:	c7 04 24 66 72 00 00 	movl   $0x7266,(%esp)
+    2970:	e8 bb 33 00 00       	call   5d30 <unlink>
+    2975:	83 c4 10             	add    $0x10,%esp
+    2978:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    297f:	90                   	nop
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    2980:	83 ec 08             	sub    $0x8,%esp
+    2983:	68 02 02 00 00       	push   $0x202
+    2988:	68 66 72 00 00       	push   $0x7266
+    298d:	e8 8e 33 00 00       	call   5d20 <open>
+    if(fd < 0){
+    2992:	83 c4 10             	add    $0x10,%esp
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    2995:	89 c6                	mov    %eax,%esi
+    if(fd < 0){
+    2997:	85 c0                	test   %eax,%eax
+    2999:	78 7e                	js     2a19 <bigwrite+0xc9>
+      int cc = write(fd, buf, sz);
+    299b:	83 ec 04             	sub    $0x4,%esp
+    299e:	53                   	push   %ebx
+    299f:	68 60 c9 00 00       	push   $0xc960
+    29a4:	50                   	push   %eax
+    29a5:	e8 f6 31 00 00       	call   5ba0 <write>
+      if(cc != sz){
+    29aa:	83 c4 10             	add    $0x10,%esp
+    29ad:	39 d8                	cmp    %ebx,%eax
+    29af:	75 55                	jne    2a06 <bigwrite+0xb6>
+      int cc = write(fd, buf, sz);
+    29b1:	83 ec 04             	sub    $0x4,%esp
+    29b4:	53                   	push   %ebx
+    29b5:	68 60 c9 00 00       	push   $0xc960
+    29ba:	56                   	push   %esi
+    29bb:	e8 e0 31 00 00       	call   5ba0 <write>
+      if(cc != sz){
+    29c0:	83 c4 10             	add    $0x10,%esp
+    29c3:	39 c3                	cmp    %eax,%ebx
+    29c5:	75 3f                	jne    2a06 <bigwrite+0xb6>
+    close(fd);
+    29c7:	83 ec 0c             	sub    $0xc,%esp
+  for(sz = 499; sz < 12*512; sz += 471){
+    29ca:	81 c3 d7 01 00 00    	add    $0x1d7,%ebx
+    close(fd);
+    29d0:	56                   	push   %esi
+    29d1:	e8 4a 32 00 00       	call   5c20 <close>
+    unlink("bigwrite");
+    29d6:	c7 04 24 66 72 00 00 	movl   $0x7266,(%esp)
+    29dd:	e8 4e 33 00 00       	call   5d30 <unlink>
+  for(sz = 499; sz < 12*512; sz += 471){
+    29e2:	83 c4 10             	add    $0x10,%esp
+    29e5:	81 fb 07 18 00 00    	cmp    $0x1807,%ebx
+    29eb:	75 93                	jne    2980 <bigwrite+0x30>
+  printf(1, "bigwrite ok\n");
+    29ed:	83 ec 08             	sub    $0x8,%esp
+    29f0:	68 99 72 00 00       	push   $0x7299
+    29f5:	6a 01                	push   $0x1
+    29f7:	e8 64 38 00 00       	call   6260 <printf>
+}
+    29fc:	83 c4 10             	add    $0x10,%esp
+    29ff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2a02:	5b                   	pop    %ebx
+    2a03:	5e                   	pop    %esi
+    2a04:	5d                   	pop    %ebp
+    2a05:	c3                   	ret
+        printf(1, "write(%d) ret %d\n", sz, cc);
+    2a06:	50                   	push   %eax
+    2a07:	53                   	push   %ebx
+    2a08:	68 87 72 00 00       	push   $0x7287
+    2a0d:	6a 01                	push   $0x1
+    2a0f:	e8 4c 38 00 00       	call   6260 <printf>
+        exit();
+    2a14:	e8 b7 30 00 00       	call   5ad0 <exit>
+      printf(1, "cannot create bigwrite\n");
+    2a19:	83 ec 08             	sub    $0x8,%esp
+    2a1c:	68 6f 72 00 00       	push   $0x726f
+    2a21:	6a 01                	push   $0x1
+    2a23:	e8 38 38 00 00       	call   6260 <printf>
+      exit();
+    2a28:	e8 a3 30 00 00       	call   5ad0 <exit>
+    2a2d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002a30 <inlinefile>:
+{
+    2a30:	55                   	push   %ebp
+    2a31:	89 e5                	mov    %esp,%ebp
+    2a33:	57                   	push   %edi
+    2a34:	56                   	push   %esi
+    2a35:	53                   	push   %ebx
+    2a36:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "inlinefile test\n");
+    2a39:	68 a6 72 00 00       	push   $0x72a6
+    2a3e:	6a 01                	push   $0x1
+    2a40:	e8 1b 38 00 00       	call   6260 <printf>
+  unlink("inlinefile");
+    2a45:	c7 04 24 b7 72 00 00 	movl   $0x72b7,(%esp)
+    2a4c:	e8 df 32 00 00       	call   5d30 <unlink>
+  fd = open("inlinefile", O_CREATE | O_RDWR);
+    2a51:	58                   	pop    %eax
+    2a52:	5a                   	pop    %edx
+    2a53:	68 02 02 00 00       	push   $0x202
+    2a58:	68 b7 72 00 00       	push   $0x72b7
+    2a5d:	e8 be 32 00 00       	call   5d20 <open>
+  if(fd < 0){
+    2a62:	83 c4 10             	add    $0x10,%esp
+    2a65:	85 c0                	test   %eax,%eax
+    2a67:	0f 88 0f 02 00 00    	js     2c7c <inlinefile+0x24c>
+    2a6d:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < 600; i++){
+    2a6f:	31 f6                	xor    %esi,%esi
+    2a71:	8d 7d e7             	lea    -0x19(%ebp),%edi
+    2a74:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = 'a' + i % 26;
+    2a78:	b8 4f ec c4 4e       	mov    $0x4ec4ec4f,%eax
+    if(write(fd, &c, 1) != 1){
+    2a7d:	83 ec 04             	sub    $0x4,%esp
+    c = 'a' + i % 26;
+    2a80:	f7 e6                	mul    %esi
+    2a82:	89 f0                	mov    %esi,%eax
+    2a84:	c1 ea 03             	shr    $0x3,%edx
+    2a87:	6b d2 1a             	imul   $0x1a,%edx,%edx
+    2a8a:	29 d0                	sub    %edx,%eax
+    2a8c:	83 c0 61             	add    $0x61,%eax
+    2a8f:	88 45 e7             	mov    %al,-0x19(%ebp)
+    if(write(fd, &c, 1) != 1){
+    2a92:	6a 01                	push   $0x1
+    2a94:	57                   	push   %edi
+    2a95:	53                   	push   %ebx
+    2a96:	e8 05 31 00 00       	call   5ba0 <write>
+    2a9b:	83 c4 10             	add    $0x10,%esp
+    2a9e:	83 f8 01             	cmp    $0x1,%eax
+    2aa1:	0f 85 ab 01 00 00    	jne    2c52 <inlinefile+0x222>
+  for(i = 0; i < 600; i++){
+    2aa7:	83 c6 01             	add    $0x1,%esi
+    2aaa:	81 fe 58 02 00 00    	cmp    $0x258,%esi
+    2ab0:	75 c6                	jne    2a78 <inlinefile+0x48>
+  close(fd);
+    2ab2:	83 ec 0c             	sub    $0xc,%esp
+    2ab5:	53                   	push   %ebx
+    2ab6:	e8 65 31 00 00       	call   5c20 <close>
+  fd = open("inlinefile", O_RDONLY);
+    2abb:	5f                   	pop    %edi
+    2abc:	58                   	pop    %eax
+    2abd:	6a 00                	push   $0x0
+    2abf:	68 b7 72 00 00       	push   $0x72b7
+    2ac4:	e8 57 32 00 00       	call   5d20 <open>
+  n = read(fd, buf, sizeof(buf));
+    2ac9:	83 c4 0c             	add    $0xc,%esp
+    2acc:	68 00 20 00 00       	push   $0x2000
+  fd = open("inlinefile", O_RDONLY);
+    2ad1:	89 c7                	mov    %eax,%edi
+  n = read(fd, buf, sizeof(buf));
+    2ad3:	68 60 c9 00 00       	push   $0xc960
+    2ad8:	50                   	push   %eax
+    2ad9:	e8 42 30 00 00       	call   5b20 <read>
+  if(n != 600){
+    2ade:	83 c4 10             	add    $0x10,%esp
+    2ae1:	3d 58 02 00 00       	cmp    $0x258,%eax
+    2ae6:	0f 85 f1 01 00 00    	jne    2cdd <inlinefile+0x2ad>
+  for(i = 0; i < n; i++){
+    2aec:	31 c9                	xor    %ecx,%ecx
+    if(buf[i] != 'a' + i % 26){
+    2aee:	be 4f ec c4 4e       	mov    $0x4ec4ec4f,%esi
+    2af3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2af7:	90                   	nop
+    2af8:	89 c8                	mov    %ecx,%eax
+    2afa:	0f be 99 60 c9 00 00 	movsbl 0xc960(%ecx),%ebx
+    2b01:	f7 e6                	mul    %esi
+    2b03:	89 c8                	mov    %ecx,%eax
+    2b05:	c1 ea 03             	shr    $0x3,%edx
+    2b08:	6b d2 1a             	imul   $0x1a,%edx,%edx
+    2b0b:	29 d0                	sub    %edx,%eax
+    2b0d:	83 c0 61             	add    $0x61,%eax
+    2b10:	39 c3                	cmp    %eax,%ebx
+    2b12:	0f 85 4f 01 00 00    	jne    2c67 <inlinefile+0x237>
+  for(i = 0; i < n; i++){
+    2b18:	83 c1 01             	add    $0x1,%ecx
+    2b1b:	81 f9 58 02 00 00    	cmp    $0x258,%ecx
+    2b21:	75 d5                	jne    2af8 <inlinefile+0xc8>
+  close(fd);
+    2b23:	83 ec 0c             	sub    $0xc,%esp
+    2b26:	57                   	push   %edi
+    2b27:	e8 f4 30 00 00       	call   5c20 <close>
+  unlink("inlinefile");
+    2b2c:	c7 04 24 b7 72 00 00 	movl   $0x72b7,(%esp)
+    2b33:	e8 f8 31 00 00       	call   5d30 <unlink>
+  if(mkdir("inlinedir") < 0 || mkdir("inlinedir/a") < 0){
+    2b38:	c7 04 24 2f 73 00 00 	movl   $0x732f,(%esp)
+    2b3f:	e8 04 32 00 00       	call   5d48 <mkdir>
+    2b44:	83 c4 10             	add    $0x10,%esp
+    2b47:	85 c0                	test   %eax,%eax
+    2b49:	0f 88 7b 01 00 00    	js     2cca <inlinefile+0x29a>
+    2b4f:	83 ec 0c             	sub    $0xc,%esp
+    2b52:	68 52 73 00 00       	push   $0x7352
+    2b57:	e8 ec 31 00 00       	call   5d48 <mkdir>
+    2b5c:	83 c4 10             	add    $0x10,%esp
+    2b5f:	85 c0                	test   %eax,%eax
+    2b61:	0f 88 63 01 00 00    	js     2cca <inlinefile+0x29a>
+  fd = open("inlinedir/a/f", O_CREATE | O_RDWR);
+    2b67:	83 ec 08             	sub    $0x8,%esp
+    2b6a:	68 02 02 00 00       	push   $0x202
+    2b6f:	68 5e 73 00 00       	push   $0x735e
+    2b74:	e8 a7 31 00 00       	call   5d20 <open>
+  if(fd < 0 || write(fd, "hi", 2) != 2){
+    2b79:	83 c4 10             	add    $0x10,%esp
+  fd = open("inlinedir/a/f", O_CREATE | O_RDWR);
+    2b7c:	89 c3                	mov    %eax,%ebx
+  if(fd < 0 || write(fd, "hi", 2) != 2){
+    2b7e:	85 c0                	test   %eax,%eax
+    2b80:	0f 88 31 01 00 00    	js     2cb7 <inlinefile+0x287>
+    2b86:	83 ec 04             	sub    $0x4,%esp
+    2b89:	6a 02                	push   $0x2
+    2b8b:	68 6c 73 00 00       	push   $0x736c
+    2b90:	50                   	push   %eax
+    2b91:	e8 0a 30 00 00       	call   5ba0 <write>
+    2b96:	83 c4 10             	add    $0x10,%esp
+    2b99:	83 f8 02             	cmp    $0x2,%eax
+    2b9c:	0f 85 15 01 00 00    	jne    2cb7 <inlinefile+0x287>
+  close(fd);
+    2ba2:	83 ec 0c             	sub    $0xc,%esp
+    2ba5:	53                   	push   %ebx
+    2ba6:	e8 75 30 00 00       	call   5c20 <close>
+  fd = open("inlinedir/a/f", O_RDONLY);
+    2bab:	58                   	pop    %eax
+    2bac:	5a                   	pop    %edx
+    2bad:	6a 00                	push   $0x0
+    2baf:	68 5e 73 00 00       	push   $0x735e
+    2bb4:	e8 67 31 00 00       	call   5d20 <open>
+  if(read(fd, buf, sizeof(buf)) != 2 || buf[0] != 'h' || buf[1] != 'i'){
+    2bb9:	83 c4 0c             	add    $0xc,%esp
+    2bbc:	68 00 20 00 00       	push   $0x2000
+  fd = open("inlinedir/a/f", O_RDONLY);
+    2bc1:	89 c3                	mov    %eax,%ebx
+  if(read(fd, buf, sizeof(buf)) != 2 || buf[0] != 'h' || buf[1] != 'i'){
+    2bc3:	68 60 c9 00 00       	push   $0xc960
+    2bc8:	50                   	push   %eax
+    2bc9:	e8 52 2f 00 00       	call   5b20 <read>
+    2bce:	83 c4 10             	add    $0x10,%esp
+    2bd1:	83 f8 02             	cmp    $0x2,%eax
+    2bd4:	0f 85 c9 00 00 00    	jne    2ca3 <inlinefile+0x273>
+    2bda:	80 3d 60 c9 00 00 68 	cmpb   $0x68,0xc960
+    2be1:	0f 85 bc 00 00 00    	jne    2ca3 <inlinefile+0x273>
+    2be7:	80 3d 61 c9 00 00 69 	cmpb   $0x69,0xc961
+    2bee:	0f 85 af 00 00 00    	jne    2ca3 <inlinefile+0x273>
+  close(fd);
+    2bf4:	83 ec 0c             	sub    $0xc,%esp
+    2bf7:	53                   	push   %ebx
+    2bf8:	e8 23 30 00 00       	call   5c20 <close>
+  if(unlink("inlinedir/a/f") < 0 || unlink("inlinedir/a") < 0 ||
+    2bfd:	c7 04 24 5e 73 00 00 	movl   $0x735e,(%esp)
+    2c04:	e8 27 31 00 00       	call   5d30 <unlink>
+    2c09:	83 c4 10             	add    $0x10,%esp
+    2c0c:	85 c0                	test   %eax,%eax
+    2c0e:	78 7f                	js     2c8f <inlinefile+0x25f>
+    2c10:	83 ec 0c             	sub    $0xc,%esp
+    2c13:	68 52 73 00 00       	push   $0x7352
+    2c18:	e8 13 31 00 00       	call   5d30 <unlink>
+    2c1d:	83 c4 10             	add    $0x10,%esp
+    2c20:	85 c0                	test   %eax,%eax
+    2c22:	78 6b                	js     2c8f <inlinefile+0x25f>
+     unlink("inlinedir") < 0){
+    2c24:	83 ec 0c             	sub    $0xc,%esp
+    2c27:	68 2f 73 00 00       	push   $0x732f
+    2c2c:	e8 ff 30 00 00       	call   5d30 <unlink>
+  if(unlink("inlinedir/a/f") < 0 || unlink("inlinedir/a") < 0 ||
+    2c31:	83 c4 10             	add    $0x10,%esp
+    2c34:	85 c0                	test   %eax,%eax
+    2c36:	78 57                	js     2c8f <inlinefile+0x25f>
+  printf(1, "inlinefile ok\n");
+    2c38:	83 ec 08             	sub    $0x8,%esp
+    2c3b:	68 89 73 00 00       	push   $0x7389
+    2c40:	6a 01                	push   $0x1
+    2c42:	e8 19 36 00 00       	call   6260 <printf>
+}
+    2c47:	83 c4 10             	add    $0x10,%esp
+    2c4a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2c4d:	5b                   	pop    %ebx
+    2c4e:	5e                   	pop    %esi
+    2c4f:	5f                   	pop    %edi
+    2c50:	5d                   	pop    %ebp
+    2c51:	c3                   	ret
+      printf(1, "inlinefile write %d failed\n", i);
+    2c52:	83 ec 04             	sub    $0x4,%esp
+    2c55:	56                   	push   %esi
+    2c56:	68 dc 72 00 00       	push   $0x72dc
+    2c5b:	6a 01                	push   $0x1
+    2c5d:	e8 fe 35 00 00       	call   6260 <printf>
+      exit();
+    2c62:	e8 69 2e 00 00       	call   5ad0 <exit>
+      printf(1, "inlinefile wrong data at %d\n", i);
+    2c67:	83 ec 04             	sub    $0x4,%esp
+    2c6a:	51                   	push   %ecx
+    2c6b:	68 12 73 00 00       	push   $0x7312
+    2c70:	6a 01                	push   $0x1
+    2c72:	e8 e9 35 00 00       	call   6260 <printf>
+      exit();
+    2c77:	e8 54 2e 00 00       	call   5ad0 <exit>
+    printf(1, "cannot create inlinefile\n");
+    2c7c:	50                   	push   %eax
+    2c7d:	50                   	push   %eax
+    2c7e:	68 c2 72 00 00       	push   $0x72c2
+    2c83:	6a 01                	push   $0x1
+    2c85:	e8 d6 35 00 00       	call   6260 <printf>
+    exit();
+    2c8a:	e8 41 2e 00 00       	call   5ad0 <exit>
+    printf(1, "inlinefile unlink failed\n");
+    2c8f:	83 ec 08             	sub    $0x8,%esp
+    2c92:	68 6f 73 00 00       	push   $0x736f
+    2c97:	6a 01                	push   $0x1
+    2c99:	e8 c2 35 00 00       	call   6260 <printf>
+    exit();
+    2c9e:	e8 2d 2e 00 00       	call   5ad0 <exit>
+    printf(1, "inlinefile read in dir failed\n");
+    2ca3:	83 ec 08             	sub    $0x8,%esp
+    2ca6:	68 f8 82 00 00       	push   $0x82f8
+    2cab:	6a 01                	push   $0x1
+    2cad:	e8 ae 35 00 00       	call   6260 <printf>
+    exit();
+    2cb2:	e8 19 2e 00 00       	call   5ad0 <exit>
+    printf(1, "inlinefile create in dir failed\n");
+    2cb7:	51                   	push   %ecx
+    2cb8:	51                   	push   %ecx
+    2cb9:	68 d4 82 00 00       	push   $0x82d4
+    2cbe:	6a 01                	push   $0x1
+    2cc0:	e8 9b 35 00 00       	call   6260 <printf>
+    exit();
+    2cc5:	e8 06 2e 00 00       	call   5ad0 <exit>
+    printf(1, "inlinefile mkdir failed\n");
+    2cca:	53                   	push   %ebx
+    2ccb:	53                   	push   %ebx
+    2ccc:	68 39 73 00 00       	push   $0x7339
+    2cd1:	6a 01                	push   $0x1
+    2cd3:	e8 88 35 00 00       	call   6260 <printf>
+    exit();
+    2cd8:	e8 f3 2d 00 00       	call   5ad0 <exit>
+    printf(1, "inlinefile read %d bytes\n", n);
+    2cdd:	56                   	push   %esi
+    2cde:	50                   	push   %eax
+    2cdf:	68 f8 72 00 00       	push   $0x72f8
+    2ce4:	6a 01                	push   $0x1
+    2ce6:	e8 75 35 00 00       	call   6260 <printf>
+    exit();
+    2ceb:	e8 e0 2d 00 00       	call   5ad0 <exit>
+
+00002cf0 <mmaptest>:
+{
+    2cf0:	55                   	push   %ebp
+    2cf1:	89 e5                	mov    %esp,%ebp
+    2cf3:	57                   	push   %edi
+    2cf4:	56                   	push   %esi
+    2cf5:	53                   	push   %ebx
+    2cf6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "mmap test\n");
+    2cf9:	68 98 73 00 00       	push   $0x7398
+    2cfe:	6a 01                	push   $0x1
+    2d00:	e8 5b 35 00 00       	call   6260 <printf>
+  unlink("mmapfile");
+    2d05:	c7 04 24 a3 73 00 00 	movl   $0x73a3,(%esp)
+    2d0c:	e8 1f 30 00 00       	call   5d30 <unlink>
+  fd = open("mmapfile", O_CREATE | O_RDWR);
+    2d11:	5b                   	pop    %ebx
+    2d12:	5e                   	pop    %esi
+    2d13:	68 02 02 00 00       	push   $0x202
+    2d18:	68 a3 73 00 00       	push   $0x73a3
+    2d1d:	e8 fe 2f 00 00       	call   5d20 <open>
+  if(fd < 0){
+    2d22:	83 c4 10             	add    $0x10,%esp
+    2d25:	85 c0                	test   %eax,%eax
+    2d27:	0f 88 d9 03 00 00    	js     3106 <mmaptest+0x416>
+    2d2d:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < SZ; i++)
+    2d2f:	31 c9                	xor    %ecx,%ecx
+    buf[i] = 'a' + i % 26;
+    2d31:	be 4f ec c4 4e       	mov    $0x4ec4ec4f,%esi
+    2d36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2d3d:	8d 76 00             	lea    0x0(%esi),%esi
+    2d40:	89 c8                	mov    %ecx,%eax
+    2d42:	f7 e6                	mul    %esi
+    2d44:	89 c8                	mov    %ecx,%eax
+  for(i = 0; i < SZ; i++)
+    2d46:	83 c1 01             	add    $0x1,%ecx
+    buf[i] = 'a' + i % 26;
+    2d49:	c1 ea 03             	shr    $0x3,%edx
+    2d4c:	6b d2 1a             	imul   $0x1a,%edx,%edx
+    2d4f:	29 d0                	sub    %edx,%eax
+    2d51:	83 c0 61             	add    $0x61,%eax
+    2d54:	88 81 5f c9 00 00    	mov    %al,0xc95f(%ecx)
+  for(i = 0; i < SZ; i++)
+    2d5a:	81 f9 70 17 00 00    	cmp    $0x1770,%ecx
+    2d60:	75 de                	jne    2d40 <mmaptest+0x50>
+  if(write(fd, buf, SZ) != SZ){
+    2d62:	83 ec 04             	sub    $0x4,%esp
+    2d65:	68 70 17 00 00       	push   $0x1770
+    2d6a:	68 60 c9 00 00       	push   $0xc960
+    2d6f:	53                   	push   %ebx
+    2d70:	e8 2b 2e 00 00       	call   5ba0 <write>
+    2d75:	83 c4 10             	add    $0x10,%esp
+    2d78:	3d 70 17 00 00       	cmp    $0x1770,%eax
+    2d7d:	0f 85 70 03 00 00    	jne    30f3 <mmaptest+0x403>
+  p = mmap(0, SZ, PROT_READ|PROT_WRITE, MAP_PRIVATE, fd, 0);
+    2d83:	83 ec 08             	sub    $0x8,%esp
+    2d86:	6a 00                	push   $0x0
+    2d88:	53                   	push   %ebx
+    2d89:	6a 02                	push   $0x2
+    2d8b:	6a 03                	push   $0x3
+    2d8d:	68 70 17 00 00       	push   $0x1770
+    2d92:	6a 00                	push   $0x0
+    2d94:	e8 1f 30 00 00       	call   5db8 <mmap>
+  if(p == MAP_FAILED){
+    2d99:	83 c4 20             	add    $0x20,%esp
+  p = mmap(0, SZ, PROT_READ|PROT_WRITE, MAP_PRIVATE, fd, 0);
+    2d9c:	89 c7                	mov    %eax,%edi
+  if(p == MAP_FAILED){
+    2d9e:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2da1:	0f 84 39 03 00 00    	je     30e0 <mmaptest+0x3f0>
+    if(p[i] != 'a' + i % 26){
+    2da7:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  for(i = 0; i < SZ; i++){
+    2daa:	31 c9                	xor    %ecx,%ecx
+    if(p[i] != 'a' + i % 26){
+    2dac:	be 4f ec c4 4e       	mov    $0x4ec4ec4f,%esi
+    2db1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2db8:	89 c8                	mov    %ecx,%eax
+    2dba:	0f be 1c 0f          	movsbl (%edi,%ecx,1),%ebx
+    2dbe:	f7 e6                	mul    %esi
+    2dc0:	89 c8                	mov    %ecx,%eax
+    2dc2:	c1 ea 03             	shr    $0x3,%edx
+    2dc5:	6b d2 1a             	imul   $0x1a,%edx,%edx
+    2dc8:	29 d0                	sub    %edx,%eax
+    2dca:	83 c0 61             	add    $0x61,%eax
+    2dcd:	39 c3                	cmp    %eax,%ebx
+    2dcf:	0f 85 a9 02 00 00    	jne    307e <mmaptest+0x38e>
+  for(i = 0; i < SZ; i++){
+    2dd5:	83 c1 01             	add    $0x1,%ecx
+    2dd8:	81 f9 70 17 00 00    	cmp    $0x1770,%ecx
+    2dde:	75 d8                	jne    2db8 <mmaptest+0xc8>
+  if(munmap(p, SZ) < 0){
+    2de0:	83 ec 08             	sub    $0x8,%esp
+  p[0] = 'X';
+    2de3:	c6 07 58             	movb   $0x58,(%edi)
+    2de6:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  if(munmap(p, SZ) < 0){
+    2de9:	68 70 17 00 00       	push   $0x1770
+    2dee:	57                   	push   %edi
+    2def:	e8 cc 2f 00 00       	call   5dc0 <munmap>
+    2df4:	83 c4 10             	add    $0x10,%esp
+    2df7:	85 c0                	test   %eax,%eax
+    2df9:	0f 88 bb 02 00 00    	js     30ba <mmaptest+0x3ca>
+  p = mmap(0, SZ, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+    2dff:	83 ec 08             	sub    $0x8,%esp
+    2e02:	6a 00                	push   $0x0
+    2e04:	53                   	push   %ebx
+    2e05:	6a 01                	push   $0x1
+    2e07:	6a 03                	push   $0x3
+    2e09:	68 70 17 00 00       	push   $0x1770
+    2e0e:	6a 00                	push   $0x0
+    2e10:	e8 a3 2f 00 00       	call   5db8 <mmap>
+  if(p == MAP_FAILED){
+    2e15:	83 c4 20             	add    $0x20,%esp
+  p = mmap(0, SZ, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+    2e18:	89 c6                	mov    %eax,%esi
+  if(p == MAP_FAILED){
+    2e1a:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2e1d:	0f 84 86 03 00 00    	je     31a9 <mmaptest+0x4b9>
+  fd1 = open("mmapfile", O_RDONLY);
+    2e23:	83 ec 08             	sub    $0x8,%esp
+  p[1] = 'Y';
+    2e26:	c6 40 01 59          	movb   $0x59,0x1(%eax)
+  p[5000] = 'Z';
+    2e2a:	c6 80 88 13 00 00 5a 	movb   $0x5a,0x1388(%eax)
+  fd1 = open("mmapfile", O_RDONLY);
+    2e31:	6a 00                	push   $0x0
+    2e33:	68 a3 73 00 00       	push   $0x73a3
+    2e38:	e8 e3 2e 00 00       	call   5d20 <open>
+  if(read(fd1, buf, SZ) != SZ || buf[0] != 'a' || buf[1] != 'Y' ||
+    2e3d:	83 c4 0c             	add    $0xc,%esp
+    2e40:	68 70 17 00 00       	push   $0x1770
+  fd1 = open("mmapfile", O_RDONLY);
+    2e45:	89 c7                	mov    %eax,%edi
+  if(read(fd1, buf, SZ) != SZ || buf[0] != 'a' || buf[1] != 'Y' ||
+    2e47:	68 60 c9 00 00       	push   $0xc960
+    2e4c:	50                   	push   %eax
+    2e4d:	e8 ce 2c 00 00       	call   5b20 <read>
+    2e52:	83 c4 10             	add    $0x10,%esp
+    2e55:	3d 70 17 00 00       	cmp    $0x1770,%eax
+    2e5a:	0f 85 35 03 00 00    	jne    3195 <mmaptest+0x4a5>
+    2e60:	80 3d 60 c9 00 00 61 	cmpb   $0x61,0xc960
+    2e67:	0f 85 28 03 00 00    	jne    3195 <mmaptest+0x4a5>
+    2e6d:	80 3d 61 c9 00 00 59 	cmpb   $0x59,0xc961
+    2e74:	0f 85 1b 03 00 00    	jne    3195 <mmaptest+0x4a5>
+    2e7a:	80 3d e8 dc 00 00 5a 	cmpb   $0x5a,0xdce8
+    2e81:	0f 85 0e 03 00 00    	jne    3195 <mmaptest+0x4a5>
+  close(fd1);
+    2e87:	83 ec 0c             	sub    $0xc,%esp
+    2e8a:	57                   	push   %edi
+    2e8b:	e8 90 2d 00 00       	call   5c20 <close>
+  pid = fork();
+    2e90:	e8 0b 2c 00 00       	call   5aa0 <fork>
+  if(pid < 0){
+    2e95:	83 c4 10             	add    $0x10,%esp
+    2e98:	85 c0                	test   %eax,%eax
+    2e9a:	0f 88 e2 02 00 00    	js     3182 <mmaptest+0x492>
+  if(pid == 0){
+    2ea0:	0f 84 d3 02 00 00    	je     3179 <mmaptest+0x489>
+  wait();
+    2ea6:	e8 3d 2e 00 00       	call   5ce8 <wait>
+  if(p[2] != 'W'){
+    2eab:	80 7e 02 57          	cmpb   $0x57,0x2(%esi)
+    2eaf:	0f 85 b1 02 00 00    	jne    3166 <mmaptest+0x476>
+  if(munmap(p, SZ) < 0){
+    2eb5:	83 ec 08             	sub    $0x8,%esp
+    2eb8:	68 70 17 00 00       	push   $0x1770
+    2ebd:	56                   	push   %esi
+    2ebe:	e8 fd 2e 00 00       	call   5dc0 <munmap>
+    2ec3:	83 c4 10             	add    $0x10,%esp
+    2ec6:	85 c0                	test   %eax,%eax
+    2ec8:	0f 88 85 02 00 00    	js     3153 <mmaptest+0x463>
+  close(fd);
+    2ece:	83 ec 0c             	sub    $0xc,%esp
+    2ed1:	53                   	push   %ebx
+    2ed2:	e8 49 2d 00 00       	call   5c20 <close>
+  fd = open("mmapfile", O_RDONLY);
+    2ed7:	5b                   	pop    %ebx
+    2ed8:	5e                   	pop    %esi
+    2ed9:	6a 00                	push   $0x0
+    2edb:	68 a3 73 00 00       	push   $0x73a3
+    2ee0:	e8 3b 2e 00 00       	call   5d20 <open>
+  if(read(fd, buf, SZ) != SZ || buf[0] != 'a' || buf[1] != 'Y' ||
+    2ee5:	83 c4 0c             	add    $0xc,%esp
+    2ee8:	68 70 17 00 00       	push   $0x1770
+  fd = open("mmapfile", O_RDONLY);
+    2eed:	89 c3                	mov    %eax,%ebx
+  if(read(fd, buf, SZ) != SZ || buf[0] != 'a' || buf[1] != 'Y' ||
+    2eef:	68 60 c9 00 00       	push   $0xc960
+    2ef4:	50                   	push   %eax
+    2ef5:	e8 26 2c 00 00       	call   5b20 <read>
+    2efa:	83 c4 10             	add    $0x10,%esp
+    2efd:	3d 70 17 00 00       	cmp    $0x1770,%eax
+    2f02:	0f 85 37 02 00 00    	jne    313f <mmaptest+0x44f>
+    2f08:	80 3d 60 c9 00 00 61 	cmpb   $0x61,0xc960
+    2f0f:	0f 85 2a 02 00 00    	jne    313f <mmaptest+0x44f>
+    2f15:	80 3d 61 c9 00 00 59 	cmpb   $0x59,0xc961
+    2f1c:	0f 85 1d 02 00 00    	jne    313f <mmaptest+0x44f>
+    2f22:	80 3d 62 c9 00 00 57 	cmpb   $0x57,0xc962
+    2f29:	0f 85 10 02 00 00    	jne    313f <mmaptest+0x44f>
+     buf[2] != 'W' || buf[5000] != 'Z'){
+    2f2f:	80 3d e8 dc 00 00 5a 	cmpb   $0x5a,0xdce8
+    2f36:	0f 85 03 02 00 00    	jne    313f <mmaptest+0x44f>
+  if(mmap(0, SZ, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0) != MAP_FAILED){
+    2f3c:	83 ec 08             	sub    $0x8,%esp
+    2f3f:	6a 00                	push   $0x0
+    2f41:	53                   	push   %ebx
+    2f42:	6a 01                	push   $0x1
+    2f44:	6a 03                	push   $0x3
+    2f46:	68 70 17 00 00       	push   $0x1770
+    2f4b:	6a 00                	push   $0x0
+    2f4d:	e8 66 2e 00 00       	call   5db8 <mmap>
+    2f52:	83 c4 20             	add    $0x20,%esp
+    2f55:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2f58:	0f 85 5e 02 00 00    	jne    31bc <mmaptest+0x4cc>
+  close(fd);
+    2f5e:	83 ec 0c             	sub    $0xc,%esp
+    2f61:	53                   	push   %ebx
+    2f62:	e8 b9 2c 00 00       	call   5c20 <close>
+  unlink("mmapfile");
+    2f67:	c7 04 24 a3 73 00 00 	movl   $0x73a3,(%esp)
+    2f6e:	e8 bd 2d 00 00       	call   5d30 <unlink>
+  p = mmap(0, 3*4096, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+    2f73:	58                   	pop    %eax
+    2f74:	5a                   	pop    %edx
+    2f75:	6a 00                	push   $0x0
+    2f77:	6a ff                	push   $0xffffffff
+    2f79:	6a 22                	push   $0x22
+    2f7b:	6a 03                	push   $0x3
+    2f7d:	68 00 30 00 00       	push   $0x3000
+    2f82:	6a 00                	push   $0x0
+    2f84:	e8 2f 2e 00 00       	call   5db8 <mmap>
+  if(p == MAP_FAILED){
+    2f89:	83 c4 20             	add    $0x20,%esp
+  p = mmap(0, 3*4096, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+    2f8c:	89 c3                	mov    %eax,%ebx
+  if(p == MAP_FAILED){
+    2f8e:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2f91:	0f 84 36 01 00 00    	je     30cd <mmaptest+0x3dd>
+    2f97:	8d 90 00 30 00 00    	lea    0x3000(%eax),%edx
+    2f9d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(p[i] != 0){
+    2fa0:	80 38 00             	cmpb   $0x0,(%eax)
+    2fa3:	0f 85 ea 00 00 00    	jne    3093 <mmaptest+0x3a3>
+  for(i = 0; i < 3*4096; i++){
+    2fa9:	83 c0 01             	add    $0x1,%eax
+    2fac:	39 c2                	cmp    %eax,%edx
+    2fae:	75 f0                	jne    2fa0 <mmaptest+0x2b0>
+  if(munmap(p + 4096, 4096) < 0){
+    2fb0:	83 ec 08             	sub    $0x8,%esp
+    2fb3:	8d 83 00 10 00 00    	lea    0x1000(%ebx),%eax
+  p[0] = 'A';
+    2fb9:	c6 03 41             	movb   $0x41,(%ebx)
+  p[2*4096] = 'C';
+    2fbc:	c6 83 00 20 00 00 43 	movb   $0x43,0x2000(%ebx)
+  if(munmap(p + 4096, 4096) < 0){
+    2fc3:	68 00 10 00 00       	push   $0x1000
+    2fc8:	50                   	push   %eax
+    2fc9:	e8 f2 2d 00 00       	call   5dc0 <munmap>
+    2fce:	83 c4 10             	add    $0x10,%esp
+    2fd1:	85 c0                	test   %eax,%eax
+    2fd3:	0f 88 53 01 00 00    	js     312c <mmaptest+0x43c>
+  if(p[0] != 'A' || p[2*4096] != 'C'){
+    2fd9:	80 3b 41             	cmpb   $0x41,(%ebx)
+    2fdc:	0f 85 c5 00 00 00    	jne    30a7 <mmaptest+0x3b7>
+    2fe2:	80 bb 00 20 00 00 43 	cmpb   $0x43,0x2000(%ebx)
+    2fe9:	0f 85 b8 00 00 00    	jne    30a7 <mmaptest+0x3b7>
+  memmove(p + 100, q, strlen(q) + 1);
+    2fef:	83 ec 0c             	sub    $0xc,%esp
+    2ff2:	8d 73 64             	lea    0x64(%ebx),%esi
+    2ff5:	68 da 74 00 00       	push   $0x74da
+    2ffa:	e8 91 28 00 00       	call   5890 <strlen>
+    2fff:	83 c4 0c             	add    $0xc,%esp
+    3002:	83 c0 01             	add    $0x1,%eax
+    3005:	50                   	push   %eax
+    3006:	68 da 74 00 00       	push   $0x74da
+    300b:	56                   	push   %esi
+    300c:	e8 5f 2a 00 00       	call   5a70 <memmove>
+  fd = open(p + 100, O_CREATE | O_RDWR);
+    3011:	5f                   	pop    %edi
+    3012:	58                   	pop    %eax
+    3013:	68 02 02 00 00       	push   $0x202
+    3018:	56                   	push   %esi
+    3019:	e8 02 2d 00 00       	call   5d20 <open>
+  if(fd < 0 || write(fd, p, 10) != 10){
+    301e:	83 c4 10             	add    $0x10,%esp
+  fd = open(p + 100, O_CREATE | O_RDWR);
+    3021:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || write(fd, p, 10) != 10){
+    3023:	85 c0                	test   %eax,%eax
+    3025:	0f 88 ee 00 00 00    	js     3119 <mmaptest+0x429>
+    302b:	83 ec 04             	sub    $0x4,%esp
+    302e:	6a 0a                	push   $0xa
+    3030:	53                   	push   %ebx
+    3031:	50                   	push   %eax
+    3032:	e8 69 2b 00 00       	call   5ba0 <write>
+    3037:	83 c4 10             	add    $0x10,%esp
+    303a:	83 f8 0a             	cmp    $0xa,%eax
+    303d:	0f 85 d6 00 00 00    	jne    3119 <mmaptest+0x429>
+  close(fd);
+    3043:	83 ec 0c             	sub    $0xc,%esp
+    3046:	56                   	push   %esi
+    3047:	e8 d4 2b 00 00       	call   5c20 <close>
+  unlink("mmapanon");
+    304c:	c7 04 24 da 74 00 00 	movl   $0x74da,(%esp)
+    3053:	e8 d8 2c 00 00       	call   5d30 <unlink>
+  munmap(p, 3*4096);
+    3058:	58                   	pop    %eax
+    3059:	5a                   	pop    %edx
+    305a:	68 00 30 00 00       	push   $0x3000
+    305f:	53                   	push   %ebx
+    3060:	e8 5b 2d 00 00       	call   5dc0 <munmap>
+  printf(1, "mmap ok\n");
+    3065:	59                   	pop    %ecx
+    3066:	5b                   	pop    %ebx
+    3067:	68 e3 74 00 00       	push   $0x74e3
+    306c:	6a 01                	push   $0x1
+    306e:	e8 ed 31 00 00       	call   6260 <printf>
+}
+    3073:	83 c4 10             	add    $0x10,%esp
+    3076:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3079:	5b                   	pop    %ebx
+    307a:	5e                   	pop    %esi
+    307b:	5f                   	pop    %edi
+    307c:	5d                   	pop    %ebp
+    307d:	c3                   	ret
+      printf(1, "mmap private wrong data at %d\n", i);
+    307e:	83 ec 04             	sub    $0x4,%esp
+    3081:	51                   	push   %ecx
+    3082:	68 18 83 00 00       	push   $0x8318
+    3087:	6a 01                	push   $0x1
+    3089:	e8 d2 31 00 00       	call   6260 <printf>
+      exit();
+    308e:	e8 3d 2a 00 00       	call   5ad0 <exit>
+      printf(1, "mmap anon not zero\n");
+    3093:	83 ec 08             	sub    $0x8,%esp
+    3096:	68 96 74 00 00       	push   $0x7496
+    309b:	6a 01                	push   $0x1
+    309d:	e8 be 31 00 00       	call   6260 <printf>
+      exit();
+    30a2:	e8 29 2a 00 00       	call   5ad0 <exit>
+    printf(1, "mmap anon lost data\n");
+    30a7:	50                   	push   %eax
+    30a8:	50                   	push   %eax
+    30a9:	68 c5 74 00 00       	push   $0x74c5
+    30ae:	6a 01                	push   $0x1
+    30b0:	e8 ab 31 00 00       	call   6260 <printf>
+    exit();
+    30b5:	e8 16 2a 00 00       	call   5ad0 <exit>
+    printf(1, "munmap private failed\n");
+    30ba:	50                   	push   %eax
+    30bb:	50                   	push   %eax
+    30bc:	68 f5 73 00 00       	push   $0x73f5
+    30c1:	6a 01                	push   $0x1
+    30c3:	e8 98 31 00 00       	call   6260 <printf>
+    exit();
+    30c8:	e8 03 2a 00 00       	call   5ad0 <exit>
+    printf(1, "mmap anon failed\n");
+    30cd:	50                   	push   %eax
+    30ce:	50                   	push   %eax
+    30cf:	68 84 74 00 00       	push   $0x7484
+    30d4:	6a 01                	push   $0x1
+    30d6:	e8 85 31 00 00       	call   6260 <printf>
+    exit();
+    30db:	e8 f0 29 00 00       	call   5ad0 <exit>
+    printf(1, "mmap private failed\n");
+    30e0:	50                   	push   %eax
+    30e1:	50                   	push   %eax
+    30e2:	68 e0 73 00 00       	push   $0x73e0
+    30e7:	6a 01                	push   $0x1
+    30e9:	e8 72 31 00 00       	call   6260 <printf>
+    exit();
+    30ee:	e8 dd 29 00 00       	call   5ad0 <exit>
+    printf(1, "mmap write mmapfile failed\n");
+    30f3:	52                   	push   %edx
+    30f4:	52                   	push   %edx
+    30f5:	68 c4 73 00 00       	push   $0x73c4
+    30fa:	6a 01                	push   $0x1
+    30fc:	e8 5f 31 00 00       	call   6260 <printf>
+    exit();
+    3101:	e8 ca 29 00 00       	call   5ad0 <exit>
+    printf(1, "cannot create mmapfile\n");
+    3106:	51                   	push   %ecx
+    3107:	51                   	push   %ecx
+    3108:	68 ac 73 00 00       	push   $0x73ac
+    310d:	6a 01                	push   $0x1
+    310f:	e8 4c 31 00 00       	call   6260 <printf>
+    exit();
+    3114:	e8 b7 29 00 00       	call   5ad0 <exit>
+    printf(1, "mmap anon syscall args failed\n");
+    3119:	56                   	push   %esi
+    311a:	56                   	push   %esi
+    311b:	68 88 83 00 00       	push   $0x8388
+    3120:	6a 01                	push   $0x1
+    3122:	e8 39 31 00 00       	call   6260 <printf>
+    exit();
+    3127:	e8 a4 29 00 00       	call   5ad0 <exit>
+    printf(1, "munmap anon middle failed\n");
+    312c:	50                   	push   %eax
+    312d:	50                   	push   %eax
+    312e:	68 aa 74 00 00       	push   $0x74aa
+    3133:	6a 01                	push   $0x1
+    3135:	e8 26 31 00 00       	call   6260 <printf>
+    exit();
+    313a:	e8 91 29 00 00       	call   5ad0 <exit>
+    printf(1, "mmap shared not written back\n");
+    313f:	83 ec 08             	sub    $0x8,%esp
+    3142:	68 66 74 00 00       	push   $0x7466
+    3147:	6a 01                	push   $0x1
+    3149:	e8 12 31 00 00       	call   6260 <printf>
+    exit();
+    314e:	e8 7d 29 00 00       	call   5ad0 <exit>
+    printf(1, "munmap shared failed\n");
+    3153:	57                   	push   %edi
+    3154:	57                   	push   %edi
+    3155:	68 50 74 00 00       	push   $0x7450
+    315a:	6a 01                	push   $0x1
+    315c:	e8 ff 30 00 00       	call   6260 <printf>
+    exit();
+    3161:	e8 6a 29 00 00       	call   5ad0 <exit>
+    printf(1, "mmap shared not seen after fork\n");
+    3166:	50                   	push   %eax
+    3167:	50                   	push   %eax
+    3168:	68 38 83 00 00       	push   $0x8338
+    316d:	6a 01                	push   $0x1
+    316f:	e8 ec 30 00 00       	call   6260 <printf>
+    exit();
+    3174:	e8 57 29 00 00       	call   5ad0 <exit>
+    p[2] = 'W';
+    3179:	c6 46 02 57          	movb   $0x57,0x2(%esi)
+    exit();
+    317d:	e8 4e 29 00 00       	call   5ad0 <exit>
+    printf(1, "mmap fork failed\n");
+    3182:	50                   	push   %eax
+    3183:	50                   	push   %eax
+    3184:	68 3e 74 00 00       	push   $0x743e
+    3189:	6a 01                	push   $0x1
+    318b:	e8 d0 30 00 00       	call   6260 <printf>
+    exit();
+    3190:	e8 3b 29 00 00       	call   5ad0 <exit>
+    printf(1, "mmap shared not seen by read\n");
+    3195:	83 ec 08             	sub    $0x8,%esp
+    3198:	68 20 74 00 00       	push   $0x7420
+    319d:	6a 01                	push   $0x1
+    319f:	e8 bc 30 00 00       	call   6260 <printf>
+    exit();
+    31a4:	e8 27 29 00 00       	call   5ad0 <exit>
+    printf(1, "mmap shared failed\n");
+    31a9:	50                   	push   %eax
+    31aa:	50                   	push   %eax
+    31ab:	68 0c 74 00 00       	push   $0x740c
+    31b0:	6a 01                	push   $0x1
+    31b2:	e8 a9 30 00 00       	call   6260 <printf>
+    exit();
+    31b7:	e8 14 29 00 00       	call   5ad0 <exit>
+    printf(1, "mmap writable on read-only fd succeeded\n");
+    31bc:	51                   	push   %ecx
+    31bd:	51                   	push   %ecx
+    31be:	68 5c 83 00 00       	push   $0x835c
+    31c3:	6a 01                	push   $0x1
+    31c5:	e8 96 30 00 00       	call   6260 <printf>
+    exit();
+    31ca:	e8 01 29 00 00       	call   5ad0 <exit>
+    31cf:	90                   	nop
+
+000031d0 <shmtest>:
+{
+    31d0:	55                   	push   %ebp
+    31d1:	89 e5                	mov    %esp,%ebp
+    31d3:	56                   	push   %esi
+    31d4:	53                   	push   %ebx
+  printf(1, "shm test\n");
+    31d5:	83 ec 08             	sub    $0x8,%esp
+    31d8:	68 ec 74 00 00       	push   $0x74ec
+    31dd:	6a 01                	push   $0x1
+    31df:	e8 7c 30 00 00       	call   6260 <printf>
+  id = shmget(4242, 8192);
+    31e4:	58                   	pop    %eax
+    31e5:	5a                   	pop    %edx
+    31e6:	68 00 20 00 00       	push   $0x2000
+    31eb:	68 92 10 00 00       	push   $0x1092
+    31f0:	e8 d3 2b 00 00       	call   5dc8 <shmget>
+  if(id < 0 || (p = shmat(id)) == (char*)-1){
+    31f5:	83 c4 10             	add    $0x10,%esp
+    31f8:	85 c0                	test   %eax,%eax
+    31fa:	0f 88 64 01 00 00    	js     3364 <shmtest+0x194>
+    3200:	83 ec 0c             	sub    $0xc,%esp
+    3203:	89 c6                	mov    %eax,%esi
+    3205:	50                   	push   %eax
+    3206:	e8 c5 2b 00 00       	call   5dd0 <shmat>
+    320b:	83 c4 10             	add    $0x10,%esp
+    320e:	89 c3                	mov    %eax,%ebx
+    3210:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3213:	0f 84 4b 01 00 00    	je     3364 <shmtest+0x194>
+  if(p[0] != 0 || p[8191] != 0){
+    3219:	80 38 00             	cmpb   $0x0,(%eax)
+    321c:	0f 85 2f 01 00 00    	jne    3351 <shmtest+0x181>
+    3222:	80 b8 ff 1f 00 00 00 	cmpb   $0x0,0x1fff(%eax)
+    3229:	0f 85 22 01 00 00    	jne    3351 <shmtest+0x181>
+  p[0] = 'P';
+    322f:	c6 00 50             	movb   $0x50,(%eax)
+  pid = fork();
+    3232:	e8 69 28 00 00       	call   5aa0 <fork>
+  if(pid < 0){
+    3237:	85 c0                	test   %eax,%eax
+    3239:	0f 88 38 01 00 00    	js     3377 <shmtest+0x1a7>
+  if(pid == 0){
+    323f:	75 6f                	jne    32b0 <shmtest+0xe0>
+    if(shmget(4242, 4096) != id || (q = shmat(id)) == (char*)-1 ||
+    3241:	83 ec 08             	sub    $0x8,%esp
+    3244:	68 00 10 00 00       	push   $0x1000
+    3249:	68 92 10 00 00       	push   $0x1092
+    324e:	e8 75 2b 00 00       	call   5dc8 <shmget>
+    3253:	83 c4 10             	add    $0x10,%esp
+    3256:	39 f0                	cmp    %esi,%eax
+    3258:	0f 85 e0 00 00 00    	jne    333e <shmtest+0x16e>
+    325e:	83 ec 0c             	sub    $0xc,%esp
+    3261:	50                   	push   %eax
+    3262:	e8 69 2b 00 00       	call   5dd0 <shmat>
+    3267:	83 c4 10             	add    $0x10,%esp
+    326a:	83 f8 ff             	cmp    $0xffffffff,%eax
+    326d:	0f 84 cb 00 00 00    	je     333e <shmtest+0x16e>
+    3273:	39 c3                	cmp    %eax,%ebx
+    3275:	0f 84 c3 00 00 00    	je     333e <shmtest+0x16e>
+       q == p || q[0] != 'P'){
+    327b:	80 38 50             	cmpb   $0x50,(%eax)
+    327e:	0f 85 ba 00 00 00    	jne    333e <shmtest+0x16e>
+    q[8191] = 'C';
+    3284:	c6 80 ff 1f 00 00 43 	movb   $0x43,0x1fff(%eax)
+    if(p[8191] != 'C'){
+    328b:	80 bb ff 1f 00 00 43 	cmpb   $0x43,0x1fff(%ebx)
+    3292:	0f 84 98 00 00 00    	je     3330 <shmtest+0x160>
+      printf(1, "shm child mappings differ\n");
+    3298:	83 ec 08             	sub    $0x8,%esp
+    329b:	68 2e 75 00 00       	push   $0x752e
+    32a0:	6a 01                	push   $0x1
+    32a2:	e8 b9 2f 00 00       	call   6260 <printf>
+      exit();
+    32a7:	e8 24 28 00 00       	call   5ad0 <exit>
+    32ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  wait();
+    32b0:	e8 33 2a 00 00       	call   5ce8 <wait>
+  if(p[8191] != 'C'){
+    32b5:	80 bb ff 1f 00 00 43 	cmpb   $0x43,0x1fff(%ebx)
+    32bc:	0f 85 ee 00 00 00    	jne    33b0 <shmtest+0x1e0>
+  if(shmdel(id) < 0 || shmat(id) != (char*)-1){
+    32c2:	83 ec 0c             	sub    $0xc,%esp
+    32c5:	56                   	push   %esi
+    32c6:	e8 15 2b 00 00       	call   5de0 <shmdel>
+    32cb:	83 c4 10             	add    $0x10,%esp
+    32ce:	85 c0                	test   %eax,%eax
+    32d0:	0f 88 b4 00 00 00    	js     338a <shmtest+0x1ba>
+    32d6:	83 ec 0c             	sub    $0xc,%esp
+    32d9:	56                   	push   %esi
+    32da:	e8 f1 2a 00 00       	call   5dd0 <shmat>
+    32df:	83 c4 10             	add    $0x10,%esp
+    32e2:	83 f8 ff             	cmp    $0xffffffff,%eax
+    32e5:	0f 85 9f 00 00 00    	jne    338a <shmtest+0x1ba>
+  if(shmdt(p) < 0 || shmdt(p) == 0){
+    32eb:	83 ec 0c             	sub    $0xc,%esp
+  p[1] = 'Q';
+    32ee:	c6 43 01 51          	movb   $0x51,0x1(%ebx)
+  if(shmdt(p) < 0 || shmdt(p) == 0){
+    32f2:	53                   	push   %ebx
+    32f3:	e8 e0 2a 00 00       	call   5dd8 <shmdt>
+    32f8:	83 c4 10             	add    $0x10,%esp
+    32fb:	85 c0                	test   %eax,%eax
+    32fd:	0f 88 9a 00 00 00    	js     339d <shmtest+0x1cd>
+    3303:	83 ec 0c             	sub    $0xc,%esp
+    3306:	53                   	push   %ebx
+    3307:	e8 cc 2a 00 00       	call   5dd8 <shmdt>
+    330c:	83 c4 10             	add    $0x10,%esp
+    330f:	85 c0                	test   %eax,%eax
+    3311:	0f 84 86 00 00 00    	je     339d <shmtest+0x1cd>
+  printf(1, "shm ok\n");
+    3317:	83 ec 08             	sub    $0x8,%esp
+    331a:	68 80 75 00 00       	push   $0x7580
+    331f:	6a 01                	push   $0x1
+    3321:	e8 3a 2f 00 00       	call   6260 <printf>
+}
+    3326:	83 c4 10             	add    $0x10,%esp
+    3329:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    332c:	5b                   	pop    %ebx
+    332d:	5e                   	pop    %esi
+    332e:	5d                   	pop    %ebp
+    332f:	c3                   	ret
+    shmdt(q);
+    3330:	83 ec 0c             	sub    $0xc,%esp
+    3333:	50                   	push   %eax
+    3334:	e8 9f 2a 00 00       	call   5dd8 <shmdt>
+    exit();
+    3339:	e8 92 27 00 00       	call   5ad0 <exit>
+      printf(1, "shm child attach failed\n");
+    333e:	53                   	push   %ebx
+    333f:	53                   	push   %ebx
+    3340:	68 15 75 00 00       	push   $0x7515
+    3345:	6a 01                	push   $0x1
+    3347:	e8 14 2f 00 00       	call   6260 <printf>
+      exit();
+    334c:	e8 7f 27 00 00       	call   5ad0 <exit>
+    printf(1, "shm not zero\n");
+    3351:	50                   	push   %eax
+    3352:	50                   	push   %eax
+    3353:	68 f6 74 00 00       	push   $0x74f6
+    3358:	6a 01                	push   $0x1
+    335a:	e8 01 2f 00 00       	call   6260 <printf>
+    exit();
+    335f:	e8 6c 27 00 00       	call   5ad0 <exit>
+    printf(1, "shmget/shmat failed\n");
+    3364:	50                   	push   %eax
+    3365:	50                   	push   %eax
+    3366:	68 ac 77 00 00       	push   $0x77ac
+    336b:	6a 01                	push   $0x1
+    336d:	e8 ee 2e 00 00       	call   6260 <printf>
+    exit();
+    3372:	e8 59 27 00 00       	call   5ad0 <exit>
+    printf(1, "shm fork failed\n");
+    3377:	56                   	push   %esi
+    3378:	56                   	push   %esi
+    3379:	68 04 75 00 00       	push   $0x7504
+    337e:	6a 01                	push   $0x1
+    3380:	e8 db 2e 00 00       	call   6260 <printf>
+    exit();
+    3385:	e8 46 27 00 00       	call   5ad0 <exit>
+    printf(1, "shmdel failed\n");
+    338a:	52                   	push   %edx
+    338b:	52                   	push   %edx
+    338c:	68 63 75 00 00       	push   $0x7563
+    3391:	6a 01                	push   $0x1
+    3393:	e8 c8 2e 00 00       	call   6260 <printf>
+    exit();
+    3398:	e8 33 27 00 00       	call   5ad0 <exit>
+    printf(1, "shmdt failed\n");
+    339d:	50                   	push   %eax
+    339e:	50                   	push   %eax
+    339f:	68 72 75 00 00       	push   $0x7572
+    33a4:	6a 01                	push   $0x1
+    33a6:	e8 b5 2e 00 00       	call   6260 <printf>
+    exit();
+    33ab:	e8 20 27 00 00       	call   5ad0 <exit>
+    printf(1, "shm child write not seen\n");
+    33b0:	51                   	push   %ecx
+    33b1:	51                   	push   %ecx
+    33b2:	68 49 75 00 00       	push   $0x7549
+    33b7:	6a 01                	push   $0x1
+    33b9:	e8 a2 2e 00 00       	call   6260 <printf>
+    exit();
+    33be:	e8 0d 27 00 00       	call   5ad0 <exit>
+    33c3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    33ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000033d0 <splicetest>:
+{
+    33d0:	55                   	push   %ebp
+    33d1:	89 e5                	mov    %esp,%ebp
+    33d3:	57                   	push   %edi
+    33d4:	56                   	push   %esi
+    33d5:	53                   	push   %ebx
+    buf[i] = 'a' + i % 26;
+    33d6:	bb 4f ec c4 4e       	mov    $0x4ec4ec4f,%ebx
+{
+    33db:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "splice test\n");
+    33de:	68 88 75 00 00       	push   $0x7588
+    33e3:	6a 01                	push   $0x1
+    33e5:	e8 76 2e 00 00       	call   6260 <printf>
+  fd = open("splicein", O_CREATE | O_RDWR);
+    33ea:	5f                   	pop    %edi
+    33eb:	58                   	pop    %eax
+    33ec:	68 02 02 00 00       	push   $0x202
+    33f1:	68 95 75 00 00       	push   $0x7595
+    33f6:	e8 25 29 00 00       	call   5d20 <open>
+    33fb:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 3000; i++)
+    33fe:	31 c9                	xor    %ecx,%ecx
+  fd = open("splicein", O_CREATE | O_RDWR);
+    3400:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 3000; i++)
+    3402:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    buf[i] = 'a' + i % 26;
+    3408:	89 c8                	mov    %ecx,%eax
+    340a:	f7 e3                	mul    %ebx
+    340c:	89 c8                	mov    %ecx,%eax
+  for(i = 0; i < 3000; i++)
+    340e:	83 c1 01             	add    $0x1,%ecx
+    buf[i] = 'a' + i % 26;
+    3411:	c1 ea 03             	shr    $0x3,%edx
+    3414:	6b d2 1a             	imul   $0x1a,%edx,%edx
+    3417:	29 d0                	sub    %edx,%eax
+    3419:	83 c0 61             	add    $0x61,%eax
+    341c:	88 81 5f c9 00 00    	mov    %al,0xc95f(%ecx)
+  for(i = 0; i < 3000; i++)
+    3422:	81 f9 b8 0b 00 00    	cmp    $0xbb8,%ecx
+    3428:	75 de                	jne    3408 <splicetest+0x38>
+  if(fd < 0 || write(fd, buf, 3000) != 3000){
+    342a:	85 f6                	test   %esi,%esi
+    342c:	0f 88 c9 02 00 00    	js     36fb <splicetest+0x32b>
+    3432:	83 ec 04             	sub    $0x4,%esp
+    3435:	68 b8 0b 00 00       	push   $0xbb8
+    343a:	68 60 c9 00 00       	push   $0xc960
+    343f:	56                   	push   %esi
+    3440:	e8 5b 27 00 00       	call   5ba0 <write>
+    3445:	83 c4 10             	add    $0x10,%esp
+    3448:	3d b8 0b 00 00       	cmp    $0xbb8,%eax
+    344d:	0f 85 a8 02 00 00    	jne    36fb <splicetest+0x32b>
+  close(fd);
+    3453:	83 ec 0c             	sub    $0xc,%esp
+    3456:	56                   	push   %esi
+    3457:	e8 c4 27 00 00       	call   5c20 <close>
+  if(pipe(p) < 0 || pipe(q) < 0){
+    345c:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    345f:	89 04 24             	mov    %eax,(%esp)
+    3462:	e8 89 28 00 00       	call   5cf0 <pipe>
+    3467:	83 c4 10             	add    $0x10,%esp
+    346a:	85 c0                	test   %eax,%eax
+    346c:	0f 88 76 02 00 00    	js     36e8 <splicetest+0x318>
+    3472:	83 ec 0c             	sub    $0xc,%esp
+    3475:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    3478:	50                   	push   %eax
+    3479:	e8 72 28 00 00       	call   5cf0 <pipe>
+    347e:	83 c4 10             	add    $0x10,%esp
+    3481:	85 c0                	test   %eax,%eax
+    3483:	0f 88 5f 02 00 00    	js     36e8 <splicetest+0x318>
+  fd = open("splicein", O_RDONLY);
+    3489:	83 ec 08             	sub    $0x8,%esp
+    348c:	6a 00                	push   $0x0
+    348e:	68 95 75 00 00       	push   $0x7595
+    3493:	e8 88 28 00 00       	call   5d20 <open>
+  if(splice(fd, p[1], 1000) != 1000 || splice(fd, p[1], 5000) != 2000 ||
+    3498:	83 c4 0c             	add    $0xc,%esp
+    349b:	68 e8 03 00 00       	push   $0x3e8
+  fd = open("splicein", O_RDONLY);
+    34a0:	89 c6                	mov    %eax,%esi
+  if(splice(fd, p[1], 1000) != 1000 || splice(fd, p[1], 5000) != 2000 ||
+    34a2:	ff 75 dc             	push   -0x24(%ebp)
+    34a5:	50                   	push   %eax
+    34a6:	e8 45 29 00 00       	call   5df0 <splice>
+    34ab:	83 c4 10             	add    $0x10,%esp
+    34ae:	3d e8 03 00 00       	cmp    $0x3e8,%eax
+    34b3:	0f 85 55 02 00 00    	jne    370e <splicetest+0x33e>
+    34b9:	83 ec 04             	sub    $0x4,%esp
+    34bc:	68 88 13 00 00       	push   $0x1388
+    34c1:	ff 75 dc             	push   -0x24(%ebp)
+    34c4:	56                   	push   %esi
+    34c5:	e8 26 29 00 00       	call   5df0 <splice>
+    34ca:	83 c4 10             	add    $0x10,%esp
+    34cd:	3d d0 07 00 00       	cmp    $0x7d0,%eax
+    34d2:	0f 85 36 02 00 00    	jne    370e <splicetest+0x33e>
+     splice(fd, p[1], 10) != 0){
+    34d8:	83 ec 04             	sub    $0x4,%esp
+    34db:	6a 0a                	push   $0xa
+    34dd:	ff 75 dc             	push   -0x24(%ebp)
+    34e0:	56                   	push   %esi
+    34e1:	e8 0a 29 00 00       	call   5df0 <splice>
+  if(splice(fd, p[1], 1000) != 1000 || splice(fd, p[1], 5000) != 2000 ||
+    34e6:	83 c4 10             	add    $0x10,%esp
+     splice(fd, p[1], 10) != 0){
+    34e9:	89 c3                	mov    %eax,%ebx
+  if(splice(fd, p[1], 1000) != 1000 || splice(fd, p[1], 5000) != 2000 ||
+    34eb:	85 c0                	test   %eax,%eax
+    34ed:	0f 85 1b 02 00 00    	jne    370e <splicetest+0x33e>
+  close(fd);
+    34f3:	83 ec 0c             	sub    $0xc,%esp
+    34f6:	56                   	push   %esi
+    34f7:	e8 24 27 00 00       	call   5c20 <close>
+  if(splice(p[0], q[0], 10) != -1){
+    34fc:	83 c4 0c             	add    $0xc,%esp
+    34ff:	6a 0a                	push   $0xa
+    3501:	ff 75 e0             	push   -0x20(%ebp)
+    3504:	ff 75 d8             	push   -0x28(%ebp)
+    3507:	e8 e4 28 00 00       	call   5df0 <splice>
+    350c:	83 c4 10             	add    $0x10,%esp
+    350f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3512:	0f 85 96 01 00 00    	jne    36ae <splicetest+0x2de>
+  if(tee(p[0], q[1], 100) != 100 || read(q[0], buf, sizeof(buf)) != 100 ||
+    3518:	83 ec 04             	sub    $0x4,%esp
+    351b:	6a 64                	push   $0x64
+    351d:	ff 75 e4             	push   -0x1c(%ebp)
+    3520:	ff 75 d8             	push   -0x28(%ebp)
+    3523:	e8 d0 28 00 00       	call   5df8 <tee>
+    3528:	83 c4 10             	add    $0x10,%esp
+    352b:	83 f8 64             	cmp    $0x64,%eax
+    352e:	0f 85 a0 01 00 00    	jne    36d4 <splicetest+0x304>
+    3534:	83 ec 04             	sub    $0x4,%esp
+    3537:	68 00 20 00 00       	push   $0x2000
+    353c:	68 60 c9 00 00       	push   $0xc960
+    3541:	ff 75 e0             	push   -0x20(%ebp)
+    3544:	e8 d7 25 00 00       	call   5b20 <read>
+    3549:	83 c4 10             	add    $0x10,%esp
+    354c:	83 f8 64             	cmp    $0x64,%eax
+    354f:	0f 85 7f 01 00 00    	jne    36d4 <splicetest+0x304>
+    3555:	80 3d 60 c9 00 00 61 	cmpb   $0x61,0xc960
+    355c:	0f 85 72 01 00 00    	jne    36d4 <splicetest+0x304>
+     buf[0] != 'a' || buf[99] != 'a' + 99 % 26){
+    3562:	80 3d c3 c9 00 00 76 	cmpb   $0x76,0xc9c3
+    3569:	0f 85 65 01 00 00    	jne    36d4 <splicetest+0x304>
+  fd = open("spliceout", O_CREATE | O_RDWR);
+    356f:	83 ec 08             	sub    $0x8,%esp
+  for(n = 0; n < 3000; ){
+    3572:	31 ff                	xor    %edi,%edi
+  fd = open("spliceout", O_CREATE | O_RDWR);
+    3574:	68 02 02 00 00       	push   $0x202
+    3579:	68 f0 75 00 00       	push   $0x75f0
+    357e:	e8 9d 27 00 00       	call   5d20 <open>
+    3583:	83 c4 10             	add    $0x10,%esp
+    3586:	89 c6                	mov    %eax,%esi
+  for(n = 0; n < 3000; ){
+    3588:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    358f:	90                   	nop
+    i = splice(p[0], fd, 3000 - n);
+    3590:	b8 b8 0b 00 00       	mov    $0xbb8,%eax
+    3595:	83 ec 04             	sub    $0x4,%esp
+    3598:	29 f8                	sub    %edi,%eax
+    359a:	50                   	push   %eax
+    359b:	56                   	push   %esi
+    359c:	ff 75 d8             	push   -0x28(%ebp)
+    359f:	e8 4c 28 00 00       	call   5df0 <splice>
+    if(i <= 0){
+    35a4:	83 c4 10             	add    $0x10,%esp
+    35a7:	85 c0                	test   %eax,%eax
+    35a9:	0f 8e eb 00 00 00    	jle    369a <splicetest+0x2ca>
+    n += i;
+    35af:	01 c7                	add    %eax,%edi
+  for(n = 0; n < 3000; ){
+    35b1:	81 ff b7 0b 00 00    	cmp    $0xbb7,%edi
+    35b7:	7e d7                	jle    3590 <splicetest+0x1c0>
+  close(fd);
+    35b9:	83 ec 0c             	sub    $0xc,%esp
+    35bc:	56                   	push   %esi
+    35bd:	e8 5e 26 00 00       	call   5c20 <close>
+  fd = open("spliceout", O_RDONLY);
+    35c2:	58                   	pop    %eax
+    35c3:	5a                   	pop    %edx
+    35c4:	6a 00                	push   $0x0
+    35c6:	68 f0 75 00 00       	push   $0x75f0
+    35cb:	e8 50 27 00 00       	call   5d20 <open>
+  if(read(fd, buf, sizeof(buf)) != 3000){
+    35d0:	83 c4 0c             	add    $0xc,%esp
+    35d3:	68 00 20 00 00       	push   $0x2000
+  fd = open("spliceout", O_RDONLY);
+    35d8:	89 c7                	mov    %eax,%edi
+  if(read(fd, buf, sizeof(buf)) != 3000){
+    35da:	68 60 c9 00 00       	push   $0xc960
+    35df:	50                   	push   %eax
+    35e0:	e8 3b 25 00 00       	call   5b20 <read>
+    35e5:	83 c4 10             	add    $0x10,%esp
+    35e8:	3d b8 0b 00 00       	cmp    $0xbb8,%eax
+    35ed:	0f 85 ce 00 00 00    	jne    36c1 <splicetest+0x2f1>
+    if(buf[i] != 'a' + i % 26){
+    35f3:	be 4f ec c4 4e       	mov    $0x4ec4ec4f,%esi
+    35f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    35ff:	90                   	nop
+    3600:	89 d8                	mov    %ebx,%eax
+    3602:	0f be 8b 60 c9 00 00 	movsbl 0xc960(%ebx),%ecx
+    3609:	f7 e6                	mul    %esi
+    360b:	89 d8                	mov    %ebx,%eax
+    360d:	c1 ea 03             	shr    $0x3,%edx
+    3610:	6b d2 1a             	imul   $0x1a,%edx,%edx
+    3613:	29 d0                	sub    %edx,%eax
+    3615:	83 c0 61             	add    $0x61,%eax
+    3618:	39 c1                	cmp    %eax,%ecx
+    361a:	75 69                	jne    3685 <splicetest+0x2b5>
+  for(i = 0; i < 3000; i++){
+    361c:	83 c3 01             	add    $0x1,%ebx
+    361f:	81 fb b8 0b 00 00    	cmp    $0xbb8,%ebx
+    3625:	75 d9                	jne    3600 <splicetest+0x230>
+  close(fd);
+    3627:	83 ec 0c             	sub    $0xc,%esp
+    362a:	57                   	push   %edi
+    362b:	e8 f0 25 00 00       	call   5c20 <close>
+  close(p[0]);
+    3630:	58                   	pop    %eax
+    3631:	ff 75 d8             	push   -0x28(%ebp)
+    3634:	e8 e7 25 00 00       	call   5c20 <close>
+  close(p[1]);
+    3639:	5a                   	pop    %edx
+    363a:	ff 75 dc             	push   -0x24(%ebp)
+    363d:	e8 de 25 00 00       	call   5c20 <close>
+  close(q[0]);
+    3642:	59                   	pop    %ecx
+    3643:	ff 75 e0             	push   -0x20(%ebp)
+    3646:	e8 d5 25 00 00       	call   5c20 <close>
+  close(q[1]);
+    364b:	5b                   	pop    %ebx
+    364c:	ff 75 e4             	push   -0x1c(%ebp)
+    364f:	e8 cc 25 00 00       	call   5c20 <close>
+  unlink("splicein");
+    3654:	c7 04 24 95 75 00 00 	movl   $0x7595,(%esp)
+    365b:	e8 d0 26 00 00       	call   5d30 <unlink>
+  unlink("spliceout");
+    3660:	c7 04 24 f0 75 00 00 	movl   $0x75f0,(%esp)
+    3667:	e8 c4 26 00 00       	call   5d30 <unlink>
+  printf(1, "splice ok\n");
+    366c:	5e                   	pop    %esi
+    366d:	5f                   	pop    %edi
+    366e:	68 42 76 00 00       	push   $0x7642
+    3673:	6a 01                	push   $0x1
+    3675:	e8 e6 2b 00 00       	call   6260 <printf>
+}
+    367a:	83 c4 10             	add    $0x10,%esp
+    367d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3680:	5b                   	pop    %ebx
+    3681:	5e                   	pop    %esi
+    3682:	5f                   	pop    %edi
+    3683:	5d                   	pop    %ebp
+    3684:	c3                   	ret
+      printf(1, "splice wrong data at %d\n", i);
+    3685:	83 ec 04             	sub    $0x4,%esp
+    3688:	53                   	push   %ebx
+    3689:	68 29 76 00 00       	push   $0x7629
+    368e:	6a 01                	push   $0x1
+    3690:	e8 cb 2b 00 00       	call   6260 <printf>
+      exit();
+    3695:	e8 36 24 00 00       	call   5ad0 <exit>
+      printf(1, "splice pipe to file failed\n");
+    369a:	83 ec 08             	sub    $0x8,%esp
+    369d:	68 fa 75 00 00       	push   $0x75fa
+    36a2:	6a 01                	push   $0x1
+    36a4:	e8 b7 2b 00 00       	call   6260 <printf>
+      exit();
+    36a9:	e8 22 24 00 00       	call   5ad0 <exit>
+    printf(1, "splice pipe to pipe succeeded\n");
+    36ae:	51                   	push   %ecx
+    36af:	51                   	push   %ecx
+    36b0:	68 a8 83 00 00       	push   $0x83a8
+    36b5:	6a 01                	push   $0x1
+    36b7:	e8 a4 2b 00 00       	call   6260 <printf>
+    exit();
+    36bc:	e8 0f 24 00 00       	call   5ad0 <exit>
+    printf(1, "splice wrong size\n");
+    36c1:	50                   	push   %eax
+    36c2:	50                   	push   %eax
+    36c3:	68 16 76 00 00       	push   $0x7616
+    36c8:	6a 01                	push   $0x1
+    36ca:	e8 91 2b 00 00       	call   6260 <printf>
+    exit();
+    36cf:	e8 fc 23 00 00       	call   5ad0 <exit>
+    printf(1, "tee failed\n");
+    36d4:	83 ec 08             	sub    $0x8,%esp
+    36d7:	68 e4 75 00 00       	push   $0x75e4
+    36dc:	6a 01                	push   $0x1
+    36de:	e8 7d 2b 00 00       	call   6260 <printf>
+    exit();
+    36e3:	e8 e8 23 00 00       	call   5ad0 <exit>
+    printf(1, "splice pipe failed\n");
+    36e8:	53                   	push   %ebx
+    36e9:	53                   	push   %ebx
+    36ea:	68 b4 75 00 00       	push   $0x75b4
+    36ef:	6a 01                	push   $0x1
+    36f1:	e8 6a 2b 00 00       	call   6260 <printf>
+    exit();
+    36f6:	e8 d5 23 00 00       	call   5ad0 <exit>
+    printf(1, "splice create failed\n");
+    36fb:	56                   	push   %esi
+    36fc:	56                   	push   %esi
+    36fd:	68 9e 75 00 00       	push   $0x759e
+    3702:	6a 01                	push   $0x1
+    3704:	e8 57 2b 00 00       	call   6260 <printf>
+    exit();
+    3709:	e8 c2 23 00 00       	call   5ad0 <exit>
+    printf(1, "splice file to pipe failed\n");
+    370e:	83 ec 08             	sub    $0x8,%esp
+    3711:	68 c8 75 00 00       	push   $0x75c8
+    3716:	6a 01                	push   $0x1
+    3718:	e8 43 2b 00 00       	call   6260 <printf>
+    exit();
+    371d:	e8 ae 23 00 00       	call   5ad0 <exit>
+    3722:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3729:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00003730 <sendfiletest>:
+{
+    3730:	55                   	push   %ebp
+    3731:	89 e5                	mov    %esp,%ebp
+    3733:	57                   	push   %edi
+    3734:	56                   	push   %esi
+    3735:	53                   	push   %ebx
+    3736:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "sendfile test\n");
+    3739:	68 4d 76 00 00       	push   $0x764d
+    373e:	6a 01                	push   $0x1
+    3740:	e8 1b 2b 00 00       	call   6260 <printf>
+  in = open("sendin", O_CREATE | O_RDWR);
+    3745:	58                   	pop    %eax
+    3746:	5a                   	pop    %edx
+    3747:	68 02 02 00 00       	push   $0x202
+    374c:	68 5c 76 00 00       	push   $0x765c
+    3751:	e8 ca 25 00 00       	call   5d20 <open>
+  if(in < 0){
+    3756:	83 c4 10             	add    $0x10,%esp
+    3759:	85 c0                	test   %eax,%eax
+    375b:	0f 88 8a 02 00 00    	js     39eb <sendfiletest+0x2bb>
+      buf[i] = (off + i) % 253;
+    3761:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(off = 0; off < 20000; off += 1000){
+    3764:	31 f6                	xor    %esi,%esi
+      buf[i] = (off + i) % 253;
+    3766:	bf a9 8d 84 81       	mov    $0x81848da9,%edi
+    376b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    376f:	90                   	nop
+    for(i = 0; i < 1000; i++)
+    3770:	31 c9                	xor    %ecx,%ecx
+    3772:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      buf[i] = (off + i) % 253;
+    3778:	8d 1c 0e             	lea    (%esi,%ecx,1),%ebx
+    for(i = 0; i < 1000; i++)
+    377b:	83 c1 01             	add    $0x1,%ecx
+      buf[i] = (off + i) % 253;
+    377e:	89 d8                	mov    %ebx,%eax
+    3780:	f7 e7                	mul    %edi
+    3782:	c1 ea 07             	shr    $0x7,%edx
+    3785:	69 d2 fd 00 00 00    	imul   $0xfd,%edx,%edx
+    378b:	29 d3                	sub    %edx,%ebx
+    378d:	88 99 5f c9 00 00    	mov    %bl,0xc95f(%ecx)
+    for(i = 0; i < 1000; i++)
+    3793:	81 f9 e8 03 00 00    	cmp    $0x3e8,%ecx
+    3799:	75 dd                	jne    3778 <sendfiletest+0x48>
+    if(write(in, buf, 1000) != 1000){
+    379b:	83 ec 04             	sub    $0x4,%esp
+    379e:	68 e8 03 00 00       	push   $0x3e8
+    37a3:	68 60 c9 00 00       	push   $0xc960
+    37a8:	ff 75 e4             	push   -0x1c(%ebp)
+    37ab:	e8 f0 23 00 00       	call   5ba0 <write>
+    37b0:	83 c4 10             	add    $0x10,%esp
+    37b3:	3d e8 03 00 00       	cmp    $0x3e8,%eax
+    37b8:	0f 85 19 02 00 00    	jne    39d7 <sendfiletest+0x2a7>
+  for(off = 0; off < 20000; off += 1000){
+    37be:	81 c6 e8 03 00 00    	add    $0x3e8,%esi
+    37c4:	81 fe 20 4e 00 00    	cmp    $0x4e20,%esi
+    37ca:	75 a4                	jne    3770 <sendfiletest+0x40>
+    37cc:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  close(in);
+    37cf:	83 ec 0c             	sub    $0xc,%esp
+    37d2:	52                   	push   %edx
+    37d3:	e8 48 24 00 00       	call   5c20 <close>
+  in = open("sendin", O_RDONLY);
+    37d8:	5b                   	pop    %ebx
+    37d9:	5e                   	pop    %esi
+    37da:	6a 00                	push   $0x0
+    37dc:	68 5c 76 00 00       	push   $0x765c
+    37e1:	e8 3a 25 00 00       	call   5d20 <open>
+  out = open("sendout", O_CREATE | O_RDWR);
+    37e6:	5f                   	pop    %edi
+  in = open("sendin", O_RDONLY);
+    37e7:	89 c6                	mov    %eax,%esi
+  out = open("sendout", O_CREATE | O_RDWR);
+    37e9:	58                   	pop    %eax
+    37ea:	68 02 02 00 00       	push   $0x202
+    37ef:	68 92 76 00 00       	push   $0x7692
+    37f4:	e8 27 25 00 00       	call   5d20 <open>
+  if(read(in, buf, 100) != 100 || sendfile(out, in, 15000) != 15000 ||
+    37f9:	83 c4 0c             	add    $0xc,%esp
+    37fc:	6a 64                	push   $0x64
+  out = open("sendout", O_CREATE | O_RDWR);
+    37fe:	89 c3                	mov    %eax,%ebx
+  if(read(in, buf, 100) != 100 || sendfile(out, in, 15000) != 15000 ||
+    3800:	68 60 c9 00 00       	push   $0xc960
+    3805:	56                   	push   %esi
+    3806:	e8 15 23 00 00       	call   5b20 <read>
+    380b:	83 c4 10             	add    $0x10,%esp
+    380e:	83 f8 64             	cmp    $0x64,%eax
+    3811:	0f 85 ac 01 00 00    	jne    39c3 <sendfiletest+0x293>
+    3817:	83 ec 04             	sub    $0x4,%esp
+    381a:	68 98 3a 00 00       	push   $0x3a98
+    381f:	56                   	push   %esi
+    3820:	53                   	push   %ebx
+    3821:	e8 da 25 00 00       	call   5e00 <sendfile>
+    3826:	83 c4 10             	add    $0x10,%esp
+    3829:	3d 98 3a 00 00       	cmp    $0x3a98,%eax
+    382e:	0f 85 8f 01 00 00    	jne    39c3 <sendfiletest+0x293>
+     sendfile(out, in, 10000) != 4900 || sendfile(out, in, 10) != 0){
+    3834:	83 ec 04             	sub    $0x4,%esp
+    3837:	68 10 27 00 00       	push   $0x2710
+    383c:	56                   	push   %esi
+    383d:	53                   	push   %ebx
+    383e:	e8 bd 25 00 00       	call   5e00 <sendfile>
+  if(read(in, buf, 100) != 100 || sendfile(out, in, 15000) != 15000 ||
+    3843:	83 c4 10             	add    $0x10,%esp
+    3846:	3d 24 13 00 00       	cmp    $0x1324,%eax
+    384b:	0f 85 72 01 00 00    	jne    39c3 <sendfiletest+0x293>
+     sendfile(out, in, 10000) != 4900 || sendfile(out, in, 10) != 0){
+    3851:	83 ec 04             	sub    $0x4,%esp
+    3854:	6a 0a                	push   $0xa
+    3856:	56                   	push   %esi
+    3857:	53                   	push   %ebx
+    3858:	e8 a3 25 00 00       	call   5e00 <sendfile>
+    385d:	83 c4 10             	add    $0x10,%esp
+    3860:	85 c0                	test   %eax,%eax
+    3862:	0f 85 5b 01 00 00    	jne    39c3 <sendfiletest+0x293>
+  if(sendfile(in, out, 10) != -1){
+    3868:	83 ec 04             	sub    $0x4,%esp
+    386b:	6a 0a                	push   $0xa
+    386d:	53                   	push   %ebx
+    386e:	56                   	push   %esi
+    386f:	e8 8c 25 00 00       	call   5e00 <sendfile>
+    3874:	83 c4 10             	add    $0x10,%esp
+    3877:	83 f8 ff             	cmp    $0xffffffff,%eax
+    387a:	0f 85 30 01 00 00    	jne    39b0 <sendfiletest+0x280>
+  close(in);
+    3880:	83 ec 0c             	sub    $0xc,%esp
+    3883:	56                   	push   %esi
+    3884:	e8 97 23 00 00       	call   5c20 <close>
+  in = open("sendout", O_RDONLY);
+    3889:	58                   	pop    %eax
+    388a:	5a                   	pop    %edx
+    388b:	6a 00                	push   $0x0
+    388d:	68 92 76 00 00       	push   $0x7692
+    3892:	e8 89 24 00 00       	call   5d20 <open>
+  if(sendfile(out, in, 10) != -1){
+    3897:	83 c4 0c             	add    $0xc,%esp
+    389a:	6a 0a                	push   $0xa
+  in = open("sendout", O_RDONLY);
+    389c:	89 c6                	mov    %eax,%esi
+  if(sendfile(out, in, 10) != -1){
+    389e:	50                   	push   %eax
+    389f:	53                   	push   %ebx
+    38a0:	e8 5b 25 00 00       	call   5e00 <sendfile>
+    38a5:	83 c4 10             	add    $0x10,%esp
+    38a8:	83 f8 ff             	cmp    $0xffffffff,%eax
+    38ab:	0f 85 ec 00 00 00    	jne    399d <sendfiletest+0x26d>
+  close(in);
+    38b1:	83 ec 0c             	sub    $0xc,%esp
+    38b4:	56                   	push   %esi
+    38b5:	e8 66 23 00 00       	call   5c20 <close>
+  close(out);
+    38ba:	89 1c 24             	mov    %ebx,(%esp)
+    38bd:	e8 5e 23 00 00       	call   5c20 <close>
+  out = open("sendout", O_RDONLY);
+    38c2:	5b                   	pop    %ebx
+    38c3:	5e                   	pop    %esi
+    38c4:	6a 00                	push   $0x0
+    38c6:	68 92 76 00 00       	push   $0x7692
+  for(off = 0; (n = read(out, buf, 1000)) > 0; off += n){
+    38cb:	31 db                	xor    %ebx,%ebx
+  out = open("sendout", O_RDONLY);
+    38cd:	e8 4e 24 00 00       	call   5d20 <open>
+  for(off = 0; (n = read(out, buf, 1000)) > 0; off += n){
+    38d2:	83 c4 10             	add    $0x10,%esp
+    38d5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    38d8:	83 ec 04             	sub    $0x4,%esp
+    38db:	68 e8 03 00 00       	push   $0x3e8
+    38e0:	68 60 c9 00 00       	push   $0xc960
+    38e5:	ff 75 e0             	push   -0x20(%ebp)
+    38e8:	e8 33 22 00 00       	call   5b20 <read>
+    38ed:	83 c4 10             	add    $0x10,%esp
+    38f0:	89 c7                	mov    %eax,%edi
+    38f2:	85 c0                	test   %eax,%eax
+    38f4:	7e 35                	jle    392b <sendfiletest+0x1fb>
+    38f6:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+    for(i = 0; i < n; i++){
+    38f9:	31 c9                	xor    %ecx,%ecx
+    38fb:	8d 73 64             	lea    0x64(%ebx),%esi
+    38fe:	66 90                	xchg   %ax,%ax
+      if(buf[i] != (char)((100 + off + i) % 253)){
+    3900:	8d 1c 0e             	lea    (%esi,%ecx,1),%ebx
+    3903:	b8 a9 8d 84 81       	mov    $0x81848da9,%eax
+    3908:	f7 e3                	mul    %ebx
+    390a:	c1 ea 07             	shr    $0x7,%edx
+    390d:	69 d2 fd 00 00 00    	imul   $0xfd,%edx,%edx
+    3913:	29 d3                	sub    %edx,%ebx
+    3915:	38 99 60 c9 00 00    	cmp    %bl,0xc960(%ecx)
+    391b:	75 53                	jne    3970 <sendfiletest+0x240>
+    for(i = 0; i < n; i++){
+    391d:	83 c1 01             	add    $0x1,%ecx
+    3920:	39 cf                	cmp    %ecx,%edi
+    3922:	75 dc                	jne    3900 <sendfiletest+0x1d0>
+  for(off = 0; (n = read(out, buf, 1000)) > 0; off += n){
+    3924:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+    3927:	01 fb                	add    %edi,%ebx
+    3929:	eb ad                	jmp    38d8 <sendfiletest+0x1a8>
+  if(off != 19900){
+    392b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+    392e:	81 fb bc 4d 00 00    	cmp    $0x4dbc,%ebx
+    3934:	75 54                	jne    398a <sendfiletest+0x25a>
+  close(out);
+    3936:	83 ec 0c             	sub    $0xc,%esp
+    3939:	52                   	push   %edx
+    393a:	e8 e1 22 00 00       	call   5c20 <close>
+  unlink("sendin");
+    393f:	c7 04 24 5c 76 00 00 	movl   $0x765c,(%esp)
+    3946:	e8 e5 23 00 00       	call   5d30 <unlink>
+  unlink("sendout");
+    394b:	c7 04 24 92 76 00 00 	movl   $0x7692,(%esp)
+    3952:	e8 d9 23 00 00       	call   5d30 <unlink>
+  printf(1, "sendfile ok\n");
+    3957:	58                   	pop    %eax
+    3958:	5a                   	pop    %edx
+    3959:	68 eb 76 00 00       	push   $0x76eb
+    395e:	6a 01                	push   $0x1
+    3960:	e8 fb 28 00 00       	call   6260 <printf>
+}
+    3965:	83 c4 10             	add    $0x10,%esp
+    3968:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    396b:	5b                   	pop    %ebx
+    396c:	5e                   	pop    %esi
+    396d:	5f                   	pop    %edi
+    396e:	5d                   	pop    %ebp
+    396f:	c3                   	ret
+        printf(1, "sendfile wrong data at %d\n", off + i);
+    3970:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+    3973:	83 ec 04             	sub    $0x4,%esp
+    3976:	01 d9                	add    %ebx,%ecx
+    3978:	51                   	push   %ecx
+    3979:	68 b8 76 00 00       	push   $0x76b8
+    397e:	6a 01                	push   $0x1
+    3980:	e8 db 28 00 00       	call   6260 <printf>
+        exit();
+    3985:	e8 46 21 00 00       	call   5ad0 <exit>
+    printf(1, "sendfile wrong size %d\n", off);
+    398a:	51                   	push   %ecx
+    398b:	53                   	push   %ebx
+    398c:	68 d3 76 00 00       	push   $0x76d3
+    3991:	6a 01                	push   $0x1
+    3993:	e8 c8 28 00 00       	call   6260 <printf>
+    exit();
+    3998:	e8 33 21 00 00       	call   5ad0 <exit>
+    printf(1, "sendfile of a file onto itself succeeded\n");
+    399d:	57                   	push   %edi
+    399e:	57                   	push   %edi
+    399f:	68 f0 83 00 00       	push   $0x83f0
+    39a4:	6a 01                	push   $0x1
+    39a6:	e8 b5 28 00 00       	call   6260 <printf>
+    exit();
+    39ab:	e8 20 21 00 00       	call   5ad0 <exit>
+    printf(1, "sendfile to read-only file succeeded\n");
+    39b0:	51                   	push   %ecx
+    39b1:	51                   	push   %ecx
+    39b2:	68 c8 83 00 00       	push   $0x83c8
+    39b7:	6a 01                	push   $0x1
+    39b9:	e8 a2 28 00 00       	call   6260 <printf>
+    exit();
+    39be:	e8 0d 21 00 00       	call   5ad0 <exit>
+    printf(1, "sendfile file to file failed\n");
+    39c3:	83 ec 08             	sub    $0x8,%esp
+    39c6:	68 9a 76 00 00       	push   $0x769a
+    39cb:	6a 01                	push   $0x1
+    39cd:	e8 8e 28 00 00       	call   6260 <printf>
+    exit();
+    39d2:	e8 f9 20 00 00       	call   5ad0 <exit>
+      printf(1, "sendfile write failed\n");
+    39d7:	83 ec 08             	sub    $0x8,%esp
+    39da:	68 7b 76 00 00       	push   $0x767b
+    39df:	6a 01                	push   $0x1
+    39e1:	e8 7a 28 00 00       	call   6260 <printf>
+      exit();
+    39e6:	e8 e5 20 00 00       	call   5ad0 <exit>
+    printf(1, "sendfile create failed\n");
+    39eb:	50                   	push   %eax
+    39ec:	50                   	push   %eax
+    39ed:	68 63 76 00 00       	push   $0x7663
+    39f2:	6a 01                	push   $0x1
+    39f4:	e8 67 28 00 00       	call   6260 <printf>
+    exit();
+    39f9:	e8 d2 20 00 00       	call   5ad0 <exit>
+    39fe:	66 90                	xchg   %ax,%ax
+
+00003a00 <iovtest>:
+{
+    3a00:	55                   	push   %ebp
+    3a01:	89 e5                	mov    %esp,%ebp
+    3a03:	57                   	push   %edi
+    3a04:	56                   	push   %esi
+    3a05:	8d bd 18 f8 ff ff    	lea    -0x7e8(%ebp),%edi
+    body[i] = 'a' + i % 26;
+    3a0b:	be 4f ec c4 4e       	mov    $0x4ec4ec4f,%esi
+{
+    3a10:	53                   	push   %ebx
+  for(i = 0; i < sizeof(body); i++)
+    3a11:	31 db                	xor    %ebx,%ebx
+{
+    3a13:	81 ec 24 08 00 00    	sub    $0x824,%esp
+  printf(1, "iov test\n");
+    3a19:	68 f8 76 00 00       	push   $0x76f8
+    3a1e:	6a 01                	push   $0x1
+    3a20:	e8 3b 28 00 00       	call   6260 <printf>
+    3a25:	83 c4 10             	add    $0x10,%esp
+    3a28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3a2f:	90                   	nop
+    body[i] = 'a' + i % 26;
+    3a30:	89 d8                	mov    %ebx,%eax
+    3a32:	f7 e6                	mul    %esi
+    3a34:	89 d8                	mov    %ebx,%eax
+    3a36:	c1 ea 03             	shr    $0x3,%edx
+    3a39:	6b d2 1a             	imul   $0x1a,%edx,%edx
+    3a3c:	29 d0                	sub    %edx,%eax
+    3a3e:	83 c0 61             	add    $0x61,%eax
+    3a41:	88 04 1f             	mov    %al,(%edi,%ebx,1)
+  for(i = 0; i < sizeof(body); i++)
+    3a44:	83 c3 01             	add    $0x1,%ebx
+    3a47:	81 fb d0 07 00 00    	cmp    $0x7d0,%ebx
+    3a4d:	75 e1                	jne    3a30 <iovtest+0x30>
+  fd = open("iovfile", O_CREATE | O_RDWR);
+    3a4f:	83 ec 08             	sub    $0x8,%esp
+  iov[1].iov_base = body;
+    3a52:	89 bd 08 f8 ff ff    	mov    %edi,-0x7f8(%ebp)
+  iov[0].iov_base = "header\n";
+    3a58:	c7 85 00 f8 ff ff 02 	movl   $0x7702,-0x800(%ebp)
+    3a5f:	77 00 00 
+  iov[0].iov_len = 7;
+    3a62:	c7 85 04 f8 ff ff 07 	movl   $0x7,-0x7fc(%ebp)
+    3a69:	00 00 00 
+  iov[1].iov_len = sizeof(body);
+    3a6c:	c7 85 0c f8 ff ff d0 	movl   $0x7d0,-0x7f4(%ebp)
+    3a73:	07 00 00 
+  iov[2].iov_base = "end\n";
+    3a76:	c7 85 10 f8 ff ff 0a 	movl   $0x770a,-0x7f0(%ebp)
+    3a7d:	77 00 00 
+  iov[2].iov_len = 4;
+    3a80:	c7 85 14 f8 ff ff 04 	movl   $0x4,-0x7ec(%ebp)
+    3a87:	00 00 00 
+  fd = open("iovfile", O_CREATE | O_RDWR);
+    3a8a:	68 02 02 00 00       	push   $0x202
+    3a8f:	68 0f 77 00 00       	push   $0x770f
+    3a94:	e8 87 22 00 00       	call   5d20 <open>
+  if(fd < 0 || writev(fd, iov, 3) != 2011){
+    3a99:	83 c4 10             	add    $0x10,%esp
+  fd = open("iovfile", O_CREATE | O_RDWR);
+    3a9c:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || writev(fd, iov, 3) != 2011){
+    3a9e:	85 c0                	test   %eax,%eax
+    3aa0:	0f 88 16 02 00 00    	js     3cbc <iovtest+0x2bc>
+    3aa6:	83 ec 04             	sub    $0x4,%esp
+    3aa9:	8d 9d 00 f8 ff ff    	lea    -0x800(%ebp),%ebx
+    3aaf:	6a 03                	push   $0x3
+    3ab1:	53                   	push   %ebx
+    3ab2:	50                   	push   %eax
+    3ab3:	e8 28 21 00 00       	call   5be0 <writev>
+    3ab8:	83 c4 10             	add    $0x10,%esp
+    3abb:	3d db 07 00 00       	cmp    $0x7db,%eax
+    3ac0:	0f 85 f6 01 00 00    	jne    3cbc <iovtest+0x2bc>
+  close(fd);
+    3ac6:	83 ec 0c             	sub    $0xc,%esp
+    3ac9:	56                   	push   %esi
+    3aca:	e8 51 21 00 00       	call   5c20 <close>
+  fd = open("iovfile", O_RDONLY);
+    3acf:	5e                   	pop    %esi
+    3ad0:	58                   	pop    %eax
+    3ad1:	6a 00                	push   $0x0
+    3ad3:	68 0f 77 00 00       	push   $0x770f
+  iov[0].iov_base = hdr;
+    3ad8:	8d b5 f8 f7 ff ff    	lea    -0x808(%ebp),%esi
+  fd = open("iovfile", O_RDONLY);
+    3ade:	e8 3d 22 00 00       	call   5d20 <open>
+  if(readv(fd, iov, 2) != 2011 || memcmp(hdr, "header\n", 7) != 0 ||
+    3ae3:	83 c4 0c             	add    $0xc,%esp
+  iov[0].iov_base = hdr;
+    3ae6:	89 b5 00 f8 ff ff    	mov    %esi,-0x800(%ebp)
+  fd = open("iovfile", O_RDONLY);
+    3aec:	89 85 e4 f7 ff ff    	mov    %eax,-0x81c(%ebp)
+  iov[1].iov_base = buf;
+    3af2:	c7 85 08 f8 ff ff 60 	movl   $0xc960,-0x7f8(%ebp)
+    3af9:	c9 00 00 
+  iov[1].iov_len = sizeof(buf);
+    3afc:	c7 85 0c f8 ff ff 00 	movl   $0x2000,-0x7f4(%ebp)
+    3b03:	20 00 00 
+  if(readv(fd, iov, 2) != 2011 || memcmp(hdr, "header\n", 7) != 0 ||
+    3b06:	6a 02                	push   $0x2
+    3b08:	53                   	push   %ebx
+    3b09:	50                   	push   %eax
+    3b0a:	e8 51 20 00 00       	call   5b60 <readv>
+    3b0f:	83 c4 10             	add    $0x10,%esp
+    3b12:	3d db 07 00 00       	cmp    $0x7db,%eax
+    3b17:	0f 85 ff 01 00 00    	jne    3d1c <iovtest+0x31c>
+    3b1d:	83 ec 04             	sub    $0x4,%esp
+    3b20:	6a 07                	push   $0x7
+    3b22:	68 02 77 00 00       	push   $0x7702
+    3b27:	56                   	push   %esi
+    3b28:	e8 b3 1d 00 00       	call   58e0 <memcmp>
+    3b2d:	83 c4 10             	add    $0x10,%esp
+    3b30:	85 c0                	test   %eax,%eax
+    3b32:	0f 85 e4 01 00 00    	jne    3d1c <iovtest+0x31c>
+     memcmp(buf, body, sizeof(body)) != 0 || memcmp(buf + sizeof(body), "end\n", 4) != 0){
+    3b38:	83 ec 04             	sub    $0x4,%esp
+    3b3b:	68 d0 07 00 00       	push   $0x7d0
+    3b40:	57                   	push   %edi
+    3b41:	68 60 c9 00 00       	push   $0xc960
+    3b46:	e8 95 1d 00 00       	call   58e0 <memcmp>
+  if(readv(fd, iov, 2) != 2011 || memcmp(hdr, "header\n", 7) != 0 ||
+    3b4b:	83 c4 10             	add    $0x10,%esp
+    3b4e:	85 c0                	test   %eax,%eax
+    3b50:	0f 85 c6 01 00 00    	jne    3d1c <iovtest+0x31c>
+     memcmp(buf, body, sizeof(body)) != 0 || memcmp(buf + sizeof(body), "end\n", 4) != 0){
+    3b56:	83 ec 04             	sub    $0x4,%esp
+    3b59:	6a 04                	push   $0x4
+    3b5b:	68 0a 77 00 00       	push   $0x770a
+    3b60:	68 30 d1 00 00       	push   $0xd130
+    3b65:	e8 76 1d 00 00       	call   58e0 <memcmp>
+    3b6a:	83 c4 10             	add    $0x10,%esp
+    3b6d:	85 c0                	test   %eax,%eax
+    3b6f:	0f 85 a7 01 00 00    	jne    3d1c <iovtest+0x31c>
+  close(fd);
+    3b75:	83 ec 0c             	sub    $0xc,%esp
+    3b78:	ff b5 e4 f7 ff ff    	push   -0x81c(%ebp)
+    3b7e:	e8 9d 20 00 00       	call   5c20 <close>
+  unlink("iovfile");
+    3b83:	c7 04 24 0f 77 00 00 	movl   $0x770f,(%esp)
+    3b8a:	e8 a1 21 00 00       	call   5d30 <unlink>
+  if(pipe(p) < 0){
+    3b8f:	8d 85 f0 f7 ff ff    	lea    -0x810(%ebp),%eax
+    3b95:	89 04 24             	mov    %eax,(%esp)
+    3b98:	e8 53 21 00 00       	call   5cf0 <pipe>
+    3b9d:	83 c4 10             	add    $0x10,%esp
+    3ba0:	85 c0                	test   %eax,%eax
+    3ba2:	0f 88 61 01 00 00    	js     3d09 <iovtest+0x309>
+  if(writev(p[1], iov, 3) != 2011){
+    3ba8:	83 ec 04             	sub    $0x4,%esp
+  iov[1].iov_base = body;
+    3bab:	89 bd 08 f8 ff ff    	mov    %edi,-0x7f8(%ebp)
+  iov[0].iov_base = "header\n";
+    3bb1:	c7 85 00 f8 ff ff 02 	movl   $0x7702,-0x800(%ebp)
+    3bb8:	77 00 00 
+  iov[1].iov_len = sizeof(body);
+    3bbb:	c7 85 0c f8 ff ff d0 	movl   $0x7d0,-0x7f4(%ebp)
+    3bc2:	07 00 00 
+  if(writev(p[1], iov, 3) != 2011){
+    3bc5:	6a 03                	push   $0x3
+    3bc7:	53                   	push   %ebx
+    3bc8:	ff b5 f4 f7 ff ff    	push   -0x80c(%ebp)
+    3bce:	e8 0d 20 00 00       	call   5be0 <writev>
+    3bd3:	83 c4 10             	add    $0x10,%esp
+    3bd6:	3d db 07 00 00       	cmp    $0x7db,%eax
+    3bdb:	0f 85 15 01 00 00    	jne    3cf6 <iovtest+0x2f6>
+  if(readv(p[0], iov, 2) != 2011 || memcmp(hdr, "header\n", 7) != 0 ||
+    3be1:	83 ec 04             	sub    $0x4,%esp
+  iov[0].iov_base = hdr;
+    3be4:	89 b5 00 f8 ff ff    	mov    %esi,-0x800(%ebp)
+  iov[1].iov_base = buf;
+    3bea:	c7 85 08 f8 ff ff 60 	movl   $0xc960,-0x7f8(%ebp)
+    3bf1:	c9 00 00 
+  iov[1].iov_len = sizeof(buf);
+    3bf4:	c7 85 0c f8 ff ff 00 	movl   $0x2000,-0x7f4(%ebp)
+    3bfb:	20 00 00 
+  if(readv(p[0], iov, 2) != 2011 || memcmp(hdr, "header\n", 7) != 0 ||
+    3bfe:	6a 02                	push   $0x2
+    3c00:	53                   	push   %ebx
+    3c01:	ff b5 f0 f7 ff ff    	push   -0x810(%ebp)
+    3c07:	e8 54 1f 00 00       	call   5b60 <readv>
+    3c0c:	83 c4 10             	add    $0x10,%esp
+    3c0f:	3d db 07 00 00       	cmp    $0x7db,%eax
+    3c14:	0f 85 c8 00 00 00    	jne    3ce2 <iovtest+0x2e2>
+    3c1a:	83 ec 04             	sub    $0x4,%esp
+    3c1d:	6a 07                	push   $0x7
+    3c1f:	68 02 77 00 00       	push   $0x7702
+    3c24:	56                   	push   %esi
+    3c25:	e8 b6 1c 00 00       	call   58e0 <memcmp>
+    3c2a:	83 c4 10             	add    $0x10,%esp
+    3c2d:	85 c0                	test   %eax,%eax
+    3c2f:	0f 85 ad 00 00 00    	jne    3ce2 <iovtest+0x2e2>
+     memcmp(buf + sizeof(body), "end\n", 4) != 0){
+    3c35:	83 ec 04             	sub    $0x4,%esp
+    3c38:	6a 04                	push   $0x4
+    3c3a:	68 0a 77 00 00       	push   $0x770a
+    3c3f:	68 30 d1 00 00       	push   $0xd130
+    3c44:	e8 97 1c 00 00       	call   58e0 <memcmp>
+  if(readv(p[0], iov, 2) != 2011 || memcmp(hdr, "header\n", 7) != 0 ||
+    3c49:	83 c4 10             	add    $0x10,%esp
+    3c4c:	85 c0                	test   %eax,%eax
+    3c4e:	0f 85 8e 00 00 00    	jne    3ce2 <iovtest+0x2e2>
+  close(p[0]);
+    3c54:	83 ec 0c             	sub    $0xc,%esp
+    3c57:	ff b5 f0 f7 ff ff    	push   -0x810(%ebp)
+    3c5d:	e8 be 1f 00 00       	call   5c20 <close>
+  close(p[1]);
+    3c62:	5a                   	pop    %edx
+    3c63:	ff b5 f4 f7 ff ff    	push   -0x80c(%ebp)
+    3c69:	e8 b2 1f 00 00       	call   5c20 <close>
+  if(writev(1, iov, 1) != -1 || writev(1, iov, IOV_MAX + 1) != -1){
+    3c6e:	83 c4 0c             	add    $0xc,%esp
+  iov[0].iov_base = (void*)0x7fffffff;
+    3c71:	c7 85 00 f8 ff ff ff 	movl   $0x7fffffff,-0x800(%ebp)
+    3c78:	ff ff 7f 
+  if(writev(1, iov, 1) != -1 || writev(1, iov, IOV_MAX + 1) != -1){
+    3c7b:	6a 01                	push   $0x1
+    3c7d:	53                   	push   %ebx
+    3c7e:	6a 01                	push   $0x1
+    3c80:	e8 5b 1f 00 00       	call   5be0 <writev>
+    3c85:	83 c4 10             	add    $0x10,%esp
+    3c88:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3c8b:	75 42                	jne    3ccf <iovtest+0x2cf>
+    3c8d:	83 ec 04             	sub    $0x4,%esp
+    3c90:	6a 11                	push   $0x11
+    3c92:	53                   	push   %ebx
+    3c93:	6a 01                	push   $0x1
+    3c95:	e8 46 1f 00 00       	call   5be0 <writev>
+    3c9a:	83 c4 10             	add    $0x10,%esp
+    3c9d:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3ca0:	75 2d                	jne    3ccf <iovtest+0x2cf>
+  printf(1, "iov ok\n");
+    3ca2:	83 ec 08             	sub    $0x8,%esp
+    3ca5:	68 92 77 00 00       	push   $0x7792
+    3caa:	6a 01                	push   $0x1
+    3cac:	e8 af 25 00 00       	call   6260 <printf>
+}
+    3cb1:	83 c4 10             	add    $0x10,%esp
+    3cb4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3cb7:	5b                   	pop    %ebx
+    3cb8:	5e                   	pop    %esi
+    3cb9:	5f                   	pop    %edi
+    3cba:	5d                   	pop    %ebp
+    3cbb:	c3                   	ret
+    printf(1, "writev file failed\n");
+    3cbc:	50                   	push   %eax
+    3cbd:	50                   	push   %eax
+    3cbe:	68 17 77 00 00       	push   $0x7717
+    3cc3:	6a 01                	push   $0x1
+    3cc5:	e8 96 25 00 00       	call   6260 <printf>
+    exit();
+    3cca:	e8 01 1e 00 00       	call   5ad0 <exit>
+    printf(1, "writev bad iovec succeeded\n");
+    3ccf:	50                   	push   %eax
+    3cd0:	50                   	push   %eax
+    3cd1:	68 76 77 00 00       	push   $0x7776
+    3cd6:	6a 01                	push   $0x1
+    3cd8:	e8 83 25 00 00       	call   6260 <printf>
+    exit();
+    3cdd:	e8 ee 1d 00 00       	call   5ad0 <exit>
+    printf(1, "readv pipe failed\n");
+    3ce2:	83 ec 08             	sub    $0x8,%esp
+    3ce5:	68 63 77 00 00       	push   $0x7763
+    3cea:	6a 01                	push   $0x1
+    3cec:	e8 6f 25 00 00       	call   6260 <printf>
+    exit();
+    3cf1:	e8 da 1d 00 00       	call   5ad0 <exit>
+    printf(1, "writev pipe failed\n");
+    3cf6:	51                   	push   %ecx
+    3cf7:	51                   	push   %ecx
+    3cf8:	68 4f 77 00 00       	push   $0x774f
+    3cfd:	6a 01                	push   $0x1
+    3cff:	e8 5c 25 00 00       	call   6260 <printf>
+    exit();
+    3d04:	e8 c7 1d 00 00       	call   5ad0 <exit>
+    printf(1, "iov pipe failed\n");
+    3d09:	53                   	push   %ebx
+    3d0a:	53                   	push   %ebx
+    3d0b:	68 3e 77 00 00       	push   $0x773e
+    3d10:	6a 01                	push   $0x1
+    3d12:	e8 49 25 00 00       	call   6260 <printf>
+    exit();
+    3d17:	e8 b4 1d 00 00       	call   5ad0 <exit>
+    printf(1, "readv file failed\n");
+    3d1c:	83 ec 08             	sub    $0x8,%esp
+    3d1f:	68 2b 77 00 00       	push   $0x772b
+    3d24:	6a 01                	push   $0x1
+    3d26:	e8 35 25 00 00       	call   6260 <printf>
+    exit();
+    3d2b:	e8 a0 1d 00 00       	call   5ad0 <exit>
+
+00003d30 <futextest>:
+{
+    3d30:	55                   	push   %ebp
+    3d31:	89 e5                	mov    %esp,%ebp
+    3d33:	56                   	push   %esi
+    3d34:	53                   	push   %ebx
+  printf(1, "futex test\n");
+    3d35:	83 ec 08             	sub    $0x8,%esp
+    3d38:	68 9a 77 00 00       	push   $0x779a
+    3d3d:	6a 01                	push   $0x1
+    3d3f:	e8 1c 25 00 00       	call   6260 <printf>
+  if((id = shmget(0, 4096)) < 0 || (m = shmat(id)) == (void*)-1){
+    3d44:	5b                   	pop    %ebx
+    3d45:	5e                   	pop    %esi
+    3d46:	68 00 10 00 00       	push   $0x1000
+    3d4b:	6a 00                	push   $0x0
+    3d4d:	e8 76 20 00 00       	call   5dc8 <shmget>
+    3d52:	83 c4 10             	add    $0x10,%esp
+    3d55:	85 c0                	test   %eax,%eax
+    3d57:	0f 88 e3 00 00 00    	js     3e40 <futextest+0x110>
+    3d5d:	83 ec 0c             	sub    $0xc,%esp
+    3d60:	89 c3                	mov    %eax,%ebx
+    3d62:	50                   	push   %eax
+    3d63:	e8 68 20 00 00       	call   5dd0 <shmat>
+    3d68:	83 c4 10             	add    $0x10,%esp
+    3d6b:	89 c6                	mov    %eax,%esi
+    3d6d:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3d70:	0f 84 ca 00 00 00    	je     3e40 <futextest+0x110>
+  shmdel(id);
+    3d76:	83 ec 0c             	sub    $0xc,%esp
+    3d79:	53                   	push   %ebx
+    3d7a:	e8 61 20 00 00       	call   5de0 <shmdel>
+  if(futexwait(flag, 1) != -1 || futexwait((uint*)0x7ffffff0, 0) != -1){
+    3d7f:	58                   	pop    %eax
+  flag = (uint*)(m + 1);
+    3d80:	8d 46 04             	lea    0x4(%esi),%eax
+  if(futexwait(flag, 1) != -1 || futexwait((uint*)0x7ffffff0, 0) != -1){
+    3d83:	5a                   	pop    %edx
+    3d84:	6a 01                	push   $0x1
+    3d86:	50                   	push   %eax
+    3d87:	e8 8c 20 00 00       	call   5e18 <futexwait>
+    3d8c:	83 c4 10             	add    $0x10,%esp
+    3d8f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3d92:	0f 85 11 01 00 00    	jne    3ea9 <futextest+0x179>
+    3d98:	83 ec 08             	sub    $0x8,%esp
+    3d9b:	6a 00                	push   $0x0
+    3d9d:	68 f0 ff ff 7f       	push   $0x7ffffff0
+    3da2:	e8 71 20 00 00       	call   5e18 <futexwait>
+    3da7:	83 c4 10             	add    $0x10,%esp
+    3daa:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3dad:	0f 85 f6 00 00 00    	jne    3ea9 <futextest+0x179>
+  umtxlock(m);
+    3db3:	83 ec 0c             	sub    $0xc,%esp
+    3db6:	56                   	push   %esi
+    3db7:	e8 a4 1e 00 00       	call   5c60 <umtxlock>
+  pid = fork();
+    3dbc:	e8 df 1c 00 00       	call   5aa0 <fork>
+  if(pid < 0){
+    3dc1:	83 c4 10             	add    $0x10,%esp
+    3dc4:	85 c0                	test   %eax,%eax
+    3dc6:	0f 88 ca 00 00 00    	js     3e96 <futextest+0x166>
+  if(pid == 0){
+    3dcc:	0f 84 a7 00 00 00    	je     3e79 <futextest+0x149>
+    3dd2:	bb 0a 00 00 00       	mov    $0xa,%ebx
+    3dd7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3dde:	66 90                	xchg   %ax,%ax
+  for(i = 0; i < 10 && m->state != 2; i++)
+    3de0:	8b 06                	mov    (%esi),%eax
+    3de2:	83 f8 02             	cmp    $0x2,%eax
+    3de5:	74 12                	je     3df9 <futextest+0xc9>
+    sleep(1);
+    3de7:	83 ec 0c             	sub    $0xc,%esp
+    3dea:	6a 01                	push   $0x1
+    3dec:	e8 7f 1f 00 00       	call   5d70 <sleep>
+  for(i = 0; i < 10 && m->state != 2; i++)
+    3df1:	83 c4 10             	add    $0x10,%esp
+    3df4:	83 eb 01             	sub    $0x1,%ebx
+    3df7:	75 e7                	jne    3de0 <futextest+0xb0>
+  if(*flag != 0){
+    3df9:	8b 46 04             	mov    0x4(%esi),%eax
+    3dfc:	85 c0                	test   %eax,%eax
+    3dfe:	75 66                	jne    3e66 <futextest+0x136>
+  umtxunlock(m);
+    3e00:	83 ec 0c             	sub    $0xc,%esp
+    3e03:	56                   	push   %esi
+    3e04:	e8 a7 1e 00 00       	call   5cb0 <umtxunlock>
+  wait();
+    3e09:	e8 da 1e 00 00       	call   5ce8 <wait>
+  if(*flag != 1 || m->state != 0){
+    3e0e:	8b 46 04             	mov    0x4(%esi),%eax
+    3e11:	83 c4 10             	add    $0x10,%esp
+    3e14:	83 f8 01             	cmp    $0x1,%eax
+    3e17:	75 3a                	jne    3e53 <futextest+0x123>
+    3e19:	8b 06                	mov    (%esi),%eax
+    3e1b:	85 c0                	test   %eax,%eax
+    3e1d:	75 34                	jne    3e53 <futextest+0x123>
+  shmdt(m);
+    3e1f:	83 ec 0c             	sub    $0xc,%esp
+    3e22:	56                   	push   %esi
+    3e23:	e8 b0 1f 00 00       	call   5dd8 <shmdt>
+  printf(1, "futex ok\n");
+    3e28:	58                   	pop    %eax
+    3e29:	5a                   	pop    %edx
+    3e2a:	68 0a 78 00 00       	push   $0x780a
+    3e2f:	6a 01                	push   $0x1
+    3e31:	e8 2a 24 00 00       	call   6260 <printf>
+}
+    3e36:	83 c4 10             	add    $0x10,%esp
+    3e39:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    3e3c:	5b                   	pop    %ebx
+    3e3d:	5e                   	pop    %esi
+    3e3e:	5d                   	pop    %ebp
+    3e3f:	c3                   	ret
+    printf(1, "futex shmget/shmat failed\n");
+    3e40:	51                   	push   %ecx
+    3e41:	51                   	push   %ecx
+    3e42:	68 a6 77 00 00       	push   $0x77a6
+    3e47:	6a 01                	push   $0x1
+    3e49:	e8 12 24 00 00       	call   6260 <printf>
+    exit();
+    3e4e:	e8 7d 1c 00 00       	call   5ad0 <exit>
+    printf(1, "umtxunlock did not hand over\n");
+    3e53:	51                   	push   %ecx
+    3e54:	51                   	push   %ecx
+    3e55:	68 ec 77 00 00       	push   $0x77ec
+    3e5a:	6a 01                	push   $0x1
+    3e5c:	e8 ff 23 00 00       	call   6260 <printf>
+    exit();
+    3e61:	e8 6a 1c 00 00       	call   5ad0 <exit>
+    printf(1, "umtxlock let two processes in\n");
+    3e66:	53                   	push   %ebx
+    3e67:	53                   	push   %ebx
+    3e68:	68 1c 84 00 00       	push   $0x841c
+    3e6d:	6a 01                	push   $0x1
+    3e6f:	e8 ec 23 00 00       	call   6260 <printf>
+    exit();
+    3e74:	e8 57 1c 00 00       	call   5ad0 <exit>
+    umtxlock(m);
+    3e79:	83 ec 0c             	sub    $0xc,%esp
+    3e7c:	56                   	push   %esi
+    3e7d:	e8 de 1d 00 00       	call   5c60 <umtxlock>
+    *flag = 1;
+    3e82:	c7 46 04 01 00 00 00 	movl   $0x1,0x4(%esi)
+    umtxunlock(m);
+    3e89:	89 34 24             	mov    %esi,(%esp)
+    3e8c:	e8 1f 1e 00 00       	call   5cb0 <umtxunlock>
+    exit();
+    3e91:	e8 3a 1c 00 00       	call   5ad0 <exit>
+    printf(1, "futex fork failed\n");
+    3e96:	56                   	push   %esi
+    3e97:	56                   	push   %esi
+    3e98:	68 d9 77 00 00       	push   $0x77d9
+    3e9d:	6a 01                	push   $0x1
+    3e9f:	e8 bc 23 00 00       	call   6260 <printf>
+    exit();
+    3ea4:	e8 27 1c 00 00       	call   5ad0 <exit>
+    printf(1, "futexwait did not fail\n");
+    3ea9:	50                   	push   %eax
+    3eaa:	50                   	push   %eax
+    3eab:	68 c1 77 00 00       	push   $0x77c1
+    3eb0:	6a 01                	push   $0x1
+    3eb2:	e8 a9 23 00 00       	call   6260 <printf>
+    exit();
+    3eb7:	e8 14 1c 00 00       	call   5ad0 <exit>
+    3ebc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00003ec0 <largepagetest>:
+{
+    3ec0:	55                   	push   %ebp
+    3ec1:	89 e5                	mov    %esp,%ebp
+    3ec3:	56                   	push   %esi
+    3ec4:	53                   	push   %ebx
+  printf(1, "large page test\n");
+    3ec5:	83 ec 08             	sub    $0x8,%esp
+    3ec8:	68 14 78 00 00       	push   $0x7814
+    3ecd:	6a 01                	push   $0x1
+    3ecf:	e8 8c 23 00 00       	call   6260 <printf>
+  oldbrk = sbrk(0);
+    3ed4:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    3edb:	e8 88 1e 00 00       	call   5d68 <sbrk>
+  if((uint)oldbrk % LPG != 0)
+    3ee0:	83 c4 10             	add    $0x10,%esp
+  oldbrk = sbrk(0);
+    3ee3:	89 c3                	mov    %eax,%ebx
+  if((uint)oldbrk % LPG != 0)
+    3ee5:	25 ff ff 3f 00       	and    $0x3fffff,%eax
+    3eea:	75 73                	jne    3f5f <largepagetest+0x9f>
+  if((a = sbrk(2*LPG)) == (char*)-1){
+    3eec:	83 ec 0c             	sub    $0xc,%esp
+    3eef:	68 00 00 80 00       	push   $0x800000
+    3ef4:	e8 6f 1e 00 00       	call   5d68 <sbrk>
+    3ef9:	83 c4 10             	add    $0x10,%esp
+    3efc:	89 c6                	mov    %eax,%esi
+    3efe:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3f01:	0f 84 7f 01 00 00    	je     4086 <largepagetest+0x1c6>
+  for(i = 0; i < 2*LPG; i += 4096)
+    3f07:	31 c0                	xor    %eax,%eax
+    3f09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    a[i] = i / 4096;
+    3f10:	89 c2                	mov    %eax,%edx
+    3f12:	c1 fa 0c             	sar    $0xc,%edx
+    3f15:	88 14 06             	mov    %dl,(%esi,%eax,1)
+  for(i = 0; i < 2*LPG; i += 4096)
+    3f18:	05 00 10 00 00       	add    $0x1000,%eax
+    3f1d:	3d 00 00 80 00       	cmp    $0x800000,%eax
+    3f22:	75 ec                	jne    3f10 <largepagetest+0x50>
+  pid = fork();
+    3f24:	e8 77 1b 00 00       	call   5aa0 <fork>
+  if(pid < 0){
+    3f29:	85 c0                	test   %eax,%eax
+    3f2b:	0f 88 42 01 00 00    	js     4073 <largepagetest+0x1b3>
+  if(pid == 0){
+    3f31:	75 44                	jne    3f77 <largepagetest+0xb7>
+    3f33:	89 f2                	mov    %esi,%edx
+    3f35:	8d 76 00             	lea    0x0(%esi),%esi
+      if(a[i] != (char)(i / 4096)){
+    3f38:	89 c1                	mov    %eax,%ecx
+    3f3a:	c1 f9 0c             	sar    $0xc,%ecx
+    3f3d:	38 0a                	cmp    %cl,(%edx)
+    3f3f:	0f 85 d5 00 00 00    	jne    401a <largepagetest+0x15a>
+    for(i = 0; i < 2*LPG; i += 4096){
+    3f45:	05 00 10 00 00       	add    $0x1000,%eax
+      a[i] = 0;
+    3f4a:	c6 02 00             	movb   $0x0,(%edx)
+    for(i = 0; i < 2*LPG; i += 4096){
+    3f4d:	81 c2 00 10 00 00    	add    $0x1000,%edx
+    3f53:	3d 00 00 80 00       	cmp    $0x800000,%eax
+    3f58:	75 de                	jne    3f38 <largepagetest+0x78>
+    exit();
+    3f5a:	e8 71 1b 00 00       	call   5ad0 <exit>
+    sbrk(LPG - (uint)oldbrk % LPG);
+    3f5f:	ba 00 00 40 00       	mov    $0x400000,%edx
+    3f64:	83 ec 0c             	sub    $0xc,%esp
+    3f67:	29 c2                	sub    %eax,%edx
+    3f69:	52                   	push   %edx
+    3f6a:	e8 f9 1d 00 00       	call   5d68 <sbrk>
+    3f6f:	83 c4 10             	add    $0x10,%esp
+    3f72:	e9 75 ff ff ff       	jmp    3eec <largepagetest+0x2c>
+  wait();
+    3f77:	e8 6c 1d 00 00       	call   5ce8 <wait>
+  for(i = 0; i < 2*LPG; i += 4096){
+    3f7c:	31 c0                	xor    %eax,%eax
+    3f7e:	66 90                	xchg   %ax,%ax
+    if(a[i] != (char)(i / 4096)){
+    3f80:	89 c2                	mov    %eax,%edx
+    3f82:	c1 fa 0c             	sar    $0xc,%edx
+    3f85:	38 14 06             	cmp    %dl,(%esi,%eax,1)
+    3f88:	0f 85 a1 00 00 00    	jne    402f <largepagetest+0x16f>
+  for(i = 0; i < 2*LPG; i += 4096){
+    3f8e:	05 00 10 00 00       	add    $0x1000,%eax
+    3f93:	3d 00 00 80 00       	cmp    $0x800000,%eax
+    3f98:	75 e6                	jne    3f80 <largepagetest+0xc0>
+  sbrk(-(LPG/2));
+    3f9a:	83 ec 0c             	sub    $0xc,%esp
+    3f9d:	68 00 00 e0 ff       	push   $0xffe00000
+    3fa2:	e8 c1 1d 00 00       	call   5d68 <sbrk>
+    3fa7:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < LPG + LPG/2; i += 4096){
+    3faa:	31 c0                	xor    %eax,%eax
+    3fac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(a[i] != (char)(i / 4096)){
+    3fb0:	89 c2                	mov    %eax,%edx
+    3fb2:	c1 fa 0c             	sar    $0xc,%edx
+    3fb5:	38 14 06             	cmp    %dl,(%esi,%eax,1)
+    3fb8:	0f 85 88 00 00 00    	jne    4046 <largepagetest+0x186>
+  for(i = 0; i < LPG + LPG/2; i += 4096){
+    3fbe:	05 00 10 00 00       	add    $0x1000,%eax
+    3fc3:	3d 00 00 60 00       	cmp    $0x600000,%eax
+    3fc8:	75 e6                	jne    3fb0 <largepagetest+0xf0>
+  p = sbrk(LPG/2);
+    3fca:	83 ec 0c             	sub    $0xc,%esp
+    3fcd:	68 00 00 20 00       	push   $0x200000
+    3fd2:	e8 91 1d 00 00       	call   5d68 <sbrk>
+  for(i = 0; i < LPG/2; i += 4096){
+    3fd7:	83 c4 10             	add    $0x10,%esp
+    3fda:	8d 90 00 00 20 00    	lea    0x200000(%eax),%edx
+    if(p[i] != 0){
+    3fe0:	80 38 00             	cmpb   $0x0,(%eax)
+    3fe3:	75 79                	jne    405e <largepagetest+0x19e>
+  for(i = 0; i < LPG/2; i += 4096){
+    3fe5:	05 00 10 00 00       	add    $0x1000,%eax
+    3fea:	39 d0                	cmp    %edx,%eax
+    3fec:	75 f2                	jne    3fe0 <largepagetest+0x120>
+  sbrk(oldbrk - sbrk(0));
+    3fee:	83 ec 0c             	sub    $0xc,%esp
+    3ff1:	6a 00                	push   $0x0
+    3ff3:	e8 70 1d 00 00       	call   5d68 <sbrk>
+    3ff8:	29 c3                	sub    %eax,%ebx
+    3ffa:	89 1c 24             	mov    %ebx,(%esp)
+    3ffd:	e8 66 1d 00 00       	call   5d68 <sbrk>
+  printf(1, "large page ok\n");
+    4002:	58                   	pop    %eax
+    4003:	5a                   	pop    %edx
+    4004:	68 6b 78 00 00       	push   $0x786b
+    4009:	6a 01                	push   $0x1
+    400b:	e8 50 22 00 00       	call   6260 <printf>
+}
+    4010:	83 c4 10             	add    $0x10,%esp
+    4013:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    4016:	5b                   	pop    %ebx
+    4017:	5e                   	pop    %esi
+    4018:	5d                   	pop    %ebp
+    4019:	c3                   	ret
+        printf(1, "child sees wrong data at %x\n", a + i);
+    401a:	83 ec 04             	sub    $0x4,%esp
+    401d:	52                   	push   %edx
+    401e:	68 36 78 00 00       	push   $0x7836
+    4023:	6a 01                	push   $0x1
+    4025:	e8 36 22 00 00       	call   6260 <printf>
+        exit();
+    402a:	e8 a1 1a 00 00       	call   5ad0 <exit>
+      printf(1, "child's writes showed in parent at %x\n", a + i);
+    402f:	83 ec 04             	sub    $0x4,%esp
+    if(a[i] != (char)(i / 4096)){
+    4032:	01 f0                	add    %esi,%eax
+      printf(1, "child's writes showed in parent at %x\n", a + i);
+    4034:	50                   	push   %eax
+    4035:	68 3c 84 00 00       	push   $0x843c
+    403a:	6a 01                	push   $0x1
+    403c:	e8 1f 22 00 00       	call   6260 <printf>
+      exit();
+    4041:	e8 8a 1a 00 00       	call   5ad0 <exit>
+      printf(1, "shrink lost data at %x\n", a + i);
+    4046:	83 ec 04             	sub    $0x4,%esp
+    if(a[i] != (char)(i / 4096)){
+    4049:	8d 14 06             	lea    (%esi,%eax,1),%edx
+      printf(1, "shrink lost data at %x\n", a + i);
+    404c:	52                   	push   %edx
+    404d:	68 53 78 00 00       	push   $0x7853
+    4052:	6a 01                	push   $0x1
+    4054:	e8 07 22 00 00       	call   6260 <printf>
+      exit();
+    4059:	e8 72 1a 00 00       	call   5ad0 <exit>
+      printf(1, "regrown heap not zeroed at %x\n", p + i);
+    405e:	83 ec 04             	sub    $0x4,%esp
+    4061:	50                   	push   %eax
+    4062:	68 64 84 00 00       	push   $0x8464
+    4067:	6a 01                	push   $0x1
+    4069:	e8 f2 21 00 00       	call   6260 <printf>
+      exit();
+    406e:	e8 5d 1a 00 00       	call   5ad0 <exit>
+    printf(1, "fork failed\n");
+    4073:	51                   	push   %ecx
+    4074:	51                   	push   %ecx
+    4075:	68 48 7e 00 00       	push   $0x7e48
+    407a:	6a 01                	push   $0x1
+    407c:	e8 df 21 00 00       	call   6260 <printf>
+    exit();
+    4081:	e8 4a 1a 00 00       	call   5ad0 <exit>
+    printf(1, "sbrk 8MB failed\n");
+    4086:	53                   	push   %ebx
+    4087:	53                   	push   %ebx
+    4088:	68 25 78 00 00       	push   $0x7825
+    408d:	6a 01                	push   $0x1
+    408f:	e8 cc 21 00 00       	call   6260 <printf>
+    exit();
+    4094:	e8 37 1a 00 00       	call   5ad0 <exit>
+    4099:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000040a0 <bigstack>:
+{
+    40a0:	55                   	push   %ebp
+    40a1:	89 e5                	mov    %esp,%ebp
+    40a3:	81 ec 00 00 04 00    	sub    $0x40000,%esp
+  buf[0] = 1;
+    40a9:	c6 85 00 00 fc ff 01 	movb   $0x1,-0x40000(%ebp)
+  return buf[0];
+    40b0:	0f be 85 00 00 fc ff 	movsbl -0x40000(%ebp),%eax
+}
+    40b7:	c9                   	leave
+    40b8:	c3                   	ret
+    40b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000040c0 <stacktest>:
+{
+    40c0:	55                   	push   %ebp
+    40c1:	89 e5                	mov    %esp,%ebp
+    40c3:	53                   	push   %ebx
+    40c4:	83 ec 1c             	sub    $0x1c,%esp
+  printf(1, "stack test\n");
+    40c7:	68 7a 78 00 00       	push   $0x787a
+    40cc:	6a 01                	push   $0x1
+    40ce:	e8 8d 21 00 00       	call   6260 <printf>
+  if(pipe(fds) < 0){
+    40d3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    40d6:	89 04 24             	mov    %eax,(%esp)
+    40d9:	e8 12 1c 00 00       	call   5cf0 <pipe>
+    40de:	83 c4 10             	add    $0x10,%esp
+    40e1:	85 c0                	test   %eax,%eax
+    40e3:	0f 88 04 01 00 00    	js     41ed <stacktest+0x12d>
+  pid = fork();
+    40e9:	e8 b2 19 00 00       	call   5aa0 <fork>
+  if(pid < 0){
+    40ee:	85 c0                	test   %eax,%eax
+    40f0:	0f 88 e4 00 00 00    	js     41da <stacktest+0x11a>
+  if(pid == 0){
+    40f6:	0f 84 17 01 00 00    	je     4213 <stacktest+0x153>
+  close(fds[1]);
+    40fc:	83 ec 0c             	sub    $0xc,%esp
+    40ff:	ff 75 f4             	push   -0xc(%ebp)
+    4102:	e8 19 1b 00 00       	call   5c20 <close>
+  if(read(fds[0], &c, 1) != 1){
+    4107:	83 c4 0c             	add    $0xc,%esp
+    410a:	8d 45 ef             	lea    -0x11(%ebp),%eax
+    410d:	6a 01                	push   $0x1
+    410f:	50                   	push   %eax
+    4110:	ff 75 f0             	push   -0x10(%ebp)
+    4113:	e8 08 1a 00 00       	call   5b20 <read>
+    4118:	83 c4 10             	add    $0x10,%esp
+    411b:	83 f8 01             	cmp    $0x1,%eax
+    411e:	0f 85 dc 00 00 00    	jne    4200 <stacktest+0x140>
+  close(fds[0]);
+    4124:	83 ec 0c             	sub    $0xc,%esp
+    4127:	ff 75 f0             	push   -0x10(%ebp)
+    412a:	e8 f1 1a 00 00       	call   5c20 <close>
+  wait();
+    412f:	e8 b4 1b 00 00       	call   5ce8 <wait>
+  ppid = getpid();
+    4134:	e8 27 1c 00 00       	call   5d60 <getpid>
+    4139:	89 c3                	mov    %eax,%ebx
+  pid = fork();
+    413b:	e8 60 19 00 00       	call   5aa0 <fork>
+  if(pid < 0){
+    4140:	83 c4 10             	add    $0x10,%esp
+    4143:	85 c0                	test   %eax,%eax
+    4145:	0f 88 8f 00 00 00    	js     41da <stacktest+0x11a>
+  if(pid == 0){
+    414b:	75 3b                	jne    4188 <stacktest+0xc8>
+    if(stacklimit(128*1024, -1) < 0){
+    414d:	83 ec 08             	sub    $0x8,%esp
+    4150:	6a ff                	push   $0xffffffff
+    4152:	68 00 00 02 00       	push   $0x20000
+    4157:	e8 e4 1c 00 00       	call   5e40 <stacklimit>
+    415c:	83 c4 10             	add    $0x10,%esp
+    415f:	85 c0                	test   %eax,%eax
+    4161:	78 6d                	js     41d0 <stacktest+0x110>
+    bigstack();
+    4163:	e8 38 ff ff ff       	call   40a0 <bigstack>
+    printf(1, "stack grew past its limit\n");
+    4168:	83 ec 08             	sub    $0x8,%esp
+    416b:	68 b1 78 00 00       	push   $0x78b1
+    4170:	6a 01                	push   $0x1
+    4172:	e8 e9 20 00 00       	call   6260 <printf>
+    kill(ppid);
+    4177:	89 1c 24             	mov    %ebx,(%esp)
+    417a:	e8 91 1b 00 00       	call   5d10 <kill>
+    exit();
+    417f:	e8 4c 19 00 00       	call   5ad0 <exit>
+    4184:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  wait();
+    4188:	e8 5b 1b 00 00       	call   5ce8 <wait>
+  if(sbrk(0x7ffff000 - (uint)sbrk(0)) != (char*)-1){
+    418d:	83 ec 0c             	sub    $0xc,%esp
+    4190:	6a 00                	push   $0x0
+    4192:	e8 d1 1b 00 00       	call   5d68 <sbrk>
+    4197:	89 c2                	mov    %eax,%edx
+    4199:	b8 00 f0 ff 7f       	mov    $0x7ffff000,%eax
+    419e:	29 d0                	sub    %edx,%eax
+    41a0:	89 04 24             	mov    %eax,(%esp)
+    41a3:	e8 c0 1b 00 00       	call   5d68 <sbrk>
+    41a8:	83 c4 10             	add    $0x10,%esp
+    41ab:	83 f8 ff             	cmp    $0xffffffff,%eax
+    41ae:	75 72                	jne    4222 <stacktest+0x162>
+  printf(1, "stack test ok\n");
+    41b0:	83 ec 08             	sub    $0x8,%esp
+    41b3:	68 e6 78 00 00       	push   $0x78e6
+    41b8:	6a 01                	push   $0x1
+    41ba:	e8 a1 20 00 00       	call   6260 <printf>
+}
+    41bf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    41c2:	83 c4 10             	add    $0x10,%esp
+    41c5:	c9                   	leave
+    41c6:	c3                   	ret
+    41c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    41ce:	66 90                	xchg   %ax,%ax
+      printf(1, "stacklimit failed\n");
+    41d0:	83 ec 08             	sub    $0x8,%esp
+    41d3:	68 9e 78 00 00       	push   $0x789e
+    41d8:	eb 96                	jmp    4170 <stacktest+0xb0>
+    printf(1, "fork failed\n");
+    41da:	53                   	push   %ebx
+    41db:	53                   	push   %ebx
+    41dc:	68 48 7e 00 00       	push   $0x7e48
+    41e1:	6a 01                	push   $0x1
+    41e3:	e8 78 20 00 00       	call   6260 <printf>
+    exit();
+    41e8:	e8 e3 18 00 00       	call   5ad0 <exit>
+    printf(1, "pipe failed\n");
+    41ed:	50                   	push   %eax
+    41ee:	50                   	push   %eax
+    41ef:	68 bb 75 00 00       	push   $0x75bb
+    41f4:	6a 01                	push   $0x1
+    41f6:	e8 65 20 00 00       	call   6260 <printf>
+    exit();
+    41fb:	e8 d0 18 00 00       	call   5ad0 <exit>
+    printf(1, "big local array failed\n");
+    4200:	52                   	push   %edx
+    4201:	52                   	push   %edx
+    4202:	68 86 78 00 00       	push   $0x7886
+    4207:	6a 01                	push   $0x1
+    4209:	e8 52 20 00 00       	call   6260 <printf>
+    exit();
+    420e:	e8 bd 18 00 00       	call   5ad0 <exit>
+    if(bigstack() == 1)
+    4213:	e8 88 fe ff ff       	call   40a0 <bigstack>
+    4218:	83 e8 01             	sub    $0x1,%eax
+    421b:	74 18                	je     4235 <stacktest+0x175>
+    exit();
+    421d:	e8 ae 18 00 00       	call   5ad0 <exit>
+    printf(1, "heap grew into the stack\n");
+    4222:	50                   	push   %eax
+    4223:	50                   	push   %eax
+    4224:	68 cc 78 00 00       	push   $0x78cc
+    4229:	6a 01                	push   $0x1
+    422b:	e8 30 20 00 00       	call   6260 <printf>
+    exit();
+    4230:	e8 9b 18 00 00       	call   5ad0 <exit>
+      write(fds[1], "x", 1);
+    4235:	51                   	push   %ecx
+    4236:	6a 01                	push   $0x1
+    4238:	68 53 71 00 00       	push   $0x7153
+    423d:	ff 75 f4             	push   -0xc(%ebp)
+    4240:	e8 5b 19 00 00       	call   5ba0 <write>
+    4245:	83 c4 10             	add    $0x10,%esp
+    4248:	eb d3                	jmp    421d <stacktest+0x15d>
+    424a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00004250 <threadtest>:
+}
+
+void
+threadtest(void)
+{
+    4250:	55                   	push   %ebp
+    4251:	89 e5                	mov    %esp,%ebp
+    4253:	57                   	push   %edi
+    4254:	56                   	push   %esi
+    4255:	53                   	push   %ebx
+
+  printf(1, "thread test\n");
+  tcount = 0;
+  tmem = 0;
+  umtxinit(&tlock);
+  for(i = 0; i < 4; i++){
+    4256:	31 db                	xor    %ebx,%ebx
+{
+    4258:	83 ec 34             	sub    $0x34,%esp
+  char *args[] = { "echo", "thread", "exec", 0 };
+    425b:	c7 45 d8 98 66 00 00 	movl   $0x6698,-0x28(%ebp)
+    4262:	c7 45 dc f5 78 00 00 	movl   $0x78f5,-0x24(%ebp)
+    4269:	c7 45 e0 fc 78 00 00 	movl   $0x78fc,-0x20(%ebp)
+    4270:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  printf(1, "thread test\n");
+    4277:	68 01 79 00 00       	push   $0x7901
+    427c:	6a 01                	push   $0x1
+    427e:	e8 dd 1f 00 00       	call   6260 <printf>
+  tcount = 0;
+    4283:	c7 05 58 c9 00 00 00 	movl   $0x0,0xc958
+    428a:	00 00 00 
+  tmem = 0;
+    428d:	c7 05 50 c9 00 00 00 	movl   $0x0,0xc950
+    4294:	00 00 00 
+  umtxinit(&tlock);
+    4297:	c7 04 24 54 c9 00 00 	movl   $0xc954,(%esp)
+    429e:	e8 ad 19 00 00       	call   5c50 <umtxinit>
+    42a3:	83 c4 10             	add    $0x10,%esp
+    if(thread_create(threadinc, (void*)i) < 0){
+    42a6:	83 ec 08             	sub    $0x8,%esp
+    42a9:	53                   	push   %ebx
+    42aa:	68 20 06 00 00       	push   $0x620
+    42af:	e8 3c 23 00 00       	call   65f0 <thread_create>
+    42b4:	83 c4 10             	add    $0x10,%esp
+    42b7:	85 c0                	test   %eax,%eax
+    42b9:	0f 88 85 01 00 00    	js     4444 <threadtest+0x1f4>
+  for(i = 0; i < 4; i++){
+    42bf:	83 c3 01             	add    $0x1,%ebx
+    42c2:	83 fb 04             	cmp    $0x4,%ebx
+    42c5:	75 df                	jne    42a6 <threadtest+0x56>
+      printf(1, "thread_create failed\n");
+      exit();
+    }
+  }
+  for(i = 0; i < 4; i++){
+    if(thread_join() < 0){
+    42c7:	e8 94 23 00 00       	call   6660 <thread_join>
+    42cc:	85 c0                	test   %eax,%eax
+    42ce:	0f 88 a8 01 00 00    	js     447c <threadtest+0x22c>
+  for(i = 0; i < 4; i++){
+    42d4:	83 eb 01             	sub    $0x1,%ebx
+    42d7:	75 ee                	jne    42c7 <threadtest+0x77>
+      printf(1, "thread_join failed\n");
+      exit();
+    }
+  }
+  if(thread_join() != -1){
+    42d9:	e8 82 23 00 00       	call   6660 <thread_join>
+    42de:	83 f8 ff             	cmp    $0xffffffff,%eax
+    42e1:	0f 85 e2 01 00 00    	jne    44c9 <threadtest+0x279>
+    printf(1, "thread_join found an extra thread\n");
+    exit();
+  }
+  if(tcount != 4000){
+    42e7:	a1 58 c9 00 00       	mov    0xc958,%eax
+    42ec:	3d a0 0f 00 00       	cmp    $0xfa0,%eax
+    42f1:	0f 85 e5 01 00 00    	jne    44dc <threadtest+0x28c>
+    printf(1, "threads counted %d, not 4000\n", tcount);
+    exit();
+  }
+  if(tmem == 0 || tmem[0] != 'T'){
+    42f7:	a1 50 c9 00 00       	mov    0xc950,%eax
+    42fc:	85 c0                	test   %eax,%eax
+    42fe:	0f 84 8c 01 00 00    	je     4490 <threadtest+0x240>
+    4304:	80 38 54             	cmpb   $0x54,(%eax)
+    4307:	0f 85 83 01 00 00    	jne    4490 <threadtest+0x240>
+    printf(1, "thread's sbrk() not shared\n");
+    exit();
+  }
+
+  // Threads share their open files.
+  if(pipe(fds) < 0){
+    430d:	83 ec 0c             	sub    $0xc,%esp
+    4310:	8d 75 d0             	lea    -0x30(%ebp),%esi
+    4313:	56                   	push   %esi
+    4314:	e8 d7 19 00 00       	call   5cf0 <pipe>
+    4319:	83 c4 10             	add    $0x10,%esp
+    431c:	85 c0                	test   %eax,%eax
+    431e:	0f 88 c8 00 00 00    	js     43ec <threadtest+0x19c>
+    printf(1, "pipe failed\n");
+    exit();
+  }
+  if(thread_create(threadclose, (void*)fds[1]) < 0 || thread_join() < 0){
+    4324:	83 ec 08             	sub    $0x8,%esp
+    4327:	ff 75 d4             	push   -0x2c(%ebp)
+    432a:	68 10 00 00 00       	push   $0x10
+    432f:	e8 bc 22 00 00       	call   65f0 <thread_create>
+    4334:	83 c4 10             	add    $0x10,%esp
+    4337:	85 c0                	test   %eax,%eax
+    4339:	0f 88 05 01 00 00    	js     4444 <threadtest+0x1f4>
+    433f:	e8 1c 23 00 00       	call   6660 <thread_join>
+    4344:	85 c0                	test   %eax,%eax
+    4346:	0f 88 f8 00 00 00    	js     4444 <threadtest+0x1f4>
+    printf(1, "thread_create failed\n");
+    exit();
+  }
+  if(write(fds[1], "x", 1) != -1){
+    434c:	83 ec 04             	sub    $0x4,%esp
+    434f:	6a 01                	push   $0x1
+    4351:	68 53 71 00 00       	push   $0x7153
+    4356:	ff 75 d4             	push   -0x2c(%ebp)
+    4359:	e8 42 18 00 00       	call   5ba0 <write>
+    435e:	83 c4 10             	add    $0x10,%esp
+    4361:	83 f8 ff             	cmp    $0xffffffff,%eax
+    4364:	0f 85 4c 01 00 00    	jne    44b6 <threadtest+0x266>
+    printf(1, "thread's close() not shared\n");
+    exit();
+  }
+  close(fds[0]);
+    436a:	83 ec 0c             	sub    $0xc,%esp
+    436d:	ff 75 d0             	push   -0x30(%ebp)
+
+  // exit() and exec() end the other threads of the process.
+  // The pipe's write end, which they share, closes only when
+  // the spinning thread has gone too.
+  for(k = 0; k < 2; k++){
+    4370:	31 db                	xor    %ebx,%ebx
+        printf(1, "exec echo failed\n");
+      }
+      exit();
+    }
+    close(fds[1]);
+    if(read(fds[0], &c, 1) != 0){
+    4372:	8d 7d cf             	lea    -0x31(%ebp),%edi
+  close(fds[0]);
+    4375:	e8 a6 18 00 00       	call   5c20 <close>
+    437a:	83 c4 10             	add    $0x10,%esp
+    if(pipe(fds) < 0){
+    437d:	83 ec 0c             	sub    $0xc,%esp
+    4380:	56                   	push   %esi
+    4381:	e8 6a 19 00 00       	call   5cf0 <pipe>
+    4386:	83 c4 10             	add    $0x10,%esp
+    4389:	85 c0                	test   %eax,%eax
+    438b:	78 5f                	js     43ec <threadtest+0x19c>
+    i = fork();
+    438d:	e8 0e 17 00 00       	call   5aa0 <fork>
+    if(i < 0){
+    4392:	85 c0                	test   %eax,%eax
+    4394:	0f 88 09 01 00 00    	js     44a3 <threadtest+0x253>
+    if(i == 0){
+    439a:	74 7e                	je     441a <threadtest+0x1ca>
+    close(fds[1]);
+    439c:	83 ec 0c             	sub    $0xc,%esp
+    439f:	ff 75 d4             	push   -0x2c(%ebp)
+    43a2:	e8 79 18 00 00       	call   5c20 <close>
+    if(read(fds[0], &c, 1) != 0){
+    43a7:	83 c4 0c             	add    $0xc,%esp
+    43aa:	6a 01                	push   $0x1
+    43ac:	57                   	push   %edi
+    43ad:	ff 75 d0             	push   -0x30(%ebp)
+    43b0:	e8 6b 17 00 00       	call   5b20 <read>
+    43b5:	83 c4 10             	add    $0x10,%esp
+    43b8:	85 c0                	test   %eax,%eax
+    43ba:	0f 85 2f 01 00 00    	jne    44ef <threadtest+0x29f>
+      printf(1, "read from pipe got data\n");
+      exit();
+    }
+    close(fds[0]);
+    43c0:	83 ec 0c             	sub    $0xc,%esp
+    43c3:	ff 75 d0             	push   -0x30(%ebp)
+    43c6:	e8 55 18 00 00       	call   5c20 <close>
+    wait();
+    43cb:	e8 18 19 00 00       	call   5ce8 <wait>
+  for(k = 0; k < 2; k++){
+    43d0:	83 c4 10             	add    $0x10,%esp
+    43d3:	85 db                	test   %ebx,%ebx
+    43d5:	75 29                	jne    4400 <threadtest+0x1b0>
+    if(pipe(fds) < 0){
+    43d7:	83 ec 0c             	sub    $0xc,%esp
+  for(k = 0; k < 2; k++){
+    43da:	bb 01 00 00 00       	mov    $0x1,%ebx
+    if(pipe(fds) < 0){
+    43df:	56                   	push   %esi
+    43e0:	e8 0b 19 00 00       	call   5cf0 <pipe>
+    43e5:	83 c4 10             	add    $0x10,%esp
+    43e8:	85 c0                	test   %eax,%eax
+    43ea:	79 a1                	jns    438d <threadtest+0x13d>
+    printf(1, "pipe failed\n");
+    43ec:	83 ec 08             	sub    $0x8,%esp
+    43ef:	68 bb 75 00 00       	push   $0x75bb
+    43f4:	6a 01                	push   $0x1
+    43f6:	e8 65 1e 00 00       	call   6260 <printf>
+    exit();
+    43fb:	e8 d0 16 00 00       	call   5ad0 <exit>
+  }
+  printf(1, "thread ok\n");
+    4400:	83 ec 08             	sub    $0x8,%esp
+    4403:	68 a8 79 00 00       	push   $0x79a8
+    4408:	6a 01                	push   $0x1
+    440a:	e8 51 1e 00 00       	call   6260 <printf>
+}
+    440f:	83 c4 10             	add    $0x10,%esp
+    4412:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    4415:	5b                   	pop    %ebx
+    4416:	5e                   	pop    %esi
+    4417:	5f                   	pop    %edi
+    4418:	5d                   	pop    %ebp
+    4419:	c3                   	ret
+      close(fds[0]);
+    441a:	83 ec 0c             	sub    $0xc,%esp
+    441d:	ff 75 d0             	push   -0x30(%ebp)
+    4420:	e8 fb 17 00 00       	call   5c20 <close>
+      if(thread_create(threadspin, 0) < 0){
+    4425:	5e                   	pop    %esi
+    4426:	5f                   	pop    %edi
+    4427:	6a 00                	push   $0x0
+    4429:	68 00 00 00 00       	push   $0x0
+    442e:	e8 bd 21 00 00       	call   65f0 <thread_create>
+    4433:	83 c4 10             	add    $0x10,%esp
+    4436:	85 c0                	test   %eax,%eax
+    4438:	78 0a                	js     4444 <threadtest+0x1f4>
+      if(k == 1){
+    443a:	83 fb 01             	cmp    $0x1,%ebx
+    443d:	74 19                	je     4458 <threadtest+0x208>
+      exit();
+    443f:	e8 8c 16 00 00       	call   5ad0 <exit>
+      printf(1, "thread_create failed\n");
+    4444:	83 ec 08             	sub    $0x8,%esp
+    4447:	68 0e 79 00 00       	push   $0x790e
+    444c:	6a 01                	push   $0x1
+    444e:	e8 0d 1e 00 00       	call   6260 <printf>
+      exit();
+    4453:	e8 78 16 00 00       	call   5ad0 <exit>
+        exec("echo", args);
+    4458:	83 ec 08             	sub    $0x8,%esp
+    445b:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    445e:	50                   	push   %eax
+    445f:	68 98 66 00 00       	push   $0x6698
+    4464:	e8 87 16 00 00       	call   5af0 <exec>
+        printf(1, "exec echo failed\n");
+    4469:	5a                   	pop    %edx
+    446a:	59                   	pop    %ecx
+    446b:	68 15 67 00 00       	push   $0x6715
+    4470:	6a 01                	push   $0x1
+    4472:	e8 e9 1d 00 00       	call   6260 <printf>
+    4477:	83 c4 10             	add    $0x10,%esp
+    447a:	eb c3                	jmp    443f <threadtest+0x1ef>
+      printf(1, "thread_join failed\n");
+    447c:	83 ec 08             	sub    $0x8,%esp
+    447f:	68 24 79 00 00       	push   $0x7924
+    4484:	6a 01                	push   $0x1
+    4486:	e8 d5 1d 00 00       	call   6260 <printf>
+      exit();
+    448b:	e8 40 16 00 00       	call   5ad0 <exit>
+    printf(1, "thread's sbrk() not shared\n");
+    4490:	50                   	push   %eax
+    4491:	50                   	push   %eax
+    4492:	68 56 79 00 00       	push   $0x7956
+    4497:	6a 01                	push   $0x1
+    4499:	e8 c2 1d 00 00       	call   6260 <printf>
+    exit();
+    449e:	e8 2d 16 00 00       	call   5ad0 <exit>
+      printf(1, "fork failed\n");
+    44a3:	50                   	push   %eax
+    44a4:	50                   	push   %eax
+    44a5:	68 48 7e 00 00       	push   $0x7e48
+    44aa:	6a 01                	push   $0x1
+    44ac:	e8 af 1d 00 00       	call   6260 <printf>
+      exit();
+    44b1:	e8 1a 16 00 00       	call   5ad0 <exit>
+    printf(1, "thread's close() not shared\n");
+    44b6:	50                   	push   %eax
+    44b7:	50                   	push   %eax
+    44b8:	68 72 79 00 00       	push   $0x7972
+    44bd:	6a 01                	push   $0x1
+    44bf:	e8 9c 1d 00 00       	call   6260 <printf>
+    exit();
+    44c4:	e8 07 16 00 00       	call   5ad0 <exit>
+    printf(1, "thread_join found an extra thread\n");
+    44c9:	51                   	push   %ecx
+    44ca:	51                   	push   %ecx
+    44cb:	68 84 84 00 00       	push   $0x8484
+    44d0:	6a 01                	push   $0x1
+    44d2:	e8 89 1d 00 00       	call   6260 <printf>
+    exit();
+    44d7:	e8 f4 15 00 00       	call   5ad0 <exit>
+    printf(1, "threads counted %d, not 4000\n", tcount);
+    44dc:	52                   	push   %edx
+    44dd:	50                   	push   %eax
+    44de:	68 38 79 00 00       	push   $0x7938
+    44e3:	6a 01                	push   $0x1
+    44e5:	e8 76 1d 00 00       	call   6260 <printf>
+    exit();
+    44ea:	e8 e1 15 00 00       	call   5ad0 <exit>
+      printf(1, "read from pipe got data\n");
+    44ef:	50                   	push   %eax
+    44f0:	50                   	push   %eax
+    44f1:	68 8f 79 00 00       	push   $0x798f
+    44f6:	6a 01                	push   $0x1
+    44f8:	e8 63 1d 00 00       	call   6260 <printf>
+      exit();
+    44fd:	e8 ce 15 00 00       	call   5ad0 <exit>
+    4502:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4509:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00004510 <bigfile>:
+
+void
+bigfile(void)
+{
+    4510:	55                   	push   %ebp
+    4511:	89 e5                	mov    %esp,%ebp
+    4513:	57                   	push   %edi
+    4514:	56                   	push   %esi
+    4515:	53                   	push   %ebx
+    4516:	83 ec 14             	sub    $0x14,%esp
+  int fd, i, total, cc;
+
+  printf(1, "bigfile test\n");
+    4519:	68 b3 79 00 00       	push   $0x79b3
+    451e:	6a 01                	push   $0x1
+    4520:	e8 3b 1d 00 00       	call   6260 <printf>
+
+  unlink("bigfile");
+    4525:	c7 04 24 cf 79 00 00 	movl   $0x79cf,(%esp)
+    452c:	e8 ff 17 00 00       	call   5d30 <unlink>
+  fd = open("bigfile", O_CREATE | O_RDWR);
+    4531:	58                   	pop    %eax
+    4532:	5a                   	pop    %edx
+    4533:	68 02 02 00 00       	push   $0x202
+    4538:	68 cf 79 00 00       	push   $0x79cf
+    453d:	e8 de 17 00 00       	call   5d20 <open>
+  if(fd < 0){
+    4542:	83 c4 10             	add    $0x10,%esp
+    4545:	85 c0                	test   %eax,%eax
+    4547:	0f 88 5e 01 00 00    	js     46ab <bigfile+0x19b>
+    454d:	89 c6                	mov    %eax,%esi
+    printf(1, "cannot create bigfile");
+    exit();
+  }
+  for(i = 0; i < 20; i++){
+    454f:	31 db                	xor    %ebx,%ebx
+    4551:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    memset(buf, i, 600);
+    4558:	83 ec 04             	sub    $0x4,%esp
+    455b:	68 58 02 00 00       	push   $0x258
+    4560:	53                   	push   %ebx
+    4561:	68 60 c9 00 00       	push   $0xc960
+    4566:	e8 55 13 00 00       	call   58c0 <memset>
+    if(write(fd, buf, 600) != 600){
+    456b:	83 c4 0c             	add    $0xc,%esp
+    456e:	68 58 02 00 00       	push   $0x258
+    4573:	68 60 c9 00 00       	push   $0xc960
+    4578:	56                   	push   %esi
+    4579:	e8 22 16 00 00       	call   5ba0 <write>
+    457e:	83 c4 10             	add    $0x10,%esp
+    4581:	3d 58 02 00 00       	cmp    $0x258,%eax
+    4586:	0f 85 f8 00 00 00    	jne    4684 <bigfile+0x174>
+  for(i = 0; i < 20; i++){
+    458c:	83 c3 01             	add    $0x1,%ebx
+    458f:	83 fb 14             	cmp    $0x14,%ebx
+    4592:	75 c4                	jne    4558 <bigfile+0x48>
+      printf(1, "write bigfile failed\n");
+      exit();
+    }
+  }
+  close(fd);
+    4594:	83 ec 0c             	sub    $0xc,%esp
+    4597:	56                   	push   %esi
+    4598:	e8 83 16 00 00       	call   5c20 <close>
+
+  fd = open("bigfile", 0);
+    459d:	5e                   	pop    %esi
+    459e:	5f                   	pop    %edi
+    459f:	6a 00                	push   $0x0
+    45a1:	68 cf 79 00 00       	push   $0x79cf
+    45a6:	e8 75 17 00 00       	call   5d20 <open>
+  if(fd < 0){
+    45ab:	83 c4 10             	add    $0x10,%esp
+  fd = open("bigfile", 0);
+    45ae:	89 c6                	mov    %eax,%esi
+  if(fd < 0){
+    45b0:	85 c0                	test   %eax,%eax
+    45b2:	0f 88 e0 00 00 00    	js     4698 <bigfile+0x188>
+    printf(1, "cannot open bigfile\n");
+    exit();
+  }
+  total = 0;
+    45b8:	31 db                	xor    %ebx,%ebx
+  for(i = 0; ; i++){
+    45ba:	31 ff                	xor    %edi,%edi
+    45bc:	eb 30                	jmp    45ee <bigfile+0xde>
+    45be:	66 90                	xchg   %ax,%ax
+      printf(1, "read bigfile failed\n");
+      exit();
+    }
+    if(cc == 0)
+      break;
+    if(cc != 300){
+    45c0:	3d 2c 01 00 00       	cmp    $0x12c,%eax
+    45c5:	0f 85 91 00 00 00    	jne    465c <bigfile+0x14c>
+      printf(1, "short read bigfile\n");
+      exit();
+    }
+    if(buf[0] != i/2 || buf[299] != i/2){
+    45cb:	89 fa                	mov    %edi,%edx
+    45cd:	0f be 05 60 c9 00 00 	movsbl 0xc960,%eax
+    45d4:	d1 fa                	sar    %edx
+    45d6:	39 d0                	cmp    %edx,%eax
+    45d8:	75 6e                	jne    4648 <bigfile+0x138>
+    45da:	0f be 15 8b ca 00 00 	movsbl 0xca8b,%edx
+    45e1:	39 d0                	cmp    %edx,%eax
+    45e3:	75 63                	jne    4648 <bigfile+0x138>
+      printf(1, "read bigfile wrong data\n");
+      exit();
+    }
+    total += cc;
+    45e5:	81 c3 2c 01 00 00    	add    $0x12c,%ebx
+  for(i = 0; ; i++){
+    45eb:	83 c7 01             	add    $0x1,%edi
+    cc = read(fd, buf, 300);
+    45ee:	83 ec 04             	sub    $0x4,%esp
+    45f1:	68 2c 01 00 00       	push   $0x12c
+    45f6:	68 60 c9 00 00       	push   $0xc960
+    45fb:	56                   	push   %esi
+    45fc:	e8 1f 15 00 00       	call   5b20 <read>
+    if(cc < 0){
+    4601:	83 c4 10             	add    $0x10,%esp
+    4604:	85 c0                	test   %eax,%eax
+    4606:	78 68                	js     4670 <bigfile+0x160>
+    if(cc == 0)
+    4608:	75 b6                	jne    45c0 <bigfile+0xb0>
+  }
+  close(fd);
+    460a:	83 ec 0c             	sub    $0xc,%esp
+    460d:	56                   	push   %esi
+    460e:	e8 0d 16 00 00       	call   5c20 <close>
+  if(total != 20*600){
+    4613:	83 c4 10             	add    $0x10,%esp
+    4616:	81 fb e0 2e 00 00    	cmp    $0x2ee0,%ebx
+    461c:	0f 85 9c 00 00 00    	jne    46be <bigfile+0x1ae>
+    printf(1, "read bigfile wrong total\n");
+    exit();
+  }
+  unlink("bigfile");
+    4622:	83 ec 0c             	sub    $0xc,%esp
+    4625:	68 cf 79 00 00       	push   $0x79cf
+    462a:	e8 01 17 00 00       	call   5d30 <unlink>
+
+  printf(1, "bigfile test ok\n");
+    462f:	58                   	pop    %eax
+    4630:	5a                   	pop    %edx
+    4631:	68 5e 7a 00 00       	push   $0x7a5e
+    4636:	6a 01                	push   $0x1
+    4638:	e8 23 1c 00 00       	call   6260 <printf>
+}
+    463d:	83 c4 10             	add    $0x10,%esp
+    4640:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    4643:	5b                   	pop    %ebx
+    4644:	5e                   	pop    %esi
+    4645:	5f                   	pop    %edi
+    4646:	5d                   	pop    %ebp
+    4647:	c3                   	ret
+      printf(1, "read bigfile wrong data\n");
+    4648:	83 ec 08             	sub    $0x8,%esp
+    464b:	68 2b 7a 00 00       	push   $0x7a2b
+    4650:	6a 01                	push   $0x1
+    4652:	e8 09 1c 00 00       	call   6260 <printf>
+      exit();
+    4657:	e8 74 14 00 00       	call   5ad0 <exit>
+      printf(1, "short read bigfile\n");
+    465c:	83 ec 08             	sub    $0x8,%esp
+    465f:	68 17 7a 00 00       	push   $0x7a17
+    4664:	6a 01                	push   $0x1
+    4666:	e8 f5 1b 00 00       	call   6260 <printf>
+      exit();
+    466b:	e8 60 14 00 00       	call   5ad0 <exit>
+      printf(1, "read bigfile failed\n");
+    4670:	83 ec 08             	sub    $0x8,%esp
+    4673:	68 02 7a 00 00       	push   $0x7a02
+    4678:	6a 01                	push   $0x1
+    467a:	e8 e1 1b 00 00       	call   6260 <printf>
+      exit();
+    467f:	e8 4c 14 00 00       	call   5ad0 <exit>
+      printf(1, "write bigfile failed\n");
+    4684:	83 ec 08             	sub    $0x8,%esp
+    4687:	68 d7 79 00 00       	push   $0x79d7
+    468c:	6a 01                	push   $0x1
+    468e:	e8 cd 1b 00 00       	call   6260 <printf>
+      exit();
+    4693:	e8 38 14 00 00       	call   5ad0 <exit>
+    printf(1, "cannot open bigfile\n");
+    4698:	53                   	push   %ebx
+    4699:	53                   	push   %ebx
+    469a:	68 ed 79 00 00       	push   $0x79ed
+    469f:	6a 01                	push   $0x1
+    46a1:	e8 ba 1b 00 00       	call   6260 <printf>
+    exit();
+    46a6:	e8 25 14 00 00       	call   5ad0 <exit>
+    printf(1, "cannot create bigfile");
+    46ab:	50                   	push   %eax
+    46ac:	50                   	push   %eax
+    46ad:	68 c1 79 00 00       	push   $0x79c1
+    46b2:	6a 01                	push   $0x1
+    46b4:	e8 a7 1b 00 00       	call   6260 <printf>
+    exit();
+    46b9:	e8 12 14 00 00       	call   5ad0 <exit>
+    printf(1, "read bigfile wrong total\n");
+    46be:	51                   	push   %ecx
+    46bf:	51                   	push   %ecx
+    46c0:	68 44 7a 00 00       	push   $0x7a44
+    46c5:	6a 01                	push   $0x1
+    46c7:	e8 94 1b 00 00       	call   6260 <printf>
+    exit();
+    46cc:	e8 ff 13 00 00       	call   5ad0 <exit>
+    46d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    46d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    46df:	90                   	nop
+
+000046e0 <fourteen>:
+
+void
+fourteen(void)
+{
+    46e0:	55                   	push   %ebp
+    46e1:	89 e5                	mov    %esp,%ebp
+    46e3:	83 ec 10             	sub    $0x10,%esp
+  int fd;
+
+  // DIRSIZ is 14.
+  printf(1, "fourteen test\n");
+    46e6:	68 6f 7a 00 00       	push   $0x7a6f
+    46eb:	6a 01                	push   $0x1
+    46ed:	e8 6e 1b 00 00       	call   6260 <printf>
+
+  if(mkdir("12345678901234") != 0){
+    46f2:	c7 04 24 aa 7a 00 00 	movl   $0x7aaa,(%esp)
+    46f9:	e8 4a 16 00 00       	call   5d48 <mkdir>
+    46fe:	83 c4 10             	add    $0x10,%esp
+    4701:	85 c0                	test   %eax,%eax
+    4703:	0f 85 97 00 00 00    	jne    47a0 <fourteen+0xc0>
+    printf(1, "mkdir 12345678901234 failed\n");
+    exit();
+  }
+  if(mkdir("12345678901234/123456789012345") != 0){
+    4709:	83 ec 0c             	sub    $0xc,%esp
+    470c:	68 a8 84 00 00       	push   $0x84a8
+    4711:	e8 32 16 00 00       	call   5d48 <mkdir>
+    4716:	83 c4 10             	add    $0x10,%esp
+    4719:	85 c0                	test   %eax,%eax
+    471b:	0f 85 de 00 00 00    	jne    47ff <fourteen+0x11f>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    exit();
+  }
+  fd = open("123456789012345/123456789012345/123456789012345", O_CREATE);
+    4721:	83 ec 08             	sub    $0x8,%esp
+    4724:	68 00 02 00 00       	push   $0x200
+    4729:	68 f8 84 00 00       	push   $0x84f8
+    472e:	e8 ed 15 00 00       	call   5d20 <open>
+  if(fd < 0){
+    4733:	83 c4 10             	add    $0x10,%esp
+    4736:	85 c0                	test   %eax,%eax
+    4738:	0f 88 ae 00 00 00    	js     47ec <fourteen+0x10c>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    exit();
+  }
+  close(fd);
+    473e:	83 ec 0c             	sub    $0xc,%esp
+    4741:	50                   	push   %eax
+    4742:	e8 d9 14 00 00       	call   5c20 <close>
+  fd = open("12345678901234/12345678901234/12345678901234", 0);
+    4747:	58                   	pop    %eax
+    4748:	5a                   	pop    %edx
+    4749:	6a 00                	push   $0x0
+    474b:	68 68 85 00 00       	push   $0x8568
+    4750:	e8 cb 15 00 00       	call   5d20 <open>
+  if(fd < 0){
+    4755:	83 c4 10             	add    $0x10,%esp
+    4758:	85 c0                	test   %eax,%eax
+    475a:	78 7d                	js     47d9 <fourteen+0xf9>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    exit();
+  }
+  close(fd);
+    475c:	83 ec 0c             	sub    $0xc,%esp
+    475f:	50                   	push   %eax
+    4760:	e8 bb 14 00 00       	call   5c20 <close>
+
+  if(mkdir("12345678901234/12345678901234") == 0){
+    4765:	c7 04 24 9b 7a 00 00 	movl   $0x7a9b,(%esp)
+    476c:	e8 d7 15 00 00       	call   5d48 <mkdir>
+    4771:	83 c4 10             	add    $0x10,%esp
+    4774:	85 c0                	test   %eax,%eax
+    4776:	74 4e                	je     47c6 <fourteen+0xe6>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    exit();
+  }
+  if(mkdir("123456789012345/12345678901234") == 0){
+    4778:	83 ec 0c             	sub    $0xc,%esp
+    477b:	68 04 86 00 00       	push   $0x8604
+    4780:	e8 c3 15 00 00       	call   5d48 <mkdir>
+    4785:	83 c4 10             	add    $0x10,%esp
+    4788:	85 c0                	test   %eax,%eax
+    478a:	74 27                	je     47b3 <fourteen+0xd3>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    exit();
+  }
+
+  printf(1, "fourteen ok\n");
+    478c:	83 ec 08             	sub    $0x8,%esp
+    478f:	68 b9 7a 00 00       	push   $0x7ab9
+    4794:	6a 01                	push   $0x1
+    4796:	e8 c5 1a 00 00       	call   6260 <printf>
+}
+    479b:	83 c4 10             	add    $0x10,%esp
+    479e:	c9                   	leave
+    479f:	c3                   	ret
+    printf(1, "mkdir 12345678901234 failed\n");
+    47a0:	50                   	push   %eax
+    47a1:	50                   	push   %eax
+    47a2:	68 7e 7a 00 00       	push   $0x7a7e
+    47a7:	6a 01                	push   $0x1
+    47a9:	e8 b2 1a 00 00       	call   6260 <printf>
+    exit();
+    47ae:	e8 1d 13 00 00       	call   5ad0 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    47b3:	50                   	push   %eax
+    47b4:	50                   	push   %eax
+    47b5:	68 24 86 00 00       	push   $0x8624
+    47ba:	6a 01                	push   $0x1
+    47bc:	e8 9f 1a 00 00       	call   6260 <printf>
+    exit();
+    47c1:	e8 0a 13 00 00       	call   5ad0 <exit>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    47c6:	52                   	push   %edx
+    47c7:	52                   	push   %edx
+    47c8:	68 d4 85 00 00       	push   $0x85d4
+    47cd:	6a 01                	push   $0x1
+    47cf:	e8 8c 1a 00 00       	call   6260 <printf>
+    exit();
+    47d4:	e8 f7 12 00 00       	call   5ad0 <exit>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    47d9:	51                   	push   %ecx
+    47da:	51                   	push   %ecx
+    47db:	68 98 85 00 00       	push   $0x8598
+    47e0:	6a 01                	push   $0x1
+    47e2:	e8 79 1a 00 00       	call   6260 <printf>
+    exit();
+    47e7:	e8 e4 12 00 00       	call   5ad0 <exit>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    47ec:	51                   	push   %ecx
+    47ed:	51                   	push   %ecx
+    47ee:	68 28 85 00 00       	push   $0x8528
+    47f3:	6a 01                	push   $0x1
+    47f5:	e8 66 1a 00 00       	call   6260 <printf>
+    exit();
+    47fa:	e8 d1 12 00 00       	call   5ad0 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    47ff:	50                   	push   %eax
+    4800:	50                   	push   %eax
+    4801:	68 c8 84 00 00       	push   $0x84c8
+    4806:	6a 01                	push   $0x1
+    4808:	e8 53 1a 00 00       	call   6260 <printf>
+    exit();
+    480d:	e8 be 12 00 00       	call   5ad0 <exit>
+    4812:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4819:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00004820 <rmdot>:
+
+void
+rmdot(void)
+{
+    4820:	55                   	push   %ebp
+    4821:	89 e5                	mov    %esp,%ebp
+    4823:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "rmdot test\n");
+    4826:	68 c6 7a 00 00       	push   $0x7ac6
+    482b:	6a 01                	push   $0x1
+    482d:	e8 2e 1a 00 00       	call   6260 <printf>
+  if(mkdir("dots") != 0){
+    4832:	c7 04 24 d2 7a 00 00 	movl   $0x7ad2,(%esp)
+    4839:	e8 0a 15 00 00       	call   5d48 <mkdir>
+    483e:	83 c4 10             	add    $0x10,%esp
+    4841:	85 c0                	test   %eax,%eax
+    4843:	0f 85 b0 00 00 00    	jne    48f9 <rmdot+0xd9>
+    printf(1, "mkdir dots failed\n");
+    exit();
+  }
+  if(chdir("dots") != 0){
+    4849:	83 ec 0c             	sub    $0xc,%esp
+    484c:	68 d2 7a 00 00       	push   $0x7ad2
+    4851:	e8 fa 14 00 00       	call   5d50 <chdir>
+    4856:	83 c4 10             	add    $0x10,%esp
+    4859:	85 c0                	test   %eax,%eax
+    485b:	0f 85 1d 01 00 00    	jne    497e <rmdot+0x15e>
+    printf(1, "chdir dots failed\n");
+    exit();
+  }
+  if(unlink(".") == 0){
+    4861:	83 ec 0c             	sub    $0xc,%esp
+    4864:	68 70 70 00 00       	push   $0x7070
+    4869:	e8 c2 14 00 00       	call   5d30 <unlink>
+    486e:	83 c4 10             	add    $0x10,%esp
+    4871:	85 c0                	test   %eax,%eax
+    4873:	0f 84 f2 00 00 00    	je     496b <rmdot+0x14b>
+    printf(1, "rm . worked!\n");
+    exit();
+  }
+  if(unlink("..") == 0){
+    4879:	83 ec 0c             	sub    $0xc,%esp
+    487c:	68 6f 70 00 00       	push   $0x706f
+    4881:	e8 aa 14 00 00       	call   5d30 <unlink>
+    4886:	83 c4 10             	add    $0x10,%esp
+    4889:	85 c0                	test   %eax,%eax
+    488b:	0f 84 c7 00 00 00    	je     4958 <rmdot+0x138>
+    printf(1, "rm .. worked!\n");
+    exit();
+  }
+  if(chdir("/") != 0){
+    4891:	83 ec 0c             	sub    $0xc,%esp
+    4894:	68 69 68 00 00       	push   $0x6869
+    4899:	e8 b2 14 00 00       	call   5d50 <chdir>
+    489e:	83 c4 10             	add    $0x10,%esp
+    48a1:	85 c0                	test   %eax,%eax
+    48a3:	0f 85 9c 00 00 00    	jne    4945 <rmdot+0x125>
+    printf(1, "chdir / failed\n");
+    exit();
+  }
+  if(unlink("dots/.") == 0){
+    48a9:	83 ec 0c             	sub    $0xc,%esp
+    48ac:	68 1a 7b 00 00       	push   $0x7b1a
+    48b1:	e8 7a 14 00 00       	call   5d30 <unlink>
+    48b6:	83 c4 10             	add    $0x10,%esp
+    48b9:	85 c0                	test   %eax,%eax
+    48bb:	74 75                	je     4932 <rmdot+0x112>
+    printf(1, "unlink dots/. worked!\n");
+    exit();
+  }
+  if(unlink("dots/..") == 0){
+    48bd:	83 ec 0c             	sub    $0xc,%esp
+    48c0:	68 38 7b 00 00       	push   $0x7b38
+    48c5:	e8 66 14 00 00       	call   5d30 <unlink>
+    48ca:	83 c4 10             	add    $0x10,%esp
+    48cd:	85 c0                	test   %eax,%eax
+    48cf:	74 4e                	je     491f <rmdot+0xff>
+    printf(1, "unlink dots/.. worked!\n");
+    exit();
+  }
+  if(unlink("dots") != 0){
+    48d1:	83 ec 0c             	sub    $0xc,%esp
+    48d4:	68 d2 7a 00 00       	push   $0x7ad2
+    48d9:	e8 52 14 00 00       	call   5d30 <unlink>
+    48de:	83 c4 10             	add    $0x10,%esp
+    48e1:	85 c0                	test   %eax,%eax
+    48e3:	75 27                	jne    490c <rmdot+0xec>
+    printf(1, "unlink dots failed!\n");
+    exit();
+  }
+  printf(1, "rmdot ok\n");
+    48e5:	83 ec 08             	sub    $0x8,%esp
+    48e8:	68 6d 7b 00 00       	push   $0x7b6d
+    48ed:	6a 01                	push   $0x1
+    48ef:	e8 6c 19 00 00       	call   6260 <printf>
+}
+    48f4:	83 c4 10             	add    $0x10,%esp
+    48f7:	c9                   	leave
+    48f8:	c3                   	ret
+    printf(1, "mkdir dots failed\n");
+    48f9:	50                   	push   %eax
+    48fa:	50                   	push   %eax
+    48fb:	68 d7 7a 00 00       	push   $0x7ad7
+    4900:	6a 01                	push   $0x1
+    4902:	e8 59 19 00 00       	call   6260 <printf>
+    exit();
+    4907:	e8 c4 11 00 00       	call   5ad0 <exit>
+    printf(1, "unlink dots failed!\n");
+    490c:	50                   	push   %eax
+    490d:	50                   	push   %eax
+    490e:	68 58 7b 00 00       	push   $0x7b58
+    4913:	6a 01                	push   $0x1
+    4915:	e8 46 19 00 00       	call   6260 <printf>
+    exit();
+    491a:	e8 b1 11 00 00       	call   5ad0 <exit>
+    printf(1, "unlink dots/.. worked!\n");
+    491f:	52                   	push   %edx
+    4920:	52                   	push   %edx
+    4921:	68 40 7b 00 00       	push   $0x7b40
+    4926:	6a 01                	push   $0x1
+    4928:	e8 33 19 00 00       	call   6260 <printf>
+    exit();
+    492d:	e8 9e 11 00 00       	call   5ad0 <exit>
+    printf(1, "unlink dots/. worked!\n");
+    4932:	51                   	push   %ecx
+    4933:	51                   	push   %ecx
+    4934:	68 21 7b 00 00       	push   $0x7b21
+    4939:	6a 01                	push   $0x1
+    493b:	e8 20 19 00 00       	call   6260 <printf>
+    exit();
+    4940:	e8 8b 11 00 00       	call   5ad0 <exit>
+    printf(1, "chdir / failed\n");
+    4945:	50                   	push   %eax
+    4946:	50                   	push   %eax
+    4947:	68 6b 68 00 00       	push   $0x686b
+    494c:	6a 01                	push   $0x1
+    494e:	e8 0d 19 00 00       	call   6260 <printf>
+    exit();
+    4953:	e8 78 11 00 00       	call   5ad0 <exit>
+    printf(1, "rm .. worked!\n");
+    4958:	50                   	push   %eax
+    4959:	50                   	push   %eax
+    495a:	68 0b 7b 00 00       	push   $0x7b0b
+    495f:	6a 01                	push   $0x1
+    4961:	e8 fa 18 00 00       	call   6260 <printf>
+    exit();
+    4966:	e8 65 11 00 00       	call   5ad0 <exit>
+    printf(1, "rm . worked!\n");
+    496b:	50                   	push   %eax
+    496c:	50                   	push   %eax
+    496d:	68 fd 7a 00 00       	push   $0x7afd
+    4972:	6a 01                	push   $0x1
+    4974:	e8 e7 18 00 00       	call   6260 <printf>
+    exit();
+    4979:	e8 52 11 00 00       	call   5ad0 <exit>
+    printf(1, "chdir dots failed\n");
+    497e:	50                   	push   %eax
+    497f:	50                   	push   %eax
+    4980:	68 ea 7a 00 00       	push   $0x7aea
+    4985:	6a 01                	push   $0x1
+    4987:	e8 d4 18 00 00       	call   6260 <printf>
+    exit();
+    498c:	e8 3f 11 00 00       	call   5ad0 <exit>
+    4991:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4998:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    499f:	90                   	nop
+
+000049a0 <dirfile>:
+
+void
+dirfile(void)
+{
+    49a0:	55                   	push   %ebp
+    49a1:	89 e5                	mov    %esp,%ebp
+    49a3:	53                   	push   %ebx
+    49a4:	83 ec 0c             	sub    $0xc,%esp
+  int fd;
+
+  printf(1, "dir vs file\n");
+    49a7:	68 77 7b 00 00       	push   $0x7b77
+    49ac:	6a 01                	push   $0x1
+    49ae:	e8 ad 18 00 00       	call   6260 <printf>
+
+  fd = open("dirfile", O_CREATE);
+    49b3:	5b                   	pop    %ebx
+    49b4:	58                   	pop    %eax
+    49b5:	68 00 02 00 00       	push   $0x200
+    49ba:	68 84 7b 00 00       	push   $0x7b84
+    49bf:	e8 5c 13 00 00       	call   5d20 <open>
+  if(fd < 0){
+    49c4:	83 c4 10             	add    $0x10,%esp
+    49c7:	85 c0                	test   %eax,%eax
+    49c9:	0f 88 43 01 00 00    	js     4b12 <dirfile+0x172>
+    printf(1, "create dirfile failed\n");
+    exit();
+  }
+  close(fd);
+    49cf:	83 ec 0c             	sub    $0xc,%esp
+    49d2:	50                   	push   %eax
+    49d3:	e8 48 12 00 00       	call   5c20 <close>
+  if(chdir("dirfile") == 0){
+    49d8:	c7 04 24 84 7b 00 00 	movl   $0x7b84,(%esp)
+    49df:	e8 6c 13 00 00       	call   5d50 <chdir>
+    49e4:	83 c4 10             	add    $0x10,%esp
+    49e7:	85 c0                	test   %eax,%eax
+    49e9:	0f 84 10 01 00 00    	je     4aff <dirfile+0x15f>
+    printf(1, "chdir dirfile succeeded!\n");
+    exit();
+  }
+  fd = open("dirfile/xx", 0);
+    49ef:	83 ec 08             	sub    $0x8,%esp
+    49f2:	6a 00                	push   $0x0
+    49f4:	68 bd 7b 00 00       	push   $0x7bbd
+    49f9:	e8 22 13 00 00       	call   5d20 <open>
+  if(fd >= 0){
+    49fe:	83 c4 10             	add    $0x10,%esp
+    4a01:	85 c0                	test   %eax,%eax
+    4a03:	0f 89 e3 00 00 00    	jns    4aec <dirfile+0x14c>
+    printf(1, "create dirfile/xx succeeded!\n");
+    exit();
+  }
+  fd = open("dirfile/xx", O_CREATE);
+    4a09:	83 ec 08             	sub    $0x8,%esp
+    4a0c:	68 00 02 00 00       	push   $0x200
+    4a11:	68 bd 7b 00 00       	push   $0x7bbd
+    4a16:	e8 05 13 00 00       	call   5d20 <open>
+  if(fd >= 0){
+    4a1b:	83 c4 10             	add    $0x10,%esp
+    4a1e:	85 c0                	test   %eax,%eax
+    4a20:	0f 89 c6 00 00 00    	jns    4aec <dirfile+0x14c>
+    printf(1, "create dirfile/xx succeeded!\n");
+    exit();
+  }
+  if(mkdir("dirfile/xx") == 0){
+    4a26:	83 ec 0c             	sub    $0xc,%esp
+    4a29:	68 bd 7b 00 00       	push   $0x7bbd
+    4a2e:	e8 15 13 00 00       	call   5d48 <mkdir>
+    4a33:	83 c4 10             	add    $0x10,%esp
+    4a36:	85 c0                	test   %eax,%eax
+    4a38:	0f 84 46 01 00 00    	je     4b84 <dirfile+0x1e4>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    exit();
+  }
+  if(unlink("dirfile/xx") == 0){
+    4a3e:	83 ec 0c             	sub    $0xc,%esp
+    4a41:	68 bd 7b 00 00       	push   $0x7bbd
+    4a46:	e8 e5 12 00 00       	call   5d30 <unlink>
+    4a4b:	83 c4 10             	add    $0x10,%esp
+    4a4e:	85 c0                	test   %eax,%eax
+    4a50:	0f 84 1b 01 00 00    	je     4b71 <dirfile+0x1d1>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    exit();
+  }
+  if(link("README", "dirfile/xx") == 0){
+    4a56:	83 ec 08             	sub    $0x8,%esp
+    4a59:	68 bd 7b 00 00       	push   $0x7bbd
+    4a5e:	68 21 7c 00 00       	push   $0x7c21
+    4a63:	e8 d8 12 00 00       	call   5d40 <link>
+    4a68:	83 c4 10             	add    $0x10,%esp
+    4a6b:	85 c0                	test   %eax,%eax
+    4a6d:	0f 84 eb 00 00 00    	je     4b5e <dirfile+0x1be>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    exit();
+  }
+  if(unlink("dirfile") != 0){
+    4a73:	83 ec 0c             	sub    $0xc,%esp
+    4a76:	68 84 7b 00 00       	push   $0x7b84
+    4a7b:	e8 b0 12 00 00       	call   5d30 <unlink>
+    4a80:	83 c4 10             	add    $0x10,%esp
+    4a83:	85 c0                	test   %eax,%eax
+    4a85:	0f 85 c0 00 00 00    	jne    4b4b <dirfile+0x1ab>
+    printf(1, "unlink dirfile failed!\n");
+    exit();
+  }
+
+  fd = open(".", O_RDWR);
+    4a8b:	83 ec 08             	sub    $0x8,%esp
+    4a8e:	6a 02                	push   $0x2
+    4a90:	68 70 70 00 00       	push   $0x7070
+    4a95:	e8 86 12 00 00       	call   5d20 <open>
+  if(fd >= 0){
+    4a9a:	83 c4 10             	add    $0x10,%esp
+    4a9d:	85 c0                	test   %eax,%eax
+    4a9f:	0f 89 93 00 00 00    	jns    4b38 <dirfile+0x198>
+    printf(1, "open . for writing succeeded!\n");
+    exit();
+  }
+  fd = open(".", 0);
+    4aa5:	83 ec 08             	sub    $0x8,%esp
+    4aa8:	6a 00                	push   $0x0
+    4aaa:	68 70 70 00 00       	push   $0x7070
+    4aaf:	e8 6c 12 00 00       	call   5d20 <open>
+  if(write(fd, "x", 1) > 0){
+    4ab4:	83 c4 0c             	add    $0xc,%esp
+    4ab7:	6a 01                	push   $0x1
+  fd = open(".", 0);
+    4ab9:	89 c3                	mov    %eax,%ebx
+  if(write(fd, "x", 1) > 0){
+    4abb:	68 53 71 00 00       	push   $0x7153
+    4ac0:	50                   	push   %eax
+    4ac1:	e8 da 10 00 00       	call   5ba0 <write>
+    4ac6:	83 c4 10             	add    $0x10,%esp
+    4ac9:	85 c0                	test   %eax,%eax
+    4acb:	7f 58                	jg     4b25 <dirfile+0x185>
+    printf(1, "write . succeeded!\n");
+    exit();
+  }
+  close(fd);
+    4acd:	83 ec 0c             	sub    $0xc,%esp
+    4ad0:	53                   	push   %ebx
+    4ad1:	e8 4a 11 00 00       	call   5c20 <close>
+
+  printf(1, "dir vs file OK\n");
+    4ad6:	58                   	pop    %eax
+    4ad7:	5a                   	pop    %edx
+    4ad8:	68 54 7c 00 00       	push   $0x7c54
+    4add:	6a 01                	push   $0x1
+    4adf:	e8 7c 17 00 00       	call   6260 <printf>
+}
+    4ae4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4ae7:	83 c4 10             	add    $0x10,%esp
+    4aea:	c9                   	leave
+    4aeb:	c3                   	ret
+    printf(1, "create dirfile/xx succeeded!\n");
+    4aec:	50                   	push   %eax
+    4aed:	50                   	push   %eax
+    4aee:	68 c8 7b 00 00       	push   $0x7bc8
+    4af3:	6a 01                	push   $0x1
+    4af5:	e8 66 17 00 00       	call   6260 <printf>
+    exit();
+    4afa:	e8 d1 0f 00 00       	call   5ad0 <exit>
+    printf(1, "chdir dirfile succeeded!\n");
+    4aff:	52                   	push   %edx
+    4b00:	52                   	push   %edx
+    4b01:	68 a3 7b 00 00       	push   $0x7ba3
+    4b06:	6a 01                	push   $0x1
+    4b08:	e8 53 17 00 00       	call   6260 <printf>
+    exit();
+    4b0d:	e8 be 0f 00 00       	call   5ad0 <exit>
+    printf(1, "create dirfile failed\n");
+    4b12:	51                   	push   %ecx
+    4b13:	51                   	push   %ecx
+    4b14:	68 8c 7b 00 00       	push   $0x7b8c
+    4b19:	6a 01                	push   $0x1
+    4b1b:	e8 40 17 00 00       	call   6260 <printf>
+    exit();
+    4b20:	e8 ab 0f 00 00       	call   5ad0 <exit>
+    printf(1, "write . succeeded!\n");
+    4b25:	51                   	push   %ecx
+    4b26:	51                   	push   %ecx
+    4b27:	68 40 7c 00 00       	push   $0x7c40
+    4b2c:	6a 01                	push   $0x1
+    4b2e:	e8 2d 17 00 00       	call   6260 <printf>
+    exit();
+    4b33:	e8 98 0f 00 00       	call   5ad0 <exit>
+    printf(1, "open . for writing succeeded!\n");
+    4b38:	53                   	push   %ebx
+    4b39:	53                   	push   %ebx
+    4b3a:	68 78 86 00 00       	push   $0x8678
+    4b3f:	6a 01                	push   $0x1
+    4b41:	e8 1a 17 00 00       	call   6260 <printf>
+    exit();
+    4b46:	e8 85 0f 00 00       	call   5ad0 <exit>
+    printf(1, "unlink dirfile failed!\n");
+    4b4b:	50                   	push   %eax
+    4b4c:	50                   	push   %eax
+    4b4d:	68 28 7c 00 00       	push   $0x7c28
+    4b52:	6a 01                	push   $0x1
+    4b54:	e8 07 17 00 00       	call   6260 <printf>
+    exit();
+    4b59:	e8 72 0f 00 00       	call   5ad0 <exit>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    4b5e:	50                   	push   %eax
+    4b5f:	50                   	push   %eax
+    4b60:	68 58 86 00 00       	push   $0x8658
+    4b65:	6a 01                	push   $0x1
+    4b67:	e8 f4 16 00 00       	call   6260 <printf>
+    exit();
+    4b6c:	e8 5f 0f 00 00       	call   5ad0 <exit>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    4b71:	50                   	push   %eax
+    4b72:	50                   	push   %eax
+    4b73:	68 03 7c 00 00       	push   $0x7c03
+    4b78:	6a 01                	push   $0x1
+    4b7a:	e8 e1 16 00 00       	call   6260 <printf>
+    exit();
+    4b7f:	e8 4c 0f 00 00       	call   5ad0 <exit>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    4b84:	50                   	push   %eax
+    4b85:	50                   	push   %eax
+    4b86:	68 e6 7b 00 00       	push   $0x7be6
+    4b8b:	6a 01                	push   $0x1
+    4b8d:	e8 ce 16 00 00       	call   6260 <printf>
+    exit();
+    4b92:	e8 39 0f 00 00       	call   5ad0 <exit>
+    4b97:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4b9e:	66 90                	xchg   %ax,%ax
+
+00004ba0 <iref>:
+
+// test that iput() is called at the end of _namei()
+void
+iref(void)
+{
+    4ba0:	55                   	push   %ebp
+    4ba1:	89 e5                	mov    %esp,%ebp
+    4ba3:	53                   	push   %ebx
+  int i, fd;
+
+  printf(1, "empty file name\n");
+    4ba4:	bb 33 00 00 00       	mov    $0x33,%ebx
+{
+    4ba9:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "empty file name\n");
+    4bac:	68 64 7c 00 00       	push   $0x7c64
+    4bb1:	6a 01                	push   $0x1
+    4bb3:	e8 a8 16 00 00       	call   6260 <printf>
+    4bb8:	83 c4 10             	add    $0x10,%esp
+    4bbb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4bbf:	90                   	nop
+
+  // the 50 is NINODE
+  for(i = 0; i < 50 + 1; i++){
+    if(mkdir("irefd") != 0){
+    4bc0:	83 ec 0c             	sub    $0xc,%esp
+    4bc3:	68 75 7c 00 00       	push   $0x7c75
+    4bc8:	e8 7b 11 00 00       	call   5d48 <mkdir>
+    4bcd:	83 c4 10             	add    $0x10,%esp
+    4bd0:	85 c0                	test   %eax,%eax
+    4bd2:	0f 85 bb 00 00 00    	jne    4c93 <iref+0xf3>
+      printf(1, "mkdir irefd failed\n");
+      exit();
+    }
+    if(chdir("irefd") != 0){
+    4bd8:	83 ec 0c             	sub    $0xc,%esp
+    4bdb:	68 75 7c 00 00       	push   $0x7c75
+    4be0:	e8 6b 11 00 00       	call   5d50 <chdir>
+    4be5:	83 c4 10             	add    $0x10,%esp
+    4be8:	85 c0                	test   %eax,%eax
+    4bea:	0f 85 b7 00 00 00    	jne    4ca7 <iref+0x107>
+      printf(1, "chdir irefd failed\n");
+      exit();
+    }
+
+    mkdir("");
+    4bf0:	83 ec 0c             	sub    $0xc,%esp
+    4bf3:	68 1d 6c 00 00       	push   $0x6c1d
+    4bf8:	e8 4b 11 00 00       	call   5d48 <mkdir>
+    link("README", "");
+    4bfd:	59                   	pop    %ecx
+    4bfe:	58                   	pop    %eax
+    4bff:	68 1d 6c 00 00       	push   $0x6c1d
+    4c04:	68 21 7c 00 00       	push   $0x7c21
+    4c09:	e8 32 11 00 00       	call   5d40 <link>
+    fd = open("", O_CREATE);
+    4c0e:	58                   	pop    %eax
+    4c0f:	5a                   	pop    %edx
+    4c10:	68 00 02 00 00       	push   $0x200
+    4c15:	68 1d 6c 00 00       	push   $0x6c1d
+    4c1a:	e8 01 11 00 00       	call   5d20 <open>
+    if(fd >= 0)
+    4c1f:	83 c4 10             	add    $0x10,%esp
+    4c22:	85 c0                	test   %eax,%eax
+    4c24:	78 0c                	js     4c32 <iref+0x92>
+      close(fd);
+    4c26:	83 ec 0c             	sub    $0xc,%esp
+    4c29:	50                   	push   %eax
+    4c2a:	e8 f1 0f 00 00       	call   5c20 <close>
+    4c2f:	83 c4 10             	add    $0x10,%esp
+    fd = open("xx", O_CREATE);
+    4c32:	83 ec 08             	sub    $0x8,%esp
+    4c35:	68 00 02 00 00       	push   $0x200
+    4c3a:	68 52 71 00 00       	push   $0x7152
+    4c3f:	e8 dc 10 00 00       	call   5d20 <open>
+    if(fd >= 0)
+    4c44:	83 c4 10             	add    $0x10,%esp
+    4c47:	85 c0                	test   %eax,%eax
+    4c49:	78 0c                	js     4c57 <iref+0xb7>
+      close(fd);
+    4c4b:	83 ec 0c             	sub    $0xc,%esp
+    4c4e:	50                   	push   %eax
+    4c4f:	e8 cc 0f 00 00       	call   5c20 <close>
+    4c54:	83 c4 10             	add    $0x10,%esp
+    unlink("xx");
+    4c57:	83 ec 0c             	sub    $0xc,%esp
+    4c5a:	68 52 71 00 00       	push   $0x7152
+    4c5f:	e8 cc 10 00 00       	call   5d30 <unlink>
+  for(i = 0; i < 50 + 1; i++){
+    4c64:	83 c4 10             	add    $0x10,%esp
+    4c67:	83 eb 01             	sub    $0x1,%ebx
+    4c6a:	0f 85 50 ff ff ff    	jne    4bc0 <iref+0x20>
+  }
+
+  chdir("/");
+    4c70:	83 ec 0c             	sub    $0xc,%esp
+    4c73:	68 69 68 00 00       	push   $0x6869
+    4c78:	e8 d3 10 00 00       	call   5d50 <chdir>
+  printf(1, "empty file name OK\n");
+    4c7d:	58                   	pop    %eax
+    4c7e:	5a                   	pop    %edx
+    4c7f:	68 a3 7c 00 00       	push   $0x7ca3
+    4c84:	6a 01                	push   $0x1
+    4c86:	e8 d5 15 00 00       	call   6260 <printf>
+}
+    4c8b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4c8e:	83 c4 10             	add    $0x10,%esp
+    4c91:	c9                   	leave
+    4c92:	c3                   	ret
+      printf(1, "mkdir irefd failed\n");
+    4c93:	83 ec 08             	sub    $0x8,%esp
+    4c96:	68 7b 7c 00 00       	push   $0x7c7b
+    4c9b:	6a 01                	push   $0x1
+    4c9d:	e8 be 15 00 00       	call   6260 <printf>
+      exit();
+    4ca2:	e8 29 0e 00 00       	call   5ad0 <exit>
+      printf(1, "chdir irefd failed\n");
+    4ca7:	83 ec 08             	sub    $0x8,%esp
+    4caa:	68 8f 7c 00 00       	push   $0x7c8f
+    4caf:	6a 01                	push   $0x1
+    4cb1:	e8 aa 15 00 00       	call   6260 <printf>
+      exit();
+    4cb6:	e8 15 0e 00 00       	call   5ad0 <exit>
+    4cbb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4cbf:	90                   	nop
+
+00004cc0 <forktest>:
+// test that fork fails gracefully
+// the forktest binary also does this, but it runs out of proc entries first.
+// inside the bigger usertests binary, we run out of memory first.
+void
+forktest(void)
+{
+    4cc0:	55                   	push   %ebp
+    4cc1:	89 e5                	mov    %esp,%ebp
+    4cc3:	53                   	push   %ebx
+  int n, pid;
+
+  printf(1, "fork test\n");
+
+  for(n=0; n<1000; n++){
+    4cc4:	31 db                	xor    %ebx,%ebx
+{
+    4cc6:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "fork test\n");
+    4cc9:	68 b7 7c 00 00       	push   $0x7cb7
+    4cce:	6a 01                	push   $0x1
+    4cd0:	e8 8b 15 00 00       	call   6260 <printf>
+    4cd5:	83 c4 10             	add    $0x10,%esp
+    4cd8:	eb 13                	jmp    4ced <forktest+0x2d>
+    4cda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    pid = fork();
+    if(pid < 0)
+      break;
+    if(pid == 0)
+    4ce0:	74 4d                	je     4d2f <forktest+0x6f>
+  for(n=0; n<1000; n++){
+    4ce2:	83 c3 01             	add    $0x1,%ebx
+    4ce5:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+    4ceb:	74 6e                	je     4d5b <forktest+0x9b>
+    pid = fork();
+    4ced:	e8 ae 0d 00 00       	call   5aa0 <fork>
+    if(pid < 0)
+    4cf2:	85 c0                	test   %eax,%eax
+    4cf4:	79 ea                	jns    4ce0 <forktest+0x20>
+  if(n == 1000){
+    printf(1, "fork claimed to work 1000 times!\n");
+    exit();
+  }
+
+  for(; n > 0; n--){
+    4cf6:	85 db                	test   %ebx,%ebx
+    4cf8:	74 14                	je     4d0e <forktest+0x4e>
+    4cfa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(wait() < 0){
+    4d00:	e8 e3 0f 00 00       	call   5ce8 <wait>
+    4d05:	85 c0                	test   %eax,%eax
+    4d07:	78 2b                	js     4d34 <forktest+0x74>
+  for(; n > 0; n--){
+    4d09:	83 eb 01             	sub    $0x1,%ebx
+    4d0c:	75 f2                	jne    4d00 <forktest+0x40>
+      printf(1, "wait stopped early\n");
+      exit();
+    }
+  }
+
+  if(wait() != -1){
+    4d0e:	e8 d5 0f 00 00       	call   5ce8 <wait>
+    4d13:	83 f8 ff             	cmp    $0xffffffff,%eax
+    4d16:	75 30                	jne    4d48 <forktest+0x88>
+    printf(1, "wait got too many\n");
+    exit();
+  }
+
+  printf(1, "fork test OK\n");
+    4d18:	83 ec 08             	sub    $0x8,%esp
+    4d1b:	68 e9 7c 00 00       	push   $0x7ce9
+    4d20:	6a 01                	push   $0x1
+    4d22:	e8 39 15 00 00       	call   6260 <printf>
+}
+    4d27:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4d2a:	83 c4 10             	add    $0x10,%esp
+    4d2d:	c9                   	leave
+    4d2e:	c3                   	ret
+      exit();
+    4d2f:	e8 9c 0d 00 00       	call   5ad0 <exit>
+      printf(1, "wait stopped early\n");
+    4d34:	83 ec 08             	sub    $0x8,%esp
+    4d37:	68 c2 7c 00 00       	push   $0x7cc2
+    4d3c:	6a 01                	push   $0x1
+    4d3e:	e8 1d 15 00 00       	call   6260 <printf>
+      exit();
+    4d43:	e8 88 0d 00 00       	call   5ad0 <exit>
+    printf(1, "wait got too many\n");
+    4d48:	50                   	push   %eax
+    4d49:	50                   	push   %eax
+    4d4a:	68 d6 7c 00 00       	push   $0x7cd6
+    4d4f:	6a 01                	push   $0x1
+    4d51:	e8 0a 15 00 00       	call   6260 <printf>
+    exit();
+    4d56:	e8 75 0d 00 00       	call   5ad0 <exit>
+    printf(1, "fork claimed to work 1000 times!\n");
+    4d5b:	52                   	push   %edx
+    4d5c:	52                   	push   %edx
+    4d5d:	68 98 86 00 00       	push   $0x8698
+    4d62:	6a 01                	push   $0x1
+    4d64:	e8 f7 14 00 00       	call   6260 <printf>
+    exit();
+    4d69:	e8 62 0d 00 00       	call   5ad0 <exit>
+    4d6e:	66 90                	xchg   %ax,%ax
+
+00004d70 <sbrktest>:
+
+void
+sbrktest(void)
+{
+    4d70:	55                   	push   %ebp
+    4d71:	89 e5                	mov    %esp,%ebp
+    4d73:	57                   	push   %edi
+    4d74:	56                   	push   %esi
+  oldbrk = sbrk(0);
+
+  // can one sbrk() less than a page?
+  a = sbrk(0);
+  int i;
+  for(i = 0; i < 5000; i++){
+    4d75:	31 f6                	xor    %esi,%esi
+{
+    4d77:	53                   	push   %ebx
+    4d78:	83 ec 64             	sub    $0x64,%esp
+  printf(stdout, "sbrk test\n");
+    4d7b:	68 f7 7c 00 00       	push   $0x7cf7
+    4d80:	ff 35 04 a0 00 00    	push   0xa004
+    4d86:	e8 d5 14 00 00       	call   6260 <printf>
+  oldbrk = sbrk(0);
+    4d8b:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    4d92:	e8 d1 0f 00 00       	call   5d68 <sbrk>
+    4d97:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  a = sbrk(0);
+    4d9a:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    4da1:	e8 c2 0f 00 00       	call   5d68 <sbrk>
+    4da6:	83 c4 10             	add    $0x10,%esp
+    4da9:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < 5000; i++){
+    4dab:	eb 05                	jmp    4db2 <sbrktest+0x42>
+    4dad:	8d 76 00             	lea    0x0(%esi),%esi
+    if(b != a){
+      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+      exit();
+    }
+    *b = 1;
+    a = b + 1;
+    4db0:	89 c3                	mov    %eax,%ebx
+    b = sbrk(1);
+    4db2:	83 ec 0c             	sub    $0xc,%esp
+    4db5:	6a 01                	push   $0x1
+    4db7:	e8 ac 0f 00 00       	call   5d68 <sbrk>
+    if(b != a){
+    4dbc:	83 c4 10             	add    $0x10,%esp
+    4dbf:	39 d8                	cmp    %ebx,%eax
+    4dc1:	0f 85 9c 02 00 00    	jne    5063 <sbrktest+0x2f3>
+  for(i = 0; i < 5000; i++){
+    4dc7:	83 c6 01             	add    $0x1,%esi
+    *b = 1;
+    4dca:	c6 03 01             	movb   $0x1,(%ebx)
+    a = b + 1;
+    4dcd:	8d 43 01             	lea    0x1(%ebx),%eax
+  for(i = 0; i < 5000; i++){
+    4dd0:	81 fe 88 13 00 00    	cmp    $0x1388,%esi
+    4dd6:	75 d8                	jne    4db0 <sbrktest+0x40>
+  }
+  pid = fork();
+    4dd8:	e8 c3 0c 00 00       	call   5aa0 <fork>
+    4ddd:	89 c6                	mov    %eax,%esi
+  if(pid < 0){
+    4ddf:	85 c0                	test   %eax,%eax
+    4de1:	0f 88 02 03 00 00    	js     50e9 <sbrktest+0x379>
+    printf(stdout, "sbrk test fork failed\n");
+    exit();
+  }
+  c = sbrk(1);
+    4de7:	83 ec 0c             	sub    $0xc,%esp
+  c = sbrk(1);
+  if(c != a + 1){
+    4dea:	83 c3 02             	add    $0x2,%ebx
+  c = sbrk(1);
+    4ded:	6a 01                	push   $0x1
+    4def:	e8 74 0f 00 00       	call   5d68 <sbrk>
+  c = sbrk(1);
+    4df4:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    4dfb:	e8 68 0f 00 00       	call   5d68 <sbrk>
+  if(c != a + 1){
+    4e00:	83 c4 10             	add    $0x10,%esp
+    4e03:	39 c3                	cmp    %eax,%ebx
+    4e05:	0f 85 3b 03 00 00    	jne    5146 <sbrktest+0x3d6>
+    printf(stdout, "sbrk test failed post-fork\n");
+    exit();
+  }
+  if(pid == 0)
+    4e0b:	85 f6                	test   %esi,%esi
+    4e0d:	0f 84 2e 03 00 00    	je     5141 <sbrktest+0x3d1>
+    exit();
+  wait();
+    4e13:	e8 d0 0e 00 00       	call   5ce8 <wait>
+
+  // can one grow address space to something big?
+#define BIG (100*1024*1024)
+  a = sbrk(0);
+    4e18:	83 ec 0c             	sub    $0xc,%esp
+    4e1b:	6a 00                	push   $0x0
+    4e1d:	e8 46 0f 00 00       	call   5d68 <sbrk>
+    4e22:	89 c3                	mov    %eax,%ebx
+  amt = (BIG) - (uint)a;
+    4e24:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    4e29:	29 d8                	sub    %ebx,%eax
+  p = sbrk(amt);
+    4e2b:	89 04 24             	mov    %eax,(%esp)
+    4e2e:	e8 35 0f 00 00       	call   5d68 <sbrk>
+  if (p != a) {
+    4e33:	83 c4 10             	add    $0x10,%esp
+    4e36:	39 c3                	cmp    %eax,%ebx
+    4e38:	0f 85 94 02 00 00    	jne    50d2 <sbrktest+0x362>
+  }
+  lastaddr = (char*) (BIG-1);
+  *lastaddr = 99;
+
+  // can one de-allocate?
+  a = sbrk(0);
+    4e3e:	83 ec 0c             	sub    $0xc,%esp
+  *lastaddr = 99;
+    4e41:	c6 05 ff ff 3f 06 63 	movb   $0x63,0x63fffff
+  a = sbrk(0);
+    4e48:	6a 00                	push   $0x0
+    4e4a:	e8 19 0f 00 00       	call   5d68 <sbrk>
+  c = sbrk(-4096);
+    4e4f:	c7 04 24 00 f0 ff ff 	movl   $0xfffff000,(%esp)
+  a = sbrk(0);
+    4e56:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-4096);
+    4e58:	e8 0b 0f 00 00       	call   5d68 <sbrk>
+  if(c == (char*)0xffffffff){
+    4e5d:	83 c4 10             	add    $0x10,%esp
+    4e60:	83 f8 ff             	cmp    $0xffffffff,%eax
+    4e63:	0f 84 22 03 00 00    	je     518b <sbrktest+0x41b>
+    printf(stdout, "sbrk could not deallocate\n");
+    exit();
+  }
+  c = sbrk(0);
+    4e69:	83 ec 0c             	sub    $0xc,%esp
+    4e6c:	6a 00                	push   $0x0
+    4e6e:	e8 f5 0e 00 00       	call   5d68 <sbrk>
+  if(c != a - 4096){
+    4e73:	8d 93 00 f0 ff ff    	lea    -0x1000(%ebx),%edx
+    4e79:	83 c4 10             	add    $0x10,%esp
+    4e7c:	39 d0                	cmp    %edx,%eax
+    4e7e:	0f 85 f0 02 00 00    	jne    5174 <sbrktest+0x404>
+    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    exit();
+  }
+
+  // can one re-allocate that page?
+  a = sbrk(0);
+    4e84:	83 ec 0c             	sub    $0xc,%esp
+    4e87:	6a 00                	push   $0x0
+    4e89:	e8 da 0e 00 00       	call   5d68 <sbrk>
+  c = sbrk(4096);
+    4e8e:	c7 04 24 00 10 00 00 	movl   $0x1000,(%esp)
+  a = sbrk(0);
+    4e95:	89 c3                	mov    %eax,%ebx
+  c = sbrk(4096);
+    4e97:	e8 cc 0e 00 00       	call   5d68 <sbrk>
+  if(c != a || sbrk(0) != a + 4096){
+    4e9c:	83 c4 10             	add    $0x10,%esp
+  c = sbrk(4096);
+    4e9f:	89 c6                	mov    %eax,%esi
+  if(c != a || sbrk(0) != a + 4096){
+    4ea1:	39 c3                	cmp    %eax,%ebx
+    4ea3:	0f 85 b4 02 00 00    	jne    515d <sbrktest+0x3ed>
+    4ea9:	83 ec 0c             	sub    $0xc,%esp
+    4eac:	6a 00                	push   $0x0
+    4eae:	e8 b5 0e 00 00       	call   5d68 <sbrk>
+    4eb3:	8d 93 00 10 00 00    	lea    0x1000(%ebx),%edx
+    4eb9:	83 c4 10             	add    $0x10,%esp
+    4ebc:	39 c2                	cmp    %eax,%edx
+    4ebe:	0f 85 99 02 00 00    	jne    515d <sbrktest+0x3ed>
+    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    exit();
+  }
+  if(*lastaddr == 99){
+    4ec4:	80 3d ff ff 3f 06 63 	cmpb   $0x63,0x63fffff
+    4ecb:	0f 84 2f 02 00 00    	je     5100 <sbrktest+0x390>
+    // should be zero
+    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    exit();
+  }
+
+  a = sbrk(0);
+    4ed1:	83 ec 0c             	sub    $0xc,%esp
+    4ed4:	6a 00                	push   $0x0
+    4ed6:	e8 8d 0e 00 00       	call   5d68 <sbrk>
+  c = sbrk(-(sbrk(0) - oldbrk));
+    4edb:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  a = sbrk(0);
+    4ee2:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-(sbrk(0) - oldbrk));
+    4ee4:	e8 7f 0e 00 00       	call   5d68 <sbrk>
+    4ee9:	89 c2                	mov    %eax,%edx
+    4eeb:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    4eee:	29 d0                	sub    %edx,%eax
+    4ef0:	89 04 24             	mov    %eax,(%esp)
+    4ef3:	e8 70 0e 00 00       	call   5d68 <sbrk>
+  if(c != a){
+    4ef8:	83 c4 10             	add    $0x10,%esp
+    4efb:	39 c3                	cmp    %eax,%ebx
+    4efd:	0f 85 b8 01 00 00    	jne    50bb <sbrktest+0x34b>
+    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    exit();
+  }
+
+  // can we read the kernel's memory?
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    4f03:	bb 00 00 00 80       	mov    $0x80000000,%ebx
+    4f08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4f0f:	90                   	nop
+    ppid = getpid();
+    4f10:	e8 4b 0e 00 00       	call   5d60 <getpid>
+    4f15:	89 c6                	mov    %eax,%esi
+    pid = fork();
+    4f17:	e8 84 0b 00 00       	call   5aa0 <fork>
+    if(pid < 0){
+    4f1c:	85 c0                	test   %eax,%eax
+    4f1e:	0f 88 5d 01 00 00    	js     5081 <sbrktest+0x311>
+      printf(stdout, "fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+    4f24:	0f 84 6f 01 00 00    	je     5099 <sbrktest+0x329>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+      kill(ppid);
+      exit();
+    }
+    wait();
+    4f2a:	e8 b9 0d 00 00       	call   5ce8 <wait>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    4f2f:	81 c3 50 c3 00 00    	add    $0xc350,%ebx
+    4f35:	81 fb 80 84 1e 80    	cmp    $0x801e8480,%ebx
+    4f3b:	75 d3                	jne    4f10 <sbrktest+0x1a0>
+  }
+
+  // if we run the system out of memory, does it clean up the last
+  // failed allocation?
+  if(pipe(fds) != 0){
+    4f3d:	83 ec 0c             	sub    $0xc,%esp
+    4f40:	8d 45 b8             	lea    -0x48(%ebp),%eax
+    4f43:	50                   	push   %eax
+    4f44:	e8 a7 0d 00 00       	call   5cf0 <pipe>
+    4f49:	83 c4 10             	add    $0x10,%esp
+    4f4c:	85 c0                	test   %eax,%eax
+    4f4e:	0f 85 da 01 00 00    	jne    512e <sbrktest+0x3be>
+    4f54:	8d 5d c0             	lea    -0x40(%ebp),%ebx
+    4f57:	8d 75 e8             	lea    -0x18(%ebp),%esi
+    4f5a:	89 df                	mov    %ebx,%edi
+    4f5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    printf(1, "pipe() failed\n");
+    exit();
+  }
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    if((pids[i] = fork()) == 0){
+    4f60:	e8 3b 0b 00 00       	call   5aa0 <fork>
+    4f65:	89 07                	mov    %eax,(%edi)
+    4f67:	85 c0                	test   %eax,%eax
+    4f69:	0f 84 91 00 00 00    	je     5000 <sbrktest+0x290>
+      sbrk(BIG - (uint)sbrk(0));
+      write(fds[1], "x", 1);
+      // sit around until killed
+      for(;;) sleep(1000);
+    }
+    if(pids[i] != -1)
+    4f6f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    4f72:	74 14                	je     4f88 <sbrktest+0x218>
+      read(fds[0], &scratch, 1);
+    4f74:	83 ec 04             	sub    $0x4,%esp
+    4f77:	8d 45 b7             	lea    -0x49(%ebp),%eax
+    4f7a:	6a 01                	push   $0x1
+    4f7c:	50                   	push   %eax
+    4f7d:	ff 75 b8             	push   -0x48(%ebp)
+    4f80:	e8 9b 0b 00 00       	call   5b20 <read>
+    4f85:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    4f88:	83 c7 04             	add    $0x4,%edi
+    4f8b:	39 f7                	cmp    %esi,%edi
+    4f8d:	75 d1                	jne    4f60 <sbrktest+0x1f0>
+  }
+  // if those failed allocations freed up the pages they did allocate,
+  // we'll be able to allocate here
+  c = sbrk(4096);
+    4f8f:	83 ec 0c             	sub    $0xc,%esp
+    4f92:	68 00 10 00 00       	push   $0x1000
+    4f97:	e8 cc 0d 00 00       	call   5d68 <sbrk>
+    4f9c:	83 c4 10             	add    $0x10,%esp
+    4f9f:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    4fa1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(pids[i] == -1)
+    4fa8:	8b 03                	mov    (%ebx),%eax
+    4faa:	83 f8 ff             	cmp    $0xffffffff,%eax
+    4fad:	74 11                	je     4fc0 <sbrktest+0x250>
+      continue;
+    kill(pids[i]);
+    4faf:	83 ec 0c             	sub    $0xc,%esp
+    4fb2:	50                   	push   %eax
+    4fb3:	e8 58 0d 00 00       	call   5d10 <kill>
+    wait();
+    4fb8:	e8 2b 0d 00 00       	call   5ce8 <wait>
+    4fbd:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    4fc0:	83 c3 04             	add    $0x4,%ebx
+    4fc3:	39 f3                	cmp    %esi,%ebx
+    4fc5:	75 e1                	jne    4fa8 <sbrktest+0x238>
+  }
+  if(c == (char*)0xffffffff){
+    4fc7:	83 ff ff             	cmp    $0xffffffff,%edi
+    4fca:	0f 84 47 01 00 00    	je     5117 <sbrktest+0x3a7>
+    printf(stdout, "failed sbrk leaked memory\n");
+    exit();
+  }
+
+  if(sbrk(0) > oldbrk)
+    4fd0:	83 ec 0c             	sub    $0xc,%esp
+    4fd3:	6a 00                	push   $0x0
+    4fd5:	e8 8e 0d 00 00       	call   5d68 <sbrk>
+    4fda:	83 c4 10             	add    $0x10,%esp
+    4fdd:	39 45 a4             	cmp    %eax,-0x5c(%ebp)
+    4fe0:	72 60                	jb     5042 <sbrktest+0x2d2>
+    sbrk(-(sbrk(0) - oldbrk));
+
+  printf(stdout, "sbrk test OK\n");
+    4fe2:	83 ec 08             	sub    $0x8,%esp
+    4fe5:	68 9f 7d 00 00       	push   $0x7d9f
+    4fea:	ff 35 04 a0 00 00    	push   0xa004
+    4ff0:	e8 6b 12 00 00       	call   6260 <printf>
+}
+    4ff5:	83 c4 10             	add    $0x10,%esp
+    4ff8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    4ffb:	5b                   	pop    %ebx
+    4ffc:	5e                   	pop    %esi
+    4ffd:	5f                   	pop    %edi
+    4ffe:	5d                   	pop    %ebp
+    4fff:	c3                   	ret
+      sbrk(BIG - (uint)sbrk(0));
+    5000:	83 ec 0c             	sub    $0xc,%esp
+    5003:	6a 00                	push   $0x0
+    5005:	e8 5e 0d 00 00       	call   5d68 <sbrk>
+    500a:	89 c2                	mov    %eax,%edx
+    500c:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    5011:	29 d0                	sub    %edx,%eax
+    5013:	89 04 24             	mov    %eax,(%esp)
+    5016:	e8 4d 0d 00 00       	call   5d68 <sbrk>
+      write(fds[1], "x", 1);
+    501b:	83 c4 0c             	add    $0xc,%esp
+    501e:	6a 01                	push   $0x1
+    5020:	68 53 71 00 00       	push   $0x7153
+    5025:	ff 75 bc             	push   -0x44(%ebp)
+    5028:	e8 73 0b 00 00       	call   5ba0 <write>
+    502d:	83 c4 10             	add    $0x10,%esp
+      for(;;) sleep(1000);
+    5030:	83 ec 0c             	sub    $0xc,%esp
+    5033:	68 e8 03 00 00       	push   $0x3e8
+    5038:	e8 33 0d 00 00       	call   5d70 <sleep>
+    503d:	83 c4 10             	add    $0x10,%esp
+    5040:	eb ee                	jmp    5030 <sbrktest+0x2c0>
+    sbrk(-(sbrk(0) - oldbrk));
+    5042:	83 ec 0c             	sub    $0xc,%esp
+    5045:	6a 00                	push   $0x0
+    5047:	e8 1c 0d 00 00       	call   5d68 <sbrk>
+    504c:	89 c2                	mov    %eax,%edx
+    504e:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    5051:	29 d0                	sub    %edx,%eax
+    5053:	89 04 24             	mov    %eax,(%esp)
+    5056:	e8 0d 0d 00 00       	call   5d68 <sbrk>
+    505b:	83 c4 10             	add    $0x10,%esp
+    505e:	e9 7f ff ff ff       	jmp    4fe2 <sbrktest+0x272>
+      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+    5063:	83 ec 0c             	sub    $0xc,%esp
+    5066:	50                   	push   %eax
+    5067:	53                   	push   %ebx
+    5068:	56                   	push   %esi
+    5069:	68 02 7d 00 00       	push   $0x7d02
+    506e:	ff 35 04 a0 00 00    	push   0xa004
+    5074:	e8 e7 11 00 00       	call   6260 <printf>
+      exit();
+    5079:	83 c4 20             	add    $0x20,%esp
+    507c:	e8 4f 0a 00 00       	call   5ad0 <exit>
+      printf(stdout, "fork failed\n");
+    5081:	83 ec 08             	sub    $0x8,%esp
+    5084:	68 48 7e 00 00       	push   $0x7e48
+    5089:	ff 35 04 a0 00 00    	push   0xa004
+    508f:	e8 cc 11 00 00       	call   6260 <printf>
+      exit();
+    5094:	e8 37 0a 00 00       	call   5ad0 <exit>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+    5099:	0f be 03             	movsbl (%ebx),%eax
+    509c:	50                   	push   %eax
+    509d:	53                   	push   %ebx
+    509e:	68 6b 7d 00 00       	push   $0x7d6b
+    50a3:	ff 35 04 a0 00 00    	push   0xa004
+    50a9:	e8 b2 11 00 00       	call   6260 <printf>
+      kill(ppid);
+    50ae:	89 34 24             	mov    %esi,(%esp)
+    50b1:	e8 5a 0c 00 00       	call   5d10 <kill>
+      exit();
+    50b6:	e8 15 0a 00 00       	call   5ad0 <exit>
+    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    50bb:	50                   	push   %eax
+    50bc:	53                   	push   %ebx
+    50bd:	68 8c 87 00 00       	push   $0x878c
+    50c2:	ff 35 04 a0 00 00    	push   0xa004
+    50c8:	e8 93 11 00 00       	call   6260 <printf>
+    exit();
+    50cd:	e8 fe 09 00 00       	call   5ad0 <exit>
+    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    50d2:	56                   	push   %esi
+    50d3:	56                   	push   %esi
+    50d4:	68 bc 86 00 00       	push   $0x86bc
+    50d9:	ff 35 04 a0 00 00    	push   0xa004
+    50df:	e8 7c 11 00 00       	call   6260 <printf>
+    exit();
+    50e4:	e8 e7 09 00 00       	call   5ad0 <exit>
+    printf(stdout, "sbrk test fork failed\n");
+    50e9:	50                   	push   %eax
+    50ea:	50                   	push   %eax
+    50eb:	68 1d 7d 00 00       	push   $0x7d1d
+    50f0:	ff 35 04 a0 00 00    	push   0xa004
+    50f6:	e8 65 11 00 00       	call   6260 <printf>
+    exit();
+    50fb:	e8 d0 09 00 00       	call   5ad0 <exit>
+    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    5100:	51                   	push   %ecx
+    5101:	51                   	push   %ecx
+    5102:	68 5c 87 00 00       	push   $0x875c
+    5107:	ff 35 04 a0 00 00    	push   0xa004
+    510d:	e8 4e 11 00 00       	call   6260 <printf>
+    exit();
+    5112:	e8 b9 09 00 00       	call   5ad0 <exit>
+    printf(stdout, "failed sbrk leaked memory\n");
+    5117:	50                   	push   %eax
+    5118:	50                   	push   %eax
+    5119:	68 84 7d 00 00       	push   $0x7d84
+    511e:	ff 35 04 a0 00 00    	push   0xa004
+    5124:	e8 37 11 00 00       	call   6260 <printf>
+    exit();
+    5129:	e8 a2 09 00 00       	call   5ad0 <exit>
+    printf(1, "pipe() failed\n");
+    512e:	52                   	push   %edx
+    512f:	52                   	push   %edx
+    5130:	68 33 6b 00 00       	push   $0x6b33
+    5135:	6a 01                	push   $0x1
+    5137:	e8 24 11 00 00       	call   6260 <printf>
+    exit();
+    513c:	e8 8f 09 00 00       	call   5ad0 <exit>
+    exit();
+    5141:	e8 8a 09 00 00       	call   5ad0 <exit>
+    printf(stdout, "sbrk test failed post-fork\n");
+    5146:	57                   	push   %edi
+    5147:	57                   	push   %edi
+    5148:	68 34 7d 00 00       	push   $0x7d34
+    514d:	ff 35 04 a0 00 00    	push   0xa004
+    5153:	e8 08 11 00 00       	call   6260 <printf>
+    exit();
+    5158:	e8 73 09 00 00       	call   5ad0 <exit>
+    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    515d:	56                   	push   %esi
+    515e:	53                   	push   %ebx
+    515f:	68 34 87 00 00       	push   $0x8734
+    5164:	ff 35 04 a0 00 00    	push   0xa004
+    516a:	e8 f1 10 00 00       	call   6260 <printf>
+    exit();
+    516f:	e8 5c 09 00 00       	call   5ad0 <exit>
+    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    5174:	50                   	push   %eax
+    5175:	53                   	push   %ebx
+    5176:	68 fc 86 00 00       	push   $0x86fc
+    517b:	ff 35 04 a0 00 00    	push   0xa004
+    5181:	e8 da 10 00 00       	call   6260 <printf>
+    exit();
+    5186:	e8 45 09 00 00       	call   5ad0 <exit>
+    printf(stdout, "sbrk could not deallocate\n");
+    518b:	53                   	push   %ebx
+    518c:	53                   	push   %ebx
+    518d:	68 50 7d 00 00       	push   $0x7d50
+    5192:	ff 35 04 a0 00 00    	push   0xa004
+    5198:	e8 c3 10 00 00       	call   6260 <printf>
+    exit();
+    519d:	e8 2e 09 00 00       	call   5ad0 <exit>
+    51a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    51a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000051b0 <validateint>:
+      "int %2\n\t"
+      "mov %%ebx, %%esp" :
+      "=a" (res) :
+      "a" (SYS_sleep), "n" (T_SYSCALL), "c" (p) :
+      "ebx");
+}
+    51b0:	c3                   	ret
+    51b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    51b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    51bf:	90                   	nop
+
+000051c0 <validatetest>:
+
+void
+validatetest(void)
+{
+    51c0:	55                   	push   %ebp
+    51c1:	89 e5                	mov    %esp,%ebp
+    51c3:	56                   	push   %esi
+  uint p;
+
+  printf(stdout, "validate test\n");
+  hi = 1100*1024;
+
+  for(p = 0; p <= (uint)hi; p += 4096){
+    51c4:	31 f6                	xor    %esi,%esi
+{
+    51c6:	53                   	push   %ebx
+  printf(stdout, "validate test\n");
+    51c7:	83 ec 08             	sub    $0x8,%esp
+    51ca:	68 ad 7d 00 00       	push   $0x7dad
+    51cf:	ff 35 04 a0 00 00    	push   0xa004
+    51d5:	e8 86 10 00 00       	call   6260 <printf>
+    51da:	83 c4 10             	add    $0x10,%esp
+    51dd:	8d 76 00             	lea    0x0(%esi),%esi
+    if((pid = fork()) == 0){
+    51e0:	e8 bb 08 00 00       	call   5aa0 <fork>
+    51e5:	89 c3                	mov    %eax,%ebx
+    51e7:	85 c0                	test   %eax,%eax
+    51e9:	74 63                	je     524e <validatetest+0x8e>
+      // try to crash the kernel by passing in a badly placed integer
+      validateint((int*)p);
+      exit();
+    }
+    sleep(0);
+    51eb:	83 ec 0c             	sub    $0xc,%esp
+    51ee:	6a 00                	push   $0x0
+    51f0:	e8 7b 0b 00 00       	call   5d70 <sleep>
+    sleep(0);
+    51f5:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    51fc:	e8 6f 0b 00 00       	call   5d70 <sleep>
+    kill(pid);
+    5201:	89 1c 24             	mov    %ebx,(%esp)
+    5204:	e8 07 0b 00 00       	call   5d10 <kill>
+    wait();
+    5209:	e8 da 0a 00 00       	call   5ce8 <wait>
+
+    // try to crash the kernel by passing in a bad string pointer
+    if(link("nosuchfile", (char*)p) != -1){
+    520e:	58                   	pop    %eax
+    520f:	5a                   	pop    %edx
+    5210:	56                   	push   %esi
+    5211:	68 bc 7d 00 00       	push   $0x7dbc
+    5216:	e8 25 0b 00 00       	call   5d40 <link>
+    521b:	83 c4 10             	add    $0x10,%esp
+    521e:	83 f8 ff             	cmp    $0xffffffff,%eax
+    5221:	75 30                	jne    5253 <validatetest+0x93>
+  for(p = 0; p <= (uint)hi; p += 4096){
+    5223:	81 c6 00 10 00 00    	add    $0x1000,%esi
+    5229:	81 fe 00 40 11 00    	cmp    $0x114000,%esi
+    522f:	75 af                	jne    51e0 <validatetest+0x20>
+      printf(stdout, "link should not succeed\n");
+      exit();
+    }
+  }
+
+  printf(stdout, "validate ok\n");
+    5231:	83 ec 08             	sub    $0x8,%esp
+    5234:	68 e0 7d 00 00       	push   $0x7de0
+    5239:	ff 35 04 a0 00 00    	push   0xa004
+    523f:	e8 1c 10 00 00       	call   6260 <printf>
+}
+    5244:	83 c4 10             	add    $0x10,%esp
+    5247:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    524a:	5b                   	pop    %ebx
+    524b:	5e                   	pop    %esi
+    524c:	5d                   	pop    %ebp
+    524d:	c3                   	ret
+      exit();
+    524e:	e8 7d 08 00 00       	call   5ad0 <exit>
+      printf(stdout, "link should not succeed\n");
+    5253:	83 ec 08             	sub    $0x8,%esp
+    5256:	68 c7 7d 00 00       	push   $0x7dc7
+    525b:	ff 35 04 a0 00 00    	push   0xa004
+    5261:	e8 fa 0f 00 00       	call   6260 <printf>
+      exit();
+    5266:	e8 65 08 00 00       	call   5ad0 <exit>
+    526b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    526f:	90                   	nop
+
+00005270 <bsstest>:
+
+// does unintialized data start out zero?
+char uninit[10000];
+void
+bsstest(void)
+{
+    5270:	55                   	push   %ebp
+    5271:	89 e5                	mov    %esp,%ebp
+    5273:	83 ec 10             	sub    $0x10,%esp
+  int i;
+
+  printf(stdout, "bss test\n");
+    5276:	68 ed 7d 00 00       	push   $0x7ded
+    527b:	ff 35 04 a0 00 00    	push   0xa004
+    5281:	e8 da 0f 00 00       	call   6260 <printf>
+    5286:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(uninit); i++){
+    5289:	31 c0                	xor    %eax,%eax
+    528b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    528f:	90                   	nop
+    if(uninit[i] != '\0'){
+    5290:	80 b8 40 a2 00 00 00 	cmpb   $0x0,0xa240(%eax)
+    5297:	75 22                	jne    52bb <bsstest+0x4b>
+  for(i = 0; i < sizeof(uninit); i++){
+    5299:	83 c0 01             	add    $0x1,%eax
+    529c:	3d 10 27 00 00       	cmp    $0x2710,%eax
+    52a1:	75 ed                	jne    5290 <bsstest+0x20>
+      printf(stdout, "bss test failed\n");
+      exit();
+    }
+  }
+  printf(stdout, "bss test ok\n");
+    52a3:	83 ec 08             	sub    $0x8,%esp
+    52a6:	68 08 7e 00 00       	push   $0x7e08
+    52ab:	ff 35 04 a0 00 00    	push   0xa004
+    52b1:	e8 aa 0f 00 00       	call   6260 <printf>
+}
+    52b6:	83 c4 10             	add    $0x10,%esp
+    52b9:	c9                   	leave
+    52ba:	c3                   	ret
+      printf(stdout, "bss test failed\n");
+    52bb:	83 ec 08             	sub    $0x8,%esp
+    52be:	68 f7 7d 00 00       	push   $0x7df7
+    52c3:	ff 35 04 a0 00 00    	push   0xa004
+    52c9:	e8 92 0f 00 00       	call   6260 <printf>
+      exit();
+    52ce:	e8 fd 07 00 00       	call   5ad0 <exit>
+    52d3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    52da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000052e0 <bigargtest>:
+// does exec return an error if the arguments
+// are larger than a page? or does it write
+// below the stack and wreck the instructions/data?
+void
+bigargtest(void)
+{
+    52e0:	55                   	push   %ebp
+    52e1:	89 e5                	mov    %esp,%ebp
+    52e3:	83 ec 14             	sub    $0x14,%esp
+  int pid, fd;
+
+  unlink("bigarg-ok");
+    52e6:	68 15 7e 00 00       	push   $0x7e15
+    52eb:	e8 40 0a 00 00       	call   5d30 <unlink>
+  pid = fork();
+    52f0:	e8 ab 07 00 00       	call   5aa0 <fork>
+  if(pid == 0){
+    52f5:	83 c4 10             	add    $0x10,%esp
+    52f8:	85 c0                	test   %eax,%eax
+    52fa:	74 44                	je     5340 <bigargtest+0x60>
+    exec("echo", args);
+    printf(stdout, "bigarg test ok\n");
+    fd = open("bigarg-ok", O_CREATE);
+    close(fd);
+    exit();
+  } else if(pid < 0){
+    52fc:	0f 88 c3 00 00 00    	js     53c5 <bigargtest+0xe5>
+    printf(stdout, "bigargtest: fork failed\n");
+    exit();
+  }
+  wait();
+    5302:	e8 e1 09 00 00       	call   5ce8 <wait>
+  fd = open("bigarg-ok", 0);
+    5307:	83 ec 08             	sub    $0x8,%esp
+    530a:	6a 00                	push   $0x0
+    530c:	68 15 7e 00 00       	push   $0x7e15
+    5311:	e8 0a 0a 00 00       	call   5d20 <open>
+  if(fd < 0){
+    5316:	83 c4 10             	add    $0x10,%esp
+    5319:	85 c0                	test   %eax,%eax
+    531b:	0f 88 8d 00 00 00    	js     53ae <bigargtest+0xce>
+    printf(stdout, "bigarg test failed!\n");
+    exit();
+  }
+  close(fd);
+    5321:	83 ec 0c             	sub    $0xc,%esp
+    5324:	50                   	push   %eax
+    5325:	e8 f6 08 00 00       	call   5c20 <close>
+  unlink("bigarg-ok");
+    532a:	c7 04 24 15 7e 00 00 	movl   $0x7e15,(%esp)
+    5331:	e8 fa 09 00 00       	call   5d30 <unlink>
+}
+    5336:	83 c4 10             	add    $0x10,%esp
+    5339:	c9                   	leave
+    533a:	c3                   	ret
+    533b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    533f:	90                   	nop
+      args[i] = "bigargs test: failed\n                                                                                                                                                                                                       ";
+    5340:	c7 04 85 60 e9 00 00 	movl   $0x87b0,0xe960(,%eax,4)
+    5347:	b0 87 00 00 
+    for(i = 0; i < MAXARG-1; i++)
+    534b:	83 c0 01             	add    $0x1,%eax
+    534e:	83 f8 1f             	cmp    $0x1f,%eax
+    5351:	75 ed                	jne    5340 <bigargtest+0x60>
+    args[MAXARG-1] = 0;
+    5353:	31 c9                	xor    %ecx,%ecx
+    5355:	89 0d dc e9 00 00    	mov    %ecx,0xe9dc
+    printf(stdout, "bigarg test\n");
+    535b:	50                   	push   %eax
+    535c:	50                   	push   %eax
+    535d:	68 1f 7e 00 00       	push   $0x7e1f
+    5362:	ff 35 04 a0 00 00    	push   0xa004
+    5368:	e8 f3 0e 00 00       	call   6260 <printf>
+    exec("echo", args);
+    536d:	58                   	pop    %eax
+    536e:	5a                   	pop    %edx
+    536f:	68 60 e9 00 00       	push   $0xe960
+    5374:	68 98 66 00 00       	push   $0x6698
+    5379:	e8 72 07 00 00       	call   5af0 <exec>
+    printf(stdout, "bigarg test ok\n");
+    537e:	59                   	pop    %ecx
+    537f:	58                   	pop    %eax
+    5380:	68 2c 7e 00 00       	push   $0x7e2c
+    5385:	ff 35 04 a0 00 00    	push   0xa004
+    538b:	e8 d0 0e 00 00       	call   6260 <printf>
+    fd = open("bigarg-ok", O_CREATE);
+    5390:	58                   	pop    %eax
+    5391:	5a                   	pop    %edx
+    5392:	68 00 02 00 00       	push   $0x200
+    5397:	68 15 7e 00 00       	push   $0x7e15
+    539c:	e8 7f 09 00 00       	call   5d20 <open>
+    close(fd);
+    53a1:	89 04 24             	mov    %eax,(%esp)
+    53a4:	e8 77 08 00 00       	call   5c20 <close>
+    exit();
+    53a9:	e8 22 07 00 00       	call   5ad0 <exit>
+    printf(stdout, "bigarg test failed!\n");
+    53ae:	50                   	push   %eax
+    53af:	50                   	push   %eax
+    53b0:	68 55 7e 00 00       	push   $0x7e55
+    53b5:	ff 35 04 a0 00 00    	push   0xa004
+    53bb:	e8 a0 0e 00 00       	call   6260 <printf>
+    exit();
+    53c0:	e8 0b 07 00 00       	call   5ad0 <exit>
+    printf(stdout, "bigargtest: fork failed\n");
+    53c5:	52                   	push   %edx
+    53c6:	52                   	push   %edx
+    53c7:	68 3c 7e 00 00       	push   $0x7e3c
+    53cc:	ff 35 04 a0 00 00    	push   0xa004
+    53d2:	e8 89 0e 00 00       	call   6260 <printf>
+    exit();
+    53d7:	e8 f4 06 00 00       	call   5ad0 <exit>
+    53dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000053e0 <fsfull>:
+
+// what happens when the file system runs out of blocks?
+// answer: balloc panics, so this test is not useful.
+void
+fsfull()
+{
+    53e0:	55                   	push   %ebp
+    53e1:	89 e5                	mov    %esp,%ebp
+    53e3:	57                   	push   %edi
+    53e4:	56                   	push   %esi
+  int nfiles;
+  int fsblocks = 0;
+
+  printf(1, "fsfull test\n");
+
+  for(nfiles = 0; ; nfiles++){
+    53e5:	31 f6                	xor    %esi,%esi
+{
+    53e7:	53                   	push   %ebx
+    53e8:	83 ec 54             	sub    $0x54,%esp
+  printf(1, "fsfull test\n");
+    53eb:	68 6a 7e 00 00       	push   $0x7e6a
+    53f0:	6a 01                	push   $0x1
+    53f2:	e8 69 0e 00 00       	call   6260 <printf>
+    53f7:	83 c4 10             	add    $0x10,%esp
+    53fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    char name[64];
+    name[0] = 'f';
+    name[1] = '0' + nfiles / 1000;
+    5400:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    name[3] = '0' + (nfiles % 100) / 10;
+    5405:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    name[4] = '0' + (nfiles % 10);
+    name[5] = '\0';
+    printf(1, "writing %s\n", name);
+    540a:	83 ec 04             	sub    $0x4,%esp
+    name[0] = 'f';
+    540d:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    5411:	f7 e6                	mul    %esi
+    name[5] = '\0';
+    5413:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    5417:	c1 ea 06             	shr    $0x6,%edx
+    541a:	8d 42 30             	lea    0x30(%edx),%eax
+    541d:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    5420:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    5426:	89 f2                	mov    %esi,%edx
+    5428:	29 c2                	sub    %eax,%edx
+    542a:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    542f:	f7 e2                	mul    %edx
+    name[3] = '0' + (nfiles % 100) / 10;
+    5431:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    5436:	c1 ea 05             	shr    $0x5,%edx
+    5439:	83 c2 30             	add    $0x30,%edx
+    543c:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    543f:	f7 e6                	mul    %esi
+    5441:	c1 ea 05             	shr    $0x5,%edx
+    5444:	6b c2 64             	imul   $0x64,%edx,%eax
+    5447:	89 f2                	mov    %esi,%edx
+    5449:	29 c2                	sub    %eax,%edx
+    544b:	89 d0                	mov    %edx,%eax
+    544d:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    544f:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    5451:	c1 ea 03             	shr    $0x3,%edx
+    5454:	83 c2 30             	add    $0x30,%edx
+    5457:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    545a:	f7 e1                	mul    %ecx
+    545c:	89 f0                	mov    %esi,%eax
+    545e:	c1 ea 03             	shr    $0x3,%edx
+    5461:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    5464:	01 d2                	add    %edx,%edx
+    5466:	29 d0                	sub    %edx,%eax
+    5468:	83 c0 30             	add    $0x30,%eax
+    546b:	88 45 ac             	mov    %al,-0x54(%ebp)
+    printf(1, "writing %s\n", name);
+    546e:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    5471:	50                   	push   %eax
+    5472:	68 77 7e 00 00       	push   $0x7e77
+    5477:	6a 01                	push   $0x1
+    5479:	e8 e2 0d 00 00       	call   6260 <printf>
+    int fd = open(name, O_CREATE|O_RDWR);
+    547e:	58                   	pop    %eax
+    547f:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    5482:	5a                   	pop    %edx
+    5483:	68 02 02 00 00       	push   $0x202
+    5488:	50                   	push   %eax
+    5489:	e8 92 08 00 00       	call   5d20 <open>
+    if(fd < 0){
+    548e:	83 c4 10             	add    $0x10,%esp
+    int fd = open(name, O_CREATE|O_RDWR);
+    5491:	89 c7                	mov    %eax,%edi
+    if(fd < 0){
+    5493:	85 c0                	test   %eax,%eax
+    5495:	78 4f                	js     54e6 <fsfull+0x106>
+      printf(1, "open %s failed\n", name);
+      break;
+    }
+    int total = 0;
+    5497:	31 db                	xor    %ebx,%ebx
+    5499:	eb 07                	jmp    54a2 <fsfull+0xc2>
+    549b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    549f:	90                   	nop
+    while(1){
+      int cc = write(fd, buf, 512);
+      if(cc < 512)
+        break;
+      total += cc;
+    54a0:	01 c3                	add    %eax,%ebx
+      int cc = write(fd, buf, 512);
+    54a2:	83 ec 04             	sub    $0x4,%esp
+    54a5:	68 00 02 00 00       	push   $0x200
+    54aa:	68 60 c9 00 00       	push   $0xc960
+    54af:	57                   	push   %edi
+    54b0:	e8 eb 06 00 00       	call   5ba0 <write>
+      if(cc < 512)
+    54b5:	83 c4 10             	add    $0x10,%esp
+    54b8:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+    54bd:	7f e1                	jg     54a0 <fsfull+0xc0>
+      fsblocks++;
+    }
+    printf(1, "wrote %d bytes\n", total);
+    54bf:	83 ec 04             	sub    $0x4,%esp
+    54c2:	53                   	push   %ebx
+    54c3:	68 93 7e 00 00       	push   $0x7e93
+    54c8:	6a 01                	push   $0x1
+    54ca:	e8 91 0d 00 00       	call   6260 <printf>
+    close(fd);
+    54cf:	89 3c 24             	mov    %edi,(%esp)
+    54d2:	e8 49 07 00 00       	call   5c20 <close>
+    if(total == 0)
+    54d7:	83 c4 10             	add    $0x10,%esp
+    54da:	85 db                	test   %ebx,%ebx
+    54dc:	74 1e                	je     54fc <fsfull+0x11c>
+  for(nfiles = 0; ; nfiles++){
+    54de:	83 c6 01             	add    $0x1,%esi
+    54e1:	e9 1a ff ff ff       	jmp    5400 <fsfull+0x20>
+      printf(1, "open %s failed\n", name);
+    54e6:	83 ec 04             	sub    $0x4,%esp
+    54e9:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    54ec:	50                   	push   %eax
+    54ed:	68 83 7e 00 00       	push   $0x7e83
+    54f2:	6a 01                	push   $0x1
+    54f4:	e8 67 0d 00 00       	call   6260 <printf>
+      break;
+    54f9:	83 c4 10             	add    $0x10,%esp
+  }
+
+  while(nfiles >= 0){
+    char name[64];
+    name[0] = 'f';
+    name[1] = '0' + nfiles / 1000;
+    54fc:	bf d3 4d 62 10       	mov    $0x10624dd3,%edi
+    name[2] = '0' + (nfiles % 1000) / 100;
+    5501:	bb 1f 85 eb 51       	mov    $0x51eb851f,%ebx
+    5506:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    550d:	8d 76 00             	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    5510:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    name[4] = '0' + (nfiles % 10);
+    name[5] = '\0';
+    unlink(name);
+    5512:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'f';
+    5515:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    5519:	f7 e7                	mul    %edi
+    name[5] = '\0';
+    551b:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    551f:	c1 ea 06             	shr    $0x6,%edx
+    5522:	8d 42 30             	lea    0x30(%edx),%eax
+    5525:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    5528:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    552e:	89 f2                	mov    %esi,%edx
+    5530:	29 c2                	sub    %eax,%edx
+    5532:	89 d0                	mov    %edx,%eax
+    5534:	f7 e3                	mul    %ebx
+    name[3] = '0' + (nfiles % 100) / 10;
+    5536:	89 f0                	mov    %esi,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    5538:	c1 ea 05             	shr    $0x5,%edx
+    553b:	83 c2 30             	add    $0x30,%edx
+    553e:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    5541:	f7 e3                	mul    %ebx
+    5543:	c1 ea 05             	shr    $0x5,%edx
+    5546:	6b ca 64             	imul   $0x64,%edx,%ecx
+    5549:	89 f2                	mov    %esi,%edx
+    554b:	29 ca                	sub    %ecx,%edx
+    554d:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    5552:	89 d0                	mov    %edx,%eax
+    5554:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    5556:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    5558:	c1 ea 03             	shr    $0x3,%edx
+    555b:	83 c2 30             	add    $0x30,%edx
+    555e:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    5561:	f7 e1                	mul    %ecx
+    5563:	89 f0                	mov    %esi,%eax
+    nfiles--;
+    5565:	83 ee 01             	sub    $0x1,%esi
+    name[4] = '0' + (nfiles % 10);
+    5568:	c1 ea 03             	shr    $0x3,%edx
+    556b:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    556e:	01 d2                	add    %edx,%edx
+    5570:	29 d0                	sub    %edx,%eax
+    5572:	83 c0 30             	add    $0x30,%eax
+    5575:	88 45 ac             	mov    %al,-0x54(%ebp)
+    unlink(name);
+    5578:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    557b:	50                   	push   %eax
+    557c:	e8 af 07 00 00       	call   5d30 <unlink>
+  while(nfiles >= 0){
+    5581:	83 c4 10             	add    $0x10,%esp
+    5584:	83 fe ff             	cmp    $0xffffffff,%esi
+    5587:	75 87                	jne    5510 <fsfull+0x130>
+  }
+
+  printf(1, "fsfull test finished\n");
+    5589:	83 ec 08             	sub    $0x8,%esp
+    558c:	68 a3 7e 00 00       	push   $0x7ea3
+    5591:	6a 01                	push   $0x1
+    5593:	e8 c8 0c 00 00       	call   6260 <printf>
+}
+    5598:	83 c4 10             	add    $0x10,%esp
+    559b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    559e:	5b                   	pop    %ebx
+    559f:	5e                   	pop    %esi
+    55a0:	5f                   	pop    %edi
+    55a1:	5d                   	pop    %ebp
+    55a2:	c3                   	ret
+    55a3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    55aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000055b0 <uio>:
+
+void
+uio()
+{
+    55b0:	55                   	push   %ebp
+    55b1:	89 e5                	mov    %esp,%ebp
+    55b3:	83 ec 10             	sub    $0x10,%esp
+
+  ushort port = 0;
+  uchar val = 0;
+  int pid;
+
+  printf(1, "uio test\n");
+    55b6:	68 b9 7e 00 00       	push   $0x7eb9
+    55bb:	6a 01                	push   $0x1
+    55bd:	e8 9e 0c 00 00       	call   6260 <printf>
+  pid = fork();
+    55c2:	e8 d9 04 00 00       	call   5aa0 <fork>
+  if(pid == 0){
+    55c7:	83 c4 10             	add    $0x10,%esp
+    55ca:	85 c0                	test   %eax,%eax
+    55cc:	74 1b                	je     55e9 <uio+0x39>
+    asm volatile("outb %0,%1"::"a"(val), "d" (port));
+    port = RTC_DATA;
+    asm volatile("inb %1,%0" : "=a" (val) : "d" (port));
+    printf(1, "uio: uio succeeded; test FAILED\n");
+    exit();
+  } else if(pid < 0){
+    55ce:	78 3d                	js     560d <uio+0x5d>
+    printf (1, "fork failed\n");
+    exit();
+  }
+  wait();
+    55d0:	e8 13 07 00 00       	call   5ce8 <wait>
+  printf(1, "uio test done\n");
+    55d5:	83 ec 08             	sub    $0x8,%esp
+    55d8:	68 c3 7e 00 00       	push   $0x7ec3
+    55dd:	6a 01                	push   $0x1
+    55df:	e8 7c 0c 00 00       	call   6260 <printf>
+}
+    55e4:	83 c4 10             	add    $0x10,%esp
+    55e7:	c9                   	leave
+    55e8:	c3                   	ret
+    asm volatile("outb %0,%1"::"a"(val), "d" (port));
+    55e9:	b8 09 00 00 00       	mov    $0x9,%eax
+    55ee:	ba 70 00 00 00       	mov    $0x70,%edx
+    55f3:	ee                   	out    %al,(%dx)
+    asm volatile("inb %1,%0" : "=a" (val) : "d" (port));
+    55f4:	ba 71 00 00 00       	mov    $0x71,%edx
+    55f9:	ec                   	in     (%dx),%al
+    printf(1, "uio: uio succeeded; test FAILED\n");
+    55fa:	52                   	push   %edx
+    55fb:	52                   	push   %edx
+    55fc:	68 90 88 00 00       	push   $0x8890
+    5601:	6a 01                	push   $0x1
+    5603:	e8 58 0c 00 00       	call   6260 <printf>
+    exit();
+    5608:	e8 c3 04 00 00       	call   5ad0 <exit>
+    printf (1, "fork failed\n");
+    560d:	50                   	push   %eax
+    560e:	50                   	push   %eax
+    560f:	68 48 7e 00 00       	push   $0x7e48
+    5614:	6a 01                	push   $0x1
+    5616:	e8 45 0c 00 00       	call   6260 <printf>
+    exit();
+    561b:	e8 b0 04 00 00       	call   5ad0 <exit>
+
+00005620 <argptest>:
+
+void argptest()
+{
+    5620:	55                   	push   %ebp
+    5621:	89 e5                	mov    %esp,%ebp
+    5623:	53                   	push   %ebx
+    5624:	83 ec 0c             	sub    $0xc,%esp
+  int fd;
+  fd = open("init", O_RDONLY);
+    5627:	6a 00                	push   $0x0
+    5629:	68 d2 7e 00 00       	push   $0x7ed2
+    562e:	e8 ed 06 00 00       	call   5d20 <open>
+  if (fd < 0) {
+    5633:	83 c4 10             	add    $0x10,%esp
+    5636:	85 c0                	test   %eax,%eax
+    5638:	78 39                	js     5673 <argptest+0x53>
+    printf(2, "open failed\n");
+    exit();
+  }
+  read(fd, sbrk(0) - 1, -1);
+    563a:	83 ec 0c             	sub    $0xc,%esp
+    563d:	89 c3                	mov    %eax,%ebx
+    563f:	6a 00                	push   $0x0
+    5641:	e8 22 07 00 00       	call   5d68 <sbrk>
+    5646:	83 c4 0c             	add    $0xc,%esp
+    5649:	83 e8 01             	sub    $0x1,%eax
+    564c:	6a ff                	push   $0xffffffff
+    564e:	50                   	push   %eax
+    564f:	53                   	push   %ebx
+    5650:	e8 cb 04 00 00       	call   5b20 <read>
+  close(fd);
+    5655:	89 1c 24             	mov    %ebx,(%esp)
+    5658:	e8 c3 05 00 00       	call   5c20 <close>
+  printf(1, "arg test passed\n");
+    565d:	58                   	pop    %eax
+    565e:	5a                   	pop    %edx
+    565f:	68 e4 7e 00 00       	push   $0x7ee4
+    5664:	6a 01                	push   $0x1
+    5666:	e8 f5 0b 00 00       	call   6260 <printf>
+}
+    566b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    566e:	83 c4 10             	add    $0x10,%esp
+    5671:	c9                   	leave
+    5672:	c3                   	ret
+    printf(2, "open failed\n");
+    5673:	51                   	push   %ecx
+    5674:	51                   	push   %ecx
+    5675:	68 d7 7e 00 00       	push   $0x7ed7
+    567a:	6a 02                	push   $0x2
+    567c:	e8 df 0b 00 00       	call   6260 <printf>
+    exit();
+    5681:	e8 4a 04 00 00       	call   5ad0 <exit>
+    5686:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    568d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00005690 <rand>:
+
+unsigned long randstate = 1;
+unsigned int
+rand()
+{
+  randstate = randstate * 1664525 + 1013904223;
+    5690:	69 05 00 a0 00 00 0d 	imul   $0x19660d,0xa000,%eax
+    5697:	66 19 00 
+    569a:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+    569f:	a3 00 a0 00 00       	mov    %eax,0xa000
+  return randstate;
+}
+    56a4:	c3                   	ret
+    56a5:	66 90                	xchg   %ax,%ax
+    56a7:	66 90                	xchg   %ax,%ax
+    56a9:	66 90                	xchg   %ax,%ax
+    56ab:	66 90                	xchg   %ax,%ax
+    56ad:	66 90                	xchg   %ax,%ax
+    56af:	90                   	nop
+
+000056b0 <main>:
+
+int
+main(int argc, char *argv[])
+{
+    56b0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    56b4:	83 e4 f0             	and    $0xfffffff0,%esp
+    56b7:	ff 71 fc             	push   -0x4(%ecx)
+    56ba:	55                   	push   %ebp
+    56bb:	89 e5                	mov    %esp,%ebp
+    56bd:	51                   	push   %ecx
+    56be:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "usertests starting\n");
+    56c1:	68 f5 7e 00 00       	push   $0x7ef5
+    56c6:	6a 01                	push   $0x1
+    56c8:	e8 93 0b 00 00       	call   6260 <printf>
+
+  if(open("usertests.ran", 0) >= 0){
+    56cd:	59                   	pop    %ecx
+    56ce:	58                   	pop    %eax
+    56cf:	6a 00                	push   $0x0
+    56d1:	68 09 7f 00 00       	push   $0x7f09
+    56d6:	e8 45 06 00 00       	call   5d20 <open>
+    56db:	83 c4 10             	add    $0x10,%esp
+    56de:	85 c0                	test   %eax,%eax
+    56e0:	78 13                	js     56f5 <main+0x45>
+    printf(1, "already ran user tests -- rebuild fs.img\n");
+    56e2:	52                   	push   %edx
+    56e3:	52                   	push   %edx
+    56e4:	68 b4 88 00 00       	push   $0x88b4
+    56e9:	6a 01                	push   $0x1
+    56eb:	e8 70 0b 00 00       	call   6260 <printf>
+    exit();
+    56f0:	e8 db 03 00 00       	call   5ad0 <exit>
+  }
+  close(open("usertests.ran", O_CREATE));
+    56f5:	50                   	push   %eax
+    56f6:	50                   	push   %eax
+    56f7:	68 00 02 00 00       	push   $0x200
+    56fc:	68 09 7f 00 00       	push   $0x7f09
+    5701:	e8 1a 06 00 00       	call   5d20 <open>
+    5706:	89 04 24             	mov    %eax,(%esp)
+    5709:	e8 12 05 00 00       	call   5c20 <close>
+
+  argptest();
+    570e:	e8 0d ff ff ff       	call   5620 <argptest>
+  createdelete();
+    5713:	e8 78 c0 ff ff       	call   1790 <createdelete>
+  linkunlink();
+    5718:	e8 13 c9 ff ff       	call   2030 <linkunlink>
+  concreate();
+    571d:	e8 0e c6 ff ff       	call   1d30 <concreate>
+  fourfiles();
+    5722:	e8 69 be ff ff       	call   1590 <fourfiles>
+  sharedfd();
+    5727:	e8 a4 bc ff ff       	call   13d0 <sharedfd>
+
+  bigargtest();
+    572c:	e8 af fb ff ff       	call   52e0 <bigargtest>
+  bigwrite();
+    5731:	e8 1a d2 ff ff       	call   2950 <bigwrite>
+  bigargtest();
+    5736:	e8 a5 fb ff ff       	call   52e0 <bigargtest>
+  bsstest();
+    573b:	e8 30 fb ff ff       	call   5270 <bsstest>
+  sbrktest();
+    5740:	e8 2b f6 ff ff       	call   4d70 <sbrktest>
+  validatetest();
+    5745:	e8 76 fa ff ff       	call   51c0 <validatetest>
+
+  opentest();
+    574a:	e8 21 b2 ff ff       	call   970 <opentest>
+  writetest();
+    574f:	e8 ac b2 ff ff       	call   a00 <writetest>
+  writetest1();
+    5754:	e8 87 b4 ff ff       	call   be0 <writetest1>
+  createtest();
+    5759:	e8 42 b6 ff ff       	call   da0 <createtest>
+
+  openiputtest();
+    575e:	e8 0d b1 ff ff       	call   870 <openiputtest>
+  exitiputtest();
+    5763:	e8 08 b0 ff ff       	call   770 <exitiputtest>
+  iputtest();
+    5768:	e8 23 af ff ff       	call   690 <iputtest>
+
+  mem();
+    576d:	e8 8e bb ff ff       	call   1300 <mem>
+  pipe1();
+    5772:	e8 09 b8 ff ff       	call   f80 <pipe1>
+  preempt();
+    5777:	e8 a4 b9 ff ff       	call   1120 <preempt>
+  exitwait();
+    577c:	e8 ff ba ff ff       	call   1280 <exitwait>
+
+  rmdot();
+    5781:	e8 9a f0 ff ff       	call   4820 <rmdot>
+  fourteen();
+    5786:	e8 55 ef ff ff       	call   46e0 <fourteen>
+  inlinefile();
+    578b:	e8 a0 d2 ff ff       	call   2a30 <inlinefile>
+  mmaptest();
+    5790:	e8 5b d5 ff ff       	call   2cf0 <mmaptest>
+  shmtest();
+    5795:	e8 36 da ff ff       	call   31d0 <shmtest>
+  splicetest();
+    579a:	e8 31 dc ff ff       	call   33d0 <splicetest>
+  sendfiletest();
+    579f:	e8 8c df ff ff       	call   3730 <sendfiletest>
+  iovtest();
+    57a4:	e8 57 e2 ff ff       	call   3a00 <iovtest>
+  futextest();
+    57a9:	e8 82 e5 ff ff       	call   3d30 <futextest>
+  largepagetest();
+    57ae:	e8 0d e7 ff ff       	call   3ec0 <largepagetest>
+  texttest();
+    57b3:	e8 68 a8 ff ff       	call   20 <texttest>
+  stacktest();
+    57b8:	e8 03 e9 ff ff       	call   40c0 <stacktest>
+  copytest();
+    57bd:	e8 ee aa ff ff       	call   2b0 <copytest>
+  threadtest();
+    57c2:	e8 89 ea ff ff       	call   4250 <threadtest>
+  bigfile();
+    57c7:	e8 44 ed ff ff       	call   4510 <bigfile>
+  subdir();
+    57cc:	e8 9f ca ff ff       	call   2270 <subdir>
+  linktest();
+    57d1:	e8 4a c3 ff ff       	call   1b20 <linktest>
+  unlinkread();
+    57d6:	e8 b5 c1 ff ff       	call   1990 <unlinkread>
+  dirfile();
+    57db:	e8 c0 f1 ff ff       	call   49a0 <dirfile>
+  iref();
+    57e0:	e8 bb f3 ff ff       	call   4ba0 <iref>
+  forktest();
+    57e5:	e8 d6 f4 ff ff       	call   4cc0 <forktest>
+  bigdir(); // slow
+    57ea:	e8 51 c9 ff ff       	call   2140 <bigdir>
+
+  uio();
+    57ef:	e8 bc fd ff ff       	call   55b0 <uio>
+
+  exectest();
+    57f4:	e8 37 b7 ff ff       	call   f30 <exectest>
+
+  exit();
+    57f9:	e8 d2 02 00 00       	call   5ad0 <exit>
+    57fe:	66 90                	xchg   %ax,%ax
+
+00005800 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    5800:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    5801:	31 c0                	xor    %eax,%eax
+{
+    5803:	89 e5                	mov    %esp,%ebp
+    5805:	53                   	push   %ebx
+    5806:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    5809:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    580c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    5810:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    5814:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    5817:	83 c0 01             	add    $0x1,%eax
+    581a:	84 d2                	test   %dl,%dl
+    581c:	75 f2                	jne    5810 <strcpy+0x10>
+    ;
+  return os;
+}
+    581e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    5821:	89 c8                	mov    %ecx,%eax
+    5823:	c9                   	leave
+    5824:	c3                   	ret
+    5825:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    582c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00005830 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    5830:	55                   	push   %ebp
+    5831:	89 e5                	mov    %esp,%ebp
+    5833:	53                   	push   %ebx
+    5834:	8b 55 08             	mov    0x8(%ebp),%edx
+    5837:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    583a:	0f b6 02             	movzbl (%edx),%eax
+    583d:	84 c0                	test   %al,%al
+    583f:	75 17                	jne    5858 <strcmp+0x28>
+    5841:	eb 3a                	jmp    587d <strcmp+0x4d>
+    5843:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    5847:	90                   	nop
+    5848:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    584c:	83 c2 01             	add    $0x1,%edx
+    584f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    5852:	84 c0                	test   %al,%al
+    5854:	74 1a                	je     5870 <strcmp+0x40>
+    p++, q++;
+    5856:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    5858:	0f b6 19             	movzbl (%ecx),%ebx
+    585b:	38 c3                	cmp    %al,%bl
+    585d:	74 e9                	je     5848 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    585f:	29 d8                	sub    %ebx,%eax
+}
+    5861:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    5864:	c9                   	leave
+    5865:	c3                   	ret
+    5866:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    586d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    5870:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    5874:	31 c0                	xor    %eax,%eax
+    5876:	29 d8                	sub    %ebx,%eax
+}
+    5878:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    587b:	c9                   	leave
+    587c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    587d:	0f b6 19             	movzbl (%ecx),%ebx
+    5880:	31 c0                	xor    %eax,%eax
+    5882:	eb db                	jmp    585f <strcmp+0x2f>
+    5884:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    588b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    588f:	90                   	nop
+
+00005890 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    5890:	55                   	push   %ebp
+    5891:	89 e5                	mov    %esp,%ebp
+    5893:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    5896:	80 3a 00             	cmpb   $0x0,(%edx)
+    5899:	74 15                	je     58b0 <strlen+0x20>
+    589b:	31 c0                	xor    %eax,%eax
+    589d:	8d 76 00             	lea    0x0(%esi),%esi
+    58a0:	83 c0 01             	add    $0x1,%eax
+    58a3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    58a7:	89 c1                	mov    %eax,%ecx
+    58a9:	75 f5                	jne    58a0 <strlen+0x10>
+    ;
+  return n;
+}
+    58ab:	89 c8                	mov    %ecx,%eax
+    58ad:	5d                   	pop    %ebp
+    58ae:	c3                   	ret
+    58af:	90                   	nop
+  for(n = 0; s[n]; n++)
+    58b0:	31 c9                	xor    %ecx,%ecx
+}
+    58b2:	5d                   	pop    %ebp
+    58b3:	89 c8                	mov    %ecx,%eax
+    58b5:	c3                   	ret
+    58b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    58bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000058c0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    58c0:	55                   	push   %ebp
+    58c1:	89 e5                	mov    %esp,%ebp
+    58c3:	57                   	push   %edi
+    58c4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    58c7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    58ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+    58cd:	89 d7                	mov    %edx,%edi
+    58cf:	fc                   	cld
+    58d0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    58d2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    58d5:	89 d0                	mov    %edx,%eax
+    58d7:	c9                   	leave
+    58d8:	c3                   	ret
+    58d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000058e0 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+    58e0:	55                   	push   %ebp
+    58e1:	89 e5                	mov    %esp,%ebp
+    58e3:	56                   	push   %esi
+    58e4:	53                   	push   %ebx
+    58e5:	8b 75 10             	mov    0x10(%ebp),%esi
+    58e8:	8b 55 08             	mov    0x8(%ebp),%edx
+    58eb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+    58ee:	85 f6                	test   %esi,%esi
+    58f0:	74 2e                	je     5920 <memcmp+0x40>
+    58f2:	01 c6                	add    %eax,%esi
+    58f4:	eb 14                	jmp    590a <memcmp+0x2a>
+    58f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    58fd:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+    5900:	83 c0 01             	add    $0x1,%eax
+    5903:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+    5906:	39 f0                	cmp    %esi,%eax
+    5908:	74 16                	je     5920 <memcmp+0x40>
+    if(*s1 != *s2)
+    590a:	0f b6 0a             	movzbl (%edx),%ecx
+    590d:	0f b6 18             	movzbl (%eax),%ebx
+    5910:	38 d9                	cmp    %bl,%cl
+    5912:	74 ec                	je     5900 <memcmp+0x20>
+      return *s1 - *s2;
+    5914:	0f b6 c1             	movzbl %cl,%eax
+    5917:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+    5919:	5b                   	pop    %ebx
+    591a:	5e                   	pop    %esi
+    591b:	5d                   	pop    %ebp
+    591c:	c3                   	ret
+    591d:	8d 76 00             	lea    0x0(%esi),%esi
+    5920:	5b                   	pop    %ebx
+  return 0;
+    5921:	31 c0                	xor    %eax,%eax
+}
+    5923:	5e                   	pop    %esi
+    5924:	5d                   	pop    %ebp
+    5925:	c3                   	ret
+    5926:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    592d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00005930 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    5930:	55                   	push   %ebp
+    5931:	89 e5                	mov    %esp,%ebp
+    5933:	8b 45 08             	mov    0x8(%ebp),%eax
+    5936:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    593a:	0f b6 10             	movzbl (%eax),%edx
+    593d:	84 d2                	test   %dl,%dl
+    593f:	75 12                	jne    5953 <strchr+0x23>
+    5941:	eb 1d                	jmp    5960 <strchr+0x30>
+    5943:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    5947:	90                   	nop
+    5948:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    594c:	83 c0 01             	add    $0x1,%eax
+    594f:	84 d2                	test   %dl,%dl
+    5951:	74 0d                	je     5960 <strchr+0x30>
+    if(*s == c)
+    5953:	38 d1                	cmp    %dl,%cl
+    5955:	75 f1                	jne    5948 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    5957:	5d                   	pop    %ebp
+    5958:	c3                   	ret
+    5959:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    5960:	31 c0                	xor    %eax,%eax
+}
+    5962:	5d                   	pop    %ebp
+    5963:	c3                   	ret
+    5964:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    596b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    596f:	90                   	nop
+
+00005970 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    5970:	55                   	push   %ebp
+    5971:	89 e5                	mov    %esp,%ebp
+    5973:	57                   	push   %edi
+    5974:	56                   	push   %esi
+int
+read(int fd, void *buf, int n)
+{
+  if(flushhook)
+    flushhook();
+  return _read(fd, buf, n);
+    5975:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    5978:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    5979:	31 db                	xor    %ebx,%ebx
+{
+    597b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    597e:	eb 32                	jmp    59b2 <gets+0x42>
+  if(flushhook)
+    5980:	a1 e0 e9 00 00       	mov    0xe9e0,%eax
+    5985:	85 c0                	test   %eax,%eax
+    5987:	74 02                	je     598b <gets+0x1b>
+    flushhook();
+    5989:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+    598b:	83 ec 04             	sub    $0x4,%esp
+    598e:	6a 01                	push   $0x1
+    5990:	56                   	push   %esi
+    5991:	6a 00                	push   $0x0
+    5993:	e8 60 03 00 00       	call   5cf8 <_read>
+    if(cc < 1)
+    5998:	83 c4 10             	add    $0x10,%esp
+    599b:	85 c0                	test   %eax,%eax
+    599d:	7e 1d                	jle    59bc <gets+0x4c>
+    buf[i++] = c;
+    599f:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    59a3:	8b 55 08             	mov    0x8(%ebp),%edx
+    59a6:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    59aa:	3c 0a                	cmp    $0xa,%al
+    59ac:	74 10                	je     59be <gets+0x4e>
+    59ae:	3c 0d                	cmp    $0xd,%al
+    59b0:	74 0c                	je     59be <gets+0x4e>
+  for(i=0; i+1 < max; ){
+    59b2:	89 df                	mov    %ebx,%edi
+    59b4:	83 c3 01             	add    $0x1,%ebx
+    59b7:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    59ba:	7c c4                	jl     5980 <gets+0x10>
+    59bc:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+    59be:	8b 45 08             	mov    0x8(%ebp),%eax
+    59c1:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+    59c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    59c8:	5b                   	pop    %ebx
+    59c9:	5e                   	pop    %esi
+    59ca:	5f                   	pop    %edi
+    59cb:	5d                   	pop    %ebp
+    59cc:	c3                   	ret
+    59cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000059d0 <stat>:
+{
+    59d0:	55                   	push   %ebp
+    59d1:	89 e5                	mov    %esp,%ebp
+    59d3:	56                   	push   %esi
+    59d4:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+    59d5:	83 ec 08             	sub    $0x8,%esp
+    59d8:	6a 00                	push   $0x0
+    59da:	ff 75 08             	push   0x8(%ebp)
+    59dd:	e8 3e 03 00 00       	call   5d20 <open>
+  if(fd < 0)
+    59e2:	83 c4 10             	add    $0x10,%esp
+    59e5:	85 c0                	test   %eax,%eax
+    59e7:	78 37                	js     5a20 <stat+0x50>
+  r = fstat(fd, st);
+    59e9:	83 ec 08             	sub    $0x8,%esp
+    59ec:	ff 75 0c             	push   0xc(%ebp)
+    59ef:	89 c3                	mov    %eax,%ebx
+    59f1:	50                   	push   %eax
+    59f2:	e8 41 03 00 00       	call   5d38 <fstat>
+}
+
+int
+close(int fd)
+{
+  if(flushhook)
+    59f7:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+    59fa:	89 c6                	mov    %eax,%esi
+  if(flushhook)
+    59fc:	a1 e0 e9 00 00       	mov    0xe9e0,%eax
+    5a01:	85 c0                	test   %eax,%eax
+    5a03:	74 02                	je     5a07 <stat+0x37>
+    flushhook();
+    5a05:	ff d0                	call   *%eax
+  return _close(fd);
+    5a07:	83 ec 0c             	sub    $0xc,%esp
+    5a0a:	53                   	push   %ebx
+    5a0b:	e8 f8 02 00 00       	call   5d08 <_close>
+    5a10:	83 c4 10             	add    $0x10,%esp
+}
+    5a13:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    5a16:	89 f0                	mov    %esi,%eax
+    5a18:	5b                   	pop    %ebx
+    5a19:	5e                   	pop    %esi
+    5a1a:	5d                   	pop    %ebp
+    5a1b:	c3                   	ret
+    5a1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+    5a20:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    5a25:	eb ec                	jmp    5a13 <stat+0x43>
+    5a27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5a2e:	66 90                	xchg   %ax,%ax
+
+00005a30 <atoi>:
+{
+    5a30:	55                   	push   %ebp
+    5a31:	89 e5                	mov    %esp,%ebp
+    5a33:	53                   	push   %ebx
+    5a34:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+    5a37:	0f be 02             	movsbl (%edx),%eax
+    5a3a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    5a3d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    5a40:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    5a45:	77 1e                	ja     5a65 <atoi+0x35>
+    5a47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5a4e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    5a50:	83 c2 01             	add    $0x1,%edx
+    5a53:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    5a56:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    5a5a:	0f be 02             	movsbl (%edx),%eax
+    5a5d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    5a60:	80 fb 09             	cmp    $0x9,%bl
+    5a63:	76 eb                	jbe    5a50 <atoi+0x20>
+}
+    5a65:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    5a68:	89 c8                	mov    %ecx,%eax
+    5a6a:	c9                   	leave
+    5a6b:	c3                   	ret
+    5a6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00005a70 <memmove>:
+{
+    5a70:	55                   	push   %ebp
+    5a71:	89 e5                	mov    %esp,%ebp
+    5a73:	57                   	push   %edi
+    5a74:	56                   	push   %esi
+    5a75:	8b 45 10             	mov    0x10(%ebp),%eax
+    5a78:	8b 55 08             	mov    0x8(%ebp),%edx
+    5a7b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+    5a7e:	85 c0                	test   %eax,%eax
+    5a80:	7e 13                	jle    5a95 <memmove+0x25>
+    5a82:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    5a84:	89 d7                	mov    %edx,%edi
+    5a86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5a8d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    5a90:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    5a91:	39 f8                	cmp    %edi,%eax
+    5a93:	75 fb                	jne    5a90 <memmove+0x20>
+}
+    5a95:	5e                   	pop    %esi
+    5a96:	89 d0                	mov    %edx,%eax
+    5a98:	5f                   	pop    %edi
+    5a99:	5d                   	pop    %ebp
+    5a9a:	c3                   	ret
+    5a9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    5a9f:	90                   	nop
+
+00005aa0 <fork>:
+  if(flushhook)
+    5aa0:	a1 e0 e9 00 00       	mov    0xe9e0,%eax
+    5aa5:	85 c0                	test   %eax,%eax
+    5aa7:	74 17                	je     5ac0 <fork+0x20>
+{
+    5aa9:	55                   	push   %ebp
+    5aaa:	89 e5                	mov    %esp,%ebp
+    5aac:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+    5aaf:	ff d0                	call   *%eax
+}
+    5ab1:	c9                   	leave
+  return _fork();
+    5ab2:	e9 21 02 00 00       	jmp    5cd8 <_fork>
+    5ab7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5abe:	66 90                	xchg   %ax,%ax
+    5ac0:	e9 13 02 00 00       	jmp    5cd8 <_fork>
+    5ac5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5acc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00005ad0 <exit>:
+{
+    5ad0:	55                   	push   %ebp
+    5ad1:	89 e5                	mov    %esp,%ebp
+    5ad3:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+    5ad6:	a1 e0 e9 00 00       	mov    0xe9e0,%eax
+    5adb:	85 c0                	test   %eax,%eax
+    5add:	74 02                	je     5ae1 <exit+0x11>
+    flushhook();
+    5adf:	ff d0                	call   *%eax
+  _exit();
+    5ae1:	e8 fa 01 00 00       	call   5ce0 <_exit>
+    5ae6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5aed:	8d 76 00             	lea    0x0(%esi),%esi
+
+00005af0 <exec>:
+{
+    5af0:	55                   	push   %ebp
+  if(flushhook)
+    5af1:	a1 e0 e9 00 00       	mov    0xe9e0,%eax
+{
+    5af6:	89 e5                	mov    %esp,%ebp
+    5af8:	56                   	push   %esi
+    5af9:	53                   	push   %ebx
+    5afa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    5afd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+    5b00:	85 c0                	test   %eax,%eax
+    5b02:	74 02                	je     5b06 <exec+0x16>
+    flushhook();
+    5b04:	ff d0                	call   *%eax
+  return _exec(path, argv);
+    5b06:	89 75 0c             	mov    %esi,0xc(%ebp)
+    5b09:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+    5b0c:	5b                   	pop    %ebx
+    5b0d:	5e                   	pop    %esi
+    5b0e:	5d                   	pop    %ebp
+  return _exec(path, argv);
+    5b0f:	e9 04 02 00 00       	jmp    5d18 <_exec>
+    5b14:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5b1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    5b1f:	90                   	nop
+
+00005b20 <read>:
+{
+    5b20:	55                   	push   %ebp
+    5b21:	89 e5                	mov    %esp,%ebp
+    5b23:	57                   	push   %edi
+    5b24:	56                   	push   %esi
+    5b25:	53                   	push   %ebx
+    5b26:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+    5b29:	a1 e0 e9 00 00       	mov    0xe9e0,%eax
+{
+    5b2e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    5b31:	8b 75 0c             	mov    0xc(%ebp),%esi
+    5b34:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+    5b37:	85 c0                	test   %eax,%eax
+    5b39:	74 02                	je     5b3d <read+0x1d>
+    flushhook();
+    5b3b:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+    5b3d:	89 7d 10             	mov    %edi,0x10(%ebp)
+    5b40:	89 75 0c             	mov    %esi,0xc(%ebp)
+    5b43:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+    5b46:	83 c4 0c             	add    $0xc,%esp
+    5b49:	5b                   	pop    %ebx
+    5b4a:	5e                   	pop    %esi
+    5b4b:	5f                   	pop    %edi
+    5b4c:	5d                   	pop    %ebp
+  return _read(fd, buf, n);
+    5b4d:	e9 a6 01 00 00       	jmp    5cf8 <_read>
+    5b52:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5b59:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00005b60 <readv>:
+{
+    5b60:	55                   	push   %ebp
+    5b61:	89 e5                	mov    %esp,%ebp
+    5b63:	57                   	push   %edi
+    5b64:	56                   	push   %esi
+    5b65:	53                   	push   %ebx
+    5b66:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+    5b69:	a1 e0 e9 00 00       	mov    0xe9e0,%eax
+{
+    5b6e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    5b71:	8b 75 0c             	mov    0xc(%ebp),%esi
+    5b74:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+    5b77:	85 c0                	test   %eax,%eax
+    5b79:	74 02                	je     5b7d <readv+0x1d>
+    flushhook();
+    5b7b:	ff d0                	call   *%eax
+  return _readv(fd, iov, cnt);
+    5b7d:	89 7d 10             	mov    %edi,0x10(%ebp)
+    5b80:	89 75 0c             	mov    %esi,0xc(%ebp)
+    5b83:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+    5b86:	83 c4 0c             	add    $0xc,%esp
+    5b89:	5b                   	pop    %ebx
+    5b8a:	5e                   	pop    %esi
+    5b8b:	5f                   	pop    %edi
+    5b8c:	5d                   	pop    %ebp
+  return _readv(fd, iov, cnt);
+    5b8d:	e9 76 02 00 00       	jmp    5e08 <_readv>
+    5b92:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5b99:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00005ba0 <write>:
+{
+    5ba0:	55                   	push   %ebp
+    5ba1:	89 e5                	mov    %esp,%ebp
+    5ba3:	57                   	push   %edi
+    5ba4:	56                   	push   %esi
+    5ba5:	53                   	push   %ebx
+    5ba6:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+    5ba9:	a1 e0 e9 00 00       	mov    0xe9e0,%eax
+{
+    5bae:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    5bb1:	8b 75 0c             	mov    0xc(%ebp),%esi
+    5bb4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+    5bb7:	85 c0                	test   %eax,%eax
+    5bb9:	74 02                	je     5bbd <write+0x1d>
+    flushhook();
+    5bbb:	ff d0                	call   *%eax
+  return _write(fd, buf, n);
+    5bbd:	89 7d 10             	mov    %edi,0x10(%ebp)
+    5bc0:	89 75 0c             	mov    %esi,0xc(%ebp)
+    5bc3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+    5bc6:	83 c4 0c             	add    $0xc,%esp
+    5bc9:	5b                   	pop    %ebx
+    5bca:	5e                   	pop    %esi
+    5bcb:	5f                   	pop    %edi
+    5bcc:	5d                   	pop    %ebp
+  return _write(fd, buf, n);
+    5bcd:	e9 2e 01 00 00       	jmp    5d00 <_write>
+    5bd2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5bd9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00005be0 <writev>:
+{
+    5be0:	55                   	push   %ebp
+    5be1:	89 e5                	mov    %esp,%ebp
+    5be3:	57                   	push   %edi
+    5be4:	56                   	push   %esi
+    5be5:	53                   	push   %ebx
+    5be6:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+    5be9:	a1 e0 e9 00 00       	mov    0xe9e0,%eax
+{
+    5bee:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    5bf1:	8b 75 0c             	mov    0xc(%ebp),%esi
+    5bf4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+    5bf7:	85 c0                	test   %eax,%eax
+    5bf9:	74 02                	je     5bfd <writev+0x1d>
+    flushhook();
+    5bfb:	ff d0                	call   *%eax
+  return _writev(fd, iov, cnt);
+    5bfd:	89 7d 10             	mov    %edi,0x10(%ebp)
+    5c00:	89 75 0c             	mov    %esi,0xc(%ebp)
+    5c03:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+    5c06:	83 c4 0c             	add    $0xc,%esp
+    5c09:	5b                   	pop    %ebx
+    5c0a:	5e                   	pop    %esi
+    5c0b:	5f                   	pop    %edi
+    5c0c:	5d                   	pop    %ebp
+  return _writev(fd, iov, cnt);
+    5c0d:	e9 fe 01 00 00       	jmp    5e10 <_writev>
+    5c12:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5c19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00005c20 <close>:
+{
+    5c20:	55                   	push   %ebp
+    5c21:	89 e5                	mov    %esp,%ebp
+    5c23:	53                   	push   %ebx
+    5c24:	83 ec 04             	sub    $0x4,%esp
+  if(flushhook)
+    5c27:	a1 e0 e9 00 00       	mov    0xe9e0,%eax
+{
+    5c2c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(flushhook)
+    5c2f:	85 c0                	test   %eax,%eax
+    5c31:	74 02                	je     5c35 <close+0x15>
+    flushhook();
+    5c33:	ff d0                	call   *%eax
+  return _close(fd);
+    5c35:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+    5c38:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    5c3b:	c9                   	leave
+  return _close(fd);
+    5c3c:	e9 c7 00 00 00       	jmp    5d08 <_close>
+    5c41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5c48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5c4f:	90                   	nop
+
+00005c50 <umtxinit>:
+// process that finds the mutex held enters the kernel, to sleep
+// in futexwait() until the holder's umtxunlock() wakes it.
+
+void
+umtxinit(struct umutex *m)
+{
+    5c50:	55                   	push   %ebp
+    5c51:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+    5c53:	8b 45 08             	mov    0x8(%ebp),%eax
+    5c56:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    5c5c:	5d                   	pop    %ebp
+    5c5d:	c3                   	ret
+    5c5e:	66 90                	xchg   %ax,%ax
+
+00005c60 <umtxlock>:
+
+void
+umtxlock(struct umutex *m)
+{
+    5c60:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+    5c61:	b8 01 00 00 00       	mov    $0x1,%eax
+    5c66:	89 e5                	mov    %esp,%ebp
+    5c68:	56                   	push   %esi
+    5c69:	53                   	push   %ebx
+    5c6a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    5c6d:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 1) == 0)
+    5c70:	85 c0                	test   %eax,%eax
+    5c72:	74 2b                	je     5c9f <umtxlock+0x3f>
+    5c74:	b8 02 00 00 00       	mov    $0x2,%eax
+    5c79:	f0 87 03             	lock xchg %eax,(%ebx)
+    return;
+  // Mark the mutex contended, so that its holder
+  // wakes a waiter on release, and wait.
+  while(xchg(&m->state, 2) != 0)
+    5c7c:	85 c0                	test   %eax,%eax
+    5c7e:	74 1f                	je     5c9f <umtxlock+0x3f>
+    5c80:	be 02 00 00 00       	mov    $0x2,%esi
+    5c85:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwait(&m->state, 2);
+    5c88:	83 ec 08             	sub    $0x8,%esp
+    5c8b:	6a 02                	push   $0x2
+    5c8d:	53                   	push   %ebx
+    5c8e:	e8 85 01 00 00       	call   5e18 <futexwait>
+    5c93:	89 f0                	mov    %esi,%eax
+    5c95:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+    5c98:	83 c4 10             	add    $0x10,%esp
+    5c9b:	85 c0                	test   %eax,%eax
+    5c9d:	75 e9                	jne    5c88 <umtxlock+0x28>
+}
+    5c9f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    5ca2:	5b                   	pop    %ebx
+    5ca3:	5e                   	pop    %esi
+    5ca4:	5d                   	pop    %ebp
+    5ca5:	c3                   	ret
+    5ca6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5cad:	8d 76 00             	lea    0x0(%esi),%esi
+
+00005cb0 <umtxunlock>:
+
+void
+umtxunlock(struct umutex *m)
+{
+    5cb0:	55                   	push   %ebp
+    5cb1:	31 c0                	xor    %eax,%eax
+    5cb3:	89 e5                	mov    %esp,%ebp
+    5cb5:	83 ec 08             	sub    $0x8,%esp
+    5cb8:	8b 55 08             	mov    0x8(%ebp),%edx
+    5cbb:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+    5cbe:	83 f8 02             	cmp    $0x2,%eax
+    5cc1:	74 05                	je     5cc8 <umtxunlock+0x18>
+    futexwake(&m->state, 1);
+}
+    5cc3:	c9                   	leave
+    5cc4:	c3                   	ret
+    5cc5:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwake(&m->state, 1);
+    5cc8:	83 ec 08             	sub    $0x8,%esp
+    5ccb:	6a 01                	push   $0x1
+    5ccd:	52                   	push   %edx
+    5cce:	e8 4d 01 00 00       	call   5e20 <futexwake>
+    5cd3:	83 c4 10             	add    $0x10,%esp
+}
+    5cd6:	c9                   	leave
+    5cd7:	c3                   	ret
+
+00005cd8 <_fork>:
+  _ ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+    5cd8:	b8 01 00 00 00       	mov    $0x1,%eax
+    5cdd:	cd 40                	int    $0x40
+    5cdf:	c3                   	ret
+
+00005ce0 <_exit>:
+RAWSYSCALL(exit)
+    5ce0:	b8 02 00 00 00       	mov    $0x2,%eax
+    5ce5:	cd 40                	int    $0x40
+    5ce7:	c3                   	ret
+
+00005ce8 <wait>:
+SYSCALL(wait)
+    5ce8:	b8 03 00 00 00       	mov    $0x3,%eax
+    5ced:	cd 40                	int    $0x40
+    5cef:	c3                   	ret
+
+00005cf0 <pipe>:
+SYSCALL(pipe)
+    5cf0:	b8 04 00 00 00       	mov    $0x4,%eax
+    5cf5:	cd 40                	int    $0x40
+    5cf7:	c3                   	ret
+
+00005cf8 <_read>:
+RAWSYSCALL(read)
+    5cf8:	b8 05 00 00 00       	mov    $0x5,%eax
+    5cfd:	cd 40                	int    $0x40
+    5cff:	c3                   	ret
+
+00005d00 <_write>:
+RAWSYSCALL(write)
+    5d00:	b8 10 00 00 00       	mov    $0x10,%eax
+    5d05:	cd 40                	int    $0x40
+    5d07:	c3                   	ret
+
+00005d08 <_close>:
+RAWSYSCALL(close)
+    5d08:	b8 15 00 00 00       	mov    $0x15,%eax
+    5d0d:	cd 40                	int    $0x40
+    5d0f:	c3                   	ret
+
+00005d10 <kill>:
+SYSCALL(kill)
+    5d10:	b8 06 00 00 00       	mov    $0x6,%eax
+    5d15:	cd 40                	int    $0x40
+    5d17:	c3                   	ret
+
+00005d18 <_exec>:
+RAWSYSCALL(exec)
+    5d18:	b8 07 00 00 00       	mov    $0x7,%eax
+    5d1d:	cd 40                	int    $0x40
+    5d1f:	c3                   	ret
+
+00005d20 <open>:
+SYSCALL(open)
+    5d20:	b8 0f 00 00 00       	mov    $0xf,%eax
+    5d25:	cd 40                	int    $0x40
+    5d27:	c3                   	ret
+
+00005d28 <mknod>:
+SYSCALL(mknod)
+    5d28:	b8 11 00 00 00       	mov    $0x11,%eax
+    5d2d:	cd 40                	int    $0x40
+    5d2f:	c3                   	ret
+
+00005d30 <unlink>:
+SYSCALL(unlink)
+    5d30:	b8 12 00 00 00       	mov    $0x12,%eax
+    5d35:	cd 40                	int    $0x40
+    5d37:	c3                   	ret
+
+00005d38 <fstat>:
+SYSCALL(fstat)
+    5d38:	b8 08 00 00 00       	mov    $0x8,%eax
+    5d3d:	cd 40                	int    $0x40
+    5d3f:	c3                   	ret
+
+00005d40 <link>:
+SYSCALL(link)
+    5d40:	b8 13 00 00 00       	mov    $0x13,%eax
+    5d45:	cd 40                	int    $0x40
+    5d47:	c3                   	ret
+
+00005d48 <mkdir>:
+SYSCALL(mkdir)
+    5d48:	b8 14 00 00 00       	mov    $0x14,%eax
+    5d4d:	cd 40                	int    $0x40
+    5d4f:	c3                   	ret
+
+00005d50 <chdir>:
+SYSCALL(chdir)
+    5d50:	b8 09 00 00 00       	mov    $0x9,%eax
+    5d55:	cd 40                	int    $0x40
+    5d57:	c3                   	ret
+
+00005d58 <dup>:
+SYSCALL(dup)
+    5d58:	b8 0a 00 00 00       	mov    $0xa,%eax
+    5d5d:	cd 40                	int    $0x40
+    5d5f:	c3                   	ret
+
+00005d60 <getpid>:
+SYSCALL(getpid)
+    5d60:	b8 0b 00 00 00       	mov    $0xb,%eax
+    5d65:	cd 40                	int    $0x40
+    5d67:	c3                   	ret
+
+00005d68 <sbrk>:
+SYSCALL(sbrk)
+    5d68:	b8 0c 00 00 00       	mov    $0xc,%eax
+    5d6d:	cd 40                	int    $0x40
+    5d6f:	c3                   	ret
+
+00005d70 <sleep>:
+SYSCALL(sleep)
+    5d70:	b8 0d 00 00 00       	mov    $0xd,%eax
+    5d75:	cd 40                	int    $0x40
+    5d77:	c3                   	ret
+
+00005d78 <uptime>:
+SYSCALL(uptime)
+    5d78:	b8 0e 00 00 00       	mov    $0xe,%eax
+    5d7d:	cd 40                	int    $0x40
+    5d7f:	c3                   	ret
+
+00005d80 <wolfie>:
+SYSCALL(wolfie)
+    5d80:	b8 16 00 00 00       	mov    $0x16,%eax
+    5d85:	cd 40                	int    $0x40
+    5d87:	c3                   	ret
+
+00005d88 <nice>:
+SYSCALL(nice)
+    5d88:	b8 17 00 00 00       	mov    $0x17,%eax
+    5d8d:	cd 40                	int    $0x40
+    5d8f:	c3                   	ret
+
+00005d90 <mtxget>:
+SYSCALL(mtxget)
+    5d90:	b8 18 00 00 00       	mov    $0x18,%eax
+    5d95:	cd 40                	int    $0x40
+    5d97:	c3                   	ret
+
+00005d98 <mtxrel>:
+SYSCALL(mtxrel)
+    5d98:	b8 19 00 00 00       	mov    $0x19,%eax
+    5d9d:	cd 40                	int    $0x40
+    5d9f:	c3                   	ret
+
+00005da0 <mtxacq>:
+SYSCALL(mtxacq)
+    5da0:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    5da5:	cd 40                	int    $0x40
+    5da7:	c3                   	ret
+
+00005da8 <mtxdel>:
+SYSCALL(mtxdel)
+    5da8:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    5dad:	cd 40                	int    $0x40
+    5daf:	c3                   	ret
+
+00005db0 <iostat>:
+SYSCALL(iostat)
+    5db0:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    5db5:	cd 40                	int    $0x40
+    5db7:	c3                   	ret
+
+00005db8 <mmap>:
+SYSCALL(mmap)
+    5db8:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    5dbd:	cd 40                	int    $0x40
+    5dbf:	c3                   	ret
+
+00005dc0 <munmap>:
+SYSCALL(munmap)
+    5dc0:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    5dc5:	cd 40                	int    $0x40
+    5dc7:	c3                   	ret
+
+00005dc8 <shmget>:
+SYSCALL(shmget)
+    5dc8:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    5dcd:	cd 40                	int    $0x40
+    5dcf:	c3                   	ret
+
+00005dd0 <shmat>:
+SYSCALL(shmat)
+    5dd0:	b8 20 00 00 00       	mov    $0x20,%eax
+    5dd5:	cd 40                	int    $0x40
+    5dd7:	c3                   	ret
+
+00005dd8 <shmdt>:
+SYSCALL(shmdt)
+    5dd8:	b8 21 00 00 00       	mov    $0x21,%eax
+    5ddd:	cd 40                	int    $0x40
+    5ddf:	c3                   	ret
+
+00005de0 <shmdel>:
+SYSCALL(shmdel)
+    5de0:	b8 22 00 00 00       	mov    $0x22,%eax
+    5de5:	cd 40                	int    $0x40
+    5de7:	c3                   	ret
+
+00005de8 <syscount>:
+SYSCALL(syscount)
+    5de8:	b8 23 00 00 00       	mov    $0x23,%eax
+    5ded:	cd 40                	int    $0x40
+    5def:	c3                   	ret
+
+00005df0 <splice>:
+SYSCALL(splice)
+    5df0:	b8 24 00 00 00       	mov    $0x24,%eax
+    5df5:	cd 40                	int    $0x40
+    5df7:	c3                   	ret
+
+00005df8 <tee>:
+SYSCALL(tee)
+    5df8:	b8 25 00 00 00       	mov    $0x25,%eax
+    5dfd:	cd 40                	int    $0x40
+    5dff:	c3                   	ret
+
+00005e00 <sendfile>:
+SYSCALL(sendfile)
+    5e00:	b8 26 00 00 00       	mov    $0x26,%eax
+    5e05:	cd 40                	int    $0x40
+    5e07:	c3                   	ret
+
+00005e08 <_readv>:
+RAWSYSCALL(readv)
+    5e08:	b8 27 00 00 00       	mov    $0x27,%eax
+    5e0d:	cd 40                	int    $0x40
+    5e0f:	c3                   	ret
+
+00005e10 <_writev>:
+RAWSYSCALL(writev)
+    5e10:	b8 28 00 00 00       	mov    $0x28,%eax
+    5e15:	cd 40                	int    $0x40
+    5e17:	c3                   	ret
+
+00005e18 <futexwait>:
+SYSCALL(futexwait)
+    5e18:	b8 29 00 00 00       	mov    $0x29,%eax
+    5e1d:	cd 40                	int    $0x40
+    5e1f:	c3                   	ret
+
+00005e20 <futexwake>:
+SYSCALL(futexwake)
+    5e20:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    5e25:	cd 40                	int    $0x40
+    5e27:	c3                   	ret
+
+00005e28 <lockstat>:
+SYSCALL(lockstat)
+    5e28:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    5e2d:	cd 40                	int    $0x40
+    5e2f:	c3                   	ret
+
+00005e30 <clone>:
+SYSCALL(clone)
+    5e30:	b8 2c 00 00 00       	mov    $0x2c,%eax
+    5e35:	cd 40                	int    $0x40
+    5e37:	c3                   	ret
+
+00005e38 <join>:
+SYSCALL(join)
+    5e38:	b8 2d 00 00 00       	mov    $0x2d,%eax
+    5e3d:	cd 40                	int    $0x40
+    5e3f:	c3                   	ret
+
+00005e40 <stacklimit>:
+SYSCALL(stacklimit)
+    5e40:	b8 2e 00 00 00       	mov    $0x2e,%eax
+    5e45:	cd 40                	int    $0x40
+    5e47:	c3                   	ret
+    5e48:	66 90                	xchg   %ax,%ax
+    5e4a:	66 90                	xchg   %ax,%ax
+    5e4c:	66 90                	xchg   %ax,%ax
+    5e4e:	66 90                	xchg   %ax,%ax
+
+00005e50 <flushall>:
+  b->n = 0;
+}
+
+static void
+flushall(void)
+{
+    5e50:	55                   	push   %ebp
+    5e51:	89 e5                	mov    %esp,%ebp
+    5e53:	83 ec 14             	sub    $0x14,%esp
+  umtxlock(&stdoutlock);
+    5e56:	68 e4 e9 00 00       	push   $0xe9e4
+    5e5b:	e8 00 fe ff ff       	call   5c60 <umtxlock>
+  if(b->n > 0)
+    5e60:	a1 28 a0 00 00       	mov    0xa028,%eax
+    5e65:	83 c4 10             	add    $0x10,%esp
+    5e68:	85 c0                	test   %eax,%eax
+    5e6a:	7e 17                	jle    5e83 <flushall+0x33>
+    _write(b->fd, b->buf, b->n);
+    5e6c:	83 ec 04             	sub    $0x4,%esp
+    5e6f:	50                   	push   %eax
+    5e70:	68 2c a0 00 00       	push   $0xa02c
+    5e75:	ff 35 20 a0 00 00    	push   0xa020
+    5e7b:	e8 80 fe ff ff       	call   5d00 <_write>
+    5e80:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+    5e83:	c7 05 28 a0 00 00 00 	movl   $0x0,0xa028
+    5e8a:	00 00 00 
+  flush(&stdout);
+  umtxunlock(&stdoutlock);
+    5e8d:	83 ec 0c             	sub    $0xc,%esp
+    5e90:	68 e4 e9 00 00       	push   $0xe9e4
+    5e95:	e8 16 fe ff ff       	call   5cb0 <umtxunlock>
+}
+    5e9a:	83 c4 10             	add    $0x10,%esp
+    5e9d:	c9                   	leave
+    5e9e:	c3                   	ret
+    5e9f:	90                   	nop
+
+00005ea0 <printint>:
+    flush(b);
+}
+
+static void
+printint(struct outbuf *b, int xx, int base, int sgn)
+{
+    5ea0:	55                   	push   %ebp
+    5ea1:	89 e5                	mov    %esp,%ebp
+    5ea3:	57                   	push   %edi
+    5ea4:	89 cf                	mov    %ecx,%edi
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    5ea6:	89 d1                	mov    %edx,%ecx
+{
+    5ea8:	56                   	push   %esi
+    5ea9:	53                   	push   %ebx
+    5eaa:	89 c3                	mov    %eax,%ebx
+    5eac:	83 ec 2c             	sub    $0x2c,%esp
+  if(sgn && xx < 0){
+    5eaf:	85 d2                	test   %edx,%edx
+    5eb1:	0f 89 b9 00 00 00    	jns    5f70 <printint+0xd0>
+    5eb7:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    5ebb:	0f 84 af 00 00 00    	je     5f70 <printint+0xd0>
+    x = -xx;
+    5ec1:	f7 d9                	neg    %ecx
+    neg = 1;
+    5ec3:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    5ec8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    5ecb:	31 f6                	xor    %esi,%esi
+    5ecd:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+    5ed0:	89 c8                	mov    %ecx,%eax
+    5ed2:	31 d2                	xor    %edx,%edx
+    5ed4:	89 f3                	mov    %esi,%ebx
+    5ed6:	f7 f7                	div    %edi
+    5ed8:	8d 76 01             	lea    0x1(%esi),%esi
+    5edb:	0f b6 92 cc 95 00 00 	movzbl 0x95cc(%edx),%edx
+    5ee2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    5ee6:	89 ca                	mov    %ecx,%edx
+    5ee8:	89 c1                	mov    %eax,%ecx
+    5eea:	39 fa                	cmp    %edi,%edx
+    5eec:	73 e2                	jae    5ed0 <printint+0x30>
+  if(neg)
+    5eee:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    5ef1:	89 d9                	mov    %ebx,%ecx
+    5ef3:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    5ef6:	85 c0                	test   %eax,%eax
+    5ef8:	74 07                	je     5f01 <printint+0x61>
+    buf[i++] = '-';
+    5efa:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    5eff:	89 f1                	mov    %esi,%ecx
+    5f01:	8d 75 d8             	lea    -0x28(%ebp),%esi
+    5f04:	89 cf                	mov    %ecx,%edi
+    5f06:	01 f7                	add    %esi,%edi
+    5f08:	eb 1a                	jmp    5f24 <printint+0x84>
+    5f0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    *b->str++ = c;
+    5f10:	8d 48 01             	lea    0x1(%eax),%ecx
+    5f13:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+    5f19:	88 10                	mov    %dl,(%eax)
+
+  while(--i >= 0)
+    5f1b:	8d 47 ff             	lea    -0x1(%edi),%eax
+    5f1e:	39 fe                	cmp    %edi,%esi
+    5f20:	74 40                	je     5f62 <printint+0xc2>
+    5f22:	89 c7                	mov    %eax,%edi
+  if(b->str){
+    5f24:	8b 83 0c 02 00 00    	mov    0x20c(%ebx),%eax
+    putc(b, buf[i]);
+    5f2a:	0f b6 17             	movzbl (%edi),%edx
+  if(b->str){
+    5f2d:	85 c0                	test   %eax,%eax
+    5f2f:	75 df                	jne    5f10 <printint+0x70>
+  b->buf[b->n++] = c;
+    5f31:	8b 4b 08             	mov    0x8(%ebx),%ecx
+    5f34:	8d 41 01             	lea    0x1(%ecx),%eax
+    5f37:	89 43 08             	mov    %eax,0x8(%ebx)
+    5f3a:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+    5f3e:	3d 00 02 00 00       	cmp    $0x200,%eax
+    5f43:	74 3b                	je     5f80 <printint+0xe0>
+    5f45:	80 fa 0a             	cmp    $0xa,%dl
+    5f48:	75 d1                	jne    5f1b <printint+0x7b>
+    5f4a:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+    5f4e:	75 cb                	jne    5f1b <printint+0x7b>
+  if(b->n > 0)
+    5f50:	85 c0                	test   %eax,%eax
+    5f52:	7f 2c                	jg     5f80 <printint+0xe0>
+  b->n = 0;
+    5f54:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  while(--i >= 0)
+    5f5b:	8d 47 ff             	lea    -0x1(%edi),%eax
+    5f5e:	39 fe                	cmp    %edi,%esi
+    5f60:	75 c0                	jne    5f22 <printint+0x82>
+}
+    5f62:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    5f65:	5b                   	pop    %ebx
+    5f66:	5e                   	pop    %esi
+    5f67:	5f                   	pop    %edi
+    5f68:	5d                   	pop    %ebp
+    5f69:	c3                   	ret
+    5f6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  neg = 0;
+    5f70:	31 c0                	xor    %eax,%eax
+    5f72:	e9 51 ff ff ff       	jmp    5ec8 <printint+0x28>
+    5f77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5f7e:	66 90                	xchg   %ax,%ax
+    _write(b->fd, b->buf, b->n);
+    5f80:	83 ec 04             	sub    $0x4,%esp
+    5f83:	50                   	push   %eax
+    5f84:	8d 43 0c             	lea    0xc(%ebx),%eax
+    5f87:	50                   	push   %eax
+    5f88:	ff 33                	push   (%ebx)
+    5f8a:	e8 71 fd ff ff       	call   5d00 <_write>
+    5f8f:	83 c4 10             	add    $0x10,%esp
+    5f92:	eb c0                	jmp    5f54 <printint+0xb4>
+    5f94:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5f9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    5f9f:	90                   	nop
+
+00005fa0 <putc>:
+{
+    5fa0:	55                   	push   %ebp
+    5fa1:	89 e5                	mov    %esp,%ebp
+    5fa3:	53                   	push   %ebx
+    5fa4:	89 c3                	mov    %eax,%ebx
+    5fa6:	83 ec 04             	sub    $0x4,%esp
+  if(b->str){
+    5fa9:	8b 80 0c 02 00 00    	mov    0x20c(%eax),%eax
+    5faf:	85 c0                	test   %eax,%eax
+    5fb1:	74 15                	je     5fc8 <putc+0x28>
+    *b->str++ = c;
+    5fb3:	8d 48 01             	lea    0x1(%eax),%ecx
+    5fb6:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+    5fbc:	88 10                	mov    %dl,(%eax)
+}
+    5fbe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    5fc1:	c9                   	leave
+    5fc2:	c3                   	ret
+    5fc3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    5fc7:	90                   	nop
+  b->buf[b->n++] = c;
+    5fc8:	8b 4b 08             	mov    0x8(%ebx),%ecx
+    5fcb:	8d 41 01             	lea    0x1(%ecx),%eax
+    5fce:	89 43 08             	mov    %eax,0x8(%ebx)
+    5fd1:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+    5fd5:	3d 00 02 00 00       	cmp    $0x200,%eax
+    5fda:	74 14                	je     5ff0 <putc+0x50>
+    5fdc:	80 fa 0a             	cmp    $0xa,%dl
+    5fdf:	75 dd                	jne    5fbe <putc+0x1e>
+    5fe1:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+    5fe5:	75 d7                	jne    5fbe <putc+0x1e>
+  if(b->n > 0)
+    5fe7:	85 c0                	test   %eax,%eax
+    5fe9:	7e 17                	jle    6002 <putc+0x62>
+    5feb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    5fef:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+    5ff0:	83 ec 04             	sub    $0x4,%esp
+    5ff3:	50                   	push   %eax
+    5ff4:	8d 43 0c             	lea    0xc(%ebx),%eax
+    5ff7:	50                   	push   %eax
+    5ff8:	ff 33                	push   (%ebx)
+    5ffa:	e8 01 fd ff ff       	call   5d00 <_write>
+    5fff:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+    6002:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+    6009:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    600c:	c9                   	leave
+    600d:	c3                   	ret
+    600e:	66 90                	xchg   %ax,%ax
+
+00006010 <format>:
+
+// Format fmt and the arguments at ap into b.
+// Only understands %d, %x, %p, %s, %c.
+static void
+format(struct outbuf *b, const char *fmt, uint *ap)
+{
+    6010:	55                   	push   %ebp
+    6011:	89 e5                	mov    %esp,%ebp
+    6013:	57                   	push   %edi
+    6014:	89 c7                	mov    %eax,%edi
+    6016:	56                   	push   %esi
+    6017:	53                   	push   %ebx
+    6018:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+    601b:	0f b6 02             	movzbl (%edx),%eax
+{
+    601e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  for(i = 0; fmt[i]; i++){
+    6021:	84 c0                	test   %al,%al
+    6023:	74 5a                	je     607f <format+0x6f>
+    6025:	8d 5a 01             	lea    0x1(%edx),%ebx
+    6028:	31 f6                	xor    %esi,%esi
+    602a:	eb 1c                	jmp    6048 <format+0x38>
+    602c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+    6030:	83 f8 25             	cmp    $0x25,%eax
+    6033:	74 3b                	je     6070 <format+0x60>
+        state = '%';
+      } else {
+        putc(b, c);
+    6035:	89 ca                	mov    %ecx,%edx
+    6037:	89 f8                	mov    %edi,%eax
+    6039:	e8 62 ff ff ff       	call   5fa0 <putc>
+  for(i = 0; fmt[i]; i++){
+    603e:	0f b6 03             	movzbl (%ebx),%eax
+    6041:	83 c3 01             	add    $0x1,%ebx
+    6044:	84 c0                	test   %al,%al
+    6046:	74 37                	je     607f <format+0x6f>
+    c = fmt[i] & 0xff;
+    6048:	0f be c8             	movsbl %al,%ecx
+    604b:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+    604e:	85 f6                	test   %esi,%esi
+    6050:	74 de                	je     6030 <format+0x20>
+      }
+    } else if(state == '%'){
+    6052:	83 fe 25             	cmp    $0x25,%esi
+    6055:	75 e7                	jne    603e <format+0x2e>
+      if(c == 'd'){
+    6057:	83 f8 25             	cmp    $0x25,%eax
+    605a:	74 46                	je     60a2 <format+0x92>
+    605c:	83 e8 63             	sub    $0x63,%eax
+    605f:	83 f8 15             	cmp    $0x15,%eax
+    6062:	77 2c                	ja     6090 <format+0x80>
+    6064:	ff 24 85 74 95 00 00 	jmp    *0x9574(,%eax,4)
+    606b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    606f:	90                   	nop
+  for(i = 0; fmt[i]; i++){
+    6070:	0f b6 03             	movzbl (%ebx),%eax
+    6073:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+    6076:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+    607b:	84 c0                	test   %al,%al
+    607d:	75 c9                	jne    6048 <format+0x38>
+        putc(b, c);
+      }
+      state = 0;
+    }
+  }
+}
+    607f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    6082:	5b                   	pop    %ebx
+    6083:	5e                   	pop    %esi
+    6084:	5f                   	pop    %edi
+    6085:	5d                   	pop    %ebp
+    6086:	c3                   	ret
+    6087:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    608e:	66 90                	xchg   %ax,%ax
+        putc(b, '%');
+    6090:	ba 25 00 00 00       	mov    $0x25,%edx
+    6095:	89 f8                	mov    %edi,%eax
+    6097:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+    609a:	e8 01 ff ff ff       	call   5fa0 <putc>
+        putc(b, c);
+    609f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    60a2:	89 ca                	mov    %ecx,%edx
+    60a4:	89 f8                	mov    %edi,%eax
+      state = 0;
+    60a6:	31 f6                	xor    %esi,%esi
+        putc(b, c);
+    60a8:	e8 f3 fe ff ff       	call   5fa0 <putc>
+    60ad:	eb 8f                	jmp    603e <format+0x2e>
+    60af:	90                   	nop
+        printint(b, *ap, 16, 0);
+    60b0:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    60b3:	83 ec 0c             	sub    $0xc,%esp
+    60b6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    60bb:	8b 16                	mov    (%esi),%edx
+    60bd:	6a 00                	push   $0x0
+        ap++;
+    60bf:	83 c6 04             	add    $0x4,%esi
+        printint(b, *ap, 16, 0);
+    60c2:	89 f8                	mov    %edi,%eax
+    60c4:	e8 d7 fd ff ff       	call   5ea0 <printint>
+        ap++;
+    60c9:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    60cc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    60cf:	31 f6                	xor    %esi,%esi
+    60d1:	e9 68 ff ff ff       	jmp    603e <format+0x2e>
+    60d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    60dd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    60e0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    60e3:	8b 30                	mov    (%eax),%esi
+        ap++;
+    60e5:	83 c0 04             	add    $0x4,%eax
+    60e8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+    60eb:	85 f6                	test   %esi,%esi
+    60ed:	75 1b                	jne    610a <format+0xfa>
+    60ef:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+    60f4:	be 6c 95 00 00       	mov    $0x956c,%esi
+    60f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+          putc(b, *s);
+    6100:	89 f8                	mov    %edi,%eax
+          s++;
+    6102:	83 c6 01             	add    $0x1,%esi
+          putc(b, *s);
+    6105:	e8 96 fe ff ff       	call   5fa0 <putc>
+        while(*s != 0){
+    610a:	0f be 16             	movsbl (%esi),%edx
+    610d:	84 d2                	test   %dl,%dl
+    610f:	75 ef                	jne    6100 <format+0xf0>
+      state = 0;
+    6111:	31 f6                	xor    %esi,%esi
+    6113:	e9 26 ff ff ff       	jmp    603e <format+0x2e>
+    6118:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    611f:	90                   	nop
+        printint(b, *ap, 10, 1);
+    6120:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    6123:	83 ec 0c             	sub    $0xc,%esp
+    6126:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    612b:	8b 16                	mov    (%esi),%edx
+    612d:	6a 01                	push   $0x1
+    612f:	eb 8e                	jmp    60bf <format+0xaf>
+    6131:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(b, *ap);
+    6138:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    613b:	89 f8                	mov    %edi,%eax
+    613d:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+    6140:	83 c6 04             	add    $0x4,%esi
+        putc(b, *ap);
+    6143:	e8 58 fe ff ff       	call   5fa0 <putc>
+        ap++;
+    6148:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      state = 0;
+    614b:	31 f6                	xor    %esi,%esi
+    614d:	e9 ec fe ff ff       	jmp    603e <format+0x2e>
+    6152:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    6159:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00006160 <fflush>:
+{
+    6160:	55                   	push   %ebp
+    6161:	89 e5                	mov    %esp,%ebp
+    6163:	83 ec 08             	sub    $0x8,%esp
+  if(fd == stdout.fd)
+    6166:	8b 45 08             	mov    0x8(%ebp),%eax
+    6169:	39 05 20 a0 00 00    	cmp    %eax,0xa020
+    616f:	74 07                	je     6178 <fflush+0x18>
+}
+    6171:	c9                   	leave
+    6172:	c3                   	ret
+    6173:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    6177:	90                   	nop
+  umtxlock(&stdoutlock);
+    6178:	83 ec 0c             	sub    $0xc,%esp
+    617b:	68 e4 e9 00 00       	push   $0xe9e4
+    6180:	e8 db fa ff ff       	call   5c60 <umtxlock>
+  if(b->n > 0)
+    6185:	a1 28 a0 00 00       	mov    0xa028,%eax
+    618a:	83 c4 10             	add    $0x10,%esp
+    618d:	85 c0                	test   %eax,%eax
+    618f:	7f 1f                	jg     61b0 <fflush+0x50>
+  b->n = 0;
+    6191:	c7 05 28 a0 00 00 00 	movl   $0x0,0xa028
+    6198:	00 00 00 
+  umtxunlock(&stdoutlock);
+    619b:	c7 45 08 e4 e9 00 00 	movl   $0xe9e4,0x8(%ebp)
+}
+    61a2:	c9                   	leave
+  umtxunlock(&stdoutlock);
+    61a3:	e9 08 fb ff ff       	jmp    5cb0 <umtxunlock>
+    61a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    61af:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+    61b0:	83 ec 04             	sub    $0x4,%esp
+    61b3:	50                   	push   %eax
+    61b4:	68 2c a0 00 00       	push   $0xa02c
+    61b9:	ff 35 20 a0 00 00    	push   0xa020
+    61bf:	e8 3c fb ff ff       	call   5d00 <_write>
+    61c4:	83 c4 10             	add    $0x10,%esp
+    61c7:	eb c8                	jmp    6191 <fflush+0x31>
+    61c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000061d0 <setvbuf>:
+{
+    61d0:	55                   	push   %ebp
+    61d1:	89 e5                	mov    %esp,%ebp
+    61d3:	53                   	push   %ebx
+    61d4:	83 ec 04             	sub    $0x4,%esp
+    61d7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd != stdout.fd)
+    61da:	8b 45 08             	mov    0x8(%ebp),%eax
+    61dd:	39 05 20 a0 00 00    	cmp    %eax,0xa020
+    61e3:	74 0b                	je     61f0 <setvbuf+0x20>
+}
+    61e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    61e8:	c9                   	leave
+    61e9:	c3                   	ret
+    61ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  umtxlock(&stdoutlock);
+    61f0:	83 ec 0c             	sub    $0xc,%esp
+    61f3:	68 e4 e9 00 00       	push   $0xe9e4
+    61f8:	e8 63 fa ff ff       	call   5c60 <umtxlock>
+  if(b->n > 0)
+    61fd:	a1 28 a0 00 00       	mov    0xa028,%eax
+    6202:	83 c4 10             	add    $0x10,%esp
+    6205:	85 c0                	test   %eax,%eax
+    6207:	7f 2f                	jg     6238 <setvbuf+0x68>
+  b->n = 0;
+    6209:	c7 05 28 a0 00 00 00 	movl   $0x0,0xa028
+    6210:	00 00 00 
+  stdout.mode = mode;
+    6213:	89 1d 24 a0 00 00    	mov    %ebx,0xa024
+  flushhook = flushall;
+    6219:	c7 05 e0 e9 00 00 50 	movl   $0x5e50,0xe9e0
+    6220:	5e 00 00 
+}
+    6223:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&stdoutlock);
+    6226:	c7 45 08 e4 e9 00 00 	movl   $0xe9e4,0x8(%ebp)
+}
+    622d:	c9                   	leave
+  umtxunlock(&stdoutlock);
+    622e:	e9 7d fa ff ff       	jmp    5cb0 <umtxunlock>
+    6233:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    6237:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+    6238:	83 ec 04             	sub    $0x4,%esp
+    623b:	50                   	push   %eax
+    623c:	68 2c a0 00 00       	push   $0xa02c
+    6241:	ff 35 20 a0 00 00    	push   0xa020
+    6247:	e8 b4 fa ff ff       	call   5d00 <_write>
+    624c:	83 c4 10             	add    $0x10,%esp
+    624f:	eb b8                	jmp    6209 <setvbuf+0x39>
+    6251:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    6258:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    625f:	90                   	nop
+
+00006260 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s, %c.
+void
+printf(int fd, const char *fmt, ...)
+{
+    6260:	55                   	push   %ebp
+    6261:	89 e5                	mov    %esp,%ebp
+    6263:	53                   	push   %ebx
+    6264:	81 ec 14 02 00 00    	sub    $0x214,%esp
+    626a:	8b 45 08             	mov    0x8(%ebp),%eax
+    local.mode = _IONBF;
+    local.n = 0;
+    local.str = 0;
+    b = &local;
+  }
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+    626d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd == stdout.fd){
+    6270:	39 05 20 a0 00 00    	cmp    %eax,0xa020
+    6276:	74 48                	je     62c0 <printf+0x60>
+    local.fd = fd;
+    6278:	89 85 e8 fd ff ff    	mov    %eax,-0x218(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+    627e:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    6281:	89 da                	mov    %ebx,%edx
+    6283:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+    local.mode = _IONBF;
+    6289:	c7 85 ec fd ff ff 03 	movl   $0x3,-0x214(%ebp)
+    6290:	00 00 00 
+    local.n = 0;
+    6293:	c7 85 f0 fd ff ff 00 	movl   $0x0,-0x210(%ebp)
+    629a:	00 00 00 
+    local.str = 0;
+    629d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+    62a4:	e8 67 fd ff ff       	call   6010 <format>
+  if(b->mode == _IONBF)
+    62a9:	83 bd ec fd ff ff 03 	cmpl   $0x3,-0x214(%ebp)
+    62b0:	0f 84 a2 00 00 00    	je     6358 <printf+0xf8>
+    flush(b);
+  if(b == &stdout)
+    umtxunlock(&stdoutlock);
+}
+    62b6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    62b9:	c9                   	leave
+    62ba:	c3                   	ret
+    62bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    62bf:	90                   	nop
+    umtxlock(&stdoutlock);
+    62c0:	83 ec 0c             	sub    $0xc,%esp
+    62c3:	68 e4 e9 00 00       	push   $0xe9e4
+    62c8:	e8 93 f9 ff ff       	call   5c60 <umtxlock>
+  if(stdout.mode == 0){
+    62cd:	a1 24 a0 00 00       	mov    0xa024,%eax
+    62d2:	83 c4 10             	add    $0x10,%esp
+    62d5:	85 c0                	test   %eax,%eax
+    62d7:	74 37                	je     6310 <printf+0xb0>
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+    62d9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    62dc:	89 da                	mov    %ebx,%edx
+    62de:	b8 20 a0 00 00       	mov    $0xa020,%eax
+    62e3:	e8 28 fd ff ff       	call   6010 <format>
+  if(b->mode == _IONBF)
+    62e8:	83 3d 24 a0 00 00 03 	cmpl   $0x3,0xa024
+    62ef:	0f 84 ab 00 00 00    	je     63a0 <printf+0x140>
+    umtxunlock(&stdoutlock);
+    62f5:	83 ec 0c             	sub    $0xc,%esp
+    62f8:	68 e4 e9 00 00       	push   $0xe9e4
+    62fd:	e8 ae f9 ff ff       	call   5cb0 <umtxunlock>
+}
+    6302:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    umtxunlock(&stdoutlock);
+    6305:	83 c4 10             	add    $0x10,%esp
+}
+    6308:	c9                   	leave
+    6309:	c3                   	ret
+    630a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+    6310:	83 ec 08             	sub    $0x8,%esp
+    6313:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+    6319:	50                   	push   %eax
+    631a:	ff 35 20 a0 00 00    	push   0xa020
+    6320:	e8 13 fa ff ff       	call   5d38 <fstat>
+    6325:	83 c4 10             	add    $0x10,%esp
+    6328:	89 c2                	mov    %eax,%edx
+      stdout.mode = _IOFBF;
+    632a:	b8 01 00 00 00       	mov    $0x1,%eax
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+    632f:	85 d2                	test   %edx,%edx
+    6331:	75 10                	jne    6343 <printf+0xe3>
+      stdout.mode = _IOLBF;
+    6333:	31 c0                	xor    %eax,%eax
+    6335:	66 83 bd e8 fd ff ff 	cmpw   $0x3,-0x218(%ebp)
+    633c:	03 
+    633d:	0f 94 c0             	sete   %al
+    6340:	83 c0 01             	add    $0x1,%eax
+    6343:	a3 24 a0 00 00       	mov    %eax,0xa024
+    flushhook = flushall;
+    6348:	c7 05 e0 e9 00 00 50 	movl   $0x5e50,0xe9e0
+    634f:	5e 00 00 
+    6352:	eb 85                	jmp    62d9 <printf+0x79>
+    6354:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(b->n > 0)
+    6358:	8b 85 f0 fd ff ff    	mov    -0x210(%ebp),%eax
+    635e:	85 c0                	test   %eax,%eax
+    6360:	0f 8e 50 ff ff ff    	jle    62b6 <printf+0x56>
+    b = &local;
+    6366:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+    _write(b->fd, b->buf, b->n);
+    636c:	83 ec 04             	sub    $0x4,%esp
+    636f:	50                   	push   %eax
+    6370:	8d 43 0c             	lea    0xc(%ebx),%eax
+    6373:	50                   	push   %eax
+    6374:	ff 33                	push   (%ebx)
+    6376:	e8 85 f9 ff ff       	call   5d00 <_write>
+  b->n = 0;
+    637b:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  if(b == &stdout)
+    6382:	83 c4 10             	add    $0x10,%esp
+    6385:	81 fb 20 a0 00 00    	cmp    $0xa020,%ebx
+    638b:	0f 85 25 ff ff ff    	jne    62b6 <printf+0x56>
+    6391:	e9 5f ff ff ff       	jmp    62f5 <printf+0x95>
+    6396:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    639d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(b->n > 0)
+    63a0:	a1 28 a0 00 00       	mov    0xa028,%eax
+    b = getstdout();
+    63a5:	bb 20 a0 00 00       	mov    $0xa020,%ebx
+  if(b->n > 0)
+    63aa:	85 c0                	test   %eax,%eax
+    63ac:	7f be                	jg     636c <printf+0x10c>
+  b->n = 0;
+    63ae:	c7 05 28 a0 00 00 00 	movl   $0x0,0xa028
+    63b5:	00 00 00 
+  if(b == &stdout)
+    63b8:	e9 38 ff ff ff       	jmp    62f5 <printf+0x95>
+    63bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000063c0 <sprintf>:
+
+// Print to the given buffer. Only understands %d, %x, %p, %s, %c.
+int
+sprintf(char *str, const char *fmt, ...)
+{
+    63c0:	55                   	push   %ebp
+    63c1:	89 e5                	mov    %esp,%ebp
+    63c3:	53                   	push   %ebx
+  struct outbuf b;
+
+  b.str = str;
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+    63c4:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+    63ca:	8d 4d 10             	lea    0x10(%ebp),%ecx
+{
+    63cd:	81 ec 14 02 00 00    	sub    $0x214,%esp
+    63d3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+    63d6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  b.str = str;
+    63d9:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+    63dc:	e8 2f fc ff ff       	call   6010 <format>
+  *b.str = '\0';
+    63e1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    63e4:	c6 00 00             	movb   $0x0,(%eax)
+  return b.str - str;
+    63e7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    63ea:	29 d8                	sub    %ebx,%eax
+}
+    63ec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    63ef:	c9                   	leave
+    63f0:	c3                   	ret
+    63f1:	66 90                	xchg   %ax,%ax
+    63f3:	66 90                	xchg   %ax,%ax
+    63f5:	66 90                	xchg   %ax,%ax
+    63f7:	66 90                	xchg   %ax,%ax
+    63f9:	66 90                	xchg   %ax,%ax
+    63fb:	66 90                	xchg   %ax,%ax
+    63fd:	66 90                	xchg   %ax,%ax
+    63ff:	90                   	nop
+
+00006400 <freeblock>:
+static Header *freep;
+static struct umutex lock;  // threads made by clone() share the heap
+
+static void
+freeblock(void *ap)
+{
+    6400:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+    6401:	8d 48 f8             	lea    -0x8(%eax),%ecx
+{
+    6404:	89 e5                	mov    %esp,%ebp
+    6406:	57                   	push   %edi
+    6407:	56                   	push   %esi
+    6408:	53                   	push   %ebx
+    6409:	89 c3                	mov    %eax,%ebx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    640b:	a1 ec e9 00 00       	mov    0xe9ec,%eax
+    6410:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    6412:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    6414:	39 ca                	cmp    %ecx,%edx
+    6416:	73 30                	jae    6448 <freeblock+0x48>
+    6418:	39 c1                	cmp    %eax,%ecx
+    641a:	72 04                	jb     6420 <freeblock+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    641c:	39 c2                	cmp    %eax,%edx
+    641e:	72 f0                	jb     6410 <freeblock+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    6420:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    6423:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    6426:	39 f8                	cmp    %edi,%eax
+    6428:	74 26                	je     6450 <freeblock+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    642a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    642d:	8b 42 04             	mov    0x4(%edx),%eax
+    6430:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    6433:	39 f1                	cmp    %esi,%ecx
+    6435:	74 30                	je     6467 <freeblock+0x67>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    6437:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    6439:	5b                   	pop    %ebx
+  freep = p;
+    643a:	89 15 ec e9 00 00    	mov    %edx,0xe9ec
+}
+    6440:	5e                   	pop    %esi
+    6441:	5f                   	pop    %edi
+    6442:	5d                   	pop    %ebp
+    6443:	c3                   	ret
+    6444:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    6448:	39 c1                	cmp    %eax,%ecx
+    644a:	72 d0                	jb     641c <freeblock+0x1c>
+    644c:	eb c2                	jmp    6410 <freeblock+0x10>
+    644e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+    6450:	03 70 04             	add    0x4(%eax),%esi
+    6453:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    6456:	8b 02                	mov    (%edx),%eax
+    6458:	8b 00                	mov    (%eax),%eax
+    645a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    645d:	8b 42 04             	mov    0x4(%edx),%eax
+    6460:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    6463:	39 f1                	cmp    %esi,%ecx
+    6465:	75 d0                	jne    6437 <freeblock+0x37>
+    p->s.size += bp->s.size;
+    6467:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    646a:	89 15 ec e9 00 00    	mov    %edx,0xe9ec
+    p->s.size += bp->s.size;
+    6470:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    6473:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    6476:	89 0a                	mov    %ecx,(%edx)
+}
+    6478:	5b                   	pop    %ebx
+    6479:	5e                   	pop    %esi
+    647a:	5f                   	pop    %edi
+    647b:	5d                   	pop    %ebp
+    647c:	c3                   	ret
+    647d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00006480 <free>:
+
+void
+free(void *ap)
+{
+    6480:	55                   	push   %ebp
+    6481:	89 e5                	mov    %esp,%ebp
+    6483:	53                   	push   %ebx
+    6484:	83 ec 10             	sub    $0x10,%esp
+    6487:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  umtxlock(&lock);
+    648a:	68 e8 e9 00 00       	push   $0xe9e8
+    648f:	e8 cc f7 ff ff       	call   5c60 <umtxlock>
+  freeblock(ap);
+    6494:	89 d8                	mov    %ebx,%eax
+    6496:	e8 65 ff ff ff       	call   6400 <freeblock>
+  umtxunlock(&lock);
+    649b:	c7 45 08 e8 e9 00 00 	movl   $0xe9e8,0x8(%ebp)
+}
+    64a2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&lock);
+    64a5:	83 c4 10             	add    $0x10,%esp
+}
+    64a8:	c9                   	leave
+  umtxunlock(&lock);
+    64a9:	e9 02 f8 ff ff       	jmp    5cb0 <umtxunlock>
+    64ae:	66 90                	xchg   %ax,%ax
+
+000064b0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    64b0:	55                   	push   %ebp
+    64b1:	89 e5                	mov    %esp,%ebp
+    64b3:	57                   	push   %edi
+    64b4:	56                   	push   %esi
+    64b5:	53                   	push   %ebx
+    64b6:	83 ec 28             	sub    $0x28,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    64b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  umtxlock(&lock);
+    64bc:	68 e8 e9 00 00       	push   $0xe9e8
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    64c1:	8d 48 07             	lea    0x7(%eax),%ecx
+    64c4:	c1 e9 03             	shr    $0x3,%ecx
+    64c7:	8d 71 01             	lea    0x1(%ecx),%esi
+  umtxlock(&lock);
+    64ca:	e8 91 f7 ff ff       	call   5c60 <umtxlock>
+  if((prevp = freep) == 0){
+    64cf:	8b 15 ec e9 00 00    	mov    0xe9ec,%edx
+    64d5:	83 c4 10             	add    $0x10,%esp
+    64d8:	85 d2                	test   %edx,%edx
+    64da:	0f 84 b0 00 00 00    	je     6590 <malloc+0xe0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    64e0:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+    64e2:	8b 47 04             	mov    0x4(%edi),%eax
+    64e5:	39 f0                	cmp    %esi,%eax
+    64e7:	73 6f                	jae    6558 <malloc+0xa8>
+  if(nu < 4096)
+    64e9:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    64ee:	39 de                	cmp    %ebx,%esi
+    64f0:	0f 43 de             	cmovae %esi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    64f3:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+    64fa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    64fd:	eb 0a                	jmp    6509 <malloc+0x59>
+    64ff:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    6500:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+    6502:	8b 47 04             	mov    0x4(%edi),%eax
+    6505:	39 f0                	cmp    %esi,%eax
+    6507:	73 4f                	jae    6558 <malloc+0xa8>
+      }
+      freep = prevp;
+      umtxunlock(&lock);
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    6509:	89 fa                	mov    %edi,%edx
+    650b:	39 3d ec e9 00 00    	cmp    %edi,0xe9ec
+    6511:	75 ed                	jne    6500 <malloc+0x50>
+  p = sbrk(nu * sizeof(Header));
+    6513:	83 ec 0c             	sub    $0xc,%esp
+    6516:	ff 75 e4             	push   -0x1c(%ebp)
+    6519:	e8 4a f8 ff ff       	call   5d68 <sbrk>
+  if(p == (char*)-1)
+    651e:	83 c4 10             	add    $0x10,%esp
+    6521:	83 f8 ff             	cmp    $0xffffffff,%eax
+    6524:	74 15                	je     653b <malloc+0x8b>
+  hp->s.size = nu;
+    6526:	89 58 04             	mov    %ebx,0x4(%eax)
+  freeblock((void*)(hp + 1));
+    6529:	83 c0 08             	add    $0x8,%eax
+    652c:	e8 cf fe ff ff       	call   6400 <freeblock>
+  return freep;
+    6531:	8b 15 ec e9 00 00    	mov    0xe9ec,%edx
+      if((p = morecore(nunits)) == 0){
+    6537:	85 d2                	test   %edx,%edx
+    6539:	75 c5                	jne    6500 <malloc+0x50>
+        umtxunlock(&lock);
+    653b:	83 ec 0c             	sub    $0xc,%esp
+    653e:	68 e8 e9 00 00       	push   $0xe9e8
+    6543:	e8 68 f7 ff ff       	call   5cb0 <umtxunlock>
+        return 0;
+    6548:	83 c4 10             	add    $0x10,%esp
+      }
+  }
+}
+    654b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    654e:	31 c0                	xor    %eax,%eax
+}
+    6550:	5b                   	pop    %ebx
+    6551:	5e                   	pop    %esi
+    6552:	5f                   	pop    %edi
+    6553:	5d                   	pop    %ebp
+    6554:	c3                   	ret
+    6555:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    6558:	39 c6                	cmp    %eax,%esi
+    655a:	74 64                	je     65c0 <malloc+0x110>
+        p->s.size -= nunits;
+    655c:	29 f0                	sub    %esi,%eax
+    655e:	89 47 04             	mov    %eax,0x4(%edi)
+        p += p->s.size;
+    6561:	8d 3c c7             	lea    (%edi,%eax,8),%edi
+        p->s.size = nunits;
+    6564:	89 77 04             	mov    %esi,0x4(%edi)
+      umtxunlock(&lock);
+    6567:	83 ec 0c             	sub    $0xc,%esp
+      freep = prevp;
+    656a:	89 15 ec e9 00 00    	mov    %edx,0xe9ec
+      umtxunlock(&lock);
+    6570:	68 e8 e9 00 00       	push   $0xe9e8
+    6575:	e8 36 f7 ff ff       	call   5cb0 <umtxunlock>
+      return (void*)(p + 1);
+    657a:	83 c4 10             	add    $0x10,%esp
+}
+    657d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    6580:	8d 47 08             	lea    0x8(%edi),%eax
+}
+    6583:	5b                   	pop    %ebx
+    6584:	5e                   	pop    %esi
+    6585:	5f                   	pop    %edi
+    6586:	5d                   	pop    %ebp
+    6587:	c3                   	ret
+    6588:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    658f:	90                   	nop
+    base.s.ptr = freep = prevp = &base;
+    6590:	c7 05 ec e9 00 00 f0 	movl   $0xe9f0,0xe9ec
+    6597:	e9 00 00 
+    base.s.size = 0;
+    659a:	bf f0 e9 00 00       	mov    $0xe9f0,%edi
+    base.s.ptr = freep = prevp = &base;
+    659f:	c7 05 f0 e9 00 00 f0 	movl   $0xe9f0,0xe9f0
+    65a6:	e9 00 00 
+    base.s.size = 0;
+    65a9:	c7 05 f4 e9 00 00 00 	movl   $0x0,0xe9f4
+    65b0:	00 00 00 
+    if(p->s.size >= nunits){
+    65b3:	e9 31 ff ff ff       	jmp    64e9 <malloc+0x39>
+    65b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    65bf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    65c0:	8b 07                	mov    (%edi),%eax
+    65c2:	89 02                	mov    %eax,(%edx)
+    65c4:	eb a1                	jmp    6567 <malloc+0xb7>
+    65c6:	66 90                	xchg   %ax,%ax
+    65c8:	66 90                	xchg   %ax,%ax
+    65ca:	66 90                	xchg   %ax,%ax
+    65cc:	66 90                	xchg   %ax,%ax
+    65ce:	66 90                	xchg   %ax,%ax
+
+000065d0 <threadstart>:
+
+#define TSTACKSZ 4096
+
+static void
+threadstart(void *fn, void *arg)
+{
+    65d0:	55                   	push   %ebp
+    65d1:	89 e5                	mov    %esp,%ebp
+    65d3:	83 ec 14             	sub    $0x14,%esp
+  ((void (*)(void*))fn)(arg);
+    65d6:	ff 75 0c             	push   0xc(%ebp)
+    65d9:	ff 55 08             	call   *0x8(%ebp)
+  exit();
+    65dc:	e8 ef f4 ff ff       	call   5ad0 <exit>
+    65e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    65e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    65ef:	90                   	nop
+
+000065f0 <thread_create>:
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    65f0:	55                   	push   %ebp
+    65f1:	89 e5                	mov    %esp,%ebp
+    65f3:	53                   	push   %ebx
+    65f4:	83 ec 20             	sub    $0x20,%esp
+  char *mem, *stack;
+  int pid;
+
+  if((mem = malloc(2*TSTACKSZ)) == 0)
+    65f7:	68 00 20 00 00       	push   $0x2000
+    65fc:	e8 af fe ff ff       	call   64b0 <malloc>
+    6601:	83 c4 10             	add    $0x10,%esp
+    6604:	85 c0                	test   %eax,%eax
+    6606:	74 47                	je     664f <thread_create+0x5f>
+    6608:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)(((uint)mem + TSTACKSZ - 1) & ~(TSTACKSZ - 1));
+    660a:	8d 80 ff 0f 00 00    	lea    0xfff(%eax),%eax
+    6610:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  *(char**)stack = mem;
+    6615:	89 18                	mov    %ebx,(%eax)
+  if((pid = clone(threadstart, (void*)fn, arg, stack)) < 0)
+    6617:	50                   	push   %eax
+    6618:	ff 75 0c             	push   0xc(%ebp)
+    661b:	ff 75 08             	push   0x8(%ebp)
+    661e:	68 d0 65 00 00       	push   $0x65d0
+    6623:	e8 08 f8 ff ff       	call   5e30 <clone>
+    6628:	83 c4 10             	add    $0x10,%esp
+    662b:	85 c0                	test   %eax,%eax
+    662d:	78 09                	js     6638 <thread_create+0x48>
+    free(mem);
+  return pid;
+}
+    662f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    6632:	c9                   	leave
+    6633:	c3                   	ret
+    6634:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    free(mem);
+    6638:	83 ec 0c             	sub    $0xc,%esp
+    663b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    663e:	53                   	push   %ebx
+    663f:	e8 3c fe ff ff       	call   6480 <free>
+    6644:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    6647:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+    664a:	83 c4 10             	add    $0x10,%esp
+}
+    664d:	c9                   	leave
+    664e:	c3                   	ret
+    return -1;
+    664f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    6654:	eb d9                	jmp    662f <thread_create+0x3f>
+    6656:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    665d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00006660 <thread_join>:
+
+int
+thread_join(void)
+{
+    6660:	55                   	push   %ebp
+    6661:	89 e5                	mov    %esp,%ebp
+    6663:	83 ec 34             	sub    $0x34,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    6666:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    6669:	50                   	push   %eax
+    666a:	e8 c9 f7 ff ff       	call   5e38 <join>
+    666f:	83 c4 10             	add    $0x10,%esp
+    6672:	85 c0                	test   %eax,%eax
+    6674:	79 0a                	jns    6680 <thread_join+0x20>
+    free(*(char**)stack);
+  return pid;
+}
+    6676:	c9                   	leave
+    6677:	c3                   	ret
+    6678:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    667f:	90                   	nop
+    free(*(char**)stack);
+    6680:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    6683:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    6686:	83 ec 0c             	sub    $0xc,%esp
+    6689:	ff 32                	push   (%edx)
+    668b:	e8 f0 fd ff ff       	call   6480 <free>
+    6690:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    6693:	83 c4 10             	add    $0x10,%esp
+}
+    6696:	c9                   	leave
+    6697:	c3                   	ret
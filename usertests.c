@@ -7,6 +7,8 @@
 #include "syscall.h"
 #include "traps.h"
 #include "memlayout.h"
+#include "mman.h"
+#include "uio.h"
 
 char buf[8192];
 char name[3];
@@ -189,6 +191,11 @@ writetest1(void)
 {
   int i, fd, n;
 
+  // Through the direct and indirect blocks and into the
+  // doubly-indirect block's second indirect block. MAXFILE
+  // blocks would not fit on the disk.
+  enum { NBIG = NDIRECT + NINDIRECT + NINDIRECT + 1 };
+
   printf(stdout, "big files test\n");
 
   fd = open("big", O_CREATE|O_RDWR);
@@ -197,7 +204,7 @@ writetest1(void)
     exit();
   }
 
-  for(i = 0; i < MAXFILE; i++){
+  for(i = 0; i < NBIG; i++){
     ((int*)buf)[0] = i;
     if(write(fd, buf, 512) != 512){
       printf(stdout, "error: write big file failed\n", i);
@@ -217,7 +224,7 @@ writetest1(void)
   for(;;){
     i = read(fd, buf, 512);
     if(i == 0){
-      if(n == MAXFILE - 1){
+      if(n != NBIG){
         printf(stdout, "read only %d blocks from big", n);
         exit();
       }
@@ -1144,6 +1151,927 @@ bigwrite(void)
   printf(1, "bigwrite ok\n");
 }
 
+// small files live in the inode; do they survive
+// growing out of it, and being rewritten in place?
+void
+inlinefile(void)
+{
+  int fd, i, n;
+  char c;
+
+  printf(1, "inlinefile test\n");
+
+  unlink("inlinefile");
+  fd = open("inlinefile", O_CREATE | O_RDWR);
+  if(fd < 0){
+    printf(1, "cannot create inlinefile\n");
+    exit();
+  }
+  // grow a byte at a time across the inline limit
+  for(i = 0; i < 600; i++){
+    c = 'a' + i % 26;
+    if(write(fd, &c, 1) != 1){
+      printf(1, "inlinefile write %d failed\n", i);
+      exit();
+    }
+  }
+  close(fd);
+
+  fd = open("inlinefile", O_RDONLY);
+  n = read(fd, buf, sizeof(buf));
+  if(n != 600){
+    printf(1, "inlinefile read %d bytes\n", n);
+    exit();
+  }
+  for(i = 0; i < n; i++){
+    if(buf[i] != 'a' + i % 26){
+      printf(1, "inlinefile wrong data at %d\n", i);
+      exit();
+    }
+  }
+  close(fd);
+  unlink("inlinefile");
+
+  // a directory with a few entries stays inline
+  if(mkdir("inlinedir") < 0 || mkdir("inlinedir/a") < 0){
+    printf(1, "inlinefile mkdir failed\n");
+    exit();
+  }
+  fd = open("inlinedir/a/f", O_CREATE | O_RDWR);
+  if(fd < 0 || write(fd, "hi", 2) != 2){
+    printf(1, "inlinefile create in dir failed\n");
+    exit();
+  }
+  close(fd);
+  fd = open("inlinedir/a/f", O_RDONLY);
+  if(read(fd, buf, sizeof(buf)) != 2 || buf[0] != 'h' || buf[1] != 'i'){
+    printf(1, "inlinefile read in dir failed\n");
+    exit();
+  }
+  close(fd);
+  if(unlink("inlinedir/a/f") < 0 || unlink("inlinedir/a") < 0 ||
+     unlink("inlinedir") < 0){
+    printf(1, "inlinefile unlink failed\n");
+    exit();
+  }
+
+  printf(1, "inlinefile ok\n");
+}
+
+// mmap() of files and anonymous memory
+void
+mmaptest(void)
+{
+  int fd, fd1, i, pid;
+  char *p, *q;
+  enum { SZ = 6000 };
+
+  printf(1, "mmap test\n");
+
+  unlink("mmapfile");
+  fd = open("mmapfile", O_CREATE | O_RDWR);
+  if(fd < 0){
+    printf(1, "cannot create mmapfile\n");
+    exit();
+  }
+  for(i = 0; i < SZ; i++)
+    buf[i] = 'a' + i % 26;
+  if(write(fd, buf, SZ) != SZ){
+    printf(1, "mmap write mmapfile failed\n");
+    exit();
+  }
+
+  // private: writes are not seen by the file
+  p = mmap(0, SZ, PROT_READ|PROT_WRITE, MAP_PRIVATE, fd, 0);
+  if(p == MAP_FAILED){
+    printf(1, "mmap private failed\n");
+    exit();
+  }
+  for(i = 0; i < SZ; i++){
+    if(p[i] != 'a' + i % 26){
+      printf(1, "mmap private wrong data at %d\n", i);
+      exit();
+    }
+  }
+  p[0] = 'X';
+  if(munmap(p, SZ) < 0){
+    printf(1, "munmap private failed\n");
+    exit();
+  }
+
+  // shared: read() sees stores at once, and they reach the file
+  p = mmap(0, SZ, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+  if(p == MAP_FAILED){
+    printf(1, "mmap shared failed\n");
+    exit();
+  }
+  p[1] = 'Y';
+  p[5000] = 'Z';
+  fd1 = open("mmapfile", O_RDONLY);
+  if(read(fd1, buf, SZ) != SZ || buf[0] != 'a' || buf[1] != 'Y' ||
+     buf[5000] != 'Z'){
+    printf(1, "mmap shared not seen by read\n");
+    exit();
+  }
+  close(fd1);
+
+  // the child shares the mapping
+  pid = fork();
+  if(pid < 0){
+    printf(1, "mmap fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    p[2] = 'W';
+    exit();
+  }
+  wait();
+  if(p[2] != 'W'){
+    printf(1, "mmap shared not seen after fork\n");
+    exit();
+  }
+
+  if(munmap(p, SZ) < 0){
+    printf(1, "munmap shared failed\n");
+    exit();
+  }
+  close(fd);
+
+  fd = open("mmapfile", O_RDONLY);
+  if(read(fd, buf, SZ) != SZ || buf[0] != 'a' || buf[1] != 'Y' ||
+     buf[2] != 'W' || buf[5000] != 'Z'){
+    printf(1, "mmap shared not written back\n");
+    exit();
+  }
+  // a read-only file cannot be mapped shared and writable
+  if(mmap(0, SZ, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0) != MAP_FAILED){
+    printf(1, "mmap writable on read-only fd succeeded\n");
+    exit();
+  }
+  close(fd);
+  unlink("mmapfile");
+
+  // anonymous memory is zeroed, can be passed to system calls,
+  // and survives unmapping a page from the middle
+  p = mmap(0, 3*4096, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
+  if(p == MAP_FAILED){
+    printf(1, "mmap anon failed\n");
+    exit();
+  }
+  for(i = 0; i < 3*4096; i++){
+    if(p[i] != 0){
+      printf(1, "mmap anon not zero\n");
+      exit();
+    }
+  }
+  p[0] = 'A';
+  p[2*4096] = 'C';
+  if(munmap(p + 4096, 4096) < 0){
+    printf(1, "munmap anon middle failed\n");
+    exit();
+  }
+  if(p[0] != 'A' || p[2*4096] != 'C'){
+    printf(1, "mmap anon lost data\n");
+    exit();
+  }
+  q = "mmapanon";
+  memmove(p + 100, q, strlen(q) + 1);
+  fd = open(p + 100, O_CREATE | O_RDWR);
+  if(fd < 0 || write(fd, p, 10) != 10){
+    printf(1, "mmap anon syscall args failed\n");
+    exit();
+  }
+  close(fd);
+  unlink("mmapanon");
+  munmap(p, 3*4096);
+
+  printf(1, "mmap ok\n");
+}
+
+// shared memory segments
+void
+shmtest(void)
+{
+  int id, pid;
+  char *p, *q;
+
+  printf(1, "shm test\n");
+
+  id = shmget(4242, 8192);
+  if(id < 0 || (p = shmat(id)) == (char*)-1){
+    printf(1, "shmget/shmat failed\n");
+    exit();
+  }
+  if(p[0] != 0 || p[8191] != 0){
+    printf(1, "shm not zero\n");
+    exit();
+  }
+  p[0] = 'P';
+
+  pid = fork();
+  if(pid < 0){
+    printf(1, "shm fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    // the inherited mapping and a new one share the pages
+    if(shmget(4242, 4096) != id || (q = shmat(id)) == (char*)-1 ||
+       q == p || q[0] != 'P'){
+      printf(1, "shm child attach failed\n");
+      exit();
+    }
+    q[8191] = 'C';
+    if(p[8191] != 'C'){
+      printf(1, "shm child mappings differ\n");
+      exit();
+    }
+    shmdt(q);
+    exit();
+  }
+  wait();
+  if(p[8191] != 'C'){
+    printf(1, "shm child write not seen\n");
+    exit();
+  }
+  if(shmdel(id) < 0 || shmat(id) != (char*)-1){
+    printf(1, "shmdel failed\n");
+    exit();
+  }
+  // still mapped here until detached
+  p[1] = 'Q';
+  if(shmdt(p) < 0 || shmdt(p) == 0){
+    printf(1, "shmdt failed\n");
+    exit();
+  }
+  printf(1, "shm ok\n");
+}
+
+// splice() between files and pipes, tee() between pipes
+void
+splicetest(void)
+{
+  int fd, p[2], q[2], n, i;
+
+  printf(1, "splice test\n");
+
+  fd = open("splicein", O_CREATE | O_RDWR);
+  for(i = 0; i < 3000; i++)
+    buf[i] = 'a' + i % 26;
+  if(fd < 0 || write(fd, buf, 3000) != 3000){
+    printf(1, "splice create failed\n");
+    exit();
+  }
+  close(fd);
+
+  if(pipe(p) < 0 || pipe(q) < 0){
+    printf(1, "splice pipe failed\n");
+    exit();
+  }
+  fd = open("splicein", O_RDONLY);
+  if(splice(fd, p[1], 1000) != 1000 || splice(fd, p[1], 5000) != 2000 ||
+     splice(fd, p[1], 10) != 0){
+    printf(1, "splice file to pipe failed\n");
+    exit();
+  }
+  close(fd);
+  if(splice(p[0], q[0], 10) != -1){
+    printf(1, "splice pipe to pipe succeeded\n");
+    exit();
+  }
+
+  if(tee(p[0], q[1], 100) != 100 || read(q[0], buf, sizeof(buf)) != 100 ||
+     buf[0] != 'a' || buf[99] != 'a' + 99 % 26){
+    printf(1, "tee failed\n");
+    exit();
+  }
+
+  fd = open("spliceout", O_CREATE | O_RDWR);
+  for(n = 0; n < 3000; ){
+    i = splice(p[0], fd, 3000 - n);
+    if(i <= 0){
+      printf(1, "splice pipe to file failed\n");
+      exit();
+    }
+    n += i;
+  }
+  close(fd);
+  fd = open("spliceout", O_RDONLY);
+  if(read(fd, buf, sizeof(buf)) != 3000){
+    printf(1, "splice wrong size\n");
+    exit();
+  }
+  for(i = 0; i < 3000; i++){
+    if(buf[i] != 'a' + i % 26){
+      printf(1, "splice wrong data at %d\n", i);
+      exit();
+    }
+  }
+  close(fd);
+  close(p[0]);
+  close(p[1]);
+  close(q[0]);
+  close(q[1]);
+  unlink("splicein");
+  unlink("spliceout");
+  printf(1, "splice ok\n");
+}
+
+// sendfile() from a file to a file, across several transactions
+void
+sendfiletest(void)
+{
+  int in, out, n, i, off;
+
+  printf(1, "sendfile test\n");
+
+  in = open("sendin", O_CREATE | O_RDWR);
+  if(in < 0){
+    printf(1, "sendfile create failed\n");
+    exit();
+  }
+  for(off = 0; off < 20000; off += 1000){
+    for(i = 0; i < 1000; i++)
+      buf[i] = (off + i) % 253;
+    if(write(in, buf, 1000) != 1000){
+      printf(1, "sendfile write failed\n");
+      exit();
+    }
+  }
+  close(in);
+
+  in = open("sendin", O_RDONLY);
+  out = open("sendout", O_CREATE | O_RDWR);
+  if(read(in, buf, 100) != 100 || sendfile(out, in, 15000) != 15000 ||
+     sendfile(out, in, 10000) != 4900 || sendfile(out, in, 10) != 0){
+    printf(1, "sendfile file to file failed\n");
+    exit();
+  }
+  if(sendfile(in, out, 10) != -1){
+    printf(1, "sendfile to read-only file succeeded\n");
+    exit();
+  }
+  close(in);
+  in = open("sendout", O_RDONLY);
+  if(sendfile(out, in, 10) != -1){
+    printf(1, "sendfile of a file onto itself succeeded\n");
+    exit();
+  }
+  close(in);
+  close(out);
+
+  out = open("sendout", O_RDONLY);
+  for(off = 0; (n = read(out, buf, 1000)) > 0; off += n){
+    for(i = 0; i < n; i++){
+      if(buf[i] != (char)((100 + off + i) % 253)){
+        printf(1, "sendfile wrong data at %d\n", off + i);
+        exit();
+      }
+    }
+  }
+  if(off != 19900){
+    printf(1, "sendfile wrong size %d\n", off);
+    exit();
+  }
+  close(out);
+  unlink("sendin");
+  unlink("sendout");
+  printf(1, "sendfile ok\n");
+}
+
+// readv() and writev() on a file and a pipe
+void
+iovtest(void)
+{
+  struct iovec iov[3];
+  char hdr[8], body[2000];
+  int fd, p[2], i;
+
+  printf(1, "iov test\n");
+
+  for(i = 0; i < sizeof(body); i++)
+    body[i] = 'a' + i % 26;
+  iov[0].iov_base = "header\n";
+  iov[0].iov_len = 7;
+  iov[1].iov_base = body;
+  iov[1].iov_len = sizeof(body);
+  iov[2].iov_base = "end\n";
+  iov[2].iov_len = 4;
+
+  fd = open("iovfile", O_CREATE | O_RDWR);
+  if(fd < 0 || writev(fd, iov, 3) != 2011){
+    printf(1, "writev file failed\n");
+    exit();
+  }
+  close(fd);
+  fd = open("iovfile", O_RDONLY);
+  iov[0].iov_base = hdr;
+  iov[1].iov_base = buf;
+  iov[1].iov_len = sizeof(buf);
+  if(readv(fd, iov, 2) != 2011 || memcmp(hdr, "header\n", 7) != 0 ||
+     memcmp(buf, body, sizeof(body)) != 0 || memcmp(buf + sizeof(body), "end\n", 4) != 0){
+    printf(1, "readv file failed\n");
+    exit();
+  }
+  close(fd);
+  unlink("iovfile");
+
+  if(pipe(p) < 0){
+    printf(1, "iov pipe failed\n");
+    exit();
+  }
+  iov[0].iov_base = "header\n";
+  iov[1].iov_base = body;
+  iov[1].iov_len = sizeof(body);
+  if(writev(p[1], iov, 3) != 2011){
+    printf(1, "writev pipe failed\n");
+    exit();
+  }
+  iov[0].iov_base = hdr;
+  iov[1].iov_base = buf;
+  iov[1].iov_len = sizeof(buf);
+  if(readv(p[0], iov, 2) != 2011 || memcmp(hdr, "header\n", 7) != 0 ||
+     memcmp(buf + sizeof(body), "end\n", 4) != 0){
+    printf(1, "readv pipe failed\n");
+    exit();
+  }
+  close(p[0]);
+  close(p[1]);
+
+  iov[0].iov_base = (void*)0x7fffffff;
+  if(writev(1, iov, 1) != -1 || writev(1, iov, IOV_MAX + 1) != -1){
+    printf(1, "writev bad iovec succeeded\n");
+    exit();
+  }
+  printf(1, "iov ok\n");
+}
+
+// futexwait()/futexwake() and umtxlock() across processes
+void
+futextest(void)
+{
+  struct umutex *m;
+  volatile uint *flag;
+  int id, pid, i;
+
+  printf(1, "futex test\n");
+
+  if((id = shmget(0, 4096)) < 0 || (m = shmat(id)) == (void*)-1){
+    printf(1, "futex shmget/shmat failed\n");
+    exit();
+  }
+  shmdel(id);
+  flag = (uint*)(m + 1);
+  if(futexwait(flag, 1) != -1 || futexwait((uint*)0x7ffffff0, 0) != -1){
+    printf(1, "futexwait did not fail\n");
+    exit();
+  }
+
+  umtxlock(m);
+  pid = fork();
+  if(pid < 0){
+    printf(1, "futex fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    umtxlock(m);
+    *flag = 1;
+    umtxunlock(m);
+    exit();
+  }
+  // The child waits in the kernel for the mutex.
+  for(i = 0; i < 10 && m->state != 2; i++)
+    sleep(1);
+  if(*flag != 0){
+    printf(1, "umtxlock let two processes in\n");
+    exit();
+  }
+  umtxunlock(m);
+  wait();
+  if(*flag != 1 || m->state != 0){
+    printf(1, "umtxunlock did not hand over\n");
+    exit();
+  }
+  shmdt(m);
+  printf(1, "futex ok\n");
+}
+
+#define LPG (4*1024*1024)
+
+// 4MB heap pages: fork() copies them, and shrinking
+// the heap into the middle of one keeps the rest.
+void
+largepagetest(void)
+{
+  char *a, *p, *oldbrk;
+  int i, pid;
+
+  printf(1, "large page test\n");
+  oldbrk = sbrk(0);
+  if((uint)oldbrk % LPG != 0)
+    sbrk(LPG - (uint)oldbrk % LPG);
+  if((a = sbrk(2*LPG)) == (char*)-1){
+    printf(1, "sbrk 8MB failed\n");
+    exit();
+  }
+  for(i = 0; i < 2*LPG; i += 4096)
+    a[i] = i / 4096;
+  pid = fork();
+  if(pid < 0){
+    printf(1, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    for(i = 0; i < 2*LPG; i += 4096){
+      if(a[i] != (char)(i / 4096)){
+        printf(1, "child sees wrong data at %x\n", a + i);
+        exit();
+      }
+      a[i] = 0;
+    }
+    exit();
+  }
+  wait();
+  for(i = 0; i < 2*LPG; i += 4096){
+    if(a[i] != (char)(i / 4096)){
+      printf(1, "child's writes showed in parent at %x\n", a + i);
+      exit();
+    }
+  }
+
+  sbrk(-(LPG/2));
+  for(i = 0; i < LPG + LPG/2; i += 4096){
+    if(a[i] != (char)(i / 4096)){
+      printf(1, "shrink lost data at %x\n", a + i);
+      exit();
+    }
+  }
+  p = sbrk(LPG/2);
+  for(i = 0; i < LPG/2; i += 4096){
+    if(p[i] != 0){
+      printf(1, "regrown heap not zeroed at %x\n", p + i);
+      exit();
+    }
+  }
+  sbrk(oldbrk - sbrk(0));
+  printf(1, "large page ok\n");
+}
+
+int
+bigstack(void)
+{
+  volatile char buf[256*1024];
+
+  buf[0] = 1;
+  return buf[0];
+}
+
+// The stack grows straight to a faulting address, however far
+// below it a big local array puts it, but not past its limit;
+// and the heap cannot grow up against it.
+void
+stacktest(void)
+{
+  int pid, ppid, fds[2];
+  char c;
+
+  printf(1, "stack test\n");
+  if(pipe(fds) < 0){
+    printf(1, "pipe failed\n");
+    exit();
+  }
+  pid = fork();
+  if(pid < 0){
+    printf(1, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    if(bigstack() == 1)
+      write(fds[1], "x", 1);
+    exit();
+  }
+  close(fds[1]);
+  if(read(fds[0], &c, 1) != 1){
+    printf(1, "big local array failed\n");
+    exit();
+  }
+  close(fds[0]);
+  wait();
+
+  ppid = getpid();
+  pid = fork();
+  if(pid < 0){
+    printf(1, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    if(stacklimit(128*1024, -1) < 0){
+      printf(1, "stacklimit failed\n");
+      kill(ppid);
+      exit();
+    }
+    bigstack();
+    printf(1, "stack grew past its limit\n");
+    kill(ppid);
+    exit();
+  }
+  wait();
+
+  if(sbrk(0x7ffff000 - (uint)sbrk(0)) != (char*)-1){
+    printf(1, "heap grew into the stack\n");
+    exit();
+  }
+  printf(1, "stack test ok\n");
+}
+
+// Program text is shared read-only between the processes running
+// it: a write to it kills the writer, and writing the program's
+// file leaves the text of the copies running it alone.
+void
+texttest(void)
+{
+  char *args[] = { "echo", "texttest", "ok", 0 };
+  int pid, ppid, fd;
+  char c, *p;
+
+  printf(1, "text test\n");
+  ppid = getpid();
+  pid = fork();
+  if(pid < 0){
+    printf(1, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    *(volatile char*)texttest = 0;
+    printf(1, "could write program text\n");
+    kill(ppid);
+    exit();
+  }
+  wait();
+
+  // Text cannot be unmapped; fork() copies every page below sz.
+  if(munmap((void*)((uint)texttest & ~4095), 4096) != -1){
+    printf(1, "munmap of program text succeeded\n");
+    exit();
+  }
+
+  // Write the first byte of our own text back to the file
+  // (text starts on the file's second page), while we run it.
+  if((fd = open("usertests", O_RDONLY)) < 0 ||
+     read(fd, buf, 4096) != 4096 || read(fd, &c, 1) != 1){
+    printf(1, "read usertests failed\n");
+    exit();
+  }
+  close(fd);
+  // Map the same page shared as well: the write must reach
+  // the mapping, which then forks and unmaps cleanly.
+  if((fd = open("usertests", O_RDWR)) < 0 ||
+     (p = mmap(0, 4096, PROT_READ, MAP_SHARED, fd, 4096)) == MAP_FAILED ||
+     p[0] != c || read(fd, buf, 4096) != 4096 || write(fd, &c, 1) != 1){
+    printf(1, "rewrite usertests failed\n");
+    exit();
+  }
+  close(fd);
+  if(p[0] != c){
+    printf(1, "shared mapping of text lost the write\n");
+    exit();
+  }
+  pid = fork();
+  if(pid < 0){
+    printf(1, "fork failed\n");
+    exit();
+  }
+  if(pid == 0)
+    exit();
+  wait();
+  if(munmap(p, 4096) < 0){
+    printf(1, "munmap failed\n");
+    exit();
+  }
+  pid = fork();
+  if(pid < 0){
+    printf(1, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    exec("echo", args);
+    printf(1, "exec echo failed\n");
+    exit();
+  }
+  wait();
+  printf(1, "text test ok\n");
+}
+
+// read() and write() copy between a file and user memory with
+// no check of the buffer beforehand: a buffer the process may
+// not use fails the call, and does not change the file.
+void
+copytest(void)
+{
+  struct stat st;
+  char *p;
+  int fd, fds[2];
+
+  printf(1, "copy test\n");
+  if((fd = open("usertests", O_RDONLY)) < 0){
+    printf(1, "open usertests failed\n");
+    exit();
+  }
+  if(read(fd, (char*)copytest, 16) != -1){
+    printf(1, "read into program text\n");
+    exit();
+  }
+  close(fd);
+
+  // A pipe copies under its spin lock; it too fails, and
+  // leaves the bytes for a read into a good buffer.
+  if(pipe(fds) < 0 || write(fds[1], "0123", 4) != 4){
+    printf(1, "pipe failed\n");
+    exit();
+  }
+  if(read(fds[0], (char*)copytest, 4) != -1){
+    printf(1, "pipe read into program text\n");
+    exit();
+  }
+  if(read(fds[0], buf, 4) != 4 || memcmp(buf, "0123", 4) != 0){
+    printf(1, "pipe lost its data\n");
+    exit();
+  }
+  close(fds[0]);
+  close(fds[1]);
+
+  // A write stops at the first byte it cannot read, here
+  // past the last 8 bytes of the heap's last page, and the
+  // file takes just the bytes before it.
+  p = (char*)(((uint)sbrk(0) + 4095) & ~4095) - 8;
+  memmove(p, "01234567", 8);
+  fd = open("copyfile", O_CREATE|O_RDWR);
+  if(fd < 0){
+    printf(1, "create copyfile failed\n");
+    exit();
+  }
+  if(write(fd, p, 16) != 8 || write(fd, (char*)0x80000000, 16) != -1){
+    printf(1, "write from unmapped memory\n");
+    exit();
+  }
+  if(fstat(fd, &st) < 0 || st.size != 8){
+    printf(1, "short write left copyfile size %d\n", st.size);
+    exit();
+  }
+  if(write(fd, "89abcdef", 8) != 8){
+    printf(1, "write copyfile failed\n");
+    exit();
+  }
+
+  // One that would have taken the file past the data kept
+  // in its inode, but stopped short of it, leaves it there.
+  if(write(fd, p, 64) != 8){
+    printf(1, "write from unmapped memory\n");
+    exit();
+  }
+  if(fstat(fd, &st) < 0 || st.size != 24){
+    printf(1, "short write left copyfile size %d\n", st.size);
+    exit();
+  }
+  memset(buf, 'x', 100);
+  if(write(fd, buf, 100) != 100){
+    printf(1, "write copyfile failed\n");
+    exit();
+  }
+  close(fd);
+  fd = open("copyfile", O_RDONLY);
+  if(fd < 0 || read(fd, buf, sizeof(buf)) != 124 ||
+     memcmp(buf, "0123456789abcdef01234567", 24) != 0 ||
+     buf[24] != 'x' || buf[123] != 'x'){
+    printf(1, "copyfile has wrong contents\n");
+    exit();
+  }
+  close(fd);
+  unlink("copyfile");
+  printf(1, "copy test ok\n");
+}
+
+int tcount;
+struct umutex tlock;
+char *tmem;
+
+void
+threadinc(void *arg)
+{
+  int i;
+
+  for(i = 0; i < 1000; i++){
+    umtxlock(&tlock);
+    tcount++;
+    umtxunlock(&tlock);
+  }
+  if((int)arg == 0){
+    tmem = sbrk(4096);
+    tmem[0] = 'T';
+  }
+}
+
+// clone() threads share memory, including memory one
+// of them allocates, and join() reaps them.
+void
+threadspin(void *arg)
+{
+  for(;;)
+    ;
+}
+
+void
+threadclose(void *arg)
+{
+  close((int)arg);
+}
+
+void
+threadtest(void)
+{
+  char *args[] = { "echo", "thread", "exec", 0 };
+  int i, k, fds[2];
+  char c;
+
+  printf(1, "thread test\n");
+  tcount = 0;
+  tmem = 0;
+  umtxinit(&tlock);
+  for(i = 0; i < 4; i++){
+    if(thread_create(threadinc, (void*)i) < 0){
+      printf(1, "thread_create failed\n");
+      exit();
+    }
+  }
+  for(i = 0; i < 4; i++){
+    if(thread_join() < 0){
+      printf(1, "thread_join failed\n");
+      exit();
+    }
+  }
+  if(thread_join() != -1){
+    printf(1, "thread_join found an extra thread\n");
+    exit();
+  }
+  if(tcount != 4000){
+    printf(1, "threads counted %d, not 4000\n", tcount);
+    exit();
+  }
+  if(tmem == 0 || tmem[0] != 'T'){
+    printf(1, "thread's sbrk() not shared\n");
+    exit();
+  }
+
+  // Threads share their open files.
+  if(pipe(fds) < 0){
+    printf(1, "pipe failed\n");
+    exit();
+  }
+  if(thread_create(threadclose, (void*)fds[1]) < 0 || thread_join() < 0){
+    printf(1, "thread_create failed\n");
+    exit();
+  }
+  if(write(fds[1], "x", 1) != -1){
+    printf(1, "thread's close() not shared\n");
+    exit();
+  }
+  close(fds[0]);
+
+  // exit() and exec() end the other threads of the process.
+  // The pipe's write end, which they share, closes only when
+  // the spinning thread has gone too.
+  for(k = 0; k < 2; k++){
+    if(pipe(fds) < 0){
+      printf(1, "pipe failed\n");
+      exit();
+    }
+    i = fork();
+    if(i < 0){
+      printf(1, "fork failed\n");
+      exit();
+    }
+    if(i == 0){
+      close(fds[0]);
+      if(thread_create(threadspin, 0) < 0){
+        printf(1, "thread_create failed\n");
+        exit();
+      }
+      if(k == 1){
+        exec("echo", args);
+        printf(1, "exec echo failed\n");
+      }
+      exit();
+    }
+    close(fds[1]);
+    if(read(fds[0], &c, 1) != 0){
+      printf(1, "read from pipe got data\n");
+      exit();
+    }
+    close(fds[0]);
+    wait();
+  }
+  printf(1, "thread ok\n");
+}
+
 void
 bigfile(void)
 {
@@ -1786,6 +2714,18 @@ main(int argc, char *argv[])
 
   rmdot();
   fourteen();
+  inlinefile();
+  mmaptest();
+  shmtest();
+  splicetest();
+  sendfiletest();
+  iovtest();
+  futextest();
+  largepagetest();
+  texttest();
+  stacktest();
+  copytest();
+  threadtest();
   bigfile();
   subdir();
   linktest();
@@ -0,0 +1,45 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+// Threads. thread_create() runs fn(arg) in a new thread that
+// shares this process's memory, on a one-page stack from
+// malloc(), and the thread exits when fn returns. thread_join()
+// waits for one to finish and frees its stack. clone() needs a
+// page-aligned stack, so the first word of the page remembers
+// the block malloc() returned.
+
+#define TSTACKSZ 4096
+
+static void
+threadstart(void *fn, void *arg)
+{
+  ((void (*)(void*))fn)(arg);
+  exit();
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+  char *mem, *stack;
+  int pid;
+
+  if((mem = malloc(2*TSTACKSZ)) == 0)
+    return -1;
+  stack = (char*)(((uint)mem + TSTACKSZ - 1) & ~(TSTACKSZ - 1));
+  *(char**)stack = mem;
+  if((pid = clone(threadstart, (void*)fn, arg, stack)) < 0)
+    free(mem);
+  return pid;
+}
+
+int
+thread_join(void)
+{
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    free(*(char**)stack);
+  return pid;
+}
@@ -5,6 +5,7 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "proc.h"
+#include "traps.h"
 #include "elf.h"
 
 extern char data[];  // defined by kernel.ld
@@ -26,26 +27,39 @@ seginit(void)
   c->gdt[SEG_KDATA] = SEG(STA_W, 0, 0xffffffff, 0);
   c->gdt[SEG_UCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, DPL_USER);
   c->gdt[SEG_UDATA] = SEG(STA_W, 0, 0xffffffff, DPL_USER);
+  // The task state only ever changes its kernel stack
+  // pointer, which switchuvm() sets, so load it once.
+  c->gdt[SEG_TSS] = SEG16(STS_T32A, &c->ts, sizeof(c->ts)-1, 0);
+  c->gdt[SEG_TSS].s = 0;
+  c->ts.ss0 = SEG_KDATA << 3;
+  // setting IOPL=0 in eflags *and* iomb beyond the tss segment limit
+  // forbids I/O instructions (e.g., inb and outb) from user space
+  c->ts.iomb = (ushort) 0xFFFF;
   lgdt(c->gdt, sizeof(c->gdt));
+  ltr(SEG_TSS << 3);
 }
 
 // Return the address of the PTE in page table pgdir
 // that corresponds to virtual address va.  If alloc!=0,
-// create any required page table pages.
-static pte_t *
+// create any required page table pages, swapping out
+// user memory for them if need be.  If va lies in
+// a 4MB page, return its page directory entry, which has
+// PTE_PS set; pteaddr() finds va's page within it.
+pte_t *
 walkpgdir(pde_t *pgdir, const void *va, int alloc)
 {
   pde_t *pde;
   pte_t *pgtab;
 
   pde = &pgdir[PDX(va)];
+  if(*pde & PTE_PS)
+    return pde;
   if(*pde & PTE_P){
     pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
   } else {
-    if(!alloc || (pgtab = (pte_t*)kalloc()) == 0)
-      return 0;
     // Make sure all those PTE_P bits are zero.
-    memset(pgtab, 0, PGSIZE);
+    if(!alloc || (pgtab = (pte_t*)uzalloc()) == 0)
+      return 0;
     // The permissions here are overly generous, but they can
     // be further restricted by the permissions in the page table
     // entries, if necessary.
@@ -54,10 +68,20 @@ walkpgdir(pde_t *pgdir, const void *va, int alloc)
   return &pgtab[PTX(va)];
 }
 
+// Return the physical address of the page holding va,
+// given the entry that walkpgdir() returned for it.
+static uint
+pteaddr(pte_t *pte, const void *va)
+{
+  if(*pte & PTE_PS)
+    return PTE_ADDR(*pte) + ((uint)va & (LPGSIZE-1) & ~(PGSIZE-1));
+  return PTE_ADDR(*pte);
+}
+
 // Create PTEs for virtual addresses starting at va that refer to
 // physical addresses starting at pa. va and size might not
 // be page-aligned.
-static int
+int
 mappages(pde_t *pgdir, void *va, uint size, uint pa, int perm)
 {
   char *a, *last;
@@ -85,6 +109,13 @@ mappages(pde_t *pgdir, void *va, uint size, uint pa, int perm)
 // page protection bits prevent user code from using the kernel's
 // mappings.
 //
+// kvmalloc() builds the kernel's half of kpgdir once, with 4MB
+// pages wherever the mapping is aligned for them, and marks its
+// entries global so that they stay in the TLB when cr3 changes.
+// setupkvm() copies those directory entries into each new page
+// table, so every process shares the kernel's page table pages
+// and freevm() leaves them alone.
+//
 // setupkvm() and exec() set up every page table like this:
 //
 //   0..KERNBASE: user memory (text+data+stack+heap), mapped to
@@ -114,33 +145,66 @@ static struct kmap {
  { (void*)DEVSPACE, DEVSPACE,      0,         PTE_W}, // more devices
 };
 
+// Map the kernel's [va, va+size) to pa in pgdir with global
+// entries: a 4MB page for each aligned 4MB stretch, 4KB pages
+// for the rest. va and pa must be page-aligned; size may run
+// to the top of the address space.
+static int
+kmappages(pde_t *pgdir, uint va, uint size, uint pa, int perm)
+{
+  pte_t *pte;
+
+  while(size > 0){
+    if(va % LPGSIZE == 0 && pa % LPGSIZE == 0 && size >= LPGSIZE){
+      if(pgdir[PDX(va)] & PTE_P)
+        panic("remap");
+      pgdir[PDX(va)] = pa | perm | PTE_P | PTE_PS | PTE_G;
+      va += LPGSIZE;
+      pa += LPGSIZE;
+      size -= LPGSIZE;
+      continue;
+    }
+    if((pte = walkpgdir(pgdir, (char*)va, 1)) == 0)
+      return -1;
+    if(*pte & PTE_P)
+      panic("remap");
+    *pte = pa | perm | PTE_P | PTE_G;
+    va += PGSIZE;
+    pa += PGSIZE;
+    size -= PGSIZE;
+  }
+  return 0;
+}
+
 // Set up kernel part of a page table.
 pde_t*
 setupkvm(void)
 {
   pde_t *pgdir;
-  struct kmap *k;
 
-  if((pgdir = (pde_t*)kalloc()) == 0)
+  if((pgdir = (pde_t*)uzalloc()) == 0)
     return 0;
-  memset(pgdir, 0, PGSIZE);
-  if (P2V(PHYSTOP) > (void*)DEVSPACE)
-    panic("PHYSTOP too high");
-  for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
-    if(mappages(pgdir, k->virt, k->phys_end - k->phys_start,
-                (uint)k->phys_start, k->perm) < 0) {
-      freevm(pgdir);
-      return 0;
-    }
+  memmove(&pgdir[PDX(KERNBASE)], &kpgdir[PDX(KERNBASE)],
+          (NPDENTRIES - PDX(KERNBASE)) * sizeof(pde_t));
   return pgdir;
 }
 
 // Allocate one page table for the machine for the kernel address
-// space for scheduler processes.
+// space for scheduler processes, and build the kernel mappings
+// that every other page table shares.
 void
 kvmalloc(void)
 {
-  kpgdir = setupkvm();
+  struct kmap *k;
+
+  if (P2V(PHYSTOP) > (void*)DEVSPACE)
+    panic("PHYSTOP too high");
+  if((kpgdir = (pde_t*)kzalloc()) == 0)
+    panic("kvmalloc");
+  for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
+    if(kmappages(kpgdir, (uint)k->virt, k->phys_end - k->phys_start,
+                 (uint)k->phys_start, k->perm) < 0)
+      panic("kvmalloc");
   switchkvm();
 }
 
@@ -153,27 +217,99 @@ switchkvm(void)
 }
 
 // Switch TSS and h/w page table to correspond to process p.
+// cr3 is left alone if p's page table is already loaded.
+// A process that has let go of its memory in exit() runs
+// on kpgdir.
 void
 switchuvm(struct proc *p)
 {
+  struct cpu *c;
+  pde_t *pgdir;
+
   if(p == 0)
     panic("switchuvm: no process");
   if(p->kstack == 0)
     panic("switchuvm: no kstack");
-  if(p->pgdir == 0)
+  pgdir = p->vm ? p->vm->pgdir : kpgdir;
+  if(pgdir == 0)
     panic("switchuvm: no pgdir");
 
   pushcli();
-  mycpu()->gdt[SEG_TSS] = SEG16(STS_T32A, &mycpu()->ts,
-                                sizeof(mycpu()->ts)-1, 0);
-  mycpu()->gdt[SEG_TSS].s = 0;
-  mycpu()->ts.ss0 = SEG_KDATA << 3;
-  mycpu()->ts.esp0 = (uint)p->kstack + KSTACKSIZE;
-  // setting IOPL=0 in eflags *and* iomb beyond the tss segment limit
-  // forbids I/O instructions (e.g., inb and outb) from user space
-  mycpu()->ts.iomb = (ushort) 0xFFFF;
-  ltr(SEG_TSS << 3);
-  lcr3(V2P(p->pgdir));  // switch to process's address space
+  c = mycpu();
+  c->ts.esp0 = (uint)p->kstack + KSTACKSIZE;
+  if(c->pgdir != pgdir){
+    lcr3(V2P(pgdir));  // switch to process's address space
+    c->pgdir = pgdir;
+  }
+  popcli();
+}
+
+// TLB shootdown. A CPU's TLB may hold entries of the page
+// table it last loaded, c->pgdir, whether it is running a
+// thread of that memory, another, or none. After removing
+// mappings from pgdir, and before freeing what they mapped,
+// tlbshoot() has every CPU with pgdir loaded forget them.
+// One CPU asks at a time: the one holding tlbbusy.
+static volatile uint tlbbusy;
+
+// Forget pgdir's entries, or switch to kpgdir if drop is set,
+// if this CPU has it loaded.
+static void
+tlbflush(struct cpu *c, pde_t *pgdir, int drop)
+{
+  if(drop && c->pgdir == pgdir)
+    c->pgdir = 0;
+  if(rcr3() == V2P(pgdir))
+    lcr3(drop ? V2P(kpgdir) : rcr3());
+}
+
+// Answer another CPU's tlbshoot(), if it has asked.
+// Interrupts must be off.
+void
+tlbintr(void)
+{
+  struct cpu *c = mycpu();
+
+  if(c->tlbpgdir == 0)
+    return;
+  tlbflush(c, c->tlbpgdir, c->tlbdrop);
+  c->tlbpgdir = 0;
+}
+
+// Make every CPU forget the entries of pgdir, whose mappings
+// changed, and wait until they have. If drop is set, CPUs stop
+// using pgdir altogether, which no thread may be running on,
+// so that it can be freed. May be called holding spin locks:
+// a CPU spinning for one answers in acquire().
+void
+tlbshoot(pde_t *pgdir, int drop)
+{
+  struct cpu *c, *me;
+  int n;
+
+  pushcli();
+  me = mycpu();
+  // The xchg orders the caller's changes to pgdir before
+  // the reads of c->pgdir; a CPU that loads pgdir after
+  // them sees the new entries.
+  while(xchg(&tlbbusy, 1) != 0){
+    pause();
+    tlbintr();
+  }
+  n = 0;
+  for(c = cpus; c < &cpus[ncpu]; c++){
+    if(c != me && c->pgdir == pgdir){
+      c->tlbdrop = drop;
+      c->tlbpgdir = pgdir;
+      lapicipi(c->apicid, T_IRQ0 + IRQ_TLB);
+      n++;
+    }
+  }
+  tlbflush(me, pgdir, drop);
+  for(c = cpus; n > 0 && c < &cpus[ncpu]; c++)
+    while(c->tlbpgdir)
+      pause();
+  xchg(&tlbbusy, 0);
   popcli();
 }
 
@@ -186,8 +322,7 @@ inituvm(pde_t *pgdir, char *init, uint sz)
 
   if(sz >= PGSIZE)
     panic("inituvm: more than a page");
-  mem = kalloc();
-  memset(mem, 0, PGSIZE);
+  mem = kzalloc();
   mappages(pgdir, 0, PGSIZE, V2P(mem), PTE_W|PTE_U);
   memmove(mem, init, sz);
 }
@@ -205,7 +340,7 @@ loaduvm(pde_t *pgdir, char *addr, struct inode *ip, uint offset, uint sz)
   for(i = 0; i < sz; i += PGSIZE){
     if((pte = walkpgdir(pgdir, addr+i, 0)) == 0)
       panic("loaduvm: address should exist");
-    pa = PTE_ADDR(*pte);
+    pa = pteaddr(pte, addr+i);
     if(sz - i < PGSIZE)
       n = sz - i;
     else
@@ -218,6 +353,9 @@ loaduvm(pde_t *pgdir, char *addr, struct inode *ip, uint offset, uint sz)
 
 // Allocate page tables and physical memory to grow process from oldsz to
 // newsz, which need not be page aligned.  Returns new size or 0 on error.
+// Each aligned 4MB stretch of the new memory is mapped with one large
+// page if a free 4MB chunk is left, and with 4096-byte pages if not,
+// which may come from swapping out other user memory.
 int
 allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 {
@@ -231,13 +369,19 @@ allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 
   a = PGROUNDUP(oldsz);
   for(; a < newsz; a += PGSIZE){
-    mem = kalloc();
+    if(a % LPGSIZE == 0 && newsz - a >= LPGSIZE &&
+       (pgdir[PDX(a)] & PTE_P) == 0 && (mem = kalloclarge()) != 0){
+      memset(mem, 0, LPGSIZE);
+      pgdir[PDX(a)] = V2P(mem) | PTE_PS | PTE_W | PTE_U | PTE_P;
+      a += LPGSIZE - PGSIZE;
+      continue;
+    }
+    mem = uzalloc();
     if(mem == 0){
       cprintf("allocuvm out of memory\n");
       deallocuvm(pgdir, newsz, oldsz);
       return 0;
     }
-    memset(mem, 0, PGSIZE);
     if(mappages(pgdir, (char*)a, PGSIZE, V2P(mem), PTE_W|PTE_U) < 0){
       cprintf("allocuvm out of memory (2)\n");
       deallocuvm(pgdir, newsz, oldsz);
@@ -248,33 +392,103 @@ allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
   return newsz;
 }
 
-// Deallocate user pages to bring the process size from oldsz to
-// newsz.  oldsz and newsz need not be page-aligned, nor does newsz
-// need to be less than oldsz.  oldsz can be larger than the actual
-// process size.  Returns the new process size.
-int
-deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
+// Replace the 4MB page holding va with a page table that maps the
+// same memory in 4096-byte pages, all but the last, which becomes
+// the page table. va must not lie in the last page, which the
+// caller is about to free anyway. No CPU may still be using the
+// 4MB entry, through which it could write to the page table.
+static void
+splitlarge(pde_t *pgdir, uint va)
+{
+  pde_t *pde;
+  pte_t *pgtab;
+  uint pa, flags, i;
+
+  pde = &pgdir[PDX(va)];
+  pa = PTE_ADDR(*pde);
+  flags = (PTE_FLAGS(*pde) & ~PTE_PS) | PTE_P;
+  pgtab = (pte_t*)P2V(pa + LPGSIZE - PGSIZE);
+  for(i = 0; i < NPTENTRIES - 1; i++)
+    pgtab[i] = (pa + i*PGSIZE) | flags;
+  pgtab[NPTENTRIES - 1] = 0;
+  *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
+}
+
+// Clear PTE_P in the entries of pgdir for [a, b), keeping the
+// frames they map, and have every CPU forget them; see
+// tlbshoot(). The caller then frees the frames, which no thread
+// can reach any more, and clears the entries. A thread that
+// faults on one meanwhile waits in swapfault() for vmlock(),
+// which the caller holds.
+void
+unmapuvm(pde_t *pgdir, uint a, uint b)
 {
+  pde_t *pde;
   pte_t *pte;
-  uint a, pa;
 
-  if(newsz >= oldsz)
-    return oldsz;
+  for(a = PGROUNDDOWN(a); a < b; a += PGSIZE){
+    pde = &pgdir[PDX(a)];
+    if((*pde & PTE_PS) && a % LPGSIZE == 0){
+      *pde &= ~PTE_P;
+      a += LPGSIZE - PGSIZE;
+      continue;
+    }
+    if(*pde & PTE_PS){
+      // Free only part of it, splitting it first.
+      *pde &= ~PTE_P;
+      tlbshoot(pgdir, 0);
+      splitlarge(pgdir, a);
+    }
+    pte = walkpgdir(pgdir, (char*)a, 0);
+    if(!pte)
+      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+    else if(*pte & PTE_P)
+      *pte &= ~PTE_P;
+  }
+  tlbshoot(pgdir, 0);
+}
+
+// Free the user pages of pgdir in [a, b), whose entries
+// unmapuvm() has cleared PTE_P in.
+static void
+freeuvm(pde_t *pgdir, uint a, uint b)
+{
+  pde_t *pde;
+  pte_t *pte;
 
-  a = PGROUNDUP(newsz);
-  for(; a  < oldsz; a += PGSIZE){
+  for(a = PGROUNDDOWN(a); a < b; a += PGSIZE){
+    pde = &pgdir[PDX(a)];
+    if(*pde & PTE_PS){
+      kfreelarge(P2V(PTE_ADDR(*pde)));
+      *pde = 0;
+      a += LPGSIZE - PGSIZE;
+      continue;
+    }
     pte = walkpgdir(pgdir, (char*)a, 0);
     if(!pte)
       a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
-    else if((*pte & PTE_P) != 0){
-      pa = PTE_ADDR(*pte);
-      if(pa == 0)
-        panic("kfree");
-      char *v = P2V(pa);
-      kfree(v);
+    else if(*pte & PTE_SWAP){
+      swapfree(*pte);
+      *pte = 0;
+    } else if(PTE_ADDR(*pte)){
+      kfree(P2V(PTE_ADDR(*pte)));
       *pte = 0;
     }
   }
+}
+
+// Deallocate user pages to bring the process size from oldsz to
+// newsz.  oldsz and newsz need not be page-aligned, nor does newsz
+// need to be less than oldsz.  oldsz can be larger than the actual
+// process size.  Returns the new process size.
+int
+deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
+{
+  if(newsz >= oldsz)
+    return oldsz;
+
+  unmapuvm(pgdir, PGROUNDUP(newsz), oldsz);
+  freeuvm(pgdir, PGROUNDUP(newsz), oldsz);
   return newsz;
 }
 
@@ -287,8 +501,12 @@ freevm(pde_t *pgdir)
 
   if(pgdir == 0)
     panic("freevm: no pgdir");
-  deallocuvm(pgdir, KERNBASE, 0);
-  for(i = 0; i < NPDENTRIES; i++){
+  // No thread runs on pgdir, but other CPUs may still have
+  // it loaded. Once they have let go, no TLB holds its entries.
+  tlbshoot(pgdir, 1);
+  freeuvm(pgdir, 0, KERNBASE);
+  // The kernel's page tables are shared; free only the user's.
+  for(i = 0; i < PDX(KERNBASE); i++){
     if(pgdir[i] & PTE_P){
       char * v = P2V(PTE_ADDR(pgdir[i]));
       kfree(v);
@@ -310,49 +528,66 @@ clearpteu(pde_t *pgdir, char *uva)
   *pte &= ~PTE_U;
 }
 
+// Copy the page at va of pgdir into d, or give d a
+// reference to it if it has been swapped out.
+static int
+copypage(pde_t *pgdir, pde_t *d, uint va)
+{
+  pte_t *pte;
+  char *mem;
+
+  if((pte = walkpgdir(pgdir, (void *) va, 0)) == 0)
+    panic("copyuvm: pte should exist");
+  if(!(*pte & (PTE_P|PTE_SWAP)))
+    panic("copyuvm: page not present");
+  if(*pte & PTE_TEXT)
+    return 0;  // program text, see vmacopy()
+  if(!(*pte & PTE_SWAP)){
+    if((mem = ualloc()) == 0)
+      return -1;
+    // ualloc() may have swapped the page out, or split
+    // the large page holding it.
+    pte = walkpgdir(pgdir, (void *) va, 0);
+    if(!(*pte & PTE_SWAP)){
+      memmove(mem, (char*)P2V(pteaddr(pte, (void *) va)), PGSIZE);
+      if(mappages(d, (void*)va, PGSIZE, V2P(mem), PTE_FLAGS(*pte) & ~PTE_PS) < 0){
+        kfree(mem);
+        return -1;
+      }
+      return 0;
+    }
+    kfree(mem);
+  }
+  return swapdup(d, va, *pte);
+}
+
 // Given a parent process's page table, create a copy
 // of it for a child.
 pde_t*
 copyuvm(pde_t *pgdir, uint sz, uint stacksz)
 {
-  // cprintf("copyuvm(pgdir=%p, sz=%p, stacksz=%p)\n", pgdir, sz, stacksz); // debug
   pde_t *d;
-  pte_t *pte;
-  uint pa, i, flags;
+  uint i;
   char *mem;
 
   if((d = setupkvm()) == 0)
     return 0;
   for(i = 0; i < sz; i += PGSIZE){
-    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0)
-      panic("copyuvm: pte should exist");
-    if(!(*pte & PTE_P))
-      panic("copyuvm: page not present");
-    pa = PTE_ADDR(*pte);
-    flags = PTE_FLAGS(*pte);
-    if((mem = kalloc()) == 0)
-      goto bad;
-    memmove(mem, (char*)P2V(pa), PGSIZE);
-    if(mappages(d, (void*)i, PGSIZE, V2P(mem), flags) < 0) {
-      kfree(mem);
-      goto bad;
+    if(i % LPGSIZE == 0 && (pgdir[PDX(i)] & PTE_PS) &&
+       (mem = kalloclarge()) != 0){
+      memmove(mem, P2V(PTE_ADDR(pgdir[PDX(i)])), LPGSIZE);
+      d[PDX(i)] = V2P(mem) | PTE_FLAGS(pgdir[PDX(i)]);
+      i += LPGSIZE - PGSIZE;
+      continue;
     }
-  }
-  for(i = stacksz; i < KERNBASE - PGSIZE; i += PGSIZE){
-    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0)
-      panic("copyuvm: pte should exist");
-    if(!(*pte & PTE_P))
-      panic("copyuvm: page not present");
-    pa = PTE_ADDR(*pte);
-    flags = PTE_FLAGS(*pte);
-    if((mem = kalloc()) == 0)
+    // Without a free chunk, a large page is copied
+    // into 4096-byte pages.
+    if(copypage(pgdir, d, i) < 0)
       goto bad;
-    memmove(mem, (char*)P2V(pa), PGSIZE);
-    if(mappages(d, (void*)i, PGSIZE, V2P(mem), flags) < 0) {
-      kfree(mem);
-      goto bad;
-    }
   }
+  for(i = stacksz; i < KERNBASE - PGSIZE; i += PGSIZE)
+    if(copypage(pgdir, d, i) < 0)
+      goto bad;
   return d;
 
 bad:
@@ -368,18 +603,18 @@ uva2ka(pde_t *pgdir, char *uva)
   pte_t *pte;
 
   pte = walkpgdir(pgdir, uva, 0);
-  if((*pte & PTE_P) == 0)
+  if(pte == 0 || (*pte & PTE_P) == 0)
     return 0;
   if((*pte & PTE_U) == 0)
     return 0;
-  return (char*)P2V(PTE_ADDR(*pte));
+  return (char*)P2V(pteaddr(pte, uva));
 }
 
 // Copy len bytes from p to user address va in page table pgdir.
 // Most useful when pgdir is not the current page table.
 // uva2ka ensures this only works for PTE_U pages.
 int
-copyout(pde_t *pgdir, uint va, void *p, uint len)
+copyoutuvm(pde_t *pgdir, uint va, void *p, uint len)
 {
   char *buf, *pa0;
   uint n, va0;
@@ -401,6 +636,54 @@ copyout(pde_t *pgdir, uint va, void *p, uint len)
   return 0;
 }
 
+// Do the n bytes at va lie in user space?
+static int
+isuser(uint va, uint n)
+{
+  return va < KERNBASE && n <= KERNBASE - va;
+}
+
+// Copy n bytes from user address va in the current page
+// table to dst. No page table walk: the copy runs straight
+// from va, and if part of it is not mapped the page fault
+// ends the copy and it returns -1 rather than faulting the
+// page in. The caller can then use checkptr() to bring the
+// pages in, with no locks held, and copy again.
+int
+copyin(void *dst, uint va, uint n)
+{
+  if(!isuser(va, n) || copyuser(dst, (void*)va, n) != 0)
+    return -1;
+  return 0;
+}
+
+// Copy n bytes from src to user address va in the current
+// page table, as copyin() does. Fails on read-only pages.
+int
+copyout(uint va, void *src, uint n)
+{
+  if(!isuser(va, n) || copyuser((void*)va, src, n) != 0)
+    return -1;
+  return 0;
+}
+
+// Move n bytes from src to dst, where either may be a user
+// address in the current page table, as memmove() for the
+// kernel's own buffers. readi() and writei() take both.
+// Returns the number of bytes not moved: 0, or more if part
+// of the user memory was missing, in which case the bytes
+// before that part have been moved.
+uint
+umove(void *dst, const void *src, uint n)
+{
+  if((uint)dst < KERNBASE)
+    return isuser((uint)dst, n) ? copyuser(dst, src, n) : n;
+  if((uint)src < KERNBASE)
+    return isuser((uint)src, n) ? copyuser(dst, src, n) : n;
+  memmove(dst, src, n);
+  return 0;
+}
+
 //PAGEBREAK!
 // Blank page.
 //PAGEBREAK!
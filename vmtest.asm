@@ -0,0 +1,2571 @@
+
+_vmtest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <f>:
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+char data[0x1000];
+void f(int n)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	53                   	push   %ebx
+       4:	83 ec 14             	sub    $0x14,%esp
+       7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+       a:	69 c3 29 5c 8f c2    	imul   $0xc28f5c29,%ebx,%eax
+      10:	05 50 b8 1e 05       	add    $0x51eb850,%eax
+      15:	c1 c8 02             	ror    $0x2,%eax
+    int m;
+    if (n % 100 == 0)
+      18:	3d 28 5c 8f 02       	cmp    $0x28f5c28,%eax
+      1d:	76 41                	jbe    60 <f+0x60>
+    {
+        printf(1, "recursive test %d: %p\n", n, &m);
+    }
+    if (n != 10000)
+      1f:	81 fb 10 27 00 00    	cmp    $0x2710,%ebx
+      25:	74 19                	je     40 <f+0x40>
+    {
+        f(n + 1);
+      27:	83 ec 0c             	sub    $0xc,%esp
+      2a:	83 c3 01             	add    $0x1,%ebx
+      2d:	53                   	push   %ebx
+      2e:	e8 cd ff ff ff       	call   0 <f>
+        {
+            // trap
+            printf(1, "%s\n", (uint)&m - 0x1000 * 8);
+        }
+    }
+}
+      33:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+      36:	83 c4 10             	add    $0x10,%esp
+      39:	c9                   	leave
+      3a:	c3                   	ret
+      3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      3f:	90                   	nop
+        m = fork();
+      40:	e8 ab 06 00 00       	call   6f0 <fork>
+      45:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if (m)
+      48:	85 c0                	test   %eax,%eax
+      4a:	74 34                	je     80 <f+0x80>
+            wait();
+      4c:	e8 e7 08 00 00       	call   938 <wait>
+}
+      51:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+      54:	c9                   	leave
+      55:	c3                   	ret
+      56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      5d:	8d 76 00             	lea    0x0(%esi),%esi
+        printf(1, "recursive test %d: %p\n", n, &m);
+      60:	8d 45 f4             	lea    -0xc(%ebp),%eax
+      63:	50                   	push   %eax
+      64:	53                   	push   %ebx
+      65:	68 e8 12 00 00       	push   $0x12e8
+      6a:	6a 01                	push   $0x1
+      6c:	e8 3f 0e 00 00       	call   eb0 <printf>
+      71:	83 c4 10             	add    $0x10,%esp
+      74:	eb a9                	jmp    1f <f+0x1f>
+      76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      7d:	8d 76 00             	lea    0x0(%esi),%esi
+            printf(1, "%s\n", (uint)&m - 0x1000 * 8);
+      80:	83 ec 04             	sub    $0x4,%esp
+      83:	8d 85 f4 7f ff ff    	lea    -0x800c(%ebp),%eax
+      89:	50                   	push   %eax
+      8a:	68 ff 12 00 00       	push   $0x12ff
+      8f:	6a 01                	push   $0x1
+      91:	e8 1a 0e 00 00       	call   eb0 <printf>
+}
+      96:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+            printf(1, "%s\n", (uint)&m - 0x1000 * 8);
+      99:	83 c4 10             	add    $0x10,%esp
+}
+      9c:	c9                   	leave
+      9d:	c3                   	ret
+      9e:	66 90                	xchg   %ax,%ax
+
+000000a0 <f2>:
+void f2(int n)
+{
+      a0:	55                   	push   %ebp
+      a1:	89 e5                	mov    %esp,%ebp
+      a3:	53                   	push   %ebx
+      a4:	81 ec 04 09 00 00    	sub    $0x904,%esp
+      aa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+      ad:	69 c3 29 5c 8f c2    	imul   $0xc28f5c29,%ebx,%eax
+      b3:	05 50 b8 1e 05       	add    $0x51eb850,%eax
+      b8:	c1 c8 02             	ror    $0x2,%eax
+    char m[0x100];
+    if (n % 100 == 0)
+      bb:	3d 28 5c 8f 02       	cmp    $0x28f5c28,%eax
+      c0:	0f 86 f2 00 00 00    	jbe    1b8 <f2+0x118>
+    {
+        printf(1, "recursive test %d: %p\n", n, &m);
+    }
+    f2(n + 1);
+      c6:	8d 53 01             	lea    0x1(%ebx),%edx
+      c9:	69 c2 29 5c 8f c2    	imul   $0xc28f5c29,%edx,%eax
+      cf:	05 50 b8 1e 05       	add    $0x51eb850,%eax
+      d4:	c1 c8 02             	ror    $0x2,%eax
+    if (n % 100 == 0)
+      d7:	3d 28 5c 8f 02       	cmp    $0x28f5c28,%eax
+      dc:	0f 86 d6 01 00 00    	jbe    2b8 <f2+0x218>
+    f2(n + 1);
+      e2:	8d 53 02             	lea    0x2(%ebx),%edx
+      e5:	69 c2 29 5c 8f c2    	imul   $0xc28f5c29,%edx,%eax
+      eb:	05 50 b8 1e 05       	add    $0x51eb850,%eax
+      f0:	c1 c8 02             	ror    $0x2,%eax
+    if (n % 100 == 0)
+      f3:	3d 28 5c 8f 02       	cmp    $0x28f5c28,%eax
+      f8:	0f 86 9a 01 00 00    	jbe    298 <f2+0x1f8>
+    f2(n + 1);
+      fe:	8d 53 03             	lea    0x3(%ebx),%edx
+     101:	69 c2 29 5c 8f c2    	imul   $0xc28f5c29,%edx,%eax
+     107:	05 50 b8 1e 05       	add    $0x51eb850,%eax
+     10c:	c1 c8 02             	ror    $0x2,%eax
+    if (n % 100 == 0)
+     10f:	3d 28 5c 8f 02       	cmp    $0x28f5c28,%eax
+     114:	0f 86 5e 01 00 00    	jbe    278 <f2+0x1d8>
+    f2(n + 1);
+     11a:	8d 53 04             	lea    0x4(%ebx),%edx
+     11d:	69 c2 29 5c 8f c2    	imul   $0xc28f5c29,%edx,%eax
+     123:	05 50 b8 1e 05       	add    $0x51eb850,%eax
+     128:	c1 c8 02             	ror    $0x2,%eax
+    if (n % 100 == 0)
+     12b:	3d 28 5c 8f 02       	cmp    $0x28f5c28,%eax
+     130:	0f 86 22 01 00 00    	jbe    258 <f2+0x1b8>
+    f2(n + 1);
+     136:	8d 53 05             	lea    0x5(%ebx),%edx
+     139:	69 c2 29 5c 8f c2    	imul   $0xc28f5c29,%edx,%eax
+     13f:	05 50 b8 1e 05       	add    $0x51eb850,%eax
+     144:	c1 c8 02             	ror    $0x2,%eax
+    if (n % 100 == 0)
+     147:	3d 28 5c 8f 02       	cmp    $0x28f5c28,%eax
+     14c:	0f 86 e6 00 00 00    	jbe    238 <f2+0x198>
+    f2(n + 1);
+     152:	8d 53 06             	lea    0x6(%ebx),%edx
+     155:	69 c2 29 5c 8f c2    	imul   $0xc28f5c29,%edx,%eax
+     15b:	05 50 b8 1e 05       	add    $0x51eb850,%eax
+     160:	c1 c8 02             	ror    $0x2,%eax
+    if (n % 100 == 0)
+     163:	3d 28 5c 8f 02       	cmp    $0x28f5c28,%eax
+     168:	0f 86 aa 00 00 00    	jbe    218 <f2+0x178>
+    f2(n + 1);
+     16e:	8d 53 07             	lea    0x7(%ebx),%edx
+     171:	69 c2 29 5c 8f c2    	imul   $0xc28f5c29,%edx,%eax
+     177:	05 50 b8 1e 05       	add    $0x51eb850,%eax
+     17c:	c1 c8 02             	ror    $0x2,%eax
+    if (n % 100 == 0)
+     17f:	3d 28 5c 8f 02       	cmp    $0x28f5c28,%eax
+     184:	76 72                	jbe    1f8 <f2+0x158>
+    f2(n + 1);
+     186:	8d 53 08             	lea    0x8(%ebx),%edx
+     189:	69 c2 29 5c 8f c2    	imul   $0xc28f5c29,%edx,%eax
+     18f:	05 50 b8 1e 05       	add    $0x51eb850,%eax
+     194:	c1 c8 02             	ror    $0x2,%eax
+    if (n % 100 == 0)
+     197:	3d 28 5c 8f 02       	cmp    $0x28f5c28,%eax
+     19c:	76 3a                	jbe    1d8 <f2+0x138>
+    f2(n + 1);
+     19e:	83 ec 0c             	sub    $0xc,%esp
+     1a1:	83 c3 09             	add    $0x9,%ebx
+     1a4:	53                   	push   %ebx
+     1a5:	e8 f6 fe ff ff       	call   a0 <f2>
+}
+     1aa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     1ad:	83 c4 10             	add    $0x10,%esp
+     1b0:	c9                   	leave
+     1b1:	c3                   	ret
+     1b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        printf(1, "recursive test %d: %p\n", n, &m);
+     1b8:	8d 85 f8 f6 ff ff    	lea    -0x908(%ebp),%eax
+     1be:	50                   	push   %eax
+     1bf:	53                   	push   %ebx
+     1c0:	68 e8 12 00 00       	push   $0x12e8
+     1c5:	6a 01                	push   $0x1
+     1c7:	e8 e4 0c 00 00       	call   eb0 <printf>
+     1cc:	83 c4 10             	add    $0x10,%esp
+     1cf:	e9 f2 fe ff ff       	jmp    c6 <f2+0x26>
+     1d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     1d8:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+     1de:	50                   	push   %eax
+     1df:	52                   	push   %edx
+     1e0:	68 e8 12 00 00       	push   $0x12e8
+     1e5:	6a 01                	push   $0x1
+     1e7:	e8 c4 0c 00 00       	call   eb0 <printf>
+     1ec:	83 c4 10             	add    $0x10,%esp
+     1ef:	eb ad                	jmp    19e <f2+0xfe>
+     1f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1f8:	8d 85 f8 fd ff ff    	lea    -0x208(%ebp),%eax
+     1fe:	50                   	push   %eax
+     1ff:	52                   	push   %edx
+     200:	68 e8 12 00 00       	push   $0x12e8
+     205:	6a 01                	push   $0x1
+     207:	e8 a4 0c 00 00       	call   eb0 <printf>
+     20c:	83 c4 10             	add    $0x10,%esp
+     20f:	e9 72 ff ff ff       	jmp    186 <f2+0xe6>
+     214:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     218:	8d 85 f8 fc ff ff    	lea    -0x308(%ebp),%eax
+     21e:	50                   	push   %eax
+     21f:	52                   	push   %edx
+     220:	68 e8 12 00 00       	push   $0x12e8
+     225:	6a 01                	push   $0x1
+     227:	e8 84 0c 00 00       	call   eb0 <printf>
+     22c:	83 c4 10             	add    $0x10,%esp
+     22f:	e9 3a ff ff ff       	jmp    16e <f2+0xce>
+     234:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     238:	8d 85 f8 fb ff ff    	lea    -0x408(%ebp),%eax
+     23e:	50                   	push   %eax
+     23f:	52                   	push   %edx
+     240:	68 e8 12 00 00       	push   $0x12e8
+     245:	6a 01                	push   $0x1
+     247:	e8 64 0c 00 00       	call   eb0 <printf>
+     24c:	83 c4 10             	add    $0x10,%esp
+     24f:	e9 fe fe ff ff       	jmp    152 <f2+0xb2>
+     254:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     258:	8d 85 f8 fa ff ff    	lea    -0x508(%ebp),%eax
+     25e:	50                   	push   %eax
+     25f:	52                   	push   %edx
+     260:	68 e8 12 00 00       	push   $0x12e8
+     265:	6a 01                	push   $0x1
+     267:	e8 44 0c 00 00       	call   eb0 <printf>
+     26c:	83 c4 10             	add    $0x10,%esp
+     26f:	e9 c2 fe ff ff       	jmp    136 <f2+0x96>
+     274:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     278:	8d 85 f8 f9 ff ff    	lea    -0x608(%ebp),%eax
+     27e:	50                   	push   %eax
+     27f:	52                   	push   %edx
+     280:	68 e8 12 00 00       	push   $0x12e8
+     285:	6a 01                	push   $0x1
+     287:	e8 24 0c 00 00       	call   eb0 <printf>
+     28c:	83 c4 10             	add    $0x10,%esp
+     28f:	e9 86 fe ff ff       	jmp    11a <f2+0x7a>
+     294:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     298:	8d 85 f8 f8 ff ff    	lea    -0x708(%ebp),%eax
+     29e:	50                   	push   %eax
+     29f:	52                   	push   %edx
+     2a0:	68 e8 12 00 00       	push   $0x12e8
+     2a5:	6a 01                	push   $0x1
+     2a7:	e8 04 0c 00 00       	call   eb0 <printf>
+     2ac:	83 c4 10             	add    $0x10,%esp
+     2af:	e9 4a fe ff ff       	jmp    fe <f2+0x5e>
+     2b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2b8:	8d 85 f8 f7 ff ff    	lea    -0x808(%ebp),%eax
+     2be:	50                   	push   %eax
+     2bf:	52                   	push   %edx
+     2c0:	68 e8 12 00 00       	push   $0x12e8
+     2c5:	6a 01                	push   $0x1
+     2c7:	e8 e4 0b 00 00       	call   eb0 <printf>
+     2cc:	83 c4 10             	add    $0x10,%esp
+     2cf:	e9 0e fe ff ff       	jmp    e2 <f2+0x42>
+     2d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2df:	90                   	nop
+
+000002e0 <f3>:
+void f3()
+{
+     2e0:	55                   	push   %ebp
+     2e1:	89 e5                	mov    %esp,%ebp
+     2e3:	56                   	push   %esi
+     2e4:	53                   	push   %ebx
+    void *p = malloc(0x1000000);
+    printf(1, "p=%p\n", p + 0x1000000);
+    int m;
+    uint addr = (uint)&m;
+     2e5:	8d 75 f4             	lea    -0xc(%ebp),%esi
+    uint addr2 = addr;
+    for (int i = 0; ; i++)
+     2e8:	31 db                	xor    %ebx,%ebx
+{
+     2ea:	83 ec 1c             	sub    $0x1c,%esp
+    void *p = malloc(0x1000000);
+     2ed:	68 00 00 00 01       	push   $0x1000000
+     2f2:	e8 09 0e 00 00       	call   1100 <malloc>
+    printf(1, "p=%p\n", p + 0x1000000);
+     2f7:	83 c4 0c             	add    $0xc,%esp
+     2fa:	05 00 00 00 01       	add    $0x1000000,%eax
+     2ff:	50                   	push   %eax
+     300:	68 34 13 00 00       	push   $0x1334
+     305:	6a 01                	push   $0x1
+     307:	e8 a4 0b 00 00       	call   eb0 <printf>
+    uint addr = (uint)&m;
+     30c:	83 c4 10             	add    $0x10,%esp
+     30f:	eb 2a                	jmp    33b <f3+0x5b>
+     311:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    {
+        if (i % 100 == 0)
+        {
+            printf(1, "%p = %d stack=%x\n", addr, *(char *)addr, addr2 - addr);
+     318:	89 da                	mov    %ebx,%edx
+     31a:	83 ec 0c             	sub    $0xc,%esp
+     31d:	c1 e2 0c             	shl    $0xc,%edx
+     320:	52                   	push   %edx
+     321:	50                   	push   %eax
+     322:	56                   	push   %esi
+     323:	68 3a 13 00 00       	push   $0x133a
+     328:	6a 01                	push   $0x1
+     32a:	e8 81 0b 00 00       	call   eb0 <printf>
+     32f:	83 c4 20             	add    $0x20,%esp
+        }
+        else
+        {
+            printf(1, "", *(char *)addr);
+        }
+        addr -= 0x1000;
+     332:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+    for (int i = 0; ; i++)
+     338:	83 c3 01             	add    $0x1,%ebx
+            printf(1, "%p = %d stack=%x\n", addr, *(char *)addr, addr2 - addr);
+     33b:	69 d3 29 5c 8f c2    	imul   $0xc28f5c29,%ebx,%edx
+     341:	0f be 06             	movsbl (%esi),%eax
+     344:	c1 ca 02             	ror    $0x2,%edx
+        if (i % 100 == 0)
+     347:	81 fa 28 5c 8f 02    	cmp    $0x28f5c28,%edx
+     34d:	76 c9                	jbe    318 <f3+0x38>
+            printf(1, "", *(char *)addr);
+     34f:	83 ec 04             	sub    $0x4,%esp
+     352:	50                   	push   %eax
+     353:	68 fe 12 00 00       	push   $0x12fe
+     358:	6a 01                	push   $0x1
+     35a:	e8 51 0b 00 00       	call   eb0 <printf>
+     35f:	83 c4 10             	add    $0x10,%esp
+     362:	eb ce                	jmp    332 <f3+0x52>
+     364:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     36b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     36f:	90                   	nop
+
+00000370 <f4>:
+    } 
+}
+void f4()
+{
+     370:	55                   	push   %ebp
+     371:	89 e5                	mov    %esp,%ebp
+     373:	53                   	push   %ebx
+    char *s;
+    for (int i = 0; ; i++)
+     374:	31 db                	xor    %ebx,%ebx
+{
+     376:	83 ec 04             	sub    $0x4,%esp
+     379:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    {
+        s = sbrk(0x1000);
+     380:	83 ec 0c             	sub    $0xc,%esp
+     383:	68 00 10 00 00       	push   $0x1000
+     388:	e8 2b 06 00 00       	call   9b8 <sbrk>
+     38d:	69 d3 29 5c 8f c2    	imul   $0xc28f5c29,%ebx,%edx
+     393:	83 c4 10             	add    $0x10,%esp
+     396:	c1 ca 02             	ror    $0x2,%edx
+        if (i % 100 == 0)
+     399:	81 fa 28 5c 8f 02    	cmp    $0x28f5c28,%edx
+     39f:	77 13                	ja     3b4 <f4+0x44>
+        {
+            printf(1, "sbrk() = %p\n", s);
+     3a1:	83 ec 04             	sub    $0x4,%esp
+     3a4:	50                   	push   %eax
+     3a5:	68 4c 13 00 00       	push   $0x134c
+     3aa:	6a 01                	push   $0x1
+     3ac:	e8 ff 0a 00 00       	call   eb0 <printf>
+     3b1:	83 c4 10             	add    $0x10,%esp
+    for (int i = 0; ; i++)
+     3b4:	83 c3 01             	add    $0x1,%ebx
+        s = sbrk(0x1000);
+     3b7:	eb c7                	jmp    380 <f4+0x10>
+     3b9:	66 90                	xchg   %ax,%ax
+     3bb:	66 90                	xchg   %ax,%ax
+     3bd:	66 90                	xchg   %ax,%ax
+     3bf:	90                   	nop
+
+000003c0 <main>:
+        }
+    } 
+    
+}
+int main(int argc, char *argv[])
+{
+     3c0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     3c4:	83 e4 f0             	and    $0xfffffff0,%esp
+     3c7:	ff 71 fc             	push   -0x4(%ecx)
+     3ca:	55                   	push   %ebp
+     3cb:	89 e5                	mov    %esp,%ebp
+     3cd:	53                   	push   %ebx
+     3ce:	51                   	push   %ecx
+     3cf:	83 ec 1c             	sub    $0x1c,%esp
+    uint m = 0xdeadbeef;
+     3d2:	c7 45 f4 ef be ad de 	movl   $0xdeadbeef,-0xc(%ebp)
+    void *heap = malloc(0x1000);
+     3d9:	68 00 10 00 00       	push   $0x1000
+     3de:	e8 1d 0d 00 00       	call   1100 <malloc>
+    printf(1, "main is %p\n", main);
+     3e3:	83 c4 0c             	add    $0xc,%esp
+     3e6:	68 c0 03 00 00       	push   $0x3c0
+    void *heap = malloc(0x1000);
+     3eb:	89 c3                	mov    %eax,%ebx
+    printf(1, "main is %p\n", main);
+     3ed:	68 03 13 00 00       	push   $0x1303
+     3f2:	6a 01                	push   $0x1
+     3f4:	e8 b7 0a 00 00       	call   eb0 <printf>
+    printf(1, "data is %p\n", data);
+     3f9:	83 c4 0c             	add    $0xc,%esp
+     3fc:	68 20 22 00 00       	push   $0x2220
+     401:	68 0f 13 00 00       	push   $0x130f
+     406:	6a 01                	push   $0x1
+     408:	e8 a3 0a 00 00       	call   eb0 <printf>
+    printf(1, "stack is %p\n", &m);
+     40d:	83 c4 0c             	add    $0xc,%esp
+     410:	8d 45 f4             	lea    -0xc(%ebp),%eax
+     413:	50                   	push   %eax
+     414:	68 1b 13 00 00       	push   $0x131b
+     419:	6a 01                	push   $0x1
+     41b:	e8 90 0a 00 00       	call   eb0 <printf>
+    printf(1, "heap is %p\n", heap);
+     420:	83 c4 0c             	add    $0xc,%esp
+     423:	53                   	push   %ebx
+     424:	68 28 13 00 00       	push   $0x1328
+     429:	6a 01                	push   $0x1
+     42b:	e8 80 0a 00 00       	call   eb0 <printf>
+    f(0);
+     430:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+     437:	e8 c4 fb ff ff       	call   0 <f>
+    // for (uint i = 0; ; i++)
+    // {
+    //     printf(1, "%p ", (&m)[i]);
+    // }
+    
+    ((void (*)())0x7ffff000)();
+     43c:	b8 00 f0 ff 7f       	mov    $0x7ffff000,%eax
+     441:	ff d0                	call   *%eax
+    // ((void (*)())0xffffffff)();
+    // no exit here, cause trap at 0xffffffff
+    exit();
+     443:	e8 d8 02 00 00       	call   720 <exit>
+     448:	66 90                	xchg   %ax,%ax
+     44a:	66 90                	xchg   %ax,%ax
+     44c:	66 90                	xchg   %ax,%ax
+     44e:	66 90                	xchg   %ax,%ax
+
+00000450 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     450:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     451:	31 c0                	xor    %eax,%eax
+{
+     453:	89 e5                	mov    %esp,%ebp
+     455:	53                   	push   %ebx
+     456:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     459:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     45c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     460:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     464:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     467:	83 c0 01             	add    $0x1,%eax
+     46a:	84 d2                	test   %dl,%dl
+     46c:	75 f2                	jne    460 <strcpy+0x10>
+    ;
+  return os;
+}
+     46e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     471:	89 c8                	mov    %ecx,%eax
+     473:	c9                   	leave
+     474:	c3                   	ret
+     475:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     47c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000480 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     480:	55                   	push   %ebp
+     481:	89 e5                	mov    %esp,%ebp
+     483:	53                   	push   %ebx
+     484:	8b 55 08             	mov    0x8(%ebp),%edx
+     487:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     48a:	0f b6 02             	movzbl (%edx),%eax
+     48d:	84 c0                	test   %al,%al
+     48f:	75 17                	jne    4a8 <strcmp+0x28>
+     491:	eb 3a                	jmp    4cd <strcmp+0x4d>
+     493:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     497:	90                   	nop
+     498:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     49c:	83 c2 01             	add    $0x1,%edx
+     49f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     4a2:	84 c0                	test   %al,%al
+     4a4:	74 1a                	je     4c0 <strcmp+0x40>
+    p++, q++;
+     4a6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     4a8:	0f b6 19             	movzbl (%ecx),%ebx
+     4ab:	38 c3                	cmp    %al,%bl
+     4ad:	74 e9                	je     498 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     4af:	29 d8                	sub    %ebx,%eax
+}
+     4b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     4b4:	c9                   	leave
+     4b5:	c3                   	ret
+     4b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4bd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     4c0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     4c4:	31 c0                	xor    %eax,%eax
+     4c6:	29 d8                	sub    %ebx,%eax
+}
+     4c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     4cb:	c9                   	leave
+     4cc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     4cd:	0f b6 19             	movzbl (%ecx),%ebx
+     4d0:	31 c0                	xor    %eax,%eax
+     4d2:	eb db                	jmp    4af <strcmp+0x2f>
+     4d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     4df:	90                   	nop
+
+000004e0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     4e0:	55                   	push   %ebp
+     4e1:	89 e5                	mov    %esp,%ebp
+     4e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     4e6:	80 3a 00             	cmpb   $0x0,(%edx)
+     4e9:	74 15                	je     500 <strlen+0x20>
+     4eb:	31 c0                	xor    %eax,%eax
+     4ed:	8d 76 00             	lea    0x0(%esi),%esi
+     4f0:	83 c0 01             	add    $0x1,%eax
+     4f3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     4f7:	89 c1                	mov    %eax,%ecx
+     4f9:	75 f5                	jne    4f0 <strlen+0x10>
+    ;
+  return n;
+}
+     4fb:	89 c8                	mov    %ecx,%eax
+     4fd:	5d                   	pop    %ebp
+     4fe:	c3                   	ret
+     4ff:	90                   	nop
+  for(n = 0; s[n]; n++)
+     500:	31 c9                	xor    %ecx,%ecx
+}
+     502:	5d                   	pop    %ebp
+     503:	89 c8                	mov    %ecx,%eax
+     505:	c3                   	ret
+     506:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     50d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000510 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     510:	55                   	push   %ebp
+     511:	89 e5                	mov    %esp,%ebp
+     513:	57                   	push   %edi
+     514:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     517:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     51a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     51d:	89 d7                	mov    %edx,%edi
+     51f:	fc                   	cld
+     520:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     522:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     525:	89 d0                	mov    %edx,%eax
+     527:	c9                   	leave
+     528:	c3                   	ret
+     529:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000530 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     530:	55                   	push   %ebp
+     531:	89 e5                	mov    %esp,%ebp
+     533:	56                   	push   %esi
+     534:	53                   	push   %ebx
+     535:	8b 75 10             	mov    0x10(%ebp),%esi
+     538:	8b 55 08             	mov    0x8(%ebp),%edx
+     53b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+     53e:	85 f6                	test   %esi,%esi
+     540:	74 2e                	je     570 <memcmp+0x40>
+     542:	01 c6                	add    %eax,%esi
+     544:	eb 14                	jmp    55a <memcmp+0x2a>
+     546:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     54d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+     550:	83 c0 01             	add    $0x1,%eax
+     553:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+     556:	39 f0                	cmp    %esi,%eax
+     558:	74 16                	je     570 <memcmp+0x40>
+    if(*s1 != *s2)
+     55a:	0f b6 0a             	movzbl (%edx),%ecx
+     55d:	0f b6 18             	movzbl (%eax),%ebx
+     560:	38 d9                	cmp    %bl,%cl
+     562:	74 ec                	je     550 <memcmp+0x20>
+      return *s1 - *s2;
+     564:	0f b6 c1             	movzbl %cl,%eax
+     567:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+     569:	5b                   	pop    %ebx
+     56a:	5e                   	pop    %esi
+     56b:	5d                   	pop    %ebp
+     56c:	c3                   	ret
+     56d:	8d 76 00             	lea    0x0(%esi),%esi
+     570:	5b                   	pop    %ebx
+  return 0;
+     571:	31 c0                	xor    %eax,%eax
+}
+     573:	5e                   	pop    %esi
+     574:	5d                   	pop    %ebp
+     575:	c3                   	ret
+     576:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     57d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000580 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     580:	55                   	push   %ebp
+     581:	89 e5                	mov    %esp,%ebp
+     583:	8b 45 08             	mov    0x8(%ebp),%eax
+     586:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     58a:	0f b6 10             	movzbl (%eax),%edx
+     58d:	84 d2                	test   %dl,%dl
+     58f:	75 12                	jne    5a3 <strchr+0x23>
+     591:	eb 1d                	jmp    5b0 <strchr+0x30>
+     593:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     597:	90                   	nop
+     598:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     59c:	83 c0 01             	add    $0x1,%eax
+     59f:	84 d2                	test   %dl,%dl
+     5a1:	74 0d                	je     5b0 <strchr+0x30>
+    if(*s == c)
+     5a3:	38 d1                	cmp    %dl,%cl
+     5a5:	75 f1                	jne    598 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     5a7:	5d                   	pop    %ebp
+     5a8:	c3                   	ret
+     5a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     5b0:	31 c0                	xor    %eax,%eax
+}
+     5b2:	5d                   	pop    %ebp
+     5b3:	c3                   	ret
+     5b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     5bf:	90                   	nop
+
+000005c0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     5c0:	55                   	push   %ebp
+     5c1:	89 e5                	mov    %esp,%ebp
+     5c3:	57                   	push   %edi
+     5c4:	56                   	push   %esi
+int
+read(int fd, void *buf, int n)
+{
+  if(flushhook)
+    flushhook();
+  return _read(fd, buf, n);
+     5c5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     5c8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     5c9:	31 db                	xor    %ebx,%ebx
+{
+     5cb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     5ce:	eb 32                	jmp    602 <gets+0x42>
+  if(flushhook)
+     5d0:	a1 20 32 00 00       	mov    0x3220,%eax
+     5d5:	85 c0                	test   %eax,%eax
+     5d7:	74 02                	je     5db <gets+0x1b>
+    flushhook();
+     5d9:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+     5db:	83 ec 04             	sub    $0x4,%esp
+     5de:	6a 01                	push   $0x1
+     5e0:	56                   	push   %esi
+     5e1:	6a 00                	push   $0x0
+     5e3:	e8 60 03 00 00       	call   948 <_read>
+    if(cc < 1)
+     5e8:	83 c4 10             	add    $0x10,%esp
+     5eb:	85 c0                	test   %eax,%eax
+     5ed:	7e 1d                	jle    60c <gets+0x4c>
+    buf[i++] = c;
+     5ef:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     5f3:	8b 55 08             	mov    0x8(%ebp),%edx
+     5f6:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     5fa:	3c 0a                	cmp    $0xa,%al
+     5fc:	74 10                	je     60e <gets+0x4e>
+     5fe:	3c 0d                	cmp    $0xd,%al
+     600:	74 0c                	je     60e <gets+0x4e>
+  for(i=0; i+1 < max; ){
+     602:	89 df                	mov    %ebx,%edi
+     604:	83 c3 01             	add    $0x1,%ebx
+     607:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     60a:	7c c4                	jl     5d0 <gets+0x10>
+     60c:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+     60e:	8b 45 08             	mov    0x8(%ebp),%eax
+     611:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+     615:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     618:	5b                   	pop    %ebx
+     619:	5e                   	pop    %esi
+     61a:	5f                   	pop    %edi
+     61b:	5d                   	pop    %ebp
+     61c:	c3                   	ret
+     61d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000620 <stat>:
+{
+     620:	55                   	push   %ebp
+     621:	89 e5                	mov    %esp,%ebp
+     623:	56                   	push   %esi
+     624:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+     625:	83 ec 08             	sub    $0x8,%esp
+     628:	6a 00                	push   $0x0
+     62a:	ff 75 08             	push   0x8(%ebp)
+     62d:	e8 3e 03 00 00       	call   970 <open>
+  if(fd < 0)
+     632:	83 c4 10             	add    $0x10,%esp
+     635:	85 c0                	test   %eax,%eax
+     637:	78 37                	js     670 <stat+0x50>
+  r = fstat(fd, st);
+     639:	83 ec 08             	sub    $0x8,%esp
+     63c:	ff 75 0c             	push   0xc(%ebp)
+     63f:	89 c3                	mov    %eax,%ebx
+     641:	50                   	push   %eax
+     642:	e8 41 03 00 00       	call   988 <fstat>
+}
+
+int
+close(int fd)
+{
+  if(flushhook)
+     647:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+     64a:	89 c6                	mov    %eax,%esi
+  if(flushhook)
+     64c:	a1 20 32 00 00       	mov    0x3220,%eax
+     651:	85 c0                	test   %eax,%eax
+     653:	74 02                	je     657 <stat+0x37>
+    flushhook();
+     655:	ff d0                	call   *%eax
+  return _close(fd);
+     657:	83 ec 0c             	sub    $0xc,%esp
+     65a:	53                   	push   %ebx
+     65b:	e8 f8 02 00 00       	call   958 <_close>
+     660:	83 c4 10             	add    $0x10,%esp
+}
+     663:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     666:	89 f0                	mov    %esi,%eax
+     668:	5b                   	pop    %ebx
+     669:	5e                   	pop    %esi
+     66a:	5d                   	pop    %ebp
+     66b:	c3                   	ret
+     66c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+     670:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     675:	eb ec                	jmp    663 <stat+0x43>
+     677:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     67e:	66 90                	xchg   %ax,%ax
+
+00000680 <atoi>:
+{
+     680:	55                   	push   %ebp
+     681:	89 e5                	mov    %esp,%ebp
+     683:	53                   	push   %ebx
+     684:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+     687:	0f be 02             	movsbl (%edx),%eax
+     68a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     68d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     690:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     695:	77 1e                	ja     6b5 <atoi+0x35>
+     697:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     69e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     6a0:	83 c2 01             	add    $0x1,%edx
+     6a3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     6a6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     6aa:	0f be 02             	movsbl (%edx),%eax
+     6ad:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     6b0:	80 fb 09             	cmp    $0x9,%bl
+     6b3:	76 eb                	jbe    6a0 <atoi+0x20>
+}
+     6b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     6b8:	89 c8                	mov    %ecx,%eax
+     6ba:	c9                   	leave
+     6bb:	c3                   	ret
+     6bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006c0 <memmove>:
+{
+     6c0:	55                   	push   %ebp
+     6c1:	89 e5                	mov    %esp,%ebp
+     6c3:	57                   	push   %edi
+     6c4:	56                   	push   %esi
+     6c5:	8b 45 10             	mov    0x10(%ebp),%eax
+     6c8:	8b 55 08             	mov    0x8(%ebp),%edx
+     6cb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+     6ce:	85 c0                	test   %eax,%eax
+     6d0:	7e 13                	jle    6e5 <memmove+0x25>
+     6d2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     6d4:	89 d7                	mov    %edx,%edi
+     6d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6dd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     6e0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     6e1:	39 f8                	cmp    %edi,%eax
+     6e3:	75 fb                	jne    6e0 <memmove+0x20>
+}
+     6e5:	5e                   	pop    %esi
+     6e6:	89 d0                	mov    %edx,%eax
+     6e8:	5f                   	pop    %edi
+     6e9:	5d                   	pop    %ebp
+     6ea:	c3                   	ret
+     6eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     6ef:	90                   	nop
+
+000006f0 <fork>:
+  if(flushhook)
+     6f0:	a1 20 32 00 00       	mov    0x3220,%eax
+     6f5:	85 c0                	test   %eax,%eax
+     6f7:	74 17                	je     710 <fork+0x20>
+{
+     6f9:	55                   	push   %ebp
+     6fa:	89 e5                	mov    %esp,%ebp
+     6fc:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+     6ff:	ff d0                	call   *%eax
+}
+     701:	c9                   	leave
+  return _fork();
+     702:	e9 21 02 00 00       	jmp    928 <_fork>
+     707:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     70e:	66 90                	xchg   %ax,%ax
+     710:	e9 13 02 00 00       	jmp    928 <_fork>
+     715:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     71c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000720 <exit>:
+{
+     720:	55                   	push   %ebp
+     721:	89 e5                	mov    %esp,%ebp
+     723:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+     726:	a1 20 32 00 00       	mov    0x3220,%eax
+     72b:	85 c0                	test   %eax,%eax
+     72d:	74 02                	je     731 <exit+0x11>
+    flushhook();
+     72f:	ff d0                	call   *%eax
+  _exit();
+     731:	e8 fa 01 00 00       	call   930 <_exit>
+     736:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     73d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000740 <exec>:
+{
+     740:	55                   	push   %ebp
+  if(flushhook)
+     741:	a1 20 32 00 00       	mov    0x3220,%eax
+{
+     746:	89 e5                	mov    %esp,%ebp
+     748:	56                   	push   %esi
+     749:	53                   	push   %ebx
+     74a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     74d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+     750:	85 c0                	test   %eax,%eax
+     752:	74 02                	je     756 <exec+0x16>
+    flushhook();
+     754:	ff d0                	call   *%eax
+  return _exec(path, argv);
+     756:	89 75 0c             	mov    %esi,0xc(%ebp)
+     759:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     75c:	5b                   	pop    %ebx
+     75d:	5e                   	pop    %esi
+     75e:	5d                   	pop    %ebp
+  return _exec(path, argv);
+     75f:	e9 04 02 00 00       	jmp    968 <_exec>
+     764:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     76b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     76f:	90                   	nop
+
+00000770 <read>:
+{
+     770:	55                   	push   %ebp
+     771:	89 e5                	mov    %esp,%ebp
+     773:	57                   	push   %edi
+     774:	56                   	push   %esi
+     775:	53                   	push   %ebx
+     776:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     779:	a1 20 32 00 00       	mov    0x3220,%eax
+{
+     77e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     781:	8b 75 0c             	mov    0xc(%ebp),%esi
+     784:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     787:	85 c0                	test   %eax,%eax
+     789:	74 02                	je     78d <read+0x1d>
+    flushhook();
+     78b:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+     78d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     790:	89 75 0c             	mov    %esi,0xc(%ebp)
+     793:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     796:	83 c4 0c             	add    $0xc,%esp
+     799:	5b                   	pop    %ebx
+     79a:	5e                   	pop    %esi
+     79b:	5f                   	pop    %edi
+     79c:	5d                   	pop    %ebp
+  return _read(fd, buf, n);
+     79d:	e9 a6 01 00 00       	jmp    948 <_read>
+     7a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000007b0 <readv>:
+{
+     7b0:	55                   	push   %ebp
+     7b1:	89 e5                	mov    %esp,%ebp
+     7b3:	57                   	push   %edi
+     7b4:	56                   	push   %esi
+     7b5:	53                   	push   %ebx
+     7b6:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     7b9:	a1 20 32 00 00       	mov    0x3220,%eax
+{
+     7be:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     7c1:	8b 75 0c             	mov    0xc(%ebp),%esi
+     7c4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     7c7:	85 c0                	test   %eax,%eax
+     7c9:	74 02                	je     7cd <readv+0x1d>
+    flushhook();
+     7cb:	ff d0                	call   *%eax
+  return _readv(fd, iov, cnt);
+     7cd:	89 7d 10             	mov    %edi,0x10(%ebp)
+     7d0:	89 75 0c             	mov    %esi,0xc(%ebp)
+     7d3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     7d6:	83 c4 0c             	add    $0xc,%esp
+     7d9:	5b                   	pop    %ebx
+     7da:	5e                   	pop    %esi
+     7db:	5f                   	pop    %edi
+     7dc:	5d                   	pop    %ebp
+  return _readv(fd, iov, cnt);
+     7dd:	e9 76 02 00 00       	jmp    a58 <_readv>
+     7e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000007f0 <write>:
+{
+     7f0:	55                   	push   %ebp
+     7f1:	89 e5                	mov    %esp,%ebp
+     7f3:	57                   	push   %edi
+     7f4:	56                   	push   %esi
+     7f5:	53                   	push   %ebx
+     7f6:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     7f9:	a1 20 32 00 00       	mov    0x3220,%eax
+{
+     7fe:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     801:	8b 75 0c             	mov    0xc(%ebp),%esi
+     804:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     807:	85 c0                	test   %eax,%eax
+     809:	74 02                	je     80d <write+0x1d>
+    flushhook();
+     80b:	ff d0                	call   *%eax
+  return _write(fd, buf, n);
+     80d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     810:	89 75 0c             	mov    %esi,0xc(%ebp)
+     813:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     816:	83 c4 0c             	add    $0xc,%esp
+     819:	5b                   	pop    %ebx
+     81a:	5e                   	pop    %esi
+     81b:	5f                   	pop    %edi
+     81c:	5d                   	pop    %ebp
+  return _write(fd, buf, n);
+     81d:	e9 2e 01 00 00       	jmp    950 <_write>
+     822:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     829:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000830 <writev>:
+{
+     830:	55                   	push   %ebp
+     831:	89 e5                	mov    %esp,%ebp
+     833:	57                   	push   %edi
+     834:	56                   	push   %esi
+     835:	53                   	push   %ebx
+     836:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     839:	a1 20 32 00 00       	mov    0x3220,%eax
+{
+     83e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     841:	8b 75 0c             	mov    0xc(%ebp),%esi
+     844:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     847:	85 c0                	test   %eax,%eax
+     849:	74 02                	je     84d <writev+0x1d>
+    flushhook();
+     84b:	ff d0                	call   *%eax
+  return _writev(fd, iov, cnt);
+     84d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     850:	89 75 0c             	mov    %esi,0xc(%ebp)
+     853:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     856:	83 c4 0c             	add    $0xc,%esp
+     859:	5b                   	pop    %ebx
+     85a:	5e                   	pop    %esi
+     85b:	5f                   	pop    %edi
+     85c:	5d                   	pop    %ebp
+  return _writev(fd, iov, cnt);
+     85d:	e9 fe 01 00 00       	jmp    a60 <_writev>
+     862:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     869:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000870 <close>:
+{
+     870:	55                   	push   %ebp
+     871:	89 e5                	mov    %esp,%ebp
+     873:	53                   	push   %ebx
+     874:	83 ec 04             	sub    $0x4,%esp
+  if(flushhook)
+     877:	a1 20 32 00 00       	mov    0x3220,%eax
+{
+     87c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(flushhook)
+     87f:	85 c0                	test   %eax,%eax
+     881:	74 02                	je     885 <close+0x15>
+    flushhook();
+     883:	ff d0                	call   *%eax
+  return _close(fd);
+     885:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     888:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     88b:	c9                   	leave
+  return _close(fd);
+     88c:	e9 c7 00 00 00       	jmp    958 <_close>
+     891:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     898:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     89f:	90                   	nop
+
+000008a0 <umtxinit>:
+// process that finds the mutex held enters the kernel, to sleep
+// in futexwait() until the holder's umtxunlock() wakes it.
+
+void
+umtxinit(struct umutex *m)
+{
+     8a0:	55                   	push   %ebp
+     8a1:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+     8a3:	8b 45 08             	mov    0x8(%ebp),%eax
+     8a6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     8ac:	5d                   	pop    %ebp
+     8ad:	c3                   	ret
+     8ae:	66 90                	xchg   %ax,%ax
+
+000008b0 <umtxlock>:
+
+void
+umtxlock(struct umutex *m)
+{
+     8b0:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+     8b1:	b8 01 00 00 00       	mov    $0x1,%eax
+     8b6:	89 e5                	mov    %esp,%ebp
+     8b8:	56                   	push   %esi
+     8b9:	53                   	push   %ebx
+     8ba:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     8bd:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 1) == 0)
+     8c0:	85 c0                	test   %eax,%eax
+     8c2:	74 2b                	je     8ef <umtxlock+0x3f>
+     8c4:	b8 02 00 00 00       	mov    $0x2,%eax
+     8c9:	f0 87 03             	lock xchg %eax,(%ebx)
+    return;
+  // Mark the mutex contended, so that its holder
+  // wakes a waiter on release, and wait.
+  while(xchg(&m->state, 2) != 0)
+     8cc:	85 c0                	test   %eax,%eax
+     8ce:	74 1f                	je     8ef <umtxlock+0x3f>
+     8d0:	be 02 00 00 00       	mov    $0x2,%esi
+     8d5:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwait(&m->state, 2);
+     8d8:	83 ec 08             	sub    $0x8,%esp
+     8db:	6a 02                	push   $0x2
+     8dd:	53                   	push   %ebx
+     8de:	e8 85 01 00 00       	call   a68 <futexwait>
+     8e3:	89 f0                	mov    %esi,%eax
+     8e5:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+     8e8:	83 c4 10             	add    $0x10,%esp
+     8eb:	85 c0                	test   %eax,%eax
+     8ed:	75 e9                	jne    8d8 <umtxlock+0x28>
+}
+     8ef:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     8f2:	5b                   	pop    %ebx
+     8f3:	5e                   	pop    %esi
+     8f4:	5d                   	pop    %ebp
+     8f5:	c3                   	ret
+     8f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000900 <umtxunlock>:
+
+void
+umtxunlock(struct umutex *m)
+{
+     900:	55                   	push   %ebp
+     901:	31 c0                	xor    %eax,%eax
+     903:	89 e5                	mov    %esp,%ebp
+     905:	83 ec 08             	sub    $0x8,%esp
+     908:	8b 55 08             	mov    0x8(%ebp),%edx
+     90b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+     90e:	83 f8 02             	cmp    $0x2,%eax
+     911:	74 05                	je     918 <umtxunlock+0x18>
+    futexwake(&m->state, 1);
+}
+     913:	c9                   	leave
+     914:	c3                   	ret
+     915:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwake(&m->state, 1);
+     918:	83 ec 08             	sub    $0x8,%esp
+     91b:	6a 01                	push   $0x1
+     91d:	52                   	push   %edx
+     91e:	e8 4d 01 00 00       	call   a70 <futexwake>
+     923:	83 c4 10             	add    $0x10,%esp
+}
+     926:	c9                   	leave
+     927:	c3                   	ret
+
+00000928 <_fork>:
+  _ ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+     928:	b8 01 00 00 00       	mov    $0x1,%eax
+     92d:	cd 40                	int    $0x40
+     92f:	c3                   	ret
+
+00000930 <_exit>:
+RAWSYSCALL(exit)
+     930:	b8 02 00 00 00       	mov    $0x2,%eax
+     935:	cd 40                	int    $0x40
+     937:	c3                   	ret
+
+00000938 <wait>:
+SYSCALL(wait)
+     938:	b8 03 00 00 00       	mov    $0x3,%eax
+     93d:	cd 40                	int    $0x40
+     93f:	c3                   	ret
+
+00000940 <pipe>:
+SYSCALL(pipe)
+     940:	b8 04 00 00 00       	mov    $0x4,%eax
+     945:	cd 40                	int    $0x40
+     947:	c3                   	ret
+
+00000948 <_read>:
+RAWSYSCALL(read)
+     948:	b8 05 00 00 00       	mov    $0x5,%eax
+     94d:	cd 40                	int    $0x40
+     94f:	c3                   	ret
+
+00000950 <_write>:
+RAWSYSCALL(write)
+     950:	b8 10 00 00 00       	mov    $0x10,%eax
+     955:	cd 40                	int    $0x40
+     957:	c3                   	ret
+
+00000958 <_close>:
+RAWSYSCALL(close)
+     958:	b8 15 00 00 00       	mov    $0x15,%eax
+     95d:	cd 40                	int    $0x40
+     95f:	c3                   	ret
+
+00000960 <kill>:
+SYSCALL(kill)
+     960:	b8 06 00 00 00       	mov    $0x6,%eax
+     965:	cd 40                	int    $0x40
+     967:	c3                   	ret
+
+00000968 <_exec>:
+RAWSYSCALL(exec)
+     968:	b8 07 00 00 00       	mov    $0x7,%eax
+     96d:	cd 40                	int    $0x40
+     96f:	c3                   	ret
+
+00000970 <open>:
+SYSCALL(open)
+     970:	b8 0f 00 00 00       	mov    $0xf,%eax
+     975:	cd 40                	int    $0x40
+     977:	c3                   	ret
+
+00000978 <mknod>:
+SYSCALL(mknod)
+     978:	b8 11 00 00 00       	mov    $0x11,%eax
+     97d:	cd 40                	int    $0x40
+     97f:	c3                   	ret
+
+00000980 <unlink>:
+SYSCALL(unlink)
+     980:	b8 12 00 00 00       	mov    $0x12,%eax
+     985:	cd 40                	int    $0x40
+     987:	c3                   	ret
+
+00000988 <fstat>:
+SYSCALL(fstat)
+     988:	b8 08 00 00 00       	mov    $0x8,%eax
+     98d:	cd 40                	int    $0x40
+     98f:	c3                   	ret
+
+00000990 <link>:
+SYSCALL(link)
+     990:	b8 13 00 00 00       	mov    $0x13,%eax
+     995:	cd 40                	int    $0x40
+     997:	c3                   	ret
+
+00000998 <mkdir>:
+SYSCALL(mkdir)
+     998:	b8 14 00 00 00       	mov    $0x14,%eax
+     99d:	cd 40                	int    $0x40
+     99f:	c3                   	ret
+
+000009a0 <chdir>:
+SYSCALL(chdir)
+     9a0:	b8 09 00 00 00       	mov    $0x9,%eax
+     9a5:	cd 40                	int    $0x40
+     9a7:	c3                   	ret
+
+000009a8 <dup>:
+SYSCALL(dup)
+     9a8:	b8 0a 00 00 00       	mov    $0xa,%eax
+     9ad:	cd 40                	int    $0x40
+     9af:	c3                   	ret
+
+000009b0 <getpid>:
+SYSCALL(getpid)
+     9b0:	b8 0b 00 00 00       	mov    $0xb,%eax
+     9b5:	cd 40                	int    $0x40
+     9b7:	c3                   	ret
+
+000009b8 <sbrk>:
+SYSCALL(sbrk)
+     9b8:	b8 0c 00 00 00       	mov    $0xc,%eax
+     9bd:	cd 40                	int    $0x40
+     9bf:	c3                   	ret
+
+000009c0 <sleep>:
+SYSCALL(sleep)
+     9c0:	b8 0d 00 00 00       	mov    $0xd,%eax
+     9c5:	cd 40                	int    $0x40
+     9c7:	c3                   	ret
+
+000009c8 <uptime>:
+SYSCALL(uptime)
+     9c8:	b8 0e 00 00 00       	mov    $0xe,%eax
+     9cd:	cd 40                	int    $0x40
+     9cf:	c3                   	ret
+
+000009d0 <wolfie>:
+SYSCALL(wolfie)
+     9d0:	b8 16 00 00 00       	mov    $0x16,%eax
+     9d5:	cd 40                	int    $0x40
+     9d7:	c3                   	ret
+
+000009d8 <nice>:
+SYSCALL(nice)
+     9d8:	b8 17 00 00 00       	mov    $0x17,%eax
+     9dd:	cd 40                	int    $0x40
+     9df:	c3                   	ret
+
+000009e0 <mtxget>:
+SYSCALL(mtxget)
+     9e0:	b8 18 00 00 00       	mov    $0x18,%eax
+     9e5:	cd 40                	int    $0x40
+     9e7:	c3                   	ret
+
+000009e8 <mtxrel>:
+SYSCALL(mtxrel)
+     9e8:	b8 19 00 00 00       	mov    $0x19,%eax
+     9ed:	cd 40                	int    $0x40
+     9ef:	c3                   	ret
+
+000009f0 <mtxacq>:
+SYSCALL(mtxacq)
+     9f0:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     9f5:	cd 40                	int    $0x40
+     9f7:	c3                   	ret
+
+000009f8 <mtxdel>:
+SYSCALL(mtxdel)
+     9f8:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     9fd:	cd 40                	int    $0x40
+     9ff:	c3                   	ret
+
+00000a00 <iostat>:
+SYSCALL(iostat)
+     a00:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     a05:	cd 40                	int    $0x40
+     a07:	c3                   	ret
+
+00000a08 <mmap>:
+SYSCALL(mmap)
+     a08:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     a0d:	cd 40                	int    $0x40
+     a0f:	c3                   	ret
+
+00000a10 <munmap>:
+SYSCALL(munmap)
+     a10:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     a15:	cd 40                	int    $0x40
+     a17:	c3                   	ret
+
+00000a18 <shmget>:
+SYSCALL(shmget)
+     a18:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     a1d:	cd 40                	int    $0x40
+     a1f:	c3                   	ret
+
+00000a20 <shmat>:
+SYSCALL(shmat)
+     a20:	b8 20 00 00 00       	mov    $0x20,%eax
+     a25:	cd 40                	int    $0x40
+     a27:	c3                   	ret
+
+00000a28 <shmdt>:
+SYSCALL(shmdt)
+     a28:	b8 21 00 00 00       	mov    $0x21,%eax
+     a2d:	cd 40                	int    $0x40
+     a2f:	c3                   	ret
+
+00000a30 <shmdel>:
+SYSCALL(shmdel)
+     a30:	b8 22 00 00 00       	mov    $0x22,%eax
+     a35:	cd 40                	int    $0x40
+     a37:	c3                   	ret
+
+00000a38 <syscount>:
+SYSCALL(syscount)
+     a38:	b8 23 00 00 00       	mov    $0x23,%eax
+     a3d:	cd 40                	int    $0x40
+     a3f:	c3                   	ret
+
+00000a40 <splice>:
+SYSCALL(splice)
+     a40:	b8 24 00 00 00       	mov    $0x24,%eax
+     a45:	cd 40                	int    $0x40
+     a47:	c3                   	ret
+
+00000a48 <tee>:
+SYSCALL(tee)
+     a48:	b8 25 00 00 00       	mov    $0x25,%eax
+     a4d:	cd 40                	int    $0x40
+     a4f:	c3                   	ret
+
+00000a50 <sendfile>:
+SYSCALL(sendfile)
+     a50:	b8 26 00 00 00       	mov    $0x26,%eax
+     a55:	cd 40                	int    $0x40
+     a57:	c3                   	ret
+
+00000a58 <_readv>:
+RAWSYSCALL(readv)
+     a58:	b8 27 00 00 00       	mov    $0x27,%eax
+     a5d:	cd 40                	int    $0x40
+     a5f:	c3                   	ret
+
+00000a60 <_writev>:
+RAWSYSCALL(writev)
+     a60:	b8 28 00 00 00       	mov    $0x28,%eax
+     a65:	cd 40                	int    $0x40
+     a67:	c3                   	ret
+
+00000a68 <futexwait>:
+SYSCALL(futexwait)
+     a68:	b8 29 00 00 00       	mov    $0x29,%eax
+     a6d:	cd 40                	int    $0x40
+     a6f:	c3                   	ret
+
+00000a70 <futexwake>:
+SYSCALL(futexwake)
+     a70:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     a75:	cd 40                	int    $0x40
+     a77:	c3                   	ret
+
+00000a78 <lockstat>:
+SYSCALL(lockstat)
+     a78:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     a7d:	cd 40                	int    $0x40
+     a7f:	c3                   	ret
+
+00000a80 <clone>:
+SYSCALL(clone)
+     a80:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     a85:	cd 40                	int    $0x40
+     a87:	c3                   	ret
+
+00000a88 <join>:
+SYSCALL(join)
+     a88:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     a8d:	cd 40                	int    $0x40
+     a8f:	c3                   	ret
+
+00000a90 <stacklimit>:
+SYSCALL(stacklimit)
+     a90:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     a95:	cd 40                	int    $0x40
+     a97:	c3                   	ret
+     a98:	66 90                	xchg   %ax,%ax
+     a9a:	66 90                	xchg   %ax,%ax
+     a9c:	66 90                	xchg   %ax,%ax
+     a9e:	66 90                	xchg   %ax,%ax
+
+00000aa0 <flushall>:
+  b->n = 0;
+}
+
+static void
+flushall(void)
+{
+     aa0:	55                   	push   %ebp
+     aa1:	89 e5                	mov    %esp,%ebp
+     aa3:	83 ec 14             	sub    $0x14,%esp
+  umtxlock(&stdoutlock);
+     aa6:	68 24 32 00 00       	push   $0x3224
+     aab:	e8 00 fe ff ff       	call   8b0 <umtxlock>
+  if(b->n > 0)
+     ab0:	a1 08 20 00 00       	mov    0x2008,%eax
+     ab5:	83 c4 10             	add    $0x10,%esp
+     ab8:	85 c0                	test   %eax,%eax
+     aba:	7e 17                	jle    ad3 <flushall+0x33>
+    _write(b->fd, b->buf, b->n);
+     abc:	83 ec 04             	sub    $0x4,%esp
+     abf:	50                   	push   %eax
+     ac0:	68 0c 20 00 00       	push   $0x200c
+     ac5:	ff 35 00 20 00 00    	push   0x2000
+     acb:	e8 80 fe ff ff       	call   950 <_write>
+     ad0:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     ad3:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     ada:	00 00 00 
+  flush(&stdout);
+  umtxunlock(&stdoutlock);
+     add:	83 ec 0c             	sub    $0xc,%esp
+     ae0:	68 24 32 00 00       	push   $0x3224
+     ae5:	e8 16 fe ff ff       	call   900 <umtxunlock>
+}
+     aea:	83 c4 10             	add    $0x10,%esp
+     aed:	c9                   	leave
+     aee:	c3                   	ret
+     aef:	90                   	nop
+
+00000af0 <printint>:
+    flush(b);
+}
+
+static void
+printint(struct outbuf *b, int xx, int base, int sgn)
+{
+     af0:	55                   	push   %ebp
+     af1:	89 e5                	mov    %esp,%ebp
+     af3:	57                   	push   %edi
+     af4:	89 cf                	mov    %ecx,%edi
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     af6:	89 d1                	mov    %edx,%ecx
+{
+     af8:	56                   	push   %esi
+     af9:	53                   	push   %ebx
+     afa:	89 c3                	mov    %eax,%ebx
+     afc:	83 ec 2c             	sub    $0x2c,%esp
+  if(sgn && xx < 0){
+     aff:	85 d2                	test   %edx,%edx
+     b01:	0f 89 b9 00 00 00    	jns    bc0 <printint+0xd0>
+     b07:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     b0b:	0f 84 af 00 00 00    	je     bc0 <printint+0xd0>
+    x = -xx;
+     b11:	f7 d9                	neg    %ecx
+    neg = 1;
+     b13:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     b18:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     b1b:	31 f6                	xor    %esi,%esi
+     b1d:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     b20:	89 c8                	mov    %ecx,%eax
+     b22:	31 d2                	xor    %edx,%edx
+     b24:	89 f3                	mov    %esi,%ebx
+     b26:	f7 f7                	div    %edi
+     b28:	8d 76 01             	lea    0x1(%esi),%esi
+     b2b:	0f b6 92 f8 17 00 00 	movzbl 0x17f8(%edx),%edx
+     b32:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     b36:	89 ca                	mov    %ecx,%edx
+     b38:	89 c1                	mov    %eax,%ecx
+     b3a:	39 fa                	cmp    %edi,%edx
+     b3c:	73 e2                	jae    b20 <printint+0x30>
+  if(neg)
+     b3e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     b41:	89 d9                	mov    %ebx,%ecx
+     b43:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     b46:	85 c0                	test   %eax,%eax
+     b48:	74 07                	je     b51 <printint+0x61>
+    buf[i++] = '-';
+     b4a:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     b4f:	89 f1                	mov    %esi,%ecx
+     b51:	8d 75 d8             	lea    -0x28(%ebp),%esi
+     b54:	89 cf                	mov    %ecx,%edi
+     b56:	01 f7                	add    %esi,%edi
+     b58:	eb 1a                	jmp    b74 <printint+0x84>
+     b5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    *b->str++ = c;
+     b60:	8d 48 01             	lea    0x1(%eax),%ecx
+     b63:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+     b69:	88 10                	mov    %dl,(%eax)
+
+  while(--i >= 0)
+     b6b:	8d 47 ff             	lea    -0x1(%edi),%eax
+     b6e:	39 fe                	cmp    %edi,%esi
+     b70:	74 40                	je     bb2 <printint+0xc2>
+     b72:	89 c7                	mov    %eax,%edi
+  if(b->str){
+     b74:	8b 83 0c 02 00 00    	mov    0x20c(%ebx),%eax
+    putc(b, buf[i]);
+     b7a:	0f b6 17             	movzbl (%edi),%edx
+  if(b->str){
+     b7d:	85 c0                	test   %eax,%eax
+     b7f:	75 df                	jne    b60 <printint+0x70>
+  b->buf[b->n++] = c;
+     b81:	8b 4b 08             	mov    0x8(%ebx),%ecx
+     b84:	8d 41 01             	lea    0x1(%ecx),%eax
+     b87:	89 43 08             	mov    %eax,0x8(%ebx)
+     b8a:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+     b8e:	3d 00 02 00 00       	cmp    $0x200,%eax
+     b93:	74 3b                	je     bd0 <printint+0xe0>
+     b95:	80 fa 0a             	cmp    $0xa,%dl
+     b98:	75 d1                	jne    b6b <printint+0x7b>
+     b9a:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+     b9e:	75 cb                	jne    b6b <printint+0x7b>
+  if(b->n > 0)
+     ba0:	85 c0                	test   %eax,%eax
+     ba2:	7f 2c                	jg     bd0 <printint+0xe0>
+  b->n = 0;
+     ba4:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  while(--i >= 0)
+     bab:	8d 47 ff             	lea    -0x1(%edi),%eax
+     bae:	39 fe                	cmp    %edi,%esi
+     bb0:	75 c0                	jne    b72 <printint+0x82>
+}
+     bb2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     bb5:	5b                   	pop    %ebx
+     bb6:	5e                   	pop    %esi
+     bb7:	5f                   	pop    %edi
+     bb8:	5d                   	pop    %ebp
+     bb9:	c3                   	ret
+     bba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  neg = 0;
+     bc0:	31 c0                	xor    %eax,%eax
+     bc2:	e9 51 ff ff ff       	jmp    b18 <printint+0x28>
+     bc7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bce:	66 90                	xchg   %ax,%ax
+    _write(b->fd, b->buf, b->n);
+     bd0:	83 ec 04             	sub    $0x4,%esp
+     bd3:	50                   	push   %eax
+     bd4:	8d 43 0c             	lea    0xc(%ebx),%eax
+     bd7:	50                   	push   %eax
+     bd8:	ff 33                	push   (%ebx)
+     bda:	e8 71 fd ff ff       	call   950 <_write>
+     bdf:	83 c4 10             	add    $0x10,%esp
+     be2:	eb c0                	jmp    ba4 <printint+0xb4>
+     be4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     beb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     bef:	90                   	nop
+
+00000bf0 <putc>:
+{
+     bf0:	55                   	push   %ebp
+     bf1:	89 e5                	mov    %esp,%ebp
+     bf3:	53                   	push   %ebx
+     bf4:	89 c3                	mov    %eax,%ebx
+     bf6:	83 ec 04             	sub    $0x4,%esp
+  if(b->str){
+     bf9:	8b 80 0c 02 00 00    	mov    0x20c(%eax),%eax
+     bff:	85 c0                	test   %eax,%eax
+     c01:	74 15                	je     c18 <putc+0x28>
+    *b->str++ = c;
+     c03:	8d 48 01             	lea    0x1(%eax),%ecx
+     c06:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+     c0c:	88 10                	mov    %dl,(%eax)
+}
+     c0e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     c11:	c9                   	leave
+     c12:	c3                   	ret
+     c13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c17:	90                   	nop
+  b->buf[b->n++] = c;
+     c18:	8b 4b 08             	mov    0x8(%ebx),%ecx
+     c1b:	8d 41 01             	lea    0x1(%ecx),%eax
+     c1e:	89 43 08             	mov    %eax,0x8(%ebx)
+     c21:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+     c25:	3d 00 02 00 00       	cmp    $0x200,%eax
+     c2a:	74 14                	je     c40 <putc+0x50>
+     c2c:	80 fa 0a             	cmp    $0xa,%dl
+     c2f:	75 dd                	jne    c0e <putc+0x1e>
+     c31:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+     c35:	75 d7                	jne    c0e <putc+0x1e>
+  if(b->n > 0)
+     c37:	85 c0                	test   %eax,%eax
+     c39:	7e 17                	jle    c52 <putc+0x62>
+     c3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c3f:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     c40:	83 ec 04             	sub    $0x4,%esp
+     c43:	50                   	push   %eax
+     c44:	8d 43 0c             	lea    0xc(%ebx),%eax
+     c47:	50                   	push   %eax
+     c48:	ff 33                	push   (%ebx)
+     c4a:	e8 01 fd ff ff       	call   950 <_write>
+     c4f:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     c52:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+     c59:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     c5c:	c9                   	leave
+     c5d:	c3                   	ret
+     c5e:	66 90                	xchg   %ax,%ax
+
+00000c60 <format>:
+
+// Format fmt and the arguments at ap into b.
+// Only understands %d, %x, %p, %s, %c.
+static void
+format(struct outbuf *b, const char *fmt, uint *ap)
+{
+     c60:	55                   	push   %ebp
+     c61:	89 e5                	mov    %esp,%ebp
+     c63:	57                   	push   %edi
+     c64:	89 c7                	mov    %eax,%edi
+     c66:	56                   	push   %esi
+     c67:	53                   	push   %ebx
+     c68:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+     c6b:	0f b6 02             	movzbl (%edx),%eax
+{
+     c6e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  for(i = 0; fmt[i]; i++){
+     c71:	84 c0                	test   %al,%al
+     c73:	74 5a                	je     ccf <format+0x6f>
+     c75:	8d 5a 01             	lea    0x1(%edx),%ebx
+     c78:	31 f6                	xor    %esi,%esi
+     c7a:	eb 1c                	jmp    c98 <format+0x38>
+     c7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     c80:	83 f8 25             	cmp    $0x25,%eax
+     c83:	74 3b                	je     cc0 <format+0x60>
+        state = '%';
+      } else {
+        putc(b, c);
+     c85:	89 ca                	mov    %ecx,%edx
+     c87:	89 f8                	mov    %edi,%eax
+     c89:	e8 62 ff ff ff       	call   bf0 <putc>
+  for(i = 0; fmt[i]; i++){
+     c8e:	0f b6 03             	movzbl (%ebx),%eax
+     c91:	83 c3 01             	add    $0x1,%ebx
+     c94:	84 c0                	test   %al,%al
+     c96:	74 37                	je     ccf <format+0x6f>
+    c = fmt[i] & 0xff;
+     c98:	0f be c8             	movsbl %al,%ecx
+     c9b:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     c9e:	85 f6                	test   %esi,%esi
+     ca0:	74 de                	je     c80 <format+0x20>
+      }
+    } else if(state == '%'){
+     ca2:	83 fe 25             	cmp    $0x25,%esi
+     ca5:	75 e7                	jne    c8e <format+0x2e>
+      if(c == 'd'){
+     ca7:	83 f8 25             	cmp    $0x25,%eax
+     caa:	74 46                	je     cf2 <format+0x92>
+     cac:	83 e8 63             	sub    $0x63,%eax
+     caf:	83 f8 15             	cmp    $0x15,%eax
+     cb2:	77 2c                	ja     ce0 <format+0x80>
+     cb4:	ff 24 85 a0 17 00 00 	jmp    *0x17a0(,%eax,4)
+     cbb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     cbf:	90                   	nop
+  for(i = 0; fmt[i]; i++){
+     cc0:	0f b6 03             	movzbl (%ebx),%eax
+     cc3:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+     cc6:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+     ccb:	84 c0                	test   %al,%al
+     ccd:	75 c9                	jne    c98 <format+0x38>
+        putc(b, c);
+      }
+      state = 0;
+    }
+  }
+}
+     ccf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     cd2:	5b                   	pop    %ebx
+     cd3:	5e                   	pop    %esi
+     cd4:	5f                   	pop    %edi
+     cd5:	5d                   	pop    %ebp
+     cd6:	c3                   	ret
+     cd7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cde:	66 90                	xchg   %ax,%ax
+        putc(b, '%');
+     ce0:	ba 25 00 00 00       	mov    $0x25,%edx
+     ce5:	89 f8                	mov    %edi,%eax
+     ce7:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     cea:	e8 01 ff ff ff       	call   bf0 <putc>
+        putc(b, c);
+     cef:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     cf2:	89 ca                	mov    %ecx,%edx
+     cf4:	89 f8                	mov    %edi,%eax
+      state = 0;
+     cf6:	31 f6                	xor    %esi,%esi
+        putc(b, c);
+     cf8:	e8 f3 fe ff ff       	call   bf0 <putc>
+     cfd:	eb 8f                	jmp    c8e <format+0x2e>
+     cff:	90                   	nop
+        printint(b, *ap, 16, 0);
+     d00:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     d03:	83 ec 0c             	sub    $0xc,%esp
+     d06:	b9 10 00 00 00       	mov    $0x10,%ecx
+     d0b:	8b 16                	mov    (%esi),%edx
+     d0d:	6a 00                	push   $0x0
+        ap++;
+     d0f:	83 c6 04             	add    $0x4,%esi
+        printint(b, *ap, 16, 0);
+     d12:	89 f8                	mov    %edi,%eax
+     d14:	e8 d7 fd ff ff       	call   af0 <printint>
+        ap++;
+     d19:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+     d1c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     d1f:	31 f6                	xor    %esi,%esi
+     d21:	e9 68 ff ff ff       	jmp    c8e <format+0x2e>
+     d26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d2d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     d30:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     d33:	8b 30                	mov    (%eax),%esi
+        ap++;
+     d35:	83 c0 04             	add    $0x4,%eax
+     d38:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+     d3b:	85 f6                	test   %esi,%esi
+     d3d:	75 1b                	jne    d5a <format+0xfa>
+     d3f:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+     d44:	be 98 17 00 00       	mov    $0x1798,%esi
+     d49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+          putc(b, *s);
+     d50:	89 f8                	mov    %edi,%eax
+          s++;
+     d52:	83 c6 01             	add    $0x1,%esi
+          putc(b, *s);
+     d55:	e8 96 fe ff ff       	call   bf0 <putc>
+        while(*s != 0){
+     d5a:	0f be 16             	movsbl (%esi),%edx
+     d5d:	84 d2                	test   %dl,%dl
+     d5f:	75 ef                	jne    d50 <format+0xf0>
+      state = 0;
+     d61:	31 f6                	xor    %esi,%esi
+     d63:	e9 26 ff ff ff       	jmp    c8e <format+0x2e>
+     d68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d6f:	90                   	nop
+        printint(b, *ap, 10, 1);
+     d70:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     d73:	83 ec 0c             	sub    $0xc,%esp
+     d76:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     d7b:	8b 16                	mov    (%esi),%edx
+     d7d:	6a 01                	push   $0x1
+     d7f:	eb 8e                	jmp    d0f <format+0xaf>
+     d81:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(b, *ap);
+     d88:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     d8b:	89 f8                	mov    %edi,%eax
+     d8d:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+     d90:	83 c6 04             	add    $0x4,%esi
+        putc(b, *ap);
+     d93:	e8 58 fe ff ff       	call   bf0 <putc>
+        ap++;
+     d98:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      state = 0;
+     d9b:	31 f6                	xor    %esi,%esi
+     d9d:	e9 ec fe ff ff       	jmp    c8e <format+0x2e>
+     da2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     da9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000db0 <fflush>:
+{
+     db0:	55                   	push   %ebp
+     db1:	89 e5                	mov    %esp,%ebp
+     db3:	83 ec 08             	sub    $0x8,%esp
+  if(fd == stdout.fd)
+     db6:	8b 45 08             	mov    0x8(%ebp),%eax
+     db9:	39 05 00 20 00 00    	cmp    %eax,0x2000
+     dbf:	74 07                	je     dc8 <fflush+0x18>
+}
+     dc1:	c9                   	leave
+     dc2:	c3                   	ret
+     dc3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     dc7:	90                   	nop
+  umtxlock(&stdoutlock);
+     dc8:	83 ec 0c             	sub    $0xc,%esp
+     dcb:	68 24 32 00 00       	push   $0x3224
+     dd0:	e8 db fa ff ff       	call   8b0 <umtxlock>
+  if(b->n > 0)
+     dd5:	a1 08 20 00 00       	mov    0x2008,%eax
+     dda:	83 c4 10             	add    $0x10,%esp
+     ddd:	85 c0                	test   %eax,%eax
+     ddf:	7f 1f                	jg     e00 <fflush+0x50>
+  b->n = 0;
+     de1:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     de8:	00 00 00 
+  umtxunlock(&stdoutlock);
+     deb:	c7 45 08 24 32 00 00 	movl   $0x3224,0x8(%ebp)
+}
+     df2:	c9                   	leave
+  umtxunlock(&stdoutlock);
+     df3:	e9 08 fb ff ff       	jmp    900 <umtxunlock>
+     df8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dff:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     e00:	83 ec 04             	sub    $0x4,%esp
+     e03:	50                   	push   %eax
+     e04:	68 0c 20 00 00       	push   $0x200c
+     e09:	ff 35 00 20 00 00    	push   0x2000
+     e0f:	e8 3c fb ff ff       	call   950 <_write>
+     e14:	83 c4 10             	add    $0x10,%esp
+     e17:	eb c8                	jmp    de1 <fflush+0x31>
+     e19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000e20 <setvbuf>:
+{
+     e20:	55                   	push   %ebp
+     e21:	89 e5                	mov    %esp,%ebp
+     e23:	53                   	push   %ebx
+     e24:	83 ec 04             	sub    $0x4,%esp
+     e27:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd != stdout.fd)
+     e2a:	8b 45 08             	mov    0x8(%ebp),%eax
+     e2d:	39 05 00 20 00 00    	cmp    %eax,0x2000
+     e33:	74 0b                	je     e40 <setvbuf+0x20>
+}
+     e35:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     e38:	c9                   	leave
+     e39:	c3                   	ret
+     e3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  umtxlock(&stdoutlock);
+     e40:	83 ec 0c             	sub    $0xc,%esp
+     e43:	68 24 32 00 00       	push   $0x3224
+     e48:	e8 63 fa ff ff       	call   8b0 <umtxlock>
+  if(b->n > 0)
+     e4d:	a1 08 20 00 00       	mov    0x2008,%eax
+     e52:	83 c4 10             	add    $0x10,%esp
+     e55:	85 c0                	test   %eax,%eax
+     e57:	7f 2f                	jg     e88 <setvbuf+0x68>
+  b->n = 0;
+     e59:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     e60:	00 00 00 
+  stdout.mode = mode;
+     e63:	89 1d 04 20 00 00    	mov    %ebx,0x2004
+  flushhook = flushall;
+     e69:	c7 05 20 32 00 00 a0 	movl   $0xaa0,0x3220
+     e70:	0a 00 00 
+}
+     e73:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&stdoutlock);
+     e76:	c7 45 08 24 32 00 00 	movl   $0x3224,0x8(%ebp)
+}
+     e7d:	c9                   	leave
+  umtxunlock(&stdoutlock);
+     e7e:	e9 7d fa ff ff       	jmp    900 <umtxunlock>
+     e83:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e87:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     e88:	83 ec 04             	sub    $0x4,%esp
+     e8b:	50                   	push   %eax
+     e8c:	68 0c 20 00 00       	push   $0x200c
+     e91:	ff 35 00 20 00 00    	push   0x2000
+     e97:	e8 b4 fa ff ff       	call   950 <_write>
+     e9c:	83 c4 10             	add    $0x10,%esp
+     e9f:	eb b8                	jmp    e59 <setvbuf+0x39>
+     ea1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ea8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     eaf:	90                   	nop
+
+00000eb0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s, %c.
+void
+printf(int fd, const char *fmt, ...)
+{
+     eb0:	55                   	push   %ebp
+     eb1:	89 e5                	mov    %esp,%ebp
+     eb3:	53                   	push   %ebx
+     eb4:	81 ec 14 02 00 00    	sub    $0x214,%esp
+     eba:	8b 45 08             	mov    0x8(%ebp),%eax
+    local.mode = _IONBF;
+    local.n = 0;
+    local.str = 0;
+    b = &local;
+  }
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     ebd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd == stdout.fd){
+     ec0:	39 05 00 20 00 00    	cmp    %eax,0x2000
+     ec6:	74 48                	je     f10 <printf+0x60>
+    local.fd = fd;
+     ec8:	89 85 e8 fd ff ff    	mov    %eax,-0x218(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     ece:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     ed1:	89 da                	mov    %ebx,%edx
+     ed3:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+    local.mode = _IONBF;
+     ed9:	c7 85 ec fd ff ff 03 	movl   $0x3,-0x214(%ebp)
+     ee0:	00 00 00 
+    local.n = 0;
+     ee3:	c7 85 f0 fd ff ff 00 	movl   $0x0,-0x210(%ebp)
+     eea:	00 00 00 
+    local.str = 0;
+     eed:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     ef4:	e8 67 fd ff ff       	call   c60 <format>
+  if(b->mode == _IONBF)
+     ef9:	83 bd ec fd ff ff 03 	cmpl   $0x3,-0x214(%ebp)
+     f00:	0f 84 a2 00 00 00    	je     fa8 <printf+0xf8>
+    flush(b);
+  if(b == &stdout)
+    umtxunlock(&stdoutlock);
+}
+     f06:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     f09:	c9                   	leave
+     f0a:	c3                   	ret
+     f0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     f0f:	90                   	nop
+    umtxlock(&stdoutlock);
+     f10:	83 ec 0c             	sub    $0xc,%esp
+     f13:	68 24 32 00 00       	push   $0x3224
+     f18:	e8 93 f9 ff ff       	call   8b0 <umtxlock>
+  if(stdout.mode == 0){
+     f1d:	a1 04 20 00 00       	mov    0x2004,%eax
+     f22:	83 c4 10             	add    $0x10,%esp
+     f25:	85 c0                	test   %eax,%eax
+     f27:	74 37                	je     f60 <printf+0xb0>
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     f29:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     f2c:	89 da                	mov    %ebx,%edx
+     f2e:	b8 00 20 00 00       	mov    $0x2000,%eax
+     f33:	e8 28 fd ff ff       	call   c60 <format>
+  if(b->mode == _IONBF)
+     f38:	83 3d 04 20 00 00 03 	cmpl   $0x3,0x2004
+     f3f:	0f 84 ab 00 00 00    	je     ff0 <printf+0x140>
+    umtxunlock(&stdoutlock);
+     f45:	83 ec 0c             	sub    $0xc,%esp
+     f48:	68 24 32 00 00       	push   $0x3224
+     f4d:	e8 ae f9 ff ff       	call   900 <umtxunlock>
+}
+     f52:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    umtxunlock(&stdoutlock);
+     f55:	83 c4 10             	add    $0x10,%esp
+}
+     f58:	c9                   	leave
+     f59:	c3                   	ret
+     f5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+     f60:	83 ec 08             	sub    $0x8,%esp
+     f63:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+     f69:	50                   	push   %eax
+     f6a:	ff 35 00 20 00 00    	push   0x2000
+     f70:	e8 13 fa ff ff       	call   988 <fstat>
+     f75:	83 c4 10             	add    $0x10,%esp
+     f78:	89 c2                	mov    %eax,%edx
+      stdout.mode = _IOFBF;
+     f7a:	b8 01 00 00 00       	mov    $0x1,%eax
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+     f7f:	85 d2                	test   %edx,%edx
+     f81:	75 10                	jne    f93 <printf+0xe3>
+      stdout.mode = _IOLBF;
+     f83:	31 c0                	xor    %eax,%eax
+     f85:	66 83 bd e8 fd ff ff 	cmpw   $0x3,-0x218(%ebp)
+     f8c:	03 
+     f8d:	0f 94 c0             	sete   %al
+     f90:	83 c0 01             	add    $0x1,%eax
+     f93:	a3 04 20 00 00       	mov    %eax,0x2004
+    flushhook = flushall;
+     f98:	c7 05 20 32 00 00 a0 	movl   $0xaa0,0x3220
+     f9f:	0a 00 00 
+     fa2:	eb 85                	jmp    f29 <printf+0x79>
+     fa4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(b->n > 0)
+     fa8:	8b 85 f0 fd ff ff    	mov    -0x210(%ebp),%eax
+     fae:	85 c0                	test   %eax,%eax
+     fb0:	0f 8e 50 ff ff ff    	jle    f06 <printf+0x56>
+    b = &local;
+     fb6:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+    _write(b->fd, b->buf, b->n);
+     fbc:	83 ec 04             	sub    $0x4,%esp
+     fbf:	50                   	push   %eax
+     fc0:	8d 43 0c             	lea    0xc(%ebx),%eax
+     fc3:	50                   	push   %eax
+     fc4:	ff 33                	push   (%ebx)
+     fc6:	e8 85 f9 ff ff       	call   950 <_write>
+  b->n = 0;
+     fcb:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  if(b == &stdout)
+     fd2:	83 c4 10             	add    $0x10,%esp
+     fd5:	81 fb 00 20 00 00    	cmp    $0x2000,%ebx
+     fdb:	0f 85 25 ff ff ff    	jne    f06 <printf+0x56>
+     fe1:	e9 5f ff ff ff       	jmp    f45 <printf+0x95>
+     fe6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fed:	8d 76 00             	lea    0x0(%esi),%esi
+  if(b->n > 0)
+     ff0:	a1 08 20 00 00       	mov    0x2008,%eax
+    b = getstdout();
+     ff5:	bb 00 20 00 00       	mov    $0x2000,%ebx
+  if(b->n > 0)
+     ffa:	85 c0                	test   %eax,%eax
+     ffc:	7f be                	jg     fbc <printf+0x10c>
+  b->n = 0;
+     ffe:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+    1005:	00 00 00 
+  if(b == &stdout)
+    1008:	e9 38 ff ff ff       	jmp    f45 <printf+0x95>
+    100d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001010 <sprintf>:
+
+// Print to the given buffer. Only understands %d, %x, %p, %s, %c.
+int
+sprintf(char *str, const char *fmt, ...)
+{
+    1010:	55                   	push   %ebp
+    1011:	89 e5                	mov    %esp,%ebp
+    1013:	53                   	push   %ebx
+  struct outbuf b;
+
+  b.str = str;
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+    1014:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+    101a:	8d 4d 10             	lea    0x10(%ebp),%ecx
+{
+    101d:	81 ec 14 02 00 00    	sub    $0x214,%esp
+    1023:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+    1026:	8b 55 0c             	mov    0xc(%ebp),%edx
+  b.str = str;
+    1029:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+    102c:	e8 2f fc ff ff       	call   c60 <format>
+  *b.str = '\0';
+    1031:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1034:	c6 00 00             	movb   $0x0,(%eax)
+  return b.str - str;
+    1037:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    103a:	29 d8                	sub    %ebx,%eax
+}
+    103c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    103f:	c9                   	leave
+    1040:	c3                   	ret
+    1041:	66 90                	xchg   %ax,%ax
+    1043:	66 90                	xchg   %ax,%ax
+    1045:	66 90                	xchg   %ax,%ax
+    1047:	66 90                	xchg   %ax,%ax
+    1049:	66 90                	xchg   %ax,%ax
+    104b:	66 90                	xchg   %ax,%ax
+    104d:	66 90                	xchg   %ax,%ax
+    104f:	90                   	nop
+
+00001050 <freeblock>:
+static Header *freep;
+static struct umutex lock;  // threads made by clone() share the heap
+
+static void
+freeblock(void *ap)
+{
+    1050:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+    1051:	8d 48 f8             	lea    -0x8(%eax),%ecx
+{
+    1054:	89 e5                	mov    %esp,%ebp
+    1056:	57                   	push   %edi
+    1057:	56                   	push   %esi
+    1058:	53                   	push   %ebx
+    1059:	89 c3                	mov    %eax,%ebx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    105b:	a1 2c 32 00 00       	mov    0x322c,%eax
+    1060:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1062:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1064:	39 ca                	cmp    %ecx,%edx
+    1066:	73 30                	jae    1098 <freeblock+0x48>
+    1068:	39 c1                	cmp    %eax,%ecx
+    106a:	72 04                	jb     1070 <freeblock+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    106c:	39 c2                	cmp    %eax,%edx
+    106e:	72 f0                	jb     1060 <freeblock+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1070:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    1073:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    1076:	39 f8                	cmp    %edi,%eax
+    1078:	74 26                	je     10a0 <freeblock+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    107a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    107d:	8b 42 04             	mov    0x4(%edx),%eax
+    1080:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    1083:	39 f1                	cmp    %esi,%ecx
+    1085:	74 30                	je     10b7 <freeblock+0x67>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    1087:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    1089:	5b                   	pop    %ebx
+  freep = p;
+    108a:	89 15 2c 32 00 00    	mov    %edx,0x322c
+}
+    1090:	5e                   	pop    %esi
+    1091:	5f                   	pop    %edi
+    1092:	5d                   	pop    %ebp
+    1093:	c3                   	ret
+    1094:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1098:	39 c1                	cmp    %eax,%ecx
+    109a:	72 d0                	jb     106c <freeblock+0x1c>
+    109c:	eb c2                	jmp    1060 <freeblock+0x10>
+    109e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+    10a0:	03 70 04             	add    0x4(%eax),%esi
+    10a3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    10a6:	8b 02                	mov    (%edx),%eax
+    10a8:	8b 00                	mov    (%eax),%eax
+    10aa:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    10ad:	8b 42 04             	mov    0x4(%edx),%eax
+    10b0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    10b3:	39 f1                	cmp    %esi,%ecx
+    10b5:	75 d0                	jne    1087 <freeblock+0x37>
+    p->s.size += bp->s.size;
+    10b7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    10ba:	89 15 2c 32 00 00    	mov    %edx,0x322c
+    p->s.size += bp->s.size;
+    10c0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    10c3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    10c6:	89 0a                	mov    %ecx,(%edx)
+}
+    10c8:	5b                   	pop    %ebx
+    10c9:	5e                   	pop    %esi
+    10ca:	5f                   	pop    %edi
+    10cb:	5d                   	pop    %ebp
+    10cc:	c3                   	ret
+    10cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000010d0 <free>:
+
+void
+free(void *ap)
+{
+    10d0:	55                   	push   %ebp
+    10d1:	89 e5                	mov    %esp,%ebp
+    10d3:	53                   	push   %ebx
+    10d4:	83 ec 10             	sub    $0x10,%esp
+    10d7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  umtxlock(&lock);
+    10da:	68 28 32 00 00       	push   $0x3228
+    10df:	e8 cc f7 ff ff       	call   8b0 <umtxlock>
+  freeblock(ap);
+    10e4:	89 d8                	mov    %ebx,%eax
+    10e6:	e8 65 ff ff ff       	call   1050 <freeblock>
+  umtxunlock(&lock);
+    10eb:	c7 45 08 28 32 00 00 	movl   $0x3228,0x8(%ebp)
+}
+    10f2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&lock);
+    10f5:	83 c4 10             	add    $0x10,%esp
+}
+    10f8:	c9                   	leave
+  umtxunlock(&lock);
+    10f9:	e9 02 f8 ff ff       	jmp    900 <umtxunlock>
+    10fe:	66 90                	xchg   %ax,%ax
+
+00001100 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    1100:	55                   	push   %ebp
+    1101:	89 e5                	mov    %esp,%ebp
+    1103:	57                   	push   %edi
+    1104:	56                   	push   %esi
+    1105:	53                   	push   %ebx
+    1106:	83 ec 28             	sub    $0x28,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1109:	8b 45 08             	mov    0x8(%ebp),%eax
+  umtxlock(&lock);
+    110c:	68 28 32 00 00       	push   $0x3228
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1111:	8d 48 07             	lea    0x7(%eax),%ecx
+    1114:	c1 e9 03             	shr    $0x3,%ecx
+    1117:	8d 71 01             	lea    0x1(%ecx),%esi
+  umtxlock(&lock);
+    111a:	e8 91 f7 ff ff       	call   8b0 <umtxlock>
+  if((prevp = freep) == 0){
+    111f:	8b 15 2c 32 00 00    	mov    0x322c,%edx
+    1125:	83 c4 10             	add    $0x10,%esp
+    1128:	85 d2                	test   %edx,%edx
+    112a:	0f 84 b0 00 00 00    	je     11e0 <malloc+0xe0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1130:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+    1132:	8b 47 04             	mov    0x4(%edi),%eax
+    1135:	39 f0                	cmp    %esi,%eax
+    1137:	73 6f                	jae    11a8 <malloc+0xa8>
+  if(nu < 4096)
+    1139:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    113e:	39 de                	cmp    %ebx,%esi
+    1140:	0f 43 de             	cmovae %esi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    1143:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+    114a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    114d:	eb 0a                	jmp    1159 <malloc+0x59>
+    114f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1150:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+    1152:	8b 47 04             	mov    0x4(%edi),%eax
+    1155:	39 f0                	cmp    %esi,%eax
+    1157:	73 4f                	jae    11a8 <malloc+0xa8>
+      }
+      freep = prevp;
+      umtxunlock(&lock);
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    1159:	89 fa                	mov    %edi,%edx
+    115b:	39 3d 2c 32 00 00    	cmp    %edi,0x322c
+    1161:	75 ed                	jne    1150 <malloc+0x50>
+  p = sbrk(nu * sizeof(Header));
+    1163:	83 ec 0c             	sub    $0xc,%esp
+    1166:	ff 75 e4             	push   -0x1c(%ebp)
+    1169:	e8 4a f8 ff ff       	call   9b8 <sbrk>
+  if(p == (char*)-1)
+    116e:	83 c4 10             	add    $0x10,%esp
+    1171:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1174:	74 15                	je     118b <malloc+0x8b>
+  hp->s.size = nu;
+    1176:	89 58 04             	mov    %ebx,0x4(%eax)
+  freeblock((void*)(hp + 1));
+    1179:	83 c0 08             	add    $0x8,%eax
+    117c:	e8 cf fe ff ff       	call   1050 <freeblock>
+  return freep;
+    1181:	8b 15 2c 32 00 00    	mov    0x322c,%edx
+      if((p = morecore(nunits)) == 0){
+    1187:	85 d2                	test   %edx,%edx
+    1189:	75 c5                	jne    1150 <malloc+0x50>
+        umtxunlock(&lock);
+    118b:	83 ec 0c             	sub    $0xc,%esp
+    118e:	68 28 32 00 00       	push   $0x3228
+    1193:	e8 68 f7 ff ff       	call   900 <umtxunlock>
+        return 0;
+    1198:	83 c4 10             	add    $0x10,%esp
+      }
+  }
+}
+    119b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    119e:	31 c0                	xor    %eax,%eax
+}
+    11a0:	5b                   	pop    %ebx
+    11a1:	5e                   	pop    %esi
+    11a2:	5f                   	pop    %edi
+    11a3:	5d                   	pop    %ebp
+    11a4:	c3                   	ret
+    11a5:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    11a8:	39 c6                	cmp    %eax,%esi
+    11aa:	74 64                	je     1210 <malloc+0x110>
+        p->s.size -= nunits;
+    11ac:	29 f0                	sub    %esi,%eax
+    11ae:	89 47 04             	mov    %eax,0x4(%edi)
+        p += p->s.size;
+    11b1:	8d 3c c7             	lea    (%edi,%eax,8),%edi
+        p->s.size = nunits;
+    11b4:	89 77 04             	mov    %esi,0x4(%edi)
+      umtxunlock(&lock);
+    11b7:	83 ec 0c             	sub    $0xc,%esp
+      freep = prevp;
+    11ba:	89 15 2c 32 00 00    	mov    %edx,0x322c
+      umtxunlock(&lock);
+    11c0:	68 28 32 00 00       	push   $0x3228
+    11c5:	e8 36 f7 ff ff       	call   900 <umtxunlock>
+      return (void*)(p + 1);
+    11ca:	83 c4 10             	add    $0x10,%esp
+}
+    11cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    11d0:	8d 47 08             	lea    0x8(%edi),%eax
+}
+    11d3:	5b                   	pop    %ebx
+    11d4:	5e                   	pop    %esi
+    11d5:	5f                   	pop    %edi
+    11d6:	5d                   	pop    %ebp
+    11d7:	c3                   	ret
+    11d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11df:	90                   	nop
+    base.s.ptr = freep = prevp = &base;
+    11e0:	c7 05 2c 32 00 00 30 	movl   $0x3230,0x322c
+    11e7:	32 00 00 
+    base.s.size = 0;
+    11ea:	bf 30 32 00 00       	mov    $0x3230,%edi
+    base.s.ptr = freep = prevp = &base;
+    11ef:	c7 05 30 32 00 00 30 	movl   $0x3230,0x3230
+    11f6:	32 00 00 
+    base.s.size = 0;
+    11f9:	c7 05 34 32 00 00 00 	movl   $0x0,0x3234
+    1200:	00 00 00 
+    if(p->s.size >= nunits){
+    1203:	e9 31 ff ff ff       	jmp    1139 <malloc+0x39>
+    1208:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    120f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1210:	8b 07                	mov    (%edi),%eax
+    1212:	89 02                	mov    %eax,(%edx)
+    1214:	eb a1                	jmp    11b7 <malloc+0xb7>
+    1216:	66 90                	xchg   %ax,%ax
+    1218:	66 90                	xchg   %ax,%ax
+    121a:	66 90                	xchg   %ax,%ax
+    121c:	66 90                	xchg   %ax,%ax
+    121e:	66 90                	xchg   %ax,%ax
+
+00001220 <threadstart>:
+
+#define TSTACKSZ 4096
+
+static void
+threadstart(void *fn, void *arg)
+{
+    1220:	55                   	push   %ebp
+    1221:	89 e5                	mov    %esp,%ebp
+    1223:	83 ec 14             	sub    $0x14,%esp
+  ((void (*)(void*))fn)(arg);
+    1226:	ff 75 0c             	push   0xc(%ebp)
+    1229:	ff 55 08             	call   *0x8(%ebp)
+  exit();
+    122c:	e8 ef f4 ff ff       	call   720 <exit>
+    1231:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1238:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    123f:	90                   	nop
+
+00001240 <thread_create>:
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    1240:	55                   	push   %ebp
+    1241:	89 e5                	mov    %esp,%ebp
+    1243:	53                   	push   %ebx
+    1244:	83 ec 20             	sub    $0x20,%esp
+  char *mem, *stack;
+  int pid;
+
+  if((mem = malloc(2*TSTACKSZ)) == 0)
+    1247:	68 00 20 00 00       	push   $0x2000
+    124c:	e8 af fe ff ff       	call   1100 <malloc>
+    1251:	83 c4 10             	add    $0x10,%esp
+    1254:	85 c0                	test   %eax,%eax
+    1256:	74 47                	je     129f <thread_create+0x5f>
+    1258:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)(((uint)mem + TSTACKSZ - 1) & ~(TSTACKSZ - 1));
+    125a:	8d 80 ff 0f 00 00    	lea    0xfff(%eax),%eax
+    1260:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  *(char**)stack = mem;
+    1265:	89 18                	mov    %ebx,(%eax)
+  if((pid = clone(threadstart, (void*)fn, arg, stack)) < 0)
+    1267:	50                   	push   %eax
+    1268:	ff 75 0c             	push   0xc(%ebp)
+    126b:	ff 75 08             	push   0x8(%ebp)
+    126e:	68 20 12 00 00       	push   $0x1220
+    1273:	e8 08 f8 ff ff       	call   a80 <clone>
+    1278:	83 c4 10             	add    $0x10,%esp
+    127b:	85 c0                	test   %eax,%eax
+    127d:	78 09                	js     1288 <thread_create+0x48>
+    free(mem);
+  return pid;
+}
+    127f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1282:	c9                   	leave
+    1283:	c3                   	ret
+    1284:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    free(mem);
+    1288:	83 ec 0c             	sub    $0xc,%esp
+    128b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    128e:	53                   	push   %ebx
+    128f:	e8 3c fe ff ff       	call   10d0 <free>
+    1294:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    1297:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+    129a:	83 c4 10             	add    $0x10,%esp
+}
+    129d:	c9                   	leave
+    129e:	c3                   	ret
+    return -1;
+    129f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    12a4:	eb d9                	jmp    127f <thread_create+0x3f>
+    12a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000012b0 <thread_join>:
+
+int
+thread_join(void)
+{
+    12b0:	55                   	push   %ebp
+    12b1:	89 e5                	mov    %esp,%ebp
+    12b3:	83 ec 34             	sub    $0x34,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    12b6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    12b9:	50                   	push   %eax
+    12ba:	e8 c9 f7 ff ff       	call   a88 <join>
+    12bf:	83 c4 10             	add    $0x10,%esp
+    12c2:	85 c0                	test   %eax,%eax
+    12c4:	79 0a                	jns    12d0 <thread_join+0x20>
+    free(*(char**)stack);
+  return pid;
+}
+    12c6:	c9                   	leave
+    12c7:	c3                   	ret
+    12c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12cf:	90                   	nop
+    free(*(char**)stack);
+    12d0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    12d3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    12d6:	83 ec 0c             	sub    $0xc,%esp
+    12d9:	ff 32                	push   (%edx)
+    12db:	e8 f0 fd ff ff       	call   10d0 <free>
+    12e0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    12e3:	83 c4 10             	add    $0x10,%esp
+}
+    12e6:	c9                   	leave
+    12e7:	c3                   	ret
@@ -0,0 +1,2407 @@
+
+_wc:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <count>:
+char buf[512];
+int l, w, c, inword;
+
+void
+count(char *p, int n)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	56                   	push   %esi
+       4:	53                   	push   %ebx
+       5:	8b 45 0c             	mov    0xc(%ebp),%eax
+       8:	8b 75 08             	mov    0x8(%ebp),%esi
+       b:	8d 1c 06             	lea    (%esi,%eax,1),%ebx
+  int i;
+
+  for(i=0; i<n; i++){
+       e:	85 c0                	test   %eax,%eax
+      10:	7f 17                	jg     29 <count+0x29>
+      12:	eb 63                	jmp    77 <count+0x77>
+      14:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c++;
+    if(p[i] == '\n')
+      l++;
+    if(strchr(" \r\t\n\v", p[i]))
+      inword = 0;
+      18:	c7 05 20 22 00 00 00 	movl   $0x0,0x2220
+      1f:	00 00 00 
+  for(i=0; i<n; i++){
+      22:	83 c6 01             	add    $0x1,%esi
+      25:	39 de                	cmp    %ebx,%esi
+      27:	74 4e                	je     77 <count+0x77>
+    c++;
+      29:	83 05 24 22 00 00 01 	addl   $0x1,0x2224
+    if(p[i] == '\n')
+      30:	0f be 06             	movsbl (%esi),%eax
+      33:	3c 0a                	cmp    $0xa,%al
+      35:	75 0a                	jne    41 <count+0x41>
+      l++;
+      37:	83 05 2c 22 00 00 01 	addl   $0x1,0x222c
+    if(strchr(" \r\t\n\v", p[i]))
+      3e:	0f be 06             	movsbl (%esi),%eax
+      41:	83 ec 08             	sub    $0x8,%esp
+      44:	50                   	push   %eax
+      45:	68 b8 10 00 00       	push   $0x10b8
+      4a:	e8 01 03 00 00       	call   350 <strchr>
+      4f:	83 c4 10             	add    $0x10,%esp
+      52:	85 c0                	test   %eax,%eax
+      54:	75 c2                	jne    18 <count+0x18>
+    else if(!inword){
+      56:	a1 20 22 00 00       	mov    0x2220,%eax
+      5b:	85 c0                	test   %eax,%eax
+      5d:	75 c3                	jne    22 <count+0x22>
+  for(i=0; i<n; i++){
+      5f:	83 c6 01             	add    $0x1,%esi
+      w++;
+      62:	83 05 28 22 00 00 01 	addl   $0x1,0x2228
+      inword = 1;
+      69:	c7 05 20 22 00 00 01 	movl   $0x1,0x2220
+      70:	00 00 00 
+  for(i=0; i<n; i++){
+      73:	39 de                	cmp    %ebx,%esi
+      75:	75 b2                	jne    29 <count+0x29>
+    }
+  }
+}
+      77:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      7a:	5b                   	pop    %ebx
+      7b:	5e                   	pop    %esi
+      7c:	5d                   	pop    %ebp
+      7d:	c3                   	ret
+      7e:	66 90                	xchg   %ax,%ax
+
+00000080 <wc>:
+
+void
+wc(int fd, char *name)
+{
+      80:	55                   	push   %ebp
+      81:	89 e5                	mov    %esp,%ebp
+      83:	56                   	push   %esi
+      84:	53                   	push   %ebx
+  l = w = c = 0;
+  inword = 0;
+
+  // Scan a regular file where it sits in the page cache
+  // rather than copying it out with read().
+  if(fstat(fd, &st) == 0 && st.type == T_FILE && st.size > 0 &&
+      85:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+{
+      88:	83 ec 28             	sub    $0x28,%esp
+      8b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  l = w = c = 0;
+      8e:	c7 05 24 22 00 00 00 	movl   $0x0,0x2224
+      95:	00 00 00 
+      98:	c7 05 28 22 00 00 00 	movl   $0x0,0x2228
+      9f:	00 00 00 
+      a2:	c7 05 2c 22 00 00 00 	movl   $0x0,0x222c
+      a9:	00 00 00 
+  inword = 0;
+      ac:	c7 05 20 22 00 00 00 	movl   $0x0,0x2220
+      b3:	00 00 00 
+  if(fstat(fd, &st) == 0 && st.type == T_FILE && st.size > 0 &&
+      b6:	50                   	push   %eax
+      b7:	53                   	push   %ebx
+      b8:	e8 9b 06 00 00       	call   758 <fstat>
+      bd:	83 c4 10             	add    $0x10,%esp
+      c0:	85 c0                	test   %eax,%eax
+      c2:	75 5d                	jne    121 <wc+0xa1>
+      c4:	66 83 7d e4 02       	cmpw   $0x2,-0x1c(%ebp)
+      c9:	75 56                	jne    121 <wc+0xa1>
+      cb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+      ce:	85 c0                	test   %eax,%eax
+      d0:	74 4f                	je     121 <wc+0xa1>
+     (p = mmap(0, st.size, PROT_READ, MAP_SHARED, fd, 0)) != MAP_FAILED){
+      d2:	83 ec 08             	sub    $0x8,%esp
+      d5:	6a 00                	push   $0x0
+      d7:	53                   	push   %ebx
+      d8:	6a 01                	push   $0x1
+      da:	6a 01                	push   $0x1
+      dc:	50                   	push   %eax
+      dd:	6a 00                	push   $0x0
+      df:	e8 f4 06 00 00       	call   7d8 <mmap>
+  if(fstat(fd, &st) == 0 && st.type == T_FILE && st.size > 0 &&
+      e4:	83 c4 20             	add    $0x20,%esp
+     (p = mmap(0, st.size, PROT_READ, MAP_SHARED, fd, 0)) != MAP_FAILED){
+      e7:	89 c6                	mov    %eax,%esi
+  if(fstat(fd, &st) == 0 && st.type == T_FILE && st.size > 0 &&
+      e9:	83 f8 ff             	cmp    $0xffffffff,%eax
+      ec:	74 33                	je     121 <wc+0xa1>
+    count(p, st.size);
+      ee:	83 ec 08             	sub    $0x8,%esp
+      f1:	ff 75 f4             	push   -0xc(%ebp)
+      f4:	50                   	push   %eax
+      f5:	e8 06 ff ff ff       	call   0 <count>
+    munmap(p, st.size);
+      fa:	5a                   	pop    %edx
+      fb:	59                   	pop    %ecx
+      fc:	ff 75 f4             	push   -0xc(%ebp)
+      ff:	56                   	push   %esi
+     100:	e8 db 06 00 00       	call   7e0 <munmap>
+    printf(1, "%d %d %d %s\n", l, w, c, name);
+     105:	5b                   	pop    %ebx
+     106:	5e                   	pop    %esi
+     107:	eb 37                	jmp    140 <wc+0xc0>
+     109:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return;
+  }
+
+  while((n = read(fd, buf, sizeof(buf))) > 0)
+    count(buf, n);
+     110:	83 ec 08             	sub    $0x8,%esp
+     113:	50                   	push   %eax
+     114:	68 40 22 00 00       	push   $0x2240
+     119:	e8 e2 fe ff ff       	call   0 <count>
+     11e:	83 c4 10             	add    $0x10,%esp
+  while((n = read(fd, buf, sizeof(buf))) > 0)
+     121:	83 ec 04             	sub    $0x4,%esp
+     124:	68 00 02 00 00       	push   $0x200
+     129:	68 40 22 00 00       	push   $0x2240
+     12e:	53                   	push   %ebx
+     12f:	e8 0c 04 00 00       	call   540 <read>
+     134:	83 c4 10             	add    $0x10,%esp
+     137:	85 c0                	test   %eax,%eax
+     139:	7f d5                	jg     110 <wc+0x90>
+  if(n < 0){
+     13b:	75 2e                	jne    16b <wc+0xeb>
+    printf(1, "wc: read error\n");
+    exit();
+  }
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+     13d:	83 ec 08             	sub    $0x8,%esp
+     140:	ff 75 0c             	push   0xc(%ebp)
+     143:	ff 35 24 22 00 00    	push   0x2224
+     149:	ff 35 28 22 00 00    	push   0x2228
+     14f:	ff 35 2c 22 00 00    	push   0x222c
+     155:	68 be 10 00 00       	push   $0x10be
+     15a:	6a 01                	push   $0x1
+     15c:	e8 1f 0b 00 00       	call   c80 <printf>
+     161:	83 c4 20             	add    $0x20,%esp
+}
+     164:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     167:	5b                   	pop    %ebx
+     168:	5e                   	pop    %esi
+     169:	5d                   	pop    %ebp
+     16a:	c3                   	ret
+    printf(1, "wc: read error\n");
+     16b:	50                   	push   %eax
+     16c:	50                   	push   %eax
+     16d:	68 cb 10 00 00       	push   $0x10cb
+     172:	6a 01                	push   $0x1
+     174:	e8 07 0b 00 00       	call   c80 <printf>
+    exit();
+     179:	e8 72 03 00 00       	call   4f0 <exit>
+     17e:	66 90                	xchg   %ax,%ax
+
+00000180 <main>:
+
+int
+main(int argc, char *argv[])
+{
+     180:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     184:	83 e4 f0             	and    $0xfffffff0,%esp
+     187:	ff 71 fc             	push   -0x4(%ecx)
+     18a:	55                   	push   %ebp
+     18b:	89 e5                	mov    %esp,%ebp
+     18d:	57                   	push   %edi
+     18e:	56                   	push   %esi
+     18f:	be 01 00 00 00       	mov    $0x1,%esi
+     194:	53                   	push   %ebx
+     195:	51                   	push   %ecx
+     196:	83 ec 18             	sub    $0x18,%esp
+     199:	8b 01                	mov    (%ecx),%eax
+     19b:	8b 59 04             	mov    0x4(%ecx),%ebx
+     19e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     1a1:	83 c3 04             	add    $0x4,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+     1a4:	83 f8 01             	cmp    $0x1,%eax
+     1a7:	7f 28                	jg     1d1 <main+0x51>
+     1a9:	eb 54                	jmp    1ff <main+0x7f>
+     1ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     1af:	90                   	nop
+  for(i = 1; i < argc; i++){
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "wc: cannot open %s\n", argv[i]);
+      exit();
+    }
+    wc(fd, argv[i]);
+     1b0:	83 ec 08             	sub    $0x8,%esp
+     1b3:	ff 33                	push   (%ebx)
+  for(i = 1; i < argc; i++){
+     1b5:	83 c6 01             	add    $0x1,%esi
+     1b8:	83 c3 04             	add    $0x4,%ebx
+    wc(fd, argv[i]);
+     1bb:	50                   	push   %eax
+     1bc:	e8 bf fe ff ff       	call   80 <wc>
+    close(fd);
+     1c1:	89 3c 24             	mov    %edi,(%esp)
+     1c4:	e8 77 04 00 00       	call   640 <close>
+  for(i = 1; i < argc; i++){
+     1c9:	83 c4 10             	add    $0x10,%esp
+     1cc:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+     1cf:	74 29                	je     1fa <main+0x7a>
+    if((fd = open(argv[i], 0)) < 0){
+     1d1:	83 ec 08             	sub    $0x8,%esp
+     1d4:	6a 00                	push   $0x0
+     1d6:	ff 33                	push   (%ebx)
+     1d8:	e8 63 05 00 00       	call   740 <open>
+     1dd:	83 c4 10             	add    $0x10,%esp
+     1e0:	89 c7                	mov    %eax,%edi
+     1e2:	85 c0                	test   %eax,%eax
+     1e4:	79 ca                	jns    1b0 <main+0x30>
+      printf(1, "wc: cannot open %s\n", argv[i]);
+     1e6:	50                   	push   %eax
+     1e7:	ff 33                	push   (%ebx)
+     1e9:	68 db 10 00 00       	push   $0x10db
+     1ee:	6a 01                	push   $0x1
+     1f0:	e8 8b 0a 00 00       	call   c80 <printf>
+      exit();
+     1f5:	e8 f6 02 00 00       	call   4f0 <exit>
+  }
+  exit();
+     1fa:	e8 f1 02 00 00       	call   4f0 <exit>
+    wc(0, "");
+     1ff:	52                   	push   %edx
+     200:	52                   	push   %edx
+     201:	68 da 10 00 00       	push   $0x10da
+     206:	6a 00                	push   $0x0
+     208:	e8 73 fe ff ff       	call   80 <wc>
+    exit();
+     20d:	e8 de 02 00 00       	call   4f0 <exit>
+     212:	66 90                	xchg   %ax,%ax
+     214:	66 90                	xchg   %ax,%ax
+     216:	66 90                	xchg   %ax,%ax
+     218:	66 90                	xchg   %ax,%ax
+     21a:	66 90                	xchg   %ax,%ax
+     21c:	66 90                	xchg   %ax,%ax
+     21e:	66 90                	xchg   %ax,%ax
+
+00000220 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     220:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     221:	31 c0                	xor    %eax,%eax
+{
+     223:	89 e5                	mov    %esp,%ebp
+     225:	53                   	push   %ebx
+     226:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     229:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     22c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     230:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     234:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     237:	83 c0 01             	add    $0x1,%eax
+     23a:	84 d2                	test   %dl,%dl
+     23c:	75 f2                	jne    230 <strcpy+0x10>
+    ;
+  return os;
+}
+     23e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     241:	89 c8                	mov    %ecx,%eax
+     243:	c9                   	leave
+     244:	c3                   	ret
+     245:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     24c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000250 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     250:	55                   	push   %ebp
+     251:	89 e5                	mov    %esp,%ebp
+     253:	53                   	push   %ebx
+     254:	8b 55 08             	mov    0x8(%ebp),%edx
+     257:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     25a:	0f b6 02             	movzbl (%edx),%eax
+     25d:	84 c0                	test   %al,%al
+     25f:	75 17                	jne    278 <strcmp+0x28>
+     261:	eb 3a                	jmp    29d <strcmp+0x4d>
+     263:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     267:	90                   	nop
+     268:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     26c:	83 c2 01             	add    $0x1,%edx
+     26f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     272:	84 c0                	test   %al,%al
+     274:	74 1a                	je     290 <strcmp+0x40>
+    p++, q++;
+     276:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     278:	0f b6 19             	movzbl (%ecx),%ebx
+     27b:	38 c3                	cmp    %al,%bl
+     27d:	74 e9                	je     268 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     27f:	29 d8                	sub    %ebx,%eax
+}
+     281:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     284:	c9                   	leave
+     285:	c3                   	ret
+     286:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     28d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     290:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     294:	31 c0                	xor    %eax,%eax
+     296:	29 d8                	sub    %ebx,%eax
+}
+     298:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     29b:	c9                   	leave
+     29c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     29d:	0f b6 19             	movzbl (%ecx),%ebx
+     2a0:	31 c0                	xor    %eax,%eax
+     2a2:	eb db                	jmp    27f <strcmp+0x2f>
+     2a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2af:	90                   	nop
+
+000002b0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     2b0:	55                   	push   %ebp
+     2b1:	89 e5                	mov    %esp,%ebp
+     2b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     2b6:	80 3a 00             	cmpb   $0x0,(%edx)
+     2b9:	74 15                	je     2d0 <strlen+0x20>
+     2bb:	31 c0                	xor    %eax,%eax
+     2bd:	8d 76 00             	lea    0x0(%esi),%esi
+     2c0:	83 c0 01             	add    $0x1,%eax
+     2c3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     2c7:	89 c1                	mov    %eax,%ecx
+     2c9:	75 f5                	jne    2c0 <strlen+0x10>
+    ;
+  return n;
+}
+     2cb:	89 c8                	mov    %ecx,%eax
+     2cd:	5d                   	pop    %ebp
+     2ce:	c3                   	ret
+     2cf:	90                   	nop
+  for(n = 0; s[n]; n++)
+     2d0:	31 c9                	xor    %ecx,%ecx
+}
+     2d2:	5d                   	pop    %ebp
+     2d3:	89 c8                	mov    %ecx,%eax
+     2d5:	c3                   	ret
+     2d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002e0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     2e0:	55                   	push   %ebp
+     2e1:	89 e5                	mov    %esp,%ebp
+     2e3:	57                   	push   %edi
+     2e4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     2e7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     2ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+     2ed:	89 d7                	mov    %edx,%edi
+     2ef:	fc                   	cld
+     2f0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     2f2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     2f5:	89 d0                	mov    %edx,%eax
+     2f7:	c9                   	leave
+     2f8:	c3                   	ret
+     2f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000300 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     300:	55                   	push   %ebp
+     301:	89 e5                	mov    %esp,%ebp
+     303:	56                   	push   %esi
+     304:	53                   	push   %ebx
+     305:	8b 75 10             	mov    0x10(%ebp),%esi
+     308:	8b 55 08             	mov    0x8(%ebp),%edx
+     30b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+     30e:	85 f6                	test   %esi,%esi
+     310:	74 2e                	je     340 <memcmp+0x40>
+     312:	01 c6                	add    %eax,%esi
+     314:	eb 14                	jmp    32a <memcmp+0x2a>
+     316:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     31d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+     320:	83 c0 01             	add    $0x1,%eax
+     323:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+     326:	39 f0                	cmp    %esi,%eax
+     328:	74 16                	je     340 <memcmp+0x40>
+    if(*s1 != *s2)
+     32a:	0f b6 0a             	movzbl (%edx),%ecx
+     32d:	0f b6 18             	movzbl (%eax),%ebx
+     330:	38 d9                	cmp    %bl,%cl
+     332:	74 ec                	je     320 <memcmp+0x20>
+      return *s1 - *s2;
+     334:	0f b6 c1             	movzbl %cl,%eax
+     337:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+     339:	5b                   	pop    %ebx
+     33a:	5e                   	pop    %esi
+     33b:	5d                   	pop    %ebp
+     33c:	c3                   	ret
+     33d:	8d 76 00             	lea    0x0(%esi),%esi
+     340:	5b                   	pop    %ebx
+  return 0;
+     341:	31 c0                	xor    %eax,%eax
+}
+     343:	5e                   	pop    %esi
+     344:	5d                   	pop    %ebp
+     345:	c3                   	ret
+     346:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     34d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000350 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     350:	55                   	push   %ebp
+     351:	89 e5                	mov    %esp,%ebp
+     353:	8b 45 08             	mov    0x8(%ebp),%eax
+     356:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     35a:	0f b6 10             	movzbl (%eax),%edx
+     35d:	84 d2                	test   %dl,%dl
+     35f:	75 12                	jne    373 <strchr+0x23>
+     361:	eb 1d                	jmp    380 <strchr+0x30>
+     363:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     367:	90                   	nop
+     368:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     36c:	83 c0 01             	add    $0x1,%eax
+     36f:	84 d2                	test   %dl,%dl
+     371:	74 0d                	je     380 <strchr+0x30>
+    if(*s == c)
+     373:	38 d1                	cmp    %dl,%cl
+     375:	75 f1                	jne    368 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     377:	5d                   	pop    %ebp
+     378:	c3                   	ret
+     379:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     380:	31 c0                	xor    %eax,%eax
+}
+     382:	5d                   	pop    %ebp
+     383:	c3                   	ret
+     384:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     38b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     38f:	90                   	nop
+
+00000390 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     390:	55                   	push   %ebp
+     391:	89 e5                	mov    %esp,%ebp
+     393:	57                   	push   %edi
+     394:	56                   	push   %esi
+int
+read(int fd, void *buf, int n)
+{
+  if(flushhook)
+    flushhook();
+  return _read(fd, buf, n);
+     395:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     398:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     399:	31 db                	xor    %ebx,%ebx
+{
+     39b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     39e:	eb 32                	jmp    3d2 <gets+0x42>
+  if(flushhook)
+     3a0:	a1 40 24 00 00       	mov    0x2440,%eax
+     3a5:	85 c0                	test   %eax,%eax
+     3a7:	74 02                	je     3ab <gets+0x1b>
+    flushhook();
+     3a9:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+     3ab:	83 ec 04             	sub    $0x4,%esp
+     3ae:	6a 01                	push   $0x1
+     3b0:	56                   	push   %esi
+     3b1:	6a 00                	push   $0x0
+     3b3:	e8 60 03 00 00       	call   718 <_read>
+    if(cc < 1)
+     3b8:	83 c4 10             	add    $0x10,%esp
+     3bb:	85 c0                	test   %eax,%eax
+     3bd:	7e 1d                	jle    3dc <gets+0x4c>
+    buf[i++] = c;
+     3bf:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     3c3:	8b 55 08             	mov    0x8(%ebp),%edx
+     3c6:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     3ca:	3c 0a                	cmp    $0xa,%al
+     3cc:	74 10                	je     3de <gets+0x4e>
+     3ce:	3c 0d                	cmp    $0xd,%al
+     3d0:	74 0c                	je     3de <gets+0x4e>
+  for(i=0; i+1 < max; ){
+     3d2:	89 df                	mov    %ebx,%edi
+     3d4:	83 c3 01             	add    $0x1,%ebx
+     3d7:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     3da:	7c c4                	jl     3a0 <gets+0x10>
+     3dc:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+     3de:	8b 45 08             	mov    0x8(%ebp),%eax
+     3e1:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+     3e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     3e8:	5b                   	pop    %ebx
+     3e9:	5e                   	pop    %esi
+     3ea:	5f                   	pop    %edi
+     3eb:	5d                   	pop    %ebp
+     3ec:	c3                   	ret
+     3ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003f0 <stat>:
+{
+     3f0:	55                   	push   %ebp
+     3f1:	89 e5                	mov    %esp,%ebp
+     3f3:	56                   	push   %esi
+     3f4:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+     3f5:	83 ec 08             	sub    $0x8,%esp
+     3f8:	6a 00                	push   $0x0
+     3fa:	ff 75 08             	push   0x8(%ebp)
+     3fd:	e8 3e 03 00 00       	call   740 <open>
+  if(fd < 0)
+     402:	83 c4 10             	add    $0x10,%esp
+     405:	85 c0                	test   %eax,%eax
+     407:	78 37                	js     440 <stat+0x50>
+  r = fstat(fd, st);
+     409:	83 ec 08             	sub    $0x8,%esp
+     40c:	ff 75 0c             	push   0xc(%ebp)
+     40f:	89 c3                	mov    %eax,%ebx
+     411:	50                   	push   %eax
+     412:	e8 41 03 00 00       	call   758 <fstat>
+}
+
+int
+close(int fd)
+{
+  if(flushhook)
+     417:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+     41a:	89 c6                	mov    %eax,%esi
+  if(flushhook)
+     41c:	a1 40 24 00 00       	mov    0x2440,%eax
+     421:	85 c0                	test   %eax,%eax
+     423:	74 02                	je     427 <stat+0x37>
+    flushhook();
+     425:	ff d0                	call   *%eax
+  return _close(fd);
+     427:	83 ec 0c             	sub    $0xc,%esp
+     42a:	53                   	push   %ebx
+     42b:	e8 f8 02 00 00       	call   728 <_close>
+     430:	83 c4 10             	add    $0x10,%esp
+}
+     433:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     436:	89 f0                	mov    %esi,%eax
+     438:	5b                   	pop    %ebx
+     439:	5e                   	pop    %esi
+     43a:	5d                   	pop    %ebp
+     43b:	c3                   	ret
+     43c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+     440:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     445:	eb ec                	jmp    433 <stat+0x43>
+     447:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     44e:	66 90                	xchg   %ax,%ax
+
+00000450 <atoi>:
+{
+     450:	55                   	push   %ebp
+     451:	89 e5                	mov    %esp,%ebp
+     453:	53                   	push   %ebx
+     454:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+     457:	0f be 02             	movsbl (%edx),%eax
+     45a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     45d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     460:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     465:	77 1e                	ja     485 <atoi+0x35>
+     467:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     46e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     470:	83 c2 01             	add    $0x1,%edx
+     473:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     476:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     47a:	0f be 02             	movsbl (%edx),%eax
+     47d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     480:	80 fb 09             	cmp    $0x9,%bl
+     483:	76 eb                	jbe    470 <atoi+0x20>
+}
+     485:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     488:	89 c8                	mov    %ecx,%eax
+     48a:	c9                   	leave
+     48b:	c3                   	ret
+     48c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000490 <memmove>:
+{
+     490:	55                   	push   %ebp
+     491:	89 e5                	mov    %esp,%ebp
+     493:	57                   	push   %edi
+     494:	56                   	push   %esi
+     495:	8b 45 10             	mov    0x10(%ebp),%eax
+     498:	8b 55 08             	mov    0x8(%ebp),%edx
+     49b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+     49e:	85 c0                	test   %eax,%eax
+     4a0:	7e 13                	jle    4b5 <memmove+0x25>
+     4a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     4a4:	89 d7                	mov    %edx,%edi
+     4a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     4b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     4b1:	39 f8                	cmp    %edi,%eax
+     4b3:	75 fb                	jne    4b0 <memmove+0x20>
+}
+     4b5:	5e                   	pop    %esi
+     4b6:	89 d0                	mov    %edx,%eax
+     4b8:	5f                   	pop    %edi
+     4b9:	5d                   	pop    %ebp
+     4ba:	c3                   	ret
+     4bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     4bf:	90                   	nop
+
+000004c0 <fork>:
+  if(flushhook)
+     4c0:	a1 40 24 00 00       	mov    0x2440,%eax
+     4c5:	85 c0                	test   %eax,%eax
+     4c7:	74 17                	je     4e0 <fork+0x20>
+{
+     4c9:	55                   	push   %ebp
+     4ca:	89 e5                	mov    %esp,%ebp
+     4cc:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+     4cf:	ff d0                	call   *%eax
+}
+     4d1:	c9                   	leave
+  return _fork();
+     4d2:	e9 21 02 00 00       	jmp    6f8 <_fork>
+     4d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4de:	66 90                	xchg   %ax,%ax
+     4e0:	e9 13 02 00 00       	jmp    6f8 <_fork>
+     4e5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004f0 <exit>:
+{
+     4f0:	55                   	push   %ebp
+     4f1:	89 e5                	mov    %esp,%ebp
+     4f3:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+     4f6:	a1 40 24 00 00       	mov    0x2440,%eax
+     4fb:	85 c0                	test   %eax,%eax
+     4fd:	74 02                	je     501 <exit+0x11>
+    flushhook();
+     4ff:	ff d0                	call   *%eax
+  _exit();
+     501:	e8 fa 01 00 00       	call   700 <_exit>
+     506:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     50d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000510 <exec>:
+{
+     510:	55                   	push   %ebp
+  if(flushhook)
+     511:	a1 40 24 00 00       	mov    0x2440,%eax
+{
+     516:	89 e5                	mov    %esp,%ebp
+     518:	56                   	push   %esi
+     519:	53                   	push   %ebx
+     51a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     51d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+     520:	85 c0                	test   %eax,%eax
+     522:	74 02                	je     526 <exec+0x16>
+    flushhook();
+     524:	ff d0                	call   *%eax
+  return _exec(path, argv);
+     526:	89 75 0c             	mov    %esi,0xc(%ebp)
+     529:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     52c:	5b                   	pop    %ebx
+     52d:	5e                   	pop    %esi
+     52e:	5d                   	pop    %ebp
+  return _exec(path, argv);
+     52f:	e9 04 02 00 00       	jmp    738 <_exec>
+     534:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     53b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     53f:	90                   	nop
+
+00000540 <read>:
+{
+     540:	55                   	push   %ebp
+     541:	89 e5                	mov    %esp,%ebp
+     543:	57                   	push   %edi
+     544:	56                   	push   %esi
+     545:	53                   	push   %ebx
+     546:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     549:	a1 40 24 00 00       	mov    0x2440,%eax
+{
+     54e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     551:	8b 75 0c             	mov    0xc(%ebp),%esi
+     554:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     557:	85 c0                	test   %eax,%eax
+     559:	74 02                	je     55d <read+0x1d>
+    flushhook();
+     55b:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+     55d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     560:	89 75 0c             	mov    %esi,0xc(%ebp)
+     563:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     566:	83 c4 0c             	add    $0xc,%esp
+     569:	5b                   	pop    %ebx
+     56a:	5e                   	pop    %esi
+     56b:	5f                   	pop    %edi
+     56c:	5d                   	pop    %ebp
+  return _read(fd, buf, n);
+     56d:	e9 a6 01 00 00       	jmp    718 <_read>
+     572:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     579:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000580 <readv>:
+{
+     580:	55                   	push   %ebp
+     581:	89 e5                	mov    %esp,%ebp
+     583:	57                   	push   %edi
+     584:	56                   	push   %esi
+     585:	53                   	push   %ebx
+     586:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     589:	a1 40 24 00 00       	mov    0x2440,%eax
+{
+     58e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     591:	8b 75 0c             	mov    0xc(%ebp),%esi
+     594:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     597:	85 c0                	test   %eax,%eax
+     599:	74 02                	je     59d <readv+0x1d>
+    flushhook();
+     59b:	ff d0                	call   *%eax
+  return _readv(fd, iov, cnt);
+     59d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     5a0:	89 75 0c             	mov    %esi,0xc(%ebp)
+     5a3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     5a6:	83 c4 0c             	add    $0xc,%esp
+     5a9:	5b                   	pop    %ebx
+     5aa:	5e                   	pop    %esi
+     5ab:	5f                   	pop    %edi
+     5ac:	5d                   	pop    %ebp
+  return _readv(fd, iov, cnt);
+     5ad:	e9 76 02 00 00       	jmp    828 <_readv>
+     5b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000005c0 <write>:
+{
+     5c0:	55                   	push   %ebp
+     5c1:	89 e5                	mov    %esp,%ebp
+     5c3:	57                   	push   %edi
+     5c4:	56                   	push   %esi
+     5c5:	53                   	push   %ebx
+     5c6:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     5c9:	a1 40 24 00 00       	mov    0x2440,%eax
+{
+     5ce:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     5d1:	8b 75 0c             	mov    0xc(%ebp),%esi
+     5d4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     5d7:	85 c0                	test   %eax,%eax
+     5d9:	74 02                	je     5dd <write+0x1d>
+    flushhook();
+     5db:	ff d0                	call   *%eax
+  return _write(fd, buf, n);
+     5dd:	89 7d 10             	mov    %edi,0x10(%ebp)
+     5e0:	89 75 0c             	mov    %esi,0xc(%ebp)
+     5e3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     5e6:	83 c4 0c             	add    $0xc,%esp
+     5e9:	5b                   	pop    %ebx
+     5ea:	5e                   	pop    %esi
+     5eb:	5f                   	pop    %edi
+     5ec:	5d                   	pop    %ebp
+  return _write(fd, buf, n);
+     5ed:	e9 2e 01 00 00       	jmp    720 <_write>
+     5f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000600 <writev>:
+{
+     600:	55                   	push   %ebp
+     601:	89 e5                	mov    %esp,%ebp
+     603:	57                   	push   %edi
+     604:	56                   	push   %esi
+     605:	53                   	push   %ebx
+     606:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+     609:	a1 40 24 00 00       	mov    0x2440,%eax
+{
+     60e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     611:	8b 75 0c             	mov    0xc(%ebp),%esi
+     614:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+     617:	85 c0                	test   %eax,%eax
+     619:	74 02                	je     61d <writev+0x1d>
+    flushhook();
+     61b:	ff d0                	call   *%eax
+  return _writev(fd, iov, cnt);
+     61d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     620:	89 75 0c             	mov    %esi,0xc(%ebp)
+     623:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     626:	83 c4 0c             	add    $0xc,%esp
+     629:	5b                   	pop    %ebx
+     62a:	5e                   	pop    %esi
+     62b:	5f                   	pop    %edi
+     62c:	5d                   	pop    %ebp
+  return _writev(fd, iov, cnt);
+     62d:	e9 fe 01 00 00       	jmp    830 <_writev>
+     632:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     639:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000640 <close>:
+{
+     640:	55                   	push   %ebp
+     641:	89 e5                	mov    %esp,%ebp
+     643:	53                   	push   %ebx
+     644:	83 ec 04             	sub    $0x4,%esp
+  if(flushhook)
+     647:	a1 40 24 00 00       	mov    0x2440,%eax
+{
+     64c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(flushhook)
+     64f:	85 c0                	test   %eax,%eax
+     651:	74 02                	je     655 <close+0x15>
+    flushhook();
+     653:	ff d0                	call   *%eax
+  return _close(fd);
+     655:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     658:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     65b:	c9                   	leave
+  return _close(fd);
+     65c:	e9 c7 00 00 00       	jmp    728 <_close>
+     661:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     668:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     66f:	90                   	nop
+
+00000670 <umtxinit>:
+// process that finds the mutex held enters the kernel, to sleep
+// in futexwait() until the holder's umtxunlock() wakes it.
+
+void
+umtxinit(struct umutex *m)
+{
+     670:	55                   	push   %ebp
+     671:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+     673:	8b 45 08             	mov    0x8(%ebp),%eax
+     676:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     67c:	5d                   	pop    %ebp
+     67d:	c3                   	ret
+     67e:	66 90                	xchg   %ax,%ax
+
+00000680 <umtxlock>:
+
+void
+umtxlock(struct umutex *m)
+{
+     680:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+     681:	b8 01 00 00 00       	mov    $0x1,%eax
+     686:	89 e5                	mov    %esp,%ebp
+     688:	56                   	push   %esi
+     689:	53                   	push   %ebx
+     68a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     68d:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 1) == 0)
+     690:	85 c0                	test   %eax,%eax
+     692:	74 2b                	je     6bf <umtxlock+0x3f>
+     694:	b8 02 00 00 00       	mov    $0x2,%eax
+     699:	f0 87 03             	lock xchg %eax,(%ebx)
+    return;
+  // Mark the mutex contended, so that its holder
+  // wakes a waiter on release, and wait.
+  while(xchg(&m->state, 2) != 0)
+     69c:	85 c0                	test   %eax,%eax
+     69e:	74 1f                	je     6bf <umtxlock+0x3f>
+     6a0:	be 02 00 00 00       	mov    $0x2,%esi
+     6a5:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwait(&m->state, 2);
+     6a8:	83 ec 08             	sub    $0x8,%esp
+     6ab:	6a 02                	push   $0x2
+     6ad:	53                   	push   %ebx
+     6ae:	e8 85 01 00 00       	call   838 <futexwait>
+     6b3:	89 f0                	mov    %esi,%eax
+     6b5:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+     6b8:	83 c4 10             	add    $0x10,%esp
+     6bb:	85 c0                	test   %eax,%eax
+     6bd:	75 e9                	jne    6a8 <umtxlock+0x28>
+}
+     6bf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     6c2:	5b                   	pop    %ebx
+     6c3:	5e                   	pop    %esi
+     6c4:	5d                   	pop    %ebp
+     6c5:	c3                   	ret
+     6c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000006d0 <umtxunlock>:
+
+void
+umtxunlock(struct umutex *m)
+{
+     6d0:	55                   	push   %ebp
+     6d1:	31 c0                	xor    %eax,%eax
+     6d3:	89 e5                	mov    %esp,%ebp
+     6d5:	83 ec 08             	sub    $0x8,%esp
+     6d8:	8b 55 08             	mov    0x8(%ebp),%edx
+     6db:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+     6de:	83 f8 02             	cmp    $0x2,%eax
+     6e1:	74 05                	je     6e8 <umtxunlock+0x18>
+    futexwake(&m->state, 1);
+}
+     6e3:	c9                   	leave
+     6e4:	c3                   	ret
+     6e5:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwake(&m->state, 1);
+     6e8:	83 ec 08             	sub    $0x8,%esp
+     6eb:	6a 01                	push   $0x1
+     6ed:	52                   	push   %edx
+     6ee:	e8 4d 01 00 00       	call   840 <futexwake>
+     6f3:	83 c4 10             	add    $0x10,%esp
+}
+     6f6:	c9                   	leave
+     6f7:	c3                   	ret
+
+000006f8 <_fork>:
+  _ ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+     6f8:	b8 01 00 00 00       	mov    $0x1,%eax
+     6fd:	cd 40                	int    $0x40
+     6ff:	c3                   	ret
+
+00000700 <_exit>:
+RAWSYSCALL(exit)
+     700:	b8 02 00 00 00       	mov    $0x2,%eax
+     705:	cd 40                	int    $0x40
+     707:	c3                   	ret
+
+00000708 <wait>:
+SYSCALL(wait)
+     708:	b8 03 00 00 00       	mov    $0x3,%eax
+     70d:	cd 40                	int    $0x40
+     70f:	c3                   	ret
+
+00000710 <pipe>:
+SYSCALL(pipe)
+     710:	b8 04 00 00 00       	mov    $0x4,%eax
+     715:	cd 40                	int    $0x40
+     717:	c3                   	ret
+
+00000718 <_read>:
+RAWSYSCALL(read)
+     718:	b8 05 00 00 00       	mov    $0x5,%eax
+     71d:	cd 40                	int    $0x40
+     71f:	c3                   	ret
+
+00000720 <_write>:
+RAWSYSCALL(write)
+     720:	b8 10 00 00 00       	mov    $0x10,%eax
+     725:	cd 40                	int    $0x40
+     727:	c3                   	ret
+
+00000728 <_close>:
+RAWSYSCALL(close)
+     728:	b8 15 00 00 00       	mov    $0x15,%eax
+     72d:	cd 40                	int    $0x40
+     72f:	c3                   	ret
+
+00000730 <kill>:
+SYSCALL(kill)
+     730:	b8 06 00 00 00       	mov    $0x6,%eax
+     735:	cd 40                	int    $0x40
+     737:	c3                   	ret
+
+00000738 <_exec>:
+RAWSYSCALL(exec)
+     738:	b8 07 00 00 00       	mov    $0x7,%eax
+     73d:	cd 40                	int    $0x40
+     73f:	c3                   	ret
+
+00000740 <open>:
+SYSCALL(open)
+     740:	b8 0f 00 00 00       	mov    $0xf,%eax
+     745:	cd 40                	int    $0x40
+     747:	c3                   	ret
+
+00000748 <mknod>:
+SYSCALL(mknod)
+     748:	b8 11 00 00 00       	mov    $0x11,%eax
+     74d:	cd 40                	int    $0x40
+     74f:	c3                   	ret
+
+00000750 <unlink>:
+SYSCALL(unlink)
+     750:	b8 12 00 00 00       	mov    $0x12,%eax
+     755:	cd 40                	int    $0x40
+     757:	c3                   	ret
+
+00000758 <fstat>:
+SYSCALL(fstat)
+     758:	b8 08 00 00 00       	mov    $0x8,%eax
+     75d:	cd 40                	int    $0x40
+     75f:	c3                   	ret
+
+00000760 <link>:
+SYSCALL(link)
+     760:	b8 13 00 00 00       	mov    $0x13,%eax
+     765:	cd 40                	int    $0x40
+     767:	c3                   	ret
+
+00000768 <mkdir>:
+SYSCALL(mkdir)
+     768:	b8 14 00 00 00       	mov    $0x14,%eax
+     76d:	cd 40                	int    $0x40
+     76f:	c3                   	ret
+
+00000770 <chdir>:
+SYSCALL(chdir)
+     770:	b8 09 00 00 00       	mov    $0x9,%eax
+     775:	cd 40                	int    $0x40
+     777:	c3                   	ret
+
+00000778 <dup>:
+SYSCALL(dup)
+     778:	b8 0a 00 00 00       	mov    $0xa,%eax
+     77d:	cd 40                	int    $0x40
+     77f:	c3                   	ret
+
+00000780 <getpid>:
+SYSCALL(getpid)
+     780:	b8 0b 00 00 00       	mov    $0xb,%eax
+     785:	cd 40                	int    $0x40
+     787:	c3                   	ret
+
+00000788 <sbrk>:
+SYSCALL(sbrk)
+     788:	b8 0c 00 00 00       	mov    $0xc,%eax
+     78d:	cd 40                	int    $0x40
+     78f:	c3                   	ret
+
+00000790 <sleep>:
+SYSCALL(sleep)
+     790:	b8 0d 00 00 00       	mov    $0xd,%eax
+     795:	cd 40                	int    $0x40
+     797:	c3                   	ret
+
+00000798 <uptime>:
+SYSCALL(uptime)
+     798:	b8 0e 00 00 00       	mov    $0xe,%eax
+     79d:	cd 40                	int    $0x40
+     79f:	c3                   	ret
+
+000007a0 <wolfie>:
+SYSCALL(wolfie)
+     7a0:	b8 16 00 00 00       	mov    $0x16,%eax
+     7a5:	cd 40                	int    $0x40
+     7a7:	c3                   	ret
+
+000007a8 <nice>:
+SYSCALL(nice)
+     7a8:	b8 17 00 00 00       	mov    $0x17,%eax
+     7ad:	cd 40                	int    $0x40
+     7af:	c3                   	ret
+
+000007b0 <mtxget>:
+SYSCALL(mtxget)
+     7b0:	b8 18 00 00 00       	mov    $0x18,%eax
+     7b5:	cd 40                	int    $0x40
+     7b7:	c3                   	ret
+
+000007b8 <mtxrel>:
+SYSCALL(mtxrel)
+     7b8:	b8 19 00 00 00       	mov    $0x19,%eax
+     7bd:	cd 40                	int    $0x40
+     7bf:	c3                   	ret
+
+000007c0 <mtxacq>:
+SYSCALL(mtxacq)
+     7c0:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     7c5:	cd 40                	int    $0x40
+     7c7:	c3                   	ret
+
+000007c8 <mtxdel>:
+SYSCALL(mtxdel)
+     7c8:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     7cd:	cd 40                	int    $0x40
+     7cf:	c3                   	ret
+
+000007d0 <iostat>:
+SYSCALL(iostat)
+     7d0:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     7d5:	cd 40                	int    $0x40
+     7d7:	c3                   	ret
+
+000007d8 <mmap>:
+SYSCALL(mmap)
+     7d8:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     7dd:	cd 40                	int    $0x40
+     7df:	c3                   	ret
+
+000007e0 <munmap>:
+SYSCALL(munmap)
+     7e0:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     7e5:	cd 40                	int    $0x40
+     7e7:	c3                   	ret
+
+000007e8 <shmget>:
+SYSCALL(shmget)
+     7e8:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     7ed:	cd 40                	int    $0x40
+     7ef:	c3                   	ret
+
+000007f0 <shmat>:
+SYSCALL(shmat)
+     7f0:	b8 20 00 00 00       	mov    $0x20,%eax
+     7f5:	cd 40                	int    $0x40
+     7f7:	c3                   	ret
+
+000007f8 <shmdt>:
+SYSCALL(shmdt)
+     7f8:	b8 21 00 00 00       	mov    $0x21,%eax
+     7fd:	cd 40                	int    $0x40
+     7ff:	c3                   	ret
+
+00000800 <shmdel>:
+SYSCALL(shmdel)
+     800:	b8 22 00 00 00       	mov    $0x22,%eax
+     805:	cd 40                	int    $0x40
+     807:	c3                   	ret
+
+00000808 <syscount>:
+SYSCALL(syscount)
+     808:	b8 23 00 00 00       	mov    $0x23,%eax
+     80d:	cd 40                	int    $0x40
+     80f:	c3                   	ret
+
+00000810 <splice>:
+SYSCALL(splice)
+     810:	b8 24 00 00 00       	mov    $0x24,%eax
+     815:	cd 40                	int    $0x40
+     817:	c3                   	ret
+
+00000818 <tee>:
+SYSCALL(tee)
+     818:	b8 25 00 00 00       	mov    $0x25,%eax
+     81d:	cd 40                	int    $0x40
+     81f:	c3                   	ret
+
+00000820 <sendfile>:
+SYSCALL(sendfile)
+     820:	b8 26 00 00 00       	mov    $0x26,%eax
+     825:	cd 40                	int    $0x40
+     827:	c3                   	ret
+
+00000828 <_readv>:
+RAWSYSCALL(readv)
+     828:	b8 27 00 00 00       	mov    $0x27,%eax
+     82d:	cd 40                	int    $0x40
+     82f:	c3                   	ret
+
+00000830 <_writev>:
+RAWSYSCALL(writev)
+     830:	b8 28 00 00 00       	mov    $0x28,%eax
+     835:	cd 40                	int    $0x40
+     837:	c3                   	ret
+
+00000838 <futexwait>:
+SYSCALL(futexwait)
+     838:	b8 29 00 00 00       	mov    $0x29,%eax
+     83d:	cd 40                	int    $0x40
+     83f:	c3                   	ret
+
+00000840 <futexwake>:
+SYSCALL(futexwake)
+     840:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     845:	cd 40                	int    $0x40
+     847:	c3                   	ret
+
+00000848 <lockstat>:
+SYSCALL(lockstat)
+     848:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     84d:	cd 40                	int    $0x40
+     84f:	c3                   	ret
+
+00000850 <clone>:
+SYSCALL(clone)
+     850:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     855:	cd 40                	int    $0x40
+     857:	c3                   	ret
+
+00000858 <join>:
+SYSCALL(join)
+     858:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     85d:	cd 40                	int    $0x40
+     85f:	c3                   	ret
+
+00000860 <stacklimit>:
+SYSCALL(stacklimit)
+     860:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     865:	cd 40                	int    $0x40
+     867:	c3                   	ret
+     868:	66 90                	xchg   %ax,%ax
+     86a:	66 90                	xchg   %ax,%ax
+     86c:	66 90                	xchg   %ax,%ax
+     86e:	66 90                	xchg   %ax,%ax
+
+00000870 <flushall>:
+  b->n = 0;
+}
+
+static void
+flushall(void)
+{
+     870:	55                   	push   %ebp
+     871:	89 e5                	mov    %esp,%ebp
+     873:	83 ec 14             	sub    $0x14,%esp
+  umtxlock(&stdoutlock);
+     876:	68 44 24 00 00       	push   $0x2444
+     87b:	e8 00 fe ff ff       	call   680 <umtxlock>
+  if(b->n > 0)
+     880:	a1 08 20 00 00       	mov    0x2008,%eax
+     885:	83 c4 10             	add    $0x10,%esp
+     888:	85 c0                	test   %eax,%eax
+     88a:	7e 17                	jle    8a3 <flushall+0x33>
+    _write(b->fd, b->buf, b->n);
+     88c:	83 ec 04             	sub    $0x4,%esp
+     88f:	50                   	push   %eax
+     890:	68 0c 20 00 00       	push   $0x200c
+     895:	ff 35 00 20 00 00    	push   0x2000
+     89b:	e8 80 fe ff ff       	call   720 <_write>
+     8a0:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     8a3:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     8aa:	00 00 00 
+  flush(&stdout);
+  umtxunlock(&stdoutlock);
+     8ad:	83 ec 0c             	sub    $0xc,%esp
+     8b0:	68 44 24 00 00       	push   $0x2444
+     8b5:	e8 16 fe ff ff       	call   6d0 <umtxunlock>
+}
+     8ba:	83 c4 10             	add    $0x10,%esp
+     8bd:	c9                   	leave
+     8be:	c3                   	ret
+     8bf:	90                   	nop
+
+000008c0 <printint>:
+    flush(b);
+}
+
+static void
+printint(struct outbuf *b, int xx, int base, int sgn)
+{
+     8c0:	55                   	push   %ebp
+     8c1:	89 e5                	mov    %esp,%ebp
+     8c3:	57                   	push   %edi
+     8c4:	89 cf                	mov    %ecx,%edi
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     8c6:	89 d1                	mov    %edx,%ecx
+{
+     8c8:	56                   	push   %esi
+     8c9:	53                   	push   %ebx
+     8ca:	89 c3                	mov    %eax,%ebx
+     8cc:	83 ec 2c             	sub    $0x2c,%esp
+  if(sgn && xx < 0){
+     8cf:	85 d2                	test   %edx,%edx
+     8d1:	0f 89 b9 00 00 00    	jns    990 <printint+0xd0>
+     8d7:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     8db:	0f 84 af 00 00 00    	je     990 <printint+0xd0>
+    x = -xx;
+     8e1:	f7 d9                	neg    %ecx
+    neg = 1;
+     8e3:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     8e8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     8eb:	31 f6                	xor    %esi,%esi
+     8ed:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     8f0:	89 c8                	mov    %ecx,%eax
+     8f2:	31 d2                	xor    %edx,%edx
+     8f4:	89 f3                	mov    %esi,%ebx
+     8f6:	f7 f7                	div    %edi
+     8f8:	8d 76 01             	lea    0x1(%esi),%esi
+     8fb:	0f b6 92 54 15 00 00 	movzbl 0x1554(%edx),%edx
+     902:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     906:	89 ca                	mov    %ecx,%edx
+     908:	89 c1                	mov    %eax,%ecx
+     90a:	39 fa                	cmp    %edi,%edx
+     90c:	73 e2                	jae    8f0 <printint+0x30>
+  if(neg)
+     90e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     911:	89 d9                	mov    %ebx,%ecx
+     913:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     916:	85 c0                	test   %eax,%eax
+     918:	74 07                	je     921 <printint+0x61>
+    buf[i++] = '-';
+     91a:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     91f:	89 f1                	mov    %esi,%ecx
+     921:	8d 75 d8             	lea    -0x28(%ebp),%esi
+     924:	89 cf                	mov    %ecx,%edi
+     926:	01 f7                	add    %esi,%edi
+     928:	eb 1a                	jmp    944 <printint+0x84>
+     92a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    *b->str++ = c;
+     930:	8d 48 01             	lea    0x1(%eax),%ecx
+     933:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+     939:	88 10                	mov    %dl,(%eax)
+
+  while(--i >= 0)
+     93b:	8d 47 ff             	lea    -0x1(%edi),%eax
+     93e:	39 fe                	cmp    %edi,%esi
+     940:	74 40                	je     982 <printint+0xc2>
+     942:	89 c7                	mov    %eax,%edi
+  if(b->str){
+     944:	8b 83 0c 02 00 00    	mov    0x20c(%ebx),%eax
+    putc(b, buf[i]);
+     94a:	0f b6 17             	movzbl (%edi),%edx
+  if(b->str){
+     94d:	85 c0                	test   %eax,%eax
+     94f:	75 df                	jne    930 <printint+0x70>
+  b->buf[b->n++] = c;
+     951:	8b 4b 08             	mov    0x8(%ebx),%ecx
+     954:	8d 41 01             	lea    0x1(%ecx),%eax
+     957:	89 43 08             	mov    %eax,0x8(%ebx)
+     95a:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+     95e:	3d 00 02 00 00       	cmp    $0x200,%eax
+     963:	74 3b                	je     9a0 <printint+0xe0>
+     965:	80 fa 0a             	cmp    $0xa,%dl
+     968:	75 d1                	jne    93b <printint+0x7b>
+     96a:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+     96e:	75 cb                	jne    93b <printint+0x7b>
+  if(b->n > 0)
+     970:	85 c0                	test   %eax,%eax
+     972:	7f 2c                	jg     9a0 <printint+0xe0>
+  b->n = 0;
+     974:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  while(--i >= 0)
+     97b:	8d 47 ff             	lea    -0x1(%edi),%eax
+     97e:	39 fe                	cmp    %edi,%esi
+     980:	75 c0                	jne    942 <printint+0x82>
+}
+     982:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     985:	5b                   	pop    %ebx
+     986:	5e                   	pop    %esi
+     987:	5f                   	pop    %edi
+     988:	5d                   	pop    %ebp
+     989:	c3                   	ret
+     98a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  neg = 0;
+     990:	31 c0                	xor    %eax,%eax
+     992:	e9 51 ff ff ff       	jmp    8e8 <printint+0x28>
+     997:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     99e:	66 90                	xchg   %ax,%ax
+    _write(b->fd, b->buf, b->n);
+     9a0:	83 ec 04             	sub    $0x4,%esp
+     9a3:	50                   	push   %eax
+     9a4:	8d 43 0c             	lea    0xc(%ebx),%eax
+     9a7:	50                   	push   %eax
+     9a8:	ff 33                	push   (%ebx)
+     9aa:	e8 71 fd ff ff       	call   720 <_write>
+     9af:	83 c4 10             	add    $0x10,%esp
+     9b2:	eb c0                	jmp    974 <printint+0xb4>
+     9b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     9bf:	90                   	nop
+
+000009c0 <putc>:
+{
+     9c0:	55                   	push   %ebp
+     9c1:	89 e5                	mov    %esp,%ebp
+     9c3:	53                   	push   %ebx
+     9c4:	89 c3                	mov    %eax,%ebx
+     9c6:	83 ec 04             	sub    $0x4,%esp
+  if(b->str){
+     9c9:	8b 80 0c 02 00 00    	mov    0x20c(%eax),%eax
+     9cf:	85 c0                	test   %eax,%eax
+     9d1:	74 15                	je     9e8 <putc+0x28>
+    *b->str++ = c;
+     9d3:	8d 48 01             	lea    0x1(%eax),%ecx
+     9d6:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+     9dc:	88 10                	mov    %dl,(%eax)
+}
+     9de:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     9e1:	c9                   	leave
+     9e2:	c3                   	ret
+     9e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     9e7:	90                   	nop
+  b->buf[b->n++] = c;
+     9e8:	8b 4b 08             	mov    0x8(%ebx),%ecx
+     9eb:	8d 41 01             	lea    0x1(%ecx),%eax
+     9ee:	89 43 08             	mov    %eax,0x8(%ebx)
+     9f1:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+     9f5:	3d 00 02 00 00       	cmp    $0x200,%eax
+     9fa:	74 14                	je     a10 <putc+0x50>
+     9fc:	80 fa 0a             	cmp    $0xa,%dl
+     9ff:	75 dd                	jne    9de <putc+0x1e>
+     a01:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+     a05:	75 d7                	jne    9de <putc+0x1e>
+  if(b->n > 0)
+     a07:	85 c0                	test   %eax,%eax
+     a09:	7e 17                	jle    a22 <putc+0x62>
+     a0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     a0f:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     a10:	83 ec 04             	sub    $0x4,%esp
+     a13:	50                   	push   %eax
+     a14:	8d 43 0c             	lea    0xc(%ebx),%eax
+     a17:	50                   	push   %eax
+     a18:	ff 33                	push   (%ebx)
+     a1a:	e8 01 fd ff ff       	call   720 <_write>
+     a1f:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     a22:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+     a29:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     a2c:	c9                   	leave
+     a2d:	c3                   	ret
+     a2e:	66 90                	xchg   %ax,%ax
+
+00000a30 <format>:
+
+// Format fmt and the arguments at ap into b.
+// Only understands %d, %x, %p, %s, %c.
+static void
+format(struct outbuf *b, const char *fmt, uint *ap)
+{
+     a30:	55                   	push   %ebp
+     a31:	89 e5                	mov    %esp,%ebp
+     a33:	57                   	push   %edi
+     a34:	89 c7                	mov    %eax,%edi
+     a36:	56                   	push   %esi
+     a37:	53                   	push   %ebx
+     a38:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+     a3b:	0f b6 02             	movzbl (%edx),%eax
+{
+     a3e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  for(i = 0; fmt[i]; i++){
+     a41:	84 c0                	test   %al,%al
+     a43:	74 5a                	je     a9f <format+0x6f>
+     a45:	8d 5a 01             	lea    0x1(%edx),%ebx
+     a48:	31 f6                	xor    %esi,%esi
+     a4a:	eb 1c                	jmp    a68 <format+0x38>
+     a4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     a50:	83 f8 25             	cmp    $0x25,%eax
+     a53:	74 3b                	je     a90 <format+0x60>
+        state = '%';
+      } else {
+        putc(b, c);
+     a55:	89 ca                	mov    %ecx,%edx
+     a57:	89 f8                	mov    %edi,%eax
+     a59:	e8 62 ff ff ff       	call   9c0 <putc>
+  for(i = 0; fmt[i]; i++){
+     a5e:	0f b6 03             	movzbl (%ebx),%eax
+     a61:	83 c3 01             	add    $0x1,%ebx
+     a64:	84 c0                	test   %al,%al
+     a66:	74 37                	je     a9f <format+0x6f>
+    c = fmt[i] & 0xff;
+     a68:	0f be c8             	movsbl %al,%ecx
+     a6b:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     a6e:	85 f6                	test   %esi,%esi
+     a70:	74 de                	je     a50 <format+0x20>
+      }
+    } else if(state == '%'){
+     a72:	83 fe 25             	cmp    $0x25,%esi
+     a75:	75 e7                	jne    a5e <format+0x2e>
+      if(c == 'd'){
+     a77:	83 f8 25             	cmp    $0x25,%eax
+     a7a:	74 46                	je     ac2 <format+0x92>
+     a7c:	83 e8 63             	sub    $0x63,%eax
+     a7f:	83 f8 15             	cmp    $0x15,%eax
+     a82:	77 2c                	ja     ab0 <format+0x80>
+     a84:	ff 24 85 fc 14 00 00 	jmp    *0x14fc(,%eax,4)
+     a8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     a8f:	90                   	nop
+  for(i = 0; fmt[i]; i++){
+     a90:	0f b6 03             	movzbl (%ebx),%eax
+     a93:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+     a96:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+     a9b:	84 c0                	test   %al,%al
+     a9d:	75 c9                	jne    a68 <format+0x38>
+        putc(b, c);
+      }
+      state = 0;
+    }
+  }
+}
+     a9f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     aa2:	5b                   	pop    %ebx
+     aa3:	5e                   	pop    %esi
+     aa4:	5f                   	pop    %edi
+     aa5:	5d                   	pop    %ebp
+     aa6:	c3                   	ret
+     aa7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     aae:	66 90                	xchg   %ax,%ax
+        putc(b, '%');
+     ab0:	ba 25 00 00 00       	mov    $0x25,%edx
+     ab5:	89 f8                	mov    %edi,%eax
+     ab7:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     aba:	e8 01 ff ff ff       	call   9c0 <putc>
+        putc(b, c);
+     abf:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     ac2:	89 ca                	mov    %ecx,%edx
+     ac4:	89 f8                	mov    %edi,%eax
+      state = 0;
+     ac6:	31 f6                	xor    %esi,%esi
+        putc(b, c);
+     ac8:	e8 f3 fe ff ff       	call   9c0 <putc>
+     acd:	eb 8f                	jmp    a5e <format+0x2e>
+     acf:	90                   	nop
+        printint(b, *ap, 16, 0);
+     ad0:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     ad3:	83 ec 0c             	sub    $0xc,%esp
+     ad6:	b9 10 00 00 00       	mov    $0x10,%ecx
+     adb:	8b 16                	mov    (%esi),%edx
+     add:	6a 00                	push   $0x0
+        ap++;
+     adf:	83 c6 04             	add    $0x4,%esi
+        printint(b, *ap, 16, 0);
+     ae2:	89 f8                	mov    %edi,%eax
+     ae4:	e8 d7 fd ff ff       	call   8c0 <printint>
+        ap++;
+     ae9:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+     aec:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     aef:	31 f6                	xor    %esi,%esi
+     af1:	e9 68 ff ff ff       	jmp    a5e <format+0x2e>
+     af6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     afd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     b00:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     b03:	8b 30                	mov    (%eax),%esi
+        ap++;
+     b05:	83 c0 04             	add    $0x4,%eax
+     b08:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+     b0b:	85 f6                	test   %esi,%esi
+     b0d:	75 1b                	jne    b2a <format+0xfa>
+     b0f:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+     b14:	be f4 14 00 00       	mov    $0x14f4,%esi
+     b19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+          putc(b, *s);
+     b20:	89 f8                	mov    %edi,%eax
+          s++;
+     b22:	83 c6 01             	add    $0x1,%esi
+          putc(b, *s);
+     b25:	e8 96 fe ff ff       	call   9c0 <putc>
+        while(*s != 0){
+     b2a:	0f be 16             	movsbl (%esi),%edx
+     b2d:	84 d2                	test   %dl,%dl
+     b2f:	75 ef                	jne    b20 <format+0xf0>
+      state = 0;
+     b31:	31 f6                	xor    %esi,%esi
+     b33:	e9 26 ff ff ff       	jmp    a5e <format+0x2e>
+     b38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b3f:	90                   	nop
+        printint(b, *ap, 10, 1);
+     b40:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     b43:	83 ec 0c             	sub    $0xc,%esp
+     b46:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     b4b:	8b 16                	mov    (%esi),%edx
+     b4d:	6a 01                	push   $0x1
+     b4f:	eb 8e                	jmp    adf <format+0xaf>
+     b51:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(b, *ap);
+     b58:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     b5b:	89 f8                	mov    %edi,%eax
+     b5d:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+     b60:	83 c6 04             	add    $0x4,%esi
+        putc(b, *ap);
+     b63:	e8 58 fe ff ff       	call   9c0 <putc>
+        ap++;
+     b68:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      state = 0;
+     b6b:	31 f6                	xor    %esi,%esi
+     b6d:	e9 ec fe ff ff       	jmp    a5e <format+0x2e>
+     b72:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000b80 <fflush>:
+{
+     b80:	55                   	push   %ebp
+     b81:	89 e5                	mov    %esp,%ebp
+     b83:	83 ec 08             	sub    $0x8,%esp
+  if(fd == stdout.fd)
+     b86:	8b 45 08             	mov    0x8(%ebp),%eax
+     b89:	39 05 00 20 00 00    	cmp    %eax,0x2000
+     b8f:	74 07                	je     b98 <fflush+0x18>
+}
+     b91:	c9                   	leave
+     b92:	c3                   	ret
+     b93:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b97:	90                   	nop
+  umtxlock(&stdoutlock);
+     b98:	83 ec 0c             	sub    $0xc,%esp
+     b9b:	68 44 24 00 00       	push   $0x2444
+     ba0:	e8 db fa ff ff       	call   680 <umtxlock>
+  if(b->n > 0)
+     ba5:	a1 08 20 00 00       	mov    0x2008,%eax
+     baa:	83 c4 10             	add    $0x10,%esp
+     bad:	85 c0                	test   %eax,%eax
+     baf:	7f 1f                	jg     bd0 <fflush+0x50>
+  b->n = 0;
+     bb1:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     bb8:	00 00 00 
+  umtxunlock(&stdoutlock);
+     bbb:	c7 45 08 44 24 00 00 	movl   $0x2444,0x8(%ebp)
+}
+     bc2:	c9                   	leave
+  umtxunlock(&stdoutlock);
+     bc3:	e9 08 fb ff ff       	jmp    6d0 <umtxunlock>
+     bc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bcf:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     bd0:	83 ec 04             	sub    $0x4,%esp
+     bd3:	50                   	push   %eax
+     bd4:	68 0c 20 00 00       	push   $0x200c
+     bd9:	ff 35 00 20 00 00    	push   0x2000
+     bdf:	e8 3c fb ff ff       	call   720 <_write>
+     be4:	83 c4 10             	add    $0x10,%esp
+     be7:	eb c8                	jmp    bb1 <fflush+0x31>
+     be9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000bf0 <setvbuf>:
+{
+     bf0:	55                   	push   %ebp
+     bf1:	89 e5                	mov    %esp,%ebp
+     bf3:	53                   	push   %ebx
+     bf4:	83 ec 04             	sub    $0x4,%esp
+     bf7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd != stdout.fd)
+     bfa:	8b 45 08             	mov    0x8(%ebp),%eax
+     bfd:	39 05 00 20 00 00    	cmp    %eax,0x2000
+     c03:	74 0b                	je     c10 <setvbuf+0x20>
+}
+     c05:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     c08:	c9                   	leave
+     c09:	c3                   	ret
+     c0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  umtxlock(&stdoutlock);
+     c10:	83 ec 0c             	sub    $0xc,%esp
+     c13:	68 44 24 00 00       	push   $0x2444
+     c18:	e8 63 fa ff ff       	call   680 <umtxlock>
+  if(b->n > 0)
+     c1d:	a1 08 20 00 00       	mov    0x2008,%eax
+     c22:	83 c4 10             	add    $0x10,%esp
+     c25:	85 c0                	test   %eax,%eax
+     c27:	7f 2f                	jg     c58 <setvbuf+0x68>
+  b->n = 0;
+     c29:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     c30:	00 00 00 
+  stdout.mode = mode;
+     c33:	89 1d 04 20 00 00    	mov    %ebx,0x2004
+  flushhook = flushall;
+     c39:	c7 05 40 24 00 00 70 	movl   $0x870,0x2440
+     c40:	08 00 00 
+}
+     c43:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&stdoutlock);
+     c46:	c7 45 08 44 24 00 00 	movl   $0x2444,0x8(%ebp)
+}
+     c4d:	c9                   	leave
+  umtxunlock(&stdoutlock);
+     c4e:	e9 7d fa ff ff       	jmp    6d0 <umtxunlock>
+     c53:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c57:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+     c58:	83 ec 04             	sub    $0x4,%esp
+     c5b:	50                   	push   %eax
+     c5c:	68 0c 20 00 00       	push   $0x200c
+     c61:	ff 35 00 20 00 00    	push   0x2000
+     c67:	e8 b4 fa ff ff       	call   720 <_write>
+     c6c:	83 c4 10             	add    $0x10,%esp
+     c6f:	eb b8                	jmp    c29 <setvbuf+0x39>
+     c71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c7f:	90                   	nop
+
+00000c80 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s, %c.
+void
+printf(int fd, const char *fmt, ...)
+{
+     c80:	55                   	push   %ebp
+     c81:	89 e5                	mov    %esp,%ebp
+     c83:	53                   	push   %ebx
+     c84:	81 ec 14 02 00 00    	sub    $0x214,%esp
+     c8a:	8b 45 08             	mov    0x8(%ebp),%eax
+    local.mode = _IONBF;
+    local.n = 0;
+    local.str = 0;
+    b = &local;
+  }
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     c8d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd == stdout.fd){
+     c90:	39 05 00 20 00 00    	cmp    %eax,0x2000
+     c96:	74 48                	je     ce0 <printf+0x60>
+    local.fd = fd;
+     c98:	89 85 e8 fd ff ff    	mov    %eax,-0x218(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     c9e:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     ca1:	89 da                	mov    %ebx,%edx
+     ca3:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+    local.mode = _IONBF;
+     ca9:	c7 85 ec fd ff ff 03 	movl   $0x3,-0x214(%ebp)
+     cb0:	00 00 00 
+    local.n = 0;
+     cb3:	c7 85 f0 fd ff ff 00 	movl   $0x0,-0x210(%ebp)
+     cba:	00 00 00 
+    local.str = 0;
+     cbd:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     cc4:	e8 67 fd ff ff       	call   a30 <format>
+  if(b->mode == _IONBF)
+     cc9:	83 bd ec fd ff ff 03 	cmpl   $0x3,-0x214(%ebp)
+     cd0:	0f 84 a2 00 00 00    	je     d78 <printf+0xf8>
+    flush(b);
+  if(b == &stdout)
+    umtxunlock(&stdoutlock);
+}
+     cd6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     cd9:	c9                   	leave
+     cda:	c3                   	ret
+     cdb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     cdf:	90                   	nop
+    umtxlock(&stdoutlock);
+     ce0:	83 ec 0c             	sub    $0xc,%esp
+     ce3:	68 44 24 00 00       	push   $0x2444
+     ce8:	e8 93 f9 ff ff       	call   680 <umtxlock>
+  if(stdout.mode == 0){
+     ced:	a1 04 20 00 00       	mov    0x2004,%eax
+     cf2:	83 c4 10             	add    $0x10,%esp
+     cf5:	85 c0                	test   %eax,%eax
+     cf7:	74 37                	je     d30 <printf+0xb0>
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+     cf9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     cfc:	89 da                	mov    %ebx,%edx
+     cfe:	b8 00 20 00 00       	mov    $0x2000,%eax
+     d03:	e8 28 fd ff ff       	call   a30 <format>
+  if(b->mode == _IONBF)
+     d08:	83 3d 04 20 00 00 03 	cmpl   $0x3,0x2004
+     d0f:	0f 84 ab 00 00 00    	je     dc0 <printf+0x140>
+    umtxunlock(&stdoutlock);
+     d15:	83 ec 0c             	sub    $0xc,%esp
+     d18:	68 44 24 00 00       	push   $0x2444
+     d1d:	e8 ae f9 ff ff       	call   6d0 <umtxunlock>
+}
+     d22:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    umtxunlock(&stdoutlock);
+     d25:	83 c4 10             	add    $0x10,%esp
+}
+     d28:	c9                   	leave
+     d29:	c3                   	ret
+     d2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+     d30:	83 ec 08             	sub    $0x8,%esp
+     d33:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+     d39:	50                   	push   %eax
+     d3a:	ff 35 00 20 00 00    	push   0x2000
+     d40:	e8 13 fa ff ff       	call   758 <fstat>
+     d45:	83 c4 10             	add    $0x10,%esp
+     d48:	89 c2                	mov    %eax,%edx
+      stdout.mode = _IOFBF;
+     d4a:	b8 01 00 00 00       	mov    $0x1,%eax
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+     d4f:	85 d2                	test   %edx,%edx
+     d51:	75 10                	jne    d63 <printf+0xe3>
+      stdout.mode = _IOLBF;
+     d53:	31 c0                	xor    %eax,%eax
+     d55:	66 83 bd e8 fd ff ff 	cmpw   $0x3,-0x218(%ebp)
+     d5c:	03 
+     d5d:	0f 94 c0             	sete   %al
+     d60:	83 c0 01             	add    $0x1,%eax
+     d63:	a3 04 20 00 00       	mov    %eax,0x2004
+    flushhook = flushall;
+     d68:	c7 05 40 24 00 00 70 	movl   $0x870,0x2440
+     d6f:	08 00 00 
+     d72:	eb 85                	jmp    cf9 <printf+0x79>
+     d74:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(b->n > 0)
+     d78:	8b 85 f0 fd ff ff    	mov    -0x210(%ebp),%eax
+     d7e:	85 c0                	test   %eax,%eax
+     d80:	0f 8e 50 ff ff ff    	jle    cd6 <printf+0x56>
+    b = &local;
+     d86:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+    _write(b->fd, b->buf, b->n);
+     d8c:	83 ec 04             	sub    $0x4,%esp
+     d8f:	50                   	push   %eax
+     d90:	8d 43 0c             	lea    0xc(%ebx),%eax
+     d93:	50                   	push   %eax
+     d94:	ff 33                	push   (%ebx)
+     d96:	e8 85 f9 ff ff       	call   720 <_write>
+  b->n = 0;
+     d9b:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  if(b == &stdout)
+     da2:	83 c4 10             	add    $0x10,%esp
+     da5:	81 fb 00 20 00 00    	cmp    $0x2000,%ebx
+     dab:	0f 85 25 ff ff ff    	jne    cd6 <printf+0x56>
+     db1:	e9 5f ff ff ff       	jmp    d15 <printf+0x95>
+     db6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dbd:	8d 76 00             	lea    0x0(%esi),%esi
+  if(b->n > 0)
+     dc0:	a1 08 20 00 00       	mov    0x2008,%eax
+    b = getstdout();
+     dc5:	bb 00 20 00 00       	mov    $0x2000,%ebx
+  if(b->n > 0)
+     dca:	85 c0                	test   %eax,%eax
+     dcc:	7f be                	jg     d8c <printf+0x10c>
+  b->n = 0;
+     dce:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+     dd5:	00 00 00 
+  if(b == &stdout)
+     dd8:	e9 38 ff ff ff       	jmp    d15 <printf+0x95>
+     ddd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000de0 <sprintf>:
+
+// Print to the given buffer. Only understands %d, %x, %p, %s, %c.
+int
+sprintf(char *str, const char *fmt, ...)
+{
+     de0:	55                   	push   %ebp
+     de1:	89 e5                	mov    %esp,%ebp
+     de3:	53                   	push   %ebx
+  struct outbuf b;
+
+  b.str = str;
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+     de4:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+     dea:	8d 4d 10             	lea    0x10(%ebp),%ecx
+{
+     ded:	81 ec 14 02 00 00    	sub    $0x214,%esp
+     df3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+     df6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  b.str = str;
+     df9:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+     dfc:	e8 2f fc ff ff       	call   a30 <format>
+  *b.str = '\0';
+     e01:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e04:	c6 00 00             	movb   $0x0,(%eax)
+  return b.str - str;
+     e07:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e0a:	29 d8                	sub    %ebx,%eax
+}
+     e0c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     e0f:	c9                   	leave
+     e10:	c3                   	ret
+     e11:	66 90                	xchg   %ax,%ax
+     e13:	66 90                	xchg   %ax,%ax
+     e15:	66 90                	xchg   %ax,%ax
+     e17:	66 90                	xchg   %ax,%ax
+     e19:	66 90                	xchg   %ax,%ax
+     e1b:	66 90                	xchg   %ax,%ax
+     e1d:	66 90                	xchg   %ax,%ax
+     e1f:	90                   	nop
+
+00000e20 <freeblock>:
+static Header *freep;
+static struct umutex lock;  // threads made by clone() share the heap
+
+static void
+freeblock(void *ap)
+{
+     e20:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+     e21:	8d 48 f8             	lea    -0x8(%eax),%ecx
+{
+     e24:	89 e5                	mov    %esp,%ebp
+     e26:	57                   	push   %edi
+     e27:	56                   	push   %esi
+     e28:	53                   	push   %ebx
+     e29:	89 c3                	mov    %eax,%ebx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     e2b:	a1 4c 24 00 00       	mov    0x244c,%eax
+     e30:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     e32:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     e34:	39 ca                	cmp    %ecx,%edx
+     e36:	73 30                	jae    e68 <freeblock+0x48>
+     e38:	39 c1                	cmp    %eax,%ecx
+     e3a:	72 04                	jb     e40 <freeblock+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     e3c:	39 c2                	cmp    %eax,%edx
+     e3e:	72 f0                	jb     e30 <freeblock+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     e40:	8b 73 fc             	mov    -0x4(%ebx),%esi
+     e43:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+     e46:	39 f8                	cmp    %edi,%eax
+     e48:	74 26                	je     e70 <freeblock+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+     e4a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+     e4d:	8b 42 04             	mov    0x4(%edx),%eax
+     e50:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     e53:	39 f1                	cmp    %esi,%ecx
+     e55:	74 30                	je     e87 <freeblock+0x67>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+     e57:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+     e59:	5b                   	pop    %ebx
+  freep = p;
+     e5a:	89 15 4c 24 00 00    	mov    %edx,0x244c
+}
+     e60:	5e                   	pop    %esi
+     e61:	5f                   	pop    %edi
+     e62:	5d                   	pop    %ebp
+     e63:	c3                   	ret
+     e64:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     e68:	39 c1                	cmp    %eax,%ecx
+     e6a:	72 d0                	jb     e3c <freeblock+0x1c>
+     e6c:	eb c2                	jmp    e30 <freeblock+0x10>
+     e6e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+     e70:	03 70 04             	add    0x4(%eax),%esi
+     e73:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     e76:	8b 02                	mov    (%edx),%eax
+     e78:	8b 00                	mov    (%eax),%eax
+     e7a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+     e7d:	8b 42 04             	mov    0x4(%edx),%eax
+     e80:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     e83:	39 f1                	cmp    %esi,%ecx
+     e85:	75 d0                	jne    e57 <freeblock+0x37>
+    p->s.size += bp->s.size;
+     e87:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+     e8a:	89 15 4c 24 00 00    	mov    %edx,0x244c
+    p->s.size += bp->s.size;
+     e90:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+     e93:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+     e96:	89 0a                	mov    %ecx,(%edx)
+}
+     e98:	5b                   	pop    %ebx
+     e99:	5e                   	pop    %esi
+     e9a:	5f                   	pop    %edi
+     e9b:	5d                   	pop    %ebp
+     e9c:	c3                   	ret
+     e9d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ea0 <free>:
+
+void
+free(void *ap)
+{
+     ea0:	55                   	push   %ebp
+     ea1:	89 e5                	mov    %esp,%ebp
+     ea3:	53                   	push   %ebx
+     ea4:	83 ec 10             	sub    $0x10,%esp
+     ea7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  umtxlock(&lock);
+     eaa:	68 48 24 00 00       	push   $0x2448
+     eaf:	e8 cc f7 ff ff       	call   680 <umtxlock>
+  freeblock(ap);
+     eb4:	89 d8                	mov    %ebx,%eax
+     eb6:	e8 65 ff ff ff       	call   e20 <freeblock>
+  umtxunlock(&lock);
+     ebb:	c7 45 08 48 24 00 00 	movl   $0x2448,0x8(%ebp)
+}
+     ec2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&lock);
+     ec5:	83 c4 10             	add    $0x10,%esp
+}
+     ec8:	c9                   	leave
+  umtxunlock(&lock);
+     ec9:	e9 02 f8 ff ff       	jmp    6d0 <umtxunlock>
+     ece:	66 90                	xchg   %ax,%ax
+
+00000ed0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+     ed0:	55                   	push   %ebp
+     ed1:	89 e5                	mov    %esp,%ebp
+     ed3:	57                   	push   %edi
+     ed4:	56                   	push   %esi
+     ed5:	53                   	push   %ebx
+     ed6:	83 ec 28             	sub    $0x28,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     ed9:	8b 45 08             	mov    0x8(%ebp),%eax
+  umtxlock(&lock);
+     edc:	68 48 24 00 00       	push   $0x2448
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     ee1:	8d 48 07             	lea    0x7(%eax),%ecx
+     ee4:	c1 e9 03             	shr    $0x3,%ecx
+     ee7:	8d 71 01             	lea    0x1(%ecx),%esi
+  umtxlock(&lock);
+     eea:	e8 91 f7 ff ff       	call   680 <umtxlock>
+  if((prevp = freep) == 0){
+     eef:	8b 15 4c 24 00 00    	mov    0x244c,%edx
+     ef5:	83 c4 10             	add    $0x10,%esp
+     ef8:	85 d2                	test   %edx,%edx
+     efa:	0f 84 b0 00 00 00    	je     fb0 <malloc+0xe0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     f00:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+     f02:	8b 47 04             	mov    0x4(%edi),%eax
+     f05:	39 f0                	cmp    %esi,%eax
+     f07:	73 6f                	jae    f78 <malloc+0xa8>
+  if(nu < 4096)
+     f09:	bb 00 10 00 00       	mov    $0x1000,%ebx
+     f0e:	39 de                	cmp    %ebx,%esi
+     f10:	0f 43 de             	cmovae %esi,%ebx
+  p = sbrk(nu * sizeof(Header));
+     f13:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+     f1a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     f1d:	eb 0a                	jmp    f29 <malloc+0x59>
+     f1f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     f20:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+     f22:	8b 47 04             	mov    0x4(%edi),%eax
+     f25:	39 f0                	cmp    %esi,%eax
+     f27:	73 4f                	jae    f78 <malloc+0xa8>
+      }
+      freep = prevp;
+      umtxunlock(&lock);
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+     f29:	89 fa                	mov    %edi,%edx
+     f2b:	39 3d 4c 24 00 00    	cmp    %edi,0x244c
+     f31:	75 ed                	jne    f20 <malloc+0x50>
+  p = sbrk(nu * sizeof(Header));
+     f33:	83 ec 0c             	sub    $0xc,%esp
+     f36:	ff 75 e4             	push   -0x1c(%ebp)
+     f39:	e8 4a f8 ff ff       	call   788 <sbrk>
+  if(p == (char*)-1)
+     f3e:	83 c4 10             	add    $0x10,%esp
+     f41:	83 f8 ff             	cmp    $0xffffffff,%eax
+     f44:	74 15                	je     f5b <malloc+0x8b>
+  hp->s.size = nu;
+     f46:	89 58 04             	mov    %ebx,0x4(%eax)
+  freeblock((void*)(hp + 1));
+     f49:	83 c0 08             	add    $0x8,%eax
+     f4c:	e8 cf fe ff ff       	call   e20 <freeblock>
+  return freep;
+     f51:	8b 15 4c 24 00 00    	mov    0x244c,%edx
+      if((p = morecore(nunits)) == 0){
+     f57:	85 d2                	test   %edx,%edx
+     f59:	75 c5                	jne    f20 <malloc+0x50>
+        umtxunlock(&lock);
+     f5b:	83 ec 0c             	sub    $0xc,%esp
+     f5e:	68 48 24 00 00       	push   $0x2448
+     f63:	e8 68 f7 ff ff       	call   6d0 <umtxunlock>
+        return 0;
+     f68:	83 c4 10             	add    $0x10,%esp
+      }
+  }
+}
+     f6b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+     f6e:	31 c0                	xor    %eax,%eax
+}
+     f70:	5b                   	pop    %ebx
+     f71:	5e                   	pop    %esi
+     f72:	5f                   	pop    %edi
+     f73:	5d                   	pop    %ebp
+     f74:	c3                   	ret
+     f75:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+     f78:	39 c6                	cmp    %eax,%esi
+     f7a:	74 64                	je     fe0 <malloc+0x110>
+        p->s.size -= nunits;
+     f7c:	29 f0                	sub    %esi,%eax
+     f7e:	89 47 04             	mov    %eax,0x4(%edi)
+        p += p->s.size;
+     f81:	8d 3c c7             	lea    (%edi,%eax,8),%edi
+        p->s.size = nunits;
+     f84:	89 77 04             	mov    %esi,0x4(%edi)
+      umtxunlock(&lock);
+     f87:	83 ec 0c             	sub    $0xc,%esp
+      freep = prevp;
+     f8a:	89 15 4c 24 00 00    	mov    %edx,0x244c
+      umtxunlock(&lock);
+     f90:	68 48 24 00 00       	push   $0x2448
+     f95:	e8 36 f7 ff ff       	call   6d0 <umtxunlock>
+      return (void*)(p + 1);
+     f9a:	83 c4 10             	add    $0x10,%esp
+}
+     f9d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+     fa0:	8d 47 08             	lea    0x8(%edi),%eax
+}
+     fa3:	5b                   	pop    %ebx
+     fa4:	5e                   	pop    %esi
+     fa5:	5f                   	pop    %edi
+     fa6:	5d                   	pop    %ebp
+     fa7:	c3                   	ret
+     fa8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     faf:	90                   	nop
+    base.s.ptr = freep = prevp = &base;
+     fb0:	c7 05 4c 24 00 00 50 	movl   $0x2450,0x244c
+     fb7:	24 00 00 
+    base.s.size = 0;
+     fba:	bf 50 24 00 00       	mov    $0x2450,%edi
+    base.s.ptr = freep = prevp = &base;
+     fbf:	c7 05 50 24 00 00 50 	movl   $0x2450,0x2450
+     fc6:	24 00 00 
+    base.s.size = 0;
+     fc9:	c7 05 54 24 00 00 00 	movl   $0x0,0x2454
+     fd0:	00 00 00 
+    if(p->s.size >= nunits){
+     fd3:	e9 31 ff ff ff       	jmp    f09 <malloc+0x39>
+     fd8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fdf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+     fe0:	8b 07                	mov    (%edi),%eax
+     fe2:	89 02                	mov    %eax,(%edx)
+     fe4:	eb a1                	jmp    f87 <malloc+0xb7>
+     fe6:	66 90                	xchg   %ax,%ax
+     fe8:	66 90                	xchg   %ax,%ax
+     fea:	66 90                	xchg   %ax,%ax
+     fec:	66 90                	xchg   %ax,%ax
+     fee:	66 90                	xchg   %ax,%ax
+
+00000ff0 <threadstart>:
+
+#define TSTACKSZ 4096
+
+static void
+threadstart(void *fn, void *arg)
+{
+     ff0:	55                   	push   %ebp
+     ff1:	89 e5                	mov    %esp,%ebp
+     ff3:	83 ec 14             	sub    $0x14,%esp
+  ((void (*)(void*))fn)(arg);
+     ff6:	ff 75 0c             	push   0xc(%ebp)
+     ff9:	ff 55 08             	call   *0x8(%ebp)
+  exit();
+     ffc:	e8 ef f4 ff ff       	call   4f0 <exit>
+    1001:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1008:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    100f:	90                   	nop
+
+00001010 <thread_create>:
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    1010:	55                   	push   %ebp
+    1011:	89 e5                	mov    %esp,%ebp
+    1013:	53                   	push   %ebx
+    1014:	83 ec 20             	sub    $0x20,%esp
+  char *mem, *stack;
+  int pid;
+
+  if((mem = malloc(2*TSTACKSZ)) == 0)
+    1017:	68 00 20 00 00       	push   $0x2000
+    101c:	e8 af fe ff ff       	call   ed0 <malloc>
+    1021:	83 c4 10             	add    $0x10,%esp
+    1024:	85 c0                	test   %eax,%eax
+    1026:	74 47                	je     106f <thread_create+0x5f>
+    1028:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)(((uint)mem + TSTACKSZ - 1) & ~(TSTACKSZ - 1));
+    102a:	8d 80 ff 0f 00 00    	lea    0xfff(%eax),%eax
+    1030:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  *(char**)stack = mem;
+    1035:	89 18                	mov    %ebx,(%eax)
+  if((pid = clone(threadstart, (void*)fn, arg, stack)) < 0)
+    1037:	50                   	push   %eax
+    1038:	ff 75 0c             	push   0xc(%ebp)
+    103b:	ff 75 08             	push   0x8(%ebp)
+    103e:	68 f0 0f 00 00       	push   $0xff0
+    1043:	e8 08 f8 ff ff       	call   850 <clone>
+    1048:	83 c4 10             	add    $0x10,%esp
+    104b:	85 c0                	test   %eax,%eax
+    104d:	78 09                	js     1058 <thread_create+0x48>
+    free(mem);
+  return pid;
+}
+    104f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1052:	c9                   	leave
+    1053:	c3                   	ret
+    1054:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    free(mem);
+    1058:	83 ec 0c             	sub    $0xc,%esp
+    105b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    105e:	53                   	push   %ebx
+    105f:	e8 3c fe ff ff       	call   ea0 <free>
+    1064:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    1067:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+    106a:	83 c4 10             	add    $0x10,%esp
+}
+    106d:	c9                   	leave
+    106e:	c3                   	ret
+    return -1;
+    106f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1074:	eb d9                	jmp    104f <thread_create+0x3f>
+    1076:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    107d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001080 <thread_join>:
+
+int
+thread_join(void)
+{
+    1080:	55                   	push   %ebp
+    1081:	89 e5                	mov    %esp,%ebp
+    1083:	83 ec 34             	sub    $0x34,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    1086:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    1089:	50                   	push   %eax
+    108a:	e8 c9 f7 ff ff       	call   858 <join>
+    108f:	83 c4 10             	add    $0x10,%esp
+    1092:	85 c0                	test   %eax,%eax
+    1094:	79 0a                	jns    10a0 <thread_join+0x20>
+    free(*(char**)stack);
+  return pid;
+}
+    1096:	c9                   	leave
+    1097:	c3                   	ret
+    1098:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    109f:	90                   	nop
+    free(*(char**)stack);
+    10a0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    10a3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    10a6:	83 ec 0c             	sub    $0xc,%esp
+    10a9:	ff 32                	push   (%edx)
+    10ab:	e8 f0 fd ff ff       	call   ea0 <free>
+    10b0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    10b3:	83 c4 10             	add    $0x10,%esp
+}
+    10b6:	c9                   	leave
+    10b7:	c3                   	ret
@@ -0,0 +1,2238 @@
+
+_zerobench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return lo;
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+  int i;
+
+  oldbrk = sbrk(0);
+  sleep(50);
+  half[0] = half[1] = 0;
+  for(i = 0; i < 2*POOL; i += STEP){
+   e:	31 ff                	xor    %edi,%edi
+{
+  10:	56                   	push   %esi
+  11:	53                   	push   %ebx
+  12:	51                   	push   %ecx
+  13:	83 ec 24             	sub    $0x24,%esp
+  oldbrk = sbrk(0);
+  16:	6a 00                	push   $0x0
+  18:	e8 2b 06 00 00       	call   648 <sbrk>
+  sleep(50);
+  1d:	c7 04 24 32 00 00 00 	movl   $0x32,(%esp)
+  oldbrk = sbrk(0);
+  24:	89 c6                	mov    %eax,%esi
+  sleep(50);
+  26:	e8 25 06 00 00       	call   650 <sleep>
+  half[0] = half[1] = 0;
+  2b:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  32:	83 c4 10             	add    $0x10,%esp
+  35:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  for(i = 0; i < 2*POOL; i += STEP){
+  3c:	eb 29                	jmp    67 <main+0x67>
+  3e:	66 90                	xchg   %ax,%ax
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+  40:	0f 31                	rdtsc
+    c0 = cycles();
+    if(sbrk(STEP) == (char*)-1){
+      printf(1, "zerobench: sbrk failed\n");
+      exit();
+    }
+    half[i >= POOL] += cycles() - c0;
+  42:	31 c9                	xor    %ecx,%ecx
+  44:	81 ff ff ff 3f 00    	cmp    $0x3fffff,%edi
+  4a:	0f 9f c1             	setg   %cl
+  for(i = 0; i < 2*POOL; i += STEP){
+  4d:	81 c7 00 00 01 00    	add    $0x10000,%edi
+    half[i >= POOL] += cycles() - c0;
+  53:	8b 54 8d e0          	mov    -0x20(%ebp,%ecx,4),%edx
+  57:	29 da                	sub    %ebx,%edx
+  59:	01 c2                	add    %eax,%edx
+  5b:	89 54 8d e0          	mov    %edx,-0x20(%ebp,%ecx,4)
+  for(i = 0; i < 2*POOL; i += STEP){
+  5f:	81 ff 00 00 80 00    	cmp    $0x800000,%edi
+  65:	74 2d                	je     94 <main+0x94>
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+  67:	0f 31                	rdtsc
+    if(sbrk(STEP) == (char*)-1){
+  69:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+  6c:	89 c3                	mov    %eax,%ebx
+    if(sbrk(STEP) == (char*)-1){
+  6e:	68 00 00 01 00       	push   $0x10000
+  73:	e8 d0 05 00 00       	call   648 <sbrk>
+  78:	83 c4 10             	add    $0x10,%esp
+  7b:	83 f8 ff             	cmp    $0xffffffff,%eax
+  7e:	75 c0                	jne    40 <main+0x40>
+      printf(1, "zerobench: sbrk failed\n");
+  80:	83 ec 08             	sub    $0x8,%esp
+  83:	68 78 0f 00 00       	push   $0xf78
+  88:	6a 01                	push   $0x1
+  8a:	e8 b1 0a 00 00       	call   b40 <printf>
+      exit();
+  8f:	e8 1c 03 00 00       	call   3b0 <exit>
+  }
+  printf(1, "zerobench: first %d KB: %d cycles per page\n",
+  94:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  97:	c1 e8 0a             	shr    $0xa,%eax
+  9a:	50                   	push   %eax
+  9b:	68 00 10 00 00       	push   $0x1000
+  a0:	68 90 0f 00 00       	push   $0xf90
+  a5:	6a 01                	push   $0x1
+  a7:	e8 94 0a 00 00       	call   b40 <printf>
+         POOL/1024, half[0] / (POOL/4096));
+  printf(1, "zerobench: next %d KB: %d cycles per page\n",
+  ac:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  af:	c1 e8 0a             	shr    $0xa,%eax
+  b2:	50                   	push   %eax
+  b3:	68 00 10 00 00       	push   $0x1000
+  b8:	68 bc 0f 00 00       	push   $0xfbc
+  bd:	6a 01                	push   $0x1
+  bf:	e8 7c 0a 00 00       	call   b40 <printf>
+         POOL/1024, half[1] / (POOL/4096));
+  sbrk(oldbrk - sbrk(0));
+  c4:	83 c4 14             	add    $0x14,%esp
+  c7:	6a 00                	push   $0x0
+  c9:	e8 7a 05 00 00       	call   648 <sbrk>
+  ce:	29 c6                	sub    %eax,%esi
+  d0:	89 34 24             	mov    %esi,(%esp)
+  d3:	e8 70 05 00 00       	call   648 <sbrk>
+  exit();
+  d8:	e8 d3 02 00 00       	call   3b0 <exit>
+  dd:	66 90                	xchg   %ax,%ax
+  df:	90                   	nop
+
+000000e0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  e0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  e1:	31 c0                	xor    %eax,%eax
+{
+  e3:	89 e5                	mov    %esp,%ebp
+  e5:	53                   	push   %ebx
+  e6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  e9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  f0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  f4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  f7:	83 c0 01             	add    $0x1,%eax
+  fa:	84 d2                	test   %dl,%dl
+  fc:	75 f2                	jne    f0 <strcpy+0x10>
+    ;
+  return os;
+}
+  fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 101:	89 c8                	mov    %ecx,%eax
+ 103:	c9                   	leave
+ 104:	c3                   	ret
+ 105:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 10c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000110 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 110:	55                   	push   %ebp
+ 111:	89 e5                	mov    %esp,%ebp
+ 113:	53                   	push   %ebx
+ 114:	8b 55 08             	mov    0x8(%ebp),%edx
+ 117:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 11a:	0f b6 02             	movzbl (%edx),%eax
+ 11d:	84 c0                	test   %al,%al
+ 11f:	75 17                	jne    138 <strcmp+0x28>
+ 121:	eb 3a                	jmp    15d <strcmp+0x4d>
+ 123:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 127:	90                   	nop
+ 128:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 12c:	83 c2 01             	add    $0x1,%edx
+ 12f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 132:	84 c0                	test   %al,%al
+ 134:	74 1a                	je     150 <strcmp+0x40>
+    p++, q++;
+ 136:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 138:	0f b6 19             	movzbl (%ecx),%ebx
+ 13b:	38 c3                	cmp    %al,%bl
+ 13d:	74 e9                	je     128 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 13f:	29 d8                	sub    %ebx,%eax
+}
+ 141:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 144:	c9                   	leave
+ 145:	c3                   	ret
+ 146:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 150:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 154:	31 c0                	xor    %eax,%eax
+ 156:	29 d8                	sub    %ebx,%eax
+}
+ 158:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 15b:	c9                   	leave
+ 15c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 15d:	0f b6 19             	movzbl (%ecx),%ebx
+ 160:	31 c0                	xor    %eax,%eax
+ 162:	eb db                	jmp    13f <strcmp+0x2f>
+ 164:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 16b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 16f:	90                   	nop
+
+00000170 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 170:	55                   	push   %ebp
+ 171:	89 e5                	mov    %esp,%ebp
+ 173:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 176:	80 3a 00             	cmpb   $0x0,(%edx)
+ 179:	74 15                	je     190 <strlen+0x20>
+ 17b:	31 c0                	xor    %eax,%eax
+ 17d:	8d 76 00             	lea    0x0(%esi),%esi
+ 180:	83 c0 01             	add    $0x1,%eax
+ 183:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 187:	89 c1                	mov    %eax,%ecx
+ 189:	75 f5                	jne    180 <strlen+0x10>
+    ;
+  return n;
+}
+ 18b:	89 c8                	mov    %ecx,%eax
+ 18d:	5d                   	pop    %ebp
+ 18e:	c3                   	ret
+ 18f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 190:	31 c9                	xor    %ecx,%ecx
+}
+ 192:	5d                   	pop    %ebp
+ 193:	89 c8                	mov    %ecx,%eax
+ 195:	c3                   	ret
+ 196:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 19d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001a0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	57                   	push   %edi
+ 1a4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1a7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1aa:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1ad:	89 d7                	mov    %edx,%edi
+ 1af:	fc                   	cld
+ 1b0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1b2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1b5:	89 d0                	mov    %edx,%eax
+ 1b7:	c9                   	leave
+ 1b8:	c3                   	ret
+ 1b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001c0 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+ 1c0:	55                   	push   %ebp
+ 1c1:	89 e5                	mov    %esp,%ebp
+ 1c3:	56                   	push   %esi
+ 1c4:	53                   	push   %ebx
+ 1c5:	8b 75 10             	mov    0x10(%ebp),%esi
+ 1c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1cb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+ 1ce:	85 f6                	test   %esi,%esi
+ 1d0:	74 2e                	je     200 <memcmp+0x40>
+ 1d2:	01 c6                	add    %eax,%esi
+ 1d4:	eb 14                	jmp    1ea <memcmp+0x2a>
+ 1d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1dd:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+ 1e0:	83 c0 01             	add    $0x1,%eax
+ 1e3:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+ 1e6:	39 f0                	cmp    %esi,%eax
+ 1e8:	74 16                	je     200 <memcmp+0x40>
+    if(*s1 != *s2)
+ 1ea:	0f b6 0a             	movzbl (%edx),%ecx
+ 1ed:	0f b6 18             	movzbl (%eax),%ebx
+ 1f0:	38 d9                	cmp    %bl,%cl
+ 1f2:	74 ec                	je     1e0 <memcmp+0x20>
+      return *s1 - *s2;
+ 1f4:	0f b6 c1             	movzbl %cl,%eax
+ 1f7:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+ 1f9:	5b                   	pop    %ebx
+ 1fa:	5e                   	pop    %esi
+ 1fb:	5d                   	pop    %ebp
+ 1fc:	c3                   	ret
+ 1fd:	8d 76 00             	lea    0x0(%esi),%esi
+ 200:	5b                   	pop    %ebx
+  return 0;
+ 201:	31 c0                	xor    %eax,%eax
+}
+ 203:	5e                   	pop    %esi
+ 204:	5d                   	pop    %ebp
+ 205:	c3                   	ret
+ 206:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000210 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+ 213:	8b 45 08             	mov    0x8(%ebp),%eax
+ 216:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 21a:	0f b6 10             	movzbl (%eax),%edx
+ 21d:	84 d2                	test   %dl,%dl
+ 21f:	75 12                	jne    233 <strchr+0x23>
+ 221:	eb 1d                	jmp    240 <strchr+0x30>
+ 223:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 227:	90                   	nop
+ 228:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 22c:	83 c0 01             	add    $0x1,%eax
+ 22f:	84 d2                	test   %dl,%dl
+ 231:	74 0d                	je     240 <strchr+0x30>
+    if(*s == c)
+ 233:	38 d1                	cmp    %dl,%cl
+ 235:	75 f1                	jne    228 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 237:	5d                   	pop    %ebp
+ 238:	c3                   	ret
+ 239:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 240:	31 c0                	xor    %eax,%eax
+}
+ 242:	5d                   	pop    %ebp
+ 243:	c3                   	ret
+ 244:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 24f:	90                   	nop
+
+00000250 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	57                   	push   %edi
+ 254:	56                   	push   %esi
+int
+read(int fd, void *buf, int n)
+{
+  if(flushhook)
+    flushhook();
+  return _read(fd, buf, n);
+ 255:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 258:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 259:	31 db                	xor    %ebx,%ebx
+{
+ 25b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 25e:	eb 32                	jmp    292 <gets+0x42>
+  if(flushhook)
+ 260:	a1 10 22 00 00       	mov    0x2210,%eax
+ 265:	85 c0                	test   %eax,%eax
+ 267:	74 02                	je     26b <gets+0x1b>
+    flushhook();
+ 269:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+ 26b:	83 ec 04             	sub    $0x4,%esp
+ 26e:	6a 01                	push   $0x1
+ 270:	56                   	push   %esi
+ 271:	6a 00                	push   $0x0
+ 273:	e8 60 03 00 00       	call   5d8 <_read>
+    if(cc < 1)
+ 278:	83 c4 10             	add    $0x10,%esp
+ 27b:	85 c0                	test   %eax,%eax
+ 27d:	7e 1d                	jle    29c <gets+0x4c>
+    buf[i++] = c;
+ 27f:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 283:	8b 55 08             	mov    0x8(%ebp),%edx
+ 286:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 28a:	3c 0a                	cmp    $0xa,%al
+ 28c:	74 10                	je     29e <gets+0x4e>
+ 28e:	3c 0d                	cmp    $0xd,%al
+ 290:	74 0c                	je     29e <gets+0x4e>
+  for(i=0; i+1 < max; ){
+ 292:	89 df                	mov    %ebx,%edi
+ 294:	83 c3 01             	add    $0x1,%ebx
+ 297:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 29a:	7c c4                	jl     260 <gets+0x10>
+ 29c:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+ 29e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2a1:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+ 2a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2a8:	5b                   	pop    %ebx
+ 2a9:	5e                   	pop    %esi
+ 2aa:	5f                   	pop    %edi
+ 2ab:	5d                   	pop    %ebp
+ 2ac:	c3                   	ret
+ 2ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002b0 <stat>:
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	56                   	push   %esi
+ 2b4:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+ 2b5:	83 ec 08             	sub    $0x8,%esp
+ 2b8:	6a 00                	push   $0x0
+ 2ba:	ff 75 08             	push   0x8(%ebp)
+ 2bd:	e8 3e 03 00 00       	call   600 <open>
+  if(fd < 0)
+ 2c2:	83 c4 10             	add    $0x10,%esp
+ 2c5:	85 c0                	test   %eax,%eax
+ 2c7:	78 37                	js     300 <stat+0x50>
+  r = fstat(fd, st);
+ 2c9:	83 ec 08             	sub    $0x8,%esp
+ 2cc:	ff 75 0c             	push   0xc(%ebp)
+ 2cf:	89 c3                	mov    %eax,%ebx
+ 2d1:	50                   	push   %eax
+ 2d2:	e8 41 03 00 00       	call   618 <fstat>
+}
+
+int
+close(int fd)
+{
+  if(flushhook)
+ 2d7:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+ 2da:	89 c6                	mov    %eax,%esi
+  if(flushhook)
+ 2dc:	a1 10 22 00 00       	mov    0x2210,%eax
+ 2e1:	85 c0                	test   %eax,%eax
+ 2e3:	74 02                	je     2e7 <stat+0x37>
+    flushhook();
+ 2e5:	ff d0                	call   *%eax
+  return _close(fd);
+ 2e7:	83 ec 0c             	sub    $0xc,%esp
+ 2ea:	53                   	push   %ebx
+ 2eb:	e8 f8 02 00 00       	call   5e8 <_close>
+ 2f0:	83 c4 10             	add    $0x10,%esp
+}
+ 2f3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2f6:	89 f0                	mov    %esi,%eax
+ 2f8:	5b                   	pop    %ebx
+ 2f9:	5e                   	pop    %esi
+ 2fa:	5d                   	pop    %ebp
+ 2fb:	c3                   	ret
+ 2fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+ 300:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 305:	eb ec                	jmp    2f3 <stat+0x43>
+ 307:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30e:	66 90                	xchg   %ax,%ax
+
+00000310 <atoi>:
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	53                   	push   %ebx
+ 314:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+ 317:	0f be 02             	movsbl (%edx),%eax
+ 31a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 31d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 320:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 325:	77 1e                	ja     345 <atoi+0x35>
+ 327:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 32e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 330:	83 c2 01             	add    $0x1,%edx
+ 333:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 336:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 33a:	0f be 02             	movsbl (%edx),%eax
+ 33d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 340:	80 fb 09             	cmp    $0x9,%bl
+ 343:	76 eb                	jbe    330 <atoi+0x20>
+}
+ 345:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 348:	89 c8                	mov    %ecx,%eax
+ 34a:	c9                   	leave
+ 34b:	c3                   	ret
+ 34c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000350 <memmove>:
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	57                   	push   %edi
+ 354:	56                   	push   %esi
+ 355:	8b 45 10             	mov    0x10(%ebp),%eax
+ 358:	8b 55 08             	mov    0x8(%ebp),%edx
+ 35b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+ 35e:	85 c0                	test   %eax,%eax
+ 360:	7e 13                	jle    375 <memmove+0x25>
+ 362:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 364:	89 d7                	mov    %edx,%edi
+ 366:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 370:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 371:	39 f8                	cmp    %edi,%eax
+ 373:	75 fb                	jne    370 <memmove+0x20>
+}
+ 375:	5e                   	pop    %esi
+ 376:	89 d0                	mov    %edx,%eax
+ 378:	5f                   	pop    %edi
+ 379:	5d                   	pop    %ebp
+ 37a:	c3                   	ret
+ 37b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 37f:	90                   	nop
+
+00000380 <fork>:
+  if(flushhook)
+ 380:	a1 10 22 00 00       	mov    0x2210,%eax
+ 385:	85 c0                	test   %eax,%eax
+ 387:	74 17                	je     3a0 <fork+0x20>
+{
+ 389:	55                   	push   %ebp
+ 38a:	89 e5                	mov    %esp,%ebp
+ 38c:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+ 38f:	ff d0                	call   *%eax
+}
+ 391:	c9                   	leave
+  return _fork();
+ 392:	e9 21 02 00 00       	jmp    5b8 <_fork>
+ 397:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39e:	66 90                	xchg   %ax,%ax
+ 3a0:	e9 13 02 00 00       	jmp    5b8 <_fork>
+ 3a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003b0 <exit>:
+{
+ 3b0:	55                   	push   %ebp
+ 3b1:	89 e5                	mov    %esp,%ebp
+ 3b3:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+ 3b6:	a1 10 22 00 00       	mov    0x2210,%eax
+ 3bb:	85 c0                	test   %eax,%eax
+ 3bd:	74 02                	je     3c1 <exit+0x11>
+    flushhook();
+ 3bf:	ff d0                	call   *%eax
+  _exit();
+ 3c1:	e8 fa 01 00 00       	call   5c0 <_exit>
+ 3c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003d0 <exec>:
+{
+ 3d0:	55                   	push   %ebp
+  if(flushhook)
+ 3d1:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+ 3d6:	89 e5                	mov    %esp,%ebp
+ 3d8:	56                   	push   %esi
+ 3d9:	53                   	push   %ebx
+ 3da:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 3dd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+ 3e0:	85 c0                	test   %eax,%eax
+ 3e2:	74 02                	je     3e6 <exec+0x16>
+    flushhook();
+ 3e4:	ff d0                	call   *%eax
+  return _exec(path, argv);
+ 3e6:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 3e9:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 3ec:	5b                   	pop    %ebx
+ 3ed:	5e                   	pop    %esi
+ 3ee:	5d                   	pop    %ebp
+  return _exec(path, argv);
+ 3ef:	e9 04 02 00 00       	jmp    5f8 <_exec>
+ 3f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3ff:	90                   	nop
+
+00000400 <read>:
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	57                   	push   %edi
+ 404:	56                   	push   %esi
+ 405:	53                   	push   %ebx
+ 406:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+ 409:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+ 40e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 411:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 414:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+ 417:	85 c0                	test   %eax,%eax
+ 419:	74 02                	je     41d <read+0x1d>
+    flushhook();
+ 41b:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+ 41d:	89 7d 10             	mov    %edi,0x10(%ebp)
+ 420:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 423:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 426:	83 c4 0c             	add    $0xc,%esp
+ 429:	5b                   	pop    %ebx
+ 42a:	5e                   	pop    %esi
+ 42b:	5f                   	pop    %edi
+ 42c:	5d                   	pop    %ebp
+  return _read(fd, buf, n);
+ 42d:	e9 a6 01 00 00       	jmp    5d8 <_read>
+ 432:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 439:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000440 <readv>:
+{
+ 440:	55                   	push   %ebp
+ 441:	89 e5                	mov    %esp,%ebp
+ 443:	57                   	push   %edi
+ 444:	56                   	push   %esi
+ 445:	53                   	push   %ebx
+ 446:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+ 449:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+ 44e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 451:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 454:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+ 457:	85 c0                	test   %eax,%eax
+ 459:	74 02                	je     45d <readv+0x1d>
+    flushhook();
+ 45b:	ff d0                	call   *%eax
+  return _readv(fd, iov, cnt);
+ 45d:	89 7d 10             	mov    %edi,0x10(%ebp)
+ 460:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 463:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 466:	83 c4 0c             	add    $0xc,%esp
+ 469:	5b                   	pop    %ebx
+ 46a:	5e                   	pop    %esi
+ 46b:	5f                   	pop    %edi
+ 46c:	5d                   	pop    %ebp
+  return _readv(fd, iov, cnt);
+ 46d:	e9 76 02 00 00       	jmp    6e8 <_readv>
+ 472:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 479:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000480 <write>:
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	57                   	push   %edi
+ 484:	56                   	push   %esi
+ 485:	53                   	push   %ebx
+ 486:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+ 489:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+ 48e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 491:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 494:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+ 497:	85 c0                	test   %eax,%eax
+ 499:	74 02                	je     49d <write+0x1d>
+    flushhook();
+ 49b:	ff d0                	call   *%eax
+  return _write(fd, buf, n);
+ 49d:	89 7d 10             	mov    %edi,0x10(%ebp)
+ 4a0:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 4a3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 4a6:	83 c4 0c             	add    $0xc,%esp
+ 4a9:	5b                   	pop    %ebx
+ 4aa:	5e                   	pop    %esi
+ 4ab:	5f                   	pop    %edi
+ 4ac:	5d                   	pop    %ebp
+  return _write(fd, buf, n);
+ 4ad:	e9 2e 01 00 00       	jmp    5e0 <_write>
+ 4b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004c0 <writev>:
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	57                   	push   %edi
+ 4c4:	56                   	push   %esi
+ 4c5:	53                   	push   %ebx
+ 4c6:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+ 4c9:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+ 4ce:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 4d1:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 4d4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+ 4d7:	85 c0                	test   %eax,%eax
+ 4d9:	74 02                	je     4dd <writev+0x1d>
+    flushhook();
+ 4db:	ff d0                	call   *%eax
+  return _writev(fd, iov, cnt);
+ 4dd:	89 7d 10             	mov    %edi,0x10(%ebp)
+ 4e0:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 4e3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 4e6:	83 c4 0c             	add    $0xc,%esp
+ 4e9:	5b                   	pop    %ebx
+ 4ea:	5e                   	pop    %esi
+ 4eb:	5f                   	pop    %edi
+ 4ec:	5d                   	pop    %ebp
+  return _writev(fd, iov, cnt);
+ 4ed:	e9 fe 01 00 00       	jmp    6f0 <_writev>
+ 4f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000500 <close>:
+{
+ 500:	55                   	push   %ebp
+ 501:	89 e5                	mov    %esp,%ebp
+ 503:	53                   	push   %ebx
+ 504:	83 ec 04             	sub    $0x4,%esp
+  if(flushhook)
+ 507:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+ 50c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(flushhook)
+ 50f:	85 c0                	test   %eax,%eax
+ 511:	74 02                	je     515 <close+0x15>
+    flushhook();
+ 513:	ff d0                	call   *%eax
+  return _close(fd);
+ 515:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 518:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 51b:	c9                   	leave
+  return _close(fd);
+ 51c:	e9 c7 00 00 00       	jmp    5e8 <_close>
+ 521:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 528:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 52f:	90                   	nop
+
+00000530 <umtxinit>:
+// process that finds the mutex held enters the kernel, to sleep
+// in futexwait() until the holder's umtxunlock() wakes it.
+
+void
+umtxinit(struct umutex *m)
+{
+ 530:	55                   	push   %ebp
+ 531:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 533:	8b 45 08             	mov    0x8(%ebp),%eax
+ 536:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 53c:	5d                   	pop    %ebp
+ 53d:	c3                   	ret
+ 53e:	66 90                	xchg   %ax,%ax
+
+00000540 <umtxlock>:
+
+void
+umtxlock(struct umutex *m)
+{
+ 540:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 541:	b8 01 00 00 00       	mov    $0x1,%eax
+ 546:	89 e5                	mov    %esp,%ebp
+ 548:	56                   	push   %esi
+ 549:	53                   	push   %ebx
+ 54a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 54d:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 1) == 0)
+ 550:	85 c0                	test   %eax,%eax
+ 552:	74 2b                	je     57f <umtxlock+0x3f>
+ 554:	b8 02 00 00 00       	mov    $0x2,%eax
+ 559:	f0 87 03             	lock xchg %eax,(%ebx)
+    return;
+  // Mark the mutex contended, so that its holder
+  // wakes a waiter on release, and wait.
+  while(xchg(&m->state, 2) != 0)
+ 55c:	85 c0                	test   %eax,%eax
+ 55e:	74 1f                	je     57f <umtxlock+0x3f>
+ 560:	be 02 00 00 00       	mov    $0x2,%esi
+ 565:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwait(&m->state, 2);
+ 568:	83 ec 08             	sub    $0x8,%esp
+ 56b:	6a 02                	push   $0x2
+ 56d:	53                   	push   %ebx
+ 56e:	e8 85 01 00 00       	call   6f8 <futexwait>
+ 573:	89 f0                	mov    %esi,%eax
+ 575:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+ 578:	83 c4 10             	add    $0x10,%esp
+ 57b:	85 c0                	test   %eax,%eax
+ 57d:	75 e9                	jne    568 <umtxlock+0x28>
+}
+ 57f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 582:	5b                   	pop    %ebx
+ 583:	5e                   	pop    %esi
+ 584:	5d                   	pop    %ebp
+ 585:	c3                   	ret
+ 586:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 58d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000590 <umtxunlock>:
+
+void
+umtxunlock(struct umutex *m)
+{
+ 590:	55                   	push   %ebp
+ 591:	31 c0                	xor    %eax,%eax
+ 593:	89 e5                	mov    %esp,%ebp
+ 595:	83 ec 08             	sub    $0x8,%esp
+ 598:	8b 55 08             	mov    0x8(%ebp),%edx
+ 59b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 59e:	83 f8 02             	cmp    $0x2,%eax
+ 5a1:	74 05                	je     5a8 <umtxunlock+0x18>
+    futexwake(&m->state, 1);
+}
+ 5a3:	c9                   	leave
+ 5a4:	c3                   	ret
+ 5a5:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwake(&m->state, 1);
+ 5a8:	83 ec 08             	sub    $0x8,%esp
+ 5ab:	6a 01                	push   $0x1
+ 5ad:	52                   	push   %edx
+ 5ae:	e8 4d 01 00 00       	call   700 <futexwake>
+ 5b3:	83 c4 10             	add    $0x10,%esp
+}
+ 5b6:	c9                   	leave
+ 5b7:	c3                   	ret
+
+000005b8 <_fork>:
+  _ ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+ 5b8:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5bd:	cd 40                	int    $0x40
+ 5bf:	c3                   	ret
+
+000005c0 <_exit>:
+RAWSYSCALL(exit)
+ 5c0:	b8 02 00 00 00       	mov    $0x2,%eax
+ 5c5:	cd 40                	int    $0x40
+ 5c7:	c3                   	ret
+
+000005c8 <wait>:
+SYSCALL(wait)
+ 5c8:	b8 03 00 00 00       	mov    $0x3,%eax
+ 5cd:	cd 40                	int    $0x40
+ 5cf:	c3                   	ret
+
+000005d0 <pipe>:
+SYSCALL(pipe)
+ 5d0:	b8 04 00 00 00       	mov    $0x4,%eax
+ 5d5:	cd 40                	int    $0x40
+ 5d7:	c3                   	ret
+
+000005d8 <_read>:
+RAWSYSCALL(read)
+ 5d8:	b8 05 00 00 00       	mov    $0x5,%eax
+ 5dd:	cd 40                	int    $0x40
+ 5df:	c3                   	ret
+
+000005e0 <_write>:
+RAWSYSCALL(write)
+ 5e0:	b8 10 00 00 00       	mov    $0x10,%eax
+ 5e5:	cd 40                	int    $0x40
+ 5e7:	c3                   	ret
+
+000005e8 <_close>:
+RAWSYSCALL(close)
+ 5e8:	b8 15 00 00 00       	mov    $0x15,%eax
+ 5ed:	cd 40                	int    $0x40
+ 5ef:	c3                   	ret
+
+000005f0 <kill>:
+SYSCALL(kill)
+ 5f0:	b8 06 00 00 00       	mov    $0x6,%eax
+ 5f5:	cd 40                	int    $0x40
+ 5f7:	c3                   	ret
+
+000005f8 <_exec>:
+RAWSYSCALL(exec)
+ 5f8:	b8 07 00 00 00       	mov    $0x7,%eax
+ 5fd:	cd 40                	int    $0x40
+ 5ff:	c3                   	ret
+
+00000600 <open>:
+SYSCALL(open)
+ 600:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 605:	cd 40                	int    $0x40
+ 607:	c3                   	ret
+
+00000608 <mknod>:
+SYSCALL(mknod)
+ 608:	b8 11 00 00 00       	mov    $0x11,%eax
+ 60d:	cd 40                	int    $0x40
+ 60f:	c3                   	ret
+
+00000610 <unlink>:
+SYSCALL(unlink)
+ 610:	b8 12 00 00 00       	mov    $0x12,%eax
+ 615:	cd 40                	int    $0x40
+ 617:	c3                   	ret
+
+00000618 <fstat>:
+SYSCALL(fstat)
+ 618:	b8 08 00 00 00       	mov    $0x8,%eax
+ 61d:	cd 40                	int    $0x40
+ 61f:	c3                   	ret
+
+00000620 <link>:
+SYSCALL(link)
+ 620:	b8 13 00 00 00       	mov    $0x13,%eax
+ 625:	cd 40                	int    $0x40
+ 627:	c3                   	ret
+
+00000628 <mkdir>:
+SYSCALL(mkdir)
+ 628:	b8 14 00 00 00       	mov    $0x14,%eax
+ 62d:	cd 40                	int    $0x40
+ 62f:	c3                   	ret
+
+00000630 <chdir>:
+SYSCALL(chdir)
+ 630:	b8 09 00 00 00       	mov    $0x9,%eax
+ 635:	cd 40                	int    $0x40
+ 637:	c3                   	ret
+
+00000638 <dup>:
+SYSCALL(dup)
+ 638:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 63d:	cd 40                	int    $0x40
+ 63f:	c3                   	ret
+
+00000640 <getpid>:
+SYSCALL(getpid)
+ 640:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 645:	cd 40                	int    $0x40
+ 647:	c3                   	ret
+
+00000648 <sbrk>:
+SYSCALL(sbrk)
+ 648:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 64d:	cd 40                	int    $0x40
+ 64f:	c3                   	ret
+
+00000650 <sleep>:
+SYSCALL(sleep)
+ 650:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 655:	cd 40                	int    $0x40
+ 657:	c3                   	ret
+
+00000658 <uptime>:
+SYSCALL(uptime)
+ 658:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 65d:	cd 40                	int    $0x40
+ 65f:	c3                   	ret
+
+00000660 <wolfie>:
+SYSCALL(wolfie)
+ 660:	b8 16 00 00 00       	mov    $0x16,%eax
+ 665:	cd 40                	int    $0x40
+ 667:	c3                   	ret
+
+00000668 <nice>:
+SYSCALL(nice)
+ 668:	b8 17 00 00 00       	mov    $0x17,%eax
+ 66d:	cd 40                	int    $0x40
+ 66f:	c3                   	ret
+
+00000670 <mtxget>:
+SYSCALL(mtxget)
+ 670:	b8 18 00 00 00       	mov    $0x18,%eax
+ 675:	cd 40                	int    $0x40
+ 677:	c3                   	ret
+
+00000678 <mtxrel>:
+SYSCALL(mtxrel)
+ 678:	b8 19 00 00 00       	mov    $0x19,%eax
+ 67d:	cd 40                	int    $0x40
+ 67f:	c3                   	ret
+
+00000680 <mtxacq>:
+SYSCALL(mtxacq)
+ 680:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 685:	cd 40                	int    $0x40
+ 687:	c3                   	ret
+
+00000688 <mtxdel>:
+SYSCALL(mtxdel)
+ 688:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 68d:	cd 40                	int    $0x40
+ 68f:	c3                   	ret
+
+00000690 <iostat>:
+SYSCALL(iostat)
+ 690:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 695:	cd 40                	int    $0x40
+ 697:	c3                   	ret
+
+00000698 <mmap>:
+SYSCALL(mmap)
+ 698:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 69d:	cd 40                	int    $0x40
+ 69f:	c3                   	ret
+
+000006a0 <munmap>:
+SYSCALL(munmap)
+ 6a0:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 6a5:	cd 40                	int    $0x40
+ 6a7:	c3                   	ret
+
+000006a8 <shmget>:
+SYSCALL(shmget)
+ 6a8:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 6ad:	cd 40                	int    $0x40
+ 6af:	c3                   	ret
+
+000006b0 <shmat>:
+SYSCALL(shmat)
+ 6b0:	b8 20 00 00 00       	mov    $0x20,%eax
+ 6b5:	cd 40                	int    $0x40
+ 6b7:	c3                   	ret
+
+000006b8 <shmdt>:
+SYSCALL(shmdt)
+ 6b8:	b8 21 00 00 00       	mov    $0x21,%eax
+ 6bd:	cd 40                	int    $0x40
+ 6bf:	c3                   	ret
+
+000006c0 <shmdel>:
+SYSCALL(shmdel)
+ 6c0:	b8 22 00 00 00       	mov    $0x22,%eax
+ 6c5:	cd 40                	int    $0x40
+ 6c7:	c3                   	ret
+
+000006c8 <syscount>:
+SYSCALL(syscount)
+ 6c8:	b8 23 00 00 00       	mov    $0x23,%eax
+ 6cd:	cd 40                	int    $0x40
+ 6cf:	c3                   	ret
+
+000006d0 <splice>:
+SYSCALL(splice)
+ 6d0:	b8 24 00 00 00       	mov    $0x24,%eax
+ 6d5:	cd 40                	int    $0x40
+ 6d7:	c3                   	ret
+
+000006d8 <tee>:
+SYSCALL(tee)
+ 6d8:	b8 25 00 00 00       	mov    $0x25,%eax
+ 6dd:	cd 40                	int    $0x40
+ 6df:	c3                   	ret
+
+000006e0 <sendfile>:
+SYSCALL(sendfile)
+ 6e0:	b8 26 00 00 00       	mov    $0x26,%eax
+ 6e5:	cd 40                	int    $0x40
+ 6e7:	c3                   	ret
+
+000006e8 <_readv>:
+RAWSYSCALL(readv)
+ 6e8:	b8 27 00 00 00       	mov    $0x27,%eax
+ 6ed:	cd 40                	int    $0x40
+ 6ef:	c3                   	ret
+
+000006f0 <_writev>:
+RAWSYSCALL(writev)
+ 6f0:	b8 28 00 00 00       	mov    $0x28,%eax
+ 6f5:	cd 40                	int    $0x40
+ 6f7:	c3                   	ret
+
+000006f8 <futexwait>:
+SYSCALL(futexwait)
+ 6f8:	b8 29 00 00 00       	mov    $0x29,%eax
+ 6fd:	cd 40                	int    $0x40
+ 6ff:	c3                   	ret
+
+00000700 <futexwake>:
+SYSCALL(futexwake)
+ 700:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 705:	cd 40                	int    $0x40
+ 707:	c3                   	ret
+
+00000708 <lockstat>:
+SYSCALL(lockstat)
+ 708:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 70d:	cd 40                	int    $0x40
+ 70f:	c3                   	ret
+
+00000710 <clone>:
+SYSCALL(clone)
+ 710:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 715:	cd 40                	int    $0x40
+ 717:	c3                   	ret
+
+00000718 <join>:
+SYSCALL(join)
+ 718:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 71d:	cd 40                	int    $0x40
+ 71f:	c3                   	ret
+
+00000720 <stacklimit>:
+SYSCALL(stacklimit)
+ 720:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 725:	cd 40                	int    $0x40
+ 727:	c3                   	ret
+ 728:	66 90                	xchg   %ax,%ax
+ 72a:	66 90                	xchg   %ax,%ax
+ 72c:	66 90                	xchg   %ax,%ax
+ 72e:	66 90                	xchg   %ax,%ax
+
+00000730 <flushall>:
+  b->n = 0;
+}
+
+static void
+flushall(void)
+{
+ 730:	55                   	push   %ebp
+ 731:	89 e5                	mov    %esp,%ebp
+ 733:	83 ec 14             	sub    $0x14,%esp
+  umtxlock(&stdoutlock);
+ 736:	68 14 22 00 00       	push   $0x2214
+ 73b:	e8 00 fe ff ff       	call   540 <umtxlock>
+  if(b->n > 0)
+ 740:	a1 08 20 00 00       	mov    0x2008,%eax
+ 745:	83 c4 10             	add    $0x10,%esp
+ 748:	85 c0                	test   %eax,%eax
+ 74a:	7e 17                	jle    763 <flushall+0x33>
+    _write(b->fd, b->buf, b->n);
+ 74c:	83 ec 04             	sub    $0x4,%esp
+ 74f:	50                   	push   %eax
+ 750:	68 0c 20 00 00       	push   $0x200c
+ 755:	ff 35 00 20 00 00    	push   0x2000
+ 75b:	e8 80 fe ff ff       	call   5e0 <_write>
+ 760:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+ 763:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+ 76a:	00 00 00 
+  flush(&stdout);
+  umtxunlock(&stdoutlock);
+ 76d:	83 ec 0c             	sub    $0xc,%esp
+ 770:	68 14 22 00 00       	push   $0x2214
+ 775:	e8 16 fe ff ff       	call   590 <umtxunlock>
+}
+ 77a:	83 c4 10             	add    $0x10,%esp
+ 77d:	c9                   	leave
+ 77e:	c3                   	ret
+ 77f:	90                   	nop
+
+00000780 <printint>:
+    flush(b);
+}
+
+static void
+printint(struct outbuf *b, int xx, int base, int sgn)
+{
+ 780:	55                   	push   %ebp
+ 781:	89 e5                	mov    %esp,%ebp
+ 783:	57                   	push   %edi
+ 784:	89 cf                	mov    %ecx,%edi
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 786:	89 d1                	mov    %edx,%ecx
+{
+ 788:	56                   	push   %esi
+ 789:	53                   	push   %ebx
+ 78a:	89 c3                	mov    %eax,%ebx
+ 78c:	83 ec 2c             	sub    $0x2c,%esp
+  if(sgn && xx < 0){
+ 78f:	85 d2                	test   %edx,%edx
+ 791:	0f 89 b9 00 00 00    	jns    850 <printint+0xd0>
+ 797:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 79b:	0f 84 af 00 00 00    	je     850 <printint+0xd0>
+    x = -xx;
+ 7a1:	f7 d9                	neg    %ecx
+    neg = 1;
+ 7a3:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 7a8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 7ab:	31 f6                	xor    %esi,%esi
+ 7ad:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 7b0:	89 c8                	mov    %ecx,%eax
+ 7b2:	31 d2                	xor    %edx,%edx
+ 7b4:	89 f3                	mov    %esi,%ebx
+ 7b6:	f7 f7                	div    %edi
+ 7b8:	8d 76 01             	lea    0x1(%esi),%esi
+ 7bb:	0f b6 92 f8 13 00 00 	movzbl 0x13f8(%edx),%edx
+ 7c2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 7c6:	89 ca                	mov    %ecx,%edx
+ 7c8:	89 c1                	mov    %eax,%ecx
+ 7ca:	39 fa                	cmp    %edi,%edx
+ 7cc:	73 e2                	jae    7b0 <printint+0x30>
+  if(neg)
+ 7ce:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 7d1:	89 d9                	mov    %ebx,%ecx
+ 7d3:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 7d6:	85 c0                	test   %eax,%eax
+ 7d8:	74 07                	je     7e1 <printint+0x61>
+    buf[i++] = '-';
+ 7da:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 7df:	89 f1                	mov    %esi,%ecx
+ 7e1:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 7e4:	89 cf                	mov    %ecx,%edi
+ 7e6:	01 f7                	add    %esi,%edi
+ 7e8:	eb 1a                	jmp    804 <printint+0x84>
+ 7ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    *b->str++ = c;
+ 7f0:	8d 48 01             	lea    0x1(%eax),%ecx
+ 7f3:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+ 7f9:	88 10                	mov    %dl,(%eax)
+
+  while(--i >= 0)
+ 7fb:	8d 47 ff             	lea    -0x1(%edi),%eax
+ 7fe:	39 fe                	cmp    %edi,%esi
+ 800:	74 40                	je     842 <printint+0xc2>
+ 802:	89 c7                	mov    %eax,%edi
+  if(b->str){
+ 804:	8b 83 0c 02 00 00    	mov    0x20c(%ebx),%eax
+    putc(b, buf[i]);
+ 80a:	0f b6 17             	movzbl (%edi),%edx
+  if(b->str){
+ 80d:	85 c0                	test   %eax,%eax
+ 80f:	75 df                	jne    7f0 <printint+0x70>
+  b->buf[b->n++] = c;
+ 811:	8b 4b 08             	mov    0x8(%ebx),%ecx
+ 814:	8d 41 01             	lea    0x1(%ecx),%eax
+ 817:	89 43 08             	mov    %eax,0x8(%ebx)
+ 81a:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+ 81e:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 823:	74 3b                	je     860 <printint+0xe0>
+ 825:	80 fa 0a             	cmp    $0xa,%dl
+ 828:	75 d1                	jne    7fb <printint+0x7b>
+ 82a:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+ 82e:	75 cb                	jne    7fb <printint+0x7b>
+  if(b->n > 0)
+ 830:	85 c0                	test   %eax,%eax
+ 832:	7f 2c                	jg     860 <printint+0xe0>
+  b->n = 0;
+ 834:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  while(--i >= 0)
+ 83b:	8d 47 ff             	lea    -0x1(%edi),%eax
+ 83e:	39 fe                	cmp    %edi,%esi
+ 840:	75 c0                	jne    802 <printint+0x82>
+}
+ 842:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 845:	5b                   	pop    %ebx
+ 846:	5e                   	pop    %esi
+ 847:	5f                   	pop    %edi
+ 848:	5d                   	pop    %ebp
+ 849:	c3                   	ret
+ 84a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  neg = 0;
+ 850:	31 c0                	xor    %eax,%eax
+ 852:	e9 51 ff ff ff       	jmp    7a8 <printint+0x28>
+ 857:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 85e:	66 90                	xchg   %ax,%ax
+    _write(b->fd, b->buf, b->n);
+ 860:	83 ec 04             	sub    $0x4,%esp
+ 863:	50                   	push   %eax
+ 864:	8d 43 0c             	lea    0xc(%ebx),%eax
+ 867:	50                   	push   %eax
+ 868:	ff 33                	push   (%ebx)
+ 86a:	e8 71 fd ff ff       	call   5e0 <_write>
+ 86f:	83 c4 10             	add    $0x10,%esp
+ 872:	eb c0                	jmp    834 <printint+0xb4>
+ 874:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 87b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 87f:	90                   	nop
+
+00000880 <putc>:
+{
+ 880:	55                   	push   %ebp
+ 881:	89 e5                	mov    %esp,%ebp
+ 883:	53                   	push   %ebx
+ 884:	89 c3                	mov    %eax,%ebx
+ 886:	83 ec 04             	sub    $0x4,%esp
+  if(b->str){
+ 889:	8b 80 0c 02 00 00    	mov    0x20c(%eax),%eax
+ 88f:	85 c0                	test   %eax,%eax
+ 891:	74 15                	je     8a8 <putc+0x28>
+    *b->str++ = c;
+ 893:	8d 48 01             	lea    0x1(%eax),%ecx
+ 896:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+ 89c:	88 10                	mov    %dl,(%eax)
+}
+ 89e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 8a1:	c9                   	leave
+ 8a2:	c3                   	ret
+ 8a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8a7:	90                   	nop
+  b->buf[b->n++] = c;
+ 8a8:	8b 4b 08             	mov    0x8(%ebx),%ecx
+ 8ab:	8d 41 01             	lea    0x1(%ecx),%eax
+ 8ae:	89 43 08             	mov    %eax,0x8(%ebx)
+ 8b1:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+ 8b5:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 8ba:	74 14                	je     8d0 <putc+0x50>
+ 8bc:	80 fa 0a             	cmp    $0xa,%dl
+ 8bf:	75 dd                	jne    89e <putc+0x1e>
+ 8c1:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+ 8c5:	75 d7                	jne    89e <putc+0x1e>
+  if(b->n > 0)
+ 8c7:	85 c0                	test   %eax,%eax
+ 8c9:	7e 17                	jle    8e2 <putc+0x62>
+ 8cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8cf:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+ 8d0:	83 ec 04             	sub    $0x4,%esp
+ 8d3:	50                   	push   %eax
+ 8d4:	8d 43 0c             	lea    0xc(%ebx),%eax
+ 8d7:	50                   	push   %eax
+ 8d8:	ff 33                	push   (%ebx)
+ 8da:	e8 01 fd ff ff       	call   5e0 <_write>
+ 8df:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+ 8e2:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+ 8e9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 8ec:	c9                   	leave
+ 8ed:	c3                   	ret
+ 8ee:	66 90                	xchg   %ax,%ax
+
+000008f0 <format>:
+
+// Format fmt and the arguments at ap into b.
+// Only understands %d, %x, %p, %s, %c.
+static void
+format(struct outbuf *b, const char *fmt, uint *ap)
+{
+ 8f0:	55                   	push   %ebp
+ 8f1:	89 e5                	mov    %esp,%ebp
+ 8f3:	57                   	push   %edi
+ 8f4:	89 c7                	mov    %eax,%edi
+ 8f6:	56                   	push   %esi
+ 8f7:	53                   	push   %ebx
+ 8f8:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+ 8fb:	0f b6 02             	movzbl (%edx),%eax
+{
+ 8fe:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 901:	84 c0                	test   %al,%al
+ 903:	74 5a                	je     95f <format+0x6f>
+ 905:	8d 5a 01             	lea    0x1(%edx),%ebx
+ 908:	31 f6                	xor    %esi,%esi
+ 90a:	eb 1c                	jmp    928 <format+0x38>
+ 90c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+ 910:	83 f8 25             	cmp    $0x25,%eax
+ 913:	74 3b                	je     950 <format+0x60>
+        state = '%';
+      } else {
+        putc(b, c);
+ 915:	89 ca                	mov    %ecx,%edx
+ 917:	89 f8                	mov    %edi,%eax
+ 919:	e8 62 ff ff ff       	call   880 <putc>
+  for(i = 0; fmt[i]; i++){
+ 91e:	0f b6 03             	movzbl (%ebx),%eax
+ 921:	83 c3 01             	add    $0x1,%ebx
+ 924:	84 c0                	test   %al,%al
+ 926:	74 37                	je     95f <format+0x6f>
+    c = fmt[i] & 0xff;
+ 928:	0f be c8             	movsbl %al,%ecx
+ 92b:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 92e:	85 f6                	test   %esi,%esi
+ 930:	74 de                	je     910 <format+0x20>
+      }
+    } else if(state == '%'){
+ 932:	83 fe 25             	cmp    $0x25,%esi
+ 935:	75 e7                	jne    91e <format+0x2e>
+      if(c == 'd'){
+ 937:	83 f8 25             	cmp    $0x25,%eax
+ 93a:	74 46                	je     982 <format+0x92>
+ 93c:	83 e8 63             	sub    $0x63,%eax
+ 93f:	83 f8 15             	cmp    $0x15,%eax
+ 942:	77 2c                	ja     970 <format+0x80>
+ 944:	ff 24 85 a0 13 00 00 	jmp    *0x13a0(,%eax,4)
+ 94b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 94f:	90                   	nop
+  for(i = 0; fmt[i]; i++){
+ 950:	0f b6 03             	movzbl (%ebx),%eax
+ 953:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+ 956:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+ 95b:	84 c0                	test   %al,%al
+ 95d:	75 c9                	jne    928 <format+0x38>
+        putc(b, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 95f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 962:	5b                   	pop    %ebx
+ 963:	5e                   	pop    %esi
+ 964:	5f                   	pop    %edi
+ 965:	5d                   	pop    %ebp
+ 966:	c3                   	ret
+ 967:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 96e:	66 90                	xchg   %ax,%ax
+        putc(b, '%');
+ 970:	ba 25 00 00 00       	mov    $0x25,%edx
+ 975:	89 f8                	mov    %edi,%eax
+ 977:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+ 97a:	e8 01 ff ff ff       	call   880 <putc>
+        putc(b, c);
+ 97f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ 982:	89 ca                	mov    %ecx,%edx
+ 984:	89 f8                	mov    %edi,%eax
+      state = 0;
+ 986:	31 f6                	xor    %esi,%esi
+        putc(b, c);
+ 988:	e8 f3 fe ff ff       	call   880 <putc>
+ 98d:	eb 8f                	jmp    91e <format+0x2e>
+ 98f:	90                   	nop
+        printint(b, *ap, 16, 0);
+ 990:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+ 993:	83 ec 0c             	sub    $0xc,%esp
+ 996:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 99b:	8b 16                	mov    (%esi),%edx
+ 99d:	6a 00                	push   $0x0
+        ap++;
+ 99f:	83 c6 04             	add    $0x4,%esi
+        printint(b, *ap, 16, 0);
+ 9a2:	89 f8                	mov    %edi,%eax
+ 9a4:	e8 d7 fd ff ff       	call   780 <printint>
+        ap++;
+ 9a9:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+ 9ac:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 9af:	31 f6                	xor    %esi,%esi
+ 9b1:	e9 68 ff ff ff       	jmp    91e <format+0x2e>
+ 9b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9bd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 9c0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 9c3:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 9c5:	83 c0 04             	add    $0x4,%eax
+ 9c8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 9cb:	85 f6                	test   %esi,%esi
+ 9cd:	75 1b                	jne    9ea <format+0xfa>
+ 9cf:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+ 9d4:	be 98 13 00 00       	mov    $0x1398,%esi
+ 9d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+          putc(b, *s);
+ 9e0:	89 f8                	mov    %edi,%eax
+          s++;
+ 9e2:	83 c6 01             	add    $0x1,%esi
+          putc(b, *s);
+ 9e5:	e8 96 fe ff ff       	call   880 <putc>
+        while(*s != 0){
+ 9ea:	0f be 16             	movsbl (%esi),%edx
+ 9ed:	84 d2                	test   %dl,%dl
+ 9ef:	75 ef                	jne    9e0 <format+0xf0>
+      state = 0;
+ 9f1:	31 f6                	xor    %esi,%esi
+ 9f3:	e9 26 ff ff ff       	jmp    91e <format+0x2e>
+ 9f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9ff:	90                   	nop
+        printint(b, *ap, 10, 1);
+ a00:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+ a03:	83 ec 0c             	sub    $0xc,%esp
+ a06:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ a0b:	8b 16                	mov    (%esi),%edx
+ a0d:	6a 01                	push   $0x1
+ a0f:	eb 8e                	jmp    99f <format+0xaf>
+ a11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(b, *ap);
+ a18:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+ a1b:	89 f8                	mov    %edi,%eax
+ a1d:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+ a20:	83 c6 04             	add    $0x4,%esi
+        putc(b, *ap);
+ a23:	e8 58 fe ff ff       	call   880 <putc>
+        ap++;
+ a28:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      state = 0;
+ a2b:	31 f6                	xor    %esi,%esi
+ a2d:	e9 ec fe ff ff       	jmp    91e <format+0x2e>
+ a32:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000a40 <fflush>:
+{
+ a40:	55                   	push   %ebp
+ a41:	89 e5                	mov    %esp,%ebp
+ a43:	83 ec 08             	sub    $0x8,%esp
+  if(fd == stdout.fd)
+ a46:	8b 45 08             	mov    0x8(%ebp),%eax
+ a49:	39 05 00 20 00 00    	cmp    %eax,0x2000
+ a4f:	74 07                	je     a58 <fflush+0x18>
+}
+ a51:	c9                   	leave
+ a52:	c3                   	ret
+ a53:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a57:	90                   	nop
+  umtxlock(&stdoutlock);
+ a58:	83 ec 0c             	sub    $0xc,%esp
+ a5b:	68 14 22 00 00       	push   $0x2214
+ a60:	e8 db fa ff ff       	call   540 <umtxlock>
+  if(b->n > 0)
+ a65:	a1 08 20 00 00       	mov    0x2008,%eax
+ a6a:	83 c4 10             	add    $0x10,%esp
+ a6d:	85 c0                	test   %eax,%eax
+ a6f:	7f 1f                	jg     a90 <fflush+0x50>
+  b->n = 0;
+ a71:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+ a78:	00 00 00 
+  umtxunlock(&stdoutlock);
+ a7b:	c7 45 08 14 22 00 00 	movl   $0x2214,0x8(%ebp)
+}
+ a82:	c9                   	leave
+  umtxunlock(&stdoutlock);
+ a83:	e9 08 fb ff ff       	jmp    590 <umtxunlock>
+ a88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a8f:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+ a90:	83 ec 04             	sub    $0x4,%esp
+ a93:	50                   	push   %eax
+ a94:	68 0c 20 00 00       	push   $0x200c
+ a99:	ff 35 00 20 00 00    	push   0x2000
+ a9f:	e8 3c fb ff ff       	call   5e0 <_write>
+ aa4:	83 c4 10             	add    $0x10,%esp
+ aa7:	eb c8                	jmp    a71 <fflush+0x31>
+ aa9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000ab0 <setvbuf>:
+{
+ ab0:	55                   	push   %ebp
+ ab1:	89 e5                	mov    %esp,%ebp
+ ab3:	53                   	push   %ebx
+ ab4:	83 ec 04             	sub    $0x4,%esp
+ ab7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd != stdout.fd)
+ aba:	8b 45 08             	mov    0x8(%ebp),%eax
+ abd:	39 05 00 20 00 00    	cmp    %eax,0x2000
+ ac3:	74 0b                	je     ad0 <setvbuf+0x20>
+}
+ ac5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ ac8:	c9                   	leave
+ ac9:	c3                   	ret
+ aca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  umtxlock(&stdoutlock);
+ ad0:	83 ec 0c             	sub    $0xc,%esp
+ ad3:	68 14 22 00 00       	push   $0x2214
+ ad8:	e8 63 fa ff ff       	call   540 <umtxlock>
+  if(b->n > 0)
+ add:	a1 08 20 00 00       	mov    0x2008,%eax
+ ae2:	83 c4 10             	add    $0x10,%esp
+ ae5:	85 c0                	test   %eax,%eax
+ ae7:	7f 2f                	jg     b18 <setvbuf+0x68>
+  b->n = 0;
+ ae9:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+ af0:	00 00 00 
+  stdout.mode = mode;
+ af3:	89 1d 04 20 00 00    	mov    %ebx,0x2004
+  flushhook = flushall;
+ af9:	c7 05 10 22 00 00 30 	movl   $0x730,0x2210
+ b00:	07 00 00 
+}
+ b03:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&stdoutlock);
+ b06:	c7 45 08 14 22 00 00 	movl   $0x2214,0x8(%ebp)
+}
+ b0d:	c9                   	leave
+  umtxunlock(&stdoutlock);
+ b0e:	e9 7d fa ff ff       	jmp    590 <umtxunlock>
+ b13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b17:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+ b18:	83 ec 04             	sub    $0x4,%esp
+ b1b:	50                   	push   %eax
+ b1c:	68 0c 20 00 00       	push   $0x200c
+ b21:	ff 35 00 20 00 00    	push   0x2000
+ b27:	e8 b4 fa ff ff       	call   5e0 <_write>
+ b2c:	83 c4 10             	add    $0x10,%esp
+ b2f:	eb b8                	jmp    ae9 <setvbuf+0x39>
+ b31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b3f:	90                   	nop
+
+00000b40 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s, %c.
+void
+printf(int fd, const char *fmt, ...)
+{
+ b40:	55                   	push   %ebp
+ b41:	89 e5                	mov    %esp,%ebp
+ b43:	53                   	push   %ebx
+ b44:	81 ec 14 02 00 00    	sub    $0x214,%esp
+ b4a:	8b 45 08             	mov    0x8(%ebp),%eax
+    local.mode = _IONBF;
+    local.n = 0;
+    local.str = 0;
+    b = &local;
+  }
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+ b4d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd == stdout.fd){
+ b50:	39 05 00 20 00 00    	cmp    %eax,0x2000
+ b56:	74 48                	je     ba0 <printf+0x60>
+    local.fd = fd;
+ b58:	89 85 e8 fd ff ff    	mov    %eax,-0x218(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+ b5e:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ b61:	89 da                	mov    %ebx,%edx
+ b63:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+    local.mode = _IONBF;
+ b69:	c7 85 ec fd ff ff 03 	movl   $0x3,-0x214(%ebp)
+ b70:	00 00 00 
+    local.n = 0;
+ b73:	c7 85 f0 fd ff ff 00 	movl   $0x0,-0x210(%ebp)
+ b7a:	00 00 00 
+    local.str = 0;
+ b7d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+ b84:	e8 67 fd ff ff       	call   8f0 <format>
+  if(b->mode == _IONBF)
+ b89:	83 bd ec fd ff ff 03 	cmpl   $0x3,-0x214(%ebp)
+ b90:	0f 84 a2 00 00 00    	je     c38 <printf+0xf8>
+    flush(b);
+  if(b == &stdout)
+    umtxunlock(&stdoutlock);
+}
+ b96:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ b99:	c9                   	leave
+ b9a:	c3                   	ret
+ b9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b9f:	90                   	nop
+    umtxlock(&stdoutlock);
+ ba0:	83 ec 0c             	sub    $0xc,%esp
+ ba3:	68 14 22 00 00       	push   $0x2214
+ ba8:	e8 93 f9 ff ff       	call   540 <umtxlock>
+  if(stdout.mode == 0){
+ bad:	a1 04 20 00 00       	mov    0x2004,%eax
+ bb2:	83 c4 10             	add    $0x10,%esp
+ bb5:	85 c0                	test   %eax,%eax
+ bb7:	74 37                	je     bf0 <printf+0xb0>
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+ bb9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ bbc:	89 da                	mov    %ebx,%edx
+ bbe:	b8 00 20 00 00       	mov    $0x2000,%eax
+ bc3:	e8 28 fd ff ff       	call   8f0 <format>
+  if(b->mode == _IONBF)
+ bc8:	83 3d 04 20 00 00 03 	cmpl   $0x3,0x2004
+ bcf:	0f 84 ab 00 00 00    	je     c80 <printf+0x140>
+    umtxunlock(&stdoutlock);
+ bd5:	83 ec 0c             	sub    $0xc,%esp
+ bd8:	68 14 22 00 00       	push   $0x2214
+ bdd:	e8 ae f9 ff ff       	call   590 <umtxunlock>
+}
+ be2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    umtxunlock(&stdoutlock);
+ be5:	83 c4 10             	add    $0x10,%esp
+}
+ be8:	c9                   	leave
+ be9:	c3                   	ret
+ bea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+ bf0:	83 ec 08             	sub    $0x8,%esp
+ bf3:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+ bf9:	50                   	push   %eax
+ bfa:	ff 35 00 20 00 00    	push   0x2000
+ c00:	e8 13 fa ff ff       	call   618 <fstat>
+ c05:	83 c4 10             	add    $0x10,%esp
+ c08:	89 c2                	mov    %eax,%edx
+      stdout.mode = _IOFBF;
+ c0a:	b8 01 00 00 00       	mov    $0x1,%eax
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+ c0f:	85 d2                	test   %edx,%edx
+ c11:	75 10                	jne    c23 <printf+0xe3>
+      stdout.mode = _IOLBF;
+ c13:	31 c0                	xor    %eax,%eax
+ c15:	66 83 bd e8 fd ff ff 	cmpw   $0x3,-0x218(%ebp)
+ c1c:	03 
+ c1d:	0f 94 c0             	sete   %al
+ c20:	83 c0 01             	add    $0x1,%eax
+ c23:	a3 04 20 00 00       	mov    %eax,0x2004
+    flushhook = flushall;
+ c28:	c7 05 10 22 00 00 30 	movl   $0x730,0x2210
+ c2f:	07 00 00 
+ c32:	eb 85                	jmp    bb9 <printf+0x79>
+ c34:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(b->n > 0)
+ c38:	8b 85 f0 fd ff ff    	mov    -0x210(%ebp),%eax
+ c3e:	85 c0                	test   %eax,%eax
+ c40:	0f 8e 50 ff ff ff    	jle    b96 <printf+0x56>
+    b = &local;
+ c46:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+    _write(b->fd, b->buf, b->n);
+ c4c:	83 ec 04             	sub    $0x4,%esp
+ c4f:	50                   	push   %eax
+ c50:	8d 43 0c             	lea    0xc(%ebx),%eax
+ c53:	50                   	push   %eax
+ c54:	ff 33                	push   (%ebx)
+ c56:	e8 85 f9 ff ff       	call   5e0 <_write>
+  b->n = 0;
+ c5b:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  if(b == &stdout)
+ c62:	83 c4 10             	add    $0x10,%esp
+ c65:	81 fb 00 20 00 00    	cmp    $0x2000,%ebx
+ c6b:	0f 85 25 ff ff ff    	jne    b96 <printf+0x56>
+ c71:	e9 5f ff ff ff       	jmp    bd5 <printf+0x95>
+ c76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c7d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(b->n > 0)
+ c80:	a1 08 20 00 00       	mov    0x2008,%eax
+    b = getstdout();
+ c85:	bb 00 20 00 00       	mov    $0x2000,%ebx
+  if(b->n > 0)
+ c8a:	85 c0                	test   %eax,%eax
+ c8c:	7f be                	jg     c4c <printf+0x10c>
+  b->n = 0;
+ c8e:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+ c95:	00 00 00 
+  if(b == &stdout)
+ c98:	e9 38 ff ff ff       	jmp    bd5 <printf+0x95>
+ c9d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ca0 <sprintf>:
+
+// Print to the given buffer. Only understands %d, %x, %p, %s, %c.
+int
+sprintf(char *str, const char *fmt, ...)
+{
+ ca0:	55                   	push   %ebp
+ ca1:	89 e5                	mov    %esp,%ebp
+ ca3:	53                   	push   %ebx
+  struct outbuf b;
+
+  b.str = str;
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+ ca4:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+ caa:	8d 4d 10             	lea    0x10(%ebp),%ecx
+{
+ cad:	81 ec 14 02 00 00    	sub    $0x214,%esp
+ cb3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+ cb6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  b.str = str;
+ cb9:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+ cbc:	e8 2f fc ff ff       	call   8f0 <format>
+  *b.str = '\0';
+ cc1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cc4:	c6 00 00             	movb   $0x0,(%eax)
+  return b.str - str;
+ cc7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cca:	29 d8                	sub    %ebx,%eax
+}
+ ccc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ ccf:	c9                   	leave
+ cd0:	c3                   	ret
+ cd1:	66 90                	xchg   %ax,%ax
+ cd3:	66 90                	xchg   %ax,%ax
+ cd5:	66 90                	xchg   %ax,%ax
+ cd7:	66 90                	xchg   %ax,%ax
+ cd9:	66 90                	xchg   %ax,%ax
+ cdb:	66 90                	xchg   %ax,%ax
+ cdd:	66 90                	xchg   %ax,%ax
+ cdf:	90                   	nop
+
+00000ce0 <freeblock>:
+static Header *freep;
+static struct umutex lock;  // threads made by clone() share the heap
+
+static void
+freeblock(void *ap)
+{
+ ce0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ ce1:	8d 48 f8             	lea    -0x8(%eax),%ecx
+{
+ ce4:	89 e5                	mov    %esp,%ebp
+ ce6:	57                   	push   %edi
+ ce7:	56                   	push   %esi
+ ce8:	53                   	push   %ebx
+ ce9:	89 c3                	mov    %eax,%ebx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ ceb:	a1 1c 22 00 00       	mov    0x221c,%eax
+ cf0:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ cf2:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ cf4:	39 ca                	cmp    %ecx,%edx
+ cf6:	73 30                	jae    d28 <freeblock+0x48>
+ cf8:	39 c1                	cmp    %eax,%ecx
+ cfa:	72 04                	jb     d00 <freeblock+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ cfc:	39 c2                	cmp    %eax,%edx
+ cfe:	72 f0                	jb     cf0 <freeblock+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ d00:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ d03:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ d06:	39 f8                	cmp    %edi,%eax
+ d08:	74 26                	je     d30 <freeblock+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ d0a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ d0d:	8b 42 04             	mov    0x4(%edx),%eax
+ d10:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ d13:	39 f1                	cmp    %esi,%ecx
+ d15:	74 30                	je     d47 <freeblock+0x67>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ d17:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ d19:	5b                   	pop    %ebx
+  freep = p;
+ d1a:	89 15 1c 22 00 00    	mov    %edx,0x221c
+}
+ d20:	5e                   	pop    %esi
+ d21:	5f                   	pop    %edi
+ d22:	5d                   	pop    %ebp
+ d23:	c3                   	ret
+ d24:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d28:	39 c1                	cmp    %eax,%ecx
+ d2a:	72 d0                	jb     cfc <freeblock+0x1c>
+ d2c:	eb c2                	jmp    cf0 <freeblock+0x10>
+ d2e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ d30:	03 70 04             	add    0x4(%eax),%esi
+ d33:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ d36:	8b 02                	mov    (%edx),%eax
+ d38:	8b 00                	mov    (%eax),%eax
+ d3a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ d3d:	8b 42 04             	mov    0x4(%edx),%eax
+ d40:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ d43:	39 f1                	cmp    %esi,%ecx
+ d45:	75 d0                	jne    d17 <freeblock+0x37>
+    p->s.size += bp->s.size;
+ d47:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ d4a:	89 15 1c 22 00 00    	mov    %edx,0x221c
+    p->s.size += bp->s.size;
+ d50:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ d53:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ d56:	89 0a                	mov    %ecx,(%edx)
+}
+ d58:	5b                   	pop    %ebx
+ d59:	5e                   	pop    %esi
+ d5a:	5f                   	pop    %edi
+ d5b:	5d                   	pop    %ebp
+ d5c:	c3                   	ret
+ d5d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000d60 <free>:
+
+void
+free(void *ap)
+{
+ d60:	55                   	push   %ebp
+ d61:	89 e5                	mov    %esp,%ebp
+ d63:	53                   	push   %ebx
+ d64:	83 ec 10             	sub    $0x10,%esp
+ d67:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  umtxlock(&lock);
+ d6a:	68 18 22 00 00       	push   $0x2218
+ d6f:	e8 cc f7 ff ff       	call   540 <umtxlock>
+  freeblock(ap);
+ d74:	89 d8                	mov    %ebx,%eax
+ d76:	e8 65 ff ff ff       	call   ce0 <freeblock>
+  umtxunlock(&lock);
+ d7b:	c7 45 08 18 22 00 00 	movl   $0x2218,0x8(%ebp)
+}
+ d82:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&lock);
+ d85:	83 c4 10             	add    $0x10,%esp
+}
+ d88:	c9                   	leave
+  umtxunlock(&lock);
+ d89:	e9 02 f8 ff ff       	jmp    590 <umtxunlock>
+ d8e:	66 90                	xchg   %ax,%ax
+
+00000d90 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ d90:	55                   	push   %ebp
+ d91:	89 e5                	mov    %esp,%ebp
+ d93:	57                   	push   %edi
+ d94:	56                   	push   %esi
+ d95:	53                   	push   %ebx
+ d96:	83 ec 28             	sub    $0x28,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d99:	8b 45 08             	mov    0x8(%ebp),%eax
+  umtxlock(&lock);
+ d9c:	68 18 22 00 00       	push   $0x2218
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ da1:	8d 48 07             	lea    0x7(%eax),%ecx
+ da4:	c1 e9 03             	shr    $0x3,%ecx
+ da7:	8d 71 01             	lea    0x1(%ecx),%esi
+  umtxlock(&lock);
+ daa:	e8 91 f7 ff ff       	call   540 <umtxlock>
+  if((prevp = freep) == 0){
+ daf:	8b 15 1c 22 00 00    	mov    0x221c,%edx
+ db5:	83 c4 10             	add    $0x10,%esp
+ db8:	85 d2                	test   %edx,%edx
+ dba:	0f 84 b0 00 00 00    	je     e70 <malloc+0xe0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ dc0:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ dc2:	8b 47 04             	mov    0x4(%edi),%eax
+ dc5:	39 f0                	cmp    %esi,%eax
+ dc7:	73 6f                	jae    e38 <malloc+0xa8>
+  if(nu < 4096)
+ dc9:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ dce:	39 de                	cmp    %ebx,%esi
+ dd0:	0f 43 de             	cmovae %esi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ dd3:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ dda:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ ddd:	eb 0a                	jmp    de9 <malloc+0x59>
+ ddf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ de0:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ de2:	8b 47 04             	mov    0x4(%edi),%eax
+ de5:	39 f0                	cmp    %esi,%eax
+ de7:	73 4f                	jae    e38 <malloc+0xa8>
+      }
+      freep = prevp;
+      umtxunlock(&lock);
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ de9:	89 fa                	mov    %edi,%edx
+ deb:	39 3d 1c 22 00 00    	cmp    %edi,0x221c
+ df1:	75 ed                	jne    de0 <malloc+0x50>
+  p = sbrk(nu * sizeof(Header));
+ df3:	83 ec 0c             	sub    $0xc,%esp
+ df6:	ff 75 e4             	push   -0x1c(%ebp)
+ df9:	e8 4a f8 ff ff       	call   648 <sbrk>
+  if(p == (char*)-1)
+ dfe:	83 c4 10             	add    $0x10,%esp
+ e01:	83 f8 ff             	cmp    $0xffffffff,%eax
+ e04:	74 15                	je     e1b <malloc+0x8b>
+  hp->s.size = nu;
+ e06:	89 58 04             	mov    %ebx,0x4(%eax)
+  freeblock((void*)(hp + 1));
+ e09:	83 c0 08             	add    $0x8,%eax
+ e0c:	e8 cf fe ff ff       	call   ce0 <freeblock>
+  return freep;
+ e11:	8b 15 1c 22 00 00    	mov    0x221c,%edx
+      if((p = morecore(nunits)) == 0){
+ e17:	85 d2                	test   %edx,%edx
+ e19:	75 c5                	jne    de0 <malloc+0x50>
+        umtxunlock(&lock);
+ e1b:	83 ec 0c             	sub    $0xc,%esp
+ e1e:	68 18 22 00 00       	push   $0x2218
+ e23:	e8 68 f7 ff ff       	call   590 <umtxunlock>
+        return 0;
+ e28:	83 c4 10             	add    $0x10,%esp
+      }
+  }
+}
+ e2b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ e2e:	31 c0                	xor    %eax,%eax
+}
+ e30:	5b                   	pop    %ebx
+ e31:	5e                   	pop    %esi
+ e32:	5f                   	pop    %edi
+ e33:	5d                   	pop    %ebp
+ e34:	c3                   	ret
+ e35:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ e38:	39 c6                	cmp    %eax,%esi
+ e3a:	74 64                	je     ea0 <malloc+0x110>
+        p->s.size -= nunits;
+ e3c:	29 f0                	sub    %esi,%eax
+ e3e:	89 47 04             	mov    %eax,0x4(%edi)
+        p += p->s.size;
+ e41:	8d 3c c7             	lea    (%edi,%eax,8),%edi
+        p->s.size = nunits;
+ e44:	89 77 04             	mov    %esi,0x4(%edi)
+      umtxunlock(&lock);
+ e47:	83 ec 0c             	sub    $0xc,%esp
+      freep = prevp;
+ e4a:	89 15 1c 22 00 00    	mov    %edx,0x221c
+      umtxunlock(&lock);
+ e50:	68 18 22 00 00       	push   $0x2218
+ e55:	e8 36 f7 ff ff       	call   590 <umtxunlock>
+      return (void*)(p + 1);
+ e5a:	83 c4 10             	add    $0x10,%esp
+}
+ e5d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ e60:	8d 47 08             	lea    0x8(%edi),%eax
+}
+ e63:	5b                   	pop    %ebx
+ e64:	5e                   	pop    %esi
+ e65:	5f                   	pop    %edi
+ e66:	5d                   	pop    %ebp
+ e67:	c3                   	ret
+ e68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e6f:	90                   	nop
+    base.s.ptr = freep = prevp = &base;
+ e70:	c7 05 1c 22 00 00 20 	movl   $0x2220,0x221c
+ e77:	22 00 00 
+    base.s.size = 0;
+ e7a:	bf 20 22 00 00       	mov    $0x2220,%edi
+    base.s.ptr = freep = prevp = &base;
+ e7f:	c7 05 20 22 00 00 20 	movl   $0x2220,0x2220
+ e86:	22 00 00 
+    base.s.size = 0;
+ e89:	c7 05 24 22 00 00 00 	movl   $0x0,0x2224
+ e90:	00 00 00 
+    if(p->s.size >= nunits){
+ e93:	e9 31 ff ff ff       	jmp    dc9 <malloc+0x39>
+ e98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e9f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ ea0:	8b 07                	mov    (%edi),%eax
+ ea2:	89 02                	mov    %eax,(%edx)
+ ea4:	eb a1                	jmp    e47 <malloc+0xb7>
+ ea6:	66 90                	xchg   %ax,%ax
+ ea8:	66 90                	xchg   %ax,%ax
+ eaa:	66 90                	xchg   %ax,%ax
+ eac:	66 90                	xchg   %ax,%ax
+ eae:	66 90                	xchg   %ax,%ax
+
+00000eb0 <threadstart>:
+
+#define TSTACKSZ 4096
+
+static void
+threadstart(void *fn, void *arg)
+{
+ eb0:	55                   	push   %ebp
+ eb1:	89 e5                	mov    %esp,%ebp
+ eb3:	83 ec 14             	sub    $0x14,%esp
+  ((void (*)(void*))fn)(arg);
+ eb6:	ff 75 0c             	push   0xc(%ebp)
+ eb9:	ff 55 08             	call   *0x8(%ebp)
+  exit();
+ ebc:	e8 ef f4 ff ff       	call   3b0 <exit>
+ ec1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ec8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ecf:	90                   	nop
+
+00000ed0 <thread_create>:
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ ed0:	55                   	push   %ebp
+ ed1:	89 e5                	mov    %esp,%ebp
+ ed3:	53                   	push   %ebx
+ ed4:	83 ec 20             	sub    $0x20,%esp
+  char *mem, *stack;
+  int pid;
+
+  if((mem = malloc(2*TSTACKSZ)) == 0)
+ ed7:	68 00 20 00 00       	push   $0x2000
+ edc:	e8 af fe ff ff       	call   d90 <malloc>
+ ee1:	83 c4 10             	add    $0x10,%esp
+ ee4:	85 c0                	test   %eax,%eax
+ ee6:	74 47                	je     f2f <thread_create+0x5f>
+ ee8:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)(((uint)mem + TSTACKSZ - 1) & ~(TSTACKSZ - 1));
+ eea:	8d 80 ff 0f 00 00    	lea    0xfff(%eax),%eax
+ ef0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  *(char**)stack = mem;
+ ef5:	89 18                	mov    %ebx,(%eax)
+  if((pid = clone(threadstart, (void*)fn, arg, stack)) < 0)
+ ef7:	50                   	push   %eax
+ ef8:	ff 75 0c             	push   0xc(%ebp)
+ efb:	ff 75 08             	push   0x8(%ebp)
+ efe:	68 b0 0e 00 00       	push   $0xeb0
+ f03:	e8 08 f8 ff ff       	call   710 <clone>
+ f08:	83 c4 10             	add    $0x10,%esp
+ f0b:	85 c0                	test   %eax,%eax
+ f0d:	78 09                	js     f18 <thread_create+0x48>
+    free(mem);
+  return pid;
+}
+ f0f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ f12:	c9                   	leave
+ f13:	c3                   	ret
+ f14:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    free(mem);
+ f18:	83 ec 0c             	sub    $0xc,%esp
+ f1b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ f1e:	53                   	push   %ebx
+ f1f:	e8 3c fe ff ff       	call   d60 <free>
+ f24:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ f27:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+ f2a:	83 c4 10             	add    $0x10,%esp
+}
+ f2d:	c9                   	leave
+ f2e:	c3                   	ret
+    return -1;
+ f2f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ f34:	eb d9                	jmp    f0f <thread_create+0x3f>
+ f36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ f3d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000f40 <thread_join>:
+
+int
+thread_join(void)
+{
+ f40:	55                   	push   %ebp
+ f41:	89 e5                	mov    %esp,%ebp
+ f43:	83 ec 34             	sub    $0x34,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+ f46:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ f49:	50                   	push   %eax
+ f4a:	e8 c9 f7 ff ff       	call   718 <join>
+ f4f:	83 c4 10             	add    $0x10,%esp
+ f52:	85 c0                	test   %eax,%eax
+ f54:	79 0a                	jns    f60 <thread_join+0x20>
+    free(*(char**)stack);
+  return pid;
+}
+ f56:	c9                   	leave
+ f57:	c3                   	ret
+ f58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ f5f:	90                   	nop
+    free(*(char**)stack);
+ f60:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ f63:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ f66:	83 ec 0c             	sub    $0xc,%esp
+ f69:	ff 32                	push   (%edx)
+ f6b:	e8 f0 fd ff ff       	call   d60 <free>
+ f70:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ f73:	83 c4 10             	add    $0x10,%esp
+}
+ f76:	c9                   	leave
+ f77:	c3                   	ret
@@ -0,0 +1,49 @@
+// Heap growth latency with and without pre-zeroed pages. After
+// a pause that lets idle CPUs fill the kernel's pool of zeroed
+// pages, grow the heap by twice the pool's size, 64KB at a time,
+// timing each sbrk() with the cycle counter. The first half is
+// served from the pool; the second mostly has to zero its pages
+// as it goes (an idle CPU may still be refilling the pool).
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "param.h"
+
+#define STEP   (64*1024)
+#define POOL   (NZEROPAGE*4096)
+
+static inline uint
+cycles(void)
+{
+  uint lo, hi;
+
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+  return lo;
+}
+
+int
+main(int argc, char *argv[])
+{
+  char *oldbrk;
+  uint c0, half[2];
+  int i;
+
+  oldbrk = sbrk(0);
+  sleep(50);
+  half[0] = half[1] = 0;
+  for(i = 0; i < 2*POOL; i += STEP){
+    c0 = cycles();
+    if(sbrk(STEP) == (char*)-1){
+      printf(1, "zerobench: sbrk failed\n");
+      exit();
+    }
+    half[i >= POOL] += cycles() - c0;
+  }
+  printf(1, "zerobench: first %d KB: %d cycles per page\n",
+         POOL/1024, half[0] / (POOL/4096));
+  printf(1, "zerobench: next %d KB: %d cycles per page\n",
+         POOL/1024, half[1] / (POOL/4096));
+  sbrk(oldbrk - sbrk(0));
+  exit();
+}
@@ -0,0 +1,2154 @@
+
+_zombie:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 04             	sub    $0x4,%esp
+  if(fork() > 0)
+  11:	e8 ba 02 00 00       	call   2d0 <fork>
+  16:	85 c0                	test   %eax,%eax
+  18:	7e 0d                	jle    27 <main+0x27>
+    sleep(5);  // Let child exit before parent.
+  1a:	83 ec 0c             	sub    $0xc,%esp
+  1d:	6a 05                	push   $0x5
+  1f:	e8 7c 05 00 00       	call   5a0 <sleep>
+  24:	83 c4 10             	add    $0x10,%esp
+  exit();
+  27:	e8 d4 02 00 00       	call   300 <exit>
+  2c:	66 90                	xchg   %ax,%ax
+  2e:	66 90                	xchg   %ax,%ax
+
+00000030 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  30:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  31:	31 c0                	xor    %eax,%eax
+{
+  33:	89 e5                	mov    %esp,%ebp
+  35:	53                   	push   %ebx
+  36:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  39:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  40:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  44:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  47:	83 c0 01             	add    $0x1,%eax
+  4a:	84 d2                	test   %dl,%dl
+  4c:	75 f2                	jne    40 <strcpy+0x10>
+    ;
+  return os;
+}
+  4e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  51:	89 c8                	mov    %ecx,%eax
+  53:	c9                   	leave
+  54:	c3                   	ret
+  55:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000060 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  60:	55                   	push   %ebp
+  61:	89 e5                	mov    %esp,%ebp
+  63:	53                   	push   %ebx
+  64:	8b 55 08             	mov    0x8(%ebp),%edx
+  67:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  6a:	0f b6 02             	movzbl (%edx),%eax
+  6d:	84 c0                	test   %al,%al
+  6f:	75 17                	jne    88 <strcmp+0x28>
+  71:	eb 3a                	jmp    ad <strcmp+0x4d>
+  73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  77:	90                   	nop
+  78:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  7c:	83 c2 01             	add    $0x1,%edx
+  7f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  82:	84 c0                	test   %al,%al
+  84:	74 1a                	je     a0 <strcmp+0x40>
+    p++, q++;
+  86:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  88:	0f b6 19             	movzbl (%ecx),%ebx
+  8b:	38 c3                	cmp    %al,%bl
+  8d:	74 e9                	je     78 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  8f:	29 d8                	sub    %ebx,%eax
+}
+  91:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  94:	c9                   	leave
+  95:	c3                   	ret
+  96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  9d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  a0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  a4:	31 c0                	xor    %eax,%eax
+  a6:	29 d8                	sub    %ebx,%eax
+}
+  a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  ab:	c9                   	leave
+  ac:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  ad:	0f b6 19             	movzbl (%ecx),%ebx
+  b0:	31 c0                	xor    %eax,%eax
+  b2:	eb db                	jmp    8f <strcmp+0x2f>
+  b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  bf:	90                   	nop
+
+000000c0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+  c0:	55                   	push   %ebp
+  c1:	89 e5                	mov    %esp,%ebp
+  c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  c6:	80 3a 00             	cmpb   $0x0,(%edx)
+  c9:	74 15                	je     e0 <strlen+0x20>
+  cb:	31 c0                	xor    %eax,%eax
+  cd:	8d 76 00             	lea    0x0(%esi),%esi
+  d0:	83 c0 01             	add    $0x1,%eax
+  d3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  d7:	89 c1                	mov    %eax,%ecx
+  d9:	75 f5                	jne    d0 <strlen+0x10>
+    ;
+  return n;
+}
+  db:	89 c8                	mov    %ecx,%eax
+  dd:	5d                   	pop    %ebp
+  de:	c3                   	ret
+  df:	90                   	nop
+  for(n = 0; s[n]; n++)
+  e0:	31 c9                	xor    %ecx,%ecx
+}
+  e2:	5d                   	pop    %ebp
+  e3:	89 c8                	mov    %ecx,%eax
+  e5:	c3                   	ret
+  e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000000f0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  f0:	55                   	push   %ebp
+  f1:	89 e5                	mov    %esp,%ebp
+  f3:	57                   	push   %edi
+  f4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+  f7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  fd:	89 d7                	mov    %edx,%edi
+  ff:	fc                   	cld
+ 100:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 102:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 105:	89 d0                	mov    %edx,%eax
+ 107:	c9                   	leave
+ 108:	c3                   	ret
+ 109:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000110 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+ 110:	55                   	push   %ebp
+ 111:	89 e5                	mov    %esp,%ebp
+ 113:	56                   	push   %esi
+ 114:	53                   	push   %ebx
+ 115:	8b 75 10             	mov    0x10(%ebp),%esi
+ 118:	8b 55 08             	mov    0x8(%ebp),%edx
+ 11b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+ 11e:	85 f6                	test   %esi,%esi
+ 120:	74 2e                	je     150 <memcmp+0x40>
+ 122:	01 c6                	add    %eax,%esi
+ 124:	eb 14                	jmp    13a <memcmp+0x2a>
+ 126:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 12d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+ 130:	83 c0 01             	add    $0x1,%eax
+ 133:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+ 136:	39 f0                	cmp    %esi,%eax
+ 138:	74 16                	je     150 <memcmp+0x40>
+    if(*s1 != *s2)
+ 13a:	0f b6 0a             	movzbl (%edx),%ecx
+ 13d:	0f b6 18             	movzbl (%eax),%ebx
+ 140:	38 d9                	cmp    %bl,%cl
+ 142:	74 ec                	je     130 <memcmp+0x20>
+      return *s1 - *s2;
+ 144:	0f b6 c1             	movzbl %cl,%eax
+ 147:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+ 149:	5b                   	pop    %ebx
+ 14a:	5e                   	pop    %esi
+ 14b:	5d                   	pop    %ebp
+ 14c:	c3                   	ret
+ 14d:	8d 76 00             	lea    0x0(%esi),%esi
+ 150:	5b                   	pop    %ebx
+  return 0;
+ 151:	31 c0                	xor    %eax,%eax
+}
+ 153:	5e                   	pop    %esi
+ 154:	5d                   	pop    %ebp
+ 155:	c3                   	ret
+ 156:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 15d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000160 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 160:	55                   	push   %ebp
+ 161:	89 e5                	mov    %esp,%ebp
+ 163:	8b 45 08             	mov    0x8(%ebp),%eax
+ 166:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 16a:	0f b6 10             	movzbl (%eax),%edx
+ 16d:	84 d2                	test   %dl,%dl
+ 16f:	75 12                	jne    183 <strchr+0x23>
+ 171:	eb 1d                	jmp    190 <strchr+0x30>
+ 173:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 177:	90                   	nop
+ 178:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 17c:	83 c0 01             	add    $0x1,%eax
+ 17f:	84 d2                	test   %dl,%dl
+ 181:	74 0d                	je     190 <strchr+0x30>
+    if(*s == c)
+ 183:	38 d1                	cmp    %dl,%cl
+ 185:	75 f1                	jne    178 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 187:	5d                   	pop    %ebp
+ 188:	c3                   	ret
+ 189:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 190:	31 c0                	xor    %eax,%eax
+}
+ 192:	5d                   	pop    %ebp
+ 193:	c3                   	ret
+ 194:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 19b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 19f:	90                   	nop
+
+000001a0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	57                   	push   %edi
+ 1a4:	56                   	push   %esi
+int
+read(int fd, void *buf, int n)
+{
+  if(flushhook)
+    flushhook();
+  return _read(fd, buf, n);
+ 1a5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 1a8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 1a9:	31 db                	xor    %ebx,%ebx
+{
+ 1ab:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 1ae:	eb 32                	jmp    1e2 <gets+0x42>
+  if(flushhook)
+ 1b0:	a1 10 22 00 00       	mov    0x2210,%eax
+ 1b5:	85 c0                	test   %eax,%eax
+ 1b7:	74 02                	je     1bb <gets+0x1b>
+    flushhook();
+ 1b9:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+ 1bb:	83 ec 04             	sub    $0x4,%esp
+ 1be:	6a 01                	push   $0x1
+ 1c0:	56                   	push   %esi
+ 1c1:	6a 00                	push   $0x0
+ 1c3:	e8 60 03 00 00       	call   528 <_read>
+    if(cc < 1)
+ 1c8:	83 c4 10             	add    $0x10,%esp
+ 1cb:	85 c0                	test   %eax,%eax
+ 1cd:	7e 1d                	jle    1ec <gets+0x4c>
+    buf[i++] = c;
+ 1cf:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1d3:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1d6:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1da:	3c 0a                	cmp    $0xa,%al
+ 1dc:	74 10                	je     1ee <gets+0x4e>
+ 1de:	3c 0d                	cmp    $0xd,%al
+ 1e0:	74 0c                	je     1ee <gets+0x4e>
+  for(i=0; i+1 < max; ){
+ 1e2:	89 df                	mov    %ebx,%edi
+ 1e4:	83 c3 01             	add    $0x1,%ebx
+ 1e7:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1ea:	7c c4                	jl     1b0 <gets+0x10>
+ 1ec:	89 fb                	mov    %edi,%ebx
+  buf[i] = '\0';
+ 1ee:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1f1:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+}
+ 1f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1f8:	5b                   	pop    %ebx
+ 1f9:	5e                   	pop    %esi
+ 1fa:	5f                   	pop    %edi
+ 1fb:	5d                   	pop    %ebp
+ 1fc:	c3                   	ret
+ 1fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000200 <stat>:
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	56                   	push   %esi
+ 204:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+ 205:	83 ec 08             	sub    $0x8,%esp
+ 208:	6a 00                	push   $0x0
+ 20a:	ff 75 08             	push   0x8(%ebp)
+ 20d:	e8 3e 03 00 00       	call   550 <open>
+  if(fd < 0)
+ 212:	83 c4 10             	add    $0x10,%esp
+ 215:	85 c0                	test   %eax,%eax
+ 217:	78 37                	js     250 <stat+0x50>
+  r = fstat(fd, st);
+ 219:	83 ec 08             	sub    $0x8,%esp
+ 21c:	ff 75 0c             	push   0xc(%ebp)
+ 21f:	89 c3                	mov    %eax,%ebx
+ 221:	50                   	push   %eax
+ 222:	e8 41 03 00 00       	call   568 <fstat>
+}
+
+int
+close(int fd)
+{
+  if(flushhook)
+ 227:	83 c4 10             	add    $0x10,%esp
+  r = fstat(fd, st);
+ 22a:	89 c6                	mov    %eax,%esi
+  if(flushhook)
+ 22c:	a1 10 22 00 00       	mov    0x2210,%eax
+ 231:	85 c0                	test   %eax,%eax
+ 233:	74 02                	je     237 <stat+0x37>
+    flushhook();
+ 235:	ff d0                	call   *%eax
+  return _close(fd);
+ 237:	83 ec 0c             	sub    $0xc,%esp
+ 23a:	53                   	push   %ebx
+ 23b:	e8 f8 02 00 00       	call   538 <_close>
+ 240:	83 c4 10             	add    $0x10,%esp
+}
+ 243:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 246:	89 f0                	mov    %esi,%eax
+ 248:	5b                   	pop    %ebx
+ 249:	5e                   	pop    %esi
+ 24a:	5d                   	pop    %ebp
+ 24b:	c3                   	ret
+ 24c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+ 250:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 255:	eb ec                	jmp    243 <stat+0x43>
+ 257:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25e:	66 90                	xchg   %ax,%ax
+
+00000260 <atoi>:
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+ 263:	53                   	push   %ebx
+ 264:	8b 55 08             	mov    0x8(%ebp),%edx
+  while('0' <= *s && *s <= '9')
+ 267:	0f be 02             	movsbl (%edx),%eax
+ 26a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 26d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 270:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 275:	77 1e                	ja     295 <atoi+0x35>
+ 277:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 280:	83 c2 01             	add    $0x1,%edx
+ 283:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 286:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 28a:	0f be 02             	movsbl (%edx),%eax
+ 28d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 290:	80 fb 09             	cmp    $0x9,%bl
+ 293:	76 eb                	jbe    280 <atoi+0x20>
+}
+ 295:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 298:	89 c8                	mov    %ecx,%eax
+ 29a:	c9                   	leave
+ 29b:	c3                   	ret
+ 29c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002a0 <memmove>:
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	57                   	push   %edi
+ 2a4:	56                   	push   %esi
+ 2a5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2a8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2ab:	8b 75 0c             	mov    0xc(%ebp),%esi
+  while(n-- > 0)
+ 2ae:	85 c0                	test   %eax,%eax
+ 2b0:	7e 13                	jle    2c5 <memmove+0x25>
+ 2b2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 2b4:	89 d7                	mov    %edx,%edi
+ 2b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2bd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 2c0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 2c1:	39 f8                	cmp    %edi,%eax
+ 2c3:	75 fb                	jne    2c0 <memmove+0x20>
+}
+ 2c5:	5e                   	pop    %esi
+ 2c6:	89 d0                	mov    %edx,%eax
+ 2c8:	5f                   	pop    %edi
+ 2c9:	5d                   	pop    %ebp
+ 2ca:	c3                   	ret
+ 2cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2cf:	90                   	nop
+
+000002d0 <fork>:
+  if(flushhook)
+ 2d0:	a1 10 22 00 00       	mov    0x2210,%eax
+ 2d5:	85 c0                	test   %eax,%eax
+ 2d7:	74 17                	je     2f0 <fork+0x20>
+{
+ 2d9:	55                   	push   %ebp
+ 2da:	89 e5                	mov    %esp,%ebp
+ 2dc:	83 ec 08             	sub    $0x8,%esp
+    flushhook();
+ 2df:	ff d0                	call   *%eax
+}
+ 2e1:	c9                   	leave
+  return _fork();
+ 2e2:	e9 21 02 00 00       	jmp    508 <_fork>
+ 2e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ee:	66 90                	xchg   %ax,%ax
+ 2f0:	e9 13 02 00 00       	jmp    508 <_fork>
+ 2f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000300 <exit>:
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	83 ec 08             	sub    $0x8,%esp
+  if(flushhook)
+ 306:	a1 10 22 00 00       	mov    0x2210,%eax
+ 30b:	85 c0                	test   %eax,%eax
+ 30d:	74 02                	je     311 <exit+0x11>
+    flushhook();
+ 30f:	ff d0                	call   *%eax
+  _exit();
+ 311:	e8 fa 01 00 00       	call   510 <_exit>
+ 316:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000320 <exec>:
+{
+ 320:	55                   	push   %ebp
+  if(flushhook)
+ 321:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+ 326:	89 e5                	mov    %esp,%ebp
+ 328:	56                   	push   %esi
+ 329:	53                   	push   %ebx
+ 32a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 32d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(flushhook)
+ 330:	85 c0                	test   %eax,%eax
+ 332:	74 02                	je     336 <exec+0x16>
+    flushhook();
+ 334:	ff d0                	call   *%eax
+  return _exec(path, argv);
+ 336:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 339:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 33c:	5b                   	pop    %ebx
+ 33d:	5e                   	pop    %esi
+ 33e:	5d                   	pop    %ebp
+  return _exec(path, argv);
+ 33f:	e9 04 02 00 00       	jmp    548 <_exec>
+ 344:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 34f:	90                   	nop
+
+00000350 <read>:
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	57                   	push   %edi
+ 354:	56                   	push   %esi
+ 355:	53                   	push   %ebx
+ 356:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+ 359:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+ 35e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 361:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 364:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+ 367:	85 c0                	test   %eax,%eax
+ 369:	74 02                	je     36d <read+0x1d>
+    flushhook();
+ 36b:	ff d0                	call   *%eax
+  return _read(fd, buf, n);
+ 36d:	89 7d 10             	mov    %edi,0x10(%ebp)
+ 370:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 373:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 376:	83 c4 0c             	add    $0xc,%esp
+ 379:	5b                   	pop    %ebx
+ 37a:	5e                   	pop    %esi
+ 37b:	5f                   	pop    %edi
+ 37c:	5d                   	pop    %ebp
+  return _read(fd, buf, n);
+ 37d:	e9 a6 01 00 00       	jmp    528 <_read>
+ 382:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 389:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000390 <readv>:
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	57                   	push   %edi
+ 394:	56                   	push   %esi
+ 395:	53                   	push   %ebx
+ 396:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+ 399:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+ 39e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 3a1:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 3a4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+ 3a7:	85 c0                	test   %eax,%eax
+ 3a9:	74 02                	je     3ad <readv+0x1d>
+    flushhook();
+ 3ab:	ff d0                	call   *%eax
+  return _readv(fd, iov, cnt);
+ 3ad:	89 7d 10             	mov    %edi,0x10(%ebp)
+ 3b0:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 3b3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 3b6:	83 c4 0c             	add    $0xc,%esp
+ 3b9:	5b                   	pop    %ebx
+ 3ba:	5e                   	pop    %esi
+ 3bb:	5f                   	pop    %edi
+ 3bc:	5d                   	pop    %ebp
+  return _readv(fd, iov, cnt);
+ 3bd:	e9 76 02 00 00       	jmp    638 <_readv>
+ 3c2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003d0 <write>:
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	57                   	push   %edi
+ 3d4:	56                   	push   %esi
+ 3d5:	53                   	push   %ebx
+ 3d6:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+ 3d9:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+ 3de:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 3e1:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 3e4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+ 3e7:	85 c0                	test   %eax,%eax
+ 3e9:	74 02                	je     3ed <write+0x1d>
+    flushhook();
+ 3eb:	ff d0                	call   *%eax
+  return _write(fd, buf, n);
+ 3ed:	89 7d 10             	mov    %edi,0x10(%ebp)
+ 3f0:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 3f3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 3f6:	83 c4 0c             	add    $0xc,%esp
+ 3f9:	5b                   	pop    %ebx
+ 3fa:	5e                   	pop    %esi
+ 3fb:	5f                   	pop    %edi
+ 3fc:	5d                   	pop    %ebp
+  return _write(fd, buf, n);
+ 3fd:	e9 2e 01 00 00       	jmp    530 <_write>
+ 402:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 409:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000410 <writev>:
+{
+ 410:	55                   	push   %ebp
+ 411:	89 e5                	mov    %esp,%ebp
+ 413:	57                   	push   %edi
+ 414:	56                   	push   %esi
+ 415:	53                   	push   %ebx
+ 416:	83 ec 0c             	sub    $0xc,%esp
+  if(flushhook)
+ 419:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+ 41e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 421:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 424:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(flushhook)
+ 427:	85 c0                	test   %eax,%eax
+ 429:	74 02                	je     42d <writev+0x1d>
+    flushhook();
+ 42b:	ff d0                	call   *%eax
+  return _writev(fd, iov, cnt);
+ 42d:	89 7d 10             	mov    %edi,0x10(%ebp)
+ 430:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 433:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 436:	83 c4 0c             	add    $0xc,%esp
+ 439:	5b                   	pop    %ebx
+ 43a:	5e                   	pop    %esi
+ 43b:	5f                   	pop    %edi
+ 43c:	5d                   	pop    %ebp
+  return _writev(fd, iov, cnt);
+ 43d:	e9 fe 01 00 00       	jmp    640 <_writev>
+ 442:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 449:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000450 <close>:
+{
+ 450:	55                   	push   %ebp
+ 451:	89 e5                	mov    %esp,%ebp
+ 453:	53                   	push   %ebx
+ 454:	83 ec 04             	sub    $0x4,%esp
+  if(flushhook)
+ 457:	a1 10 22 00 00       	mov    0x2210,%eax
+{
+ 45c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(flushhook)
+ 45f:	85 c0                	test   %eax,%eax
+ 461:	74 02                	je     465 <close+0x15>
+    flushhook();
+ 463:	ff d0                	call   *%eax
+  return _close(fd);
+ 465:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 468:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 46b:	c9                   	leave
+  return _close(fd);
+ 46c:	e9 c7 00 00 00       	jmp    538 <_close>
+ 471:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 478:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 47f:	90                   	nop
+
+00000480 <umtxinit>:
+// process that finds the mutex held enters the kernel, to sleep
+// in futexwait() until the holder's umtxunlock() wakes it.
+
+void
+umtxinit(struct umutex *m)
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 483:	8b 45 08             	mov    0x8(%ebp),%eax
+ 486:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 48c:	5d                   	pop    %ebp
+ 48d:	c3                   	ret
+ 48e:	66 90                	xchg   %ax,%ax
+
+00000490 <umtxlock>:
+
+void
+umtxlock(struct umutex *m)
+{
+ 490:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 491:	b8 01 00 00 00       	mov    $0x1,%eax
+ 496:	89 e5                	mov    %esp,%ebp
+ 498:	56                   	push   %esi
+ 499:	53                   	push   %ebx
+ 49a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 49d:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 1) == 0)
+ 4a0:	85 c0                	test   %eax,%eax
+ 4a2:	74 2b                	je     4cf <umtxlock+0x3f>
+ 4a4:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4a9:	f0 87 03             	lock xchg %eax,(%ebx)
+    return;
+  // Mark the mutex contended, so that its holder
+  // wakes a waiter on release, and wait.
+  while(xchg(&m->state, 2) != 0)
+ 4ac:	85 c0                	test   %eax,%eax
+ 4ae:	74 1f                	je     4cf <umtxlock+0x3f>
+ 4b0:	be 02 00 00 00       	mov    $0x2,%esi
+ 4b5:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwait(&m->state, 2);
+ 4b8:	83 ec 08             	sub    $0x8,%esp
+ 4bb:	6a 02                	push   $0x2
+ 4bd:	53                   	push   %ebx
+ 4be:	e8 85 01 00 00       	call   648 <futexwait>
+ 4c3:	89 f0                	mov    %esi,%eax
+ 4c5:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+ 4c8:	83 c4 10             	add    $0x10,%esp
+ 4cb:	85 c0                	test   %eax,%eax
+ 4cd:	75 e9                	jne    4b8 <umtxlock+0x28>
+}
+ 4cf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 4d2:	5b                   	pop    %ebx
+ 4d3:	5e                   	pop    %esi
+ 4d4:	5d                   	pop    %ebp
+ 4d5:	c3                   	ret
+ 4d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000004e0 <umtxunlock>:
+
+void
+umtxunlock(struct umutex *m)
+{
+ 4e0:	55                   	push   %ebp
+ 4e1:	31 c0                	xor    %eax,%eax
+ 4e3:	89 e5                	mov    %esp,%ebp
+ 4e5:	83 ec 08             	sub    $0x8,%esp
+ 4e8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4eb:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 4ee:	83 f8 02             	cmp    $0x2,%eax
+ 4f1:	74 05                	je     4f8 <umtxunlock+0x18>
+    futexwake(&m->state, 1);
+}
+ 4f3:	c9                   	leave
+ 4f4:	c3                   	ret
+ 4f5:	8d 76 00             	lea    0x0(%esi),%esi
+    futexwake(&m->state, 1);
+ 4f8:	83 ec 08             	sub    $0x8,%esp
+ 4fb:	6a 01                	push   $0x1
+ 4fd:	52                   	push   %edx
+ 4fe:	e8 4d 01 00 00       	call   650 <futexwake>
+ 503:	83 c4 10             	add    $0x10,%esp
+}
+ 506:	c9                   	leave
+ 507:	c3                   	ret
+
+00000508 <_fork>:
+  _ ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+ 508:	b8 01 00 00 00       	mov    $0x1,%eax
+ 50d:	cd 40                	int    $0x40
+ 50f:	c3                   	ret
+
+00000510 <_exit>:
+RAWSYSCALL(exit)
+ 510:	b8 02 00 00 00       	mov    $0x2,%eax
+ 515:	cd 40                	int    $0x40
+ 517:	c3                   	ret
+
+00000518 <wait>:
+SYSCALL(wait)
+ 518:	b8 03 00 00 00       	mov    $0x3,%eax
+ 51d:	cd 40                	int    $0x40
+ 51f:	c3                   	ret
+
+00000520 <pipe>:
+SYSCALL(pipe)
+ 520:	b8 04 00 00 00       	mov    $0x4,%eax
+ 525:	cd 40                	int    $0x40
+ 527:	c3                   	ret
+
+00000528 <_read>:
+RAWSYSCALL(read)
+ 528:	b8 05 00 00 00       	mov    $0x5,%eax
+ 52d:	cd 40                	int    $0x40
+ 52f:	c3                   	ret
+
+00000530 <_write>:
+RAWSYSCALL(write)
+ 530:	b8 10 00 00 00       	mov    $0x10,%eax
+ 535:	cd 40                	int    $0x40
+ 537:	c3                   	ret
+
+00000538 <_close>:
+RAWSYSCALL(close)
+ 538:	b8 15 00 00 00       	mov    $0x15,%eax
+ 53d:	cd 40                	int    $0x40
+ 53f:	c3                   	ret
+
+00000540 <kill>:
+SYSCALL(kill)
+ 540:	b8 06 00 00 00       	mov    $0x6,%eax
+ 545:	cd 40                	int    $0x40
+ 547:	c3                   	ret
+
+00000548 <_exec>:
+RAWSYSCALL(exec)
+ 548:	b8 07 00 00 00       	mov    $0x7,%eax
+ 54d:	cd 40                	int    $0x40
+ 54f:	c3                   	ret
+
+00000550 <open>:
+SYSCALL(open)
+ 550:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 555:	cd 40                	int    $0x40
+ 557:	c3                   	ret
+
+00000558 <mknod>:
+SYSCALL(mknod)
+ 558:	b8 11 00 00 00       	mov    $0x11,%eax
+ 55d:	cd 40                	int    $0x40
+ 55f:	c3                   	ret
+
+00000560 <unlink>:
+SYSCALL(unlink)
+ 560:	b8 12 00 00 00       	mov    $0x12,%eax
+ 565:	cd 40                	int    $0x40
+ 567:	c3                   	ret
+
+00000568 <fstat>:
+SYSCALL(fstat)
+ 568:	b8 08 00 00 00       	mov    $0x8,%eax
+ 56d:	cd 40                	int    $0x40
+ 56f:	c3                   	ret
+
+00000570 <link>:
+SYSCALL(link)
+ 570:	b8 13 00 00 00       	mov    $0x13,%eax
+ 575:	cd 40                	int    $0x40
+ 577:	c3                   	ret
+
+00000578 <mkdir>:
+SYSCALL(mkdir)
+ 578:	b8 14 00 00 00       	mov    $0x14,%eax
+ 57d:	cd 40                	int    $0x40
+ 57f:	c3                   	ret
+
+00000580 <chdir>:
+SYSCALL(chdir)
+ 580:	b8 09 00 00 00       	mov    $0x9,%eax
+ 585:	cd 40                	int    $0x40
+ 587:	c3                   	ret
+
+00000588 <dup>:
+SYSCALL(dup)
+ 588:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 58d:	cd 40                	int    $0x40
+ 58f:	c3                   	ret
+
+00000590 <getpid>:
+SYSCALL(getpid)
+ 590:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 595:	cd 40                	int    $0x40
+ 597:	c3                   	ret
+
+00000598 <sbrk>:
+SYSCALL(sbrk)
+ 598:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 59d:	cd 40                	int    $0x40
+ 59f:	c3                   	ret
+
+000005a0 <sleep>:
+SYSCALL(sleep)
+ 5a0:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 5a5:	cd 40                	int    $0x40
+ 5a7:	c3                   	ret
+
+000005a8 <uptime>:
+SYSCALL(uptime)
+ 5a8:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 5ad:	cd 40                	int    $0x40
+ 5af:	c3                   	ret
+
+000005b0 <wolfie>:
+SYSCALL(wolfie)
+ 5b0:	b8 16 00 00 00       	mov    $0x16,%eax
+ 5b5:	cd 40                	int    $0x40
+ 5b7:	c3                   	ret
+
+000005b8 <nice>:
+SYSCALL(nice)
+ 5b8:	b8 17 00 00 00       	mov    $0x17,%eax
+ 5bd:	cd 40                	int    $0x40
+ 5bf:	c3                   	ret
+
+000005c0 <mtxget>:
+SYSCALL(mtxget)
+ 5c0:	b8 18 00 00 00       	mov    $0x18,%eax
+ 5c5:	cd 40                	int    $0x40
+ 5c7:	c3                   	ret
+
+000005c8 <mtxrel>:
+SYSCALL(mtxrel)
+ 5c8:	b8 19 00 00 00       	mov    $0x19,%eax
+ 5cd:	cd 40                	int    $0x40
+ 5cf:	c3                   	ret
+
+000005d0 <mtxacq>:
+SYSCALL(mtxacq)
+ 5d0:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 5d5:	cd 40                	int    $0x40
+ 5d7:	c3                   	ret
+
+000005d8 <mtxdel>:
+SYSCALL(mtxdel)
+ 5d8:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 5dd:	cd 40                	int    $0x40
+ 5df:	c3                   	ret
+
+000005e0 <iostat>:
+SYSCALL(iostat)
+ 5e0:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 5e5:	cd 40                	int    $0x40
+ 5e7:	c3                   	ret
+
+000005e8 <mmap>:
+SYSCALL(mmap)
+ 5e8:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 5ed:	cd 40                	int    $0x40
+ 5ef:	c3                   	ret
+
+000005f0 <munmap>:
+SYSCALL(munmap)
+ 5f0:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 5f5:	cd 40                	int    $0x40
+ 5f7:	c3                   	ret
+
+000005f8 <shmget>:
+SYSCALL(shmget)
+ 5f8:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 5fd:	cd 40                	int    $0x40
+ 5ff:	c3                   	ret
+
+00000600 <shmat>:
+SYSCALL(shmat)
+ 600:	b8 20 00 00 00       	mov    $0x20,%eax
+ 605:	cd 40                	int    $0x40
+ 607:	c3                   	ret
+
+00000608 <shmdt>:
+SYSCALL(shmdt)
+ 608:	b8 21 00 00 00       	mov    $0x21,%eax
+ 60d:	cd 40                	int    $0x40
+ 60f:	c3                   	ret
+
+00000610 <shmdel>:
+SYSCALL(shmdel)
+ 610:	b8 22 00 00 00       	mov    $0x22,%eax
+ 615:	cd 40                	int    $0x40
+ 617:	c3                   	ret
+
+00000618 <syscount>:
+SYSCALL(syscount)
+ 618:	b8 23 00 00 00       	mov    $0x23,%eax
+ 61d:	cd 40                	int    $0x40
+ 61f:	c3                   	ret
+
+00000620 <splice>:
+SYSCALL(splice)
+ 620:	b8 24 00 00 00       	mov    $0x24,%eax
+ 625:	cd 40                	int    $0x40
+ 627:	c3                   	ret
+
+00000628 <tee>:
+SYSCALL(tee)
+ 628:	b8 25 00 00 00       	mov    $0x25,%eax
+ 62d:	cd 40                	int    $0x40
+ 62f:	c3                   	ret
+
+00000630 <sendfile>:
+SYSCALL(sendfile)
+ 630:	b8 26 00 00 00       	mov    $0x26,%eax
+ 635:	cd 40                	int    $0x40
+ 637:	c3                   	ret
+
+00000638 <_readv>:
+RAWSYSCALL(readv)
+ 638:	b8 27 00 00 00       	mov    $0x27,%eax
+ 63d:	cd 40                	int    $0x40
+ 63f:	c3                   	ret
+
+00000640 <_writev>:
+RAWSYSCALL(writev)
+ 640:	b8 28 00 00 00       	mov    $0x28,%eax
+ 645:	cd 40                	int    $0x40
+ 647:	c3                   	ret
+
+00000648 <futexwait>:
+SYSCALL(futexwait)
+ 648:	b8 29 00 00 00       	mov    $0x29,%eax
+ 64d:	cd 40                	int    $0x40
+ 64f:	c3                   	ret
+
+00000650 <futexwake>:
+SYSCALL(futexwake)
+ 650:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 655:	cd 40                	int    $0x40
+ 657:	c3                   	ret
+
+00000658 <lockstat>:
+SYSCALL(lockstat)
+ 658:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 65d:	cd 40                	int    $0x40
+ 65f:	c3                   	ret
+
+00000660 <clone>:
+SYSCALL(clone)
+ 660:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 665:	cd 40                	int    $0x40
+ 667:	c3                   	ret
+
+00000668 <join>:
+SYSCALL(join)
+ 668:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 66d:	cd 40                	int    $0x40
+ 66f:	c3                   	ret
+
+00000670 <stacklimit>:
+SYSCALL(stacklimit)
+ 670:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 675:	cd 40                	int    $0x40
+ 677:	c3                   	ret
+ 678:	66 90                	xchg   %ax,%ax
+ 67a:	66 90                	xchg   %ax,%ax
+ 67c:	66 90                	xchg   %ax,%ax
+ 67e:	66 90                	xchg   %ax,%ax
+
+00000680 <flushall>:
+  b->n = 0;
+}
+
+static void
+flushall(void)
+{
+ 680:	55                   	push   %ebp
+ 681:	89 e5                	mov    %esp,%ebp
+ 683:	83 ec 14             	sub    $0x14,%esp
+  umtxlock(&stdoutlock);
+ 686:	68 14 22 00 00       	push   $0x2214
+ 68b:	e8 00 fe ff ff       	call   490 <umtxlock>
+  if(b->n > 0)
+ 690:	a1 08 20 00 00       	mov    0x2008,%eax
+ 695:	83 c4 10             	add    $0x10,%esp
+ 698:	85 c0                	test   %eax,%eax
+ 69a:	7e 17                	jle    6b3 <flushall+0x33>
+    _write(b->fd, b->buf, b->n);
+ 69c:	83 ec 04             	sub    $0x4,%esp
+ 69f:	50                   	push   %eax
+ 6a0:	68 0c 20 00 00       	push   $0x200c
+ 6a5:	ff 35 00 20 00 00    	push   0x2000
+ 6ab:	e8 80 fe ff ff       	call   530 <_write>
+ 6b0:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+ 6b3:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+ 6ba:	00 00 00 
+  flush(&stdout);
+  umtxunlock(&stdoutlock);
+ 6bd:	83 ec 0c             	sub    $0xc,%esp
+ 6c0:	68 14 22 00 00       	push   $0x2214
+ 6c5:	e8 16 fe ff ff       	call   4e0 <umtxunlock>
+}
+ 6ca:	83 c4 10             	add    $0x10,%esp
+ 6cd:	c9                   	leave
+ 6ce:	c3                   	ret
+ 6cf:	90                   	nop
+
+000006d0 <printint>:
+    flush(b);
+}
+
+static void
+printint(struct outbuf *b, int xx, int base, int sgn)
+{
+ 6d0:	55                   	push   %ebp
+ 6d1:	89 e5                	mov    %esp,%ebp
+ 6d3:	57                   	push   %edi
+ 6d4:	89 cf                	mov    %ecx,%edi
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 6d6:	89 d1                	mov    %edx,%ecx
+{
+ 6d8:	56                   	push   %esi
+ 6d9:	53                   	push   %ebx
+ 6da:	89 c3                	mov    %eax,%ebx
+ 6dc:	83 ec 2c             	sub    $0x2c,%esp
+  if(sgn && xx < 0){
+ 6df:	85 d2                	test   %edx,%edx
+ 6e1:	0f 89 b9 00 00 00    	jns    7a0 <printint+0xd0>
+ 6e7:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 6eb:	0f 84 af 00 00 00    	je     7a0 <printint+0xd0>
+    x = -xx;
+ 6f1:	f7 d9                	neg    %ecx
+    neg = 1;
+ 6f3:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 6f8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 6fb:	31 f6                	xor    %esi,%esi
+ 6fd:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 700:	89 c8                	mov    %ecx,%eax
+ 702:	31 d2                	xor    %edx,%edx
+ 704:	89 f3                	mov    %esi,%ebx
+ 706:	f7 f7                	div    %edi
+ 708:	8d 76 01             	lea    0x1(%esi),%esi
+ 70b:	0f b6 92 c8 12 00 00 	movzbl 0x12c8(%edx),%edx
+ 712:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 716:	89 ca                	mov    %ecx,%edx
+ 718:	89 c1                	mov    %eax,%ecx
+ 71a:	39 fa                	cmp    %edi,%edx
+ 71c:	73 e2                	jae    700 <printint+0x30>
+  if(neg)
+ 71e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 721:	89 d9                	mov    %ebx,%ecx
+ 723:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 726:	85 c0                	test   %eax,%eax
+ 728:	74 07                	je     731 <printint+0x61>
+    buf[i++] = '-';
+ 72a:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 72f:	89 f1                	mov    %esi,%ecx
+ 731:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 734:	89 cf                	mov    %ecx,%edi
+ 736:	01 f7                	add    %esi,%edi
+ 738:	eb 1a                	jmp    754 <printint+0x84>
+ 73a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    *b->str++ = c;
+ 740:	8d 48 01             	lea    0x1(%eax),%ecx
+ 743:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+ 749:	88 10                	mov    %dl,(%eax)
+
+  while(--i >= 0)
+ 74b:	8d 47 ff             	lea    -0x1(%edi),%eax
+ 74e:	39 fe                	cmp    %edi,%esi
+ 750:	74 40                	je     792 <printint+0xc2>
+ 752:	89 c7                	mov    %eax,%edi
+  if(b->str){
+ 754:	8b 83 0c 02 00 00    	mov    0x20c(%ebx),%eax
+    putc(b, buf[i]);
+ 75a:	0f b6 17             	movzbl (%edi),%edx
+  if(b->str){
+ 75d:	85 c0                	test   %eax,%eax
+ 75f:	75 df                	jne    740 <printint+0x70>
+  b->buf[b->n++] = c;
+ 761:	8b 4b 08             	mov    0x8(%ebx),%ecx
+ 764:	8d 41 01             	lea    0x1(%ecx),%eax
+ 767:	89 43 08             	mov    %eax,0x8(%ebx)
+ 76a:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+ 76e:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 773:	74 3b                	je     7b0 <printint+0xe0>
+ 775:	80 fa 0a             	cmp    $0xa,%dl
+ 778:	75 d1                	jne    74b <printint+0x7b>
+ 77a:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+ 77e:	75 cb                	jne    74b <printint+0x7b>
+  if(b->n > 0)
+ 780:	85 c0                	test   %eax,%eax
+ 782:	7f 2c                	jg     7b0 <printint+0xe0>
+  b->n = 0;
+ 784:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  while(--i >= 0)
+ 78b:	8d 47 ff             	lea    -0x1(%edi),%eax
+ 78e:	39 fe                	cmp    %edi,%esi
+ 790:	75 c0                	jne    752 <printint+0x82>
+}
+ 792:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 795:	5b                   	pop    %ebx
+ 796:	5e                   	pop    %esi
+ 797:	5f                   	pop    %edi
+ 798:	5d                   	pop    %ebp
+ 799:	c3                   	ret
+ 79a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  neg = 0;
+ 7a0:	31 c0                	xor    %eax,%eax
+ 7a2:	e9 51 ff ff ff       	jmp    6f8 <printint+0x28>
+ 7a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ae:	66 90                	xchg   %ax,%ax
+    _write(b->fd, b->buf, b->n);
+ 7b0:	83 ec 04             	sub    $0x4,%esp
+ 7b3:	50                   	push   %eax
+ 7b4:	8d 43 0c             	lea    0xc(%ebx),%eax
+ 7b7:	50                   	push   %eax
+ 7b8:	ff 33                	push   (%ebx)
+ 7ba:	e8 71 fd ff ff       	call   530 <_write>
+ 7bf:	83 c4 10             	add    $0x10,%esp
+ 7c2:	eb c0                	jmp    784 <printint+0xb4>
+ 7c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7cf:	90                   	nop
+
+000007d0 <putc>:
+{
+ 7d0:	55                   	push   %ebp
+ 7d1:	89 e5                	mov    %esp,%ebp
+ 7d3:	53                   	push   %ebx
+ 7d4:	89 c3                	mov    %eax,%ebx
+ 7d6:	83 ec 04             	sub    $0x4,%esp
+  if(b->str){
+ 7d9:	8b 80 0c 02 00 00    	mov    0x20c(%eax),%eax
+ 7df:	85 c0                	test   %eax,%eax
+ 7e1:	74 15                	je     7f8 <putc+0x28>
+    *b->str++ = c;
+ 7e3:	8d 48 01             	lea    0x1(%eax),%ecx
+ 7e6:	89 8b 0c 02 00 00    	mov    %ecx,0x20c(%ebx)
+ 7ec:	88 10                	mov    %dl,(%eax)
+}
+ 7ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 7f1:	c9                   	leave
+ 7f2:	c3                   	ret
+ 7f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7f7:	90                   	nop
+  b->buf[b->n++] = c;
+ 7f8:	8b 4b 08             	mov    0x8(%ebx),%ecx
+ 7fb:	8d 41 01             	lea    0x1(%ecx),%eax
+ 7fe:	89 43 08             	mov    %eax,0x8(%ebx)
+ 801:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == BUFSZ || (c == '\n' && b->mode == _IOLBF))
+ 805:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 80a:	74 14                	je     820 <putc+0x50>
+ 80c:	80 fa 0a             	cmp    $0xa,%dl
+ 80f:	75 dd                	jne    7ee <putc+0x1e>
+ 811:	83 7b 04 02          	cmpl   $0x2,0x4(%ebx)
+ 815:	75 d7                	jne    7ee <putc+0x1e>
+  if(b->n > 0)
+ 817:	85 c0                	test   %eax,%eax
+ 819:	7e 17                	jle    832 <putc+0x62>
+ 81b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 81f:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+ 820:	83 ec 04             	sub    $0x4,%esp
+ 823:	50                   	push   %eax
+ 824:	8d 43 0c             	lea    0xc(%ebx),%eax
+ 827:	50                   	push   %eax
+ 828:	ff 33                	push   (%ebx)
+ 82a:	e8 01 fd ff ff       	call   530 <_write>
+ 82f:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+ 832:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+ 839:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 83c:	c9                   	leave
+ 83d:	c3                   	ret
+ 83e:	66 90                	xchg   %ax,%ax
+
+00000840 <format>:
+
+// Format fmt and the arguments at ap into b.
+// Only understands %d, %x, %p, %s, %c.
+static void
+format(struct outbuf *b, const char *fmt, uint *ap)
+{
+ 840:	55                   	push   %ebp
+ 841:	89 e5                	mov    %esp,%ebp
+ 843:	57                   	push   %edi
+ 844:	89 c7                	mov    %eax,%edi
+ 846:	56                   	push   %esi
+ 847:	53                   	push   %ebx
+ 848:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+ 84b:	0f b6 02             	movzbl (%edx),%eax
+{
+ 84e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 851:	84 c0                	test   %al,%al
+ 853:	74 5a                	je     8af <format+0x6f>
+ 855:	8d 5a 01             	lea    0x1(%edx),%ebx
+ 858:	31 f6                	xor    %esi,%esi
+ 85a:	eb 1c                	jmp    878 <format+0x38>
+ 85c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+ 860:	83 f8 25             	cmp    $0x25,%eax
+ 863:	74 3b                	je     8a0 <format+0x60>
+        state = '%';
+      } else {
+        putc(b, c);
+ 865:	89 ca                	mov    %ecx,%edx
+ 867:	89 f8                	mov    %edi,%eax
+ 869:	e8 62 ff ff ff       	call   7d0 <putc>
+  for(i = 0; fmt[i]; i++){
+ 86e:	0f b6 03             	movzbl (%ebx),%eax
+ 871:	83 c3 01             	add    $0x1,%ebx
+ 874:	84 c0                	test   %al,%al
+ 876:	74 37                	je     8af <format+0x6f>
+    c = fmt[i] & 0xff;
+ 878:	0f be c8             	movsbl %al,%ecx
+ 87b:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 87e:	85 f6                	test   %esi,%esi
+ 880:	74 de                	je     860 <format+0x20>
+      }
+    } else if(state == '%'){
+ 882:	83 fe 25             	cmp    $0x25,%esi
+ 885:	75 e7                	jne    86e <format+0x2e>
+      if(c == 'd'){
+ 887:	83 f8 25             	cmp    $0x25,%eax
+ 88a:	74 46                	je     8d2 <format+0x92>
+ 88c:	83 e8 63             	sub    $0x63,%eax
+ 88f:	83 f8 15             	cmp    $0x15,%eax
+ 892:	77 2c                	ja     8c0 <format+0x80>
+ 894:	ff 24 85 70 12 00 00 	jmp    *0x1270(,%eax,4)
+ 89b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 89f:	90                   	nop
+  for(i = 0; fmt[i]; i++){
+ 8a0:	0f b6 03             	movzbl (%ebx),%eax
+ 8a3:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+ 8a6:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+ 8ab:	84 c0                	test   %al,%al
+ 8ad:	75 c9                	jne    878 <format+0x38>
+        putc(b, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 8af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8b2:	5b                   	pop    %ebx
+ 8b3:	5e                   	pop    %esi
+ 8b4:	5f                   	pop    %edi
+ 8b5:	5d                   	pop    %ebp
+ 8b6:	c3                   	ret
+ 8b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8be:	66 90                	xchg   %ax,%ax
+        putc(b, '%');
+ 8c0:	ba 25 00 00 00       	mov    $0x25,%edx
+ 8c5:	89 f8                	mov    %edi,%eax
+ 8c7:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+ 8ca:	e8 01 ff ff ff       	call   7d0 <putc>
+        putc(b, c);
+ 8cf:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ 8d2:	89 ca                	mov    %ecx,%edx
+ 8d4:	89 f8                	mov    %edi,%eax
+      state = 0;
+ 8d6:	31 f6                	xor    %esi,%esi
+        putc(b, c);
+ 8d8:	e8 f3 fe ff ff       	call   7d0 <putc>
+ 8dd:	eb 8f                	jmp    86e <format+0x2e>
+ 8df:	90                   	nop
+        printint(b, *ap, 16, 0);
+ 8e0:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+ 8e3:	83 ec 0c             	sub    $0xc,%esp
+ 8e6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 8eb:	8b 16                	mov    (%esi),%edx
+ 8ed:	6a 00                	push   $0x0
+        ap++;
+ 8ef:	83 c6 04             	add    $0x4,%esi
+        printint(b, *ap, 16, 0);
+ 8f2:	89 f8                	mov    %edi,%eax
+ 8f4:	e8 d7 fd ff ff       	call   6d0 <printint>
+        ap++;
+ 8f9:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+ 8fc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8ff:	31 f6                	xor    %esi,%esi
+ 901:	e9 68 ff ff ff       	jmp    86e <format+0x2e>
+ 906:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 90d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 910:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 913:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 915:	83 c0 04             	add    $0x4,%eax
+ 918:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 91b:	85 f6                	test   %esi,%esi
+ 91d:	75 1b                	jne    93a <format+0xfa>
+ 91f:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+ 924:	be 68 12 00 00       	mov    $0x1268,%esi
+ 929:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+          putc(b, *s);
+ 930:	89 f8                	mov    %edi,%eax
+          s++;
+ 932:	83 c6 01             	add    $0x1,%esi
+          putc(b, *s);
+ 935:	e8 96 fe ff ff       	call   7d0 <putc>
+        while(*s != 0){
+ 93a:	0f be 16             	movsbl (%esi),%edx
+ 93d:	84 d2                	test   %dl,%dl
+ 93f:	75 ef                	jne    930 <format+0xf0>
+      state = 0;
+ 941:	31 f6                	xor    %esi,%esi
+ 943:	e9 26 ff ff ff       	jmp    86e <format+0x2e>
+ 948:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 94f:	90                   	nop
+        printint(b, *ap, 10, 1);
+ 950:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+ 953:	83 ec 0c             	sub    $0xc,%esp
+ 956:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 95b:	8b 16                	mov    (%esi),%edx
+ 95d:	6a 01                	push   $0x1
+ 95f:	eb 8e                	jmp    8ef <format+0xaf>
+ 961:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(b, *ap);
+ 968:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+ 96b:	89 f8                	mov    %edi,%eax
+ 96d:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+ 970:	83 c6 04             	add    $0x4,%esi
+        putc(b, *ap);
+ 973:	e8 58 fe ff ff       	call   7d0 <putc>
+        ap++;
+ 978:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      state = 0;
+ 97b:	31 f6                	xor    %esi,%esi
+ 97d:	e9 ec fe ff ff       	jmp    86e <format+0x2e>
+ 982:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 989:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000990 <fflush>:
+{
+ 990:	55                   	push   %ebp
+ 991:	89 e5                	mov    %esp,%ebp
+ 993:	83 ec 08             	sub    $0x8,%esp
+  if(fd == stdout.fd)
+ 996:	8b 45 08             	mov    0x8(%ebp),%eax
+ 999:	39 05 00 20 00 00    	cmp    %eax,0x2000
+ 99f:	74 07                	je     9a8 <fflush+0x18>
+}
+ 9a1:	c9                   	leave
+ 9a2:	c3                   	ret
+ 9a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9a7:	90                   	nop
+  umtxlock(&stdoutlock);
+ 9a8:	83 ec 0c             	sub    $0xc,%esp
+ 9ab:	68 14 22 00 00       	push   $0x2214
+ 9b0:	e8 db fa ff ff       	call   490 <umtxlock>
+  if(b->n > 0)
+ 9b5:	a1 08 20 00 00       	mov    0x2008,%eax
+ 9ba:	83 c4 10             	add    $0x10,%esp
+ 9bd:	85 c0                	test   %eax,%eax
+ 9bf:	7f 1f                	jg     9e0 <fflush+0x50>
+  b->n = 0;
+ 9c1:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+ 9c8:	00 00 00 
+  umtxunlock(&stdoutlock);
+ 9cb:	c7 45 08 14 22 00 00 	movl   $0x2214,0x8(%ebp)
+}
+ 9d2:	c9                   	leave
+  umtxunlock(&stdoutlock);
+ 9d3:	e9 08 fb ff ff       	jmp    4e0 <umtxunlock>
+ 9d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9df:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+ 9e0:	83 ec 04             	sub    $0x4,%esp
+ 9e3:	50                   	push   %eax
+ 9e4:	68 0c 20 00 00       	push   $0x200c
+ 9e9:	ff 35 00 20 00 00    	push   0x2000
+ 9ef:	e8 3c fb ff ff       	call   530 <_write>
+ 9f4:	83 c4 10             	add    $0x10,%esp
+ 9f7:	eb c8                	jmp    9c1 <fflush+0x31>
+ 9f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000a00 <setvbuf>:
+{
+ a00:	55                   	push   %ebp
+ a01:	89 e5                	mov    %esp,%ebp
+ a03:	53                   	push   %ebx
+ a04:	83 ec 04             	sub    $0x4,%esp
+ a07:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd != stdout.fd)
+ a0a:	8b 45 08             	mov    0x8(%ebp),%eax
+ a0d:	39 05 00 20 00 00    	cmp    %eax,0x2000
+ a13:	74 0b                	je     a20 <setvbuf+0x20>
+}
+ a15:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ a18:	c9                   	leave
+ a19:	c3                   	ret
+ a1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  umtxlock(&stdoutlock);
+ a20:	83 ec 0c             	sub    $0xc,%esp
+ a23:	68 14 22 00 00       	push   $0x2214
+ a28:	e8 63 fa ff ff       	call   490 <umtxlock>
+  if(b->n > 0)
+ a2d:	a1 08 20 00 00       	mov    0x2008,%eax
+ a32:	83 c4 10             	add    $0x10,%esp
+ a35:	85 c0                	test   %eax,%eax
+ a37:	7f 2f                	jg     a68 <setvbuf+0x68>
+  b->n = 0;
+ a39:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+ a40:	00 00 00 
+  stdout.mode = mode;
+ a43:	89 1d 04 20 00 00    	mov    %ebx,0x2004
+  flushhook = flushall;
+ a49:	c7 05 10 22 00 00 80 	movl   $0x680,0x2210
+ a50:	06 00 00 
+}
+ a53:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&stdoutlock);
+ a56:	c7 45 08 14 22 00 00 	movl   $0x2214,0x8(%ebp)
+}
+ a5d:	c9                   	leave
+  umtxunlock(&stdoutlock);
+ a5e:	e9 7d fa ff ff       	jmp    4e0 <umtxunlock>
+ a63:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a67:	90                   	nop
+    _write(b->fd, b->buf, b->n);
+ a68:	83 ec 04             	sub    $0x4,%esp
+ a6b:	50                   	push   %eax
+ a6c:	68 0c 20 00 00       	push   $0x200c
+ a71:	ff 35 00 20 00 00    	push   0x2000
+ a77:	e8 b4 fa ff ff       	call   530 <_write>
+ a7c:	83 c4 10             	add    $0x10,%esp
+ a7f:	eb b8                	jmp    a39 <setvbuf+0x39>
+ a81:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a8f:	90                   	nop
+
+00000a90 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s, %c.
+void
+printf(int fd, const char *fmt, ...)
+{
+ a90:	55                   	push   %ebp
+ a91:	89 e5                	mov    %esp,%ebp
+ a93:	53                   	push   %ebx
+ a94:	81 ec 14 02 00 00    	sub    $0x214,%esp
+ a9a:	8b 45 08             	mov    0x8(%ebp),%eax
+    local.mode = _IONBF;
+    local.n = 0;
+    local.str = 0;
+    b = &local;
+  }
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+ a9d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd == stdout.fd){
+ aa0:	39 05 00 20 00 00    	cmp    %eax,0x2000
+ aa6:	74 48                	je     af0 <printf+0x60>
+    local.fd = fd;
+ aa8:	89 85 e8 fd ff ff    	mov    %eax,-0x218(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+ aae:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ ab1:	89 da                	mov    %ebx,%edx
+ ab3:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+    local.mode = _IONBF;
+ ab9:	c7 85 ec fd ff ff 03 	movl   $0x3,-0x214(%ebp)
+ ac0:	00 00 00 
+    local.n = 0;
+ ac3:	c7 85 f0 fd ff ff 00 	movl   $0x0,-0x210(%ebp)
+ aca:	00 00 00 
+    local.str = 0;
+ acd:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+ ad4:	e8 67 fd ff ff       	call   840 <format>
+  if(b->mode == _IONBF)
+ ad9:	83 bd ec fd ff ff 03 	cmpl   $0x3,-0x214(%ebp)
+ ae0:	0f 84 a2 00 00 00    	je     b88 <printf+0xf8>
+    flush(b);
+  if(b == &stdout)
+    umtxunlock(&stdoutlock);
+}
+ ae6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ ae9:	c9                   	leave
+ aea:	c3                   	ret
+ aeb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ aef:	90                   	nop
+    umtxlock(&stdoutlock);
+ af0:	83 ec 0c             	sub    $0xc,%esp
+ af3:	68 14 22 00 00       	push   $0x2214
+ af8:	e8 93 f9 ff ff       	call   490 <umtxlock>
+  if(stdout.mode == 0){
+ afd:	a1 04 20 00 00       	mov    0x2004,%eax
+ b02:	83 c4 10             	add    $0x10,%esp
+ b05:	85 c0                	test   %eax,%eax
+ b07:	74 37                	je     b40 <printf+0xb0>
+  format(b, fmt, (uint*)(void*)&fmt + 1);
+ b09:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ b0c:	89 da                	mov    %ebx,%edx
+ b0e:	b8 00 20 00 00       	mov    $0x2000,%eax
+ b13:	e8 28 fd ff ff       	call   840 <format>
+  if(b->mode == _IONBF)
+ b18:	83 3d 04 20 00 00 03 	cmpl   $0x3,0x2004
+ b1f:	0f 84 ab 00 00 00    	je     bd0 <printf+0x140>
+    umtxunlock(&stdoutlock);
+ b25:	83 ec 0c             	sub    $0xc,%esp
+ b28:	68 14 22 00 00       	push   $0x2214
+ b2d:	e8 ae f9 ff ff       	call   4e0 <umtxunlock>
+}
+ b32:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    umtxunlock(&stdoutlock);
+ b35:	83 c4 10             	add    $0x10,%esp
+}
+ b38:	c9                   	leave
+ b39:	c3                   	ret
+ b3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+ b40:	83 ec 08             	sub    $0x8,%esp
+ b43:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+ b49:	50                   	push   %eax
+ b4a:	ff 35 00 20 00 00    	push   0x2000
+ b50:	e8 13 fa ff ff       	call   568 <fstat>
+ b55:	83 c4 10             	add    $0x10,%esp
+ b58:	89 c2                	mov    %eax,%edx
+      stdout.mode = _IOFBF;
+ b5a:	b8 01 00 00 00       	mov    $0x1,%eax
+    if(fstat(stdout.fd, &st) == 0 && st.type == T_DEV)
+ b5f:	85 d2                	test   %edx,%edx
+ b61:	75 10                	jne    b73 <printf+0xe3>
+      stdout.mode = _IOLBF;
+ b63:	31 c0                	xor    %eax,%eax
+ b65:	66 83 bd e8 fd ff ff 	cmpw   $0x3,-0x218(%ebp)
+ b6c:	03 
+ b6d:	0f 94 c0             	sete   %al
+ b70:	83 c0 01             	add    $0x1,%eax
+ b73:	a3 04 20 00 00       	mov    %eax,0x2004
+    flushhook = flushall;
+ b78:	c7 05 10 22 00 00 80 	movl   $0x680,0x2210
+ b7f:	06 00 00 
+ b82:	eb 85                	jmp    b09 <printf+0x79>
+ b84:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(b->n > 0)
+ b88:	8b 85 f0 fd ff ff    	mov    -0x210(%ebp),%eax
+ b8e:	85 c0                	test   %eax,%eax
+ b90:	0f 8e 50 ff ff ff    	jle    ae6 <printf+0x56>
+    b = &local;
+ b96:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+    _write(b->fd, b->buf, b->n);
+ b9c:	83 ec 04             	sub    $0x4,%esp
+ b9f:	50                   	push   %eax
+ ba0:	8d 43 0c             	lea    0xc(%ebx),%eax
+ ba3:	50                   	push   %eax
+ ba4:	ff 33                	push   (%ebx)
+ ba6:	e8 85 f9 ff ff       	call   530 <_write>
+  b->n = 0;
+ bab:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  if(b == &stdout)
+ bb2:	83 c4 10             	add    $0x10,%esp
+ bb5:	81 fb 00 20 00 00    	cmp    $0x2000,%ebx
+ bbb:	0f 85 25 ff ff ff    	jne    ae6 <printf+0x56>
+ bc1:	e9 5f ff ff ff       	jmp    b25 <printf+0x95>
+ bc6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bcd:	8d 76 00             	lea    0x0(%esi),%esi
+  if(b->n > 0)
+ bd0:	a1 08 20 00 00       	mov    0x2008,%eax
+    b = getstdout();
+ bd5:	bb 00 20 00 00       	mov    $0x2000,%ebx
+  if(b->n > 0)
+ bda:	85 c0                	test   %eax,%eax
+ bdc:	7f be                	jg     b9c <printf+0x10c>
+  b->n = 0;
+ bde:	c7 05 08 20 00 00 00 	movl   $0x0,0x2008
+ be5:	00 00 00 
+  if(b == &stdout)
+ be8:	e9 38 ff ff ff       	jmp    b25 <printf+0x95>
+ bed:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000bf0 <sprintf>:
+
+// Print to the given buffer. Only understands %d, %x, %p, %s, %c.
+int
+sprintf(char *str, const char *fmt, ...)
+{
+ bf0:	55                   	push   %ebp
+ bf1:	89 e5                	mov    %esp,%ebp
+ bf3:	53                   	push   %ebx
+  struct outbuf b;
+
+  b.str = str;
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+ bf4:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+ bfa:	8d 4d 10             	lea    0x10(%ebp),%ecx
+{
+ bfd:	81 ec 14 02 00 00    	sub    $0x214,%esp
+ c03:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+ c06:	8b 55 0c             	mov    0xc(%ebp),%edx
+  b.str = str;
+ c09:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  format(&b, fmt, (uint*)(void*)&fmt + 1);
+ c0c:	e8 2f fc ff ff       	call   840 <format>
+  *b.str = '\0';
+ c11:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c14:	c6 00 00             	movb   $0x0,(%eax)
+  return b.str - str;
+ c17:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c1a:	29 d8                	sub    %ebx,%eax
+}
+ c1c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ c1f:	c9                   	leave
+ c20:	c3                   	ret
+ c21:	66 90                	xchg   %ax,%ax
+ c23:	66 90                	xchg   %ax,%ax
+ c25:	66 90                	xchg   %ax,%ax
+ c27:	66 90                	xchg   %ax,%ax
+ c29:	66 90                	xchg   %ax,%ax
+ c2b:	66 90                	xchg   %ax,%ax
+ c2d:	66 90                	xchg   %ax,%ax
+ c2f:	90                   	nop
+
+00000c30 <freeblock>:
+static Header *freep;
+static struct umutex lock;  // threads made by clone() share the heap
+
+static void
+freeblock(void *ap)
+{
+ c30:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ c31:	8d 48 f8             	lea    -0x8(%eax),%ecx
+{
+ c34:	89 e5                	mov    %esp,%ebp
+ c36:	57                   	push   %edi
+ c37:	56                   	push   %esi
+ c38:	53                   	push   %ebx
+ c39:	89 c3                	mov    %eax,%ebx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c3b:	a1 1c 22 00 00       	mov    0x221c,%eax
+ c40:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c42:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c44:	39 ca                	cmp    %ecx,%edx
+ c46:	73 30                	jae    c78 <freeblock+0x48>
+ c48:	39 c1                	cmp    %eax,%ecx
+ c4a:	72 04                	jb     c50 <freeblock+0x20>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c4c:	39 c2                	cmp    %eax,%edx
+ c4e:	72 f0                	jb     c40 <freeblock+0x10>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ c50:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ c53:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ c56:	39 f8                	cmp    %edi,%eax
+ c58:	74 26                	je     c80 <freeblock+0x50>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c5a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ c5d:	8b 42 04             	mov    0x4(%edx),%eax
+ c60:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ c63:	39 f1                	cmp    %esi,%ecx
+ c65:	74 30                	je     c97 <freeblock+0x67>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ c67:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ c69:	5b                   	pop    %ebx
+  freep = p;
+ c6a:	89 15 1c 22 00 00    	mov    %edx,0x221c
+}
+ c70:	5e                   	pop    %esi
+ c71:	5f                   	pop    %edi
+ c72:	5d                   	pop    %ebp
+ c73:	c3                   	ret
+ c74:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c78:	39 c1                	cmp    %eax,%ecx
+ c7a:	72 d0                	jb     c4c <freeblock+0x1c>
+ c7c:	eb c2                	jmp    c40 <freeblock+0x10>
+ c7e:	66 90                	xchg   %ax,%ax
+    bp->s.size += p->s.ptr->s.size;
+ c80:	03 70 04             	add    0x4(%eax),%esi
+ c83:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c86:	8b 02                	mov    (%edx),%eax
+ c88:	8b 00                	mov    (%eax),%eax
+ c8a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ c8d:	8b 42 04             	mov    0x4(%edx),%eax
+ c90:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ c93:	39 f1                	cmp    %esi,%ecx
+ c95:	75 d0                	jne    c67 <freeblock+0x37>
+    p->s.size += bp->s.size;
+ c97:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ c9a:	89 15 1c 22 00 00    	mov    %edx,0x221c
+    p->s.size += bp->s.size;
+ ca0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ ca3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ ca6:	89 0a                	mov    %ecx,(%edx)
+}
+ ca8:	5b                   	pop    %ebx
+ ca9:	5e                   	pop    %esi
+ caa:	5f                   	pop    %edi
+ cab:	5d                   	pop    %ebp
+ cac:	c3                   	ret
+ cad:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000cb0 <free>:
+
+void
+free(void *ap)
+{
+ cb0:	55                   	push   %ebp
+ cb1:	89 e5                	mov    %esp,%ebp
+ cb3:	53                   	push   %ebx
+ cb4:	83 ec 10             	sub    $0x10,%esp
+ cb7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  umtxlock(&lock);
+ cba:	68 18 22 00 00       	push   $0x2218
+ cbf:	e8 cc f7 ff ff       	call   490 <umtxlock>
+  freeblock(ap);
+ cc4:	89 d8                	mov    %ebx,%eax
+ cc6:	e8 65 ff ff ff       	call   c30 <freeblock>
+  umtxunlock(&lock);
+ ccb:	c7 45 08 18 22 00 00 	movl   $0x2218,0x8(%ebp)
+}
+ cd2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  umtxunlock(&lock);
+ cd5:	83 c4 10             	add    $0x10,%esp
+}
+ cd8:	c9                   	leave
+  umtxunlock(&lock);
+ cd9:	e9 02 f8 ff ff       	jmp    4e0 <umtxunlock>
+ cde:	66 90                	xchg   %ax,%ax
+
+00000ce0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ ce0:	55                   	push   %ebp
+ ce1:	89 e5                	mov    %esp,%ebp
+ ce3:	57                   	push   %edi
+ ce4:	56                   	push   %esi
+ ce5:	53                   	push   %ebx
+ ce6:	83 ec 28             	sub    $0x28,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ ce9:	8b 45 08             	mov    0x8(%ebp),%eax
+  umtxlock(&lock);
+ cec:	68 18 22 00 00       	push   $0x2218
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ cf1:	8d 48 07             	lea    0x7(%eax),%ecx
+ cf4:	c1 e9 03             	shr    $0x3,%ecx
+ cf7:	8d 71 01             	lea    0x1(%ecx),%esi
+  umtxlock(&lock);
+ cfa:	e8 91 f7 ff ff       	call   490 <umtxlock>
+  if((prevp = freep) == 0){
+ cff:	8b 15 1c 22 00 00    	mov    0x221c,%edx
+ d05:	83 c4 10             	add    $0x10,%esp
+ d08:	85 d2                	test   %edx,%edx
+ d0a:	0f 84 b0 00 00 00    	je     dc0 <malloc+0xe0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d10:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ d12:	8b 47 04             	mov    0x4(%edi),%eax
+ d15:	39 f0                	cmp    %esi,%eax
+ d17:	73 6f                	jae    d88 <malloc+0xa8>
+  if(nu < 4096)
+ d19:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ d1e:	39 de                	cmp    %ebx,%esi
+ d20:	0f 43 de             	cmovae %esi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ d23:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ d2a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ d2d:	eb 0a                	jmp    d39 <malloc+0x59>
+ d2f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d30:	8b 3a                	mov    (%edx),%edi
+    if(p->s.size >= nunits){
+ d32:	8b 47 04             	mov    0x4(%edi),%eax
+ d35:	39 f0                	cmp    %esi,%eax
+ d37:	73 4f                	jae    d88 <malloc+0xa8>
+      }
+      freep = prevp;
+      umtxunlock(&lock);
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ d39:	89 fa                	mov    %edi,%edx
+ d3b:	39 3d 1c 22 00 00    	cmp    %edi,0x221c
+ d41:	75 ed                	jne    d30 <malloc+0x50>
+  p = sbrk(nu * sizeof(Header));
+ d43:	83 ec 0c             	sub    $0xc,%esp
+ d46:	ff 75 e4             	push   -0x1c(%ebp)
+ d49:	e8 4a f8 ff ff       	call   598 <sbrk>
+  if(p == (char*)-1)
+ d4e:	83 c4 10             	add    $0x10,%esp
+ d51:	83 f8 ff             	cmp    $0xffffffff,%eax
+ d54:	74 15                	je     d6b <malloc+0x8b>
+  hp->s.size = nu;
+ d56:	89 58 04             	mov    %ebx,0x4(%eax)
+  freeblock((void*)(hp + 1));
+ d59:	83 c0 08             	add    $0x8,%eax
+ d5c:	e8 cf fe ff ff       	call   c30 <freeblock>
+  return freep;
+ d61:	8b 15 1c 22 00 00    	mov    0x221c,%edx
+      if((p = morecore(nunits)) == 0){
+ d67:	85 d2                	test   %edx,%edx
+ d69:	75 c5                	jne    d30 <malloc+0x50>
+        umtxunlock(&lock);
+ d6b:	83 ec 0c             	sub    $0xc,%esp
+ d6e:	68 18 22 00 00       	push   $0x2218
+ d73:	e8 68 f7 ff ff       	call   4e0 <umtxunlock>
+        return 0;
+ d78:	83 c4 10             	add    $0x10,%esp
+      }
+  }
+}
+ d7b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ d7e:	31 c0                	xor    %eax,%eax
+}
+ d80:	5b                   	pop    %ebx
+ d81:	5e                   	pop    %esi
+ d82:	5f                   	pop    %edi
+ d83:	5d                   	pop    %ebp
+ d84:	c3                   	ret
+ d85:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ d88:	39 c6                	cmp    %eax,%esi
+ d8a:	74 64                	je     df0 <malloc+0x110>
+        p->s.size -= nunits;
+ d8c:	29 f0                	sub    %esi,%eax
+ d8e:	89 47 04             	mov    %eax,0x4(%edi)
+        p += p->s.size;
+ d91:	8d 3c c7             	lea    (%edi,%eax,8),%edi
+        p->s.size = nunits;
+ d94:	89 77 04             	mov    %esi,0x4(%edi)
+      umtxunlock(&lock);
+ d97:	83 ec 0c             	sub    $0xc,%esp
+      freep = prevp;
+ d9a:	89 15 1c 22 00 00    	mov    %edx,0x221c
+      umtxunlock(&lock);
+ da0:	68 18 22 00 00       	push   $0x2218
+ da5:	e8 36 f7 ff ff       	call   4e0 <umtxunlock>
+      return (void*)(p + 1);
+ daa:	83 c4 10             	add    $0x10,%esp
+}
+ dad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ db0:	8d 47 08             	lea    0x8(%edi),%eax
+}
+ db3:	5b                   	pop    %ebx
+ db4:	5e                   	pop    %esi
+ db5:	5f                   	pop    %edi
+ db6:	5d                   	pop    %ebp
+ db7:	c3                   	ret
+ db8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ dbf:	90                   	nop
+    base.s.ptr = freep = prevp = &base;
+ dc0:	c7 05 1c 22 00 00 20 	movl   $0x2220,0x221c
+ dc7:	22 00 00 
+    base.s.size = 0;
+ dca:	bf 20 22 00 00       	mov    $0x2220,%edi
+    base.s.ptr = freep = prevp = &base;
+ dcf:	c7 05 20 22 00 00 20 	movl   $0x2220,0x2220
+ dd6:	22 00 00 
+    base.s.size = 0;
+ dd9:	c7 05 24 22 00 00 00 	movl   $0x0,0x2224
+ de0:	00 00 00 
+    if(p->s.size >= nunits){
+ de3:	e9 31 ff ff ff       	jmp    d19 <malloc+0x39>
+ de8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ def:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ df0:	8b 07                	mov    (%edi),%eax
+ df2:	89 02                	mov    %eax,(%edx)
+ df4:	eb a1                	jmp    d97 <malloc+0xb7>
+ df6:	66 90                	xchg   %ax,%ax
+ df8:	66 90                	xchg   %ax,%ax
+ dfa:	66 90                	xchg   %ax,%ax
+ dfc:	66 90                	xchg   %ax,%ax
+ dfe:	66 90                	xchg   %ax,%ax
+
+00000e00 <threadstart>:
+
+#define TSTACKSZ 4096
+
+static void
+threadstart(void *fn, void *arg)
+{
+ e00:	55                   	push   %ebp
+ e01:	89 e5                	mov    %esp,%ebp
+ e03:	83 ec 14             	sub    $0x14,%esp
+  ((void (*)(void*))fn)(arg);
+ e06:	ff 75 0c             	push   0xc(%ebp)
+ e09:	ff 55 08             	call   *0x8(%ebp)
+  exit();
+ e0c:	e8 ef f4 ff ff       	call   300 <exit>
+ e11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e1f:	90                   	nop
+
+00000e20 <thread_create>:
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ e20:	55                   	push   %ebp
+ e21:	89 e5                	mov    %esp,%ebp
+ e23:	53                   	push   %ebx
+ e24:	83 ec 20             	sub    $0x20,%esp
+  char *mem, *stack;
+  int pid;
+
+  if((mem = malloc(2*TSTACKSZ)) == 0)
+ e27:	68 00 20 00 00       	push   $0x2000
+ e2c:	e8 af fe ff ff       	call   ce0 <malloc>
+ e31:	83 c4 10             	add    $0x10,%esp
+ e34:	85 c0                	test   %eax,%eax
+ e36:	74 47                	je     e7f <thread_create+0x5f>
+ e38:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)(((uint)mem + TSTACKSZ - 1) & ~(TSTACKSZ - 1));
+ e3a:	8d 80 ff 0f 00 00    	lea    0xfff(%eax),%eax
+ e40:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  *(char**)stack = mem;
+ e45:	89 18                	mov    %ebx,(%eax)
+  if((pid = clone(threadstart, (void*)fn, arg, stack)) < 0)
+ e47:	50                   	push   %eax
+ e48:	ff 75 0c             	push   0xc(%ebp)
+ e4b:	ff 75 08             	push   0x8(%ebp)
+ e4e:	68 00 0e 00 00       	push   $0xe00
+ e53:	e8 08 f8 ff ff       	call   660 <clone>
+ e58:	83 c4 10             	add    $0x10,%esp
+ e5b:	85 c0                	test   %eax,%eax
+ e5d:	78 09                	js     e68 <thread_create+0x48>
+    free(mem);
+  return pid;
+}
+ e5f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ e62:	c9                   	leave
+ e63:	c3                   	ret
+ e64:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    free(mem);
+ e68:	83 ec 0c             	sub    $0xc,%esp
+ e6b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ e6e:	53                   	push   %ebx
+ e6f:	e8 3c fe ff ff       	call   cb0 <free>
+ e74:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ e77:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+ e7a:	83 c4 10             	add    $0x10,%esp
+}
+ e7d:	c9                   	leave
+ e7e:	c3                   	ret
+    return -1;
+ e7f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ e84:	eb d9                	jmp    e5f <thread_create+0x3f>
+ e86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e8d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000e90 <thread_join>:
+
+int
+thread_join(void)
+{
+ e90:	55                   	push   %ebp
+ e91:	89 e5                	mov    %esp,%ebp
+ e93:	83 ec 34             	sub    $0x34,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+ e96:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ e99:	50                   	push   %eax
+ e9a:	e8 c9 f7 ff ff       	call   668 <join>
+ e9f:	83 c4 10             	add    $0x10,%esp
+ ea2:	85 c0                	test   %eax,%eax
+ ea4:	79 0a                	jns    eb0 <thread_join+0x20>
+    free(*(char**)stack);
+  return pid;
+}
+ ea6:	c9                   	leave
+ ea7:	c3                   	ret
+ ea8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ eaf:	90                   	nop
+    free(*(char**)stack);
+ eb0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ eb3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ eb6:	83 ec 0c             	sub    $0xc,%esp
+ eb9:	ff 32                	push   (%edx)
+ ebb:	e8 f0 fd ff ff       	call   cb0 <free>
+ ec0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ ec3:	83 c4 10             	add    $0x10,%esp
+}
+ ec6:	c9                   	leave
+ ec7:	c3                   	ret